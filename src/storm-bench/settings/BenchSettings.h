@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+namespace settings {
+/*!
+ * Initialize the settings manager.
+ */
+void initializeBenchSettings(std::string const& name, std::string const& executableName);
+
+/*!
+ * Initialize the settings manager for the kernel microbenchmarks.
+ */
+void initializeMicrobenchSettings(std::string const& name, std::string const& executableName);
+
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,104 @@
+#include "storm-bench/settings/modules/BenchmarkSettings.h"
+
+#include <algorithm>
+
+#include "storm/parser/CSVParser.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string BenchmarkSettings::moduleName = "benchmark";
+const std::vector<std::string> BenchmarkSettings::phaseNames = {"build", "bisimulation", "graph", "vi", "pi", "ovi", "topological", "transient",
+                                                                 "symbolic-build", "dd", "hybrid"};
+
+const std::string BenchmarkSettings::benchmarksOptionName = "benchmarks";
+const std::string BenchmarkSettings::phasesOptionName = "phases";
+const std::string BenchmarkSettings::repetitionsOptionName = "repetitions";
+const std::string BenchmarkSettings::jsonOutputOptionName = "jsonoutput";
+const std::string BenchmarkSettings::transientTimeBoundOptionName = "transienttime";
+
+// A small selection of QVBS models that covers DTMCs, MDPs and CTMCs.
+const std::string defaultBenchmarks = "brp,crowds,nand,consensus,csma,firewire,wlan,cluster,embedded,kanban";
+
+BenchmarkSettings::BenchmarkSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, benchmarksOptionName, false, "Sets the QVBS benchmarks that are to be run.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "values", "A comma separated list of benchmarks of the form 'model[:instance[:property]]'. If no property is "
+                                                   "given, the first property that is a probability or reward operator is used.")
+                                         .setDefaultValueString(defaultBenchmarks)
+                                         .build())
+                        .build());
+    std::string phaseList;
+    for (auto const& phase : phaseNames) {
+        phaseList += (phaseList.empty() ? "" : ",") + phase;
+    }
+    this->addOption(storm::settings::OptionBuilder(moduleName, phasesOptionName, false,
+                                                   "Sets the phases that are measured for each benchmark. The phases symbolic-build, dd and hybrid use the "
+                                                   "symbolic model (built with Sylvan), all other phases use the sparse model.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of phases out of " + phaseList)
+                                         .setDefaultValueString(phaseList)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOptionName, false, "Sets how often each phase is repeated.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of repetitions.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jsonOutputOptionName, false,
+                                                   "Writes the measurements to the given file (instead of the standard output).")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, transientTimeBoundOptionName, false, "Sets the time bound for the transient analysis of CTMCs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("bound", "The time bound.")
+                                         .setDefaultValueDouble(1.0)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+}
+
+std::vector<std::string> BenchmarkSettings::getBenchmarks() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(benchmarksOptionName).getArgumentByName("values").getValueAsString());
+}
+
+std::vector<std::string> BenchmarkSettings::getPhases() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(phasesOptionName).getArgumentByName("values").getValueAsString());
+}
+
+uint64_t BenchmarkSettings::getRepetitions() const {
+    return this->getOption(repetitionsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BenchmarkSettings::isJsonOutputSet() const {
+    return this->getOption(jsonOutputOptionName).getHasOptionBeenSet();
+}
+
+std::string BenchmarkSettings::getJsonOutputFilename() const {
+    return this->getOption(jsonOutputOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+double BenchmarkSettings::getTransientTimeBound() const {
+    return this->getOption(transientTimeBoundOptionName).getArgumentByName("bound").getValueAsDouble();
+}
+
+bool BenchmarkSettings::check() const {
+    for (auto const& phase : getPhases()) {
+        STORM_LOG_THROW(std::find(phaseNames.begin(), phaseNames.end(), phase) != phaseNames.end(), storm::exceptions::InvalidSettingsException,
+                        "Unknown benchmark phase '" << phase << "'.");
+    }
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
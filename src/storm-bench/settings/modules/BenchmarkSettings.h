@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for the performance benchmarks of storm-bench.
+ */
+class BenchmarkSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of benchmark settings.
+     */
+    BenchmarkSettings();
+
+    /*!
+     * Retrieves the benchmarks that are to be run. Each benchmark is given as 'model[:instance[:property]]', where model is the short name of a QVBS model.
+     *
+     * @return The benchmarks.
+     */
+    std::vector<std::string> getBenchmarks() const;
+
+    /*!
+     * Retrieves the phases that are to be measured for each benchmark.
+     *
+     * @return The phases.
+     */
+    std::vector<std::string> getPhases() const;
+
+    /*!
+     * Retrieves how often each phase is repeated.
+     *
+     * @return The number of repetitions.
+     */
+    uint64_t getRepetitions() const;
+
+    /*!
+     * Retrieves whether the results are to be written to a file (instead of the standard output).
+     *
+     * @return True iff the results are to be written to a file.
+     */
+    bool isJsonOutputSet() const;
+
+    /*!
+     * Retrieves the file to which the results are written.
+     *
+     * @return The name of the file.
+     */
+    std::string getJsonOutputFilename() const;
+
+    /*!
+     * Retrieves the time bound that is used for the transient analysis of CTMCs.
+     *
+     * @return The time bound.
+     */
+    double getTransientTimeBound() const;
+
+    bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+    // The names of all phases that can be measured.
+    static const std::vector<std::string> phaseNames;
+
+   private:
+    static const std::string benchmarksOptionName;
+    static const std::string phasesOptionName;
+    static const std::string repetitionsOptionName;
+    static const std::string jsonOutputOptionName;
+    static const std::string transientTimeBoundOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
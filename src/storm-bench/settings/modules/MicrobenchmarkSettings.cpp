@@ -0,0 +1,125 @@
+#include "storm-bench/settings/modules/MicrobenchmarkSettings.h"
+
+#include <algorithm>
+
+#include "storm/parser/CSVParser.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string MicrobenchmarkSettings::moduleName = "microbenchmark";
+const std::vector<std::string> MicrobenchmarkSettings::kernelNames = {
+    "build-matrix", "transpose", "submatrix", "multiply", "native-multiply-reduce", "gmmxx-multiply-reduce", "vi-apply", "vi", "svi", "ii", "ovi",
+    "bitvector",    "hashmap",   "prob01",    "scc",      "mec",                    "expand"};
+
+const std::string MicrobenchmarkSettings::kernelsOptionName = "kernels";
+const std::string MicrobenchmarkSettings::repetitionsOptionName = "repetitions";
+const std::string MicrobenchmarkSettings::warmupOptionName = "warmup";
+const std::string MicrobenchmarkSettings::syntheticStatesOptionName = "syntheticstates";
+const std::string MicrobenchmarkSettings::seedOptionName = "seed";
+const std::string MicrobenchmarkSettings::qvbsBenchmarksOptionName = "qvbs";
+const std::string MicrobenchmarkSettings::jsonOutputOptionName = "jsonoutput";
+
+MicrobenchmarkSettings::MicrobenchmarkSettings() : ModuleSettings(moduleName) {
+    std::string kernelList;
+    for (auto const& kernel : kernelNames) {
+        kernelList += (kernelList.empty() ? "" : ",") + kernel;
+    }
+    this->addOption(storm::settings::OptionBuilder(moduleName, kernelsOptionName, false, "Sets the kernels that are measured for each input.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma separated list of kernels out of " + kernelList)
+                                         .setDefaultValueString(kernelList)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOptionName, false, "Sets how often each kernel is measured.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of repetitions.")
+                                         .setDefaultValueUnsignedInteger(10)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, warmupOptionName, false, "Sets how often each kernel is run before it is measured.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of warmup runs.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, syntheticStatesOptionName, false, "Sets the number of states of the synthetic input.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of states. If zero, only the QVBS benchmarks are considered.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false, "Sets the seed from which the synthetic input is generated.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").setDefaultValueUnsignedInteger(42).build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, qvbsBenchmarksOptionName, false, "Adds QVBS benchmarks as inputs.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "values", "A comma separated list of benchmarks of the form 'model[:instance[:property]]'. If no property is "
+                                                   "given, the first property that is a probability or reward operator is used.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jsonOutputOptionName, false,
+                                                   "Writes the measurements to the given file (instead of the standard output).")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build())
+                        .build());
+}
+
+std::vector<std::string> MicrobenchmarkSettings::getKernels() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(kernelsOptionName).getArgumentByName("values").getValueAsString());
+}
+
+uint64_t MicrobenchmarkSettings::getRepetitions() const {
+    return this->getOption(repetitionsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t MicrobenchmarkSettings::getWarmupRuns() const {
+    return this->getOption(warmupOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t MicrobenchmarkSettings::getSyntheticStates() const {
+    return this->getOption(syntheticStatesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t MicrobenchmarkSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+bool MicrobenchmarkSettings::isQvbsBenchmarksSet() const {
+    return this->getOption(qvbsBenchmarksOptionName).getHasOptionBeenSet();
+}
+
+std::vector<std::string> MicrobenchmarkSettings::getQvbsBenchmarks() const {
+    return storm::parser::parseCommaSeperatedValues(this->getOption(qvbsBenchmarksOptionName).getArgumentByName("values").getValueAsString());
+}
+
+bool MicrobenchmarkSettings::isJsonOutputSet() const {
+    return this->getOption(jsonOutputOptionName).getHasOptionBeenSet();
+}
+
+std::string MicrobenchmarkSettings::getJsonOutputFilename() const {
+    return this->getOption(jsonOutputOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool MicrobenchmarkSettings::check() const {
+    for (auto const& kernel : getKernels()) {
+        STORM_LOG_THROW(std::find(kernelNames.begin(), kernelNames.end(), kernel) != kernelNames.end(), storm::exceptions::InvalidSettingsException,
+                        "Unknown kernel '" << kernel << "'.");
+    }
+    STORM_LOG_THROW(getSyntheticStates() > 0 || isQvbsBenchmarksSet(), storm::exceptions::InvalidSettingsException,
+                    "There is no input for the microbenchmarks. Either set a positive number of synthetic states or give QVBS benchmarks.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for the kernel microbenchmarks of storm-microbench.
+ */
+class MicrobenchmarkSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of microbenchmark settings.
+     */
+    MicrobenchmarkSettings();
+
+    /*!
+     * Retrieves the kernels that are to be measured for each input.
+     *
+     * @return The kernels.
+     */
+    std::vector<std::string> getKernels() const;
+
+    /*!
+     * Retrieves how often each kernel is measured.
+     *
+     * @return The number of repetitions.
+     */
+    uint64_t getRepetitions() const;
+
+    /*!
+     * Retrieves how often each kernel is run before the measured repetitions.
+     *
+     * @return The number of warmup runs.
+     */
+    uint64_t getWarmupRuns() const;
+
+    /*!
+     * Retrieves the number of states of the synthetic input. Zero means that no synthetic input is considered.
+     *
+     * @return The number of states.
+     */
+    uint64_t getSyntheticStates() const;
+
+    /*!
+     * Retrieves the seed from which the synthetic input is generated.
+     *
+     * @return The seed.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves whether QVBS benchmarks are used as additional inputs.
+     *
+     * @return True iff QVBS benchmarks were given.
+     */
+    bool isQvbsBenchmarksSet() const;
+
+    /*!
+     * Retrieves the QVBS benchmarks that are used as additional inputs. Each benchmark is given as 'model[:instance[:property]]'.
+     *
+     * @return The benchmarks.
+     */
+    std::vector<std::string> getQvbsBenchmarks() const;
+
+    /*!
+     * Retrieves whether the results are to be written to a file (instead of the standard output).
+     *
+     * @return True iff the results are to be written to a file.
+     */
+    bool isJsonOutputSet() const;
+
+    /*!
+     * Retrieves the file to which the results are written.
+     *
+     * @return The name of the file.
+     */
+    std::string getJsonOutputFilename() const;
+
+    bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+    // The names of all kernels that can be measured.
+    static const std::vector<std::string> kernelNames;
+
+   private:
+    static const std::string kernelsOptionName;
+    static const std::string repetitionsOptionName;
+    static const std::string warmupOptionName;
+    static const std::string syntheticStatesOptionName;
+    static const std::string seedOptionName;
+    static const std::string qvbsBenchmarksOptionName;
+    static const std::string jsonOutputOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
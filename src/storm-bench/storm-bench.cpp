@@ -0,0 +1,355 @@
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
+
+#include "storm-bench/settings/BenchSettings.h"
+#include "storm-bench/settings/modules/BenchmarkSettings.h"
+#include "storm-bench/utility/BenchmarkUtility.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-version-info/storm-version.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/io/file.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/NondeterministicModel.h"
+#include "storm/models/symbolic/Model.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace bench {
+
+typedef storm::json<double> Json;
+typedef storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> SymbolicModel;
+
+Json skipPhase(std::string const& phase, std::string const& reason) {
+    STORM_PRINT_AND_LOG("  " << phase << ": skipped (" << reason << ").\n");
+    Json result;
+    result["phase"] = phase;
+    result["skipped"] = reason;
+    return result;
+}
+
+/*!
+ * Runs the given phase the given number of times and records the wall time and peak memory usage of each run.
+ * The phase returns additional information (e.g. the number of nonzeros or the result) that is added to the measurement.
+ */
+Json measurePhase(std::string const& phase, uint64_t repetitions, std::function<Json()> const& runPhase) {
+    Json result;
+    result["phase"] = phase;
+    Json wallTimes = Json::array();
+    Json peakMemoryUsages = Json::array();
+    try {
+        for (uint64_t repetition = 0; repetition < repetitions; ++repetition) {
+            resetPeakMemoryUsage();
+            storm::utility::Stopwatch watch(true);
+            Json information = runPhase();
+            watch.stop();
+            wallTimes.push_back(static_cast<double>(watch.getTimeInNanoseconds()) * 1e-9);
+            peakMemoryUsages.push_back(getPeakMemoryUsageInKilobytes());
+            result.update(information);
+        }
+    } catch (storm::exceptions::BaseException const& exception) {
+        // Report the error but continue with the remaining phases.
+        STORM_LOG_ERROR("Phase " << phase << " failed: " << exception.what());
+        result["error"] = exception.what();
+    }
+    result["wall-time-seconds"] = wallTimes;
+    result["peak-rss-kilobytes"] = peakMemoryUsages;
+    if (!wallTimes.empty()) {
+        STORM_PRINT_AND_LOG("  " << phase << ": " << wallTimes.back().get<double>() << "s, " << peakMemoryUsages.back().get<uint64_t>() << "kB.\n");
+    }
+    return result;
+}
+
+Json getInitialStateResult(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::vector<double> const& values) {
+    Json result = Json::object();
+    if (!model->getInitialStates().empty()) {
+        result["result"] = values[*model->getInitialStates().begin()];
+    }
+    return result;
+}
+
+/*!
+ * Restricts the given result of the dd or hybrid engine to the initial states and returns the minimal value over these states.
+ */
+Json getInitialStateResult(std::shared_ptr<SymbolicModel> const& model, storm::modelchecker::CheckResult& checkResult) {
+    Json result = Json::object();
+    if (checkResult.isQuantitative() && !model->getInitialStates().isZero()) {
+        checkResult.filter(
+            storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::Sylvan>(model->getReachableStates(), model->getInitialStates()));
+        result["result"] = checkResult.asQuantitativeCheckResult<double>().getMin();
+    }
+    return result;
+}
+
+/*!
+ * @return The environment for the given solving phase or nothing if the phase is not applicable.
+ */
+std::optional<storm::Environment> getSolverEnvironment(std::string const& phase, bool nondeterministic) {
+    storm::Environment env;
+    if (nondeterministic) {
+        if (phase == "vi") {
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        } else if (phase == "pi") {
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+        } else if (phase == "ovi") {
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        } else {
+            STORM_LOG_ASSERT(phase == "topological", "Unexpected phase " << phase << ".");
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        }
+    } else {
+        if (phase == "vi") {
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        } else if (phase == "pi") {
+            return std::nullopt;
+        } else if (phase == "ovi") {
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration);
+        } else {
+            STORM_LOG_ASSERT(phase == "topological", "Unexpected phase " << phase << ".");
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        }
+    }
+    return env;
+}
+
+Json runBenchmark(BenchmarkSpecification const& specification, storm::settings::modules::BenchmarkSettings const& settings) {
+    Json result;
+    result["model"] = specification.modelName;
+    result["instance"] = specification.instanceIndex;
+
+    // Parse the model and its properties
+    QvbsInput input = loadQvbsInput(specification);
+    storm::storage::SymbolicModelDescription const& modelDescription = input.modelDescription;
+    result["constants"] = input.constantDefinitionString;
+    auto formula = input.formula;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formula};
+    result["property"] = input.propertyName;
+    std::stringstream formulaString;
+    formulaString << *formula;
+    result["formula"] = formulaString.str();
+    STORM_PRINT_AND_LOG("Benchmark " << specification.modelName << " (instance " << specification.instanceIndex << ", property " << input.propertyName
+                                     << "):\n");
+
+    std::vector<std::string> phases = settings.getPhases();
+    uint64_t repetitions = settings.getRepetitions();
+    Json phaseResults = Json::array();
+
+    // The model is always built as all other phases require it, but the time is only reported if requested.
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    auto buildPhase = [&]() {
+        model = storm::api::buildSparseModel<double>(modelDescription, formulas);
+        Json information;
+        information["states"] = model->getNumberOfStates();
+        information["choices"] = model->getNumberOfChoices();
+        information["nonzeros"] = model->getNumberOfTransitions();
+        return information;
+    };
+    if (std::find(phases.begin(), phases.end(), "build") != phases.end()) {
+        phaseResults.push_back(measurePhase("build", repetitions, buildPhase));
+    } else {
+        buildPhase();
+    }
+    STORM_LOG_THROW(model, storm::exceptions::NotSupportedException, "Unable to build the model of benchmark " << specification.modelName << ".");
+    std::stringstream modelType;
+    modelType << model->getType();
+    result["model-type"] = modelType.str();
+    result["states"] = model->getNumberOfStates();
+    result["nonzeros"] = model->getNumberOfTransitions();
+
+    // The symbolic model is only built if one of the phases of the dd or hybrid engine is requested.
+    std::shared_ptr<SymbolicModel> symbolicModel;
+    auto symbolicBuildPhase = [&]() {
+        symbolicModel = storm::api::buildSymbolicModel<storm::dd::DdType::Sylvan, double>(modelDescription, formulas);
+        STORM_LOG_THROW(symbolicModel, storm::exceptions::NotSupportedException,
+                        "Unable to build the symbolic model of benchmark " << specification.modelName << ".");
+        Json information;
+        information["states"] = symbolicModel->getNumberOfStates();
+        information["nonzeros"] = symbolicModel->getNumberOfTransitions();
+        information["dd-nodes"] = symbolicModel->getTransitionMatrix().getNodeCount();
+        return information;
+    };
+
+    auto untilOperands = getUntilOperands(*formula);
+    std::optional<storm::storage::BitVector> phiStates, psiStates;
+    if (untilOperands) {
+        phiStates = getStatesSatisfying(model, untilOperands->first);
+        psiStates = getStatesSatisfying(model, untilOperands->second);
+    }
+
+    for (auto const& phase : phases) {
+        if (phase == "build") {
+            continue;
+        } else if (phase == "symbolic-build") {
+            phaseResults.push_back(measurePhase(phase, repetitions, symbolicBuildPhase));
+        } else if (phase == "dd" || phase == "hybrid") {
+            if (phase == "dd" && !model->isOfType(storm::models::ModelType::Dtmc) && !model->isOfType(storm::models::ModelType::Mdp)) {
+                phaseResults.push_back(skipPhase(phase, "the dd engine only supports DTMCs and MDPs"));
+                continue;
+            }
+            if (!symbolicModel) {
+                symbolicBuildPhase();
+            }
+            phaseResults.push_back(measurePhase(phase, repetitions, [&]() {
+                storm::Environment env;
+                auto task = storm::api::createTask<double>(formula, true);
+                auto checkResult = phase == "dd" ? storm::api::verifyWithDdEngine<storm::dd::DdType::Sylvan, double>(env, symbolicModel, task)
+                                                 : storm::api::verifyWithHybridEngine<storm::dd::DdType::Sylvan, double>(env, symbolicModel, task);
+                STORM_LOG_THROW(checkResult, storm::exceptions::NotSupportedException, "Unable to check property " << *formula << ".");
+                Json information = getInitialStateResult(symbolicModel, *checkResult);
+                information["nonzeros"] = symbolicModel->getNumberOfTransitions();
+                information["dd-nodes"] = symbolicModel->getTransitionMatrix().getNodeCount();
+                return information;
+            }));
+        } else if (phase == "bisimulation") {
+            if (model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                phaseResults.push_back(skipPhase(phase, "bisimulation is not supported for Markov automata"));
+                continue;
+            }
+            phaseResults.push_back(measurePhase(phase, repetitions, [&]() {
+                auto quotient = storm::api::performBisimulationMinimization<double>(model, formulas);
+                Json information;
+                information["states"] = quotient->getNumberOfStates();
+                information["nonzeros"] = quotient->getNumberOfTransitions();
+                return information;
+            }));
+        } else if (phase == "graph") {
+            if (!untilOperands) {
+                phaseResults.push_back(skipPhase(phase, "the property is not a reachability probability"));
+                continue;
+            }
+            phaseResults.push_back(measurePhase(phase, repetitions, [&]() {
+                Json information;
+                information["nonzeros"] = model->getNumberOfTransitions();
+                if (model->isNondeterministicModel()) {
+                    auto const& nondeterministicModel = *model->as<storm::models::sparse::NondeterministicModel<double>>();
+                    auto maxResult = storm::utility::graph::performProb01Max(nondeterministicModel, phiStates.value(), psiStates.value());
+                    auto minResult = storm::utility::graph::performProb01Min(nondeterministicModel, phiStates.value(), psiStates.value());
+                    information["prob0-max"] = maxResult.first.getNumberOfSetBits();
+                    information["prob1-max"] = maxResult.second.getNumberOfSetBits();
+                    information["prob0-min"] = minResult.first.getNumberOfSetBits();
+                    information["prob1-min"] = minResult.second.getNumberOfSetBits();
+                } else {
+                    auto prob01 = storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates.value(), psiStates.value());
+                    information["prob0"] = prob01.first.getNumberOfSetBits();
+                    information["prob1"] = prob01.second.getNumberOfSetBits();
+                }
+                return information;
+            }));
+        } else if (phase == "vi" || phase == "pi" || phase == "ovi" || phase == "topological") {
+            auto env = getSolverEnvironment(phase, model->isNondeterministicModel());
+            if (!env) {
+                phaseResults.push_back(skipPhase(phase, "policy iteration requires a nondeterministic model"));
+                continue;
+            }
+            phaseResults.push_back(measurePhase(phase, repetitions, [&]() {
+                auto checkResult = storm::api::verifyWithSparseEngine<double>(env.value(), model, storm::api::createTask<double>(formula, true));
+                STORM_LOG_THROW(checkResult, storm::exceptions::NotSupportedException, "Unable to check property " << *formula << ".");
+                Json information;
+                information["nonzeros"] = model->getNumberOfTransitions();
+                if (checkResult->isExplicitQuantitativeCheckResult()) {
+                    information.update(getInitialStateResult(model, checkResult->asExplicitQuantitativeCheckResult<double>().getValueVector()));
+                }
+                return information;
+            }));
+        } else {
+            STORM_LOG_ASSERT(phase == "transient", "Unexpected phase " << phase << ".");
+            if (!model->isOfType(storm::models::ModelType::Ctmc)) {
+                phaseResults.push_back(skipPhase(phase, "transient analysis requires a CTMC"));
+                continue;
+            } else if (!untilOperands) {
+                phaseResults.push_back(skipPhase(phase, "the property is not a reachability probability"));
+                continue;
+            }
+            auto ctmc = model->as<storm::models::sparse::Ctmc<double>>();
+            double timeBound = settings.getTransientTimeBound();
+            phaseResults.push_back(measurePhase(phase, repetitions, [&]() {
+                storm::Environment env;
+                auto values = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+                    env, ctmc->getTransitionMatrix(), ctmc->getInitialStates(), phiStates.value(), psiStates.value(), ctmc->getExitRateVector(), timeBound);
+                Json information = getInitialStateResult(model, values);
+                information["nonzeros"] = ctmc->getNumberOfTransitions();
+                information["time-bound"] = timeBound;
+                return information;
+            }));
+        }
+    }
+    result["phases"] = phaseResults;
+    return result;
+}
+
+void processOptions() {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::BenchmarkSettings>();
+
+    Json result;
+    result["storm-version"] = storm::StormVersion::shortVersionString();
+    result["repetitions"] = settings.getRepetitions();
+    Json benchmarkResults = Json::array();
+    for (auto const& benchmark : settings.getBenchmarks()) {
+        auto specification = parseBenchmarkSpecification(benchmark);
+        try {
+            benchmarkResults.push_back(runBenchmark(specification, settings));
+        } catch (storm::exceptions::BaseException const& exception) {
+            // Report the error but continue with the remaining benchmarks.
+            STORM_LOG_ERROR("Benchmark " << benchmark << " failed: " << exception.what());
+            Json benchmarkResult;
+            benchmarkResult["model"] = specification.modelName;
+            benchmarkResult["instance"] = specification.instanceIndex;
+            benchmarkResult["error"] = exception.what();
+            benchmarkResults.push_back(benchmarkResult);
+        }
+    }
+    result["benchmarks"] = benchmarkResults;
+
+    if (settings.isJsonOutputSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(settings.getJsonOutputFilename(), stream);
+        stream << storm::dumpJson(result) << '\n';
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_PRINT(storm::dumpJson(result) << '\n');
+    }
+}
+
+}  // namespace bench
+}  // namespace storm
+
+/*!
+ * Main entry point of the executable storm-bench.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        return storm::cli::process("Storm-bench", "storm-bench", storm::settings::initializeBenchSettings, storm::bench::processOptions, argc, argv);
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-bench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-bench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -0,0 +1,631 @@
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <optional>
+#include <random>
+#include <sstream>
+
+#include "storm-bench/settings/BenchSettings.h"
+#include "storm-bench/settings/modules/MicrobenchmarkSettings.h"
+#include "storm-bench/utility/BenchmarkUtility.h"
+
+#include "storm-cli-utilities/cli.h"
+#include "storm-version-info/storm-version.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/environment/Environment.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/solver/helper/IntervalterationHelper.h"
+#include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/NativeMultiplier.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace bench {
+
+typedef storm::json<double> Json;
+
+// The number of consecutive sweeps of the kernels that take less than a millisecond on a single sweep (e.g. a matrix-vector multiplication).
+uint64_t const numberOfSweeps = 10;
+
+// The precision up to which the value iteration kernels solve the reachability probabilities.
+double const solverPrecision = 1e-6;
+
+/*!
+ * The data on which the kernels operate: a DTMC or MDP together with a reachability objective.
+ */
+struct MicrobenchmarkInput {
+    std::string name;
+    // The transition matrix. It has a trivial row grouping iff the model is deterministic.
+    storm::storage::SparseMatrix<double> transitionMatrix;
+    storm::storage::SparseMatrix<double> backwardTransitions;
+    storm::storage::BitVector phiStates;
+    storm::storage::BitVector psiStates;
+    // The states whose minimal probability to satisfy phi until psi is neither zero nor one and the corresponding equation system x = Ax + b.
+    storm::storage::BitVector maybeStates;
+    storm::storage::SparseMatrix<double> maybeMatrix;
+    std::vector<double> maybeOffsets;
+    // The description of the model (if any), which is used to measure the state space exploration.
+    std::optional<storm::storage::SymbolicModelDescription> modelDescription;
+    uint64_t seed = 0;
+
+    bool isDeterministic() const {
+        return transitionMatrix.hasTrivialRowGrouping();
+    }
+};
+
+/*!
+ * Computes the maybe states of the given input and the equation system for their minimal reachability probabilities.
+ * Restricting to the maybe states of the minimizing objective yields a system without end components, i.e., all value iteration kernels converge.
+ */
+void prepareReachabilitySystem(MicrobenchmarkInput& input) {
+    auto const& matrix = input.transitionMatrix;
+    auto prob01 = input.isDeterministic() ? storm::utility::graph::performProb01(input.backwardTransitions, input.phiStates, input.psiStates)
+                                          : storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), input.backwardTransitions,
+                                                                                    input.phiStates, input.psiStates);
+    input.maybeStates = ~(prob01.first | prob01.second);
+    input.maybeMatrix = matrix.getSubmatrix(true, input.maybeStates, input.maybeStates);
+    input.maybeOffsets = matrix.getConstrainedRowGroupSumVector(input.maybeStates, prob01.second);
+}
+
+/*!
+ * Creates a random MDP with the given number of states (plus an absorbing goal and sink state) that only depends on the given seed.
+ * The successors of a state are close to the state itself such that the accesses have a similar locality as in models built from a breadth first
+ * exploration. The first choice of each state leaks some probability to the goal and the sink. Every eighth state has an additional choice that moves to
+ * the next such state, i.e., these states form an end component.
+ */
+MicrobenchmarkInput createSyntheticInput(uint64_t numberOfStates, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    uint64_t const window = std::min<uint64_t>(64, numberOfStates);
+    uint64_t const goalState = numberOfStates;
+    uint64_t const sinkState = numberOfStates + 1;
+    std::uniform_real_distribution<double> weightDistribution(0.1, 1.0);
+
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    auto addChoice = [&](std::map<uint64_t, double> const& successors) {
+        for (auto const& successor : successors) {
+            builder.addNextValue(row, successor.first, successor.second);
+        }
+        ++row;
+    };
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        uint64_t const numberOfChoices = 1 + generator() % 3;
+        for (uint64_t choice = 0; choice < numberOfChoices; ++choice) {
+            std::map<uint64_t, double> successors;
+            uint64_t const numberOfSuccessors = 1 + generator() % 4;
+            double sum = 0.0;
+            for (uint64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+                uint64_t const column = (state + numberOfStates + generator() % (2 * window + 1) - window) % numberOfStates;
+                double const weight = weightDistribution(generator);
+                successors[column] += weight;
+                sum += weight;
+            }
+            double const leak = choice == 0 ? 0.02 : 0.0;
+            for (auto& successor : successors) {
+                successor.second *= (1.0 - leak) / sum;
+            }
+            if (choice == 0) {
+                successors[goalState] = leak / 2;
+                successors[sinkState] = leak / 2;
+            }
+            addChoice(successors);
+        }
+        if (state % 8 == 0) {
+            uint64_t const nextState = state + 8 < numberOfStates ? state + 8 : 0;
+            addChoice(nextState == state ? std::map<uint64_t, double>{{state, 1.0}} : std::map<uint64_t, double>{{state, 0.5}, {nextState, 0.5}});
+        }
+    }
+    for (auto const& absorbingState : {goalState, sinkState}) {
+        builder.newRowGroup(row);
+        addChoice({{absorbingState, 1.0}});
+    }
+
+    MicrobenchmarkInput input;
+    input.name = "synthetic";
+    input.seed = seed;
+    input.transitionMatrix = builder.build(row, numberOfStates + 2, numberOfStates + 2);
+    input.backwardTransitions = input.transitionMatrix.transpose(true);
+    input.phiStates = storm::storage::BitVector(numberOfStates + 2, true);
+    input.psiStates = storm::storage::BitVector(numberOfStates + 2);
+    input.psiStates.set(goalState);
+    prepareReachabilitySystem(input);
+    return input;
+}
+
+/*!
+ * Builds the given QVBS benchmark and derives the reachability objective from its until property.
+ */
+MicrobenchmarkInput createQvbsInput(std::string const& benchmark, uint64_t seed) {
+    QvbsInput qvbsInput = loadQvbsInput(parseBenchmarkSpecification(benchmark));
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {qvbsInput.formula};
+    auto model = storm::api::buildSparseModel<double>(qvbsInput.modelDescription, formulas);
+    STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException,
+                    "The microbenchmarks only support DTMCs and MDPs but benchmark " << benchmark << " is a " << model->getType() << ".");
+    auto untilOperands = getUntilOperands(*qvbsInput.formula);
+    STORM_LOG_THROW(untilOperands, storm::exceptions::NotSupportedException,
+                    "The property " << qvbsInput.propertyName << " of benchmark " << benchmark << " is not a reachability probability.");
+
+    MicrobenchmarkInput input;
+    input.name = benchmark;
+    input.seed = seed;
+    input.transitionMatrix = model->getTransitionMatrix();
+    input.backwardTransitions = *model->getBackwardTransitions();
+    input.phiStates = getStatesSatisfying(model, untilOperands->first);
+    input.psiStates = getStatesSatisfying(model, untilOperands->second);
+    input.modelDescription = qvbsInput.modelDescription;
+    prepareReachabilitySystem(input);
+    return input;
+}
+
+/*!
+ * @return The minimum, maximum, mean, median and standard deviation of the given times.
+ */
+Json computeStatistics(std::vector<double> times) {
+    Json result;
+    std::sort(times.begin(), times.end());
+    double sum = 0.0;
+    for (auto const& time : times) {
+        sum += time;
+    }
+    double const mean = sum / times.size();
+    double squaredDeviations = 0.0;
+    for (auto const& time : times) {
+        squaredDeviations += (time - mean) * (time - mean);
+    }
+    uint64_t const middle = times.size() / 2;
+    result["min"] = times.front();
+    result["max"] = times.back();
+    result["mean"] = mean;
+    result["median"] = times.size() % 2 == 1 ? times[middle] : (times[middle - 1] + times[middle]) / 2;
+    result["stddev"] = times.size() > 1 ? std::sqrt(squaredDeviations / (times.size() - 1)) : 0.0;
+    return result;
+}
+
+Json skipKernel(std::string const& kernel, std::string const& reason) {
+    STORM_PRINT_AND_LOG("  " << kernel << ": skipped (" << reason << ").\n");
+    Json result;
+    result["kernel"] = kernel;
+    result["skipped"] = reason;
+    return result;
+}
+
+/*!
+ * Runs the given kernel for the warmup runs and then measures the wall time of the given number of repetitions.
+ * The kernel returns additional information (e.g. the number of iterations) that is added to the measurement.
+ */
+Json measureKernel(std::string const& kernel, storm::settings::modules::MicrobenchmarkSettings const& settings, std::function<Json()> const& runKernel) {
+    Json result;
+    result["kernel"] = kernel;
+    std::vector<double> wallTimes;
+    try {
+        for (uint64_t warmup = 0; warmup < settings.getWarmupRuns(); ++warmup) {
+            runKernel();
+        }
+        for (uint64_t repetition = 0; repetition < settings.getRepetitions(); ++repetition) {
+            storm::utility::Stopwatch watch(true);
+            Json information = runKernel();
+            watch.stop();
+            wallTimes.push_back(static_cast<double>(watch.getTimeInNanoseconds()) * 1e-9);
+            result.update(information);
+        }
+    } catch (storm::exceptions::BaseException const& exception) {
+        // Report the error but continue with the remaining kernels.
+        STORM_LOG_ERROR("Kernel " << kernel << " failed: " << exception.what());
+        result["error"] = exception.what();
+    }
+    result["wall-time-seconds"] = wallTimes;
+    if (!wallTimes.empty()) {
+        Json statistics = computeStatistics(wallTimes);
+        STORM_PRINT_AND_LOG("  " << kernel << ": median " << statistics["median"].get<double>() << "s (min " << statistics["min"].get<double>() << "s, max "
+                                 << statistics["max"].get<double>() << "s).\n");
+        result["statistics"] = statistics;
+    }
+    return result;
+}
+
+/*!
+ * @return A vector of the given size whose entries are uniformly distributed in [0, 1] and only depend on the given seed.
+ */
+std::vector<double> createRandomVector(uint64_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<double> result(size);
+    for (auto& value : result) {
+        value = distribution(generator);
+    }
+    return result;
+}
+
+/*!
+ * @return A bit vector of the given size where each bit is set with probability one half and that only depends on the given seed.
+ */
+storm::storage::BitVector createRandomBitVector(uint64_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    storm::storage::BitVector result(size);
+    for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+        uint64_t const numberOfBits = std::min<uint64_t>(64, size - bitIndex);
+        uint64_t const bits = generator();
+        result.setFromInt(bitIndex, numberOfBits, numberOfBits == 64 ? bits : bits >> (64 - numberOfBits));
+    }
+    return result;
+}
+
+/*!
+ * A backend for the value iteration operator that minimizes over the choices and writes the result (Jacobi style) to the output operand.
+ */
+class MinimizingBackend {
+   public:
+    void startNewIteration() {
+        // intentionally left empty.
+    }
+
+    void firstRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(double&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= value;
+    }
+
+    void applyUpdate(double& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        currValue = *best;
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    storm::utility::Extremum<storm::OptimizationDirection::Minimize, double> best;
+};
+
+template<bool TrivialRowGrouping>
+Json runValueIterationKernel(std::string const& kernel, MicrobenchmarkInput const& input, storm::settings::modules::MicrobenchmarkSettings const& settings) {
+    // The operator is set up once as its construction is part of the solver setup but not of the iterations.
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, TrivialRowGrouping>>();
+    viOperator->setMatrixBackwards(input.maybeMatrix);
+    std::optional<storm::OptimizationDirection> dir;
+    if (!TrivialRowGrouping) {
+        dir = storm::OptimizationDirection::Minimize;
+    }
+    uint64_t const numberOfMaybeStates = input.maybeMatrix.getRowGroupCount();
+    return measureKernel(kernel, settings, [&]() {
+        std::vector<double> values(numberOfMaybeStates, 0.0);
+        uint64_t numberOfIterations = 0;
+        storm::solver::SolverStatus status = storm::solver::SolverStatus::InProgress;
+        if (kernel == "vi-apply") {
+            std::vector<double> otherValues(numberOfMaybeStates, 0.0);
+            MinimizingBackend backend;
+            for (; numberOfIterations < numberOfSweeps; ++numberOfIterations) {
+                viOperator->apply(values, otherValues, input.maybeOffsets, backend);
+                std::swap(values, otherValues);
+            }
+        } else if (kernel == "vi") {
+            storm::solver::helper::ValueIterationHelper<double, TrivialRowGrouping> helper(viOperator);
+            status = helper.VI(values, input.maybeOffsets, numberOfIterations, false, solverPrecision, dir);
+        } else if (kernel == "svi") {
+            storm::solver::helper::SoundValueIterationHelper<double, TrivialRowGrouping> helper(viOperator);
+            status = helper.SVI(values, input.maybeOffsets, numberOfIterations, false, solverPrecision, dir, 0.0, 1.0);
+        } else if (kernel == "ii") {
+            storm::solver::helper::IntervalIterationHelper<double, TrivialRowGrouping> helper(viOperator);
+            auto setLowerBounds = [](std::vector<double>& lowerBounds) { std::fill(lowerBounds.begin(), lowerBounds.end(), 0.0); };
+            auto setUpperBounds = [](std::vector<double>& upperBounds) { std::fill(upperBounds.begin(), upperBounds.end(), 1.0); };
+            status = helper.II(values, input.maybeOffsets, numberOfIterations, false, solverPrecision, setLowerBounds, setUpperBounds, dir);
+        } else {
+            STORM_LOG_ASSERT(kernel == "ovi", "Unexpected kernel " << kernel << ".");
+            storm::solver::helper::OptimisticValueIterationHelper<double, TrivialRowGrouping> helper(viOperator);
+            status = helper.OVI(values, input.maybeOffsets, numberOfIterations, false, solverPrecision, dir, std::nullopt, 0.0, 1.0);
+        }
+        Json information;
+        information["maybe-states"] = numberOfMaybeStates;
+        information["iterations"] = numberOfIterations;
+        if (kernel != "vi-apply") {
+            std::stringstream statusString;
+            statusString << status;
+            information["status"] = statusString.str();
+        }
+        return information;
+    });
+}
+
+/*!
+ * Explores the state space of the given model with the next state generator and a hash map from the (compressed) states to their indices.
+ */
+Json exploreStateSpace(storm::storage::SymbolicModelDescription const& modelDescription) {
+    storm::builder::BuilderOptions options;
+    std::shared_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+    if (modelDescription.isPrismProgram()) {
+        generator = std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(modelDescription.asPrismProgram(), options);
+    } else {
+        generator = std::make_shared<storm::generator::JaniNextStateGenerator<double, uint32_t>>(modelDescription.asJaniModel(), options);
+    }
+    storm::storage::BitVectorHashMap<uint32_t> stateToId(generator->getStateSize(), 100000);
+    std::deque<storm::generator::CompressedState> statesToExplore;
+    auto stateToIdCallback = [&stateToId, &statesToExplore](storm::generator::CompressedState const& state) -> uint32_t {
+        uint32_t const newIndex = static_cast<uint32_t>(stateToId.size());
+        uint32_t const index = stateToId.findOrAdd(state, newIndex);
+        if (index == newIndex) {
+            statesToExplore.push_back(state);
+        }
+        return index;
+    };
+    generator->getInitialStates(stateToIdCallback);
+    uint64_t numberOfChoices = 0;
+    uint64_t numberOfTransitions = 0;
+    while (!statesToExplore.empty()) {
+        generator->load(statesToExplore.front());
+        statesToExplore.pop_front();
+        auto behavior = generator->expand(stateToIdCallback);
+        for (auto const& choice : behavior) {
+            ++numberOfChoices;
+            numberOfTransitions += choice.size();
+        }
+    }
+    Json information;
+    information["states"] = stateToId.size();
+    information["choices"] = numberOfChoices;
+    information["nonzeros"] = numberOfTransitions;
+    return information;
+}
+
+Json runKernels(MicrobenchmarkInput const& input, storm::settings::modules::MicrobenchmarkSettings const& settings) {
+    auto const& matrix = input.transitionMatrix;
+    bool const deterministic = input.isDeterministic();
+    STORM_PRINT_AND_LOG("Input " << input.name << " (" << matrix.getRowGroupCount() << " states, " << matrix.getEntryCount() << " nonzeros):\n");
+
+    Json result;
+    result["input"] = input.name;
+    result["states"] = matrix.getRowGroupCount();
+    result["choices"] = matrix.getRowCount();
+    result["nonzeros"] = matrix.getEntryCount();
+    result["maybe-states"] = input.maybeStates.getNumberOfSetBits();
+    Json kernelResults = Json::array();
+    for (auto const& kernel : settings.getKernels()) {
+        if (kernel == "build-matrix") {
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                storm::storage::SparseMatrixBuilder<double> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true, !deterministic,
+                                                                    deterministic ? 0 : matrix.getRowGroupCount());
+                for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                    uint64_t const firstRow = deterministic ? group : matrix.getRowGroupIndices()[group];
+                    if (!deterministic) {
+                        builder.newRowGroup(firstRow);
+                    }
+                    for (uint64_t row = firstRow; row < firstRow + matrix.getRowGroupSize(group); ++row) {
+                        for (auto const& entry : matrix.getRow(row)) {
+                            builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                        }
+                    }
+                }
+                Json information;
+                information["nonzeros"] = builder.build().getEntryCount();
+                return information;
+            }));
+        } else if (kernel == "transpose") {
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                Json information;
+                information["nonzeros"] = matrix.transpose(true).getEntryCount();
+                return information;
+            }));
+        } else if (kernel == "submatrix") {
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                Json information;
+                information["nonzeros"] = matrix.getSubmatrix(true, input.maybeStates, input.maybeStates).getEntryCount();
+                return information;
+            }));
+        } else if (kernel == "multiply" || kernel == "native-multiply-reduce" || kernel == "gmmxx-multiply-reduce") {
+            std::vector<double> x = createRandomVector(matrix.getColumnCount(), input.seed);
+            std::unique_ptr<storm::solver::Multiplier<double>> multiplier;
+            if (kernel == "native-multiply-reduce") {
+                multiplier = std::make_unique<storm::solver::NativeMultiplier<double>>(matrix);
+            } else if (kernel == "gmmxx-multiply-reduce") {
+                multiplier = std::make_unique<storm::solver::GmmxxMultiplier<double>>(matrix);
+            }
+            storm::Environment env;
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                std::vector<double> product(multiplier ? matrix.getRowGroupCount() : matrix.getRowCount());
+                for (uint64_t sweep = 0; sweep < numberOfSweeps; ++sweep) {
+                    if (multiplier) {
+                        multiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, product);
+                    } else {
+                        matrix.multiplyWithVector(x, product);
+                    }
+                }
+                Json information;
+                information["sweeps"] = numberOfSweeps;
+                return information;
+            }));
+        } else if (kernel == "vi-apply" || kernel == "vi" || kernel == "svi" || kernel == "ii" || kernel == "ovi") {
+            if (input.maybeStates.empty()) {
+                kernelResults.push_back(skipKernel(kernel, "there are no maybe states"));
+            } else if (deterministic) {
+                kernelResults.push_back(runValueIterationKernel<true>(kernel, input, settings));
+            } else {
+                kernelResults.push_back(runValueIterationKernel<false>(kernel, input, settings));
+            }
+        } else if (kernel == "bitvector") {
+            uint64_t const size = matrix.getRowGroupCount();
+            auto first = createRandomBitVector(size, input.seed);
+            auto second = createRandomBitVector(size, input.seed + 1);
+            auto third = createRandomBitVector(size, input.seed + 2);
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                uint64_t numberOfSetBits = 0;
+                uint64_t numberOfSubsets = 0;
+                uint64_t sumOfIndices = 0;
+                for (uint64_t sweep = 0; sweep < numberOfSweeps; ++sweep) {
+                    auto combined = (first & second) | ~third;
+                    numberOfSetBits += combined.getNumberOfSetBits();
+                    if (first.isSubsetOf(combined)) {
+                        ++numberOfSubsets;
+                    }
+                    for (auto const& index : combined) {
+                        sumOfIndices += index;
+                    }
+                }
+                Json information;
+                information["set-bits"] = numberOfSetBits;
+                information["subsets"] = numberOfSubsets;
+                information["index-sum"] = sumOfIndices;
+                return information;
+            }));
+        } else if (kernel == "hashmap") {
+            // Keys of 96 bits that are similar to compressed states: a pseudo-random part and a part that is unique for each key.
+            std::mt19937_64 generator(input.seed);
+            std::vector<storm::storage::BitVector> keys;
+            keys.reserve(matrix.getRowGroupCount());
+            for (uint64_t index = 0; index < matrix.getRowGroupCount(); ++index) {
+                storm::storage::BitVector key(96);
+                key.setFromInt(0, 64, generator());
+                key.setFromInt(64, 32, index & 0xFFFFFFFFull);
+                keys.push_back(std::move(key));
+            }
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                storm::storage::BitVectorHashMap<uint64_t> map(96, 1000);
+                // The first pass inserts all keys, the second pass only finds them.
+                uint64_t sumOfValues = 0;
+                for (uint64_t pass = 0; pass < 2; ++pass) {
+                    for (auto const& key : keys) {
+                        sumOfValues += map.findOrAdd(key, map.size());
+                    }
+                }
+                Json information;
+                information["keys"] = map.size();
+                information["value-sum"] = sumOfValues;
+                return information;
+            }));
+        } else if (kernel == "prob01") {
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                Json information;
+                if (deterministic) {
+                    auto prob01 = storm::utility::graph::performProb01(input.backwardTransitions, input.phiStates, input.psiStates);
+                    information["prob0"] = prob01.first.getNumberOfSetBits();
+                    information["prob1"] = prob01.second.getNumberOfSetBits();
+                } else {
+                    auto maxResult = storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), input.backwardTransitions, input.phiStates,
+                                                                             input.psiStates);
+                    auto minResult = storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), input.backwardTransitions, input.phiStates,
+                                                                             input.psiStates);
+                    information["prob0-max"] = maxResult.first.getNumberOfSetBits();
+                    information["prob1-max"] = maxResult.second.getNumberOfSetBits();
+                    information["prob0-min"] = minResult.first.getNumberOfSetBits();
+                    information["prob1-min"] = minResult.second.getNumberOfSetBits();
+                }
+                return information;
+            }));
+        } else if (kernel == "scc") {
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                Json information;
+                information["components"] = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix).size();
+                return information;
+            }));
+        } else if (kernel == "mec") {
+            if (deterministic) {
+                kernelResults.push_back(skipKernel(kernel, "end components require a nondeterministic model"));
+                continue;
+            }
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() {
+                Json information;
+                information["components"] = storm::storage::MaximalEndComponentDecomposition<double>(matrix, input.backwardTransitions).size();
+                return information;
+            }));
+        } else {
+            STORM_LOG_ASSERT(kernel == "expand", "Unexpected kernel " << kernel << ".");
+            if (!input.modelDescription) {
+                kernelResults.push_back(skipKernel(kernel, "the input has no model description"));
+                continue;
+            }
+            kernelResults.push_back(measureKernel(kernel, settings, [&]() { return exploreStateSpace(input.modelDescription.value()); }));
+        }
+    }
+    result["kernels"] = kernelResults;
+    return result;
+}
+
+void processOptions() {
+    auto const& settings = storm::settings::getModule<storm::settings::modules::MicrobenchmarkSettings>();
+
+    Json result;
+    result["storm-version"] = storm::StormVersion::shortVersionString();
+    result["repetitions"] = settings.getRepetitions();
+    result["warmup-runs"] = settings.getWarmupRuns();
+    result["seed"] = settings.getSeed();
+    Json inputResults = Json::array();
+    if (settings.getSyntheticStates() > 0) {
+        inputResults.push_back(runKernels(createSyntheticInput(settings.getSyntheticStates(), settings.getSeed()), settings));
+    }
+    if (settings.isQvbsBenchmarksSet()) {
+        for (auto const& benchmark : settings.getQvbsBenchmarks()) {
+            try {
+                inputResults.push_back(runKernels(createQvbsInput(benchmark, settings.getSeed()), settings));
+            } catch (storm::exceptions::BaseException const& exception) {
+                // Report the error but continue with the remaining inputs.
+                STORM_LOG_ERROR("Input " << benchmark << " failed: " << exception.what());
+                Json inputResult;
+                inputResult["input"] = benchmark;
+                inputResult["error"] = exception.what();
+                inputResults.push_back(inputResult);
+            }
+        }
+    }
+    result["inputs"] = inputResults;
+
+    if (settings.isJsonOutputSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(settings.getJsonOutputFilename(), stream);
+        stream << storm::dumpJson(result) << '\n';
+        storm::utility::closeFile(stream);
+    } else {
+        STORM_PRINT(storm::dumpJson(result) << '\n');
+    }
+}
+
+}  // namespace bench
+}  // namespace storm
+
+/*!
+ * Main entry point of the executable storm-microbench.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        return storm::cli::process("Storm-microbench", "storm-microbench", storm::settings::initializeMicrobenchSettings, storm::bench::processOptions, argc,
+                                   argv);
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-microbench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-microbench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -0,0 +1,120 @@
+#include "storm-bench/utility/BenchmarkUtility.h"
+
+#include <sys/resource.h>
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include <fstream>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/ValueParser.h"
+
+#include "storm/api/storm.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace bench {
+
+BenchmarkSpecification parseBenchmarkSpecification(std::string const& specification) {
+    std::vector<std::string> parts;
+    boost::split(parts, specification, boost::is_any_of(":"));
+    STORM_LOG_THROW(parts.size() <= 3 && !parts.front().empty(), storm::exceptions::InvalidSettingsException,
+                    "Invalid benchmark '" << specification << "'. Expected 'model[:instance[:property]]'.");
+    BenchmarkSpecification result;
+    result.modelName = parts[0];
+    if (parts.size() > 1 && !parts[1].empty()) {
+        result.instanceIndex = storm::parser::parseNumber<std::size_t>(parts[1]);
+    }
+    if (parts.size() > 2 && !parts[2].empty()) {
+        result.propertyName = parts[2];
+    }
+    return result;
+}
+
+QvbsInput loadQvbsInput(BenchmarkSpecification const& specification) {
+    QvbsInput result;
+    storm::storage::QvbsBenchmark benchmark(specification.modelName);
+    result.constantDefinitionString = benchmark.getConstantDefinition(specification.instanceIndex);
+    boost::optional<std::vector<std::string>> propertyFilter;
+    if (specification.propertyName) {
+        propertyFilter = std::vector<std::string>({specification.propertyName.value()});
+    }
+    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(specification.instanceIndex), propertyFilter);
+    result.modelDescription = storm::storage::SymbolicModelDescription(janiInput.first);
+    auto constantDefinitions = result.modelDescription.parseConstantDefinitions(result.constantDefinitionString);
+    result.modelDescription = result.modelDescription.preprocess(constantDefinitions);
+    auto properties = storm::api::substituteConstantsInProperties(janiInput.second, constantDefinitions);
+
+    auto propertyIt = std::find_if(properties.begin(), properties.end(), [](storm::jani::Property const& property) {
+        return property.getRawFormula()->isProbabilityOperatorFormula() || property.getRawFormula()->isRewardOperatorFormula();
+    });
+    STORM_LOG_THROW(propertyIt != properties.end(), storm::exceptions::InvalidSettingsException,
+                    "No suitable property found for benchmark " << specification.modelName << ".");
+    result.propertyName = propertyIt->getName();
+    result.formula = propertyIt->getRawFormula();
+    return result;
+}
+
+void resetPeakMemoryUsage() {
+#ifdef LINUX
+    // Writing 5 to clear_refs resets the peak resident set size (VmHWM) of the process.
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs) {
+        clearRefs << "5";
+    }
+#endif
+}
+
+uint64_t getPeakMemoryUsageInKilobytes() {
+#ifdef LINUX
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (boost::starts_with(line, "VmHWM:")) {
+            return std::stoull(line.substr(6));
+        }
+    }
+#endif
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024;
+#else
+    return ru.ru_maxrss;
+#endif
+}
+
+std::optional<std::pair<std::shared_ptr<storm::logic::Formula const>, std::shared_ptr<storm::logic::Formula const>>> getUntilOperands(
+    storm::logic::Formula const& formula) {
+    if (!formula.isProbabilityOperatorFormula()) {
+        return std::nullopt;
+    }
+    auto const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    if (pathFormula.isEventuallyFormula()) {
+        return std::make_pair(storm::logic::Formula::getTrueFormula(), pathFormula.asEventuallyFormula().getSubformula().asSharedPointer());
+    } else if (pathFormula.isUntilFormula()) {
+        return std::make_pair(pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer(),
+                              pathFormula.asUntilFormula().getRightSubformula().asSharedPointer());
+    } else if (pathFormula.isBoundedUntilFormula() && !pathFormula.asBoundedUntilFormula().isMultiDimensional()) {
+        return std::make_pair(pathFormula.asBoundedUntilFormula().getLeftSubformula().asSharedPointer(),
+                              pathFormula.asBoundedUntilFormula().getRightSubformula().asSharedPointer());
+    }
+    return std::nullopt;
+}
+
+storm::storage::BitVector getStatesSatisfying(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                                              std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula));
+    STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "Unable to check state formula " << *formula << ".");
+    return result->asExplicitQualitativeCheckResult().getTruthValuesVector();
+}
+
+}  // namespace bench
+}  // namespace storm
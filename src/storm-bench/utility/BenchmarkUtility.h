@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace bench {
+
+struct BenchmarkSpecification {
+    // The (short) name of the QVBS model.
+    std::string modelName;
+    // The index of the considered instance of the model.
+    uint64_t instanceIndex = 0;
+    // The name of the considered property (if any).
+    std::optional<std::string> propertyName;
+};
+
+/*!
+ * Parses a benchmark of the form 'model[:instance[:property]]'.
+ */
+BenchmarkSpecification parseBenchmarkSpecification(std::string const& specification);
+
+struct QvbsInput {
+    // The preprocessed model description, i.e., all constants are defined.
+    storm::storage::SymbolicModelDescription modelDescription;
+    std::string constantDefinitionString;
+    std::string propertyName;
+    std::shared_ptr<storm::logic::Formula const> formula;
+};
+
+/*!
+ * Parses the jani file of the given QVBS benchmark and selects the given property or (if no property is given) the first property that is a probability
+ * or reward operator.
+ */
+QvbsInput loadQvbsInput(BenchmarkSpecification const& specification);
+
+/*!
+ * Resets the peak memory usage of this process (if supported by the operating system) such that the peak of the next phase can be measured.
+ */
+void resetPeakMemoryUsage();
+
+/*!
+ * @return The peak resident set size (in kilobytes) since the last reset or (if resetting is not supported) since the start of the process.
+ */
+uint64_t getPeakMemoryUsageInKilobytes();
+
+/*!
+ * @return The left and right subformulas if the given formula asks for the probability of a (possibly bounded) until or eventually formula.
+ */
+std::optional<std::pair<std::shared_ptr<storm::logic::Formula const>, std::shared_ptr<storm::logic::Formula const>>> getUntilOperands(
+    storm::logic::Formula const& formula);
+
+/*!
+ * @return The states of the given model that satisfy the given state formula.
+ */
+storm::storage::BitVector getStatesSatisfying(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                                              std::shared_ptr<storm::logic::Formula const> const& formula);
+
+}  // namespace bench
+}  // namespace storm
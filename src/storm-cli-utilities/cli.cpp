@@ -7,9 +7,11 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
 
@@ -78,6 +80,23 @@ void setLogLevel() {
     setFileLogging();
 }
 
+bool isExportTelemetrySet() {
+    return storm::settings::hasModule<storm::settings::modules::IOSettings>() &&
+           storm::settings::getModule<storm::settings::modules::IOSettings>().isExportTelemetrySet();
+}
+
+void exportTelemetry() {
+    storm::settings::modules::IOSettings const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    std::ofstream stream;
+    storm::utility::openFile(ioSettings.getExportTelemetryFilename(), stream);
+    if (ioSettings.getExportTelemetryFormat() == "chrome") {
+        storm::utility::telemetry::exportChromeTrace(stream);
+    } else {
+        storm::utility::telemetry::exportJson(stream);
+    }
+    storm::utility::closeFile(stream);
+}
+
 int process(std::string const& name, std::string const& executableName, std::function<void(std::string const&, std::string const&)> initSettingsFunc,
             std::function<void(void)> processOptionsFunc, const int argc, const char** argv) {
     storm::utility::setUp();
@@ -99,9 +118,17 @@ int process(std::string const& name, std::string const& executableName, std::fun
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 
     // Process options and start computations
-    processOptionsFunc();
+    bool telemetry = isExportTelemetrySet();
+    storm::utility::telemetry::setEnabled(telemetry);
+    {
+        storm::utility::telemetry::Scope processScope(executableName);
+        processOptionsFunc();
+    }
 
     totalTimer.stop();
+    if (telemetry) {
+        exportTelemetry();
+    }
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
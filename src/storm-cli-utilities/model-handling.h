@@ -6,6 +6,7 @@
 #include "storm-gamebased-ar/api/verification.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm-parsers/parser/MappedDirectEncodingBinaryModel.h"
 
 #include "storm/io/file.h"
 #include "storm/utility/AutomaticSettings.h"
@@ -13,13 +14,27 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
 
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/initialize.h"
-
+#include "storm/utility/threads.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 
+#include "storm/adapters/JsonAdapter.h"
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
@@ -27,9 +42,17 @@
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/WarmStartStore.h"
+#include "storm/modelchecker/prctl/SparseReachabilityBatch.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -70,6 +93,7 @@ struct SymbolicInput {
 inline void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
     if (ioSettings.isPrismOrJaniInputSet()) {
+        storm::utility::telemetry::Scope telemetryScope("parsing");
         storm::utility::Stopwatch modelParsingWatch(true);
         if (ioSettings.isPrismInputSet()) {
             input.model =
@@ -116,9 +140,12 @@ inline SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings
     storm::storage::QvbsBenchmark benchmark(ioSettings.getQvbsModelName());
     STORM_PRINT_AND_LOG(benchmark.getInfo(ioSettings.getQvbsInstanceIndex(), ioSettings.getQvbsPropertyFilter()));
     storm::utility::Stopwatch modelParsingWatch(true);
-    auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(ioSettings.getQvbsInstanceIndex()), ioSettings.getQvbsPropertyFilter());
-    input.model = std::move(janiInput.first);
-    input.properties = std::move(janiInput.second);
+    {
+        storm::utility::telemetry::Scope telemetryScope("parsing");
+        auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(ioSettings.getQvbsInstanceIndex()), ioSettings.getQvbsPropertyFilter());
+        input.model = std::move(janiInput.first);
+        input.properties = std::move(janiInput.second);
+    }
     modelParsingWatch.stop();
     STORM_PRINT("Time for model input parsing: " << modelParsingWatch << ".\n\n");
 
@@ -189,6 +216,10 @@ inline void getModelProcessingInformationAutomatic(SymbolicInput const& input, M
                         "Automatic engine does not support decisions based on multiple properties. Only the first property will be considered.");
 
     storm::utility::AutomaticSettings as;
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isMemoryLimitSet()) {
+        as.setMemoryLimit(resourceSettings.getMemoryLimitInBytes());
+    }
     if (hints.isNumberStatesSet()) {
         as.predict(input.model->asJaniModel(), properties.front(), hints.getNumberStates());
     } else {
@@ -374,6 +405,23 @@ inline std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicIn
         output.properties = storm::api::substituteConstantsInProperties(output.properties, constantDefinitions);
     }
     ensureNoUndefinedPropertyConstants(output.properties);
+
+    // Remove the variables and modules that can not influence the properties.
+    if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isConeOfInfluenceSet() && output.model &&
+        output.model.get().isPrismProgram() && !output.properties.empty()) {
+        storm::prism::Program const& program = output.model.get().asPrismProgram();
+        if (program.getModelType() == storm::prism::Program::ModelType::PTA || program.getModelType() == storm::prism::Program::ModelType::SMG) {
+            STORM_LOG_WARN("Restricting to the cone of influence is not supported for " << program.getModelType() << " programs. Ignoring option.");
+        } else {
+            std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+            for (auto const& property : output.properties) {
+                formulas.push_back(property.getRawFormula());
+                formulas.push_back(property.getFilter().getStatesFormula());
+            }
+            output.model = storm::storage::SymbolicModelDescription(program.restrictToConeOfInfluence(formulas));
+        }
+    }
+
     auto transformedJani = std::make_shared<SymbolicInput>();
     ModelProcessingInformation mpi = getModelProcessingInformation(output, transformedJani);
 
@@ -482,6 +530,26 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
         options.setAddOverlappingGuardsLabel(true);
     }
 
+    if (buildSettings.isCompileGuardsSet()) {
+        options.setCompileGuards(true);
+        options.setCompiledGuardsCacheDirectory(buildSettings.getCompiledGuardsCacheDirectory());
+        options.setGuardCompiler(buildSettings.getGuardCompiler());
+    }
+
+    if (buildSettings.isPartialOrderReductionSet()) {
+        // The reduced model only preserves (unnested) probabilities of LTL formulas without next and bounded until operators.
+        storm::logic::FragmentSpecification fragment = storm::logic::pctlstar();
+        fragment.setNextFormulasAllowed(false).setBoundedUntilFormulasAllowed(false).setNestedOperatorsAllowed(false).setHOAPathFormulasAllowed(false);
+        fragment.setOperatorAtTopLevelRequired(true);
+        bool propertiesArePreserved = std::all_of(input.properties.begin(), input.properties.end(), [&fragment](storm::jani::Property const& property) {
+            return property.getRawFormula()->isInFragment(fragment);
+        });
+        STORM_LOG_WARN_COND(propertiesArePreserved, "Partial order reduction is not applied as it does not preserve all given properties.");
+        options.setPartialOrderReduction(propertiesArePreserved && !buildSettings.isBuildFullModelSet());
+    }
+    options.setSymmetryReduction(buildSettings.isSymmetryReductionSet() && !buildSettings.isBuildFullModelSet());
+    options.setBytecodeExpressionEvaluation(buildSettings.isBytecodeExpressionsSet());
+
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isComputeExpectedVisitingTimesSet() || ioSettings.isComputeSteadyStateDistributionSet()) {
         options.clearTerminalStates();
@@ -491,6 +559,15 @@ inline storm::builder::BuilderOptions createBuildOptionsSparseFromSettings(Symbo
 
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isStreamBuildSet()) {
+        // Write the model to disk first, so the builder and the model are never held in memory at the same time.
+        storm::api::buildSparseModelToDrbFile<ValueType>(input.model.get(), options, buildSettings.getStreamBuildFilename(),
+                                                         buildSettings.getStreamBuildTemporaryDirectory());
+        storm::parser::DirectEncodingBinaryParserOptions parserOptions;
+        parserOptions.buildChoiceLabeling = options.isBuildChoiceLabelsSet();
+        return storm::api::buildExplicitDRBModel<ValueType>(buildSettings.getStreamBuildFilename(), parserOptions);
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
@@ -507,7 +584,12 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
     } else if (ioSettings.isExplicitDRNSet()) {
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        options.parallelParsing = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitDRBSet()) {
+        storm::parser::DirectEncodingBinaryParserOptions options;
+        options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
+        result = storm::api::buildExplicitDRBModel<ValueType>(ioSettings.getExplicitDRBFilename(), options);
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -518,6 +600,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    storm::utility::telemetry::Scope telemetryScope("model-building");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     std::shared_ptr<storm::models::ModelBase> result;
@@ -529,7 +612,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
             auto options = createBuildOptionsSparseFromSettings(input);
             result = buildModelSparse<ValueType>(input, options);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitDRBSet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, storm::settings::getModule<storm::settings::modules::BuildSettings>());
@@ -538,6 +621,8 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
     modelBuildingWatch.stop();
     if (result) {
         STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+        storm::utility::telemetry::setAttribute("states", static_cast<uint64_t>(result->getNumberOfStates()));
+        storm::utility::telemetry::setAttribute("transitions", static_cast<uint64_t>(result->getNumberOfTransitions()));
     }
 
     return result;
@@ -579,7 +664,30 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelBi
     }
 
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+    storm::utility::telemetry::Scope telemetryScope("bisimulation");
+    auto result = storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType,
+                                                                         bisimulationSettings.getSparseRefinementMethod());
+    storm::utility::telemetry::setAttribute("quotient-states", static_cast<uint64_t>(result->getNumberOfStates()));
+    storm::utility::telemetry::setAttribute("quotient-transitions", static_cast<uint64_t>(result->getNumberOfTransitions()));
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelAutomaticBisimulation(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, SymbolicInput const& input,
+    storm::settings::modules::BisimulationSettings const& bisimulationSettings) {
+    storm::utility::telemetry::Scope telemetryScope("bisimulation");
+    auto result = storm::api::performAutomaticBisimulationMinimization<ValueType>(
+        model, createFormulasToRespect(input.properties), bisimulationSettings.getAutomaticQuotientRatio(), bisimulationSettings.getSparseRefinementMethod());
+    if (result == model) {
+        STORM_PRINT_AND_LOG("Skipped bisimulation minimization as it does not reduce the model sufficiently.\n");
+    } else {
+        STORM_PRINT_AND_LOG("Bisimulation minimization reduced the model from " << model->getNumberOfStates() << " to " << result->getNumberOfStates()
+                                                                                << " states.\n");
+    }
+    storm::utility::telemetry::setAttribute("quotient-states", static_cast<uint64_t>(result->getNumberOfStates()));
+    storm::utility::telemetry::setAttribute("quotient-transitions", static_cast<uint64_t>(result->getNumberOfTransitions()));
+    return result;
 }
 
 template<typename ValueType>
@@ -608,6 +716,10 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
     if (mpi.applyBisimulation) {
         result.first = preprocessSparseModelBisimulation(result.first, input, bisimulationSettings);
         result.second = true;
+    } else if (bisimulationSettings.isAutomaticSet()) {
+        auto minimizedModel = preprocessSparseModelAutomaticBisimulation(result.first, input, bisimulationSettings);
+        result.second |= minimizedModel != result.first;
+        result.first = minimizedModel;
     }
 
     if (transformationSettings.isToDiscreteTimeModelSet()) {
@@ -626,6 +738,17 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    if (transformationSettings.isRemoveDuplicateChoicesSet()) {
+        if (result.first->isOfType(storm::models::ModelType::Mdp)) {
+            uint64_t const numberOfChoices = result.first->getNumberOfChoices();
+            result.first = storm::api::eliminateDuplicateChoices(result.first);
+            result.second = true;
+            STORM_PRINT_AND_LOG("Removed " << numberOfChoices - result.first->getNumberOfChoices() << " duplicate choices.\n");
+        } else {
+            STORM_LOG_WARN("Duplicate choices are only removed for MDPs, but the model is a " << result.first->getType() << ".");
+        }
+    }
+
     return result;
 }
 
@@ -643,6 +766,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
                 break;
+            case storm::exporter::ModelExportFormat::Drb:
+                storm::api::exportSparseModelAsDrb(model, ioSettings.getExportBuildFilename());
+                break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
@@ -704,6 +830,7 @@ void exportDdModel(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueT
 
 template<storm::dd::DdType DdType, typename ValueType>
 void exportModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
+    storm::utility::telemetry::Scope telemetryScope("model-export");
     if (model->isSparseModel()) {
         exportSparseModel<ValueType>(model->as<storm::models::sparse::Model<ValueType>>(), input);
     } else {
@@ -742,8 +869,12 @@ std::shared_ptr<storm::models::Model<ExportValueType>> preprocessDdModelBisimula
         quotientFormat = storm::dd::bisimulation::QuotientFormat::Sparse;
     }
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<DdType, ValueType, ExportValueType>(
+    storm::utility::telemetry::Scope telemetryScope("bisimulation");
+    auto result = storm::api::performBisimulationMinimization<DdType, ValueType, ExportValueType>(
         model, createFormulasToRespect(input.properties), storm::storage::BisimulationType::Strong, bisimulationSettings.getSignatureMode(), quotientFormat);
+    storm::utility::telemetry::setAttribute("quotient-states", static_cast<uint64_t>(result->getNumberOfStates()));
+    storm::utility::telemetry::setAttribute("quotient-transitions", static_cast<uint64_t>(result->getNumberOfTransitions()));
+    return result;
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
@@ -788,6 +919,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    storm::utility::telemetry::Scope telemetryScope("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -888,6 +1020,16 @@ inline void generateCounterexamples<double>(std::shared_ptr<storm::models::Model
 
 template<typename ValueType>
 void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
+    if (result->isExplicitTimeBoundsCheckResult()) {
+        // Print the filtered result for each of the time bounds on a separate line.
+        auto const& timeBoundsResult = result->asExplicitTimeBoundsCheckResult<ValueType>();
+        for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBoundsResult.getNumberOfTimeBounds(); ++timeBoundIndex) {
+            STORM_PRINT("\n  t=" << timeBoundsResult.getTimeBounds()[timeBoundIndex] << ": ");
+            std::unique_ptr<storm::modelchecker::CheckResult> resultForTimeBound = timeBoundsResult.getResult(timeBoundIndex).clone();
+            printFilteredResult<ValueType>(resultForTimeBound, ft);
+        }
+        return;
+    }
     if (result->isQuantitative()) {
         if (ft == storm::modelchecker::FilterType::VALUES) {
             STORM_PRINT(*result);
@@ -991,6 +1133,10 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyProperty(std::shared_ptr
                                                                  std::shared_ptr<storm::logic::Formula const> const& statesFilter,
                                                                  VerificationCallbackType const& verificationCallback) {
     auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    storm::utility::telemetry::Scope telemetryScope("model-checking");
+    if (storm::utility::telemetry::isRecording()) {
+        storm::utility::telemetry::setAttribute("formula", formula->toString());
+    }
 
     try {
         if (transformationSettings.isChainEliminationSet() && !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*formula)) {
@@ -1014,16 +1160,108 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyProperty(std::shared_ptr
     return nullptr;
 }
 
+/*!
+ * Verifies the given properties concurrently. Each thread repeatedly picks the next property that is not checked yet. The results are printed and
+ * postprocessed in the order of the properties as soon as all preceding properties are done, such that the output does not depend on the scheduling.
+ * @param properties The properties to check
+ * @param verificationCallback Function to perform the actual verification task. Needs to be safe to be invoked concurrently
+ * @param postprocessingCallback Function that processes the verification result. Is only invoked by the calling thread
+ * @param numberOfThreads The number of properties that are checked at the same time
+ */
+template<typename ValueType>
+void verifyPropertiesConcurrently(std::vector<storm::jani::Property> const& properties, VerificationCallbackType const& verificationCallback,
+                                  PostprocessingCallbackType const& postprocessingCallback, uint64_t numberOfThreads) {
+    struct PropertyCheck {
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        storm::utility::Stopwatch watch;
+        std::exception_ptr exception;
+        bool done = false;
+    };
+    std::vector<PropertyCheck> checks(properties.size());
+    std::mutex mutex;
+    std::condition_variable checkDone;
+    uint64_t nextProperty = 0;
+    bool abort = false;
+    auto work = [&]() {
+        while (true) {
+            uint64_t propertyIndex;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (abort || nextProperty >= properties.size()) {
+                    break;
+                }
+                propertyIndex = nextProperty++;
+            }
+            auto& check = checks[propertyIndex];
+            auto const& property = properties[propertyIndex];
+            check.watch.start();
+            try {
+                check.result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+            } catch (...) {
+                check.exception = std::current_exception();
+            }
+            check.watch.stop();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                check.done = true;
+            }
+            checkDone.notify_all();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < std::min<uint64_t>(numberOfThreads, properties.size()); ++thread) {
+        threads.emplace_back(work);
+    }
+
+    std::exception_ptr exception;
+    for (uint64_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex) {
+        auto& check = checks[propertyIndex];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            checkDone.wait(lock, [&check]() { return check.done; });
+        }
+        try {
+            if (check.exception) {
+                std::rethrow_exception(check.exception);
+            }
+            printModelCheckingProperty(properties[propertyIndex]);
+            if (check.result) {
+                postprocessingCallback(check.result);
+            }
+            printResult<ValueType>(check.result, properties[propertyIndex], &check.watch);
+        } catch (...) {
+            exception = std::current_exception();
+            std::lock_guard<std::mutex> lock(mutex);
+            abort = true;
+            break;
+        }
+        // Free the result as soon as possible as the results for all states might be large.
+        check.result.reset();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
 /*!
  * Verifies all (potentially preprocessed) properties given in `input`.
  * @param input Where the properties are read from
  * @param verificationCallback Function to perform the actual verification task for a given formula plus a filter formula to identify relevant states
  * @param postprocessingCallback Function that processes the verification result, such as e.g. output to a file
+ * @param numberOfParallelChecks The number of properties that are checked concurrently. If larger than one, the verification callback needs to be safe
+ * to be invoked concurrently
  */
 template<typename ValueType>
 void verifyProperties(SymbolicInput const& input, VerificationCallbackType const& verificationCallback,
-                      PostprocessingCallbackType const& postprocessingCallback = PostprocessingIdentity()) {
+                      PostprocessingCallbackType const& postprocessingCallback = PostprocessingIdentity(), uint64_t numberOfParallelChecks = 1) {
     auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    if (numberOfParallelChecks > 1 && properties.size() > 1) {
+        verifyPropertiesConcurrently<ValueType>(properties, verificationCallback, postprocessingCallback, numberOfParallelChecks);
+        return;
+    }
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
         storm::utility::Stopwatch watch(true);
@@ -1036,6 +1274,70 @@ void verifyProperties(SymbolicInput const& input, VerificationCallbackType const
     }
 }
 
+/*!
+ * For a model whose exploration was stopped early (see --state-limit and --memory-limit), the unexplored states are absorbing and labeled with
+ * 'unexplored'. Checking a reachability probability on such a model yields a lower bound. This derives the formula that yields an upper bound by
+ * also considering the unexplored states as goal states.
+ * @return The formula for the upper bound or nullptr if the formula is not a probability operator over a reachability or until formula with
+ * propositional subformulas.
+ */
+inline std::shared_ptr<storm::logic::Formula const> getUpperBoundFormulaForPartiallyExploredModel(storm::logic::Formula const& formula) {
+    if (!formula.isProbabilityOperatorFormula()) {
+        return nullptr;
+    }
+    auto const& probabilityOperator = formula.asProbabilityOperatorFormula();
+    auto const& pathFormula = probabilityOperator.getSubformula();
+    auto addUnexploredStates = [](storm::logic::Formula const& goal) {
+        return std::make_shared<storm::logic::BinaryBooleanStateFormula>(storm::logic::BinaryBooleanStateFormula::OperatorType::Or, goal.asSharedPointer(),
+                                                                         std::make_shared<storm::logic::AtomicLabelFormula>("unexplored"));
+    };
+    std::shared_ptr<storm::logic::Formula const> upperBoundPathFormula;
+    if (pathFormula.isEventuallyFormula() && pathFormula.asEventuallyFormula().getSubformula().isInFragment(storm::logic::propositional())) {
+        upperBoundPathFormula = std::make_shared<storm::logic::EventuallyFormula>(addUnexploredStates(pathFormula.asEventuallyFormula().getSubformula()));
+    } else if (pathFormula.isUntilFormula() && pathFormula.asUntilFormula().getLeftSubformula().isInFragment(storm::logic::propositional()) &&
+               pathFormula.asUntilFormula().getRightSubformula().isInFragment(storm::logic::propositional())) {
+        upperBoundPathFormula = std::make_shared<storm::logic::UntilFormula>(pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer(),
+                                                                             addUnexploredStates(pathFormula.asUntilFormula().getRightSubformula()));
+    } else {
+        return nullptr;
+    }
+    return std::make_shared<storm::logic::ProbabilityOperatorFormula>(upperBoundPathFormula, probabilityOperator.getOperatorInformation());
+}
+
+/*!
+ * Verifies all properties given in `input` on a model whose exploration was stopped early. Where possible, a lower bound (treating the unexplored
+ * states as 0) and an upper bound (treating the unexplored states as 1) are reported.
+ * @param input Where the properties are read from
+ * @param verificationCallback Function to perform the actual verification task for a given formula plus a filter formula to identify relevant states
+ * @param postprocessingCallback Function that processes the verification result (of the lower bound), such as e.g. output to a file
+ */
+template<typename ValueType>
+void verifyPropertiesOnPartiallyExploredModel(SymbolicInput const& input, VerificationCallbackType const& verificationCallback,
+                                              PostprocessingCallbackType const& postprocessingCallback = PostprocessingIdentity()) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (auto const& property : properties) {
+        printModelCheckingProperty(property);
+        storm::utility::Stopwatch watch(true);
+        auto result = verifyProperty<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula(), verificationCallback);
+        if (result) {
+            postprocessingCallback(result);
+        }
+        auto upperBoundFormula = getUpperBoundFormulaForPartiallyExploredModel(*property.getRawFormula());
+        if (!upperBoundFormula) {
+            watch.stop();
+            STORM_LOG_WARN("The model was not explored completely and no bounds can be derived for this property. The result refers to the explored part.");
+            printResult<ValueType>(result, property, &watch);
+            continue;
+        }
+        STORM_PRINT("Lower bound (unexplored states count as 0). ");
+        printResult<ValueType>(result, property);
+        auto upperBoundResult = verifyProperty<ValueType>(upperBoundFormula, property.getFilter().getStatesFormula(), verificationCallback);
+        watch.stop();
+        STORM_PRINT("Upper bound (unexplored states count as 1). ");
+        printResult<ValueType>(upperBoundResult, property, &watch);
+    }
+}
+
 /*!
  * Computes values for each state (such as the steady-state probability distribution).
  * If one or more formulas are given, they serve as filter to identify which states are relevant.
@@ -1200,24 +1502,203 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSmcEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithSmcEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
+/*!
+ * Computes the states of the mapped model that satisfy the given propositional formula.
+ */
+inline storm::storage::BitVector getStatesOfMappedDrbModel(storm::parser::MappedDirectEncodingBinaryModel const& model,
+                                                           storm::logic::Formula const& formula) {
+    uint64_t const numberOfStates = model.getTransitionMatrix().numberOfStates;
+    if (formula.isTrueFormula() || formula.isFalseFormula()) {
+        return storm::storage::BitVector(numberOfStates, formula.isTrueFormula());
+    } else if (formula.isInitialFormula()) {
+        return model.getStateLabel("init");
+    } else if (formula.isAtomicLabelFormula()) {
+        return model.getStateLabel(formula.asAtomicLabelFormula().getLabel());
+    } else if (formula.isUnaryBooleanStateFormula() && formula.asUnaryBooleanStateFormula().isNot()) {
+        return ~getStatesOfMappedDrbModel(model, formula.asUnaryBooleanStateFormula().getSubformula());
+    } else if (formula.isBinaryBooleanStateFormula()) {
+        auto const& binaryFormula = formula.asBinaryBooleanStateFormula();
+        auto left = getStatesOfMappedDrbModel(model, binaryFormula.getLeftSubformula());
+        auto right = getStatesOfMappedDrbModel(model, binaryFormula.getRightSubformula());
+        return binaryFormula.isAnd() ? left & right : left | right;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "The formula '" << formula << "' is not supported for mapped drb models. Only labels and boolean combinations thereof are supported.");
+}
+
+template<typename ValueType>
+void verifyWithMappedDrbModel(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking mapped drb models is only supported for floating point values.");
+    } else {
+        auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+        storm::utility::Stopwatch mappingWatch(true);
+        storm::parser::MappedDirectEncodingBinaryModel model(ioSettings.getExplicitDRBFilename());
+        mappingWatch.stop();
+        auto const& matrix = model.getTransitionMatrix();
+        STORM_LOG_THROW(model.getType() == storm::models::ModelType::Dtmc || model.getType() == storm::models::ModelType::Mdp,
+                        storm::exceptions::NotSupportedException, "Checking mapped drb models is only supported for DTMCs and MDPs.");
+        STORM_PRINT_AND_LOG("Mapped " << model.getType() << " with " << matrix.numberOfStates << " states, " << matrix.numberOfRows << " choices and "
+                                      << matrix.rowIndications[matrix.numberOfRows] << " transitions in " << mappingWatch << ".\n");
+
+        storm::solver::helper::MappedValueIterationHelper helper(matrix);
+        auto const& minMaxEnvironment = mpi.env.solver().minMax();
+        bool const relative = minMaxEnvironment.getRelativeTerminationCriterion();
+        double const precision = storm::utility::convertNumber<double>(minMaxEnvironment.getPrecision());
+        uint64_t const maximalNumberOfIterations = minMaxEnvironment.getMaximalNumberOfIterations();
+        verifyProperties<ValueType>(input, [&](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                               std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(formula->isProbabilityOperatorFormula() || formula->isRewardOperatorFormula(), storm::exceptions::NotSupportedException,
+                            "Only reachability probabilities and expected rewards are supported for mapped drb models.");
+            auto const& operatorFormula = formula->asOperatorFormula();
+            STORM_LOG_THROW(operatorFormula.getSubformula().isEventuallyFormula(), storm::exceptions::NotSupportedException,
+                            "Only reachability probabilities and expected rewards are supported for mapped drb models.");
+            std::optional<storm::OptimizationDirection> dir;
+            if (model.getType() == storm::models::ModelType::Mdp) {
+                STORM_LOG_THROW(operatorFormula.hasOptimalityType(), storm::exceptions::InvalidPropertyException,
+                                "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+                dir = operatorFormula.getOptimalityType();
+            }
+            auto targetStates = getStatesOfMappedDrbModel(model, operatorFormula.getSubformula().asEventuallyFormula().getSubformula());
+
+            uint64_t numIterations = 0;
+            std::vector<double> values;
+            if (formula->isProbabilityOperatorFormula()) {
+                values = helper.computeReachabilityProbabilities(targetStates, dir, relative, precision, maximalNumberOfIterations, numIterations);
+            } else {
+                auto const& rewardOperatorFormula = formula->asRewardOperatorFormula();
+                auto const& rewardModel =
+                    model.getRewardModel(rewardOperatorFormula.hasRewardModelName() ? rewardOperatorFormula.getRewardModelName() : std::string());
+                values = helper.computeExpectedRewards(targetStates, rewardModel.stateRewards, rewardModel.stateActionRewards, relative, precision,
+                                                       maximalNumberOfIterations, numIterations);
+            }
+
+            std::unique_ptr<storm::modelchecker::CheckResult> result =
+                std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<double>>(std::move(values));
+            if (!states->isTrueFormula()) {
+                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(getStatesOfMappedDrbModel(model, *states)));
+            }
+            return result;
+        });
+    }
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
+    storm::Environment env = mpi.env;
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isMemoryLimitSet() && sparseModel->isNondeterministicModel()) {
+        // Now that the model is built, pick a solution method whose vectors fit into the memory that is left besides the model.
+        auto const& matrix = sparseModel->getTransitionMatrix();
+        uint64_t const valueBytes = storm::utility::memory::getValueBytes(!std::is_same_v<ValueType, double>);
+        uint64_t const occupiedBytes =
+            storm::utility::memory::estimateSparseMatrixBytes(matrix.getRowCount(), matrix.getEntryCount(), matrix.getRowGroupCount(), valueBytes) +
+            storm::utility::memory::estimateMecDecompositionBytes(matrix.getRowGroupCount(), matrix.getRowCount(), matrix.getEntryCount());
+        uint64_t const limit = resourceSettings.getMemoryLimitInBytes();
+        uint64_t const budget = limit > occupiedBytes ? limit - occupiedBytes : 0;
+        auto const method = storm::utility::memory::selectMinMaxMethod(env.solver().minMax().getMethod(), matrix.getRowGroupCount(), matrix.getRowCount(),
+                                                                        valueBytes, budget);
+        if (method != env.solver().minMax().getMethod()) {
+            env.solver().minMax().setMethod(method);
+        }
+    }
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    std::optional<storm::modelchecker::WarmStartStore<ValueType>> warmStartStore;
+    if (modelCheckerSettings.isWarmStartSet()) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            warmStartStore.emplace(modelCheckerSettings.getWarmStartDirectory());
+        } else {
+            STORM_LOG_WARN("Warm starts are only supported for models with floating point values. Ignoring option.");
+        }
+    }
+    std::optional<storm::modelchecker::SparseReachabilityBatch<double>> reachabilityBatch;
+    if (modelCheckerSettings.isBatchReachabilitySet()) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            STORM_LOG_WARN_COND(!ioSettings.isExportSchedulerSet(), "Reachability properties are not checked together as schedulers are exported.");
+            if (!ioSettings.isExportSchedulerSet()) {
+                auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+                reachabilityBatch.emplace(sparseModel, storm::api::extractFormulasFromProperties(properties));
+            }
+        } else {
+            STORM_LOG_WARN("Checking reachability properties together is only supported for models with floating point values. Ignoring option.");
+        }
+    }
+    uint64_t numberOfParallelChecks = 1;
+    if (modelCheckerSettings.getNumberOfParallelProperties() > 1) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            STORM_LOG_WARN_COND(!warmStartStore && !reachabilityBatch,
+                                "Properties are checked one at a time because warm starts are used or reachability properties are checked together.");
+            if (!warmStartStore && !reachabilityBatch) {
+                // The threads available to the process are shared between the properties and the threads spawned by each check. Parallel loops
+                // via TBB need no adjustment as all threads submit their work to the same scheduler.
+                uint64_t const numberOfThreads = std::max<uint64_t>(1, storm::utility::getNumberOfThreads());
+                numberOfParallelChecks = std::min<uint64_t>(modelCheckerSettings.getNumberOfParallelProperties(), numberOfThreads);
+                uint64_t const threadsPerCheck = std::max<uint64_t>(1, numberOfThreads / numberOfParallelChecks);
+                env.modelchecker().setLtlThreads(std::min(env.modelchecker().getLtlThreads(), threadsPerCheck));
+                env.modelchecker().setEpochThreads(std::min(env.modelchecker().getEpochThreads(), threadsPerCheck));
+                STORM_LOG_INFO("Checking up to " << numberOfParallelChecks << " properties concurrently.");
+                // Create the data that is otherwise created lazily before the model is used by several threads
+                sparseModel->getTransitionMatrix().getRowGroupIndices();
+                sparseModel->getAnalysisCache();
+            }
+        } else {
+            STORM_LOG_WARN("Checking properties concurrently is only supported for models with floating point values. Checking them one at a time.");
+        }
+    }
+    auto verificationCallback = [&sparseModel, &ioSettings, &modelCheckerSettings, &env, &warmStartStore, &reachabilityBatch](
+                                    std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+        // Each check gets its own environment as properties might be checked concurrently.
+        storm::Environment const checkEnv = env;
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (warmStartStore && (sparseModel->isOfType(storm::models::ModelType::Dtmc) || sparseModel->isOfType(storm::models::ModelType::Mdp))) {
+                if (auto hint = warmStartStore->load(*sparseModel, *formula)) {
+                    task.setHint(std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(std::move(*hint)));
+                }
+            }
+        }
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        if (reachabilityBatch && reachabilityBatch->contains(*formula)) {
+            result = reachabilityBatch->check(checkEnv, *formula);
+        } else if (modelCheckerSettings.isTimeBoundsSet() &&
+                   (sparseModel->isOfType(storm::models::ModelType::Ctmc) || sparseModel->isOfType(storm::models::ModelType::Dtmc) ||
+                    sparseModel->isOfType(storm::models::ModelType::Mdp)) &&
+                   formula->isProbabilityOperatorFormula() && formula->asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+            result = storm::api::verifyForTimeBoundsWithSparseEngine<ValueType>(checkEnv, sparseModel, task, modelCheckerSettings.getTimeBounds());
+        } else {
+            result = storm::api::verifyWithSparseEngine<ValueType>(checkEnv, sparseModel, task);
+        }
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (warmStartStore && result && result->isExplicitQuantitativeCheckResult() && result->isResultForAllStates()) {
+                auto const& quantitativeResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+                warmStartStore->store(*sparseModel, *formula, quantitativeResult.getValueVector(),
+                                      quantitativeResult.hasScheduler() ? &quantitativeResult.getScheduler() : nullptr);
+            }
+        }
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else if (!states->isTrueFormula()) {  // No need to apply filter if it is the formula 'true'
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            filter = storm::api::verifyWithSparseEngine<ValueType>(checkEnv, sparseModel, storm::api::createTask<ValueType>(states, false));
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1226,6 +1707,7 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
     };
     uint64_t exportCount = 0;  // this number will be prepended to the export file name of schedulers and/or check results in case of multiple properties.
     auto postprocessingCallback = [&sparseModel, &ioSettings, &input, &exportCount](std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
+        storm::utility::telemetry::Scope telemetryScope("result-export");
         if (ioSettings.isExportSchedulerSet()) {
             if (result->isExplicitQuantitativeCheckResult()) {
                 if (result->template asExplicitQuantitativeCheckResult<ValueType>().hasScheduler()) {
@@ -1259,24 +1741,38 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
                                 "No information of state valuations available. The result output will use internal state ids. You might be interested in "
                                 "building the model with state valuations using --buildstateval.");
             STORM_LOG_WARN_COND(exportCount == 0, "Prepending " << exportCount << " to file name for this property because there are multiple properties.");
-            storm::api::exportCheckResultToJson(sparseModel, result,
-                                                (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename());
+            std::string const filename =
+                (exportCount == 0 ? std::string("") : std::to_string(exportCount)) + ioSettings.getExportCheckResultFilename();
+            storm::exporter::CheckResultExportOptions exportOptions;
+            exportOptions.format = storm::exporter::getCheckResultExportFormat(filename);
+            if (ioSettings.isExportCheckResultLabelSet()) {
+                exportOptions.stateLabel = ioSettings.getExportCheckResultLabel();
+            }
+            if (ioSettings.isExportCheckResultTopKSet()) {
+                exportOptions.topK = ioSettings.getExportCheckResultTopK();
+            }
+            storm::api::exportCheckResult(sparseModel, result, filename, exportOptions);
         }
         ++exportCount;
     };
     if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
-        verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+        auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+        if ((buildSettings.isExplorationStateLimitSet() || buildSettings.isExplorationMemoryLimitSet()) && sparseModel->hasLabel("unexplored")) {
+            verifyPropertiesOnPartiallyExploredModel<ValueType>(input, verificationCallback, postprocessingCallback);
+        } else {
+            verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback, numberOfParallelChecks);
+        }
     }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         computeStateValues<ValueType>(
             "steady-state probabilities",
-            [&mpi, &sparseModel]() { return storm::api::computeSteadyStateDistributionWithSparseEngine<ValueType>(mpi.env, sparseModel); }, input,
+            [&env, &sparseModel]() { return storm::api::computeSteadyStateDistributionWithSparseEngine<ValueType>(env, sparseModel); }, input,
             verificationCallback, postprocessingCallback);
     }
     if (ioSettings.isComputeExpectedVisitingTimesSet()) {
         computeStateValues<ValueType>(
             "expected visiting times",
-            [&mpi, &sparseModel]() { return storm::api::computeExpectedVisitingTimesWithSparseEngine<ValueType>(mpi.env, sparseModel); }, input,
+            [&env, &sparseModel]() { return storm::api::computeExpectedVisitingTimesWithSparseEngine<ValueType>(env, sparseModel); }, input,
             verificationCallback, postprocessingCallback);
     }
 }
@@ -1404,6 +1900,28 @@ std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTyp
     return model;
 }
 
+template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
+std::shared_ptr<storm::dd::DdManager<DdType>> getDdManager(std::shared_ptr<storm::models::ModelBase> const& model) {
+    if (model->isSymbolicModel()) {
+        if (auto symbolicModel = std::dynamic_pointer_cast<storm::models::symbolic::Model<DdType, VerificationValueType>>(model)) {
+            return symbolicModel->getManagerAsSharedPointer();
+        }
+        if (auto symbolicModel = std::dynamic_pointer_cast<storm::models::symbolic::Model<DdType, BuildValueType>>(model)) {
+            return symbolicModel->getManagerAsSharedPointer();
+        }
+    }
+    return nullptr;
+}
+
+template<storm::dd::DdType DdType>
+void processDdStatistics(storm::dd::DdManager<DdType> const& manager, std::string const& phase, storm::json<double>& exportedStatistics) {
+    storm::dd::DdManagerStatistics statistics = manager.getStatistics();
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        std::cout << "\n[" << phase << "] " << statistics;
+    }
+    exportedStatistics[phase] = statistics.toJson();
+}
+
 template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
 void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto abstractionSettings = storm::settings::getModule<storm::settings::modules::AbstractionSettings>();
@@ -1415,15 +1933,36 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Smc) {
+        verifyWithSmcEngine<VerificationValueType>(input, mpi);
+    } else if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExplicitDRBSet() &&
+               storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isOutOfCoreSet()) {
+        verifyWithMappedDrbModel<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
         if (model) {
+            auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            std::shared_ptr<storm::dd::DdManager<DdType>> ddManager = getDdManager<DdType, BuildValueType, VerificationValueType>(model);
+            storm::json<double> ddStatistics;
+            if (ddManager) {
+                processDdStatistics(*ddManager, "model-building", ddStatistics);
+            }
             if (counterexampleSettings.isCounterexampleSet()) {
                 generateCounterexamples<VerificationValueType>(model, input);
             } else {
                 verifyModel<DdType, VerificationValueType>(model, input, mpi);
             }
+            if (ddManager) {
+                processDdStatistics(*ddManager, "model-checking", ddStatistics);
+            }
+            if (ioSettings.isExportDdStatisticsSet()) {
+                STORM_LOG_WARN_COND(ddManager, "No DD statistics are exported as the model is not symbolic.");
+                std::ofstream stream;
+                storm::utility::openFile(ioSettings.getExportDdStatisticsFilename(), stream);
+                stream << storm::dumpJson(ddStatistics);
+                storm::utility::closeFile(stream);
+            }
         }
     }
 }
@@ -10,6 +10,9 @@
 // Includes for the linked libraries and versions header.
 #include "storm/adapters/IntelTbbAdapter.h"
 
+#ifdef STORM_HAVE_CUDA
+#include <cuda_runtime_api.h>
+#endif
 #ifdef STORM_HAVE_GLPK
 #include "glpk.h"
 #endif
@@ -101,6 +104,9 @@ void printVersion() {
 #ifdef STORM_HAVE_CARL
     STORM_PRINT("Linked with CArL v" << STORM_CARL_VERSION << ".\n");
 #endif
+#ifdef STORM_HAVE_CUDA
+    STORM_PRINT("Linked with CUDA runtime v" << CUDART_VERSION / 1000 << "." << (CUDART_VERSION % 1000) / 10 << ".\n");
+#endif
 #ifdef STORM_HAVE_GLPK
     STORM_PRINT("Linked with GNU Linear Programming Kit v" << GLP_MAJOR_VERSION << "." << GLP_MINOR_VERSION << ".\n");
 #endif
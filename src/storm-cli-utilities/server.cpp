@@ -0,0 +1,578 @@
+#include "storm-cli-utilities/server.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+#if defined LINUX || defined MACOS
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+namespace storm {
+namespace cli {
+
+namespace {
+typedef storm::json<double> Json;
+
+struct ResidentModel {
+    // Becomes ready once the model is built (or building it failed)
+    std::shared_future<void> ready;
+    // Only set for models given as prism program or jani model
+    std::optional<storm::storage::SymbolicModelDescription> description;
+    std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
+    // Shared by concurrent checks, which is why it is only accessed via const references (non-const access would drop the analysis cache)
+    std::shared_ptr<storm::models::sparse::Model<double> const> model;
+    // Parsing properties may declare variables in the expression manager of the model description
+    std::mutex parsingMutex;
+};
+
+/*!
+ * Writes the responses to one client and keeps track of the requests of the client that are not answered yet.
+ */
+class Client {
+   public:
+    explicit Client(std::function<void(std::string const&)> const& writeLine) : writeLine(writeLine) {}
+
+    void addPendingResponse() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++pendingResponses;
+    }
+
+    void respond(Json const& response) {
+        std::lock_guard<std::mutex> lock(mutex);
+        writeLine(storm::dumpJson(response, true));
+        STORM_LOG_ASSERT(pendingResponses > 0, "Unexpected response.");
+        if (--pendingResponses == 0) {
+            allResponded.notify_all();
+        }
+    }
+
+    void waitForPendingResponses() {
+        std::unique_lock<std::mutex> lock(mutex);
+        allResponded.wait(lock, [this]() { return pendingResponses == 0; });
+    }
+
+   private:
+    std::function<void(std::string const&)> writeLine;
+    std::mutex mutex;
+    std::condition_variable allResponded;
+    uint64_t pendingResponses = 0;
+};
+
+std::string getString(Json const& request, std::string const& key) {
+    auto it = request.find(key);
+    STORM_LOG_THROW(it != request.end() && it->is_string(), storm::exceptions::InvalidArgumentException,
+                    "Expected a string '" << key << "' in the request.");
+    return it->get<std::string>();
+}
+
+std::string getOptionalString(Json const& request, std::string const& key) {
+    return request.contains(key) ? getString(request, key) : "";
+}
+
+Json okResponse(Json const& id, Json response) {
+    response["status"] = "ok";
+    if (!id.is_null()) {
+        response["id"] = id;
+    }
+    return response;
+}
+
+Json errorResponse(Json const& id, std::string const& message) {
+    Json response;
+    response["status"] = "error";
+    response["message"] = message;
+    if (!id.is_null()) {
+        response["id"] = id;
+    }
+    return response;
+}
+
+template<typename ModelCheckerType, typename ModelType>
+std::unique_ptr<storm::modelchecker::CheckResult> checkWith(storm::Environment const& env, ModelType const& model,
+                                                            storm::modelchecker::CheckTask<storm::logic::Formula, double> const& task) {
+    ModelCheckerType modelchecker(model);
+    if (modelchecker.canHandle(task)) {
+        return modelchecker.check(env, task);
+    }
+    return nullptr;
+}
+
+/*!
+ * Checks the given resident model with the sparse engine. In contrast to storm::api::verifyWithSparseEngine, the model is only accessed via const
+ * references, so Markov automata have to be closed before.
+ */
+std::unique_ptr<storm::modelchecker::CheckResult> checkResidentModel(storm::Environment const& env, storm::models::sparse::Model<double> const& model,
+                                                                     storm::modelchecker::CheckTask<storm::logic::Formula, double> const& task) {
+    switch (model.getType()) {
+        case storm::models::ModelType::Dtmc:
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination &&
+                storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
+                return checkWith<storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>>>(
+                    env, *model.as<storm::models::sparse::Dtmc<double>>(), task);
+            }
+            return checkWith<storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>>>(
+                env, *model.as<storm::models::sparse::Dtmc<double>>(), task);
+        case storm::models::ModelType::Mdp:
+            return checkWith<storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>>(
+                env, *model.as<storm::models::sparse::Mdp<double>>(), task);
+        case storm::models::ModelType::Ctmc:
+            return checkWith<storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>>>(
+                env, *model.as<storm::models::sparse::Ctmc<double>>(), task);
+        case storm::models::ModelType::MarkovAutomaton:
+            STORM_LOG_ASSERT(model.as<storm::models::sparse::MarkovAutomaton<double>>()->isClosed(), "Resident Markov automaton is not closed.");
+            return checkWith<storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>>>(
+                env, *model.as<storm::models::sparse::MarkovAutomaton<double>>(), task);
+        case storm::models::ModelType::Smg:
+            return checkWith<storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>>>(
+                env, *model.as<storm::models::sparse::Smg<double>>(), task);
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << model.getType() << " is not supported by the sparse engine.");
+    }
+}
+
+Json buildModel(Json const& request, ResidentModel& residentModel) {
+    storm::utility::Stopwatch buildingWatch(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    std::string constants = getOptionalString(request, "constants");
+    std::string properties = getOptionalString(request, "properties");
+    if (request.contains("prism") || request.contains("jani")) {
+        storm::storage::SymbolicModelDescription description;
+        if (request.contains("prism")) {
+            description = storm::api::parseProgram(getString(request, "prism"));
+        } else {
+            description = storm::api::parseJaniModel(getString(request, "jani")).first;
+        }
+        residentModel.constantDefinitions = description.parseConstantDefinitions(constants);
+        description = description.preprocess(residentModel.constantDefinitions);
+        std::vector<storm::jani::Property> parsedProperties;
+        if (!properties.empty()) {
+            parsedProperties = storm::api::substituteConstantsInProperties(storm::api::parsePropertiesForSymbolicModelDescription(properties, description),
+                                                                           residentModel.constantDefinitions);
+        }
+        // Labels and reward models that are not referred to by the given properties might be used by later queries
+        storm::builder::BuilderOptions options(storm::api::extractFormulasFromProperties(parsedProperties), description);
+        options.setBuildAllLabels().setBuildAllRewardModels();
+        model = storm::api::buildSparseModel<double>(description, options);
+        residentModel.description = std::move(description);
+    } else if (request.contains("drb")) {
+        STORM_LOG_THROW(constants.empty(), storm::exceptions::NotSupportedException, "Constant definitions are not supported for drb files.");
+        model = storm::api::buildExplicitDRBModel<double>(getString(request, "drb"));
+    } else {
+        STORM_LOG_THROW(request.contains("drn"), storm::exceptions::InvalidArgumentException, "Expected a prism, jani, drn, or drb file in the request.");
+        STORM_LOG_THROW(constants.empty(), storm::exceptions::NotSupportedException, "Constant definitions are not supported for drn files.");
+        model = storm::api::buildExplicitDRNModel<double>(getString(request, "drn"));
+    }
+    STORM_LOG_THROW(model, storm::exceptions::NotSupportedException, "Unable to build the model.");
+    if (model->isOfType(storm::models::ModelType::MarkovAutomaton) && !model->as<storm::models::sparse::MarkovAutomaton<double>>()->isClosed()) {
+        model->as<storm::models::sparse::MarkovAutomaton<double>>()->close();
+    }
+    residentModel.model = model;
+    // Create the data that is otherwise created lazily before the model is used by several threads
+    residentModel.model->getTransitionMatrix().getRowGroupIndices();
+    residentModel.model->getAnalysisCache();
+    buildingWatch.stop();
+
+    Json response;
+    response["states"] = residentModel.model->getNumberOfStates();
+    response["transitions"] = residentModel.model->getNumberOfTransitions();
+    response["time-ms"] = buildingWatch.getTimeInMilliseconds();
+    return response;
+}
+
+Json checkProperty(ResidentModel& residentModel, std::string const& propertyString) {
+    // Throws if building the model failed
+    residentModel.ready.get();
+    storm::utility::Stopwatch checkingWatch(true);
+    std::vector<storm::jani::Property> properties;
+    if (residentModel.description) {
+        std::lock_guard<std::mutex> lock(residentModel.parsingMutex);
+        properties = storm::api::substituteConstantsInProperties(
+            storm::api::parsePropertiesForSymbolicModelDescription(propertyString, residentModel.description.value()), residentModel.constantDefinitions);
+    } else {
+        properties = storm::api::parseProperties(propertyString);
+    }
+    STORM_LOG_THROW(properties.size() == 1, storm::exceptions::InvalidArgumentException, "Expected exactly one property but got " << properties.size() << ".");
+
+    storm::Environment env;
+    env.modelchecker().setAnalysisCacheEnabled(true);
+    auto task = storm::api::createTask<double>(properties.front().getRawFormula(), true);
+    auto result = checkResidentModel(env, *residentModel.model, task);
+    STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "The property is not supported.");
+    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(residentModel.model->getInitialStates()));
+    checkingWatch.stop();
+
+    Json response;
+    if (result->isExplicitQualitativeCheckResult()) {
+        response["result"] = result->asExplicitQualitativeCheckResult().toJson<double>();
+    } else {
+        STORM_LOG_THROW(result->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException, "Unexpected type of check result.");
+        response["result"] = result->asExplicitQuantitativeCheckResult<double>().toJson();
+    }
+    response["time-ms"] = checkingWatch.getTimeInMilliseconds();
+    return response;
+}
+
+/*!
+ * Keeps the loaded models and handles the requests of all clients. Loading and checking is done by a pool of workers.
+ */
+class ModelServer {
+   public:
+    explicit ModelServer(uint64_t numberOfThreads) {
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    ~ModelServer() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        taskAdded.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /*!
+     * Handles the given request line. The response is given to the client, possibly after this function returned and from another thread.
+     * @return false iff the request asks the server to shut down.
+     */
+    bool handle(std::string const& line, std::shared_ptr<Client> const& client) {
+        client->addPendingResponse();
+        Json id;
+        std::string command;
+        try {
+            Json request = Json::parse(line);
+            STORM_LOG_THROW(request.is_object(), storm::exceptions::InvalidArgumentException, "Expected a json object as request.");
+            if (request.contains("id")) {
+                id = request["id"];
+            }
+            command = getString(request, "command");
+            if (command == "load") {
+                load(id, request, client);
+            } else if (command == "check") {
+                check(id, request, client);
+            } else if (command == "unload") {
+                unload(getString(request, "model"));
+                client->respond(okResponse(id, Json::object()));
+            } else if (command == "list") {
+                client->respond(okResponse(id, list()));
+            } else {
+                STORM_LOG_THROW(command == "shutdown", storm::exceptions::InvalidArgumentException, "Unknown command '" << command << "'.");
+                client->respond(okResponse(id, Json::object()));
+            }
+        } catch (std::exception const& e) {
+            client->respond(errorResponse(id, e.what()));
+        }
+        return command != "shutdown";
+    }
+
+   private:
+    struct Task {
+        Json id;
+        std::shared_ptr<Client> client;
+        std::function<Json()> compute;
+    };
+
+    void work() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskAdded.wait(lock, [this]() { return stopped || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            Json response;
+            try {
+                response = okResponse(task.id, task.compute());
+            } catch (std::exception const& e) {
+                response = errorResponse(task.id, e.what());
+            }
+            task.client->respond(response);
+        }
+    }
+
+    // Tasks are processed in the order in which they are added. Hence, a model is always built by a worker before (or while) it is checked.
+    void addTask(Task&& task) {
+        tasks.push_back(std::move(task));
+        taskAdded.notify_one();
+    }
+
+    void load(Json const& id, Json const& request, std::shared_ptr<Client> const& client) {
+        std::string name = getString(request, "model");
+        auto residentModel = std::make_shared<ResidentModel>();
+        auto built = std::make_shared<std::promise<void>>();
+        residentModel->ready = built->get_future().share();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        STORM_LOG_THROW(models.count(name) == 0, storm::exceptions::InvalidArgumentException, "A model with name '" << name << "' is already loaded.");
+        models[name] = residentModel;
+        addTask({id, client, [this, name, request, residentModel, built]() {
+                     try {
+                         Json response = buildModel(request, *residentModel);
+                         built->set_value();
+                         return response;
+                     } catch (...) {
+                         built->set_exception(std::current_exception());
+                         std::lock_guard<std::mutex> lock(mutex);
+                         auto it = models.find(name);
+                         if (it != models.end() && it->second == residentModel) {
+                             models.erase(it);
+                         }
+                         throw;
+                     }
+                 }});
+    }
+
+    void check(Json const& id, Json const& request, std::shared_ptr<Client> const& client) {
+        std::string name = getString(request, "model");
+        std::string property = getString(request, "property");
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = models.find(name);
+        STORM_LOG_THROW(it != models.end(), storm::exceptions::InvalidArgumentException, "No model with name '" << name << "' is loaded.");
+        // Running checks keep the model alive even if it is unloaded meanwhile
+        addTask({id, client, [residentModel = it->second, property]() { return checkProperty(*residentModel, property); }});
+    }
+
+    void unload(std::string const& name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        STORM_LOG_THROW(models.erase(name) > 0, storm::exceptions::InvalidArgumentException, "No model with name '" << name << "' is loaded.");
+    }
+
+    Json list() {
+        std::lock_guard<std::mutex> lock(mutex);
+        Json modelList = Json::array();
+        for (auto const& entry : models) {
+            Json modelInfo;
+            modelInfo["name"] = entry.first;
+            bool isBuilt = entry.second->ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready && entry.second->model;
+            modelInfo["built"] = isBuilt;
+            if (isBuilt) {
+                modelInfo["states"] = entry.second->model->getNumberOfStates();
+                modelInfo["transitions"] = entry.second->model->getNumberOfTransitions();
+            }
+            modelList.push_back(std::move(modelInfo));
+        }
+        Json response;
+        response["models"] = std::move(modelList);
+        return response;
+    }
+
+    std::mutex mutex;
+    std::condition_variable taskAdded;
+    std::deque<Task> tasks;
+    bool stopped = false;
+    std::map<std::string, std::shared_ptr<ResidentModel>> models;
+    std::vector<std::thread> workers;
+};
+
+bool isBlank(std::string const& line) {
+    return std::all_of(line.begin(), line.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+}
+
+void serveStandardInput(ModelServer& server) {
+    auto client = std::make_shared<Client>([](std::string const& response) { std::cout << response << '\n' << std::flush; });
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        if (!isBlank(line) && !server.handle(line, client)) {
+            break;
+        }
+    }
+    client->waitForPendingResponses();
+}
+
+#if defined LINUX || defined MACOS
+void sendLine(int connection, std::string const& line) {
+    std::string data = line + "\n";
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags = MSG_NOSIGNAL;
+#endif
+    uint64_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t sentNow = ::send(connection, data.data() + sent, data.size() - sent, flags);
+        if (sentNow < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sentNow <= 0) {
+            STORM_LOG_WARN("Unable to send a response as the client disconnected.");
+            return;
+        }
+        sent += sentNow;
+    }
+}
+
+// The state shared by the thread accepting connections and the threads serving them
+struct Connections {
+    std::mutex mutex;
+    std::condition_variable closed;
+    std::set<int> open;
+    bool shutdownRequested = false;
+};
+
+void serveSocket(ModelServer& server, std::string const& socketPath) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    STORM_LOG_THROW(socketPath.size() < sizeof(address.sun_path), storm::exceptions::InvalidArgumentException,
+                    "The socket path '" << socketPath << "' is too long.");
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    STORM_LOG_THROW(listener >= 0, storm::exceptions::FileIoException, "Unable to create a socket: " << std::strerror(errno) << ".");
+    ::unlink(socketPath.c_str());
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, SOMAXCONN) != 0) {
+        std::string error = std::strerror(errno);
+        ::close(listener);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on socket '" << socketPath << "': " << error << ".");
+    }
+    STORM_PRINT_AND_LOG("Listening on socket '" << socketPath << "'.\n");
+
+    auto connections = std::make_shared<Connections>();
+    auto requestShutdown = [connections, address]() {
+        {
+            std::lock_guard<std::mutex> lock(connections->mutex);
+            connections->shutdownRequested = true;
+            // Stop reading further requests of all clients
+            for (auto const& connection : connections->open) {
+                ::shutdown(connection, SHUT_RD);
+            }
+        }
+        // Wake up the thread waiting for new connections
+        int wakeUp = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (wakeUp >= 0) {
+            ::connect(wakeUp, reinterpret_cast<sockaddr const*>(&address), sizeof(address));
+            ::close(wakeUp);
+        }
+    };
+    auto serveConnection = [&server, connections, requestShutdown](int connection) {
+        auto client = std::make_shared<Client>([connection](std::string const& response) { sendLine(connection, response); });
+        std::string buffer;
+        char chunk[4096];
+        bool reading = true;
+        while (reading) {
+            ssize_t received = ::recv(connection, chunk, sizeof(chunk), 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received <= 0) {
+                break;
+            }
+            buffer.append(chunk, received);
+            std::string::size_type lineEnd;
+            while (reading && (lineEnd = buffer.find('\n')) != std::string::npos) {
+                std::string line = buffer.substr(0, lineEnd);
+                buffer.erase(0, lineEnd + 1);
+                if (!isBlank(line) && !server.handle(line, client)) {
+                    reading = false;
+                    requestShutdown();
+                }
+            }
+        }
+        client->waitForPendingResponses();
+        std::lock_guard<std::mutex> lock(connections->mutex);
+        connections->open.erase(connection);
+        ::close(connection);
+        connections->closed.notify_all();
+    };
+
+    while (true) {
+        int connection = ::accept(listener, nullptr, nullptr);
+        if (connection < 0 && errno == EINTR) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(connections->mutex);
+        if (connections->shutdownRequested || connection < 0) {
+            STORM_LOG_ERROR_COND(connections->shutdownRequested, "Unable to accept a connection: " << std::strerror(errno) << ".");
+            if (connection >= 0) {
+                ::close(connection);
+            }
+            break;
+        }
+#ifdef SO_NOSIGPIPE
+        int noSigPipe = 1;
+        ::setsockopt(connection, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+        connections->open.insert(connection);
+        std::thread(serveConnection, connection).detach();
+    }
+
+    // Answer the pending requests of all clients
+    {
+        std::unique_lock<std::mutex> lock(connections->mutex);
+        connections->closed.wait(lock, [&connections]() { return connections->open.empty(); });
+    }
+    ::close(listener);
+    ::unlink(socketPath.c_str());
+}
+#endif
+}  // namespace
+
+void runServer(std::string const& socketPath) {
+    ModelServer server(std::max<uint64_t>(1, storm::utility::getNumberOfThreads()));
+    if (socketPath.empty()) {
+        serveStandardInput(server);
+    } else {
+#if defined LINUX || defined MACOS
+        serveSocket(server, socketPath);
+#else
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unix domain sockets are not supported on this platform.");
+#endif
+    }
+}
+
+}  // namespace cli
+}  // namespace storm
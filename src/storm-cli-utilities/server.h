@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+namespace cli {
+
+/*!
+ * Runs Storm as a server that keeps built models in memory and answers queries until it is asked to shut down.
+ * Each request is a json object on a single line and is answered by a json object on a single line. The requests are
+ *  - {"command": "load", "model": name, "prism"|"jani"|"drn"|"drb": path, "constants": definitions, "properties": properties}
+ *    builds the sparse model of the given file and keeps it under the given name. The constants and properties are optional. Properties are only
+ *    needed if they refer to expressions over model variables, as the labels of these expressions have to be built with the model.
+ *  - {"command": "check", "model": name, "property": property} checks the property on the model and responds with the result for the initial states.
+ *  - {"command": "unload", "model": name} removes the model.
+ *  - {"command": "list"} responds with the names and sizes of the loaded models.
+ *  - {"command": "shutdown"} stops the server once all pending requests are answered.
+ * An optional "id" of a request is copied to its response. Each response has a "status" ("ok" or "error") and a "message" in case of an error.
+ * Loading and checking is done concurrently by as many workers as there are threads, such that responses may arrive in a different order than the
+ * requests. Checks of the same model share its analysis cache.
+ * Several processes that check the same model (e.g. the jobs of a batch service) should send their requests to one server per machine instead of
+ * loading the model themselves, such that the model is kept in memory only once.
+ *
+ * @param socketPath The path of the unix domain socket on which the server listens for clients. If empty, requests are read from the standard
+ * input and responses are written to the standard output. Clients should ignore output lines that are not json objects (e.g. log messages).
+ */
+void runServer(std::string const& socketPath);
+
+}  // namespace cli
+}  // namespace storm
@@ -11,8 +11,15 @@
 
 #include "storm-cli-utilities/cli.h"
 #include "storm-cli-utilities/model-handling.h"
+#include "storm-cli-utilities/server.h"
 
 void processOptions() {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    if (ioSettings.isServerSet()) {
+        storm::cli::runServer(ioSettings.getServerSocket());
+        return;
+    }
+
     // Parse symbolic input (PRISM, JANI, properties, etc.)
     storm::cli::SymbolicInput symbolicInput = storm::cli::parseSymbolicInput();
 
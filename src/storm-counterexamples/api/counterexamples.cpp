@@ -49,8 +49,10 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCoun
 
     // Check if counterexample is even possible
     storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+    // Non-const access to the transition matrix would invalidate the cached backward transitions.
+    storm::models::sparse::Model<double> const& constModel = *model;
     auto results = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeUntilProbabilities(
-        env, false, model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, subQualitativeResult.getTruthValuesVector(), true);
+        env, false, constModel.getTransitionMatrix(), *constModel.getBackwardTransitions(), phiStates, subQualitativeResult.getTruthValuesVector(), true);
     double reachProb = results.at(initialState);
     STORM_LOG_THROW((reachProb > threshold) || (strictBound && reachProb >= threshold), storm::exceptions::InvalidArgumentException,
                     "Given probability threshold " << threshold << " cannot be " << (strictBound ? "achieved" : "exceeded")
@@ -101,10 +101,10 @@ class MILPMinimalLabelSetGenerator {
     static struct StateInformation determineRelevantAndProblematicStates(storm::models::sparse::Mdp<T> const& mdp, storm::storage::BitVector const& phiStates,
                                                                          storm::storage::BitVector const& psiStates) {
         StateInformation result;
-        result.relevantStates = storm::utility::graph::performProbGreater0E(mdp.getBackwardTransitions(), phiStates, psiStates);
+        result.relevantStates = storm::utility::graph::performProbGreater0E(*mdp.getBackwardTransitions(), phiStates, psiStates);
         result.relevantStates &= ~psiStates;
         result.problematicStates = storm::utility::graph::performProb0E(mdp.getTransitionMatrix(), mdp.getNondeterministicChoiceIndices(),
-                                                                        mdp.getBackwardTransitions(), phiStates, psiStates);
+                                                                        *mdp.getBackwardTransitions(), phiStates, psiStates);
         result.problematicStates &= result.relevantStates;
         STORM_LOG_DEBUG("Found " << phiStates.getNumberOfSetBits() << " filter states.");
         STORM_LOG_DEBUG("Found " << psiStates.getNumberOfSetBits() << " target states.");
@@ -695,7 +695,8 @@ class MILPMinimalLabelSetGenerator {
     static uint_fast64_t assertSchedulerCuts(storm::solver::LpSolver<double>& solver, storm::models::sparse::Mdp<T> const& mdp,
                                              storm::storage::BitVector const& psiStates, StateInformation const& stateInformation,
                                              ChoiceInformation const& choiceInformation, VariableInformation const& variableInformation) {
-        storm::storage::SparseMatrix<T> backwardTransitions = mdp.getBackwardTransitions();
+        auto const backwardTransitionsPtr = mdp.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = *backwardTransitionsPtr;
         uint_fast64_t numberOfConstraintsCreated = 0;
 
         for (auto state : stateInformation.relevantStates) {
@@ -939,7 +940,7 @@ class MILPMinimalLabelSetGenerator {
             storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelcheckerHelper;
             std::vector<T> result = std::move(
                 modelcheckerHelper
-                    .computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), mdp.getBackwardTransitions(), phiStates, psiStates, false, false)
+                    .computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), *mdp.getBackwardTransitions(), phiStates, psiStates, false, false)
                     .values);
             for (auto state : mdp.getInitialStates()) {
                 maximalReachabilityProbability = std::max(maximalReachabilityProbability, result[state]);
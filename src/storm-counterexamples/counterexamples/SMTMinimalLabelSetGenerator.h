@@ -2,11 +2,14 @@
 
 #include <chrono>
 #include <queue>
+#include <set>
+#include <tuple>
 
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -132,7 +135,8 @@ class SMTMinimalLabelSetGenerator {
 
         // Compute all relevant states, i.e. states for which there exists a scheduler that has a non-zero
         // probabilitiy of satisfying phi until psi.
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        auto const backwardTransitionsPtr = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = *backwardTransitionsPtr;
         relevancyInformation.relevantStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates);
         relevancyInformation.relevantStates &= ~psiStates;
 
@@ -368,7 +372,8 @@ class SMTMinimalLabelSetGenerator {
 
         // Get some data from the model for convenient access.
         storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        auto const backwardTransitionsPtr = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = *backwardTransitionsPtr;
         storm::storage::BitVector const& initialStates = model.getInitialStates();
 
         for (auto currentState : relevancyInformation.relevantStates) {
@@ -898,7 +903,8 @@ class SMTMinimalLabelSetGenerator {
 
         // Get some data from the model for convenient access.
         storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
-        storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+        auto const backwardTransitionsPtr = model.getBackwardTransitions();
+        storm::storage::SparseMatrix<T> const& backwardTransitions = *backwardTransitionsPtr;
 
         // First, we add the formulas that encode
         // (1) if an incoming transition is chosen, an outgoing one is chosen as well (for non-initial states)
@@ -1394,7 +1400,7 @@ class SMTMinimalLabelSetGenerator {
 
         storm::storage::BitVector unreachableRelevantStates = ~reachableStates & relevancyInformation.relevantStates;
         storm::storage::BitVector statesThatCanReachTargetStates =
-            storm::utility::graph::performProbGreater0E(subModel.getBackwardTransitions(), phiStates, psiStates);
+            storm::utility::graph::performProbGreater0E(*subModel.getBackwardTransitions(), phiStates, psiStates);
 
         storm::storage::FlatSet<uint_fast64_t> locallyRelevantLabels;
         std::set_difference(relevancyInformation.relevantLabels.begin(), relevancyInformation.relevantLabels.end(), commandSet.begin(), commandSet.end(),
@@ -1525,7 +1531,7 @@ class SMTMinimalLabelSetGenerator {
 
         storm::storage::BitVector unreachableRelevantStates = ~reachableStates & relevancyInformation.relevantStates;
         storm::storage::BitVector statesThatCanReachTargetStates =
-            storm::utility::graph::performProbGreater0E(subModel.getBackwardTransitions(), phiStates, psiStates);
+            storm::utility::graph::performProbGreater0E(*subModel.getBackwardTransitions(), phiStates, psiStates);
 
         storm::storage::FlatSet<uint_fast64_t> locallyRelevantLabels;
         std::set_difference(relevancyInformation.relevantLabels.begin(), relevancyInformation.relevantLabels.end(), commandSet.begin(), commandSet.end(),
@@ -1656,7 +1662,7 @@ class SMTMinimalLabelSetGenerator {
             if (rewardName == boost::none) {
                 results.push_back(storm::utility::zero<T>());
                 allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeUntilProbabilities(
-                    env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), phiStates, psiStates, false);
+                    env, false, model.getTransitionMatrix(), *model.getBackwardTransitions(), phiStates, psiStates, false);
                 for (auto state : model.getInitialStates()) {
                     STORM_LOG_TRACE("Found probability " << allStatesResult[state]);
                     results.back() = std::max(results.back(), allStatesResult[state]);
@@ -1666,7 +1672,7 @@ class SMTMinimalLabelSetGenerator {
                 for (auto const& rewName : rewardName.get()) {
                     results.push_back(storm::utility::zero<T>());
                     allStatesResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<T>::computeReachabilityRewards(
-                        env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), model.getRewardModel(rewName), psiStates, false);
+                        env, false, model.getTransitionMatrix(), *model.getBackwardTransitions(), model.getRewardModel(rewName), psiStates, false);
                     for (auto state : model.getInitialStates()) {
                         results.back() = std::max(results.back(), allStatesResult[state]);
                     }
@@ -1678,7 +1684,7 @@ class SMTMinimalLabelSetGenerator {
                 storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelCheckerHelper;
                 allStatesResult = std::move(
                     modelCheckerHelper
-                        .computeUntilProbabilities(env, false, model.getTransitionMatrix(), model.getBackwardTransitions(), phiStates, psiStates, false, false)
+                        .computeUntilProbabilities(env, false, model.getTransitionMatrix(), *model.getBackwardTransitions(), phiStates, psiStates, false, false)
                         .values);
                 for (auto state : model.getInitialStates()) {
                     results.back() = std::max(results.back(), allStatesResult[state]);
@@ -1692,6 +1698,40 @@ class SMTMinimalLabelSetGenerator {
         return results;
     }
 
+    /*!
+     * The result of checking a candidate label set.
+     */
+    struct CandidateCheckResult {
+        std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+        std::vector<double> propertyValue;
+        bool targetReachable = false;
+        /// Set if the label set was already found to be insufficient, in which case nothing else was computed.
+        bool knownInsufficient = false;
+    };
+
+    /*!
+     * Restricts the model to the given label set and computes the maximal property value in the restricted model.
+     * This does not modify shared state, so multiple candidates can be checked concurrently.
+     */
+    static CandidateCheckResult checkCandidate(Environment const& env, storm::models::sparse::Model<T> const& model,
+                                               storm::storage::FlatSet<uint_fast64_t> const& commandSet, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, boost::optional<std::vector<std::string>> const& rewardName) {
+        CandidateCheckResult result;
+        std::tie(result.subModel, result.subLabelSets) =
+            restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+        storm::storage::BitVector reachableStates =
+            storm::utility::graph::getReachableStates(result.subModel->getTransitionMatrix(), result.subModel->getInitialStates(), phiStates, psiStates);
+        result.targetReachable = !reachableStates.isDisjointFrom(psiStates);
+        if (!rewardName && !result.targetReachable) {
+            // The probability is zero, so there is no need to invoke the model checker.
+            result.propertyValue.push_back(storm::utility::zero<double>());
+        } else {
+            result.propertyValue = computeMaximalReachabilityProbability(env, *result.subModel, phiStates, psiStates, rewardName);
+        }
+        return result;
+    }
+
    public:
     struct Options {
         Options(bool checkThresholdFeasible = false) : checkThresholdFeasible(checkThresholdFeasible) {
@@ -1699,6 +1739,7 @@ class SMTMinimalLabelSetGenerator {
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            candidateBatchSize = settings.getCandidateBatchSize();
         }
 
         bool checkThresholdFeasible;
@@ -1710,6 +1751,8 @@ class SMTMinimalLabelSetGenerator {
         uint64_t maximumCounterexamples = 1;
         uint64_t multipleCounterexampleSizeCap = 100000000;
         uint64_t maximumExtraIterations = 100000000;
+        /// The number of candidate command sets of the same size that are checked together (in parallel if TBB is enabled).
+        uint64_t candidateBatchSize = 1;
     };
 
     struct GeneratorStats {
@@ -1852,10 +1895,11 @@ class SMTMinimalLabelSetGenerator {
         uint_fast64_t zeroProbabilityCount = 0;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
+        // The command sets that were checked and do not suffice to achieve the threshold.
+        std::set<storm::storage::FlatSet<uint_fast64_t>> insufficientLabelSets;
+        uint_fast64_t cachedCandidateCount = 0;
         do {
-            ++iterations;
-
-            if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
+            if (result.size() > 0 && iterations >= firstCounterexampleFound + options.maximumExtraIterations) {
                 break;
             }
             if (result.size() == 0) {
@@ -1864,22 +1908,37 @@ class SMTMinimalLabelSetGenerator {
             }
             STORM_LOG_DEBUG("Computing minimal command set.");
             solverClock = std::chrono::high_resolution_clock::now();
+            std::vector<storm::storage::FlatSet<uint_fast64_t>> candidates;
             boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+            if (smallest != boost::none) {
+                candidates.push_back(std::move(smallest.get()));
+                // Further candidates of the same size are obtained by excluding the previous ones. This is sound as every candidate is either no
+                // counterexample or it is a counterexample, in which case all bigger solutions are ruled out anyway.
+                while (candidates.size() < options.candidateBatchSize) {
+                    ruleOutSingleSolution(*solver, candidates.back(), variableInformation, relevancyInformation);
+                    if (solver->checkWithAssumptions({!variableInformation.auxiliaryVariables.back()}) != storm::solver::SmtSolver::CheckResult::Sat) {
+                        break;
+                    }
+                    candidates.push_back(getUsedLabelSet(*solver->getModel(), variableInformation));
+                }
+            }
             totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-            if (smallest == boost::none) {
+            if (candidates.empty()) {
                 STORM_LOG_DEBUG("No further counterexamples.");
                 break;
-            } else {
-                commandSet = smallest.get();
             }
-            STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
-                                                                   << commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size()
-                                                                   << " + " << relevancyInformation.knownLabels.size() << ") ");
+            STORM_LOG_DEBUG("Computed " << candidates.size() << " minimal command set(s) with bound " << currentBound << " and size "
+                                        << candidates.front().size() + relevancyInformation.knownLabels.size() << " (" << candidates.front().size() << " + "
+                                        << relevancyInformation.knownLabels.size() << ") ");
 
-            // Restrict the given model to the current set of labels and compute the reachability probability.
+            // Restrict the given model to the current sets of labels and compute the reachability probability.
             modelCheckingClock = std::chrono::high_resolution_clock::now();
-            commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-            commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+            for (auto& candidate : candidates) {
+                candidate.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                candidate.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+            }
+            // All candidates have the same size.
+            commandSet = candidates.front();
             if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
                 (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
                 STORM_LOG_DEBUG("No further counterexamples of similar size.");
@@ -1891,66 +1950,95 @@ class SMTMinimalLabelSetGenerator {
                 break;
             }
 
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
-
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            std::vector<CandidateCheckResult> checkResults(candidates.size());
+            auto checkCandidates = [&](uint64_t begin, uint64_t end) {
+                for (uint64_t candidateIndex = begin; candidateIndex < end; ++candidateIndex) {
+                    if (insufficientLabelSets.count(candidates[candidateIndex]) > 0) {
+                        checkResults[candidateIndex].knownInsufficient = true;
+                    } else {
+                        checkResults[candidateIndex] = checkCandidate(env, model, candidates[candidateIndex], phiStates, psiStates, rewardName);
+                    }
+                }
+            };
+            bool checkedInParallel = false;
+#ifdef STORM_HAVE_INTELTBB
+            if (candidates.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, candidates.size(), 1),
+                                  [&checkCandidates](tbb::blocked_range<uint64_t> const& range) { checkCandidates(range.begin(), range.end()); });
+                checkedInParallel = true;
+            }
+#endif
+            if (!checkedInParallel) {
+                checkCandidates(0, candidates.size());
+            }
             totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
             // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
-            // process.
+            // process. The candidates are processed in the order in which the solver found them, so the result does not depend on the parallel checks.
             analysisClock = std::chrono::high_resolution_clock::now();
-            bool violation = false;
-            for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
-                violation |=
-                    (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
-            }
-
-            if (violation) {
-                if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
-                    ++zeroProbabilityCount;
+            for (uint64_t candidateIndex = 0; candidateIndex < candidates.size() && !done; ++candidateIndex) {
+                ++iterations;
+                commandSet = candidates[candidateIndex];
+                CandidateCheckResult const& checkResult = checkResults[candidateIndex];
+                if (checkResult.knownInsufficient) {
+                    // The solver proposed a command set that was already checked, i.e., the previous analysis did not rule it out.
+                    STORM_LOG_DEBUG("Command set was already checked; ruling it out.");
+                    ++cachedCandidateCount;
+                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                    continue;
+                }
+                std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = checkResult.subModel;
+                std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = checkResult.subLabelSets;
+                maximalPropertyValue = checkResult.propertyValue;
+
+                bool violation = false;
+                for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                    violation |=
+                        (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
                 }
 
-                if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
-
-                    if (reachableStates.isDisjointFrom(psiStates)) {
-                        // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                        analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                       variableInformation, relevancyInformation);
-                    } else {
-                        // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient
-                        // to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                        analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                               variableInformation, relevancyInformation);
+                if (violation) {
+                    insufficientLabelSets.insert(commandSet);
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++zeroProbabilityCount;
                     }
 
-                    if (relevancyInformation.dontCareLabels.size() > 0) {
+                    if (options.useDynamicConstraints) {
+                        // Determine which of the two analysis techniques to call depending on whether a target state is reachable.
+                        if (!checkResult.targetReachable) {
+                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                            analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                           variableInformation, relevancyInformation);
+                        } else {
+                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was
+                            // insufficient to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                            analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                                   variableInformation, relevancyInformation);
+                        }
+
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        // Do not guide solver, just rule out current solution.
                         ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
                     }
                 } else {
-                    // Do not guide solver, just rule out current solution.
-                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
-                }
-            } else {
-                STORM_LOG_DEBUG("Found a counterexample.");
-                if (result.empty()) {
-                    // If this is the first counterexample we find, we store when we found it.
-                    firstCounterexampleFound = iterations;
-                }
-                result.push_back(commandSet);
-                if (options.maximumCounterexamples > result.size()) {
-                    STORM_LOG_DEBUG("Exclude counterexample for future.");
-                    ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
-                } else {
-                    STORM_LOG_DEBUG("Stop searching for further counterexamples.");
-                    done = true;
+                    STORM_LOG_DEBUG("Found a counterexample.");
+                    if (result.empty()) {
+                        // If this is the first counterexample we find, we store when we found it.
+                        firstCounterexampleFound = iterations;
+                    }
+                    result.push_back(commandSet);
+                    if (options.maximumCounterexamples > result.size()) {
+                        STORM_LOG_DEBUG("Exclude counterexample for future.");
+                        ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
+                    } else {
+                        STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                        done = true;
+                    }
+                    smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
                 }
-                smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
             }
             totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
 
@@ -1998,7 +2086,8 @@ class SMTMinimalLabelSetGenerator {
             std::cout << "Other:\n";
             std::cout << "    * number of models checked: " << iterations << '\n';
             std::cout << "    * number of models that could not reach a target state: " << zeroProbabilityCount << " ("
-                      << 100 * static_cast<double>(zeroProbabilityCount) / iterations << "%)\n\n";
+                      << 100 * static_cast<double>(zeroProbabilityCount) / iterations << "%)\n";
+            std::cout << "    * number of command sets that were proposed again: " << cachedCandidateCount << "\n\n";
         }
 
         return result;
@@ -2191,7 +2280,7 @@ class SMTMinimalLabelSetGenerator {
             // Modify the phi and psi states appropriately.
             storm::storage::BitVector statesWithProbability0E =
                 storm::utility::graph::performProb0E(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(),
-                                                     model.getBackwardTransitions(), result.phiStates, result.psiStates);
+                                                     *model.getBackwardTransitions(), result.phiStates, result.psiStates);
             result.phiStates = ~result.psiStates;
             result.psiStates = std::move(statesWithProbability0E);
 
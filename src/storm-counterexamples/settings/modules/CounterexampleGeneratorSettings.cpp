@@ -21,6 +21,7 @@ const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionNam
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
 const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+const std::string CounterexampleGeneratorSettings::candidateBatchSizeOptionName = "cexbatch";
 
 CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false,
@@ -64,6 +65,15 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                                    "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, candidateBatchSizeOptionName, true,
+                                                   "Sets how many candidate command sets of the same size are checked together in the MAXSAT-based "
+                                                   "counterexample generation. The candidates of a batch are checked in parallel if Intel TBB is enabled.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of candidates per batch.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool CounterexampleGeneratorSettings::isCounterexampleSet() const {
@@ -106,6 +116,10 @@ bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
     return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CounterexampleGeneratorSettings::getCandidateBatchSize() const {
+    return this->getOption(candidateBatchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool CounterexampleGeneratorSettings::check() const {
     STORM_LOG_THROW(isCounterexampleSet() || !isCounterexampleTypeSet(), storm::exceptions::InvalidSettingsException,
                     "Counterexample type was set but counterexample flag '-cex' is missing.");
@@ -91,6 +91,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseDynamicConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of candidate command sets of the same size that the MAXSAT-based technique checks together.
+     *
+     * @return The number of candidates per batch.
+     */
+    uint64_t getCandidateBatchSize() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -106,6 +113,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
     static const std::string noDynamicConstraintsOptionName;
+    static const std::string candidateBatchSizeOptionName;
 };
 
 }  // namespace modules
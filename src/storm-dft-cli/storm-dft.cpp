@@ -73,9 +73,11 @@ void processOptions() {
 
     bool useSMT = false;
     uint64_t solverTimeout = 10;
+    uint64_t smtThreads = 1;
 #ifdef STORM_HAVE_Z3
     if (faultTreeSettings.solveWithSMT()) {
         useSMT = true;
+        smtThreads = faultTreeSettings.getSmtThreads();
         STORM_LOG_DEBUG("Use SMT for preprocessing");
     }
 #endif
@@ -143,7 +145,7 @@ void processOptions() {
         auto const additionalRelevantEventNames{faultTreeSettings.getRelevantEvents()};
         storm::dft::api::analyzeDFTBdd<ValueType>(dft, isExportToBddDot, filename, isMTTF, mttfPrecision, mttfStepsize, mttfAlgorithm, isMinimalCutSets,
                                                   probabilityAnalysis, isModularisation, importanceMeasureName, timepoints, manuallyInputtedProperties,
-                                                  additionalRelevantEventNames, chunksize);
+                                                  additionalRelevantEventNames, chunksize, faultTreeSettings.getModularisationThreads());
 
         // don't perform other analysis if analyzeWithBdds is set
         if (dftIOSettings.isAnalyzeWithBdds()) {
@@ -213,7 +215,7 @@ void processOptions() {
     STORM_LOG_DEBUG("DFT after preparation for Markov analysis:\n" << dft->getElementsString());
 
     // Check which FDEPs actually introduce conflicts which need non-deterministic resolution
-    bool hasConflicts = storm::dft::api::computeDependencyConflicts(*dft, useSMT, solverTimeout);
+    bool hasConflicts = storm::dft::api::computeDependencyConflicts(*dft, useSMT, solverTimeout, smtThreads);
     if (hasConflicts) {
         STORM_LOG_DEBUG("FDEP conflicts found.");
     } else {
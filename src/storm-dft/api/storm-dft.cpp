@@ -24,7 +24,7 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
                    double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName, bool const calculateMCS,
                    bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads) {
     if (calculateMttf) {
         if (mttfAlgorithmName == "proceeding") {
             std::cout << "The numerically approximated MTTF is " << storm::dft::utility::MTTFHelperProceeding(dft, mttfStepsize, mttfPrecision) << '\n';
@@ -34,13 +34,9 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
     }
 
     if (useModularisation && calculateProbability) {
-        storm::dft::modelchecker::DftModularizationChecker checker{dft};
-        if (chunksize == 1) {
-            for (auto const& timebound : timepoints) {
-                auto const probability{checker.getProbabilityAtTimebound(timebound)};
-                std::cout << "System failure probability at timebound " << timebound << " is " << probability << '\n';
-            }
-        } else {
+        storm::dft::modelchecker::DftModularizationChecker checker{dft, numberOfThreads};
+        if (!timepoints.empty()) {
+            // Analyse the dynamic modules only once for all timepoints
             auto const probabilities{checker.getProbabilitiesAtTimepoints(timepoints, chunksize)};
             for (size_t i{0}; i < timepoints.size(); ++i) {
                 auto const timebound{timepoints[i]};
@@ -166,7 +162,7 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunct
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize) {
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BDD analysis is not supportet for this data type.");
 }
 
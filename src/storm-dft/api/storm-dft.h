@@ -110,15 +110,13 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> prepareForMarkovAnalysis(st
 
 template<typename ValueType>
 std::pair<uint64_t, uint64_t> computeBEFailureBounds(storm::dft::storage::DFT<ValueType> const& dft, bool useSMT, double solverTimeout) {
-    uint64_t lowerBEBound = storm::dft::utility::FailureBoundFinder::getLeastFailureBound(dft, useSMT, solverTimeout);
-    uint64_t upperBEBound = storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(dft, useSMT, solverTimeout);
-    return std::make_pair(lowerBEBound, upperBEBound);
+    return storm::dft::utility::FailureBoundFinder::getFailureBounds(dft, useSMT, solverTimeout);
 }
 
 template<typename ValueType>
-bool computeDependencyConflicts(storm::dft::storage::DFT<ValueType>& dft, bool useSMT, double solverTimeout) {
+bool computeDependencyConflicts(storm::dft::storage::DFT<ValueType>& dft, bool useSMT, double solverTimeout, size_t numberOfThreads = 1) {
     std::vector<std::pair<uint64_t, uint64_t>> fdepConflicts =
-        storm::dft::utility::FDEPConflictFinder<ValueType>::getDependencyConflicts(dft, useSMT, solverTimeout);
+        storm::dft::utility::FDEPConflictFinder<ValueType>::getDependencyConflicts(dft, useSMT, solverTimeout, numberOfThreads);
 
     for (auto const& pair : fdepConflicts) {
         STORM_LOG_DEBUG("Conflict between " << dft.getElement(pair.first)->name() << " and " << dft.getElement(pair.second)->name());
@@ -231,13 +229,16 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
  * @param chunksize
  * The size of the chunks of doubles to work on at a time
  *
+ * @param numberOfThreads
+ * The number of threads used to analyse the dynamic modules when using modularisation
+ *
  */
 template<typename ValueType>
 void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& dft, bool const exportToDot, std::string const& filename,
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, size_t const numberOfThreads = 1);
 
 /*!
  * Analyze the DFT using the SMT encoding
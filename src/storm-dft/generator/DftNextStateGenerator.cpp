@@ -204,12 +204,24 @@ std::pair<StateType, bool> DftNextStateGenerator<ValueType, StateType>::getNewSt
     }
 }
 
+template<typename ValueType, typename StateType>
+typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::copyState(
+    DFTStatePointer const& origState) const {
+    if (!scratchState || scratchState.use_count() > 1 || scratchState == origState) {
+        // The scratch state is still in use (or not yet allocated)
+        scratchState = origState->copy();
+    } else {
+        scratchState->assign(*origState);
+    }
+    return scratchState;
+}
+
 template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const> dependency,
     bool dependencySuccessful) const {
     // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
+    DFTStatePointer newState = copyState(origState);
 
     if (dependencySuccessful) {
         // Dependency was successful -> dependent BE fails
@@ -234,7 +246,7 @@ template<typename ValueType, typename StateType>
 typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextStateGenerator<ValueType, StateType>::createSuccessorState(
     DFTStatePointer const origState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const> be) const {
     // Construct new state as copy from original one
-    DFTStatePointer newState = origState->copy();
+    DFTStatePointer newState = copyState(origState);
 
     STORM_LOG_TRACE("With the failure of " << be->name() << " [" << be->id() << "]" << " in " << mDft.getStateString(origState));
     newState->letBEFail(be);
@@ -120,6 +120,16 @@ class DftNextStateGenerator {
      */
     std::pair<StateType, bool> getNewStateId(DFTStatePointer state, StateToIdCallback const& stateToIdCallback) const;
 
+    /*!
+     * Copy the given state as starting point for a successor state.
+     * The copy is written into a scratch state which is reused as long as no one else keeps a pointer to it.
+     * Thus, a new state is only allocated if the previous successor was stored (e.g., because it is a new state).
+     *
+     * @param origState State to copy.
+     * @return Copy of the state.
+     */
+    DFTStatePointer copyState(DFTStatePointer const& origState) const;
+
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
 
@@ -129,6 +139,9 @@ class DftNextStateGenerator {
     // Current state
     DFTStatePointer state;
 
+    // Reusable memory for successor states
+    mutable DFTStatePointer scratchState;
+
     // Flag indicating whether all failed states should be merged into one unique failed state.
     bool uniqueFailedState;
 
@@ -0,0 +1,111 @@
+#include "storm-dft/modelchecker/DFTInstantiationChecker.h"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/utility/macros.h"
+
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/modelchecker/DFTModelChecker.h"
+#include "storm-dft/utility/SymmetryFinder.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+DFTInstantiationChecker::DFTInstantiationChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, property_vector const& properties,
+                                                 bool symred, storm::dft::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant)
+    : properties(properties) {
+    dft.setRelevantEvents(relevantEvents, allowDCForRelevant);
+
+    // Find symmetries
+    storm::dft::storage::DftSymmetries symmetries;
+    if (symred) {
+        symmetries = storm::dft::utility::SymmetryFinder<storm::RationalFunction>::findSymmetries(dft);
+        STORM_LOG_DEBUG("Found " << symmetries.nrSymmetries() << " symmetries.");
+    }
+
+    storm::dft::builder::ExplicitDFTModelBuilder<storm::RationalFunction> builder(dft, symmetries);
+    builder.buildModel(0, 0.0);
+    parametricModel = builder.getModel();
+    STORM_LOG_DEBUG("Built parametric model with " << parametricModel->getNumberOfStates() << " states and " << parametricModel->getNumberOfTransitions()
+                                                   << " transitions.");
+}
+
+std::vector<std::vector<double>> DFTInstantiationChecker::check(std::vector<Valuation> const& valuations, size_t numberOfThreads) const {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "At least one thread is required.");
+    if (parametricModel->isOfType(storm::models::ModelType::Ctmc)) {
+        return checkInstantiations<storm::models::sparse::Ctmc<storm::RationalFunction>, storm::models::sparse::Ctmc<double>>(valuations, numberOfThreads);
+    }
+    STORM_LOG_THROW(parametricModel->isOfType(storm::models::ModelType::MarkovAutomaton), storm::exceptions::NotSupportedException,
+                    "Parametric model of type " << parametricModel->getType() << " is not supported.");
+    return checkInstantiations<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>, storm::models::sparse::MarkovAutomaton<double>>(
+        valuations, numberOfThreads);
+}
+
+std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> DFTInstantiationChecker::getParametricModel() const {
+    return parametricModel;
+}
+
+template<typename ParametricModelType, typename ConstantModelType>
+std::vector<std::vector<double>> DFTInstantiationChecker::checkInstantiations(std::vector<Valuation> const& valuations, size_t numberOfThreads) const {
+    storm::utility::ModelInstantiator<ParametricModelType, ConstantModelType> instantiator(*parametricModel->template as<ParametricModelType>());
+    std::vector<std::vector<double>> results(valuations.size());
+
+    // The valuations are handled in chunks. The models of a chunk are instantiated one after another (the rational functions are not thread-safe)
+    // and then checked concurrently.
+    uint64_t const chunkSize = 4 * numberOfThreads;
+    for (uint64_t chunkStart = 0; chunkStart < valuations.size(); chunkStart += chunkSize) {
+        std::vector<Valuation> chunk(valuations.begin() + chunkStart, valuations.begin() + std::min<uint64_t>(chunkStart + chunkSize, valuations.size()));
+        std::vector<std::shared_ptr<storm::models::sparse::Model<double>>> models;
+        models.reserve(chunk.size());
+        instantiator.instantiateBatch(chunk, [&models](uint64_t, ConstantModelType const& model) {
+            // The instantiator reuses its model, thus each instantiation is copied
+            models.push_back(std::make_shared<ConstantModelType>(model));
+        });
+
+        std::mutex mutex;
+        uint64_t nextModel = 0;
+        std::exception_ptr exception;
+        auto work = [&]() {
+            try {
+                while (true) {
+                    uint64_t index;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (exception || nextModel >= models.size()) {
+                            break;
+                        }
+                        index = nextModel++;
+                    }
+                    results[chunkStart + index] = DFTModelChecker<double>::verifyModel(models[index], properties);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                exception = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint64_t i = 1; i < std::min<uint64_t>(numberOfThreads, models.size()); ++i) {
+            threads.emplace_back(work);
+        }
+        work();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    return results;
+}
+
+}  // namespace modelchecker
+}  // namespace storm::dft
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/utility/RelevantEvents.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+/*!
+ * Analyser for many instantiations of a parametric DFT.
+ * The state space of a DFT does not depend on the failure rates. Thus, the parametric model is built only once and for each valuation only its
+ * rates are instantiated (see storm::utility::ModelInstantiator) before the instantiated model is checked.
+ */
+class DFTInstantiationChecker {
+   public:
+    typedef std::vector<std::shared_ptr<storm::logic::Formula const>> property_vector;
+    typedef storm::utility::parametric::Valuation<storm::RationalFunction> Valuation;
+
+    /*!
+     * Constructor. Builds the parametric model of the DFT.
+     *
+     * @param dft Parametric DFT.
+     * @param properties Properties to check for.
+     * @param symred Flag whether symmetry reduction should be used.
+     * @param relevantEvents Relevant events which should be observed.
+     * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events.
+     */
+    DFTInstantiationChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, property_vector const& properties, bool symred = true,
+                            storm::dft::utility::RelevantEvents const& relevantEvents = {}, bool allowDCForRelevant = false);
+
+    /*!
+     * Check the properties for all given valuations of the parameters.
+     * The instantiation is done sequentially (evaluating the rate functions for several valuations at once), whereas the instantiated models are
+     * checked concurrently.
+     *
+     * @param valuations Valuations of the parameters occurring in the DFT.
+     * @param numberOfThreads Number of threads which check instantiated models concurrently.
+     * @return For each valuation, the results for the properties.
+     */
+    std::vector<std::vector<double>> check(std::vector<Valuation> const& valuations, size_t numberOfThreads = 1) const;
+
+    /*!
+     * Get the parametric model of the DFT.
+     *
+     * @return Parametric CTMC or MA.
+     */
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> getParametricModel() const;
+
+   private:
+    /*!
+     * Check all valuations for a parametric model of the given type.
+     */
+    template<typename ParametricModelType, typename ConstantModelType>
+    std::vector<std::vector<double>> checkInstantiations(std::vector<Valuation> const& valuations, size_t numberOfThreads) const;
+
+    property_vector properties;
+
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+};
+
+}  // namespace modelchecker
+}  // namespace storm::dft
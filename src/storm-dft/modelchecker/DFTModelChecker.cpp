@@ -1,5 +1,9 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 
+#include <exception>
+#include <thread>
+#include <type_traits>
+
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/exceptions/InvalidModelException.h"
 #include "storm/io/DirectEncodingExporter.h"
@@ -192,8 +196,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueTyp
     // Perform modularisation via parallel composition
     if (dfts.size() > 1) {
         STORM_LOG_TRACE("Recursive CHECK Call");
-        bool firstTime = true;
-        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composedModel;
+        std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> ctmcs;
         for (auto const& ft : dfts) {
             STORM_LOG_DEBUG("Building Model via parallel composition...");
             explorationTimer.start();
@@ -225,27 +228,21 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueTyp
                        ->template as<storm::models::sparse::Ctmc<ValueType>>();
             bisimulationTimer.stop();
 
-            if (firstTime) {
-                composedModel = ctmc;
-                firstTime = false;
-            } else {
-                composedModel = storm::builder::ParallelCompositionBuilder<ValueType>::compose(composedModel, ctmc, isAnd);
-            }
+            ctmcs.push_back(ctmc);
+        }
 
-            // Apply bisimulation to parallel composition
-            bisimulationTimer.start();
-            composedModel = storm::api::performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(
-                                composedModel, properties, storm::storage::BisimulationType::Weak)
-                                ->template as<storm::models::sparse::Ctmc<ValueType>>();
-            bisimulationTimer.stop();
+        // Compose the CTMCs and minimize each intermediate product
+        bisimulationTimer.start();
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composedModel =
+            storm::builder::ParallelCompositionBuilder<ValueType>::composeMinimized(ctmcs, isAnd, properties, storm::storage::BisimulationType::Weak);
+        bisimulationTimer.stop();
 
-            STORM_LOG_DEBUG("No. states (Composed): " << composedModel->getNumberOfStates());
-            STORM_LOG_DEBUG("No. transitions (Composed): " << composedModel->getNumberOfTransitions());
-            if (composedModel->getNumberOfStates() <= 15) {
-                STORM_LOG_TRACE("Transition matrix: \n" << composedModel->getTransitionMatrix());
-            } else {
-                STORM_LOG_TRACE("Transition matrix: too big to print");
-            }
+        STORM_LOG_DEBUG("No. states (Composed): " << composedModel->getNumberOfStates());
+        STORM_LOG_DEBUG("No. transitions (Composed): " << composedModel->getNumberOfTransitions());
+        if (composedModel->getNumberOfStates() <= 15) {
+            STORM_LOG_TRACE("Transition matrix: \n" << composedModel->getTransitionMatrix());
+        } else {
+            STORM_LOG_TRACE("Transition matrix: too big to print");
         }
         if (printInfo) {
             composedModel->printModelInformationToStream(std::cout);
@@ -313,6 +310,7 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
         if (properties.size() > 1) {
             STORM_LOG_WARN("Computing approximation only for first property: " << *property);
         }
+        property_vector const singleProperty = {property};
 
         bool probabilityFormula = property->isProbabilityOperatorFormula();
         STORM_LOG_ASSERT((property->isTimeOperatorFormula() && !probabilityFormula) || (!property->isTimeOperatorFormula() && probabilityFormula),
@@ -333,39 +331,69 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
 
             // Build model for lower bound
             STORM_LOG_DEBUG("Getting model for lower bound...");
-            model = builder.getModelApproximation(true, !probabilityFormula);
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> lowerModel = builder.getModelApproximation(true, !probabilityFormula);
             // We only output the info from the lower bound as the info for the upper bound is the same
             if (printInfo && dftIOSettings.isShowDftStatisticsSet()) {
                 std::cout << "Model in iteration " << (iteration + 1) << ":\n";
-                model->printModelInformationToStream(std::cout);
+                lowerModel->printModelInformationToStream(std::cout);
             }
-            buildingTimer.stop();
 
             if (ioSettings.isExportExplicitSet()) {
                 std::vector<std::string> parameterNames;
                 // TODO fill parameter names
-                storm::api::exportSparseModelAsDrn(model, ioSettings.getExportExplicitFilename(), parameterNames,
+                storm::api::exportSparseModelAsDrn(lowerModel, ioSettings.getExportExplicitFilename(), parameterNames,
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
             }
 
-            // Check lower bounds
-            newResult = checkModel(model, {property});
-            STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first),
-                             "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
-            approxResult.first = newResult[0];
-
             // Build model for upper bound
             STORM_LOG_DEBUG("Getting model for upper bound...");
-            buildingTimer.start();
             model = builder.getModelApproximation(false, !probabilityFormula);
             buildingTimer.stop();
-            // Check upper bound
-            newResult = checkModel(model, {property});
+
+            // Check lower and upper bound concurrently
+            modelCheckingTimer.start();
+            std::vector<ValueType> upperResult;
+            std::exception_ptr upperException;
+            auto checkUpperBound = [&]() {
+                try {
+                    minimizeModel(model, singleProperty);
+                    upperResult = verifyModel(model, singleProperty);
+                } catch (...) {
+                    upperException = std::current_exception();
+                }
+            };
+            std::thread upperThread;
+            if (std::is_same<ValueType, double>::value) {
+                upperThread = std::thread(checkUpperBound);
+            } else {
+                // Operations on rational functions are not thread-safe
+                checkUpperBound();
+            }
+            try {
+                minimizeModel(lowerModel, singleProperty);
+                newResult = verifyModel(lowerModel, singleProperty);
+            } catch (...) {
+                if (upperThread.joinable()) {
+                    upperThread.join();
+                }
+                throw;
+            }
+            if (upperThread.joinable()) {
+                upperThread.join();
+            }
+            if (upperException) {
+                std::rethrow_exception(upperException);
+            }
+            modelCheckingTimer.stop();
+
             STORM_LOG_ASSERT(newResult.size() == 1, "Wrong size for result vector.");
-            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, newResult[0]),
-                             "New over-approximation " << newResult[0] << " is greater than old result " << approxResult.second);
-            approxResult.second = newResult[0];
+            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(newResult[0], approxResult.first),
+                             "New under-approximation " << newResult[0] << " is smaller than old result " << approxResult.first);
+            approxResult.first = newResult[0];
+            STORM_LOG_ASSERT(upperResult.size() == 1, "Wrong size for result vector.");
+            STORM_LOG_ASSERT(iteration == 0 || !comparator.isLess(approxResult.second, upperResult[0]),
+                             "New over-approximation " << upperResult[0] << " is greater than old result " << approxResult.second);
+            approxResult.second = upperResult[0];
 
             STORM_LOG_ASSERT(comparator.isLess(approxResult.first, approxResult.second) || comparator.isEqual(approxResult.first, approxResult.second),
                              "Under-approximation " << approxResult.first << " is greater than over-approximation " << approxResult.second);
@@ -435,28 +463,37 @@ template<typename ValueType>
 std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model,
                                                               property_vector const& properties) {
     // Bisimulation
+    bisimulationTimer.start();
+    minimizeModel(model, properties);
+    bisimulationTimer.stop();
+
+    // Check the model
+    modelCheckingTimer.start();
+    std::vector<ValueType> results = verifyModel(model, properties);
+    modelCheckingTimer.stop();
+    return results;
+}
+
+template<typename ValueType>
+void DFTModelChecker<ValueType>::minimizeModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties) {
     if (model->isOfType(storm::models::ModelType::Ctmc) && storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet()) {
-        bisimulationTimer.start();
         STORM_LOG_DEBUG("Bisimulation...");
         model = storm::api::performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(
                     model->template as<storm::models::sparse::Ctmc<ValueType>>(), properties, storm::storage::BisimulationType::Weak)
                     ->template as<storm::models::sparse::Ctmc<ValueType>>();
         STORM_LOG_DEBUG("No. states (Bisimulation): " << model->getNumberOfStates());
         STORM_LOG_DEBUG("No. transitions (Bisimulation): " << model->getNumberOfTransitions());
-        bisimulationTimer.stop();
     }
+}
 
-    // Check the model
+template<typename ValueType>
+std::vector<ValueType> DFTModelChecker<ValueType>::verifyModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                               property_vector const& properties) {
     STORM_LOG_DEBUG("Model checking...");
-    modelCheckingTimer.start();
     std::vector<ValueType> results;
 
     // Check each property
-    storm::utility::Stopwatch singleModelCheckingTimer;
     for (auto property : properties) {
-        singleModelCheckingTimer.reset();
-        singleModelCheckingTimer.start();
-        // STORM_PRINT_AND_LOG("Model checking property " << *property << " ...\n");
         std::unique_ptr<storm::modelchecker::CheckResult> result(
             storm::api::verifyWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(property, true)));
 
@@ -468,11 +505,7 @@ std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<st
             STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
             results.push_back(-storm::utility::one<ValueType>());
         }
-        // STORM_PRINT_AND_LOG("Result (initial states): " << resultValue << '\n');
-        singleModelCheckingTimer.stop();
-        // STORM_PRINT_AND_LOG("Time for model checking: " << singleModelCheckingTimer << ".\n");
     }
-    modelCheckingTimer.stop();
     STORM_LOG_DEBUG("Model checking done.");
     return results;
 }
@@ -74,6 +74,17 @@ class DFTModelChecker {
      */
     void printResults(dft_results const& results, std::ostream& os = std::cout);
 
+    /*!
+     * Check the given model for the given properties.
+     * Does not measure the time and can therefore be called concurrently.
+     *
+     * @param model      Model to check
+     * @param properties Properties to check for
+     *
+     * @return Model checking result
+     */
+    static std::vector<ValueType> verifyModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, property_vector const& properties);
+
    private:
     bool printInfo;
 
@@ -152,6 +163,15 @@ class DFTModelChecker {
      */
     std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+    /*!
+     * Minimize the given model via bisimulation if the model is a CTMC and bisimulation is enabled.
+     * Does not measure the time and can therefore be called concurrently.
+     *
+     * @param model      Model to minimize. It is replaced by the quotient model.
+     * @param properties Properties which should be preserved
+     */
+    static void minimizeModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
+
     /*!
      * Checks if the computed approximation is sufficient, i.e.
      * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
@@ -1,24 +1,32 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidModelException.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads)
+    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, numberOfThreads{numberOfThreads} {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "At least one thread is required.");
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -26,6 +34,7 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    computeModuleClasses();
 }
 
 template<typename ValueType>
@@ -41,6 +50,47 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::computeModuleClasses() {
+    // Consider the biggest modules first such that their (expensive) analysis starts as early as possible
+    std::vector<size_t> moduleSizes;
+    for (auto const& mod : dynamicModules) {
+        moduleSizes.push_back(mod.getAllElements().size());
+    }
+    std::vector<size_t> order(dynamicModules.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&moduleSizes](size_t left, size_t right) { return moduleSizes[left] > moduleSizes[right]; });
+
+    storm::dft::storage::DFTColouring<ValueType> colouring(*dft);
+    auto isIsomorphic = [this, &colouring](storm::dft::storage::DftIndependentModule const& left, storm::dft::storage::DftIndependentModule const& right) {
+        std::set<size_t> const leftElements = left.getAllElements();
+        std::set<size_t> const rightElements = right.getAllElements();
+        auto leftCandidates = colouring.colourSubdft(std::vector<size_t>(leftElements.begin(), leftElements.end()));
+        auto rightCandidates = colouring.colourSubdft(std::vector<size_t>(rightElements.begin(), rightElements.end()));
+        storm::dft::storage::DFTIsomorphismCheck<ValueType> isoCheck(leftCandidates, rightCandidates, *dft);
+        while (isoCheck.findNextIsomorphism()) {
+            // The isomorphism must map the top elements onto each other
+            if (isoCheck.getIsomorphism().at(left.getRepresentative()) == right.getRepresentative()) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    moduleClasses.clear();
+    for (size_t index : order) {
+        auto classIt = std::find_if(moduleClasses.begin(), moduleClasses.end(), [&](std::vector<size_t> const& moduleClass) {
+            return moduleSizes[moduleClass.front()] == moduleSizes[index] && isIsomorphic(dynamicModules[moduleClass.front()], dynamicModules[index]);
+        });
+        if (classIt != moduleClasses.end()) {
+            classIt->push_back(index);
+        } else {
+            moduleClasses.push_back({index});
+        }
+    }
+    STORM_LOG_DEBUG("Found " << moduleClasses.size() << " classes of isomorphic modules among " << dynamicModules.size() << " dynamic modules.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -66,21 +116,71 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTi
 
 template<typename ValueType>
 std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<ValueType>::replaceDynamicModules(std::vector<ValueType> const& timepoints) {
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
+    // First analyse one dynamic module per class of isomorphic modules.
+    // The classes are distributed over the threads, each thread uses its own model checker.
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> classResults(moduleClasses.size());
+    std::mutex mutex;
+    size_t nextClass = 0;
+    std::exception_ptr exception;
+    auto work = [&](storm::dft::modelchecker::DFTModelChecker<ValueType>& checker) {
+        try {
+            while (true) {
+                size_t currentClass;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception || nextClass >= moduleClasses.size()) {
+                        break;
+                    }
+                    currentClass = nextClass++;
+                }
+                auto const& mod = dynamicModules[moduleClasses[currentClass].front()];
+                STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
+                classResults[currentClass] = analyseDynamicModule(mod, props, checker);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    // The main thread works as well
+    size_t const additionalThreads = moduleClasses.empty() ? 0 : std::min(numberOfThreads, moduleClasses.size()) - 1;
+    threads.reserve(additionalThreads);
+    for (size_t i = 0; i < additionalThreads; ++i) {
+        threads.emplace_back([&work]() {
+            storm::dft::modelchecker::DFTModelChecker<ValueType> checker(false);
+            work(checker);
+        });
+    }
+    work(modelchecker);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
-
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
-        // Remember probabilities for module
+    for (size_t currentClass = 0; currentClass < moduleClasses.size(); ++currentClass) {
+        // Remember probabilities for all modules of the class
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
+            auto const probability{boost::get<ValueType>(classResults[currentClass][i])};
             auto const timebound{timepoints[i]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        for (size_t index : moduleClasses[currentClass]) {
+            samplePoints.insert({dynamicModules[index].getRepresentative(), activeSamples});
+        }
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +223,13 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties,
+    storm::dft::modelchecker::DFTModelChecker<ValueType>& checker) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    return checker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
@@ -28,8 +28,9 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Number of threads used to analyse the dynamic modules.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, size_t numberOfThreads = 1);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -65,6 +66,12 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Group the dynamic modules into classes of isomorphic modules which therefore have the same failure probabilities.
+     * Populates moduleClasses.
+     */
+    void computeModuleClasses();
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -75,10 +82,12 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties to check on the module.
+     * @param checker Model checker used for the analysis.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(
+        storm::dft::storage::DftIndependentModule const &module, FormulaVector const &properties,
+        storm::dft::modelchecker::DFTModelChecker<ValueType> &checker) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +98,11 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Classes of isomorphic dynamic modules given by their indices in dynamicModules.
+    // Only the first module of each class is analysed. The classes are sorted by decreasing module size.
+    std::vector<std::vector<size_t>> moduleClasses;
+    // Number of threads used to analyse the dynamic modules
+    size_t numberOfThreads;
 };
 
 }  // namespace modelchecker
@@ -1,11 +1,14 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/eigen.h"
+#include "storm/utility/threads.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -235,6 +238,162 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * A flattened representation of a bdd.
+ * The nodes are ordered such that the children of a node precede the node.
+ * Thus, the root is the last node.
+ * The indices 0 and 1 are reserved for the terminals zero and one.
+ */
+struct FlatBdd {
+    std::vector<uint32_t> variables{0, 0};
+    std::vector<size_t> thenIndices{0, 1};
+    std::vector<size_t> elseIndices{0, 1};
+
+    size_t size() const {
+        return variables.size();
+    }
+};
+
+/**
+ * \returns
+ * The index of the bdd in the flattened bdd.
+ * Adds the bdd and all its (not yet added) descendants in post order.
+ *
+ * \param bddToIndex
+ * A cache for common sub Bdds.
+ */
+size_t flattenBdd(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
+    }
+
+    auto const it{bddToIndex.find(bdd.GetBDD())};
+    if (it != bddToIndex.end()) {
+        return it->second;
+    }
+
+    auto const thenIndex{flattenBdd(bdd.Then(), flatBdd, bddToIndex)};
+    auto const elseIndex{flattenBdd(bdd.Else(), flatBdd, bddToIndex)};
+
+    auto const index{flatBdd.size()};
+    flatBdd.variables.push_back(bdd.TopVar());
+    flatBdd.thenIndices.push_back(thenIndex);
+    flatBdd.elseIndices.push_back(elseIndex);
+    bddToIndex[bdd.GetBDD()] = index;
+    return index;
+}
+
+/**
+ * Calculates the probability of the flattened bdd
+ * and the birnbaum factors of all variables at once.
+ *
+ * A bottom-up pass computes the probabilities of all nodes.
+ * A top-down pass computes the probability to reach each node from the root.
+ * The birnbaum factor of a variable is the partial derivative of the probability
+ * w.r.t. the probability of the variable, which is the sum over all nodes of the variable of
+ * P(reach node) * (P(then) - P(else)).
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ *
+ * \param indexToBirnbaumFactors
+ * A mapping that must contain (zero) arrays of width chunksize for every variable in the bdd.
+ * The birnbaum factors are added to them.
+ *
+ * \returns
+ * The probabilities of the bdd.
+ */
+Eigen::ArrayXd flatBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                                   std::map<uint32_t, Eigen::ArrayXd> &indexToBirnbaumFactors) {
+    std::vector<Eigen::ArrayXd const *> nodeToVariableProbabilities(flatBdd.size(), nullptr);
+    std::vector<Eigen::ArrayXd> probabilities(flatBdd.size());
+    probabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+    probabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{2}; node < flatBdd.size(); ++node) {
+        auto const &currentProbabilities{indexToProbabilities.at(flatBdd.variables[node])};
+        nodeToVariableProbabilities[node] = &currentProbabilities;
+
+        // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+        probabilities[node] =
+            currentProbabilities * probabilities[flatBdd.thenIndices[node]] + (1 - currentProbabilities) * probabilities[flatBdd.elseIndices[node]];
+    }
+
+    auto const root{flatBdd.size() - 1};
+    if (root < 2) {
+        // The bdd is a terminal, no variable has an influence.
+        return probabilities[root];
+    }
+
+    // Parents precede their children in reverse order
+    // so the reach probability of a node is complete when it is visited.
+    std::vector<Eigen::ArrayXd> reachProbabilities(flatBdd.size(), Eigen::ArrayXd::Constant(chunksize, 0));
+    reachProbabilities[root] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{root}; node >= 2; --node) {
+        auto const &reachProbability{reachProbabilities[node]};
+        auto const &currentProbabilities{*nodeToVariableProbabilities[node]};
+        auto const thenIndex{flatBdd.thenIndices[node]};
+        auto const elseIndex{flatBdd.elseIndices[node]};
+
+        indexToBirnbaumFactors.at(flatBdd.variables[node]) += reachProbability * (probabilities[thenIndex] - probabilities[elseIndex]);
+        reachProbabilities[thenIndex] += currentProbabilities * reachProbability;
+        reachProbabilities[elseIndex] += (1 - currentProbabilities) * reachProbability;
+    }
+
+    return probabilities[root];
+}
+
+/**
+ * \returns
+ * The probabilities of the given basic elements at the given timepoints
+ * indexed by their variable index.
+ */
+std::map<uint32_t, Eigen::ArrayXd> getBasicElementProbabilities(
+    std::vector<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType>>> const &basicElements,
+    storm::dft::storage::SylvanBddManager const &sylvanBddManager, Eigen::ArrayXd const &timepointsArray) {
+    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    for (auto const &be : basicElements) {
+        auto const beIndex{sylvanBddManager.getIndex(be->name())};
+        // Vectorize known BETypes
+        // fallback to getUnreliability() otherwise
+        if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
+            auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType>>(be)->activeFailureRate()};
+
+            // exponential distribution
+            // p(T <= t) = 1 - exp(-lambda*t)
+            indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+        } else if (be->beType() == storm::dft::storage::elements::BEType::ERLANG) {
+            auto const erlang{std::static_pointer_cast<storm::dft::storage::elements::BEErlang<ValueType>>(be)};
+
+            // erlang distribution
+            // p(T <= t) = 1 - \sum_{n=0}^{k-1} 1/n! * exp(-lambda*t) * (lambda*t)^n
+            Eigen::ArrayXd const scaledTimepoints{erlang->activeFailureRate() * timepointsArray};
+            Eigen::ArrayXd summand{(-scaledTimepoints).exp()};
+            Eigen::ArrayXd probabilities{1 - summand};
+            for (unsigned n{1}; n < erlang->phases(); ++n) {
+                summand *= scaledTimepoints / n;
+                probabilities -= summand;
+            }
+            indexToProbabilities[beIndex] = probabilities;
+        } else if (be->beType() == storm::dft::storage::elements::BEType::WEIBULL) {
+            auto const weibull{std::static_pointer_cast<storm::dft::storage::elements::BEWeibull<ValueType>>(be)};
+
+            // weibull distribution
+            // p(T <= t) = 1 - exp(-(t/lambda)^k)
+            indexToProbabilities[beIndex] = 1 - (-(timepointsArray / weibull->rate()).pow(weibull->shape())).exp();
+        } else {
+            auto probabilities{timepointsArray};
+            for (Eigen::Index i{0}; i < timepointsArray.size(); ++i) {
+                probabilities(i) = be->getUnreliability(timepointsArray(i));
+            }
+            indexToProbabilities[beIndex] = probabilities;
+        }
+    }
+    return indexToProbabilities;
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -311,24 +470,7 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
         }
 
         // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
-            // Vectorize known BETypes
-            // fallback to getUnreliability() otherwise
-            if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
-                auto const failureRate{std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType>>(be)->activeFailureRate()};
-
-                // exponential distribution
-                // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
-            } else {
-                auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
-                    probabilities(i) = be->getUnreliability(timepointsArray(i));
-                }
-                indexToProbabilities[beIndex] = probabilities;
-            }
-        }
+        indexToProbabilities = getBasicElementProbabilities(basicElements, *getSylvanBddManager(), timepointsArray);
 
         func(chunksize, timepointsArray, indexToProbabilities);
     }
@@ -391,26 +533,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const resultsPerBasicElement{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(resultsPerBasicElement.size());
+    for (auto const &results : resultsPerBasicElement) {
+        resultVector.push_back(results.front());
     }
     return resultVector;
 }
@@ -454,48 +582,75 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
     auto const basicElements{getDFT()->getBasicElements()};
 
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
+    // The bdd is flattened once, such that the chunks can be processed without touching the (not thread-safe) caches of sylvan.
+    FlatBdd flatBdd{};
+    {
+        std::unordered_map<uint64_t, size_t> bddToIndex{};
+        flattenBdd(getTopLevelElementBdd(), flatBdd, bddToIndex);
     }
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    std::vector<uint32_t> basicElementIndices{};
+    basicElementIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    std::vector<std::vector<ValueType>> resultVector(basicElements.size(), std::vector<ValueType>(timepoints.size()));
+    if (timepoints.empty()) {
+        return resultVector;
+    }
 
-        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
+    if (chunksize == 0) {
+        // Split the timepoints evenly among the threads.
+        auto const numberOfChunks{std::max<size_t>(1, storm::utility::getNumberOfThreads())};
+        chunksize = (timepoints.size() + numberOfChunks - 1) / numberOfChunks;
+    }
+    auto const numberOfChunks{(timepoints.size() + chunksize - 1) / chunksize};
 
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+    // Computes the importance measures of all basic elements for the timepoints of the given chunk.
+    // Chunks write to disjoint parts of the result vector.
+    auto const processChunk{[&](size_t const chunk) {
+        auto const firstTimepoint{chunk * chunksize};
+        auto const currentChunksize{std::min(chunksize, timepoints.size() - firstTimepoint)};
 
-            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[firstTimepoint + i];
+        }
+        auto const indexToProbabilities{getBasicElementProbabilities(basicElements, *getSylvanBddManager(), timepointsArray)};
 
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+        std::map<uint32_t, Eigen::ArrayXd> indexToBirnbaumFactors{};
+        for (auto const index : basicElementIndices) {
+            indexToBirnbaumFactors[index] = Eigen::ArrayXd::Constant(currentChunksize, 0);
+        }
+        auto const probabilitiesArray{flatBirnbaumFactors(currentChunksize, flatBdd, indexToProbabilities, indexToBirnbaumFactors)};
+
+        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
+            auto const index{basicElementIndices[basicElementIndex]};
+            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
+            auto const &birnbaumFactorsArray{indexToBirnbaumFactors.at(index)};
+            Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[basicElementIndex][firstTimepoint + i] = importanceMeasureArray(i);
             }
         }
+    }};
+
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numberOfChunks, 1), [&processChunk](tbb::blocked_range<size_t> const &range) {
+        for (size_t chunk{range.begin()}; chunk < range.end(); ++chunk) {
+            processChunk(chunk);
+        }
     });
+#else
+    for (size_t chunk{0}; chunk < numberOfChunks; ++chunk) {
+        processChunk(chunk);
+    }
+#endif
 
     return resultVector;
 }
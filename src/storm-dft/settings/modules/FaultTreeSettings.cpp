@@ -18,6 +18,7 @@ const std::string FaultTreeSettings::moduleName = "dft";
 const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
 const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
 const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
 const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
 const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
 const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -30,6 +31,7 @@ const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
 const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
 #ifdef STORM_HAVE_Z3
 const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
+const std::string FaultTreeSettings::smtThreadsOptionName = "smt-threads";
 #endif
 const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
@@ -42,6 +44,14 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false,
+                                                   "Number of threads used to analyse independent dynamic modules during modularisation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
@@ -75,6 +85,14 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false, "Use a unique constantly failed BE.").build());
 #ifdef STORM_HAVE_Z3
     this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, smtThreadsOptionName, false,
+                                                   "Number of threads used to check for conflicts between dependencies with SMT.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 #endif
     this->addOption(storm::settings::OptionBuilder(moduleName, chunksizeOptionName, false, "Calculate probabilies in chunks.")
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
@@ -116,6 +134,10 @@ bool FaultTreeSettings::useModularisation() const {
     return this->getOption(modularisationOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getModularisationThreads() const {
+    return this->getOption(modularisationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool FaultTreeSettings::isDisableDC() const {
     return this->getOption(disableDCOptionName).getHasOptionBeenSet();
 }
@@ -179,6 +201,10 @@ bool FaultTreeSettings::solveWithSMT() const {
     return this->getOption(solveWithSmtOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getSmtThreads() const {
+    return this->getOption(smtThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 #endif
 
 bool FaultTreeSettings::isChunksizeSet() const {
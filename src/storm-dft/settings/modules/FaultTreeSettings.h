@@ -32,6 +32,13 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool useModularisation() const;
 
+    /*!
+     * Retrieves the number of threads used to analyse the dynamic modules during modularisation.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getModularisationThreads() const;
+
     /*!
      * Retrieves whether the option to disable Dont Care propagation is set.
      *
@@ -125,6 +132,13 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool solveWithSMT() const;
 
+    /*!
+     * Retrieves the number of threads (each with its own SMT solver) used to check for conflicts between dependencies.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getSmtThreads() const;
+
 #endif
 
     /*!
@@ -179,6 +193,7 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string noSymmetryReductionOptionName;
     static const std::string noSymmetryReductionOptionShortName;
     static const std::string modularisationOptionName;
+    static const std::string modularisationThreadsOptionName;
     static const std::string disableDCOptionName;
     static const std::string allowDCRelevantOptionName;
     static const std::string relevantEventsOptionName;
@@ -191,6 +206,7 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string uniqueFailedBEOptionName;
 #ifdef STORM_HAVE_Z3
     static const std::string solveWithSmtOptionName;
+    static const std::string smtThreadsOptionName;
 #endif
     static const std::string chunksizeOptionName;
     static const std::string mttfPrecisionName;
@@ -0,0 +1,193 @@
+#include "DFTSimulationEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTSimulationEngine<ValueType>::DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft,
+                                                    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, SimulationOptions const& options)
+    : dft(dft), stateGenerationInfo(stateGenerationInfo), options(options) {
+    STORM_LOG_THROW(options.numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "At least one thread is required for simulation.");
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::IllegalArgumentException, "Batches must contain at least one trace.");
+    STORM_LOG_THROW(options.minBatches > 0 && options.minBatches <= options.maxBatches, storm::exceptions::IllegalArgumentException,
+                    "Invalid bounds on the number of batches.");
+    STORM_LOG_THROW(options.confidenceLevel > 0 && options.confidenceLevel < 1, storm::exceptions::IllegalArgumentException,
+                    "Confidence level must be in (0,1).");
+}
+
+template<typename ValueType>
+SimulationResult DFTSimulationEngine<ValueType>::estimateUnreliability(double timebound) const {
+    return simulateBatches([this, timebound](DFTTraceSimulator<ValueType>& simulator, uint64_t& numberOfTraces) {
+        uint64_t successful = 0;
+        for (uint64_t i = 0; i < options.batchSize; ++i) {
+            if (simulator.simulateCompleteTrace(timebound) == SimulationTraceResult::SUCCESSFUL) {
+                ++successful;
+            }
+        }
+        numberOfTraces += options.batchSize;
+        return static_cast<double>(successful) / options.batchSize;
+    });
+}
+
+template<typename ValueType>
+SimulationResult DFTSimulationEngine<ValueType>::estimateUnreliabilityWithSplitting(double timebound, ImportanceFunction<ValueType> const& importanceFunction,
+                                                                                    std::vector<double> const& thresholds) const {
+    STORM_LOG_THROW(std::adjacent_find(thresholds.begin(), thresholds.end(), std::greater_equal<double>()) == thresholds.end(),
+                    storm::exceptions::IllegalArgumentException, "Thresholds for importance splitting must be strictly increasing.");
+
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+    return simulateBatches([this, timebound, &importanceFunction, &thresholds](DFTTraceSimulator<ValueType>& simulator, uint64_t& numberOfTraces) {
+        // States (together with the elapsed time) in which the current level was entered
+        std::vector<std::pair<DFTStatePointer, double>> entrances;
+        simulator.resetToInitial();
+        entrances.emplace_back(simulator.getCurrentState(), 0.0);
+
+        double estimate = 1;
+        for (uint64_t level = 0; level <= thresholds.size(); ++level) {
+            // A failed DFT has reached all levels
+            auto reachedNextLevel = [&](DFTStatePointer const& state) {
+                return state->hasFailed(dft.getTopLevelIndex()) || (level < thresholds.size() && importanceFunction.getImportance(state) >= thresholds[level]);
+            };
+
+            std::vector<std::pair<DFTStatePointer, double>> nextEntrances;
+            for (uint64_t trial = 0; trial < options.batchSize; ++trial) {
+                auto const& entrance = entrances[trial % entrances.size()];
+                simulator.resetToState(entrance.first);
+                simulator.setTime(entrance.second);
+                bool success = reachedNextLevel(entrance.first);
+                SimulationTraceResult result = SimulationTraceResult::CONTINUE;
+                while (!success && result == SimulationTraceResult::CONTINUE) {
+                    result = simulator.simulateNextStep(timebound);
+                    success = result == SimulationTraceResult::SUCCESSFUL ||
+                              (result == SimulationTraceResult::CONTINUE && reachedNextLevel(simulator.getCurrentState()));
+                }
+                if (success) {
+                    nextEntrances.emplace_back(simulator.getCurrentState(), simulator.getCurrentTime());
+                }
+            }
+            numberOfTraces += options.batchSize;
+
+            estimate *= static_cast<double>(nextEntrances.size()) / options.batchSize;
+            if (nextEntrances.empty()) {
+                // No trial reached the next level
+                return 0.0;
+            }
+            entrances = std::move(nextEntrances);
+        }
+        return estimate;
+    });
+}
+
+template<typename ValueType>
+SimulationResult DFTSimulationEngine<ValueType>::simulateBatches(std::function<double(DFTTraceSimulator<ValueType>&, uint64_t&)> const& simulateBatch) const {
+    double quantile = boost::math::quantile(boost::math::normal(), 1 - (1 - options.confidenceLevel) / 2);
+
+    // The state shared between the threads, guarded by the mutex.
+    std::mutex mutex;
+    std::vector<double> batchEstimates(options.maxBatches, std::numeric_limits<double>::quiet_NaN());
+    uint64_t nextBatch = 0;
+    uint64_t finishedBatches = 0;
+    uint64_t numberOfTraces = 0;
+    double sum = 0;
+    double sumOfSquares = 0;
+    bool done = false;
+    std::exception_ptr exception;
+
+    auto halfWidth = [&quantile](double estimateSum, double estimateSumOfSquares, uint64_t numberOfBatches) {
+        if (numberOfBatches < 2) {
+            return std::numeric_limits<double>::infinity();
+        }
+        double mean = estimateSum / numberOfBatches;
+        double variance = std::max(0.0, (estimateSumOfSquares - numberOfBatches * mean * mean) / (numberOfBatches - 1));
+        return quantile * std::sqrt(variance / numberOfBatches);
+    };
+
+    auto work = [&]() {
+        try {
+            // Each thread uses its own simulator, whose random number generator is reseeded for every batch
+            boost::mt19937 randomGenerator;
+            DFTTraceSimulator<ValueType> simulator(dft, stateGenerationInfo, randomGenerator);
+            while (true) {
+                uint64_t batch;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (done || nextBatch >= options.maxBatches) {
+                        break;
+                    }
+                    batch = nextBatch++;
+                }
+
+                std::seed_seq seedSequence{static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32), static_cast<uint32_t>(batch),
+                                           static_cast<uint32_t>(batch >> 32)};
+                randomGenerator.seed(seedSequence);
+                uint64_t tracesOfBatch = 0;
+                double estimate = simulateBatch(simulator, tracesOfBatch);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                batchEstimates[batch] = estimate;
+                numberOfTraces += tracesOfBatch;
+                ++finishedBatches;
+                sum += estimate;
+                sumOfSquares += estimate * estimate;
+                if (options.relativeError > 0 && finishedBatches >= options.minBatches && sum > 0 &&
+                    halfWidth(sum, sumOfSquares, finishedBatches) <= options.relativeError * sum / finishedBatches) {
+                    STORM_LOG_INFO("Stopping simulation after " << finishedBatches << " batches as the required precision is reached.");
+                    done = true;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+            done = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(options.numberOfThreads - 1);
+    for (uint64_t i = 1; i < options.numberOfThreads; ++i) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    // Sum up in the order of the batches to obtain results that do not depend on the scheduling of the threads
+    sum = 0;
+    sumOfSquares = 0;
+    for (double estimate : batchEstimates) {
+        if (!std::isnan(estimate)) {
+            sum += estimate;
+            sumOfSquares += estimate * estimate;
+        }
+    }
+    SimulationResult result;
+    result.numberOfBatches = finishedBatches;
+    result.numberOfTraces = numberOfTraces;
+    result.estimate = sum / finishedBatches;
+    double width = halfWidth(sum, sumOfSquares, finishedBatches);
+    result.lowerBound = std::max(0.0, result.estimate - width);
+    result.upperBound = std::min(1.0, result.estimate + width);
+    return result;
+}
+
+template class DFTSimulationEngine<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
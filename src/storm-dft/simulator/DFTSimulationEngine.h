@@ -0,0 +1,108 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Options for the simulation engine.
+ */
+struct SimulationOptions {
+    // Number of threads which simulate batches concurrently.
+    uint64_t numberOfThreads = 1;
+    // Seed from which the random number streams of the batches are derived.
+    uint64_t seed = 5;
+    // Number of traces per batch. For importance splitting, this is the number of trials per level in each batch.
+    uint64_t batchSize = 1000;
+    // Minimal number of batches before the stopping rule is applied.
+    uint64_t minBatches = 10;
+    // Maximal number of batches.
+    uint64_t maxBatches = 1000;
+    // Confidence level of the computed confidence interval.
+    double confidenceLevel = 0.95;
+    // The simulation stops once the half-width of the confidence interval is at most this fraction of the estimate. Zero disables the stopping rule.
+    double relativeError = 0;
+};
+
+/*!
+ * Result of a simulation run.
+ */
+struct SimulationResult {
+    // Estimated probability.
+    double estimate;
+    // Bounds of the confidence interval.
+    double lowerBound;
+    double upperBound;
+    // Number of simulated batches.
+    uint64_t numberOfBatches;
+    // Number of simulated (partial) traces.
+    uint64_t numberOfTraces;
+};
+
+/*!
+ * Engine for estimating the unreliability of a DFT by simulation.
+ * The traces are simulated in batches which are distributed over several threads. Each batch uses its own random number stream which only depends on
+ * the seed and the index of the batch. Thus, without the stopping rule, the result does not depend on the number of threads.
+ * The confidence interval is computed from the batch estimates via the normal approximation.
+ */
+template<typename ValueType>
+class DFTSimulationEngine {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT. It is shared by all threads and must not be changed during the simulation.
+     * @param stateGenerationInfo Info for state generation.
+     * @param options Simulation options.
+     */
+    DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                        SimulationOptions const& options = SimulationOptions());
+
+    /*!
+     * Estimate the probability that the DFT fails within the given time bound by standard Monte-Carlo simulation.
+     *
+     * @param timebound Time bound.
+     * @return Simulation result.
+     */
+    SimulationResult estimateUnreliability(double timebound) const;
+
+    /*!
+     * Estimate the probability that the DFT fails within the given time bound by fixed-effort importance splitting.
+     * The thresholds partition the states into levels according to the importance function. In each batch, the given number of trials is started
+     * from the states in which the previous level was entered (in round-robin fashion). A trial succeeds if it reaches the next level within the
+     * time bound. The estimate of the batch is the product of the success rates of all levels, where the last level consists of the failed states.
+     *
+     * @param timebound Time bound.
+     * @param importanceFunction Importance function.
+     * @param thresholds Strictly increasing importance values at which a new level starts.
+     * @return Simulation result.
+     */
+    SimulationResult estimateUnreliabilityWithSplitting(double timebound, ImportanceFunction<ValueType> const& importanceFunction,
+                                                        std::vector<double> const& thresholds) const;
+
+   private:
+    /*!
+     * Simulate batches in parallel until the stopping rule or the maximal number of batches is reached.
+     *
+     * @param simulateBatch Simulates one batch with the given simulator and returns its estimate. It also increases the given trace counter.
+     * @return Simulation result.
+     */
+    SimulationResult simulateBatches(std::function<double(DFTTraceSimulator<ValueType>&, uint64_t&)> const& simulateBatch) const;
+
+    // The DFT used for the simulation.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    SimulationOptions options;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -52,6 +52,16 @@ class SylvanBddManager {
         internalManager.execute(f);
     }
 
+    /*!
+     * Executes the given functions as parallel LACE tasks and waits until all of them are done.
+     * The functions must not access shared data without synchronization.
+     *
+     * @param functions the functions that are executed
+     */
+    void executeInParallel(std::vector<std::function<void()>> const &functions) const {
+        internalManager.executeInParallel(functions);
+    }
+
     /**
      * Creates a variable with a unique name
      *
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DftModule.h"
 #include "storm-dft/storage/SylvanBddManager.h"
+#include "storm-dft/utility/DftModularizer.h"
 #include "storm-dft/utility/RelevantEvents.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/bitoperations.h"
@@ -12,8 +18,23 @@
 namespace storm::dft {
 namespace transformations {
 
+/**
+ * Heuristics for the order of the BDD variables representing the basic elements.
+ */
+enum class SftVariableOrdering {
+    /// The order in which the basic elements are stored in the DFT.
+    Default,
+    /// The order in which a depth first search from the top level element first visits the basic elements.
+    /// Basic elements that are close to each other in the gate DAG thus obtain neighbouring variables.
+    DepthFirst
+};
+
 /**
  * Transformator for DFT -> BDD.
+ *
+ * Independent modules of the DFT are translated in parallel on the Lace workers of Sylvan
+ * (if the transformation is performed within SylvanBddManager::execute) and
+ * composed according to the gate semantics afterwards.
  */
 template<typename ValueType>
 class SftToBddTransformator {
@@ -22,10 +43,10 @@ class SftToBddTransformator {
 
     SftToBddTransformator(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft,
                           std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager = std::make_shared<storm::dft::storage::SylvanBddManager>(),
-                          storm::dft::utility::RelevantEvents relevantEvents = {})
+                          storm::dft::utility::RelevantEvents relevantEvents = {}, SftVariableOrdering variableOrdering = SftVariableOrdering::Default)
         : dft{std::move(dft)}, sylvanBddManager{std::move(sylvanBddManager)}, relevantEvents{relevantEvents} {
         // create Variables for the BEs
-        for (auto const& i : this->dft->getBasicElements()) {
+        for (auto const& i : getOrderedBasicElements(variableOrdering)) {
             // Filter constantBeTrigger
             if (i->name() != "constantBeTrigger") {
                 variables.push_back(this->sylvanBddManager->createVariable(i->name()));
@@ -45,7 +66,7 @@ class SftToBddTransformator {
     Bdd const& transformTopLevel() {
         auto const tlName{dft->getTopLevelElement()->name()};
         if (relevantEventBdds.empty()) {
-            relevantEventBdds[tlName] = translate(dft->getTopLevelElement());
+            translateTopLevel();
         }
         // else relevantEventBdds is not empty and we maintain the invariant
         // that the toplevel event is in there
@@ -66,7 +87,7 @@ class SftToBddTransformator {
      */
     std::map<std::string, Bdd> const& transformRelevantEvents() {
         if (relevantEventBdds.empty()) {
-            relevantEventBdds[dft->getTopLevelElement()->name()] = translate(dft->getTopLevelElement());
+            translateTopLevel();
         }
 
         // we maintain the invariant that if relevantEventBdds is not empty
@@ -104,24 +125,152 @@ class SftToBddTransformator {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     storm::dft::utility::RelevantEvents relevantEvents;
 
+    /**
+     * The BDDs of the relevant events and the top level element of an independent module.
+     */
+    struct ModuleTranslation {
+        Bdd bdd;
+        std::map<std::string, Bdd> relevantEventBdds{};
+    };
+
+    /**
+     * The data used while translating the elements of one independent module.
+     */
+    struct TranslationContext {
+        // The BDDs of the relevant events within the module.
+        std::map<std::string, Bdd>& relevantEventBdds;
+        // The BDDs of the sub-modules indexed by the id of their representative.
+        std::map<size_t, Bdd> const& moduleBdds;
+    };
+
+    /**
+     * \return The basic elements in the order given by the variable ordering heuristic.
+     */
+    std::vector<std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType>>> getOrderedBasicElements(SftVariableOrdering variableOrdering) const {
+        auto basicElements{dft->getBasicElements()};
+        if (variableOrdering == SftVariableOrdering::DepthFirst) {
+            std::vector<size_t> order{};
+            std::set<size_t> visited{};
+            collectBasicElementsDepthFirst(dft->getTopLevelElement(), visited, order);
+
+            // Basic elements that are not reachable from the top level element are appended in their default order.
+            std::map<size_t, size_t> idToPosition{};
+            for (size_t position{0}; position < order.size(); ++position) {
+                idToPosition[order[position]] = position;
+            }
+            std::stable_sort(basicElements.begin(), basicElements.end(), [&idToPosition](auto const& first, auto const& second) {
+                auto const firstIt{idToPosition.find(first->id())};
+                auto const secondIt{idToPosition.find(second->id())};
+                if (secondIt == idToPosition.end()) {
+                    return firstIt != idToPosition.end();
+                }
+                return firstIt != idToPosition.end() && firstIt->second < secondIt->second;
+            });
+        }
+        return basicElements;
+    }
+
+    /**
+     * Appends the ids of the basic elements below the given element in the order of their first visit.
+     */
+    void collectBasicElementsDepthFirst(std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const> element, std::set<size_t>& visited,
+                                        std::vector<size_t>& order) const {
+        if (!visited.insert(element->id()).second) {
+            return;
+        }
+        if (element->isBasicElement()) {
+            order.push_back(element->id());
+        } else if (element->isGate()) {
+            for (auto const& child : std::static_pointer_cast<storm::dft::storage::elements::DFTGate<ValueType> const>(element)->children()) {
+                collectBasicElementsDepthFirst(child, visited, order);
+            }
+        }
+    }
+
+    /**
+     * Translate the toplevel element and all relevant events into BDDs.
+     *
+     * \exception storm::exceptions::NotSupportedException
+     * The given DFT is not a SFT
+     */
+    void translateTopLevel() {
+        auto const topLevelElement{dft->getTopLevelElement()};
+        if (topLevelElement->isGate()) {
+            storm::dft::utility::DftModularizer<ValueType> modularizer{};
+            auto translation{translateModule(modularizer.computeModules(*dft))};
+            relevantEventBdds = std::move(translation.relevantEventBdds);
+            relevantEventBdds[topLevelElement->name()] = translation.bdd;
+        } else {
+            std::map<size_t, Bdd> const moduleBdds{};
+            TranslationContext context{relevantEventBdds, moduleBdds};
+            relevantEventBdds[topLevelElement->name()] = translate(topLevelElement, context);
+        }
+    }
+
+    /**
+     * Translate an independent module into a BDD.
+     * Sub-modules are translated first, as parallel tasks if there are several non-trivial ones.
+     *
+     * \exception storm::exceptions::NotSupportedException
+     * The given DFT is not a SFT
+     */
+    ModuleTranslation translateModule(storm::dft::storage::DftIndependentModule const& module) {
+        std::vector<storm::dft::storage::DftIndependentModule const*> submodules{};
+        for (auto const& submodule : module.getSubModules()) {
+            // Single basic elements are cheaper to translate in place.
+            if (!submodule.isSingleBE()) {
+                submodules.push_back(&submodule);
+            }
+        }
+
+        std::vector<ModuleTranslation> submoduleTranslations(submodules.size());
+        if (submodules.size() > 1) {
+            std::vector<std::function<void()>> tasks{};
+            tasks.reserve(submodules.size());
+            for (size_t i{0}; i < submodules.size(); ++i) {
+                // Each task writes only to its own translation.
+                tasks.push_back([this, &submodules, &submoduleTranslations, i]() { submoduleTranslations[i] = translateModule(*submodules[i]); });
+            }
+            sylvanBddManager->executeInParallel(tasks);
+        } else if (submodules.size() == 1) {
+            submoduleTranslations.front() = translateModule(*submodules.front());
+        }
+
+        // Compose the sub-modules according to the gates of this module.
+        ModuleTranslation translation{};
+        std::map<size_t, Bdd> moduleBdds{};
+        for (size_t i{0}; i < submodules.size(); ++i) {
+            moduleBdds[submodules[i]->getRepresentative()] = submoduleTranslations[i].bdd;
+            translation.relevantEventBdds.merge(submoduleTranslations[i].relevantEventBdds);
+        }
+        TranslationContext context{translation.relevantEventBdds, moduleBdds};
+        translation.bdd = translate(dft->getElement(module.getRepresentative()), context);
+        return translation;
+    }
+
     /**
      * Translate a simple DFT element into a BDD.
      *
      * \exception storm::exceptions::NotSupportedException
      * The given DFT is not a SFT
      */
-    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const> element) {
+    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTElement<ValueType> const> element, TranslationContext& context) {
+        auto const moduleIt{context.moduleBdds.find(element->id())};
+        if (moduleIt != context.moduleBdds.end()) {
+            return moduleIt->second;
+        }
+
         auto isRelevant{relevantEvents.isRelevant(element->name())};
         if (isRelevant) {
-            auto const it{relevantEventBdds.find(element->name())};
-            if (it != relevantEventBdds.end()) {
+            auto const it{context.relevantEventBdds.find(element->name())};
+            if (it != context.relevantEventBdds.end()) {
                 return it->second;
             }
         }
 
         Bdd rBdd;
         if (element->isGate()) {
-            rBdd = translate(std::dynamic_pointer_cast<storm::dft::storage::elements::DFTGate<ValueType> const>(element));
+            rBdd = translate(std::dynamic_pointer_cast<storm::dft::storage::elements::DFTGate<ValueType> const>(element), context);
         } else if (element->isBasicElement()) {
             rBdd = translate(std::dynamic_pointer_cast<storm::dft::storage::elements::DFTBE<ValueType> const>(element));
         } else {
@@ -134,7 +283,7 @@ class SftToBddTransformator {
             // rBdd can't be in relevantEventBdds
             // as we would've returned
             // at the start of the function
-            relevantEventBdds[element->name()] = rBdd;
+            context.relevantEventBdds[element->name()] = rBdd;
         }
 
         return rBdd;
@@ -146,23 +295,23 @@ class SftToBddTransformator {
      * \exception storm::exceptions::NotSupportedException
      * The given DFT is not a SFT
      */
-    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTGate<ValueType> const> gate) {
+    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTGate<ValueType> const> gate, TranslationContext& context) {
         if (gate->type() == storm::dft::storage::elements::DFTElementType::AND) {
             // used only in conjunctions therefore neutral element -> 1
             auto tmpBdd{sylvanBddManager->getOne()};
             for (auto const& child : gate->children()) {
-                tmpBdd &= translate(child);
+                tmpBdd &= translate(child, context);
             }
             return tmpBdd;
         } else if (gate->type() == storm::dft::storage::elements::DFTElementType::OR) {
             // used only in disjunctions therefore neutral element -> 0
             auto tmpBdd{sylvanBddManager->getZero()};
             for (auto const& child : gate->children()) {
-                tmpBdd |= translate(child);
+                tmpBdd |= translate(child, context);
             }
             return tmpBdd;
         } else if (gate->type() == storm::dft::storage::elements::DFTElementType::VOT) {
-            return translate(std::dynamic_pointer_cast<storm::dft::storage::elements::DFTVot<ValueType> const>(gate));
+            return translate(std::dynamic_pointer_cast<storm::dft::storage::elements::DFTVot<ValueType> const>(gate), context);
         }
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Gate of type \"" << gate->typestring() << "\" is not supported. Probably not a SFT.");
         return sylvanBddManager->getZero();
@@ -174,12 +323,12 @@ class SftToBddTransformator {
      * \exception storm::exceptions::NotSupportedException
      * The given DFT is not a SFT
      */
-    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTVot<ValueType> const> vot) {
+    Bdd translate(std::shared_ptr<storm::dft::storage::elements::DFTVot<ValueType> const> vot, TranslationContext& context) {
         std::vector<Bdd> bdds;
         bdds.reserve(vot->children().size());
 
         for (auto const& child : vot->children()) {
-            bdds.push_back(translate(child));
+            bdds.push_back(translate(child, context));
         }
 
         auto const rval{translateVot(0, vot->threshold(), bdds)};
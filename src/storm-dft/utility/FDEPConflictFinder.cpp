@@ -1,23 +1,25 @@
 #include "FDEPConflictFinder.h"
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
 #include "storm-dft/modelchecker/DFTASFChecker.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 
 namespace storm::dft {
 namespace utility {
 
 template<>
 std::vector<std::pair<uint64_t, uint64_t>> FDEPConflictFinder<double>::getDependencyConflicts(storm::dft::storage::DFT<double> const& dft, bool useSMT,
-                                                                                              uint_fast64_t timeout) {
-    std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtChecker = nullptr;
-    if (useSMT) {
-        storm::dft::modelchecker::DFTASFChecker checker(dft);
-        smtChecker = std::make_shared<storm::dft::modelchecker::DFTASFChecker>(checker);
-        smtChecker->toSolver();
-    }
-
+                                                                                              uint_fast64_t timeout, size_t numberOfThreads) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "At least one thread is required.");
     std::vector<bool> dynamicBehavior = getDynamicBehavior(dft);
 
-    std::vector<std::pair<uint64_t, uint64_t>> res;
+    // Pairs of dependencies which might be conflicting
+    std::vector<std::pair<uint64_t, uint64_t>> candidates;
     uint64_t dep1Index;
     uint64_t dep2Index;
     for (size_t i = 0; i < dft.getDependencies().size(); ++i) {
@@ -25,43 +27,95 @@ std::vector<std::pair<uint64_t, uint64_t>> FDEPConflictFinder<double>::getDepend
         for (size_t j = i + 1; j < dft.getDependencies().size(); ++j) {
             dep2Index = dft.getDependencies().at(j);
             if (dynamicBehavior[dep1Index] && dynamicBehavior[dep2Index]) {
-                if (useSMT) {  // if an SMT solver is to be used
-                    if (dft.getDependency(dep1Index)->triggerEvent() == dft.getDependency(dep2Index)->triggerEvent()) {
-                        STORM_LOG_TRACE("Conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name()
-                                                            << ": Same trigger");
-                        res.emplace_back(std::pair<uint64_t, uint64_t>(dep1Index, dep2Index));
-                    } else {
-                        switch (smtChecker->checkDependencyConflict(dep1Index, dep2Index, timeout)) {
-                            case storm::solver::SmtSolver::CheckResult::Sat:
-                                STORM_LOG_TRACE("Conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name());
-                                res.emplace_back(std::pair<uint64_t, uint64_t>(dep1Index, dep2Index));
-                                break;
-                            case storm::solver::SmtSolver::CheckResult::Unknown:
-                                STORM_LOG_TRACE("Unknown: Conflict between " << dft.getElement(dep1Index)->name() << " and "
-                                                                             << dft.getElement(dep2Index)->name());
-                                res.emplace_back(std::pair<uint64_t, uint64_t>(dep1Index, dep2Index));
-                                break;
-                            default:
-                                STORM_LOG_TRACE("No conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name());
-                                break;
-                        }
-                    }
-                } else {
-                    STORM_LOG_TRACE("Conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name());
-                    res.emplace_back(std::pair<uint64_t, uint64_t>(dep1Index, dep2Index));
-                }
+                candidates.emplace_back(dep1Index, dep2Index);
             } else {
                 STORM_LOG_TRACE("Static behavior: No conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name());
                 break;
             }
         }
     }
+
+    // Whether the candidate is conflicting (not using std::vector<bool> as the entries are written concurrently)
+    std::vector<uint8_t> isConflict(candidates.size(), true);
+    // Candidates which need to be checked by the SMT solver
+    std::vector<uint64_t> queries;
+    for (uint64_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        std::tie(dep1Index, dep2Index) = candidates[candidate];
+        if (!useSMT) {
+            STORM_LOG_TRACE("Conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name());
+        } else if (dft.getDependency(dep1Index)->triggerEvent() == dft.getDependency(dep2Index)->triggerEvent()) {
+            STORM_LOG_TRACE("Conflict between " << dft.getElement(dep1Index)->name() << " and " << dft.getElement(dep2Index)->name() << ": Same trigger");
+        } else {
+            queries.push_back(candidate);
+        }
+    }
+
+    // The queries are independent and distributed over several solver instances. The DFT encoding is asserted once per solver instance.
+    std::mutex mutex;
+    uint64_t nextQuery = 0;
+    std::exception_ptr exception;
+    auto work = [&]() {
+        try {
+            storm::dft::modelchecker::DFTASFChecker smtChecker(dft);
+            bool initialized = false;
+            while (true) {
+                uint64_t query;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception || nextQuery >= queries.size()) {
+                        break;
+                    }
+                    query = queries[nextQuery++];
+                }
+                if (!initialized) {
+                    smtChecker.toSolver();
+                    initialized = true;
+                }
+                auto const& [firstDep, secondDep] = candidates[query];
+                switch (smtChecker.checkDependencyConflict(firstDep, secondDep, timeout)) {
+                    case storm::solver::SmtSolver::CheckResult::Sat:
+                        STORM_LOG_TRACE("Conflict between " << dft.getElement(firstDep)->name() << " and " << dft.getElement(secondDep)->name());
+                        break;
+                    case storm::solver::SmtSolver::CheckResult::Unknown:
+                        STORM_LOG_TRACE("Unknown: Conflict between " << dft.getElement(firstDep)->name() << " and " << dft.getElement(secondDep)->name());
+                        break;
+                    default:
+                        STORM_LOG_TRACE("No conflict between " << dft.getElement(firstDep)->name() << " and " << dft.getElement(secondDep)->name());
+                        isConflict[query] = false;
+                        break;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+    if (!queries.empty()) {
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < std::min<size_t>(numberOfThreads, queries.size()); ++i) {
+            threads.emplace_back(work);
+        }
+        work();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    std::vector<std::pair<uint64_t, uint64_t>> res;
+    for (uint64_t candidate = 0; candidate < candidates.size(); ++candidate) {
+        if (isConflict[candidate]) {
+            res.push_back(candidates[candidate]);
+        }
+    }
     return res;
 }
 
 template<>
 std::vector<std::pair<uint64_t, uint64_t>> FDEPConflictFinder<storm::RationalFunction>::getDependencyConflicts(
-    storm::dft::storage::DFT<storm::RationalFunction> const& dft, bool useSMT, uint_fast64_t timeout) {
+    storm::dft::storage::DFT<storm::RationalFunction> const& dft, bool useSMT, uint_fast64_t timeout, size_t) {
     if (useSMT) {
         STORM_LOG_WARN("SMT encoding for rational functions is not supported");
     }
@@ -16,10 +16,11 @@ class FDEPConflictFinder {
      * @param dft The DFT.
      * @param useSMT If set, an SMT solver is used to refine the conflict set.
      * @param timeout Timeout for each SMT query in seconds, defaults to 10 seconds.
+     * @param numberOfThreads Number of threads which check pairs of FDEPs concurrently, each with its own SMT solver instance.
      * @return A vector of pairs of indices. The indices in a pair refer to FDEPs which are conflicting.
      */
     static std::vector<std::pair<uint64_t, uint64_t>> getDependencyConflicts(storm::dft::storage::DFT<ValueType> const& dft, bool useSMT = false,
-                                                                             uint_fast64_t timeout = 10);
+                                                                             uint_fast64_t timeout = 10, size_t numberOfThreads = 1);
 
     /*!
      *
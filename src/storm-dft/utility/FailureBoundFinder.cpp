@@ -3,12 +3,12 @@
 namespace storm::dft {
 namespace utility {
 
-uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::correctLowerBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint64_t bound, uint_fast64_t timeout) {
     STORM_LOG_DEBUG("Lower bound correction - try to correct bound " << std::to_string(bound));
     uint64_t boundCandidate = bound;
     uint64_t nrDepEvents = 0;
     uint64_t nrNonMarkovian = 0;
-    auto dft = smtchecker->getDFT();
+    auto const &dft = smtchecker.getDFT();
 
     // Count dependent events
     for (size_t i = 0; i < dft.nrElements(); ++i) {
@@ -30,9 +30,9 @@ uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::model
                                                                          << " non-Markovian states");
         // The uniqueness transformation for constantly failed BEs guarantees that a DFT never fails
         // in step 0 without intermediate non-Markovians, thus forcibly set nrNonMarkovian
-        smtchecker->setSolverTimeout(timeout * 1000);
-        storm::solver::SmtSolver::CheckResult tmp_res = smtchecker->checkFailsLeqWithEqNonMarkovianState(boundCandidate + nrNonMarkovian, nrNonMarkovian);
-        smtchecker->unsetSolverTimeout();
+        smtchecker.setSolverTimeout(timeout * 1000);
+        storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkFailsLeqWithEqNonMarkovianState(boundCandidate + nrNonMarkovian, nrNonMarkovian);
+        smtchecker.unsetSolverTimeout();
         switch (tmp_res) {
             case storm::solver::SmtSolver::CheckResult::Sat:
                 /* If SAT, there is a sequence where only boundCandidate-many BEs fail directly and rest is nonMarkovian.
@@ -61,13 +61,13 @@ uint64_t FailureBoundFinder::correctLowerBound(std::shared_ptr<storm::dft::model
     return boundCandidate + 1;
 }
 
-uint64_t FailureBoundFinder::correctUpperBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout) {
+uint64_t FailureBoundFinder::correctUpperBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint64_t bound, uint_fast64_t timeout) {
     STORM_LOG_DEBUG("Upper bound correction - try to correct bound " << std::to_string(bound));
     uint64_t boundCandidate = bound;
     uint64_t nrDepEvents = 0;
     uint64_t nrNonMarkovian = 0;
     uint64_t currentTimepoint = 0;
-    auto dft = smtchecker->getDFT();
+    auto const &dft = smtchecker.getDFT();
     // Count dependent events
     for (size_t i = 0; i < dft.nrElements(); ++i) {
         std::shared_ptr<storm::dft::storage::elements::DFTElement<double> const> element = dft.getElement(i);
@@ -85,9 +85,9 @@ uint64_t FailureBoundFinder::correctUpperBound(std::shared_ptr<storm::dft::model
             nrNonMarkovian = currentTimepoint - boundCandidate;
             STORM_LOG_TRACE("Upper bound correction - candidate " << std::to_string(boundCandidate) << " check split " << std::to_string(currentTimepoint)
                                                                   << "|" << std::to_string(nrNonMarkovian));
-            smtchecker->setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker->checkFailsAtTimepointWithEqNonMarkovianState(currentTimepoint, nrNonMarkovian);
-            smtchecker->unsetSolverTimeout();
+            smtchecker.setSolverTimeout(timeout * 1000);
+            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkFailsAtTimepointWithEqNonMarkovianState(currentTimepoint, nrNonMarkovian);
+            smtchecker.unsetSolverTimeout();
             switch (tmp_res) {
                 case storm::solver::SmtSolver::CheckResult::Sat:
                     STORM_LOG_TRACE("Upper bound correction - SAT");
@@ -113,35 +113,70 @@ uint64_t FailureBoundFinder::correctUpperBound(std::shared_ptr<storm::dft::model
     return boundCandidate;
 }
 
+uint64_t FailureBoundFinder::computeLeastFailureBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint_fast64_t timeout) {
+    auto const &dft = smtchecker.getDFT();
+    // The TLE cannot fail with less than 'lower' failures. If upper <= nrBasicElements(), the TLE can fail with at most 'upper' failures.
+    uint64_t lower = 0;
+    uint64_t upper = dft.nrBasicElements() + 1;
+    while (lower < upper) {
+        uint64_t bound = lower + (upper - lower) / 2;
+        smtchecker.setSolverTimeout(timeout * 1000);
+        storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithLeq(bound);
+        smtchecker.unsetSolverTimeout();
+        switch (tmp_res) {
+            case storm::solver::SmtSolver::CheckResult::Sat:
+                upper = bound;
+                break;
+            case storm::solver::SmtSolver::CheckResult::Unknown:
+                STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
+                return lower;
+            default:
+                lower = bound + 1;
+                break;
+        }
+    }
+    if (lower <= dft.nrBasicElements() && !dft.getDependencies().empty()) {
+        return correctLowerBound(smtchecker, lower, timeout);
+    }
+    return lower;
+}
+
+uint64_t FailureBoundFinder::computeAlwaysFailedBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint_fast64_t timeout) {
+    auto const &dft = smtchecker.getDFT();
+    if (smtchecker.checkTleNeverFailed() == storm::solver::SmtSolver::CheckResult::Sat) {
+        return dft.nrBasicElements() + 1;
+    }
+    uint64_t bound = dft.nrBasicElements();
+    while (true) {
+        smtchecker.setSolverTimeout(timeout * 1000);
+        storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithEq(bound);
+        smtchecker.unsetSolverTimeout();
+        switch (tmp_res) {
+            case storm::solver::SmtSolver::CheckResult::Sat:
+                if (!dft.getDependencies().empty()) {
+                    return correctUpperBound(smtchecker, bound, timeout);
+                } else {
+                    return bound;
+                }
+            case storm::solver::SmtSolver::CheckResult::Unknown:
+                STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
+                return bound;
+            default:
+                if (bound == 0) {
+                    return bound;
+                }
+                --bound;
+                break;
+        }
+    }
+}
+
 uint64_t FailureBoundFinder::getLeastFailureBound(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout) {
     if (useSMT) {
         STORM_LOG_TRACE("Compute lower bound for number of BE failures necessary for the DFT to fail");
-
         storm::dft::modelchecker::DFTASFChecker smtchecker(dft);
         smtchecker.toSolver();
-
-        uint64_t bound = 0;
-        while (bound < dft.nrBasicElements() + 1) {
-            smtchecker.setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithLeq(bound);
-            smtchecker.unsetSolverTimeout();
-            switch (tmp_res) {
-                case storm::solver::SmtSolver::CheckResult::Sat:
-                    if (!dft.getDependencies().empty()) {
-                        return correctLowerBound(std::make_shared<storm::dft::modelchecker::DFTASFChecker>(smtchecker), bound, timeout);
-                    } else {
-                        return bound;
-                    }
-                case storm::solver::SmtSolver::CheckResult::Unknown:
-                    STORM_LOG_DEBUG("Lower bound: Solver returned 'Unknown'");
-                    return bound;
-                default:
-                    ++bound;
-                    break;
-            }
-        }
-
-        return bound;
+        return computeLeastFailureBound(smtchecker, timeout);
     } else {
         // naive bound
         return 1;
@@ -160,31 +195,7 @@ uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<doubl
     if (useSMT) {
         storm::dft::modelchecker::DFTASFChecker smtchecker(dft);
         smtchecker.toSolver();
-
-        if (smtchecker.checkTleNeverFailed() == storm::solver::SmtSolver::CheckResult::Sat) {
-            return dft.nrBasicElements() + 1;
-        }
-        uint64_t bound = dft.nrBasicElements();
-        while (bound >= 0) {
-            smtchecker.setSolverTimeout(timeout * 1000);
-            storm::solver::SmtSolver::CheckResult tmp_res = smtchecker.checkTleFailsWithEq(bound);
-            smtchecker.unsetSolverTimeout();
-            switch (tmp_res) {
-                case storm::solver::SmtSolver::CheckResult::Sat:
-                    if (!dft.getDependencies().empty()) {
-                        return correctUpperBound(std::make_shared<storm::dft::modelchecker::DFTASFChecker>(smtchecker), bound, timeout);
-                    } else {
-                        return bound;
-                    }
-                case storm::solver::SmtSolver::CheckResult::Unknown:
-                    STORM_LOG_DEBUG("Upper bound: Solver returned 'Unknown'");
-                    return bound;
-                default:
-                    --bound;
-                    break;
-            }
-        }
-        return bound;
+        return computeAlwaysFailedBound(smtchecker, timeout);
     } else {
         // naive bound
         return dft.nrBasicElements() + 1;
@@ -198,6 +209,27 @@ uint64_t FailureBoundFinder::getAlwaysFailedBound(storm::dft::storage::DFT<Ratio
     return dft.nrBasicElements() + 1;
 }
 
+std::pair<uint64_t, uint64_t> FailureBoundFinder::getFailureBounds(storm::dft::storage::DFT<double> const &dft, bool useSMT, uint_fast64_t timeout) {
+    if (useSMT) {
+        STORM_LOG_TRACE("Compute bounds for number of BE failures");
+        storm::dft::modelchecker::DFTASFChecker smtchecker(dft);
+        smtchecker.toSolver();
+        uint64_t lowerBound = computeLeastFailureBound(smtchecker, timeout);
+        return std::make_pair(lowerBound, computeAlwaysFailedBound(smtchecker, timeout));
+    } else {
+        // naive bounds
+        return std::make_pair(1, dft.nrBasicElements() + 1);
+    }
+}
+
+std::pair<uint64_t, uint64_t> FailureBoundFinder::getFailureBounds(storm::dft::storage::DFT<RationalFunction> const &dft, bool useSMT,
+                                                                   uint_fast64_t timeout) {
+    if (useSMT) {
+        STORM_LOG_WARN("SMT encoding does not support rational functions");
+    }
+    return std::make_pair(1, dft.nrBasicElements() + 1);
+}
+
 class FailureBoundFinder;
 
 }  // namespace utility
@@ -32,7 +32,40 @@ class FailureBoundFinder {
 
     static uint64_t getAlwaysFailedBound(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
 
+    /**
+     * Get both the least failure bound and the always failed bound.
+     * The SMT encoding of the DFT is only generated once and shared by all queries for both bounds.
+     *
+     * @param dft the DFT to check
+     * @param useSMT if set, an SMT solver is used to improve the bounds
+     * @param timeout timeout for each query in seconds, defaults to 10 seconds
+     * @return pair of least failure bound and always failed bound
+     */
+    static std::pair<uint64_t, uint64_t> getFailureBounds(storm::dft::storage::DFT<double> const &dft, bool useSMT = false, uint_fast64_t timeout = 10);
+
+    static std::pair<uint64_t, uint64_t> getFailureBounds(storm::dft::storage::DFT<storm::RationalFunction> const &dft, bool useSMT = false,
+                                                          uint_fast64_t timeout = 10);
+
    private:
+    /**
+     * Compute the least failure bound with the given SMT checker whose solver is already initialized.
+     * As the TLE can fail with at most b failures if it can fail with at most b-1 failures, the bound is determined by binary search.
+     *
+     * @param smtchecker the SMT checker to use
+     * @param timeout timeout for each query in seconds
+     * @return the least failure bound
+     */
+    static uint64_t computeLeastFailureBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint_fast64_t timeout);
+
+    /**
+     * Compute the always failed bound with the given SMT checker whose solver is already initialized.
+     *
+     * @param smtchecker the SMT checker to use
+     * @param timeout timeout for each query in seconds
+     * @return the always failed bound
+     */
+    static uint64_t computeAlwaysFailedBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint_fast64_t timeout);
+
     /**
      * Helper function for correction of least failure bound when dependencies are present.
      * The main idea is to check if a later point of failure for the TLE than the pre-computed bound exists, but
@@ -44,7 +77,7 @@ class FailureBoundFinder {
      * @param timeout timeout timeout for each query in seconds
      * @return the corrected bound
      */
-    static uint64_t correctLowerBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout);
+    static uint64_t correctLowerBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint64_t bound, uint_fast64_t timeout);
 
     /**
      * Helper function for correction of bound for number of BEs such that the DFT always fails when dependencies are present
@@ -54,7 +87,7 @@ class FailureBoundFinder {
      * @param timeout timeout timeout for each query in seconds
      * @return the corrected bound
      */
-    static uint64_t correctUpperBound(std::shared_ptr<storm::dft::modelchecker::DFTASFChecker> smtchecker, uint64_t bound, uint_fast64_t timeout);
+    static uint64_t correctUpperBound(storm::dft::modelchecker::DFTASFChecker &smtchecker, uint64_t bound, uint_fast64_t timeout);
 };
 
 }  // namespace utility
@@ -310,6 +310,17 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         }
     }
 
+    // The solutions of the blocks that were enumerated in a previous abstraction can only be reused if the solver is constrained in the same way.
+    std::optional<storm::dd::Bdd<DdType>> blockSolutionsGuard;
+    if (enumerateAbstractGuard) {
+        blockSolutionsGuard = abstractGuard;
+    }
+    if (blockSolutionsGuard != cachedBlockSolutionsGuard) {
+        cachedBlockSolutions.clear();
+        cachedBlockSolutionsGuard = blockSolutionsGuard;
+    }
+    decltype(cachedBlockSolutions) blockSolutions;
+
     // Then enumerate the solutions for each of the blocks of the decomposition.
     uint64_t usedNondeterminismVariables = 0;
     uint64_t blockCounter = 0;
@@ -353,17 +364,29 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
             }
         }
 
-        std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-        numberOfSolutions = 0;
-        smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap, this, &numberOfSolutions, &sourceVariablesAndPredicates,
-                                                        &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
-            sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
-                getDistributionBdd(model, destinationVariablesAndPredicates));
-            ++numberOfSolutions;
-            return true;
-        });
-        STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-        numberOfTotalSolutions += numberOfSolutions;
+        // Only enumerate the solutions of the block if they were not already enumerated for the same predicates.
+        auto blockSolutionsIt = blockSolutions.find(transitionDecisionVariables);
+        if (blockSolutionsIt == blockSolutions.end()) {
+            auto cachedBlockSolutionsIt = cachedBlockSolutions.find(transitionDecisionVariables);
+            if (cachedBlockSolutionsIt != cachedBlockSolutions.end()) {
+                STORM_LOG_TRACE("Reusing solutions for block " << blockCounter << ".");
+                blockSolutionsIt = blockSolutions.emplace(transitionDecisionVariables, std::move(cachedBlockSolutionsIt->second)).first;
+            } else {
+                std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> enumeratedSolutions;
+                numberOfSolutions = 0;
+                smtSolver->allSat(transitionDecisionVariables, [&enumeratedSolutions, this, &numberOfSolutions, &sourceVariablesAndPredicates,
+                                                                &destinationVariablesAndPredicates](storm::solver::SmtSolver::ModelReference const& model) {
+                    enumeratedSolutions[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(
+                        getDistributionBdd(model, destinationVariablesAndPredicates));
+                    ++numberOfSolutions;
+                    return true;
+                });
+                STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
+                numberOfTotalSolutions += numberOfSolutions;
+                blockSolutionsIt = blockSolutions.emplace(transitionDecisionVariables, std::move(enumeratedSolutions)).first;
+            }
+        }
+        auto const& sourceToDistributionsMap = blockSolutionsIt->second;
 
         // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
         // need to encode the nondeterminism.
@@ -407,6 +430,9 @@ void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition()
         smtSolver->pop();
     }
 
+    // Only keep the solutions of the blocks of the current decomposition.
+    cachedBlockSolutions = std::move(blockSolutions);
+
     // multiply the results
     storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
     for (auto const& blockBdd : blockBdds) {
@@ -2,7 +2,9 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-gamebased-ar/abstraction/GameBddResult.h"
@@ -249,6 +251,13 @@ class CommandAbstractor {
     // predicates, this result may be reused.
     GameBddResult<DdType> cachedDd;
 
+    // The solutions enumerated for the blocks of the most recent decomposition, indexed by the decision variables of the block. As the decision
+    // variables of a predicate never change, the solutions of a block remain valid as long as the solver is constrained in the same way.
+    std::map<std::vector<storm::expressions::Variable>, std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>>> cachedBlockSolutions;
+
+    // The abstract guard that was asserted while enumerating the cached block solutions (if any).
+    std::optional<storm::dd::Bdd<DdType>> cachedBlockSolutionsGuard;
+
     // All relevant decision variables over which to perform AllSat.
     std::vector<storm::expressions::Variable> decisionVariables;
 
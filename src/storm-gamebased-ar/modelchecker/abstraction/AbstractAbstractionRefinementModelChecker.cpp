@@ -108,6 +108,13 @@ bool AbstractAbstractionRefinementModelChecker<ModelType>::getReuseQuantitativeR
     return reuseQuantitativeResults;
 }
 
+template<typename ModelType>
+storm::dd::Add<AbstractAbstractionRefinementModelChecker<ModelType>::DdType, typename AbstractAbstractionRefinementModelChecker<ModelType>::ValueType>
+AbstractAbstractionRefinementModelChecker<ModelType>::translateValuesOfPreviousAbstractModel(storm::models::symbolic::Model<DdType, ValueType> const&,
+                                                                                             storm::dd::Add<DdType, ValueType> const& values) {
+    return values;
+}
+
 template<typename ModelType>
 std::unique_ptr<storm::modelchecker::CheckResult> AbstractAbstractionRefinementModelChecker<ModelType>::performAbstractionRefinement(Environment const& env) {
     STORM_LOG_THROW(checkTask->isOnlyInitialStatesRelevantSet(), storm::exceptions::InvalidPropertyException,
@@ -377,8 +384,9 @@ AbstractAbstractionRefinementModelChecker<ModelType>::computeQuantitativeResult(
 
     storm::dd::Add<DdType, ValueType> startValues;
     if (this->getReuseQuantitativeResults() && lastBounds.first) {
-        startValues = maybe.ite(lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector(),
-                                abstractModel.getManager().template getAddZero<ValueType>());
+        storm::dd::Add<DdType, ValueType> previousValues = this->translateValuesOfPreviousAbstractModel(
+            abstractModel, lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector());
+        startValues = maybe.ite(previousValues, abstractModel.getManager().template getAddZero<ValueType>());
     } else {
         startValues = abstractModel.getManager().template getAddZero<ValueType>();
     }
@@ -424,8 +432,9 @@ AbstractAbstractionRefinementModelChecker<ModelType>::computeQuantitativeResult(
 
     storm::dd::Add<DdType, ValueType> minStartValues;
     if (this->getReuseQuantitativeResults() && lastBounds.first) {
-        minStartValues = maybeMin.ite(lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector(),
-                                      abstractModel.getManager().template getAddZero<ValueType>());
+        storm::dd::Add<DdType, ValueType> previousValues = this->translateValuesOfPreviousAbstractModel(
+            abstractModel, lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector());
+        minStartValues = maybeMin.ite(previousValues, abstractModel.getManager().template getAddZero<ValueType>());
     } else {
         minStartValues = abstractModel.getManager().template getAddZero<ValueType>();
     }
@@ -486,8 +495,9 @@ AbstractAbstractionRefinementModelChecker<ModelType>::computeQuantitativeResult(
 
     storm::dd::Add<DdType, ValueType> minStartValues;
     if (this->getReuseQuantitativeResults() && lastBounds.first) {
-        minStartValues = maybeMin.ite(lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector(),
-                                      abstractModel.getManager().template getAddZero<ValueType>());
+        storm::dd::Add<DdType, ValueType> previousValues = this->translateValuesOfPreviousAbstractModel(
+            abstractModel, lastBounds.first->asSymbolicQuantitativeCheckResult<DdType, ValueType>().getValueVector());
+        minStartValues = maybeMin.ite(previousValues, abstractModel.getManager().template getAddZero<ValueType>());
     } else {
         minStartValues = abstractModel.getManager().template getAddZero<ValueType>();
     }
@@ -119,6 +119,12 @@ class AbstractAbstractionRefinementModelChecker : public storm::modelchecker::Ab
     /// current ones.
     virtual void refineAbstractModel() = 0;
 
+    /// Translates the values obtained for the previous abstract model to the states of the given (current) abstract
+    /// model, so that they can be used as start values of the quantitative solution. The default implementation
+    /// assumes that the encoding of the abstract states is the same across refinements.
+    virtual storm::dd::Add<DdType, ValueType> translateValuesOfPreviousAbstractModel(storm::models::symbolic::Model<DdType, ValueType> const& abstractModel,
+                                                                                     storm::dd::Add<DdType, ValueType> const& values);
+
     /// -------- Methods used to implement the abstraction refinement procedure.
 
     /// Performs the actual abstraction refinement loop.
@@ -7,11 +7,17 @@
 
 #include "storm-gamebased-ar/abstraction/SymbolicStateSet.h"
 
+#include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
 
 #include "storm/modelchecker/propositional/SymbolicPropositionalModelChecker.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -22,7 +28,8 @@ template<typename ModelType>
 const std::string BisimulationAbstractionRefinementModelChecker<ModelType>::name = "bisimulation-based astraction refinement";
 
 template<typename ModelType>
-BisimulationAbstractionRefinementModelChecker<ModelType>::BisimulationAbstractionRefinementModelChecker(ModelType const& model) : model(model) {
+BisimulationAbstractionRefinementModelChecker<ModelType>::BisimulationAbstractionRefinementModelChecker(ModelType const& model)
+    : model(model), refinementSteps(storm::settings::getModule<storm::settings::modules::AbstractionSettings>().getNumberOfRefinementSteps()) {
     // Intentionally left empty.
 }
 
@@ -62,6 +69,10 @@ void BisimulationAbstractionRefinementModelChecker<ModelType>::initializeAbstrac
 template<typename ModelType>
 std::shared_ptr<storm::models::Model<typename BisimulationAbstractionRefinementModelChecker<ModelType>::ValueType>>
 BisimulationAbstractionRefinementModelChecker<ModelType>::getAbstractModel() {
+    auto const& partition = this->bisimulation->getStatePartition();
+    previousPartition = std::move(currentPartition);
+    currentPartition = partition.storedAsBdd() ? partition.asBdd() : partition.asAdd().notZero();
+
     lastAbstractModel = this->bisimulation->getQuotient(storm::dd::bisimulation::QuotientFormat::Dd);
     return lastAbstractModel;
 }
@@ -127,7 +138,27 @@ bool BisimulationAbstractionRefinementModelChecker<ModelType>::requiresScheduler
 template<typename ModelType>
 void BisimulationAbstractionRefinementModelChecker<ModelType>::refineAbstractModel() {
     STORM_LOG_ASSERT(bisimulation, "Bisimulation object required.");
-    this->bisimulation->compute(10);
+    this->bisimulation->compute(refinementSteps);
+}
+
+template<typename ModelType>
+storm::dd::Add<BisimulationAbstractionRefinementModelChecker<ModelType>::DdType, typename BisimulationAbstractionRefinementModelChecker<ModelType>::ValueType>
+BisimulationAbstractionRefinementModelChecker<ModelType>::translateValuesOfPreviousAbstractModel(
+    storm::models::symbolic::Model<DdType, ValueType> const& abstractModel, storm::dd::Add<DdType, ValueType> const& values) {
+    // The block numbers change from one partition to the next, so the values need to be mapped to the new blocks. This is only possible if the states
+    // of the current abstract model are the blocks, i.e. if it is a partial quotient.
+    auto const& partition = this->bisimulation->getStatePartition();
+    if (!previousPartition || abstractModel.getRowVariables().count(partition.getBlockVariable()) == 0) {
+        return abstractModel.getManager().template getAddZero<ValueType>();
+    }
+
+    // Since the current partition refines the previous one, the relation maps each current block to the unique previous block containing it. The
+    // values of the previous blocks are thus lower bounds for the (less abstract) current blocks, which makes them valid start values.
+    std::set<storm::expressions::Variable> blockVariableSet = {partition.getBlockVariable()};
+    std::set<storm::expressions::Variable> primedBlockVariableSet = {partition.getPrimedBlockVariable()};
+    storm::dd::Bdd<DdType> blockRelation =
+        currentPartition.value().andExists(previousPartition.value().renameVariables(blockVariableSet, primedBlockVariableSet), model.getColumnVariables());
+    return values.renameVariables(blockVariableSet, primedBlockVariableSet).multiplyMatrix(blockRelation, primedBlockVariableSet);
 }
 
 template class BisimulationAbstractionRefinementModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>;
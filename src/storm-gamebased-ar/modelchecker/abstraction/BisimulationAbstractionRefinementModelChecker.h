@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include "storm-gamebased-ar/modelchecker/abstraction/AbstractAbstractionRefinementModelChecker.h"
+#include "storm/storage/dd/Bdd.h"
 
 namespace storm::models {
 template<typename ValueType>
@@ -40,6 +42,8 @@ class BisimulationAbstractionRefinementModelChecker : public AbstractAbstraction
     virtual uint64_t getAbstractionPlayer() const override;
     virtual bool requiresSchedulerSynthesis() const override;
     virtual void refineAbstractModel() override;
+    virtual storm::dd::Add<DdType, ValueType> translateValuesOfPreviousAbstractModel(storm::models::symbolic::Model<DdType, ValueType> const& abstractModel,
+                                                                                     storm::dd::Add<DdType, ValueType> const& values) override;
 
    private:
     template<typename QuotientModelType>
@@ -53,6 +57,14 @@ class BisimulationAbstractionRefinementModelChecker : public AbstractAbstraction
     /// Maintains the last abstract model that was returned.
     std::shared_ptr<storm::models::Model<ValueType>> lastAbstractModel;
 
+    /// The state partitions (as BDDs) underlying the last and the second to last abstract model. These are used to
+    /// map the values of the blocks of the previous abstract model to the (refined) blocks of the current one.
+    std::optional<storm::dd::Bdd<DdType>> currentPartition;
+    std::optional<storm::dd::Bdd<DdType>> previousPartition;
+
+    /// The number of refinement steps to perform between two abstract models.
+    uint64_t refinementSteps;
+
     /// The name of the method.
     const static std::string name;
 };
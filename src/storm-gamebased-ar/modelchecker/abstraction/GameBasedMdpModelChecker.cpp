@@ -484,8 +484,7 @@ ExplicitQuantitativeResult<ValueType> computeQuantitativeResult(
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<uint64_t> const& player1Groups,
     ExplicitQualitativeGameResultMinMax const& qualitativeResult, storm::storage::BitVector const& maybeStates, storage::ExplicitGameStrategyPair& strategyPair,
     storm::dd::Odd const& odd, ExplicitQuantitativeResult<ValueType> const* startingQuantitativeResult = nullptr,
-    storage::ExplicitGameStrategyPair const* startingStrategyPair = nullptr,
-    boost::optional<PreviousExplicitResult<ValueType>> const& previousResult = boost::none) {
+    storage::ExplicitGameStrategyPair const* startingStrategyPair = nullptr) {
     bool player2Min = player2Direction == storm::OptimizationDirection::Minimize;
     auto const& player1Prob1States = player2Min ? qualitativeResult.getProb1Min().asExplicitQualitativeGameResult().getPlayer1States()
                                                 : qualitativeResult.getProb1Max().asExplicitQualitativeGameResult().getPlayer1States();
@@ -502,17 +501,6 @@ ExplicitQuantitativeResult<ValueType> computeQuantitativeResult(
         return result;
     }
 
-    // If there is a previous result, unpack the previous values with respect to the new ODD.
-    if (previousResult) {
-        STORM_LOG_ASSERT(player2Min, "Can only reuse previous values when minimizing.");
-        previousResult.get().odd.oldToNewIndex(odd, [&previousResult, &result, player2Min, player1Prob1States](uint64_t oldOffset, uint64_t newOffset) {
-            if (!player1Prob1States.get(newOffset)) {
-                result.getValues()[newOffset] =
-                    player2Min ? previousResult.get().values.getValues()[oldOffset] : previousResult.get().values.getValues()[oldOffset];
-            }
-        });
-    }
-
     // Otherwise, we need to solve a (sub)game.
     STORM_LOG_TRACE("[" << player1Direction << ", " << player2Direction << "]: Solving " << maybeStates.getNumberOfSetBits() << " maybe states.");
 
@@ -549,10 +537,6 @@ ExplicitQuantitativeResult<ValueType> computeQuantitativeResult(
     if (startingQuantitativeResult) {
         storm::utility::vector::selectVectorValues(values, maybeStates, startingQuantitativeResult->getValues());
     }
-    if (previousResult) {
-        STORM_LOG_ASSERT(!startingQuantitativeResult, "Cannot take two different hints.");
-        storm::utility::vector::selectVectorValues(values, maybeStates, result.getValues());
-    }
 
     // Prepare scheduler storage.
     std::vector<uint64_t> player1Scheduler(subPlayer1Groups.size() - 1);
@@ -624,6 +608,69 @@ ExplicitQuantitativeResult<ValueType> computeQuantitativeResult(
     return result;
 }
 
+template<typename ValueType>
+ExplicitQuantitativeResult<ValueType> liftPreviousValues(PreviousExplicitResult<ValueType> const& previousResult, storm::dd::Odd const& odd,
+                                                         storm::storage::BitVector const& player1Prob1States) {
+    ExplicitQuantitativeResult<ValueType> result(player1Prob1States.size());
+    storm::utility::vector::setVectorValues(result.getValues(), player1Prob1States, storm::utility::one<ValueType>());
+
+    // Every state of the refined game inherits the value of the state it was split from.
+    previousResult.odd.oldToNewIndex(odd, [&previousResult, &result, &player1Prob1States](uint64_t oldOffset, uint64_t newOffset) {
+        if (!player1Prob1States.get(newOffset)) {
+            result.getValues()[newOffset] = previousResult.values.getValues()[oldOffset];
+        }
+    });
+    return result;
+}
+
+template<typename ValueType>
+storage::ExplicitGameStrategyPair liftPreviousStrategies(PreviousExplicitResult<ValueType> const& previousResult, storm::dd::Odd const& odd,
+                                                         std::vector<uint64_t> const& player1Groups, std::vector<uint64_t> const& player2RowGrouping,
+                                                         std::vector<uint64_t> const& player1Labeling, std::vector<uint64_t> const& player2Labeling) {
+    storage::ExplicitGameStrategyPair result(player1Groups.size() - 1, player2RowGrouping.size() - 1);
+
+    // Every state of the refined game takes the choices (identified by their labels) of the state it was split from, if they are still available.
+    previousResult.odd.oldToNewIndex(odd, [&](uint64_t oldOffset, uint64_t newOffset) {
+        uint64_t player1Label = previousResult.player1Labels[oldOffset];
+        if (player1Label == storm::storage::ExplicitGameStrategy::UNDEFINED) {
+            return;
+        }
+
+        for (uint64_t player2State = player1Groups[newOffset]; player2State < player1Groups[newOffset + 1]; ++player2State) {
+            if (player1Labeling[player2State] == player1Label) {
+                result.getPlayer1Strategy().setChoice(newOffset, player2State);
+
+                uint64_t player2Label = previousResult.player2Labels[oldOffset];
+                for (uint64_t row = player2RowGrouping[player2State]; row < player2RowGrouping[player2State + 1]; ++row) {
+                    if (player2Labeling[row] == player2Label) {
+                        result.getPlayer2Strategy().setChoice(player2State, row);
+                        break;
+                    }
+                }
+                break;
+            }
+        }
+    });
+    return result;
+}
+
+template<typename ValueType>
+void storeStrategies(PreviousExplicitResult<ValueType>& previousResult, storage::ExplicitGameStrategyPair const& strategyPair,
+                     std::vector<uint64_t> const& player1Labeling, std::vector<uint64_t> const& player2Labeling) {
+    uint64_t numberOfPlayer1States = strategyPair.getPlayer1Strategy().getNumberOfStates();
+    previousResult.player1Labels.assign(numberOfPlayer1States, storm::storage::ExplicitGameStrategy::UNDEFINED);
+    previousResult.player2Labels.assign(numberOfPlayer1States, storm::storage::ExplicitGameStrategy::UNDEFINED);
+    for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+        if (strategyPair.getPlayer1Strategy().hasDefinedChoice(player1State)) {
+            uint64_t player2State = strategyPair.getPlayer1Strategy().getChoice(player1State);
+            previousResult.player1Labels[player1State] = player1Labeling[player2State];
+            if (strategyPair.getPlayer2Strategy().hasDefinedChoice(player2State)) {
+                previousResult.player2Labels[player1State] = player2Labeling[strategyPair.getPlayer2Strategy().getChoice(player2State)];
+            }
+        }
+    }
+}
+
 template<storm::dd::DdType Type, typename ModelType>
 std::unique_ptr<storm::modelchecker::CheckResult> GameBasedMdpModelChecker<Type, ModelType>::performGameBasedAbstractionRefinement(
     Environment const& env, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& checkTask,
@@ -1480,15 +1527,28 @@ std::unique_ptr<storm::modelchecker::CheckResult> GameBasedMdpModelChecker<Type,
         STORM_LOG_TRACE("Starting numerical solution step.");
 
         // (7) Solve the min values and check whether we can give the answer already.
+        // If there is a previous result, lift the lower bounds and strategies to the refined game to warm-start the solver.
         storm::utility::Stopwatch quantitativeWatch(true);
-        quantitativeResult.setMin(computeQuantitativeResult<ValueType>(env, player1Direction, storm::OptimizationDirection::Minimize, transitionMatrix,
-                                                                       player1Groups, qualitativeResult, maybeMin, minStrategyPair, odd, nullptr, nullptr,
-                                                                       this->reuseQuantitativeResults ? previousResult : boost::none));
+        boost::optional<ExplicitQuantitativeResult<ValueType>> startingMinResult;
+        boost::optional<storage::ExplicitGameStrategyPair> startingMinStrategyPair;
+        if (this->reuseQuantitativeResults && previousResult) {
+            if (previousResult.get().hasValues()) {
+                startingMinResult = liftPreviousValues(previousResult.get(), odd, qualitativeResult.prob1Min.getPlayer1States());
+            }
+            if (previousResult.get().hasStrategies()) {
+                startingMinStrategyPair =
+                    liftPreviousStrategies(previousResult.get(), odd, player1Groups, player2RowGrouping, player1Labeling, player2Labeling);
+            }
+        }
 
         // Dispose of previous result as we now reused it.
         if (previousResult) {
             previousResult.get().clear();
         }
+
+        quantitativeResult.setMin(computeQuantitativeResult<ValueType>(
+            env, player1Direction, storm::OptimizationDirection::Minimize, transitionMatrix, player1Groups, qualitativeResult, maybeMin, minStrategyPair, odd,
+            startingMinResult ? &startingMinResult.get() : nullptr, startingMinStrategyPair ? &startingMinStrategyPair.get() : nullptr));
         quantitativeWatch.stop();
         result = checkForResultAfterQuantitativeCheck<ValueType>(checkTask, storm::OptimizationDirection::Minimize,
                                                                  quantitativeResult.getMin().getRange(initialStates));
@@ -1561,14 +1621,26 @@ std::unique_ptr<storm::modelchecker::CheckResult> GameBasedMdpModelChecker<Type,
         refinementWatch.stop();
         totalRefinementWatch.add(refinementWatch);
         STORM_LOG_INFO("Quantitative refinement completed in " << refinementWatch.getTimeInMilliseconds() << "ms.");
+    }
 
+    // (11) Prepare the parts of the solution that remain valid for the refined game.
+    if (this->reuseQualitativeResults || this->reuseQuantitativeResults) {
+        PreviousExplicitResult<ValueType> nextPreviousResult;
+        if (this->reuseQualitativeResults) {
+            nextPreviousResult.prob1MaxStates = qualitativeResult.prob1Max.getPlayer1States();
+        }
         if (this->reuseQuantitativeResults) {
-            PreviousExplicitResult<ValueType> nextPreviousResult;
-            nextPreviousResult.values = std::move(quantitativeResult.getMin());
-            nextPreviousResult.odd = odd;
-            previousResult = std::move(nextPreviousResult);
-            STORM_LOG_TRACE("Prepared next previous result to reuse values.");
+            if (!qualitativeRefinement) {
+                nextPreviousResult.values = std::move(quantitativeResult.getMin());
+                storeStrategies(nextPreviousResult, minStrategyPair, player1Labeling, player2Labeling);
+            } else if (previousResult && previousResult.get().hasValues()) {
+                // As no values were computed for this game, we carry over the ones of the previous game.
+                nextPreviousResult.values = liftPreviousValues(previousResult.get(), odd, qualitativeResult.prob1Min.getPlayer1States());
+            }
         }
+        nextPreviousResult.odd = odd;
+        previousResult = std::move(nextPreviousResult);
+        STORM_LOG_TRACE("Prepared next previous result to reuse values, strategies and qualitative information.");
     }
 
     return nullptr;
@@ -1659,9 +1731,20 @@ ExplicitQualitativeGameResultMinMax GameBasedMdpModelChecker<Type, ModelType>::c
     result.prob0Max =
         storm::utility::graph::performProb0(transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions, constraintStates,
                                             targetStates, player1Direction, storm::OptimizationDirection::Maximize, &maxStrategyPair);
-    result.prob1Max =
-        storm::utility::graph::performProb1(transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions, constraintStates,
-                                            targetStates, player1Direction, storm::OptimizationDirection::Maximize, &maxStrategyPair);
+
+    // We know that only previous prob1 states can now be prob 1 states again, because the upper bound values can only decrease over iterations.
+    boost::optional<storm::storage::BitVector> prob1MaxCandidates;
+    if (reuseQualitativeResults && previousResult && previousResult.get().prob1MaxStates.size() > 0) {
+        prob1MaxCandidates = targetStates;
+        previousResult.get().odd.oldToNewIndex(odd, [&previousResult, &prob1MaxCandidates](uint64_t oldOffset, uint64_t newOffset) {
+            if (previousResult.get().prob1MaxStates.get(oldOffset)) {
+                prob1MaxCandidates.get().set(newOffset);
+            }
+        });
+    }
+    result.prob1Max = storm::utility::graph::performProb1(transitionMatrix, player1Groups, player1BackwardTransitions, player2BackwardTransitions,
+                                                          constraintStates, targetStates, player1Direction, storm::OptimizationDirection::Maximize,
+                                                          &maxStrategyPair, prob1MaxCandidates);
 
     STORM_LOG_INFO("[" << player1Direction << ", " << storm::OptimizationDirection::Minimize << "]: " << result.prob0Min.player1States.getNumberOfSetBits()
                        << " 'no', " << result.prob1Min.player1States.getNumberOfSetBits() << " 'yes'.");
@@ -10,6 +10,7 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/Odd.h"
 
+#include "storm/storage/BitVector.h"
 #include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm-gamebased-ar/abstraction/ExplicitQuantitativeResult.h"
@@ -66,14 +67,40 @@ using storm::gbar::abstraction::SymbolicQualitativeGameResult;
 using storm::gbar::abstraction::SymbolicQualitativeGameResultMinMax;
 
 namespace detail {
+/*!
+ * The parts of the solution of an explicit game that are carried over to the game obtained by the next refinement. As refinement only splits abstract
+ * states, the information is given with respect to the states of the previous game (described by the ODD) and is mapped to the states of the refined
+ * game they were split into.
+ */
 template<typename ValueType>
 struct PreviousExplicitResult {
+    // The lower bounds (player 2 minimizing). These remain lower bounds for all states of the refined game.
     ExplicitQuantitativeResult<ValueType> values;
+
+    // The strategies of the two players (player 2 minimizing), given by the player 1 and player 2 labels of the chosen player 2 states and rows,
+    // respectively. Choices are identified via labels, because the states and rows themselves are renumbered by the refinement.
+    std::vector<uint64_t> player1Labels;
+    std::vector<uint64_t> player2Labels;
+
+    // The player 1 states with probability 1 (player 2 maximizing). As upper bounds can only decrease, these are candidates for the refined game.
+    storm::storage::BitVector prob1MaxStates;
+
     storm::dd::Odd odd;
 
+    bool hasValues() const {
+        return !values.getValues().empty();
+    }
+
+    bool hasStrategies() const {
+        return !player1Labels.empty();
+    }
+
     void clear() {
         odd = storm::dd::Odd();
         values = ExplicitQuantitativeResult<ValueType>();
+        player1Labels.clear();
+        player2Labels.clear();
+        prob1MaxStates = storm::storage::BitVector();
     }
 };
 }  // namespace detail
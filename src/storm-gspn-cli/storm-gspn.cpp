@@ -1,3 +1,4 @@
+#include "storm-gspn/analysis/GspnStructuralAnalysis.h"
 #include "storm-gspn/api/storm-gspn.h"
 #include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
@@ -32,6 +33,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/DebugSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/GlpkSettings.h"
+#include "storm/settings/modules/GurobiSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 
@@ -50,6 +53,8 @@ void initializeSettings(std::string const& name, std::string const& executableNa
     storm::settings::addModule<storm::settings::modules::DebugSettings>();
     storm::settings::addModule<storm::settings::modules::JaniExportSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+    storm::settings::addModule<storm::settings::modules::GlpkSettings>();
+    storm::settings::addModule<storm::settings::modules::GurobiSettings>();
 }
 
 void processOptions() {
@@ -93,6 +98,12 @@ void processOptions() {
         }
         gspn->setCapacities(capacities);
     }
+    if (gspnSettings.isStructuralCapacitiesSet()) {
+        storm::gspn::GspnStructuralAnalysis analysis(*gspn);
+        auto capacities = analysis.computeCapacities();
+        STORM_LOG_INFO("Derived capacities for " << capacities.size() << " places from the structure of the GSPN.");
+        gspn->setCapacities(capacities);
+    }
 
     storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
@@ -0,0 +1,154 @@
+#include "storm-gspn/analysis/GspnStructuralAnalysis.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "storm/solver/LpSolver.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/solver.h"
+
+namespace storm {
+namespace gspn {
+
+GspnStructuralAnalysis::GspnStructuralAnalysis(GSPN const& gspn) : gspn(gspn) {
+    auto addTransition = [this](Transition const& transition) {
+        std::map<uint64_t, int64_t> effects;
+        for (auto const& entry : transition.getInputPlaces()) {
+            effects[entry.first] -= entry.second;
+        }
+        for (auto const& entry : transition.getOutputPlaces()) {
+            effects[entry.first] += entry.second;
+        }
+        std::vector<std::pair<uint64_t, int64_t>> column;
+        for (auto const& entry : effects) {
+            if (entry.second != 0) {
+                column.push_back(entry);
+            }
+        }
+        // Transitions which do not change the marking are irrelevant
+        if (!column.empty()) {
+            incidence.push_back(std::move(column));
+        }
+    };
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        if (!storm::utility::isZero(transition.getWeight())) {
+            addTransition(transition);
+        }
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        if (!storm::utility::isZero(transition.getRate())) {
+            addTransition(transition);
+        }
+    }
+}
+
+std::vector<std::vector<uint64_t>> GspnStructuralAnalysis::computePlaceInvariants() const {
+    uint64_t const numberOfPlaces = gspn.getNumberOfPlaces();
+    auto solver = storm::utility::solver::getLpSolver<double>("GSPN place invariants");
+    std::vector<storm::expressions::Variable> weights;
+    for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+        weights.push_back(solver->addLowerBoundedIntegerVariable("y" + std::to_string(place), 0.0, 1.0));
+    }
+    solver->update();
+    for (uint64_t transition = 0; transition < incidence.size(); ++transition) {
+        storm::expressions::Expression weightedChange = solver->getConstant(0.0);
+        for (auto const& entry : incidence[transition]) {
+            weightedChange = weightedChange + solver->getConstant(static_cast<double>(entry.second)) * weights[entry.first].getExpression();
+        }
+        solver->addConstraint("t" + std::to_string(transition), weightedChange == solver->getConstant(0.0));
+    }
+    solver->update();
+
+    std::vector<std::vector<uint64_t>> invariants;
+    storm::storage::BitVector coveredPlaces(numberOfPlaces, false);
+    for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+        if (coveredPlaces.get(place)) {
+            continue;
+        }
+        solver->push();
+        solver->addConstraint("cover", weights[place].getExpression() >= solver->getConstant(1.0));
+        solver->update();
+        solver->optimize();
+        if (solver->isOptimal()) {
+            std::vector<uint64_t> invariant(numberOfPlaces, 0);
+            for (uint64_t otherPlace = 0; otherPlace < numberOfPlaces; ++otherPlace) {
+                invariant[otherPlace] = solver->getIntegerValue(weights[otherPlace]);
+                if (invariant[otherPlace] > 0) {
+                    coveredPlaces.set(otherPlace);
+                }
+            }
+            if (std::find(invariants.begin(), invariants.end(), invariant) == invariants.end()) {
+                invariants.push_back(std::move(invariant));
+            }
+        } else {
+            STORM_LOG_DEBUG("Place " << gspn.getPlace(place)->getName() << " is not covered by a P-invariant.");
+        }
+        solver->pop();
+    }
+    return invariants;
+}
+
+std::vector<boost::optional<uint64_t>> GspnStructuralAnalysis::computePlaceBounds(bool integer) const {
+    uint64_t const numberOfPlaces = gspn.getNumberOfPlaces();
+    auto solver = storm::utility::solver::getLpSolver<double>("GSPN place bounds");
+    solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
+    std::vector<storm::expressions::Expression> firingCounts;
+    for (uint64_t transition = 0; transition < incidence.size(); ++transition) {
+        std::string name = "x" + std::to_string(transition);
+        firingCounts.push_back(integer ? solver->addLowerBoundedIntegerVariable(name, 0.0).getExpression()
+                                       : solver->addLowerBoundedContinuousVariable(name, 0.0).getExpression());
+    }
+    // The objective is constrained to the number of tokens in the considered place
+    storm::expressions::Variable objective = solver->addLowerBoundedContinuousVariable("m", 0.0, 1.0);
+    solver->update();
+
+    // Number of tokens in each place according to the state equation
+    std::vector<storm::expressions::Expression> tokens(numberOfPlaces);
+    for (auto const& place : gspn.getPlaces()) {
+        tokens[place.getID()] = solver->getConstant(static_cast<double>(place.getNumberOfInitialTokens()));
+    }
+    for (uint64_t transition = 0; transition < incidence.size(); ++transition) {
+        for (auto const& entry : incidence[transition]) {
+            tokens[entry.first] = tokens[entry.first] + solver->getConstant(static_cast<double>(entry.second)) * firingCounts[transition];
+        }
+    }
+    for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+        solver->addConstraint("p" + std::to_string(place), tokens[place] >= solver->getConstant(0.0));
+    }
+    solver->update();
+
+    std::vector<boost::optional<uint64_t>> bounds(numberOfPlaces);
+    for (uint64_t place = 0; place < numberOfPlaces; ++place) {
+        solver->push();
+        solver->addConstraint("objective", objective.getExpression() == tokens[place]);
+        solver->update();
+        solver->optimize();
+        if (solver->isOptimal()) {
+            // The number of tokens is integral
+            bounds[place] = static_cast<uint64_t>(std::floor(solver->getObjectiveValue() + 1e-6));
+        } else {
+            // The initial marking satisfies the state equation, thus the LP is feasible
+            STORM_LOG_ASSERT(solver->isUnbounded(), "LP for the bound of place " << place << " is neither optimal nor unbounded.");
+        }
+        solver->pop();
+    }
+    return bounds;
+}
+
+std::unordered_map<std::string, uint64_t> GspnStructuralAnalysis::computeCapacities(bool integer) const {
+    std::vector<boost::optional<uint64_t>> bounds = computePlaceBounds(integer);
+    std::unordered_map<std::string, uint64_t> capacities;
+    for (auto const& place : gspn.getPlaces()) {
+        if (!place.hasRestrictedCapacity() && bounds[place.getID()]) {
+            capacities.emplace(place.getName(), bounds[place.getID()].get());
+        }
+    }
+    return capacities;
+}
+
+}  // namespace gspn
+}  // namespace storm
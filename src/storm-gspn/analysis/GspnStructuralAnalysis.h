@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+
+namespace storm {
+namespace gspn {
+
+/*!
+ * Structural analysis of a GSPN based on its incidence matrix, i.e., without exploring the state space.
+ * Transitions which can never fire (weight or rate zero) are ignored. Inhibitor arcs and priorities are ignored as well, which only makes the
+ * results more conservative.
+ */
+class GspnStructuralAnalysis {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param gspn GSPN.
+     */
+    GspnStructuralAnalysis(GSPN const& gspn);
+
+    /*!
+     * Compute P-invariants, i.e., non-negative integer weightings y of the places with y^T * C = 0 for the incidence matrix C. The weighted sum of
+     * tokens is the same in all reachable markings. For each place, an invariant with minimal sum of weights covering the place is computed
+     * (if there is one).
+     *
+     * @return Invariants, each given as vector of weights indexed by the place ids. Each invariant occurs only once.
+     */
+    std::vector<std::vector<uint64_t>> computePlaceInvariants() const;
+
+    /*!
+     * Compute upper bounds on the number of tokens in each place via the state equation m = m_0 + C * x with x >= 0.
+     * Every reachable marking satisfies the state equation, thus the bounds are sound. The bounds are at least as tight as the bounds derived from
+     * the P-invariants.
+     *
+     * @param integer If true, the firing counts x are integer which gives tighter bounds at the cost of solving an ILP per place.
+     * @return For each place id, the bound or none if the place is structurally unbounded.
+     */
+    std::vector<boost::optional<uint64_t>> computePlaceBounds(bool integer = false) const;
+
+    /*!
+     * Get capacities for all places without capacity for which a bound could be computed. They can be passed to GSPN::setCapacities.
+     *
+     * @param integer See computePlaceBounds.
+     */
+    std::unordered_map<std::string, uint64_t> computeCapacities(bool integer = false) const;
+
+   private:
+    GSPN const& gspn;
+
+    // Incidence matrix restricted to the transitions which can fire, given as list of (place, change) entries for each transition
+    std::vector<std::vector<std::pair<uint64_t, int64_t>>> incidence;
+};
+
+}  // namespace gspn
+}  // namespace storm
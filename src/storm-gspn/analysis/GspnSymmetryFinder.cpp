@@ -0,0 +1,272 @@
+#include "storm-gspn/analysis/GspnSymmetryFinder.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace gspn {
+
+namespace {
+// Types of arcs. Arcs are stored at both of their nodes, the arc at the place (or partition) uses the type shifted by reverseArc.
+uint64_t const inputArc = 0;
+uint64_t const outputArc = 1;
+uint64_t const inhibitionArc = 2;
+uint64_t const partitionArc = 3;
+uint64_t const reverseArc = 4;
+
+// Maximal number of backtracking steps when searching for an isomorphism between two components
+uint64_t const maxBacktrackingSteps = 100000;
+
+uint64_t const noNode = std::numeric_limits<uint64_t>::max();
+}  // namespace
+
+GspnSymmetries GspnSymmetryFinder::findSymmetries(GSPN const& gspn, std::set<uint64_t> const& fixedPlaces) {
+    GspnSymmetryFinder finder(gspn, fixedPlaces);
+    finder.refineColors();
+
+    // Components can only be isomorphic if they contain the same colors
+    std::map<std::vector<uint64_t>, std::vector<std::vector<uint64_t>>> candidates;
+    for (auto& component : finder.computeComponents()) {
+        std::vector<uint64_t> componentColors;
+        for (auto const& node : component) {
+            componentColors.push_back(finder.colors[node]);
+        }
+        std::sort(componentColors.begin(), componentColors.end());
+        candidates[componentColors].push_back(std::move(component));
+    }
+
+    std::vector<GspnSymmetries::SymmetryGroup> groups;
+    std::vector<uint64_t> mapping;
+    for (auto const& entry : candidates) {
+        auto const& components = entry.second;
+        std::vector<bool> assigned(components.size(), false);
+        for (uint64_t representative = 0; representative < components.size(); ++representative) {
+            if (assigned[representative]) {
+                continue;
+            }
+            // The places of the representative define the order of the places in all components of the group
+            std::vector<uint64_t> places;
+            for (auto const& node : components[representative]) {
+                if (node < finder.numberOfPlaces) {
+                    places.push_back(node);
+                }
+            }
+            if (places.empty()) {
+                // Permuting transitions only does not change markings
+                break;
+            }
+            std::sort(places.begin(), places.end());
+            GspnSymmetries::SymmetryGroup group = {places};
+            for (uint64_t other = representative + 1; other < components.size(); ++other) {
+                if (!assigned[other] && finder.findIsomorphism(components[representative], components[other], mapping)) {
+                    assigned[other] = true;
+                    std::vector<uint64_t> otherPlaces;
+                    for (auto const& place : places) {
+                        otherPlaces.push_back(mapping[place]);
+                    }
+                    group.push_back(std::move(otherPlaces));
+                }
+            }
+            if (group.size() > 1) {
+                groups.push_back(std::move(group));
+            }
+        }
+    }
+    GspnSymmetries symmetries(std::move(groups));
+    STORM_LOG_DEBUG("Found " << symmetries.nrSymmetries() << " symmetry groups in GSPN " << gspn.getName() << ":\n" << symmetries);
+    return symmetries;
+}
+
+GspnSymmetryFinder::GspnSymmetryFinder(GSPN const& gspn, std::set<uint64_t> const& fixedPlaces) : numberOfPlaces(gspn.getNumberOfPlaces()) {
+    auto const& immediateTransitions = gspn.getImmediateTransitions();
+    auto const& timedTransitions = gspn.getTimedTransitions();
+    auto const& partitions = gspn.getPartitions();
+    // Nodes are the places (by id), the immediate transitions, the timed transitions and the partitions
+    uint64_t const firstTimed = numberOfPlaces + immediateTransitions.size();
+    uint64_t const firstPartition = firstTimed + timedTransitions.size();
+    uint64_t const numberOfNodes = firstPartition + partitions.size();
+    arcs.resize(numberOfNodes);
+
+    // Initial colors given by the attributes of the nodes: (kind, attribute, attribute, rate or weight)
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t, double>> attributes(numberOfNodes);
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() < numberOfPlaces, "Place id " << place.getID() << " is out of range.");
+        uint64_t capacity = place.hasRestrictedCapacity() ? place.getCapacity() : noNode;
+        if (fixedPlaces.count(place.getID()) > 0) {
+            // Fixed places get a unique color
+            attributes[place.getID()] = std::make_tuple(1, place.getID(), 0, 0.0);
+        } else {
+            attributes[place.getID()] = std::make_tuple(0, place.getNumberOfInitialTokens(), capacity, 0.0);
+        }
+    }
+    auto addArcs = [this](uint64_t node, Transition const& transition) {
+        for (auto const& entry : transition.getInputPlaces()) {
+            arcs[node].emplace_back(entry.first, inputArc, entry.second);
+            arcs[entry.first].emplace_back(node, inputArc + reverseArc, entry.second);
+        }
+        for (auto const& entry : transition.getOutputPlaces()) {
+            arcs[node].emplace_back(entry.first, outputArc, entry.second);
+            arcs[entry.first].emplace_back(node, outputArc + reverseArc, entry.second);
+        }
+        for (auto const& entry : transition.getInhibitionPlaces()) {
+            arcs[node].emplace_back(entry.first, inhibitionArc, entry.second);
+            arcs[entry.first].emplace_back(node, inhibitionArc + reverseArc, entry.second);
+        }
+    };
+    for (uint64_t i = 0; i < immediateTransitions.size(); ++i) {
+        attributes[numberOfPlaces + i] = std::make_tuple(2, immediateTransitions[i].getPriority(), 0, immediateTransitions[i].getWeight());
+        addArcs(numberOfPlaces + i, immediateTransitions[i]);
+    }
+    for (uint64_t i = 0; i < timedTransitions.size(); ++i) {
+        auto const& transition = timedTransitions[i];
+        uint64_t servers = transition.hasInfiniteServerSemantics() ? 0 : transition.getNumberOfServers();
+        attributes[firstTimed + i] = std::make_tuple(3, transition.getPriority(), servers, transition.getRate());
+        addArcs(firstTimed + i, transition);
+    }
+    // Partitions are nodes as well such that a permutation of the transitions respects the choices between immediate transitions
+    for (uint64_t i = 0; i < partitions.size(); ++i) {
+        attributes[firstPartition + i] = std::make_tuple(4, partitions[i].priority, 0, 0.0);
+        for (auto const& transition : partitions[i].transitions) {
+            arcs[numberOfPlaces + transition].emplace_back(firstPartition + i, partitionArc, 1);
+            arcs[firstPartition + i].emplace_back(numberOfPlaces + transition, partitionArc + reverseArc, 1);
+        }
+    }
+    for (auto& nodeArcs : arcs) {
+        std::sort(nodeArcs.begin(), nodeArcs.end());
+    }
+
+    std::map<std::tuple<uint64_t, uint64_t, uint64_t, double>, uint64_t> attributeColors;
+    for (auto const& attribute : attributes) {
+        attributeColors.emplace(attribute, 0);
+    }
+    uint64_t color = 0;
+    for (auto& entry : attributeColors) {
+        entry.second = color++;
+    }
+    colors.reserve(numberOfNodes);
+    for (auto const& attribute : attributes) {
+        colors.push_back(attributeColors.at(attribute));
+    }
+}
+
+void GspnSymmetryFinder::refineColors() {
+    if (colors.empty()) {
+        return;
+    }
+    uint64_t numberOfColors = *std::max_element(colors.begin(), colors.end()) + 1;
+    while (true) {
+        // The new color of a node is given by its old color and the colors of its neighbors. Thus, refinement never merges colors.
+        std::map<std::pair<uint64_t, std::vector<Arc>>, uint64_t> signatures;
+        std::vector<uint64_t> newColors(colors.size());
+        for (uint64_t node = 0; node < colors.size(); ++node) {
+            std::vector<Arc> neighbors;
+            neighbors.reserve(arcs[node].size());
+            for (auto const& arc : arcs[node]) {
+                neighbors.emplace_back(colors[std::get<0>(arc)], std::get<1>(arc), std::get<2>(arc));
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            newColors[node] = signatures.emplace(std::make_pair(colors[node], std::move(neighbors)), signatures.size()).first->second;
+        }
+        colors = std::move(newColors);
+        if (signatures.size() == numberOfColors) {
+            break;
+        }
+        numberOfColors = signatures.size();
+    }
+
+    std::vector<uint64_t> colorSizes(numberOfColors, 0);
+    for (auto const& color : colors) {
+        ++colorSizes[color];
+    }
+    isFixed.resize(colors.size());
+    for (uint64_t node = 0; node < colors.size(); ++node) {
+        isFixed[node] = colorSizes[colors[node]] == 1;
+    }
+}
+
+std::vector<std::vector<uint64_t>> GspnSymmetryFinder::computeComponents() const {
+    std::vector<std::vector<uint64_t>> components;
+    std::vector<bool> visited = isFixed;
+    for (uint64_t start = 0; start < colors.size(); ++start) {
+        if (visited[start]) {
+            continue;
+        }
+        std::vector<uint64_t> component = {start};
+        visited[start] = true;
+        for (uint64_t i = 0; i < component.size(); ++i) {
+            for (auto const& arc : arcs[component[i]]) {
+                uint64_t target = std::get<0>(arc);
+                if (!visited[target]) {
+                    visited[target] = true;
+                    component.push_back(target);
+                }
+            }
+        }
+        components.push_back(std::move(component));
+    }
+    return components;
+}
+
+bool GspnSymmetryFinder::findIsomorphism(std::vector<uint64_t> const& first, std::vector<uint64_t> const& second, std::vector<uint64_t>& mapping) const {
+    std::map<uint64_t, std::vector<uint64_t>> candidatesByColor;
+    for (auto const& node : second) {
+        candidatesByColor[colors[node]].push_back(node);
+    }
+    mapping.assign(colors.size(), noNode);
+    std::vector<bool> used(colors.size(), false);
+
+    // The node b is a valid image of the node a if all arcs of a to fixed or already mapped nodes have a counterpart at b.
+    // As a and b have the same color, they have the same number of arcs. Thus, a complete mapping is an isomorphism.
+    auto isConsistent = [&](uint64_t a, uint64_t b) {
+        for (auto const& arc : arcs[a]) {
+            uint64_t target = std::get<0>(arc);
+            uint64_t image = isFixed[target] ? target : mapping[target];
+            if (image != noNode && !std::binary_search(arcs[b].begin(), arcs[b].end(), Arc(image, std::get<1>(arc), std::get<2>(arc)))) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Backtracking search over the nodes of the first component in breadth-first order
+    std::vector<uint64_t> nextCandidate(first.size(), 0);
+    uint64_t position = 0;
+    uint64_t steps = 0;
+    while (position < first.size()) {
+        uint64_t node = first[position];
+        auto const& candidates = candidatesByColor[colors[node]];
+        bool found = false;
+        while (nextCandidate[position] < candidates.size()) {
+            uint64_t candidate = candidates[nextCandidate[position]++];
+            if (!used[candidate] && isConsistent(node, candidate)) {
+                mapping[node] = candidate;
+                used[candidate] = true;
+                found = true;
+                break;
+            }
+        }
+        if (found) {
+            ++position;
+            continue;
+        }
+        // Backtrack
+        nextCandidate[position] = 0;
+        if (position == 0) {
+            return false;
+        }
+        if (++steps > maxBacktrackingSteps) {
+            STORM_LOG_DEBUG("Aborted search for isomorphism between components after " << maxBacktrackingSteps << " steps.");
+            return false;
+        }
+        --position;
+        used[mapping[first[position]]] = false;
+        mapping[first[position]] = noNode;
+    }
+    return true;
+}
+
+}  // namespace gspn
+}  // namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm-gspn/storage/gspn/GspnSymmetries.h"
+
+namespace storm {
+namespace gspn {
+
+/*!
+ * Finds groups of interchangeable sub-nets of a GSPN, e.g., several identical servers sharing a queue.
+ * The net is considered as graph over places, transitions and partitions. First, its nodes are colored by color refinement starting from their
+ * attributes (initial tokens, capacities, rates, weights, priorities, server semantics). Nodes with a unique color are mapped to themselves by every
+ * automorphism. The remaining nodes decompose into connected components and components which are isomorphic (with respect to the colors and the
+ * arcs to the fixed nodes) can be interchanged arbitrarily.
+ */
+class GspnSymmetryFinder {
+   public:
+    /*!
+     * Find symmetries of the GSPN.
+     *
+     * @param gspn GSPN.
+     * @param fixedPlaces Ids of places which must not be permuted, e.g., because they occur in the properties.
+     * @return Symmetry groups.
+     */
+    static GspnSymmetries findSymmetries(GSPN const& gspn, std::set<uint64_t> const& fixedPlaces = {});
+
+   private:
+    // Arc of the graph given by the target node, the type of the arc and its multiplicity
+    typedef std::tuple<uint64_t, uint64_t, uint64_t> Arc;
+
+    GspnSymmetryFinder(GSPN const& gspn, std::set<uint64_t> const& fixedPlaces);
+
+    /*!
+     * Refine the colors until the color of each node determines the multiset of colors of its neighbors.
+     */
+    void refineColors();
+
+    /*!
+     * Compute the connected components of the nodes which are not fixed. The nodes of each component are given in breadth-first order.
+     */
+    std::vector<std::vector<uint64_t>> computeComponents() const;
+
+    /*!
+     * Search for an isomorphism between two components which maps each fixed node to itself.
+     *
+     * @param first First component in breadth-first order.
+     * @param second Second component.
+     * @param mapping Mapping from the nodes of the first component to the nodes of the second component. Is only valid if an isomorphism was found.
+     * @return True iff an isomorphism was found.
+     */
+    bool findIsomorphism(std::vector<uint64_t> const& first, std::vector<uint64_t> const& second, std::vector<uint64_t>& mapping) const;
+
+    uint64_t numberOfPlaces;
+    // Outgoing arcs of each node in sorted order
+    std::vector<std::vector<Arc>> arcs;
+    std::vector<uint64_t> colors;
+    std::vector<bool> isFixed;
+};
+
+}  // namespace gspn
+}  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
 #include "storm/storage/jani/Model.h"
@@ -14,6 +15,14 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the CTMC or Markov automaton of the GSPN directly, i.e., without the translation to JANI.
+ *    If symmetry reduction is enabled, the model is lumped with respect to the symmetric sub-nets of the GSPN.
+ */
+std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitModel(storm::gspn::GSPN const& gspn,
+                                                                         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = {},
+                                                                         bool symmetryReduction = false);
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
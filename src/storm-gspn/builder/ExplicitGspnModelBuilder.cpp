@@ -1,332 +1,433 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "storm-gspn/analysis/GspnSymmetryFinder.h"
+
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/logic/AtomicExpressionFormula.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, bool symmetryReduction)
+    : gspn(gspn), symmetryReduction(symmetryReduction) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::initialize() {
+    // Encoding of markings
+    uint64_t const numberOfPlaces = gspn.getNumberOfPlaces();
+    placeOffsets.assign(numberOfPlaces, 0);
+    placeBits.assign(numberOfPlaces, 0);
+    markingSize = 0;
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() < numberOfPlaces, "Place id " << place.getID() << " is out of range.");
+        uint64_t bits = 32;
+        if (place.hasRestrictedCapacity()) {
+            bits = 1;
+            while (bits < 64 && (place.getCapacity() >> bits) > 0) {
+                ++bits;
+            }
+        }
+        placeOffsets[place.getID()] = markingSize;
+        placeBits[place.getID()] = bits;
+        markingSize += bits;
+    }
+    // Keys of the hash maps must not be empty
+    markingSize = std::max<uint64_t>(markingSize, 1);
+    stateStorage = storm::storage::BitVectorHashMap<uint64_t>(markingSize, 1000);
+    vanishingStorage = storm::storage::BitVectorHashMap<uint64_t>(markingSize, 1000);
+    stateMarkings.clear();
+    vanishingDistributions.clear();
+    vanishingInProgress.clear();
+
+    // Transitions
+    auto const& immediateTransitions = gspn.getImmediateTransitions();
+    auto const& timedTransitions = gspn.getTimedTransitions();
+    numberOfImmediateTransitions = immediateTransitions.size();
+    transitions.clear();
+    transitions.resize(numberOfImmediateTransitions + timedTransitions.size());
+    auto setArcs = [&](TransitionInfo& info, storm::gspn::Transition const& transition) {
+        std::map<uint64_t, int64_t> effects;
+        for (auto const& entry : transition.getInputPlaces()) {
+            info.inputs.emplace_back(entry.first, entry.second);
+            effects[entry.first] -= entry.second;
+        }
+        for (auto const& entry : transition.getOutputPlaces()) {
+            effects[entry.first] += entry.second;
+        }
+        for (auto const& entry : transition.getInhibitionPlaces()) {
+            info.inhibitors.emplace_back(entry.first, entry.second);
+        }
+        for (auto const& entry : effects) {
+            if (entry.second != 0) {
+                info.effects.push_back(entry);
+            }
+        }
+    };
+    for (uint64_t i = 0; i < immediateTransitions.size(); ++i) {
+        setArcs(transitions[i], immediateTransitions[i]);
+        transitions[i].value = storm::utility::convertNumber<ValueType>(immediateTransitions[i].getWeight());
+    }
+    for (uint64_t i = 0; i < timedTransitions.size(); ++i) {
+        setArcs(transitions[numberOfImmediateTransitions + i], timedTransitions[i]);
+        transitions[numberOfImmediateTransitions + i].value = storm::utility::convertNumber<ValueType>(timedTransitions[i].getRate());
+    }
+
+    // Firing a transition can only change the enabledness of transitions which have an input or inhibition arc from a place it changes
+    std::vector<std::vector<uint64_t>> transitionsReadingPlace(numberOfPlaces);
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        for (auto const& entry : transitions[transition].inputs) {
+            transitionsReadingPlace[entry.first].push_back(transition);
+        }
+        for (auto const& entry : transitions[transition].inhibitors) {
+            transitionsReadingPlace[entry.first].push_back(transition);
+        }
+    }
+    for (auto& info : transitions) {
+        for (auto const& entry : info.effects) {
+            info.affectedTransitions.insert(info.affectedTransitions.end(), transitionsReadingPlace[entry.first].begin(),
+                                            transitionsReadingPlace[entry.first].end());
+        }
+        std::sort(info.affectedTransitions.begin(), info.affectedTransitions.end());
+        info.affectedTransitions.erase(std::unique(info.affectedTransitions.begin(), info.affectedTransitions.end()), info.affectedTransitions.end());
+    }
+
+    // Partitions
+    partitions = gspn.getPartitions();
+    priorities.assign(numberOfImmediateTransitions, 0);
+    storm::storage::BitVector isPartitioned(numberOfImmediateTransitions, false);
+    for (auto const& partition : partitions) {
+        for (auto const& transition : partition.transitions) {
+            priorities[transition] = partition.priority;
+            isPartitioned.set(transition);
+        }
+    }
+    for (auto transition : ~isPartitioned) {
+        storm::gspn::TransitionPartition partition;
+        partition.transitions.push_back(transition);
+        partition.priority = immediateTransitions[transition].getPriority();
+        priorities[transition] = partition.priority;
+        partitions.push_back(std::move(partition));
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::encode(std::vector<uint64_t> const& tokens) const {
+    storm::storage::BitVector marking(markingSize);
+    for (auto const& place : gspn.getPlaces()) {
+        uint64_t const numberOfTokens = tokens[place.getID()];
+        STORM_LOG_THROW(!place.hasRestrictedCapacity() || numberOfTokens <= place.getCapacity(), storm::exceptions::WrongFormatException,
+                        "Capacity of place " << place.getName() << " is exceeded: it contains " << numberOfTokens << " tokens.");
+        STORM_LOG_THROW(placeBits[place.getID()] >= 64 || (numberOfTokens >> placeBits[place.getID()]) == 0, storm::exceptions::WrongFormatException,
+                        "Number of tokens in place " << place.getName() << " is too large. Consider setting a capacity.");
+        marking.setFromInt(placeOffsets[place.getID()], placeBits[place.getID()], numberOfTokens);
+    }
+    return marking;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> ExplicitGspnModelBuilder<ValueType>::decode(storm::storage::BitVector const& marking) const {
+    std::vector<uint64_t> tokens(placeOffsets.size());
+    for (uint64_t place = 0; place < tokens.size(); ++place) {
+        tokens[place] = marking.getAsInt(placeOffsets[place], placeBits[place]);
+    }
+    return tokens;
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(uint64_t transition, std::vector<uint64_t> const& tokens) const {
+    TransitionInfo const& info = transitions[transition];
+    if (storm::utility::isZero(info.value)) {
+        return false;
+    }
+    for (auto const& entry : info.inputs) {
+        if (tokens[entry.first] < entry.second) {
+            return false;
+        }
+    }
+    for (auto const& entry : info.inhibitors) {
+        if (tokens[entry.first] >= entry.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::computeEnabledTransitions(std::vector<uint64_t> const& tokens) const {
+    storm::storage::BitVector enabled(transitions.size(), false);
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        if (isEnabled(transition, tokens)) {
+            enabled.set(transition);
+        }
+    }
+    return enabled;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::fire(uint64_t transition, std::vector<uint64_t>& tokens, storm::storage::BitVector& enabled) const {
+    TransitionInfo const& info = transitions[transition];
+    for (auto const& entry : info.effects) {
+        tokens[entry.first] += entry.second;
+    }
+    for (auto const& affected : info.affectedTransitions) {
+        enabled.set(affected, isEnabled(affected, tokens));
+    }
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isVanishing(storm::storage::BitVector const& enabled) const {
+    return enabled.getNextSetIndex(0) < numberOfImmediateTransitions;
+}
+
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> ExplicitGspnModelBuilder<ValueType>::getImmediateChoices(storm::storage::BitVector const& enabled) const {
+    uint64_t highestPriority = 0;
+    for (uint64_t transition = enabled.getNextSetIndex(0); transition < numberOfImmediateTransitions; transition = enabled.getNextSetIndex(transition + 1)) {
+        highestPriority = std::max(highestPriority, priorities[transition]);
+    }
+    std::vector<std::vector<uint64_t>> choices;
+    for (auto const& partition : partitions) {
+        if (partition.priority != highestPriority) {
+            continue;
+        }
+        std::vector<uint64_t> choice;
+        for (auto const& transition : partition.transitions) {
+            if (enabled.get(transition)) {
+                choice.push_back(transition);
+            }
+        }
+        if (!choice.empty()) {
+            choices.push_back(std::move(choice));
+        }
+    }
+    return choices;
+}
+
+template<typename ValueType>
+ValueType ExplicitGspnModelBuilder<ValueType>::getRate(uint64_t transition, std::vector<uint64_t> const& tokens) const {
+    auto const& timedTransition = gspn.getTimedTransitions()[transition - numberOfImmediateTransitions];
+    TransitionInfo const& info = transitions[transition];
+    if (timedTransition.hasSingleServerSemantics()) {
+        return info.value;
+    }
+    STORM_LOG_THROW(timedTransition.hasKServerSemantics() || !info.inputs.empty(), storm::exceptions::InvalidModelException,
+                    "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+    // The enabling degree is the number of times the transition could fire concurrently
+    uint64_t enablingDegree = timedTransition.hasKServerSemantics() ? timedTransition.getNumberOfServers() : std::numeric_limits<uint64_t>::max();
+    for (auto const& entry : info.inputs) {
+        enablingDegree = std::min(enablingDegree, tokens[entry.first] / entry.second);
+    }
+    return info.value * storm::utility::convertNumber<ValueType>(enablingDegree);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::findOrAddState(storm::storage::BitVector const& marking) {
+    uint64_t index = stateStorage.findOrAdd(marking, stateMarkings.size());
+    if (index == stateMarkings.size()) {
+        stateMarkings.push_back(marking);
+    }
+    return index;
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::Distribution ExplicitGspnModelBuilder<ValueType>::resolveMarking(std::vector<uint64_t> const& tokens,
+                                                                                                               storm::storage::BitVector const& enabled) {
+    if (symmetries.nrSymmetries() > 0) {
+        std::vector<uint64_t> canonicalTokens = tokens;
+        if (symmetries.canonicalize(canonicalTokens)) {
+            return resolveMarking(canonicalTokens, computeEnabledTransitions(canonicalTokens));
+        }
+    }
+    storm::storage::BitVector marking = encode(tokens);
+    if (!isVanishing(enabled)) {
+        return {{findOrAddState(marking), storm::utility::one<ValueType>()}};
+    }
+    if (stateStorage.contains(marking)) {
+        return {{stateStorage.getValue(marking), storm::utility::one<ValueType>()}};
+    }
+    if (vanishingStorage.contains(marking)) {
+        return vanishingDistributions[vanishingStorage.getValue(marking)];
+    }
+
+    auto choices = getImmediateChoices(enabled);
+    if (choices.size() > 1 || vanishingInProgress.count(marking) > 0) {
+        // Non-determinism and cycles of vanishing markings are kept in the model
+        return {{findOrAddState(marking), storm::utility::one<ValueType>()}};
+    }
+    vanishingInProgress.insert(marking);
+    Distribution result = resolveImmediateChoice(choices.front(), tokens, enabled);
+    vanishingInProgress.erase(marking);
+    if (stateStorage.contains(marking)) {
+        // The marking lies on a cycle and has become a state while resolving its successors
+        return {{stateStorage.getValue(marking), storm::utility::one<ValueType>()}};
+    }
+    vanishingStorage.findOrAdd(marking, vanishingDistributions.size());
+    vanishingDistributions.push_back(result);
+    return result;
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::Distribution ExplicitGspnModelBuilder<ValueType>::resolveImmediateChoice(
+    std::vector<uint64_t> const& choice, std::vector<uint64_t> const& tokens, storm::storage::BitVector const& enabled) {
+    ValueType totalWeight = storm::utility::zero<ValueType>();
+    for (auto const& transition : choice) {
+        totalWeight += transitions[transition].value;
+    }
+    Distribution result;
+    for (auto const& transition : choice) {
+        std::vector<uint64_t> successorTokens = tokens;
+        storm::storage::BitVector successorEnabled = enabled;
+        fire(transition, successorTokens, successorEnabled);
+        ValueType probability = transitions[transition].value / totalWeight;
+        for (auto const& entry : resolveMarking(successorTokens, successorEnabled)) {
+            result[entry.first] += probability * entry.second;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitGspnModelBuilder<ValueType>::build(
+    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    initialize();
+
+    std::vector<std::shared_ptr<storm::logic::AtomicExpressionFormula const>> atomicExpressionFormulas;
+    for (auto const& formula : formulas) {
+        formula->gatherAtomicExpressionFormulas(atomicExpressionFormulas);
+    }
+    symmetries = storm::gspn::GspnSymmetries();
+    if (symmetryReduction) {
+        // Places occurring in the labels must keep their identity
+        std::set<uint64_t> fixedPlaces;
+        for (auto const& atomicExpressionFormula : atomicExpressionFormulas) {
+            for (auto const& variable : atomicExpressionFormula->getExpression().getVariables()) {
+                if (auto place = gspn.getPlace(variable.getName())) {
+                    fixedPlaces.insert(place->getID());
+                }
+            }
+        }
+        symmetries = storm::gspn::GspnSymmetryFinder::findSymmetries(gspn, fixedPlaces);
+        STORM_LOG_INFO("Found " << symmetries.nrSymmetries() << " symmetry groups.");
+    }
+
+    std::vector<uint64_t> initialTokens(gspn.getNumberOfPlaces());
+    for (auto const& place : gspn.getPlaces()) {
+        initialTokens[place.getID()] = place.getNumberOfInitialTokens();
+    }
+    symmetries.canonicalize(initialTokens);
+    // The initial marking is always a state, even if it is vanishing
+    findOrAddState(encode(initialTokens));
+
+    // Explore the states in breadth-first order. The rows of Markovian states contain rates.
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(0, 0, 0, false, true);
+    std::vector<bool> markovian;
+    std::vector<uint64_t> deadlockStates;
+    uint64_t currentRow = 0;
+    for (uint64_t state = 0; state < stateMarkings.size(); ++state) {
+        std::vector<uint64_t> tokens = decode(stateMarkings[state]);
+        storm::storage::BitVector enabled = computeEnabledTransitions(tokens);
+        matrixBuilder.newRowGroup(currentRow);
+        if (isVanishing(enabled)) {
+            markovian.push_back(false);
+            for (auto const& choice : getImmediateChoices(enabled)) {
+                for (auto const& entry : resolveImmediateChoice(choice, tokens, enabled)) {
+                    matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                }
+                ++currentRow;
+            }
+        } else {
+            markovian.push_back(true);
+            Distribution rates;
+            for (uint64_t transition = enabled.getNextSetIndex(numberOfImmediateTransitions); transition < enabled.size();
+                 transition = enabled.getNextSetIndex(transition + 1)) {
+                ValueType rate = getRate(transition, tokens);
+                std::vector<uint64_t> successorTokens = tokens;
+                storm::storage::BitVector successorEnabled = enabled;
+                fire(transition, successorTokens, successorEnabled);
+                for (auto const& entry : resolveMarking(successorTokens, successorEnabled)) {
+                    rates[entry.first] += rate * entry.second;
+                }
+            }
+            if (rates.empty()) {
+                // Deadlocks get a self-loop
+                deadlockStates.push_back(state);
+                rates[state] = storm::utility::one<ValueType>();
+            }
+            for (auto const& entry : rates) {
+                matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+            }
+            ++currentRow;
+        }
+    }
+    uint64_t const numberOfStates = stateMarkings.size();
+    storm::storage::SparseMatrix<ValueType> matrix = matrixBuilder.build(currentRow, numberOfStates, numberOfStates);
+    STORM_LOG_DEBUG("Explored " << numberOfStates << " states and eliminated " << vanishingDistributions.size() << " vanishing markings.");
+
+    // Labeling
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates.begin(), deadlockStates.end()));
+    if (!atomicExpressionFormulas.empty()) {
+        auto const& manager = *gspn.getExpressionManager();
+        storm::expressions::ExpressionEvaluator<double> evaluator(manager);
+        std::vector<std::pair<std::string, storm::expressions::Expression>> labelExpressions;
+        for (auto const& atomicExpressionFormula : atomicExpressionFormulas) {
+            std::string label = atomicExpressionFormula->getExpression().toString();
+            if (!labeling.containsLabel(label)) {
+                labeling.addLabel(label);
+                labelExpressions.emplace_back(label, atomicExpressionFormula->getExpression().substitute(gspn.getConstantsSubstitution()));
+            }
+        }
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            std::vector<uint64_t> tokens = decode(stateMarkings[state]);
+            for (auto const& place : gspn.getPlaces()) {
+                evaluator.setIntegerValue(manager.getVariable(place.getName()), tokens[place.getID()]);
+            }
+            for (auto const& labelExpression : labelExpressions) {
+                if (evaluator.asBool(labelExpression.second)) {
+                    labeling.addLabelToState(labelExpression.first, state);
+                }
+            }
+        }
+    }
+
+    storm::storage::BitVector markovianStates(numberOfStates, false);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        markovianStates.set(state, markovian[state]);
+    }
+    if (markovianStates.full()) {
+        // All vanishing markings have been eliminated
+        matrix.makeRowGroupingTrivial();
+        storm::storage::sparse::ModelComponents<ValueType> components(std::move(matrix), std::move(labeling));
+        components.rateTransitions = true;
+        return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(components));
+    }
+    storm::storage::sparse::ModelComponents<ValueType> components(std::move(matrix), std::move(labeling));
+    components.rateTransitions = true;
+    components.markovianStates = std::move(markovianStates);
+    return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
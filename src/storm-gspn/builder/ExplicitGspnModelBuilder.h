@@ -1,175 +1,143 @@
-// #ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-// #define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
-// #endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm-gspn/storage/gspn/GspnSymmetries.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the state space of a GSPN directly, i.e., without the detour via JANI.
+ * Markings are stored as bit vectors in which each place occupies as many bits as required by its capacity. Whether a transition is enabled is
+ * decided via precomputed input and inhibition vectors, and after firing a transition only the transitions sharing a place with it are re-evaluated.
+ * Vanishing markings (markings in which an immediate transition is enabled) are eliminated on-the-fly if they contain no non-determinism. The result
+ * is a CTMC if all vanishing markings could be eliminated and a Markov automaton otherwise.
+ * Optionally, symmetric sub-nets are detected (see storm::gspn::GspnSymmetryFinder) and each marking is replaced by the canonical representative of
+ * its orbit before it is looked up. The resulting model is the lumped model, which preserves all properties over places not permuted by the
+ * symmetries.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param gspn GSPN. Places without capacity may contain up to 2^32-1 tokens.
+     * @param symmetryReduction Flag whether symmetries of the GSPN should be exploited. Places occurring in the formulas are never permuted.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, bool symmetryReduction = false);
+
+    /*!
+     * Builds the model.
+     *
+     * @param formulas Formulas. For each atomic expression occurring in the formulas, a label named after the expression is added.
+     * @return CTMC or Markov automaton. The labels "init" and "deadlock" are always added.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = {});
+
+   private:
+    // Distribution over the indices of states
+    typedef std::map<uint64_t, ValueType> Distribution;
+
+    struct TransitionInfo {
+        // Input places and multiplicities
+        std::vector<std::pair<uint64_t, uint64_t>> inputs;
+        // Inhibition places and multiplicities
+        std::vector<std::pair<uint64_t, uint64_t>> inhibitors;
+        // Change of the number of tokens for all places whose number of tokens is changed by firing the transition
+        std::vector<std::pair<uint64_t, int64_t>> effects;
+        // Transitions whose enabledness might change by firing the transition
+        std::vector<uint64_t> affectedTransitions;
+        // Weight (immediate transitions) or rate (timed transitions). Transitions with weight or rate zero are never enabled.
+        ValueType value;
+    };
+
+    /*!
+     * Precompute the encoding of the markings and the information about the transitions.
+     * Transitions are numbered such that the immediate transitions come first (in the order of the GSPN), followed by the timed transitions.
+     */
+    void initialize();
+
+    storm::storage::BitVector encode(std::vector<uint64_t> const& tokens) const;
+
+    std::vector<uint64_t> decode(storm::storage::BitVector const& marking) const;
+
+    bool isEnabled(uint64_t transition, std::vector<uint64_t> const& tokens) const;
+
+    storm::storage::BitVector computeEnabledTransitions(std::vector<uint64_t> const& tokens) const;
+
+    /*!
+     * Fire the given transition and update the enabled transitions accordingly.
+     */
+    void fire(uint64_t transition, std::vector<uint64_t>& tokens, storm::storage::BitVector& enabled) const;
+
+    bool isVanishing(storm::storage::BitVector const& enabled) const;
+
+    /*!
+     * Get the choices of a vanishing marking. A choice consists of the enabled transitions of a partition with the highest priority among all
+     * enabled immediate transitions.
+     */
+    std::vector<std::vector<uint64_t>> getImmediateChoices(storm::storage::BitVector const& enabled) const;
+
+    /*!
+     * Get the rate of the given (enabled) timed transition, which depends on the server semantics.
+     */
+    ValueType getRate(uint64_t transition, std::vector<uint64_t> const& tokens) const;
+
+    /*!
+     * Get the index of the state with the given marking. If the marking is new, it is added to the exploration queue.
+     */
+    uint64_t findOrAddState(storm::storage::BitVector const& marking);
+
+    /*!
+     * Compute the distribution over states which is reached when entering the given marking.
+     * The marking is canonicalized first if symmetry reduction is enabled.
+     * Tangible markings are states themselves. Vanishing markings with a single choice are resolved by (recursively) firing their immediate
+     * transitions. Vanishing markings with several choices or which lie on a cycle of vanishing markings become (probabilistic) states.
+     */
+    Distribution resolveMarking(std::vector<uint64_t> const& tokens, storm::storage::BitVector const& enabled);
+
+    /*!
+     * Compute the distribution over states reached by firing one of the given immediate transitions, chosen according to their weights.
+     */
+    Distribution resolveImmediateChoice(std::vector<uint64_t> const& choice, std::vector<uint64_t> const& tokens, storm::storage::BitVector const& enabled);
+
+    storm::gspn::GSPN const& gspn;
+    bool symmetryReduction;
+    storm::gspn::GspnSymmetries symmetries;
+
+    uint64_t numberOfImmediateTransitions;
+    std::vector<TransitionInfo> transitions;
+    // Partitions of the immediate transitions (immediate transitions not contained in any partition of the GSPN form their own partition)
+    std::vector<storm::gspn::TransitionPartition> partitions;
+    // Priority of the partition of each immediate transition
+    std::vector<uint64_t> priorities;
+
+    // First bit and number of bits of each place in the encoding of markings
+    std::vector<uint64_t> placeOffsets;
+    std::vector<uint64_t> placeBits;
+    uint64_t markingSize;
+
+    // Markings of the states and their indices. Their order is the order of the exploration.
+    storm::storage::BitVectorHashMap<uint64_t> stateStorage;
+    std::vector<storm::storage::BitVector> stateMarkings;
+    // Vanishing markings which have been eliminated and the distributions over states they lead to
+    storm::storage::BitVectorHashMap<uint64_t> vanishingStorage;
+    std::vector<Distribution> vanishingDistributions;
+    // Vanishing markings currently being resolved, used to detect cycles
+    std::unordered_set<storm::storage::BitVector> vanishingInProgress;
+};
+
+}  // namespace builder
+}  // namespace storm
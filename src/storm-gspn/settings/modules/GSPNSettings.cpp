@@ -19,6 +19,7 @@ const std::string GSPNSettings::gspnFileOptionShortName = "gspn";
 const std::string GSPNSettings::capacitiesFileOptionName = "capacitiesfile";
 const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
+const std::string GSPNSettings::structuralCapacitiesOptionName = "structuralcapacities";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
 
@@ -40,6 +41,9 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, structuralCapacitiesOptionName, false,
+                                                   "Derives capacities of places without capacity from the state equation (requires an LP solver).")
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, constantsOptionName, false, "Specifies the constant replacements to use.")
                         .setShortName(constantsOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
@@ -73,6 +77,10 @@ uint64_t GSPNSettings::getCapacity() const {
     return this->getOption(capacityOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
 
+bool GSPNSettings::isStructuralCapacitiesSet() const {
+    return this->getOption(structuralCapacitiesOptionName).getHasOptionBeenSet();
+}
+
 bool GSPNSettings::isConstantsSet() const {
     return this->getOption(constantsOptionName).getHasOptionBeenSet();
 }
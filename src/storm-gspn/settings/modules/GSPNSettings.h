@@ -43,6 +43,11 @@ class GSPNSettings : public ModuleSettings {
      */
     uint64_t getCapacity() const;
 
+    /*!
+     * Retrieves whether capacities should be derived from the structure of the GSPN
+     */
+    bool isStructuralCapacitiesSet() const;
+
     /*!
      * Retrieves whether the constants option was set.
      */
@@ -64,6 +69,7 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacitiesFileOptionName;
     static const std::string capacitiesFileOptionShortName;
     static const std::string capacityOptionName;
+    static const std::string structuralCapacitiesOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
 };
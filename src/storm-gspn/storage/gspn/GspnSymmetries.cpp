@@ -0,0 +1,68 @@
+#include "storm-gspn/storage/gspn/GspnSymmetries.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace gspn {
+
+GspnSymmetries::GspnSymmetries(std::vector<SymmetryGroup> groups) : groups(std::move(groups)) {
+    for (auto const& group : this->groups) {
+        STORM_LOG_ASSERT(group.size() > 1, "Symmetry group must contain at least two components.");
+        for (auto const& component : group) {
+            STORM_LOG_ASSERT(component.size() == group.front().size(), "Components of a symmetry group must have the same number of places.");
+        }
+    }
+}
+
+uint64_t GspnSymmetries::nrSymmetries() const {
+    return groups.size();
+}
+
+std::vector<GspnSymmetries::SymmetryGroup> const& GspnSymmetries::getSymmetryGroups() const {
+    return groups;
+}
+
+bool GspnSymmetries::canonicalize(std::vector<uint64_t>& tokens) const {
+    bool changed = false;
+    std::vector<std::vector<uint64_t>> componentTokens;
+    for (auto const& group : groups) {
+        componentTokens.resize(group.size());
+        for (uint64_t component = 0; component < group.size(); ++component) {
+            componentTokens[component].clear();
+            for (auto const& place : group[component]) {
+                componentTokens[component].push_back(tokens[place]);
+            }
+        }
+        if (std::is_sorted(componentTokens.begin(), componentTokens.end())) {
+            continue;
+        }
+        std::sort(componentTokens.begin(), componentTokens.end());
+        for (uint64_t component = 0; component < group.size(); ++component) {
+            for (uint64_t i = 0; i < group[component].size(); ++i) {
+                tokens[group[component][i]] = componentTokens[component][i];
+            }
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+std::ostream& operator<<(std::ostream& out, GspnSymmetries const& symmetries) {
+    for (auto const& group : symmetries.groups) {
+        out << "Symmetry group:";
+        for (auto const& component : group) {
+            out << " {";
+            for (auto const& place : component) {
+                out << " " << place;
+            }
+            out << " }";
+        }
+        out << '\n';
+    }
+    return out;
+}
+
+}  // namespace gspn
+}  // namespace storm
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace storm {
+namespace gspn {
+
+/*!
+ * Symmetries of a GSPN given by groups of interchangeable sub-nets.
+ * Each group consists of components and each component is given by its places. The i-th place of one component corresponds to the i-th place
+ * of every other component of the same group. Any permutation of the components of a group is an automorphism of the net.
+ */
+class GspnSymmetries {
+   public:
+    typedef std::vector<std::vector<uint64_t>> SymmetryGroup;
+
+    GspnSymmetries() = default;
+
+    GspnSymmetries(std::vector<SymmetryGroup> groups);
+
+    /*!
+     * Get the number of symmetry groups.
+     */
+    uint64_t nrSymmetries() const;
+
+    std::vector<SymmetryGroup> const& getSymmetryGroups() const;
+
+    /*!
+     * Replace the marking by the canonical representative of its orbit under the symmetries.
+     * Within each group, the components are sorted lexicographically by their numbers of tokens.
+     *
+     * @param tokens Number of tokens for each place id. Is changed in-place.
+     * @return True iff the marking was changed.
+     */
+    bool canonicalize(std::vector<uint64_t>& tokens) const;
+
+    friend std::ostream& operator<<(std::ostream& out, GspnSymmetries const& symmetries);
+
+   private:
+    std::vector<SymmetryGroup> groups;
+};
+
+}  // namespace gspn
+}  // namespace storm
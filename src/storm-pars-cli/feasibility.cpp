@@ -7,6 +7,7 @@
 #include "storm-pars/api/region.h"
 #include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
 #include "storm-pars/derivative/GradientDescentMethod.h"
+#include "storm-pars/derivative/MultiStartGradientDescent.h"
 #include "storm-pars/settings/modules/DerivativeSettings.h"
 #include "storm-pars/settings/modules/RegionVerificationSettings.h"
 #include "storm-pars/utility/FeasibilitySynthesisTask.h"
@@ -150,12 +151,31 @@ void runFeasibilityWithGD(std::shared_ptr<storm::models::sparse::Model<ValueType
 
     STORM_PRINT("Finding an extremum using Gradient Descent\n");
     storm::utility::Stopwatch derivativeWatch(true);
-    storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double> gdsearch(
-        *dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(),
-        derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet());
+    // Each thread gets its own searcher with its own model checkers, the model is shared.
+    // The searchers are set up sequentially as this is not thread-safe.
+    uint64_t numberOfStarts = derSettings.getNumberOfParallelStarts();
+    std::vector<std::unique_ptr<storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double>>> searchers;
+    for (uint64_t i = 0; i < numberOfStarts; ++i) {
+        searchers.push_back(std::make_unique<storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double>>(
+            *dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(),
+            derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet()));
+        searchers.back()->setup(Environment(), task);
+    }
 
-    gdsearch.setup(Environment(), task);
-    auto instantiationAndValue = gdsearch.gradientDescent();
+    std::pair<std::map<typename utility::parametric::VariableType<ValueType>::type, typename utility::parametric::CoefficientType<ValueType>::type>, double>
+        instantiationAndValue;
+    if (numberOfStarts == 1) {
+        instantiationAndValue = searchers.front()->gradientDescent();
+    } else {
+        std::random_device device;
+        std::default_random_engine engine(device());
+        auto startPoints =
+            storm::derivative::createLatinHypercubeStartPoints<storm::RationalFunction>(searchers.front()->getParameters(), numberOfStarts, engine);
+        instantiationAndValue = storm::derivative::multiStartGradientDescent<storm::RationalFunction, double>(
+            searchers, startPoints, task->getBound(), [](auto const& instantiation, double const& value) {
+                STORM_PRINT("Best value found so far: " << value << " at " << instantiation << "\n");
+            });
+    }
     // TODO check what happens if no feasible solution is found
     if (!derSettings.areInconsequentialParametersOmitted() && omittedParameters) {
         for (RationalFunctionVariable const& param : *omittedParameters) {
@@ -174,7 +194,7 @@ void runFeasibilityWithGD(std::shared_ptr<storm::models::sparse::Model<ValueType
     valueValuationPair.second = instantiationAndValue.first;
 
     if (derSettings.isPrintJsonSet()) {
-        gdsearch.printRunAsJson();
+        searchers.front()->printRunAsJson();
     }
 
     if (task->isBoundSet()) {
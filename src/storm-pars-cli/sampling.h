@@ -1,5 +1,9 @@
 
 #pragma once
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+
 #include "storm-cli-utilities/cli.h"
 #include "storm-cli-utilities/model-handling.h"
 
@@ -74,6 +78,104 @@ struct SampleInformation {
     bool exact;
 };
 
+/*!
+ * Invokes the given callback for each point of the sample spaces, i.e., for each element of the cartesian products.
+ */
+template<typename ValueType>
+void forEachSamplePoint(SampleInformation<ValueType> const& samples,
+                        std::function<void(storm::utility::parametric::Valuation<ValueType> const&)> const& callback) {
+    storm::utility::parametric::Valuation<ValueType> valuation;
+    std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
+    std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
+    std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
+
+    for (auto const& product : samples.cartesianProducts) {
+        parameters.clear();
+        iterators.clear();
+        iteratorEnds.clear();
+
+        for (auto const& entry : product) {
+            parameters.push_back(entry.first);
+            iterators.push_back(entry.second.cbegin());
+            iteratorEnds.push_back(entry.second.cend());
+        }
+
+        bool done = false;
+        while (!done) {
+            // Read off valuation.
+            for (uint64_t i = 0; i < parameters.size(); ++i) {
+                valuation[parameters[i]] = *iterators[i];
+            }
+            callback(valuation);
+
+            // Without parameters, the sample space consists of a single point.
+            done = parameters.empty();
+            for (uint64_t i = 0; i < parameters.size(); ++i) {
+                ++iterators[i];
+                if (iterators[i] == iteratorEnds[i]) {
+                    // Reset iterator and proceed to move next iterator.
+                    iterators[i] = product.at(parameters[i]).cbegin();
+
+                    // If the last iterator was removed, we are done.
+                    if (i == parameters.size() - 1) {
+                        done = true;
+                    }
+                } else {
+                    // If an iterator was moved but not reset, we have another valuation to check.
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * Checks whether none of the distinct non-constant transition functions and rewards of the model vanishes at any of the sample points. Each distinct
+ * function is evaluated only once per point. If this holds, all instantiations have the graph of the parametric model and the model checker only
+ * needs to perform the qualitative analysis once.
+ */
+template<typename ValueType>
+bool samplesAreGraphPreserving(storm::models::sparse::Model<ValueType> const& model, SampleInformation<ValueType> const& samples) {
+    std::unordered_set<ValueType> functions;
+    auto insertFunctions = [&functions](std::vector<ValueType> const& values) {
+        for (auto const& value : values) {
+            if (!storm::utility::isConstant(value)) {
+                functions.insert(value);
+            }
+        }
+    };
+    for (auto const& entry : model.getTransitionMatrix()) {
+        if (!storm::utility::isConstant(entry.getValue())) {
+            functions.insert(entry.getValue());
+        }
+    }
+    for (auto const& rewardModel : model.getRewardModels()) {
+        if (rewardModel.second.hasStateRewards()) {
+            insertFunctions(rewardModel.second.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            insertFunctions(rewardModel.second.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            for (auto const& entry : rewardModel.second.getTransitionRewardMatrix()) {
+                if (!storm::utility::isConstant(entry.getValue())) {
+                    functions.insert(entry.getValue());
+                }
+            }
+        }
+    }
+
+    bool graphPreserving = true;
+    forEachSamplePoint<ValueType>(samples, [&functions, &graphPreserving](storm::utility::parametric::Valuation<ValueType> const& valuation) {
+        if (graphPreserving) {
+            graphPreserving = std::none_of(functions.begin(), functions.end(), [&valuation](ValueType const& function) {
+                return storm::utility::isZero(storm::utility::parametric::evaluate(function, valuation));
+            });
+        }
+    });
+    return graphPreserving;
+}
+
 template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
 void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
     // When samples are provided, we create an instantiation model checker.
@@ -85,58 +187,29 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
         modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
         modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
 
-        storm::utility::parametric::Valuation<ValueType> valuation;
-
-        std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
-        std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-        std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
-
-        storm::utility::Stopwatch watch(true);
-        for (auto const& product : samples.cartesianProducts) {
-            parameters.clear();
-            iterators.clear();
-            iteratorEnds.clear();
-
-            for (auto const& entry : product) {
-                parameters.push_back(entry.first);
-                iterators.push_back(entry.second.cbegin());
-                iteratorEnds.push_back(entry.second.cend());
-            }
-
-            bool done = false;
-            while (!done) {
-                // Read off valuation.
-                for (uint64_t i = 0; i < parameters.size(); ++i) {
-                    valuation[parameters[i]] = *iterators[i];
+        // Valuations are checked in batches, which allows the model checker to evaluate the transition functions for all valuations of a batch at once.
+        uint64_t const batchSize = 1024;
+        std::vector<storm::utility::parametric::Valuation<ValueType>> batch;
+        auto checkBatch = [&]() {
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkBatch(Environment(), batch);
+            for (uint64_t index = 0; index < batch.size(); ++index) {
+                if (results[index]) {
+                    results[index]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                 }
+                printInitialStatesResult<ValueType>(results[index], nullptr, &batch[index]);
+            }
+            batch.clear();
+        };
 
-                storm::utility::Stopwatch valuationWatch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                valuationWatch.stop();
-
-                if (result) {
-                    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
-                }
-                printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
-
-                for (uint64_t i = 0; i < parameters.size(); ++i) {
-                    ++iterators[i];
-                    if (iterators[i] == iteratorEnds[i]) {
-                        // Reset iterator and proceed to move next iterator.
-                        iterators[i] = product.at(parameters[i]).cbegin();
-
-                        // If the last iterator was removed, we are done.
-                        if (i == parameters.size() - 1) {
-                            done = true;
-                        }
-                    } else {
-                        // If an iterator was moved but not reset, we have another valuation to check.
-                        break;
-                    }
-                }
+        storm::utility::Stopwatch watch(true);
+        forEachSamplePoint<ValueType>(samples, [&batch, &checkBatch](storm::utility::parametric::Valuation<ValueType> const& valuation) {
+            batch.push_back(valuation);
+            if (batch.size() == batchSize) {
+                checkBatch();
             }
-        }
+        });
 
+        checkBatch();
         watch.stop();
         STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << "\n\n");
     }
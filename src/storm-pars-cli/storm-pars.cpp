@@ -378,7 +378,7 @@ void parameterSpacePartitioningWithSparseEngine(std::shared_ptr<storm::models::s
     storm::utility::Stopwatch watch(true);
     std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
         model, storm::api::createTask<ValueType>((property.getRawFormula()), true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
-        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh);
+        storm::modelchecker::RegionResultHypothesis::Unknown, false, monotonicitySettings, monThresh, partitionSettings.getNumberOfThreads());
     watch.stop();
     printInitialStatesResult<ValueType>(result, &watch);
 
@@ -506,6 +506,10 @@ void processInputWithValueTypeAndDdlib(cli::SymbolicInput& input, storm::cli::Mo
         if (!samplesAsString.empty()) {
             samples = parseSamples<ValueType>(model, samplesAsString, sampleSettings.isSamplesAreGraphPreservingSet());
             samples.exact = sampleSettings.isSampleExactSet();
+            if (!samples.graphPreserving) {
+                samples.graphPreserving = samplesAreGraphPreserving(*model->as<storm::models::sparse::Model<ValueType>>(), samples);
+                STORM_LOG_INFO_COND(!samples.graphPreserving, "The samples are graph-preserving, the qualitative analysis is only performed once.");
+            }
         }
         if (!samples.empty()) {
             STORM_LOG_TRACE("Sampling the model at given points.");
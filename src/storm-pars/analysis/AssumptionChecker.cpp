@@ -161,6 +161,7 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
     // Check if the order between the different successors is known
     // Also start creating expression for order of states
     auto exprOrderSucc = manager->boolean(true);
+    std::vector<Order::NodeComparison> successorComparisons;
     std::set<expressions::Variable> stateVariables;
     std::set<expressions::Variable> topVariables;
     std::set<expressions::Variable> bottomVariables;
@@ -217,6 +218,7 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
                         comp = Order::NodeComparison::ABOVE;
                     }
                 }
+                successorComparisons.push_back(comp);
                 if (comp == Order::NodeComparison::ABOVE) {
                     exprOrderSucc = exprOrderSucc && !(manager->getVariable(varname1) <= manager->getVariable(varname2));
                 } else if (comp == Order::NodeComparison::BELOW) {
@@ -231,6 +233,13 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
         }
     }
 
+    // The validity only depends on the relations between the successors and on the region (the bounds on the successor probabilities derived from min/max
+    // values of a region also hold on its subregions), so an assumption that was valid on a superregion is valid here as well.
+    ValidatedAssumptionKey key(val1, val2, assumption->getRelationType(), std::move(successorComparisons));
+    if (orderKnown && isValidatedOnSuperRegion(key, region)) {
+        return AssumptionStatus::VALID;
+    }
+
     if (orderKnown) {
         solver::Z3SmtSolver s(*manager);
         auto valueTypeToExpression = expressions::RationalFunctionToExpression<ValueType>(manager);
@@ -304,6 +313,7 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
         if (smtRes == solver::SmtSolver::CheckResult::Unsat) {
             // If there is no thing satisfying the negation we are safe.
             result = AssumptionStatus::VALID;
+            validatedAssumptions[std::move(key)].push_back(region);
         } else if (smtRes == solver::SmtSolver::CheckResult::Sat) {
             result = AssumptionStatus::INVALID;
         }
@@ -311,6 +321,21 @@ AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumptionS
     return result;
 }
 
+template<typename ValueType, typename ConstantType>
+bool AssumptionChecker<ValueType, ConstantType>::isValidatedOnSuperRegion(ValidatedAssumptionKey const& key,
+                                                                           storage::ParameterRegion<ValueType> const& region) const {
+    auto regionsItr = validatedAssumptions.find(key);
+    if (regionsItr == validatedAssumptions.end()) {
+        return false;
+    }
+    for (auto const& validatedRegion : regionsItr->second) {
+        if (validatedRegion.isSubRegion(region)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename ValueType, typename ConstantType>
 AssumptionStatus AssumptionChecker<ValueType, ConstantType>::validateAssumption(std::shared_ptr<expressions::BinaryRelationExpression> assumption,
                                                                                 std::shared_ptr<Order> order,
@@ -1,6 +1,10 @@
 #ifndef STORM_ASSUMPTIONCHECKER_H
 #define STORM_ASSUMPTIONCHECKER_H
 
+#include <map>
+#include <tuple>
+#include <vector>
+
 #include "Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm/environment/Environment.h"
@@ -77,12 +81,20 @@ class AssumptionChecker {
                                         storage::ParameterRegion<ValueType> region) const;
 
    private:
+    // An assumption on two states together with the relations between their successors under which it was validated
+    typedef std::tuple<uint_fast64_t, uint_fast64_t, expressions::RelationType, std::vector<Order::NodeComparison>> ValidatedAssumptionKey;
+
     bool useSamples;
 
     std::vector<std::vector<ConstantType>> samples;
 
     storage::SparseMatrix<ValueType> matrix;
 
+    // Regions for which the SMT solver showed an assumption to be valid, such that it need not be checked again on their subregions
+    mutable std::map<ValidatedAssumptionKey, std::vector<storage::ParameterRegion<ValueType>>> validatedAssumptions;
+
+    bool isValidatedOnSuperRegion(ValidatedAssumptionKey const& key, storage::ParameterRegion<ValueType> const& region) const;
+
     AssumptionStatus validateAssumptionSMTSolver(uint_fast64_t val1, uint_fast64_t val2, std::shared_ptr<expressions::BinaryRelationExpression> assumption,
                                                  std::shared_ptr<Order> order, storage::ParameterRegion<ValueType> region,
                                                  std::vector<ConstantType> const minValues, std::vector<ConstantType> const maxValue) const;
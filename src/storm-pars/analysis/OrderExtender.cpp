@@ -116,7 +116,7 @@ std::shared_ptr<Order> OrderExtender<ValueType, ConstantType>::getBottomTopOrder
         }
         // Get the maybeStates
         std::pair<storage::BitVector, storage::BitVector> statesWithProbability01 =
-            utility::graph::performProb01(this->model->getBackwardTransitions(), phiStates, psiStates);
+            utility::graph::performProb01(*this->model->getBackwardTransitions(), phiStates, psiStates);
         storage::BitVector topStates = statesWithProbability01.second;
         storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -280,6 +280,7 @@ std::unique_ptr<storm::modelchecker::RegionCheckResult<ValueType>> checkRegionsW
  * @param allowModelSimplification
  * @param useMonotonicity
  * @param monThresh if given, determines at which depth to start using monotonicity
+ * @param numberOfThreads if larger than one, regions are analyzed concurrently by this many threads (not supported with monotonicity)
  */
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> checkAndRefineRegionWithSparseEngine(
@@ -287,10 +288,21 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> che
     storm::storage::ParameterRegion<ValueType> const& region, storm::modelchecker::RegionCheckEngine engine,
     boost::optional<ValueType> const& coverageThreshold, boost::optional<uint64_t> const& refinementDepthThreshold = boost::none,
     storm::modelchecker::RegionResultHypothesis hypothesis = storm::modelchecker::RegionResultHypothesis::Unknown, bool allowModelSimplification = true,
-    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0) {
+    MonotonicitySetting monotonicitySetting = MonotonicitySetting(), uint64_t monThresh = 0, uint64_t numberOfThreads = 1) {
     Environment env;
     bool preconditionsValidated = false;
     auto regionChecker = initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting);
+    if (numberOfThreads > 1) {
+        STORM_LOG_THROW(!monotonicitySetting.useMonotonicity, storm::exceptions::NotSupportedException,
+                        "Parallel region refinement does not support monotonicity.");
+        // Every thread gets its own region model checker. They are created upfront as specifying them might simplify the model.
+        std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<ValueType>>> additionalCheckers;
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            additionalCheckers.push_back(
+                initializeRegionModelChecker(env, model, task, engine, true, allowModelSimplification, preconditionsValidated, monotonicitySetting));
+        }
+        return regionChecker->performParallelRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, additionalCheckers);
+    }
     return regionChecker->performRegionRefinement(env, region, coverageThreshold, refinementDepthThreshold, hypothesis, monThresh);
 }
 
@@ -320,9 +320,10 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            // We only need the derivatives at the initial state, which the adjoint method yields for the whole mini-batch with a single solver call.
+            auto gradient = derivativeEvaluationHelper->computeGradientAtInitialState(env, nesterovPredictedPosition, miniBatch, valueVector);
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = gradient.at(parameter);
                 if (synthesisTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     synthesisTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
@@ -369,7 +370,7 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
             parameterNum = 0;
         }
 
-        if (storm::utility::resources::isTerminate()) {
+        if (isStopRequested()) {
             STORM_LOG_WARN("Aborting Gradient Descent, returning non-optimal value.");
             break;
         }
@@ -449,12 +450,15 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         if (isFoundPointBetter) {
             bestInstantiation = point;
             bestValue = prob;
+            if (improvementCallback) {
+                improvementCallback(toParameterSpace(bestInstantiation), bestValue);
+            }
         }
 
         if (synthesisTask->getBound().isSatisfied(bestValue)) {
             STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
             break;
-        } else if (storm::utility::resources::isTerminate()) {
+        } else if (isStopRequested()) {
             break;
         } else {
             if (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC) {
@@ -467,17 +471,27 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
         }
     }
 
+    return std::make_pair(toParameterSpace(bestInstantiation), bestValue);
+}
+
+template<typename FunctionType, typename ConstantType>
+bool GradientDescentInstantiationSearcher<FunctionType, ConstantType>::isStopRequested() const {
+    return storm::utility::resources::isTerminate() || (stopCondition && stopCondition());
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> GradientDescentInstantiationSearcher<FunctionType, ConstantType>::toParameterSpace(
+    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> const& position) const {
+    auto result = position;
     if (constraintMethod == GradientDescentConstraintMethod::LOGISTIC_SIGMOID) {
         // Apply sigmoid function
         for (auto const& parameter : parameters) {
-            bestInstantiation[parameter] =
-                utility::one<CoefficientType<FunctionType>>() /
-                (utility::one<CoefficientType<FunctionType>>() +
-                 utility::convertNumber<CoefficientType<FunctionType>>(std::exp(-utility::convertNumber<double>(bestInstantiation[parameter]))));
+            result[parameter] = utility::one<CoefficientType<FunctionType>>() /
+                                (utility::one<CoefficientType<FunctionType>>() +
+                                 utility::convertNumber<CoefficientType<FunctionType>>(std::exp(-utility::convertNumber<double>(result[parameter]))));
         }
     }
-
-    return std::make_pair(bestInstantiation, bestValue);
+    return result;
 }
 
 template<typename FunctionType, typename ConstantType>
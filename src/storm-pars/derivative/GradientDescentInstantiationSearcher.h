@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include "storm-pars/analysis/MonotonicityHelper.h"
@@ -23,6 +24,9 @@ namespace derivative {
 template<typename FunctionType, typename ConstantType>
 class GradientDescentInstantiationSearcher {
    public:
+    typedef std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>
+        Instantiation;
+
     /**
      * The GradientDescentInstantiationSearcher can find extrema and feasible instantiations in pMCs,
      * for either rewards or probabilities.
@@ -157,6 +161,35 @@ class GradientDescentInstantiationSearcher {
         derivativeEvaluationHelper->specifyFormula(env, *this->currentCheckTaskNoBound);
     }
 
+    /**
+     * Sets the point at which the first descent starts. Further descents start at random points.
+     */
+    void setStartPoint(Instantiation const& point) {
+        startPoint = point;
+    }
+
+    /**
+     * Sets a condition that is checked after each step. Once it holds, gradientDescent returns the best instantiation found so far.
+     * This allows to abort searchers that run in other threads.
+     */
+    void setStopCondition(std::function<bool()> const& condition) {
+        stopCondition = condition;
+    }
+
+    /**
+     * Sets a function that gradientDescent calls with the instantiation and its value whenever it finds a better instantiation.
+     */
+    void setImprovementCallback(std::function<void(Instantiation const&, ConstantType const&)> const& callback) {
+        improvementCallback = callback;
+    }
+
+    /**
+     * Returns the parameters that are optimized. Only available after setup.
+     */
+    std::set<typename utility::parametric::VariableType<FunctionType>::type> const& getParameters() const {
+        return parameters;
+    }
+
     /**
      * Perform Gradient Descent.
      */
@@ -183,6 +216,8 @@ class GradientDescentInstantiationSearcher {
 
    private:
     void resetDynamicValues();
+    bool isStopRequested() const;
+    Instantiation toParameterSpace(Instantiation const& position) const;
 
     Environment env;
     std::shared_ptr<storm::pars::FeasibilitySynthesisTask const> synthesisTask;
@@ -205,6 +240,9 @@ class GradientDescentInstantiationSearcher {
     const bool recordRun;
     std::vector<VisualizationPoint> walk;
 
+    std::function<bool()> stopCondition;
+    std::function<void(Instantiation const&, ConstantType const&)> improvementCallback;
+
     // Gradient Descent types and data that belongs to them, with hyperparameters and running data.
     struct Adam {
         ConstantType averageDecay;
@@ -0,0 +1,117 @@
+#include "storm-pars/derivative/MultiStartGradientDescent.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace derivative {
+
+template<typename FunctionType>
+using VariableType = typename utility::parametric::VariableType<FunctionType>::type;
+template<typename FunctionType>
+using CoefficientType = typename utility::parametric::CoefficientType<FunctionType>::type;
+
+template<typename FunctionType>
+std::vector<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>> createLatinHypercubeStartPoints(
+    std::set<VariableType<FunctionType>> const& parameters, uint64_t numberOfPoints, std::default_random_engine& engine) {
+    std::vector<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>> result(numberOfPoints);
+    std::uniform_real_distribution<> dist(0, 1);
+    std::vector<uint64_t> intervals(numberOfPoints);
+    for (auto const& parameter : parameters) {
+        // Assign the intervals to the points in random order
+        std::iota(intervals.begin(), intervals.end(), 0);
+        std::shuffle(intervals.begin(), intervals.end(), engine);
+        for (uint64_t i = 0; i < numberOfPoints; ++i) {
+            result[i][parameter] = utility::convertNumber<CoefficientType<FunctionType>>((intervals[i] + dist(engine)) / numberOfPoints);
+        }
+    }
+    return result;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::pair<typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation, ConstantType> multiStartGradientDescent(
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>>& searchers,
+    std::vector<typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation> const& startPoints,
+    storm::logic::Bound const& bound,
+    std::function<void(typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation const&, ConstantType const&)> const&
+        reportImprovement) {
+    typedef typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation Instantiation;
+    STORM_LOG_THROW(!searchers.empty(), storm::exceptions::IllegalArgumentException, "Expected at least one gradient descent searcher.");
+    STORM_LOG_THROW(searchers.size() == startPoints.size(), storm::exceptions::IllegalArgumentException,
+                    "Expected one start point for each of the " << searchers.size() << " gradient descent searchers, got " << startPoints.size() << ".");
+
+    // The state shared between the threads. Except for the flag, it is guarded by the mutex.
+    std::mutex mutex;
+    std::atomic<bool> feasibleInstantiationFound(false);
+    boost::optional<std::pair<Instantiation, ConstantType>> best;
+    std::exception_ptr exception;
+
+    auto improve = [&](Instantiation const& instantiation, ConstantType const& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!best || (bound.isLowerBound() ? value > best->second : value < best->second)) {
+            best = std::make_pair(instantiation, value);
+            if (reportImprovement) {
+                reportImprovement(instantiation, value);
+            }
+        }
+        if (bound.isSatisfied(value)) {
+            feasibleInstantiationFound = true;
+        }
+    };
+
+    for (uint64_t i = 0; i < searchers.size(); ++i) {
+        STORM_LOG_ASSERT(searchers[i], "Expected a gradient descent searcher for each thread.");
+        searchers[i]->setStartPoint(startPoints[i]);
+        searchers[i]->setStopCondition([&feasibleInstantiationFound]() { return feasibleInstantiationFound.load(); });
+        searchers[i]->setImprovementCallback(improve);
+    }
+
+    auto work = [&](GradientDescentInstantiationSearcher<FunctionType, ConstantType>& searcher) {
+        try {
+            searcher.gradientDescent();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+            feasibleInstantiationFound = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(searchers.size() - 1);
+    for (uint64_t i = 1; i < searchers.size(); ++i) {
+        threads.emplace_back(work, std::ref(*searchers[i]));
+    }
+    work(*searchers.front());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    STORM_LOG_ASSERT(best, "Expected that gradient descent found some instantiation.");
+    return best.get();
+}
+
+template std::vector<std::map<VariableType<RationalFunction>, CoefficientType<RationalFunction>>> createLatinHypercubeStartPoints<RationalFunction>(
+    std::set<VariableType<RationalFunction>> const& parameters, uint64_t numberOfPoints, std::default_random_engine& engine);
+template std::pair<GradientDescentInstantiationSearcher<RationalFunction, RationalNumber>::Instantiation, RationalNumber> multiStartGradientDescent(
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<RationalFunction, RationalNumber>>>& searchers,
+    std::vector<GradientDescentInstantiationSearcher<RationalFunction, RationalNumber>::Instantiation> const& startPoints, storm::logic::Bound const& bound,
+    std::function<void(GradientDescentInstantiationSearcher<RationalFunction, RationalNumber>::Instantiation const&, RationalNumber const&)> const&
+        reportImprovement);
+template std::pair<GradientDescentInstantiationSearcher<RationalFunction, double>::Instantiation, double> multiStartGradientDescent(
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<RationalFunction, double>>>& searchers,
+    std::vector<GradientDescentInstantiationSearcher<RationalFunction, double>::Instantiation> const& startPoints, storm::logic::Bound const& bound,
+    std::function<void(GradientDescentInstantiationSearcher<RationalFunction, double>::Instantiation const&, double const&)> const& reportImprovement);
+
+}  // namespace derivative
+}  // namespace storm
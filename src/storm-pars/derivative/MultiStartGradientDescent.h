@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
+#include "storm/logic/Bound.h"
+
+namespace storm {
+namespace derivative {
+
+/*!
+ * Creates points in the parameter space (0,1)^n by latin hypercube sampling, i.e., for each parameter, each of the numberOfPoints equally sized
+ * intervals of (0,1) contains the value of exactly one point.
+ */
+template<typename FunctionType>
+std::vector<std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>>
+createLatinHypercubeStartPoints(std::set<typename utility::parametric::VariableType<FunctionType>::type> const& parameters, uint64_t numberOfPoints,
+                                std::default_random_engine& engine);
+
+/*!
+ * Runs the gradient descent of each of the given searchers in its own thread, where the i-th searcher starts at the i-th start point.
+ * The searchers have to be set up for the same model and task beforehand (on the calling thread). Each searcher is only used by a single thread, the
+ * model is shared read-only. Once a thread found an instantiation that satisfies the bound, the other threads stop.
+ * @param bound the bound of the synthesis task
+ * @param reportImprovement if set, this is called whenever a thread found an instantiation that is better than all instantiations found before
+ * @return the best instantiation over all threads together with its value
+ */
+template<typename FunctionType, typename ConstantType>
+std::pair<typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation, ConstantType> multiStartGradientDescent(
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>>& searchers,
+    std::vector<typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation> const& startPoints,
+    storm::logic::Bound const& bound,
+    std::function<void(typename GradientDescentInstantiationSearcher<FunctionType, ConstantType>::Instantiation const&, ConstantType const&)> const&
+        reportImprovement = {});
+
+}  // namespace derivative
+}  // namespace storm
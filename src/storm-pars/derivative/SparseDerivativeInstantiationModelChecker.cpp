@@ -36,6 +36,83 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = getInterestingReachabilityProbabilities(env, valuation, valueVector);
+    instantiateEquationSystem(valuation);
+    std::vector<ConstantType> resultVec = computeDerivativeRightHandSide(valuation, parameter, interestingReachabilityProbabilities);
+
+    approximationWatch.start();
+    // Here's where the real magic happens - the solver call!
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+
+    // Calculate (1-M)^-1 * resultVec
+    solver->setMatrix(constrainedMatrixInstantiated);
+    std::vector<ConstantType> finalResult(resultVec.size());
+    solver->solveEquations(env, finalResult, resultVec);
+    approximationWatch.stop();
+
+    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(Environment const& env,
+                                                                             storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                             std::vector<VariableType<FunctionType>> const& parameters,
+                                                                             boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = getInterestingReachabilityProbabilities(env, valuation, valueVector);
+    instantiateEquationSystem(valuation);
+
+    // All derivatives share the matrix (1-M), so we set up a single solver and let it cache whatever it computes for the matrix.
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+    solver->setMatrix(constrainedMatrixInstantiated);
+    solver->setCachingEnabled(true);
+
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> results;
+    for (auto const& parameter : parameters) {
+        std::vector<ConstantType> resultVec = computeDerivativeRightHandSide(valuation, parameter, interestingReachabilityProbabilities);
+        approximationWatch.start();
+        std::vector<ConstantType> finalResult(resultVec.size());
+        solver->solveEquations(env, finalResult, resultVec);
+        approximationWatch.stop();
+        results[parameter] = std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(finalResult));
+    }
+    return results;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeGradientAtInitialState(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, std::vector<VariableType<FunctionType>> const& parameters,
+    boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = getInterestingReachabilityProbabilities(env, valuation, valueVector);
+    instantiateEquationSystem(valuation);
+
+    // The derivative w.r.t. parameter p is e_init^T * (1-M)^-1 * b_p, where b_p is the right-hand side for p.
+    // We therefore solve (1-M)^T * adjoint = e_init once and obtain each partial derivative as adjoint^T * b_p.
+    // Transposing the matrix preserves the problem format, i.e., (1-M)^T = 1-M^T for equation systems and M^T for fixpoint systems.
+    approximationWatch.start();
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+    solver->setMatrix(constrainedMatrixInstantiated.transpose());
+    std::vector<ConstantType> unitVector(constrainedMatrixInstantiated.getRowCount(), storm::utility::zero<ConstantType>());
+    unitVector[initialStateEqSystem] = storm::utility::one<ConstantType>();
+    std::vector<ConstantType> adjoint(unitVector.size());
+    solver->solveEquations(env, adjoint, unitVector);
+    approximationWatch.stop();
+
+    std::map<VariableType<FunctionType>, ConstantType> gradient;
+    for (auto const& parameter : parameters) {
+        std::vector<ConstantType> resultVec = computeDerivativeRightHandSide(valuation, parameter, interestingReachabilityProbabilities);
+        gradient[parameter] = storm::utility::vector::dotProduct(adjoint, resultVec);
+    }
+    return gradient;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::getInterestingReachabilityProbabilities(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+    boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -55,59 +132,52 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
-    // Instantiate the matrices with the given instantiation
+    return interestingReachabilityProbabilities;
+}
 
+template<typename FunctionType, typename ConstantType>
+void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::instantiateEquationSystem(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation) {
     instantiationWatch.start();
-
-    // STORM_PRINT_AND_LOG(valuation << "\n");
-
     // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
-
-    // Write the instantiated values to the matrices and vectors according to the stored mappings
+    // Write the instantiated values to the matrix according to the stored mapping
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+    instantiationWatch.stop();
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeDerivativeRightHandSide(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
+    std::vector<ConstantType> const& interestingReachabilityProbabilities) {
+    instantiationWatch.start();
+    for (auto& functionResult : this->functionsDerived.at(parameter)) {
+        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+    }
     for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+    // Note that the mapping points into the stored matrix, so we must not copy the matrix before writing the values.
+    auto const& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
     std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
     for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
         instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
     }
-
     instantiationWatch.stop();
 
     approximationWatch.start();
-
     std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
     deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
     for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
         resultVec[i] += instantiatedDerivedOutputVec[i];
     }
-
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
-
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
-
     approximationWatch.stop();
-
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+    return resultVec;
 }
 
 template<typename FunctionType, typename ConstantType>
@@ -170,7 +240,7 @@ void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::spec
         next &= avoid;
 
         storm::storage::BitVector atSomePointTarget =
-            storm::utility::graph::performProbGreater0(model.getBackwardTransitions(), storm::storage::BitVector(model.getNumberOfStates(), true), target);
+            storm::utility::graph::performProbGreater0(*model.getBackwardTransitions(), storm::storage::BitVector(model.getNumberOfStates(), true), target);
         next &= atSomePointTarget;
     } else {
         next = target;
@@ -180,7 +250,7 @@ void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::spec
         next &= avoid;
 
         storm::storage::BitVector targetProbOne =
-            storm::utility::graph::performProb1(model.getBackwardTransitions(), storm::storage::BitVector(model.getNumberOfStates(), true), target);
+            storm::utility::graph::performProb1(*model.getBackwardTransitions(), storm::storage::BitVector(model.getNumberOfStates(), true), target);
         next &= targetProbOne;
     }
 
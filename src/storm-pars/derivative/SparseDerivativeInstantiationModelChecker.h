@@ -47,6 +47,30 @@ class SparseDerivativeInstantiationModelChecker {
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
 
+    /**
+     * Calculates the derivatives of the model w.r.t. several parameters at an instantiation.
+     * The model is instantiated once and all derivatives are obtained from the same linear equation solver, so a factorization of the
+     * equation system (if the solver computes one and caching is possible) is shared by all parameters.
+     * Call specifyFormula first!
+     * @param env The environment.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+    check(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+          std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+          boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
+    /**
+     * Calculates the gradient of the value of the initial state w.r.t. the given parameters at an instantiation.
+     * This uses the adjoint method: A single equation system with the transposed matrix yields the sensitivity of the initial state w.r.t. the
+     * right-hand side, such that each partial derivative is a scalar product instead of a separate solver call.
+     * Call specifyFormula first!
+     * @param env The environment.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, ConstantType> computeGradientAtInitialState(
+        Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+        std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+        boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -84,6 +108,27 @@ class SparseDerivativeInstantiationModelChecker {
                                       std::unordered_map<FunctionType, ConstantType>& functions);
     void setup(Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask);
 
+    /**
+     * Retrieves the reachability probabilities (or expected rewards) of the states of the equation system, either from the given vector
+     * or by model checking the instantiated model.
+     */
+    std::vector<ConstantType> getInterestingReachabilityProbabilities(Environment const& env,
+                                                                      storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                      boost::optional<std::vector<ConstantType>> const& valueVector);
+
+    /**
+     * Instantiates the matrix of the equation system with the given valuation.
+     */
+    void instantiateEquationSystem(storm::utility::parametric::Valuation<FunctionType> const& valuation);
+
+    /**
+     * Computes the right-hand side of the equation system for the derivative w.r.t. the given parameter, i.e., the derivative of the matrix times the
+     * reachability probabilities plus the derivative of the output vector.
+     */
+    std::vector<ConstantType> computeDerivativeRightHandSide(storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                             typename utility::parametric::VariableType<FunctionType>::type const& parameter,
+                                                             std::vector<ConstantType> const& interestingReachabilityProbabilities);
+
     utility::Stopwatch instantiationWatch;
     utility::Stopwatch approximationWatch;
     utility::Stopwatch generalSetupWatch;
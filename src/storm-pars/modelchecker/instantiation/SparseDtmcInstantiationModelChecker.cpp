@@ -22,7 +22,23 @@ template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
     STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-    auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+    return checkInstantiatedModel(env, modelInstantiator.instantiate(valuation));
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+    STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+    std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+    modelInstantiator.instantiateBatch(valuations, [&](uint64_t valuation, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
+        results[valuation] = checkInstantiatedModel(env, instantiatedModel);
+    });
+    return results;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkInstantiatedModel(
+    Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel) {
     STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException,
                     "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
     storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
@@ -23,7 +23,15 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    /*!
+     * Checks the formula for each of the given valuations. The transition functions are evaluated for all valuations at once.
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
+
    protected:
+    std::unique_ptr<CheckResult> checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel);
+
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
         Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
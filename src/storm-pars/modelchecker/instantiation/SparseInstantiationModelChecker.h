@@ -26,6 +26,13 @@ class SparseInstantiationModelChecker {
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
 
+    /*!
+     * Checks the formula for each of the given valuations in the given order. As results of previous checks may be used as hints, consecutive valuations
+     * should be close to each other.
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
     // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
     // This bypasses the graph analysis for the different instantiations.
     void setInstantiationsAreGraphPreserving(bool value);
@@ -92,7 +92,7 @@ std::unique_ptr<CheckResult> SparseMdpInstantiationModelChecker<SparseModelType,
         // Check if there can be end components within the maybestates
         if (storm::solver::minimize(this->currentCheckTask->getOptimizationDirection()) ||
             storm::utility::graph::performProb1A(instantiatedModel.getTransitionMatrix(), instantiatedModel.getTransitionMatrix().getRowGroupIndices(),
-                                                 instantiatedModel.getBackwardTransitions(), hint.getMaybeStates(), ~hint.getMaybeStates())
+                                                 *instantiatedModel.getBackwardTransitions(), hint.getMaybeStates(), ~hint.getMaybeStates())
                 .full()) {
             hint.setNoEndComponentsInMaybeStates(true);
         }
@@ -162,7 +162,7 @@ std::unique_ptr<CheckResult> SparseMdpInstantiationModelChecker<SparseModelType,
         // Check if there can be end components within the maybestates
         if (storm::solver::maximize(this->currentCheckTask->getOptimizationDirection()) ||
             storm::utility::graph::performProb1A(instantiatedModel.getTransitionMatrix(), instantiatedModel.getTransitionMatrix().getRowGroupIndices(),
-                                                 instantiatedModel.getBackwardTransitions(), hint.getMaybeStates(), ~hint.getMaybeStates())
+                                                 *instantiatedModel.getBackwardTransitions(), hint.getMaybeStates(), ~hint.getMaybeStates())
                 .full()) {
             hint.setNoEndComponentsInMaybeStates(true);
         }
@@ -1,5 +1,10 @@
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <queue>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include "storm-pars/analysis/OrderExtender.h"
@@ -335,6 +340,134 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
 }
 
+template<typename ParametricType>
+std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(
+    Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+    boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis,
+    std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers) {
+    STORM_LOG_THROW(!useMonotonicity, storm::exceptions::NotSupportedException, "Parallel region refinement does not support monotonicity.");
+    STORM_LOG_INFO("Applying parallel refinement with " << (additionalCheckers.size() + 1) << " threads on region: " << region.toString(true) << " .");
+    // All threads collect their samples in the same index
+    for (auto const& checker : additionalCheckers) {
+        checker->setSampleIndex(sampleIndex);
+    }
+
+    auto thresholdAsCoefficient =
+        coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+    auto areaOfParameterSpace = region.area();
+    auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+
+    struct PendingRegion {
+        storm::storage::ParameterRegion<ParametricType> region;
+        RegionResult result;
+        uint64_t depth;
+        CoefficientType area;
+    };
+    // Larger regions are processed first. Among regions of equal size, those with a partially known result are closer to a conclusive result.
+    auto hasLowerPriority = [](PendingRegion const& lhs, PendingRegion const& rhs) {
+        if (lhs.area != rhs.area) {
+            return lhs.area < rhs.area;
+        }
+        return lhs.result == RegionResult::Unknown && rhs.result != RegionResult::Unknown;
+    };
+    std::priority_queue<PendingRegion, std::vector<PendingRegion>, decltype(hasLowerPriority)> unprocessedRegions(hasLowerPriority);
+    unprocessedRegions.push({region, RegionResult::Unknown, 0, areaOfParameterSpace});
+
+    // The state shared between the threads, guarded by the mutex.
+    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint64_t numberOfBusyThreads = 0;
+    uint_fast64_t numOfAnalyzedRegions = 0;
+    bool done = false;
+    std::exception_ptr exception;
+
+    auto work = [&](RegionModelChecker<ParametricType>& checker) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            // Wait for a region unless all regions are processed, which is the case if no thread can produce further regions.
+            condition.wait(lock, [&]() { return done || !unprocessedRegions.empty() || numberOfBusyThreads == 0; });
+            if (done || unprocessedRegions.empty()) {
+                break;
+            }
+            PendingRegion current = unprocessedRegions.top();
+            unprocessedRegions.pop();
+            ++numberOfBusyThreads;
+            lock.unlock();
+
+            std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+            try {
+                current.result = checker.analyzeRegion(env, current.region, hypothesis, current.result, false);
+                bool isConclusive = current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated;
+                if (!isConclusive && (!depthThreshold || current.depth < depthThreshold.get())) {
+                    current.region.split(current.region.getCenterPoint(), newRegions);
+                }
+            } catch (...) {
+                lock.lock();
+                exception = std::current_exception();
+                done = true;
+                --numberOfBusyThreads;
+                condition.notify_all();
+                break;
+            }
+
+            lock.lock();
+            --numberOfBusyThreads;
+            ++numOfAnalyzedRegions;
+            if (current.result == RegionResult::AllSat || current.result == RegionResult::AllViolated) {
+                fractionOfUndiscoveredArea -= current.area / areaOfParameterSpace;
+                result.emplace_back(std::move(current.region), current.result);
+            } else if (newRegions.empty()) {
+                // If the region is not further refined, it is still added to the result
+                result.emplace_back(std::move(current.region), current.result);
+            } else {
+                RegionResult initResForNewRegions =
+                    (current.result == RegionResult::CenterSat)
+                        ? RegionResult::ExistsSat
+                        : ((current.result == RegionResult::CenterViolated) ? RegionResult::ExistsViolated : RegionResult::Unknown);
+                for (auto& newRegion : newRegions) {
+                    CoefficientType area = newRegion.area();
+                    unprocessedRegions.push({std::move(newRegion), initResForNewRegions, current.depth + 1, std::move(area)});
+                }
+            }
+            if (fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
+                done = true;
+            }
+            STORM_LOG_INFO("Analyzed region #" << numOfAnalyzedRegions << " (Refinement depth " << current.depth << "; "
+                                               << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(additionalCheckers.size());
+    for (auto const& checker : additionalCheckers) {
+        STORM_LOG_ASSERT(checker, "Expected a region model checker for each thread.");
+        threads.emplace_back(work, std::ref(*checker));
+    }
+    work(*this);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    // Add the still unprocessed regions to the result
+    while (!unprocessedRegions.empty()) {
+        result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
+        unprocessedRegions.pop();
+    }
+
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+        STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions using " << (additionalCheckers.size() + 1) << " threads.\n");
+    }
+
+    auto regionCopyForResult = region;
+    return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+}
+
 template<typename ParametricType>
 void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(
     storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order,
@@ -439,6 +572,16 @@ void RegionModelChecker<ParametricType>::setMonotoneParameters(std::pair<std::se
     monotoneDecrParameters = std::move(monotoneParameters.second);
 }
 
+template<typename ParametricType>
+std::shared_ptr<storm::storage::ParameterSampleIndex<ParametricType>> const& RegionModelChecker<ParametricType>::getSampleIndex() const {
+    return sampleIndex;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setSampleIndex(std::shared_ptr<storm::storage::ParameterSampleIndex<ParametricType>> const& index) {
+    sampleIndex = index;
+}
+
 #ifdef STORM_HAVE_CARL
 template class RegionModelChecker<storm::RationalFunction>;
 #endif
@@ -10,6 +10,7 @@
 #include "storm-pars/modelchecker/results/RegionCheckResult.h"
 #include "storm-pars/modelchecker/results/RegionRefinementCheckResult.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/storage/ParameterSampleIndex.h"
 
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/models/ModelBase.h"
@@ -74,6 +75,18 @@ class RegionModelChecker {
         boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown,
         uint64_t monThresh = 0);
 
+    /*!
+     * Iteratively refines the region like performRegionRefinement, but analyzes regions concurrently.
+     * Each thread analyzes regions with its own region model checker: This checker and the given additional checkers, which must have been specified for
+     * the same model and check task. Pending regions are kept in a shared queue in which larger regions and regions with a partially known result come
+     * first. Monotonicity is not supported in this mode.
+     * @param additionalCheckers the region model checkers for the additional threads
+     */
+    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(
+        Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold,
+        boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis,
+        std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> const& additionalCheckers);
+
     // TODO return type is not quite nice
     // TODO consider returning v' as well
     /*!
@@ -133,6 +146,16 @@ class RegionModelChecker {
      */
     virtual void resetMaxSplitDimensions();
 
+    /*!
+     * Retrieves the index of the parameter valuations at which this checker instantiated the model so far (if the checker collects samples).
+     */
+    std::shared_ptr<storm::storage::ParameterSampleIndex<ParametricType>> const& getSampleIndex() const;
+
+    /*!
+     * Sets the index in which this checker collects its samples, e.g., to share the samples with other checkers for the same model and check task.
+     */
+    void setSampleIndex(std::shared_ptr<storm::storage::ParameterSampleIndex<ParametricType>> const& index);
+
     void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>,
                                          std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>>
                                    monotoneParameters);
@@ -146,6 +169,8 @@ class RegionModelChecker {
     uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneIncrParameters;
     boost::optional<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneDecrParameters;
+    // Samples of the property at parameter valuations. Regions containing a satisfying and a violating sample are classified without parameter lifting.
+    std::shared_ptr<storm::storage::ParameterSampleIndex<ParametricType>> sampleIndex;
 
     virtual void extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order,
                                                std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult);
@@ -124,7 +124,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
         std::move(propositionalChecker.check(checkTask.getFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
 
     // get the maybeStates
-    maybeStates = storm::utility::graph::performProbGreater0(this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound);
+    maybeStates = storm::utility::graph::performProbGreater0(*this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound);
     maybeStates &= ~psiStates;
 
     // set the result for all non-maybe states
@@ -148,7 +148,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
 
     // For monotonicity checking
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
     this->orderExtender = storm::analysis::OrderExtender<ValueType, ConstantType>(&statesWithProbability01.second, &statesWithProbability01.first,
                                                                                   this->parametricModel->getTransitionMatrix());
 }
@@ -168,7 +168,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
 
     // get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
     maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
 
     // set the result for all non-maybe states
@@ -212,7 +212,7 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
         std::move(propositionalChecker.check(checkTask.getFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
     // get the maybeStates
     storm::storage::BitVector infinityStates = storm::utility::graph::performProb1(
-        this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates);
+        *this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates);
     infinityStates.complement();
     maybeStates = ~(targetStates | infinityStates);
 
@@ -441,9 +441,15 @@ std::unique_ptr<CheckResult> SparseDtmcParameterLiftingModelChecker<SparseModelT
             solver->setTerminationCondition(std::move(termCond));
         }
 
-        // Invoke the solver
+        // Invoke the solver. We start from the previous solution for the same direction, which was computed for a region that is typically close to the
+        // current one (e.g. a sibling during refinement).
+        boost::optional<std::vector<ConstantType>>& previousX = storm::solver::minimize(dirForParameters) ? minX : maxX;
+        if (previousX) {
+            x = previousX.get();
+        }
         x.resize(maybeStates.getNumberOfSetBits(), storm::utility::zero<ConstantType>());
         solver->solveEquations(env, dirForParameters, x, parameterLifter->getVector());
+        previousX = x;
         if (storm::solver::minimize(dirForParameters)) {
             minSchedChoices = solver->getSchedulerChoices();
         } else {
@@ -550,6 +556,8 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::rese
     minSchedChoices = boost::none;
     maxSchedChoices = boost::none;
     x.clear();
+    minX = boost::none;
+    maxX = boost::none;
     lowerResultBound = boost::none;
     upperResultBound = boost::none;
     regionSplitEstimationsEnabled = false;
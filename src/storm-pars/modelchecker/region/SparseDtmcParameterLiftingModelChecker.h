@@ -90,6 +90,8 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     // Results from the most recent solver call.
     boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
     std::vector<ConstantType> x;
+    // The solutions of the most recent solver calls for each direction. Used as initial values for the next region.
+    boost::optional<std::vector<ConstantType>> minX, maxX;
     boost::optional<ConstantType> lowerResultBound, upperResultBound;
 
     bool regionSplitEstimationsEnabled;
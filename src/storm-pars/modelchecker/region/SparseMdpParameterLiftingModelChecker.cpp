@@ -116,8 +116,8 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
     maybeStates = storm::solver::minimize(checkTask.getOptimizationDirection())
                       ? storm::utility::graph::performProbGreater0A(this->parametricModel->getTransitionMatrix(),
                                                                     this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                                                                    this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound)
-                      : storm::utility::graph::performProbGreater0E(this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound);
+                                                                    *this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound)
+                      : storm::utility::graph::performProbGreater0E(*this->parametricModel->getBackwardTransitions(), phiStates, psiStates, true, *stepBound);
     maybeStates &= ~psiStates;
 
     // set the result for all non-maybe states
@@ -160,10 +160,10 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
         storm::solver::minimize(checkTask.getOptimizationDirection())
             ? storm::utility::graph::performProb01Min(this->parametricModel->getTransitionMatrix(),
                                                       this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                                                      this->parametricModel->getBackwardTransitions(), phiStates, psiStates)
+                                                      *this->parametricModel->getBackwardTransitions(), phiStates, psiStates)
             : storm::utility::graph::performProb01Max(this->parametricModel->getTransitionMatrix(),
                                                       this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                                                      this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
+                                                      *this->parametricModel->getBackwardTransitions(), phiStates, psiStates);
     maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
 
     // set the result for all non-maybe states
@@ -185,7 +185,7 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
             storm::solver::minimize(checkTask.getOptimizationDirection()) ||  // when minimizing, there can not be an EC within the maybestates
             storm::utility::graph::performProb1A(this->parametricModel->getTransitionMatrix(),
                                                  this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                                                 this->parametricModel->getBackwardTransitions(), maybeStates, ~maybeStates)
+                                                 *this->parametricModel->getBackwardTransitions(), maybeStates, ~maybeStates)
                 .full();
     }
 
@@ -209,10 +209,10 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
         storm::solver::minimize(checkTask.getOptimizationDirection())
             ? storm::utility::graph::performProb1E(
                   this->parametricModel->getTransitionMatrix(), this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                  this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates)
+                  *this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates)
             : storm::utility::graph::performProb1A(
                   this->parametricModel->getTransitionMatrix(), this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                  this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates);
+                  *this->parametricModel->getBackwardTransitions(), storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true), targetStates);
     infinityStates.complement();
     maybeStates = ~(targetStates | infinityStates);
 
@@ -246,7 +246,7 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
             !storm::solver::minimize(checkTask.getOptimizationDirection()) ||  // when maximizing, there can not be an EC within the maybestates
             storm::utility::graph::performProb1A(this->parametricModel->getTransitionMatrix(),
                                                  this->parametricModel->getTransitionMatrix().getRowGroupIndices(),
-                                                 this->parametricModel->getBackwardTransitions(), maybeStates, ~maybeStates)
+                                                 *this->parametricModel->getBackwardTransitions(), maybeStates, ~maybeStates)
                 .full();
     }
 
@@ -29,6 +29,8 @@ template<typename SparseModelType, typename ConstantType>
 void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyFormula(
     Environment const& env, storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
     currentFormula = checkTask.getFormula().asSharedPointer();
+    // Samples for a previous formula are meaningless for the new one
+    this->sampleIndex = std::make_shared<storm::storage::ParameterSampleIndex<typename SparseModelType::ValueType>>();
     currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(
         checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
 
@@ -74,11 +76,11 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
 
     // Check if we need to check the formula on one point to decide whether to show AllSat or AllViolated
     if (hypothesis == RegionResultHypothesis::Unknown && result == RegionResult::Unknown) {
-        result = getInstantiationChecker()
-                         .check(env, region.getCenterPoint())
-                         ->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]
-                     ? RegionResult::CenterSat
-                     : RegionResult::CenterViolated;
+        auto centerPoint = region.getCenterPoint();
+        bool centerSat =
+            getInstantiationChecker().check(env, centerPoint)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()];
+        addSample(centerPoint, centerSat);
+        result = centerSat ? RegionResult::CenterSat : RegionResult::CenterViolated;
     }
 
     bool existsSat = (hypothesis == RegionResultHypothesis::AllSat || result == RegionResult::ExistsSat || result == RegionResult::CenterSat);
@@ -121,18 +123,14 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
             }
 
             // Check for result
-            if (existsSat && getInstantiationCheckerSAT()
-                                 .check(env, valuationToCheckSat)
-                                 ->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+            if (existsSat && checkSample(env, valuationToCheckSat, getInstantiationCheckerSAT())) {
                 STORM_LOG_INFO("Region " << region << " is AllSat, discovered with instantiation checker on " << valuationToCheckSat
                                          << " and help of monotonicity\n");
                 RegionModelChecker<typename SparseModelType::ValueType>::numberOfRegionsKnownThroughMonotonicity++;
                 return RegionResult::AllSat;
             }
 
-            if (existsViolated && !getInstantiationCheckerVIO()
-                                       .check(env, valuationToCheckViolated)
-                                       ->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+            if (existsViolated && !checkSample(env, valuationToCheckViolated, getInstantiationCheckerVIO())) {
                 STORM_LOG_INFO("Region " << region << " is AllViolated, discovered with instantiation checker on " << valuationToCheckViolated
                                          << " and help of monotonicity\n");
                 RegionModelChecker<typename SparseModelType::ValueType>::numberOfRegionsKnownThroughMonotonicity++;
@@ -143,6 +141,23 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
         }
     }
 
+    // Samples found while analyzing other regions might already show that parameter lifting cannot yield AllSat or AllViolated
+    if (this->sampleIndex) {
+        bool hasSatSample = result == RegionResult::ExistsSat || result == RegionResult::CenterSat || this->sampleIndex->containsSample(region, true);
+        bool hasViolatedSample =
+            result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated || this->sampleIndex->containsSample(region, false);
+        if (hasSatSample && hasViolatedSample) {
+            STORM_LOG_INFO("Region " << region << " is ExistsBoth, discovered with previously computed samples.");
+            return RegionResult::ExistsBoth;
+        } else if (existsSat && hasViolatedSample) {
+            // The hypothesis AllSat is refuted
+            return RegionResult::ExistsViolated;
+        } else if (!existsSat && hasSatSample) {
+            // The hypothesis AllViolated is refuted
+            return RegionResult::ExistsSat;
+        }
+    }
+
     // Try to prove AllSat or AllViolated, depending on the hypothesis or the current result
     if (existsSat) {
         // show AllSat:
@@ -188,7 +203,7 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
     auto vertices = region.getVerticesOfRegion(region.getVariables());
     auto vertexIt = vertices.begin();
     while (vertexIt != vertices.end() && !(hasSatPoint && hasViolatedPoint)) {
-        if (getInstantiationChecker().check(env, *vertexIt)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+        if (checkSample(env, *vertexIt, getInstantiationChecker())) {
             hasSatPoint = true;
         } else {
             hasViolatedPoint = true;
@@ -209,6 +224,23 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
     return result;
 }
 
+template<typename SparseModelType, typename ConstantType>
+bool SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::checkSample(
+    Environment const& env, typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::Valuation const& valuation,
+    storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& instantiationChecker) {
+    bool satisfied = instantiationChecker.check(env, valuation)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()];
+    addSample(valuation, satisfied);
+    return satisfied;
+}
+
+template<typename SparseModelType, typename ConstantType>
+void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::addSample(
+    typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::Valuation const& valuation, bool satisfied) {
+    if (this->sampleIndex) {
+        this->sampleIndex->insert(valuation, satisfied);
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region,
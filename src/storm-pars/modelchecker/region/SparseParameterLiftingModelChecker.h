@@ -102,13 +102,22 @@ class SparseParameterLiftingModelChecker : public RegionModelChecker<typename Sp
     virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerSAT();
     virtual storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationCheckerVIO();
 
+    /*!
+     * Checks the property at the given valuation with the given instantiation checker and adds the outcome to the sample index.
+     * @return true iff the property is satisfied in the initial state
+     */
+    bool checkSample(Environment const& env, typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::Valuation const& valuation,
+                     storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>& instantiationChecker);
+    void addSample(typename storm::storage::ParameterRegion<typename SparseModelType::ValueType>::Valuation const& valuation, bool satisfied);
+
     virtual std::unique_ptr<CheckResult> computeQuantitativeValues(
         Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region,
         storm::solver::OptimizationDirection const& dirForParameters,
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>>
             localMonotonicityResult = nullptr) = 0;
 
-    std::shared_ptr<SparseModelType> parametricModel;
+    // Only accessed via const references so that the backward transitions cached by the model remain valid.
+    std::shared_ptr<SparseModelType const> parametricModel;
     std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
     ConstantType lastValue;
     boost::optional<storm::analysis::OrderExtender<typename SparseModelType::ValueType, ConstantType>> orderExtender;
@@ -27,6 +27,7 @@ const std::string DerivativeSettings::printJson = "print-json";
 const std::string DerivativeSettings::gradientDescentMethod = "descent-method";
 const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
 const std::string DerivativeSettings::constraintMethod = "constraint-method";
+const std::string DerivativeSettings::parallelStarts = "parallel-starts";
 
 DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false,
@@ -84,6 +85,14 @@ DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("project-gradient")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelStarts, false,
+                                                   "Runs this many gradient descents in parallel threads that start at a latin hypercube sample of the "
+                                                   "parameter space. All threads stop once one of them found a feasible instantiation.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -104,6 +113,9 @@ double DerivativeSettings::getLearningRate() const {
 uint_fast64_t DerivativeSettings::getMiniBatchSize() const {
     return this->getOption(miniBatchSize).getArgumentByName(miniBatchSize).getValueAsInteger();
 }
+uint_fast64_t DerivativeSettings::getNumberOfParallelStarts() const {
+    return this->getOption(parallelStarts).getArgumentByName("count").getValueAsUnsignedInteger();
+}
 double DerivativeSettings::getAverageDecay() const {
     return this->getOption(adamParams).getArgumentByName(averageDecay).getValueAsDouble();
 }
@@ -41,6 +41,11 @@ class DerivativeSettings : public ModuleSettings {
      */
     uint_fast64_t getMiniBatchSize() const;
 
+    /*!
+     * Retrieves the number of gradient descents that run in parallel threads.
+     */
+    uint_fast64_t getNumberOfParallelStarts() const;
+
     /*!
      * Retrieves the decay of the decaying step average of the ADAM algorithm.
      */
@@ -102,6 +107,7 @@ class DerivativeSettings : public ModuleSettings {
     const static std::string gradientDescentMethod;
     const static std::string omitInconsequentialParams;
     const static std::string constraintMethod;
+    const static std::string parallelStarts;
     boost::optional<derivative::GradientDescentMethod> methodFromString(const std::string &str) const;
     boost::optional<derivative::GradientDescentConstraintMethod> constraintMethodFromString(const std::string &str) const;
 };
@@ -36,6 +36,11 @@ class PartitionSettings : public ModuleSettings {
      */
     bool isPrintFullResultSet() const;
 
+    /*!
+     * Retrieves the number of threads that concurrently analyze regions during refinement.
+     */
+    uint64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 };
 }  // namespace storm::settings::modules
@@ -228,12 +228,12 @@ std::string ParameterRegion<ParametricType>::toString(bool boundariesAsDouble) c
 }
 
 template<typename ParametricType>
-bool ParameterRegion<ParametricType>::isSubRegion(ParameterRegion<ParametricType> subRegion) {
+bool ParameterRegion<ParametricType>::isSubRegion(ParameterRegion<ParametricType> const& subRegion) const {
     auto varsRegion = getVariables();
     auto varsSubRegion = subRegion.getVariables();
     for (auto var : varsRegion) {
         if (std::find(varsSubRegion.begin(), varsSubRegion.end(), var) != varsSubRegion.end()) {
-            if (getLowerBoundary(var) > subRegion.getLowerBoundary(var) || getUpperBoundary(var) < getUpperBoundary(var)) {
+            if (getLowerBoundary(var) > subRegion.getLowerBoundary(var) || getUpperBoundary(var) < subRegion.getUpperBoundary(var)) {
                 return false;
             }
         } else {
@@ -0,0 +1,109 @@
+#include "storm-pars/storage/ParameterSampleIndex.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ParametricType>
+void ParameterSampleIndex<ParametricType>::insert(Valuation const& valuation, bool satisfied) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (nodes.empty()) {
+        variables.clear();
+        for (auto const& entry : valuation) {
+            variables.insert(entry.first);
+        }
+    }
+    if (variables.empty() || valuation.size() != variables.size()) {
+        return;
+    }
+    std::vector<CoefficientType> point;
+    point.reserve(variables.size());
+    for (auto const& variable : variables) {
+        auto valuationIt = valuation.find(variable);
+        if (valuationIt == valuation.end()) {
+            return;
+        }
+        point.push_back(valuationIt->second);
+    }
+
+    if (nodes.empty()) {
+        nodes.push_back({std::move(point), satisfied, satisfied, !satisfied, 0, 0});
+        return;
+    }
+    uint64_t currentNode = 0;
+    uint64_t depth = 0;
+    while (true) {
+        Node& node = nodes[currentNode];
+        if (node.point == point) {
+            // The sample is already known
+            return;
+        }
+        node.subtreeHasSatisfied |= satisfied;
+        node.subtreeHasViolated |= !satisfied;
+        uint64_t axis = depth % point.size();
+        uint64_t& child = point[axis] < node.point[axis] ? node.left : node.right;
+        if (child == 0) {
+            child = nodes.size();
+            // Note that the reference to the child is invalidated by this call
+            nodes.push_back({std::move(point), satisfied, satisfied, !satisfied, 0, 0});
+            return;
+        }
+        currentNode = child;
+        ++depth;
+    }
+}
+
+template<typename ParametricType>
+bool ParameterSampleIndex<ParametricType>::containsSample(ParameterRegion<ParametricType> const& region, bool satisfied) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (nodes.empty() || region.getVariables() != variables) {
+        return false;
+    }
+    std::vector<CoefficientType> lower, upper;
+    for (auto const& variable : variables) {
+        lower.push_back(region.getLowerBoundary(variable));
+        upper.push_back(region.getUpperBoundary(variable));
+    }
+
+    // Depth-first search that skips subtrees outside of the region or without a sample with the requested outcome
+    std::vector<std::pair<uint64_t, uint64_t>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        auto [currentNode, depth] = stack.back();
+        stack.pop_back();
+        Node const& node = nodes[currentNode];
+        if (!(satisfied ? node.subtreeHasSatisfied : node.subtreeHasViolated)) {
+            continue;
+        }
+        if (node.satisfied == satisfied) {
+            bool isInRegion = true;
+            for (uint64_t i = 0; isInRegion && i < node.point.size(); ++i) {
+                isInRegion = lower[i] <= node.point[i] && node.point[i] <= upper[i];
+            }
+            if (isInRegion) {
+                return true;
+            }
+        }
+        uint64_t axis = depth % node.point.size();
+        if (node.left != 0 && lower[axis] < node.point[axis]) {
+            stack.emplace_back(node.left, depth + 1);
+        }
+        if (node.right != 0 && node.point[axis] <= upper[axis]) {
+            stack.emplace_back(node.right, depth + 1);
+        }
+    }
+    return false;
+}
+
+template<typename ParametricType>
+uint64_t ParameterSampleIndex<ParametricType>::getNumberOfSamples() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return nodes.size();
+}
+
+#ifdef STORM_HAVE_CARL
+template class ParameterSampleIndex<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "storm-pars/storage/ParameterRegion.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Stores parameter valuations at which the property has been checked together with the outcome (satisfied or violated).
+ * The samples are organized in a k-d tree such that it can be decided quickly whether a region contains a satisfying or a violating sample.
+ * All methods are thread-safe, which allows several region model checkers to share the index.
+ */
+template<typename ParametricType>
+class ParameterSampleIndex {
+   public:
+    typedef typename ParameterRegion<ParametricType>::VariableType VariableType;
+    typedef typename ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+    typedef typename ParameterRegion<ParametricType>::Valuation Valuation;
+
+    /*!
+     * Adds the given sample. The variables of the first sample determine the parameter space of the index, samples over other variables are ignored.
+     * @param satisfied whether the property is satisfied at the given valuation
+     */
+    void insert(Valuation const& valuation, bool satisfied);
+
+    /*!
+     * Returns true iff a sample with the given outcome lies in the given (closed) region.
+     */
+    bool containsSample(ParameterRegion<ParametricType> const& region, bool satisfied) const;
+
+    uint64_t getNumberOfSamples() const;
+
+   private:
+    struct Node {
+        std::vector<CoefficientType> point;
+        bool satisfied;
+        // Whether the subtree rooted at this node contains a satisfying (violating) sample
+        bool subtreeHasSatisfied;
+        bool subtreeHasViolated;
+        // Indices of the children in the node vector (0 if there is no such child as the root is never a child)
+        uint64_t left;
+        uint64_t right;
+    };
+
+    mutable std::mutex mutex;
+    std::set<VariableType> variables;
+    // The root (if any) is the first node. Nodes in the left (right) subtree of a node at depth d have a smaller (greater or equal) d-th coordinate.
+    std::vector<Node> nodes;
+};
+
+}  // namespace storage
+}  // namespace storm
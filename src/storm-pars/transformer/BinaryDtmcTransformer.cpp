@@ -41,28 +41,19 @@ typename BinaryDtmcTransformer::TransformationData BinaryDtmcTransformer::transf
     storm::models::sparse::Dtmc<RationalFunction> const& dtmc) const {
     auto const& matrix = dtmc.getTransitionMatrix();
 
-    // Initialize a FIFO Queue that stores the start and the end of each row
+    // The rows of the original states are transformed in place, only the rows of the new auxiliary states are stored in a FIFO queue.
+    // This avoids copying the whole matrix.
     std::queue<StateWithRow> queue;
-    for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
-        std::vector<storage::MatrixEntry<uint64_t, RationalFunction>> diyRow;
-        for (auto const& entry : matrix.getRow(state)) {
-            diyRow.push_back(entry);
-        }
-        queue.emplace(StateWithRow{state, diyRow});
-    }
-
     storm::storage::SparseMatrixBuilder<RationalFunction> builder;
     uint64_t currRow = 0;
-    uint64_t currAuxState = queue.size();
+    uint64_t currAuxState = matrix.getRowCount();
     std::vector<uint64_t> origStates;
+    origStates.reserve(matrix.getRowCount());
 
-    while (!queue.empty()) {
-        auto stateWithRow = std::move(queue.front());
-        queue.pop();
-
+    auto transformRow = [&](uint64_t state, auto const& row) {
         std::set<RationalFunctionVariable> variablesInRow;
 
-        for (auto const& entry : stateWithRow.row) {
+        for (auto const& entry : row) {
             for (auto const& variable : entry.getValue().gatherVariables()) {
                 variablesInRow.emplace(variable);
             }
@@ -70,7 +61,7 @@ typename BinaryDtmcTransformer::TransformationData BinaryDtmcTransformer::transf
 
         if (variablesInRow.size() == 0) {
             // Insert the row directly
-            for (auto const& entry : stateWithRow.row) {
+            for (auto const& entry : row) {
                 builder.addNextValue(currRow, entry.getColumn(), entry.getValue());
             }
             ++currRow;
@@ -88,7 +79,7 @@ typename BinaryDtmcTransformer::TransformationData BinaryDtmcTransformer::transf
             RationalFunction sumOfLeftBranch;
             RationalFunction sumOfRightBranch;
 
-            for (auto const& entry : stateWithRow.row) {
+            for (auto const& entry : row) {
                 if (entry.getValue().isConstant()) {
                     outgoing.push_back(entry);
                 }
@@ -119,11 +110,11 @@ typename BinaryDtmcTransformer::TransformationData BinaryDtmcTransformer::transf
                 entry.setValue(entry.getValue() / sumOfRightBranch);
             }
 
-            queue.push(StateWithRow{currAuxState, newStateLeft});
+            queue.push(StateWithRow{currAuxState, std::move(newStateLeft)});
             outgoing.push_back(storage::MatrixEntry<uint64_t, RationalFunction>(
                 currAuxState, (sumOfLeftBranch)*RationalFunction(carl::makePolynomial<Polynomial>(parameter))));
             ++currAuxState;
-            queue.push(StateWithRow{currAuxState, newStateRight});
+            queue.push(StateWithRow{currAuxState, std::move(newStateRight)});
             outgoing.push_back(storage::MatrixEntry<uint64_t, RationalFunction>(
                 currAuxState, (sumOfRightBranch) * (utility::one<RationalFunction>() - RationalFunction(carl::makePolynomial<Polynomial>(parameter)))));
             ++currAuxState;
@@ -135,7 +126,16 @@ typename BinaryDtmcTransformer::TransformationData BinaryDtmcTransformer::transf
         } else {
             STORM_LOG_ERROR("More than one variable in row " << currRow << "!");
         }
-        origStates.push_back(stateWithRow.state);
+        origStates.push_back(state);
+    };
+
+    for (uint64_t state = 0; state < matrix.getRowCount(); ++state) {
+        transformRow(state, matrix.getRow(state));
+    }
+    while (!queue.empty()) {
+        auto stateWithRow = std::move(queue.front());
+        queue.pop();
+        transformRow(stateWithRow.state, stateWithRow.row);
     }
     TransformationData result;
     result.simpleMatrix = builder.build(currRow, currAuxState, currAuxState);
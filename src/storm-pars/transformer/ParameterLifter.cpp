@@ -36,7 +36,10 @@ ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::S
     uint_fast64_t newRowIndex = 0;
     for (auto const& rowIndex : selectedRows) {
         builder.newRowGroup(newRowIndex);
+        uint_fast64_t const rowGroup = rowGroupToStateNumber.size();
         rowGroupToStateNumber.push_back(rowIndex);
+        matrixAssignmentOffsets.push_back(matrixAssignment.size());
+        vectorAssignmentOffsets.push_back(vectorAssignment.size());
 
         // Gather the occurring variables within this row and set which entries are non-constant
         std::set<VariableType> occurringVariables;
@@ -66,6 +69,14 @@ ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::S
             nonConstVectorEntries.set(pVectorEntryCount, true);
         }
         ++pVectorEntryCount;
+        for (auto const& var : occurringVariables) {
+            rowGroupsAtVariable[var].push_back(rowGroup);
+        }
+        for (auto const& var : vectorEntryVariables) {
+            if (occurringVariables.count(var) == 0) {
+                rowGroupsAtVariable[var].push_back(rowGroup);
+            }
+        }
         // Compute the (abstract) valuation for each row
         auto rowValuations = getVerticesOfAbstractRegion(occurringVariables);
         for (auto const& val : rowValuations) {
@@ -118,6 +129,9 @@ ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::S
         }
     }
 
+    matrixAssignmentOffsets.push_back(matrixAssignment.size());
+    vectorAssignmentOffsets.push_back(vectorAssignment.size());
+
     // Matrix and vector are now filled with constant results from constant functions and place holders for non-constant functions.
     matrix = builder.build(newRowIndex);
     vector.shrink_to_fit();
@@ -156,11 +170,47 @@ ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::S
 template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region,
                                                                   storm::solver::OptimizationDirection const& dirForParameters) {
-    // write the evaluation result of each function,evaluation pair into the placeholders
-    functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
+    // Find the variables whose boundaries changed since the last call. Everything else is still up to date.
+    bool updateAll = !lastRegion || lastDirForParameters != dirForParameters || lastRegion->getVariables() != region.getVariables();
+    std::set<VariableType> changedVariables;
+    if (!updateAll) {
+        for (auto const& var : region.getVariables()) {
+            if (region.getLowerBoundary(var) != lastRegion->getLowerBoundary(var) || region.getUpperBoundary(var) != lastRegion->getUpperBoundary(var)) {
+                changedVariables.insert(var);
+            }
+        }
+    }
+    lastRegion = region;
+    lastDirForParameters = dirForParameters;
+
+    if (updateAll) {
+        // write the evaluation result of each function,evaluation pair into the placeholders
+        functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
+        // apply the matrix and vector assignments to write the contents of the placeholder into the matrix/vector
+        for (uint_fast64_t rowGroup = 0; rowGroup < rowGroupToStateNumber.size(); ++rowGroup) {
+            applyAssignments(rowGroup, region);
+        }
+    } else if (!changedVariables.empty()) {
+        functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters, changedVariables);
+        storm::storage::BitVector affectedRowGroups(rowGroupToStateNumber.size(), false);
+        for (auto const& var : changedVariables) {
+            auto rowGroupsIt = rowGroupsAtVariable.find(var);
+            if (rowGroupsIt != rowGroupsAtVariable.end()) {
+                for (auto const& rowGroup : rowGroupsIt->second) {
+                    affectedRowGroups.set(rowGroup);
+                }
+            }
+        }
+        for (auto const& rowGroup : affectedRowGroups) {
+            applyAssignments(rowGroup, region);
+        }
+    }
+}
 
-    // apply the matrix and vector assignments to write the contents of the placeholder into the matrix/vector
-    for (auto& assignment : matrixAssignment) {
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::applyAssignments(uint_fast64_t rowGroup, storm::storage::ParameterRegion<ParametricType> const& region) {
+    for (uint_fast64_t index = matrixAssignmentOffsets[rowGroup]; index < matrixAssignmentOffsets[rowGroup + 1]; ++index) {
+        auto& assignment = matrixAssignment[index];
         STORM_LOG_WARN_COND(
             !storm::utility::isZero(assignment.second),
             "Parameter lifting on region "
@@ -168,9 +218,8 @@ void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage
                 << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
         assignment.first->setValue(assignment.second);
     }
-
-    for (auto& assignment : vectorAssignment) {
-        *assignment.first = assignment.second;
+    for (uint_fast64_t index = vectorAssignmentOffsets[rowGroup]; index < vectorAssignmentOffsets[rowGroup + 1]; ++index) {
+        *vectorAssignment[index].first = vectorAssignment[index].second;
     }
 }
 
@@ -350,23 +399,50 @@ template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
     storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
     for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
-        ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
+        collectedFunctionValuationPlaceholder.second = evaluate(collectedFunctionValuationPlaceholder.first, region, dirForUnspecifiedParameters);
+    }
+}
+
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
+    storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters,
+    std::set<VariableType> const& changedVariables) {
+    for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+        // The abstract valuation specifies exactly the variables that occur in the function
         AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-        ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
-        auto concreteValuations = abstrValuation.getConcreteValuations(region);
-        auto concreteValuationIt = concreteValuations.begin();
-        placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-        for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-            ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-            if (storm::solver::minimize(dirForUnspecifiedParameters)) {
-                placeholder = std::min(placeholder, currentResult);
-            } else {
-                placeholder = std::max(placeholder, currentResult);
+        bool isAffected = false;
+        for (auto const& var : changedVariables) {
+            if (abstrValuation.getLowerParameters().count(var) > 0 || abstrValuation.getUpperParameters().count(var) > 0 ||
+                abstrValuation.getUnspecifiedParameters().count(var) > 0) {
+                isAffected = true;
+                break;
             }
         }
+        if (isAffected) {
+            collectedFunctionValuationPlaceholder.second = evaluate(collectedFunctionValuationPlaceholder.first, region, dirForUnspecifiedParameters);
+        }
     }
 }
 
+template<typename ParametricType, typename ConstantType>
+ConstantType ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluate(
+    FunctionValuation const& functionValuation, storm::storage::ParameterRegion<ParametricType> const& region,
+    storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) const {
+    ParametricType const& function = functionValuation.first;
+    auto concreteValuations = functionValuation.second.getConcreteValuations(region);
+    auto concreteValuationIt = concreteValuations.begin();
+    ConstantType result = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+    for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
+        ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+        if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+            result = std::min(result, currentResult);
+        } else {
+            result = std::max(result, currentResult);
+        }
+    }
+    return result;
+}
+
 template class ParameterLifter<storm::RationalFunction, double>;
 template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
 }  // namespace transformer
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <vector>
@@ -26,6 +27,9 @@ namespace transformer {
  * the parameter is directly set such that the vector entry is maximized (or minimized, depending on the specified optimization direction).
  *
  * @note The row grouping of the original matrix is ignored.
+ *
+ * Consecutive calls of specifyRegion are incremental: Only the functions and rows that depend on a parameter whose boundaries differ from the previously
+ * specified region are updated. This makes checking a region cheap if it differs from the previous one in only a few parameters, e.g., during refinement.
  */
 template<typename ParametricType, typename ConstantType>
 class ParameterLifter {
@@ -45,6 +49,12 @@ class ParameterLifter {
                     storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels = false,
                     bool useMonotonicity = false);
 
+    /*!
+     * Specifies the region for the parameterlifter, i.e., writes the evaluations at the vertices of the region into the matrix and the vector.
+     * Only the entries that depend on parameters whose boundaries differ from the previously specified region are updated.
+     * @param region the region
+     * @param dirForParameters the optimization direction (for parameters that only occur in the vector)
+     */
     void specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
 
     /*!
@@ -141,6 +151,13 @@ class ParameterLifter {
         void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
                                         storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
 
+        /*!
+         * Only evaluates the collected functions that depend on at least one of the given variables.
+         */
+        void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
+                                        storm::solver::OptimizationDirection const& dirForUnspecifiedParameters,
+                                        std::set<VariableType> const& changedVariables);
+
        private:
         // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
         typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
@@ -155,10 +172,18 @@ class ParameterLifter {
             }
         };
 
+        ConstantType evaluate(FunctionValuation const& functionValuation, storm::storage::ParameterRegion<ParametricType> const& region,
+                              storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) const;
+
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
     };
 
+    /*!
+     * Writes the contents of the placeholders of the given row group into the matrix and the vector.
+     */
+    void applyAssignments(uint_fast64_t rowGroup, storm::storage::ParameterRegion<ParametricType> const& region);
+
     FunctionValuationCollector functionValuationCollector;
 
     // Returns the 2^(variables.size()) vertices of the region
@@ -176,6 +201,14 @@ class ParameterLifter {
     std::vector<ConstantType> vector;                                                                      // The resulting vector
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>> vectorAssignment;  // Connection of vector entries with placeholders
 
+    // The assignments of row group g are [matrixAssignmentOffsets[g], matrixAssignmentOffsets[g+1]) (and similarly for the vector)
+    std::vector<uint_fast64_t> matrixAssignmentOffsets, vectorAssignmentOffsets;
+    // For each variable the row groups whose matrix entries or vector entry depend on it. Used for incremental updates.
+    std::map<VariableType, std::vector<uint_fast64_t>> rowGroupsAtVariable;
+    // The most recently specified region and direction
+    std::optional<storm::storage::ParameterRegion<ParametricType>> lastRegion;
+    storm::solver::OptimizationDirection lastDirForParameters;
+
     // Used for monotonicity in sparsedtmcparameterlifter
     std::vector<std::set<VariableType>> occurringVariablesAtState;
     std::map<VariableType, std::set<uint_fast64_t>> occuringStatesAtVariable;
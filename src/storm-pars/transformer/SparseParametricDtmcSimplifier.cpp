@@ -103,7 +103,7 @@ bool SparseParametricDtmcSimplifier<SparseModelType>::simplifyForBoundedUntilPro
                                                         ->asExplicitQualitativeCheckResult()
                                                         .getTruthValuesVector());
     storm::storage::BitVector probGreater0States =
-        storm::utility::graph::performProbGreater0(this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound);
+        storm::utility::graph::performProbGreater0(*this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound);
 
     // Only consider the maybestates that are reachable from one initial probGreater0 state within the given amount of steps and without hopping over a target
     // state
@@ -154,10 +154,10 @@ bool SparseParametricDtmcSimplifier<SparseModelType>::simplifyForReachabilityRew
     storm::storage::BitVector targetStates = std::move(
         propositionalChecker.check(formula.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
     // The set of target states can be extended by the states that reach target with probability 1 without collecting any reward
-    targetStates = storm::utility::graph::performProb1(this->originalModel.getBackwardTransitions(),
+    targetStates = storm::utility::graph::performProb1(*this->originalModel.getBackwardTransitions(),
                                                        originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), targetStates);
     storm::storage::BitVector statesWithProb1 = storm::utility::graph::performProb1(
-        this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true), targetStates);
+        *this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true), targetStates);
     storm::storage::BitVector infinityStates = ~statesWithProb1;
     // Only consider the states that are reachable from an initial state without hopping over a target state
     storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(
@@ -216,7 +216,7 @@ bool SparseParametricDtmcSimplifier<SparseModelType>::simplifyForCumulativeRewar
 
     // Get the states with non-zero reward
     storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
-        this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
+        *this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
         ~originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), true, stepBound);
     storm::storage::BitVector zeroRewardStates = ~maybeStates;
     storm::storage::BitVector noStates(this->originalModel.getNumberOfStates(), false);
@@ -129,8 +129,8 @@ bool SparseParametricMdpSimplifier<SparseModelType>::simplifyForBoundedUntilProb
     storm::storage::BitVector probGreater0States =
         minimizing ? storm::utility::graph::performProbGreater0A(this->originalModel.getTransitionMatrix(),
                                                                  this->originalModel.getTransitionMatrix().getRowGroupIndices(),
-                                                                 this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound)
-                   : storm::utility::graph::performProbGreater0E(this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound);
+                                                                 *this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound)
+                   : storm::utility::graph::performProbGreater0E(*this->originalModel.getBackwardTransitions(), phiStates, psiStates, true, upperStepBound);
 
     // Only consider the maybestates that are reachable from one initial probGreater0 state within the given amount of steps and without hopping over a target
     // state
@@ -186,14 +186,14 @@ bool SparseParametricMdpSimplifier<SparseModelType>::simplifyForReachabilityRewa
     // The set of target states can be extended by the states that reach target with probability 1 without collecting any reward
     // TODO for the call of Prob1E we could restrict the analysis to actions with zero reward instead of states with zero reward
     targetStates =
-        minimizing ? storm::utility::graph::performProb1E(this->originalModel, this->originalModel.getBackwardTransitions(),
+        minimizing ? storm::utility::graph::performProb1E(this->originalModel, *this->originalModel.getBackwardTransitions(),
                                                           originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), targetStates)
-                   : storm::utility::graph::performProb1A(this->originalModel, this->originalModel.getBackwardTransitions(),
+                   : storm::utility::graph::performProb1A(this->originalModel, *this->originalModel.getBackwardTransitions(),
                                                           originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), targetStates);
     storm::storage::BitVector statesWithProb1 =
-        minimizing ? storm::utility::graph::performProb1E(this->originalModel, this->originalModel.getBackwardTransitions(),
+        minimizing ? storm::utility::graph::performProb1E(this->originalModel, *this->originalModel.getBackwardTransitions(),
                                                           storm::storage::BitVector(this->originalModel.getNumberOfStates(), true), targetStates)
-                   : storm::utility::graph::performProb1A(this->originalModel, this->originalModel.getBackwardTransitions(),
+                   : storm::utility::graph::performProb1A(this->originalModel, *this->originalModel.getBackwardTransitions(),
                                                           storm::storage::BitVector(this->originalModel.getNumberOfStates(), true), targetStates);
     storm::storage::BitVector infinityStates = ~statesWithProb1;
     // Only consider the states that are reachable from an initial state without hopping over a target state
@@ -273,10 +273,10 @@ bool SparseParametricMdpSimplifier<SparseModelType>::simplifyForCumulativeReward
     storm::storage::BitVector maybeStates =
         minimizing ? storm::utility::graph::performProbGreater0A(
                          this->originalModel.getTransitionMatrix(), this->originalModel.getTransitionMatrix().getRowGroupIndices(),
-                         this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
+                         *this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
                          ~originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), true, stepBound)
                    : storm::utility::graph::performProbGreater0E(
-                         this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
+                         *this->originalModel.getBackwardTransitions(), storm::storage::BitVector(this->originalModel.getNumberOfStates(), true),
                          ~originalRewardModel.getStatesWithZeroReward(this->originalModel.getTransitionMatrix()), true, stepBound);
     storm::storage::BitVector zeroRewardStates = ~maybeStates;
     storm::storage::BitVector noStates(this->originalModel.getNumberOfStates(), false);
@@ -77,7 +77,6 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
     std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>> treeStates;
     std::map<RationalFunctionVariable, std::set<uint64_t>> workingSets;
 
-    auto backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
     // Count number of parameter occurences per state
     for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
         for (auto const& entry : flexibleMatrix.getRow(row)) {
@@ -214,38 +213,35 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                 directProbs[entry.getColumn()] = entry.getValue();
             }
 
-            // TODO slow could be done better if flexible matrix had ability to add states
-            uint64_t newMatrixSize = flexibleMatrix.getRowCount() + 3 * parameterBuckets.size();
+            // The new states are appended to the matrix
+            uint64_t const oldMatrixSize = flexibleMatrix.getRowCount();
+            uint64_t newMatrixSize = oldMatrixSize + 3 * parameterBuckets.size();
             if (parameterBuckets.count(constantVariable)) {
                 newMatrixSize -= 2;
             }
-            storage::SparseMatrixBuilder<RationalFunction> builder;
-            storage::FlexibleSparseMatrix<RationalFunction> matrixWithAdditionalStates(builder.build(newMatrixSize, newMatrixSize, 0));
-            for (uint64_t row = 0; row < flexibleMatrix.getRowCount(); row++) {
-                matrixWithAdditionalStates.getRow(row) = flexibleMatrix.getRow(row);
-            }
+            flexibleMatrix.appendEmptyRowsAndColumns(newMatrixSize - oldMatrixSize);
 
             workingSets.clear();
 
-            uint64_t newStateIndex = flexibleMatrix.getRowCount();
-            matrixWithAdditionalStates.getRow(state).clear();
+            uint64_t newStateIndex = oldMatrixSize;
+            flexibleMatrix.getRow(state).clear();
             for (auto const& entry : parameterBuckets) {
-                matrixWithAdditionalStates.getRow(state).push_back(
+                flexibleMatrix.getRow(state).push_back(
                     storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex, cumulativeProbabilities.at(entry.first)));
                 STORM_LOG_INFO("Reorder: " << state << " -> " << newStateIndex);
 
                 if (entry.first == constantVariable) {
                     for (auto const& successor : entry.second) {
-                        matrixWithAdditionalStates.getRow(newStateIndex)
+                        flexibleMatrix.getRow(newStateIndex)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(successor,
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
                     }
                     // Issue: multiple transitions can go to a single state, not allowed
                     // Solution: Join them
-                    matrixWithAdditionalStates.getRow(newStateIndex) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex));
+                    flexibleMatrix.getRow(newStateIndex) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex));
 
                     workingSets[entry.first].emplace(newStateIndex);
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
@@ -253,9 +249,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
 
                     newStateIndex += 1;
                 } else {
-                    matrixWithAdditionalStates.getRow(newStateIndex)
+                    flexibleMatrix.getRow(newStateIndex)
                         .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex + 1, pRationalFunctions.at(entry.first)));
-                    matrixWithAdditionalStates.getRow(newStateIndex)
+                    flexibleMatrix.getRow(newStateIndex)
                         .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(newStateIndex + 2, oneMinusPRationalFunctions.at(entry.first)));
 
                     for (auto const& successor : entry.second) {
@@ -268,29 +264,29 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                         // If it's still needed, re-count it
                         workingSets[entry.first].emplace(successor);
 
-                        matrixWithAdditionalStates.getRow(newStateIndex + 1)
+                        flexibleMatrix.getRow(newStateIndex + 1)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(pTransitions.at(successor),
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
-                        matrixWithAdditionalStates.getRow(newStateIndex + 2)
+                        flexibleMatrix.getRow(newStateIndex + 2)
                             .push_back(storage::MatrixEntry<uint64_t, RationalFunction>(oneMinusPTransitions.at(successor),
                                                                                         directProbs.at(successor) / cumulativeProbabilities.at(entry.first)));
                     }
                     // Issue: multiple transitions can go to a single state, not allowed
                     // Solution: Join them
-                    matrixWithAdditionalStates.getRow(newStateIndex + 1) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex + 1));
-                    matrixWithAdditionalStates.getRow(newStateIndex + 2) = joinDuplicateTransitions(matrixWithAdditionalStates.getRow(newStateIndex + 2));
+                    flexibleMatrix.getRow(newStateIndex + 1) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex + 1));
+                    flexibleMatrix.getRow(newStateIndex + 2) = joinDuplicateTransitions(flexibleMatrix.getRow(newStateIndex + 2));
 
                     treeStates[entry.first][newStateIndex].emplace(newStateIndex);
                     workingSets[entry.first].emplace(newStateIndex);
                     workingSets[entry.first].emplace(newStateIndex + 1);
                     workingSets[entry.first].emplace(newStateIndex + 2);
 
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex + 1)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex + 1)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
                     }
-                    for (auto const& entry : matrixWithAdditionalStates.getRow(newStateIndex + 2)) {
+                    for (auto const& entry : flexibleMatrix.getRow(newStateIndex + 2)) {
                         for (auto const& parameter : allParameters) {
                             workingSets[parameter].emplace(entry.getColumn());
                         }
@@ -301,10 +297,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
             }
 
             // Extend labeling to more states
-            models::sparse::StateLabeling nextNewLabels =
-                extendStateLabeling(runningLabeling, flexibleMatrix.getRowCount(), newMatrixSize, state, labelsInFormula);
+            models::sparse::StateLabeling nextNewLabels = extendStateLabeling(runningLabeling, oldMatrixSize, newMatrixSize, state, labelsInFormula);
 
-            for (uint64_t i = flexibleMatrix.getRowCount(); i < newMatrixSize; i++) {
+            for (uint64_t i = oldMatrixSize; i < newMatrixSize; i++) {
                 // Next consider the new states
                 topologicalOrderingStack.push(i);
                 // New states have zero reward
@@ -312,12 +307,9 @@ models::sparse::Dtmc<RationalFunction> TimeTravelling::timeTravel(models::sparse
                     stateRewardVector->push_back(storm::utility::zero<RationalFunction>());
                 }
             }
-            runningLabeling = nextNewLabels;
-
-            updateTreeStates(treeStates, workingSets, matrixWithAdditionalStates, allParameters, stateRewardVector, runningLabeling, labelsInFormula);
+            runningLabeling = std::move(nextNewLabels);
 
-            flexibleMatrix = matrixWithAdditionalStates;
-            backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
+            updateTreeStates(treeStates, workingSets, flexibleMatrix, allParameters, stateRewardVector, runningLabeling, labelsInFormula);
         }
     }
 
@@ -399,32 +391,25 @@ std::vector<storm::storage::MatrixEntry<uint64_t, RationalFunction>> TimeTravell
 }
 
 models::sparse::StateLabeling TimeTravelling::extendStateLabeling(models::sparse::StateLabeling const& oldLabeling, uint64_t oldSize, uint64_t newSize,
-                                                                  uint64_t stateWithLabels, const std::set<std::string> labelsInFormula) {
+                                                                  uint64_t stateWithLabels, std::set<std::string> const& labelsInFormula) {
     models::sparse::StateLabeling newLabels(newSize);
     for (auto const& label : oldLabeling.getLabels()) {
-        newLabels.addLabel(label);
-    }
-    for (uint64_t state = 0; state < oldSize; state++) {
-        for (auto const& label : oldLabeling.getLabelsOfState(state)) {
-            newLabels.addLabelToState(label, state);
-        }
-    }
-    for (uint64_t i = oldSize; i < newSize; i++) {
+        storage::BitVector states = oldLabeling.getStates(label);
+        states.resize(newSize, false);
         // We assume that everything that we time-travel has the same labels for now.
-        for (auto const& label : oldLabeling.getLabelsOfState(stateWithLabels)) {
-            if (labelsInFormula.count(label)) {
-                newLabels.addLabelToState(label, i);
+        if (labelsInFormula.count(label) && states.get(stateWithLabels)) {
+            for (uint64_t i = oldSize; i < newSize; i++) {
+                states.set(i, true);
             }
         }
+        newLabels.addLabel(label, std::move(states));
     }
     return newLabels;
 }
 
-bool labelsIntersectedEqual(const std::set<std::string>& labels1, const std::set<std::string>& labels2, const std::set<std::string>& intersection) {
+bool labelsIntersectedEqual(models::sparse::StateLabeling const& labeling, uint64_t state1, uint64_t state2, std::set<std::string> const& intersection) {
     for (auto const& label : intersection) {
-        bool set1ContainsLabel = labels1.count(label) > 0;
-        bool set2ContainsLabel = labels2.count(label) > 0;
-        if (set1ContainsLabel != set2ContainsLabel) {
+        if (labeling.containsLabel(label) && labeling.getStateHasLabel(label, state1) != labeling.getStateHasLabel(label, state2)) {
             return false;
         }
     }
@@ -435,7 +420,7 @@ void TimeTravelling::updateTreeStates(std::map<RationalFunctionVariable, std::ma
                                       std::map<RationalFunctionVariable, std::set<uint64_t>>& workingSets,
                                       storage::FlexibleSparseMatrix<RationalFunction>& flexibleMatrix, const std::set<carl::Variable>& allParameters,
                                       const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                      const models::sparse::StateLabeling stateLabeling, const std::set<std::string> labelsInFormula) {
+                                      models::sparse::StateLabeling const& stateLabeling, std::set<std::string> const& labelsInFormula) {
     auto backwardsTransitions = flexibleMatrix.createSparseMatrix().transpose(true);
     for (auto const& parameter : allParameters) {
         std::set<uint64_t> workingSet = workingSets[parameter];
@@ -447,7 +432,7 @@ void TimeTravelling::updateTreeStates(std::map<RationalFunctionVariable, std::ma
                 }
                 for (auto const& entry : backwardsTransitions.getRow(row)) {
                     if (entry.getValue().isConstant() &&
-                        labelsIntersectedEqual(stateLabeling.getLabelsOfState(entry.getColumn()), stateLabeling.getLabelsOfState(row), labelsInFormula)) {
+                        labelsIntersectedEqual(stateLabeling, entry.getColumn(), row, labelsInFormula)) {
                         // If the set of tree states at the current position is a subset of the set of
                         // tree states of the parent state, we've reached some loop. Then we can stop.
                         bool isSubset = true;
@@ -477,7 +462,7 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
                                                  const std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                                                  const std::set<carl::Variable>& allParameters,
                                                  const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                                 const models::sparse::StateLabeling stateLabeling, const std::set<std::string> labelsInFormula) {
+                                                 models::sparse::StateLabeling const& stateLabeling, std::set<std::string> const& labelsInFormula) {
     auto copiedRow = matrix.getRow(state);
     bool firstIteration = true;
     for (auto const& entry : copiedRow) {
@@ -493,7 +478,7 @@ bool TimeTravelling::collapseConstantTransitions(uint64_t state, storage::Flexib
         bool continueConvertingHere;
         if (stateRewardVector && !stateRewardVector->at(entry.getColumn()).isZero()) {
             continueConvertingHere = false;
-        } else if (!labelsIntersectedEqual(stateLabeling.getLabelsOfState(state), stateLabeling.getLabelsOfState(nextState), labelsInFormula)) {
+        } else if (!labelsIntersectedEqual(stateLabeling, state, nextState, labelsInFormula)) {
             continueConvertingHere = false;
         } else {
             if (alreadyVisited.count(nextState)) {
@@ -47,7 +47,7 @@ class TimeTravelling {
     void updateTreeStates(std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                           std::map<RationalFunctionVariable, std::set<uint64_t>>& workingSets, storage::FlexibleSparseMatrix<RationalFunction>& flexibleMatrix,
                           const std::set<carl::Variable>& allParameters, const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                          const models::sparse::StateLabeling stateLabelling, const std::set<std::string> labelsInFormula);
+                          models::sparse::StateLabeling const& stateLabelling, std::set<std::string> const& labelsInFormula);
 
     /**
      * extendStateLabeling extends the given state labeling to newly created states. It will set the new labels to the labels on the given state.
@@ -60,7 +60,7 @@ class TimeTravelling {
      * @return models::sparse::StateLabeling
      */
     models::sparse::StateLabeling extendStateLabeling(models::sparse::StateLabeling const& oldLabeling, uint64_t oldSize, uint64_t newSize,
-                                                      uint64_t stateWithLabels, const std::set<std::string> labelsInFormula);
+                                                      uint64_t stateWithLabels, std::set<std::string> const& labelsInFormula);
     /**
      * Sums duplicate transitions in a vector of MatrixEntries into one MatrixEntry.
      *
@@ -87,7 +87,7 @@ class TimeTravelling {
     bool collapseConstantTransitions(uint64_t state, storage::FlexibleSparseMatrix<RationalFunction>& matrix, std::map<uint64_t, bool>& alreadyVisited,
                                      const std::map<RationalFunctionVariable, std::map<uint64_t, std::set<uint64_t>>>& treeStates,
                                      const std::set<carl::Variable>& allParameters, const boost::optional<std::vector<RationalFunction>>& stateRewardVector,
-                                     const models::sparse::StateLabeling stateLabelling, const std::set<std::string> labelsInFormula);
+                                     models::sparse::StateLabeling const& stateLabelling, std::set<std::string> const& labelsInFormula);
 };
 
 }  // namespace transformer
@@ -0,0 +1,115 @@
+#include "storm-pars/utility/BatchFunctionEvaluator.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+BatchFunctionEvaluator::BatchFunctionEvaluator(std::vector<storm::RationalFunction> const& functions) {
+    monomials.push_back({0, 0});
+    monomialIndices.emplace(std::vector<uint64_t>(), 0);
+    polynomialOffsets.push_back(0);
+    for (auto const& function : functions) {
+        if (function.isConstant()) {
+            terms.push_back({0, storm::utility::convertNumber<double>(function.constantPart())});
+            polynomialOffsets.push_back(terms.size());
+            terms.push_back({0, 1.0});
+        } else {
+            addPolynomial(function.nominatorAsPolynomial().polynomialWithCoefficient());
+            polynomialOffsets.push_back(terms.size());
+            addPolynomial(function.denominatorAsPolynomial().polynomialWithCoefficient());
+        }
+        polynomialOffsets.push_back(terms.size());
+    }
+}
+
+uint64_t BatchFunctionEvaluator::getNumberOfFunctions() const {
+    return (polynomialOffsets.size() - 1) / 2;
+}
+
+uint64_t BatchFunctionEvaluator::getOrAddMonomial(std::vector<uint64_t> const& variableSequence) {
+    auto monomialIt = monomialIndices.find(variableSequence);
+    if (monomialIt != monomialIndices.end()) {
+        return monomialIt->second;
+    }
+    // Parents are created before their children, so monomials can be evaluated in the order of their indices.
+    uint64_t parent = getOrAddMonomial(std::vector<uint64_t>(variableSequence.begin(), variableSequence.end() - 1));
+    uint64_t index = monomials.size();
+    monomials.push_back({parent, variableSequence.back()});
+    monomialIndices.emplace(variableSequence, index);
+    return index;
+}
+
+void BatchFunctionEvaluator::addPolynomial(storm::RawPolynomial const& polynomial) {
+    for (auto const& term : polynomial) {
+        std::vector<uint64_t> variableSequence;
+        if (!term.isConstant()) {
+            for (auto const& variableWithExponent : *term.monomial()) {
+                auto [variableIt, isNewVariable] = variableIndices.emplace(variableWithExponent.first, variables.size());
+                if (isNewVariable) {
+                    variables.push_back(variableWithExponent.first);
+                }
+                variableSequence.insert(variableSequence.end(), variableWithExponent.second, variableIt->second);
+            }
+            std::sort(variableSequence.begin(), variableSequence.end());
+        }
+        terms.push_back({getOrAddMonomial(variableSequence), storm::utility::convertNumber<double>(term.coeff())});
+    }
+}
+
+void BatchFunctionEvaluator::evaluate(std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations,
+                                      std::vector<double>& result) const {
+    uint64_t const batchSize = valuations.size();
+    result.assign(getNumberOfFunctions() * batchSize, 0.0);
+    if (batchSize == 0) {
+        return;
+    }
+
+    std::vector<double> variableValues(variables.size() * batchSize);
+    for (uint64_t variable = 0; variable < variables.size(); ++variable) {
+        for (uint64_t point = 0; point < batchSize; ++point) {
+            auto valueIt = valuations[point].find(variables[variable]);
+            STORM_LOG_THROW(valueIt != valuations[point].end(), storm::exceptions::InvalidArgumentException,
+                            "The valuation does not assign a value to variable " << variables[variable] << ".");
+            variableValues[variable * batchSize + point] = storm::utility::convertNumber<double>(valueIt->second);
+        }
+    }
+
+    std::vector<double> monomialValues(monomials.size() * batchSize);
+    std::fill_n(monomialValues.begin(), batchSize, 1.0);
+    for (uint64_t monomial = 1; monomial < monomials.size(); ++monomial) {
+        double* target = monomialValues.data() + monomial * batchSize;
+        double const* parentValues = monomialValues.data() + monomials[monomial].parent * batchSize;
+        double const* factors = variableValues.data() + monomials[monomial].variable * batchSize;
+        for (uint64_t point = 0; point < batchSize; ++point) {
+            target[point] = parentValues[point] * factors[point];
+        }
+    }
+
+    auto addTerms = [&](uint64_t begin, uint64_t end, double* target) {
+        for (uint64_t term = begin; term < end; ++term) {
+            double const coefficient = terms[term].coefficient;
+            double const* values = monomialValues.data() + terms[term].monomial * batchSize;
+            for (uint64_t point = 0; point < batchSize; ++point) {
+                target[point] += coefficient * values[point];
+            }
+        }
+    };
+    std::vector<double> denominator(batchSize);
+    for (uint64_t function = 0; function < getNumberOfFunctions(); ++function) {
+        double* numerator = result.data() + function * batchSize;
+        addTerms(polynomialOffsets[2 * function], polynomialOffsets[2 * function + 1], numerator);
+        std::fill(denominator.begin(), denominator.end(), 0.0);
+        addTerms(polynomialOffsets[2 * function + 1], polynomialOffsets[2 * function + 2], denominator.data());
+        for (uint64_t point = 0; point < batchSize; ++point) {
+            numerator[point] /= denominator[point];
+        }
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Evaluates a fixed set of rational functions for many valuations at once (in double precision).
+ * The functions are compiled into a flat program: Every monomial that occurs in some numerator or denominator is computed from a shared monomial with
+ * one variable less, i.e., with a single multiplication per valuation, and each polynomial is a list of coefficients over these monomials.
+ * Evaluation proceeds monomial by monomial and term by term over the whole batch of valuations, which are stored contiguously so that the inner
+ * loops can be vectorized.
+ */
+class BatchFunctionEvaluator {
+   public:
+    /*!
+     * Compiles the given functions.
+     */
+    explicit BatchFunctionEvaluator(std::vector<storm::RationalFunction> const& functions);
+
+    uint64_t getNumberOfFunctions() const;
+
+    /*!
+     * Evaluates all functions for the given valuations. The value of function f for valuation v is stored at index f * valuations.size() + v of the result.
+     * Each valuation has to assign a value to every variable that occurs in the functions.
+     */
+    void evaluate(std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations, std::vector<double>& result) const;
+
+   private:
+    /*!
+     * Retrieves the index of the monomial that is the product of the given variables (with repetitions, in ascending order) and creates it if necessary.
+     */
+    uint64_t getOrAddMonomial(std::vector<uint64_t> const& variableSequence);
+
+    /*!
+     * Adds the terms of the given polynomial.
+     */
+    void addPolynomial(storm::RawPolynomial const& polynomial);
+
+    struct Monomial {
+        // The monomial is the product of the parent monomial and the variable.
+        uint64_t parent;
+        uint64_t variable;
+    };
+    struct Term {
+        uint64_t monomial;
+        double coefficient;
+    };
+
+    std::vector<storm::RationalFunctionVariable> variables;
+    std::map<storm::RationalFunctionVariable, uint64_t> variableIndices;
+    // The first monomial is the constant one.
+    std::vector<Monomial> monomials;
+    std::map<std::vector<uint64_t>, uint64_t> monomialIndices;
+    std::vector<Term> terms;
+    // The terms of the numerator of function f are [polynomialOffsets[2f], polynomialOffsets[2f+1]), those of its denominator are
+    // [polynomialOffsets[2f+1], polynomialOffsets[2f+2]).
+    std::vector<uint64_t> polynomialOffsets;
+};
+
+}  // namespace utility
+}  // namespace storm
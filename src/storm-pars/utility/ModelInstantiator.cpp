@@ -1,7 +1,10 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/utility/BatchFunctionEvaluator.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace utility {
@@ -10,22 +13,22 @@ template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel) {
     // Now pre-compute the information for the equation system.
     initializeModelSpecificData(parametricModel);
-    initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
+    initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), parametricModel.getTransitionMatrix());
 
     for (auto& rewModel : this->instantiatedModel->getRewardModels()) {
         if (rewModel.second.hasStateRewards()) {
-            initializeVectorMapping(rewModel.second.getStateRewardVector(), this->functions, this->vectorMapping,
-                                    parametricModel.getRewardModel(rewModel.first).getStateRewardVector());
+            initializeVectorMapping(rewModel.second.getStateRewardVector(), parametricModel.getRewardModel(rewModel.first).getStateRewardVector());
         }
         if (rewModel.second.hasStateActionRewards()) {
-            initializeVectorMapping(rewModel.second.getStateActionRewardVector(), this->functions, this->vectorMapping,
-                                    parametricModel.getRewardModel(rewModel.first).getStateActionRewardVector());
+            initializeVectorMapping(rewModel.second.getStateActionRewardVector(), parametricModel.getRewardModel(rewModel.first).getStateActionRewardVector());
         }
         if (rewModel.second.hasTransitionRewards()) {
-            initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), this->functions, this->matrixMapping,
-                                    parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
+            initializeMatrixMapping(rewModel.second.getTransitionRewardMatrix(), parametricModel.getRewardModel(rewModel.first).getTransitionRewardMatrix());
         }
     }
+    // The numbers of the functions are not needed anymore
+    functionIds = std::unordered_map<ParametricType, uint32_t>();
+    functionValues.resize(functions.size(), storm::utility::one<ConstantType>());
 }
 
 template<typename ParametricSparseModelType, typename ConstantType>
@@ -89,12 +92,24 @@ ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::buildDumm
     return result;
 }
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+uint32_t ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getFunctionId(ParametricType const& function) {
+    auto functionIdIt = functionIds.find(function);
+    if (functionIdIt != functionIds.end()) {
+        return functionIdIt->second;
+    }
+    STORM_LOG_THROW(functions.size() < noFunction, storm::exceptions::NotSupportedException, "The model has too many distinct functions.");
+    uint32_t id = functions.size();
+    functions.push_back(function);
+    functionIds.emplace(function, id);
+    return id;
+}
+
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeMatrixMapping(
-    storm::storage::SparseMatrix<ConstantType>& constantMatrix, std::unordered_map<ParametricType, ConstantType>& functions,
-    std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
-    storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const {
-    ConstantType dummyValue = storm::utility::one<ConstantType>();
+    storm::storage::SparseMatrix<ConstantType>& constantMatrix, storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) {
+    std::vector<uint32_t> entryFunctions;
+    entryFunctions.reserve(parametricMatrix.getEntryCount());
     auto constantEntryIt = constantMatrix.begin();
     auto parametricEntryIt = parametricMatrix.begin();
     while (parametricEntryIt != parametricMatrix.end()) {
@@ -103,40 +118,38 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
         if (storm::utility::isConstant(parametricEntryIt->getValue())) {
             // Constant entries can be inserted directly
             constantEntryIt->setValue(storm::utility::convertNumber<ConstantType>(parametricEntryIt->getValue()));
+            entryFunctions.push_back(noFunction);
         } else {
-            // insert the new function and store that the current constantMatrix entry needs to be set to the value of this function
-            auto functionsIt = functions.insert(std::make_pair(parametricEntryIt->getValue(), dummyValue)).first;
-            mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-            // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+            // store that the current constantMatrix entry needs to be set to the value of this function
+            entryFunctions.push_back(getFunctionId(parametricEntryIt->getValue()));
         }
         ++constantEntryIt;
         ++parametricEntryIt;
     }
     STORM_LOG_ASSERT(constantEntryIt == constantMatrix.end(), "Parametric matrix seems to have more or less entries then the constant matrix");
     constantMatrix.updateNonzeroEntryCount();
+    matrixMapping.emplace_back(&constantMatrix, std::move(entryFunctions));
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeVectorMapping(
-    std::vector<ConstantType>& constantVector, std::unordered_map<ParametricType, ConstantType>& functions,
-    std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping, std::vector<ParametricType> const& parametricVector) const {
-    ConstantType dummyValue = storm::utility::one<ConstantType>();
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeVectorMapping(std::vector<ConstantType>& constantVector,
+                                                                                                    std::vector<ParametricType> const& parametricVector) {
+    STORM_LOG_ASSERT(constantVector.size() == parametricVector.size(), "Parametric vector seems to have more or less entries then the constant vector");
+    std::vector<uint32_t> entryFunctions;
+    entryFunctions.reserve(parametricVector.size());
     auto constantEntryIt = constantVector.begin();
-    auto parametricEntryIt = parametricVector.begin();
-    while (parametricEntryIt != parametricVector.end()) {
-        if (storm::utility::isConstant(storm::utility::simplify(*parametricEntryIt))) {
+    for (auto const& parametricEntry : parametricVector) {
+        if (storm::utility::isConstant(storm::utility::simplify(parametricEntry))) {
             // Constant entries can be inserted directly
-            *constantEntryIt = storm::utility::convertNumber<ConstantType>(*parametricEntryIt);
+            *constantEntryIt = storm::utility::convertNumber<ConstantType>(parametricEntry);
+            entryFunctions.push_back(noFunction);
         } else {
-            // insert the new function and store that the current constantVector entry needs to be set to the value of this function
-            auto functionsIt = functions.insert(std::make_pair(*parametricEntryIt, dummyValue)).first;
-            mapping.emplace_back(std::make_pair(constantEntryIt, &(functionsIt->second)));
-            // Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+            // store that the current constantVector entry needs to be set to the value of this function
+            entryFunctions.push_back(getFunctionId(parametricEntry));
         }
         ++constantEntryIt;
-        ++parametricEntryIt;
     }
-    STORM_LOG_ASSERT(constantEntryIt == constantVector.end(), "Parametric vector seems to have more or less entries then the constant vector");
+    vectorMapping.emplace_back(&constantVector, std::move(entryFunctions));
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
@@ -144,16 +157,53 @@ ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, Cons
     storm::utility::parametric::Valuation<ParametricType> const& valuation) {
     // Write results into the placeholders
     instantiate_helper(valuation);
+    writeInstantiatedValues();
+    return *this->instantiatedModel;
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateBatch(
+    std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+    std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback) {
+    if constexpr (std::is_same<ConstantType, double>::value) {
+        if (!batchEvaluator) {
+            batchEvaluator = std::make_unique<BatchFunctionEvaluator>(this->functions);
+        }
+        std::vector<double> batchValues;
+        batchEvaluator->evaluate(valuations, batchValues);
+        for (uint64_t valuation = 0; valuation < valuations.size(); ++valuation) {
+            for (uint64_t function = 0; function < this->functions.size(); ++function) {
+                this->functionValues[function] = batchValues[function * valuations.size() + valuation];
+            }
+            writeInstantiatedValues();
+            callback(valuation, *this->instantiatedModel);
+        }
+    } else {
+        for (uint64_t valuation = 0; valuation < valuations.size(); ++valuation) {
+            callback(valuation, instantiate(valuations[valuation]));
+        }
+    }
+}
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::writeInstantiatedValues() {
     // Write the instantiated values to the matrices and vectors according to the stored mappings
-    for (auto& entryValuePair : this->matrixMapping) {
-        entryValuePair.first->setValue(*(entryValuePair.second));
+    for (auto& [constantMatrix, entryFunctions] : this->matrixMapping) {
+        auto entryFunctionIt = entryFunctions.begin();
+        for (auto& entry : *constantMatrix) {
+            if (*entryFunctionIt != noFunction) {
+                entry.setValue(this->functionValues[*entryFunctionIt]);
+            }
+            ++entryFunctionIt;
+        }
     }
-    for (auto& entryValuePair : this->vectorMapping) {
-        *(entryValuePair.first) = *(entryValuePair.second);
+    for (auto& [constantVector, entryFunctions] : this->vectorMapping) {
+        for (uint64_t entry = 0; entry < entryFunctions.size(); ++entry) {
+            if (entryFunctions[entry] != noFunction) {
+                (*constantVector)[entry] = this->functionValues[entryFunctions[entry]];
+            }
+        }
     }
-
-    return *this->instantiatedModel;
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
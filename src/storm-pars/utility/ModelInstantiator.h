@@ -1,6 +1,9 @@
 #ifndef STORM_UTILITY_MODELINSTANTIATOR_H
 #define STORM_UTILITY_MODELINSTANTIATOR_H
 
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -16,10 +19,13 @@
 namespace storm {
 namespace utility {
 
+class BatchFunctionEvaluator;
+
 /*!
  * This class allows efficient instantiation of the given parametric model.
  * The key to efficiency is to evaluate every distinct transition- (or reward-) function only once
  * instead of evaluating the same function for each occurrence in the model.
+ * To this end, the distinct functions are numbered and every entry of the instantiated model only stores the (32-bit) number of its function.
  */
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 class ModelInstantiator {
@@ -47,6 +53,14 @@ class ModelInstantiator {
      */
     ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
 
+    /*!
+     * Instantiates the model for each of the given valuations (one after another) and invokes the callback with the index of the valuation and the
+     * instantiated model. If the model is instantiated with doubles, the occurring functions are evaluated for all valuations at once (see
+     * BatchFunctionEvaluator).
+     */
+    void instantiateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+                          std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback);
+
     /*!
      *  Check validity
      */
@@ -82,7 +96,7 @@ class ModelInstantiator {
         components.choiceLabeling = parametricModel.getOptionalChoiceLabeling();
         this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
 
-        initializeVectorMapping(this->instantiatedModel->getExitRateVector(), this->functions, this->vectorMapping, parametricModel.getExitRateVector());
+        initializeVectorMapping(this->instantiatedModel->getExitRateVector(), parametricModel.getExitRateVector());
     }
 
     template<typename PMT = ParametricSparseModelType>
@@ -97,7 +111,7 @@ class ModelInstantiator {
         components.choiceLabeling = parametricModel.getOptionalChoiceLabeling();
         this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
 
-        initializeVectorMapping(this->instantiatedModel->getExitRates(), this->functions, this->vectorMapping, parametricModel.getExitRates());
+        initializeVectorMapping(this->instantiatedModel->getExitRates(), parametricModel.getExitRates());
     }
 
     template<typename PMT = ParametricSparseModelType>
@@ -116,19 +130,25 @@ class ModelInstantiator {
     template<typename PMT = ParametricSparseModelType>
     typename std::enable_if<std::is_same<PMT, ConstantSparseModelType>::value>::type instantiate_helper(
         storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-        for (auto& functionResult : this->functions) {
-            functionResult.second = storm::utility::parametric::substitute(functionResult.first, valuation);
+        for (uint64_t function = 0; function < this->functions.size(); ++function) {
+            this->functionValues[function] = storm::utility::parametric::substitute(this->functions[function], valuation);
         }
     }
 
     template<typename PMT = ParametricSparseModelType>
     typename std::enable_if<!std::is_same<PMT, ConstantSparseModelType>::value>::type instantiate_helper(
         storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-        for (auto& functionResult : this->functions) {
-            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        for (uint64_t function = 0; function < this->functions.size(); ++function) {
+            this->functionValues[function] =
+                storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(this->functions[function], valuation));
         }
     }
 
+    /*!
+     * Writes the values of the placeholders to the matrices and vectors of the instantiated model.
+     */
+    void writeInstantiatedValues();
+
     /*!
      * Creates a matrix that has entries at the same position as the given matrix.
      * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -142,19 +162,21 @@ class ModelInstantiator {
     std::unordered_map<std::string, typename ConstantSparseModelType::RewardModelType> buildDummyRewardModels(
         std::unordered_map<std::string, typename ParametricSparseModelType::RewardModelType> const& parametricRewardModel) const;
 
+    /*!
+     * Retrieves the number of the given function. Functions that did not occur so far get the next free number.
+     */
+    uint32_t getFunctionId(ParametricType const& function);
+
     /*!
      * Connects the occurring functions with the corresponding matrix entries
      *
      * @note constantMatrix and parametricMatrix should have entries at the same positions
      *
      * @param constantMatrix The matrix to which the evaluation results are written
-     * @param functions Occurring functions are inserted in this map
-     * @param mapping The connections of functions to matrix entries are push_backed  into this
      * @param parametricMatrix the source matrix with the functions to consider.
      */
-    void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix, std::unordered_map<ParametricType, ConstantType>& functions,
-                                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>>& mapping,
-                                 storm::storage::SparseMatrix<ParametricType> const& parametricMatrix) const;
+    void initializeMatrixMapping(storm::storage::SparseMatrix<ConstantType>& constantMatrix,
+                                 storm::storage::SparseMatrix<ParametricType> const& parametricMatrix);
 
     /*!
      * Connects the occurring functions with the corresponding vector entries
@@ -162,22 +184,25 @@ class ModelInstantiator {
      * @note constantVector and parametricVector should have the same size
      *
      * @param constantVector The vector to which the evaluation results are written
-     * @param functions Occurring functions with their placeholders are inserted in this map
-     * @param mapping The connections of functions to vector entries are push_backed  into this
      * @param parametricVector the source vector with the functions to consider.
      */
-    void initializeVectorMapping(std::vector<ConstantType>& constantVector, std::unordered_map<ParametricType, ConstantType>& functions,
-                                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
-                                 std::vector<ParametricType> const& parametricVector) const;
+    void initializeVectorMapping(std::vector<ConstantType>& constantVector, std::vector<ParametricType> const& parametricVector);
+
+    /// Marks entries with a constant value, which is written only once
+    static constexpr uint32_t noFunction = std::numeric_limits<uint32_t>::max();
 
     /// The resulting model
     std::shared_ptr<ConstantSparseModelType> instantiatedModel;
-    /// the occurring functions together with the corresponding placeholders for their evaluated result
-    std::unordered_map<ParametricType, ConstantType> functions;
-    /// Connection of matrix entries with placeholders
-    std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
-    /// Connection of Vector entries with placeholders
-    std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+    /// the occurring functions (the index of a function is its number) and the placeholders for their evaluated result
+    std::vector<ParametricType> functions;
+    std::vector<ConstantType> functionValues;
+    /// The numbers of the occurring functions (only needed while the mappings are initialized)
+    std::unordered_map<ParametricType, uint32_t> functionIds;
+    /// For each matrix (vector) of the instantiated model and each of its entries the number of the function of that entry (or noFunction)
+    std::vector<std::pair<storm::storage::SparseMatrix<ConstantType>*, std::vector<uint32_t>>> matrixMapping;
+    std::vector<std::pair<std::vector<ConstantType>*, std::vector<uint32_t>>> vectorMapping;
+    /// Evaluates all occurring functions for a batch of valuations (created on demand)
+    std::unique_ptr<BatchFunctionEvaluator> batchEvaluator;
 };
 }  // Namespace utility
 }  // namespace storm
@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/DirectEncodingBinaryParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -32,6 +33,15 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRBModel(
+    std::string const& drbFile, storm::parser::DirectEncodingBinaryParserOptions const& options = storm::parser::DirectEncodingBinaryParserOptions()) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        return storm::parser::DirectEncodingBinaryParser<ValueType>::parseModel(drbFile, options);
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models with binary direct encoding are not supported.");
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const& imcaFile) {
     if constexpr (std::is_same_v<ValueType, double>) {
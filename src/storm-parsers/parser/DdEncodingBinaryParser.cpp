@@ -0,0 +1,170 @@
+#include "storm-parsers/parser/DdEncodingBinaryParser.h"
+
+#include <filesystem>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DDEncodingExporter.h"
+#include "storm/io/file.h"
+#include "storm/models/symbolic/Ctmc.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+/*!
+ * Splits the given line into the given number of whitespace-separated tokens. The last token holds the remainder of the line.
+ */
+std::vector<std::string> tokenize(std::string const& line, uint64_t numberOfTokens, std::string const& filename) {
+    std::vector<std::string> tokens;
+    std::istringstream stream(line);
+    for (uint64_t i = 1; i < numberOfTokens; ++i) {
+        std::string token;
+        STORM_LOG_THROW(stream >> token, storm::exceptions::WrongFormatException, "Unexpected line '" << line << "' in file " << filename << ".");
+        tokens.push_back(std::move(token));
+    }
+    std::string remainder;
+    std::getline(stream >> std::ws, remainder);
+    STORM_LOG_THROW(!remainder.empty(), storm::exceptions::WrongFormatException, "Unexpected line '" << line << "' in file " << filename << ".");
+    tokens.push_back(std::move(remainder));
+    return tokens;
+}
+
+/*!
+ * Recreates the meta variable (with all its layers) that is described by the given tokens, i.e., type, number of layers, lowest DD variable index,
+ * bounds or number of bits and name.
+ */
+template<storm::dd::DdType Type>
+void addMetaVariable(storm::dd::DdManager<Type>& manager, std::vector<std::string> const& tokens, std::string const& filename) {
+    uint64_t const numberOfLayers = std::stoull(tokens[1]);
+    uint64_t const lowestIndex = std::stoull(tokens[2]);
+    std::string const& name = tokens.back();
+    std::vector<storm::expressions::Variable> variables;
+    if (tokens[0] == "bool") {
+        variables = manager.addMetaVariable(name, numberOfLayers);
+    } else if (tokens[0] == "int") {
+        variables = manager.addMetaVariable(name, std::stoll(tokens[3]), std::stoll(tokens[4]), numberOfLayers);
+    } else if (tokens[0] == "bitvector") {
+        variables = manager.addBitVectorMetaVariable(name, std::stoull(tokens[3]), numberOfLayers);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown type '" << tokens[0] << "' of meta variable in file " << filename << ".");
+    }
+    // The node tables refer to DD variables by their index, so the indices need to coincide with the ones of the exported model.
+    STORM_LOG_THROW(manager.getMetaVariable(variables.front()).getLowestIndex() == lowestIndex, storm::exceptions::WrongFormatException,
+                    "Meta variable '" << name << "' could not be recreated with the DD variable indices stored in file " << filename << ".");
+}
+
+uint64_t getNumberOfMetaVariableTokens(std::string const& line) {
+    if (boost::starts_with(line, "bool ")) {
+        return 4;
+    } else if (boost::starts_with(line, "int ")) {
+        return 6;
+    }
+    return 5;
+}
+}  // namespace
+
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdEncodingBinaryParser<Type, ValueType>::parseModel(std::string const& directory) {
+    std::filesystem::path const path(directory);
+    std::string const filename = (path / storm::exporter::drdd::manifestFilename).string();
+    std::ifstream file;
+    storm::utility::openFile(filename, file);
+
+    auto manager = std::make_shared<storm::dd::DdManager<Type>>();
+    auto loadBdd = [&](std::string const& ddFilename) { return storm::dd::Bdd<Type>::fromBinary(*manager, (path / ddFilename).string()); };
+    auto loadAdd = [&](std::string const& ddFilename) { return storm::dd::Add<Type, ValueType>::fromBinary(*manager, (path / ddFilename).string()); };
+    auto loadOptionalAdd = [&](std::string const& ddFilename) {
+        return ddFilename == "-" ? boost::optional<storm::dd::Add<Type, ValueType>>() : boost::optional<storm::dd::Add<Type, ValueType>>(loadAdd(ddFilename));
+    };
+
+    boost::optional<storm::models::ModelType> type;
+    std::set<storm::expressions::Variable> rowVariables, columnVariables, nondeterminismVariables;
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+    boost::optional<storm::dd::Add<Type, ValueType>> transitionMatrix;
+    boost::optional<storm::dd::Bdd<Type>> reachableStates, initialStates, deadlockStates;
+    std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap;
+    std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> rewardModels;
+
+    std::string section;
+    bool sawEnd = false;
+    std::string line;
+    while (!sawEnd && storm::utility::getline(file, line)) {
+        if (line.empty() || boost::starts_with(line, "//")) {
+            continue;
+        }
+        if (boost::starts_with(line, "@type: ")) {
+            type = storm::models::getModelType(line.substr(7));
+        } else if (boost::starts_with(line, "@transitions: ")) {
+            transitionMatrix = loadAdd(line.substr(14));
+        } else if (boost::starts_with(line, "@reachable: ")) {
+            reachableStates = loadBdd(line.substr(12));
+        } else if (boost::starts_with(line, "@initial: ")) {
+            initialStates = loadBdd(line.substr(10));
+        } else if (boost::starts_with(line, "@deadlock: ")) {
+            deadlockStates = loadBdd(line.substr(11));
+        } else if (line == "@end") {
+            sawEnd = true;
+        } else if (boost::starts_with(line, "@")) {
+            section = line;
+        } else if (section == "@metavariables") {
+            addMetaVariable(*manager, tokenize(line, getNumberOfMetaVariableTokens(line), filename), filename);
+        } else if (section == "@rowcolumn") {
+            auto tokens = tokenize(line, 2, filename);
+            rowColumnMetaVariablePairs.emplace_back(manager->getMetaVariable(tokens[0]), manager->getMetaVariable(tokens[1]));
+            rowVariables.insert(rowColumnMetaVariablePairs.back().first);
+            columnVariables.insert(rowColumnMetaVariablePairs.back().second);
+        } else if (section == "@nondeterminism") {
+            nondeterminismVariables.insert(manager->getMetaVariable(line));
+        } else if (section == "@labels") {
+            auto tokens = tokenize(line, 2, filename);
+            labelToBddMap.emplace(tokens[1], loadBdd(tokens[0]));
+        } else if (section == "@rewards") {
+            auto tokens = tokenize(line, 4, filename);
+            rewardModels.emplace(tokens[3], storm::models::symbolic::StandardRewardModel<Type, ValueType>(
+                                                loadOptionalAdd(tokens[0]), loadOptionalAdd(tokens[1]), loadOptionalAdd(tokens[2])));
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unexpected line '" << line << "' in file " << filename << ".");
+        }
+    }
+    STORM_LOG_THROW(sawEnd, storm::exceptions::WrongFormatException, "Unexpected end of file " << filename << ".");
+    STORM_LOG_THROW(type, storm::exceptions::WrongFormatException, "The file " << filename << " does not specify the model type.");
+    STORM_LOG_THROW(transitionMatrix && reachableStates && initialStates && deadlockStates, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not specify all DDs of the model.");
+
+    switch (type.get()) {
+        case storm::models::ModelType::Dtmc:
+            return std::make_shared<storm::models::symbolic::Dtmc<Type, ValueType>>(manager, *reachableStates, *initialStates, *deadlockStates,
+                                                                                    *transitionMatrix, rowVariables, columnVariables,
+                                                                                    rowColumnMetaVariablePairs, labelToBddMap, rewardModels);
+        case storm::models::ModelType::Ctmc:
+            return std::make_shared<storm::models::symbolic::Ctmc<Type, ValueType>>(manager, *reachableStates, *initialStates, *deadlockStates,
+                                                                                    *transitionMatrix, rowVariables, columnVariables,
+                                                                                    rowColumnMetaVariablePairs, labelToBddMap, rewardModels);
+        case storm::models::ModelType::Mdp:
+            return std::make_shared<storm::models::symbolic::Mdp<Type, ValueType>>(manager, *reachableStates, *initialStates, *deadlockStates,
+                                                                                   *transitionMatrix, rowVariables, columnVariables,
+                                                                                   rowColumnMetaVariablePairs, nondeterminismVariables, labelToBddMap,
+                                                                                   rewardModels);
+        default:
+            break;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Loading symbolic models of type " << type.get() << " is not supported.");
+}
+
+// Template instantiations.
+template class DdEncodingBinaryParser<storm::dd::DdType::CUDD, double>;
+template class DdEncodingBinaryParser<storm::dd::DdType::Sylvan, double>;
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/symbolic/Model.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ *	Parser for symbolic models in the binary drdd format (see storm::exporter::explicitExportSymbolicModelBinary).
+ *	The meta variables are recreated in a fresh DD manager such that they obtain the same DD variable indices as in the exported model. The DDs are then
+ *	rebuilt from their stored node tables, i.e., in time linear in the number of nodes and without building the model from its description again.
+ */
+template<storm::dd::DdType Type, typename ValueType = double>
+class DdEncodingBinaryParser {
+   public:
+    /*!
+     * Load a model in binary drdd format from a directory and create the model.
+     *
+     * @param directory The directory that holds the exported model.
+     *
+     * @return A symbolic model
+     */
+    static std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> parseModel(std::string const& directory);
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,209 @@
+#include "storm-parsers/parser/DirectEncodingBinaryParser.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm-parsers/parser/DirectEncodingBinaryReader.h"
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DirectEncodingBinaryFormat.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace drb = storm::exporter::drb;
+
+namespace {
+
+storm::storage::sparse::StateValuations parseStateValuations(DirectEncodingBinaryReader& reader, uint64_t numberOfStates,
+                                                             storm::expressions::ExpressionManager& manager) {
+    storm::storage::sparse::StateValuationsBuilder builder;
+    uint64_t numberOfVariables = reader.readWord();
+    std::vector<bool> isBooleanVariable;
+    for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+        auto typeCode = static_cast<drb::VariableTypeCode>(reader.readWord());
+        STORM_LOG_THROW(typeCode == drb::VariableTypeCode::Boolean || typeCode == drb::VariableTypeCode::Integer, storm::exceptions::WrongFormatException,
+                        "Unknown variable type in state valuations of drb file.");
+        bool isBoolean = typeCode == drb::VariableTypeCode::Boolean;
+        std::string name = reader.readString();
+        storm::expressions::Variable variable;
+        if (manager.hasVariable(name)) {
+            variable = manager.getVariable(name);
+            STORM_LOG_THROW(isBoolean ? variable.hasBooleanType() : variable.hasIntegerType(), storm::exceptions::WrongFormatException,
+                            "The type of variable '" << name << "' in the state valuations does not match the type of the existing variable.");
+        } else {
+            variable = isBoolean ? manager.declareBooleanVariable(name) : manager.declareIntegerVariable(name);
+        }
+        builder.addVariable(variable);
+        isBooleanVariable.push_back(isBoolean);
+    }
+
+    STORM_LOG_THROW(numberOfVariables == 0 || numberOfStates <= reader.remaining() / (numberOfVariables * sizeof(uint64_t)),
+                    storm::exceptions::WrongFormatException, "Unexpected end of drb file.");
+    uint64_t const* values = reader.readArray<uint64_t>(numberOfStates * numberOfVariables);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<bool> booleanValues;
+        std::vector<int64_t> integerValues;
+        for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex, ++values) {
+            if (isBooleanVariable[variableIndex]) {
+                booleanValues.push_back(*values != 0);
+            } else {
+                integerValues.push_back(static_cast<int64_t>(*values));
+            }
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues));
+    }
+    return builder.build();
+}
+
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingBinaryParser<ValueType, RewardModelType>::parseModel(
+    std::string const& filename, DirectEncodingBinaryParserOptions const& options) {
+    static_assert(std::is_same_v<ValueType, double>, "The drb format only supports models with double values.");
+
+    // Map the file into memory
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile file(filename.c_str());
+    DirectEncodingBinaryReader reader(file.getData(), file.getDataEnd());
+
+    // Parse header
+    auto [headerPointer, type] = reader.readHeader(filename);
+    drb::Header const& header = *headerPointer;
+    uint64_t const numberOfStates = header.numberOfStates;
+    uint64_t const numberOfChoices = header.numberOfChoices;
+    uint64_t const numberOfEntries = header.numberOfEntries;
+    STORM_LOG_TRACE("Model type: " << type << " with " << numberOfStates << " states, " << numberOfChoices << " choices and " << numberOfEntries
+                                   << " transitions.");
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components;
+    components.stateLabeling = storm::models::sparse::StateLabeling(numberOfStates);
+    if (options.buildChoiceLabeling) {
+        components.choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfChoices);
+    }
+    // We store rates for CTMCs.
+    components.rateTransitions = type == storm::models::ModelType::Ctmc;
+
+    std::vector<uint64_t> rowIndications;
+    uint64_t const* columns = nullptr;
+    ValueType const* values = nullptr;
+    boost::optional<std::vector<uint64_t>> rowGroupIndices;
+
+    // Parse sections
+    bool sawEnd = false;
+    while (!sawEnd) {
+        drb::SectionHeader const& sectionHeader = *reader.readArray<drb::SectionHeader>(1);
+        STORM_LOG_THROW(sectionHeader.size <= reader.remaining(), storm::exceptions::WrongFormatException, "Unexpected end of drb file.");
+        char const* sectionEnd = reader.getPosition() + sectionHeader.size;
+
+        switch (static_cast<drb::SectionType>(sectionHeader.type)) {
+            case drb::SectionType::End:
+                sawEnd = true;
+                break;
+            case drb::SectionType::RowIndications:
+                rowIndications = reader.readVector<uint64_t>(numberOfChoices + 1);
+                break;
+            case drb::SectionType::Columns:
+                columns = reader.readArray<uint64_t>(numberOfEntries);
+                break;
+            case drb::SectionType::Values:
+                values = reader.readArray<ValueType>(numberOfEntries);
+                break;
+            case drb::SectionType::RowGroupIndices:
+                rowGroupIndices = reader.readVector<uint64_t>(numberOfStates + 1);
+                break;
+            case drb::SectionType::StateLabel: {
+                std::string label = reader.readString();
+                components.stateLabeling.addLabel(label, reader.readBitVector(numberOfStates));
+                break;
+            }
+            case drb::SectionType::ChoiceLabel: {
+                std::string label = reader.readString();
+                storm::storage::BitVector choices = reader.readBitVector(numberOfChoices);
+                if (options.buildChoiceLabeling) {
+                    components.choiceLabeling->addLabel(label, std::move(choices));
+                }
+                break;
+            }
+            case drb::SectionType::RewardModel: {
+                std::string name = reader.readString();
+                uint64_t flags = reader.readWord();
+                std::optional<std::vector<ValueType>> stateRewards;
+                std::optional<std::vector<ValueType>> stateActionRewards;
+                if (flags & drb::HasStateRewards) {
+                    stateRewards = reader.readVector<ValueType>(numberOfStates);
+                }
+                if (flags & drb::HasStateActionRewards) {
+                    stateActionRewards = reader.readVector<ValueType>(numberOfChoices);
+                }
+                components.rewardModels.emplace(name, RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::nullopt));
+                break;
+            }
+            case drb::SectionType::ExitRates:
+                components.exitRates = reader.readVector<ValueType>(numberOfStates);
+                break;
+            case drb::SectionType::MarkovianStates:
+                components.markovianStates = reader.readBitVector(numberOfStates);
+                break;
+            case drb::SectionType::Observations:
+                components.observabilityClasses = reader.readVector<uint32_t>(numberOfStates);
+                break;
+            case drb::SectionType::StateValuations:
+                if (options.expressionManager) {
+                    components.stateValuations = parseStateValuations(reader, numberOfStates, *options.expressionManager);
+                }
+                break;
+            default:
+                STORM_LOG_WARN("Skipping unknown section of type " << sectionHeader.type << " in drb file.");
+        }
+        STORM_LOG_THROW(reader.getPosition() <= sectionEnd, storm::exceptions::WrongFormatException,
+                        "Section of type " << sectionHeader.type << " exceeds its declared size.");
+        reader.setPosition(sectionEnd);
+    }
+
+    // Build the transition matrix
+    STORM_LOG_THROW(rowIndications.size() == numberOfChoices + 1 && columns != nullptr && values != nullptr, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain a transition matrix.");
+    STORM_LOG_THROW(std::is_sorted(rowIndications.begin(), rowIndications.end()) && rowIndications.back() == numberOfEntries,
+                    storm::exceptions::WrongFormatException, "Invalid row indications in drb file.");
+    bool nondeterministic =
+        type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp;
+    if (nondeterministic) {
+        STORM_LOG_THROW(rowGroupIndices && std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end()) && rowGroupIndices->back() == numberOfChoices,
+                        storm::exceptions::WrongFormatException, "Missing or invalid row group indices in drb file.");
+    } else {
+        STORM_LOG_THROW(numberOfChoices == numberOfStates, storm::exceptions::WrongFormatException,
+                        "The number of choices of a deterministic model must match its number of states.");
+        rowGroupIndices = boost::none;
+    }
+    std::vector<storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType>> columnsAndValues;
+    columnsAndValues.reserve(numberOfEntries);
+    for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+        STORM_LOG_THROW(columns[entry] < numberOfStates, storm::exceptions::WrongFormatException, "Invalid column index in drb file.");
+        columnsAndValues.emplace_back(columns[entry], values[entry]);
+    }
+    components.transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(numberOfStates, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+
+    STORM_LOG_THROW(type != storm::models::ModelType::Ctmc || components.exitRates, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain the exit rates of the CTMC.");
+    STORM_LOG_THROW(type != storm::models::ModelType::MarkovAutomaton || (components.exitRates && components.markovianStates),
+                    storm::exceptions::WrongFormatException, "The file " << filename << " does not contain the exit rates and Markovian states of the MA.");
+    STORM_LOG_THROW(type != storm::models::ModelType::Pomdp || components.observabilityClasses, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain the observations of the POMDP.");
+
+    // Build model
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+// Template instantiations.
+template class DirectEncodingBinaryParser<double>;
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace expressions {
+class ExpressionManager;
+}
+
+namespace parser {
+
+struct DirectEncodingBinaryParserOptions {
+    bool buildChoiceLabeling = false;
+    // If set, the state valuations contained in the file are built using (and, if necessary, declaring) variables of this manager.
+    // Otherwise, state valuations are not loaded.
+    std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
+};
+
+/*!
+ *	Parser for models in the binary DRB format (see storm/io/DirectEncodingBinaryFormat.h).
+ *	The file is mapped into memory and the arrays of the model are copied in bulk into the model components, i.e., without parsing individual entries.
+ */
+template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+class DirectEncodingBinaryParser {
+   public:
+    /*!
+     * Load a model in DRB format from a file and create the model.
+     *
+     * @param filename The DRB file to be loaded.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(
+        std::string const& filename, DirectEncodingBinaryParserOptions const& options = DirectEncodingBinaryParserOptions());
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DirectEncodingBinaryFormat.h"
+#include "storm/models/ModelType.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Provides access to the (memory mapped) content of a drb file (see storm/io/DirectEncodingBinaryFormat.h).
+ */
+class DirectEncodingBinaryReader {
+   public:
+    DirectEncodingBinaryReader(char const* begin, char const* end) : current(begin), end(end) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Retrieves a pointer to the given number of consecutive objects of type T and moves past them (including the padding).
+     */
+    template<typename T>
+    T const* readArray(uint64_t count) {
+        STORM_LOG_THROW(count <= remaining() / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of drb file.");
+        T const* result = reinterpret_cast<T const*>(current);
+        current += std::min(storm::exporter::drb::paddedSize(count * sizeof(T)), remaining());
+        return result;
+    }
+
+    template<typename T>
+    std::vector<T> readVector(uint64_t count) {
+        T const* data = readArray<T>(count);
+        return std::vector<T>(data, data + count);
+    }
+
+    uint64_t readWord() {
+        return *readArray<uint64_t>(1);
+    }
+
+    std::string readString() {
+        uint64_t length = readWord();
+        char const* data = readArray<char>(length);
+        return std::string(data, length);
+    }
+
+    storm::storage::BitVector readBitVector(uint64_t length) {
+        uint64_t const* words = readArray<uint64_t>((length + 63) / 64);
+        storm::storage::BitVector result(length);
+        for (uint64_t index = 0; index < length; index += 64) {
+            result.setFromInt(index, std::min<uint64_t>(64, length - index), words[index / 64]);
+        }
+        return result;
+    }
+
+    /*!
+     * Reads and validates the header of the file.
+     * @param filename the name of the file (for error messages)
+     * @return the header and the type of the contained model
+     */
+    std::pair<storm::exporter::drb::Header const*, storm::models::ModelType> readHeader(std::string const& filename) {
+        namespace drb = storm::exporter::drb;
+        drb::Header const& header = *readArray<drb::Header>(1);
+        STORM_LOG_THROW(std::equal(std::begin(drb::Magic), std::end(drb::Magic), header.magic), storm::exceptions::WrongFormatException,
+                        "The file " << filename << " is not in the drb format.");
+        STORM_LOG_THROW(header.byteOrderMarker == drb::ByteOrderMarker, storm::exceptions::WrongFormatException,
+                        "The file " << filename << " was written on a machine with a different byte order.");
+        STORM_LOG_THROW(header.version <= drb::Version, storm::exceptions::NotSupportedException,
+                        "The file " << filename << " has version " << header.version << " of the drb format but only versions up to " << drb::Version
+                                    << " are supported.");
+        STORM_LOG_THROW(header.valueType == static_cast<uint64_t>(drb::ValueTypeCode::Double), storm::exceptions::NotSupportedException,
+                        "The file " << filename << " contains values of an unsupported type.");
+
+        switch (static_cast<drb::ModelTypeCode>(header.modelType)) {
+            case drb::ModelTypeCode::Dtmc:
+                return {&header, storm::models::ModelType::Dtmc};
+            case drb::ModelTypeCode::Ctmc:
+                return {&header, storm::models::ModelType::Ctmc};
+            case drb::ModelTypeCode::Mdp:
+                return {&header, storm::models::ModelType::Mdp};
+            case drb::ModelTypeCode::MarkovAutomaton:
+                return {&header, storm::models::ModelType::MarkovAutomaton};
+            case drb::ModelTypeCode::Pomdp:
+                return {&header, storm::models::ModelType::Pomdp};
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "The file " << filename << " contains a model of unknown type.");
+        }
+    }
+
+    char const* getPosition() const {
+        return current;
+    }
+
+    void setPosition(char const* position) {
+        current = position;
+    }
+
+    uint64_t remaining() const {
+        return end - current;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+
+}  // namespace parser
+}  // namespace storm
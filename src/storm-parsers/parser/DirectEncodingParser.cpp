@@ -1,13 +1,17 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/parser/ValueParser.h"
 
 #include "storm/exceptions/AbortException.h"
@@ -22,6 +26,7 @@
 #include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -30,6 +35,296 @@
 namespace storm {
 namespace parser {
 
+namespace {
+
+/*!
+ * Parses the labels of a state, which are separated by whitespace and can optionally be enclosed in quotation marks.
+ */
+std::vector<std::string> parseLabels(std::string const& line) {
+    // Regex for labels with two cases:
+    // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+    //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+    //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
+    //   (?=(\s|$|\"))
+    // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+    //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+    //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+    static const std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
+    std::vector<std::string> labels;
+    // Iterate over matches
+    auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
+    auto match_end = std::sregex_iterator();
+    for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
+        std::smatch match = *i;
+        // Find matched group and add as label
+        if (match.length(1) > 0) {
+            labels.push_back(match.str(1));
+        } else {
+            labels.push_back(match.str(3));
+        }
+    }
+    return labels;
+}
+
+/*!
+ * The (local) result of parsing a consecutive range of states.
+ */
+template<typename ValueType>
+struct ParsedChunk {
+    // The range of the mapped file that holds the states of this chunk.
+    char const* begin;
+    char const* end;
+
+    // The index of the first state of this chunk.
+    uint64_t firstState = 0;
+    // For each state of the chunk, the index of its first row (relative to the first row of the chunk).
+    std::vector<uint64_t> rowGroupStarts;
+    // For each row of the chunk, the index of its first entry (relative to the first entry of the chunk).
+    std::vector<uint64_t> rowStarts;
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> entries;
+
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // For each reward model, the non-zero rewards of the states/rows of the chunk (again relative to the chunk).
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> stateRewards;
+    std::vector<std::vector<std::pair<uint64_t, ValueType>>> actionRewards;
+    // The (chunk-relative) states/rows of the labels.
+    std::map<std::string, std::vector<uint64_t>> stateLabels;
+    std::map<std::string, std::vector<uint64_t>> choiceLabels;
+
+    uint64_t getNumberOfStates() const {
+        return rowGroupStarts.size();
+    }
+
+    uint64_t getNumberOfRows() const {
+        return rowStarts.size();
+    }
+};
+
+/*!
+ * Parses the given comma-separated list of rewards and stores the non-zero ones for the given (chunk-relative) state or row.
+ */
+template<typename ValueType, typename ValueParserFunction>
+void parseRewardList(std::string const& rewardsStr, uint64_t index, ValueParserFunction const& parseValue,
+                     std::vector<std::vector<std::pair<uint64_t, ValueType>>>& rewards) {
+    std::vector<std::string> rewardStrings;
+    boost::split(rewardStrings, rewardsStr, boost::is_any_of(","));
+    if (rewards.size() < rewardStrings.size()) {
+        rewards.resize(rewardStrings.size());
+    }
+    auto rewardsIt = rewards.begin();
+    for (auto const& rew : rewardStrings) {
+        auto rewardValue = parseValue(rew);
+        if (!storm::utility::isZero(rewardValue)) {
+            rewardsIt->emplace_back(index, std::move(rewardValue));
+        }
+        ++rewardsIt;
+    }
+}
+
+/*!
+ * Parses the states in the range of the given chunk. The format is the same as for the sequential parser, see DirectEncodingParser::parseStates.
+ */
+template<typename ValueType, typename ValueParserFunction>
+void parseChunk(ParsedChunk<ValueType>& chunk, storm::models::ModelType type, size_t stateSize, bool buildChoiceLabeling,
+                ValueParserFunction const& parseValue) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    bool firstActionForState = true;
+    bool rowsNeedFixing = false;
+    uint64_t lastColumn = 0;
+    uint64_t lineCount = 0;
+    std::string line;
+
+    char const* lineBegin = chunk.begin;
+    while (lineBegin < chunk.end) {
+        char const* lineEnd = std::find(lineBegin, chunk.end, '\n');
+        line.assign(lineBegin, lineEnd);
+        lineBegin = lineEnd + 1;
+        while (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || boost::starts_with(line, "//")) {
+            continue;
+        }
+        boost::trim_left(line);
+        if (boost::starts_with(line, "state ")) {
+            // New state
+            uint64_t localState = chunk.getNumberOfStates();
+            chunk.rowGroupStarts.push_back(chunk.rowStarts.size());
+            chunk.rowStarts.push_back(chunk.entries.size());
+            firstActionForState = true;
+
+            // Parse state id
+            line = line.substr(6);  // Remove "state "
+            std::string curString = line;
+            size_t posEnd = line.find(" ");
+            if (posEnd != std::string::npos) {
+                curString = line.substr(0, posEnd);
+                line = line.substr(posEnd + 1);
+            } else {
+                line = "";
+            }
+            size_t parsedId = parseNumber<size_t>(curString);
+            if (localState == 0) {
+                chunk.firstState = parsedId;
+            }
+            STORM_LOG_THROW(chunk.firstState + localState == parsedId, storm::exceptions::WrongFormatException,
+                            "State ids are not ordered and without gaps. Expected " << chunk.firstState + localState << " but got " << parsedId << ".");
+            STORM_LOG_THROW(parsedId < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing for state " << parsedId);
+                line = line.substr(1);  // Remove "!"
+                curString = line;
+                posEnd = line.find(" ");
+                if (posEnd != std::string::npos) {
+                    curString = line.substr(0, posEnd);
+                    line = line.substr(posEnd + 1);
+                } else {
+                    line = "";
+                }
+                chunk.exitRates.push_back(parseValue(curString));
+            }
+
+            if (boost::starts_with(line, "[")) {
+                // Parse rewards
+                size_t posEndReward = line.find(']');
+                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing for state " << parsedId << " .");
+                parseRewardList(line.substr(1, posEndReward - 1), localState, parseValue, chunk.stateRewards);
+                line = line.substr(posEndReward + 1);
+            }
+
+            if (type == storm::models::ModelType::Pomdp) {
+                STORM_LOG_THROW(boost::starts_with(line, "{"), storm::exceptions::WrongFormatException, "Expected an observation for state " << parsedId);
+                size_t posEndObservation = line.find("}");
+                chunk.observations.push_back(std::stoi(line.substr(1, posEndObservation - 1)));
+                line = line.substr(posEndObservation + 1);
+            }
+
+            // Parse labels
+            if (!line.empty()) {
+                for (std::string const& label : parseLabels(line)) {
+                    chunk.stateLabels[label].push_back(localState);
+                }
+            }
+        } else {
+            STORM_LOG_THROW(chunk.getNumberOfStates() > 0, storm::exceptions::WrongFormatException, "Expected a state declaration before '" << line << "'.");
+            if (boost::starts_with(line, "action ")) {
+                // New action
+                if (firstActionForState) {
+                    firstActionForState = false;
+                } else {
+                    chunk.rowStarts.push_back(chunk.entries.size());
+                }
+                uint64_t localRow = chunk.getNumberOfRows() - 1;
+                line = line.substr(7);
+                std::string curString = line;
+                size_t posEnd = line.find(" ");
+                if (posEnd != std::string::npos) {
+                    curString = line.substr(0, posEnd);
+                    line = line.substr(posEnd + 1);
+                } else {
+                    line = "";
+                }
+
+                // curString contains action name.
+                if (buildChoiceLabeling && curString != "__NOLABEL__") {
+                    chunk.choiceLabels[curString].push_back(localRow);
+                }
+                // Check for rewards
+                if (boost::starts_with(line, "[")) {
+                    size_t posEndReward = line.find(']');
+                    STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
+                    parseRewardList(line.substr(1, posEndReward - 1), localRow, parseValue, chunk.actionRewards);
+                }
+            } else {
+                // New transition
+                size_t posColon = line.find(':');
+                STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found in '" << line << "'.");
+                size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
+                STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                                "Target state " << target << " is greater than state size " << stateSize);
+                // Entries of a row that are not ordered by column are fixed after parsing the chunk.
+                if (chunk.entries.size() > chunk.rowStarts.back() && target <= lastColumn) {
+                    rowsNeedFixing = true;
+                }
+                lastColumn = target;
+                chunk.entries.emplace_back(target, parseValue(line.substr(posColon + 2)));
+            }
+        }
+
+        if (++lineCount % 4096 == 0 && storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+
+    if (rowsNeedFixing) {
+        // Sort the entries of each row by their column and add up duplicate entries (as done by the SparseMatrixBuilder).
+        uint64_t newEntryCount = 0;
+        for (uint64_t row = 0; row < chunk.getNumberOfRows(); ++row) {
+            auto rowBegin = chunk.entries.begin() + chunk.rowStarts[row];
+            auto rowEnd = row + 1 < chunk.getNumberOfRows() ? chunk.entries.begin() + chunk.rowStarts[row + 1] : chunk.entries.end();
+            std::stable_sort(rowBegin, rowEnd, [](auto const& a, auto const& b) { return a.getColumn() < b.getColumn(); });
+            chunk.rowStarts[row] = newEntryCount;
+            for (auto it = rowBegin; it != rowEnd; ++it) {
+                if (newEntryCount > chunk.rowStarts[row] && chunk.entries[newEntryCount - 1].getColumn() == it->getColumn()) {
+                    chunk.entries[newEntryCount - 1].setValue(chunk.entries[newEntryCount - 1].getValue() + it->getValue());
+                } else {
+                    chunk.entries[newEntryCount++] = std::move(*it);
+                }
+            }
+        }
+        STORM_LOG_WARN_COND(newEntryCount == chunk.entries.size(), "Unordered transitions in DRN file caused duplicate entries.");
+        chunk.entries.resize(newEntryCount);
+    }
+}
+
+/*!
+ * Finds the beginning of the first line at or after the given position that declares a state.
+ */
+char const* findNextStateDeclaration(char const* position, char const* begin, char const* end) {
+    // Move to the beginning of the next line (unless we are already at the beginning of a line).
+    if (position != begin && *(position - 1) != '\n') {
+        position = std::find(position, end, '\n');
+        if (position != end) {
+            ++position;
+        }
+    }
+    static const std::string stateKeyword = "state ";
+    while (position != end) {
+        char const* lineEnd = std::find(position, end, '\n');
+        char const* firstNonBlank = std::find_if(position, lineEnd, [](char c) { return c != ' ' && c != '\t'; });
+        if (static_cast<uint64_t>(lineEnd - firstNonBlank) >= stateKeyword.size() && std::equal(stateKeyword.begin(), stateKeyword.end(), firstNonBlank)) {
+            return position;
+        }
+        position = lineEnd == end ? end : lineEnd + 1;
+    }
+    return end;
+}
+
+/*!
+ * Calls the given function for all indices in [0, size), in parallel if TBB is available.
+ */
+template<typename FunctionType>
+void forEachIndex(uint64_t size, FunctionType const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size, 1), [&function](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+            function(index);
+        }
+    });
+#else
+    for (uint64_t index = 0; index < size; ++index) {
+        function(index);
+    }
+#endif
+}
+
+}  // namespace
+
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
@@ -118,7 +413,19 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+#ifdef STORM_HAVE_INTELTBB
+            bool parallelParsing = options.parallelParsing && storm::NumberTraits<ValueType>::IsThreadSafe;
+            STORM_LOG_WARN_COND(parallelParsing || !options.parallelParsing, "Parallel parsing is not supported for this value type.");
+#else
+            bool parallelParsing = false;
+            STORM_LOG_WARN_COND(!options.parallelParsing, "Parallel parsing requires Intel TBB.");
+#endif
+            if (parallelParsing) {
+                modelComponents = parseStatesParallel(filename, static_cast<uint64_t>(file.tellg()), type, nrStates, nrChoices, placeholders,
+                                                      valueParser, rewardModelNames, options);
+            } else {
+                modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            }
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
@@ -268,32 +575,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 
             // Parse labels
             if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
+                for (std::string const& label : parseLabels(line)) {
                     if (!modelComponents->stateLabeling.containsLabel(label)) {
                         modelComponents->stateLabeling.addLabel(label);
                     }
@@ -411,6 +693,181 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
     return modelComponents;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStatesParallel(
+    std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    MappedFile file(filename.c_str());
+    char const* begin = file.getData() + std::min<uint64_t>(offset, file.getDataSize());
+    char const* end = file.getDataEnd();
+
+    // Split the states into chunks whose boundaries are state declarations.
+    uint64_t numberOfChunks = std::max<uint64_t>(1, static_cast<uint64_t>(end - begin) / std::max<uint64_t>(1, options.parallelParsingChunkSize));
+#ifdef STORM_HAVE_INTELTBB
+    numberOfChunks = std::min<uint64_t>(numberOfChunks, 8 * static_cast<uint64_t>(tbb::this_task_arena::max_concurrency()));
+#endif
+    std::vector<char const*> boundaries(numberOfChunks + 1, end);
+    boundaries.front() = begin;
+    forEachIndex(numberOfChunks - 1, [&](uint64_t index) {
+        boundaries[index + 1] = findNextStateDeclaration(begin + (index + 1) * ((end - begin) / numberOfChunks), begin, end);
+    });
+    std::vector<ParsedChunk<ValueType>> chunks;
+    for (uint64_t index = 0; index < numberOfChunks; ++index) {
+        if (boundaries[index] < boundaries[index + 1] || index == 0) {
+            chunks.emplace_back();
+            chunks.back().begin = boundaries[index];
+            chunks.back().end = std::max(boundaries[index], boundaries[index + 1]);
+        }
+    }
+    STORM_LOG_INFO("Parsing states of " << filename << " in " << chunks.size() << " chunks.");
+
+    // Parse the chunks
+    auto parseValueFunction = [&placeholders, &valueParser](std::string const& valueStr) { return parseValue(valueStr, placeholders, valueParser); };
+    forEachIndex(chunks.size(), [&](uint64_t index) { parseChunk(chunks[index], type, stateSize, options.buildChoiceLabeling, parseValueFunction); });
+
+    // Compute the offsets of the chunks in the final model.
+    std::vector<uint64_t> stateOffsets(chunks.size() + 1, 0), rowOffsets(chunks.size() + 1, 0), entryOffsets(chunks.size() + 1, 0);
+    uint64_t numRewardModels = 0;
+    for (uint64_t index = 0; index < chunks.size(); ++index) {
+        auto const& chunk = chunks[index];
+        STORM_LOG_THROW(chunk.getNumberOfStates() == 0 || chunk.firstState == stateOffsets[index], storm::exceptions::WrongFormatException,
+                        "State ids are not ordered and without gaps. Expected " << stateOffsets[index] << " but got " << chunk.firstState << ".");
+        stateOffsets[index + 1] = stateOffsets[index] + chunk.getNumberOfStates();
+        rowOffsets[index + 1] = rowOffsets[index] + chunk.getNumberOfRows();
+        entryOffsets[index + 1] = entryOffsets[index] + chunk.entries.size();
+        numRewardModels = std::max({numRewardModels, static_cast<uint64_t>(chunk.stateRewards.size()), static_cast<uint64_t>(chunk.actionRewards.size())});
+    }
+    uint64_t const numberOfRows = rowOffsets.back();
+    STORM_LOG_THROW(stateOffsets.back() == stateSize, storm::exceptions::WrongFormatException,
+                    "Number of states detected (" << stateOffsets.back() << ") does not match number of states declared (" << stateSize << ", in @nr_states).");
+    bool nonDeterministic =
+        (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    } else {
+        STORM_LOG_THROW(numberOfRows == stateSize, storm::exceptions::WrongFormatException, "Deterministic models must have exactly one action per state.");
+    }
+
+    // Concatenate the chunks
+    auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
+    std::vector<uint_fast64_t> rowIndications(numberOfRows + 1);
+    rowIndications.back() = entryOffsets.back();
+    boost::optional<std::vector<uint_fast64_t>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<uint_fast64_t>(stateSize + 1);
+        rowGroupIndices->back() = numberOfRows;
+    }
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues;
+    if (chunks.size() == 1) {
+        columnsAndValues = std::move(chunks.front().entries);
+    } else {
+        columnsAndValues.resize(entryOffsets.back());
+    }
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    if (continuousTime) {
+        modelComponents->exitRates = std::vector<ValueType>(stateSize);
+    }
+    if (type == storm::models::ModelType::Pomdp) {
+        modelComponents->observabilityClasses = std::vector<uint32_t>(stateSize);
+    }
+    forEachIndex(chunks.size(), [&](uint64_t index) {
+        auto& chunk = chunks[index];
+        std::transform(chunk.rowStarts.begin(), chunk.rowStarts.end(), rowIndications.begin() + rowOffsets[index],
+                       [&](uint64_t rowStart) { return rowStart + entryOffsets[index]; });
+        if (nonDeterministic) {
+            std::transform(chunk.rowGroupStarts.begin(), chunk.rowGroupStarts.end(), rowGroupIndices->begin() + stateOffsets[index],
+                           [&](uint64_t rowGroupStart) { return rowGroupStart + rowOffsets[index]; });
+        }
+        if (chunks.size() > 1) {
+            std::move(chunk.entries.begin(), chunk.entries.end(), columnsAndValues.begin() + entryOffsets[index]);
+        }
+        if (continuousTime) {
+            std::move(chunk.exitRates.begin(), chunk.exitRates.end(), modelComponents->exitRates->begin() + stateOffsets[index]);
+        }
+        if (type == storm::models::ModelType::Pomdp) {
+            std::copy(chunk.observations.begin(), chunk.observations.end(), modelComponents->observabilityClasses->begin() + stateOffsets[index]);
+        }
+        // Free the memory of the chunk as early as possible.
+        chunk.entries = decltype(chunk.entries)();
+        chunk.rowStarts = std::vector<uint64_t>();
+    });
+    modelComponents->transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    STORM_LOG_TRACE("Built matrix");
+
+    if (type == storm::models::ModelType::MarkovAutomaton) {
+        modelComponents->markovianStates = storm::storage::BitVector(stateSize);
+        for (uint64_t state = 0; state < stateSize; ++state) {
+            if (!storm::utility::isZero<ValueType>(modelComponents->exitRates.get()[state])) {
+                modelComponents->markovianStates->set(state);
+            }
+        }
+    }
+    // We parse rates for continuous time models.
+    if (type == storm::models::ModelType::Ctmc) {
+        modelComponents->rateTransitions = true;
+    }
+
+    // Build labelings
+    modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
+    if (options.buildChoiceLabeling) {
+        modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfRows);
+    }
+    for (uint64_t index = 0; index < chunks.size(); ++index) {
+        for (auto const& labelStates : chunks[index].stateLabels) {
+            if (!modelComponents->stateLabeling.containsLabel(labelStates.first)) {
+                modelComponents->stateLabeling.addLabel(labelStates.first);
+            }
+            for (auto const& localState : labelStates.second) {
+                modelComponents->stateLabeling.addLabelToState(labelStates.first, stateOffsets[index] + localState);
+            }
+        }
+        for (auto const& labelChoices : chunks[index].choiceLabels) {
+            if (!modelComponents->choiceLabeling->containsLabel(labelChoices.first)) {
+                modelComponents->choiceLabeling->addLabel(labelChoices.first);
+            }
+            for (auto const& localRow : labelChoices.second) {
+                modelComponents->choiceLabeling->addLabelToChoice(labelChoices.first, rowOffsets[index] + localRow);
+            }
+        }
+    }
+
+    // Build reward models
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::string rewardModelName;
+        if (rewardModelNames.size() <= i) {
+            rewardModelName = "rew" + std::to_string(i);
+        } else {
+            rewardModelName = rewardModelNames[i];
+        }
+        std::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        for (uint64_t index = 0; index < chunks.size(); ++index) {
+            if (i < chunks[index].stateRewards.size()) {
+                for (auto& reward : chunks[index].stateRewards[i]) {
+                    if (!stateRewardVector) {
+                        stateRewardVector = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+                    }
+                    (*stateRewardVector)[stateOffsets[index] + reward.first] = std::move(reward.second);
+                }
+            }
+            if (i < chunks[index].actionRewards.size()) {
+                for (auto& reward : chunks[index].actionRewards[i]) {
+                    if (!actionRewardVector) {
+                        actionRewardVector = std::vector<ValueType>(numberOfRows, storm::utility::zero<ValueType>());
+                    }
+                    (*actionRewardVector)[rowOffsets[index] + reward.first] = std::move(reward.second);
+                }
+            }
+        }
+        modelComponents->rewardModels.emplace(
+            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
 template<typename ValueType, typename RewardModelType>
 ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
@@ -13,6 +13,10 @@ class ValueParser;
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    // If set, the file is mapped into memory and the states are parsed in parallel chunks (if supported for the value type).
+    bool parallelParsing = false;
+    // The minimal size (in bytes) of the chunks that are parsed in parallel.
+    uint64_t parallelParsingChunkSize = 1ull << 20;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -47,6 +51,24 @@ class DirectEncodingParser {
         std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
         ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
 
+    /*!
+     * Parse states and return transition matrix. The states are split into chunks that are parsed in parallel.
+     *
+     * @param filename Name of the input file.
+     * @param offset Position in the file at which the states start.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param rewardModelNames Names of reward models.
+     *
+     * @return Transition matrix.
+     */
+    static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStatesParallel(
+        std::string const& filename, uint64_t offset, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
     /*!
      * Parse value from string while using placeholders.
      * @param valueStr String.
@@ -137,7 +137,10 @@ ExpressionParser::ExpressionParser(storm::expressions::ExpressionManager const&
     literalExpression =
         qi::lit("true")[qi::_val = phoenix::bind(&ExpressionCreator::createBooleanLiteralExpression, phoenix::ref(*expressionCreator), true, qi::_pass)] |
         qi::lit("false")[qi::_val = phoenix::bind(&ExpressionCreator::createBooleanLiteralExpression, phoenix::ref(*expressionCreator), false, qi::_pass)] |
-        rationalLiteral_[qi::_val = phoenix::bind(&ExpressionCreator::createRationalLiteralExpression, phoenix::ref(*expressionCreator), qi::_1, qi::_pass)] |
+        // Only try to parse a rational literal if the number has a dot. Otherwise, the rational parser would accumulate all digits of (very common)
+        // integer literals as rational numbers before failing.
+        (&qi::lexeme[-qi::char_("+-") >> *qi::digit >> qi::lit('.')] >>
+         rationalLiteral_[qi::_val = phoenix::bind(&ExpressionCreator::createRationalLiteralExpression, phoenix::ref(*expressionCreator), qi::_1, qi::_pass)]) |
         qi::long_long[qi::_val = phoenix::bind(&ExpressionCreator::createIntegerLiteralExpression, phoenix::ref(*expressionCreator), qi::_1, qi::_pass)];
     literalExpression.name("literal expression");
 
@@ -209,8 +209,10 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
     STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
     // Automatons can only be parsed after constants and variables.
-    for (auto const& automataEntry : parsedStructure.at("automata")) {
+    // The structure of each automaton is released as soon as the automaton is built, so that the memory of the structure is reused for the model.
+    for (auto& automataEntry : parsedStructure.at("automata")) {
         model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+        automataEntry = Json();
     }
     STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
     storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
@@ -244,7 +246,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             }
         }
     }
-    return {model, properties};
+    return {std::move(model), std::move(properties)};
 }
 
 template<typename ValueType>
@@ -0,0 +1,129 @@
+#include "storm-parsers/parser/MappedDirectEncodingBinaryModel.h"
+
+#include <algorithm>
+
+#include "storm-parsers/parser/DirectEncodingBinaryReader.h"
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/DirectEncodingBinaryFormat.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace drb = storm::exporter::drb;
+
+MappedDirectEncodingBinaryModel::MappedDirectEncodingBinaryModel(std::string const& filename) : file(std::make_unique<MappedFile>(filename.c_str())) {
+    STORM_LOG_INFO("Mapping file " << filename);
+    DirectEncodingBinaryReader reader(file->getData(), file->getDataEnd());
+    auto [header, modelType] = reader.readHeader(filename);
+    type = modelType;
+    matrix.numberOfStates = header->numberOfStates;
+    matrix.numberOfRows = header->numberOfChoices;
+    uint64_t const numberOfEntries = header->numberOfEntries;
+
+    bool sawEnd = false;
+    while (!sawEnd) {
+        drb::SectionHeader const& sectionHeader = *reader.readArray<drb::SectionHeader>(1);
+        STORM_LOG_THROW(sectionHeader.size <= reader.remaining(), storm::exceptions::WrongFormatException, "Unexpected end of drb file.");
+        char const* sectionEnd = reader.getPosition() + sectionHeader.size;
+
+        switch (static_cast<drb::SectionType>(sectionHeader.type)) {
+            case drb::SectionType::End:
+                sawEnd = true;
+                break;
+            case drb::SectionType::RowIndications:
+                matrix.rowIndications = reader.readArray<uint64_t>(matrix.numberOfRows + 1);
+                break;
+            case drb::SectionType::Columns:
+                matrix.columns = reader.readArray<uint64_t>(numberOfEntries);
+                break;
+            case drb::SectionType::Values:
+                matrix.values = reader.readArray<double>(numberOfEntries);
+                break;
+            case drb::SectionType::RowGroupIndices:
+                matrix.rowGroupIndices = reader.readArray<uint64_t>(matrix.numberOfStates + 1);
+                break;
+            case drb::SectionType::StateLabel: {
+                std::string label = reader.readString();
+                stateLabels.emplace(std::move(label), reader.readBitVector(matrix.numberOfStates));
+                break;
+            }
+            case drb::SectionType::RewardModel: {
+                std::string name = reader.readString();
+                uint64_t flags = reader.readWord();
+                RewardModel rewardModel;
+                if (flags & drb::HasStateRewards) {
+                    rewardModel.stateRewards = reader.readArray<double>(matrix.numberOfStates);
+                }
+                if (flags & drb::HasStateActionRewards) {
+                    rewardModel.stateActionRewards = reader.readArray<double>(matrix.numberOfRows);
+                }
+                rewardModels.emplace(std::move(name), rewardModel);
+                break;
+            }
+            default:
+                // All other sections are not needed to check reachability properties.
+                break;
+        }
+        STORM_LOG_THROW(reader.getPosition() <= sectionEnd, storm::exceptions::WrongFormatException,
+                        "Section of type " << sectionHeader.type << " exceeds its declared size.");
+        reader.setPosition(sectionEnd);
+    }
+
+    STORM_LOG_THROW(matrix.rowIndications && matrix.columns && matrix.values, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain a transition matrix.");
+    STORM_LOG_THROW(std::is_sorted(matrix.rowIndications, matrix.rowIndications + matrix.numberOfRows + 1) &&
+                        matrix.rowIndications[matrix.numberOfRows] == numberOfEntries,
+                    storm::exceptions::WrongFormatException, "Invalid row indications in drb file.");
+    bool nondeterministic =
+        type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp;
+    if (nondeterministic) {
+        STORM_LOG_THROW(matrix.rowGroupIndices && std::is_sorted(matrix.rowGroupIndices, matrix.rowGroupIndices + matrix.numberOfStates + 1) &&
+                            matrix.rowGroupIndices[matrix.numberOfStates] == matrix.numberOfRows,
+                        storm::exceptions::WrongFormatException, "Missing or invalid row group indices in drb file.");
+    } else {
+        STORM_LOG_THROW(matrix.numberOfRows == matrix.numberOfStates, storm::exceptions::WrongFormatException,
+                        "The number of choices of a deterministic model must match its number of states.");
+        matrix.rowGroupIndices = nullptr;
+    }
+    // This streams over the columns once, but guarantees that value iteration never reads outside of the solution vector.
+    STORM_LOG_THROW(std::all_of(matrix.columns, matrix.columns + numberOfEntries, [this](uint64_t column) { return column < matrix.numberOfStates; }),
+                    storm::exceptions::WrongFormatException, "Invalid column index in drb file.");
+}
+
+MappedDirectEncodingBinaryModel::~MappedDirectEncodingBinaryModel() = default;
+
+storm::models::ModelType MappedDirectEncodingBinaryModel::getType() const {
+    return type;
+}
+
+storm::solver::helper::MappedSparseMatrix const& MappedDirectEncodingBinaryModel::getTransitionMatrix() const {
+    return matrix;
+}
+
+bool MappedDirectEncodingBinaryModel::hasStateLabel(std::string const& label) const {
+    return stateLabels.count(label) > 0;
+}
+
+storm::storage::BitVector const& MappedDirectEncodingBinaryModel::getStateLabel(std::string const& label) const {
+    auto labelIt = stateLabels.find(label);
+    STORM_LOG_THROW(labelIt != stateLabels.end(), storm::exceptions::InvalidArgumentException, "The model has no state label '" << label << "'.");
+    return labelIt->second;
+}
+
+MappedDirectEncodingBinaryModel::RewardModel const& MappedDirectEncodingBinaryModel::getRewardModel(std::string const& name) const {
+    if (name.empty()) {
+        STORM_LOG_THROW(rewardModels.size() == 1, storm::exceptions::InvalidArgumentException,
+                        "The reward model has to be specified as the model has " << rewardModels.size() << " reward models.");
+        return rewardModels.begin()->second;
+    }
+    auto rewardModelIt = rewardModels.find(name);
+    STORM_LOG_THROW(rewardModelIt != rewardModels.end(), storm::exceptions::InvalidArgumentException, "The model has no reward model '" << name << "'.");
+    return rewardModelIt->second;
+}
+
+}  // namespace parser
+}  // namespace storm
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "storm/models/ModelType.h"
+#include "storm/solver/helper/MappedValueIterationHelper.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace parser {
+
+class MappedFile;
+
+/*!
+ * Provides access to a model in the binary DRB format (see storm/io/DirectEncodingBinaryFormat.h) without loading it into memory.
+ * The file stays mapped as long as this object lives and the transition matrix and the rewards are accessed directly on the mapped pages, i.e., the
+ * operating system pages them in and out as needed. Only the state labels are copied.
+ */
+class MappedDirectEncodingBinaryModel {
+   public:
+    struct RewardModel {
+        // Null if the reward model has no state rewards.
+        double const* stateRewards = nullptr;
+        // Null if the reward model has no state-action rewards.
+        double const* stateActionRewards = nullptr;
+    };
+
+    /*!
+     * Maps the given file and validates its structure.
+     */
+    explicit MappedDirectEncodingBinaryModel(std::string const& filename);
+    ~MappedDirectEncodingBinaryModel();
+
+    storm::models::ModelType getType() const;
+
+    /*!
+     * @return a view on the transition matrix. The view is only valid as long as this object lives.
+     */
+    storm::solver::helper::MappedSparseMatrix const& getTransitionMatrix() const;
+
+    bool hasStateLabel(std::string const& label) const;
+    storm::storage::BitVector const& getStateLabel(std::string const& label) const;
+
+    /*!
+     * Retrieves the reward model with the given name. If the name is empty, the model has to have exactly one reward model, which is then returned.
+     */
+    RewardModel const& getRewardModel(std::string const& name) const;
+
+   private:
+    std::unique_ptr<MappedFile> file;
+    storm::models::ModelType type;
+    storm::solver::helper::MappedSparseMatrix matrix;
+    std::map<std::string, storm::storage::BitVector> stateLabels;
+    std::map<std::string, RewardModel> rewardModels;
+};
+
+}  // namespace parser
+}  // namespace storm
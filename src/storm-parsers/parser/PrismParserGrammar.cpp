@@ -26,7 +26,12 @@ storm::prism::Program PrismParserGrammar::parse(std::string const& filename, boo
 
     // Now try to parse the contents of the file.
     try {
-        std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
+        // Read the whole file at once, as reading generated programs character by character takes considerable time.
+        inputFileStream.seekg(0, std::ios::end);
+        std::string fileContent(static_cast<std::size_t>(inputFileStream.tellg()), '\0');
+        inputFileStream.seekg(0, std::ios::beg);
+        inputFileStream.read(fileContent.data(), fileContent.size());
+        fileContent.resize(inputFileStream.gcount());
         result = parseFromString(fileContent, filename, prismCompatibility);
     } catch (storm::exceptions::WrongFormatException& e) {
         // In case of an exception properly close the file before passing exception.
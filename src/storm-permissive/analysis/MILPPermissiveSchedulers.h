@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include "storm-permissive/analysis/PermissiveSchedulerComputation.h"
@@ -20,6 +21,11 @@ template<typename RM>
 class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation<RM> {
    private:
     bool mCalledOptimizer = false;
+    // The MILP is built once and only the parts that depend on the bound are replaced between solves.
+    bool mCreatedMILP = false;
+    // If set, the constraints for the direction of the bound (lower or upper) are on the solver stack.
+    std::optional<bool> mLowerBoundConstraintsCreated;
+    storm::storage::BitVector mRelevantStates;
     storm::solver::LpSolver<double>& solver;
     std::unordered_map<storm::storage::StateActionPair, storm::expressions::Variable> multistrategyVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mProbVariables;
@@ -32,8 +38,13 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                                        storm::storage::BitVector const& goalstates, storm::storage::BitVector const& sinkstates)
         : PermissiveSchedulerComputation<RM>(mdp, goalstates, sinkstates), solver(milpsolver) {}
 
+    /*!
+     * Computes a permissive scheduler for the given bound. Repeated calls (e.g., for a sweep over bounds or penalties) reuse the MILP of the
+     * previous call: only the objective coefficients and the constraints that depend on the bound are replaced, which allows the solver to
+     * start from the previous solution.
+     */
     void calculatePermissiveScheduler(bool lowerBound, double boundary) override {
-        createMILP(lowerBound, boundary, this->mPenalties);
+        updateMILP(lowerBound, boundary, this->mPenalties);
         // STORM_LOG_DEBUG("Calling optimizer");
         solver.optimize();
         // STORM_LOG_DEBUG("Done optimizing.")
@@ -133,18 +144,9 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     /**
      * Create constraints
      */
-    void createConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
+    void createConstraints(storm::storage::BitVector const& relevantStates) {
         // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
-
-        // (1)
-        STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
-        uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
-        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
-        if (lowerBound) {
-            solver.addConstraint("c1", mProbVariables[initialStateIndex] >= solver.getConstant(boundary));
-        } else {
-            solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
-        }
+        // (1) and (3) depend on the bound and are created separately.
         for (uint_fast64_t s : relevantStates) {
             std::string stateString = std::to_string(s);
             storm::expressions::Expression expr = solver.getConstant(0.0);
@@ -156,26 +158,6 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
             // (5)
             solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
-            // (3) For the relevant states.
-            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                std::string sastring(stateString + "_" + std::to_string(a));
-                expr = solver.getConstant(0.0);
-                for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
-                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
-                        expr = expr + solver.getConstant(entry.getValue()) * mProbVariables[entry.getColumn()];
-                    } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
-                        expr = expr + solver.getConstant(entry.getValue());
-                    }
-                }
-                if (lowerBound) {
-                    solver.addConstraint("c3-" + sastring,
-                                         mProbVariables[s] <= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
-                } else {
-                    solver.addConstraint("c3-" + sastring,
-                                         mProbVariables[s] >= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
-                }
-            }
-
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 // (6)
                 std::string sastring(stateString + "_" + std::to_string(a));
@@ -208,18 +190,88 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     }
 
     /**
-     *
+     * Create the constraints (3) that depend on whether the bound is a lower or an upper bound
      */
-    void createMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
-        // Notice that the separated construction of variables and
-        // constraints slows down the construction of the MILP.
-        // In the future, we might want to merge this.
-        createVariables(penalties, relevantStates);
-        createConstraints(lowerBound, boundary, relevantStates);
-
-        solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
+    void createDirectionConstraints(bool lowerBound, storm::storage::BitVector const& relevantStates) {
+        for (uint_fast64_t s : relevantStates) {
+            std::string stateString = std::to_string(s);
+            storm::expressions::Expression expr;
+            // (3) For the relevant states.
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                std::string sastring(stateString + "_" + std::to_string(a));
+                expr = solver.getConstant(0.0);
+                for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
+                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
+                        expr = expr + solver.getConstant(entry.getValue()) * mProbVariables[entry.getColumn()];
+                    } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
+                        expr = expr + solver.getConstant(entry.getValue());
+                    }
+                }
+                if (lowerBound) {
+                    solver.addConstraint("c3-" + sastring,
+                                         mProbVariables[s] <= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
+                } else {
+                    solver.addConstraint("c3-" + sastring,
+                                         mProbVariables[s] >= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
+                }
+            }
+        }
+    }
+
+    /**
+     * Create the constraint (1) that bounds the probability of the initial state
+     */
+    void createBoundConstraint(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
+        STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
+        uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
+        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
+        if (lowerBound) {
+            solver.addConstraint("c1", mProbVariables[initialStateIndex] >= solver.getConstant(boundary));
+        } else {
+            solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
+        }
+    }
+
+    /**
+     * Update the objective coefficients of the multistrategy variables to the given penalties
+     */
+    void updatePenalties(PermissiveSchedulerPenalties const& penalties) {
+        for (auto const& entry : multistrategyVariables) {
+            solver.setObjectiveFunctionCoefficient(entry.second, -penalties.get(entry.first));
+        }
+    }
+
+    /**
+     * Creates the MILP on the first call. Later calls replace the bound-dependent constraints, which are kept on the solver stack.
+     */
+    void updateMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
+        if (!mCreatedMILP) {
+            storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
+            mRelevantStates = ~irrelevant;
+            // Notice that the separated construction of variables and
+            // constraints slows down the construction of the MILP.
+            // In the future, we might want to merge this.
+            createVariables(penalties, mRelevantStates);
+            createConstraints(mRelevantStates);
+            solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
+            mCreatedMILP = true;
+        } else {
+            updatePenalties(penalties);
+            // Remove the bound constraint and, if the direction changed, the direction constraints.
+            solver.pop();
+            if (mLowerBoundConstraintsCreated.value() != lowerBound) {
+                solver.pop();
+                mLowerBoundConstraintsCreated.reset();
+            }
+        }
+        if (!mLowerBoundConstraintsCreated.has_value()) {
+            solver.push();
+            createDirectionConstraints(lowerBound, mRelevantStates);
+            mLowerBoundConstraintsCreated = lowerBound;
+        }
+        solver.push();
+        createBoundConstraint(lowerBound, boundary, mRelevantStates);
+        solver.update();
     }
 };
 }  // namespace ps
@@ -3,6 +3,7 @@
 
 #include "storm-permissive/analysis/MILPPermissiveSchedulers.h"
 #include "storm-permissive/analysis/SmtBasedPermissiveSchedulers.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -15,16 +16,24 @@ namespace storm {
 namespace ps {
 
 template<typename RM>
-boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
+std::pair<storm::storage::BitVector, storm::storage::BitVector> computeGoalAndSinkStates(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                        storm::logic::ProbabilityOperatorFormula const& safeProp) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
-    auto backwardTransitions = mdp.getBackwardTransitions();
+    auto const backwardTransitionsPtr = mdp.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     storm::storage::BitVector goalstates =
         propMC.check(safeProp.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
     storm::storage::BitVector sinkstates =
         storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
+    return std::make_pair(std::move(goalstates), std::move(sinkstates));
+}
+
+template<typename RM>
+boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
+    auto [goalstates, sinkstates] = computeGoalAndSinkStates(mdp, safeProp);
 
     auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
     MilpPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, mdp, goalstates, sinkstates);
@@ -39,6 +48,40 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP
     }
 }
 
+template<typename RM>
+std::vector<boost::optional<SubMDPPermissiveScheduler<RM>>> computePermissiveSchedulersViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                              storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                              std::vector<double> const& thresholds, bool parallel) {
+    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
+    auto const [goalstates, sinkstates] = computeGoalAndSinkStates(mdp, safeProp);
+    bool const lowerBound = storm::logic::isLowerBound(safeProp.getComparisonType());
+
+    std::vector<boost::optional<SubMDPPermissiveScheduler<RM>>> result(thresholds.size());
+    // Solves the given range of thresholds on a single solver instance, reusing the MILP between consecutive thresholds.
+    auto solveThresholds = [&](uint64_t begin, uint64_t end) {
+        auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
+        MilpPermissiveSchedulerComputation<RM> comp(*solver, mdp, goalstates, sinkstates);
+        for (uint64_t i = begin; i < end; ++i) {
+            comp.calculatePermissiveScheduler(lowerBound, thresholds[i]);
+            if (comp.foundSolution()) {
+                result[i].emplace(comp.getScheduler());
+            }
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, thresholds.size()),
+                          [&solveThresholds](tbb::blocked_range<uint64_t> const& range) { solveThresholds(range.begin(), range.end()); });
+        return result;
+    }
+#else
+    STORM_LOG_WARN_COND(!parallel, "Solving the thresholds in parallel requires Intel TBB. Solving them sequentially.");
+#endif
+    solveThresholds(0, thresholds.size());
+    return result;
+}
+
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMC(std::shared_ptr<storm::models::sparse::Mdp<double, RM>> mdp,
                                                                                storm::logic::ProbabilityOperatorFormula const& safeProp) {}
@@ -48,7 +91,8 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
-    auto backwardTransitions = mdp.getBackwardTransitions();
+    auto const backwardTransitionsPtr = mdp.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     storm::storage::BitVector goalstates =
         propMC.check(safeProp.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
@@ -70,6 +114,9 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
 
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double> const& mdp,
                                                                                         storm::logic::ProbabilityOperatorFormula const& safeProp);
+template std::vector<boost::optional<SubMDPPermissiveScheduler<>>> computePermissiveSchedulersViaMILP(
+    storm::models::sparse::Mdp<double> const& mdp, storm::logic::ProbabilityOperatorFormula const& safeProp, std::vector<double> const& thresholds,
+    bool parallel);
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double> const& mdp,
                                                                                        storm::logic::ProbabilityOperatorFormula const& safeProp);
 
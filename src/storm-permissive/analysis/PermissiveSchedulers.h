@@ -77,6 +77,16 @@ template<typename RM = storm::models::sparse::StandardRewardModel<double>>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
                                                                                  storm::logic::ProbabilityOperatorFormula const& safeProp);
 
+/*!
+ * Computes permissive schedulers for the bound of the given property and each of the given thresholds (which replace the threshold of the property).
+ * Consecutive thresholds are solved on the same MILP, where only the bound is replaced. If parallel is set (and TBB is available), the thresholds are
+ * distributed over several solver instances.
+ */
+template<typename RM = storm::models::sparse::StandardRewardModel<double>>
+std::vector<boost::optional<SubMDPPermissiveScheduler<RM>>> computePermissiveSchedulersViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                              storm::logic::ProbabilityOperatorFormula const& safeProp,
+                                                                                              std::vector<double> const& thresholds, bool parallel = false);
+
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp);
@@ -27,6 +27,7 @@ const std::string triangulationModeOption = "triangulationmode";
 const std::string clippingOption = "use-clipping";
 const std::string cutZeroGapOption = "cut-zero-gap";
 const std::string stateEliminationCutoffOption = "state-elimination-cutoff";
+const std::string parallelExpansionOption = "parallel-expansion";
 
 BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -159,6 +160,15 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
     this->addOption(storm::settings::OptionBuilder(moduleName, stateEliminationCutoffOption, false,
                                                    "If this is set, an additional unfolding step for cut-off beliefs is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelExpansionOption, false,
+                                                   "If this is set, the successors of multiple beliefs are computed and triangulated in parallel.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch", "The number of beliefs expanded in parallel.")
+                                         .setDefaultValueUnsignedInteger(256)
+                                         .makeOptional()
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool BeliefExplorationSettings::isRefineSet() const {
@@ -249,6 +259,14 @@ bool BeliefExplorationSettings::isCutZeroGapSet() const {
     return this->getOption(cutZeroGapOption).getHasOptionBeenSet();
 }
 
+bool BeliefExplorationSettings::isParallelExpansionSet() const {
+    return this->getOption(parallelExpansionOption).getHasOptionBeenSet();
+}
+
+uint64_t BeliefExplorationSettings::getParallelExpansionBatchSize() const {
+    return this->getOption(parallelExpansionOption).getArgumentByName("batch").getValueAsUnsignedInteger();
+}
+
 template<typename ValueType>
 void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
     options.refine = isRefineSet();
@@ -282,6 +300,7 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     }
     options.dynamicTriangulation = isDynamicTriangulationModeSet();
     options.cutZeroGap = isCutZeroGapSet();
+    options.parallelExpansionBatchSize = isParallelExpansionSet() ? getParallelExpansionBatchSize() : 0;
 }
 
 template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(
@@ -74,6 +74,10 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     bool isStateEliminationCutoffSet() const;
 
+    /// Controls whether (and for how many beliefs at once) successor beliefs are computed in parallel
+    bool isParallelExpansionSet() const;
+    uint64_t getParallelExpansionBatchSize() const;
+
     template<typename ValueType>
     void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
 
@@ -17,6 +17,7 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
@@ -231,6 +232,25 @@ void performQualitativeAnalysis(std::shared_ptr<storm::models::sparse::Pomdp<Val
                 search.getStatistics().print();
             }
 
+        } else if (qualSettings.getMemlessSearchMethod() == "portfolio") {
+            STORM_LOG_ERROR_COND(!qualSettings.isWinningRegionSet(), "Computing winning regions is not supported by the portfolio method.");
+            storm::pomdp::PolicySearchPortfolio<ValueType> portfolio(pomdp, targetStates, surelyNotAlmostSurelyReachTarget);
+            portfolio.addDefaultConfigurations(lookahead, fillMemlessSearchOptionsFromSettings());
+            bool result = portfolio.analyzeForInitialStates();
+            if (result) {
+                STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target (found by configuration "
+                                    << portfolio.getSuccessfulConfiguration().value() << " of " << portfolio.getNumberOfConfigurations() << ").\n");
+            } else {
+                STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target.\n");
+            }
+            if (qualSettings.isPrintWinningRegionSet()) {
+                portfolio.getWinningRegion().print();
+                std::cout << '\n';
+            }
+            if (qualSettings.isExportWinningRegionSet()) {
+                std::size_t hash = pomdp.hash();
+                portfolio.getWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(), "model hash: " + std::to_string(hash));
+            }
         } else {
             STORM_LOG_ERROR("This method is not implemented.");
         }
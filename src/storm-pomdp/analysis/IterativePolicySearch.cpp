@@ -368,6 +368,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     STORM_LOG_DEBUG("Surely reach sink states: " << surelyReachSinkStates);
     STORM_LOG_DEBUG("Target states " << targetStates);
     STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
+    importSharedWinningRegion();
     stats.initializeSolverTimer.start();
     // TODO: When do we need to reinitialize? When the solver has been reset.
     bool lookaheadConstraintsRequired = initialize(k);
@@ -509,6 +510,10 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
 
     bool foundWhatWeLookFor = false;
     while (true) {
+        if (isAborted()) {
+            STORM_LOG_INFO("Policy search aborted.");
+            return false;
+        }
         stats.incrementOuterIterations();
         // TODO consider what we really want to store about the schedulers.
         scheduler.reset(pomdp.getNrObservations(), maximalNrActions);
@@ -528,6 +533,10 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         }
         uint64_t localIterations = 0;
         while (true) {
+            if (isAborted()) {
+                STORM_LOG_INFO("Policy search aborted.");
+                return false;
+            }
             ++iterations;
             ++localIterations;
 
@@ -702,6 +711,9 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
                 }
             }
         }
+        if (sharedWinningRegion && !updated.empty()) {
+            sharedWinningRegion->publish(winningRegion);
+        }
         stats.winningRegionUpdatesTimer.stop();
         if (foundWhatWeLookFor) {
             return true;
@@ -851,6 +863,20 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     return true;
 }
 
+template<typename ValueType>
+void IterativePolicySearch<ValueType>::importSharedWinningRegion() {
+    if (!sharedWinningRegion || !sharedWinningRegion->importInto(winningRegion)) {
+        return;
+    }
+    for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+        if (winningRegion.observationIsWinning(observation)) {
+            for (uint64_t state : statesPerObservation[observation]) {
+                targetStates.set(state);
+            }
+        }
+    }
+}
+
 template<typename ValueType>
 void IterativePolicySearch<ValueType>::coveredStatesToStream(std::ostream& os, storm::storage::BitVector const& remaining) const {
     bool first = true;
@@ -1,3 +1,6 @@
+#pragma once
+
+#include <atomic>
 #include <sstream>
 #include <vector>
 #include "storm/exceptions/UnexpectedException.h"
@@ -14,7 +17,7 @@ namespace storm {
 namespace pomdp {
 
 enum class MemlessSearchPathVariables { BooleanRanking, IntegerRanking, RealRanking };
-MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
     if (in == "int") {
         return MemlessSearchPathVariables::IntegerRanking;
     } else if (in == "real") {
@@ -182,6 +185,21 @@ class IterativePolicySearch {
         return winningRegion;
     }
 
+    /*!
+     * Shares winning region information with other searches on the same POMDP: The search publishes its winning sets after every update
+     * and imports the sets published by others whenever it (re)starts.
+     */
+    void setSharedWinningRegion(std::shared_ptr<SharedWinningRegion> const& sharedRegion) {
+        sharedWinningRegion = sharedRegion;
+    }
+
+    /*!
+     * Sets a flag that, once raised, lets the search stop as soon as the current solver call returns. An aborted search reports that nothing was found.
+     */
+    void setAbortFlag(std::atomic<bool> const& flag) {
+        abortFlag = &flag;
+    }
+
     uint64_t getOffsetFromObservation(uint64_t state, uint64_t observation) const;
 
     bool analyze(uint64_t k, storm::storage::BitVector const& oneOfTheseStates,
@@ -204,6 +222,15 @@ class IterativePolicySearch {
 
     bool initialize(uint64_t k);
 
+    bool isAborted() const {
+        return abortFlag != nullptr && abortFlag->load();
+    }
+
+    /*!
+     * Adds the winning sets found by other searches to the winning region. Observations that thereby become winning are added to the target states.
+     */
+    void importSharedWinningRegion();
+
     bool smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions = {});
 
     std::unique_ptr<storm::solver::SmtSolver> smtSolver;
@@ -245,6 +272,8 @@ class IterativePolicySearch {
 
     std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory;
     std::shared_ptr<WinningRegionQueryInterface<ValueType>> validator;
+    std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+    std::atomic<bool> const* abortFlag = nullptr;
 
     mutable bool useFindOffset = false;
 };
@@ -0,0 +1,110 @@
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
+
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace pomdp {
+
+template<typename ValueType>
+PolicySearchPortfolio<ValueType>::PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                                                        storm::storage::BitVector const& surelyReachSinkStates)
+    : pomdp(pomdp), targetStates(targetStates), surelyReachSinkStates(surelyReachSinkStates) {
+    std::vector<uint64_t> nrStatesPerObservation(pomdp.getNrObservations(), 0);
+    for (auto obs : pomdp.getObservations()) {
+        ++nrStatesPerObservation[obs];
+    }
+    sharedWinningRegion = std::make_shared<SharedWinningRegion>(nrStatesPerObservation);
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::addConfiguration(uint64_t lookahead, MemlessSearchOptions const& options,
+                                                        std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory) {
+    configurations.push_back({lookahead, options, smtSolverFactory});
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::addDefaultConfigurations(uint64_t lookahead, MemlessSearchOptions const& options) {
+    auto z3Factory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    addConfiguration(lookahead, options, z3Factory);
+    for (auto pathVariableType :
+         {MemlessSearchPathVariables::RealRanking, MemlessSearchPathVariables::IntegerRanking, MemlessSearchPathVariables::BooleanRanking}) {
+        if (pathVariableType != options.pathVariableType) {
+            MemlessSearchOptions variant = options;
+            variant.pathVariableType = pathVariableType;
+            addConfiguration(lookahead, variant, z3Factory);
+        }
+    }
+#ifdef STORM_HAVE_MSAT
+    addConfiguration(lookahead, options, std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>());
+#endif
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::analyzeForInitialStates() {
+    STORM_LOG_THROW(!configurations.empty(), storm::exceptions::UnexpectedException, "The portfolio does not contain any configuration.");
+    successfulConfiguration = std::nullopt;
+    std::atomic<bool> abort(false);
+    std::mutex resultMutex;
+    std::exception_ptr exception;
+
+    std::vector<std::thread> threads;
+    threads.reserve(configurations.size());
+    for (uint64_t index = 0; index < configurations.size(); ++index) {
+        threads.emplace_back([this, index, &abort, &resultMutex, &exception]() {
+            try {
+                Configuration& configuration = configurations[index];
+                IterativePolicySearch<ValueType> search(pomdp, targetStates, surelyReachSinkStates, configuration.smtSolverFactory, configuration.options);
+                search.setSharedWinningRegion(sharedWinningRegion);
+                search.setAbortFlag(abort);
+                if (search.analyzeForInitialStates(configuration.lookahead)) {
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    if (!successfulConfiguration) {
+                        STORM_LOG_INFO("Policy search configuration " << index << " found a winning policy.");
+                        successfulConfiguration = index;
+                    }
+                    abort = true;
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception && !successfulConfiguration) {
+        std::rethrow_exception(exception);
+    }
+    return successfulConfiguration.has_value();
+}
+
+template<typename ValueType>
+WinningRegion PolicySearchPortfolio<ValueType>::getWinningRegion() const {
+    return sharedWinningRegion->getWinningRegion();
+}
+
+template<typename ValueType>
+std::optional<uint64_t> PolicySearchPortfolio<ValueType>::getSuccessfulConfiguration() const {
+    return successfulConfiguration;
+}
+
+template<typename ValueType>
+uint64_t PolicySearchPortfolio<ValueType>::getNumberOfConfigurations() const {
+    return configurations.size();
+}
+
+template class PolicySearchPortfolio<double>;
+template class PolicySearchPortfolio<storm::RationalNumber>;
+
+}  // namespace pomdp
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/solver.h"
+
+namespace storm {
+namespace pomdp {
+
+/*!
+ * Runs several configurations of the iterative policy search concurrently (one thread each).
+ * The searches share their winning regions and all searches are stopped as soon as one of them finds a policy that almost-surely reaches the target.
+ */
+template<typename ValueType>
+class PolicySearchPortfolio {
+   public:
+    struct Configuration {
+        uint64_t lookahead;
+        MemlessSearchOptions options;
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
+    };
+
+    PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                          storm::storage::BitVector const& surelyReachSinkStates);
+
+    /*!
+     * Adds a configuration of the search to the portfolio.
+     */
+    void addConfiguration(uint64_t lookahead, MemlessSearchOptions const& options,
+                          std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory);
+
+    /*!
+     * Adds a default set of configurations that differ in the encoding of the ranking function and in the SMT solver.
+     *
+     * @param lookahead The lookahead for the configurations with a discrete ranking function.
+     * @param options The options from which the configurations are derived.
+     */
+    void addDefaultConfigurations(uint64_t lookahead, MemlessSearchOptions const& options);
+
+    /*!
+     * Runs all configurations until one of them finds a policy that almost-surely reaches the target from all initial states
+     * or until all of them are done.
+     *
+     * @return true iff one of the configurations found such a policy.
+     */
+    bool analyzeForInitialStates();
+
+    /*!
+     * Retrieves the union of the winning regions found by all configurations.
+     */
+    WinningRegion getWinningRegion() const;
+
+    /*!
+     * Retrieves the index of the configuration that found a policy during the last analysis (if any).
+     */
+    std::optional<uint64_t> getSuccessfulConfiguration() const;
+
+    uint64_t getNumberOfConfigurations() const;
+
+   private:
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+    storm::storage::BitVector targetStates;
+    storm::storage::BitVector surelyReachSinkStates;
+
+    std::vector<Configuration> configurations;
+    std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+    std::optional<uint64_t> successfulConfiguration;
+};
+
+}  // namespace pomdp
+}  // namespace storm
@@ -46,7 +46,7 @@ storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProbSma
         untilSubformula = std::make_shared<storm::logic::UntilFormula>(subformula->asUntilFormula());
     }
     // The vector is sound, but not necessarily complete!
-    return ~storm::utility::graph::performProb1E(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), pomdp.getBackwardTransitions(),
+    return ~storm::utility::graph::performProb1E(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), *pomdp.getBackwardTransitions(),
                                                  checkPropositionalFormula(untilSubformula->getLeftSubformula()),
                                                  checkPropositionalFormula(untilSubformula->getRightSubformula()));
 }
@@ -83,7 +83,7 @@ storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb0or
 
 template<typename ValueType>
 storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb0Max(storm::logic::UntilFormula const& formula) const {
-    return storm::utility::graph::performProb0A(pomdp.getBackwardTransitions(), checkPropositionalFormula(formula.getLeftSubformula()),
+    return storm::utility::graph::performProb0A(*pomdp.getBackwardTransitions(), checkPropositionalFormula(formula.getLeftSubformula()),
                                                 checkPropositionalFormula(formula.getRightSubformula()));
 }
 
@@ -96,11 +96,11 @@ template<typename ValueType>
 storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb1Max(storm::storage::BitVector const& okay,
                                                                                   storm::storage::BitVector const& good) const {
     storm::storage::BitVector newGoalStates = storm::utility::graph::performProb1A(
-        pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), pomdp.getBackwardTransitions(), okay, good);
+        pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), *pomdp.getBackwardTransitions(), okay, good);
     STORM_LOG_TRACE("Prob1A states according to MDP: " << newGoalStates);
     // Now find a set of observations such that there is (a memoryless) scheduler inducing prob. 1 for each state whose observation is in the set.
     storm::storage::BitVector potentialGoalStates = storm::utility::graph::performProb1E(
-        pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), pomdp.getBackwardTransitions(), okay, newGoalStates);
+        pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), *pomdp.getBackwardTransitions(), okay, newGoalStates);
     STORM_LOG_TRACE("Prob1E states according to MDP: " << potentialGoalStates);
 
     storm::storage::BitVector avoidStates = ~potentialGoalStates;
@@ -127,9 +127,9 @@ storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb1Ma
     storm::storage::BitVector goalStates(pomdp.getNumberOfStates());
     while (goalStates != newGoalStates) {
         goalStates = storm::utility::graph::performProb1A(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(),
-                                                          pomdp.getBackwardTransitions(), okay, newGoalStates);
+                                                          *pomdp.getBackwardTransitions(), okay, newGoalStates);
         goalStates = storm::utility::graph::performProb1E(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(),
-                                                          pomdp.getBackwardTransitions(), okay & singleObservationStates, goalStates);
+                                                          *pomdp.getBackwardTransitions(), okay & singleObservationStates, goalStates);
         newGoalStates = goalStates;
         STORM_LOG_TRACE("Prob1A states according to MDP: " << newGoalStates);
         for (uint64_t observation : potentialGoalObservations) {
@@ -192,7 +192,7 @@ storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb1Ma
 
 template<typename ValueType>
 storm::storage::BitVector QualitativeAnalysisOnGraphs<ValueType>::analyseProb1Min(storm::logic::UntilFormula const& formula) const {
-    return storm::utility::graph::performProb1A(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), pomdp.getBackwardTransitions(),
+    return storm::utility::graph::performProb1A(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), *pomdp.getBackwardTransitions(),
                                                 checkPropositionalFormula(formula.getLeftSubformula()),
                                                 checkPropositionalFormula(formula.getRightSubformula()));
 }
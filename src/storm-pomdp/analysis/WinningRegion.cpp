@@ -1,6 +1,9 @@
 #include "storm-pomdp/analysis/WinningRegion.h"
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
+#include <fstream>
 #include <iostream>
+#include <storm/exceptions/FileIoException.h>
 #include <storm/exceptions/WrongFormatException.h>
 #include "storm/io/file.h"
 #include "storm/storage/expressions/Expression.h"
@@ -11,6 +14,23 @@
 
 namespace storm {
 namespace pomdp {
+
+namespace {
+// The magic number at the beginning of every binary winning region file, i.e. "STORMWR" followed by the format version.
+uint64_t constexpr binaryMagicNumber = 0x53544F524D575201ull;
+
+void writeWord(std::ofstream& out, uint64_t word) {
+    out.write(reinterpret_cast<char const*>(&word), sizeof(word));
+}
+
+uint64_t readWord(std::ifstream& in, std::string const& path) {
+    uint64_t word;
+    in.read(reinterpret_cast<char*>(&word), sizeof(word));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of winning region file " << path << ".");
+    return word;
+}
+}  // namespace
+
 WinningRegion::WinningRegion(std::vector<uint64_t> const& observationSizes) : observationSizes(observationSizes) {
     for (uint64_t i = 0; i < observationSizes.size(); ++i) {
         winningRegion.push_back(std::vector<storm::storage::BitVector>());
@@ -18,11 +38,13 @@ WinningRegion::WinningRegion(std::vector<uint64_t> const& observationSizes) : ob
 }
 
 void WinningRegion::setObservationIsWinning(uint64_t observation) {
+    dropIndex(observation);
     winningRegion[observation] = {storm::storage::BitVector(observationSizes[observation], true)};
 }
 
 void WinningRegion::addTargetStates(uint64_t observation, storm::storage::BitVector const& offsets) {
     assert(!offsets.empty());
+    dropIndex(observation);
     if (winningRegion[observation].empty()) {
         winningRegion[observation].push_back(offsets);
         return;
@@ -56,6 +78,7 @@ bool WinningRegion::update(uint64_t observation, storm::storage::BitVector const
         }
     }
 
+    dropIndex(observation);
     // only if changed.
     if (changed) {
         newWinningSupport.push_back(winning);
@@ -66,7 +89,21 @@ bool WinningRegion::update(uint64_t observation, storm::storage::BitVector const
     return true;
 }
 
+bool WinningRegion::merge(WinningRegion const& other) {
+    assert(other.getNumberOfObservations() == getNumberOfObservations());
+    bool changed = false;
+    for (uint64_t observation = 0; observation < getNumberOfObservations(); ++observation) {
+        for (auto const& winning : other.getWinningSetsPerObservation(observation)) {
+            changed |= update(observation, winning);
+        }
+    }
+    return changed;
+}
+
 bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
+    if (!supportIndices.empty() && supportIndices[observation]) {
+        return supportIndices[observation]->containsSupersetOf(currently);
+    }
     for (storm::storage::BitVector winning : winningRegion[observation]) {
         if (currently.isSubsetOf(winning)) {
             return true;
@@ -308,6 +345,19 @@ uint64_t WinningRegion::getStorageSize() const {
     return result;
 }
 
+void WinningRegion::buildIndex() {
+    supportIndices.clear();
+    for (auto const& winningSets : winningRegion) {
+        supportIndices.emplace_back(storm::storage::SupportSetIndex(winningSets));
+    }
+}
+
+void WinningRegion::dropIndex(uint64_t observation) {
+    if (!supportIndices.empty()) {
+        supportIndices[observation].reset();
+    }
+}
+
 void WinningRegion::storeToFile(std::string const& path, std::string const& preamble, bool append) const {
     std::ofstream file;
     storm::utility::openFile(path, file, append);
@@ -376,8 +426,73 @@ std::pair<WinningRegion, std::string> WinningRegion::loadFromFile(std::string co
         }
     }
     storm::utility::closeFile(file);
+    wr.buildIndex();
     return {wr, preamblestream.str()};
 }
 
+void WinningRegion::storeToBinaryFile(std::string const& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << path << ".");
+    writeWord(file, binaryMagicNumber);
+    writeWord(file, observationSizes.size());
+    for (uint64_t observation = 0; observation < getNumberOfObservations(); ++observation) {
+        uint64_t size = observationSizes[observation];
+        writeWord(file, size);
+        writeWord(file, winningRegion[observation].size());
+        for (auto const& winning : winningRegion[observation]) {
+            for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+                writeWord(file, winning.getAsInt(bitIndex, std::min<uint64_t>(64, size - bitIndex)));
+            }
+        }
+    }
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not write winning region to file " << path << ".");
+}
+
+WinningRegion WinningRegion::loadFromBinaryFile(std::string const& path) {
+    std::ifstream file(path, std::ios::binary);
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << path << ".");
+    STORM_LOG_THROW(readWord(file, path) == binaryMagicNumber, storm::exceptions::WrongFormatException,
+                    "File " << path << " does not contain a winning region.");
+    uint64_t numberOfObservations = readWord(file, path);
+    std::vector<uint64_t> observationSizes;
+    std::vector<std::vector<storm::storage::BitVector>> winningSets(numberOfObservations);
+    for (uint64_t observation = 0; observation < numberOfObservations; ++observation) {
+        uint64_t size = readWord(file, path);
+        observationSizes.push_back(size);
+        uint64_t numberOfWinningSets = readWord(file, path);
+        for (uint64_t set = 0; set < numberOfWinningSets; ++set) {
+            storm::storage::BitVector winning(size);
+            for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+                winning.setFromInt(bitIndex, std::min<uint64_t>(64, size - bitIndex), readWord(file, path));
+            }
+            winningSets[observation].push_back(std::move(winning));
+        }
+    }
+    WinningRegion result(observationSizes);
+    // The stored sets are already free of dominated sets.
+    result.winningRegion = std::move(winningSets);
+    result.buildIndex();
+    return result;
+}
+
+SharedWinningRegion::SharedWinningRegion(std::vector<uint64_t> const& observationSizes) : region(observationSizes) {
+    // Intentionally left empty.
+}
+
+bool SharedWinningRegion::publish(WinningRegion const& localRegion) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return region.merge(localRegion);
+}
+
+bool SharedWinningRegion::importInto(WinningRegion& localRegion) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return localRegion.merge(region);
+}
+
+WinningRegion SharedWinningRegion::getWinningRegion() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return region;
+}
+
 }  // namespace pomdp
 }  // namespace storm
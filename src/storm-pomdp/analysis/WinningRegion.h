@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cassert>
+#include <mutex>
+#include <optional>
 #include <vector>
+#include "storm-pomdp/storage/SupportSetIndex.h"
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/storage/BitVector.h"
 
@@ -15,6 +18,11 @@ class WinningRegion {
     WinningRegion(std::vector<uint64_t> const& observationSizes = {});
 
     bool update(uint64_t observation, storm::storage::BitVector const& winning);
+    /*!
+     * Adds all winning sets of the given region (over the same observations) to this region.
+     * @return true iff this region changed.
+     */
+    bool merge(WinningRegion const& other);
     bool query(uint64_t observation, storm::storage::BitVector const& currently) const;
     bool isWinning(uint64_t observation, uint64_t offset) const {
         assert(observation < observationSizes.size());
@@ -40,12 +48,62 @@ class WinningRegion {
     bool empty() const;
     void print() const;
 
+    /*!
+     * Builds an index over the winning sets of every observation, which speeds up subsequent queries (e.g. for shielding).
+     * The index of an observation is dropped whenever its winning sets change.
+     */
+    void buildIndex();
+
     void storeToFile(std::string const& path, std::string const& preamble = "", bool append = false) const;
     static std::pair<WinningRegion, std::string> loadFromFile(std::string const& path);
 
+    /*!
+     * Stores the winning region in a compact binary format, in which every winning set takes one bit per state of its observation.
+     */
+    void storeToBinaryFile(std::string const& path) const;
+
+    /*!
+     * Loads a winning region that was stored with storeToBinaryFile. The loaded region is indexed.
+     */
+    static WinningRegion loadFromBinaryFile(std::string const& path);
+
    private:
+    void dropIndex(uint64_t observation);
+
     std::vector<std::vector<storm::storage::BitVector>> winningRegion;
     std::vector<uint64_t> observationSizes;
+    // For each observation, the index over its winning sets (if built and still up to date). Empty if no index was built.
+    std::vector<std::optional<storm::storage::SupportSetIndex>> supportIndices;
+};
+
+/*!
+ * A winning region that is shared among several concurrent searches on the same POMDP.
+ * Searches publish the winning sets they found and import the ones found by the others.
+ */
+class SharedWinningRegion {
+   public:
+    SharedWinningRegion(std::vector<uint64_t> const& observationSizes);
+
+    /*!
+     * Adds the winning sets of the given region to the shared region.
+     * @return true iff the shared region changed.
+     */
+    bool publish(WinningRegion const& localRegion);
+
+    /*!
+     * Adds the winning sets of the shared region to the given region.
+     * @return true iff the given region changed.
+     */
+    bool importInto(WinningRegion& localRegion) const;
+
+    /*!
+     * Retrieves a copy of the current shared region.
+     */
+    WinningRegion getWinningRegion() const;
+
+   private:
+    mutable std::mutex mutex;
+    WinningRegion region;
 };
 }  // namespace pomdp
 }  // namespace storm
\ No newline at end of file
@@ -12,7 +12,9 @@ WinningRegionQueryInterface<ValueType>::WinningRegionQueryInterface(storm::model
     for (uint64_t observation = 0; observation < nrObservations; ++observation) {
         statesPerObservation.push_back(std::vector<uint64_t>());
     }
+    stateOffsets.reserve(pomdp.getNumberOfStates());
     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        stateOffsets.push_back(statesPerObservation[pomdp.getObservation(state)].size());
         statesPerObservation[pomdp.getObservation(state)].push_back(state);
     }
 }
@@ -21,19 +23,10 @@ template<typename ValueType>
 bool WinningRegionQueryInterface<ValueType>::isInWinningRegion(storm::storage::BitVector const& beliefSupport) const {
     STORM_LOG_ASSERT(beliefSupport.getNumberOfSetBits() > 0, "One cannot think one is literally nowhere");
     uint64_t observation = pomdp.getObservation(beliefSupport.getNextSetIndex(0));
-    // TODO consider optimizations after testing.
     storm::storage::BitVector queryVector(statesPerObservation[observation].size());
-    auto stateWithObsIt = statesPerObservation[observation].begin();
-    uint64_t offset = 0;
     for (uint64_t possibleState : beliefSupport) {
         STORM_LOG_ASSERT(pomdp.getObservation(possibleState) == observation, "Support must be observation-consistent");
-        while (possibleState > *stateWithObsIt) {
-            stateWithObsIt++;
-            offset++;
-        }
-        if (possibleState == *stateWithObsIt) {
-            queryVector.set(offset);
-        }
+        queryVector.set(stateOffsets[possibleState]);
     }
     return winningRegion.query(observation, queryVector);
 }
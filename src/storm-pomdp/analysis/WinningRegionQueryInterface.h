@@ -22,6 +22,8 @@ class WinningRegionQueryInterface {
     WinningRegion const& winningRegion;
     // TODO consider sharing this.
     std::vector<std::vector<uint64_t>> statesPerObservation;
+    // For each state, its offset among the states with the same observation.
+    std::vector<uint64_t> stateOffsets;
 };
 }  // namespace pomdp
 }  // namespace storm
\ No newline at end of file
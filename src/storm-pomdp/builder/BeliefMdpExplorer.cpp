@@ -64,6 +64,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     lowerValueBounds.clear();
     upperValueBounds.clear();
     values.clear();
+    previousSchedulerChoices.clear();
     exploredMdpTransitions.clear();
     exploredChoiceIndices.clear();
     previousChoiceIndices.clear();
@@ -206,6 +207,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::restoreExplorationState() {
     lowerValueBounds = explorationStorage.storedLowerValueBounds;
     upperValueBounds = explorationStorage.storedUpperValueBounds;
     values = explorationStorage.storedValues;
+    previousSchedulerChoices.clear();
     status = Status::Exploring;
     targetStates = explorationStorage.storedTargetStates;
 
@@ -235,6 +237,19 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextBeliefsToExplore(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    res.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplorePrioState.size()));
+    // States are popped from the end of the queue (see exploreNextState)
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfBeliefs; ++stateIt) {
+        res.push_back(mdpStateToBeliefIdMap[stateIt->second]);
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -550,6 +565,12 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::finishExploration() {
             remappedStateToBeliefIdMap[entry.second] = mdpStateToBeliefIdMap[entry.first];
         }
         mdpStateToBeliefIdMap = remappedStateToBeliefIdMap;
+        // The values are used as hints for the next check, so they need to be remapped as well
+        std::vector<ValueType> remappedValues(values);
+        for (auto const &entry : stateRemapping) {
+            remappedValues[entry.second] = values[entry.first];
+        }
+        values = std::move(remappedValues);
         for (auto const &beliefMdpState : beliefIdToMdpStateMap) {
             if (stateRemapping.find(beliefMdpState.second) != stateRemapping.end()) {
                 beliefIdToMdpStateMap[beliefMdpState.first] = stateRemapping[beliefMdpState.second];
@@ -782,6 +803,9 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::dropUnexploredStates() {
     storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
     storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+    if (!previousSchedulerChoices.empty()) {
+        storm::utility::vector::filterVectorInPlace(previousSchedulerChoices, relevantMdpStates);
+    }
 
     {  // mdpStateToChoiceLabelsMap
         if (!mdpStateToChoiceLabelsMap.empty()) {
@@ -922,6 +946,14 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(s
     if (res) {
         values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
         scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+        // Keep the choices such that they can serve as a hint in case the MDP is re-explored and checked again
+        previousSchedulerChoices.assign(exploredMdp->getNumberOfStates(), 0);
+        for (uint64_t state = 0; state < previousSchedulerChoices.size(); ++state) {
+            auto const &choice = scheduler->getChoice(state);
+            if (choice.isDefined() && choice.isDeterministic()) {
+                previousSchedulerChoices[state] = choice.getDeterministicChoice();
+            }
+        }
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                   "Computed values are smaller than the lower bound.");
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -1085,6 +1117,20 @@ BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shar
     auto task = storm::api::createTask<ValueType>(property, false);
     auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
     hint.setResultHint(values);
+    // When re-checking a refined MDP, the previous scheduler serves as initial scheduler. We only do this if the MDP has no end components among the maybe
+    // states (i.e. for minimal probabilities or maximal rewards) since otherwise the scheduler might not be valid for the refined MDP.
+    bool rewards = property->isRewardOperatorFormula();
+    bool minimize = storm::solver::minimize(property->asOperatorFormula().getOptimalityType());
+    if (!previousSchedulerChoices.empty() && minimize != rewards) {
+        STORM_LOG_ASSERT(previousSchedulerChoices.size() == exploredMdp->getNumberOfStates(), "Unexpected number of scheduler choices.");
+        storm::storage::Scheduler<ValueType> schedulerHint(exploredMdp->getNumberOfStates());
+        for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+            uint64_t choice = previousSchedulerChoices[state];
+            // The number of choices might have changed (e.g. due to clipping)
+            schedulerHint.setChoice(choice < exploredMdp->getTransitionMatrix().getRowGroupSize(state) ? choice : 0, state);
+        }
+        hint.setSchedulerHint(std::move(schedulerHint));
+    }
     auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
     task.setHint(hintPtr);
     task.setProduceSchedulers();
@@ -1148,6 +1194,10 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::insertValueHints(ValueType c
     upperValueBounds.push_back(upperBound);
     // Take the middle value as a hint
     values.push_back((lowerBound + upperBound) / storm::utility::convertNumber<ValueType, uint64_t>(2));
+    if (!previousSchedulerChoices.empty()) {
+        // New states have no previous choice
+        previousSchedulerChoices.push_back(0);
+    }
     STORM_LOG_ASSERT(lowerValueBounds.size() == getCurrentNumberOfMdpStates(), "Value vectors have different size then number of available states.");
     STORM_LOG_ASSERT(lowerValueBounds.size() == upperValueBounds.size() && values.size() == upperValueBounds.size(), "Value vectors have inconsistent size.");
 }
@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of the states that are explored next, provided that no further states are added to the exploration queue.
+     * @param maxNumberOfBeliefs The maximal number of beliefs that are retrieved.
+     */
+    std::vector<BeliefId> getNextBeliefsToExplore(uint64_t maxNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -315,6 +321,7 @@ class BeliefMdpExplorer {
     std::vector<ValueType> lowerValueBounds;
     std::vector<ValueType> upperValueBounds;
     std::vector<ValueType> values;  // Contains an estimate during building and the actual result after a check has performed
+    std::vector<uint64_t> previousSchedulerChoices;  // The choices of the scheduler computed in the last check (if the MDP is currently re-explored)
     std::optional<storm::storage::BitVector> optimalChoices;
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
@@ -1,5 +1,9 @@
 
 #include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/geometry/ReduceVertexCloud.h"
 #include "storm/storage/geometry/nativepolytopeconversion/QuickHull.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -48,12 +52,23 @@ storm::models::sparse::Pomdp<ValueType> const& BeliefStateManager<ValueType>::ge
 template<typename ValueType>
 void BeliefStateManager<ValueType>::setRiskPerState(std::vector<ValueType> const& risk) {
     riskPerState = risk;
+    riskPerObservationAndOffset.clear();
+    for (auto const& states : statePerObservationAndOffset) {
+        riskPerObservationAndOffset.emplace_back();
+        for (uint64_t state : states) {
+            riskPerObservationAndOffset.back().push_back(riskPerState.at(state));
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& BeliefStateManager<ValueType>::getRiskPerOffset(uint32_t observation) const {
+    return riskPerObservationAndOffset.at(observation);
 }
 
 template<typename ValueType>
 uint64_t BeliefStateManager<ValueType>::getFreshId() {
-    beliefIdCounter++;
-    return beliefIdCounter;
+    return ++beliefIdCounter;
 }
 
 template<typename ValueType>
@@ -164,6 +179,27 @@ std::map<uint64_t, ValueType> const& SparseBeliefState<ValueType>::getBeliefMap(
     return belief;
 }
 
+template<typename ValueType>
+ValueType SparseBeliefState<ValueType>::getDistance(SparseBeliefState const& other) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    auto it = belief.begin();
+    auto otherIt = other.belief.begin();
+    while (it != belief.end() || otherIt != other.belief.end()) {
+        if (otherIt == other.belief.end() || (it != belief.end() && it->first < otherIt->first)) {
+            result += storm::utility::abs<ValueType>(it->second);
+            ++it;
+        } else if (it == belief.end() || otherIt->first < it->first) {
+            result += storm::utility::abs<ValueType>(otherIt->second);
+            ++otherIt;
+        } else {
+            result += storm::utility::abs<ValueType>(it->second - otherIt->second);
+            ++it;
+            ++otherIt;
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 void SparseBeliefState<ValueType>::setSupport(storm::storage::BitVector& support) const {
     for (auto const& entry : belief) {
@@ -233,7 +269,7 @@ bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDe
     if (lhs.observation != rhs.observation) {
         return false;
     }
-    storm::utility::ConstantsComparator<ValueType> cmp(0.00001, true);
+    storm::utility::ConstantsComparator<ValueType> cmp(storm::utility::convertNumber<ValueType>(0.00001), true);
     auto lhsIt = lhs.belief.begin();
     auto rhsIt = rhs.belief.begin();
     while (lhsIt != lhs.belief.end()) {
@@ -249,9 +285,12 @@ bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDe
 
 template<typename ValueType>
 ObservationDenseBeliefState<ValueType>::ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state)
-    : manager(manager), belief(manager->numberOfStatesPerObservation(manager->getObservation(state))) {
+    : manager(manager), belief(manager->numberOfStatesPerObservation(manager->getObservation(state)), storm::utility::zero<ValueType>()), id(0), prevId(0) {
+    id = manager->getFreshId();
     observation = manager->getObservation(state);
     belief[manager->getObservationOffset(state)] = storm::utility::one<ValueType>();
+    boost::hash_combine(prestoredhash, manager->getObservationOffset(state));
+    risk = manager->getRisk(state);
 }
 
 template<typename ValueType>
@@ -264,62 +303,64 @@ ObservationDenseBeliefState<ValueType>::ObservationDenseBeliefState(std::shared_
 
 template<typename ValueType>
 void ObservationDenseBeliefState<ValueType>::update(uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState>& previousBeliefs) const {
-    updateHelper({{}}, {storm::utility::zero<ValueType>()}, 0, newObservation, previousBeliefs);
-}
-
-template<typename ValueType>
-void ObservationDenseBeliefState<ValueType>::updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums,
-                                                          uint64_t currentEntry, uint32_t newObservation,
-                                                          std::unordered_set<ObservationDenseBeliefState<ValueType>>& previousBeliefs) const {
-    while (currentEntry != belief.size() && storm::utility::isZero(belief[currentEntry])) {
-        currentEntry++;
-    }
-    if (currentEntry == belief.size()) {
-        for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-            auto const& partialBelief = partialBeliefs[i];
-            auto const& sum = sums[i];
-            if (storm::utility::isZero(sum)) {
-                continue;
+    auto const& pomdp = manager->getPomdp();
+    uint64_t const newSize = manager->numberOfStatesPerObservation(newObservation);
+    // Partial beliefs are stored contiguously, each as a dense vector over the states with the new observation followed by the sum of its entries.
+    uint64_t const stride = newSize + 1;
+    std::vector<ValueType> partialBeliefs(stride, storm::utility::zero<ValueType>());
+    uint64_t numberOfPartialBeliefs = 1;
+    std::vector<std::pair<uint64_t, ValueType>> contribution;
+    for (uint64_t currentEntry = 0; currentEntry < belief.size(); ++currentEntry) {
+        if (storm::utility::isZero(belief[currentEntry])) {
+            continue;
+        }
+        uint64_t state = manager->getState(observation, currentEntry);
+        uint64_t numberOfRows = pomdp.getNumberOfChoices(state);
+        std::vector<ValueType> newPartialBeliefs;
+        newPartialBeliefs.reserve(numberOfPartialBeliefs * numberOfRows * stride);
+        for (auto row = pomdp.getNondeterministicChoiceIndices()[state]; row < pomdp.getNondeterministicChoiceIndices()[state + 1]; ++row) {
+            // The contribution of the row does not depend on the partial belief, so it is computed only once.
+            contribution.clear();
+            ValueType rowSum = storm::utility::zero<ValueType>();
+            for (auto const& transition : pomdp.getTransitionMatrix().getRow(row)) {
+                if (newObservation == pomdp.getObservation(transition.getColumn())) {
+                    contribution.emplace_back(manager->getObservationOffset(transition.getColumn()), transition.getValue() * belief[currentEntry]);
+                    rowSum += contribution.back().second;
+                }
             }
-            std::size_t newHash = 0;
-            ValueType risk = storm::utility::zero<ValueType>();
-            std::vector<ValueType> finalBelief(manager->numberOfStatesPerObservation(observation), storm::utility::zero<ValueType>());
-            for (auto& entry : partialBelief) {
-                assert(!storm::utility::isZero(sum));
-                finalBelief[manager->getObservationOffset(entry.first)] = (entry.second / sum);
-                // boost::hash_combine(newHash, std::hash<ValueType>()(entry.second));
-                boost::hash_combine(newHash, entry.first);
-                risk += entry.second / sum * manager->getRisk(entry.first);
+            for (uint64_t i = 0; i < numberOfPartialBeliefs; ++i) {
+                uint64_t begin = newPartialBeliefs.size();
+                newPartialBeliefs.insert(newPartialBeliefs.end(), partialBeliefs.begin() + i * stride, partialBeliefs.begin() + (i + 1) * stride);
+                for (auto const& entry : contribution) {
+                    newPartialBeliefs[begin + entry.first] += entry.second;
+                }
+                newPartialBeliefs[begin + newSize] += rowSum;
             }
-            previousBeliefs.insert(ObservationDenseBeliefState<ValueType>(manager, newObservation, finalBelief, newHash, risk, id));
         }
-    } else {
-        uint64_t state = manager->getState(observation, currentEntry);
-        uint64_t nextEntry = currentEntry + 1;
-        std::vector<std::map<uint64_t, ValueType>> newPartialBeliefs;
-        std::vector<ValueType> newSums;
-        for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-            for (auto row = manager->getPomdp().getNondeterministicChoiceIndices()[state];
-                 row < manager->getPomdp().getNondeterministicChoiceIndices()[state + 1]; ++row) {
-                std::map<uint64_t, ValueType> newPartialBelief = partialBeliefs[i];
-                ValueType newSum = sums[i];
-                for (auto const& transition : manager->getPomdp().getTransitionMatrix().getRow(row)) {
-                    if (newObservation != manager->getPomdp().getObservation(transition.getColumn())) {
-                        continue;
-                    }
+        partialBeliefs = std::move(newPartialBeliefs);
+        numberOfPartialBeliefs *= numberOfRows;
+    }
 
-                    if (newPartialBelief.count(transition.getColumn()) == 0) {
-                        newPartialBelief[transition.getColumn()] = transition.getValue() * belief[currentEntry];
-                    } else {
-                        newPartialBelief[transition.getColumn()] += transition.getValue() * belief[currentEntry];
-                    }
-                    newSum += transition.getValue() * belief[currentEntry];
-                }
-                newPartialBeliefs.push_back(newPartialBelief);
-                newSums.push_back(newSum);
+    std::vector<ValueType> const& riskPerOffset = manager->getRiskPerOffset(newObservation);
+    for (uint64_t i = 0; i < numberOfPartialBeliefs; ++i) {
+        ValueType const* partialBelief = partialBeliefs.data() + i * stride;
+        ValueType const& sum = partialBelief[newSize];
+        if (storm::utility::isZero(sum)) {
+            continue;
+        }
+        std::vector<ValueType> finalBelief(newSize);
+        ValueType risk = storm::utility::zero<ValueType>();
+        for (uint64_t offset = 0; offset < newSize; ++offset) {
+            finalBelief[offset] = partialBelief[offset] / sum;
+            risk += finalBelief[offset] * riskPerOffset[offset];
+        }
+        std::size_t newHash = 0;
+        for (uint64_t offset = 0; offset < newSize; ++offset) {
+            if (!storm::utility::isZero(finalBelief[offset])) {
+                boost::hash_combine(newHash, offset);
             }
         }
-        updateHelper(newPartialBeliefs, newSums, nextEntry, newObservation, previousBeliefs);
+        previousBeliefs.insert(ObservationDenseBeliefState<ValueType>(manager, newObservation, finalBelief, newHash, risk, id));
     }
 }
 
@@ -330,7 +371,7 @@ std::size_t ObservationDenseBeliefState<ValueType>::hash() const noexcept {
 
 template<typename ValueType>
 ValueType ObservationDenseBeliefState<ValueType>::get(uint64_t state) const {
-    if (manager->getObservation(state) != state) {
+    if (manager->getObservation(state) != observation) {
         return storm::utility::zero<ValueType>();
     }
     return belief[manager->getObservationOffset(state)];
@@ -343,12 +384,40 @@ ValueType ObservationDenseBeliefState<ValueType>::getRisk() const {
 
 template<typename ValueType>
 uint64_t ObservationDenseBeliefState<ValueType>::getSupportSize() const {
-    return belief.size();
+    return manager->getNumberOfStates();
 }
 
 template<typename ValueType>
 void ObservationDenseBeliefState<ValueType>::setSupport(storm::storage::BitVector& support) const {
-    storm::utility::vector::setNonzeroIndices(belief, support);
+    for (uint64_t offset = 0; offset < belief.size(); ++offset) {
+        if (!storm::utility::isZero(belief[offset])) {
+            support.set(manager->getState(observation, offset), true);
+        }
+    }
+}
+
+template<typename ValueType>
+std::map<uint64_t, ValueType> ObservationDenseBeliefState<ValueType>::getBeliefMap() const {
+    std::map<uint64_t, ValueType> result;
+    for (uint64_t offset = 0; offset < belief.size(); ++offset) {
+        if (!storm::utility::isZero(belief[offset])) {
+            result.emplace_hint(result.end(), manager->getState(observation, offset), belief[offset]);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType ObservationDenseBeliefState<ValueType>::getDistance(ObservationDenseBeliefState const& other) const {
+    if (observation != other.observation) {
+        // The supports are disjoint.
+        return storm::utility::convertNumber<ValueType>(2);
+    }
+    ValueType result = storm::utility::zero<ValueType>();
+    for (uint64_t offset = 0; offset < belief.size(); ++offset) {
+        result += storm::utility::abs<ValueType>(belief[offset] - other.belief[offset]);
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -390,6 +459,7 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::reset(uint32_t obser
         }
     }
     lastObservation = observation;
+    numberOfPrunedBeliefs = 0;
     return hit;
 }
 
@@ -398,17 +468,93 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::track(uint64_t newOb
     STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Cannot track without a belief (need to reset).");
     std::unordered_set<BeliefState> newBeliefs;
     storm::utility::Stopwatch trackTimer(true);
-    for (auto const& belief : beliefs) {
-        belief.update(newObservation, newBeliefs);
-        if (options.trackTimeOut > 0 && static_cast<uint64_t>(trackTimer.getTimeInMilliseconds()) > options.trackTimeOut) {
+    auto isTimedOut = [this, &trackTimer]() {
+        return options.trackTimeOut > 0 && static_cast<uint64_t>(trackTimer.getTimeInMilliseconds()) > options.trackTimeOut;
+    };
+    if (options.parallelUpdates) {
+#ifdef STORM_HAVE_INTELTBB
+        std::vector<BeliefState const*> currentBeliefs;
+        currentBeliefs.reserve(beliefs.size());
+        for (auto const& belief : beliefs) {
+            currentBeliefs.push_back(&belief);
+        }
+        // Each belief is updated into its own set, the sets are merged afterwards.
+        std::vector<std::unordered_set<BeliefState>> successors(currentBeliefs.size());
+        std::atomic<bool> timedOut(false);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentBeliefs.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t i = range.begin(); i < range.end() && !timedOut; ++i) {
+                currentBeliefs[i]->update(newObservation, successors[i]);
+                if (isTimedOut()) {
+                    timedOut = true;
+                }
+            }
+        });
+        if (timedOut) {
             return false;
         }
+        for (auto& successorsOfBelief : successors) {
+            newBeliefs.merge(successorsOfBelief);
+        }
+#else
+        STORM_LOG_WARN("Parallel belief updates require Intel TBB. Updating sequentially.");
+        options.parallelUpdates = false;
+#endif
     }
-    beliefs = newBeliefs;
+    if (!options.parallelUpdates) {
+        for (auto const& belief : beliefs) {
+            belief.update(newObservation, newBeliefs);
+            if (isTimedOut()) {
+                return false;
+            }
+        }
+    }
+    beliefs = std::move(newBeliefs);
     lastObservation = newObservation;
+    prune();
     return !beliefs.empty();
 }
 
+template<typename ValueType, typename BeliefState>
+void NondeterministicBeliefTracker<ValueType, BeliefState>::prune() {
+    bool pruneByRisk = options.riskThreshold.has_value();
+    bool pruneByDominance = !storm::utility::isZero(options.dominanceDistance);
+    bool pruneBySize = options.maxNumberOfBeliefs > 0 && beliefs.size() > options.maxNumberOfBeliefs;
+    if (!pruneByRisk && !pruneByDominance && !pruneBySize) {
+        return;
+    }
+    // Consider the beliefs by decreasing risk, so that beliefs with a high risk are kept.
+    std::vector<BeliefState const*> orderedBeliefs;
+    orderedBeliefs.reserve(beliefs.size());
+    for (auto const& belief : beliefs) {
+        orderedBeliefs.push_back(&belief);
+    }
+    std::sort(orderedBeliefs.begin(), orderedBeliefs.end(), [](BeliefState const* lhs, BeliefState const* rhs) { return lhs->getRisk() > rhs->getRisk(); });
+    std::vector<BeliefState const*> keptBeliefs;
+    for (auto belief : orderedBeliefs) {
+        if (options.maxNumberOfBeliefs > 0 && keptBeliefs.size() >= options.maxNumberOfBeliefs) {
+            break;
+        }
+        if (pruneByRisk && !keptBeliefs.empty() && belief->getRisk() < options.riskThreshold.value()) {
+            break;
+        }
+        if (pruneByDominance && std::any_of(keptBeliefs.begin(), keptBeliefs.end(), [&](BeliefState const* kept) {
+                return belief->getDistance(*kept) <= options.dominanceDistance;
+            })) {
+            continue;
+        }
+        keptBeliefs.push_back(belief);
+    }
+    if (keptBeliefs.size() == beliefs.size()) {
+        return;
+    }
+    numberOfPrunedBeliefs += beliefs.size() - keptBeliefs.size();
+    std::unordered_set<BeliefState> newBeliefs;
+    for (auto belief : keptBeliefs) {
+        newBeliefs.insert(*belief);
+    }
+    beliefs = std::move(newBeliefs);
+}
+
 template<typename ValueType, typename BeliefState>
 ValueType NondeterministicBeliefTracker<ValueType, BeliefState>::getCurrentRisk(bool max) {
     STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Risk is only defined for beliefs (run reset() first).");
@@ -489,16 +635,24 @@ bool NondeterministicBeliefTracker<ValueType, BeliefState>::hasTimedOut() const
     return reductionTimedOut;
 }
 
+template<typename ValueType, typename BeliefState>
+uint64_t NondeterministicBeliefTracker<ValueType, BeliefState>::getNumberOfPrunedBeliefs() const {
+    return numberOfPrunedBeliefs;
+}
+
 template class SparseBeliefState<double>;
 template bool operator==(SparseBeliefState<double> const&, SparseBeliefState<double> const&);
 template class NondeterministicBeliefTracker<double, SparseBeliefState<double>>;
-// template class ObservationDenseBeliefState<double>;
-// template bool operator==(ObservationDenseBeliefState<double> const&, ObservationDenseBeliefState<double> const&);
-// template class NondeterministicBeliefTracker<double, ObservationDenseBeliefState<double>>;
+template class ObservationDenseBeliefState<double>;
+template bool operator==(ObservationDenseBeliefState<double> const&, ObservationDenseBeliefState<double> const&);
+template class NondeterministicBeliefTracker<double, ObservationDenseBeliefState<double>>;
 
 template class SparseBeliefState<storm::RationalNumber>;
 template bool operator==(SparseBeliefState<storm::RationalNumber> const&, SparseBeliefState<storm::RationalNumber> const&);
 template class NondeterministicBeliefTracker<storm::RationalNumber, SparseBeliefState<storm::RationalNumber>>;
+template class ObservationDenseBeliefState<storm::RationalNumber>;
+template bool operator==(ObservationDenseBeliefState<storm::RationalNumber> const&, ObservationDenseBeliefState<storm::RationalNumber> const&);
+template class NondeterministicBeliefTracker<storm::RationalNumber, ObservationDenseBeliefState<storm::RationalNumber>>;
 
 }  // namespace generator
 }  // namespace storm
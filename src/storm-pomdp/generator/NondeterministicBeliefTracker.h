@@ -1,4 +1,6 @@
 #pragma once
+#include <atomic>
+#include <optional>
 #include "storm/models/sparse/Pomdp.h"
 
 namespace storm {
@@ -15,6 +17,10 @@ class BeliefStateManager {
     uint64_t getActionsForObservation(uint32_t observation) const;
     ValueType getRisk(uint64_t) const;
     void setRiskPerState(std::vector<ValueType> const& risk);
+    /**
+     * The risk of the states with the given observation, ordered by their offset.
+     */
+    std::vector<ValueType> const& getRiskPerOffset(uint32_t observation) const;
     uint64_t getFreshId();
     uint32_t getObservation(uint64_t state) const;
     uint64_t getObservationOffset(uint64_t state) const;
@@ -25,8 +31,10 @@ class BeliefStateManager {
    private:
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
     std::vector<ValueType> riskPerState;
+    std::vector<std::vector<ValueType>> riskPerObservationAndOffset;
     std::vector<uint64_t> numberActionsPerObservation;
-    uint64_t beliefIdCounter = 0;
+    // Beliefs may be updated concurrently.
+    std::atomic<uint64_t> beliefIdCounter{0};
     std::vector<uint64_t> observationOffsetId;
     std::vector<std::vector<uint64_t>> statePerObservationAndOffset;
 };
@@ -68,6 +76,10 @@ class SparseBeliefState {
     uint64_t getSupportSize() const;
     void setSupport(storm::storage::BitVector&) const;
     std::map<uint64_t, ValueType> const& getBeliefMap() const;
+    /**
+     * Get the L1-distance to the other belief
+     */
+    ValueType getDistance(SparseBeliefState const& other) const;
 
     friend bool operator== <>(SparseBeliefState<ValueType> const& lhs, SparseBeliefState<ValueType> const& rhs);
 
@@ -86,18 +98,24 @@ class SparseBeliefState {
     uint64_t prevId;
 };
 
-/**
- * ObservationDenseBeliefState stores beliefs in a dense format (per observation).
- */
 template<typename ValueType>
 class ObservationDenseBeliefState;
 template<typename ValueType>
 bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDenseBeliefState<ValueType> const& rhs);
 
+/**
+ * ObservationDenseBeliefState stores beliefs in a dense format (per observation).
+ * Updates work on contiguous vectors over the states with the new observation, which makes them amenable to vectorization.
+ */
 template<typename ValueType>
 class ObservationDenseBeliefState {
    public:
     ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state);
+    /**
+     * Update the belief using the new observation
+     * @param newObservation
+     * @param previousBeliefs put the new belief in this set
+     */
     void update(uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState>& previousBeliefs) const;
     std::size_t hash() const noexcept;
     ValueType get(uint64_t state) const;
@@ -105,11 +123,14 @@ class ObservationDenseBeliefState {
     std::string toString() const;
     uint64_t getSupportSize() const;
     void setSupport(storm::storage::BitVector&) const;
+    std::map<uint64_t, ValueType> getBeliefMap() const;
+    /**
+     * Get the L1-distance to the other belief
+     */
+    ValueType getDistance(ObservationDenseBeliefState const& other) const;
     friend bool operator== <>(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDenseBeliefState<ValueType> const& rhs);
 
    private:
-    void updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums, uint64_t currentEntry,
-                      uint32_t newObservation, std::unordered_set<ObservationDenseBeliefState<ValueType>>& previousBeliefs) const;
     ObservationDenseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint32_t observation, std::vector<ValueType> const& belief,
                                 std::size_t newHash, ValueType const& risk, uint64_t prevId);
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
@@ -136,6 +157,15 @@ class NondeterministicBeliefTracker {
         uint64_t trackTimeOut = 0;
         uint64_t timeOut = 0;  // for reduction, in milliseconds, 0 is no timeout
         ValueType wiggle;      // tolerance, anything above 0 means that we are incomplete.
+        // Update the beliefs concurrently (requires Intel TBB).
+        bool parallelUpdates = false;
+        // The following options prune the beliefs after each step, which means that we are incomplete.
+        // Keep at most this many beliefs (those with the highest risk), 0 is no limit.
+        uint64_t maxNumberOfBeliefs = 0;
+        // Drop beliefs with a lower risk. The belief with the highest risk is always kept.
+        std::optional<ValueType> riskThreshold;
+        // Drop beliefs within this L1-distance of a kept belief with at least the same risk.
+        ValueType dominanceDistance = ValueType();
     };
     NondeterministicBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp,
                                   typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options = Options());
@@ -193,12 +223,23 @@ class NondeterministicBeliefTracker {
      * @return
      */
     bool hasTimedOut() const;
+    /**
+     * How many beliefs were pruned since the last reset?
+     * @return
+     */
+    uint64_t getNumberOfPrunedBeliefs() const;
 
    private:
+    /**
+     * Prune the current beliefs according to the options.
+     */
+    void prune();
+
     storm::models::sparse::Pomdp<ValueType> const& pomdp;
     std::shared_ptr<BeliefStateManager<ValueType>> manager;
     std::unordered_set<BeliefState> beliefs;
     bool reductionTimedOut = false;
+    uint64_t numberOfPrunedBeliefs = 0;
     Options options;
     uint32_t lastObservation;
 };
@@ -322,6 +322,7 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         overApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
             options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        overApproxBeliefManager->setTriangulationCacheSize(options.triangulationCacheSize);
         if (rewardModelName) {
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
@@ -844,6 +845,11 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             fixPoint = false;
         }
 
+        if (options.parallelExpansionBatchSize > 0 &&
+            !beliefManager->hasPreparedExpansion(overApproximation->getNextBeliefsToExplore(1).front(), observationResolutionVector)) {
+            // Expand and triangulate the next beliefs in parallel. Their ids are assigned (in the usual order) when they are retrieved below
+            beliefManager->prepareExpansions(overApproximation->getNextBeliefsToExplore(options.parallelExpansionBatchSize), observationResolutionVector);
+        }
         uint64_t currId = overApproximation->exploreNextState();
         bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
         if (!hasOldBehavior) {
@@ -1100,6 +1106,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
             underApproximation->storeExplorationState();
             stateStored = true;
         }
+        if (options.parallelExpansionBatchSize > 0 && !beliefManager->hasPreparedExpansion(underApproximation->getNextBeliefsToExplore(1).front())) {
+            beliefManager->prepareExpansions(underApproximation->getNextBeliefsToExplore(options.parallelExpansionBatchSize));
+        }
         uint64_t currId = underApproximation->exploreNextState();
         uint32_t currObservation = beliefManager->getBeliefObservation(currId);
         uint64_t addedActions = 0;
@@ -29,6 +29,8 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // If not zero, the successors of this many beliefs from the exploration queue are computed (and triangulated) in parallel.
+    uint64_t parallelExpansionBatchSize = 0;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
@@ -55,6 +57,7 @@ struct BeliefExplorationPomdpModelCheckerOptions {
                                      ? storm::utility::zero<ValueType>()
                                      : storm::utility::convertNumber<ValueType>(1e-9);  /// Used to decide whether two beliefs are equal
     bool dynamicTriangulation = true;  // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+    uint64_t triangulationCacheSize = 1 << 16;  // The number of triangulations of successor beliefs that are cached (0 disables the cache)
 
     storm::builder::ExplorationHeuristic explorationHeuristic = storm::builder::ExplorationHeuristic::BreadthFirst;
 };
@@ -1,9 +1,11 @@
 #include "storm-pomdp/modelchecker/PreprocessingPomdpValueBoundsModelChecker.h"
+#include <optional>
 #include <random>
 
 #include "storm-pomdp/storage/PomdpMemory.h"
 #include "storm-pomdp/transformer/PomdpMemoryUnfolder.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/storage/Scheduler.h"
 
@@ -210,12 +212,27 @@ typename PreprocessingPomdpValueBoundsModelChecker<ValueType>::ValueBounds Prepr
     std::vector<storm::storage::Scheduler<ValueType>> guessedSchedulers;
     std::shared_ptr<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>> guessedSchedulerPair;
     std::vector<std::pair<double, bool>> guessParameters({{0.875, false}, {0.875, true}, {0.75, false}, {0.75, true}});
-    for (auto const& pars : guessParameters) {
-        guessedSchedulerPair = std::make_shared<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>>(
-            computeValuesForGuessedScheduler(env, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
-                                             storm::utility::convertNumber<ValueType>(pars.first), pars.second));
-        guessedSchedulerValues.push_back(guessedSchedulerPair->first);
-        guessedSchedulers.push_back(guessedSchedulerPair->second);
+    // The initial guesses only read the POMDP and the fully observable values and each checks its own induced model, so they can be computed concurrently.
+    std::vector<std::optional<std::pair<std::vector<ValueType>, storm::storage::Scheduler<ValueType>>>> initialGuesses(guessParameters.size());
+    auto computeInitialGuess = [&](uint64_t guess) {
+        initialGuesses[guess] = computeValuesForGuessedScheduler(env, fullyObservableResult, actionBasedRewardsPtr, formula, info, underlyingMdp,
+                                                                 storm::utility::convertNumber<ValueType>(guessParameters[guess].first),
+                                                                 guessParameters[guess].second);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, guessParameters.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t guess = range.begin(); guess < range.end(); ++guess) {
+            computeInitialGuess(guess);
+        }
+    });
+#else
+    for (uint64_t guess = 0; guess < guessParameters.size(); ++guess) {
+        computeInitialGuess(guess);
+    }
+#endif
+    for (auto& initialGuess : initialGuesses) {
+        guessedSchedulerValues.push_back(std::move(initialGuess->first));
+        guessedSchedulers.push_back(std::move(initialGuess->second));
     }
 
     // compute the 'best' guess and do a few iterations on it
@@ -1,5 +1,11 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+#include <iterator>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/solver/GlpkLpSolver.h"
@@ -30,60 +36,11 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
     }
 }
 
-template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
-}
-
-template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
-    // If the sizes are different, we don't have to look inside the belief
-    if (lhBelief.size() != rhBelief.size()) {
-        return false;
-    }
-    // Assumes that beliefs are ordered
-    auto lhIt = lhBelief.begin();
-    auto rhIt = rhBelief.begin();
-    while (lhIt != lhBelief.end() || rhIt != rhBelief.end()) {
-        // Iterate over the entries simultaneously, beliefs not equal if they contain either different states or different values for the same state
-        if (lhIt->first != rhIt->first || std::fabs(lhIt->second - rhIt->second) > 1e-15) {
-            return false;
-        }
-        ++lhIt;
-        ++rhIt;
-    }
-    return lhIt == lhBelief.end() && rhIt == rhBelief.end();
-}
-
-template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, entry.second);
-    }
-    return seed;
-}
-
-template<>
-std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(const BeliefType &belief) const {
-    std::size_t seed = 0;
-    // Assumes that beliefs are ordered
-    for (auto const &entry : belief) {
-        boost::hash_combine(seed, entry.first);
-        boost::hash_combine(seed, round(storm::utility::convertNumber<double>(entry.second) * 1e15));
-    }
-    return seed;
-}
-
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision,
                                                                     TriangulationMode const &triangulationMode)
-    : pomdp(pomdp), triangulationMode(triangulationMode) {
+    : pomdp(pomdp), beliefStorage(pomdp.getObservations()), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
     initialBeliefId = computeInitialBelief();
 }
 
@@ -178,7 +135,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefM
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-    return getBeliefObservation(getBelief(beliefId));
+    return beliefStorage.getObservation(beliefId);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -195,7 +152,8 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -204,7 +162,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -221,7 +179,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefStorage.size();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -248,21 +206,73 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareExpansions(std::vector<BeliefId> const &beliefIds,
+                                                                             std::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+    std::vector<std::vector<std::vector<PreparedSuccessor>>> expansions(beliefIds.size());
+    // The expansions only read from this manager, so they can be computed independently. Ids are assigned when the expansions are retrieved.
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, beliefIds.size()), [&](tbb::blocked_range<uint64_t> const &range) {
+        for (uint64_t i = range.begin(); i < range.end(); ++i) {
+            expansions[i] = computeExpansion(beliefIds[i], observationResolutions);
+        }
+    });
+#else
+    for (uint64_t i = 0; i < beliefIds.size(); ++i) {
+        expansions[i] = computeExpansion(beliefIds[i], observationResolutions);
+    }
+#endif
+    preparedExpansions.clear();
+    preparedResolutions = observationResolutions;
+    for (uint64_t i = 0; i < beliefIds.size(); ++i) {
+        preparedExpansions.emplace(beliefIds[i], std::move(expansions[i]));
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPreparedExpansion(
+    BeliefId const &beliefId, std::optional<std::vector<BeliefValueType>> const &observationResolutions) const {
+    return preparedExpansions.count(beliefId) > 0 && preparedResolutions == observationResolutions;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::vector<typename BeliefManager<PomdpType, BeliefValueType, StateType>::PreparedSuccessor>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeExpansion(BeliefId const &beliefId,
+                                                                       std::optional<std::vector<BeliefValueType>> const &observationResolutions) const {
+    BeliefType belief = getBelief(beliefId);
+    std::vector<std::vector<PreparedSuccessor>> result(pomdp.getNumberOfChoices(belief.begin()->first));
+    for (uint64_t action = 0; action < result.size(); ++action) {
+        for (auto &successor : computeSuccessorBeliefs(belief, action)) {
+            PreparedSuccessor preparedSuccessor;
+            if (observationResolutions) {
+                uint32_t successorObservation = pomdp.getObservation(successor.first.begin()->first);
+                preparedSuccessor.triangulation = computeTriangulation(successor.first, observationResolutions.value()[successorObservation]);
+            } else {
+                preparedSuccessor.triangulation.gridPoints.push_back(std::move(successor.first));
+                preparedSuccessor.triangulation.weights.push_back(storm::utility::one<BeliefValueType>());
+            }
+            preparedSuccessor.probability = std::move(successor.second);
+            result[action].push_back(std::move(preparedSuccessor));
+        }
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return beliefStorage.getBelief(id);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
     BeliefType const &belief) const {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    STORM_LOG_ASSERT(obs < pomdp.getNrObservations(), "Belief has unknown observation.");
+    auto id = beliefStorage.find(belief, obs);
+    STORM_LOG_ASSERT(id.has_value(), "Unknown Belief.");
+    return id.value();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -394,7 +404,7 @@ uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservat
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+                                                                                        PendingTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -403,7 +413,8 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
     // Variable names are mostly based on the paper
     // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than
     // pomdp.getNumberOfStates()). Initialize diffs and the first row of the 'qs' matrix (aka v)
-    std::set<FreudenthalDiff, std::greater<>> sorted_diffs;  // d (and p?) in the paper
+    std::vector<FreudenthalDiff> sorted_diffs;  // d (and p?) in the paper
+    sorted_diffs.reserve(numEntries);
     std::vector<BeliefValueType> qsRow;                      // Row of the 'qs' matrix from the paper (initially corresponds to v
     qsRow.reserve(numEntries);
     std::vector<StateType> toOriginalIndicesMap;  // Maps 'local' indices to the original pomdp state indices
@@ -415,11 +426,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
         toOriginalIndicesMap.push_back(entry.first);
         x -= entry.second * resolution;
     }
+    // Sorting a vector once is considerably faster than maintaining a set (in particular for beliefs with large support)
+    std::sort(sorted_diffs.begin(), sorted_diffs.end(), std::greater<>());
     // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
     qsRow.push_back(storm::utility::zero<BeliefValueType>());
 
     result.weights.reserve(numEntries);
     result.gridPoints.reserve(numEntries);
+    result.resolution = storm::utility::convertNumber<uint64_t>(resolution);
     auto currentSortedDiff = sorted_diffs.begin();
     auto previousSortedDiff = sorted_diffs.end();
     --previousSortedDiff;
@@ -443,7 +457,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
@@ -451,7 +465,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+                                                                                    PendingTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -489,14 +503,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::PendingTriangulation BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(
+    BeliefType const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    PendingTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.push_back(belief);
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -510,19 +524,79 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefType const &belief, BeliefValueType const &resolution) {
+    // Dirac beliefs are triangulated quickly, so we do not cache them.
+    bool const useCache = triangulationCacheSize > 0 && belief.size() > 1;
+    std::size_t hash = 0;
+    if (useCache) {
+        hash = computeTriangulationCacheHash(belief, resolution);
+        auto range = triangulationCache.equal_range(hash);
+        for (auto cacheIt = range.first; cacheIt != range.second; ++cacheIt) {
+            auto entryIt = cacheIt->second;
+            if (entryIt->resolution == resolution && entryIt->belief == belief) {
+                // Mark the entry as most recently used
+                triangulationCacheEntries.splice(triangulationCacheEntries.begin(), triangulationCacheEntries, entryIt);
+                return entryIt->triangulation;
+            }
+        }
+    }
+
+    PendingTriangulation pendingTriangulation = computeTriangulation(belief, resolution);
+    Triangulation result;
+    result.weights = std::move(pendingTriangulation.weights);
+    result.gridPoints.reserve(pendingTriangulation.gridPoints.size());
+    for (auto const &gridPoint : pendingTriangulation.gridPoints) {
+        result.gridPoints.push_back(getOrAddBeliefId(gridPoint, pendingTriangulation.resolution));
+    }
     STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+
+    if (useCache) {
+        if (triangulationCacheEntries.size() >= triangulationCacheSize) {
+            // Evict the least recently used entry
+            auto lastEntryIt = std::prev(triangulationCacheEntries.end());
+            auto range = triangulationCache.equal_range(lastEntryIt->hash);
+            for (auto cacheIt = range.first; cacheIt != range.second; ++cacheIt) {
+                if (cacheIt->second == lastEntryIt) {
+                    triangulationCache.erase(cacheIt);
+                    break;
+                }
+            }
+            triangulationCacheEntries.pop_back();
+        }
+        triangulationCacheEntries.push_front({belief, resolution, hash, result});
+        triangulationCache.emplace(hash, triangulationCacheEntries.begin());
+    }
     return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulationCacheHash(BeliefType const &belief,
+                                                                                               BeliefValueType const &resolution) const {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, resolution);
+    for (auto const &entry : belief) {
+        boost::hash_combine(seed, entry.first);
+        boost::hash_combine(seed, entry.second);
+    }
+    return seed;
+}
 
-    BeliefType belief = getBelief(beliefId);
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::setTriangulationCacheSize(uint64_t cacheSize) {
+    triangulationCacheSize = cacheSize;
+    triangulationCache.clear();
+    triangulationCacheEntries.clear();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const {
+    std::vector<std::pair<BeliefType, BeliefValueType>> successors;
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -537,7 +611,7 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -551,17 +625,50 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        successors.emplace_back(std::move(successorBelief), successor.second);
+    }
+    return successors;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+
+    if (!observationGridClippingResolutions) {
+        auto preparedIt = preparedExpansions.find(beliefId);
+        if (preparedIt != preparedExpansions.end() && preparedResolutions == observationTriangulationResolutions) {
+            // Assign the ids in the same order as below
+            for (auto const &successor : preparedIt->second[actionIndex]) {
+                auto const &triangulation = successor.triangulation;
+                for (size_t j = 0; j < triangulation.gridPoints.size(); ++j) {
+                    BeliefValueType a = triangulation.weights[j] * successor.probability;
+                    destinations.emplace_back(getOrAddBeliefId(triangulation.gridPoints[j], triangulation.resolution),
+                                              storm::utility::convertNumber<ValueType>(a));
+                }
+            }
+            return destinations;
+        }
+    }
+
+    // Now for each successor belief we potentially triangulate it
+    for (auto const &successor : computeSuccessorBeliefs(getBelief(beliefId), actionIndex)) {
+        BeliefType const &successorBelief = successor.first;
+        uint32_t successorObservation = pomdp.getObservation(successorBelief.begin()->first);
 
         // Insert the destination. We know that destinations have to be disjoint since they have different observations
         if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
+            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successorObservation]);
             for (size_t j = 0; j < triangulation.size(); ++j) {
                 // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
                 BeliefValueType a = triangulation.weights[j] * successor.second;
                 destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
             }
         } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
+            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successorObservation],
                                                        storm::storage::BitVector(pomdp.getNumberOfStates()));
             if (clipping.isClippable) {
                 BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
@@ -590,7 +697,7 @@ template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(obs < pomdp.getNrObservations(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -717,7 +824,7 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
         optDelta = lpSolver->getObjectiveValue();
         for (uint64_t dist = 0; dist < gridCandidates.size(); ++dist) {
             if (lpSolver->getBinaryValue(lpSolver->getManager().getVariable("a_" + std::to_string(dist)))) {
-                targetBelief = getOrAddBeliefId(gridCandidates[dist]);
+                targetBelief = getOrAddBeliefId(gridCandidates[dist], resolution);
                 break;
             }
         }
@@ -768,17 +875,16 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
-    BeliefType const &belief) {
+    BeliefType const &belief, uint64_t resolution) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(obs < pomdp.getNrObservations(), "Belief has unknown observation.");
+    auto insertionRes = beliefStorage.findOrAdd(belief, obs, resolution);
+    if (insertionRes.second) {
+        // There actually was an insertion
+        STORM_LOG_TRACE("Add Belief " << insertionRes.first << " " << toString(belief));
     }
     // Return the id
-    return insertioRes.first->second;
+    return insertionRes.first;
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -2,10 +2,13 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <list>
 #include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include "storm-pomdp/storage/BeliefStorage.h"
+
 #include "storm/solver/LpSolver.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
@@ -78,8 +81,14 @@ class BeliefManager {
 
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
+    /*!
+     * Sets the maximal number of triangulations that are cached. If the cache is full, the least recently used triangulation is dropped.
+     * A size of zero disables the cache. Previously cached triangulations are dropped.
+     */
+    void setTriangulationCacheSize(uint64_t cacheSize);
+
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -93,6 +102,19 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Computes the successor beliefs of all actions of the given beliefs (using multiple threads if possible). If resolutions are given, the
+     * successors are also triangulated. The results are kept until they are retrieved via expandAndTriangulate (with the same resolutions) or via
+     * expand (if no resolutions are given). As belief ids are only assigned when the results are retrieved, the ids coincide with the ones obtained
+     * without preparation. Results of previous preparations are discarded.
+     */
+    void prepareExpansions(std::vector<BeliefId> const &beliefIds, std::optional<std::vector<BeliefValueType>> const &observationResolutions = std::nullopt);
+
+    /*!
+     * Retrieves whether the expansion of the given belief has been prepared with the given resolutions.
+     */
+    bool hasPreparedExpansion(BeliefId const &beliefId, std::optional<std::vector<BeliefValueType>> const &observationResolutions = std::nullopt) const;
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -107,14 +129,28 @@ class BeliefManager {
     BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
+
+    // A triangulation whose grid points have not been assigned an id yet.
+    struct PendingTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
+        // The resolution of the grid (zero if the grid points are not on a grid).
+        uint64_t resolution = 0;
+    };
 
-    struct BeliefHash {
-        std::size_t operator()(const BeliefType &belief) const;
+    // A cached triangulation of a belief w.r.t. a resolution.
+    struct TriangulationCacheEntry {
+        BeliefType belief;
+        BeliefValueType resolution;
+        std::size_t hash;
+        Triangulation triangulation;
     };
 
-    struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+    // A successor belief of a prepared expansion together with the probability to reach it.
+    struct PreparedSuccessor {
+        PendingTriangulation triangulation;
+        BeliefValueType probability;
     };
 
     struct FreudenthalDiff {
@@ -125,7 +161,7 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    BeliefType getBelief(BeliefId const &id) const;
 
     BeliefId getId(BeliefType const &belief) const;
 
@@ -139,25 +175,46 @@ class BeliefManager {
 
     uint32_t getBeliefObservation(BeliefType belief) const;
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, PendingTriangulation &result) const;
+
+    /*!
+     * Computes the triangulation of the given belief without assigning ids to the grid points. This does not modify the manager.
+     */
+    PendingTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
     Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+    std::size_t computeTriangulationCacheHash(BeliefType const &belief, BeliefValueType const &resolution) const;
+
+    /*!
+     * Computes the successor beliefs of the given belief and action together with the probability to reach them. This does not modify the manager.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefType const &belief, uint64_t actionIndex) const;
+
+    /*!
+     * Computes the successors of all actions of the given belief without assigning ids to them. This does not modify the manager.
+     */
+    std::vector<std::vector<PreparedSuccessor>> computeExpansion(BeliefId const &beliefId,
+                                                                 std::optional<std::vector<BeliefValueType>> const &observationResolutions) const;
+
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
         std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions = std::nullopt);
 
     BeliefId computeInitialBelief();
 
-    BeliefId getOrAddBeliefId(BeliefType const &belief);
+    /*!
+     * Retrieves the id of the given belief and adds it if necessary. If the resolution is not zero, the values of the belief are expected to be
+     * multiples of 1/resolution (e.g. for grid points), which allows to store the belief more compactly.
+     */
+    BeliefId getOrAddBeliefId(BeliefType const &belief, uint64_t resolution = 0);
 
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    BeliefStorage<StateType, BeliefValueType> beliefStorage;
     BeliefId initialBeliefId;
 
     storm::utility::ConstantsComparator<BeliefValueType> cc;
@@ -165,6 +222,15 @@ class BeliefManager {
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
 
     TriangulationMode triangulationMode;
+
+    // The cached triangulations (most recently used first), indexed by their hash.
+    uint64_t triangulationCacheSize = 0;
+    std::list<TriangulationCacheEntry> triangulationCacheEntries;
+    std::unordered_multimap<std::size_t, typename std::list<TriangulationCacheEntry>::iterator> triangulationCache;
+
+    // The prepared expansions (for each belief and action the successors) and the resolutions with which they were triangulated.
+    std::unordered_map<BeliefId, std::vector<std::vector<PreparedSuccessor>>> preparedExpansions;
+    std::optional<std::vector<BeliefValueType>> preparedResolutions;
 };
 }  // namespace storage
 }  // namespace storm
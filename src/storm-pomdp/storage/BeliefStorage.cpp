@@ -0,0 +1,212 @@
+#include "storm-pomdp/storage/BeliefStorage.h"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+uint64_t const emptySlot = std::numeric_limits<uint64_t>::max();
+}
+
+template<typename StateType, typename BeliefValueType>
+BeliefStorage<StateType, BeliefValueType>::BeliefStorage(std::vector<uint32_t> const& stateObservations)
+    : localStateIndices(stateObservations.size()), slots(1024, emptySlot) {
+    for (StateType state = 0; state < stateObservations.size(); ++state) {
+        uint32_t observation = stateObservations[state];
+        if (observation >= observationStates.size()) {
+            observationStates.resize(observation + 1);
+        }
+        localStateIndices[state] = observationStates[observation].size();
+        observationStates[observation].push_back(state);
+    }
+}
+
+template<typename StateType, typename BeliefValueType>
+std::pair<typename BeliefStorage<StateType, BeliefValueType>::BeliefId, bool> BeliefStorage<StateType, BeliefValueType>::findOrAdd(BeliefType const& belief,
+                                                                                                                                 uint32_t observation,
+                                                                                                                                 uint64_t resolution) {
+    std::size_t hash = computeHash(belief, observation);
+    uint64_t slot = findSlot(belief, observation, hash);
+    if (slots[slot] != emptySlot) {
+        return {slots[slot], false};
+    }
+
+    // Add the belief as a new run.
+    BeliefId id = runs.size();
+    BeliefRun run{localStates.size(), 0, static_cast<uint32_t>(belief.size()), observation, 0};
+    for (auto const& entry : belief) {
+        STORM_LOG_ASSERT(observation < observationStates.size() && localStateIndices[entry.first] < observationStates[observation].size() &&
+                             observationStates[observation][localStateIndices[entry.first]] == entry.first,
+                         "State " << entry.first << " does not have observation " << observation << ".");
+        localStates.push_back(localStateIndices[entry.first]);
+    }
+    std::vector<uint32_t> beliefNumerators;
+    if (resolution > 0 && quantize(belief, resolution, beliefNumerators)) {
+        run.valueOffset = numerators.size();
+        run.denominator = static_cast<uint32_t>(resolution);
+        numerators.insert(numerators.end(), beliefNumerators.begin(), beliefNumerators.end());
+    } else {
+        run.valueOffset = values.size();
+        for (auto const& entry : belief) {
+            values.push_back(entry.second);
+        }
+    }
+    runs.push_back(run);
+    hashes.push_back(hash);
+    slots[slot] = id;
+    if (runs.size() * 4 > slots.size() * 3) {
+        increaseNumberOfSlots();
+    }
+    return {id, true};
+}
+
+template<typename StateType, typename BeliefValueType>
+std::optional<typename BeliefStorage<StateType, BeliefValueType>::BeliefId> BeliefStorage<StateType, BeliefValueType>::find(BeliefType const& belief,
+                                                                                                                          uint32_t observation) const {
+    uint64_t slot = findSlot(belief, observation, computeHash(belief, observation));
+    if (slots[slot] == emptySlot) {
+        return std::nullopt;
+    }
+    return slots[slot];
+}
+
+template<typename StateType, typename BeliefValueType>
+typename BeliefStorage<StateType, BeliefValueType>::BeliefType BeliefStorage<StateType, BeliefValueType>::getBelief(BeliefId const& id) const {
+    STORM_LOG_ASSERT(id < runs.size(), "Belief index " << id << " is out of range.");
+    BeliefRun const& run = runs[id];
+    auto const& states = observationStates[run.observation];
+    // The entries of a run are ordered by state, so they can be inserted at the end.
+    BeliefType result;
+    result.reserve(run.size);
+    for (uint64_t entry = 0; entry < run.size; ++entry) {
+        result.emplace_hint(result.end(), states[localStates[run.entryOffset + entry]], getValue(run, entry));
+    }
+    return result;
+}
+
+template<typename StateType, typename BeliefValueType>
+uint32_t BeliefStorage<StateType, BeliefValueType>::getObservation(BeliefId const& id) const {
+    STORM_LOG_ASSERT(id < runs.size(), "Belief index " << id << " is out of range.");
+    return runs[id].observation;
+}
+
+template<typename StateType, typename BeliefValueType>
+uint64_t BeliefStorage<StateType, BeliefValueType>::size() const {
+    return runs.size();
+}
+
+template<typename StateType, typename BeliefValueType>
+std::size_t BeliefStorage<StateType, BeliefValueType>::computeHash(BeliefType const& belief, uint32_t observation) const {
+    std::size_t seed = 0;
+    boost::hash_combine(seed, observation);
+    // Assumes that beliefs are ordered
+    for (auto const& entry : belief) {
+        boost::hash_combine(seed, entry.first);
+        if constexpr (std::is_same_v<BeliefValueType, double>) {
+            // Values that are considered equal (see matches) shall have the same hash (in most cases).
+            boost::hash_combine(seed, std::round(entry.second * 1e15));
+        } else {
+            boost::hash_combine(seed, entry.second);
+        }
+    }
+    return seed;
+}
+
+template<typename StateType, typename BeliefValueType>
+BeliefValueType BeliefStorage<StateType, BeliefValueType>::getValue(BeliefRun const& run, uint64_t entry) const {
+    if (run.denominator == 0) {
+        return values[run.valueOffset + entry];
+    }
+    return storm::utility::convertNumber<BeliefValueType>(static_cast<uint_fast64_t>(numerators[run.valueOffset + entry])) /
+           storm::utility::convertNumber<BeliefValueType>(static_cast<uint_fast64_t>(run.denominator));
+}
+
+template<typename StateType, typename BeliefValueType>
+bool BeliefStorage<StateType, BeliefValueType>::matches(BeliefRun const& run, BeliefType const& belief, uint32_t observation) const {
+    if (run.observation != observation || run.size != belief.size()) {
+        return false;
+    }
+    auto const& states = observationStates[observation];
+    auto beliefIt = belief.begin();
+    for (uint64_t entry = 0; entry < run.size; ++entry, ++beliefIt) {
+        // Beliefs are not equal if they contain either different states or different values for the same state
+        if (states[localStates[run.entryOffset + entry]] != beliefIt->first) {
+            return false;
+        }
+        if constexpr (std::is_same_v<BeliefValueType, double>) {
+            if (std::fabs(getValue(run, entry) - beliefIt->second) > 1e-15) {
+                return false;
+            }
+        } else {
+            if (getValue(run, entry) != beliefIt->second) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename StateType, typename BeliefValueType>
+bool BeliefStorage<StateType, BeliefValueType>::quantize(BeliefType const& belief, uint64_t resolution, std::vector<uint32_t>& result) const {
+    if (resolution > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    BeliefValueType const denominator = storm::utility::convertNumber<BeliefValueType>(static_cast<uint_fast64_t>(resolution));
+    result.clear();
+    result.reserve(belief.size());
+    for (auto const& entry : belief) {
+        BeliefValueType scaled = storm::utility::round(entry.second * denominator);
+        if (scaled < storm::utility::zero<BeliefValueType>() || scaled > denominator) {
+            return false;
+        }
+        uint_fast64_t numerator = storm::utility::convertNumber<uint_fast64_t>(scaled);
+        // Only quantize if the value can be restored exactly.
+        if (storm::utility::convertNumber<BeliefValueType>(numerator) / denominator != entry.second) {
+            return false;
+        }
+        result.push_back(static_cast<uint32_t>(numerator));
+    }
+    return true;
+}
+
+template<typename StateType, typename BeliefValueType>
+uint64_t BeliefStorage<StateType, BeliefValueType>::findSlot(BeliefType const& belief, uint32_t observation, std::size_t hash) const {
+    uint64_t const mask = slots.size() - 1;
+    uint64_t slot = hash & mask;
+    while (slots[slot] != emptySlot) {
+        BeliefId id = slots[slot];
+        if (hashes[id] == hash && matches(runs[id], belief, observation)) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename StateType, typename BeliefValueType>
+void BeliefStorage<StateType, BeliefValueType>::increaseNumberOfSlots() {
+    slots.assign(slots.size() * 2, emptySlot);
+    uint64_t const mask = slots.size() - 1;
+    for (BeliefId id = 0; id < runs.size(); ++id) {
+        uint64_t slot = hashes[id] & mask;
+        while (slots[slot] != emptySlot) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = id;
+    }
+}
+
+template class BeliefStorage<uint64_t, double>;
+template class BeliefStorage<uint64_t, storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <boost/container/flat_map.hpp>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A compact store that assigns ids to beliefs (i.e. distributions over the states of a POMDP that share the same observation).
+ * The entries of all beliefs are kept as contiguous runs in one arena. States are stored by their index among the states with the same observation and,
+ * if the belief lies on a grid of known resolution, values are stored as numerators w.r.t. that resolution. Beliefs are found via open addressing over
+ * the runs with cached hash values.
+ */
+template<typename StateType, typename BeliefValueType>
+class BeliefStorage {
+   public:
+    typedef boost::container::flat_map<StateType, BeliefValueType> BeliefType;
+    typedef uint64_t BeliefId;
+
+    /*!
+     * Creates an empty storage for beliefs over states with the given observations.
+     */
+    explicit BeliefStorage(std::vector<uint32_t> const& stateObservations);
+
+    /*!
+     * Retrieves the id of the given belief. If the belief is not stored yet, it is added with the next free id.
+     *
+     * @param belief The belief. All states in its support need to have the given observation.
+     * @param observation The observation of the belief.
+     * @param resolution If not zero, the values of the belief are expected to be multiples of 1/resolution, which allows to store them compactly.
+     * @return The id of the belief and a flag that indicates whether the belief was added.
+     */
+    std::pair<BeliefId, bool> findOrAdd(BeliefType const& belief, uint32_t observation, uint64_t resolution = 0);
+
+    /*!
+     * Retrieves the id of the given belief (if it is stored).
+     */
+    std::optional<BeliefId> find(BeliefType const& belief, uint32_t observation) const;
+
+    /*!
+     * Reconstructs the belief with the given id.
+     */
+    BeliefType getBelief(BeliefId const& id) const;
+
+    /*!
+     * Retrieves the observation of the belief with the given id.
+     */
+    uint32_t getObservation(BeliefId const& id) const;
+
+    /*!
+     * Retrieves the number of stored beliefs.
+     */
+    uint64_t size() const;
+
+   private:
+    // The position of the entries of one belief within the arena.
+    struct BeliefRun {
+        uint64_t entryOffset;
+        uint64_t valueOffset;
+        uint32_t size;
+        uint32_t observation;
+        // Zero if the values are stored unquantized.
+        uint32_t denominator;
+    };
+
+    std::size_t computeHash(BeliefType const& belief, uint32_t observation) const;
+    BeliefValueType getValue(BeliefRun const& run, uint64_t entry) const;
+    bool matches(BeliefRun const& run, BeliefType const& belief, uint32_t observation) const;
+    bool quantize(BeliefType const& belief, uint64_t resolution, std::vector<uint32_t>& result) const;
+
+    /*!
+     * Retrieves the slot that holds the given belief or the empty slot at which it would have to be inserted.
+     */
+    uint64_t findSlot(BeliefType const& belief, uint32_t observation, std::size_t hash) const;
+
+    /*!
+     * Doubles the number of slots and reinserts all beliefs using the cached hashes.
+     */
+    void increaseNumberOfSlots();
+
+    // For each state the index among the states with the same observation and for each observation the states with this observation.
+    std::vector<uint32_t> localStateIndices;
+    std::vector<std::vector<StateType>> observationStates;
+
+    // The arena of all entries. Values are either stored unquantized or as numerators.
+    std::vector<uint32_t> localStates;
+    std::vector<BeliefValueType> values;
+    std::vector<uint32_t> numerators;
+
+    std::vector<BeliefRun> runs;
+    std::vector<std::size_t> hashes;
+
+    // The hash table (with open addressing). Empty slots hold the largest id.
+    std::vector<BeliefId> slots;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,255 @@
+#include "storm-pomdp/storage/PomdpMemoryProduct.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+PomdpMemoryProduct<ValueType>::PomdpMemoryProduct(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::PomdpMemory const& memory)
+    : pomdp(pomdp), memory(memory), backwardTransitions(*pomdp.getBackwardTransitions()) {
+    STORM_LOG_THROW(pomdp.isCanonic(), storm::exceptions::InvalidArgumentException, "POMDP must be canonical to build a product with a memory structure.");
+    memoryTransitions.resize(memory.getNumberOfStates());
+    memoryPredecessors.resize(memory.getNumberOfStates());
+    memoryTransitionOffsets.reserve(memory.getNumberOfStates() + 1);
+    memoryTransitionOffsets.push_back(0);
+    for (uint64_t memoryState = 0; memoryState < memory.getNumberOfStates(); ++memoryState) {
+        for (auto const& memorySuccessor : memory.getTransitions(memoryState)) {
+            memoryTransitions[memoryState].push_back(memorySuccessor);
+            memoryPredecessors[memorySuccessor].push_back(memoryState);
+        }
+        memoryTransitionOffsets.push_back(memoryTransitionOffsets.back() + memoryTransitions[memoryState].size());
+    }
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getNumberOfStates() const {
+    return pomdp.getNumberOfStates() * memory.getNumberOfStates();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getNumberOfChoices() const {
+    return pomdp.getNumberOfChoices() * memoryTransitionOffsets.back();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getProductState(uint64_t modelState, uint64_t memoryState) const {
+    return modelState * memory.getNumberOfStates() + memoryState;
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getModelState(uint64_t productState) const {
+    return productState / memory.getNumberOfStates();
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getMemoryState(uint64_t productState) const {
+    return productState % memory.getNumberOfStates();
+}
+
+template<typename ValueType>
+uint32_t PomdpMemoryProduct<ValueType>::getObservation(uint64_t productState) const {
+    return pomdp.getObservation(getModelState(productState)) * memory.getNumberOfStates() + getMemoryState(productState);
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getRowGroupIndex(uint64_t productState) const {
+    uint64_t modelState = getModelState(productState);
+    return pomdp.getTransitionMatrix().getRowGroupIndices()[modelState] * memoryTransitionOffsets.back() +
+           pomdp.getTransitionMatrix().getRowGroupSize(modelState) * memoryTransitionOffsets[getMemoryState(productState)];
+}
+
+template<typename ValueType>
+uint64_t PomdpMemoryProduct<ValueType>::getRowGroupSize(uint64_t productState) const {
+    return pomdp.getTransitionMatrix().getRowGroupSize(getModelState(productState)) * memoryTransitions[getMemoryState(productState)].size();
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::getInitialStates() const {
+    storm::storage::BitVector result(getNumberOfStates(), false);
+    for (auto const& modelState : pomdp.getInitialStates()) {
+        result.set(getProductState(modelState, memory.getInitialState()));
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::liftModelStates(storm::storage::BitVector const& modelStates) const {
+    storm::storage::BitVector result(getNumberOfStates(), false);
+    for (auto const& modelState : modelStates) {
+        for (uint64_t memoryState = 0; memoryState < memory.getNumberOfStates(); ++memoryState) {
+            result.set(getProductState(modelState, memoryState));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::getReachableStates(storm::storage::BitVector const& initialStates,
+                                                                            storm::storage::BitVector const& constraintStates,
+                                                                            storm::storage::BitVector const& targetStates) const {
+    storm::storage::BitVector reachableStates(initialStates);
+    std::vector<uint64_t> stack(initialStates.begin(), initialStates.end());
+    while (!stack.empty()) {
+        uint64_t currentState = stack.back();
+        stack.pop_back();
+        if (!constraintStates.get(currentState) || targetStates.get(currentState)) {
+            continue;
+        }
+        for (uint64_t localChoice = 0; localChoice < getRowGroupSize(currentState); ++localChoice) {
+            forEachTransition(currentState, localChoice, [&](uint64_t successor, ValueType const& probability) {
+                if (!storm::utility::isZero(probability) && !reachableStates.get(successor)) {
+                    reachableStates.set(successor);
+                    stack.push_back(successor);
+                }
+            });
+        }
+    }
+    return reachableStates;
+}
+
+template<typename ValueType>
+template<typename PredecessorFunction>
+void PomdpMemoryProduct<ValueType>::forEachPredecessor(uint64_t productState, PredecessorFunction const& function) const {
+    // A product state (s, m) is a predecessor of (t, n) iff s is a predecessor of t in the POMDP and n is a successor of m in the memory.
+    uint64_t memoryState = getMemoryState(productState);
+    for (auto const& entry : backwardTransitions.getRow(getModelState(productState))) {
+        if (storm::utility::isZero(entry.getValue())) {
+            continue;
+        }
+        for (auto const& memoryPredecessor : memoryPredecessors[memoryState]) {
+            function(getProductState(entry.getColumn(), memoryPredecessor));
+        }
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::performProbGreater0E(storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) const {
+    storm::storage::BitVector statesWithProbabilityGreater0(psiStates);
+    std::vector<uint64_t> stack(psiStates.begin(), psiStates.end());
+    while (!stack.empty()) {
+        uint64_t currentState = stack.back();
+        stack.pop_back();
+        forEachPredecessor(currentState, [&](uint64_t predecessor) {
+            if (phiStates.get(predecessor) && !statesWithProbabilityGreater0.get(predecessor)) {
+                statesWithProbabilityGreater0.set(predecessor);
+                stack.push_back(predecessor);
+            }
+        });
+    }
+    return statesWithProbabilityGreater0;
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::performProb0A(storm::storage::BitVector const& phiStates,
+                                                                       storm::storage::BitVector const& psiStates) const {
+    return ~performProbGreater0E(phiStates, psiStates);
+}
+
+template<typename ValueType>
+storm::storage::BitVector PomdpMemoryProduct<ValueType>::performProb1E(storm::storage::BitVector const& phiStates,
+                                                                       storm::storage::BitVector const& psiStates) const {
+    // Greatest fixpoint of the set of states that can reach a psi state within the set with positive probability while staying in the set.
+    storm::storage::BitVector currentStates(getNumberOfStates(), true);
+    bool done = false;
+    while (!done) {
+        storm::storage::BitVector nextStates(psiStates);
+        std::vector<uint64_t> stack(psiStates.begin(), psiStates.end());
+        while (!stack.empty()) {
+            uint64_t currentState = stack.back();
+            stack.pop_back();
+            forEachPredecessor(currentState, [&](uint64_t predecessor) {
+                if (!phiStates.get(predecessor) || nextStates.get(predecessor)) {
+                    return;
+                }
+                for (uint64_t localChoice = 0; localChoice < getRowGroupSize(predecessor); ++localChoice) {
+                    bool allSuccessorsInCurrentStates = true;
+                    bool hasSuccessorInNextStates = false;
+                    forEachTransition(predecessor, localChoice, [&](uint64_t successor, ValueType const& probability) {
+                        if (storm::utility::isZero(probability)) {
+                            return;
+                        }
+                        allSuccessorsInCurrentStates &= currentStates.get(successor);
+                        hasSuccessorInNextStates |= nextStates.get(successor);
+                    });
+                    if (allSuccessorsInCurrentStates && hasSuccessorInNextStates) {
+                        nextStates.set(predecessor);
+                        stack.push_back(predecessor);
+                        break;
+                    }
+                }
+            });
+        }
+        done = nextStates == currentStates;
+        currentStates = std::move(nextStates);
+    }
+    return currentStates;
+}
+
+template<typename ValueType>
+void PomdpMemoryProduct<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& x,
+                                                      storm::storage::BitVector const& fixedStates, std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(x.size() == getNumberOfStates() && result.size() == getNumberOfStates(), "Unexpected size of value vectors.");
+    for (uint64_t state = 0; state < getNumberOfStates(); ++state) {
+        if (fixedStates.get(state)) {
+            result[state] = x[state];
+            continue;
+        }
+        bool first = true;
+        for (uint64_t localChoice = 0; localChoice < getRowGroupSize(state); ++localChoice) {
+            ValueType choiceValue = storm::utility::zero<ValueType>();
+            forEachTransition(state, localChoice, [&](uint64_t successor, ValueType const& probability) { choiceValue += probability * x[successor]; });
+            if (first || (storm::solver::minimize(dir) ? choiceValue < result[state] : choiceValue > result[state])) {
+                result[state] = std::move(choiceValue);
+                first = false;
+            }
+        }
+        if (first) {
+            // States without choices do not occur in canonic POMDPs, but we treat them as sinks.
+            result[state] = x[state];
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> PomdpMemoryProduct<ValueType>::computeUntilProbabilities(storm::solver::OptimizationDirection dir,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates, ValueType const& precision,
+                                                                                uint64_t maxIterations) const {
+    storm::storage::BitVector statesWithProbability0 = performProb0A(phiStates, psiStates);
+    storm::storage::BitVector statesWithProbability1 = storm::solver::maximize(dir) ? performProb1E(phiStates, psiStates) : psiStates;
+    storm::storage::BitVector fixedStates = statesWithProbability0 | statesWithProbability1;
+
+    std::vector<ValueType> x(getNumberOfStates(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(x, statesWithProbability1, storm::utility::one<ValueType>());
+    if (fixedStates.full()) {
+        return x;
+    }
+    // Iterating from below converges to the least fixpoint, which yields the optimal probabilities for both directions.
+    std::vector<ValueType> y(x);
+    for (uint64_t iteration = 0; iteration < maxIterations; ++iteration) {
+        multiplyAndReduce(dir, x, fixedStates, y);
+        ValueType maxDifference = storm::utility::zero<ValueType>();
+        for (auto const& state : ~fixedStates) {
+            maxDifference = std::max<ValueType>(maxDifference, storm::utility::abs<ValueType>(y[state] - x[state]));
+        }
+        x.swap(y);
+        if (maxDifference <= precision) {
+            STORM_LOG_INFO("Value iteration on the POMDP memory product converged after " << (iteration + 1) << " iterations.");
+            return x;
+        }
+    }
+    STORM_LOG_WARN("Value iteration on the POMDP memory product did not converge within " << maxIterations << " iterations.");
+    return x;
+}
+
+template class PomdpMemoryProduct<double>;
+template class PomdpMemoryProduct<storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <vector>
+
+#include "storm-pomdp/storage/PomdpMemory.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A view on the product of a (canonic) POMDP and a memory structure that does not materialize the product.
+ * States and choices are numbered as in the POMDP built by the PomdpMemoryUnfolder (without dropping unreachable states):
+ * The product state of model state s and memory state m is s * |M| + m, its observation is obs(s) * |M| + m, and its choices are pairs of a
+ * model choice and a successor memory state. Transitions are derived on demand from the transition matrix of the POMDP and the memory structure, so the
+ * memory consumption is independent of the number of memory transitions.
+ */
+template<typename ValueType>
+class PomdpMemoryProduct {
+   public:
+    PomdpMemoryProduct(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::PomdpMemory const& memory);
+
+    uint64_t getNumberOfStates() const;
+    uint64_t getNumberOfChoices() const;
+
+    uint64_t getProductState(uint64_t modelState, uint64_t memoryState) const;
+    uint64_t getModelState(uint64_t productState) const;
+    uint64_t getMemoryState(uint64_t productState) const;
+    uint32_t getObservation(uint64_t productState) const;
+
+    /*!
+     * Retrieves the index of the first choice of the given product state.
+     */
+    uint64_t getRowGroupIndex(uint64_t productState) const;
+    uint64_t getRowGroupSize(uint64_t productState) const;
+
+    /*!
+     * Calls the given function for every transition (product state and probability) of the given product choice.
+     */
+    template<typename TransitionFunction>
+    void forEachTransition(uint64_t productState, uint64_t localChoice, TransitionFunction const& function) const {
+        uint64_t memoryState = getMemoryState(productState);
+        auto const& memorySuccessors = memoryTransitions[memoryState];
+        uint64_t modelRow = pomdp.getTransitionMatrix().getRowGroupIndices()[getModelState(productState)] + localChoice / memorySuccessors.size();
+        uint64_t memorySuccessor = memorySuccessors[localChoice % memorySuccessors.size()];
+        for (auto const& entry : pomdp.getTransitionMatrix().getRow(modelRow)) {
+            function(getProductState(entry.getColumn(), memorySuccessor), entry.getValue());
+        }
+    }
+
+    /*!
+     * Retrieves the product states with an initial model state and the initial memory state.
+     */
+    storm::storage::BitVector getInitialStates() const;
+
+    /*!
+     * Retrieves the product states whose model state is contained in the given set.
+     */
+    storm::storage::BitVector liftModelStates(storm::storage::BitVector const& modelStates) const;
+
+    /*!
+     * Retrieves the product states that are reachable from the given states via constraint states (see storm::utility::graph::getReachableStates).
+     */
+    storm::storage::BitVector getReachableStates(storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates,
+                                                 storm::storage::BitVector const& targetStates) const;
+
+    /*!
+     * Computes the product states from which some scheduler reaches a psi state via phi states with positive probability.
+     */
+    storm::storage::BitVector performProbGreater0E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+    /*!
+     * Computes the product states from which all schedulers reach a psi state via phi states with probability zero.
+     */
+    storm::storage::BitVector performProb0A(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+    /*!
+     * Computes the product states from which some scheduler reaches a psi state via phi states with probability one.
+     */
+    storm::storage::BitVector performProb1E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+    /*!
+     * Applies the Bellman operator, i.e., sets result[s] to the optimum over the choices of s of the expected value of x after taking the choice.
+     * Values of states in the given set of fixed states are copied from x.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& x, storm::storage::BitVector const& fixedStates,
+                           std::vector<ValueType>& result) const;
+
+    /*!
+     * Computes the optimal probabilities to reach a psi state via phi states by (Jacobi) value iteration from below after qualitative preprocessing.
+     *
+     * @param precision Iteration stops once no value changes by more than this (absolute) value.
+     * @param maxIterations Iteration stops after this number of iterations.
+     */
+    std::vector<ValueType> computeUntilProbabilities(storm::solver::OptimizationDirection dir, storm::storage::BitVector const& phiStates,
+                                                     storm::storage::BitVector const& psiStates, ValueType const& precision,
+                                                     uint64_t maxIterations = 100000) const;
+
+   private:
+    /*!
+     * Calls the given function for every product state that has a transition to the given product state.
+     */
+    template<typename PredecessorFunction>
+    void forEachPredecessor(uint64_t productState, PredecessorFunction const& function) const;
+
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+    storm::storage::PomdpMemory const& memory;
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+    // For each memory state its successors and its predecessors.
+    std::vector<std::vector<uint64_t>> memoryTransitions;
+    std::vector<std::vector<uint64_t>> memoryPredecessors;
+    // For each memory state the number of memory transitions of the memory states with a smaller index (and the total number as last entry).
+    std::vector<uint64_t> memoryTransitionOffsets;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,117 @@
+#include "storm-pomdp/storage/SupportSetIndex.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <tuple>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+SupportSetIndex::SupportSetIndex() : nodes({{0, 0, 0, 0, false}}) {
+    // Intentionally left empty.
+}
+
+SupportSetIndex::SupportSetIndex(std::vector<storm::storage::BitVector> const& sets) : SupportSetIndex() {
+    std::vector<std::vector<uint32_t>> elementsOfSets;
+    elementsOfSets.reserve(sets.size());
+    for (auto const& set : sets) {
+        elementsOfSets.emplace_back(set.begin(), set.end());
+    }
+    // In lexicographic order, sets with a common prefix are consecutive and a set precedes all sets that it is a proper prefix of.
+    std::sort(elementsOfSets.begin(), elementsOfSets.end());
+
+    // Create the nodes in breadth-first order so that the children of each node are contiguous.
+    // Each entry consists of the node, the range of sets with the prefix of the node, and the length of the prefix.
+    std::deque<std::tuple<uint32_t, uint64_t, uint64_t, uint64_t>> pending;
+    pending.emplace_back(0, 0, elementsOfSets.size(), 0);
+    while (!pending.empty()) {
+        auto [node, begin, end, depth] = pending.front();
+        pending.pop_front();
+        while (begin < end && elementsOfSets[begin].size() == depth) {
+            nodes[node].isEnd = true;
+            ++begin;
+        }
+        nodes[node].firstChild = nodes.size();
+        while (begin < end) {
+            uint32_t element = elementsOfSets[begin][depth];
+            uint64_t groupEnd = begin;
+            while (groupEnd < end && elementsOfSets[groupEnd][depth] == element) {
+                ++groupEnd;
+            }
+            pending.emplace_back(nodes.size(), begin, groupEnd, depth + 1);
+            nodes.push_back({element, element, 0, 0, false});
+            ++nodes[node].numberOfChildren;
+            begin = groupEnd;
+        }
+    }
+    STORM_LOG_ASSERT(nodes.size() <= std::numeric_limits<uint32_t>::max(), "Too many nodes in the support set index.");
+
+    // Children are created after their parents, so the maximal elements can be propagated backwards.
+    for (uint64_t node = nodes.size(); node > 0; --node) {
+        Node& current = nodes[node - 1];
+        for (uint32_t child = current.firstChild; child < current.firstChild + current.numberOfChildren; ++child) {
+            current.maxElement = std::max(current.maxElement, nodes[child].maxElement);
+        }
+    }
+}
+
+bool SupportSetIndex::containsSupersetOf(storm::storage::BitVector const& set) const {
+    if (nodes.front().numberOfChildren == 0 && !nodes.front().isEnd) {
+        return false;
+    }
+    return containsSupersetFrom(0, set.getNextSetIndex(0), set);
+}
+
+bool SupportSetIndex::containsSubsetOf(storm::storage::BitVector const& set) const {
+    return containsSubsetFrom(0, set);
+}
+
+uint64_t SupportSetIndex::getNumberOfNodes() const {
+    return nodes.size();
+}
+
+bool SupportSetIndex::containsSupersetFrom(uint32_t node, uint64_t nextElement, storm::storage::BitVector const& set) const {
+    // All elements of the set are on the path to this node, which is a prefix of at least one set of the family.
+    if (nextElement >= set.size()) {
+        return true;
+    }
+    Node const& current = nodes[node];
+    if (current.numberOfChildren == 0 || current.maxElement < nextElement) {
+        return false;
+    }
+    for (uint32_t child = current.firstChild; child < current.firstChild + current.numberOfChildren; ++child) {
+        uint32_t element = nodes[child].element;
+        // Children are ordered, so later children skip the next element.
+        if (element > nextElement) {
+            break;
+        }
+        uint64_t nextElementOfChild = element == nextElement ? set.getNextSetIndex(nextElement + 1) : nextElement;
+        if (containsSupersetFrom(child, nextElementOfChild, set)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SupportSetIndex::containsSubsetFrom(uint32_t node, storm::storage::BitVector const& set) const {
+    Node const& current = nodes[node];
+    if (current.isEnd) {
+        return true;
+    }
+    for (uint32_t child = current.firstChild; child < current.firstChild + current.numberOfChildren; ++child) {
+        uint32_t element = nodes[child].element;
+        if (element >= set.size()) {
+            break;
+        }
+        if (set.get(element) && containsSubsetFrom(child, set)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * An immutable index over a family of sets (given as bit vectors of equal size) that answers whether the family contains a superset or a subset of a
+ * given set without scanning all sets. The sets are stored as a set-trie, i.e., a trie over their elements in ascending order, whose nodes are laid out
+ * in one array with the children of a node stored contiguously.
+ */
+class SupportSetIndex {
+   public:
+    /*!
+     * Creates an index for the empty family.
+     */
+    SupportSetIndex();
+
+    /*!
+     * Creates an index for the given family of sets.
+     */
+    explicit SupportSetIndex(std::vector<storm::storage::BitVector> const& sets);
+
+    /*!
+     * Retrieves whether the family contains a set that includes the given set.
+     */
+    bool containsSupersetOf(storm::storage::BitVector const& set) const;
+
+    /*!
+     * Retrieves whether the family contains a set that is included in the given set.
+     */
+    bool containsSubsetOf(storm::storage::BitVector const& set) const;
+
+    /*!
+     * Retrieves the number of nodes of the trie (including the root).
+     */
+    uint64_t getNumberOfNodes() const;
+
+   private:
+    struct Node {
+        // The element that is added by this node. Unused for the root.
+        uint32_t element;
+        // The largest element in the subtrie of this node.
+        uint32_t maxElement;
+        uint32_t firstChild;
+        uint32_t numberOfChildren;
+        // Whether a set of the family ends at this node.
+        bool isEnd;
+    };
+
+    bool containsSupersetFrom(uint32_t node, uint64_t nextElement, storm::storage::BitVector const& set) const;
+    bool containsSubsetFrom(uint32_t node, storm::storage::BitVector const& set) const;
+
+    std::vector<Node> nodes;
+};
+
+}  // namespace storage
+}  // namespace storm
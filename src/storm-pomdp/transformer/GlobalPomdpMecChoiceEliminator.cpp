@@ -49,7 +49,8 @@ template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEliminator<ValueType>::transformMinReward(
     storm::logic::EventuallyFormula const& formula) const {
     assert(formula.isRewardPathFormula());
-    auto backwardTransitions = pomdp.getBackwardTransitions();
+    auto const backwardTransitionsPtr = pomdp.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     storm::storage::BitVector allStates(pomdp.getNumberOfStates(), true);
     auto prob1EStates = storm::utility::graph::performProb1E(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(), backwardTransitions,
                                                              allStates, checkPropositionalFormula(formula.getSubformula()));
@@ -96,7 +97,8 @@ std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEli
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> GlobalPomdpMecChoiceEliminator<ValueType>::transformMax(
     storm::logic::UntilFormula const& formula) const {
-    auto backwardTransitions = pomdp.getBackwardTransitions();
+    auto const backwardTransitionsPtr = pomdp.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     auto prob01States = storm::utility::graph::performProb01Max(pomdp.getTransitionMatrix(), pomdp.getTransitionMatrix().getRowGroupIndices(),
                                                                 backwardTransitions, checkPropositionalFormula(formula.getLeftSubformula()),
                                                                 checkPropositionalFormula(formula.getRightSubformula()));
@@ -192,7 +194,7 @@ template<typename ValueType>
 storm::storage::MaximalEndComponentDecomposition<ValueType> GlobalPomdpMecChoiceEliminator<ValueType>::decomposeEndComponents(
     storm::storage::BitVector const& subsystem, storm::storage::BitVector const& redirectingStates) const {
     if (redirectingStates.empty()) {
-        return storm::storage::MaximalEndComponentDecomposition<ValueType>(pomdp.getTransitionMatrix(), pomdp.getBackwardTransitions(), subsystem);
+        return storm::storage::MaximalEndComponentDecomposition<ValueType>(pomdp.getTransitionMatrix(), *pomdp.getBackwardTransitions(), subsystem);
     } else {
         // Redirect all incoming transitions of a redirictingState back to the origin of the transition.
         storm::storage::SparseMatrixBuilder<ValueType> builder(pomdp.getTransitionMatrix().getRowCount(), pomdp.getTransitionMatrix().getColumnCount(), 0, true,
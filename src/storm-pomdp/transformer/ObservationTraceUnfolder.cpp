@@ -11,8 +11,8 @@ namespace storm {
 namespace pomdp {
 template<typename ValueType>
 ObservationTraceUnfolder<ValueType>::ObservationTraceUnfolder(storm::models::sparse::Pomdp<ValueType> const& model, std::vector<ValueType> const& risk,
-                                                              std::shared_ptr<storm::expressions::ExpressionManager>& exprManager)
-    : model(model), risk(risk), exprManager(exprManager) {
+                                                              std::shared_ptr<storm::expressions::ExpressionManager>& exprManager, uint64_t windowSize)
+    : model(model), risk(risk), exprManager(exprManager), windowSize(windowSize) {
     statesPerObservation = std::vector<storm::storage::BitVector>(model.getNrObservations() + 1, storm::storage::BitVector(model.getNumberOfStates()));
     for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
         statesPerObservation[model.getObservation(state)].set(state, true);
@@ -22,11 +22,6 @@ ObservationTraceUnfolder<ValueType>::ObservationTraceUnfolder(storm::models::spa
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::transform(const std::vector<uint32_t>& observations) {
-    std::vector<uint32_t> modifiedObservations = observations;
-    // First observation should be special.
-    // This just makes the algorithm simpler because we do not treat the first step as a special case later.
-    modifiedObservations[0] = model.getNrObservations();
-
     storm::storage::BitVector initialStates = model.getInitialStates();
     storm::storage::BitVector actualInitialStates = initialStates;
     for (uint64_t state : initialStates) {
@@ -36,8 +31,14 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
     }
     STORM_LOG_THROW(actualInitialStates.getNumberOfSetBits() == 1, storm::exceptions::InvalidArgumentException,
                     "Must have unique initial state matching the observation");
-    //
-    statesPerObservation[model.getNrObservations()] = actualInitialStates;
+    return unfold(observations, actualInitialStates);
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::unfold(std::vector<uint32_t> const& observations,
+                                                                                                   storm::storage::BitVector const& initialStates) {
+    STORM_LOG_ASSERT(!initialStates.empty(), "Expected at least one initial state.");
+    statesPerObservation[model.getNrObservations()] = initialStates;
 
 #ifdef _VERBOSE_OBSERVATION_UNFOLDING
     std::cout << "build valution builder..\n";
@@ -53,13 +54,26 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
     std::cout << "start buildiing matrix...\n";
 #endif
 
-    // Add this initial state state:
-    unfoldedToOldNextStep[0] = actualInitialStates.getNextSetIndex(0);
-
     storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, true, true);
     uint64_t newStateIndex = 1;
     uint64_t newRowGroupStart = 0;
     uint64_t newRowCount = 0;
+
+    if (initialStates.getNumberOfSetBits() == 1) {
+        // Add this initial state state:
+        unfoldedToOldNextStep[0] = initialStates.getNextSetIndex(0);
+    } else {
+        // The initial state nondeterministically selects one of the possible states. Resets return to this selection.
+        transitionMatrixBuilder.newRowGroup(newRowGroupStart);
+        svbuilder.addState(0, {}, {-1});
+        for (uint64_t state : initialStates) {
+            transitionMatrixBuilder.addNextValue(newRowCount, newStateIndex, storm::utility::one<ValueType>());
+            unfoldedToOldNextStep[newStateIndex] = state;
+            newStateIndex++;
+            newRowCount++;
+        }
+        newRowGroupStart = newRowCount;
+    }
     // Notice that we are going to use a special last step
 
     for (uint64_t step = 0; step < observations.size() - 1; ++step) {
@@ -72,7 +86,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
 #ifdef _VERBOSE_OBSERVATION_UNFOLDING
             std::cout << "\tconsider new state " << unfoldedToOldEntry.first << '\n';
 #endif
-            assert(step == 0 || newRowCount == transitionMatrixBuilder.getLastRow() + 1);
+            assert(newRowCount == 0 || newRowCount == transitionMatrixBuilder.getLastRow() + 1);
             svbuilder.addState(unfoldedToOldEntry.first, {}, {static_cast<int64_t>(unfoldedToOldEntry.second)});
             uint64_t oldRowIndexStart = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second];
             uint64_t oldRowIndexEnd = model.getNondeterministicChoiceIndices()[unfoldedToOldEntry.second + 1];
@@ -184,12 +198,44 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Mdp<ValueType>> ObservationTraceUnfolder<ValueType>::extend(uint32_t observation) {
     traceSoFar.push_back(observation);
+    if (windowSize == 0) {
+        return transform(traceSoFar);
+    }
+    supportsSoFar.push_back(getSuccessorSupport(supportsSoFar.back(), observation));
+    STORM_LOG_THROW(!supportsSoFar.back().empty(), storm::exceptions::InvalidArgumentException,
+                    "Observation " << observation << " is inconsistent with the observations so far.");
+    if (traceSoFar.size() > windowSize) {
+        traceSoFar.erase(traceSoFar.begin());
+        supportsSoFar.pop_front();
+        traceTruncated = true;
+    }
+    if (traceTruncated) {
+        return unfold(traceSoFar, supportsSoFar.front());
+    }
     return transform(traceSoFar);
 }
 
 template<typename ValueType>
 void ObservationTraceUnfolder<ValueType>::reset(uint32_t observation) {
     traceSoFar = {observation};
+    supportsSoFar.clear();
+    traceTruncated = false;
+    if (windowSize > 0) {
+        supportsSoFar.push_back(model.getInitialStates() & statesPerObservation[observation]);
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector ObservationTraceUnfolder<ValueType>::getSuccessorSupport(storm::storage::BitVector const& support, uint32_t observation) const {
+    storm::storage::BitVector result(model.getNumberOfStates());
+    for (uint64_t state : support) {
+        for (auto const& entry : model.getTransitionMatrix().getRowGroup(state)) {
+            if (!storm::utility::isZero(entry.getValue()) && model.getObservation(entry.getColumn()) == observation) {
+                result.set(entry.getColumn(), true);
+            }
+        }
+    }
+    return result;
 }
 
 template class ObservationTraceUnfolder<double>;
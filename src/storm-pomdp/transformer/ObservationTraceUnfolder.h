@@ -1,3 +1,5 @@
+#include <deque>
+
 #include "storm/models/sparse/Pomdp.h"
 
 namespace storm {
@@ -15,9 +17,10 @@ class ObservationTraceUnfolder {
      * @param model the MDP with state-based observations
      * @param risk the state risk
      * @param exprManager an Expression Manager
+     * @param windowSize If positive, the incremental approach only unfolds the last windowSize observations (see extend)
      */
     ObservationTraceUnfolder(storm::models::sparse::Pomdp<ValueType> const& model, std::vector<ValueType> const& risk,
-                             std::shared_ptr<storm::expressions::ExpressionManager>& exprManager);
+                             std::shared_ptr<storm::expressions::ExpressionManager>& exprManager, uint64_t windowSize = 0);
     /**
      * Transform in one shot
      * @param observations
@@ -26,6 +29,9 @@ class ObservationTraceUnfolder {
     std::shared_ptr<storm::models::sparse::Mdp<ValueType>> transform(std::vector<uint32_t> const& observations);
     /**
      * Transform incrementaly
+     * If a window size is set and the trace is longer than the window, only the last observations are unfolded. The older observations are summarized
+     * by the set of states that are consistent with them, from which the unfolding starts nondeterministically. This over-approximates the maximal risk,
+     * but the size of the unfolding (and thus the time to analyse it) does not grow with the length of the trace.
      * @param observation
      * @return
      */
@@ -37,11 +43,25 @@ class ObservationTraceUnfolder {
     void reset(uint32_t observation);
 
    private:
+    /**
+     * Unfolds the given observations starting in one of the given states, which must have the first observation.
+     */
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> unfold(std::vector<uint32_t> const& observations, storm::storage::BitVector const& initialStates);
+    /**
+     * Computes the states with the given observation that are reachable in one step from the given states.
+     */
+    storm::storage::BitVector getSuccessorSupport(storm::storage::BitVector const& support, uint32_t observation) const;
+
     storm::models::sparse::Pomdp<ValueType> const& model;
     std::vector<ValueType> risk;  // TODO reconsider holding this as a reference, but there were some strange bugs
     std::shared_ptr<storm::expressions::ExpressionManager>& exprManager;
     std::vector<storm::storage::BitVector> statesPerObservation;
     std::vector<uint32_t> traceSoFar;
+    uint64_t windowSize;
+    // For each observation in traceSoFar the states consistent with the observations so far (only maintained if the window size is positive).
+    std::deque<storm::storage::BitVector> supportsSoFar;
+    // Whether observations have been dropped from traceSoFar.
+    bool traceTruncated = false;
     storm::expressions::Variable svvar;
 };
 
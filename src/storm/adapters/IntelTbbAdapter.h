@@ -20,6 +20,9 @@
 #ifdef STORM_HAVE_INTELTBB
 #include "tbb/blocked_range.h"
 #include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+#include "tbb/task_scheduler_observer.h"
 #include "tbb/tbb_stddef.h"
 #endif
 
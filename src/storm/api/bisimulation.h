@@ -4,6 +4,7 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 
+#include "storm/storage/bisimulation/BisimulationReductionEstimate.h"
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
@@ -11,45 +12,63 @@
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/logic/Formula.h"
+#include "storm/logic/FormulaInformation.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace api {
 
 template<typename ModelType>
-std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
-                                                                              std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-                                                                              storm::storage::BisimulationType type) {
+std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(
+    std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type,
+    storm::storage::BisimulationRefinementMethod refinementMethod = storm::storage::BisimulationRefinementMethod::Splitter,
+    boost::optional<uint_fast64_t> const& maximalNumberOfBlocks = boost::none) {
     typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
     if (!formulas.empty()) {
         options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    options.setRefinementMethod(refinementMethod);
+    options.maximalNumberOfBlocks = maximalNumberOfBlocks;
 
     storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
+    if (bisimulationDecomposition.hasExceededMaximalNumberOfBlocks()) {
+        // The quotient would be too large, so we keep the original model.
+        return model;
+    }
     return bisimulationDecomposition.getQuotient();
 }
 
 template<typename ModelType>
-std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
-                                                                                 std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-                                                                                 storm::storage::BisimulationType type) {
+std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(
+    std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type,
+    storm::storage::BisimulationRefinementMethod refinementMethod = storm::storage::BisimulationRefinementMethod::Splitter,
+    boost::optional<uint_fast64_t> const& maximalNumberOfBlocks = boost::none) {
     typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options options;
     if (!formulas.empty()) {
         options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
     }
     options.setType(type);
+    options.setRefinementMethod(refinementMethod);
+    options.maximalNumberOfBlocks = maximalNumberOfBlocks;
 
     storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
     bisimulationDecomposition.computeBisimulationDecomposition();
+    if (bisimulationDecomposition.hasExceededMaximalNumberOfBlocks()) {
+        // The quotient would be too large, so we keep the original model.
+        return model;
+    }
     return bisimulationDecomposition.getQuotient();
 }
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(
     std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
-    storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
+    storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong,
+    storm::storage::BisimulationRefinementMethod refinementMethod = storm::storage::BisimulationRefinementMethod::Splitter,
+    boost::optional<uint_fast64_t> const& maximalNumberOfBlocks = boost::none) {
     STORM_LOG_THROW(
         model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp),
         storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
@@ -59,14 +78,60 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMini
 
     if (model->isOfType(storm::models::ModelType::Dtmc)) {
         return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(
-            model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type, refinementMethod, maximalNumberOfBlocks);
     } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
         return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(
-            model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type, refinementMethod, maximalNumberOfBlocks);
     } else {
         return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(
-            model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type);
+            model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type, refinementMethod, maximalNumberOfBlocks);
+    }
+}
+
+/*!
+ * Decides automatically whether and which bisimulation minimization is applied. The decision is based on a cheap estimate of the size of the strong
+ * bisimulation quotient. If this estimate promises a sufficient reduction, strong bisimulation is applied. Otherwise, weak bisimulation is tried if it
+ * preserves the given formulas (it can only yield a smaller quotient). In both cases, the refinement is aborted (and the original model is returned)
+ * as soon as the quotient is known to exceed the given ratio of the model states.
+ *
+ * @param maximalQuotientRatio The maximal ratio of quotient states to model states for which the quotient is used.
+ * @return The quotient or the original model, if minimizing does not pay off.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> performAutomaticBisimulationMinimization(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    double maximalQuotientRatio,
+    storm::storage::BisimulationRefinementMethod refinementMethod = storm::storage::BisimulationRefinementMethod::Splitter) {
+    if (!model->isOfType(storm::models::ModelType::Dtmc) && !model->isOfType(storm::models::ModelType::Ctmc) &&
+        !model->isOfType(storm::models::ModelType::Mdp)) {
+        STORM_LOG_INFO("Skipping bisimulation minimization as it is not available for models of type " << model->getType() << ".");
+        return model;
+    }
+
+    // Try to get rid of non state-rewards to easy bisimulation computation.
+    model->reduceToStateBasedRewards();
+
+    uint_fast64_t const maximalNumberOfBlocks = static_cast<uint_fast64_t>(maximalQuotientRatio * model->getNumberOfStates());
+    storm::storage::BisimulationReductionEstimate estimate = storm::storage::estimateBisimulationReduction(*model, formulas);
+    STORM_LOG_INFO("Estimated strong bisimulation quotient to have " << (estimate.converged ? "" : "at least ") << estimate.numberOfBlocks << " of "
+                                                                     << estimate.numberOfStates << " states.");
+    if (estimate.numberOfBlocks <= maximalNumberOfBlocks) {
+        STORM_LOG_INFO("Performing strong bisimulation minimization.");
+        return performBisimulationMinimization<ValueType>(model, formulas, storm::storage::BisimulationType::Strong, refinementMethod, maximalNumberOfBlocks);
+    }
+
+    // Weak bisimulation is only considered for DTMCs. It does not preserve bounded properties.
+    bool weakPreservesFormulas = !formulas.empty() && model->isOfType(storm::models::ModelType::Dtmc);
+    for (auto const& formula : formulas) {
+        storm::logic::FormulaInformation info = formula->info();
+        weakPreservesFormulas &= !info.containsBoundedUntilFormula() && !info.containsNextFormula() && !info.containsCumulativeRewardFormula();
+    }
+    if (weakPreservesFormulas) {
+        STORM_LOG_INFO("Performing weak bisimulation minimization.");
+        return performBisimulationMinimization<ValueType>(model, formulas, storm::storage::BisimulationType::Weak, refinementMethod, maximalNumberOfBlocks);
     }
+    STORM_LOG_INFO("Skipping bisimulation minimization as it is not expected to reduce the model sufficiently.");
+    return model;
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
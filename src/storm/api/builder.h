@@ -108,6 +108,18 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return builder.build();
 }
 
+/*!
+ * Explores the given model and streams it into the given file in the binary drb format without building it in memory.
+ *
+ * @param temporaryDirectory The directory in which temporary files are stored. If empty, the directory of the file is used.
+ */
+template<typename ValueType>
+void buildSparseModelToDrbFile(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+                               std::string const& filename, std::string const& temporaryDirectory = "") {
+    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options);
+    builder.buildToDrbFile(filename, temporaryDirectory);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
                                                                           std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
@@ -2,6 +2,7 @@
 
 #include "storm/adapters/JsonForward.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/CheckResultExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
@@ -32,11 +33,26 @@ void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueTy
     storm::utility::closeFile(stream);
 }
 
+template<typename ValueType>
+void exportSparseModelAsDrb(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
+    std::ofstream stream(filename, std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    STORM_PRINT_AND_LOG("Write to file " << filename << ".\n");
+    storm::exporter::explicitExportSparseModelBinary(stream, model);
+    storm::utility::closeFile(stream);
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& filename) {
     storm::exporter::explicitExportSymbolicModel(filename, model);
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+void exportSymbolicModelAsBinaryDrdd(std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> const& model, std::string const& directory) {
+    STORM_PRINT_AND_LOG("Write to directory " << directory << ".\n");
+    storm::exporter::explicitExportSymbolicModelBinary(directory, model);
+}
+
 template<typename ValueType>
 void exportSparseModelAsDot(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, size_t maxWidth = 30) {
     std::ofstream stream;
@@ -95,5 +111,32 @@ inline void exportCheckResultToJson<storm::RationalFunction>(std::shared_ptr<sto
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of check results is not supported for rational functions. ");
 }
 
+/*!
+ * Exports the check result in the format given by the options. Unless filters are given, json exports are written as by exportCheckResultToJson. All other
+ * exports are streamed, i.e. they do not build the whole document in memory.
+ */
+template<typename ValueType>
+inline void exportCheckResult(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                              std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename,
+                              storm::exporter::CheckResultExportOptions const& options) {
+    if (options.format == storm::exporter::CheckResultExportFormat::Json && !options.stateLabel && !options.topK) {
+        exportCheckResultToJson(model, checkResult, filename);
+        return;
+    }
+    STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
+                    "Streaming export of check results is only supported for explicit quantitative check results (e.g. in the sparse engine)");
+    std::ofstream stream(filename, std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    storm::exporter::exportCheckResult(stream, *model, checkResult->template asExplicitQuantitativeCheckResult<ValueType>(), options);
+    storm::utility::closeFile(stream);
+}
+
+template<>
+inline void exportCheckResult<storm::RationalFunction>(std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const&,
+                                                       std::unique_ptr<storm::modelchecker::CheckResult> const&, std::string const&,
+                                                       storm::exporter::CheckResultExportOptions const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export of check results is not supported for rational functions. ");
+}
+
 }  // namespace api
 }  // namespace storm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
+#include "storm/transformer/DuplicateChoiceEliminator.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
 #include "storm/transformer/StatePermuter.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
@@ -166,5 +167,15 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> permuteModelStates(std:
     return storm::transformer::permuteStates(*model, permutation);
 }
 
+/*!
+ * Removes the choices of an MDP that have the same distribution and rewards as another choice of the same state.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> eliminateDuplicateChoices(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+    STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException,
+                    "Removing duplicate choices is only supported for MDPs, but the model is a " << model->getType() << ".");
+    return storm::transformer::DuplicateChoiceEliminator<ValueType>::transform(*model->template as<storm::models::sparse::Mdp<ValueType>>());
+}
+
 }  // namespace api
 }  // namespace storm
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
@@ -17,6 +18,7 @@
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -88,6 +90,49 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with statistical model checking engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking engine is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<ValueType>> checker(program);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << program.getModelType() << " is not supported by the statistical model checking engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSmcEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                      storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSmcEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -317,6 +362,74 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWi
     return result;
 }
 
+/*!
+ * Checks a time-bounded reachability property of the form P=? [phi U<=t psi] for each of the given (ascendingly sorted) time bounds,
+ * i.e., the time bound of the property is replaced by the given ones. All time bounds are handled in a single pass.
+ */
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyForTimeBoundsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timeBounds) {
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && !formula.asProbabilityOperatorFormula().hasBound() &&
+                        formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException,
+                    "Checking several time bounds at once is only supported for properties of the form P=? [phi U<=t psi], but got " << formula << ".");
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+    return modelchecker.computeBoundedUntilProbabilities(
+        env, task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula()), timeBounds);
+}
+
+/*!
+ * Checks a step-bounded reachability property of the form P=? [phi U<=k psi] on a DTMC or MDP for each of the given (ascendingly sorted) step bounds,
+ * i.e., the step bound of the property is replaced by the given ones. All step bounds are handled in a single sequence of steps.
+ */
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyForStepBoundsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<uint64_t> const& stepBounds) {
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && !formula.asProbabilityOperatorFormula().hasBound() &&
+                        formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException,
+                    "Checking several step bounds at once is only supported for properties of the form P=? [phi U<=k psi], but got " << formula << ".");
+    auto untilTask = task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    if (model->getType() == storm::models::ModelType::Dtmc) {
+        auto dtmc = model->template as<storm::models::sparse::Dtmc<ValueType>>();
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+        return modelchecker.computeBoundedUntilProbabilities(env, untilTask, stepBounds);
+    } else if (model->getType() == storm::models::ModelType::Mdp) {
+        if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MDPs with this data type.");
+        } else {
+            auto mdp = model->template as<storm::models::sparse::Mdp<ValueType>>();
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            return modelchecker.computeBoundedUntilProbabilities(env, untilTask, stepBounds);
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Checking several step bounds at once for the model type " << model->getType() << " is not supported.");
+    return nullptr;
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyForTimeBoundsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timeBounds) {
+    if (model->getType() == storm::models::ModelType::Dtmc || model->getType() == storm::models::ModelType::Mdp) {
+        std::vector<uint64_t> stepBounds;
+        for (auto const& timeBound : timeBounds) {
+            STORM_LOG_THROW(timeBound == std::floor(timeBound), storm::exceptions::NotSupportedException,
+                            "The bound " << timeBound << " is not a valid step bound for the model type " << model->getType() << ".");
+            stepBounds.push_back(static_cast<uint64_t>(timeBound));
+        }
+        return verifyForStepBoundsWithSparseEngine(env, model, task, stepBounds);
+    }
+    STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc, storm::exceptions::NotSupportedException,
+                    "Checking several time bounds at once for the model type " << model->getType() << " is not supported.");
+    return verifyForTimeBoundsWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, timeBounds);
+}
+
 //
 // Verifying with Hybrid engine
 //
@@ -1,17 +1,39 @@
 #include "storm/automata/DeterministicAutomaton.h"
 
+#include <algorithm>
+
 #include "cpphoafparser/consumer/hoa_intermediate_check_validity.hh"
 #include "cpphoafparser/parser/hoa_parser.hh"
 #include "cpphoafparser/parser/hoa_parser_helper.hh"
 
 #include "storm/automata/AcceptanceCondition.h"
 #include "storm/automata/HOAConsumerDA.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/FileIoException.h"
 
 namespace storm {
 namespace automata {
+
+namespace {
+bool isConjunctionOfAtoms(AcceptanceCondition::acceptance_expr::ptr const& expr) {
+    if (expr->isAND()) {
+        return isConjunctionOfAtoms(expr->getLeft()) && isConjunctionOfAtoms(expr->getRight());
+    }
+    return expr->isAtom() || expr->isTRUE() || expr->isFALSE();
+}
+
+bool isInDNF(AcceptanceCondition::acceptance_expr::ptr const& expr) {
+    if (expr->isOR()) {
+        return isInDNF(expr->getLeft()) && isInDNF(expr->getRight());
+    }
+    return isConjunctionOfAtoms(expr);
+}
+}  // namespace
+
 DeterministicAutomaton::DeterministicAutomaton(APSet apSet, std::size_t numberOfStates, std::size_t initialState, AcceptanceCondition::ptr acceptance)
     : apSet(apSet), numberOfStates(numberOfStates), initialState(initialState), acceptance(acceptance) {
     // TODO: this could overflow, add check?
@@ -50,6 +72,92 @@ AcceptanceCondition::ptr DeterministicAutomaton::getAcceptance() const {
     return acceptance;
 }
 
+storm::storage::BitVector DeterministicAutomaton::computeAcceptingSinks() const {
+    storm::storage::BitVector acceptingSinks(numberOfStates, false);
+    for (std::size_t state = 0; state < numberOfStates; ++state) {
+        bool isSink = true;
+        for (APSet::alphabet_element label = 0; label < edgesPerState; ++label) {
+            if (getSuccessor(state, label) != state) {
+                isSink = false;
+                break;
+            }
+        }
+        if (isSink) {
+            storm::storage::StateBlock stateAsBlock;
+            stateAsBlock.insert(state);
+            acceptingSinks.set(state, acceptance->isAccepting(stateAsBlock));
+        }
+    }
+    return acceptingSinks;
+}
+
+storm::storage::BitVector DeterministicAutomaton::computeRejectingStates() const {
+    // Build the graph of the automaton, ignoring the labels of the edges
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    std::vector<std::size_t> stateSuccessors;
+    for (std::size_t state = 0; state < numberOfStates; ++state) {
+        stateSuccessors.assign(successors.begin() + state * edgesPerState, successors.begin() + (state + 1) * edgesPerState);
+        std::sort(stateSuccessors.begin(), stateSuccessors.end());
+        stateSuccessors.erase(std::unique(stateSuccessors.begin(), stateSuccessors.end()), stateSuccessors.end());
+        for (auto const& successor : stateSuccessors) {
+            builder.addNextValue(state, successor, 1.0);
+        }
+    }
+    storm::storage::SparseMatrix<double> graph = builder.build();
+
+    // Find the states that lie on a cycle that might be accepting
+    storm::storage::BitVector candidateStates(numberOfStates, false);
+    if (isInDNF(acceptance->getAcceptanceExpression())) {
+        for (auto const& conjunction : acceptance->extractFromDNF()) {
+            // Remove the states that would violate a Fin-literal, the remaining cycles need to satisfy the Inf-literals
+            storm::storage::BitVector allowed(numberOfStates, true);
+            for (auto const& literal : conjunction) {
+                if (literal->isFALSE()) {
+                    allowed.clear();
+                } else if (literal->isAtom() && literal->getAtom().getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
+                    storm::storage::BitVector const& accSet = acceptance->getAcceptanceSet(literal->getAtom().getAcceptanceSet());
+                    allowed &= literal->getAtom().isNegated() ? accSet : ~accSet;
+                }
+            }
+            if (allowed.empty()) {
+                continue;
+            }
+            storm::storage::StronglyConnectedComponentDecomposition<double> sccs(
+                graph, storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(allowed).dropNaiveSccs());
+            for (auto const& scc : sccs) {
+                bool accepting = true;
+                for (auto const& literal : conjunction) {
+                    if (literal->isAtom() && literal->getAtom().getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
+                        storm::storage::BitVector const& accSet = acceptance->getAcceptanceSet(literal->getAtom().getAcceptanceSet());
+                        bool negated = literal->getAtom().isNegated();
+                        accepting = std::any_of(scc.begin(), scc.end(), [&accSet, negated](std::size_t state) { return accSet.get(state) != negated; });
+                        if (!accepting) {
+                            break;
+                        }
+                    }
+                }
+                if (accepting) {
+                    for (auto const& state : scc) {
+                        candidateStates.set(state);
+                    }
+                }
+            }
+        }
+    } else {
+        // Without DNF, we only exclude the sinks that violate the acceptance condition
+        candidateStates.complement();
+        for (std::size_t state = 0; state < numberOfStates; ++state) {
+            if (graph.getRow(state).getNumberOfEntries() == 1 && graph.getRow(state).begin()->getColumn() == state) {
+                storm::storage::StateBlock stateAsBlock;
+                stateAsBlock.insert(state);
+                candidateStates.set(state, acceptance->isAccepting(stateAsBlock));
+            }
+        }
+    }
+
+    return ~storm::utility::graph::performProbGreater0(graph.transpose(), storm::storage::BitVector(numberOfStates, true), candidateStates);
+}
+
 void DeterministicAutomaton::printHOA(std::ostream& out) const {
     out << "HOA: v1\n";
 
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include "storm/automata/APSet.h"
+#include "storm/storage/BitVector.h"
 
 namespace storm {
 namespace automata {
@@ -27,6 +28,19 @@ class DeterministicAutomaton {
 
     std::shared_ptr<AcceptanceCondition> getAcceptance() const;
 
+    /*!
+     * Computes the states from which every run is accepting, i.e., the states whose edges all lead back to the state itself and
+     * for which staying in the state forever satisfies the acceptance condition.
+     */
+    storm::storage::BitVector computeAcceptingSinks() const;
+
+    /*!
+     * Computes the states from which no run is accepting, independent of the input word.
+     * If the acceptance condition is in disjunctive normal form, these are the states that can not reach a cycle satisfying one of the conjunctions.
+     * Otherwise, only the states that can not reach any state except for sinks that violate the acceptance condition are detected.
+     */
+    storm::storage::BitVector computeRejectingStates() const;
+
     void printHOA(std::ostream& out) const;
 
     static DeterministicAutomaton::ptr parse(std::istream& in);
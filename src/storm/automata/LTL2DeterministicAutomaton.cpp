@@ -5,14 +5,71 @@
 #include "storm/exceptions/ExpressionEvaluationException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
 #include "storm/logic/Formula.h"
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 namespace storm {
 namespace automata {
 
+namespace {
+std::mutex automatonCacheMutex;
+// Maps the cache key of a translation to the resulting automaton
+std::map<std::string, std::shared_ptr<DeterministicAutomaton>> automatonCache;
+
+std::string getCacheFilename(std::string const& cacheDirectory, std::string const& key) {
+    std::stringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>()(key) << ".hoa";
+    return (std::filesystem::path(cacheDirectory) / filename.str()).string();
+}
+
+// The files of the on-disk cache start with a line containing the cache key, followed by the automaton in HOA format
+std::shared_ptr<DeterministicAutomaton> loadCachedAutomaton(std::string const& cacheDirectory, std::string const& key) {
+    std::string const filename = getCacheFilename(cacheDirectory, key);
+    if (!storm::utility::fileExistsAndIsReadable(filename)) {
+        return nullptr;
+    }
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    std::string storedKey;
+    std::getline(stream, storedKey);
+    std::shared_ptr<DeterministicAutomaton> da;
+    if (storedKey == key) {
+        STORM_LOG_INFO("Reading automaton for " << key << " from " << filename);
+        da = DeterministicAutomaton::parse(stream);
+    } else {
+        STORM_LOG_WARN("Ignoring cached automaton in " << filename << " because it has been stored for a different formula.");
+    }
+    storm::utility::closeFile(stream);
+    return da;
+}
+
+void storeCachedAutomaton(std::string const& cacheDirectory, std::string const& key, DeterministicAutomaton const& da) {
+    std::error_code errorCode;
+    std::filesystem::create_directories(cacheDirectory, errorCode);
+    STORM_LOG_THROW(!errorCode && std::filesystem::is_directory(cacheDirectory), storm::exceptions::FileIoException,
+                    "Could not create automaton cache directory '" << cacheDirectory << "'.");
+    // Write to a temporary file first such that concurrent runs never read an incomplete automaton
+    std::string const filename = getCacheFilename(cacheDirectory, key);
+    std::string const temporaryFilename = filename + ".tmp";
+    std::ofstream stream;
+    storm::utility::openFile(temporaryFilename, stream, false, true);
+    stream << key << '\n';
+    da.printHOA(stream);
+    storm::utility::closeFile(stream);
+    std::filesystem::rename(temporaryFilename, filename, errorCode);
+    STORM_LOG_WARN_COND(!errorCode, "Could not store automaton for " << key << " in " << filename << ".");
+}
+}  // namespace
+
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
     std::string prefixLtl = f.toPrefixString();
@@ -96,6 +153,42 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     }
 }
 
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                                            boost::optional<std::string> const& ltl2daTool,
+                                                                            boost::optional<std::string> const& cacheDirectory) {
+    // The atomic propositions are named canonically when the state subformulas are extracted, so the prefix formula identifies the translation.
+    std::string key = (ltl2daTool ? "ltl2datool " + ltl2daTool.get() : std::string(dnf ? "spot-dnf" : "spot")) + " " + f.toPrefixString();
+
+    {
+        std::lock_guard<std::mutex> lock(automatonCacheMutex);
+        auto findRes = automatonCache.find(key);
+        if (findRes != automatonCache.end()) {
+            STORM_LOG_INFO("Reusing deterministic automaton for " << key << ".");
+            return findRes->second;
+        }
+    }
+
+    std::shared_ptr<DeterministicAutomaton> da;
+    if (cacheDirectory) {
+        da = loadCachedAutomaton(cacheDirectory.get(), key);
+    }
+    if (!da) {
+        da = ltl2daTool ? ltl2daExternalTool(f, ltl2daTool.get()) : ltl2daSpot(f, dnf);
+        if (cacheDirectory) {
+            storeCachedAutomaton(cacheDirectory.get(), key, *da);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(automatonCacheMutex);
+    automatonCache.emplace(std::move(key), da);
+    return da;
+}
+
+void LTL2DeterministicAutomaton::clearCache() {
+    std::lock_guard<std::mutex> lock(automatonCacheMutex);
+    automatonCache.clear();
+}
+
 }  // namespace automata
 
 }  // namespace storm
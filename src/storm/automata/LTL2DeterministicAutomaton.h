@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+
+#include <boost/optional.hpp>
 
 namespace storm {
 
@@ -35,6 +38,26 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton using the given external LTL2DA tool or (if none is given) Spot.
+     * The automata are cached in memory, i.e., each formula is translated only once. If a cache directory is given, the automata are
+     * additionally stored there in HOA format and reused in later runs.
+     *
+     * @param f The LTL formula.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only relevant for Spot).
+     * @param ltl2daTool The external tool (if any).
+     * @param cacheDirectory The directory in which the automata are stored (if any).
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                          boost::optional<std::string> const& ltl2daTool = boost::none,
+                                                          boost::optional<std::string> const& cacheDirectory = boost::none);
+
+    /*!
+     * Clears the in-memory cache of translated automata.
+     */
+    static void clearCache();
 };
 
 }  // namespace automata
@@ -52,6 +52,12 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       addOverlappingGuardsLabel(false),
       addOutOfBoundsState(false),
       reservedBitsForUnboundedVariables(32),
+      compileGuards(false),
+      compiledGuardsCacheDirectory(""),
+      guardCompiler("c++"),
+      partialOrderReduction(false),
+      symmetryReduction(false),
+      bytecodeExpressionEvaluation(false),
       showProgress(false),
       showProgressDelay(0) {
     // Intentionally left empty.
@@ -190,6 +196,30 @@ bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isCompileGuardsSet() const {
+    return compileGuards;
+}
+
+std::string const& BuilderOptions::getCompiledGuardsCacheDirectory() const {
+    return compiledGuardsCacheDirectory;
+}
+
+std::string const& BuilderOptions::getGuardCompiler() const {
+    return guardCompiler;
+}
+
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isBytecodeExpressionEvaluationSet() const {
+    return bytecodeExpressionEvaluation;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -291,6 +321,36 @@ BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setCompileGuards(bool newValue) {
+    compileGuards = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setCompiledGuardsCacheDirectory(std::string const& directory) {
+    compiledGuardsCacheDirectory = directory;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setGuardCompiler(std::string const& compiler) {
+    guardCompiler = compiler;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setBytecodeExpressionEvaluation(bool newValue) {
+    bytecodeExpressionEvaluation = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
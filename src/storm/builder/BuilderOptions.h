@@ -120,6 +120,12 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isCompileGuardsSet() const;
+    std::string const& getCompiledGuardsCacheDirectory() const;
+    std::string const& getGuardCompiler() const;
+    bool isPartialOrderReductionSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isBytecodeExpressionEvaluationSet() const;
     uint64_t getShowProgressDelay() const;
 
     /**
@@ -211,6 +217,49 @@ class BuilderOptions {
      */
     BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
 
+    /**
+     * Should the guards of the commands be compiled to native code instead of being interpreted?
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setCompileGuards(bool newValue = true);
+
+    /**
+     * Sets the directory in which compiled guards are cached. If empty, the cache directory of the user is used.
+     */
+    BuilderOptions& setCompiledGuardsCacheDirectory(std::string const& directory);
+
+    /**
+     * Sets the command that is used to invoke the C++ compiler when compiling guards.
+     */
+    BuilderOptions& setGuardCompiler(std::string const& compiler);
+
+    /**
+     * Should the state space be reduced by an ample set partial order reduction? The reduced model preserves the minimal and maximal probabilities
+     * of properties in LTL without next operators (over the built labels), but not rewards, step bounds or nested probabilities. It is only applied
+     * to MDPs given as PRISM programs.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
+    /**
+     * Should the state space be reduced by exploiting symmetries between a PRISM module and the modules renamed from it? States that only differ
+     * in a permutation of these modules are merged. Only fully symmetric module families are reduced, i.e. families for which also the built
+     * labels, reward models and all other modules are invariant under permuting the modules of the family.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should expressions (guards, updates, rewards and labels) be evaluated by interpreting bytecode instead of using exprtk? For exact models,
+     * this only affects the evaluation of boolean and integer expressions.
+     * @param newValue The new value (default true)
+     * @return this
+     */
+    BuilderOptions& setBytecodeExpressionEvaluation(bool newValue = true);
+
     /**
      * Substitutes all expressions occurring in these options.
      */
@@ -271,6 +320,24 @@ class BuilderOptions {
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
+    /// A flag indicating whether the guards of the commands are compiled to native code.
+    bool compileGuards;
+
+    /// The directory in which compiled guards are cached.
+    std::string compiledGuardsCacheDirectory;
+
+    /// The command that is used to invoke the C++ compiler.
+    std::string guardCompiler;
+
+    /// A flag indicating whether the state space is reduced by a partial order reduction.
+    bool partialOrderReduction;
+
+    /// A flag indicating whether the state space is reduced by exploiting symmetric modules.
+    bool symmetryReduction;
+
+    /// A flag indicating whether expressions are evaluated by interpreting bytecode.
+    bool bytecodeExpressionEvaluation;
+
     /// A flag that stores whether the progress of exploration is to be printed.
     bool showProgress;
 
@@ -1,5 +1,7 @@
 #include "storm/builder/DdJaniModelBuilder.h"
 
+#include <chrono>
+#include <filesystem>
 #include <sstream>
 
 #include <boost/algorithm/string/join.hpp>
@@ -28,6 +30,8 @@
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -37,6 +41,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -379,13 +384,42 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // If a variable order is requested, the meta variables of the locations and the non-transient variables are created in that order up front.
+        preallocatedMetaVariables.clear();
+        std::vector<std::string> variableOrder = storm::builder::getDdVariableOrderFromSettings(this->model);
+        if (!variableOrder.empty()) {
+            std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> domains;
+            auto addDomain = [&domains](storm::jani::Variable const& variable) {
+                auto const& type = variable.getType();
+                if (variable.isTransient()) {
+                    return;
+                } else if (type.isBasicType() && type.asBasicType().isBooleanType()) {
+                    domains.emplace(variable.getExpressionVariable().getName(), std::nullopt);
+                } else if (type.isBoundedType() && type.asBoundedType().isIntegerType() && type.asBoundedType().hasLowerBound() &&
+                           type.asBoundedType().hasUpperBound()) {
+                    domains.emplace(variable.getExpressionVariable().getName(), std::make_pair(type.asBoundedType().getLowerBound().evaluateAsInt(),
+                                                                                               type.asBoundedType().getUpperBound().evaluateAsInt()));
+                }
+            };
+            for (auto const& automaton : this->model.getAutomata()) {
+                domains.emplace("l_" + automaton.getName(), std::pair<int64_t, int64_t>(0, automaton.getNumberOfLocations() - 1));
+                for (auto const& variable : automaton.getVariables()) {
+                    addDomain(variable);
+                }
+            }
+            for (auto const& variable : this->model.getGlobalVariables()) {
+                addDomain(variable);
+            }
+            preallocatedMetaVariables = storm::builder::createMetaVariablesInOrder(*result.manager, variableOrder, domains);
+        }
+
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
 
             // Start by creating a meta variable for the location of the automaton.
             storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
             std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                addMetaVariable(result, "l_" + automaton.getName(), std::pair<int64_t, int64_t>(0, automaton.getNumberOfLocations() - 1));
             result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
             result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -472,7 +506,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         int_fast64_t high = type.getUpperBound().evaluateAsInt();
 
         std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+            addMetaVariable(result, variable.getExpressionVariable().getName(), std::make_pair(low, high));
 
         STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
@@ -494,7 +528,7 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
 
     void createBooleanVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-            result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+            addMetaVariable(result, variable.getExpressionVariable().getName(), std::nullopt);
 
         STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName()
                                                                                << ".");
@@ -515,9 +549,30 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         result.allGlobalVariables.insert(variable.getExpressionVariable());
     }
 
+    /*!
+     * Retrieves the meta variables for the given variable. They are created unless they have been created up front.
+     *
+     * @param range The range of an integer variable or nothing for a boolean variable.
+     */
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> addMetaVariable(CompositionVariables<Type, ValueType>& result,
+                                                                                          std::string const& name,
+                                                                                          std::optional<std::pair<int64_t, int64_t>> const& range) {
+        auto findRes = preallocatedMetaVariables.find(name);
+        if (findRes != preallocatedMetaVariables.end()) {
+            return findRes->second;
+        } else if (range) {
+            return result.manager->addMetaVariable(name, range->first, range->second);
+        } else {
+            return result.manager->addMetaVariable(name);
+        }
+    }
+
     storm::jani::Model const& model;
     std::set<std::string> automata;
     storm::jani::CompositionInformation actionInformation;
+
+    // The meta variables that have been created up front to obtain the requested variable order.
+    std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> preallocatedMetaVariables;
 };
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -2199,6 +2254,49 @@ storm::dd::Bdd<Type> computeInitialStates(storm::jani::Model const& model, Compo
     return initialStates;
 }
 
+// Stores the ADDs of the composed system that are not needed for the reachability analysis on disk and drops them from the system, so that the DD
+// package can reclaim their nodes until they are reloaded.
+template<storm::dd::DdType Type, typename ValueType>
+class SpilledSystem {
+   public:
+    SpilledSystem(ComposerResult<Type, ValueType>& system, storm::dd::DdManager<Type> const& manager, std::string const& directory)
+        : system(system), manager(manager) {
+        std::error_code errorCode;
+        std::filesystem::create_directories(directory, errorCode);
+        STORM_LOG_THROW(!errorCode && std::filesystem::is_directory(directory), storm::exceptions::FileIoException,
+                        "Could not create the directory " << directory << " to store DDs.");
+        std::string prefix = "storm-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+
+        transitionsFile = (std::filesystem::path(directory) / (prefix + "-transitions.dd")).string();
+        system.transitions.exportToBinary(transitionsFile);
+        system.transitions = manager.template getAddZero<ValueType>();
+
+        for (auto& assignment : system.transientEdgeAssignments) {
+            std::string filename = (std::filesystem::path(directory) / (prefix + "-" + assignment.first.getName() + ".dd")).string();
+            assignment.second.exportToBinary(filename);
+            assignment.second = manager.template getAddZero<ValueType>();
+            transientEdgeAssignmentFiles.emplace(assignment.first, filename);
+        }
+        STORM_LOG_INFO("Stored " << (transientEdgeAssignmentFiles.size() + 1) << " DDs of the composed system in " << directory << ".");
+    }
+
+    // Loads the stored ADDs into the system again and deletes the files.
+    void reload() {
+        system.transitions = storm::dd::Add<Type, ValueType>::fromBinary(manager, transitionsFile);
+        std::filesystem::remove(transitionsFile);
+        for (auto const& entry : transientEdgeAssignmentFiles) {
+            system.transientEdgeAssignments.at(entry.first) = storm::dd::Add<Type, ValueType>::fromBinary(manager, entry.second);
+            std::filesystem::remove(entry.second);
+        }
+    }
+
+   private:
+    ComposerResult<Type, ValueType>& system;
+    storm::dd::DdManager<Type> const& manager;
+    std::string transitionsFile;
+    std::map<storm::expressions::Variable, std::string> transientEdgeAssignmentFiles;
+};
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> fixDeadlocks(storm::jani::ModelType const& modelType, storm::dd::Add<Type, ValueType>& transitionMatrix,
                                   storm::dd::Bdd<Type> const& transitionMatrixBdd, storm::dd::Bdd<Type> const& reachableStates,
@@ -2379,9 +2477,37 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
         model.getModelType() == storm::jani::ModelType::MA) {
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
     }
-    modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
-                                                                                 variables.columnMetaVariables)
-                                          .first;
+    // Collect the variables of the individual automata to allow for a localized computation of the reachable states.
+    std::vector<std::set<storm::expressions::Variable>> automatonRowMetaVariables;
+    for (auto const& automatonLocationVariables : variables.automatonToLocationDdVariableMap) {
+        std::set<storm::expressions::Variable> rowMetaVariables = {automatonLocationVariables.second.first};
+        for (auto const& variable : model.getAutomaton(automatonLocationVariables.first).getVariables()) {
+            if (!variable.isTransient()) {
+                rowMetaVariables.insert(variables.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
+            }
+        }
+        automatonRowMetaVariables.push_back(std::move(rowMetaVariables));
+    }
+
+    // If requested, the ADDs of the system are stored on disk during the reachability analysis, which only requires the transition BDD.
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    boost::optional<SpilledSystem<Type, ValueType>> spilledSystem;
+    if (buildSettings.isDdSpillDirectorySet()) {
+        if (std::is_same<ValueType, double>::value) {
+            spilledSystem.emplace(system, *variables.manager, buildSettings.getDdSpillDirectory());
+        } else {
+            STORM_LOG_WARN("Storing DDs on disk is only supported for double values. The DDs are kept in memory.");
+        }
+    }
+
+    modelComponents.reachableStates =
+        storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables,
+                                                   variables.columnMetaVariables, variables.rowColumnMetaVariablePairs, automatonRowMetaVariables,
+                                                   buildSettings.getSymbolicReachabilityStrategy())
+            .first;
+    if (spilledSystem) {
+        spilledSystem->reload();
+    }
 
     // Check that the reachable fragment does not overlap with the illegal fragment.
     storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2403,6 +2529,10 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> buildInternal(s
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, model.getModelType(), variables, system, rewardVariables);
 
+    if (buildSettings.isDdVariableOrderExportSet()) {
+        storm::builder::exportDdVariableOrder(*variables.manager, variables.rowColumnMetaVariablePairs, buildSettings.getDdVariableOrderExportFilename());
+    }
+
     // Finally, create the model.
     return createModel(model.getModelType(), variables, modelComponents);
 }
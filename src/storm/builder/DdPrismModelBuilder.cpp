@@ -2,6 +2,7 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -190,11 +191,41 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
+        // If a variable order is requested, the meta variables of the state variables are created in that order up front.
+        std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> preallocatedMetaVariables;
+        std::vector<std::string> variableOrder = storm::builder::getDdVariableOrderFromSettings(program);
+        if (!variableOrder.empty()) {
+            std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> domains;
+            auto addDomains = [&domains](std::vector<storm::prism::IntegerVariable> const& integerVariables,
+                                         std::vector<storm::prism::BooleanVariable> const& booleanVariables) {
+                for (auto const& integerVariable : integerVariables) {
+                    domains.emplace(integerVariable.getName(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(),
+                                                                              integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                }
+                for (auto const& booleanVariable : booleanVariables) {
+                    domains.emplace(booleanVariable.getName(), std::nullopt);
+                }
+            };
+            addDomains(program.getGlobalIntegerVariables(), program.getGlobalBooleanVariables());
+            for (auto const& module : program.getModules()) {
+                addDomains(module.getIntegerVariables(), module.getBooleanVariables());
+            }
+            preallocatedMetaVariables = storm::builder::createMetaVariablesInOrder(*manager, variableOrder, domains);
+        }
+        auto addIntegerMetaVariable = [&](std::string const& name, int_fast64_t low, int_fast64_t high) {
+            auto findRes = preallocatedMetaVariables.find(name);
+            return findRes != preallocatedMetaVariables.end() ? findRes->second : manager->addMetaVariable(name, low, high);
+        };
+        auto addBooleanMetaVariable = [&](std::string const& name) {
+            auto findRes = preallocatedMetaVariables.find(name);
+            return findRes != preallocatedMetaVariables.end() ? findRes->second : manager->addMetaVariable(name);
+        };
+
         // Create meta variables for global program variables.
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
             int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
             int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = addIntegerMetaVariable(integerVariable.getName(), low, high);
 
             STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -213,7 +244,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = addBooleanMetaVariable(booleanVariable.getName());
 
             STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                    << "] and " << variablePair.second.getName() << "["
@@ -241,7 +272,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
                 int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
                 int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
                 std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
+                    addIntegerMetaVariable(integerVariable.getName(), low, high);
                 STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -260,7 +291,7 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
                 rowColumnMetaVariablePairs.push_back(variablePair);
             }
             for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = addBooleanMetaVariable(booleanVariable.getName());
                 STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
                                                                                 << "] and " << variablePair.second.getName() << "["
                                                                                 << variablePair.second.getIndex() << "]");
@@ -1457,9 +1488,24 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
     }
 
-    storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
-                                                                                            generationInfo.columnMetaVariables)
-                                               .first;
+    // Collect the variables of the individual modules to allow for a localized computation of the reachable states.
+    std::vector<std::set<storm::expressions::Variable>> moduleRowMetaVariables;
+    for (auto const& module : program.getModules()) {
+        std::set<storm::expressions::Variable> rowMetaVariables;
+        for (auto const& variable : module.getIntegerVariables()) {
+            rowMetaVariables.insert(generationInfo.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            rowMetaVariables.insert(generationInfo.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
+        }
+        moduleRowMetaVariables.push_back(std::move(rowMetaVariables));
+    }
+    auto reachabilityStrategy = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityStrategy();
+    storm::dd::Bdd<Type> reachableStates =
+        storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables,
+                                                         generationInfo.columnMetaVariables, generationInfo.rowColumnMetaVariablePairs,
+                                                         moduleRowMetaVariables, reachabilityStrategy)
+            .first;
     storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
     transitionMatrix *= reachableStatesAdd;
     if (system.stateActionDd) {
@@ -1569,6 +1615,12 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         result->addParameters(generationInfo.parameters);
     }
 
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isDdVariableOrderExportSet()) {
+        storm::builder::exportDdVariableOrder(*generationInfo.manager, generationInfo.rowColumnMetaVariablePairs,
+                                              buildSettings.getDdVariableOrderExportFilename());
+    }
+
     return result;
 }
 
@@ -0,0 +1,331 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+/*!
+ * Collects the variables the dependency graph is built upon together with its hyperedges.
+ */
+class DependencyGraph {
+   public:
+    void addVariable(std::string const& name) {
+        if (variableToIndex.emplace(name, variables.size()).second) {
+            variables.push_back(name);
+        }
+    }
+
+    void addHyperedge(std::set<std::string> const& edgeVariables) {
+        std::set<uint64_t> edge;
+        for (auto const& variable : edgeVariables) {
+            auto findRes = variableToIndex.find(variable);
+            if (findRes != variableToIndex.end()) {
+                edge.insert(findRes->second);
+            }
+        }
+        // Hyperedges with a single variable do not influence the order.
+        if (edge.size() > 1) {
+            hyperedges.emplace_back(edge.begin(), edge.end());
+        }
+    }
+
+    std::vector<std::string> computeOrder(DdVariableOrderingHeuristic const& heuristic) const {
+        if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+            return variables;
+        }
+        STORM_LOG_ASSERT(heuristic == DdVariableOrderingHeuristic::Force, "Unexpected heuristic.");
+        std::vector<std::string> result;
+        result.reserve(variables.size());
+        for (auto const& index : computeForceOrder(variables.size(), hyperedges)) {
+            result.push_back(variables[index]);
+        }
+        return result;
+    }
+
+   private:
+    std::vector<std::string> variables;
+    std::unordered_map<std::string, uint64_t> variableToIndex;
+    std::vector<std::vector<uint64_t>> hyperedges;
+};
+
+void insertVariableNames(std::set<storm::expressions::Variable> const& variables, std::set<std::string>& names) {
+    for (auto const& variable : variables) {
+        names.insert(variable.getName());
+    }
+}
+
+double getTotalSpan(std::vector<double> const& positions, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    double result = 0.0;
+    for (auto const& edge : hyperedges) {
+        auto minMax = std::minmax_element(edge.begin(), edge.end(), [&positions](uint64_t lhs, uint64_t rhs) { return positions[lhs] < positions[rhs]; });
+        result += positions[*minMax.second] - positions[*minMax.first];
+    }
+    return result;
+}
+}  // namespace detail
+
+std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges) {
+    std::vector<uint64_t> order(numberOfVariables);
+    std::iota(order.begin(), order.end(), 0ull);
+    std::vector<double> positions(order.begin(), order.end());
+    std::vector<uint64_t> bestOrder = order;
+    double bestSpan = detail::getTotalSpan(positions, hyperedges);
+
+    // As suggested by Aloul et al., the number of iterations is logarithmic in the number of variables.
+    uint64_t const maxIterations = 10 * static_cast<uint64_t>(std::ceil(std::log2(numberOfVariables + 1))) + 10;
+    std::vector<double> centerSums(numberOfVariables);
+    std::vector<uint64_t> centerCounts(numberOfVariables);
+    for (uint64_t iteration = 0; iteration < maxIterations; ++iteration) {
+        // Compute the center of gravity of each hyperedge and move each variable to the average of the centers of its hyperedges.
+        std::fill(centerSums.begin(), centerSums.end(), 0.0);
+        std::fill(centerCounts.begin(), centerCounts.end(), 0ull);
+        for (auto const& edge : hyperedges) {
+            double center = 0.0;
+            for (auto const& variable : edge) {
+                center += positions[variable];
+            }
+            center /= edge.size();
+            for (auto const& variable : edge) {
+                centerSums[variable] += center;
+                ++centerCounts[variable];
+            }
+        }
+        std::vector<double> tentativePositions(numberOfVariables);
+        for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+            tentativePositions[variable] = centerCounts[variable] > 0 ? centerSums[variable] / centerCounts[variable] : positions[variable];
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&tentativePositions](uint64_t lhs, uint64_t rhs) { return tentativePositions[lhs] < tentativePositions[rhs]; });
+        for (uint64_t position = 0; position < numberOfVariables; ++position) {
+            positions[order[position]] = position;
+        }
+
+        double span = detail::getTotalSpan(positions, hyperedges);
+        STORM_LOG_TRACE("FORCE iteration " << iteration << " yields a total span of " << span << ".");
+        if (span < bestSpan) {
+            bestSpan = span;
+            bestOrder = order;
+        } else {
+            break;
+        }
+    }
+    return bestOrder;
+}
+
+std::vector<std::string> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderingHeuristic const& heuristic) {
+    detail::DependencyGraph graph;
+    // The declaration order coincides with the order in which the dd builder creates the variables.
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        graph.addVariable(variable.getName());
+    }
+    for (auto const& variable : program.getGlobalBooleanVariables()) {
+        graph.addVariable(variable.getName());
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getIntegerVariables()) {
+            graph.addVariable(variable.getName());
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            graph.addVariable(variable.getName());
+        }
+    }
+
+    std::map<uint64_t, std::set<std::string>> actionToVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<std::string> commandVariables;
+            detail::insertVariableNames(command.getGuardExpression().getVariables(), commandVariables);
+            for (auto const& update : command.getUpdates()) {
+                for (auto const& assignment : update.getAssignments()) {
+                    commandVariables.insert(assignment.getVariableName());
+                    detail::insertVariableNames(assignment.getExpression().getVariables(), commandVariables);
+                }
+            }
+            if (command.isLabeled()) {
+                actionToVariables[command.getActionIndex()].insert(commandVariables.begin(), commandVariables.end());
+            }
+            graph.addHyperedge(commandVariables);
+        }
+    }
+    for (auto const& actionVariables : actionToVariables) {
+        graph.addHyperedge(actionVariables.second);
+    }
+    return graph.computeOrder(heuristic);
+}
+
+std::vector<std::string> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderingHeuristic const& heuristic) {
+    detail::DependencyGraph graph;
+    // The declaration order coincides with the order in which the dd builder creates the variables.
+    for (auto const& automaton : model.getAutomata()) {
+        graph.addVariable("l_" + automaton.getName());
+    }
+    for (auto const& variable : model.getGlobalVariables()) {
+        if (!variable.isTransient()) {
+            graph.addVariable(variable.getExpressionVariable().getName());
+        }
+    }
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& variable : automaton.getVariables()) {
+            if (!variable.isTransient()) {
+                graph.addVariable(variable.getExpressionVariable().getName());
+            }
+        }
+    }
+
+    std::map<uint64_t, std::set<std::string>> actionToVariables;
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<std::string> edgeVariables = {"l_" + automaton.getName()};
+            detail::insertVariableNames(edge.getGuard().getVariables(), edgeVariables);
+            for (auto const& destination : edge.getDestinations()) {
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    if (assignment.getLValue().isVariable()) {
+                        edgeVariables.insert(assignment.getExpressionVariable().getName());
+                    }
+                    detail::insertVariableNames(assignment.getAssignedExpression().getVariables(), edgeVariables);
+                }
+            }
+            if (edge.getActionIndex() != storm::jani::Model::SILENT_ACTION_INDEX) {
+                actionToVariables[edge.getActionIndex()].insert(edgeVariables.begin(), edgeVariables.end());
+            }
+            graph.addHyperedge(edgeVariables);
+        }
+    }
+    for (auto const& actionVariables : actionToVariables) {
+        graph.addHyperedge(actionVariables.second);
+    }
+    return graph.computeOrder(heuristic);
+}
+
+std::vector<std::string> applyPreferredDdVariableOrder(std::vector<std::string> const& order, std::vector<std::string> const& preferredOrder) {
+    std::set<std::string> const knownVariables(order.begin(), order.end());
+    std::vector<std::string> result;
+    std::set<std::string> placedVariables;
+    for (auto const& variable : preferredOrder) {
+        if (knownVariables.count(variable) == 0) {
+            STORM_LOG_WARN("Ignoring unknown variable '" << variable << "' in the given variable order.");
+        } else if (placedVariables.insert(variable).second) {
+            result.push_back(variable);
+        }
+    }
+    STORM_LOG_WARN_COND(placedVariables.size() == knownVariables.size(),
+                        "The given variable order does not cover all variables. " << (knownVariables.size() - placedVariables.size())
+                                                                                  << " variable(s) are placed below the given ones.");
+    for (auto const& variable : order) {
+        if (placedVariables.count(variable) == 0) {
+            result.push_back(variable);
+        }
+    }
+    return result;
+}
+
+template<typename ModelType>
+std::vector<std::string> getDdVariableOrderFromSettings(ModelType const& model) {
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    auto const heuristic = buildSettings.getDdVariableOrderingHeuristic();
+    if (heuristic == DdVariableOrderingHeuristic::Declaration && !buildSettings.isDdVariableOrderImportSet()) {
+        return {};
+    }
+    std::vector<std::string> result = computeDdVariableOrder(model, heuristic);
+    if (buildSettings.isDdVariableOrderImportSet()) {
+        result = applyPreferredDdVariableOrder(result, importDdVariableOrder(buildSettings.getDdVariableOrderImportFilename()));
+    }
+    STORM_LOG_INFO("Using variable order (" << heuristic << (buildSettings.isDdVariableOrderImportSet() ? ", imported" : "") << ") with "
+                                            << result.size() << " variable(s).");
+    return result;
+}
+
+std::vector<std::string> importDdVariableOrder(std::string const& filename) {
+    std::vector<std::string> result;
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    std::string line;
+    while (storm::utility::getline(stream, line)) {
+        line.erase(0, line.find_first_not_of(" \t"));
+        line.erase(line.find_last_not_of(" \t") + 1);
+        if (!line.empty() && line.front() != '#') {
+            result.push_back(line);
+        }
+    }
+    storm::utility::closeFile(stream);
+    return result;
+}
+
+template<storm::dd::DdType Type>
+void exportDdVariableOrder(storm::dd::DdManager<Type> const& manager,
+                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                           std::string const& filename) {
+    std::vector<std::pair<uint64_t, std::string>> levelsAndNames;
+    for (auto const& rowColumnPair : rowColumnMetaVariablePairs) {
+        uint64_t topLevel = std::numeric_limits<uint64_t>::max();
+        for (auto const& indexAndLevel : manager.getMetaVariable(rowColumnPair.first).getIndicesAndLevels()) {
+            topLevel = std::min(topLevel, indexAndLevel.second);
+        }
+        levelsAndNames.emplace_back(topLevel, rowColumnPair.first.getName());
+    }
+    std::sort(levelsAndNames.begin(), levelsAndNames.end());
+
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream);
+    stream << "# variable order (top-most first)\n";
+    for (auto const& levelAndName : levelsAndNames) {
+        stream << levelAndName.second << '\n';
+    }
+    storm::utility::closeFile(stream);
+}
+
+template<storm::dd::DdType Type>
+std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createMetaVariablesInOrder(
+    storm::dd::DdManager<Type>& manager, std::vector<std::string> const& order,
+    std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> const& domains) {
+    std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> result;
+    for (auto const& name : order) {
+        auto domainIt = domains.find(name);
+        if (domainIt == domains.end()) {
+            continue;
+        }
+        if (domainIt->second) {
+            result.emplace(name, manager.addMetaVariable(name, domainIt->second->first, domainIt->second->second));
+        } else {
+            result.emplace(name, manager.addMetaVariable(name));
+        }
+    }
+    return result;
+}
+
+template std::vector<std::string> getDdVariableOrderFromSettings(storm::prism::Program const& model);
+template std::vector<std::string> getDdVariableOrderFromSettings(storm::jani::Model const& model);
+
+template void exportDdVariableOrder(storm::dd::DdManager<storm::dd::DdType::CUDD> const& manager,
+                                    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                                    std::string const& filename);
+template void exportDdVariableOrder(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager,
+                                    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                                    std::string const& filename);
+
+template std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createMetaVariablesInOrder(
+    storm::dd::DdManager<storm::dd::DdType::CUDD>& manager, std::vector<std::string> const& order,
+    std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> const& domains);
+template std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createMetaVariablesInOrder(
+    storm::dd::DdManager<storm::dd::DdType::Sylvan>& manager, std::vector<std::string> const& order,
+    std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> const& domains);
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storm/builder/DdVariableOrderingHeuristic.h"
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+namespace dd {
+template<storm::dd::DdType Type>
+class DdManager;
+}
+
+namespace builder {
+
+/*!
+ * Computes an order of the given variables with the FORCE heuristic (Aloul et al.), i.e., the variables are iteratively moved towards the centers of
+ * gravity of the hyperedges they are contained in as long as this decreases the total span of the hyperedges.
+ *
+ * @param numberOfVariables The number of variables. The initial order is given by the indices of the variables.
+ * @param hyperedges The hyperedges of the dependency graph, each given by the indices of the contained variables.
+ * @return The indices of the variables from the top-most to the bottom-most one.
+ */
+std::vector<uint64_t> computeForceOrder(uint64_t numberOfVariables, std::vector<std::vector<uint64_t>> const& hyperedges);
+
+/*!
+ * Computes an order of the state variables of the given program. A command induces a hyperedge of the dependency graph that contains the variables
+ * it reads and writes. Similarly, all commands labeled with the same synchronizing action induce a hyperedge.
+ *
+ * @return The names of the state variables from the top-most to the bottom-most one.
+ */
+std::vector<std::string> computeDdVariableOrder(storm::prism::Program const& program, DdVariableOrderingHeuristic const& heuristic);
+
+/*!
+ * Computes an order of the (non-transient) variables and the location variables of the given model. The location variable of automaton A is named l_A.
+ * An edge induces a hyperedge of the dependency graph that contains the location variable of its automaton and the variables it reads and writes.
+ * Similarly, all edges labeled with the same (non-silent) action induce a hyperedge.
+ *
+ * @return The names of the variables from the top-most to the bottom-most one.
+ */
+std::vector<std::string> computeDdVariableOrder(storm::jani::Model const& model, DdVariableOrderingHeuristic const& heuristic);
+
+/*!
+ * Moves the variables that appear in the given preferred order to the top (in the preferred order). The remaining variables keep their relative order.
+ */
+std::vector<std::string> applyPreferredDdVariableOrder(std::vector<std::string> const& order, std::vector<std::string> const& preferredOrder);
+
+/*!
+ * Retrieves the order of the state variables that is requested via the build settings (heuristic and imported order).
+ *
+ * @return The names of the variables from the top-most to the bottom-most one or an empty vector if the variables are to be created in the order of
+ * their declaration.
+ */
+template<typename ModelType>
+std::vector<std::string> getDdVariableOrderFromSettings(ModelType const& model);
+
+/*!
+ * Reads a variable order from the given file. The file contains one variable name per line, empty lines and lines starting with '#' are ignored.
+ */
+std::vector<std::string> importDdVariableOrder(std::string const& filename);
+
+/*!
+ * Writes the current order of the given (row) meta variables to the given file such that it can be imported in later runs.
+ * The variables are ordered by the level of their top-most DD variable, i.e. the order also reflects dynamic reordering (if enabled).
+ */
+template<storm::dd::DdType Type>
+void exportDdVariableOrder(storm::dd::DdManager<Type> const& manager,
+                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+                           std::string const& filename);
+
+/*!
+ * Creates row and column meta variables for the given variables in the given order. Variables in the order without a domain are skipped.
+ *
+ * @param domains For each variable, the range of an integer variable or nothing for a boolean variable.
+ * @return The created meta variables indexed by the names of the variables.
+ */
+template<storm::dd::DdType Type>
+std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createMetaVariablesInOrder(
+    storm::dd::DdManager<Type>& manager, std::vector<std::string> const& order,
+    std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> const& domains);
+
+}  // namespace builder
+}  // namespace storm
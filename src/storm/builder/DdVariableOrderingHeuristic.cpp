@@ -0,0 +1,22 @@
+#include "storm/builder/DdVariableOrderingHeuristic.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic) {
+    switch (heuristic) {
+        case DdVariableOrderingHeuristic::Declaration:
+            out << "declaration";
+            break;
+        case DdVariableOrderingHeuristic::Force:
+            out << "force";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all currently supported heuristics for the (static) order of the state variables in decision diagrams.
+enum class DdVariableOrderingHeuristic { Declaration, Force };
+
+std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+
+}  // namespace builder
+}  // namespace storm
@@ -1,14 +1,19 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <sys/resource.h>
 #include <map>
+#include <unordered_map>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
-#include "storm/builder/RewardModelBuilder.h"
+#include "storm/builder/FusedRewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
+#include "storm/builder/StreamingModelWriter.h"
 
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -22,6 +27,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
@@ -30,6 +36,9 @@
 #include "storm/storage/jani/ParallelComposition.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
@@ -39,19 +48,150 @@
 namespace storm {
 namespace builder {
 
+namespace {
+/*!
+ * Expands batches of states from the front of the exploration queue using (cloned) generators in multiple threads.
+ * While a batch is expanded, no new states are added to the state storage. Instead, successor states that are not yet known obtain temporary indices.
+ * These are resolved once the behavior of the corresponding state is requested, which happens in the same order in which a sequential exploration would
+ * have discovered them. Hence, the resulting state indices coincide with the ones obtained by a sequential (breadth-first) exploration.
+ */
+template<typename ValueType, typename StateType>
+class ParallelStateExpander {
+   public:
+    static constexpr uint64_t MaximalBatchSize = 65536;
+
+    ParallelStateExpander(std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>>&& workerGenerators,
+                          storm::storage::sparse::StateStorage<StateType> const& stateStorage)
+        : workerGenerators(std::move(workerGenerators)), stateStorage(stateStorage) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Expands the first states of the given queue (unless the current batch has not been processed yet).
+     * @param statesToExplore The exploration queue which must not be modified until all states of the batch have been processed.
+     * @param expansionLimit If given, no states will be expanded if the number of states reaches this limit.
+     */
+    void prepareBatch(std::deque<std::pair<CompressedState, StateType>> const& statesToExplore, std::optional<StateType> const& expansionLimit) {
+        if (currentPosition < batch.size()) {
+            return;
+        }
+        uint64_t const batchSize = std::min<uint64_t>(statesToExplore.size(), MaximalBatchSize);
+        batch.resize(batchSize);
+        currentPosition = 0;
+        firstTemporaryIndex = stateStorage.getNumberOfStates();
+        if (expansionLimit.has_value() && firstTemporaryIndex >= expansionLimit.value()) {
+            // The limit is already reached, so no state of this batch will be expanded.
+            for (auto& entry : batch) {
+                entry.behavior = StateBehavior<ValueType, StateType>();
+                entry.newStates.clear();
+            }
+            return;
+        }
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batchSize, 16), [&statesToExplore, this](tbb::blocked_range<uint64_t> const& range) {
+            STORM_LOG_ASSERT(static_cast<uint64_t>(tbb::this_task_arena::current_thread_index()) < workerGenerators.size(), "Unexpected thread index.");
+            auto& generator = *workerGenerators[tbb::this_task_arena::current_thread_index()];
+            for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                expand(generator, statesToExplore[i].first, batch[i]);
+            }
+        });
+#else
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            expand(*workerGenerators.front(), statesToExplore[i].first, batch[i]);
+        }
+#endif
+    }
+
+    /*!
+     * Retrieves the behavior of the next state of the current batch.
+     * @param stateToIdCallback Used to resolve the successor states that were unknown during the expansion.
+     * @param resolve If false, the successor states are not resolved, i.e., the behavior is discarded by the caller.
+     */
+    StateBehavior<ValueType, StateType> nextBehavior(std::function<StateType(CompressedState const&)> const& stateToIdCallback, bool resolve) {
+        STORM_LOG_ASSERT(currentPosition < batch.size(), "No behavior left in the current batch.");
+        auto& entry = batch[currentPosition++];
+        resolvedIndices.clear();
+        if (resolve) {
+            for (auto const& newState : entry.newStates) {
+                resolvedIndices.push_back(stateToIdCallback(newState));
+            }
+        }
+        return std::move(entry.behavior);
+    }
+
+    /*!
+     * Translates an index occurring in the behavior that has been retrieved last into the actual state index.
+     */
+    StateType getStateIndex(StateType const& index) const {
+        return index < firstTemporaryIndex ? index : resolvedIndices[index - firstTemporaryIndex];
+    }
+
+   private:
+    struct BatchEntry {
+        StateBehavior<ValueType, StateType> behavior;
+        std::vector<CompressedState> newStates;
+    };
+
+    void expand(storm::generator::NextStateGenerator<ValueType, StateType>& generator, CompressedState const& state, BatchEntry& entry) const {
+        entry.newStates.clear();
+        std::unordered_map<CompressedState, StateType> temporaryIndices;
+        auto stateToIdCallback = [this, &entry, &temporaryIndices](CompressedState const& successor) -> StateType {
+            if (stateStorage.stateToId.contains(successor)) {
+                return stateStorage.stateToId.getValue(successor);
+            }
+            auto insertionRes = temporaryIndices.emplace(successor, static_cast<StateType>(firstTemporaryIndex + entry.newStates.size()));
+            if (insertionRes.second) {
+                entry.newStates.push_back(successor);
+            }
+            return insertionRes.first->second;
+        };
+        generator.load(state);
+        entry.behavior = generator.expand(stateToIdCallback);
+    }
+
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+    storm::storage::sparse::StateStorage<StateType> const& stateStorage;
+    std::vector<BatchEntry> batch;
+    uint64_t currentPosition = 0;
+    uint64_t firstTemporaryIndex = 0;
+    std::vector<StateType> resolvedIndices;
+};
+
+/*!
+ * Retrieves the peak memory usage (resident set size) of this process in MB.
+ */
+uint64_t getPeakMemoryUsageInMegabytes() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024 / 1024;
+#else
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss / 1024;
+#endif
+}
+}  // namespace
+
 template<typename StateType>
 StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
     auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
-    // TODO search once
-    if (!stateToId.contains(cs)) {
-        return static_cast<StateType>(this->size());
-    }
-    return this->stateToId.getValue(cs);
+    return table.lookup(cs);
+}
+
+template<typename StateType>
+std::vector<StateType> ExplicitStateLookup<StateType>::lookup(std::vector<int64_t> const& valuations) const {
+    return table.lookup(valuations);
 }
 
 template<typename StateType>
 uint64_t ExplicitStateLookup<StateType>::size() const {
-    return this->stateToId.size();
+    return table.size();
+}
+
+template<typename StateType>
+StateLookupTable<StateType> const& ExplicitStateLookup<StateType>::getLookupTable() const {
+    return table;
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -62,12 +202,17 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
     if (buildSettings.isExplorationStateLimitSet()) {
         explorationStateLimit = buildSettings.getExplorationStateLimit();
     }
+    if (buildSettings.isExplorationMemoryLimitSet()) {
+        explorationMemoryLimit = buildSettings.getExplorationMemoryLimit();
+    }
+    parallelExploration = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    compressStates = buildSettings.isCompressStatesSet();
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator), options(options), stateStorage(generator->getStateSize(), options.compressStates) {
     // Intentionally left empty.
 }
 
@@ -115,8 +260,10 @@ template<typename ValueType, typename RewardModelType, typename StateType>
 StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
     StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
-    // Check, if the state was already registered.
-    std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+    // Check, if the state was already registered. If the generator derived the hash of the state incrementally, we do not rehash it.
+    auto const& stateHash = generator->getCallbackStateHash();
+    std::pair<StateType, std::size_t> actualIndexBucketPair = stateHash ? stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex, stateHash.get())
+                                                                        : stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
 
     StateType actualIndex = actualIndexBucketPair.first;
 
@@ -128,6 +275,11 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
             statesToExplore.emplace_back(state, actualIndex);
+        } else if (options.explorationOrder == ExplorationOrder::ProbabilityMass) {
+            // The state is only queued once its probability mass is known.
+            pendingStates.emplace(actualIndex, state);
+            stateProbabilityMass.push_back(0.0);
+            stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -136,16 +288,124 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     return actualIndex;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::hasStatesToExplore() const {
+    return !statesToExplore.empty() || !pendingStates.empty();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::pair<CompressedState, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::popStateToExplore() {
+    if (options.explorationOrder != ExplorationOrder::ProbabilityMass) {
+        std::pair<CompressedState, StateType> result = std::move(statesToExplore.front());
+        statesToExplore.pop_front();
+        return result;
+    }
+
+    // Skip the outdated entries of the queue, i.e., the ones whose state was explored already or whose mass has increased in the meantime.
+    auto stateIt = pendingStates.end();
+    while (!pendingStatesByMass.empty() && stateIt == pendingStates.end()) {
+        auto const [mass, state] = pendingStatesByMass.top();
+        pendingStatesByMass.pop();
+        if (mass == stateProbabilityMass[state]) {
+            stateIt = pendingStates.find(state);
+        }
+    }
+    if (stateIt == pendingStates.end()) {
+        // No pending state received any probability mass (e.g. because of vanishing probabilities), so we take an arbitrary one.
+        stateIt = pendingStates.begin();
+    }
+    std::pair<CompressedState, StateType> result(std::move(stateIt->second), stateIt->first);
+    pendingStates.erase(stateIt);
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::distributeProbabilityMass(
+    StateType const& state, storm::generator::StateBehavior<ValueType, StateType> const& behavior) {
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The probability mass guided exploration order is not supported for parametric models.");
+    } else {
+        double choiceMass = stateProbabilityMass[state] / behavior.getNumberOfChoices();
+        for (auto const& choice : behavior) {
+            // For continuous-time models, the choices carry rates that need to be normalized.
+            double totalMass = storm::utility::convertNumber<double>(choice.getTotalMass());
+            for (auto const& stateProbabilityPair : choice) {
+                StateType const successor = stateProbabilityPair.first;
+                if (pendingStates.count(successor) > 0) {
+                    stateProbabilityMass[successor] += choiceMass * storm::utility::convertNumber<double>(stateProbabilityPair.second) / totalMass;
+                    pendingStatesByMass.emplace(stateProbabilityMass[successor], successor);
+                }
+            }
+        }
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
+namespace {
+// The rewards of all reward models are either added to a single FusedRewardModelBuilder or to one (streaming) builder per reward model.
+template<typename RewardValueType, typename ValueType>
+void addStateRewards(FusedRewardModelBuilder<RewardValueType>& rewardModelBuilder, std::vector<ValueType> const& rewards) {
+    rewardModelBuilder.addStateRewards(rewards);
+}
+
+template<typename RewardModelBuilderType, typename ValueType>
+void addStateRewards(std::vector<RewardModelBuilderType>& rewardModelBuilders, std::vector<ValueType> const& rewards) {
+    auto stateRewardIt = rewards.begin();
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        if (rewardModelBuilder.hasStateRewards()) {
+            rewardModelBuilder.addStateReward(*stateRewardIt);
+        }
+        ++stateRewardIt;
+    }
+}
+
+template<typename RewardValueType, typename ValueType>
+void addChoiceRewards(FusedRewardModelBuilder<RewardValueType>& rewardModelBuilder, std::vector<ValueType> const& rewards) {
+    rewardModelBuilder.addChoiceRewards(rewards);
+}
+
+template<typename RewardModelBuilderType, typename ValueType>
+void addChoiceRewards(std::vector<RewardModelBuilderType>& rewardModelBuilders, std::vector<ValueType> const& rewards) {
+    auto choiceRewardIt = rewards.begin();
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        if (rewardModelBuilder.hasStateActionRewards()) {
+            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+        }
+        ++choiceRewardIt;
+    }
+}
+
+// Adds zero rewards for a state with a single (self-loop) choice.
+template<typename ValueType, typename RewardValueType>
+void addZeroRewards(FusedRewardModelBuilder<RewardValueType>& rewardModelBuilder) {
+    rewardModelBuilder.addZeroStateRewards();
+    rewardModelBuilder.addZeroChoiceRewards();
+}
+
+template<typename ValueType, typename RewardModelBuilderType>
+void addZeroRewards(std::vector<RewardModelBuilderType>& rewardModelBuilders) {
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        if (rewardModelBuilder.hasStateRewards()) {
+            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+        }
+
+        if (rewardModelBuilder.hasStateActionRewards()) {
+            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+        }
+    }
+}
+}  // namespace
+
 template<typename ValueType, typename RewardModelType, typename StateType>
-void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
-    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
-    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+template<typename TransitionMatrixBuilderType, typename RewardModelBuildersType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(TransitionMatrixBuilderType& transitionMatrixBuilder,
+                                                                                RewardModelBuildersType& rewardModelBuilders,
+                                                                                StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
     // Initialize building state valuations (if necessary)
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
         stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
@@ -166,6 +426,46 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
+    if (options.explorationOrder == ExplorationOrder::ProbabilityMass) {
+        STORM_LOG_THROW((!std::is_same_v<ValueType, storm::RationalFunction>), storm::exceptions::NotSupportedException,
+                        "The probability mass guided exploration order is not supported for parametric models.");
+        for (auto const& initialState : this->stateStorage.initialStateIndices) {
+            stateProbabilityMass[initialState] = 1.0 / this->stateStorage.initialStateIndices.size();
+            pendingStatesByMass.emplace(stateProbabilityMass[initialState], initialState);
+        }
+    }
+
+    // If requested, prepare the generators that are used to expand states in parallel.
+    std::unique_ptr<ParallelStateExpander<ValueType, StateType>> parallelExpander;
+    if (options.parallelExploration) {
+#ifdef STORM_HAVE_INTELTBB
+        if (options.explorationOrder != ExplorationOrder::Bfs) {
+            STORM_LOG_WARN("Parallel state space exploration is only supported for breadth-first exploration order. Exploring sequentially.");
+        } else if (!storm::NumberTraits<ValueType>::IsThreadSafe) {
+            STORM_LOG_WARN("Parallel state space exploration is not supported for this value type. Exploring sequentially.");
+        } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+            STORM_LOG_WARN("Parallel state space exploration is not supported when labeling states with overlapping guards. Exploring sequentially.");
+        } else if (generator->getOptions().isPartialOrderReductionSet()) {
+            STORM_LOG_WARN("Parallel state space exploration is not supported for partial order reduction. Exploring sequentially.");
+        } else {
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+            for (int worker = 0; worker < tbb::this_task_arena::max_concurrency(); ++worker) {
+                auto workerGenerator = generator->clone();
+                if (!workerGenerator) {
+                    workerGenerators.clear();
+                    break;
+                }
+                workerGenerators.push_back(std::move(workerGenerator));
+            }
+            STORM_LOG_WARN_COND(!workerGenerators.empty(), "The next-state generator does not support parallel state space exploration. Exploring sequentially.");
+            if (!workerGenerators.empty()) {
+                parallelExpander = std::make_unique<ParallelStateExpander<ValueType, StateType>>(std::move(workerGenerators), this->stateStorage);
+            }
+        }
+#else
+        STORM_LOG_WARN("Parallel state space exploration requires Intel TBB. Exploring sequentially.");
+#endif
+    }
 
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
@@ -175,13 +475,25 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
+    bool memoryLimitExceeded = false;
+    // Reports to the progress callback (if any). Printing progress is handled separately below.
+    std::optional<storm::utility::ProgressMeasurement> progress;
+    if (storm::utility::hasProgressCallback()) {
+        progress.emplace("states");
+        progress->startNewMeasurement(0);
+    }
 
     // Perform a search through the model.
-    while (!statesToExplore.empty()) {
-        // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
-        StateType currentIndex = statesToExplore.front().second;
-        statesToExplore.pop_front();
+    while (hasStatesToExplore()) {
+        if (parallelExpander) {
+            // Expand the states at the front of the queue in parallel (if not already done).
+            parallelExpander->prepareBatch(statesToExplore, options.explorationStateLimit);
+        }
+
+        // Get the next state to explore.
+        std::pair<CompressedState, StateType> stateAndIndex = popStateToExplore();
+        CompressedState const& currentState = stateAndIndex.first;
+        StateType const currentIndex = stateAndIndex.second;
 
         // If the exploration order differs from breadth-first, we remember that this row group was actually
         // filled with the transitions of a different state.
@@ -193,15 +505,29 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
         }
 
-        generator->load(currentState);
+        if (!parallelExpander || stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+            generator->load(currentState);
+        }
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
 
         storm::generator::StateBehavior<ValueType, StateType> behavior;
-        // If the exploration state limit is set and the limit is reached, we stop the exploration.
-        bool const stateLimitExceeded = options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
-        if (!stateLimitExceeded) {
+        // If the exploration state limit or memory limit is set and the limit is reached, we stop the exploration. As determining the memory usage
+        // involves a system call, we only do so periodically.
+        if (options.explorationMemoryLimit.has_value() && !memoryLimitExceeded && numberOfExploredStates % 1024 == 0) {
+            memoryLimitExceeded = getPeakMemoryUsageInMegabytes() >= options.explorationMemoryLimit.value();
+            STORM_LOG_WARN_COND(!memoryLimitExceeded, "Memory limit reached after exploring " << numberOfExploredStates << " states.");
+        }
+        bool const stateLimitExceeded = memoryLimitExceeded || (options.explorationStateLimit.has_value() &&
+                                                                stateStorage.getNumberOfStates() >= options.explorationStateLimit.value());
+        if (parallelExpander) {
+            // The behavior was already computed, we only need to resolve the newly discovered states.
+            auto expandedBehavior = parallelExpander->nextBehavior(stateToIdCallback, !stateLimitExceeded);
+            if (!stateLimitExceeded) {
+                behavior = std::move(expandedBehavior);
+            }
+        } else if (!stateLimitExceeded) {
             behavior = generator->expand(stateToIdCallback);
         }
 
@@ -215,7 +541,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
                 this->stateStorage.deadlockStateIndices.push_back(currentIndex);
             } else {
                 if (stateLimitExceeded) {
-                    // (b) The state was not expanded because the state limit is reached
+                    // (b) The state was not expanded because the state (or memory) limit is reached
                     this->stateStorage.unexploredStateIndices.push_back(currentIndex);
                 }
                 // (c) the state was not expanded because it is terminal, i.e., exploration from that state is not required for the given property/ies
@@ -229,15 +555,7 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
 
             transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
 
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                }
-
-                if (rewardModelBuilder.hasStateActionRewards()) {
-                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                }
-            }
+            addZeroRewards<ValueType>(rewardModelBuilders);
 
             // This state shall be Markovian (to not introduce Zeno behavior)
             if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
@@ -250,15 +568,13 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             ++currentRow;
             ++currentRowGroup;
         } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
+            if (options.explorationOrder == ExplorationOrder::ProbabilityMass) {
+                distributeProbabilityMass(currentIndex, behavior);
             }
 
+            // Add the state rewards to the corresponding reward models.
+            addStateRewards(rewardModelBuilders, behavior.getStateRewards());
+
             // If the model is nondeterministic, we need to open a row group.
             if (!generator->isDeterministicModel()) {
                 transitionMatrixBuilder.newRowGroup(currentRow);
@@ -290,17 +606,12 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
 
                 // Add the probabilistic behavior to the matrix.
                 for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    StateType const column = parallelExpander ? parallelExpander->getStateIndex(stateProbabilityPair.first) : stateProbabilityPair.first;
+                    transitionMatrixBuilder.addNextValue(currentRow, column, stateProbabilityPair.second);
                 }
 
                 // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
+                addChoiceRewards(rewardModelBuilders, choice.getRewards());
                 ++currentRow;
                 firstChoiceOfState = false;
             }
@@ -309,6 +620,10 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         }
 
         ++numberOfExploredStates;
+        if (progress) {
+            progress->setFrontierSize(statesToExplore.size());
+            progress->reportProgress(numberOfExploredStates);
+        }
         if (generator->getOptions().isShowProgressSet()) {
             ++numberOfExploredStatesSinceLastMessage;
 
@@ -344,8 +659,10 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         // (c) the hash map storing the mapping states -> ids
         // (d) fix remapping for state-generation labels
 
-        // Fix (a).
-        transitionMatrixBuilder.replaceColumns(remapping, 0);
+        // Fix (a). Streamed models are always explored in breadth-first order, so only the matrix builder needs to be fixed.
+        if constexpr (std::is_same_v<TransitionMatrixBuilderType, storm::storage::SparseMatrixBuilder<ValueType>>) {
+            transitionMatrixBuilder.replaceColumns(remapping, 0);
+        }
 
         // Fix (b).
         std::vector<StateType> newInitialStateIndices(this->stateStorage.initialStateIndices.size());
@@ -369,10 +686,11 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
 
     // Prepare the component builders
     storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
-    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
+    std::vector<RewardModelInformation> rewardModelInformation;
     for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
-        rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
+        rewardModelInformation.push_back(generator->getRewardModelInformation(i));
     }
+    FusedRewardModelBuilder<typename RewardModelType::ValueType> rewardModelBuilder(rewardModelInformation);
     StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
     stateAndChoiceInformationBuilder.setBuildChoiceLabels(generator->getOptions().isBuildChoiceLabelsSet());
     stateAndChoiceInformationBuilder.setBuildChoiceOrigins(generator->getOptions().isBuildChoiceOriginsSet());
@@ -380,7 +698,7 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    buildMatrices(transitionMatrixBuilder, rewardModelBuilder, stateAndChoiceInformationBuilder);
 
     // Initialize the model components with the obtained information.
     storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
@@ -391,10 +709,7 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
 
     // Now finalize all reward models.
-    for (auto& rewardModelBuilder : rewardModelBuilders) {
-        modelComponents.rewardModels.emplace(rewardModelBuilder.getName(),
-                                             rewardModelBuilder.build(numChoices, modelComponents.transitionMatrix.getColumnCount(), numStates));
-    }
+    modelComponents.rewardModels = rewardModelBuilder.build(numChoices, numStates);
     // Build the player assignment
     if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications()) {
         modelComponents.statePlayerIndications = stateAndChoiceInformationBuilder.buildStatePlayerIndications(numStates);
@@ -417,14 +732,7 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
         modelComponents.choiceOrigins = generator->generateChoiceOrigins(originData);
     }
     if (generator->isPartiallyObservable()) {
-        std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
-        std::unordered_map<uint32_t, std::vector<std::pair<std::vector<std::string>, uint32_t>>> observationActions;
-        for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-            uint32_t varObservation = generator->observabilityClass(bitVectorIndexPair.first);
-            classes[bitVectorIndexPair.second] = varObservation;
-        }
-
-        modelComponents.observabilityClasses = classes;
+        modelComponents.observabilityClasses = buildObservabilityClasses();
         if (generator->getOptions().isBuildObservationValuationsSet()) {
             modelComponents.observationValuations = generator->makeObservationValuation();
         }
@@ -432,11 +740,69 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     return modelComponents;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildToDrbFile(std::string const& filename, std::string const& temporaryDirectory) {
+    if constexpr (!std::is_same_v<ValueType, double> || !std::is_same_v<typename RewardModelType::ValueType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Streaming model construction only supports models with double values.");
+    } else {
+        storm::exporter::drb::ModelTypeCode modelType;
+        switch (generator->getModelType()) {
+            case storm::generator::ModelType::DTMC:
+                modelType = storm::exporter::drb::ModelTypeCode::Dtmc;
+                break;
+            case storm::generator::ModelType::CTMC:
+                modelType = storm::exporter::drb::ModelTypeCode::Ctmc;
+                break;
+            case storm::generator::ModelType::MDP:
+                modelType = storm::exporter::drb::ModelTypeCode::Mdp;
+                break;
+            case storm::generator::ModelType::POMDP:
+                modelType = storm::exporter::drb::ModelTypeCode::Pomdp;
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Streaming model construction does not support this model type.");
+        }
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::NotSupportedException,
+                        "Streaming model construction requires breadth-first exploration.");
+        STORM_LOG_WARN_COND(!generator->getOptions().isBuildStateValuationsSet() && !generator->getOptions().isBuildChoiceOriginsSet(),
+                            "State valuations and choice origins are not written by the streaming model construction.");
+
+        StreamingModelWriter writer(filename, modelType, temporaryDirectory);
+        std::vector<StreamingRewardModelBuilder> rewardModelBuilders;
+        for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+            rewardModelBuilders.push_back(writer.createRewardModelBuilder(generator->getRewardModelInformation(i)));
+        }
+        StateAndChoiceInformationBuilder stateAndChoiceInformationBuilder;
+        stateAndChoiceInformationBuilder.setBuildChoiceLabels(generator->getOptions().isBuildChoiceLabelsSet());
+
+        buildMatrices(writer, rewardModelBuilders, stateAndChoiceInformationBuilder);
+
+        boost::optional<storm::models::sparse::ChoiceLabeling> choiceLabeling;
+        if (stateAndChoiceInformationBuilder.isBuildChoiceLabels()) {
+            choiceLabeling = stateAndChoiceInformationBuilder.buildChoiceLabeling(writer.getCurrentRowCount());
+        }
+        boost::optional<std::vector<uint32_t>> observabilityClasses;
+        if (generator->isPartiallyObservable()) {
+            observabilityClasses = buildObservabilityClasses();
+        }
+        writer.finalize(buildStateLabeling(), rewardModelBuilders, choiceLabeling, observabilityClasses);
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
     return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices, stateStorage.unexploredStateIndices);
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::vector<uint32_t> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildObservabilityClasses() {
+    std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
+    for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
+        classes[bitVectorIndexPair.second] = generator->observabilityClass(bitVectorIndexPair.first);
+    }
+    return classes;
+}
+
 // Explicitly instantiate the class.
 template class ExplicitModelBuilder<double, storm::models::sparse::StandardRewardModel<double>, uint32_t>;
 template class ExplicitStateLookup<uint32_t>;
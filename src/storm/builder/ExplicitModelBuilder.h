@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <deque>
 #include <memory>
+#include <queue>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -24,6 +26,7 @@
 #include "storm/utility/prism.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/StateLookupTable.h"
 
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/NextStateGenerator.h"
@@ -38,14 +41,15 @@ using namespace storm::generator;
 
 // Forward-declare classes.
 template<typename ValueType>
-class RewardModelBuilder;
+class FusedRewardModelBuilder;
 class StateAndChoiceInformationBuilder;
 
 template<typename StateType>
 class ExplicitStateLookup {
    public:
-    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::BitVectorHashMap<StateType> const& stateToId)
-        : varInfo(varInfo), stateToId(stateToId) {
+    ExplicitStateLookup(VariableInformation const& varInfo,
+                        storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> const& stateToId)
+        : varInfo(varInfo), table(varInfo, stateToId) {
         // intentionally left empty.
     }
 
@@ -55,14 +59,27 @@ class ExplicitStateLookup {
      * @return The id of the state, or size() when no state is found
      */
     StateType lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const;
+
+    /**
+     * Lookup states in batch
+     * @param valuations The concatenated valuations of the variables, see StateLookupTable
+     * @return For each valuation the id of the state, or size() when no state is found
+     */
+    std::vector<StateType> lookup(std::vector<int64_t> const& valuations) const;
+
     /**
      * How many states have been stored?
      */
     uint64_t size() const;
 
+    /**
+     * The table underlying the lookup, which can be stored and used without the model.
+     */
+    StateLookupTable<StateType> const& getLookupTable() const;
+
    private:
     VariableInformation varInfo;
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    StateLookupTable<StateType> table;
 };
 
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -82,6 +99,16 @@ class ExplicitModelBuilder {
 
         // If set, no further states will be explored once the given number is exceeded.
         std::optional<StateType> explorationStateLimit;
+
+        // If set, no further states will be explored once the peak memory usage (in MB) exceeds the given number.
+        std::optional<uint64_t> explorationMemoryLimit;
+
+        // If set, states are expanded using multiple threads. This requires Intel TBB and breadth-first exploration.
+        // The resulting model coincides with the one obtained by a sequential exploration.
+        bool parallelExploration;
+
+        // If set, the explored states are stored tree-compressed.
+        bool compressStates;
     };
 
     /*!
@@ -118,6 +145,18 @@ class ExplicitModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+    /*!
+     * Explores the model like build() but streams it into a file in the binary drb format instead of building it in memory. The transitions and
+     * rewards are written to temporary files while the model is explored and these are assembled to the drb file afterwards, so the transition
+     * matrix is never held in memory. The model can subsequently be loaded with the DirectEncodingBinaryParser.
+     * This requires breadth-first exploration and double values. Markov automata and stochastic games, state valuations and choice origins are
+     * not supported.
+     *
+     * @param filename The name of the drb file.
+     * @param temporaryDirectory The directory in which the temporary files are stored. If empty, the directory of the drb file is used.
+     */
+    void buildToDrbFile(std::string const& filename, std::string const& temporaryDirectory = "");
+
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
      * This wrapper can be helpful to find states in later stages.
@@ -137,15 +176,32 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Retrieves whether there are states that still need to be explored.
+     */
+    bool hasStatesToExplore() const;
+
+    /*!
+     * Removes the state that is to be explored next (according to the exploration order) and returns it together with its id.
+     */
+    std::pair<CompressedState, StateType> popStateToExplore();
+
+    /*!
+     * For the probability mass guided exploration order, distributes the probability mass of the given (explored) state to its successors
+     * that still need to be explored. Nondeterministic choices are weighted uniformly.
+     */
+    void distributeProbabilityMass(StateType const& state, storm::generator::StateBehavior<ValueType, StateType> const& behavior);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
-     * @param transitionMatrixBuilder The builder of the transition matrix.
-     * @param rewardModelBuilders The builders for the selected reward models.
+     * @param transitionMatrixBuilder The builder of the transition matrix. This is either a SparseMatrixBuilder or a StreamingModelWriter.
+     * @param rewardModelBuilders The builder(s) for the selected reward models. This is either a FusedRewardModelBuilder or a vector of
+     * StreamingRewardModelBuilders.
      * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
      */
-    void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-                       std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    template<typename TransitionMatrixBuilderType, typename RewardModelBuildersType>
+    void buildMatrices(TransitionMatrixBuilderType& transitionMatrixBuilder, RewardModelBuildersType& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
     /*!
@@ -162,6 +218,11 @@ class ExplicitModelBuilder {
      */
     storm::models::sparse::StateLabeling buildStateLabeling();
 
+    /*!
+     * Builds the observability classes of the states of a partially observable model.
+     */
+    std::vector<uint32_t> buildObservabilityClasses();
+
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
@@ -174,6 +235,12 @@ class ExplicitModelBuilder {
     /// A set of states that still need to be explored.
     std::deque<std::pair<CompressedState, StateType>> statesToExplore;
 
+    /// For the probability mass guided exploration order, the states that still need to be explored are stored here instead. The queue orders them
+    /// by the (estimated) probability mass with which they are reached. It may contain outdated entries, which are skipped.
+    std::unordered_map<StateType, CompressedState> pendingStates;
+    std::priority_queue<std::pair<double, StateType>> pendingStatesByMass;
+    std::vector<double> stateProbabilityMass;
+
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
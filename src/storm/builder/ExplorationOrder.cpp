@@ -11,6 +11,9 @@ std::ostream& operator<<(std::ostream& out, ExplorationOrder const& order) {
         case ExplorationOrder::Bfs:
             out << "breadth-first";
             break;
+        case ExplorationOrder::ProbabilityMass:
+            out << "probability-mass-guided";
+            break;
         default:
             out << "undefined";
             break;
@@ -6,8 +6,9 @@
 namespace storm {
 namespace builder {
 
-// An enum that contains all currently supported exploration orders.
-enum class ExplorationOrder { Dfs, Bfs };
+// An enum that contains all currently supported exploration orders. The probability mass guided order first explores the states that are (estimated
+// to be) reached with the highest probability.
+enum class ExplorationOrder { Dfs, Bfs, ProbabilityMass };
 
 std::ostream& operator<<(std::ostream& out, ExplorationOrder const& order);
 
@@ -0,0 +1,117 @@
+#include "storm/builder/FusedRewardModelBuilder.h"
+
+#include <optional>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+// The number of states (choices) per block.
+uint64_t constexpr RewardBlockSize = 1ull << 14;
+}  // namespace
+
+template<typename ValueType>
+FusedRewardModelBuilder<ValueType>::FusedRewardModelBuilder(std::vector<RewardModelInformation> const& rewardModelInformation) {
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelInformation.size(); ++rewardModelIndex) {
+        auto const& information = rewardModelInformation[rewardModelIndex];
+        STORM_LOG_THROW(!information.hasTransitionRewards(), storm::exceptions::InvalidArgumentException, "Unable to treat transition rewards.");
+        rewardModelNames.push_back(information.getName());
+        if (information.hasStateRewards()) {
+            stateRewardModels.push_back(rewardModelIndex);
+        }
+        if (information.hasStateActionRewards()) {
+            choiceRewardModels.push_back(rewardModelIndex);
+        }
+    }
+}
+
+template<typename ValueType>
+void FusedRewardModelBuilder<ValueType>::addZeroStateRewards() {
+    addZeroRewards(stateRewardBlocks, stateRewardModels.size());
+}
+
+template<typename ValueType>
+void FusedRewardModelBuilder<ValueType>::addZeroChoiceRewards() {
+    addZeroRewards(choiceRewardBlocks, choiceRewardModels.size());
+}
+
+template<typename ValueType>
+void FusedRewardModelBuilder<ValueType>::addZeroRewards(std::vector<std::vector<ValueType>>& blocks, uint64_t stride) {
+    if (stride > 0) {
+        std::vector<ValueType>& block = getBlockWithSpace(blocks, stride);
+        block.insert(block.end(), stride, storm::utility::zero<ValueType>());
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType>& FusedRewardModelBuilder<ValueType>::getBlockWithSpace(std::vector<std::vector<ValueType>>& blocks, uint64_t stride) {
+    if (blocks.empty() || blocks.back().size() + stride > blocks.back().capacity()) {
+        blocks.emplace_back();
+        blocks.back().reserve(RewardBlockSize * stride);
+    }
+    return blocks.back();
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> FusedRewardModelBuilder<ValueType>::distribute(std::vector<std::vector<ValueType>>& blocks, uint64_t stride,
+                                                                                   uint64_t size) {
+    std::vector<std::vector<ValueType>> result(stride);
+    for (auto& rewardVector : result) {
+        rewardVector.reserve(size);
+    }
+    for (auto& block : blocks) {
+        STORM_LOG_ASSERT(block.size() % stride == 0, "Unexpected size of reward block.");
+        for (uint64_t offset = 0; offset < block.size(); offset += stride) {
+            for (uint64_t position = 0; position < stride; ++position) {
+                result[position].push_back(std::move(block[offset + position]));
+            }
+        }
+        // Release the block right away such that the memory can be reused for the resulting vectors.
+        std::vector<ValueType>().swap(block);
+    }
+    blocks.clear();
+    for (auto& rewardVector : result) {
+        STORM_LOG_ASSERT(rewardVector.size() <= size, "Too many rewards were added.");
+        rewardVector.resize(size);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> FusedRewardModelBuilder<ValueType>::build(
+    uint_fast64_t rowCount, uint_fast64_t rowGroupCount) {
+    std::vector<std::optional<std::vector<ValueType>>> stateRewardVectors(rewardModelNames.size());
+    auto distributedStateRewards = distribute(stateRewardBlocks, stateRewardModels.size(), rowGroupCount);
+    for (uint64_t position = 0; position < stateRewardModels.size(); ++position) {
+        stateRewardVectors[stateRewardModels[position]] = std::move(distributedStateRewards[position]);
+    }
+    std::vector<std::optional<std::vector<ValueType>>> stateActionRewardVectors(rewardModelNames.size());
+    auto distributedChoiceRewards = distribute(choiceRewardBlocks, choiceRewardModels.size(), rowCount);
+    for (uint64_t position = 0; position < choiceRewardModels.size(); ++position) {
+        stateActionRewardVectors[choiceRewardModels[position]] = std::move(distributedChoiceRewards[position]);
+    }
+
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> result;
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelNames.size(); ++rewardModelIndex) {
+        result.emplace(rewardModelNames[rewardModelIndex],
+                       storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVectors[rewardModelIndex]),
+                                                                             std::move(stateActionRewardVectors[rewardModelIndex])));
+    }
+    return result;
+}
+
+template class FusedRewardModelBuilder<double>;
+template class FusedRewardModelBuilder<storm::RationalNumber>;
+template class FusedRewardModelBuilder<storm::RationalFunction>;
+template class FusedRewardModelBuilder<storm::Interval>;
+
+}  // namespace builder
+}  // namespace storm
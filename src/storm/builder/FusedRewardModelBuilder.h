@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/builder/RewardModelInformation.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+template<typename ValueType>
+class StandardRewardModel;
+}
+}  // namespace models
+namespace builder {
+
+/*!
+ * A structure that is used to keep track of all reward models currently being built (instead of using one RewardModelBuilder per reward model).
+ *
+ * The rewards of all reward models are stored interleaved, i.e., the rewards of one state (choice) are stored consecutively with one entry for each
+ * reward model that has state (state-action) rewards. The rewards are stored in blocks of fixed size such that previously added rewards are never
+ * reallocated during the exploration. When building the reward models, the blocks are distributed to exactly sized reward vectors and released one
+ * after another, i.e., at most one block is kept in memory in addition to the resulting vectors.
+ */
+template<typename ValueType>
+class FusedRewardModelBuilder {
+   public:
+    FusedRewardModelBuilder(std::vector<RewardModelInformation> const& rewardModelInformation);
+
+    /*!
+     * Adds the state rewards of the next state.
+     * @param rewards the state rewards for each reward model (including the ones without state rewards)
+     */
+    template<typename RewardValueType>
+    void addStateRewards(std::vector<RewardValueType> const& rewards) {
+        addRewards(stateRewardBlocks, stateRewardModels, rewards);
+    }
+
+    /*!
+     * Adds the state-action rewards of the next choice.
+     * @param rewards the state-action rewards for each reward model (including the ones without state-action rewards)
+     */
+    template<typename RewardValueType>
+    void addChoiceRewards(std::vector<RewardValueType> const& rewards) {
+        addRewards(choiceRewardBlocks, choiceRewardModels, rewards);
+    }
+
+    /*!
+     * Adds zero rewards for the next state (or choice) for all reward models.
+     */
+    void addZeroStateRewards();
+    void addZeroChoiceRewards();
+
+    /*!
+     * Builds the reward models. The stored rewards are released.
+     */
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> build(uint_fast64_t rowCount, uint_fast64_t rowGroupCount);
+
+   private:
+    template<typename RewardValueType>
+    void addRewards(std::vector<std::vector<ValueType>>& blocks, std::vector<uint64_t> const& rewardModelIndices,
+                    std::vector<RewardValueType> const& rewards) {
+        if (!rewardModelIndices.empty()) {
+            std::vector<ValueType>& block = getBlockWithSpace(blocks, rewardModelIndices.size());
+            for (auto const& rewardModelIndex : rewardModelIndices) {
+                block.emplace_back(rewards[rewardModelIndex]);
+            }
+        }
+    }
+
+    void addZeroRewards(std::vector<std::vector<ValueType>>& blocks, uint64_t stride);
+
+    // Retrieves the last block and appends a new one if the last block does not have space for another stride entries.
+    std::vector<ValueType>& getBlockWithSpace(std::vector<std::vector<ValueType>>& blocks, uint64_t stride);
+
+    // Distributes the interleaved rewards to one vector of the given size per stride position. The blocks are released.
+    static std::vector<std::vector<ValueType>> distribute(std::vector<std::vector<ValueType>>& blocks, uint64_t stride, uint64_t size);
+
+    std::vector<std::string> rewardModelNames;
+
+    // The indices of the reward models with state (state-action) rewards. The i-th entry of a state (choice) belongs to the i-th of these reward models.
+    std::vector<uint64_t> stateRewardModels;
+    std::vector<uint64_t> choiceRewardModels;
+
+    // The interleaved rewards.
+    std::vector<std::vector<ValueType>> stateRewardBlocks;
+    std::vector<std::vector<ValueType>> choiceRewardBlocks;
+};
+
+}  // namespace builder
+}  // namespace storm
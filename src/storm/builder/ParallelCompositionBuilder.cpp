@@ -1,7 +1,14 @@
 #include "storm/builder/ParallelCompositionBuilder.h"
+
+#include <queue>
+#include <tuple>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace builder {
@@ -161,6 +168,56 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuild
     return composedCtmc;
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::composeMinimized(
+    std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs, bool labelAnd,
+    std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType bisimulationType) {
+    STORM_LOG_THROW(!ctmcs.empty(), storm::exceptions::InvalidArgumentException, "No Markov chains to compose.");
+
+    // The models that still need to be composed, ordered by their size. Models of equal size are composed in the order in which they were added.
+    struct Entry {
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ctmc;
+        uint64_t index;
+    };
+    auto isLarger = [](Entry const& lhs, Entry const& rhs) {
+        return std::make_tuple(lhs.ctmc->getNumberOfStates(), lhs.ctmc->getNumberOfTransitions(), lhs.index) >
+               std::make_tuple(rhs.ctmc->getNumberOfStates(), rhs.ctmc->getNumberOfTransitions(), rhs.index);
+    };
+    std::priority_queue<Entry, std::vector<Entry>, decltype(isLarger)> queue(isLarger);
+    uint64_t nextIndex = 0;
+    for (auto const& ctmc : ctmcs) {
+        queue.push({minimize(ctmc, formulas, bisimulationType), nextIndex++});
+    }
+
+    while (queue.size() > 1) {
+        Entry first = queue.top();
+        queue.pop();
+        Entry second = queue.top();
+        queue.pop();
+        STORM_LOG_DEBUG("Composing models with " << first.ctmc->getNumberOfStates() << " and " << second.ctmc->getNumberOfStates() << " states.");
+        auto composedCtmc = minimize(compose(first.ctmc, second.ctmc, labelAnd), formulas, bisimulationType);
+        STORM_LOG_DEBUG("No. states (Composed): " << composedCtmc->getNumberOfStates());
+        STORM_LOG_DEBUG("No. transitions (Composed): " << composedCtmc->getNumberOfTransitions());
+        queue.push({std::move(composedCtmc), nextIndex++});
+    }
+    return queue.top().ctmc;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::minimize(
+    std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    storm::storage::BisimulationType bisimulationType) {
+    typedef storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>> DecompositionType;
+    typename DecompositionType::Options options;
+    if (!formulas.empty()) {
+        options = typename DecompositionType::Options(*ctmc, formulas);
+    }
+    options.setType(bisimulationType);
+    DecompositionType decomposition(*ctmc, options);
+    decomposition.computeBisimulationDecomposition();
+    return decomposition.getQuotient();
+}
+
 // Explicitly instantiate the class.
 template class ParallelCompositionBuilder<double>;
 
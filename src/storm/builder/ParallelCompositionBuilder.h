@@ -1,9 +1,17 @@
 #ifndef PARALLELCOMPOSITIONBUILDER_H
 #define PARALLELCOMPOSITIONBUILDER_H
 
+#include <memory>
+#include <vector>
+
 #include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
 
 namespace storm {
+namespace logic {
+class Formula;
+}
+
 namespace builder {
 
 /*!
@@ -14,6 +22,28 @@ class ParallelCompositionBuilder {
    public:
     static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> compose(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcA,
                                                                            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcB, bool labelAnd);
+
+    /*!
+     * Builds the parallel composition of the given Markov chains compositionally, i.e., without building the full product.
+     * Each Markov chain is minimized w.r.t. bisimulation before it is composed and every intermediate product is minimized again.
+     * The composition order is chosen greedily: the two currently smallest models (measured in states and then transitions) are composed next,
+     * as the size of their product is the smallest possible.
+     *
+     * @param ctmcs The Markov chains to compose. There has to be at least one.
+     * @param labelAnd See compose.
+     * @param formulas The formulas that need to be preserved by the minimization. If empty, all labels are preserved.
+     * @param bisimulationType The type of bisimulation used for the minimization.
+     * @return The minimized parallel composition.
+     */
+    static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composeMinimized(
+        std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs, bool labelAnd,
+        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+        storm::storage::BisimulationType bisimulationType = storm::storage::BisimulationType::Weak);
+
+   private:
+    static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> minimize(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc,
+                                                                            std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                            storm::storage::BisimulationType bisimulationType);
 };
 
 }  // namespace builder
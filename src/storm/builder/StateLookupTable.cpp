@@ -0,0 +1,198 @@
+#include "storm/builder/StateLookupTable.h"
+
+#include <cstring>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+constexpr char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'L', 'T'};
+constexpr uint64_t Version = 1;
+constexpr uint64_t ByteOrderMarker = 0x0102030405060708ull;
+
+void writeWord(std::ostream& out, uint64_t word) {
+    out.write(reinterpret_cast<char const*>(&word), sizeof(word));
+}
+
+uint64_t readWord(std::istream& in) {
+    uint64_t word;
+    in.read(reinterpret_cast<char*>(&word), sizeof(word));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of state lookup table.");
+    return word;
+}
+}  // namespace
+
+template<typename StateType>
+StateLookupTable<StateType>::StateLookupTable(storm::generator::VariableInformation const& varInfo,
+                                              storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> const& stateToId)
+    : bitsPerState(varInfo.getTotalBitOffset(true)), stateToId(stateToId) {
+    for (auto const& locationVariable : varInfo.locationVariables) {
+        variables.push_back({locationVariable.variable.getName(), locationVariable.bitOffset, locationVariable.bitWidth, 0,
+                             static_cast<int64_t>(locationVariable.highestValue)});
+    }
+    for (auto const& booleanVariable : varInfo.booleanVariables) {
+        variables.push_back({booleanVariable.getName(), booleanVariable.bitOffset, 1, 0, 1});
+    }
+    for (auto const& integerVariable : varInfo.integerVariables) {
+        variables.push_back(
+            {integerVariable.getName(), integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound});
+    }
+}
+
+template<typename StateType>
+StateLookupTable<StateType>::StateLookupTable(std::vector<VariableLayout>&& variables, uint64_t bitsPerState,
+                                              storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash>&& stateToId)
+    : variables(std::move(variables)), bitsPerState(bitsPerState), stateToId(std::move(stateToId)) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+uint64_t StateLookupTable<StateType>::getNumberOfVariables() const {
+    return variables.size();
+}
+
+template<typename StateType>
+std::vector<std::string> StateLookupTable<StateType>::getVariableNames() const {
+    std::vector<std::string> result;
+    result.reserve(variables.size());
+    for (auto const& variable : variables) {
+        result.push_back(variable.name);
+    }
+    return result;
+}
+
+template<typename StateType>
+uint64_t StateLookupTable<StateType>::size() const {
+    return stateToId.size();
+}
+
+template<typename StateType>
+StateType StateLookupTable<StateType>::lookup(storm::generator::CompressedState const& state) const {
+    auto id = stateToId.find(state);
+    return id ? id.get() : static_cast<StateType>(this->size());
+}
+
+template<typename StateType>
+bool StateLookupTable<StateType>::pack(int64_t const* valuation, storm::generator::CompressedState& state) const {
+    for (auto const& variable : variables) {
+        int64_t value = *valuation;
+        if (value < variable.lowerBound || value > variable.upperBound) {
+            return false;
+        }
+        state.setFromInt(variable.bitOffset, variable.bitWidth, static_cast<uint64_t>(value - variable.lowerBound));
+        ++valuation;
+    }
+    return true;
+}
+
+template<typename StateType>
+StateType StateLookupTable<StateType>::lookup(int64_t const* valuation) const {
+    storm::generator::CompressedState state(bitsPerState);
+    if (!pack(valuation, state)) {
+        return static_cast<StateType>(this->size());
+    }
+    return lookup(state);
+}
+
+template<typename StateType>
+std::vector<StateType> StateLookupTable<StateType>::lookup(std::vector<int64_t> const& valuations) const {
+    uint64_t const numberOfVariables = getNumberOfVariables();
+    STORM_LOG_THROW(numberOfVariables > 0 ? valuations.size() % numberOfVariables == 0 : valuations.empty(), storm::exceptions::InvalidArgumentException,
+                    "Expected a multiple of " << numberOfVariables << " values, but got " << valuations.size() << ".");
+    uint64_t const numberOfValuations = numberOfVariables > 0 ? valuations.size() / numberOfVariables : 0;
+    std::vector<StateType> result(numberOfValuations);
+
+    // Every worker packs its valuations into its own compressed state.
+    auto lookupRange = [&](uint64_t begin, uint64_t end) {
+        storm::generator::CompressedState state(bitsPerState);
+        for (uint64_t index = begin; index < end; ++index) {
+            result[index] = pack(valuations.data() + index * numberOfVariables, state) ? lookup(state) : static_cast<StateType>(this->size());
+        }
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfValuations, 1024),
+                      [&](tbb::blocked_range<uint64_t> const& range) { lookupRange(range.begin(), range.end()); });
+#else
+    lookupRange(0, numberOfValuations);
+#endif
+    return result;
+}
+
+template<typename StateType>
+void StateLookupTable<StateType>::store(std::ostream& out) const {
+    out.write(Magic, sizeof(Magic));
+    writeWord(out, Version);
+    writeWord(out, ByteOrderMarker);
+    writeWord(out, bitsPerState);
+    writeWord(out, variables.size());
+    writeWord(out, stateToId.size());
+
+    for (auto const& variable : variables) {
+        writeWord(out, variable.bitOffset);
+        writeWord(out, variable.bitWidth);
+        writeWord(out, static_cast<uint64_t>(variable.lowerBound));
+        writeWord(out, static_cast<uint64_t>(variable.upperBound));
+        writeWord(out, variable.name.size());
+        out.write(variable.name.data(), variable.name.size());
+    }
+
+    // The states are written as their id followed by the words of the compressed state.
+    for (auto it = stateToId.begin(), ite = stateToId.end(); it != ite; ++it) {
+        auto const& [state, id] = *it;
+        writeWord(out, id);
+        for (uint64_t bit = 0; bit < bitsPerState; bit += 64) {
+            writeWord(out, state.getAsInt(bit, 64));
+        }
+    }
+    STORM_LOG_THROW(out, storm::exceptions::WrongFormatException, "Unable to write state lookup table.");
+}
+
+template<typename StateType>
+StateLookupTable<StateType> StateLookupTable<StateType>::load(std::istream& in) {
+    char magic[sizeof(Magic)];
+    in.read(magic, sizeof(magic));
+    STORM_LOG_THROW(in && std::memcmp(magic, Magic, sizeof(Magic)) == 0, storm::exceptions::WrongFormatException, "Input is not a state lookup table.");
+    uint64_t version = readWord(in);
+    STORM_LOG_THROW(version == Version, storm::exceptions::WrongFormatException, "Unsupported version " << version << " of state lookup table.");
+    STORM_LOG_THROW(readWord(in) == ByteOrderMarker, storm::exceptions::WrongFormatException,
+                    "The state lookup table was written on a machine with a different byte order.");
+    uint64_t bitsPerState = readWord(in);
+    STORM_LOG_THROW(bitsPerState % 64 == 0, storm::exceptions::WrongFormatException, "Invalid number of bits per state in state lookup table.");
+    uint64_t numberOfVariables = readWord(in);
+    uint64_t numberOfStates = readWord(in);
+
+    std::vector<VariableLayout> variables(numberOfVariables);
+    for (auto& variable : variables) {
+        variable.bitOffset = readWord(in);
+        variable.bitWidth = readWord(in);
+        variable.lowerBound = static_cast<int64_t>(readWord(in));
+        variable.upperBound = static_cast<int64_t>(readWord(in));
+        variable.name.resize(readWord(in));
+        in.read(variable.name.data(), variable.name.size());
+        STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of state lookup table.");
+        STORM_LOG_THROW(variable.bitWidth <= 64 && variable.bitOffset + variable.bitWidth <= bitsPerState, storm::exceptions::WrongFormatException,
+                        "Variable '" << variable.name << "' exceeds the compressed states of the state lookup table.");
+    }
+
+    storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> stateToId(bitsPerState, numberOfStates);
+    storm::storage::BitVector state(bitsPerState);
+    for (uint64_t index = 0; index < numberOfStates; ++index) {
+        StateType id = static_cast<StateType>(readWord(in));
+        for (uint64_t bit = 0; bit < bitsPerState; bit += 64) {
+            state.setFromInt(bit, 64, readWord(in));
+        }
+        stateToId.findOrAdd(state, id);
+    }
+    return StateLookupTable<StateType>(std::move(variables), bitsPerState, std::move(stateToId));
+}
+
+template class StateLookupTable<uint32_t>;
+template class StateLookupTable<uint64_t>;
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * A table that maps valuations of the variables of a model to the ids of the (explored) states. The table only consists of the layout of the
+ * variables in the compressed states and of the states themselves. It can therefore be stored and later be used without the model, e.g., by a
+ * runtime shield or monitor.
+ *
+ * Valuations are given as arrays of integers in the order of the variable information, i.e., the values of all location variables, followed by
+ * the values of all Boolean variables (0 or 1), followed by the values of all integer variables.
+ */
+template<typename StateType>
+class StateLookupTable {
+   public:
+    /*!
+     * Creates a table for the given states.
+     *
+     * @param varInfo The information about the variables, which determines how valuations are compressed.
+     * @param stateToId The map from compressed states to their ids.
+     */
+    StateLookupTable(storm::generator::VariableInformation const& varInfo,
+                     storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> const& stateToId);
+
+    /*!
+     * Retrieves the number of values of each valuation.
+     */
+    uint64_t getNumberOfVariables() const;
+
+    /*!
+     * Retrieves the names of the variables in the order in which their values are expected.
+     */
+    std::vector<std::string> getVariableNames() const;
+
+    /*!
+     * Retrieves the number of stored states.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Looks up the given compressed state.
+     *
+     * @return The id of the state, or size() when no state is found.
+     */
+    StateType lookup(storm::generator::CompressedState const& state) const;
+
+    /*!
+     * Looks up the state with the given valuation.
+     *
+     * @param valuation A pointer to the getNumberOfVariables() values of the variables.
+     * @return The id of the state, or size() when no state is found (in particular, when a value is out of the bounds of its variable).
+     */
+    StateType lookup(int64_t const* valuation) const;
+
+    /*!
+     * Looks up the states with the given valuations. Each valuation is packed into a compressed state using the precomputed bit offsets of the
+     * variables. If TBB is available, the lookups are performed in parallel.
+     *
+     * @param valuations The concatenation of the valuations. The size must be a multiple of getNumberOfVariables().
+     * @return For each valuation the id of the state, or size() when no state is found.
+     */
+    std::vector<StateType> lookup(std::vector<int64_t> const& valuations) const;
+
+    /*!
+     * Writes the table to the given stream in a binary format. Numbers are written in the byte order of the machine.
+     */
+    void store(std::ostream& out) const;
+
+    /*!
+     * Reads a table that was written with store.
+     */
+    static StateLookupTable<StateType> load(std::istream& in);
+
+   private:
+    // The position of a variable in the compressed states.
+    struct VariableLayout {
+        std::string name;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+        int64_t upperBound;
+    };
+
+    StateLookupTable(std::vector<VariableLayout>&& variables, uint64_t bitsPerState,
+                     storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash>&& stateToId);
+
+    /*!
+     * Writes the given valuation to the given compressed state. As all variables are overwritten, the same state may be used for several
+     * valuations.
+     *
+     * @return False iff a value is out of the bounds of its variable.
+     */
+    bool pack(int64_t const* valuation, storm::generator::CompressedState& state) const;
+
+    // The layout of the variables in the order in which their values are expected.
+    std::vector<VariableLayout> variables;
+
+    // The number of bits of the compressed states (a multiple of 64).
+    uint64_t bitsPerState;
+
+    storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> stateToId;
+};
+
+}  // namespace builder
+}  // namespace storm
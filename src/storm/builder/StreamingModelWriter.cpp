@@ -0,0 +1,301 @@
+#include "storm/builder/StreamingModelWriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace drb = storm::exporter::drb;
+
+namespace {
+void writeWord(std::ostream& os, uint64_t word) {
+    os.write(reinterpret_cast<char const*>(&word), sizeof(uint64_t));
+}
+
+void writeSectionHeader(std::ostream& os, drb::SectionType type, uint64_t size) {
+    writeWord(os, static_cast<uint64_t>(type));
+    writeWord(os, size);
+}
+
+void writePadding(std::ostream& os, uint64_t numberOfBytes) {
+    static const char padding[8] = {};
+    os.write(padding, drb::paddedSize(numberOfBytes) - numberOfBytes);
+}
+
+void writeString(std::ostream& os, std::string const& str) {
+    writeWord(os, str.size());
+    os.write(str.data(), str.size());
+    writePadding(os, str.size());
+}
+
+void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+        writeWord(os, bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+    }
+}
+
+uint64_t encodeValue(double const& value) {
+    uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    return word;
+}
+
+// Writes the words of the given file followed by zeros up to the given number of words (which are omitted by the reward model builders).
+void writeWordsAndZeros(std::ostream& os, SpillFile& file, uint64_t numberOfWords) {
+    STORM_LOG_ASSERT(file.size() <= numberOfWords, "Unexpected number of words in temporary file.");
+    file.writeTo(os);
+    for (uint64_t index = file.size(); index < numberOfWords; ++index) {
+        writeWord(os, 0);
+    }
+}
+}  // namespace
+
+SpillFile::SpillFile(std::string const& filename)
+    : filename(filename), file(filename, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc), numberOfFlushedWords(0) {
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not create temporary file " << filename << ".");
+    chunk.reserve(chunkSize);
+}
+
+SpillFile::~SpillFile() {
+    file.close();
+    std::error_code errorCode;
+    std::filesystem::remove(filename, errorCode);
+}
+
+uint64_t SpillFile::size() const {
+    return numberOfFlushedWords + chunk.size();
+}
+
+void SpillFile::writeTo(std::ostream& os) {
+    file.flush();
+    file.seekg(0);
+    std::vector<uint64_t> buffer(std::min(chunkSize, numberOfFlushedWords));
+    for (uint64_t remainingWords = numberOfFlushedWords; remainingWords > 0;) {
+        uint64_t numberOfWords = std::min<uint64_t>(buffer.size(), remainingWords);
+        file.read(reinterpret_cast<char*>(buffer.data()), numberOfWords * sizeof(uint64_t));
+        STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not read temporary file " << filename << ".");
+        os.write(reinterpret_cast<char const*>(buffer.data()), numberOfWords * sizeof(uint64_t));
+        remainingWords -= numberOfWords;
+    }
+    os.write(reinterpret_cast<char const*>(chunk.data()), chunk.size() * sizeof(uint64_t));
+    file.seekp(0, std::ios::end);
+}
+
+void SpillFile::flush() {
+    file.write(reinterpret_cast<char const*>(chunk.data()), chunk.size() * sizeof(uint64_t));
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not write temporary file " << filename << ".");
+    numberOfFlushedWords += chunk.size();
+    chunk.clear();
+}
+
+StreamingRewardModelBuilder::StreamingRewardModelBuilder(RewardModelInformation const& rewardModelInformation, std::unique_ptr<SpillFile>&& stateRewards,
+                                                         std::unique_ptr<SpillFile>&& stateActionRewards)
+    : rewardModelName(rewardModelInformation.getName()), stateRewards(std::move(stateRewards)), stateActionRewards(std::move(stateActionRewards)) {
+    STORM_LOG_THROW(!rewardModelInformation.hasTransitionRewards(), storm::exceptions::InvalidArgumentException, "Unable to treat transition rewards.");
+}
+
+std::string const& StreamingRewardModelBuilder::getName() const {
+    return rewardModelName;
+}
+
+void StreamingRewardModelBuilder::addStateReward(double const& value) {
+    stateRewards->push_back(encodeValue(value));
+}
+
+void StreamingRewardModelBuilder::addStateActionReward(double const& value) {
+    stateActionRewards->push_back(encodeValue(value));
+}
+
+bool StreamingRewardModelBuilder::hasStateRewards() const {
+    return static_cast<bool>(stateRewards);
+}
+
+bool StreamingRewardModelBuilder::hasStateActionRewards() const {
+    return static_cast<bool>(stateActionRewards);
+}
+
+StreamingModelWriter::StreamingModelWriter(std::string const& filename, drb::ModelTypeCode modelType, std::string const& temporaryDirectory)
+    : filename(filename), modelType(modelType), numberOfSpillFiles(0), numberOfRows(0), numberOfEntries(0) {
+    STORM_LOG_THROW(modelType != drb::ModelTypeCode::MarkovAutomaton, storm::exceptions::InvalidArgumentException,
+                    "Markov automata can not be written while they are explored.");
+    std::filesystem::path directory = temporaryDirectory.empty() ? std::filesystem::path(filename).parent_path() : std::filesystem::path(temporaryDirectory);
+    if (directory.empty()) {
+        directory = ".";
+    }
+    std::string uniqueSuffix = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    temporaryFilenamePrefix = (directory / (std::filesystem::path(filename).filename().string() + "." + uniqueSuffix + ".part")).string();
+
+    rowIndications = createSpillFile();
+    columns = createSpillFile();
+    values = createSpillFile();
+    if (modelType == drb::ModelTypeCode::Mdp || modelType == drb::ModelTypeCode::Pomdp) {
+        rowGroupIndices = createSpillFile();
+    }
+    if (modelType == drb::ModelTypeCode::Ctmc) {
+        exitRates = createSpillFile();
+    }
+}
+
+void StreamingModelWriter::newRowGroup(uint64_t startingRow) {
+    STORM_LOG_ASSERT(rowGroupIndices, "Row groups are only supported for nondeterministic models.");
+    rowGroupIndices->push_back(startingRow);
+}
+
+void StreamingModelWriter::addNextValue(uint64_t row, uint64_t column, double const& value) {
+    STORM_LOG_THROW(row + 1 >= numberOfRows, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but an element in row " << numberOfRows - 1 << " has already been added.");
+    while (numberOfRows <= row) {
+        if (numberOfRows > 0) {
+            finishRow();
+        }
+        rowIndications->push_back(numberOfEntries);
+        ++numberOfRows;
+    }
+    currentRowEntries.emplace_back(column, value);
+}
+
+uint64_t StreamingModelWriter::getCurrentRowGroupCount() const {
+    return rowGroupIndices ? rowGroupIndices->size() : numberOfRows;
+}
+
+uint64_t StreamingModelWriter::getCurrentRowCount() const {
+    return numberOfRows;
+}
+
+StreamingRewardModelBuilder StreamingModelWriter::createRewardModelBuilder(RewardModelInformation const& rewardModelInformation) {
+    return StreamingRewardModelBuilder(rewardModelInformation, rewardModelInformation.hasStateRewards() ? createSpillFile() : nullptr,
+                                       rewardModelInformation.hasStateActionRewards() ? createSpillFile() : nullptr);
+}
+
+void StreamingModelWriter::finalize(storm::models::sparse::StateLabeling const& stateLabeling, std::vector<StreamingRewardModelBuilder>& rewardModelBuilders,
+                                    boost::optional<storm::models::sparse::ChoiceLabeling> const& choiceLabeling,
+                                    boost::optional<std::vector<uint32_t>> const& observations) {
+    if (numberOfRows > 0) {
+        finishRow();
+    }
+    uint64_t const numberOfStates = getCurrentRowGroupCount();
+    uint64_t const numberOfChoices = numberOfRows;
+    rowIndications->push_back(numberOfEntries);
+    if (rowGroupIndices) {
+        rowGroupIndices->push_back(numberOfChoices);
+    }
+    STORM_LOG_THROW(modelType != drb::ModelTypeCode::Pomdp || observations, storm::exceptions::InvalidArgumentException,
+                    "The observations of a POMDP are required.");
+
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+
+    drb::Header header;
+    std::copy(std::begin(drb::Magic), std::end(drb::Magic), header.magic);
+    header.version = drb::Version;
+    header.byteOrderMarker = drb::ByteOrderMarker;
+    header.valueType = static_cast<uint64_t>(drb::ValueTypeCode::Double);
+    header.modelType = static_cast<uint64_t>(modelType);
+    header.numberOfStates = numberOfStates;
+    header.numberOfChoices = numberOfChoices;
+    header.numberOfEntries = numberOfEntries;
+    os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    // Copy the segments of the transition matrix and remove each temporary file as soon as it is no longer needed.
+    writeSectionHeader(os, drb::SectionType::RowIndications, (numberOfChoices + 1) * sizeof(uint64_t));
+    rowIndications->writeTo(os);
+    rowIndications.reset();
+    writeSectionHeader(os, drb::SectionType::Columns, numberOfEntries * sizeof(uint64_t));
+    columns->writeTo(os);
+    columns.reset();
+    writeSectionHeader(os, drb::SectionType::Values, numberOfEntries * sizeof(double));
+    values->writeTo(os);
+    values.reset();
+    if (rowGroupIndices) {
+        writeSectionHeader(os, drb::SectionType::RowGroupIndices, (numberOfStates + 1) * sizeof(uint64_t));
+        rowGroupIndices->writeTo(os);
+        rowGroupIndices.reset();
+    }
+
+    for (auto const& label : stateLabeling.getLabels()) {
+        writeSectionHeader(os, drb::SectionType::StateLabel, drb::stringSize(label.size()) + drb::bitVectorSize(numberOfStates));
+        writeString(os, label);
+        writeBitVector(os, stateLabeling.getStates(label));
+    }
+    if (choiceLabeling) {
+        for (auto const& label : choiceLabeling->getLabels()) {
+            writeSectionHeader(os, drb::SectionType::ChoiceLabel, drb::stringSize(label.size()) + drb::bitVectorSize(numberOfChoices));
+            writeString(os, label);
+            writeBitVector(os, choiceLabeling->getChoices(label));
+        }
+    }
+
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        uint64_t flags = 0;
+        uint64_t size = drb::stringSize(rewardModelBuilder.getName().size()) + 8;
+        if (rewardModelBuilder.hasStateRewards()) {
+            flags |= drb::HasStateRewards;
+            size += numberOfStates * sizeof(double);
+        }
+        if (rewardModelBuilder.hasStateActionRewards()) {
+            flags |= drb::HasStateActionRewards;
+            size += numberOfChoices * sizeof(double);
+        }
+        writeSectionHeader(os, drb::SectionType::RewardModel, size);
+        writeString(os, rewardModelBuilder.getName());
+        writeWord(os, flags);
+        if (rewardModelBuilder.hasStateRewards()) {
+            writeWordsAndZeros(os, *rewardModelBuilder.stateRewards, numberOfStates);
+            rewardModelBuilder.stateRewards.reset();
+        }
+        if (rewardModelBuilder.hasStateActionRewards()) {
+            writeWordsAndZeros(os, *rewardModelBuilder.stateActionRewards, numberOfChoices);
+            rewardModelBuilder.stateActionRewards.reset();
+        }
+    }
+
+    if (exitRates) {
+        writeSectionHeader(os, drb::SectionType::ExitRates, numberOfStates * sizeof(double));
+        exitRates->writeTo(os);
+        exitRates.reset();
+    }
+    if (modelType == drb::ModelTypeCode::Pomdp) {
+        STORM_LOG_ASSERT(observations->size() == numberOfStates, "Unexpected number of observations.");
+        writeSectionHeader(os, drb::SectionType::Observations, drb::paddedSize(numberOfStates * sizeof(uint32_t)));
+        os.write(reinterpret_cast<char const*>(observations->data()), numberOfStates * sizeof(uint32_t));
+        writePadding(os, numberOfStates * sizeof(uint32_t));
+    }
+
+    writeSectionHeader(os, drb::SectionType::End, 0);
+    STORM_LOG_THROW(os, storm::exceptions::FileIoException, "Could not write model to file " << filename << ".");
+}
+
+std::unique_ptr<SpillFile> StreamingModelWriter::createSpillFile() {
+    return std::make_unique<SpillFile>(temporaryFilenamePrefix + std::to_string(numberOfSpillFiles++));
+}
+
+void StreamingModelWriter::finishRow() {
+    std::sort(currentRowEntries.begin(), currentRowEntries.end(),
+              [](std::pair<uint64_t, double> const& first, std::pair<uint64_t, double> const& second) { return first.first < second.first; });
+    double exitRate = 0.0;
+    for (auto entryIt = currentRowEntries.begin(); entryIt != currentRowEntries.end();) {
+        uint64_t column = entryIt->first;
+        double value = 0.0;
+        for (; entryIt != currentRowEntries.end() && entryIt->first == column; ++entryIt) {
+            value += entryIt->second;
+        }
+        columns->push_back(column);
+        values->push_back(encodeValue(value));
+        exitRate += value;
+        ++numberOfEntries;
+    }
+    if (exitRates) {
+        exitRates->push_back(encodeValue(exitRate));
+    }
+    currentRowEntries.clear();
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/builder/RewardModelInformation.h"
+#include "storm/io/DirectEncodingBinaryFormat.h"
+#include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/models/sparse/StateLabeling.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * An append-only sequence of 64 bit words that is kept in a temporary file. Only one chunk of words is buffered in memory.
+ */
+class SpillFile {
+   public:
+    /*!
+     * Creates an empty sequence stored in the given (new) file. The file is removed once the sequence is destroyed.
+     */
+    explicit SpillFile(std::string const& filename);
+
+    ~SpillFile();
+
+    SpillFile(SpillFile const& other) = delete;
+    SpillFile& operator=(SpillFile const& other) = delete;
+
+    /*!
+     * Appends the given word.
+     */
+    void push_back(uint64_t word) {
+        chunk.push_back(word);
+        if (chunk.size() == chunkSize) {
+            flush();
+        }
+    }
+
+    /*!
+     * Retrieves the number of words in the sequence.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Writes all words to the given stream (in the order in which they were appended).
+     */
+    void writeTo(std::ostream& os);
+
+   private:
+    /*!
+     * Writes the buffered chunk to the file.
+     */
+    void flush();
+
+    // The number of words that are buffered before they are written to the file.
+    static constexpr uint64_t chunkSize = 1ull << 17;
+
+    std::string filename;
+    std::fstream file;
+    std::vector<uint64_t> chunk;
+    uint64_t numberOfFlushedWords;
+};
+
+/*!
+ * Counterpart of the RewardModelBuilder that streams the rewards to temporary files instead of keeping them in memory.
+ */
+class StreamingRewardModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given reward model that stores its rewards in the given files. Use StreamingModelWriter::createRewardModelBuilder.
+     */
+    StreamingRewardModelBuilder(RewardModelInformation const& rewardModelInformation, std::unique_ptr<SpillFile>&& stateRewards,
+                                std::unique_ptr<SpillFile>&& stateActionRewards);
+
+    std::string const& getName() const;
+
+    void addStateReward(double const& value);
+
+    void addStateActionReward(double const& value);
+
+    bool hasStateRewards() const;
+
+    bool hasStateActionRewards() const;
+
+   private:
+    friend class StreamingModelWriter;
+
+    std::string rewardModelName;
+
+    // The state rewards and state-action rewards (if the reward model has them).
+    std::unique_ptr<SpillFile> stateRewards;
+    std::unique_ptr<SpillFile> stateActionRewards;
+};
+
+/*!
+ * Writes an explicit model into a file in the binary drb format (see DirectEncodingBinaryFormat.h) while the model is being explored. The transition
+ * matrix is passed row by row (with the same interface as the SparseMatrixBuilder) and, just like the rewards, kept in temporary files only.
+ * Finalizing the writer assembles the file from these segments. Hence, neither the transition matrix nor a builder for it is ever held in memory.
+ */
+class StreamingModelWriter {
+   public:
+    /*!
+     * Creates a writer for a model of the given type.
+     *
+     * @param filename The name of the drb file to write.
+     * @param modelType The type of the model.
+     * @param temporaryDirectory The directory in which the temporary files are stored. If empty, the directory of the drb file is used.
+     */
+    StreamingModelWriter(std::string const& filename, storm::exporter::drb::ModelTypeCode modelType, std::string const& temporaryDirectory = "");
+
+    /*!
+     * Starts a new row group in the given row. Must only be used for nondeterministic models.
+     */
+    void newRowGroup(uint64_t startingRow);
+
+    /*!
+     * Appends an entry to the given row. Rows have to be passed in ascending order. Just like for the SparseMatrixBuilder, the entries of a row may
+     * be passed in any order and entries with the same column are added up.
+     */
+    void addNextValue(uint64_t row, uint64_t column, double const& value);
+
+    /*!
+     * Retrieves the number of row groups (i.e. states) passed so far.
+     */
+    uint64_t getCurrentRowGroupCount() const;
+
+    /*!
+     * Retrieves the number of rows (i.e. choices) passed so far.
+     */
+    uint64_t getCurrentRowCount() const;
+
+    /*!
+     * Creates a builder for the given reward model whose rewards are stored in temporary files of this writer.
+     */
+    StreamingRewardModelBuilder createRewardModelBuilder(RewardModelInformation const& rewardModelInformation);
+
+    /*!
+     * Writes the drb file. Afterwards, the temporary files are removed and the writer must no longer be used.
+     *
+     * @param stateLabeling The labeling of the states.
+     * @param rewardModelBuilders The builders of the reward models (which have to be created by this writer).
+     * @param choiceLabeling If given, the labeling of the choices.
+     * @param observations If given, the observations of the states. These are required for POMDPs.
+     */
+    void finalize(storm::models::sparse::StateLabeling const& stateLabeling, std::vector<StreamingRewardModelBuilder>& rewardModelBuilders,
+                  boost::optional<storm::models::sparse::ChoiceLabeling> const& choiceLabeling = boost::none,
+                  boost::optional<std::vector<uint32_t>> const& observations = boost::none);
+
+   private:
+    /*!
+     * Creates a new temporary file.
+     */
+    std::unique_ptr<SpillFile> createSpillFile();
+
+    /*!
+     * Sorts the entries of the current row and appends them to the segments of the transition matrix.
+     */
+    void finishRow();
+
+    std::string filename;
+    storm::exporter::drb::ModelTypeCode modelType;
+
+    // The prefix of the names of all temporary files of this writer and the number of temporary files created so far.
+    std::string temporaryFilenamePrefix;
+    uint64_t numberOfSpillFiles;
+
+    // The segments of the transition matrix in CSR form.
+    std::unique_ptr<SpillFile> rowIndications;
+    std::unique_ptr<SpillFile> columns;
+    std::unique_ptr<SpillFile> values;
+    std::unique_ptr<SpillFile> rowGroupIndices;
+
+    // For CTMCs, the sum of the rates of each row.
+    std::unique_ptr<SpillFile> exitRates;
+
+    // The entries of the current row, which is the only row that is held in memory.
+    std::vector<std::pair<uint64_t, double>> currentRowEntries;
+
+    // The number of rows that were started and the number of entries of the finished rows.
+    uint64_t numberOfRows;
+    uint64_t numberOfEntries;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,25 @@
+#include "storm/builder/SymbolicReachabilityStrategy.h"
+
+namespace storm {
+namespace builder {
+
+std::ostream& operator<<(std::ostream& out, SymbolicReachabilityStrategy const& strategy) {
+    switch (strategy) {
+        case SymbolicReachabilityStrategy::Bfs:
+            out << "breadth-first";
+            break;
+        case SymbolicReachabilityStrategy::Chaining:
+            out << "chaining";
+            break;
+        case SymbolicReachabilityStrategy::Saturation:
+            out << "saturation";
+            break;
+        default:
+            out << "undefined";
+            break;
+    }
+    return out;
+}
+
+}  // namespace builder
+}  // namespace storm
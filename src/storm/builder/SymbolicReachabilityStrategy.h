@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ostream>
+
+namespace storm {
+namespace builder {
+
+// An enum that contains all currently supported strategies for the symbolic computation of the reachable states.
+enum class SymbolicReachabilityStrategy { Bfs, Chaining, Saturation };
+
+std::ostream& operator<<(std::ostream& out, SymbolicReachabilityStrategy const& strategy);
+
+}  // namespace builder
+}  // namespace storm
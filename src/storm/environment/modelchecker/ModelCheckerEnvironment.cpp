@@ -17,6 +17,17 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isLtl2daCacheSet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
+    ltlThreads = mcSettings.getLtlThreads();
+    analysisCacheEnabled = mcSettings.isAnalysisCacheSet();
+    epochThreads = mcSettings.getEpochThreads();
+    epochSolutionSinglePrecision = mcSettings.isEpochSinglePrecisionSet();
+    if (mcSettings.isEpochSpillSet()) {
+        epochSolutionSpillDirectory = mcSettings.getEpochSpillDirectory();
+    }
+    epochSolutionMemoryLimit = mcSettings.getEpochSpillMemoryLimit() * 1024 * 1024;
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -57,4 +68,78 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+uint64_t ModelCheckerEnvironment::getLtlThreads() const {
+    return ltlThreads;
+}
+
+void ModelCheckerEnvironment::setLtlThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "At least one thread is required for LTL model checking.");
+    ltlThreads = value;
+}
+
+bool ModelCheckerEnvironment::isAnalysisCacheEnabled() const {
+    return analysisCacheEnabled;
+}
+
+void ModelCheckerEnvironment::setAnalysisCacheEnabled(bool value) {
+    analysisCacheEnabled = value;
+}
+
+uint64_t ModelCheckerEnvironment::getEpochThreads() const {
+    return epochThreads;
+}
+
+void ModelCheckerEnvironment::setEpochThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "At least one thread is required to analyze epochs.");
+    epochThreads = value;
+}
+
+bool ModelCheckerEnvironment::isEpochSolutionSinglePrecisionEnabled() const {
+    return epochSolutionSinglePrecision;
+}
+
+void ModelCheckerEnvironment::setEpochSolutionSinglePrecisionEnabled(bool value) {
+    epochSolutionSinglePrecision = value;
+}
+
+bool ModelCheckerEnvironment::isEpochSolutionSpillDirectorySet() const {
+    return epochSolutionSpillDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getEpochSolutionSpillDirectory() const {
+    return epochSolutionSpillDirectory.get();
+}
+
+void ModelCheckerEnvironment::setEpochSolutionSpillDirectory(std::string const& value) {
+    epochSolutionSpillDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetEpochSolutionSpillDirectory() {
+    epochSolutionSpillDirectory = boost::none;
+}
+
+uint64_t ModelCheckerEnvironment::getEpochSolutionMemoryLimit() const {
+    return epochSolutionMemoryLimit;
+}
+
+void ModelCheckerEnvironment::setEpochSolutionMemoryLimit(uint64_t value) {
+    epochSolutionMemoryLimit = value;
+}
+
 }  // namespace storm
@@ -29,9 +29,60 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    /*!
+     * If set, deterministic automata for LTL formulas are stored in this directory and reused when translating the same formula again.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    /*!
+     * The number of threads used to search for accepting end components of the disjuncts of an LTL acceptance condition concurrently.
+     * Also used to analyze the end components of the product for lexicographic objectives concurrently.
+     */
+    uint64_t getLtlThreads() const;
+    void setLtlThreads(uint64_t value);
+
+    /*!
+     * If set, the sparse model checkers cache results in the analysis cache of the model and reuse them for subsequent computations.
+     */
+    bool isAnalysisCacheEnabled() const;
+    void setAnalysisCacheEnabled(bool value);
+
+    /*!
+     * The number of threads used to analyze independent epochs of reward-bounded properties concurrently.
+     */
+    uint64_t getEpochThreads() const;
+    void setEpochThreads(uint64_t value);
+
+    /*!
+     * If set, the solutions of epochs of reward-bounded properties are stored in single precision while they are still needed.
+     */
+    bool isEpochSolutionSinglePrecisionEnabled() const;
+    void setEpochSolutionSinglePrecisionEnabled(bool value);
+
+    /*!
+     * If set, the solutions of epochs of reward-bounded properties are written to this directory once the solutions kept in memory
+     * exceed the memory limit (in bytes).
+     */
+    bool isEpochSolutionSpillDirectorySet() const;
+    std::string const& getEpochSolutionSpillDirectory() const;
+    void setEpochSolutionSpillDirectory(std::string const& value);
+    void unsetEpochSolutionSpillDirectory();
+    uint64_t getEpochSolutionMemoryLimit() const;
+    void setEpochSolutionMemoryLimit(uint64_t value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<std::string> ltl2daCacheDirectory;
+    uint64_t ltlThreads;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
+    bool analysisCacheEnabled;
+    uint64_t epochThreads;
+    bool epochSolutionSinglePrecision;
+    boost::optional<std::string> epochSolutionSpillDirectory;
+    uint64_t epochSolutionMemoryLimit;
 };
 }  // namespace storm
@@ -49,6 +49,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    refinementBatchSize = multiobjectiveSettings.getRefinementBatchSize();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -196,4 +197,13 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
+
+uint64_t MultiObjectiveModelCheckerEnvironment::getRefinementBatchSize() const {
+    return refinementBatchSize;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setRefinementBatchSize(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "At least one weight vector has to be checked per refinement round.");
+    refinementBatchSize = value;
+}
 }  // namespace storm
\ No newline at end of file
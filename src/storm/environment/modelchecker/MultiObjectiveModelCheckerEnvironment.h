@@ -72,6 +72,13 @@ class MultiObjectiveModelCheckerEnvironment {
     bool isLexicographicModelCheckingSet() const;
     void setLexicographicModelChecking(bool value);
 
+    /*!
+     * The number of weight vectors that are checked concurrently in each refinement round of the pcaa method and when exploring Pareto fronts
+     * under deterministic schedulers.
+     */
+    uint64_t getRefinementBatchSize() const;
+    void setRefinementBatchSize(uint64_t value);
+
    private:
     storm::modelchecker::multiobjective::MultiObjectiveMethod method;
     boost::optional<std::string> plotPathUnderApprox, plotPathOverApprox, plotPathParetoPoints;
@@ -85,5 +92,6 @@ class MultiObjectiveModelCheckerEnvironment {
     boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
     bool printResults;
     bool useLexicographicModelChecking;
+    uint64_t refinementBatchSize;
 };
 }  // namespace storm
@@ -19,6 +19,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    parallelComponentSolving = lraSettings.isParallelComponentSolvingSet();
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +92,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+bool LongRunAverageSolverEnvironment::isParallelComponentSolvingSet() const {
+    return parallelComponentSolving;
+}
+
+void LongRunAverageSolverEnvironment::setParallelComponentSolving(bool value) {
+    parallelComponentSolving = value;
+}
+
 }  // namespace storm
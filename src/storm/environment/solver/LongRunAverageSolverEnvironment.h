@@ -32,6 +32,9 @@ class LongRunAverageSolverEnvironment {
     storm::RationalNumber const& getAperiodicFactor() const;
     void setAperiodicFactor(storm::RationalNumber value);
 
+    bool isParallelComponentSolvingSet() const;
+    void setParallelComponentSolving(bool value);
+
    private:
     storm::solver::LraMethod detMethod;
     bool detMethodSetFromDefault;
@@ -44,5 +47,7 @@ class LongRunAverageSolverEnvironment {
     boost::optional<uint64_t> maxIters;
 
     storm::RationalNumber aperiodicFactor;
+
+    bool parallelComponentSolving;
 };
 }  // namespace storm
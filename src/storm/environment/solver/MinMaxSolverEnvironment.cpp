@@ -25,6 +25,8 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     forceRequireUnique = minMaxSettings.isForceUniqueSolutionRequirementSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+    stateOrder = minMaxSettings.getStateOrder();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +86,20 @@ void MinMaxSolverEnvironment::setForceRequireUnique(bool value) {
     forceRequireUnique = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecision() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+std::optional<storm::utility::permutation::OrderKind> const& MinMaxSolverEnvironment::getStateOrder() const {
+    return stateOrder;
+}
+
+void MinMaxSolverEnvironment::setStateOrder(std::optional<storm::utility::permutation::OrderKind> value) {
+    stateOrder = value;
+}
+
 }  // namespace storm
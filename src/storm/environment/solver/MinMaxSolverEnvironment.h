@@ -1,10 +1,13 @@
 #pragma once
 
+#include <optional>
+
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
 
@@ -26,6 +29,10 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isForceRequireUnique() const;
     void setForceRequireUnique(bool value);
+    bool isMixedPrecision() const;
+    void setMixedPrecision(bool value);
+    std::optional<storm::utility::permutation::OrderKind> const& getStateOrder() const;
+    void setStateOrder(std::optional<storm::utility::permutation::OrderKind> value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +42,7 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool forceRequireUnique;
+    bool mixedPrecision;
+    std::optional<storm::utility::permutation::OrderKind> stateOrder;
 };
 }  // namespace storm
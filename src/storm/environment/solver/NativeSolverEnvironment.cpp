@@ -26,6 +26,7 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    restartIterationCount = nativeSettings.getRestartIterationCount();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +94,12 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+uint64_t const& NativeSolverEnvironment::getRestartIterationCount() const {
+    return restartIterationCount;
+}
+
+void NativeSolverEnvironment::setRestartIterationCount(uint64_t value) {
+    restartIterationCount = value;
+}
+
 }  // namespace storm
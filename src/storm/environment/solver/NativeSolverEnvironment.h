@@ -28,6 +28,8 @@ class NativeSolverEnvironment {
     void setSorOmega(storm::RationalNumber const& value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    uint64_t const& getRestartIterationCount() const;
+    void setRestartIterationCount(uint64_t value);
 
    private:
     storm::solver::NativeLinearEquationSolverMethod method;
@@ -38,5 +40,6 @@ class NativeSolverEnvironment {
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
     bool symmetricUpdates;
+    uint64_t restartIterationCount;
 };
 }  // namespace storm
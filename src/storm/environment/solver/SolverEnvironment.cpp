@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -18,6 +19,12 @@ SolverEnvironment::SolverEnvironment() {
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isCheckpointDirectorySet()) {
+        checkpointDirectory = resourceSettings.getCheckpointDirectory();
+    }
+    checkpointInterval = resourceSettings.getCheckpointIntervalInSeconds();
+    resumeFromCheckpoints = resourceSettings.isResumeSet();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +127,30 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+boost::optional<std::string> const& SolverEnvironment::getCheckpointDirectory() const {
+    return checkpointDirectory;
+}
+
+void SolverEnvironment::setCheckpointDirectory(boost::optional<std::string> const& value) {
+    checkpointDirectory = value;
+}
+
+uint64_t SolverEnvironment::getCheckpointInterval() const {
+    return checkpointInterval;
+}
+
+void SolverEnvironment::setCheckpointInterval(uint64_t seconds) {
+    checkpointInterval = seconds;
+}
+
+bool SolverEnvironment::isResumeFromCheckpoints() const {
+    return resumeFromCheckpoints;
+}
+
+void SolverEnvironment::setResumeFromCheckpoints(bool value) {
+    resumeFromCheckpoints = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <string>
 
 #include "storm/adapters/RationalNumberForward.h"
 #include "storm/environment/Environment.h"
@@ -53,6 +54,13 @@ class SolverEnvironment {
     bool isForceExact() const;
     void setForceExact(bool value);
 
+    boost::optional<std::string> const& getCheckpointDirectory() const;
+    void setCheckpointDirectory(boost::optional<std::string> const& value);
+    uint64_t getCheckpointInterval() const;
+    void setCheckpointInterval(uint64_t seconds);
+    bool isResumeFromCheckpoints() const;
+    void setResumeFromCheckpoints(bool value);
+
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
     bool isLinearEquationSolverTypeSetFromDefaultValue() const;
@@ -78,5 +86,8 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    boost::optional<std::string> checkpointDirectory;
+    uint64_t checkpointInterval;
+    bool resumeFromCheckpoints;
 };
 }  // namespace storm
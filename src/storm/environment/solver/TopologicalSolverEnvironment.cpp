@@ -15,6 +15,9 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    parallelSccSolving = topologicalSettings.isParallelSccSolvingSet();
+    adaptiveSccSolving = topologicalSettings.isAdaptiveSccSolvingSet();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +54,20 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+bool TopologicalSolverEnvironment::isParallelSccSolvingSet() const {
+    return parallelSccSolving;
+}
+
+void TopologicalSolverEnvironment::setParallelSccSolving(bool value) {
+    parallelSccSolving = value;
+}
+
+bool TopologicalSolverEnvironment::isAdaptiveSccSolvingSet() const {
+    return adaptiveSccSolving;
+}
+
+void TopologicalSolverEnvironment::setAdaptiveSccSolving(bool value) {
+    adaptiveSccSolving = value;
+}
+
 }  // namespace storm
@@ -19,11 +19,20 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    bool isParallelSccSolvingSet() const;
+    void setParallelSccSolving(bool value);
+
+    bool isAdaptiveSccSolvingSet() const;
+    void setAdaptiveSccSolving(bool value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    bool parallelSccSolving;
+    bool adaptiveSccSolving;
 };
 }  // namespace storm
@@ -1,11 +1,15 @@
 #include "storm/generator/Choice.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/constants.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/BoostTypes.h"
 #include "storm/utility/macros.h"
 
@@ -25,7 +29,9 @@ void Choice<ValueType, StateType>::add(Choice const& other) {
     STORM_LOG_THROW(this->rewards.size() == other.rewards.size(), storm::exceptions::InvalidOperationException, "Reward value sizes of choices do not match.");
 
     // Add the elements to the distribution.
-    this->distribution.add(other.distribution);
+    for (auto const& entry : other.distribution) {
+        addToDistribution(entry.first, entry.second);
+    }
 
     // Update the total mass of the choice.
     this->totalMass += other.totalMass;
@@ -47,26 +53,38 @@ void Choice<ValueType, StateType>::add(Choice const& other) {
 
 template<typename ValueType, typename StateType>
 StateType Choice<ValueType, StateType>::sampleFromDistribution(ValueType const& quantile) const {
-    return distribution.sampleFromDistribution(quantile);
+    if constexpr (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "We cannot sample from parametric distributions.");
+    } else {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (auto const& entry : distribution) {
+            sum += entry.second;
+            if (quantile < sum) {
+                return entry.first;
+            }
+        }
+        STORM_LOG_ASSERT(false, "This point should not be reached.");
+    }
+    return 0;
 }
 
 template<typename ValueType, typename StateType>
-typename storm::storage::Distribution<ValueType, StateType>::iterator Choice<ValueType, StateType>::begin() {
+typename Choice<ValueType, StateType>::iterator Choice<ValueType, StateType>::begin() {
     return distribution.begin();
 }
 
 template<typename ValueType, typename StateType>
-typename storm::storage::Distribution<ValueType, StateType>::const_iterator Choice<ValueType, StateType>::begin() const {
+typename Choice<ValueType, StateType>::const_iterator Choice<ValueType, StateType>::begin() const {
     return distribution.cbegin();
 }
 
 template<typename ValueType, typename StateType>
-typename storm::storage::Distribution<ValueType, StateType>::iterator Choice<ValueType, StateType>::end() {
+typename Choice<ValueType, StateType>::iterator Choice<ValueType, StateType>::end() {
     return distribution.end();
 }
 
 template<typename ValueType, typename StateType>
-typename storm::storage::Distribution<ValueType, StateType>::const_iterator Choice<ValueType, StateType>::end() const {
+typename Choice<ValueType, StateType>::const_iterator Choice<ValueType, StateType>::end() const {
     return distribution.cend();
 }
 
@@ -157,7 +175,18 @@ ValueType Choice<ValueType, StateType>::getTotalMass() const {
 template<typename ValueType, typename StateType>
 void Choice<ValueType, StateType>::addProbability(StateType const& state, ValueType const& value) {
     totalMass += value;
-    distribution.addProbability(state, value);
+    addToDistribution(state, value);
+}
+
+template<typename ValueType, typename StateType>
+void Choice<ValueType, StateType>::addToDistribution(StateType const& state, ValueType const& value) {
+    auto it = std::lower_bound(distribution.begin(), distribution.end(), state,
+                               [](std::pair<StateType, ValueType> const& entry, StateType const& otherState) { return entry.first < otherState; });
+    if (it != distribution.end() && it->first == state) {
+        it->second += value;
+    } else {
+        distribution.insert(it, std::make_pair(state, value));
+    }
 }
 
 template<typename ValueType, typename StateType>
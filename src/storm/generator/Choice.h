@@ -6,9 +6,9 @@
 #include <set>
 
 #include <boost/any.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/optional.hpp>
 
-#include "storm/storage/Distribution.h"
 #include "storm/storage/PlayerIndex.h"
 
 namespace storm {
@@ -18,6 +18,12 @@ namespace generator {
 template<typename ValueType, typename StateType = uint32_t>
 struct Choice {
    public:
+    // The entries of the distribution of a choice, sorted by state. As most choices only have few successors, a small number of entries is stored
+    // inline, which avoids heap allocations for the many short-lived choices that are created during state space exploration.
+    typedef boost::container::small_vector<std::pair<StateType, ValueType>, 4> DistributionContainer;
+    typedef typename DistributionContainer::iterator iterator;
+    typedef typename DistributionContainer::const_iterator const_iterator;
+
     Choice(uint_fast64_t actionIndex = 0, bool markovian = false);
 
     Choice(Choice const& other) = default;
@@ -46,28 +52,28 @@ struct Choice {
      *
      * @return An iterator to the first element of the distribution.
      */
-    typename storm::storage::Distribution<ValueType, StateType>::iterator begin();
+    iterator begin();
 
     /*!
      * Returns an iterator to the distribution associated with this choice.
      *
      * @return An iterator to the first element of the distribution.
      */
-    typename storm::storage::Distribution<ValueType, StateType>::const_iterator begin() const;
+    const_iterator begin() const;
 
     /*!
      * Returns an iterator past the end of the distribution associated with this choice.
      *
      * @return An iterator past the end of the distribution.
      */
-    typename storm::storage::Distribution<ValueType, StateType>::iterator end();
+    iterator end();
 
     /*!
      * Returns an iterator past the end of the distribution associated with this choice.
      *
      * @return An iterator past the end of the distribution.
      */
-    typename storm::storage::Distribution<ValueType, StateType>::const_iterator end() const;
+    const_iterator end() const;
 
     /*!
      * Inserts the contents of this object to the given output stream.
@@ -187,6 +193,11 @@ struct Choice {
     void reserve(std::size_t const& size);
 
    private:
+    /*!
+     * Adds the given value to the entry of the given state in the distribution (without updating the total mass).
+     */
+    void addToDistribution(StateType const& state, ValueType const& value);
+
     // A flag indicating whether this choice is Markovian or not.
     bool markovian;
 
@@ -194,7 +205,7 @@ struct Choice {
     uint_fast64_t actionIndex;
 
     // The distribution that is associated with the choice.
-    storm::storage::Distribution<ValueType, StateType> distribution;
+    DistributionContainer distribution;
 
     // The total probability mass (or rates) of this choice.
     ValueType totalMass;
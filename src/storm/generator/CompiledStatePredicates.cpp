@@ -0,0 +1,270 @@
+#include "storm/generator/CompiledStatePredicates.h"
+
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ToCppVisitor.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+// Reads the bits of a compressed state. This mirrors BitVector::get and BitVector::getAsInt (the first bit of each bucket is its most
+// significant one).
+std::string const sourcePreamble = R"(// Generated by storm. Do not edit.
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+inline bool storm_bit(uint64_t const* s, uint64_t index) {
+    return (s[index >> 6] >> (63 - (index & 63))) & 1ull;
+}
+
+inline int64_t storm_bits(uint64_t const* s, uint64_t index, uint64_t width) {
+    uint64_t offset = index & 63;
+    uint64_t value = s[index >> 6] << offset;
+    if (offset + width > 64) {
+        value |= s[(index >> 6) + 1] >> (64 - offset);
+    }
+    return static_cast<int64_t>(value >> (64 - width));
+}
+}  // namespace
+
+)";
+
+bool isCompilable(storm::expressions::Expression const& expression, std::unordered_map<storm::expressions::Variable, std::string> const& names) {
+    if (!expression.hasBooleanType() && !expression.hasIntegerType()) {
+        return false;
+    }
+    if (expression.isLiteral()) {
+        return true;
+    }
+    if (expression.isVariable()) {
+        return names.count(*expression.getVariables().begin()) > 0;
+    }
+    if (!expression.isFunctionApplication()) {
+        return false;
+    }
+    switch (expression.getOperator()) {
+        case storm::expressions::OperatorType::And:
+        case storm::expressions::OperatorType::Or:
+        case storm::expressions::OperatorType::Xor:
+        case storm::expressions::OperatorType::Implies:
+        case storm::expressions::OperatorType::Iff:
+        case storm::expressions::OperatorType::Not:
+        case storm::expressions::OperatorType::Plus:
+        case storm::expressions::OperatorType::Minus:
+        case storm::expressions::OperatorType::Times:
+        case storm::expressions::OperatorType::Modulo:
+        case storm::expressions::OperatorType::Equal:
+        case storm::expressions::OperatorType::NotEqual:
+        case storm::expressions::OperatorType::Less:
+        case storm::expressions::OperatorType::LessOrEqual:
+        case storm::expressions::OperatorType::Greater:
+        case storm::expressions::OperatorType::GreaterOrEqual:
+        case storm::expressions::OperatorType::Ite:
+            break;
+        default:
+            // Division and powers have a different semantics in C++, minimum and maximum are translated to std::min/std::max, which do not
+            // accept mixed integer types, and the remaining operators are not integer operations.
+            return false;
+    }
+    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+        if (!isCompilable(expression.getOperand(operandIndex), names)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string getSymbolName(uint64_t predicateIndex) {
+    return "storm_predicate_" + std::to_string(predicateIndex);
+}
+
+// Retrieves the default cache directory of the current user.
+std::filesystem::path getDefaultCacheDirectory() {
+    if (char const* cacheHome = std::getenv("XDG_CACHE_HOME"); cacheHome != nullptr && *cacheHome != '\0') {
+        return std::filesystem::path(cacheHome) / "storm" / "compiled";
+    }
+    if (char const* home = std::getenv("HOME"); home != nullptr && *home != '\0') {
+        return std::filesystem::path(home) / ".cache" / "storm" / "compiled";
+    }
+    return std::filesystem::temp_directory_path() / ("storm-compiled-" + std::to_string(geteuid()));
+}
+
+// A file or directory may only be used for libraries that are loaded into this process if no other user can have placed or modified it.
+bool isOwnedAndProtected(std::filesystem::path const& path, bool directory) {
+    struct stat status;
+    if (lstat(path.c_str(), &status) != 0) {
+        return false;
+    }
+    bool hasExpectedType = directory ? S_ISDIR(status.st_mode) : S_ISREG(status.st_mode);
+    return hasExpectedType && status.st_uid == geteuid() && (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+// Creates the given cache directory (accessible only by the current user) if it does not exist yet.
+bool prepareCacheDirectory(std::filesystem::path const& directory) {
+    std::error_code errorCode;
+    if (directory.has_parent_path()) {
+        std::filesystem::create_directories(directory.parent_path(), errorCode);
+    }
+    if (mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+        return false;
+    }
+    return isOwnedAndProtected(directory, true);
+}
+
+// Compiles the given source to a shared library at the given path. The source is written next to the library.
+bool compileLibrary(std::string const& compiler, std::string const& source, std::filesystem::path const& sourcePath,
+                    std::filesystem::path const& libraryPath) {
+    {
+        std::ofstream sourceFile(sourcePath);
+        sourceFile << source;
+    }
+    std::string command = compiler + " -std=c++17 -O2 -shared -fPIC -o \"" + libraryPath.string() + "\" \"" + sourcePath.string() + "\"";
+    STORM_LOG_DEBUG("Invoking compiler: " << command);
+    int exitCode = std::system(command.c_str());
+    std::error_code errorCode;
+    std::filesystem::remove(sourcePath, errorCode);
+    if (exitCode != 0) {
+        std::filesystem::remove(libraryPath, errorCode);
+        STORM_LOG_WARN("Compiling state predicates failed (command '" << command << "' returned " << exitCode << "). Falling back to interpretation.");
+        return false;
+    }
+    // Independent of the umask, nobody else may modify the library.
+    return chmod(libraryPath.c_str(), S_IRWXU) == 0;
+}
+}  // namespace
+
+CompiledStatePredicates::CompiledStatePredicates(VariableInformation const& variableInformation,
+                                                 std::vector<storm::expressions::Expression> const& predicates, std::string const& cacheDirectory,
+                                                 std::string const& compiler)
+    : functions(predicates.size(), nullptr), libraryHandle(nullptr) {
+    // Map the variables to the code that reads them from the state.
+    std::unordered_map<storm::expressions::Variable, std::string> names;
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        names[booleanVariable.variable] = "storm_bit(s, " + std::to_string(booleanVariable.bitOffset) + "ull)";
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        if (integerVariable.bitWidth == 0) {
+            names[integerVariable.variable] = "static_cast<int64_t>(" + std::to_string(integerVariable.lowerBound) + "ll)";
+        } else {
+            names[integerVariable.variable] = "(storm_bits(s, " + std::to_string(integerVariable.bitOffset) + "ull, " +
+                                              std::to_string(integerVariable.bitWidth) + "ull) + static_cast<int64_t>(" +
+                                              std::to_string(integerVariable.lowerBound) + "ll))";
+        }
+    }
+    std::unordered_map<storm::expressions::Variable, std::string> prefixes;
+    storm::expressions::ToCppTranslationOptions translationOptions(prefixes, names);
+    storm::expressions::ToCppVisitor visitor;
+
+    std::stringstream source;
+    source << sourcePreamble;
+    std::vector<uint64_t> compilablePredicates;
+    for (uint64_t predicateIndex = 0; predicateIndex < predicates.size(); ++predicateIndex) {
+        if (isCompilable(predicates[predicateIndex], names)) {
+            compilablePredicates.push_back(predicateIndex);
+            source << "extern \"C\" bool " << getSymbolName(predicateIndex) << "(uint64_t const* s) {\n"
+                   << "    return " << visitor.translate(predicates[predicateIndex], translationOptions) << ";\n"
+                   << "}\n\n";
+        }
+    }
+    STORM_LOG_DEBUG("Compiling " << compilablePredicates.size() << " of " << predicates.size() << " state predicates to native code.");
+    if (compilablePredicates.empty()) {
+        return;
+    }
+
+    // The library is identified by the hash of its source and the compiler, so changes of the model or the state layout lead to a new library.
+    std::string sourceString = source.str();
+    std::stringstream libraryName;
+    libraryName << "predicates-" << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>()(compiler + "\n" + sourceString);
+    std::filesystem::path directory = cacheDirectory.empty() ? getDefaultCacheDirectory() : std::filesystem::path(cacheDirectory);
+    std::filesystem::path libraryPath = directory / (libraryName.str() + ".so");
+
+    // Cached libraries are only loaded from directories and files that no other user can write to, as loading a library executes its code.
+    // Otherwise, the library is compiled into a fresh directory that is removed after loading.
+    std::error_code errorCode;
+    bool useCache = prepareCacheDirectory(directory);
+    STORM_LOG_WARN_COND(useCache, "Not caching compiled state predicates in " << directory << " as it is not a directory owned and only writable by the "
+                                                                                << "current user.");
+    if (useCache && std::filesystem::exists(libraryPath, errorCode) && !isOwnedAndProtected(libraryPath, false)) {
+        STORM_LOG_WARN("Ignoring cached library " << libraryPath << " as it is not a regular file owned and only writable by the current user.");
+        useCache = false;
+    }
+    std::filesystem::path privateDirectory;
+    if (!useCache) {
+        std::string privateDirectoryName = (std::filesystem::temp_directory_path() / "storm-compiled-XXXXXX").string();
+        if (mkdtemp(privateDirectoryName.data()) == nullptr) {
+            STORM_LOG_WARN("Unable to create a temporary directory for compiled state predicates. Falling back to interpretation.");
+            return;
+        }
+        privateDirectory = privateDirectoryName;
+        libraryPath = privateDirectory / (libraryName.str() + ".so");
+        if (!compileLibrary(compiler, sourceString, privateDirectory / (libraryName.str() + ".cpp"), libraryPath)) {
+            std::filesystem::remove_all(privateDirectory, errorCode);
+            return;
+        }
+    } else if (!std::filesystem::exists(libraryPath, errorCode)) {
+        // Compile to a unique temporary file first, so concurrent runs never load a partially written library.
+        std::string uniqueSuffix = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        std::filesystem::path temporaryLibraryPath = directory / (libraryName.str() + "-" + uniqueSuffix + ".so");
+        if (!compileLibrary(compiler, sourceString, directory / (libraryName.str() + "-" + uniqueSuffix + ".cpp"), temporaryLibraryPath)) {
+            return;
+        }
+        std::filesystem::rename(temporaryLibraryPath, libraryPath, errorCode);
+        if (errorCode) {
+            std::filesystem::remove(temporaryLibraryPath, errorCode);
+        }
+    } else {
+        STORM_LOG_DEBUG("Using cached library " << libraryPath << ".");
+    }
+
+    if (isOwnedAndProtected(libraryPath, false)) {
+        libraryHandle = dlopen(libraryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    }
+    if (!privateDirectory.empty()) {
+        // The loaded library remains mapped after its file is removed.
+        std::filesystem::remove_all(privateDirectory, errorCode);
+    }
+    if (libraryHandle == nullptr) {
+        char const* error = dlerror();
+        STORM_LOG_WARN("Loading compiled state predicates from " << libraryPath << " failed ("
+                                                                 << (error ? error : "the file is not owned and only writable by the current user")
+                                                                 << "). Falling back to interpretation.");
+        return;
+    }
+    for (auto predicateIndex : compilablePredicates) {
+        functions[predicateIndex] = reinterpret_cast<PredicateFunction>(dlsym(libraryHandle, getSymbolName(predicateIndex).c_str()));
+        STORM_LOG_WARN_COND(functions[predicateIndex] != nullptr, "Compiled state predicate " << predicateIndex << " is missing in " << libraryPath << ".");
+    }
+}
+
+CompiledStatePredicates::~CompiledStatePredicates() {
+    if (libraryHandle != nullptr) {
+        dlclose(libraryHandle);
+    }
+}
+
+uint64_t CompiledStatePredicates::getNumberOfCompiledPredicates() const {
+    uint64_t result = 0;
+    for (auto const& function : functions) {
+        if (function != nullptr) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace generator {
+
+struct VariableInformation;
+
+/*!
+ * Evaluates boolean expressions over the variables of compressed states with native code. The expressions are translated to C++ (using the
+ * ToCppVisitor), compiled into a shared library by an external compiler and loaded at runtime. Compiled libraries are cached on disk, so the
+ * compiler is invoked only once per set of expressions and state layout.
+ *
+ * Only expressions whose semantics coincide with the ones of their C++ translation are compiled, i.e. expressions over boolean and bounded integer
+ * variables using boolean connectives, relations, integer addition, subtraction, multiplication, modulo and if-then-else. All
+ * other expressions (and all expressions, if compilation fails) are reported as not compiled and have to be evaluated by the caller.
+ */
+class CompiledStatePredicates {
+   public:
+    typedef bool (*PredicateFunction)(uint64_t const* state);
+
+    /*!
+     * Compiles the given predicates (or loads them from the cache).
+     *
+     * @param variableInformation The information about the layout of the compressed states.
+     * @param predicates The boolean expressions to compile.
+     * @param cacheDirectory The directory in which compiled libraries are cached. If empty, a cache directory of the current user is used. Libraries
+     * are only cached in and loaded from directories that are owned and only writable by the current user.
+     * @param compiler The command that invokes the C++ compiler.
+     */
+    CompiledStatePredicates(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& predicates,
+                            std::string const& cacheDirectory, std::string const& compiler);
+
+    ~CompiledStatePredicates();
+
+    CompiledStatePredicates(CompiledStatePredicates const& other) = delete;
+    CompiledStatePredicates& operator=(CompiledStatePredicates const& other) = delete;
+
+    /*!
+     * Retrieves whether the predicate with the given index was compiled.
+     */
+    bool isCompiled(uint64_t predicateIndex) const {
+        return functions[predicateIndex] != nullptr;
+    }
+
+    /*!
+     * Evaluates the (compiled) predicate with the given index in the given state.
+     */
+    bool evaluate(uint64_t predicateIndex, CompressedState const& state) const {
+        return functions[predicateIndex](state.data());
+    }
+
+    /*!
+     * Retrieves the number of predicates that were compiled.
+     */
+    uint64_t getNumberOfCompiledPredicates() const;
+
+   private:
+    // For each predicate, the compiled function or null if the predicate was not compiled.
+    std::vector<PredicateFunction> functions;
+
+    // The handle of the loaded library (if any).
+    void* libraryHandle;
+};
+
+}  // namespace generator
+}  // namespace storm
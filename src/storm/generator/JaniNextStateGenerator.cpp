@@ -99,15 +99,17 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
 
     // Now we are ready to initialize the variable information.
     this->checkValid();
-    this->variableInformation =
-        VariableInformation(this->model, this->parallelAutomata, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
-    this->variableInformation.registerArrayVariableReplacements(arrayEliminatorData);
+    auto variableInformation = std::make_shared<VariableInformation>(this->model, this->parallelAutomata, options.getReservedBitsForUnboundedVariables(),
+                                                                     options.isAddOutOfBoundsStateSet());
+    variableInformation->registerArrayVariableReplacements(arrayEliminatorData);
+    this->variableInformation = std::move(variableInformation);
     this->transientVariableInformation = TransientVariableInformation<ValueType>(this->model, this->parallelAutomata);
     this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
     this->initializeSpecialStates();
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
+    this->evaluator->setUseBytecode(this->options.isBytecodeExpressionEvaluationSet());
     this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
 
     // Build the information structs for the reward models.
@@ -218,10 +220,11 @@ void JaniNextStateGenerator<ValueType, StateType>::setLocation(CompressedState&
 
 template<typename ValueType, typename StateType>
 std::vector<uint64_t> JaniNextStateGenerator<ValueType, StateType>::getLocations(CompressedState const& state) const {
-    std::vector<uint64_t> result(this->variableInformation.locationVariables.size());
+    std::vector<uint64_t> result(this->variableInformation->locationVariables.size());
 
     auto resultIt = result.begin();
-    for (auto it = this->variableInformation.locationVariables.begin(), ite = this->variableInformation.locationVariables.end(); it != ite; ++it, ++resultIt) {
+    for (auto it = this->variableInformation->locationVariables.begin(), ite = this->variableInformation->locationVariables.end(); it != ite;
+         ++it, ++resultIt) {
         if (it->bitWidth == 0) {
             *resultIt = 0;
         } else {
@@ -250,19 +253,19 @@ std::vector<StateType> JaniNextStateGenerator<ValueType, StateType>::getInitialS
         // Proceed as long as the solver can still enumerate initial states.
         while (solver->check() == storm::solver::SmtSolver::CheckResult::Sat) {
             // Create fresh state.
-            CompressedState initialState(this->variableInformation.getTotalBitOffset(true));
+            CompressedState initialState(this->variableInformation->getTotalBitOffset(true));
 
             // Read variable assignment from the solution of the solver. Also, create an expression we can use to
             // prevent the variable assignment from being enumerated again.
             storm::expressions::Expression blockingExpression;
             std::shared_ptr<storm::solver::SmtSolver::ModelReference> model = solver->getModel();
-            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+            for (auto const& booleanVariable : this->variableInformation->booleanVariables) {
                 bool variableValue = model->getBooleanValue(booleanVariable.variable);
                 storm::expressions::Expression localBlockingExpression = variableValue ? !booleanVariable.variable : booleanVariable.variable;
                 blockingExpression = blockingExpression.isInitialized() ? blockingExpression || localBlockingExpression : localBlockingExpression;
                 initialState.set(booleanVariable.bitOffset, variableValue);
             }
-            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+            for (auto const& integerVariable : this->variableInformation->integerVariables) {
                 int_fast64_t variableValue = model->getIntegerValue(integerVariable.variable);
                 if (integerVariable.forceOutOfBoundsCheck || this->getOptions().isExplorationChecksSet()) {
                     STORM_LOG_THROW(variableValue >= integerVariable.lowerBound, storm::exceptions::WrongFormatException,
@@ -286,7 +289,9 @@ std::vector<StateType> JaniNextStateGenerator<ValueType, StateType>::getInitialS
             }
             storm::utility::combinatorics::forEach(
                 initialLocationsIts, initialLocationsItes,
-                [this, &initialState](uint64_t index, uint64_t value) { setLocation(initialState, this->variableInformation.locationVariables[index], value); },
+                [this, &initialState](uint64_t index, uint64_t value) {
+                    setLocation(initialState, this->variableInformation->locationVariables[index], value);
+                },
                 [&stateToIdCallback, &initialStateIndices, &initialState]() {
                     // Register initial state.
                     StateType id = stateToIdCallback(initialState);
@@ -310,14 +315,14 @@ std::vector<StateType> JaniNextStateGenerator<ValueType, StateType>::getInitialS
             allValues.template emplace_back(aInitLocs.begin(), aInitLocs.end());
         }
         uint64_t locEndIndex = allValues.size();
-        for (auto const& intVar : this->variableInformation.integerVariables) {
+        for (auto const& intVar : this->variableInformation->integerVariables) {
             STORM_LOG_ASSERT(intVar.lowerBound <= intVar.upperBound, "Expecting variable with non-empty set of possible values.");
             // The value of integer variables is shifted so that 0 is always the smallest possible value
             allValues.push_back(storm::utility::vector::buildVectorForRange<uint64_t>(static_cast<uint64_t>(0), intVar.upperBound + 1 - intVar.lowerBound));
         }
         uint64_t intEndIndex = allValues.size();
         // For boolean variables we consider the values 0 and 1.
-        allValues.resize(allValues.size() + this->variableInformation.booleanVariables.size(),
+        allValues.resize(allValues.size() + this->variableInformation->booleanVariables.size(),
                          std::vector<uint64_t>({static_cast<uint64_t>(0), static_cast<uint64_t>(1)}));
 
         std::vector<std::vector<uint64_t>::const_iterator> its;
@@ -328,22 +333,22 @@ std::vector<StateType> JaniNextStateGenerator<ValueType, StateType>::getInitialS
         }
 
         // Now create an initial state for each combination of values
-        CompressedState initialState(this->variableInformation.getTotalBitOffset(true));
+        CompressedState initialState(this->variableInformation->getTotalBitOffset(true));
         storm::utility::combinatorics::forEach(
             its, ites,
             [this, &initialState, &locEndIndex, &intEndIndex](uint64_t index, uint64_t value) {
                 // Set the value for the variable corresponding to the given index
                 if (index < locEndIndex) {
                     // Location variable
-                    setLocation(initialState, this->variableInformation.locationVariables[index], value);
+                    setLocation(initialState, this->variableInformation->locationVariables[index], value);
                 } else if (index < intEndIndex) {
                     // Integer variable
-                    auto const& intVar = this->variableInformation.integerVariables[index - locEndIndex];
+                    auto const& intVar = this->variableInformation->integerVariables[index - locEndIndex];
                     initialState.setFromInt(intVar.bitOffset, intVar.bitWidth, value);
                 } else {
                     // Boolean variable
-                    STORM_LOG_ASSERT(index - intEndIndex < this->variableInformation.booleanVariables.size(), "Unexpected index");
-                    auto const& boolVar = this->variableInformation.booleanVariables[index - intEndIndex];
+                    STORM_LOG_ASSERT(index - intEndIndex < this->variableInformation->booleanVariables.size(), "Unexpected index");
+                    auto const& boolVar = this->variableInformation->booleanVariables[index - intEndIndex];
                     STORM_LOG_ASSERT(value <= 1u, "Unexpected value for boolean variable.");
                     initialState.set(boolVar.bitOffset, static_cast<bool>(value));
                 }
@@ -372,7 +377,7 @@ void JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState&
     auto assignmentIte = assignments.end();
 
     // Iterate over all boolean assignments and carry them out.
-    auto boolIt = this->variableInformation.booleanVariables.begin();
+    auto boolIt = this->variableInformation->booleanVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->lValueIsVariable() && assignmentIt->getExpressionVariable().hasBooleanType(); ++assignmentIt) {
         while (assignmentIt->getExpressionVariable() != boolIt->variable) {
             ++boolIt;
@@ -381,7 +386,7 @@ void JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState&
     }
 
     // Iterate over all integer assignments and carry them out.
-    auto integerIt = this->variableInformation.integerVariables.begin();
+    auto integerIt = this->variableInformation->integerVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->lValueIsVariable() && assignmentIt->getExpressionVariable().hasIntegerType(); ++assignmentIt) {
         while (assignmentIt->getExpressionVariable() != integerIt->variable) {
             ++integerIt;
@@ -416,7 +421,7 @@ void JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState&
         }
         if (assignmentIt->getAssignedExpression().hasIntegerType()) {
             IntegerVariableInformation const& intInfo =
-                this->variableInformation.getIntegerArrayVariableReplacement(assignmentIt->getLValue().getVariable().getExpressionVariable(), arrayIndices);
+                this->variableInformation->getIntegerArrayVariableReplacement(assignmentIt->getLValue().getVariable().getExpressionVariable(), arrayIndices);
             int_fast64_t assignedValue = expressionEvaluator.asInt(assignmentIt->getAssignedExpression());
 
             if (this->options.isAddOutOfBoundsStateSet()) {
@@ -439,7 +444,7 @@ void JaniNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState&
                                                                               << assignedValue << ").");
         } else if (assignmentIt->getAssignedExpression().hasBooleanType()) {
             BooleanVariableInformation const& boolInfo =
-                this->variableInformation.getBooleanArrayVariableReplacement(assignmentIt->getLValue().getVariable().getExpressionVariable(), arrayIndices);
+                this->variableInformation->getBooleanArrayVariableReplacement(assignmentIt->getLValue().getVariable().getExpressionVariable(), arrayIndices);
             state.set(boolInfo.bitOffset, expressionEvaluator.asBool(assignmentIt->getAssignedExpression()));
         } else {
             STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unhandled type of base variable.");
@@ -578,15 +583,15 @@ template<typename ValueType, typename StateType>
 void JaniNextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                                                      storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
     std::vector<bool> booleanValues;
-    booleanValues.reserve(this->variableInformation.booleanVariables.size() + transientVariableInformation.booleanVariableInformation.size());
+    booleanValues.reserve(this->variableInformation->booleanVariables.size() + transientVariableInformation.booleanVariableInformation.size());
     std::vector<int64_t> integerValues;
-    integerValues.reserve(this->variableInformation.locationVariables.size() + this->variableInformation.integerVariables.size() +
+    integerValues.reserve(this->variableInformation->locationVariables.size() + this->variableInformation->integerVariables.size() +
                           transientVariableInformation.integerVariableInformation.size());
     std::vector<storm::RationalNumber> rationalValues;
     rationalValues.reserve(transientVariableInformation.rationalVariableInformation.size());
 
     // Add values for non-transient variables
-    extractVariableValues(*this->state, this->variableInformation, integerValues, booleanValues, integerValues);
+    extractVariableValues(*this->state, *this->variableInformation, integerValues, booleanValues, integerValues);
 
     // Add values for transient variables
     auto transientVariableValuation = getTransientVariableValuationAtLocations(getLocations(*this->state), *this->evaluator);
@@ -729,9 +734,7 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
     }
 
     // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
-    }
+    result.addChoices(std::move(allChoices));
 
     this->postprocess(result);
 
@@ -779,7 +782,7 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
             int64_t const& highestLevel = edge.getHighestAssignmentLevel();
             bool hasTransientAssignments = destination.hasTransientAssignment();
             CompressedState newState = state;
-            applyUpdate(newState, destination, this->variableInformation.locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
+            applyUpdate(newState, destination, this->variableInformation->locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
             if (hasTransientAssignments) {
                 STORM_LOG_ASSERT(this->options.isScaleAndLiftTransitionRewardsSet(),
                                  "Transition rewards are not supported and scaling to action rewards is disabled.");
@@ -792,9 +795,9 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
             if (assignmentLevel < highestLevel) {
                 while (assignmentLevel < highestLevel) {
                     ++assignmentLevel;
-                    unpackStateIntoEvaluator(newState, this->variableInformation, *this->evaluator);
+                    unpackStateIntoEvaluator(newState, *this->variableInformation, *this->evaluator);
                     evaluatorChanged = true;
-                    applyUpdate(newState, destination, this->variableInformation.locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
+                    applyUpdate(newState, destination, this->variableInformation->locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
                     if (hasTransientAssignments) {
                         transientVariableValuation.clear();
                         applyTransientUpdate(transientVariableValuation, destination.getOrderedAssignments().getTransientAssignments(assignmentLevel),
@@ -805,14 +808,14 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
                 }
             }
             if (evaluateRewardExpressionsAtDestinations) {
-                unpackStateIntoEvaluator(newState, this->variableInformation, *this->evaluator);
+                unpackStateIntoEvaluator(newState, *this->variableInformation, *this->evaluator);
                 evaluatorChanged = true;
                 addEvaluatedRewardExpressions(stateActionRewards, probability);
             }
 
             if (evaluatorChanged) {
                 // Restore the old variable valuation
-                unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+                unpackStateIntoEvaluator(state, *this->variableInformation, *this->evaluator);
                 if (hasTransientAssignments) {
                     this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
                 }
@@ -904,7 +907,7 @@ void JaniNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribut
             STORM_LOG_ASSERT(edge.getNumberOfDestinations() > 0, "Found an edge with zero destinations. This is not expected.");
             uint64_t localDestinationIndex = destinationIndex % edge.getNumberOfDestinations();
             destinations.push_back(&edge.getDestination(localDestinationIndex));
-            locationVars.push_back(&this->variableInformation.locationVariables[edgeCombination[i].first]);
+            locationVars.push_back(&this->variableInformation->locationVariables[edgeCombination[i].first]);
             destinationIndex /= edge.getNumberOfDestinations();
             ValueType probability = this->evaluator->asRational(destinations.back()->getProbability());
             if (edge.hasRate()) {
@@ -925,7 +928,7 @@ void JaniNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribut
             bool evaluatorChanged = false;
             // remaining assignment levels (if there are any)
             for (int64_t assignmentLevel = lowestDestinationAssignmentLevel + 1; assignmentLevel <= highestDestinationAssignmentLevel; ++assignmentLevel) {
-                unpackStateIntoEvaluator(successorState, this->variableInformation, *this->evaluator);
+                unpackStateIntoEvaluator(successorState, *this->variableInformation, *this->evaluator);
                 transientVariableValuation.setInEvaluator(*this->evaluator, this->getOptions().isExplorationChecksSet());
                 transientVariableValuation.clear();
                 evaluatorChanged = true;
@@ -942,13 +945,13 @@ void JaniNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribut
                 transientVariableValuation.setInEvaluator(*this->evaluator, this->getOptions().isExplorationChecksSet());
             }
             if (evaluateRewardExpressionsAtDestinations) {
-                unpackStateIntoEvaluator(successorState, this->variableInformation, *this->evaluator);
+                unpackStateIntoEvaluator(successorState, *this->variableInformation, *this->evaluator);
                 evaluatorChanged = true;
                 addEvaluatedRewardExpressions(stateActionRewards, successorProbability);
             }
             if (evaluatorChanged) {
                 // Restore the old state information
-                unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+                unpackStateIntoEvaluator(state, *this->variableInformation, *this->evaluator);
                 this->transientVariableInformation.setDefaultValuesInEvaluator(*this->evaluator);
             }
 
@@ -1357,6 +1360,16 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
     STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
 }
 
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+    // Eliminating arrays declares new variables in the (shared) expression manager, so we can not repeat this step.
+    if (!arrayEliminatorData.replacements.empty()) {
+        return nullptr;
+    }
+    // The model has already been preprocessed, so we can directly invoke the delegate constructor.
+    return std::shared_ptr<JaniNextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(model, this->options, false));
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> JaniNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
     std::vector<boost::any>& dataForChoiceOrigins) const {
@@ -64,6 +64,8 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
      * @pre The values of non-transient variables have been set in the provided evaluator
@@ -38,7 +38,7 @@ NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions:
                                                              std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
     : options(options),
       expressionManager(expressionManager.getSharedPointer()),
-      variableInformation(variableInformation),
+      variableInformation(std::make_shared<VariableInformation const>(variableInformation)),
       evaluator(nullptr),
       state(nullptr),
       actionMask(mask) {
@@ -51,6 +51,23 @@ NextStateGenerator<ValueType, StateType>::NextStateGenerator(storm::expressions:
                                                              std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
     : options(options), expressionManager(expressionManager.getSharedPointer()), variableInformation(), evaluator(nullptr), state(nullptr), actionMask(mask) {}
 
+template<typename ValueType, typename StateType>
+NextStateGenerator<ValueType, StateType>::NextStateGenerator(NextStateGenerator<ValueType, StateType> const& other)
+    : options(other.options),
+      expressionManager(other.expressionManager),
+      terminalStates(other.terminalStates),
+      variableInformation(other.variableInformation),
+      evaluator(nullptr),
+      state(nullptr),
+      comparator(other.comparator),
+      mask(other.mask),
+      observabilityMap(other.observabilityMap),
+      outOfBoundsState(other.outOfBoundsState),
+      overlappingGuardStates(other.overlappingGuardStates),
+      actionMask(other.actionMask) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, typename StateType>
 NextStateGenerator<ValueType, StateType>::~NextStateGenerator() = default;
 
@@ -61,13 +78,13 @@ NextStateGeneratorOptions const& NextStateGenerator<ValueType, StateType>::getOp
 
 template<typename ValueType, typename StateType>
 uint64_t NextStateGenerator<ValueType, StateType>::getStateSize() const {
-    return variableInformation.getTotalBitOffset(true);
+    return variableInformation->getTotalBitOffset(true);
 }
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::initializeSpecialStates() {
-    if (variableInformation.hasOutOfBoundsBit()) {
-        outOfBoundsState = createOutOfBoundsState(variableInformation);
+    if (variableInformation->hasOutOfBoundsBit()) {
+        outOfBoundsState = createOutOfBoundsState(*variableInformation);
     }
     if (options.isAddOverlappingGuardLabelSet()) {
         overlappingGuardStates = std::vector<uint64_t>();
@@ -77,14 +94,14 @@ void NextStateGenerator<ValueType, StateType>::initializeSpecialStates() {
 template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
     storm::storage::sparse::StateValuationsBuilder result;
-    for (auto const& v : variableInformation.locationVariables) {
-        result.addVariable(v.variable);
+    for (auto const& v : variableInformation->locationVariables) {
+        result.addVariable(v.variable, 0, static_cast<int64_t>(v.highestValue));
     }
-    for (auto const& v : variableInformation.booleanVariables) {
+    for (auto const& v : variableInformation->booleanVariables) {
         result.addVariable(v.variable);
     }
-    for (auto const& v : variableInformation.integerVariables) {
-        result.addVariable(v.variable);
+    for (auto const& v : variableInformation->integerVariables) {
+        result.addVariable(v.variable, v.lowerBound, v.upperBound);
     }
     return result;
 }
@@ -92,17 +109,17 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeObservationValuationsBuilder() const {
     storm::storage::sparse::StateValuationsBuilder result;
-    for (auto const& v : variableInformation.booleanVariables) {
+    for (auto const& v : variableInformation->booleanVariables) {
         if (v.observable) {
             result.addVariable(v.variable);
         }
     }
-    for (auto const& v : variableInformation.integerVariables) {
+    for (auto const& v : variableInformation->integerVariables) {
         if (v.observable) {
-            result.addVariable(v.variable);
+            result.addVariable(v.variable, v.lowerBound, v.upperBound);
         }
     }
-    for (auto const& l : variableInformation.observationLabels) {
+    for (auto const& l : variableInformation->observationLabels) {
         result.addObservationLabel(l.name);
     }
     return result;
@@ -111,12 +128,26 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
     // Since almost all subsequent operations are based on the evaluator, we load the state into it now.
-    unpackStateIntoEvaluator(state, variableInformation, *evaluator);
+    unpackStateIntoEvaluator(state, *variableInformation, *evaluator);
 
     // Also, we need to store a pointer to the state itself, because we need to be able to access it when expanding it.
     this->state = &state;
 }
 
+template<typename ValueType, typename StateType>
+boost::optional<uint64_t> const& NextStateGenerator<ValueType, StateType>::getCallbackStateHash() const {
+    return callbackStateHash;
+}
+
+template<typename ValueType, typename StateType>
+StateType NextStateGenerator<ValueType, StateType>::getStateId(StateToIdCallback const& stateToIdCallback, CompressedState const& state,
+                                                               uint64_t stateHash) {
+    callbackStateHash = stateHash;
+    StateType result = stateToIdCallback(state);
+    callbackStateHash = boost::none;
+    return result;
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
     if (expression.isTrue()) {
@@ -127,17 +158,17 @@ bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Exp
 
 template<typename ValueType, typename StateType>
 VariableInformation const& NextStateGenerator<ValueType, StateType>::getVariableInformation() const {
-    return variableInformation;
+    return *variableInformation;
 }
 
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                                                  storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const {
     std::vector<bool> booleanValues;
-    booleanValues.reserve(variableInformation.booleanVariables.size());
+    booleanValues.reserve(variableInformation->booleanVariables.size());
     std::vector<int64_t> integerValues;
-    integerValues.reserve(variableInformation.locationVariables.size() + variableInformation.integerVariables.size());
-    extractVariableValues(*this->state, variableInformation, integerValues, booleanValues, integerValues);
+    integerValues.reserve(variableInformation->locationVariables.size() + variableInformation->integerVariables.size());
+    extractVariableValues(*this->state, *variableInformation, integerValues, booleanValues, integerValues);
     valuationsBuilder.addState(currentStateIndex, std::move(booleanValues), std::move(integerValues));
 }
 
@@ -146,24 +177,24 @@ storm::storage::sparse::StateValuations NextStateGenerator<ValueType, StateType>
     storm::storage::sparse::StateValuationsBuilder valuationsBuilder = initializeObservationValuationsBuilder();
     for (auto const& observationEntry : observabilityMap) {
         std::vector<bool> booleanValues;
-        booleanValues.reserve(variableInformation.booleanVariables.size());  // TODO: use number of observable boolean variables
+        booleanValues.reserve(variableInformation->booleanVariables.size());  // TODO: use number of observable boolean variables
         std::vector<int64_t> integerValues;
-        integerValues.reserve(variableInformation.locationVariables.size() +
-                              variableInformation.integerVariables.size());  // TODO: use number of observable integer variables
+        integerValues.reserve(variableInformation->locationVariables.size() +
+                              variableInformation->integerVariables.size());  // TODO: use number of observable integer variables
         std::vector<int64_t> observationLabelValues;
-        observationLabelValues.reserve(variableInformation.observationLabels.size());
-        expressions::SimpleValuation val = unpackStateIntoValuation(observationEntry.first, variableInformation, *expressionManager);
-        for (auto const& v : variableInformation.booleanVariables) {
+        observationLabelValues.reserve(variableInformation->observationLabels.size());
+        expressions::SimpleValuation val = unpackStateIntoValuation(observationEntry.first, *variableInformation, *expressionManager);
+        for (auto const& v : variableInformation->booleanVariables) {
             if (v.observable) {
                 booleanValues.push_back(val.getBooleanValue(v.variable));
             }
         }
-        for (auto const& v : variableInformation.integerVariables) {
+        for (auto const& v : variableInformation->integerVariables) {
             if (v.observable) {
                 integerValues.push_back(val.getIntegerValue(v.variable));
             }
         }
-        for (uint64_t labelStart = variableInformation.getTotalBitOffset(true); labelStart < observationEntry.first.size(); labelStart += 64) {
+        for (uint64_t labelStart = variableInformation->getTotalBitOffset(true); labelStart < observationEntry.first.size(); labelStart += 64) {
             observationLabelValues.push_back(observationEntry.first.getAsInt(labelStart, 64));
         }
         valuationsBuilder.addState(observationEntry.second, std::move(booleanValues), std::move(integerValues), {}, std::move(observationLabelValues));
@@ -199,7 +230,7 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
 
     auto const& states = stateStorage.stateToId;
     for (auto const& stateIndexPair : states) {
-        unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+        unpackStateIntoEvaluator(stateIndexPair.first, *variableInformation, *this->evaluator);
         unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
 
         for (auto const& label : labelsAndExpressions) {
@@ -293,19 +324,19 @@ void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueTy
 
 template<typename ValueType, typename StateType>
 std::string NextStateGenerator<ValueType, StateType>::stateToString(CompressedState const& state) const {
-    return toString(state, variableInformation);
+    return toString(state, *variableInformation);
 }
 
 template<typename ValueType, typename StateType>
 storm::json<ValueType> NextStateGenerator<ValueType, StateType>::currentStateToJson(bool onlyObservable) const {
-    storm::json<ValueType> result = unpackStateIntoJson<ValueType>(*state, variableInformation, onlyObservable);
+    storm::json<ValueType> result = unpackStateIntoJson<ValueType>(*state, *variableInformation, onlyObservable);
     extendStateInformation(result);
     return result;
 }
 
 template<typename ValueType, typename StateType>
 storm::expressions::SimpleValuation NextStateGenerator<ValueType, StateType>::currentStateToSimpleValuation() const {
-    return unpackStateIntoValuation(*state, variableInformation, *expressionManager);
+    return unpackStateIntoValuation(*state, *variableInformation, *expressionManager);
 }
 
 template<typename ValueType, typename StateType>
@@ -323,7 +354,7 @@ std::shared_ptr<storm::storage::sparse::ChoiceOrigins> NextStateGenerator<ValueT
 template<typename ValueType, typename StateType>
 uint32_t NextStateGenerator<ValueType, StateType>::observabilityClass(CompressedState const& state) const {
     if (this->mask.size() == 0) {
-        this->mask = computeObservabilityMask(variableInformation);
+        this->mask = computeObservabilityMask(*variableInformation);
     }
     uint32_t classId = unpackStateToObservabilityClass(state, evaluateObservationLabels(state), observabilityMap, mask);
     return classId;
@@ -343,6 +374,11 @@ void NextStateGenerator<ValueType, StateType>::remapStateIds(std::function<State
     // Nothing to be done.
 }
 
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+    return nullptr;
+}
+
 template class NextStateGenerator<double>;
 
 template class ActionMask<double>;
@@ -78,7 +78,7 @@ class NextStateGenerator {
                        NextStateGeneratorOptions const& options, std::shared_ptr<ActionMask<ValueType, StateType>> const& = nullptr);
 
     /*!
-     * Creates a new next state generator. This version of the constructor default-constructs the variable information.
+     * Creates a new next state generator. This version of the constructor does not create the variable information.
      * Hence, the subclass is responsible for suitably initializing it in its constructor.
      */
     NextStateGenerator(storm::expressions::ExpressionManager const& expressionManager, NextStateGeneratorOptions const& options,
@@ -139,7 +139,30 @@ class NextStateGenerator {
      */
     void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
 
+    /*!
+     * Creates an independent copy of this generator that can be used to expand states concurrently to this generator, e.g., in another thread.
+     *
+     * @return The copy or nullptr, if this generator does not support being cloned.
+     */
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+
+    /*!
+     * Retrieves the hash (w.r.t. storm::storage::ZobristBitVectorHash) of the state that is currently passed to the state-to-id callback, if the
+     * generator derived it incrementally from the hash of the expanded state. Callbacks can use it to avoid rehashing the state.
+     */
+    boost::optional<uint64_t> const& getCallbackStateHash() const;
+
    protected:
+    /*!
+     * Creates a copy of the given generator that shares the variable information with it. The copy has neither an evaluator nor a loaded state,
+     * so the subclass is responsible for creating an evaluator.
+     */
+    NextStateGenerator(NextStateGenerator<ValueType, StateType> const& other);
+
+    /*!
+     * Invokes the given callback for the given state and provides the given hash of the state via getCallbackStateHash meanwhile.
+     */
+    StateType getStateId(StateToIdCallback const& stateToIdCallback, CompressedState const& state, uint64_t stateHash);
     /*!
      * Checks if the input label has a special purpose (e.g. "init", "deadlock", "unexplored", "overlap_guards", "out_of_bounds").
      */
@@ -180,8 +203,8 @@ class NextStateGenerator {
     /// The expressions that define terminal states.
     std::vector<std::pair<storm::expressions::Expression, bool>> terminalStates;
 
-    /// Information about how the variables are packed.
-    VariableInformation variableInformation;
+    /// Information about how the variables are packed (shared with copies of this generator).
+    std::shared_ptr<VariableInformation const> variableInformation;
 
     /// An evaluator used to evaluate expressions.
     std::unique_ptr<storm::expressions::ExpressionEvaluator<ValueType>> evaluator;
@@ -205,6 +228,9 @@ class NextStateGenerator {
     boost::optional<std::vector<uint64_t>> overlappingGuardStates;
 
     std::shared_ptr<ActionMask<ValueType, StateType>> actionMask;
+
+    /// The hash of the state that is currently passed to the state-to-id callback (if known).
+    boost::optional<uint64_t> callbackStateHash;
 };
 }  // namespace generator
 }  // namespace storm
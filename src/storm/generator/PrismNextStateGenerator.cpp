@@ -1,5 +1,10 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -37,18 +42,25 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask, bool)
-    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask), program(program), rewardModels(), hasStateActionRewards(false) {
+    : NextStateGenerator<ValueType, StateType>(program.getManager(), options, mask),
+      sharedProgram(std::make_shared<storm::prism::Program const>(program)),
+      program(*sharedProgram),
+      rewardModels(),
+      hasStateActionRewards(false),
+      numberOfKnownStates(0) {
     STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
     STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException,
                     "The explicit next-state generator currently does not support custom system compositions.");
 
     // Only after checking validity of the program, we initialize the variable information.
     this->checkValid();
-    this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
+    this->variableInformation =
+        std::make_shared<VariableInformation const>(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
     this->initializeSpecialStates();
 
     // Create a proper evaluator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+    this->evaluator->setUseBytecode(this->options.isBytecodeExpressionEvaluationSet());
 
     if (this->options.isBuildAllRewardModelsSet()) {
         for (auto const& rewardModel : this->program.getRewardModels()) {
@@ -101,6 +113,627 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    if (this->options.isCompileGuardsSet()) {
+        std::vector<storm::expressions::Expression> guards;
+        for (auto const& module : program.getModules()) {
+            for (auto const& command : module.getCommands()) {
+                if (command.getGlobalIndex() >= guards.size()) {
+                    guards.resize(command.getGlobalIndex() + 1);
+                }
+                guards[command.getGlobalIndex()] = command.getGuardExpression();
+            }
+        }
+        compiledGuards = std::make_shared<CompiledStatePredicates const>(*this->variableInformation, guards, this->options.getCompiledGuardsCacheDirectory(),
+                                                                         this->options.getGuardCompiler());
+        STORM_LOG_INFO("Compiled " << compiledGuards->getNumberOfCompiledPredicates() << " of " << guards.size() << " guards to native code.");
+    }
+
+    buildGuardIndices();
+    buildPartialOrderReduction();
+    buildSymmetryReduction();
+}
+
+namespace {
+// Collects the top-level conjuncts of the given expression.
+void gatherConjuncts(storm::expressions::Expression const& expression, std::vector<storm::expressions::Expression>& conjuncts) {
+    if (expression.isFunctionApplication() && expression.getOperator() == storm::expressions::OperatorType::And) {
+        for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            gatherConjuncts(expression.getOperand(operandIndex), conjuncts);
+        }
+    } else {
+        conjuncts.push_back(expression);
+    }
+}
+
+// If the given conjunct requires a variable to have a constant value, retrieves the variable and the value.
+boost::optional<std::pair<storm::expressions::Variable, int64_t>> getRequiredValue(storm::expressions::Expression const& conjunct) {
+    if (conjunct.isVariable() && conjunct.hasBooleanType()) {
+        return std::make_pair(*conjunct.getVariables().begin(), static_cast<int64_t>(1));
+    }
+    if (!conjunct.isFunctionApplication()) {
+        return boost::none;
+    }
+    if (conjunct.getOperator() == storm::expressions::OperatorType::Not && conjunct.getOperand(0).isVariable()) {
+        return std::make_pair(*conjunct.getOperand(0).getVariables().begin(), static_cast<int64_t>(0));
+    }
+    if (conjunct.getOperator() == storm::expressions::OperatorType::Equal && conjunct.getOperand(0).hasIntegerType() &&
+        conjunct.getOperand(1).hasIntegerType()) {
+        if (conjunct.getOperand(0).isVariable() && conjunct.getOperand(1).isLiteral()) {
+            return std::make_pair(*conjunct.getOperand(0).getVariables().begin(), static_cast<int64_t>(conjunct.getOperand(1).evaluateAsInt()));
+        }
+        if (conjunct.getOperand(1).isVariable() && conjunct.getOperand(0).isLiteral()) {
+            return std::make_pair(*conjunct.getOperand(1).getVariables().begin(), static_cast<int64_t>(conjunct.getOperand(0).evaluateAsInt()));
+        }
+    }
+    return boost::none;
+}
+
+// Retrieves a string representation of the given expression that does not depend on the order of the operands of commutative operators.
+std::string getNormalizedString(storm::expressions::Expression const& expression) {
+    if (!expression.isFunctionApplication()) {
+        return expression.toString();
+    }
+    storm::expressions::OperatorType operatorType = expression.getOperator();
+    bool isAssociative = operatorType == storm::expressions::OperatorType::And || operatorType == storm::expressions::OperatorType::Or ||
+                         operatorType == storm::expressions::OperatorType::Plus || operatorType == storm::expressions::OperatorType::Times ||
+                         operatorType == storm::expressions::OperatorType::Min || operatorType == storm::expressions::OperatorType::Max;
+    bool isCommutative = isAssociative || operatorType == storm::expressions::OperatorType::Equal ||
+                         operatorType == storm::expressions::OperatorType::NotEqual || operatorType == storm::expressions::OperatorType::Iff ||
+                         operatorType == storm::expressions::OperatorType::Xor;
+
+    std::vector<storm::expressions::Expression> operands;
+    if (isAssociative) {
+        // Flatten nested applications of the same operator.
+        std::vector<storm::expressions::Expression> stack = {expression};
+        while (!stack.empty()) {
+            storm::expressions::Expression current = stack.back();
+            stack.pop_back();
+            if (current.isFunctionApplication() && current.getOperator() == operatorType) {
+                for (uint_fast64_t operandIndex = 0; operandIndex < current.getArity(); ++operandIndex) {
+                    stack.push_back(current.getOperand(operandIndex));
+                }
+            } else {
+                operands.push_back(current);
+            }
+        }
+    } else {
+        for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            operands.push_back(expression.getOperand(operandIndex));
+        }
+    }
+
+    std::vector<std::string> operandStrings;
+    for (auto const& operand : operands) {
+        operandStrings.push_back(getNormalizedString(operand));
+    }
+    if (isCommutative) {
+        std::sort(operandStrings.begin(), operandStrings.end());
+    }
+    std::string result = "(" + std::to_string(static_cast<int>(operatorType));
+    for (auto const& operandString : operandStrings) {
+        result += " " + operandString;
+    }
+    return result + ")";
+}
+
+// Retrieves whether the given expressions coincide up to reordering the operands of commutative operators.
+bool areEquivalentUpToReordering(storm::expressions::Expression const& first, storm::expressions::Expression const& second) {
+    return getNormalizedString(first) == getNormalizedString(second);
+}
+}  // namespace
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildGuardIndices() {
+    // The locations of the variables in the compressed states.
+    std::unordered_map<storm::expressions::Variable, GuardIndex> variableLocations;
+    for (auto const& booleanVariable : this->variableInformation->booleanVariables) {
+        GuardIndex& location = variableLocations[booleanVariable.variable];
+        location.isBooleanVariable = true;
+        location.bitOffset = booleanVariable.bitOffset;
+    }
+    for (auto const& integerVariable : this->variableInformation->integerVariables) {
+        GuardIndex& location = variableLocations[integerVariable.variable];
+        location.bitOffset = integerVariable.bitOffset;
+        location.bitWidth = integerVariable.bitWidth;
+        location.lowerBound = integerVariable.lowerBound;
+    }
+
+    auto newGuardIndices = std::make_shared<std::vector<GuardIndex>>();
+    uint64_t numberOfIndexedModules = 0;
+    for (auto const& module : program.getModules()) {
+        // Determine the values required by the guards and pick the variable that is most frequently required to have a certain value.
+        std::vector<std::unordered_map<storm::expressions::Variable, int64_t>> requiredValuesOfCommands(module.getNumberOfCommands());
+        std::unordered_map<storm::expressions::Variable, uint64_t> numberOfRequiringCommands;
+        std::vector<storm::expressions::Expression> conjuncts;
+        for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+            conjuncts.clear();
+            gatherConjuncts(module.getCommand(commandIndex).getGuardExpression(), conjuncts);
+            for (auto const& conjunct : conjuncts) {
+                auto requiredValue = getRequiredValue(conjunct);
+                if (requiredValue && variableLocations.count(requiredValue->first) > 0 &&
+                    requiredValuesOfCommands[commandIndex].emplace(requiredValue->first, requiredValue->second).second) {
+                    ++numberOfRequiringCommands[requiredValue->first];
+                }
+            }
+        }
+        boost::optional<storm::expressions::Variable> indexedVariable;
+        uint64_t bestNumberOfRequiringCommands = 1;
+        for (auto const& variableAndCount : numberOfRequiringCommands) {
+            if (variableAndCount.second > bestNumberOfRequiringCommands ||
+                (variableAndCount.second == bestNumberOfRequiringCommands && indexedVariable && variableAndCount.first < indexedVariable.get())) {
+                indexedVariable = variableAndCount.first;
+                bestNumberOfRequiringCommands = variableAndCount.second;
+            }
+        }
+
+        GuardIndex guardIndex;
+        if (indexedVariable) {
+            guardIndex = variableLocations.at(indexedVariable.get());
+            guardIndex.hasIndexedVariable = true;
+            ++numberOfIndexedModules;
+        }
+        guardIndex.requiredValues.resize(module.getNumberOfCommands());
+        for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+            if (indexedVariable) {
+                auto requiredValueIt = requiredValuesOfCommands[commandIndex].find(indexedVariable.get());
+                if (requiredValueIt != requiredValuesOfCommands[commandIndex].end()) {
+                    guardIndex.requiredValues[commandIndex] = requiredValueIt->second;
+                    guardIndex.commandIndicesByValue[requiredValueIt->second].push_back(commandIndex);
+                    continue;
+                }
+            }
+            guardIndex.unindexedCommandIndices.push_back(commandIndex);
+        }
+        newGuardIndices->push_back(std::move(guardIndex));
+    }
+    guardIndices = std::move(newGuardIndices);
+    STORM_LOG_DEBUG("Built guard indices for " << numberOfIndexedModules << " of " << program.getNumberOfModules() << " modules.");
+}
+
+template<typename ValueType, typename StateType>
+int64_t PrismNextStateGenerator<ValueType, StateType>::GuardIndex::getValue(CompressedState const& state) const {
+    if (isBooleanVariable) {
+        return state.get(bitOffset) ? 1 : 0;
+    }
+    return static_cast<int64_t>(state.getAsInt(bitOffset, bitWidth)) + lowerBound;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<uint64_t> const& PrismNextStateGenerator<ValueType, StateType>::getCandidateCommandIndices(uint64_t moduleIndex) {
+    GuardIndex const& guardIndex = (*guardIndices)[moduleIndex];
+    if (!guardIndex.hasIndexedVariable) {
+        return guardIndex.unindexedCommandIndices;
+    }
+    auto indexedCommandsIt = guardIndex.commandIndicesByValue.find(guardIndex.getValue(*this->state));
+    if (indexedCommandsIt == guardIndex.commandIndicesByValue.end()) {
+        return guardIndex.unindexedCommandIndices;
+    }
+    if (guardIndex.unindexedCommandIndices.empty()) {
+        return indexedCommandsIt->second;
+    }
+    // Merge both sorted lists to preserve the order of the commands.
+    candidateCommandIndicesMemory.clear();
+    std::merge(indexedCommandsIt->second.begin(), indexedCommandsIt->second.end(), guardIndex.unindexedCommandIndices.begin(),
+               guardIndex.unindexedCommandIndices.end(), std::back_inserter(candidateCommandIndicesMemory));
+    return candidateCommandIndicesMemory;
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCandidateCommand(uint64_t moduleIndex, uint64_t commandIndex) const {
+    GuardIndex const& guardIndex = (*guardIndices)[moduleIndex];
+    auto const& requiredValue = guardIndex.requiredValues[commandIndex];
+    return !requiredValue || guardIndex.getValue(*this->state) == requiredValue.get();
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildPartialOrderReduction() {
+    if (!this->options.isPartialOrderReductionSet()) {
+        return;
+    }
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Partial order reduction is only supported for MDPs. The full state space is built.");
+        return;
+    }
+    if (!rewardModels.empty() || this->actionMask != nullptr || this->options.isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Partial order reduction does not support reward models, action masks or overlapping guard labels. The full state space is built.");
+        return;
+    }
+
+    // Variables occurring in labels or terminal state expressions are visible, i.e. commands writing them must not form ample sets.
+    std::set<storm::expressions::Variable> visibleVariables;
+    auto addVariables = [](std::set<storm::expressions::Variable>& variables, storm::expressions::Expression const& expression) {
+        std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+        variables.insert(expressionVariables.begin(), expressionVariables.end());
+    };
+    for (auto const& label : program.getLabels()) {
+        addVariables(visibleVariables, label.getStatePredicateExpression());
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        addVariables(visibleVariables, expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        addVariables(visibleVariables, expressionBool.first);
+    }
+
+    // Determine the variables read and written by the commands of each module.
+    std::vector<std::set<storm::expressions::Variable>> readVariables(program.getNumberOfModules());
+    std::vector<std::set<storm::expressions::Variable>> writtenVariables(program.getNumberOfModules());
+    uint64_t numberOfCommands = 0;
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            numberOfCommands = std::max<uint64_t>(numberOfCommands, command.getGlobalIndex() + 1);
+            addVariables(readVariables[moduleIndex], command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                addVariables(readVariables[moduleIndex], update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    addVariables(readVariables[moduleIndex], assignment.getExpression());
+                    writtenVariables[moduleIndex].insert(assignment.getVariable());
+                }
+            }
+        }
+    }
+
+    ampleCommands = storm::storage::BitVector(numberOfCommands);
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        // Gather the variables read and written by the other modules.
+        std::set<storm::expressions::Variable> otherReadVariables;
+        std::set<storm::expressions::Variable> otherWrittenVariables;
+        for (uint64_t otherModuleIndex = 0; otherModuleIndex < program.getNumberOfModules(); ++otherModuleIndex) {
+            if (otherModuleIndex != moduleIndex) {
+                otherReadVariables.insert(readVariables[otherModuleIndex].begin(), readVariables[otherModuleIndex].end());
+                otherWrittenVariables.insert(writtenVariables[otherModuleIndex].begin(), writtenVariables[otherModuleIndex].end());
+            }
+        }
+        auto writtenByOthers = [&otherWrittenVariables](storm::expressions::Expression const& expression) {
+            for (auto const& variable : expression.getVariables()) {
+                if (otherWrittenVariables.count(variable) > 0) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        // Other modules must not be able to enable or disable the commands of this module.
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        bool guardsAreLocal = std::none_of(module.getCommands().begin(), module.getCommands().end(),
+                                           [&writtenByOthers](storm::prism::Command const& command) { return writtenByOthers(command.getGuardExpression()); });
+        if (!guardsAreLocal) {
+            continue;
+        }
+
+        bool hasAmpleCommand = false;
+        for (auto const& command : module.getCommands()) {
+            bool isAmple = !isCommandPotentiallySynchronizing(command);
+            for (auto const& update : command.getUpdates()) {
+                isAmple &= !writtenByOthers(update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    storm::expressions::Variable const& variable = assignment.getVariable();
+                    isAmple &= !writtenByOthers(assignment.getExpression()) && otherReadVariables.count(variable) == 0 &&
+                               otherWrittenVariables.count(variable) == 0 && visibleVariables.count(variable) == 0;
+                }
+            }
+            if (isAmple) {
+                ampleCommands.set(command.getGlobalIndex());
+                hasAmpleCommand = true;
+            }
+        }
+        if (hasAmpleCommand) {
+            partialOrderReductionModules.push_back(moduleIndex);
+        }
+    }
+
+    STORM_LOG_WARN_COND(!partialOrderReductionModules.empty(), "Partial order reduction has no effect as no command is independent and invisible.");
+    STORM_LOG_INFO("Partial order reduction may reduce states via " << ampleCommands.getNumberOfSetBits() << " of " << numberOfCommands << " commands.");
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::buildSymmetryReduction() {
+    if (!this->options.isSymmetryReductionSet()) {
+        return;
+    }
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG || program.isPartiallyObservable()) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for games and partially observable models. The full state space is built.");
+        return;
+    }
+    if (this->actionMask != nullptr || this->options.isPartialOrderReductionSet()) {
+        STORM_LOG_WARN("Symmetry reduction is not supported in combination with action masks or partial order reduction. The full state space is built.");
+        return;
+    }
+
+    // The location of each variable in compressed states.
+    struct VariableLocation {
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+        int64_t upperBound;
+    };
+    std::unordered_map<storm::expressions::Variable, VariableLocation> variableLocations;
+    for (auto const& booleanVariable : this->variableInformation->booleanVariables) {
+        variableLocations[booleanVariable.variable] = VariableLocation{booleanVariable.bitOffset, 1, 0, 1};
+    }
+    for (auto const& integerVariable : this->variableInformation->integerVariables) {
+        variableLocations[integerVariable.variable] =
+            VariableLocation{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound};
+    }
+
+    // The local variables of each module (in the order of their declaration) and their initial values.
+    std::vector<std::vector<storm::expressions::Variable>> localVariables(program.getNumberOfModules());
+    std::unordered_map<storm::expressions::Variable, storm::expressions::Expression> initialValues;
+    std::map<std::string, uint64_t> moduleNameToIndex;
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        moduleNameToIndex[module.getName()] = moduleIndex;
+        for (auto const& variable : module.getBooleanVariables()) {
+            localVariables[moduleIndex].push_back(variable.getExpressionVariable());
+            if (variable.hasInitialValue()) {
+                initialValues[variable.getExpressionVariable()] = variable.getInitialValueExpression();
+            }
+        }
+        for (auto const& variable : module.getIntegerVariables()) {
+            localVariables[moduleIndex].push_back(variable.getExpressionVariable());
+            if (variable.hasInitialValue()) {
+                initialValues[variable.getExpressionVariable()] = variable.getInitialValueExpression();
+            }
+        }
+    }
+
+    // The expressions outside of the modules that need to be invariant under permutations of the modules of a family.
+    std::vector<storm::expressions::Expression> globalExpressions;
+    if (program.hasInitialConstruct()) {
+        globalExpressions.push_back(program.getInitialStatesExpression());
+    }
+    for (auto const& label : program.getLabels()) {
+        if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+            globalExpressions.push_back(label.getStatePredicateExpression());
+        }
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        globalExpressions.push_back(expressionLabel.second);
+    }
+    for (auto const& expressionBool : this->terminalStates) {
+        globalExpressions.push_back(expressionBool.first);
+    }
+    for (auto const& rewardModel : rewardModels) {
+        for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+            globalExpressions.push_back(stateReward.getStatePredicateExpression());
+            globalExpressions.push_back(stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+            globalExpressions.push_back(stateActionReward.getStatePredicateExpression());
+            globalExpressions.push_back(stateActionReward.getRewardValueExpression());
+        }
+        for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+            globalExpressions.push_back(transitionReward.getSourceStatePredicateExpression());
+            globalExpressions.push_back(transitionReward.getTargetStatePredicateExpression());
+            globalExpressions.push_back(transitionReward.getRewardValueExpression());
+        }
+    }
+
+    // Group the modules by the module they were renamed from.
+    std::map<std::string, std::vector<uint64_t>> families;
+    for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        if (module.isRenamedFromModule()) {
+            auto baseModuleIt = moduleNameToIndex.find(module.getBaseModule());
+            if (baseModuleIt != moduleNameToIndex.end() && !program.getModule(baseModuleIt->second).isRenamedFromModule()) {
+                auto& family = families[module.getBaseModule()];
+                if (family.empty()) {
+                    family.push_back(baseModuleIt->second);
+                }
+                family.push_back(moduleIndex);
+            }
+        }
+    }
+
+    for (auto const& baseNameAndFamily : families) {
+        std::vector<uint64_t> const& family = baseNameAndFamily.second;
+        storm::prism::Module const& baseModule = program.getModule(family.front());
+        std::vector<storm::expressions::Variable> const& baseVariables = localVariables[family.front()];
+
+        // Match the local variables of the renamed modules with the ones of the base module.
+        bool isSymmetric = true;
+        std::vector<std::vector<storm::expressions::Variable>> familyVariables = {baseVariables};
+        for (uint64_t memberIndex = 1; memberIndex < family.size() && isSymmetric; ++memberIndex) {
+            storm::prism::Module const& module = program.getModule(family[memberIndex]);
+            std::vector<storm::expressions::Variable> memberVariables;
+            isSymmetric = localVariables[family[memberIndex]].size() == baseVariables.size();
+            for (auto const& baseVariable : baseVariables) {
+                auto renamingIt = module.getRenaming().find(baseVariable.getName());
+                auto variableIt = std::find_if(localVariables[family[memberIndex]].begin(), localVariables[family[memberIndex]].end(),
+                                               [&renamingIt, &module](storm::expressions::Variable const& variable) {
+                                                   return renamingIt != module.getRenaming().end() && variable.getName() == renamingIt->second;
+                                               });
+                if (variableIt == localVariables[family[memberIndex]].end()) {
+                    isSymmetric = false;
+                    break;
+                }
+                memberVariables.push_back(*variableIt);
+            }
+            familyVariables.push_back(std::move(memberVariables));
+        }
+
+        // The variables have to be encoded and initialized in the same way.
+        for (uint64_t memberIndex = 1; memberIndex < familyVariables.size() && isSymmetric; ++memberIndex) {
+            for (uint64_t variableIndex = 0; variableIndex < baseVariables.size() && isSymmetric; ++variableIndex) {
+                VariableLocation const& baseLocation = variableLocations.at(baseVariables[variableIndex]);
+                VariableLocation const& location = variableLocations.at(familyVariables[memberIndex][variableIndex]);
+                isSymmetric = baseLocation.bitWidth == location.bitWidth && baseLocation.lowerBound == location.lowerBound &&
+                              baseLocation.upperBound == location.upperBound &&
+                              initialValues.count(baseVariables[variableIndex]) == initialValues.count(familyVariables[memberIndex][variableIndex]);
+                if (isSymmetric && initialValues.count(baseVariables[variableIndex]) > 0) {
+                    isSymmetric = areEquivalentUpToReordering(initialValues.at(baseVariables[variableIndex]),
+                                                              initialValues.at(familyVariables[memberIndex][variableIndex]));
+                }
+            }
+        }
+
+        // The commands of the base module must not access the local variables of other modules of the family.
+        std::set<storm::expressions::Variable> otherFamilyVariables;
+        for (uint64_t memberIndex = 1; memberIndex < familyVariables.size(); ++memberIndex) {
+            otherFamilyVariables.insert(familyVariables[memberIndex].begin(), familyVariables[memberIndex].end());
+        }
+        auto accessesOtherFamilyVariables = [&otherFamilyVariables](storm::expressions::Expression const& expression) {
+            for (auto const& variable : expression.getVariables()) {
+                if (otherFamilyVariables.count(variable) > 0) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        for (auto const& command : baseModule.getCommands()) {
+            isSymmetric &= !accessesOtherFamilyVariables(command.getGuardExpression());
+            for (auto const& update : command.getUpdates()) {
+                isSymmetric &= !accessesOtherFamilyVariables(update.getLikelihoodExpression());
+                for (auto const& assignment : update.getAssignments()) {
+                    isSymmetric &= !accessesOtherFamilyVariables(assignment.getExpression());
+                }
+            }
+        }
+
+        // The renamed modules have to coincide with the base module up to renaming the local variables.
+        for (uint64_t memberIndex = 1; memberIndex < family.size() && isSymmetric; ++memberIndex) {
+            std::map<storm::expressions::Variable, storm::expressions::Expression> renaming;
+            for (uint64_t variableIndex = 0; variableIndex < baseVariables.size(); ++variableIndex) {
+                renaming[baseVariables[variableIndex]] = familyVariables[memberIndex][variableIndex].getExpression();
+            }
+            auto isRenamed = [&renaming](storm::expressions::Expression const& baseExpression, storm::expressions::Expression const& expression) {
+                return areEquivalentUpToReordering(baseExpression.substitute(renaming), expression);
+            };
+            storm::prism::Module const& module = program.getModule(family[memberIndex]);
+            isSymmetric = module.getNumberOfCommands() == baseModule.getNumberOfCommands();
+            for (uint64_t commandIndex = 0; commandIndex < baseModule.getNumberOfCommands() && isSymmetric; ++commandIndex) {
+                storm::prism::Command const& baseCommand = baseModule.getCommand(commandIndex);
+                storm::prism::Command const& command = module.getCommand(commandIndex);
+                isSymmetric = baseCommand.getActionIndex() == command.getActionIndex() && baseCommand.isMarkovian() == command.isMarkovian() &&
+                              baseCommand.getNumberOfUpdates() == command.getNumberOfUpdates() &&
+                              isRenamed(baseCommand.getGuardExpression(), command.getGuardExpression());
+                for (uint64_t updateIndex = 0; updateIndex < baseCommand.getNumberOfUpdates() && isSymmetric; ++updateIndex) {
+                    storm::prism::Update const& baseUpdate = baseCommand.getUpdates()[updateIndex];
+                    storm::prism::Update const& update = command.getUpdates()[updateIndex];
+                    isSymmetric = baseUpdate.getAssignments().size() == update.getAssignments().size() &&
+                                  isRenamed(baseUpdate.getLikelihoodExpression(), update.getLikelihoodExpression());
+                    for (uint64_t assignmentIndex = 0; assignmentIndex < baseUpdate.getAssignments().size() && isSymmetric; ++assignmentIndex) {
+                        storm::prism::Assignment const& baseAssignment = baseUpdate.getAssignments()[assignmentIndex];
+                        storm::prism::Assignment const& assignment = update.getAssignments()[assignmentIndex];
+                        isSymmetric = isRenamed(baseAssignment.getVariable().getExpression(), assignment.getVariable().getExpression()) &&
+                                      isRenamed(baseAssignment.getExpression(), assignment.getExpression());
+                    }
+                }
+            }
+        }
+
+        // Everything else has to be invariant under permutations of the modules of the family. It suffices to check this for a transposition and
+        // a cyclic shift of the modules as these generate all permutations.
+        if (isSymmetric) {
+            std::map<storm::expressions::Variable, storm::expressions::Expression> transposition;
+            std::map<storm::expressions::Variable, storm::expressions::Expression> shift;
+            for (uint64_t variableIndex = 0; variableIndex < baseVariables.size(); ++variableIndex) {
+                transposition[familyVariables[0][variableIndex]] = familyVariables[1][variableIndex].getExpression();
+                transposition[familyVariables[1][variableIndex]] = familyVariables[0][variableIndex].getExpression();
+                for (uint64_t memberIndex = 0; memberIndex < familyVariables.size(); ++memberIndex) {
+                    uint64_t nextMemberIndex = (memberIndex + 1) % familyVariables.size();
+                    shift[familyVariables[memberIndex][variableIndex]] = familyVariables[nextMemberIndex][variableIndex].getExpression();
+                }
+            }
+            auto isInvariant = [&transposition, &shift](storm::expressions::Expression const& expression) {
+                return areEquivalentUpToReordering(expression.substitute(transposition), expression) &&
+                       areEquivalentUpToReordering(expression.substitute(shift), expression);
+            };
+            isSymmetric = std::all_of(globalExpressions.begin(), globalExpressions.end(), isInvariant);
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules() && isSymmetric; ++moduleIndex) {
+                if (std::find(family.begin(), family.end(), moduleIndex) != family.end()) {
+                    continue;
+                }
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    isSymmetric &= isInvariant(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        isSymmetric &= isInvariant(update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            isSymmetric &= isInvariant(assignment.getExpression());
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!isSymmetric) {
+            STORM_LOG_WARN("The modules renamed from module '" << baseNameAndFamily.first << "' are not fully symmetric and are not reduced.");
+            continue;
+        }
+        if (baseVariables.empty()) {
+            continue;
+        }
+
+        SymmetricModuleFamily symmetricFamily;
+        for (auto const& memberVariables : familyVariables) {
+            std::vector<uint64_t> bitOffsets;
+            for (auto const& variable : memberVariables) {
+                bitOffsets.push_back(variableLocations.at(variable).bitOffset);
+            }
+            symmetricFamily.bitOffsets.push_back(std::move(bitOffsets));
+        }
+        for (auto const& variable : baseVariables) {
+            symmetricFamily.bitWidths.push_back(variableLocations.at(variable).bitWidth);
+        }
+        STORM_LOG_INFO("Applying symmetry reduction to the " << family.size() << " modules renamed from module '" << baseNameAndFamily.first << "'.");
+        symmetricModuleFamilies.push_back(std::move(symmetricFamily));
+    }
+}
+
+template<typename ValueType, typename StateType>
+boost::optional<CompressedState> PrismNextStateGenerator<ValueType, StateType>::getCanonicalState(CompressedState const& state) const {
+    boost::optional<CompressedState> result;
+    for (auto const& family : symmetricModuleFamilies) {
+        CompressedState const& currentState = result ? result.get() : state;
+        auto isLess = [&currentState, &family](std::vector<uint64_t> const& firstOffsets, std::vector<uint64_t> const& secondOffsets) {
+            for (uint64_t variableIndex = 0; variableIndex < family.bitWidths.size(); ++variableIndex) {
+                uint64_t firstValue = currentState.getAsInt(firstOffsets[variableIndex], family.bitWidths[variableIndex]);
+                uint64_t secondValue = currentState.getAsInt(secondOffsets[variableIndex], family.bitWidths[variableIndex]);
+                if (firstValue != secondValue) {
+                    return firstValue < secondValue;
+                }
+            }
+            return false;
+        };
+        if (std::is_sorted(family.bitOffsets.begin(), family.bitOffsets.end(), isLess)) {
+            continue;
+        }
+
+        // Sort the values of the modules and write them back.
+        std::vector<std::vector<uint64_t>> values;
+        for (auto const& offsets : family.bitOffsets) {
+            std::vector<uint64_t> moduleValues;
+            for (uint64_t variableIndex = 0; variableIndex < family.bitWidths.size(); ++variableIndex) {
+                moduleValues.push_back(currentState.getAsInt(offsets[variableIndex], family.bitWidths[variableIndex]));
+            }
+            values.push_back(std::move(moduleValues));
+        }
+        std::sort(values.begin(), values.end());
+        if (!result) {
+            result = state;
+        }
+        for (uint64_t memberIndex = 0; memberIndex < values.size(); ++memberIndex) {
+            for (uint64_t variableIndex = 0; variableIndex < family.bitWidths.size(); ++variableIndex) {
+                result->setFromInt(family.bitOffsets[memberIndex][variableIndex], family.bitWidths[variableIndex], values[memberIndex][variableIndex]);
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::createCanonicalStateToIdCallback(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        boost::optional<CompressedState> canonicalState = getCanonicalState(state);
+        if (!canonicalState) {
+            return stateToIdCallback(state);
+        }
+        // A hash that was derived for the state does not apply to its representative.
+        this->callbackStateHash = boost::none;
+        return stateToIdCallback(canonicalState.get());
+    };
 }
 
 template<typename ValueType, typename StateType>
@@ -178,21 +811,28 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
 }
 
 template<typename ValueType, typename StateType>
-std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+    // If symmetry reduction is applied, states are replaced by their canonical representatives.
+    StateToIdCallback canonicalStateToIdCallback;
+    if (!symmetricModuleFamilies.empty()) {
+        canonicalStateToIdCallback = createCanonicalStateToIdCallback(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = symmetricModuleFamilies.empty() ? originalStateToIdCallback : canonicalStateToIdCallback;
+
     std::vector<StateType> initialStateIndices;
 
     // If all states are initial, we can simplify the enumeration substantially.
     if (program.hasInitialConstruct() && program.getInitialStatesExpression().isTrue()) {
         // Create vectors holding all possible values
         std::vector<std::vector<uint64_t>> allValues;
-        for (auto const& intVar : this->variableInformation.integerVariables) {
+        for (auto const& intVar : this->variableInformation->integerVariables) {
             STORM_LOG_ASSERT(intVar.lowerBound <= intVar.upperBound, "Expecting variable with non-empty set of possible values.");
             // The value of integer variables is shifted so that 0 is always the smallest possible value
             allValues.push_back(storm::utility::vector::buildVectorForRange<uint64_t>(static_cast<uint64_t>(0), intVar.upperBound + 1 - intVar.lowerBound));
         }
         uint64_t intEndIndex = allValues.size();
         // For boolean variables we consider the values 0 and 1.
-        allValues.resize(allValues.size() + this->variableInformation.booleanVariables.size(),
+        allValues.resize(allValues.size() + this->variableInformation->booleanVariables.size(),
                          std::vector<uint64_t>({static_cast<uint64_t>(0), static_cast<uint64_t>(1)}));
 
         std::vector<std::vector<uint64_t>::const_iterator> its;
@@ -203,19 +843,19 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         }
 
         // Now create an initial state for each combination of values
-        CompressedState initialState(this->variableInformation.getTotalBitOffset(true));
+        CompressedState initialState(this->variableInformation->getTotalBitOffset(true));
         storm::utility::combinatorics::forEach(
             its, ites,
             [this, &initialState, &intEndIndex](uint64_t index, uint64_t value) {
                 // Set the value for the variable corresponding to the given index
                 if (index < intEndIndex) {
                     // Integer variable
-                    auto const& intVar = this->variableInformation.integerVariables[index];
+                    auto const& intVar = this->variableInformation->integerVariables[index];
                     initialState.setFromInt(intVar.bitOffset, intVar.bitWidth, value);
                 } else {
                     // Boolean variable
-                    STORM_LOG_ASSERT(index - intEndIndex < this->variableInformation.booleanVariables.size(), "Unexpected index");
-                    auto const& boolVar = this->variableInformation.booleanVariables[index - intEndIndex];
+                    STORM_LOG_ASSERT(index - intEndIndex < this->variableInformation->booleanVariables.size(), "Unexpected index");
+                    auto const& boolVar = this->variableInformation->booleanVariables[index - intEndIndex];
                     STORM_LOG_ASSERT(value <= 1u, "Unexpected value for boolean variable.");
                     initialState.set(boolVar.bitOffset, static_cast<bool>(value));
                 }
@@ -241,19 +881,19 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
         // Proceed ss long as the solver can still enumerate initial states.
         while (solver->check() == storm::solver::SmtSolver::CheckResult::Sat) {
             // Create fresh state.
-            CompressedState initialState(this->variableInformation.getTotalBitOffset(true));
+            CompressedState initialState(this->variableInformation->getTotalBitOffset(true));
 
             // Read variable assignment from the solution of the solver. Also, create an expression we can use to
             // prevent the variable assignment from being enumerated again.
             storm::expressions::Expression blockingExpression;
             std::shared_ptr<storm::solver::SmtSolver::ModelReference> model = solver->getModel();
-            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+            for (auto const& booleanVariable : this->variableInformation->booleanVariables) {
                 bool variableValue = model->getBooleanValue(booleanVariable.variable);
                 storm::expressions::Expression localBlockingExpression = variableValue ? !booleanVariable.variable : booleanVariable.variable;
                 blockingExpression = blockingExpression.isInitialized() ? blockingExpression || localBlockingExpression : localBlockingExpression;
                 initialState.set(booleanVariable.bitOffset, variableValue);
             }
-            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+            for (auto const& integerVariable : this->variableInformation->integerVariables) {
                 int_fast64_t variableValue = model->getIntegerValue(integerVariable.variable);
                 storm::expressions::Expression localBlockingExpression = integerVariable.variable != model->getManager().integer(variableValue);
                 blockingExpression = blockingExpression.isInitialized() ? blockingExpression || localBlockingExpression : localBlockingExpression;
@@ -279,7 +919,14 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
 }
 
 template<typename ValueType, typename StateType>
-StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+    // If symmetry reduction is applied, successor states are replaced by their canonical representatives.
+    StateToIdCallback canonicalStateToIdCallback;
+    if (!symmetricModuleFamilies.empty()) {
+        canonicalStateToIdCallback = createCanonicalStateToIdCallback(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = symmetricModuleFamilies.empty() ? originalStateToIdCallback : canonicalStateToIdCallback;
+
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
 
@@ -309,8 +956,16 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
+    // The hashes of all successor states are derived from the hash of the current state.
+    currentStateHash = stateHasher(*this->state);
+
     std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+    if (!partialOrderReductionModules.empty()) {
+        allChoices = getAmpleChoices(stateToIdCallback);
+    }
+    if (!allChoices.empty()) {
+        // The choices of the state were reduced to an ample set.
+    } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
         // First explore only edges without a rate
         allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
         addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -415,9 +1070,7 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     }
 
     // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
-    }
+    result.addChoices(std::move(allChoices));
 
     this->postprocess(result);
 
@@ -442,7 +1095,7 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     auto assignmentIte = update.getAssignments().end();
 
     // Iterate over all boolean assignments and carry them out.
-    auto boolIt = this->variableInformation.booleanVariables.begin();
+    auto boolIt = this->variableInformation->booleanVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
@@ -451,7 +1104,7 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     }
 
     // Iterate over all integer assignments and carry them out.
-    auto integerIt = this->variableInformation.integerVariables.begin();
+    auto integerIt = this->variableInformation->integerVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
@@ -482,11 +1135,12 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 }
 
 struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
+    ActiveCommandData(uint64_t moduleIndex, storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
                       typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+        : moduleIndex(moduleIndex), modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
         // Intentionally left empty
     }
+    uint64_t moduleIndex;
     storm::prism::Module const* modulePtr;
     std::set<uint_fast64_t> const* commandIndicesPtr;
     typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
@@ -531,10 +1185,10 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCandidateCommand(i, *commandIndexIt) && isGuardSatisfied(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
-                activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                activeCommands.emplace_back(i, &module, &commandIndices, commandIndexIt);
                 break;
             }
         }
@@ -565,7 +1219,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCandidateCommand(activeCommand.moduleIndex, *commandIndexIt) && isGuardSatisfied(command)) {
                 commands.push_back(command);
             }
         }
@@ -577,18 +1231,58 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
     return result;
 }
 
+template<typename ValueType, typename StateType>
+std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoices(StateToIdCallback const& stateToIdCallback) {
+    numberOfKnownStates = std::max<uint64_t>(numberOfKnownStates, static_cast<uint64_t>(stateToIdCallback(*this->state)) + 1);
+
+    for (uint64_t moduleIndex : partialOrderReductionModules) {
+        // As only the module itself can enable its commands, a single enabled command is an ample set if it qualifies. Synchronizing commands are
+        // counted as well, as they could otherwise be executed first once the other modules are ready.
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        boost::optional<uint64_t> enabledCommandIndex;
+        bool isSingleEnabledCommand = true;
+        for (uint64_t commandIndex : getCandidateCommandIndices(moduleIndex)) {
+            if (isGuardSatisfied(module.getCommand(commandIndex))) {
+                if (enabledCommandIndex) {
+                    isSingleEnabledCommand = false;
+                    break;
+                }
+                enabledCommandIndex = commandIndex;
+            }
+        }
+        if (!enabledCommandIndex || !isSingleEnabledCommand || !ampleCommands.get(module.getCommand(enabledCommandIndex.get()).getGlobalIndex())) {
+            continue;
+        }
+
+        // The reduction must not close a cycle, so all successors have to be new. Otherwise, the state is fully expanded.
+        std::vector<Choice<ValueType>> result = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::All, moduleIndex);
+        STORM_LOG_ASSERT(result.size() == 1, "Expected exactly one choice of the ample set.");
+        for (auto const& stateProbabilityPair : result.front()) {
+            if (stateProbabilityPair.first < numberOfKnownStates) {
+                return {};
+            }
+        }
+        return result;
+    }
+    return {};
+}
+
 template<typename ValueType, typename StateType>
 std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAsynchronousChoices(CompressedState const& state,
                                                                                                      StateToIdCallback stateToIdCallback,
-                                                                                                     CommandFilter const& commandFilter) {
+                                                                                                     CommandFilter const& commandFilter,
+                                                                                                     boost::optional<uint64_t> const& moduleIndex) {
     std::vector<Choice<ValueType>> result;
 
-    // Iterate over all modules.
+    // Iterate over all (requested) modules.
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+        if (moduleIndex && i != moduleIndex.get()) {
+            continue;
+        }
         storm::prism::Module const& module = program.getModule(i);
 
-        // Iterate over all commands.
-        for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+        // Iterate over all commands whose guard may be enabled according to the guard index.
+        for (uint64_t j : getCandidateCommandIndices(i)) {
             storm::prism::Command const& command = module.getCommand(j);
 
             // Only consider commands that are not possibly synchronizing.
@@ -608,7 +1302,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isGuardSatisfied(command)) {
                 continue;
             }
 
@@ -630,7 +1324,8 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    CompressedState successor = applyUpdate(state, update);
+                    StateType stateIndex = this->getStateId(stateToIdCallback, successor, stateHasher.update(currentStateHash, state, successor));
 
                     // Update the choice by adding the probability/target state to it.
                     choice.addProbability(stateIndex, probability);
@@ -678,7 +1373,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
 
 template<typename ValueType, typename StateType>
 void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribution(
-    storm::storage::BitVector const& state, ValueType const& probability, uint64_t position,
+    storm::storage::BitVector const& state, uint64_t stateHash, ValueType const& probability, uint64_t position,
     std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> const& iteratorList,
     storm::generator::Distribution<StateType, ValueType>& distribution, StateToIdCallback stateToIdCallback) {
     if (storm::utility::isZero<ValueType>(probability)) {
@@ -686,14 +1381,16 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
     }
 
     if (position >= iteratorList.size()) {
-        StateType id = stateToIdCallback(state);
+        StateType id = this->getStateId(stateToIdCallback, state, stateHash);
         distribution.add(id, probability);
     } else {
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            CompressedState successor = applyUpdate(state, update);
+            generateSynchronizedDistribution(successor, stateHasher.update(stateHash, state, successor),
+                                             probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList,
+                                             distribution, stateToIdCallback);
         }
     }
 }
@@ -726,7 +1423,8 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
             bool done = false;
             while (!done) {
                 distribution.clear();
-                generateSynchronizedDistribution(state, storm::utility::one<ValueType>(), 0, iteratorList, distribution, stateToIdCallback);
+                generateSynchronizedDistribution(state, currentStateHash, storm::utility::one<ValueType>(), 0, iteratorList, distribution,
+                                                 stateToIdCallback);
                 distribution.compress();
 
                 // At this point, we applied all commands of the current command combination and newTargetStates
@@ -844,7 +1542,7 @@ storm::storage::BitVector PrismNextStateGenerator<ValueType, StateType>::evaluat
     if (program.getNumberOfObservationLabels() == 0) {
         return result;
     }
-    unpackStateIntoEvaluator(state, this->variableInformation, *this->evaluator);
+    unpackStateIntoEvaluator(state, *this->variableInformation, *this->evaluator);
     for (uint64_t i = 0; i < program.getNumberOfObservationLabels(); ++i) {
         result.setFromInt(64 * i, 64, this->evaluator->asInt(program.getObservationLabels()[i].getStatePredicateExpression()));
     }
@@ -870,6 +1568,27 @@ storm::builder::RewardModelInformation PrismNextStateGenerator<ValueType, StateT
                                                   rewardModel.hasTransitionRewards());
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isGuardSatisfied(storm::prism::Command const& command) const {
+    if (compiledGuards && compiledGuards->isCompiled(command.getGlobalIndex())) {
+        return compiledGuards->evaluate(command.getGlobalIndex(), *this->state);
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+    // The action mask might not be safe to be queried concurrently.
+    if (this->actionMask) {
+        return nullptr;
+    }
+    // All data derived from the program is immutable and therefore shared, only the evaluator and the buffers for expanding states are per copy.
+    auto result = std::shared_ptr<PrismNextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(*this));
+    result->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
+    result->evaluator->setUseBytecode(this->options.isBytecodeExpressionEvaluationSet());
+    return result;
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> PrismNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
     std::vector<boost::any>& dataForChoiceOrigins) const {
@@ -1,6 +1,9 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <unordered_map>
+
+#include "storm/generator/CompiledStatePredicates.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -48,6 +51,8 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
    private:
     void checkValid() const;
 
@@ -59,6 +64,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                             std::shared_ptr<ActionMask<ValueType, StateType>> const&, bool flag);
 
+    /*!
+     * Creates a copy (without evaluator) that shares the program, the variable information, the guard indices and the compiled guards with the
+     * given generator. Only used by clone.
+     */
+    PrismNextStateGenerator(PrismNextStateGenerator<ValueType, StateType> const& other) = default;
+
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
      * the given compressed state.
@@ -91,10 +102,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      * Retrieves all choices that are definitively asynchronous, possible from the given state.
      *
      * @param state The state for which to retrieve the unlabeled choices.
+     * @param moduleIndex If given, only the commands of this module are considered.
      * @return The asynchronous choices of the state.
      */
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
-                                                          CommandFilter const& commandFilter = CommandFilter::All);
+                                                          CommandFilter const& commandFilter = CommandFilter::All,
+                                                          boost::optional<uint64_t> const& moduleIndex = boost::none);
 
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
@@ -120,14 +133,105 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     /*!
      * A recursive helper function to generate a synchronziing distribution.
      */
-    void generateSynchronizedDistribution(storm::storage::BitVector const& state, ValueType const& probability, uint64_t position,
+    void generateSynchronizedDistribution(storm::storage::BitVector const& state, uint64_t stateHash, ValueType const& probability, uint64_t position,
                                           std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> const& iteratorList,
                                           storm::generator::Distribution<StateType, ValueType>& distribution, StateToIdCallback stateToIdCallback);
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
-    // The program used for the generation of next states.
-    storm::prism::Program program;
+    /*!
+     * Evaluates the guard of the given command in the state currently loaded into the evaluator. If the guard was compiled, the compiled
+     * version is used instead of the evaluator.
+     */
+    bool isGuardSatisfied(storm::prism::Command const& command) const;
+
+    /*!
+     * Builds the guard index of each module (see GuardIndex).
+     */
+    void buildGuardIndices();
+
+    /*!
+     * Retrieves the indices of the commands of the given module whose guards may be satisfied in the state currently loaded into the generator
+     * according to the guard index of the module. The indices are sorted increasingly. The returned reference is invalidated by the next call.
+     */
+    std::vector<uint64_t> const& getCandidateCommandIndices(uint64_t moduleIndex);
+
+    /*!
+     * Retrieves whether the guard of the given command of the given module may be satisfied in the state currently loaded into the generator
+     * according to the guard index of the module. If this returns false, the guard is definitely not satisfied.
+     */
+    bool isCandidateCommand(uint64_t moduleIndex, uint64_t commandIndex) const;
+
+    /*!
+     * Determines the commands that may form a (singleton) ample set, provided that partial order reduction was requested and is applicable.
+     * A command qualifies if it is asynchronous, independent of all commands of other modules (i.e. neither of them writes a variable the other
+     * one reads or writes) and invisible (i.e. it writes no variable that occurs in a label or terminal state expression). Moreover, the guards of
+     * its module must only read variables that no other module writes, so that only the module itself can enable its commands.
+     */
+    void buildPartialOrderReduction();
+
+    /*!
+     * Tries to reduce the choices of the state currently loaded into the generator to an ample set. This succeeds if a module admitting ample sets
+     * has a single enabled command, this command qualifies for an ample set and all its successors are new, i.e. were not expanded before. The
+     * latter guarantees that each cycle of the reduced model contains a fully expanded state.
+     *
+     * @return The choice of the ample set or an empty vector if the state needs to be fully expanded.
+     */
+    std::vector<Choice<ValueType>> getAmpleChoices(StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Determines the families of modules that are fully symmetric, provided that symmetry reduction was requested and is applicable. A family
+     * consists of a module and all modules renamed from it. It is fully symmetric if each renamed module coincides with the base module up to
+     * renaming its local variables, the commands of the family only access their own local variables and global variables, and all other parts
+     * of the program that are considered for building the model (other modules, initial states, built labels, reward models and terminal state
+     * expressions) are invariant under permuting the modules of the family.
+     */
+    void buildSymmetryReduction();
+
+    /*!
+     * Retrieves the canonical representative of the given state, which is obtained by sorting the values of the local variables of the modules of
+     * each fully symmetric family.
+     *
+     * @return The representative or nothing if the given state already is the representative.
+     */
+    boost::optional<CompressedState> getCanonicalState(CompressedState const& state) const;
+
+    /*!
+     * Creates a callback that invokes the given one on the canonical representatives of the states.
+     */
+    StateToIdCallback createCanonicalStateToIdCallback(StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * An index of the commands of a module over a variable that the guards of the commands frequently compare with a constant. Commands whose
+     * guard contains a conjunct 'x = c' (or 'x', '!x' for boolean variables) for the indexed variable x only need to be considered in states
+     * in which x has value c.
+     */
+    struct GuardIndex {
+        // Retrieves the value of the indexed variable in the given state (0 and 1 for boolean variables).
+        int64_t getValue(CompressedState const& state) const;
+
+        // Whether the module has an indexed variable at all. If not, all commands are unindexed.
+        bool hasIndexedVariable = false;
+
+        // The location of the indexed variable in compressed states.
+        bool isBooleanVariable = false;
+        uint64_t bitOffset = 0;
+        uint64_t bitWidth = 0;
+        int64_t lowerBound = 0;
+
+        // For each command of the module, the value of the indexed variable required by its guard (if any).
+        std::vector<boost::optional<int64_t>> requiredValues;
+
+        // For each value of the indexed variable, the sorted indices of the commands requiring this value.
+        std::unordered_map<int64_t, std::vector<uint64_t>> commandIndicesByValue;
+
+        // The sorted indices of the commands that do not require a particular value of the indexed variable.
+        std::vector<uint64_t> unindexedCommandIndices;
+    };
+
+    // The program used for the generation of next states. It is shared with the clones of this generator.
+    std::shared_ptr<storm::prism::Program const> sharedProgram;
+    storm::prism::Program const& program;
 
     // The reward models that need to be considered.
     std::vector<std::reference_wrapper<storm::prism::RewardModel const>> rewardModels;
@@ -138,6 +242,40 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The hash of the state that is currently being expanded.
+    uint64_t currentStateHash;
+
+    // The hash function used to derive the hashes of successor states.
+    storm::storage::ZobristBitVectorHash stateHasher;
+
+    // The guard index of each module (shared with the clones of this generator).
+    std::shared_ptr<std::vector<GuardIndex> const> guardIndices;
+
+    // Memory used for assembling candidate commands.
+    std::vector<uint64_t> candidateCommandIndicesMemory;
+
+    // If requested, the guards of the commands compiled to native code (indexed by the global command index).
+    std::shared_ptr<CompiledStatePredicates const> compiledGuards;
+
+    // If partial order reduction is applied, the modules with commands that may form an ample set and these commands (by their global index).
+    std::vector<uint64_t> partialOrderReductionModules;
+    storm::storage::BitVector ampleCommands;
+
+    // One plus the largest index of the states expanded so far, i.e. all expanded states have a smaller index.
+    uint64_t numberOfKnownStates;
+
+    // A family of modules whose local variables can be permuted arbitrarily without changing the behavior of the program.
+    struct SymmetricModuleFamily {
+        // For each module of the family, the bit offsets of its local variables in compressed states. The variables are ordered consistently.
+        std::vector<std::vector<uint64_t>> bitOffsets;
+
+        // The bit widths of the local variables, which coincide for all modules of the family.
+        std::vector<uint64_t> bitWidths;
+    };
+
+    // If symmetry reduction is applied, the fully symmetric module families.
+    std::vector<SymmetricModuleFamily> symmetricModuleFamilies;
 };
 
 }  // namespace generator
@@ -1,5 +1,7 @@
 #include "storm/generator/StateBehavior.h"
 
+#include <iterator>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 namespace storm {
@@ -15,6 +17,15 @@ void StateBehavior<ValueType, StateType>::addChoice(Choice<ValueType, StateType>
     choices.push_back(std::move(choice));
 }
 
+template<typename ValueType, typename StateType>
+void StateBehavior<ValueType, StateType>::addChoices(std::vector<Choice<ValueType, StateType>>&& newChoices) {
+    if (choices.empty()) {
+        choices = std::move(newChoices);
+    } else {
+        choices.insert(choices.end(), std::make_move_iterator(newChoices.begin()), std::make_move_iterator(newChoices.end()));
+    }
+}
+
 template<typename ValueType, typename StateType>
 void StateBehavior<ValueType, StateType>::addStateReward(ValueType const& stateReward) {
     stateRewards.push_back(stateReward);
@@ -21,6 +21,11 @@ class StateBehavior {
      */
     void addChoice(Choice<ValueType, StateType>&& choice);
 
+    /*!
+     * Adds the given choices to the behavior of the state. If there are no choices yet, the given vector is taken over as a whole.
+     */
+    void addChoices(std::vector<Choice<ValueType, StateType>>&& choices);
+
     /*!
      * Adds the given state reward to the behavior of the state.
      */
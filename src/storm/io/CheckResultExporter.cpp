@@ -0,0 +1,515 @@
+#include "storm/io/CheckResultExporter.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <queue>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+CheckResultExportFormat getCheckResultExportFormat(std::string const& filename) {
+    auto hasExtension = [&filename](std::string const& extension) {
+        return filename.size() > extension.size() && std::equal(extension.rbegin(), extension.rend(), filename.rbegin());
+    };
+    if (hasExtension(".jsonl")) {
+        return CheckResultExportFormat::Jsonl;
+    } else if (hasExtension(".csv")) {
+        return CheckResultExportFormat::Csv;
+    } else if (hasExtension(".srb")) {
+        return CheckResultExportFormat::Binary;
+    }
+    return CheckResultExportFormat::Json;
+}
+
+namespace {
+
+namespace detail {
+// The number of states whose output is produced at once. This is a multiple of 64 such that bit vector columns can be written chunk by chunk.
+uint64_t const resultChunkSize = 1ull << 16;
+}  // namespace detail
+
+/*!
+ * The exported states, either given as a set (exported in ascending order) or as an explicit sequence.
+ */
+class StateSelection {
+   public:
+    explicit StateSelection(storm::storage::BitVector&& states) : states(std::move(states)) {}
+    explicit StateSelection(std::vector<uint64_t>&& orderedStates) : orderedStates(std::move(orderedStates)) {}
+
+    uint64_t size() const {
+        return states ? states->getNumberOfSetBits() : orderedStates.size();
+    }
+
+    /*!
+     * Calls the given function for consecutive chunks of the selected states.
+     */
+    void forEachChunk(std::function<void(std::vector<uint64_t> const&)> const& callback) const {
+        std::vector<uint64_t> chunk;
+        chunk.reserve(detail::resultChunkSize);
+        auto addState = [&](uint64_t state) {
+            chunk.push_back(state);
+            if (chunk.size() == detail::resultChunkSize) {
+                callback(chunk);
+                chunk.clear();
+            }
+        };
+        if (states) {
+            for (auto state : *states) {
+                addState(state);
+            }
+        } else {
+            for (auto state : orderedStates) {
+                addState(state);
+            }
+        }
+        if (!chunk.empty()) {
+            callback(chunk);
+        }
+    }
+
+   private:
+    std::optional<storm::storage::BitVector> states;
+    std::vector<uint64_t> orderedStates;
+};
+
+template<typename ValueType>
+StateSelection selectStates(storm::models::sparse::Model<ValueType> const& model,
+                            storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportOptions const& options) {
+    storm::storage::BitVector states;
+    if (checkResult.isResultForAllStates()) {
+        states = storm::storage::BitVector(checkResult.getValueVector().size(), true);
+    } else {
+        states = storm::storage::BitVector(model.getNumberOfStates(), false);
+        for (auto const& stateValue : checkResult.getValueMap()) {
+            states.set(stateValue.first, true);
+        }
+    }
+    if (options.stateLabel) {
+        STORM_LOG_THROW(model.getStateLabeling().containsLabel(options.stateLabel.value()), storm::exceptions::InvalidArgumentException,
+                        "The model has no state label '" << options.stateLabel.value() << "'.");
+        storm::storage::BitVector labeledStates = model.getStateLabeling().getStates(options.stateLabel.value());
+        labeledStates.resize(states.size());
+        states &= labeledStates;
+    }
+    if (!options.topK) {
+        return StateSelection(std::move(states));
+    }
+
+    // Keep the best k states in a heap whose top is the worst of them.
+    auto isBetter = [&checkResult](uint64_t const& lhs, uint64_t const& rhs) {
+        ValueType const& lhsValue = checkResult[lhs];
+        ValueType const& rhsValue = checkResult[rhs];
+        return lhsValue > rhsValue || (lhsValue == rhsValue && lhs < rhs);
+    };
+    std::priority_queue<uint64_t, std::vector<uint64_t>, decltype(isBetter)> bestStates(isBetter);
+    uint64_t const k = options.topK.value();
+    if (k > 0) {
+        for (auto state : states) {
+            if (bestStates.size() < k) {
+                bestStates.push(state);
+            } else if (isBetter(state, bestStates.top())) {
+                bestStates.pop();
+                bestStates.push(state);
+            }
+        }
+    }
+    std::vector<uint64_t> orderedStates(bestStates.size());
+    for (auto stateIt = orderedStates.rbegin(); stateIt != orderedStates.rend(); ++stateIt) {
+        *stateIt = bestStates.top();
+        bestStates.pop();
+    }
+    return StateSelection(std::move(orderedStates));
+}
+
+/*!
+ * Retrieves the values of the state variables for chunks of states.
+ */
+class ValuationChunk {
+   public:
+    explicit ValuationChunk(storm::storage::sparse::StateValuations const* valuations) : valuations(valuations) {
+        if (valuations) {
+            variables = valuations->getVariables();
+            integerValues.resize(variables.size());
+            rationalValues.resize(variables.size());
+        }
+    }
+
+    void load(std::vector<uint64_t> const& states) {
+        for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+            load(states, variableIndex);
+        }
+    }
+
+    void load(std::vector<uint64_t> const& states, uint64_t variableIndex) {
+        auto const& variable = variables[variableIndex];
+        if (variable.hasRationalType()) {
+            auto& values = rationalValues[variableIndex];
+            values.resize(states.size());
+            for (uint64_t i = 0; i < states.size(); ++i) {
+                values[i] = valuations->isEmpty(states[i]) ? 0.0 : storm::utility::convertNumber<double>(valuations->getRationalValue(states[i], variable));
+            }
+        } else {
+            valuations->getIntegerValues(variable, states, integerValues[variableIndex]);
+        }
+    }
+
+    bool hasValuations() const {
+        return valuations != nullptr;
+    }
+
+    bool isEmpty(uint64_t state) const {
+        return valuations->isEmpty(state);
+    }
+
+    std::vector<storm::expressions::Variable> const& getVariables() const {
+        return variables;
+    }
+
+    std::vector<int64_t> const& getIntegerValues(uint64_t variableIndex) const {
+        return integerValues[variableIndex];
+    }
+
+    std::vector<double> const& getRationalValues(uint64_t variableIndex) const {
+        return rationalValues[variableIndex];
+    }
+
+   private:
+    storm::storage::sparse::StateValuations const* valuations;
+    std::vector<storm::expressions::Variable> variables;
+    std::vector<std::vector<int64_t>> integerValues;
+    std::vector<std::vector<double>> rationalValues;
+};
+
+void appendNumber(std::string& buffer, int64_t number) {
+    char chars[24];
+    auto result = std::to_chars(chars, chars + sizeof(chars), number);
+    buffer.append(chars, result.ptr);
+}
+
+/*!
+ * Appends the shortest representation of the given double that parses back to the same value. Json does not support non-finite numbers, which are
+ * therefore written as null (as done by our json library).
+ */
+void appendDouble(std::string& buffer, double value, bool isJson) {
+    if (!std::isfinite(value)) {
+        if (isJson) {
+            buffer += "null";
+        } else {
+            buffer += std::isnan(value) ? "nan" : (value > 0 ? "inf" : "-inf");
+        }
+        return;
+    }
+    char chars[32];
+    auto result = std::to_chars(chars, chars + sizeof(chars), value);
+    buffer.append(chars, result.ptr);
+}
+
+void appendJsonString(std::string& buffer, std::string const& str) {
+    buffer += '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            buffer += '\\';
+            buffer += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char chars[8];
+            std::snprintf(chars, sizeof(chars), "\\u%04x", static_cast<unsigned>(c));
+            buffer += chars;
+        } else {
+            buffer += c;
+        }
+    }
+    buffer += '"';
+}
+
+void appendCsvString(std::string& buffer, std::string const& str) {
+    if (str.find_first_of(",\"\n") == std::string::npos) {
+        buffer += str;
+        return;
+    }
+    buffer += '"';
+    for (char c : str) {
+        if (c == '"') {
+            buffer += '"';
+        }
+        buffer += c;
+    }
+    buffer += '"';
+}
+
+template<typename ValueType>
+class CheckResultFormatter {
+   public:
+    CheckResultFormatter(storm::models::sparse::Model<ValueType> const& model,
+                         storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportOptions const& options)
+        : checkResult(checkResult), options(options), valuationChunk(model.hasStateValuations() ? &model.getStateValuations() : nullptr) {
+        if (options.includeLabels) {
+            for (auto const& label : model.getStateLabeling().getLabels()) {
+                labels.emplace_back(label, &model.getStateLabeling().getStates(label));
+            }
+        }
+    }
+
+    void exportText(std::ostream& os, StateSelection const& selection) {
+        std::string buffer;
+        CheckResultExportFormat const format = options.format;
+        if (format == CheckResultExportFormat::Json) {
+            buffer += "[";
+        } else if (format == CheckResultExportFormat::Csv) {
+            appendCsvHeader(buffer);
+        }
+        bool first = true;
+        selection.forEachChunk([&](std::vector<uint64_t> const& states) {
+            valuationChunk.load(states);
+            for (uint64_t i = 0; i < states.size(); ++i) {
+                if (format == CheckResultExportFormat::Csv) {
+                    appendCsvLine(buffer, states[i], i);
+                } else {
+                    if (format == CheckResultExportFormat::Json) {
+                        buffer += first ? "\n" : ",\n";
+                    }
+                    appendJsonEntry(buffer, states[i], i);
+                    if (format == CheckResultExportFormat::Jsonl) {
+                        buffer += '\n';
+                    }
+                }
+                first = false;
+            }
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        });
+        if (format == CheckResultExportFormat::Json) {
+            buffer += "\n]\n";
+        }
+        os.write(buffer.data(), buffer.size());
+    }
+
+    void exportBinary(std::ostream& os, StateSelection const& selection) {
+        auto const& variables = valuationChunk.getVariables();
+        srb::Header header{};
+        std::copy(std::begin(srb::Magic), std::end(srb::Magic), header.magic);
+        header.version = srb::Version;
+        header.byteOrderMarker = 0x0102030405060708ull;
+        header.numberOfRows = selection.size();
+        header.numberOfColumns = 2 + variables.size() + labels.size();
+        writeRaw(os, &header, sizeof(header));
+
+        writeColumn(os, srb::ColumnTypeCode::State, "state", selection, [&](std::vector<uint64_t> const& states) { writeVector(os, states); });
+        writeColumn(os, srb::ColumnTypeCode::Value, "value", selection, [&](std::vector<uint64_t> const& states) {
+            std::vector<double> values(states.size());
+            for (uint64_t i = 0; i < states.size(); ++i) {
+                values[i] = storm::utility::convertNumber<double>(checkResult[states[i]]);
+            }
+            writeVector(os, values);
+        });
+        for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+            auto const& variable = variables[variableIndex];
+            if (variable.hasRationalType()) {
+                writeColumn(os, srb::ColumnTypeCode::Rational, variable.getName(), selection, [&](std::vector<uint64_t> const& states) {
+                    valuationChunk.load(states, variableIndex);
+                    writeVector(os, valuationChunk.getRationalValues(variableIndex));
+                });
+            } else if (variable.hasBooleanType()) {
+                writeColumn(os, srb::ColumnTypeCode::Boolean, variable.getName(), selection, [&](std::vector<uint64_t> const& states) {
+                    valuationChunk.load(states, variableIndex);
+                    auto const& values = valuationChunk.getIntegerValues(variableIndex);
+                    writeBits(os, states.size(), [&values](uint64_t i) { return values[i] != 0; });
+                });
+            } else {
+                writeColumn(os, srb::ColumnTypeCode::Integer, variable.getName(), selection, [&](std::vector<uint64_t> const& states) {
+                    valuationChunk.load(states, variableIndex);
+                    writeVector(os, valuationChunk.getIntegerValues(variableIndex));
+                });
+            }
+        }
+        for (auto const& [label, labeledStates] : labels) {
+            writeColumn(os, srb::ColumnTypeCode::Boolean, label, selection, [&](std::vector<uint64_t> const& states) {
+                writeBits(os, states.size(), [&](uint64_t i) { return isLabeled(*labeledStates, states[i]); });
+            });
+        }
+    }
+
+   private:
+    static bool isLabeled(storm::storage::BitVector const& labeledStates, uint64_t state) {
+        return state < labeledStates.size() && labeledStates.get(state);
+    }
+
+    void appendValue(std::string& buffer, ValueType const& value, bool isJson) const {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            appendDouble(buffer, value, isJson);
+        } else {
+            if (isJson) {
+                // Json has no representation for exact values.
+                appendDouble(buffer, storm::utility::convertNumber<double>(value), true);
+            } else {
+                buffer += storm::utility::to_string(value);
+            }
+        }
+    }
+
+    void appendJsonEntry(std::string& buffer, uint64_t state, uint64_t indexInChunk) const {
+        buffer += "{\"s\":";
+        if (valuationChunk.hasValuations()) {
+            buffer += '{';
+            if (!valuationChunk.isEmpty(state)) {
+                auto const& variables = valuationChunk.getVariables();
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    if (variableIndex > 0) {
+                        buffer += ',';
+                    }
+                    appendJsonString(buffer, variables[variableIndex].getName());
+                    buffer += ':';
+                    appendVariableValue(buffer, variableIndex, indexInChunk, true);
+                }
+            }
+            buffer += '}';
+        } else {
+            appendNumber(buffer, state);
+        }
+        buffer += ",\"v\":";
+        appendValue(buffer, checkResult[state], true);
+        if (options.includeLabels) {
+            buffer += ",\"l\":[";
+            bool first = true;
+            for (auto const& [label, labeledStates] : labels) {
+                if (isLabeled(*labeledStates, state)) {
+                    if (!first) {
+                        buffer += ',';
+                    }
+                    first = false;
+                    appendJsonString(buffer, label);
+                }
+            }
+            buffer += ']';
+        }
+        buffer += '}';
+    }
+
+    void appendCsvHeader(std::string& buffer) const {
+        buffer += "state";
+        for (auto const& variable : valuationChunk.getVariables()) {
+            buffer += ',';
+            appendCsvString(buffer, variable.getName());
+        }
+        buffer += ",value";
+        if (options.includeLabels) {
+            buffer += ",labels";
+        }
+        buffer += '\n';
+    }
+
+    void appendCsvLine(std::string& buffer, uint64_t state, uint64_t indexInChunk) const {
+        appendNumber(buffer, state);
+        bool const hasValuation = valuationChunk.hasValuations() && !valuationChunk.isEmpty(state);
+        for (uint64_t variableIndex = 0; variableIndex < valuationChunk.getVariables().size(); ++variableIndex) {
+            buffer += ',';
+            if (hasValuation) {
+                appendVariableValue(buffer, variableIndex, indexInChunk, false);
+            }
+        }
+        buffer += ',';
+        appendValue(buffer, checkResult[state], false);
+        if (options.includeLabels) {
+            // Labels are separated by spaces.
+            std::string stateLabels;
+            for (auto const& [label, labeledStates] : labels) {
+                if (isLabeled(*labeledStates, state)) {
+                    if (!stateLabels.empty()) {
+                        stateLabels += ' ';
+                    }
+                    stateLabels += label;
+                }
+            }
+            buffer += ',';
+            appendCsvString(buffer, stateLabels);
+        }
+        buffer += '\n';
+    }
+
+    void appendVariableValue(std::string& buffer, uint64_t variableIndex, uint64_t indexInChunk, bool isJson) const {
+        auto const& variable = valuationChunk.getVariables()[variableIndex];
+        if (variable.hasRationalType()) {
+            appendDouble(buffer, valuationChunk.getRationalValues(variableIndex)[indexInChunk], isJson);
+        } else if (variable.hasBooleanType()) {
+            buffer += valuationChunk.getIntegerValues(variableIndex)[indexInChunk] != 0 ? "true" : "false";
+        } else {
+            appendNumber(buffer, valuationChunk.getIntegerValues(variableIndex)[indexInChunk]);
+        }
+    }
+
+    static void writeRaw(std::ostream& os, void const* data, uint64_t numberOfBytes) {
+        os.write(reinterpret_cast<char const*>(data), numberOfBytes);
+    }
+
+    template<typename T>
+    static void writeVector(std::ostream& os, std::vector<T> const& values) {
+        static_assert(sizeof(T) == 8, "Only 64 bit words are written.");
+        writeRaw(os, values.data(), values.size() * sizeof(T));
+    }
+
+    /*!
+     * Writes the given number of bits as a sequence of 64 bit words (in the same order as BitVector::getAsInt).
+     */
+    template<typename BitFunction>
+    static void writeBits(std::ostream& os, uint64_t numberOfBits, BitFunction const& getBit) {
+        std::vector<uint64_t> words((numberOfBits + 63) / 64, 0);
+        for (uint64_t i = 0; i < numberOfBits; ++i) {
+            if (getBit(i)) {
+                words[i / 64] |= 1ull << (63 - (i % 64));
+            }
+        }
+        writeVector(os, words);
+    }
+
+    static void writeColumn(std::ostream& os, srb::ColumnTypeCode type, std::string const& name, StateSelection const& selection,
+                            std::function<void(std::vector<uint64_t> const&)> const& writeChunk) {
+        uint64_t const typeCode = static_cast<uint64_t>(type);
+        writeRaw(os, &typeCode, sizeof(typeCode));
+        uint64_t const nameLength = name.size();
+        writeRaw(os, &nameLength, sizeof(nameLength));
+        std::string paddedName = name;
+        paddedName.resize((nameLength + 7) & ~7ull, '\0');
+        writeRaw(os, paddedName.data(), paddedName.size());
+        selection.forEachChunk(writeChunk);
+    }
+
+    storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult;
+    CheckResultExportOptions const& options;
+    ValuationChunk valuationChunk;
+    std::vector<std::pair<std::string, storm::storage::BitVector const*>> labels;
+};
+
+}  // namespace
+
+template<typename ValueType>
+void exportCheckResult(std::ostream& os, storm::models::sparse::Model<ValueType> const& model,
+                       storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportOptions const& options) {
+    StateSelection selection = selectStates(model, checkResult, options);
+    STORM_LOG_INFO("Exporting the result for " << selection.size() << " state(s).");
+    CheckResultFormatter<ValueType> formatter(model, checkResult, options);
+    if (options.format == CheckResultExportFormat::Binary) {
+        formatter.exportBinary(os, selection);
+    } else {
+        formatter.exportText(os, selection);
+    }
+}
+
+template void exportCheckResult<double>(std::ostream& os, storm::models::sparse::Model<double> const& model,
+                                        storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& checkResult,
+                                        CheckResultExportOptions const& options);
+template void exportCheckResult<storm::RationalNumber>(std::ostream& os, storm::models::sparse::Model<storm::RationalNumber> const& model,
+                                                       storm::modelchecker::ExplicitQuantitativeCheckResult<storm::RationalNumber> const& checkResult,
+                                                       CheckResultExportOptions const& options);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace modelchecker {
+template<typename ValueType>
+class ExplicitQuantitativeCheckResult;
+}
+
+namespace exporter {
+
+enum class CheckResultExportFormat {
+    Json,   // A single json array (as written by ExplicitQuantitativeCheckResult::toJson)
+    Jsonl,  // One json object per line with the same entries as in the json array
+    Csv,    // One line per state with one column per state variable
+    Binary  // Binary columnar format (see below)
+};
+
+/*!
+ * Derives the export format from the extension of the given file: '.jsonl', '.csv' and '.srb' (binary) are recognized, everything else is exported as
+ * json.
+ */
+CheckResultExportFormat getCheckResultExportFormat(std::string const& filename);
+
+struct CheckResultExportOptions {
+    CheckResultExportFormat format = CheckResultExportFormat::Jsonl;
+    // If set, only the states with this label are exported.
+    std::optional<std::string> stateLabel;
+    // If set, only (at most) this many states with the largest values are exported in descending order of their values. Ties are broken by the state index.
+    std::optional<uint64_t> topK;
+    // Whether the labels of each state are exported.
+    bool includeLabels = true;
+};
+
+/*
+ * Layout of the binary columnar result format (srb).
+ *
+ * The file starts with a fixed-size header followed by the columns. Each column consists of its ColumnTypeCode, its name and one entry for each
+ * exported state. All numbers are stored as 64 bit words in the byte order of the machine that wrote the file, strings are stored as in the drb format
+ * (see DirectEncodingBinaryFormat.h), i.e. all data is 8 byte aligned.
+ *
+ * Columns:
+ * - State:    the index of the state
+ * - Value:    the value of the state as double
+ * - Boolean:  a bit vector over the exported states (used for boolean state variables and, if requested, for each state label)
+ * - Integer:  one integer per state (used for integer state variables)
+ * - Rational: one double per state (used for rational state variables)
+ * States without a valuation get the value 0 (or false) in all variable columns.
+ */
+namespace srb {
+constexpr char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'R', 'B'};
+constexpr uint64_t Version = 1;
+
+enum class ColumnTypeCode : uint64_t { State = 1, Value = 2, Boolean = 3, Integer = 4, Rational = 5 };
+
+struct Header {
+    char magic[8];
+    uint64_t version;
+    uint64_t byteOrderMarker;
+    uint64_t numberOfRows;
+    uint64_t numberOfColumns;
+};
+}  // namespace srb
+
+/*!
+ * Exports the values of the given check result together with the state valuations (if present) and the state labels of the given model.
+ * In contrast to ExplicitQuantitativeCheckResult::toJson, the output is produced in chunks of states, such that only a bounded amount of memory is needed
+ * (apart from the top-k selection, which keeps k states).
+ *
+ * @param os The stream to export to. For the binary format, the stream has to be opened in binary mode.
+ */
+template<typename ValueType>
+void exportCheckResult(std::ostream& os, storm::models::sparse::Model<ValueType> const& model,
+                       storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType> const& checkResult, CheckResultExportOptions const& options);
+
+}  // namespace exporter
+}  // namespace storm
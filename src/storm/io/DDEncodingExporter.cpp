@@ -1,6 +1,13 @@
 #include "storm/io/DDEncodingExporter.h"
+
+#include <filesystem>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/io/file.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
 
 namespace storm {
 namespace exporter {
@@ -25,6 +32,102 @@ void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<st
     }
 }
 
+namespace {
+/*!
+ * Names in the manifest are separated by whitespace (except for the last entry of a line).
+ */
+void checkName(std::string const& name) {
+    STORM_LOG_THROW(name.find_first_of(" \t\n") == std::string::npos, storm::exceptions::NotSupportedException,
+                    "Cannot export the meta variable '" << name << "' as its name contains whitespace.");
+}
+
+template<storm::dd::DdType Type>
+std::string exportDd(std::filesystem::path const& directory, std::string const& name, storm::dd::Dd<Type> const& dd) {
+    std::string filename = name + ".dd";
+    dd.exportToBinary((directory / filename).string());
+    return filename;
+}
+}  // namespace
+
+template<storm::dd::DdType Type, typename ValueType>
+void explicitExportSymbolicModelBinary(std::string const& directory, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel) {
+    auto const modelType = symbolicModel->getType();
+    STORM_LOG_THROW(modelType == storm::models::ModelType::Dtmc || modelType == storm::models::ModelType::Ctmc || modelType == storm::models::ModelType::Mdp,
+                    storm::exceptions::NotSupportedException, "Exporting symbolic models of type " << modelType << " in binary format is not supported.");
+    std::filesystem::path const path(directory);
+    std::error_code errorCode;
+    std::filesystem::create_directories(path, errorCode);
+    STORM_LOG_THROW(!errorCode, storm::exceptions::FileIoException, "Could not create directory " << directory << ": " << errorCode.message() << ".");
+
+    std::ofstream filestream;
+    storm::utility::openFile((path / drdd::manifestFilename).string(), filestream);
+    filestream << "// storm exported binary dd\n";
+    filestream << "@type: " << modelType << '\n';
+
+    // The meta variables are recreated in the order of their DD variable indices when loading the model. Layers of a meta variable (i.e. x, x', x'', ...)
+    // are created together, so we only store the first layer.
+    auto const& manager = symbolicModel->getManager();
+    std::map<uint64_t, std::string> indexToMetaVariableName;
+    for (auto const& name : manager.getAllMetaVariableNames()) {
+        if (name.back() != '\'') {
+            checkName(name);
+            indexToMetaVariableName.emplace(manager.getMetaVariable(manager.getMetaVariable(name)).getLowestIndex(), name);
+        }
+    }
+    filestream << "@metavariables\n";
+    for (auto const& [lowestIndex, name] : indexToMetaVariableName) {
+        auto const& metaVariable = manager.getMetaVariable(manager.getMetaVariable(name));
+        uint64_t numberOfLayers = 1;
+        while (manager.hasMetaVariable(name + std::string(numberOfLayers, '\''))) {
+            ++numberOfLayers;
+        }
+        switch (metaVariable.getType()) {
+            case storm::dd::MetaVariableType::Bool:
+                filestream << "bool " << numberOfLayers << ' ' << lowestIndex << ' ' << name << '\n';
+                break;
+            case storm::dd::MetaVariableType::Int:
+                filestream << "int " << numberOfLayers << ' ' << lowestIndex << ' ' << metaVariable.getLow() << ' ' << metaVariable.getHigh() << ' ' << name
+                           << '\n';
+                break;
+            case storm::dd::MetaVariableType::BitVector:
+                filestream << "bitvector " << numberOfLayers << ' ' << lowestIndex << ' ' << metaVariable.getNumberOfDdVariables() << ' ' << name << '\n';
+                break;
+        }
+    }
+    filestream << "@rowcolumn\n";
+    for (auto const& [rowVariable, columnVariable] : symbolicModel->getRowColumnMetaVariablePairs()) {
+        filestream << rowVariable.getName() << ' ' << columnVariable.getName() << '\n';
+    }
+    filestream << "@nondeterminism\n";
+    for (auto const& variable : symbolicModel->getNondeterminismVariables()) {
+        filestream << variable.getName() << '\n';
+    }
+
+    filestream << "@transitions: " << exportDd(path, "transitions", symbolicModel->getTransitionMatrix()) << '\n';
+    filestream << "@reachable: " << exportDd(path, "reachable", symbolicModel->getReachableStates()) << '\n';
+    filestream << "@initial: " << exportDd(path, "initial", symbolicModel->getInitialStates()) << '\n';
+    filestream << "@deadlock: " << exportDd(path, "deadlock", symbolicModel->getDeadlockStates()) << '\n';
+
+    // Labels and reward models are stored in files named by their position as their names are arbitrary.
+    filestream << "@labels\n";
+    uint64_t labelIndex = 0;
+    for (auto const& label : symbolicModel->getLabels()) {
+        filestream << exportDd(path, "label" + std::to_string(labelIndex++), symbolicModel->getStates(label)) << ' ' << label << '\n';
+    }
+    filestream << "@rewards\n";
+    uint64_t rewardModelIndex = 0;
+    for (auto const& [rewardModelName, rewardModel] : symbolicModel->getRewardModels()) {
+        std::string const prefix = "reward" + std::to_string(rewardModelIndex++);
+        filestream << (rewardModel.hasStateRewards() ? exportDd(path, prefix + "-state", rewardModel.getStateRewardVector()) : "-") << ' ';
+        filestream << (rewardModel.hasStateActionRewards() ? exportDd(path, prefix + "-stateaction", rewardModel.getStateActionRewardVector()) : "-") << ' ';
+        filestream << (rewardModel.hasTransitionRewards() ? exportDd(path, prefix + "-transition", rewardModel.getTransitionRewardMatrix()) : "-") << ' ';
+        filestream << rewardModelName << '\n';
+    }
+    filestream << "@end\n";
+    STORM_LOG_THROW(filestream, storm::exceptions::FileIoException, "Could not write the manifest to directory " << directory << ".");
+    storm::utility::closeFile(filestream);
+}
+
 template void explicitExportSymbolicModel<storm::dd::DdType::CUDD, double>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, double>(
@@ -34,5 +137,10 @@ template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::Rati
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber>> sparseModel);
 template void explicitExportSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalFunction>(
     std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction>> sparseModel);
+
+template void explicitExportSymbolicModelBinary<storm::dd::DdType::CUDD, double>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> symbolicModel);
+template void explicitExportSymbolicModelBinary<storm::dd::DdType::Sylvan, double>(
+    std::string const&, std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> symbolicModel);
 }  // namespace exporter
 }  // namespace storm
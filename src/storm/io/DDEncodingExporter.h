@@ -14,5 +14,24 @@ namespace exporter {
 template<storm::dd::DdType Type, typename ValueType>
 void explicitExportSymbolicModel(std::string const& filename, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel);
 
+/*!
+ * Exports a symbolic model into the binary drdd format. The model is stored in the given directory which contains
+ *  - a textual manifest (see drdd::manifestFilename) describing the model type, the meta variables of the DD manager (in the order of their DD variable
+ *    indices), the row/column pairs, the labels and the reward models and
+ *  - one binary file (see storm::dd::Dd::exportToBinary) for each DD of the model.
+ * As the DDs are stored as node tables, the model can be loaded again in time linear in the size of the DDs (see storm::parser::DdEncodingBinaryParser).
+ * Only Dtmcs, Ctmcs and Mdps are supported.
+ *
+ * @param directory      Directory path. It is created if it does not exist yet.
+ * @param symbolicModel  Model to export
+ */
+template<storm::dd::DdType Type, typename ValueType>
+void explicitExportSymbolicModelBinary(std::string const& directory, std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> symbolicModel);
+
+namespace drdd {
+// The name of the manifest file within a directory holding a binary drdd export.
+std::string const manifestFilename = "model.drdd";
+}  // namespace drdd
+
 }  // namespace exporter
 }  // namespace storm
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace drb {
+
+/*
+ * Layout of the binary direct encoding (drb).
+ *
+ * The file starts with a fixed-size header followed by a sequence of sections that is terminated by a section of type End.
+ * Each section starts with a section header (its type and the size of its payload in bytes).
+ * All numbers are stored as 64 bit words (unless stated otherwise) in the byte order of the machine that wrote the file.
+ * Arrays and strings are padded with zeros to a multiple of 8 bytes such that all arrays are properly aligned when the file is mapped into memory.
+ *
+ * Strings are stored as their length followed by the characters.
+ * Bit vectors are stored as the sequence of their 64 bit words (as obtained by BitVector::getAsInt), their length is given by the context.
+ *
+ * Sections:
+ * - RowIndications:  numberOfChoices + 1 offsets into the entries
+ * - Columns:         numberOfEntries column indices
+ * - Values:          numberOfEntries values
+ * - RowGroupIndices: numberOfStates + 1 offsets into the rows (only for nondeterministic models)
+ * - StateLabel:      name followed by a bit vector over the states
+ * - ChoiceLabel:     name followed by a bit vector over the choices
+ * - RewardModel:     name, a word of RewardModelFlags, followed by the state and/or state-action rewards
+ * - ExitRates:       one value per state (only for continuous time models)
+ * - MarkovianStates: bit vector over the states (only for Markov automata)
+ * - Observations:    one 32 bit observation per state (only for POMDPs)
+ * - StateValuations: number of variables, for each variable its VariableTypeCode and name, followed by one word per state and variable
+ */
+
+constexpr char Magic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+constexpr uint64_t Version = 1;
+constexpr uint64_t ByteOrderMarker = 0x0102030405060708ull;
+
+enum class ValueTypeCode : uint64_t { Double = 1 };
+
+enum class ModelTypeCode : uint64_t { Dtmc = 1, Ctmc = 2, Mdp = 3, MarkovAutomaton = 4, Pomdp = 5 };
+
+enum class SectionType : uint64_t {
+    End = 0,
+    RowIndications = 1,
+    Columns = 2,
+    Values = 3,
+    RowGroupIndices = 4,
+    StateLabel = 5,
+    ChoiceLabel = 6,
+    RewardModel = 7,
+    ExitRates = 8,
+    MarkovianStates = 9,
+    Observations = 10,
+    StateValuations = 11
+};
+
+enum RewardModelFlags : uint64_t { HasStateRewards = 1, HasStateActionRewards = 2 };
+
+enum class VariableTypeCode : uint64_t { Boolean = 1, Integer = 2 };
+
+struct Header {
+    char magic[8];
+    uint64_t version;
+    uint64_t byteOrderMarker;
+    uint64_t valueType;
+    uint64_t modelType;
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfEntries;
+};
+
+struct SectionHeader {
+    uint64_t type;
+    uint64_t size;
+};
+
+/*!
+ * @return The given number of bytes rounded up to the next multiple of 8.
+ */
+constexpr uint64_t paddedSize(uint64_t numberOfBytes) {
+    return (numberOfBytes + 7) & ~7ull;
+}
+
+/*!
+ * @return The number of bytes needed to store a bit vector of the given length.
+ */
+constexpr uint64_t bitVectorSize(uint64_t length) {
+    return ((length + 63) / 64) * 8;
+}
+
+/*!
+ * @return The number of bytes needed to store a string of the given length.
+ */
+constexpr uint64_t stringSize(uint64_t length) {
+    return 8 + paddedSize(length);
+}
+
+}  // namespace drb
+}  // namespace exporter
+}  // namespace storm
@@ -1,6 +1,12 @@
 #include "storm/io/DirectEncodingExporter.h"
+#include "storm/io/DirectEncodingBinaryFormat.h"
 #include <storm/exceptions/NotSupportedException.h>
 
+#include <charconv>
+#include <optional>
+#include <sstream>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,14 +14,197 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 namespace storm {
 namespace exporter {
 
+namespace {
+
+namespace detail {
+// The (approximate) number of matrix entries and rows whose output is formatted at once
+uint64_t const drnChunkSize = 1ull << 16;
+// The number of chunks per thread that are kept in memory before they are written to the stream
+uint64_t const drnChunksPerThread = 4;
+}  // namespace detail
+
+/*!
+ * Formats the states of a model in the DRN format.
+ * Numbers are written as the given output stream would write them, but doubles are formatted using std::to_chars, avoiding the overhead of iostreams.
+ */
+template<typename ValueType>
+class DrnStateFormatter {
+   public:
+    DrnStateFormatter(storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> const& exitRates,
+                      std::unordered_map<ValueType, std::string> const& placeholders, std::ostream const& formatSource)
+        : model(model), exitRates(exitRates), placeholders(placeholders), precision(formatSource.precision()), flags(formatSource.flags()) {
+        if (model.getType() == storm::models::ModelType::Pomdp) {
+            observations = &static_cast<storm::models::sparse::Pomdp<ValueType> const&>(model).getObservations();
+        }
+        auto const floatField = flags & std::ios_base::floatfield;
+        if (floatField == std::ios_base::fixed) {
+            doubleFormat = std::chars_format::fixed;
+        } else if (floatField == std::ios_base::scientific) {
+            doubleFormat = std::chars_format::scientific;
+        } else if (floatField == std::ios_base::fmtflags()) {
+            doubleFormat = std::chars_format::general;
+        }
+    }
+
+    /*!
+     * Appends the output for the states in [groupBegin, groupEnd) to the given buffer.
+     */
+    void formatStates(uint64_t groupBegin, uint64_t groupEnd, std::string& buffer) const {
+        // Fallback for values that are not formatted via std::to_chars
+        std::ostringstream valueStream;
+        valueStream.precision(precision);
+        valueStream.flags(flags);
+
+        storm::storage::SparseMatrix<ValueType> const& matrix = model.getTransitionMatrix();
+        for (uint64_t group = groupBegin; group < groupEnd; ++group) {
+            buffer += "state ";
+            appendNumber(buffer, group);
+
+            // Write exit rates for CTMCs and MAs
+            if (!exitRates.empty()) {
+                buffer += " !";
+                appendValue(buffer, exitRates[group], valueStream);
+            }
+
+            if (observations) {
+                buffer += " {";
+                appendNumber(buffer, (*observations)[group]);
+                buffer += '}';
+            }
+
+            // Write state rewards
+            bool first = true;
+            for (auto const& rewardModelEntry : model.getRewardModels()) {
+                buffer += first ? " [" : ", ";
+                first = false;
+                if (rewardModelEntry.second.hasStateRewards()) {
+                    appendValue(buffer, rewardModelEntry.second.getStateRewardVector()[group], valueStream);
+                } else {
+                    buffer += '0';
+                }
+            }
+            if (!first) {
+                buffer += ']';
+            }
+
+            // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+            for (auto const& label : model.getStateLabeling().getLabelsOfState(group)) {
+                STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                    buffer += " \"";
+                    buffer += label;
+                    buffer += '"';
+                } else {
+                    buffer += ' ';
+                    buffer += label;
+                }
+            }
+            buffer += '\n';
+            // Write state valuations as comments
+            if (model.hasStateValuations()) {
+                buffer += "//";
+                buffer += model.getStateValuations().getStateInfo(group);
+                buffer += '\n';
+            }
+
+            // Write probabilities
+            uint64_t const start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+            uint64_t const end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+            // Iterate over all actions
+            for (uint64_t row = start; row < end; ++row) {
+                // Write choice
+                buffer += "\taction ";
+                if (model.hasChoiceLabeling()) {
+                    auto const choiceLabels = model.getChoiceLabeling().getLabelsOfChoice(row);
+                    if (choiceLabels.empty()) {
+                        buffer += "__NOLABEL__";
+                    }
+                    for (auto const& label : choiceLabels) {
+                        buffer += label;
+                    }
+                } else {
+                    appendNumber(buffer, row - start);
+                }
+
+                // Write action rewards
+                bool first = true;
+                for (auto const& rewardModelEntry : model.getRewardModels()) {
+                    buffer += first ? " [" : ", ";
+                    first = false;
+                    if (rewardModelEntry.second.hasStateActionRewards()) {
+                        appendValue(buffer, rewardModelEntry.second.getStateActionRewardVector()[row], valueStream);
+                    } else {
+                        buffer += '0';
+                    }
+                }
+                if (!first) {
+                    buffer += ']';
+                }
+                buffer += '\n';
+
+                // Write transitions
+                for (auto const& entry : matrix.getRow(row)) {
+                    buffer += "\t\t";
+                    appendNumber(buffer, entry.getColumn());
+                    buffer += " : ";
+                    appendValue(buffer, entry.getValue(), valueStream);
+                    buffer += '\n';
+                }
+            }
+        }
+    }
+
+   private:
+    static void appendNumber(std::string& buffer, uint64_t number) {
+        char chars[24];
+        auto result = std::to_chars(chars, chars + sizeof(chars), number);
+        buffer.append(chars, result.ptr);
+    }
+
+    void appendValue(std::string& buffer, ValueType const& value, std::ostringstream& valueStream) const {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (doubleFormat) {
+                char chars[64];
+                auto result = std::to_chars(chars, chars + sizeof(chars), value, *doubleFormat, precision);
+                // Very long outputs (e.g. large values in fixed notation) are written using the stream
+                if (result.ec == std::errc()) {
+                    buffer.append(chars, result.ptr);
+                    return;
+                }
+            }
+        }
+        valueStream.str("");
+        writeValue(valueStream, value, placeholders);
+        buffer += valueStream.str();
+    }
+
+    storm::models::sparse::Model<ValueType> const& model;
+    std::vector<ValueType> const& exitRates;
+    std::unordered_map<ValueType, std::string> const& placeholders;
+    std::vector<uint32_t> const* observations = nullptr;
+    std::streamsize const precision;
+    std::ios_base::fmtflags const flags;
+    // The format for doubles or nothing if doubles can not be formatted with std::to_chars (e.g. hexfloat output)
+    std::optional<std::chars_format> doubleFormat;
+};
+
+}  // namespace
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -68,114 +257,261 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
     os << "@model\n";
 
+    // The states are formatted in chunks (possibly concurrently) and then written in order.
+    DrnStateFormatter<ValueType> formatter(*sparseModel, exitRates, placeholders, os);
     storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-
-    // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
+    std::vector<uint64_t> chunkBegins{0};
+    uint64_t chunkSize = 0;
+    for (uint64_t group = 0; group < numberOfStates; ++group) {
+        uint64_t const rowBegin = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+        uint64_t const rowEnd = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+        chunkSize += (rowEnd - rowBegin) + std::distance(matrix.begin(rowBegin), matrix.end(rowEnd - 1));
+        if (chunkSize >= detail::drnChunkSize) {
+            chunkBegins.push_back(group + 1);
+            chunkSize = 0;
         }
+    }
+    if (chunkBegins.back() != numberOfStates) {
+        chunkBegins.push_back(numberOfStates);
+    }
+    uint64_t const numberOfChunks = chunkBegins.size() - 1;
 
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
+    // Formatting with other value types might not be thread-safe, e.g., due to caches of the underlying libraries.
+    bool parallel = false;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    }
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!parallel, "Storm was built without support for Intel TBB, defaulting to sequential export of the model.");
+    parallel = false;
+#endif
+    // We only keep a limited number of formatted chunks in memory.
+    uint64_t const batchSize = parallel ? detail::drnChunksPerThread * storm::utility::getNumberOfThreads() : 1;
+    std::vector<std::string> buffers(std::min(batchSize, numberOfChunks));
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(numberOfStates);
+    progress.startNewMeasurement(0);
+    for (uint64_t batchBegin = 0; batchBegin < numberOfChunks; batchBegin += batchSize) {
+        uint64_t const batchEnd = std::min(batchBegin + batchSize, numberOfChunks);
+        auto formatChunk = [&](uint64_t chunk) {
+            auto& buffer = buffers[chunk - batchBegin];
+            buffer.clear();
+            formatter.formatStates(chunkBegins[chunk], chunkBegins[chunk + 1], buffer);
+        };
+        if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(batchBegin, batchEnd, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk < range.end(); ++chunk) {
+                    formatChunk(chunk);
+                }
+            });
+#endif
+        } else {
+            for (uint64_t chunk = batchBegin; chunk < batchEnd; ++chunk) {
+                formatChunk(chunk);
+            }
         }
+        for (uint64_t chunk = batchBegin; chunk < batchEnd; ++chunk) {
+            auto const& buffer = buffers[chunk - batchBegin];
+            os.write(buffer.data(), buffer.size());
+        }
+        progress.updateProgress(chunkBegins[batchEnd]);
+    }
+}
 
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
-            }
+namespace {
+
+void writeWord(std::ostream& os, uint64_t word) {
+    os.write(reinterpret_cast<char const*>(&word), sizeof(uint64_t));
+}
+
+void writeSectionHeader(std::ostream& os, drb::SectionType type, uint64_t size) {
+    writeWord(os, static_cast<uint64_t>(type));
+    writeWord(os, size);
+}
+
+template<typename T>
+void writeArray(std::ostream& os, T const* data, uint64_t count) {
+    static const char padding[8] = {};
+    uint64_t numberOfBytes = count * sizeof(T);
+    os.write(reinterpret_cast<char const*>(data), numberOfBytes);
+    os.write(padding, drb::paddedSize(numberOfBytes) - numberOfBytes);
+}
+
+void writeString(std::ostream& os, std::string const& str) {
+    writeWord(os, str.size());
+    writeArray(os, str.data(), str.size());
+}
 
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
+void writeBitVector(std::ostream& os, storm::storage::BitVector const& bitVector) {
+    for (uint64_t index = 0; index < bitVector.size(); index += 64) {
+        writeWord(os, bitVector.getAsInt(index, std::min<uint64_t>(64, bitVector.size() - index)));
+    }
+}
+
+void writeStateValuations(std::ostream& os, storm::storage::sparse::StateValuations const& valuations, uint64_t numberOfStates) {
+    // Collect the variables (in the order in which they are iterated for each state).
+    std::vector<std::pair<drb::VariableTypeCode, std::string>> variables;
+    if (numberOfStates > 0) {
+        for (auto valIt = valuations.at(0).begin(); valIt != valuations.at(0).end(); ++valIt) {
+            if (!valIt.isVariableAssignment() || valIt.isRational()) {
+                STORM_LOG_WARN("State valuations with rational variables or observation labels are not supported in the drb format and are not exported.");
+                return;
             }
+            variables.emplace_back(valIt.isBoolean() ? drb::VariableTypeCode::Boolean : drb::VariableTypeCode::Integer, valIt.getName());
         }
+    }
 
-        if (!first) {
-            os << "]";
+    uint64_t size = 8 + variables.size() * 8 + numberOfStates * variables.size() * 8;
+    for (auto const& variable : variables) {
+        size += drb::stringSize(variable.second.size());
+    }
+    writeSectionHeader(os, drb::SectionType::StateValuations, size);
+    writeWord(os, variables.size());
+    for (auto const& variable : variables) {
+        writeWord(os, static_cast<uint64_t>(variable.first));
+        writeString(os, variable.second);
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto valIt = valuations.at(state).begin(); valIt != valuations.at(state).end(); ++valIt) {
+            writeWord(os, valIt.isBoolean() ? static_cast<uint64_t>(valIt.getBooleanValue()) : static_cast<uint64_t>(valIt.getIntegerValue()));
         }
+    }
+}
 
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
-            }
+}  // namespace
+
+template<typename ValueType>
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The drb format only supports models with double values.");
+    } else {
+        drb::ModelTypeCode modelType;
+        switch (sparseModel->getType()) {
+            case storm::models::ModelType::Dtmc:
+                modelType = drb::ModelTypeCode::Dtmc;
+                break;
+            case storm::models::ModelType::Ctmc:
+                modelType = drb::ModelTypeCode::Ctmc;
+                break;
+            case storm::models::ModelType::Mdp:
+                modelType = drb::ModelTypeCode::Mdp;
+                break;
+            case storm::models::ModelType::MarkovAutomaton:
+                modelType = drb::ModelTypeCode::MarkovAutomaton;
+                break;
+            case storm::models::ModelType::Pomdp:
+                modelType = drb::ModelTypeCode::Pomdp;
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                                "Models of type " << sparseModel->getType() << " can not be exported in the drb format.");
         }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+
+        storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
+        uint64_t const numberOfStates = sparseModel->getNumberOfStates();
+        uint64_t const numberOfChoices = matrix.getRowCount();
+        uint64_t const numberOfEntries = matrix.getEntryCount();
+
+        // Write header
+        drb::Header header;
+        std::copy(std::begin(drb::Magic), std::end(drb::Magic), header.magic);
+        header.version = drb::Version;
+        header.byteOrderMarker = drb::ByteOrderMarker;
+        header.valueType = static_cast<uint64_t>(drb::ValueTypeCode::Double);
+        header.modelType = static_cast<uint64_t>(modelType);
+        header.numberOfStates = numberOfStates;
+        header.numberOfChoices = numberOfChoices;
+        header.numberOfEntries = numberOfEntries;
+        os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+        // Write the transition matrix in CSR form
+        writeSectionHeader(os, drb::SectionType::RowIndications, (numberOfChoices + 1) * sizeof(uint64_t));
+        for (uint64_t row = 0; row < numberOfChoices; ++row) {
+            writeWord(os, std::distance(matrix.begin(), matrix.begin(row)));
+        }
+        writeWord(os, numberOfEntries);
+        writeSectionHeader(os, drb::SectionType::Columns, numberOfEntries * sizeof(uint64_t));
+        for (auto const& entry : matrix) {
+            writeWord(os, entry.getColumn());
+        }
+        writeSectionHeader(os, drb::SectionType::Values, numberOfEntries * sizeof(ValueType));
+        for (auto const& entry : matrix) {
+            writeArray(os, &entry.getValue(), 1);
         }
 
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
-                    }
-                    os << label;
-                }
-            } else {
-                os << "\taction " << row - start;
+        if (sparseModel->isNondeterministicModel()) {
+            writeSectionHeader(os, drb::SectionType::RowGroupIndices, (numberOfStates + 1) * sizeof(uint64_t));
+            for (uint64_t group = 0; group <= numberOfStates; ++group) {
+                writeWord(os, matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group]);
             }
+        }
 
-            // Write action rewards
-            bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                if (first) {
-                    os << " [";
-                    first = false;
-                } else {
-                    os << ", ";
-                }
+        // Write labelings
+        for (auto const& label : sparseModel->getStateLabeling().getLabels()) {
+            writeSectionHeader(os, drb::SectionType::StateLabel, drb::stringSize(label.size()) + drb::bitVectorSize(numberOfStates));
+            writeString(os, label);
+            writeBitVector(os, sparseModel->getStateLabeling().getStates(label));
+        }
+        if (sparseModel->hasChoiceLabeling()) {
+            for (auto const& label : sparseModel->getChoiceLabeling().getLabels()) {
+                writeSectionHeader(os, drb::SectionType::ChoiceLabel, drb::stringSize(label.size()) + drb::bitVectorSize(numberOfChoices));
+                writeString(os, label);
+                writeBitVector(os, sparseModel->getChoiceLabeling().getChoices(label));
+            }
+        }
 
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                } else {
-                    os << "0";
-                }
+        // Write reward models
+        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
+            auto const& rewardModel = rewardModelEntry.second;
+            STORM_LOG_WARN_COND(!rewardModel.hasTransitionRewards(), "Transition rewards of reward model '"
+                                                                          << rewardModelEntry.first << "' are not supported in the drb format and are not exported.");
+            uint64_t flags = 0;
+            uint64_t size = drb::stringSize(rewardModelEntry.first.size()) + 8;
+            if (rewardModel.hasStateRewards()) {
+                flags |= drb::HasStateRewards;
+                size += numberOfStates * sizeof(ValueType);
             }
-            if (!first) {
-                os << "]";
+            if (rewardModel.hasStateActionRewards()) {
+                flags |= drb::HasStateActionRewards;
+                size += numberOfChoices * sizeof(ValueType);
+            }
+            writeSectionHeader(os, drb::SectionType::RewardModel, size);
+            writeString(os, rewardModelEntry.first);
+            writeWord(os, flags);
+            if (rewardModel.hasStateRewards()) {
+                writeArray(os, rewardModel.getStateRewardVector().data(), numberOfStates);
             }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+            if (rewardModel.hasStateActionRewards()) {
+                writeArray(os, rewardModel.getStateActionRewardVector().data(), numberOfChoices);
             }
         }
-    }  // end state iteration
+
+        // Write model type specific components
+        if (modelType == drb::ModelTypeCode::Ctmc || modelType == drb::ModelTypeCode::MarkovAutomaton) {
+            std::vector<ValueType> const& exitRates = modelType == drb::ModelTypeCode::Ctmc
+                                                          ? sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector()
+                                                          : sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getExitRates();
+            writeSectionHeader(os, drb::SectionType::ExitRates, numberOfStates * sizeof(ValueType));
+            writeArray(os, exitRates.data(), numberOfStates);
+        }
+        if (modelType == drb::ModelTypeCode::MarkovAutomaton) {
+            writeSectionHeader(os, drb::SectionType::MarkovianStates, drb::bitVectorSize(numberOfStates));
+            writeBitVector(os, sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->getMarkovianStates());
+        }
+        if (modelType == drb::ModelTypeCode::Pomdp) {
+            std::vector<uint32_t> const& observations = sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservations();
+            writeSectionHeader(os, drb::SectionType::Observations, drb::paddedSize(numberOfStates * sizeof(uint32_t)));
+            writeArray(os, observations.data(), numberOfStates);
+        }
+
+        if (sparseModel->hasStateValuations()) {
+            writeStateValuations(os, sparseModel->getStateValuations(), numberOfStates);
+        }
+
+        writeSectionHeader(os, drb::SectionType::End, 0);
+    }
 }
 
 template<typename ValueType>
@@ -281,5 +617,13 @@ template void explicitExportSparseModel<storm::RationalFunction>(std::ostream& o
                                                                  std::vector<std::string> const& parameters, DirectEncodingOptions const& options);
 template void explicitExportSparseModel<storm::Interval>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::Interval>> sparseModel,
                                                          std::vector<std::string> const& parameters, DirectEncodingOptions const& options);
+
+template void explicitExportSparseModelBinary<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+template void explicitExportSparseModelBinary<storm::RationalNumber>(std::ostream& os,
+                                                                     std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel);
+template void explicitExportSparseModelBinary<storm::RationalFunction>(std::ostream& os,
+                                                                       std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel);
+template void explicitExportSparseModelBinary<storm::Interval>(std::ostream& os,
+                                                               std::shared_ptr<storm::models::sparse::Model<storm::Interval>> sparseModel);
 }  // namespace exporter
 }  // namespace storm
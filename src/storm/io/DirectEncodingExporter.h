@@ -22,6 +22,16 @@ template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options = DirectEncodingOptions());
 
+/*!
+ * Exports a sparse model into the binary drb format (see DirectEncodingBinaryFormat.h).
+ * The stream has to be opened in binary mode. Only models with double values are supported.
+ *
+ * @param os           Stream to export to
+ * @param sparseModel  Model to export
+ */
+template<typename ValueType>
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
 /*!
  * Accumulate parameters in the model.
  *
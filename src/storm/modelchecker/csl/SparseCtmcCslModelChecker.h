@@ -50,6 +50,14 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
     virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env,
                                                              CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Computes the probabilities of the given bounded until formula for several time bounds at once, i.e., the upper time bound of the formula is
+     * replaced by each of the given (ascendingly sorted) time bounds. The formula must not have a lower time bound.
+     */
+    std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                  CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask,
+                                                                  std::vector<double> const& upperBounds);
+
     /*!
      * Compute transient probabilities for all states.
      */
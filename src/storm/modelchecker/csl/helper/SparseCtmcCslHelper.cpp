@@ -1,4 +1,8 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcTransientHelper.h"
+
+#include <algorithm>
+#include <limits>
 
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
@@ -22,6 +26,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -274,6 +279,103 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, bool, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds must be sorted in ascending order.");
+    STORM_LOG_THROW(upperBounds.empty() || upperBounds.front() >= 0.0, storm::exceptions::InvalidArgumentException, "The time bounds must be non-negative.");
+    STORM_LOG_THROW(upperBounds.empty() || upperBounds.back() != storm::utility::infinity<double>(), storm::exceptions::InvalidArgumentException,
+                    "The time bounds must be finite.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<std::vector<ValueType>> results;
+    if (upperBounds.empty()) {
+        return results;
+    }
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0.getNumberOfSetBits() << " states with probability greater 0.");
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // The uniformized matrix and the compensation vector do not depend on the time bound, so we only compute them once.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+    std::vector<ValueType> b;
+    ValueType uniformizationRate = 0;
+    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+        for (auto state : statesWithProbabilityGreater0NonPsi) {
+            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+        for (auto& element : b) {
+            element /= uniformizationRate;
+        }
+    }
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& upperBound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+    }
+
+    bool recompute;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        results.assign(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+        for (auto& result : results) {
+            storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+        }
+        if (!statesWithProbabilityGreater0NonPsi.empty()) {
+            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+            std::vector<std::vector<ValueType>> subresults =
+                computeTransientProbabilities(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, std::move(values), epsilon);
+            for (uint64_t boundIndex = 0; boundIndex < results.size(); ++boundIndex) {
+                storm::utility::vector::setVectorValues(results[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+            }
+        }
+
+        // The precision check can only decrease epsilon, so we check the results for all bounds before recomputing.
+        recompute = false;
+        for (auto const& result : results) {
+            recompute |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues);
+        }
+    } while (recompute);
+    return results;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const&, storm::solver::SolveGoal<ValueType>&&,
+                                                                                          storm::storage::SparseMatrix<ValueType> const&,
+                                                                                          storm::storage::SparseMatrix<ValueType> const&,
+                                                                                          storm::storage::BitVector const&, storm::storage::BitVector const&,
+                                                                                          std::vector<ValueType> const&, bool, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -664,6 +766,18 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
+    auto const method = env.solver().timeBounded().getCtmcMethod();
+    if constexpr (std::is_same_v<ValueType, double> && !useMixedPoissonProbabilities) {
+        if (method == storm::solver::CtmcTransientMethod::AdaptiveUniformization) {
+            return SparseCtmcTransientHelper::computeAdaptiveUniformization(uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon);
+        } else if (method == storm::solver::CtmcTransientMethod::Krylov) {
+            return SparseCtmcTransientHelper::computeKrylov(uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon);
+        }
+    } else {
+        STORM_LOG_WARN_COND(method == storm::solver::CtmcTransientMethod::Uniformization,
+                            "The selected method for transient probabilities is not supported for this computation. Falling back to uniformization.");
+    }
+
     // Use Fox-Glynn to get the truncation points and the weights.
     storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
@@ -754,6 +868,99 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                       storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                       std::vector<ValueType> const* addVector,
+                                                                                       std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                       std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_THROW(std::is_sorted(timeBounds.begin(), timeBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds must be sorted in ascending order.");
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    if (env.solver().timeBounded().getCtmcMethod() != storm::solver::CtmcTransientMethod::Uniformization) {
+        // The alternative methods do not share iterations between the time bounds. As the underlying system is time-homogeneous, we can still
+        // proceed from one time bound to the next one.
+        std::vector<std::vector<ValueType>> result;
+        result.reserve(timeBounds.size());
+        ValueType previousTimeBound = storm::utility::zero<ValueType>();
+        for (auto const& timeBound : timeBounds) {
+            values = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, addVector, timeBound - previousTimeBound, uniformizationRate, values,
+                                                              epsilon / storm::utility::convertNumber<ValueType>(timeBounds.size()));
+            result.push_back(values);
+            previousTimeBound = timeBound;
+        }
+        return result;
+    }
+
+    // Use Fox-Glynn to get the truncation points and the weights for each of the time bounds.
+    // If no time can pass, the current values are the result, which we obtain by using the single weight one for the first iteration.
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+    uint_fast64_t minLeft = std::numeric_limits<uint_fast64_t>::max();
+    uint_fast64_t maxRight = 0;
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+        auto& foxGlynnResult = foxGlynnResults[boundIndex];
+        if (storm::utility::isZero(lambda)) {
+            foxGlynnResult.weights.push_back(storm::utility::one<ValueType>());
+            foxGlynnResult.totalWeight = storm::utility::one<ValueType>();
+        } else {
+            foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+            STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResult.left
+                                                                      << ", right=" << foxGlynnResult.right);
+        }
+        minLeft = std::min(minLeft, foxGlynnResult.left);
+        maxRight = std::max(maxRight, foxGlynnResult.right);
+    }
+
+    STORM_LOG_DEBUG("Starting " << maxRight << " iterations for " << timeBounds.size() << " time bounds with " << uniformizedMatrix.getRowCount() << " x "
+                                << uniformizedMatrix.getColumnCount() << " matrix.");
+
+    // Initialize the results. The iteration for index 0 only contributes to those time bounds whose left truncation point is zero.
+    std::vector<std::vector<ValueType>> results(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        if (foxGlynnResults[boundIndex].left == 0) {
+            results[boundIndex] = values;
+            storm::utility::vector::scaleVectorInPlace(results[boundIndex], foxGlynnResults[boundIndex].weights.front());
+        }
+    }
+
+    if (maxRight > 0) {
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+        uint_fast64_t startingIteration = 1;
+        if (minLeft > 1) {
+            // Perform the matrix-vector multiplications (without adding) that lie below all left truncation points.
+            multiplier->repeatedMultiply(env, values, addVector, minLeft - 1);
+            startingIteration = minLeft;
+        }
+
+        // For each index, perform the matrix-vector multiplication once and add the scaled result to all time bounds whose truncation points
+        // enclose the index.
+        ValueType weight = 0;
+        std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) {
+            return a + weight * b;
+        };
+        for (uint_fast64_t index = startingIteration; index <= maxRight; ++index) {
+            multiplier->multiply(env, values, addVector, values);
+            for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                if (foxGlynnResult.left <= index && index <= foxGlynnResult.right) {
+                    weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                    storm::utility::vector::applyPointwise(results[boundIndex], values, results[boundIndex], addAndScale);
+                }
+            }
+        }
+    }
+
+    // Finally, divide the results by the total weights
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(results[boundIndex],
+                                                                         storm::utility::one<ValueType>() / foxGlynnResults[boundIndex].totalWeight);
+    }
+    return results;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -789,6 +996,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -851,6 +1063,12 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                             storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                                             std::vector<double> const* addVector,
+                                                                                             std::vector<double> const& timeBounds, double uniformizationRate,
+                                                                                             std::vector<double> values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -860,6 +1078,15 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, std::vector<double> const& upperBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative,
+    std::vector<double> const& upperBounds);
 
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
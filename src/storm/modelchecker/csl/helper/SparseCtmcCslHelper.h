@@ -39,6 +39,31 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the bounded until probabilities for several time intervals of the form [0, t] at once.
+     * All time bounds are handled by a single sequence of matrix-vector multiplications on the uniformized matrix.
+     *
+     * @param upperBounds The (ascendingly sorted) upper time bounds.
+     * @return For each upper time bound, the vector of bounded until probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, bool qualitative,
+                                                                                std::vector<double> const& upperBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates, bool qualitative,
+                                                                                std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -143,6 +168,26 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds at once.
+     * The Fox-Glynn weighted sums for all time bounds are accumulated during a single sequence of matrix-vector multiplications
+     * whose length is given by the largest right truncation point.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The (ascendingly sorted) time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilities(Environment const& env,
+                                                                             storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                             std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+                                                                             ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -0,0 +1,396 @@
+#include "storm/modelchecker/csl/helper/SparseCtmcTransientHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/math/constants/constants.hpp>
+
+#include "storm/adapters/eigen.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+
+#include "storm/exceptions/PrecisionExceededException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+namespace {
+/*!
+ * Retrieves for each state the probability to leave it in one step of the uniformized chain, i.e., its exit rate divided by the uniformization rate.
+ */
+std::vector<double> getExitProbabilities(storm::storage::SparseMatrix<double> const& uniformizedMatrix) {
+    std::vector<double> result(uniformizedMatrix.getRowCount(), 1.0);
+    for (uint64_t state = 0; state < uniformizedMatrix.getRowCount(); ++state) {
+        for (auto const& entry : uniformizedMatrix.getRow(state)) {
+            if (entry.getColumn() == state) {
+                result[state] = std::max(0.0, 1.0 - entry.getValue());
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * Computes result = (P - I) x + b * x[n], where P is the uniformized matrix and b the add vector (if present), in which case x has one additional
+ * entry at position n. Subtracting the identity explicitly (instead of using the diagonal of P) retains the precision of slow exit rates.
+ */
+void multiplyWithUniformizedGenerator(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const& exitProbabilities,
+                                      std::vector<double> const* addVector, std::vector<double> const& x, std::vector<double>& result) {
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        double value = -exitProbabilities[state] * x[state];
+        for (auto const& entry : uniformizedMatrix.getRow(state)) {
+            if (entry.getColumn() != state) {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+        }
+        if (addVector) {
+            value += (*addVector)[state] * x[numberOfStates];
+        }
+        result[state] = value;
+    }
+    if (addVector) {
+        result[numberOfStates] = 0.0;
+    }
+}
+
+/*!
+ * Computes the exponential of a small dense matrix with the scaling and squaring method using a Pade approximant of degree 13 (Higham, 2005).
+ */
+StormEigen::MatrixXd computeMatrixExponential(StormEigen::MatrixXd const& matrix) {
+    static double const coefficients[] = {64764752532480000.0, 32382376266240000.0, 7771770303897600.0, 1187353796428800.0, 129060195264000.0,
+                                          10559470521600.0,    670442572800.0,      33522128640.0,     1323241920.0,      40840800.0,
+                                          960960.0,            16380.0,             182.0,             1.0};
+    // Up to this norm, the approximant is accurate in double precision.
+    double const maximalNorm = 5.371920351148152;
+    double const norm = matrix.cwiseAbs().colwise().sum().maxCoeff();
+    int const squarings = norm > maximalNorm ? static_cast<int>(std::ceil(std::log2(norm / maximalNorm))) : 0;
+    StormEigen::MatrixXd const identity = StormEigen::MatrixXd::Identity(matrix.rows(), matrix.cols());
+    StormEigen::MatrixXd const a1 = matrix / std::ldexp(1.0, squarings);
+    StormEigen::MatrixXd const a2 = a1 * a1;
+    StormEigen::MatrixXd const a4 = a2 * a2;
+    StormEigen::MatrixXd const a6 = a4 * a2;
+    StormEigen::MatrixXd const odd =
+        a1 * (a6 * (coefficients[13] * a6 + coefficients[11] * a4 + coefficients[9] * a2) + coefficients[7] * a6 + coefficients[5] * a4 +
+              coefficients[3] * a2 + coefficients[1] * identity);
+    StormEigen::MatrixXd const even = a6 * (coefficients[12] * a6 + coefficients[10] * a4 + coefficients[8] * a2) + coefficients[6] * a6 +
+                                      coefficients[4] * a4 + coefficients[2] * a2 + coefficients[0] * identity;
+    StormEigen::MatrixXd result = (even - odd).partialPivLu().solve(even + odd);
+    for (int squaring = 0; squaring < squarings; ++squaring) {
+        result = result * result;
+    }
+    return result;
+}
+
+/*!
+ * Rounds the given step size to two significant digits (as done by Expokit).
+ */
+double roundStepSize(double stepSize) {
+    double const scale = std::pow(10.0, std::floor(std::log10(stepSize)) - 1.0);
+    return std::ceil(stepSize / scale) * scale;
+}
+}  // namespace
+
+std::vector<double> SparseCtmcTransientHelper::computeAdaptiveUniformization(storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                             std::vector<double> const* addVector, double timeBound,
+                                                                             double uniformizationRate, std::vector<double> const& values, double epsilon) {
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    std::vector<double> const exitProbabilities = getExitProbabilities(uniformizedMatrix);
+
+    // Determine the step in which each state first becomes relevant, i.e., may get a non-zero value. The states are ordered accordingly.
+    uint64_t const irrelevant = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> firstStep(numberOfStates, irrelevant);
+    std::vector<uint64_t> orderedStates;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (values[state] != 0.0) {
+            firstStep[state] = 0;
+            orderedStates.push_back(state);
+        }
+    }
+    if (addVector) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if ((*addVector)[state] != 0.0 && firstStep[state] == irrelevant) {
+                firstStep[state] = 1;
+                orderedStates.push_back(state);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> const predecessors = uniformizedMatrix.transpose();
+    for (uint64_t index = 0; index < orderedStates.size(); ++index) {
+        uint64_t const state = orderedStates[index];
+        for (auto const& entry : predecessors.getRow(state)) {
+            if (entry.getValue() != 0.0 && firstStep[entry.getColumn()] == irrelevant) {
+                firstStep[entry.getColumn()] = firstStep[state] + 1;
+                orderedStates.push_back(entry.getColumn());
+            }
+        }
+    }
+    if (orderedStates.empty()) {
+        return values;
+    }
+
+    // In step k, all states that are relevant in step k+1 get a (possibly) non-zero update. The rate for step k is the maximal exit rate among these
+    // states, which keeps all values non-negative and bounded. For each step, we also store the number of states that need to be updated.
+    uint64_t const lastFirstStep = firstStep[orderedStates.back()];
+    std::vector<double> stepRates(lastFirstStep + 1, 0.0);
+    std::vector<uint64_t> numberOfUpdatedStates(lastFirstStep + 1, 0);
+    double maximalExitProbability = 0.0;
+    uint64_t index = 0;
+    for (uint64_t step = 0; step <= lastFirstStep; ++step) {
+        for (; index < orderedStates.size() && firstStep[orderedStates[index]] <= step + 1; ++index) {
+            maximalExitProbability = std::max(maximalExitProbability, exitProbabilities[orderedStates[index]]);
+        }
+        stepRates[step] = maximalExitProbability * uniformizationRate * 1.02;
+        numberOfUpdatedStates[step] = index;
+    }
+    double const finalRate = stepRates.back();
+    if (finalRate == 0.0) {
+        // No relevant state has a transition, so nothing changes over time.
+        return values;
+    }
+    auto getStepRate = [&stepRates](uint64_t step) { return stepRates[std::min<uint64_t>(step, stepRates.size() - 1)]; };
+
+    // The weight of step k is the probability that a pure birth process with rates stepRates is in phase k at the time bound. We uniformize this
+    // process with the final rate. Phases with the final rate are left in each uniformization step, so it suffices to track the distribution over
+    // the first phases and the probability of reaching the first phase with the final rate in each uniformization step.
+    storm::utility::numerical::FoxGlynnResult<double> foxGlynnResult = storm::utility::numerical::foxGlynn(finalRate * timeBound, epsilon / 2.0);
+    auto getPoissonProbability = [&foxGlynnResult](uint64_t iteration) {
+        if (iteration < foxGlynnResult.left || iteration > foxGlynnResult.right) {
+            return 0.0;
+        }
+        return foxGlynnResult.weights[iteration - foxGlynnResult.left] / foxGlynnResult.totalWeight;
+    };
+    uint64_t const numberOfSlowPhases = std::find(stepRates.begin(), stepRates.end(), finalRate) - stepRates.begin();
+    std::vector<double> weights(numberOfSlowPhases, 0.0);
+    std::vector<double> slowPhaseDistribution(numberOfSlowPhases, 0.0), nextSlowPhaseDistribution(numberOfSlowPhases, 0.0);
+    std::vector<double> entryProbabilities(1, numberOfSlowPhases == 0 ? 1.0 : 0.0);
+    if (numberOfSlowPhases > 0) {
+        slowPhaseDistribution[0] = 1.0;
+        for (uint64_t iteration = 0; iteration <= foxGlynnResult.right; ++iteration) {
+            double const poissonProbability = getPoissonProbability(iteration);
+            double remainingMass = 0.0;
+            for (uint64_t phase = 0; phase < numberOfSlowPhases; ++phase) {
+                weights[phase] += poissonProbability * slowPhaseDistribution[phase];
+                remainingMass += slowPhaseDistribution[phase];
+                double const leaveProbability = stepRates[phase] / finalRate;
+                nextSlowPhaseDistribution[phase] = slowPhaseDistribution[phase] * (1.0 - leaveProbability);
+                if (phase > 0) {
+                    nextSlowPhaseDistribution[phase] += slowPhaseDistribution[phase - 1] * stepRates[phase - 1] / finalRate;
+                }
+            }
+            entryProbabilities.push_back(slowPhaseDistribution.back() * stepRates[numberOfSlowPhases - 1] / finalRate);
+            slowPhaseDistribution.swap(nextSlowPhaseDistribution);
+            if (remainingMass < epsilon * 1e-3) {
+                break;
+            }
+        }
+    }
+    // Ignore the iterations in which the fast phases are entered with negligible probability.
+    uint64_t firstEntry = 0, lastEntry = entryProbabilities.size();
+    double neglectedMass = 0.0;
+    while (firstEntry < lastEntry && neglectedMass + entryProbabilities[firstEntry] < epsilon / 8.0) {
+        neglectedMass += entryProbabilities[firstEntry++];
+    }
+    while (lastEntry > firstEntry && neglectedMass + entryProbabilities[lastEntry - 1] < epsilon / 4.0) {
+        neglectedMass += entryProbabilities[--lastEntry];
+    }
+    for (uint64_t offset = 0; firstEntry < lastEntry && firstEntry + offset <= foxGlynnResult.right; ++offset) {
+        double weight = 0.0;
+        for (uint64_t entryIteration = firstEntry; entryIteration < lastEntry; ++entryIteration) {
+            weight += entryProbabilities[entryIteration] * getPoissonProbability(entryIteration + offset);
+        }
+        weights.push_back(weight);
+    }
+    while (!weights.empty() && weights.back() == 0.0) {
+        weights.pop_back();
+    }
+    STORM_LOG_INFO("Adaptive uniformization requires " << weights.size() << " iterations (standard uniformization with rate " << uniformizationRate
+                                                        << " requires about " << static_cast<uint64_t>(uniformizationRate * timeBound) << ").");
+
+    // Finally, perform the iterations. Only the states that are relevant in the next step are updated, all other states have value zero.
+    std::vector<double> currentValues = values, nextValues = values;
+    std::vector<double> result(numberOfStates, 0.0);
+    for (uint64_t step = 0; step < weights.size(); ++step) {
+        uint64_t const updatedStates = numberOfUpdatedStates[std::min<uint64_t>(step, numberOfUpdatedStates.size() - 1)];
+        if (weights[step] != 0.0) {
+            for (uint64_t orderIndex = 0; orderIndex < updatedStates; ++orderIndex) {
+                uint64_t const state = orderedStates[orderIndex];
+                result[state] += weights[step] * currentValues[state];
+            }
+        }
+        if (step + 1 == weights.size()) {
+            break;
+        }
+        double const factor = uniformizationRate / getStepRate(step);
+        for (uint64_t orderIndex = 0; orderIndex < updatedStates; ++orderIndex) {
+            uint64_t const state = orderedStates[orderIndex];
+            double change = addVector ? (*addVector)[state] : 0.0;
+            change -= exitProbabilities[state] * currentValues[state];
+            for (auto const& entry : uniformizedMatrix.getRow(state)) {
+                if (entry.getColumn() != state) {
+                    change += entry.getValue() * currentValues[entry.getColumn()];
+                }
+            }
+            nextValues[state] = currentValues[state] + factor * change;
+        }
+        // The states that have not been updated agree in both vectors and the updated ones are updated again in the next step.
+        currentValues.swap(nextValues);
+    }
+    return result;
+}
+
+std::vector<double> SparseCtmcTransientHelper::computeKrylov(storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                             std::vector<double> const* addVector, double timeBound, double uniformizationRate,
+                                                             std::vector<double> const& values, double epsilon) {
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    uint64_t const dimension = addVector ? numberOfStates + 1 : numberOfStates;
+    std::vector<double> const exitProbabilities = getExitProbabilities(uniformizedMatrix);
+
+    // The parameters of Expokit's expv routine.
+    uint64_t const maximalSubspaceDimension = std::min<uint64_t>(dimension, 30);
+    uint64_t const maximalRejections = 10;
+    double const gamma = 0.9;
+    double const delta = 1.2;
+
+    // The system is x' = uniformizationRate * G x, where G is the (extended) uniformized generator. We scale time instead of the matrix.
+    double const endTime = timeBound * uniformizationRate;
+    // Expokit bounds the local error per unit of time, so we distribute the tolerated error over the time horizon.
+    double const tolerance = epsilon / (delta * endTime);
+    double norm = 0.0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        double rowSum = exitProbabilities[state] + (addVector ? std::abs((*addVector)[state]) : 0.0);
+        for (auto const& entry : uniformizedMatrix.getRow(state)) {
+            if (entry.getColumn() != state) {
+                rowSum += std::abs(entry.getValue());
+            }
+        }
+        norm = std::max(norm, rowSum);
+    }
+
+    std::vector<double> current = values;
+    if (addVector) {
+        current.push_back(1.0);
+    }
+    auto euclideanNorm = [](std::vector<double> const& vector) {
+        double sum = 0.0;
+        for (auto const& value : vector) {
+            sum += value * value;
+        }
+        return std::sqrt(sum);
+    };
+    double beta = euclideanNorm(current);
+    if (norm == 0.0 || beta == 0.0) {
+        return values;
+    }
+
+    uint64_t const m = maximalSubspaceDimension;
+    double const roundOff = norm * std::numeric_limits<double>::epsilon();
+    double const factor = std::pow((m + 1) / std::exp(1.0), m + 1) * boost::math::constants::root_two_pi<double>() * std::sqrt(m + 1.0);
+    double exponent = 1.0 / m;
+    double nextStepSize = roundStepSize((1.0 / norm) * std::pow((factor * tolerance) / (4.0 * beta * norm), exponent));
+    double currentTime = 0.0;
+    uint64_t numberOfSteps = 0;
+
+    std::vector<std::vector<double>> basis(m + 1, std::vector<double>(dimension));
+    std::vector<double> product(dimension);
+    while (currentTime < endTime) {
+        ++numberOfSteps;
+        double stepSize = std::min(endTime - currentTime, nextStepSize);
+
+        // Arnoldi process with modified Gram-Schmidt orthogonalization.
+        StormEigen::MatrixXd hessenberg = StormEigen::MatrixXd::Zero(m + 2, m + 2);
+        for (uint64_t state = 0; state < dimension; ++state) {
+            basis[0][state] = current[state] / beta;
+        }
+        uint64_t usedDimension = m;
+        bool happyBreakdown = false;
+        for (uint64_t j = 0; j < m; ++j) {
+            multiplyWithUniformizedGenerator(uniformizedMatrix, exitProbabilities, addVector, basis[j], product);
+            for (uint64_t i = 0; i <= j; ++i) {
+                double projection = 0.0;
+                for (uint64_t state = 0; state < dimension; ++state) {
+                    projection += basis[i][state] * product[state];
+                }
+                hessenberg(i, j) = projection;
+                for (uint64_t state = 0; state < dimension; ++state) {
+                    product[state] -= projection * basis[i][state];
+                }
+            }
+            double const productNorm = euclideanNorm(product);
+            if (productNorm * beta <= tolerance) {
+                // The Krylov subspace is (almost) invariant, so the approximation is accurate for the remaining time.
+                happyBreakdown = true;
+                usedDimension = j + 1;
+                stepSize = endTime - currentTime;
+                break;
+            }
+            hessenberg(j + 1, j) = productNorm;
+            for (uint64_t state = 0; state < dimension; ++state) {
+                basis[j + 1][state] = product[state] / productNorm;
+            }
+        }
+        double nextBasisNorm = 0.0;
+        if (!happyBreakdown) {
+            hessenberg(m + 1, m) = 1.0;
+            multiplyWithUniformizedGenerator(uniformizedMatrix, exitProbabilities, addVector, basis[m], product);
+            nextBasisNorm = euclideanNorm(product);
+        }
+
+        // Compute the exponential of the (extended) Hessenberg matrix and estimate the local error. Reject the step if it is too large.
+        uint64_t const extendedDimension = happyBreakdown ? usedDimension : m + 2;
+        StormEigen::MatrixXd exponential;
+        double localError = 0.0;
+        for (uint64_t rejections = 0;; ++rejections) {
+            exponential = computeMatrixExponential(stepSize * hessenberg.topLeftCorner(extendedDimension, extendedDimension));
+            if (happyBreakdown) {
+                break;
+            }
+            double const phi1 = std::abs(beta * exponential(m, 0));
+            double const phi2 = std::abs(beta * exponential(m + 1, 0) * nextBasisNorm);
+            if (phi1 > 10.0 * phi2) {
+                localError = phi2;
+                exponent = 1.0 / m;
+            } else if (phi1 > phi2) {
+                localError = (phi1 * phi2) / (phi1 - phi2);
+                exponent = 1.0 / m;
+            } else {
+                localError = phi1;
+                exponent = 1.0 / (m - 1);
+            }
+            if (localError <= delta * stepSize * tolerance) {
+                break;
+            }
+            STORM_LOG_THROW(rejections < maximalRejections, storm::exceptions::PrecisionExceededException,
+                            "The Krylov method could not reach the requested precision. Consider using a larger subspace or a larger precision.");
+            stepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+        }
+
+        // Update the current vector with the linear combination of the basis vectors.
+        uint64_t const combinedVectors = happyBreakdown ? usedDimension : m + 1;
+        std::fill(current.begin(), current.end(), 0.0);
+        for (uint64_t i = 0; i < combinedVectors; ++i) {
+            double const coefficient = beta * exponential(i, 0);
+            for (uint64_t state = 0; state < dimension; ++state) {
+                current[state] += coefficient * basis[i][state];
+            }
+        }
+        beta = euclideanNorm(current);
+        currentTime += stepSize;
+        if (beta == 0.0) {
+            break;
+        }
+        localError = std::max(localError, roundOff);
+        nextStepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+    }
+    STORM_LOG_INFO("Krylov method required " << numberOfSteps << " steps (standard uniformization with rate " << uniformizationRate << " requires about "
+                                             << static_cast<uint64_t>(endTime) << " iterations).");
+
+    current.resize(numberOfStates);
+    return current;
+}
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Alternatives to standard uniformization for computing transient probabilities of CTMCs. All methods get the same input as
+ * SparseCtmcCslHelper::computeTransientProbabilities, i.e., they compute the solution of x' = uniformizationRate * ((P - I) x + b) at the given time
+ * bound, where P is the uniformized matrix, b the (optional) add vector and x(0) the given values. The generator is recovered from the uniformized
+ * matrix, so the methods can be used for forward (transposed) and backward computations alike.
+ */
+class SparseCtmcTransientHelper {
+   public:
+    /*!
+     * Computes the transient probabilities with adaptive uniformization (van Moorsel and Sanders). The values only spread along the transitions of
+     * the model, so in step k only the states that can be reached within k (backward) steps from the states with a non-zero initial value or add value
+     * are relevant. Each step is uniformized with the maximal exit rate among these states and the weights of the steps are the probabilities of the
+     * corresponding pure birth process. This avoids many iterations if the fast states only become relevant late.
+     *
+     * @param epsilon The (absolute) error that is introduced by truncating the infinite sum.
+     */
+    static std::vector<double> computeAdaptiveUniformization(storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                             std::vector<double> const* addVector, double timeBound, double uniformizationRate,
+                                                             std::vector<double> const& values, double epsilon);
+
+    /*!
+     * Computes the transient probabilities by approximating the action of the matrix exponential in Krylov subspaces with adaptive time stepping and
+     * local error control, following the expv routine of Expokit (Sidje, 1998). The add vector is treated by extending the system with one constant
+     * dimension. The number of steps does not depend on the product of the maximal rate and the time bound, which makes the method suitable for stiff
+     * models with large time bounds.
+     *
+     * @param epsilon The (absolute) error in the euclidean norm that is tolerated over the whole time horizon.
+     */
+    static std::vector<double> computeKrylov(storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+                                             double timeBound, double uniformizationRate, std::vector<double> const& values, double epsilon);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
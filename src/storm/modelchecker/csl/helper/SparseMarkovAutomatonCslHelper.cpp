@@ -1,5 +1,8 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <optional>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
@@ -10,6 +13,8 @@
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
@@ -67,22 +72,140 @@ class UnifPlusHelper {
         // Intentionally left empty
     }
 
+    /*!
+     * The structures of a bounded until query that only depend on the goal states (and not on the time bound).
+     * The Markovian transitions are uniformized with the maximal exit rate of the Markovian maybe states.
+     */
+    struct BoundedUntilData {
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        storm::storage::BitVector maybeStates;
+        storm::storage::BitVector markovianMaybeStates;
+        storm::storage::BitVector markovianStatesModMaybeStates;
+        storm::storage::BitVector probabilisticStatesModMaybeStates;
+        // The exit rates restricted to only markovian maybe states.
+        std::vector<ValueType> markovianExitRates;
+        // The uniformization rate used for the matrices below.
+        ValueType lambda;
+        // The (uniformized) probabilities to go from a Markovian state to a psi state in one step
+        std::vector<std::pair<uint64_t, ValueType>> markovianToPsiProbabilities;
+        // Uniformized transitions from Markovian maybe states to all other maybe states. Includes selfloop entries.
+        storm::storage::SparseMatrix<ValueType> markovianToMaybeTransitions;
+        // Transitions from probabilistic maybe states to probabilistic maybe states.
+        storm::storage::SparseMatrix<ValueType> probabilisticToProbabilisticTransitions;
+        // Transitions from probabilistic maybe states to Markovian maybe states.
+        storm::storage::SparseMatrix<ValueType> probabilisticToMarkovianTransitions;
+        // The probabilities to go from a probabilistic state to a psi state in one step
+        std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities;
+    };
+
+    /*!
+     * Computes the structures for the given goal that can be shared among the computations for different time bounds.
+     */
+    BoundedUntilData prepareBoundedUntilData(OptimizationDirection dir, storm::storage::BitVector const& phiStates,
+                                             storm::storage::BitVector const& psiStates) {
+        BoundedUntilData data;
+        data.phiStates = phiStates;
+        data.psiStates = psiStates;
+        // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
+
+        // Compute some important subsets of states
+        data.maybeStates = ~(getProb0States(dir, phiStates, psiStates) | psiStates);
+        data.markovianMaybeStates = markovianStates & data.maybeStates;
+        storm::storage::BitVector probabilisticMaybeStates = ~markovianStates & data.maybeStates;
+        data.markovianStatesModMaybeStates = data.markovianMaybeStates % data.maybeStates;
+        data.probabilisticStatesModMaybeStates = probabilisticMaybeStates % data.maybeStates;
+        if (data.markovianMaybeStates.empty()) {
+            // The query will be solved by solving the untimed variant instead.
+            return data;
+        }
+
+        // Get the exit rates restricted to only markovian maybe states.
+        data.markovianExitRates = storm::utility::vector::filterVector(exitRateVector, data.markovianMaybeStates);
+        // Uniformization rate
+        data.lambda = *std::max_element(data.markovianExitRates.begin(), data.markovianExitRates.end());
+
+        // Split the transitions into various part
+        data.markovianToPsiProbabilities = getSparseOneStepProbabilities(data.markovianMaybeStates, psiStates);
+        for (auto& entry : data.markovianToPsiProbabilities) {
+            entry.second *= data.markovianExitRates[entry.first] / data.lambda;
+        }
+        data.markovianToMaybeTransitions =
+            getUniformizedMarkovianTransitions(data.markovianExitRates, data.lambda, data.maybeStates, data.markovianMaybeStates);
+        data.probabilisticToProbabilisticTransitions = transitionMatrix.getSubmatrix(true, probabilisticMaybeStates, probabilisticMaybeStates, false);
+        data.probabilisticToMarkovianTransitions = transitionMatrix.getSubmatrix(true, probabilisticMaybeStates, data.markovianMaybeStates, false);
+        data.probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
+        return data;
+    }
+
     std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                             ValueType const& upperTimeBound,
                                                             boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
-        // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
+        return computeBoundedUntilProbabilities(env, dir, prepareBoundedUntilData(dir, phiStates, psiStates), upperTimeBound, relevantStates);
+    }
 
-        // Compute some important subsets of states
-        storm::storage::BitVector maybeStates = ~(getProb0States(dir, phiStates, psiStates) | psiStates);
-        storm::storage::BitVector markovianMaybeStates = markovianStates & maybeStates;
-        storm::storage::BitVector probabilisticMaybeStates = ~markovianStates & maybeStates;
-        storm::storage::BitVector markovianStatesModMaybeStates = markovianMaybeStates % maybeStates;
-        storm::storage::BitVector probabilisticStatesModMaybeStates = probabilisticMaybeStates % maybeStates;
+    /*!
+     * Computes the bounded until probabilities for multiple goal state sets and multiple time bounds.
+     * The structures that only depend on the goal states are computed once per goal state set. If TBB is enabled and the value type is thread-safe,
+     * the different queries are processed concurrently.
+     * @return the result for the i-th goal state set and the j-th time bound at position i * upperTimeBounds.size() + j
+     */
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
+                                                                         storm::storage::BitVector const& phiStates,
+                                                                         std::vector<storm::storage::BitVector> const& psiStates,
+                                                                         std::vector<ValueType> const& upperTimeBounds,
+                                                                         boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        std::vector<BoundedUntilData> data;
+        data.reserve(psiStates.size());
+        for (auto const& goal : psiStates) {
+            data.push_back(prepareBoundedUntilData(dir, phiStates, goal));
+        }
+        uint64_t const numQueries = psiStates.size() * upperTimeBounds.size();
+        std::vector<std::vector<ValueType>> result(numQueries);
+        auto computeQuery = [&](uint64_t query) {
+            result[query] = computeBoundedUntilProbabilities(env, dir, data[query / upperTimeBounds.size()], upperTimeBounds[query % upperTimeBounds.size()],
+                                                             relevantStates);
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+            numQueries > 1) {
+            // Make sure that the row group indices of the matrices that are shared among the queries are not created on-the-fly by multiple threads.
+            for (auto const& d : data) {
+                d.probabilisticToProbabilisticTransitions.getRowGroupIndices();
+                d.probabilisticToMarkovianTransitions.getRowGroupIndices();
+            }
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numQueries, 1),
+                              [&](tbb::blocked_range<uint64_t> const& range) {
+                                  for (auto query = range.begin(); query < range.end(); ++query) {
+                                      computeQuery(query);
+                                  }
+                              },
+                              tbb::simple_partitioner());
+            return result;
+        }
+#endif
+        for (uint64_t query = 0; query < numQueries; ++query) {
+            computeQuery(query);
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Aborted batched unif+ after " << (query + 1) << " of " << numQueries << " queries.");
+                break;
+            }
+        }
+        return result;
+    }
+
+    std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir, BoundedUntilData const& data,
+                                                            ValueType const& upperTimeBound,
+                                                            boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        storm::storage::BitVector const& psiStates = data.psiStates;
+        storm::storage::BitVector const& maybeStates = data.maybeStates;
+        storm::storage::BitVector const& markovianStatesModMaybeStates = data.markovianStatesModMaybeStates;
+        storm::storage::BitVector const& probabilisticStatesModMaybeStates = data.probabilisticStatesModMaybeStates;
         // Catch the case where this query can be solved by solving the untimed variant instead.
         // This is the case if there is no Markovian maybe state (e.g. if the initial state is already a psi state) of if the time bound is infinity.
-        if (markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBound)) {
-            return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true), phiStates,
+        if (data.markovianMaybeStates.empty() || storm::utility::isInfinity(upperTimeBound)) {
+            return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, getBackwardTransitions(), data.phiStates,
                                                                                         psiStates, false, false)
                 .values;
         }
@@ -97,9 +220,6 @@ class UnifPlusHelper {
             bestKnownSolution.resize(relevantStates->size());
         }
 
-        // Get the exit rates restricted to only markovian maybe states.
-        std::vector<ValueType> markovianExitRates = storm::utility::vector::filterVector(exitRateVector, markovianMaybeStates);
-
         // Obtain parameters of the algorithm
         auto two = storm::utility::convertNumber<ValueType>(2.0);
         // Truncation error
@@ -108,26 +228,15 @@ class UnifPlusHelper {
         ValueType epsilon = two * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
         bool relativePrecision = env.solver().timeBounded().getRelativeTerminationCriterion();
         // Uniformization rate
-        ValueType lambda = *std::max_element(markovianExitRates.begin(), markovianExitRates.end());
+        ValueType lambda = data.lambda;
         STORM_LOG_DEBUG("Initial lambda is " << lambda << ".");
 
-        // Split the transitions into various part
-        // The (uniformized) probabilities to go from a Markovian state to a psi state in one step
-        std::vector<std::pair<uint64_t, ValueType>> markovianToPsiProbabilities = getSparseOneStepProbabilities(markovianMaybeStates, psiStates);
-        for (auto& entry : markovianToPsiProbabilities) {
-            entry.second *= markovianExitRates[entry.first] / lambda;
-        }
-        // Uniformized transitions from Markovian maybe states to all other maybe states. Inserts selfloop entries.
-        storm::storage::SparseMatrix<ValueType> markovianToMaybeTransitions =
-            getUniformizedMarkovianTransitions(markovianExitRates, lambda, maybeStates, markovianMaybeStates);
-        // Transitions from probabilistic maybe states to probabilistic maybe states.
-        storm::storage::SparseMatrix<ValueType> probabilisticToProbabilisticTransitions =
-            transitionMatrix.getSubmatrix(true, probabilisticMaybeStates, probabilisticMaybeStates, false);
-        // Transitions from probabilistic maybe states to Markovian maybe states.
-        storm::storage::SparseMatrix<ValueType> probabilisticToMarkovianTransitions =
-            transitionMatrix.getSubmatrix(true, probabilisticMaybeStates, markovianMaybeStates, false);
-        // The probabilities to go from a probabilistic state to a psi state in one step
-        std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
+        // The Markovian transitions are uniformized in place below, so we need our own copies.
+        std::vector<std::pair<uint64_t, ValueType>> markovianToPsiProbabilities = data.markovianToPsiProbabilities;
+        storm::storage::SparseMatrix<ValueType> markovianToMaybeTransitions = data.markovianToMaybeTransitions;
+        storm::storage::SparseMatrix<ValueType> const& probabilisticToProbabilisticTransitions = data.probabilisticToProbabilisticTransitions;
+        storm::storage::SparseMatrix<ValueType> const& probabilisticToMarkovianTransitions = data.probabilisticToMarkovianTransitions;
+        std::vector<std::pair<uint64_t, ValueType>> const& probabilisticToPsiProbabilities = data.probabilisticToPsiProbabilities;
 
         // Set up a solver for the transitions between probabilistic states (if there are some)
         Environment solverEnv = env;
@@ -138,8 +247,7 @@ class UnifPlusHelper {
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
+        std::vector<ValueType> nextMarkovianStateValues(data.markovianExitRates.size());
         std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
         std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
@@ -451,13 +559,23 @@ class UnifPlusHelper {
         }
     }
 
+    /*!
+     * Retrieves the backward transitions. These have to be computed before (i.e., before the queries are processed concurrently).
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions() const {
+        STORM_LOG_ASSERT(backwardTransitions, "Backward transitions have not been computed.");
+        return *backwardTransitions;
+    }
+
     storm::storage::BitVector getProb0States(OptimizationDirection dir, storm::storage::BitVector const& phiStates,
-                                             storm::storage::BitVector const& psiStates) const {
+                                             storm::storage::BitVector const& psiStates) {
+        if (!backwardTransitions) {
+            backwardTransitions = transitionMatrix.transpose(true);
+        }
         if (dir == storm::solver::OptimizationDirection::Maximize) {
-            return storm::utility::graph::performProb0A(transitionMatrix.transpose(true), phiStates, psiStates);
+            return storm::utility::graph::performProb0A(*backwardTransitions, phiStates, psiStates);
         } else {
-            return storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), transitionMatrix.transpose(true), phiStates,
-                                                        psiStates);
+            return storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), *backwardTransitions, phiStates, psiStates);
         }
     }
 
@@ -482,6 +600,8 @@ class UnifPlusHelper {
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     std::vector<ValueType> const& exitRateVector;
     storm::storage::BitVector const& markovianStates;
+    // The backward transitions are computed once and then shared among all queries.
+    std::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
 };
 
 template<typename ValueType>
@@ -722,6 +842,32 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    std::vector<storm::storage::BitVector> const& psiStates, std::vector<double> const& upperTimeBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::UnifPlus,
+                        "Using Unif+ method because the IMCA method does not support multiple queries at once.");
+
+    std::vector<ValueType> bounds;
+    bounds.reserve(upperTimeBounds.size());
+    for (auto const& bound : upperTimeBounds) {
+        bounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+    }
+    UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+    return helper.computeBoundedUntilProbabilities(env, dir, phiStates, psiStates, bounds);
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+    Environment const&, OptimizationDirection, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<storm::storage::BitVector> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -785,6 +931,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    std::vector<storm::storage::BitVector> const& psiStates, std::vector<double> const& upperTimeBounds);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -811,6 +962,11 @@ template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::comp
     std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    std::vector<storm::storage::BitVector> const& psiStates, std::vector<double> const& upperTimeBounds);
+
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
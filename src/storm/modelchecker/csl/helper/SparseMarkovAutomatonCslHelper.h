@@ -32,6 +32,29 @@ class SparseMarkovAutomatonCslHelper {
                                                                    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
                                                                    storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+    /*!
+     * Computes the probabilities to satisfy phi U<=t psi for each of the given goal state sets psi and each of the given time bounds t using Unif+.
+     * Structures that do not depend on the time bound are shared among the queries. If TBB is enabled, the queries are processed concurrently.
+     * @return the result for the i-th goal state set and the j-th time bound at position i * upperTimeBounds.size() + j
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir,
+                                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                std::vector<ValueType> const& exitRateVector,
+                                                                                storm::storage::BitVector const& markovianStates,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                std::vector<storm::storage::BitVector> const& psiStates,
+                                                                                std::vector<double> const& upperTimeBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir,
+                                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                std::vector<ValueType> const& exitRateVector,
+                                                                                storm::storage::BitVector const& markovianStates,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                std::vector<storm::storage::BitVector> const& psiStates,
+                                                                                std::vector<double> const& upperTimeBounds);
+
     template<typename ValueType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(Environment const& env, OptimizationDirection dir,
                                                                                        storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -1,5 +1,9 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <exception>
+#include <shared_mutex>
+#include <thread>
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -29,7 +33,9 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/prism.h"
+#include "storm/utility/threads.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -40,12 +46,36 @@ namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
+    : SparseExplorationModelChecker(program, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads)
     : program(program.substituteConstantsFormulas()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
-      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()),
+      numberOfThreads(numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads) {
     // Intentionally left empty.
 }
 
+// The data that the threads of a concurrent exploration share in addition to the exploration information, the bounds and the statistics.
+template<typename ModelType, typename StateType>
+struct SparseExplorationModelChecker<ModelType, StateType>::ConcurrentExplorationState {
+    // Guards all shared data. Sampling a path only reads and thus requires shared access, whereas exploring states, updating bounds and performing
+    // precomputations require exclusive access.
+    std::shared_mutex mutex;
+
+    // Counts the performed precomputations. As collapsing MECs moves actions, paths sampled across a precomputation are discarded.
+    uint64_t epoch = 0;
+
+    // Whether the threads are to stop sampling.
+    bool done = false;
+
+    // The first exception thrown by any of the threads.
+    std::exception_ptr exception;
+};
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
     storm::logic::Formula const& formula = checkTask.getFormula();
@@ -80,7 +110,17 @@ std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>
 
     // Compute and return result.
     std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+    auto const& [initialState, lowerBound, upperBound] = boundsForInitialState;
+    if (comparator.isZero(upperBound - lowerBound)) {
+        return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialState, lowerBound);
+    }
+
+    // The exploration was interrupted, so we return the center of the interval along with the bounds.
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(
+        initialState, (lowerBound + upperBound) / storm::utility::convertNumber<ValueType>(static_cast<uint64_t>(2)));
+    result->setBounds(ExplicitQuantitativeCheckResult<ValueType>(initialState, lowerBound),
+                      ExplicitQuantitativeCheckResult<ValueType>(initialState, upperBound));
+    return result;
 }
 
 template<typename ModelType, typename StateType>
@@ -95,40 +135,48 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
     // Create a structure that holds the bounds for the states and actions.
     Bounds<StateType, ValueType> bounds;
 
-    // Create a stack that is used to track the path we sampled.
-    StateActionStack stack;
-
     // Now perform the actual sampling.
     Statistics<StateType, ValueType> stats;
-    bool convergenceCriterionMet = false;
-    while (!convergenceCriterionMet) {
-        bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
-
-        stats.sampledPath();
-        stats.updateMaxPathLength(stack.size());
-
-        // If a terminal state was found, we update the probabilities along the path contained in the stack.
-        if (result) {
-            // Update the bounds along the path to the terminal state.
-            STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
-            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
-        } else {
-            // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
-            // case, we cannot update the probabilities.
-            STORM_LOG_TRACE("Did not find terminal state.");
-        }
+    if (numberOfThreads > 1) {
+        performConcurrentExploration(stateGeneration, explorationInformation, bounds, stats, numberOfThreads);
+    } else {
+        // Create a stack that is used to track the path we sampled.
+        StateActionStack stack;
+
+        bool convergenceCriterionMet = false;
+        while (!convergenceCriterionMet) {
+            bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
+
+            stats.sampledPath();
+            stats.updateMaxPathLength(stack.size());
 
-        STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, "
-                                              << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
-        STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
-                                                         << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
-        ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
-        STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-        convergenceCriterionMet = comparator.isZero(difference);
-
-        // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-        if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-            performPrecomputation(stack, explorationInformation, bounds, stats);
+            // If a terminal state was found, we update the probabilities along the path contained in the stack.
+            if (result) {
+                // Update the bounds along the path to the terminal state.
+                STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+            } else {
+                // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
+                // case, we cannot update the probabilities.
+                STORM_LOG_TRACE("Did not find terminal state.");
+            }
+
+            STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates
+                                                  << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+            STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", "
+                                                             << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+            ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+            STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+            convergenceCriterionMet = comparator.isZero(difference);
+            if (!convergenceCriterionMet && storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Exploration aborted before convergence. The value of the initial state is only known to lie within its bounds.");
+                break;
+            }
+
+            // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+            if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                performPrecomputation(stack, explorationInformation, bounds, stats);
+            }
         }
     }
 
@@ -141,6 +189,134 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+// The number of exploration steps a thread performs on explored states before it adds them to the statistics.
+static const std::size_t explorationStepsPerUpdate = 1024;
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                       ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                       Bounds<StateType, ValueType>& bounds,
+                                                                                       Statistics<StateType, ValueType>& stats,
+                                                                                       uint64_t numberOfThreads) const {
+    ConcurrentExplorationState shared;
+    auto work = [&](std::default_random_engine generator) {
+        try {
+            StateActionStack stack;
+            while (!sampleAndUpdatePathConcurrently(stateGeneration, explorationInformation, stack, bounds, stats, shared, generator)) {
+                // Intentionally left empty.
+            }
+        } catch (...) {
+            std::unique_lock<std::shared_mutex> lock(shared.mutex);
+            if (!shared.exception) {
+                shared.exception = std::current_exception();
+            }
+            shared.done = true;
+        }
+    };
+
+    // The random number generators of the threads are seeded sequentially, because the generator of the model checker is not thread-safe.
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(work, std::default_random_engine(randomGenerator()));
+    }
+    work(std::default_random_engine(randomGenerator()));
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (shared.exception) {
+        std::rethrow_exception(shared.exception);
+    }
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::sampleAndUpdatePathConcurrently(
+    StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
+    Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, ConcurrentExplorationState& shared,
+    std::default_random_engine& generator) const {
+    std::shared_lock<std::shared_mutex> readLock(shared.mutex);
+    if (shared.done) {
+        return true;
+    }
+    uint64_t epoch = shared.epoch;
+    stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+
+    // Sample the path while holding shared access. Only exploring a state and recording the exploration steps requires exclusive access.
+    std::size_t explorationSteps = 0;
+    bool foundTerminalState = false;
+    while (!foundTerminalState) {
+        StateType currentStateId = stack.back().first;
+        ++explorationSteps;
+
+        if (explorationInformation.isUnexplored(currentStateId) || explorationSteps >= explorationStepsPerUpdate) {
+            readLock.unlock();
+            std::unique_lock<std::shared_mutex> writeLock(shared.mutex);
+            if (shared.done || shared.epoch != epoch) {
+                stack.clear();
+                return shared.done;
+            }
+
+            // Another thread may have explored the state in the meantime.
+            auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+            if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                foundTerminalState = exploreState(stateGeneration, currentStateId, unexploredIt->second, explorationInformation, bounds, stats);
+                explorationInformation.removeUnexploredState(unexploredIt);
+            } else {
+                foundTerminalState = explorationInformation.isTerminal(currentStateId);
+            }
+            stats.addExplorationSteps(explorationSteps);
+            explorationSteps = 0;
+
+            // If the number of exploration steps exceeds a certain threshold, do a precomputation and abort the path.
+            if (!foundTerminalState && explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
+                performPrecomputation(stack, explorationInformation, bounds, stats);
+                ++shared.epoch;
+                stack.clear();
+                return false;
+            }
+
+            writeLock.unlock();
+            readLock.lock();
+            if (shared.epoch != epoch) {
+                stack.clear();
+                return shared.done;
+            }
+        } else {
+            foundTerminalState = explorationInformation.isTerminal(currentStateId);
+        }
+
+        if (!foundTerminalState) {
+            ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+            stack.back().second = chosenAction;
+            stack.emplace_back(sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator), 0);
+        }
+    }
+    readLock.unlock();
+
+    // Update the bounds along the path unless a precomputation invalidated it in the meantime.
+    std::unique_lock<std::shared_mutex> writeLock(shared.mutex);
+    if (shared.done) {
+        return true;
+    }
+    stats.addExplorationSteps(explorationSteps);
+    stats.sampledPath();
+    stats.updateMaxPathLength(stack.size());
+    if (shared.epoch == epoch) {
+        updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+    } else {
+        stack.clear();
+    }
+
+    StateType initialStateIndex = stateGeneration.getFirstInitialState();
+    shared.done = comparator.isZero(bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation)) || storm::utility::resources::isTerminate();
+
+    // If the number of sampled paths exceeds a certain threshold, do a precomputation.
+    if (!shared.done && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+        performPrecomputation(stack, explorationInformation, bounds, stats);
+        ++shared.epoch;
+    }
+    return shared.done;
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -182,11 +358,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -319,7 +495,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds,
+    std::default_random_engine& generator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -355,13 +532,13 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(generator)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -382,11 +559,11 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     }
 }
 
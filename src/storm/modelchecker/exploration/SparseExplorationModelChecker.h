@@ -48,6 +48,11 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    /*!
+     * Creates a model checker that samples paths with the given number of threads. If the number is zero, the number of available cores is used.
+     */
+    SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads);
+
     static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
 
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
@@ -56,9 +61,20 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                                                                    CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
 
    private:
+    struct ConcurrentExplorationState;
+
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    void performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                      ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                                      Statistics<StateType, ValueType>& stats, uint64_t numberOfThreads) const;
+
+    bool sampleAndUpdatePathConcurrently(StateGeneration<StateType, ValueType>& stateGeneration,
+                                         ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
+                                         Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, ConcurrentExplorationState& shared,
+                                         std::default_random_engine& generator) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -68,10 +84,10 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -112,6 +128,9 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
+
+    // The number of threads that sample paths concurrently.
+    uint64_t numberOfThreads;
 };
 }  // namespace modelchecker
 }  // namespace storm
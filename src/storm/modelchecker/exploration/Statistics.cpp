@@ -28,6 +28,12 @@ void Statistics<StateType, ValueType>::explorationStep() {
     ++explorationStepsSinceLastPrecomputation;
 }
 
+template<typename StateType, typename ValueType>
+void Statistics<StateType, ValueType>::addExplorationSteps(std::size_t const& count) {
+    explorationSteps += count;
+    explorationStepsSinceLastPrecomputation += count;
+}
+
 template<typename StateType, typename ValueType>
 void Statistics<StateType, ValueType>::sampledPath() {
     ++pathsSampled;
@@ -18,6 +18,8 @@ struct Statistics {
 
     void explorationStep();
 
+    void addExplorationSteps(std::size_t const& count);
+
     void sampledPath();
 
     void updateMaxPathLength(std::size_t const& currentPathLength);
@@ -1,4 +1,8 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
@@ -9,7 +13,12 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/StepBoundedIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SubmatrixView.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -29,6 +38,10 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
                                                                                        storm::storage::BitVector const& phiStates,
                                                                                        storm::storage::BitVector const& psiStates, uint64_t lowerBound,
                                                                                        uint64_t upperBound, ModelCheckerHint const& hint) {
+    if (lowerBound == 0) {
+        return std::move(compute(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, std::vector<uint64_t>({upperBound}), hint)
+                             .front());
+    }
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // If we identify the states that have probability 0 of reaching the target states, we can exclude them in the further analysis.
@@ -39,21 +52,14 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
         maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
     } else {
         maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, upperBound);
-        if (lowerBound == 0) {
-            maybeStates &= ~psiStates;
-        } else {
-            makeZeroColumns = psiStates;
-        }
+        makeZeroColumns = psiStates;
     }
 
     STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
-    if (lowerBound == 0) {
-        storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
-    }
 
     if (!maybeStates.empty()) {
         // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
-        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true, makeZeroColumns);
+        storm::storage::SubmatrixView<ValueType> submatrix(transitionMatrix, maybeStates, maybeStates, makeZeroColumns);
 
         // Create the vector of one-step probabilities to go to target states.
         std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
@@ -62,16 +68,9 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
         // Perform the matrix vector multiplication
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-        if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
-        } else {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
-            submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
-            multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
-        }
+        performSteps(env, submatrix, subresult, b, {upperBound - lowerBound + 1});
+        b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
+        performSteps(env, storm::storage::SubmatrixView<ValueType>(transitionMatrix, maybeStates, maybeStates), subresult, b, {lowerBound - 1});
 
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
@@ -80,6 +79,69 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
     return result;
 }
 
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseDeterministicStepBoundedHorizonHelper<ValueType>::compute(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<uint64_t> const& upperBounds, ModelCheckerHint const& hint) {
+    STORM_LOG_THROW(!upperBounds.empty() && std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The step bounds must be given in ascending order.");
+    std::vector<std::vector<ValueType>> results(upperBounds.size(), std::vector<ValueType>(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>()));
+
+    // If we identify the states that have probability 0 of reaching the target states (within the largest bound), we can exclude them in the further
+    // analysis.
+    storm::storage::BitVector maybeStates;
+    if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+        maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
+    } else {
+        maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, upperBounds.back());
+        maybeStates &= ~psiStates;
+    }
+
+    STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
+    for (auto& result : results) {
+        storm::utility::vector::setVectorValues<ValueType>(result, psiStates, storm::utility::one<ValueType>());
+    }
+
+    if (!maybeStates.empty()) {
+        // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
+        storm::storage::SubmatrixView<ValueType> submatrix(transitionMatrix, maybeStates, maybeStates);
+
+        // Create the vector of one-step probabilities to go to target states.
+        std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
+
+        // Create the vector with which to multiply. The intermediate results are written whenever one of the step bounds is reached.
+        std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
+        performSteps(env, submatrix, subresult, b, upperBounds, [&results, &maybeStates](uint64_t boundIndex, std::vector<ValueType> const& values) {
+            storm::utility::vector::setVectorValues(results[boundIndex], maybeStates, values);
+        });
+    }
+
+    return results;
+}
+
+template<typename ValueType>
+void SparseDeterministicStepBoundedHorizonHelper<ValueType>::performSteps(
+    Environment const& env, storm::storage::SubmatrixView<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+    std::vector<uint64_t> const& stepBounds, std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback) const {
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        // The value iteration operator does not support rational functions, so we materialize the submatrix and use a multiplier instead.
+        storm::storage::SparseMatrix<ValueType> const sparseMatrix = matrix.toSparseMatrix();
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, sparseMatrix);
+        uint64_t step = 0;
+        for (uint64_t boundIndex = 0; boundIndex < stepBounds.size(); ++boundIndex) {
+            multiplier->repeatedMultiply(env, x, &b, stepBounds[boundIndex] - step);
+            step = stepBounds[boundIndex];
+            if (stepBoundCallback) {
+                stepBoundCallback(boundIndex, x);
+            }
+        }
+    } else {
+        bool const parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+        storm::solver::helper::StepBoundedIterationHelper<ValueType, true>(matrix, parallel).performSteps(x, b, stepBounds, {}, stepBoundCallback);
+    }
+}
+
 template class SparseDeterministicStepBoundedHorizonHelper<double>;
 template class SparseDeterministicStepBoundedHorizonHelper<storm::RationalNumber>;
 template class SparseDeterministicStepBoundedHorizonHelper<storm::RationalFunction>;
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <functional>
+
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SemanticSolutionType.h"
 #include "storm/solver/SolveGoal.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SubmatrixView.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
@@ -20,7 +23,24 @@ class SparseDeterministicStepBoundedHorizonHelper {
                                    storm::storage::BitVector const& psiStates, uint64_t lowerBound, uint64_t upperBound,
                                    ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the probabilities to satisfy phi U<=k psi for each of the given (ascendingly sorted) step bounds k.
+     * All step bounds are handled in a single sequence of steps, i.e., the result for a bound is taken once the corresponding number of steps is reached.
+     * @return one value vector for each step bound
+     */
+    std::vector<std::vector<ValueType>> compute(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, std::vector<uint64_t> const& upperBounds,
+                                                ModelCheckerHint const& hint = ModelCheckerHint());
+
    private:
+    /*!
+     * Performs stepBounds.back() steps x <- A*x + b and invokes the callback whenever one of the step bounds is reached.
+     */
+    void performSteps(Environment const& env, storm::storage::SubmatrixView<ValueType> const& matrix, std::vector<ValueType>& x,
+                      std::vector<ValueType> const& b, std::vector<uint64_t> const& stepBounds,
+                      std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback = {}) const;
 };
 
 }  // namespace helper
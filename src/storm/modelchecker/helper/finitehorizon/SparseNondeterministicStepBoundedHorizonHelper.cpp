@@ -1,4 +1,7 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
+
+#include <algorithm>
+
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
@@ -9,7 +12,11 @@
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
-#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/StepBoundedIterationHelper.h"
+#include "storm/storage/SubmatrixView.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -32,54 +39,89 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
                                                                                           storm::storage::BitVector const& phiStates,
                                                                                           storm::storage::BitVector const& psiStates, uint64_t lowerBound,
                                                                                           uint64_t upperBound, ModelCheckerHint const& hint) {
+    if (lowerBound == 0) {
+        return std::move(compute(env, std::move(goal), transitionMatrix, backwardTransitions, phiStates, psiStates, std::vector<uint64_t>({upperBound}), hint)
+                             .front());
+    }
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-    storm::storage::BitVector makeZeroColumns;
 
     // Determine the states that have 0 probability of reaching the target states.
-    storm::storage::BitVector maybeStates;
-    if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
-        maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
-    } else {
-        if (goal.minimize()) {
-            maybeStates = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates,
-                                                                      psiStates, true, upperBound);
-        } else {
-            maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, upperBound);
-        }
-        if (lowerBound == 0) {
-            maybeStates &= ~psiStates;
-        } else {
-            makeZeroColumns = psiStates;
-        }
+    storm::storage::BitVector maybeStates = computeMaybeStates(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, upperBound, hint);
+    storm::storage::BitVector makeZeroColumns;
+    if (!hint.isExplicitModelCheckerHint() || !hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+        makeZeroColumns = psiStates;
     }
-
     STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
 
     if (!maybeStates.empty()) {
+        bool const parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
         // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
-        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false, makeZeroColumns);
+        storm::storage::SubmatrixView<ValueType> submatrix(transitionMatrix, maybeStates, maybeStates, makeZeroColumns);
         std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
 
         // Create the vector with which to multiply.
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
-
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-        if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
-        } else {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
-            storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
-            auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
-        }
+        storm::solver::helper::StepBoundedIterationHelper<ValueType, false>(submatrix, parallel)
+            .performSteps(subresult, b, upperBound - lowerBound + 1, goal.direction());
+        b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
+        storm::storage::SubmatrixView<ValueType> unconstrainedSubmatrix(transitionMatrix, maybeStates, maybeStates);
+        storm::solver::helper::StepBoundedIterationHelper<ValueType, false>(unconstrainedSubmatrix, parallel)
+            .performSteps(subresult, b, lowerBound - 1, goal.direction());
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
     }
-    if (lowerBound == 0) {
+    return result;
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseNondeterministicStepBoundedHorizonHelper<ValueType>::compute(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<uint64_t> const& upperBounds, ModelCheckerHint const& hint) {
+    STORM_LOG_THROW(!upperBounds.empty() && std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The step bounds must be given in ascending order.");
+    std::vector<std::vector<ValueType>> results(upperBounds.size(),
+                                                std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>()));
+
+    // Determine the states that have 0 probability of reaching the target states within the largest bound.
+    storm::storage::BitVector maybeStates = computeMaybeStates(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, upperBounds.back(), hint);
+    if (!hint.isExplicitModelCheckerHint() || !hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+        maybeStates &= ~psiStates;
+    }
+    STORM_LOG_INFO("Preprocessing: " << maybeStates.getNumberOfSetBits() << " non-target states with probability greater 0.");
+
+    if (!maybeStates.empty()) {
+        // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
+        storm::storage::SubmatrixView<ValueType> submatrix(transitionMatrix, maybeStates, maybeStates);
+        std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, psiStates);
+
+        // Create the vector with which to multiply. The intermediate results are written whenever one of the step bounds is reached.
+        std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
+        storm::solver::helper::StepBoundedIterationHelper<ValueType, false>(
+            submatrix, storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet())
+            .performSteps(subresult, b, upperBounds, goal.direction(), [&results, &maybeStates](uint64_t boundIndex, std::vector<ValueType> const& values) {
+                storm::utility::vector::setVectorValues(results[boundIndex], maybeStates, values);
+            });
+    }
+    for (auto& result : results) {
         storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
     }
-    return result;
+    return results;
+}
+
+template<typename ValueType>
+storm::storage::BitVector SparseNondeterministicStepBoundedHorizonHelper<ValueType>::computeMaybeStates(
+    storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    uint64_t upperBound, ModelCheckerHint const& hint) const {
+    if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+        return hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
+    } else if (goal.minimize()) {
+        return storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates,
+                                                           true, upperBound);
+    } else {
+        return storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, upperBound);
+    }
 }
 
 template class SparseNondeterministicStepBoundedHorizonHelper<double>;
@@ -20,7 +20,22 @@ class SparseNondeterministicStepBoundedHorizonHelper {
                                    storm::storage::BitVector const& psiStates, uint64_t lowerBound, uint64_t upperBound,
                                    ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the probabilities to satisfy phi U<=k psi for each of the given (ascendingly sorted) step bounds k.
+     * All step bounds are handled in a single sequence of steps, i.e., the result for a bound is taken once the corresponding number of steps is reached.
+     * @return one value vector for each step bound
+     */
+    std::vector<std::vector<ValueType>> compute(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, std::vector<uint64_t> const& upperBounds,
+                                                ModelCheckerHint const& hint = ModelCheckerHint());
+
    private:
+    storm::storage::BitVector computeMaybeStates(storm::solver::SolveGoal<ValueType> const& goal,
+                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates, uint64_t upperBound, ModelCheckerHint const& hint) const;
 };
 
 }  // namespace helper
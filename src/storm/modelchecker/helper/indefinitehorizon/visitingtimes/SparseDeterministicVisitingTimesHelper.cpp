@@ -1,6 +1,7 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -9,12 +10,14 @@
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/utility/graph.h"
@@ -92,61 +95,58 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues) {
-    STORM_LOG_ASSERT(stateValues.size() == transitionMatrix.getRowCount(), "Dimension missmatch.");
+    std::vector<std::vector<ValueType>> stateValuesPerDistribution;
+    stateValuesPerDistribution.push_back(std::move(stateValues));
+    computeExpectedVisitingTimes(env, stateValuesPerDistribution);
+    stateValues = std::move(stateValuesPerDistribution.front());
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingTimes(Environment const& env,
+                                                                                     std::vector<std::vector<ValueType>>& stateValuesPerDistribution) {
+    if (stateValuesPerDistribution.empty()) {
+        return;
+    }
+    for (auto const& stateValues : stateValuesPerDistribution) {
+        STORM_LOG_ASSERT(stateValues.size() == transitionMatrix.getRowCount(), "Dimension missmatch.");
+    }
+    bool const topological = env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological;
+    bool solveSccsInParallel = topological && env.solver().topological().isParallelSccSolvingSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!solveSccsInParallel, "Storm was built without support for Intel TBB, defaulting to sequential SCC solving.");
+    solveSccsInParallel = false;
+#endif
+    if constexpr (!storm::NumberTraits<ValueType>::IsThreadSafe) {
+        STORM_LOG_WARN_COND(!solveSccsInParallel, "Concurrent SCC solving is not supported for this value type, defaulting to sequential SCC solving.");
+        solveSccsInParallel = false;
+    }
     createBackwardTransitions();
-    createDecomposition(env);
+    createDecomposition(env, solveSccsInParallel);
     createNonBsccStateVector();
 
-    // Create auxiliary data and lambdas
-    storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
-    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
-    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
-        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
-    };
-    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
-        if (!storm::utility::isZero(stateValues[state])) {
-            return true;
-        }
-        auto row = this->backwardTransitions->getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
-    };
-
-    if (env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological) {
+    if (topological) {
         // Compute EVTs SCC wise in topological order
         // We need to adapt precision if we solve each SCC separately (in topological order) and/or consider CTMCs
         auto sccEnv = getEnvironmentForSolver(env, true);
 
-        // We solve each SCC individually in *forward* topological order
-        storm::utility::ProgressMeasurement progress("sccs");
-        progress.setMaxCount(sccDecomposition->size());
-        progress.startNewMeasurement(0);
-        uint64_t sccIndex = 0;
-        auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
-        for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-            auto const& scc = *sccIt;
-            if (scc.size() == 1) {
-                processSingletonScc(*scc.begin(), stateValues);
-            } else {
-                sccAsBitVector.set(scc.begin(), scc.end(), true);
-                if (sccAsBitVector.isSubsetOf(nonBsccStates)) {
-                    // This is not a BSCC
-                    auto sccResult = computeValueForStateSet(sccEnv, sccAsBitVector, stateValues);
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-                } else {
-                    // This is a BSCC
-                    if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                    } else {
-                        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
-                    }
+        if (solveSccsInParallel) {
+            processSccsConcurrently(sccEnv, stateValuesPerDistribution);
+        } else {
+            // We solve each SCC individually in *forward* topological order
+            storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
+            storm::utility::ProgressMeasurement progress("sccs");
+            progress.setMaxCount(sccDecomposition->size());
+            progress.startNewMeasurement(0);
+            uint64_t sccIndex = 0;
+            auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
+            for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
+                processScc(sccEnv, *sccIt, sccAsBitVector, stateValuesPerDistribution);
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << sccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                sccAsBitVector.clear();
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->computedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     } else {
@@ -154,23 +154,22 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
         if (!nonBsccStates.empty()) {
             // We need to adapt precision if we consider CTMCs.
             Environment adjustedEnv = getEnvironmentForSolver(env, false);
-            auto result = computeValueForStateSet(adjustedEnv, nonBsccStates, stateValues);
-            storm::utility::vector::setVectorValues(stateValues, nonBsccStates, result);
+            auto solver = createSolverForStateSet(adjustedEnv, nonBsccStates);
+            for (auto& stateValues : stateValuesPerDistribution) {
+                auto result = computeValueForStateSet(adjustedEnv, *solver, nonBsccStates, stateValues);
+                storm::utility::vector::setVectorValues(stateValues, nonBsccStates, result);
+            }
         }
 
         // After computing the state values for the  non-BSCCs, we can set the values of the BSCC states.
+        storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
         auto sccItEnd = std::make_reverse_iterator(sccDecomposition->begin());
         for (auto sccIt = std::make_reverse_iterator(sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
             auto const& scc = *sccIt;
             sccAsBitVector.set(scc.begin(), scc.end(), true);
             if (sccAsBitVector.isSubsetOf(~nonBsccStates)) {
-                // This is a BSCC, we set the values of the states to infinity or 0.
-                if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                    // The BSCC is reachable: The EVT is infinity
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                } else {
-                    // The BSCC is not reachable: The EVT is zero
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+                for (auto& stateValues : stateValuesPerDistribution) {
+                    processBscc(sccAsBitVector, stateValues);
                 }
             }
             sccAsBitVector.clear();
@@ -180,10 +179,75 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
     if (isContinuousTime()) {
         // Divide with the exit rates
         // Since storm::utility::infinity<storm::RationalNumber>() is just set to some big number, we have to treat the infinity-case explicitly.
-        storm::utility::vector::applyPointwise(stateValues, *exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
-            return storm::utility::isInfinity(xi) ? xi : xi / yi;
+        for (auto& stateValues : stateValuesPerDistribution) {
+            storm::utility::vector::applyPointwise(stateValues, *exitRates, stateValues, [](ValueType const& xi, ValueType const& yi) -> ValueType {
+                return storm::utility::isInfinity(xi) ? xi : xi / yi;
+            });
+        }
+    }
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& env, storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::storage::BitVector& sccAsBitVector,
+                                                                   std::vector<std::vector<ValueType>>& stateValuesPerDistribution) const {
+    if (scc.size() == 1) {
+        for (auto& stateValues : stateValuesPerDistribution) {
+            processSingletonScc(*scc.begin(), stateValues);
+        }
+        return;
+    }
+    sccAsBitVector.set(scc.begin(), scc.end(), true);
+    if (sccAsBitVector.isSubsetOf(nonBsccStates)) {
+        // This is not a BSCC. The equation system is set up once and solved for each distribution.
+        auto solver = createSolverForStateSet(env, sccAsBitVector);
+        for (auto& stateValues : stateValuesPerDistribution) {
+            auto sccResult = computeValueForStateSet(env, *solver, sccAsBitVector, stateValues);
+            storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
+        }
+    } else {
+        // This is a BSCC
+        for (auto& stateValues : stateValuesPerDistribution) {
+            processBscc(sccAsBitVector, stateValues);
+        }
+    }
+    sccAsBitVector.clear();
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processSccsConcurrently(storm::Environment const& env,
+                                                                                std::vector<std::vector<ValueType>>& stateValuesPerDistribution) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Group the SCCs by their depth. There are no transitions between SCCs of the same depth, so these SCCs can be processed independently as soon as all
+    // SCCs with a larger depth (i.e., all potential predecessors) are processed.
+    STORM_LOG_ASSERT(sccDecomposition->hasSccDepth(), "Did not compute the SCC depths although they are needed.");
+    std::vector<std::vector<uint64_t>> sccsPerDepth(sccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[sccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    uint64_t numProcessedSccs = 0;
+    storm::utility::ProgressMeasurement progress("sccs");
+    progress.setMaxCount(sccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto sccIndicesIt = sccsPerDepth.rbegin(); sccIndicesIt != sccsPerDepth.rend(); ++sccIndicesIt) {
+        auto const& sccIndices = *sccIndicesIt;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            storm::storage::BitVector sccAsBitVector(transitionMatrix.getRowCount(), false);
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                processScc(env, sccDecomposition->getBlock(sccIndices[i]), sccAsBitVector, stateValuesPerDistribution);
+            }
         });
+        numProcessedSccs += sccIndices.size();
+        progress.updateProgress(numProcessedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Visiting times computation aborted after analyzing " << numProcessedSccs << "/" << sccDecomposition->size() << " SCCs.");
+            break;
+        }
     }
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Concurrent SCC processing requires Intel TBB.");
+#endif
 }
 
 template<typename ValueType>
@@ -201,8 +265,9 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::createBackwardTransition
 }
 
 template<typename ValueType>
-void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Environment const& env) {
-    if (this->sccDecomposition && !this->sccDecomposition->hasSccDepth() && env.solver().isForceSoundness()) {
+void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Environment const& env, bool needSccDepths) {
+    needSccDepths = needSccDepths || env.solver().isForceSoundness();
+    if (this->sccDecomposition && !this->sccDecomposition->hasSccDepth() && needSccDepths) {
         // We are missing SCCDepths in the given decomposition.
         STORM_LOG_WARN("Recomputing SCC Decomposition because the currently available decomposition is computed without SCCDepths.");
         this->computedSccDecomposition.reset();
@@ -211,8 +276,7 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Envi
 
     if (!this->sccDecomposition) {
         // The decomposition has not been provided or computed, yet.
-        auto options =
-            storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(env.solver().isForceSoundness());
+        auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needSccDepths);
         this->computedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(this->transitionMatrix, options);
         this->sccDecomposition.reset(*this->computedSccDecomposition);
     }
@@ -430,8 +494,30 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint
     }
 }
 
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processBscc(storm::storage::BitVector const& bsccAsBitVector,
+                                                                    std::vector<ValueType>& stateValues) const {
+    auto isReachableInState = [this, &bsccAsBitVector, &stateValues](uint64_t state) {
+        if (!storm::utility::isZero(stateValues[state])) {
+            return true;
+        }
+        auto row = this->backwardTransitions->getRow(state);
+        return std::any_of(row.begin(), row.end(), [&bsccAsBitVector, &stateValues](auto const& e) {
+            return !bsccAsBitVector.get(e.getColumn()) && !storm::utility::isZero(stateValues[e.getColumn()]);
+        });
+    };
+    if (std::any_of(bsccAsBitVector.begin(), bsccAsBitVector.end(), isReachableInState)) {
+        // The BSCC is reachable: The EVT is infinity
+        storm::utility::vector::setVectorValues(stateValues, bsccAsBitVector, storm::utility::infinity<ValueType>());
+    } else {
+        // The BSCC is not reachable: The EVT is zero
+        storm::utility::vector::setVectorValues(stateValues, bsccAsBitVector, storm::utility::zero<ValueType>());
+    }
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::computeValueForStateSet(storm::Environment const& env,
+                                                                                                  storm::solver::LinearEquationSolver<ValueType> const& solver,
                                                                                                   storm::storage::BitVector const& stateSetAsBitvector,
                                                                                                   std::vector<ValueType> const& stateValues) const {
     // Get the vector for the equation system
@@ -445,7 +531,9 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         }
         ++valIt;
     }
-    return computeExpectedVisitingTimes(env, stateSetAsBitvector, sccVector);
+    std::vector<ValueType> eqSysValues(sccVector.size());
+    solver.solveEquations(env, eqSysValues, sccVector);
+    return eqSysValues;
 }
 
 template<typename ValueType>
@@ -458,6 +546,15 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         return {};
     }
 
+    auto solver = createSolverForStateSet(env, subsystem);
+    std::vector<ValueType> eqSysValues(initialValues.size());
+    solver->solveEquations(env, eqSysValues, initialValues);
+    return eqSysValues;
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> SparseDeterministicVisitingTimesHelper<ValueType>::createSolverForStateSet(
+    storm::Environment const& env, storm::storage::BitVector const& subsystem) const {
     // Here we assume that the subsystem does not contain a BSCC
     // Let P be the subsystem matrix. We solve the equation system
     //       x * P + b = x
@@ -494,9 +591,9 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
 
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    std::vector<ValueType> eqSysValues(initialValues.size());
-    solver->solveEquations(env, eqSysValues, initialValues);
-    return eqSysValues;
+    // The solver might be used for multiple right-hand sides
+    solver->setCachingEnabled(true);
+    return solver;
 }
 
 template class SparseDeterministicVisitingTimesHelper<double>;
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <vector>
 
 #include "storm/modelchecker/helper/SingleValueModelCheckerHelper.h"
@@ -10,6 +11,11 @@
 namespace storm {
 class Environment;
 
+namespace solver {
+template<typename ValueType>
+class LinearEquationSolver;
+}
+
 namespace modelchecker {
 namespace helper {
 
@@ -85,6 +91,16 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     void computeExpectedVisitingTimes(Environment const& env, std::vector<ValueType>& stateValues);
 
+    /*!
+     * Computes for each state the expected number of times we are visiting that state for multiple initial distributions at once.
+     * The equation system of each SCC (or of all non-BSCC states) is only set up once and then solved for every distribution.
+     * If concurrent SCC solving is enabled for the topological solver, independent SCCs are processed concurrently.
+     * @pre each entry of parameter stateValuesPerDistribution contains for each state the initial value (probability) for that state.
+     * The values can actually sum up to something different than 1 but should be non-negative.
+     * @post each entry of parameter stateValuesPerDistribution contains the desired values for the corresponding distribution
+     */
+    void computeExpectedVisitingTimes(Environment const& env, std::vector<std::vector<ValueType>>& stateValuesPerDistribution);
+
     /*!
      * Computes for each selected state the expected number of times we are visiting that state assuming the given initial state probabilities
      * The interpretation of the subsystem is that once a path has exited the subsystem, all subsequent visits will be ignored.
@@ -113,9 +129,10 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     void createBackwardTransitions();
 
     /*!
+     * @param needSccDepths if true, the decomposition is ensured to contain sccDepths. These are also computed if sound model checking is requested.
      * @post _sccDecomposition points to an SCC decomposition
      */
-    void createDecomposition(Environment const& env);
+    void createDecomposition(Environment const& env, bool needSccDepths = false);
 
     /*!
      * @post _nonBsccStates points to the vector of non-BSCC states
@@ -149,11 +166,34 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
     void processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const;
 
     /*!
-     * Solves the equation system for non-singleton (subs)sets of the chain's non-bottom states.
+     * Sets the values of the given BSCC to infinity or zero, depending on whether the BSCC is reached. The values are directly inserted into stateValues
+     */
+    void processBscc(storm::storage::BitVector const& bsccAsBitVector, std::vector<ValueType>& stateValues) const;
+
+    /*!
+     * Processes the given SCC for each of the given distributions. The resulting values are directly inserted into stateValuesPerDistribution.
+     * @param sccAsBitVector auxiliary storage that is assumed to be (and is left) cleared.
+     */
+    void processScc(storm::Environment const& env, storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccAsBitVector,
+                    std::vector<std::vector<ValueType>>& stateValuesPerDistribution) const;
+
+    /*!
+     * Processes all SCCs in topological order, where SCCs that do not depend on each other are processed concurrently.
+     */
+    void processSccsConcurrently(storm::Environment const& env, std::vector<std::vector<ValueType>>& stateValuesPerDistribution) const;
+
+    /*!
+     * Creates a solver for the equation system of the given (non-singleton) set of the chain's non-bottom states.
+     */
+    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> createSolverForStateSet(storm::Environment const& env,
+                                                                                            storm::storage::BitVector const& subsystem) const;
+
+    /*!
+     * Solves the equation system for non-singleton (subs)sets of the chain's non-bottom states using the given solver.
      * @return for each state of the given set the expected number of times that state is visited.
      */
-    std::vector<ValueType> computeValueForStateSet(storm::Environment const& env, storm::storage::BitVector const& stateSetAsBitVector,
-                                                   std::vector<ValueType> const& stateValues) const;
+    std::vector<ValueType> computeValueForStateSet(storm::Environment const& env, storm::solver::LinearEquationSolver<ValueType> const& solver,
+                                                   storm::storage::BitVector const& stateSetAsBitVector, std::vector<ValueType> const& stateValues) const;
 
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     storm::OptionalRef<std::vector<ValueType> const> exitRates;
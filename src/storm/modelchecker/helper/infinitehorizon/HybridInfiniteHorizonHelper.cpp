@@ -1,5 +1,7 @@
 #include "HybridInfiniteHorizonHelper.h"
 
+#include <algorithm>
+
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromOtherHelper.h"
@@ -8,8 +10,12 @@
 
 #include "storm/models/symbolic/NondeterministicModel.h"
 
+#include "storm/storage/Decomposition.h"
+#include "storm/storage/MaximalEndComponent.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
 
+#include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -18,6 +24,60 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace detail {
+/*!
+ * A decomposition whose blocks are computed elsewhere (here: on the decision diagrams) and then added one by one.
+ */
+template<typename BlockType>
+class ProvidedDecomposition : public storm::storage::Decomposition<BlockType> {
+   public:
+    void addBlock(BlockType&& block) {
+        this->blocks.push_back(std::move(block));
+    }
+};
+
+/*!
+ * Computes the maximal end components (bottom SCCs for deterministic models) on the decision diagrams and translates them to the given explicit model.
+ * The choices of the end components are taken from the explicit transition matrix, as the choice ordering of the symbolic representation is not preserved.
+ */
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+std::unique_ptr<storm::storage::Decomposition<typename SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::LongRunComponentType>>
+computeLongRunComponentDecomposition(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                     storm::storage::SparseMatrix<ValueType> const& explicitTransitionMatrix, storm::dd::Odd const& odd) {
+    using LongRunComponentType = typename SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::LongRunComponentType;
+    std::set<storm::expressions::Variable> choiceVariables;
+    if constexpr (Nondeterministic) {
+        choiceVariables = dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(model).getNondeterminismVariables();
+    }
+    auto components = storm::utility::dd::computeMaximalEndComponentDecomposition(model.getReachableStates(), transitionMatrix.notZero(),
+                                                                                 model.getRowVariables(), model.getColumnVariables(), choiceVariables,
+                                                                                 model.getRowColumnMetaVariablePairs());
+
+    auto result = std::make_unique<ProvidedDecomposition<LongRunComponentType>>();
+    for (auto const& component : components) {
+        storm::storage::BitVector states = component.first.toVector(odd);
+        LongRunComponentType block;
+        for (auto state : states) {
+            if constexpr (Nondeterministic) {
+                storm::storage::MaximalEndComponent::set_type choices;
+                for (uint64_t choice = explicitTransitionMatrix.getRowGroupIndices()[state]; choice < explicitTransitionMatrix.getRowGroupIndices()[state + 1];
+                     ++choice) {
+                    auto row = explicitTransitionMatrix.getRow(choice);
+                    if (std::all_of(row.begin(), row.end(), [&states](auto const& entry) { return states.get(entry.getColumn()); })) {
+                        choices.insert(choice);
+                    }
+                }
+                block.addState(state, std::move(choices));
+            } else {
+                block.insert(state);
+            }
+        }
+        result->addBlock(std::move(block));
+    }
+    return result;
+}
+}  // namespace detail
+
 template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
 HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::HybridInfiniteHorizonHelper(storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                                               storm::dd::Add<DdType, ValueType> const& transitionMatrix)
@@ -66,6 +126,10 @@ HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRun
         }
     }
     auto sparseHelper = createSparseHelper(explicitTransitionMatrix, explicitMarkovianStates, explicitExitRateVector, odd);
+    // The sparse helper only keeps a reference to the decomposition, so it has to outlive the computation below.
+    auto decomposition =
+        detail::computeLongRunComponentDecomposition<ValueType, DdType, Nondeterministic>(_model, _transitionMatrix, explicitTransitionMatrix, odd);
+    sparseHelper->provideLongRunComponentDecomposition(*decomposition);
     auto explicitResult = sparseHelper->computeLongRunAverageProbabilities(env, psiStates.toVector(odd));
     return std::make_unique<HybridQuantitativeCheckResult<DdType, ValueType>>(_model.getReachableStates(), _model.getManager().getBddZero(),
                                                                               _model.getManager().template getAddZero<ValueType>(), _model.getReachableStates(),
@@ -118,6 +182,10 @@ HybridInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRun
         }
     }
     auto sparseHelper = createSparseHelper(explicitTransitionMatrix, explicitMarkovianStates, explicitExitRateVector, odd);
+    // The sparse helper only keeps a reference to the decomposition, so it has to outlive the computation below.
+    auto decomposition =
+        detail::computeLongRunComponentDecomposition<ValueType, DdType, Nondeterministic>(_model, _transitionMatrix, explicitTransitionMatrix, odd);
+    sparseHelper->provideLongRunComponentDecomposition(*decomposition);
     auto explicitResult = sparseHelper->computeLongRunAverageValues(env, rewardModel.hasStateRewards() ? &explicitStateRewards : nullptr,
                                                                     rewardModel.hasStateActionRewards() ? &explicitActionRewards : nullptr);
     return std::make_unique<HybridQuantitativeCheckResult<DdType, ValueType>>(_model.getReachableStates(), _model.getManager().getBddZero(),
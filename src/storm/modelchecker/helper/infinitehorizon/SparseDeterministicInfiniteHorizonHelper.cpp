@@ -1,10 +1,14 @@
 #include "SparseDeterministicInfiniteHorizonHelper.h"
 
+#include <algorithm>
 #include <numeric>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
+#include "storm/modelchecker/helper/infinitehorizon/internal/AggregationDisaggregationHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
+#include "storm/modelchecker/helper/infinitehorizon/internal/GthSolver.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 
@@ -29,6 +33,13 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace detail {
+// BSCCs with at most this many states are solved directly (unless a specific algorithm is requested).
+uint64_t const maxNumberOfStatesOfDirectlySolvedBscc = 64;
+// When processing BSCCs concurrently, small BSCCs are batched into tasks with (roughly) this many states.
+uint64_t const numberOfStatesPerBatch = 4096;
+}  // namespace detail
+
 template<typename ValueType>
 SparseDeterministicInfiniteHorizonHelper<ValueType>::SparseDeterministicInfiniteHorizonHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix)
     : SparseInfiniteHorizonHelper<ValueType, false>(transitionMatrix) {
@@ -264,6 +275,8 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     if (alg == storm::SteadyStateDistributionAlgorithm::Automatic) {
         if (subEnv.solver().isForceSoundness()) {
             alg = storm::SteadyStateDistributionAlgorithm::ExpectedVisitingTimes;
+        } else if (bscc.size() <= detail::maxNumberOfStatesOfDirectlySolvedBscc) {
+            return computeSteadyStateDistrForBsccDirect(bscc);
         } else {
             alg = storm::SteadyStateDistributionAlgorithm::EquationSystem;
         }
@@ -274,6 +287,8 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
 
     if (alg == storm::SteadyStateDistributionAlgorithm::EquationSystem) {
         return computeSteadyStateDistrForBsccEqSys(subEnv, bscc);
+    } else if (alg == storm::SteadyStateDistributionAlgorithm::AggregationDisaggregation) {
+        return computeSteadyStateDistrForBsccIad(subEnv, bscc);
     } else {
         STORM_LOG_ASSERT(alg == storm::SteadyStateDistributionAlgorithm::ExpectedVisitingTimes,
                          "Unexpected algorithm for steady state distribution computation.");
@@ -347,6 +362,50 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     return visitingTimes;
 }
 
+template<typename ValueType>
+std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccDirect(
+    storm::storage::StronglyConnectedComponent const& bscc) {
+    STORM_LOG_ASSERT(std::is_sorted(bscc.begin(), bscc.end()), "Expected that bsccs are sorted.");
+    // Build a dense matrix with the transition probabilities (or rates) between the states of the BSCC.
+    uint64_t const numStates = bscc.size();
+    std::vector<ValueType> denseMatrix(numStates * numStates, storm::utility::zero<ValueType>());
+    uint64_t row = 0;
+    for (auto const& state : bscc) {
+        for (auto const& entry : this->_transitionMatrix.getRow(state)) {
+            if (storm::utility::isZero(entry.getValue())) {
+                continue;
+            }
+            auto const columnIt = std::lower_bound(bscc.begin(), bscc.end(), entry.getColumn());
+            STORM_LOG_ASSERT(columnIt != bscc.end() && *columnIt == entry.getColumn(), "Unexpected transition leaving the BSCC.");
+            auto& value = denseMatrix[row * numStates + std::distance(bscc.begin(), columnIt)];
+            value += this->isContinuousTime() ? ValueType(entry.getValue() * (*this->_exitRates)[state]) : entry.getValue();
+        }
+        ++row;
+    }
+    return internal::solveSteadyStateGth(denseMatrix, numStates);
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccIad(
+    Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) {
+    if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Aggregation-disaggregation is not supported for parametric models. Use a different steady state distribution algorithm.");
+        return {};
+    } else {
+        STORM_LOG_WARN_COND(!env.solver().isForceSoundness(),
+                            "Sound computations are not properly implemented for this computation. You might get incorrect results.");
+        internal::AggregationDisaggregationHelper<ValueType> iadHelper(this->_transitionMatrix, bscc, this->_exitRates);
+        if (iadHelper.getNumberOfBlocks() < 2) {
+            // There is no block structure to exploit.
+            return computeSteadyStateDistrForBsccEqSys(env, bscc);
+        }
+        STORM_LOG_INFO("Computing steady state distribution of BSCC with " << bscc.size() << " states using aggregation-disaggregation with "
+                                                                           << iadHelper.getNumberOfBlocks() << " blocks.");
+        return iadHelper.computeSteadyStateDistribution(env);
+    }
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::computeSteadyStateDistrForBsccEqSys(
     Environment const& env, storm::storage::StronglyConnectedComponent const& bscc) {
@@ -618,27 +677,95 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     auto bsccReachProbs = computeBsccReachabilityProbabilities(subEnv, initialDistributionGetter);
     // We are now ready to compute the resulting lra distribution
     std::vector<ValueType> steadyStateDistr(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-    for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
-        auto const& component = (*this->_longRunComponentDecomposition)[currentComponentIndex];
-        // Compute distribution for current bscc
-        auto bsccDistr = this->computeSteadyStateDistrForBscc(subEnv, component);
-        // Scale with probability to reach that bscc
-        auto const& scalingFactor = bsccReachProbs[currentComponentIndex];
-        if (!storm::utility::isOne(scalingFactor)) {
-            storm::utility::vector::scaleVectorInPlace(bsccDistr, scalingFactor);
-        }
-        // Set the values in the result vector
-        auto bsccDistrIt = bsccDistr.begin();
-        for (auto const& element : component) {
-            uint64_t state = internal::getComponentElementState(element);
-            steadyStateDistr[state] = *bsccDistrIt;
-            ++bsccDistrIt;
+    bool computeBsccsConcurrently = subEnv.solver().lra().isParallelComponentSolvingSet() && this->_longRunComponentDecomposition->size() > 1;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!computeBsccsConcurrently, "Storm was built without support for Intel TBB, defaulting to sequential component processing.");
+    computeBsccsConcurrently = false;
+#endif
+    if (computeBsccsConcurrently && !this->isConcurrentComponentComputationSupported(subEnv)) {
+        STORM_LOG_WARN(
+            "Concurrent processing of bottom strongly connected components is not supported for the selected value type. Processing them sequentially.");
+        computeBsccsConcurrently = false;
+    }
+    if (computeBsccsConcurrently) {
+        computeScaledSteadyStateDistrForBsccsConcurrently(subEnv, bsccReachProbs, steadyStateDistr);
+    } else {
+        for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+            computeScaledSteadyStateDistrForBscc(subEnv, currentComponentIndex, bsccReachProbs[currentComponentIndex], steadyStateDistr);
         }
-        STORM_LOG_ASSERT(bsccDistrIt == bsccDistr.end(), "Unexpected number of entries in bscc distribution");
     }
     return steadyStateDistr;
 }
 
+template<typename ValueType>
+void SparseDeterministicInfiniteHorizonHelper<ValueType>::computeScaledSteadyStateDistrForBscc(Environment const& env, uint64_t bsccIndex,
+                                                                                               ValueType const& scalingFactor, std::vector<ValueType>& result) {
+    auto const& component = (*this->_longRunComponentDecomposition)[bsccIndex];
+    // Compute distribution for current bscc
+    auto bsccDistr = this->computeSteadyStateDistrForBscc(env, component);
+    // Scale with probability to reach that bscc
+    if (!storm::utility::isOne(scalingFactor)) {
+        storm::utility::vector::scaleVectorInPlace(bsccDistr, scalingFactor);
+    }
+    // Set the values in the result vector
+    auto bsccDistrIt = bsccDistr.begin();
+    for (auto const& element : component) {
+        uint64_t state = internal::getComponentElementState(element);
+        result[state] = *bsccDistrIt;
+        ++bsccDistrIt;
+    }
+    STORM_LOG_ASSERT(bsccDistrIt == bsccDistr.end(), "Unexpected number of entries in bscc distribution");
+}
+
+template<typename ValueType>
+void SparseDeterministicInfiniteHorizonHelper<ValueType>::computeScaledSteadyStateDistrForBsccsConcurrently(Environment const& env,
+                                                                                                            std::vector<ValueType> const& scalingFactors,
+                                                                                                            std::vector<ValueType>& result) {
+#ifdef STORM_HAVE_INTELTBB
+    // Some methods compute the backward transitions on demand. We compute them beforehand to avoid that this happens concurrently.
+    this->createBackwardTransitions();
+
+    // Start with the largest BSCCs as they typically take longest.
+    auto const& bsccs = *this->_longRunComponentDecomposition;
+    std::vector<uint64_t> bsccOrder(bsccs.size());
+    std::iota(bsccOrder.begin(), bsccOrder.end(), 0ull);
+    std::stable_sort(bsccOrder.begin(), bsccOrder.end(), [&bsccs](uint64_t lhs, uint64_t rhs) { return bsccs[lhs].size() > bsccs[rhs].size(); });
+
+    // Each large BSCC gets its own task. Small BSCCs are cheap to solve, so we batch them to reduce the scheduling overhead.
+    // The i-th task processes the BSCCs bsccOrder[taskStarts[i]], ..., bsccOrder[taskStarts[i+1] - 1].
+    std::vector<uint64_t> taskStarts;
+    bool isBatchOpen = false;
+    uint64_t numberOfStatesInTask = 0;
+    for (uint64_t i = 0; i < bsccOrder.size(); ++i) {
+        uint64_t const bsccSize = bsccs[bsccOrder[i]].size();
+        bool const isSmall = bsccSize <= detail::maxNumberOfStatesOfDirectlySolvedBscc;
+        if (!isSmall || !isBatchOpen || numberOfStatesInTask >= detail::numberOfStatesPerBatch) {
+            taskStarts.push_back(i);
+            numberOfStatesInTask = 0;
+        }
+        isBatchOpen = isSmall;
+        numberOfStatesInTask += bsccSize;
+    }
+    taskStarts.push_back(bsccOrder.size());
+
+    // The BSCCs are disjoint, so each task only writes values for states of its own BSCCs.
+    tbb::parallel_for(
+        tbb::blocked_range<uint64_t>(0, taskStarts.size() - 1, 1),
+        [&](tbb::blocked_range<uint64_t> const& range) {
+            // Each task uses its own environment
+            storm::Environment taskEnvironment(env);
+            for (auto task = range.begin(); task < range.end(); ++task) {
+                for (uint64_t i = taskStarts[task]; i < taskStarts[task + 1]; ++i) {
+                    computeScaledSteadyStateDistrForBscc(taskEnvironment, bsccOrder[i], scalingFactors[bsccOrder[i]], result);
+                }
+            }
+        },
+        tbb::simple_partitioner());
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Concurrent processing of components requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType>
 std::vector<ValueType> computeUpperBoundsForExpectedVisitingTimes(storm::storage::SparseMatrix<ValueType> const& nonBsccMatrix,
                                                                   std::vector<ValueType> const& toBsccProbabilities) {
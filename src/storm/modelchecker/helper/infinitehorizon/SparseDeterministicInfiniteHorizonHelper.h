@@ -68,6 +68,24 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
     std::vector<ValueType> computeSteadyStateDistrForBscc(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
     std::vector<ValueType> computeSteadyStateDistrForBsccEqSys(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
     std::vector<ValueType> computeSteadyStateDistrForBsccEVTs(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
+    std::vector<ValueType> computeSteadyStateDistrForBsccIad(Environment const& env, storm::storage::StronglyConnectedComponent const& bscc);
+
+    /*!
+     * Computes the steady state distribution for the given BSCC by solving a dense equation system. Only suitable for small BSCCs.
+     */
+    std::vector<ValueType> computeSteadyStateDistrForBsccDirect(storm::storage::StronglyConnectedComponent const& bscc);
+
+    /*!
+     * Computes the steady state distribution of the BSCC with the given index, scales it with the given factor and inserts it into the given result vector.
+     */
+    void computeScaledSteadyStateDistrForBscc(Environment const& env, uint64_t bsccIndex, ValueType const& scalingFactor, std::vector<ValueType>& result);
+
+    /*!
+     * As computeScaledSteadyStateDistrForBscc, but processes all BSCCs concurrently, where each task uses its own copy of the given environment.
+     * Larger BSCCs are started first and small BSCCs are processed in batches.
+     */
+    void computeScaledSteadyStateDistrForBsccsConcurrently(Environment const& env, std::vector<ValueType> const& scalingFactors,
+                                                           std::vector<ValueType>& result);
 
     std::pair<bool, ValueType> computeLraForTrivialBscc(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                         storm::storage::StronglyConnectedComponent const& bscc);
@@ -1,8 +1,12 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <numeric>
+#include <type_traits>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -15,6 +19,7 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -24,6 +29,7 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
 
 namespace storm {
@@ -169,11 +175,26 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
+    bool computeComponentsConcurrently = env.solver().lra().isParallelComponentSolvingSet() && _longRunComponentDecomposition->size() > 1;
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!computeComponentsConcurrently, "Storm was built without support for Intel TBB, defaulting to sequential component processing.");
+    computeComponentsConcurrently = false;
+#endif
+    if (computeComponentsConcurrently && !isConcurrentComponentComputationSupported(underlyingSolverEnvironment)) {
+        STORM_LOG_WARN("Concurrent processing of " << componentString
+                                                    << " is not supported for the selected method and value type. Processing them sequentially.");
+        computeComponentsConcurrently = false;
+    }
     std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+    if (computeComponentsConcurrently) {
+        componentLraValues = computeLraForComponentsConcurrently(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter);
         progress.updateProgress(componentLraValues.size());
+    } else {
+        componentLraValues.reserve(_longRunComponentDecomposition->size());
+        for (auto const& c : *_longRunComponentDecomposition) {
+            componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+            progress.updateProgress(componentLraValues.size());
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -196,6 +217,46 @@ void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::createBackwardTra
     }
 }
 
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isConcurrentComponentComputationSupported(Environment const&) const {
+    return storm::NumberTraits<ValueType>::IsThreadSafe;
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponentsConcurrently(Environment const& env,
+                                                                                                                     ValueGetter const& stateValuesGetter,
+                                                                                                                     ValueGetter const& actionValuesGetter) {
+#ifdef STORM_HAVE_INTELTBB
+    // Some methods compute the backward transitions on demand. We compute them beforehand to avoid that this happens concurrently.
+    createBackwardTransitions();
+
+    // Start with the largest components as they typically take longest.
+    std::vector<uint64_t> componentOrder(_longRunComponentDecomposition->size());
+    std::iota(componentOrder.begin(), componentOrder.end(), 0ull);
+    std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t lhs, uint64_t rhs) {
+        return (*_longRunComponentDecomposition)[lhs].size() > (*_longRunComponentDecomposition)[rhs].size();
+    });
+
+    // The components are disjoint, so each task only writes choices for states of its own component.
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size(), storm::utility::zero<ValueType>());
+    tbb::parallel_for(
+        tbb::blocked_range<uint64_t>(0, componentOrder.size(), 1),
+        [&](tbb::blocked_range<uint64_t> const& range) {
+            // Each task uses its own environment
+            storm::Environment taskEnvironment(env);
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                uint64_t const componentIndex = componentOrder[i];
+                componentLraValues[componentIndex] =
+                    computeLraForComponent(taskEnvironment, stateValuesGetter, actionValuesGetter, (*_longRunComponentDecomposition)[componentIndex]);
+            }
+        },
+        tbb::simple_partitioner());
+    return componentLraValues;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Concurrent processing of components requires Intel TBB.");
+#endif
+}
+
 template class SparseInfiniteHorizonHelper<double, true>;
 template class SparseInfiniteHorizonHelper<storm::RationalNumber, true>;
 
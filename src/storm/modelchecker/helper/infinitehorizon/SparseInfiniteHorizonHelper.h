@@ -118,6 +118,19 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     void createBackwardTransitions();
 
+    /*!
+     * @return true iff computeLraForComponent may be invoked concurrently for different components using the given environment.
+     */
+    virtual bool isConcurrentComponentComputationSupported(Environment const& env) const;
+
+    /*!
+     * Computes the LRA values of all components concurrently, where each component is processed with its own copy of the given environment.
+     * Larger components are started first.
+     * @return the LRA values of the components in the order of the decomposition.
+     */
+    std::vector<ValueType> computeLraForComponentsConcurrently(Environment const& env, ValueGetter const& stateValuesGetter,
+                                                               ValueGetter const& actionValuesGetter);
+
     /*!
      * @post _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
      */
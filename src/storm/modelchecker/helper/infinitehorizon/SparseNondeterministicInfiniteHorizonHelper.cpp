@@ -95,6 +95,20 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
+    storm::solver::LraMethod method = getMecLraMethod(env);
+    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
+                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
+    if (method == storm::solver::LraMethod::LinearProgramming) {
+        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
+    }
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getMecLraMethod(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
         method != storm::solver::LraMethod::LinearProgramming) {
@@ -108,15 +122,13 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
             "specify a different LRA method.");
         method = storm::solver::LraMethod::ValueIteration;
     }
-    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
-                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
-    if (method == storm::solver::LraMethod::LinearProgramming) {
-        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
-    }
+    return method;
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isConcurrentComponentComputationSupported(Environment const& env) const {
+    return SparseInfiniteHorizonHelper<ValueType, true>::isConcurrentComponentComputationSupported(env) &&
+           getMecLraMethod(env) == storm::solver::LraMethod::ValueIteration;
 }
 
 template<typename ValueType>
@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -65,6 +66,16 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    /*!
+     * @return the method that is used to compute the LRA value of non-trivial MECs under the given environment.
+     */
+    storm::solver::LraMethod getMecLraMethod(Environment const& env) const;
+
+    /*!
+     * Only value iteration is supported since LP solvers might share global data between different instances.
+     */
+    virtual bool isConcurrentComponentComputationSupported(Environment const& env) const override;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
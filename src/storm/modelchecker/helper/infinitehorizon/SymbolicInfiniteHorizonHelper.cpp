@@ -0,0 +1,211 @@
+#include "storm/modelchecker/helper/infinitehorizon/SymbolicInfiniteHorizonHelper.h"
+
+#include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/models/symbolic/NondeterministicModel.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::SymbolicInfiniteHorizonHelper(
+    storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix)
+    : _model(model), _transitionMatrix(transitionMatrix) {
+    STORM_LOG_ASSERT(model.isNondeterministicModel() == Nondeterministic, "Template Parameter does not match model type.");
+    STORM_LOG_THROW(model.isDiscreteTimeModel(), storm::exceptions::NotSupportedException,
+                    "Long run average computations on decision diagrams are only supported for discrete time models.");
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>>
+SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageProbabilities(Environment const& env,
+                                                                                                       storm::dd::Bdd<DdType> const& psiStates) {
+    return computeLongRunAverageValues(env, psiStates.template toAdd<ValueType>());
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>>
+SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageRewards(
+    Environment const& env, storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel) {
+    STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Transition rewards are not supported in this engine.");
+    storm::dd::Add<DdType, ValueType> choiceValues = _model.getManager().template getAddZero<ValueType>();
+    if (rewardModel.hasStateRewards()) {
+        choiceValues += rewardModel.getStateRewardVector();
+    }
+    if (rewardModel.hasStateActionRewards()) {
+        choiceValues += rewardModel.getStateActionRewardVector();
+    }
+    return computeLongRunAverageValues(env, choiceValues);
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>>
+SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeLongRunAverageValues(Environment const& env,
+                                                                                                storm::dd::Add<DdType, ValueType> const& choiceValues) {
+    STORM_LOG_WARN_COND(!this->isProduceSchedulerSet(), "Scheduler extraction not supported in Dd engine.");
+    storm::dd::DdManager<DdType> const& manager = _model.getManager();
+    storm::dd::Bdd<DdType> const& reachableStates = _model.getReachableStates();
+    std::set<storm::expressions::Variable> const choiceVariables = getChoiceVariables();
+    auto const& pairs = _model.getRowColumnMetaVariablePairs();
+
+    // Decompose the model into its maximal end components.
+    storm::dd::Bdd<DdType> const transitions = _transitionMatrix.notZero();
+    auto endComponents = storm::utility::dd::computeMaximalEndComponentDecomposition(reachableStates, transitions, _model.getRowVariables(),
+                                                                                    _model.getColumnVariables(), choiceVariables, pairs);
+    storm::dd::Bdd<DdType> endComponentRelation = manager.getBddZero();
+    storm::dd::Bdd<DdType> endComponentStates = manager.getBddZero();
+    storm::dd::Bdd<DdType> endComponentChoices = manager.getBddZero();
+    for (auto const& endComponent : endComponents) {
+        endComponentRelation |= endComponent.first && endComponent.first.swapVariables(pairs);
+        endComponentStates |= endComponent.first;
+        endComponentChoices |= endComponent.second;
+    }
+    STORM_LOG_INFO("Found " << endComponents.size() << " " << (Nondeterministic ? "maximal end components" : "bottom SCCs") << " with "
+                            << endComponentStates.getNonZeroCount() << " states.");
+
+    storm::dd::Add<DdType, ValueType> gains = computeEndComponentGains(env, endComponentRelation, endComponentStates, endComponentChoices, choiceValues);
+
+    // Compute the optimal value of the gains of the end components that are eventually reached. Each end component is collapsed into a single state
+    // which has the choices leaving the end component and an additional choice to stay and obtain the gain.
+    bool const minimize = isMinimize();
+    auto optimize = [minimize](storm::dd::Add<DdType, ValueType> const& values, std::set<storm::expressions::Variable> const& variables) {
+        return minimize ? values.minAbstract(variables) : values.maxAbstract(variables);
+    };
+    storm::dd::Add<DdType, ValueType> const neutral =
+        manager.getConstant(minimize ? storm::utility::infinity<ValueType>() : -storm::utility::infinity<ValueType>());
+    storm::dd::Add<DdType, ValueType> const stayValues = endComponentStates.ite(gains, neutral);
+    storm::dd::Bdd<DdType> const exitChoices = transitions.existsAbstract(_model.getColumnVariables()) && !endComponentChoices;
+    storm::dd::Add<DdType, ValueType> const exitTransitions = _transitionMatrix * exitChoices.template toAdd<ValueType>();
+
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool const relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t const maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    storm::dd::Add<DdType, ValueType> values = reachableStates.ite(gains, manager.template getAddZero<ValueType>());
+    uint64_t iterations = 0;
+    bool converged = false;
+    while (!converged && iterations < maxIter) {
+        storm::dd::Add<DdType, ValueType> exitValues = exitChoices.ite(
+            exitTransitions.multiplyMatrix(values.swapVariables(pairs), _model.getColumnVariables()), neutral);
+        exitValues = optimize(exitValues, choiceVariables);
+        storm::dd::Add<DdType, ValueType> collapsedValues =
+            endComponentStates.ite(optimize(endComponentRelation.ite(exitValues.swapVariables(pairs), neutral), _model.getColumnVariables()), exitValues);
+        storm::dd::Add<DdType, ValueType> newValues =
+            reachableStates.ite(minimize ? collapsedValues.minimum(stayValues) : collapsedValues.maximum(stayValues), manager.template getAddZero<ValueType>());
+
+        converged = newValues.equalModuloPrecision(values, precision, relative);
+        values = std::move(newValues);
+        ++iterations;
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+    if (converged) {
+        STORM_LOG_TRACE("Long run average values of transient states converged after " << iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Long run average values of transient states did not converge within " << iterations << " iterations.");
+    }
+    return std::make_unique<SymbolicQuantitativeCheckResult<DdType, ValueType>>(reachableStates, values);
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+storm::dd::Add<DdType, ValueType> SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::computeEndComponentGains(
+    Environment const& env, storm::dd::Bdd<DdType> const& endComponentRelation, storm::dd::Bdd<DdType> const& endComponentStates,
+    storm::dd::Bdd<DdType> const& endComponentChoices, storm::dd::Add<DdType, ValueType> const& choiceValues) const {
+    storm::dd::DdManager<DdType> const& manager = _model.getManager();
+    auto const& pairs = _model.getRowColumnMetaVariablePairs();
+    bool const minimize = isMinimize();
+    auto optimize = [minimize](storm::dd::Add<DdType, ValueType> const& values, std::set<storm::expressions::Variable> const& variables) {
+        return minimize ? values.minAbstract(variables) : values.maxAbstract(variables);
+    };
+    storm::dd::Add<DdType, ValueType> const zero = manager.template getAddZero<ValueType>();
+    storm::dd::Add<DdType, ValueType> const infinity = manager.getConstant(storm::utility::infinity<ValueType>());
+    storm::dd::Add<DdType, ValueType> const neutral = minimize ? infinity : -infinity;
+
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().lra().getPrecision());
+    bool const relative = env.solver().lra().getRelativeTerminationCriterion();
+    boost::optional<uint64_t> maxIter;
+    if (env.solver().lra().isMaximalIterationCountSet()) {
+        maxIter = env.solver().lra().getMaximalIterationCount();
+    }
+
+    // The aperiodic transformation (which stays in the current state with the aperiodic factor) does not change the gain but guarantees convergence.
+    ValueType const aperiodicFactor = storm::utility::convertNumber<ValueType>(env.solver().lra().getAperiodicFactor());
+    storm::dd::Add<DdType, ValueType> const stayFactor = manager.getConstant(aperiodicFactor);
+    storm::dd::Add<DdType, ValueType> const endComponentTransitions =
+        _transitionMatrix * endComponentChoices.template toAdd<ValueType>() * manager.getConstant(storm::utility::one<ValueType>() - aperiodicFactor);
+
+    storm::dd::Add<DdType, ValueType> values = zero;
+    storm::dd::Add<DdType, ValueType> gains = zero;
+    uint64_t iterations = 0;
+    bool converged = false;
+    while (!converged && (!maxIter || iterations < maxIter.get())) {
+        storm::dd::Add<DdType, ValueType> newValues = endComponentTransitions.multiplyMatrix(values.swapVariables(pairs), _model.getColumnVariables());
+        newValues += values * stayFactor + choiceValues;
+        newValues = endComponentStates.ite(optimize(endComponentChoices.ite(newValues, neutral), getChoiceVariables()), zero);
+
+        // The largest and smallest difference within each end component bound its gain.
+        storm::dd::Add<DdType, ValueType> differenceAsColumn = (newValues - values).swapVariables(pairs);
+        storm::dd::Add<DdType, ValueType> upper =
+            endComponentStates.ite(endComponentRelation.ite(differenceAsColumn, -infinity).maxAbstract(_model.getColumnVariables()), zero);
+        storm::dd::Add<DdType, ValueType> lower =
+            endComponentStates.ite(endComponentRelation.ite(differenceAsColumn, infinity).minAbstract(_model.getColumnVariables()), zero);
+        gains = (upper + lower) * manager.getConstant(storm::utility::convertNumber<ValueType>(0.5));
+        storm::dd::Add<DdType, ValueType> bound = manager.getConstant(storm::utility::convertNumber<ValueType>(2.0) * precision);
+        if (relative) {
+            bound *= gains.maximum(-gains);
+        }
+        converged = (endComponentStates && !(upper - lower).lessOrEqual(bound)).isZero();
+
+        // Shifting the values of each end component by a constant does not affect the differences but keeps the values small.
+        values = newValues - lower;
+        ++iterations;
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+    if (converged) {
+        STORM_LOG_TRACE("Gains of the end components converged after " << iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Gains of the end components did not converge within " << iterations << " iterations.");
+    }
+    return gains;
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+std::set<storm::expressions::Variable> SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::getChoiceVariables() const {
+    if constexpr (Nondeterministic) {
+        return dynamic_cast<storm::models::symbolic::NondeterministicModel<DdType, ValueType> const&>(_model).getNondeterminismVariables();
+    } else {
+        return {};
+    }
+}
+
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+bool SymbolicInfiniteHorizonHelper<ValueType, DdType, Nondeterministic>::isMinimize() const {
+    if constexpr (Nondeterministic) {
+        return this->minimize();
+    } else {
+        return false;
+    }
+}
+
+template class SymbolicInfiniteHorizonHelper<double, storm::dd::DdType::CUDD, false>;
+template class SymbolicInfiniteHorizonHelper<double, storm::dd::DdType::CUDD, true>;
+template class SymbolicInfiniteHorizonHelper<double, storm::dd::DdType::Sylvan, false>;
+template class SymbolicInfiniteHorizonHelper<double, storm::dd::DdType::Sylvan, true>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,75 @@
+#pragma once
+#include "storm/modelchecker/helper/SingleValueModelCheckerHelper.h"
+
+#include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
+
+#include "storm/models/symbolic/Model.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+namespace storm {
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Helper class for model checking queries that depend on the long run behavior of a discrete time (nondeterministic) system that is solved entirely on
+ * decision diagrams, i.e., without translating the model to an explicit representation.
+ *
+ * The maximal end components (bottom SCCs for DTMCs) are computed symbolically. The optimal long run average value (gain) of all components is then
+ * computed simultaneously with (relative) value iteration on the aperiodic transformation of the components. Finally, the values of the remaining states
+ * are obtained by optimizing the gain of the reached component, where each component is collapsed to a single state.
+ */
+template<typename ValueType, storm::dd::DdType DdType, bool Nondeterministic>
+class SymbolicInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueType, storm::models::GetModelRepresentation<DdType>::representation> {
+   public:
+    /*!
+     * Initializes the helper for a discrete time model (MDP or DTMC)
+     */
+    SymbolicInfiniteHorizonHelper(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix);
+
+    /*!
+     * Computes the long run average probabilities, i.e., the fraction of the time we are in a psiState
+     * @return a value for each state
+     */
+    std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>> computeLongRunAverageProbabilities(Environment const& env,
+                                                                                                           storm::dd::Bdd<DdType> const& psiStates);
+
+    /*!
+     * Computes the long run average rewards, i.e., the average reward collected per time unit
+     * @return a value for each state
+     */
+    std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>> computeLongRunAverageRewards(
+        Environment const& env, storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel);
+
+   private:
+    /*!
+     * Computes the long run average of the given values that are collected in each step.
+     * @param choiceValues the value collected when taking a choice (over the row and nondeterminism variables).
+     */
+    std::unique_ptr<SymbolicQuantitativeCheckResult<DdType, ValueType>> computeLongRunAverageValues(Environment const& env,
+                                                                                                    storm::dd::Add<DdType, ValueType> const& choiceValues);
+
+    /*!
+     * Computes the optimal gain of each of the given end components with relative value iteration.
+     * @param endComponentRelation relates all states of the same end component (over the row and column variables)
+     * @param endComponentChoices the choices that stay within the end component of their state
+     * @return the gain for each state of an end component and zero for all other states.
+     */
+    storm::dd::Add<DdType, ValueType> computeEndComponentGains(Environment const& env, storm::dd::Bdd<DdType> const& endComponentRelation,
+                                                               storm::dd::Bdd<DdType> const& endComponentStates,
+                                                               storm::dd::Bdd<DdType> const& endComponentChoices,
+                                                               storm::dd::Add<DdType, ValueType> const& choiceValues) const;
+
+    std::set<storm::expressions::Variable> getChoiceVariables() const;
+    bool isMinimize() const;
+
+    storm::models::symbolic::Model<DdType, ValueType> const& _model;
+    storm::dd::Add<DdType, ValueType> const& _transitionMatrix;
+};
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,256 @@
+#include "AggregationDisaggregationHelper.h"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/modelchecker/helper/infinitehorizon/internal/GthSolver.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+#include "storm/exceptions/UnmetRequirementException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+namespace detail {
+// Transitions with at least this (embedded) probability connect states within the same block.
+double const strongCouplingThreshold = 0.1;
+// The coupling matrix is dense, so we merge consecutive blocks if there are more than this many.
+uint64_t const maxNumberOfBlocks = 512;
+}  // namespace detail
+
+template<typename ValueType>
+AggregationDisaggregationHelper<ValueType>::AggregationDisaggregationHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                            storm::storage::StronglyConnectedComponent const& bscc,
+                                                                            std::vector<ValueType> const* exitRates) {
+    STORM_LOG_ASSERT(std::is_sorted(bscc.begin(), bscc.end()), "Expected that bsccs are sorted.");
+    storm::storage::BitVector bsccStates(transitionMatrix.getRowCount(), false);
+    for (auto const& globalIndex : bscc) {
+        bsccStates.set(globalIndex, true);
+    }
+    auto bsccMatrix = transitionMatrix.getSubmatrix(false, bsccStates, bsccStates, true);  // add diagonal entries!
+    createBlocks(bsccMatrix);
+
+    // For continuous time models, we uniformize the BSCC, which preserves the steady state distribution.
+    if (exitRates) {
+        ValueType uniformizationRate = storm::utility::zero<ValueType>();
+        for (auto const& globalIndex : bscc) {
+            uniformizationRate = std::max(uniformizationRate, (*exitRates)[globalIndex]);
+        }
+        uint64_t row = 0;
+        for (auto const& globalIndex : bscc) {
+            ValueType const factor = (*exitRates)[globalIndex] / uniformizationRate;
+            for (auto& entry : bsccMatrix.getRow(row)) {
+                if (entry.getColumn() == row) {
+                    entry.setValue(storm::utility::one<ValueType>() - factor * (storm::utility::one<ValueType>() - entry.getValue()));
+                } else {
+                    entry.setValue(entry.getValue() * factor);
+                }
+            }
+            ++row;
+        }
+    }
+    selfLoopProbabilities.assign(bsccMatrix.getRowCount(), storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < bsccMatrix.getRowCount(); ++row) {
+        for (auto const& entry : bsccMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                selfLoopProbabilities[row] = entry.getValue();
+            }
+        }
+    }
+    backwardProbabilities = bsccMatrix.transpose();
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::createBlocks(storm::storage::SparseMatrix<ValueType> const& bsccMatrix) {
+    uint64_t const numStates = bsccMatrix.getRowCount();
+    ValueType const threshold = storm::utility::convertNumber<ValueType>(detail::strongCouplingThreshold);
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numStates, numStates);
+    for (uint64_t row = 0; row < numStates; ++row) {
+        for (auto const& entry : bsccMatrix.getRow(row)) {
+            if (entry.getColumn() != row && entry.getValue() >= threshold) {
+                builder.addNextValue(row, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccs(
+        builder.build(), storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+
+    // The SCCs are sorted such that successors come first. We process the blocks in reversed order so that the inflow of a block is mostly up to date.
+    uint64_t const minBlockSize = (numStates + detail::maxNumberOfBlocks - 1) / detail::maxNumberOfBlocks;
+    blocks.clear();
+    blocks.emplace_back();
+    for (auto sccIt = sccs.rbegin(); sccIt != sccs.rend(); ++sccIt) {
+        if (blocks.back().size() >= minBlockSize) {
+            blocks.emplace_back();
+        }
+        blocks.back().insert(blocks.back().end(), sccIt->begin(), sccIt->end());
+    }
+    stateToBlockMap.resize(numStates);
+    for (uint64_t block = 0; block < blocks.size(); ++block) {
+        std::sort(blocks[block].begin(), blocks[block].end());
+        for (auto const& state : blocks[block]) {
+            stateToBlockMap[state] = block;
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t AggregationDisaggregationHelper<ValueType>::getNumberOfBlocks() const {
+    return blocks.size();
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::createBlockSolvers(Environment const& env) {
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool const isEquationSystemFormat =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    blockSolvers.clear();
+    blockSolvers.resize(blocks.size());
+    storm::storage::BitVector blockStates(backwardProbabilities.getRowCount(), false);
+    for (uint64_t block = 0; block < blocks.size(); ++block) {
+        if (blocks[block].size() == 1) {
+            continue;
+        }
+        blockStates.clear();
+        for (auto const& state : blocks[block]) {
+            blockStates.set(state, true);
+        }
+        // The equations for the block are x = x*P_block + inflow, i.e., x = P_block^t*x + inflow.
+        auto blockMatrix = backwardProbabilities.getSubmatrix(false, blockStates, blockStates, true);
+        if (isEquationSystemFormat) {
+            blockMatrix.convertToEquationSystem();
+        }
+        auto& solver = blockSolvers[block];
+        solver = linearEquationSolverFactory.create(env, std::move(blockMatrix));
+        solver->setLowerBound(storm::utility::zero<ValueType>());
+        solver->setCachingEnabled(true);
+        auto requirements = solver->getRequirements(env);
+        requirements.clearLowerBounds();
+        STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UnmetRequirementException,
+                        "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+    }
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::aggregateAndDisaggregate(std::vector<ValueType>& distribution) const {
+    uint64_t const numBlocks = blocks.size();
+    std::vector<ValueType> blockProbabilities(numBlocks, storm::utility::zero<ValueType>());
+    for (uint64_t state = 0; state < distribution.size(); ++state) {
+        blockProbabilities[stateToBlockMap[state]] += distribution[state];
+    }
+    // The weight of a state within its block. If the block has no probability, we assume a uniform distribution within the block.
+    auto weight = [&](uint64_t state) {
+        uint64_t const block = stateToBlockMap[state];
+        if (storm::utility::isZero(blockProbabilities[block])) {
+            return storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType, uint64_t>(blocks[block].size());
+        } else {
+            return distribution[state] / blockProbabilities[block];
+        }
+    };
+
+    // Build and solve the coupling matrix
+    std::vector<ValueType> couplingMatrix(numBlocks * numBlocks, storm::utility::zero<ValueType>());
+    for (uint64_t state = 0; state < backwardProbabilities.getRowCount(); ++state) {
+        uint64_t const column = stateToBlockMap[state];
+        for (auto const& entry : backwardProbabilities.getRow(state)) {
+            couplingMatrix[stateToBlockMap[entry.getColumn()] * numBlocks + column] += weight(entry.getColumn()) * entry.getValue();
+        }
+    }
+    auto aggregatedDistribution = solveSteadyStateGth(couplingMatrix, numBlocks);
+
+    // Disaggregate
+    for (uint64_t state = 0; state < distribution.size(); ++state) {
+        distribution[state] = aggregatedDistribution[stateToBlockMap[state]] * weight(state);
+    }
+}
+
+template<typename ValueType>
+void AggregationDisaggregationHelper<ValueType>::performBlockGaussSeidelStep(Environment const& env, std::vector<ValueType>& distribution) const {
+    std::vector<ValueType> blockValues, blockInflow;
+    for (uint64_t block = 0; block < blocks.size(); ++block) {
+        auto const& states = blocks[block];
+        blockValues.clear();
+        blockInflow.clear();
+        for (auto const& state : states) {
+            ValueType inflow = storm::utility::zero<ValueType>();
+            for (auto const& entry : backwardProbabilities.getRow(state)) {
+                if (stateToBlockMap[entry.getColumn()] != block) {
+                    inflow += entry.getValue() * distribution[entry.getColumn()];
+                }
+            }
+            blockValues.push_back(distribution[state]);
+            blockInflow.push_back(std::move(inflow));
+        }
+        if (states.size() == 1) {
+            // The probability to stay in a state of a BSCC with more than one state is less than one.
+            distribution[states.front()] = blockInflow.front() / (storm::utility::one<ValueType>() - selfLoopProbabilities[states.front()]);
+        } else {
+            blockSolvers[block]->solveEquations(env, blockValues, blockInflow);
+            for (uint64_t i = 0; i < states.size(); ++i) {
+                distribution[states[i]] = blockValues[i];
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> AggregationDisaggregationHelper<ValueType>::computeSteadyStateDistribution(Environment const& env) {
+    STORM_LOG_ASSERT(blocks.size() > 1, "Aggregation-disaggregation requires at least two blocks.");
+    createBlockSolvers(env);
+
+    ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().lra().getPrecision());
+    bool const relative = env.solver().lra().getRelativeTerminationCriterion();
+    std::optional<uint64_t> maxIter;
+    if (env.solver().lra().isMaximalIterationCountSet()) {
+        maxIter = env.solver().lra().getMaximalIterationCount();
+    }
+
+    uint64_t const numStates = backwardProbabilities.getRowCount();
+    std::vector<ValueType> distribution(numStates, storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType, uint64_t>(numStates));
+    std::vector<ValueType> previousDistribution;
+    uint64_t iter = 0;
+    while (!maxIter.has_value() || iter < maxIter.value()) {
+        ++iter;
+        previousDistribution = distribution;
+        aggregateAndDisaggregate(distribution);
+        performBlockGaussSeidelStep(env, distribution);
+        ValueType const sum = std::accumulate(distribution.begin(), distribution.end(), storm::utility::zero<ValueType>());
+        storm::utility::vector::scaleVectorInPlace(distribution, storm::utility::one<ValueType>() / sum);
+
+        if (storm::utility::vector::equalModuloPrecision(previousDistribution, distribution, precision, relative)) {
+            break;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+    if (maxIter.has_value() && iter == maxIter.value()) {
+        STORM_LOG_WARN("Aggregation-disaggregation did not converge within " << iter << " iterations.");
+    } else if (storm::utility::resources::isTerminate()) {
+        STORM_LOG_WARN("Aggregation-disaggregation aborted after " << iter << " iterations.");
+    } else {
+        STORM_LOG_TRACE("Aggregation-disaggregation converged after " << iter << " iterations.");
+    }
+    return distribution;
+}
+
+template class AggregationDisaggregationHelper<double>;
+template class AggregationDisaggregationHelper<storm::RationalNumber>;
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
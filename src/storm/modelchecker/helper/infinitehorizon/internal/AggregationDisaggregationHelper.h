@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+
+namespace storm {
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+/*!
+ * Helper class that computes the steady state distribution of a BSCC using iterative aggregation-disaggregation (IAD).
+ * The states of the BSCC are partitioned into blocks. Each iteration
+ *  - solves the (small) coupling matrix that describes the transitions between the blocks, weighted with the current distribution,
+ *  - disaggregates the resulting block probabilities onto the states and
+ *  - performs a block Gauss-Seidel step in which the equation system of each block is solved with a linear equation solver.
+ * The method converges fast if the transitions between blocks are weak compared to those within the blocks (nearly completely decomposable chains).
+ * Blocks are obtained as the SCCs of the graph that only considers transitions with a large (embedded) probability.
+ *
+ * @see Koury, McAllister, Stewart: Iterative Methods for Computing Stationary Distributions of Nearly Completely Decomposable Markov Chains (1984),
+ * https://doi.org/10.1137/0605040
+ */
+template<typename ValueType>
+class AggregationDisaggregationHelper {
+   public:
+    /*!
+     * Prepares the computation for the given BSCC.
+     * @param transitionMatrix The (probabilistic) transition matrix of the model
+     * @param bscc The (sorted) states of the BSCC.
+     * @param exitRates The exit rates of the states for continuous time models and nullptr otherwise.
+     */
+    AggregationDisaggregationHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::StronglyConnectedComponent const& bscc,
+                                    std::vector<ValueType> const* exitRates);
+
+    /*!
+     * @return the number of blocks in which the states of the BSCC are partitioned.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+    /*!
+     * Computes the steady state distribution. Convergence is checked w.r.t. the precision of the long run average environment and the equation systems of the
+     * blocks are solved w.r.t. the linear equation solver environment.
+     * @return the steady state distribution, where the i-th entry refers to the i-th state of the BSCC.
+     */
+    std::vector<ValueType> computeSteadyStateDistribution(Environment const& env);
+
+   private:
+    /*!
+     * Partitions the states into blocks (see class description).
+     */
+    void createBlocks(storm::storage::SparseMatrix<ValueType> const& bsccMatrix);
+
+    /*!
+     * Creates the solvers for the equation systems of the blocks with more than one state.
+     */
+    void createBlockSolvers(Environment const& env);
+
+    /*!
+     * Updates the given distribution by performing the aggregation and disaggregation step.
+     */
+    void aggregateAndDisaggregate(std::vector<ValueType>& distribution) const;
+
+    /*!
+     * Updates the given distribution by solving the equation system of each block, where the inflow from other blocks is taken from the distribution.
+     */
+    void performBlockGaussSeidelStep(Environment const& env, std::vector<ValueType>& distribution) const;
+
+    // The transposed transition matrix of the (uniformized) BSCC, i.e., the entries of each row refer to the incoming transitions of a state.
+    storm::storage::SparseMatrix<ValueType> backwardProbabilities;
+    // The i-th block consists of the (local) states blocks[i], ordered such that predecessors tend to come before their successors.
+    std::vector<std::vector<uint64_t>> blocks;
+    std::vector<uint64_t> stateToBlockMap;
+    // For each block with more than one state, the solver for the equation system of that block. Nullptr for singleton blocks.
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> blockSolvers;
+    // For each state, the probability of its (uniformized) self loop.
+    std::vector<ValueType> selfLoopProbabilities;
+};
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
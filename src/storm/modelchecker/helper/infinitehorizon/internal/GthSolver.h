@@ -0,0 +1,60 @@
+#pragma once
+
+#include <numeric>
+#include <vector>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+/*!
+ * Computes the steady state distribution of the given irreducible chain using the Grassmann-Taksar-Heyman algorithm, i.e., a variant of Gaussian
+ * elimination that does not perform subtractions and is therefore numerically stable.
+ * @param matrix A dense matrix (stored row-wise) whose off-diagonal entries are the transition probabilities (or rates) of the chain. Diagonal entries are
+ * ignored. The matrix is overwritten.
+ * @param dimension The number of states of the chain.
+ */
+template<typename ValueType>
+std::vector<ValueType> solveSteadyStateGth(std::vector<ValueType>& matrix, uint64_t dimension) {
+    STORM_LOG_ASSERT(matrix.size() == dimension * dimension, "Unexpected size of the dense matrix.");
+    auto entry = [&matrix, &dimension](uint64_t row, uint64_t column) -> ValueType& { return matrix[row * dimension + column]; };
+    // Eliminate the states in reverse order.
+    for (uint64_t n = dimension - 1; n > 0; --n) {
+        ValueType outflow = storm::utility::zero<ValueType>();
+        for (uint64_t column = 0; column < n; ++column) {
+            outflow += entry(n, column);
+        }
+        STORM_LOG_ASSERT(!storm::utility::isZero(outflow), "The chain is not irreducible.");
+        for (uint64_t row = 0; row < n; ++row) {
+            entry(row, n) /= outflow;
+        }
+        for (uint64_t row = 0; row < n; ++row) {
+            if (!storm::utility::isZero(entry(row, n))) {
+                for (uint64_t column = 0; column < n; ++column) {
+                    entry(row, column) += entry(row, n) * entry(n, column);
+                }
+            }
+        }
+    }
+    // Back substitution
+    std::vector<ValueType> result(dimension, storm::utility::zero<ValueType>());
+    result.front() = storm::utility::one<ValueType>();
+    for (uint64_t n = 1; n < dimension; ++n) {
+        for (uint64_t row = 0; row < n; ++row) {
+            result[n] += result[row] * entry(row, n);
+        }
+    }
+    ValueType const sum = std::accumulate(result.begin(), result.end(), storm::utility::zero<ValueType>());
+    storm::utility::vector::scaleVectorInPlace(result, storm::utility::one<ValueType>() / sum);
+    return result;
+}
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -17,6 +17,10 @@
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace storm {
 namespace modelchecker {
 namespace helper {
@@ -66,7 +70,8 @@ std::map<std::string, storm::storage::BitVector> SparseLTLHelper<ValueType, Nond
 }
 
 template<typename ValueType, bool Nondeterministic>
-storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(automata::AcceptanceCondition const& acceptance,
+storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeAcceptingECs(Environment const& env,
+                                                                                            automata::AcceptanceCondition const& acceptance,
                                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                             typename transformer::DAProduct<productModelType>::ptr product) {
@@ -81,14 +86,28 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 
     std::vector<std::vector<automata::AcceptanceCondition::acceptance_expr::ptr>> dnf = acceptance.extractFromDNF();
 
-    storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
+    // Every end component that is relevant for a conjunction lies within a MEC of the complete model and only uses choices of that MEC.
+    // Hence, the MEC decomposition of the complete model restricts the states and choices that need to be considered for each conjunction.
+    storm::storage::MaximalEndComponentDecomposition<ValueType> baseMecs(transitionMatrix, backwardTransitions);
+    storm::storage::BitVector baseMecStates(transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector baseMecChoices(transitionMatrix.getRowCount(), false);
+    for (auto const& mec : baseMecs) {
+        for (auto const& stateChoicesPair : mec) {
+            baseMecStates.set(stateChoicesPair.first);
+            for (auto const& choice : stateChoicesPair.second) {
+                baseMecChoices.set(choice);
+            }
+        }
+    }
 
-    std::size_t accMECs = 0;
-    std::size_t allMECs = 0;
+    // For each conjunction, the MECs in the allowed fragment that satisfy the conjunction and the number of considered MECs
+    std::vector<std::vector<storm::storage::MaximalEndComponent>> acceptingMecsPerConjunction(dnf.size());
+    std::vector<std::size_t> numberOfMecsPerConjunction(dnf.size(), 0);
 
-    for (auto const& conjunction : dnf) {
+    auto analyzeConjunction = [&](uint64_t conjunctionIndex, storm::storage::SccDecompositionMemoryCache& sccDecompositionCache) {
+        auto const& conjunction = dnf[conjunctionIndex];
         // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
+        storm::storage::BitVector allowed = baseMecStates;
 
         for (auto const& literal : conjunction) {
             if (literal->isTRUE()) {
@@ -114,13 +133,14 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 
         if (allowed.empty()) {
             // skip
-            continue;
+            return;
         }
 
         // Compute MECs in the allowed fragment
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed);
-        allMECs += mecs.size();
-        for (const auto& mec : mecs) {
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(transitionMatrix, backwardTransitions, allowed, baseMecChoices,
+                                                                         sccDecompositionCache);
+        numberOfMecsPerConjunction[conjunctionIndex] = mecs.size();
+        for (auto& mec : mecs) {
             bool accepting = true;
             for (auto const& literal : conjunction) {
                 if (literal->isTRUE()) {
@@ -154,16 +174,63 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
             }
 
             if (accepting) {
-                accMECs++;
-
-                for (auto const& stateChoicePair : mec) {
-                    acceptingStates.set(stateChoicePair.first);
+                acceptingMecsPerConjunction[conjunctionIndex].push_back(std::move(mec));
+            }
+        }
+    };
+
+    // The conjunctions are analyzed concurrently, each thread reuses its memory for the SCC decompositions
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.modelchecker().getLtlThreads(), dnf.size());
+    std::mutex mutex;
+    uint64_t nextConjunction = 0;
+    std::exception_ptr exception;
+    auto work = [&]() {
+        storm::storage::SccDecompositionMemoryCache sccDecompositionCache;
+        try {
+            while (true) {
+                uint64_t conjunctionIndex;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception || nextConjunction >= dnf.size()) {
+                        break;
+                    }
+                    conjunctionIndex = nextConjunction++;
                 }
+                analyzeConjunction(conjunctionIndex, sccDecompositionCache);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
 
-                if (this->isProduceSchedulerSet()) {
-                    // save choices for states that weren't assigned to any other MEC yet.
-                    this->_schedulerHelper.get().saveProductEcChoices(acceptance, mec, conjunction, product);
-                }
+    // Collect the results in the order of the conjunctions such that the scheduler choices do not depend on the number of threads
+    storm::storage::BitVector acceptingStates(transitionMatrix.getRowGroupCount(), false);
+    std::size_t accMECs = 0;
+    std::size_t allMECs = 0;
+    for (uint64_t conjunctionIndex = 0; conjunctionIndex < dnf.size(); ++conjunctionIndex) {
+        allMECs += numberOfMecsPerConjunction[conjunctionIndex];
+        for (auto const& mec : acceptingMecsPerConjunction[conjunctionIndex]) {
+            accMECs++;
+
+            for (auto const& stateChoicePair : mec) {
+                acceptingStates.set(stateChoicePair.first);
+            }
+
+            if (this->isProduceSchedulerSet()) {
+                // save choices for states that weren't assigned to any other MEC yet.
+                this->_schedulerHelper.get().saveProductEcChoices(acceptance, mec, dnf[conjunctionIndex], product);
             }
         }
     }
@@ -223,6 +290,17 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
 
+    // Automaton states whose outcome is already decided are made absorbing, such that the product is only explored where it matters.
+    // The scheduler extraction requires the complete product.
+    storm::storage::BitVector rejectingDaStates;
+    if (!this->isProduceSchedulerSet()) {
+        rejectingDaStates = da.computeRejectingStates();
+        storm::storage::BitVector acceptingDaSinks = da.computeAcceptingSinks();
+        STORM_LOG_INFO("Deterministic automaton has " << rejectingDaStates.getNumberOfSetBits() << " rejecting states and "
+                                                      << acceptingDaSinks.getNumberOfSetBits() << " accepting sinks which are not explored further.");
+        productBuilder.setAbsorbingStates(rejectingDaStates | acceptingDaSinks);
+    }
+
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
     STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has "
@@ -239,13 +317,17 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     storm::storage::BitVector acceptingStates;
     if (Nondeterministic) {
         STORM_LOG_INFO("Computing MECs and checking for acceptance...");
-        acceptingStates = computeAcceptingECs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
-                                              product->getProductModel().getBackwardTransitions(), product);
+        acceptingStates = computeAcceptingECs(env, *product->getAcceptance(), product->getProductModel().getTransitionMatrix(),
+                                              *product->getProductModel().getBackwardTransitions(), product);
 
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
         acceptingStates = computeAcceptingBCCs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix());
     }
+    if (!rejectingDaStates.empty()) {
+        // The self-loops of rejecting product states are not part of the automaton and might be considered accepting.
+        acceptingStates &= ~product->liftFromAutomaton(rejectingDaStates);
+    }
 
     if (acceptingStates.empty()) {
         STORM_LOG_INFO("No accepting states, skipping probability computation.");
@@ -276,8 +358,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     if (Nondeterministic) {
         MDPSparseModelCheckingHelperReturnType<ValueType> prodCheckResult =
             storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
-                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
-                acceptingStates, this->isQualitativeSet(),
+                env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), *product->getProductModel().getBackwardTransitions(),
+                bvTrue, acceptingStates, this->isQualitativeSet(),
                 this->isProduceSchedulerSet()  // Whether to create memoryless scheduler for the Model-DA Product.
             );
         prodNumericResult = std::move(prodCheckResult.values);
@@ -289,8 +371,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     } else {
         prodNumericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
-            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), product->getProductModel().getBackwardTransitions(), bvTrue,
-            acceptingStates, this->isQualitativeSet());
+            env, std::move(solveGoalProduct), product->getProductModel().getTransitionMatrix(), *product->getProductModel().getBackwardTransitions(),
+            bvTrue, acceptingStates, this->isQualitativeSet());
     }
 
     std::vector<ValueType> numericResult = product->projectToOriginalModel(this->_transitionMatrix.getRowGroupCount(), prodNumericResult);
@@ -315,16 +397,17 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO("Resulting LTL path formula: " << ltlFormula->toString());
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
-    // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
+    // Convert LTL formula to a deterministic automaton, using the external tool given via ltl2da or the internal tool (Spot)
+    // For nondeterministic models the acceptance condition is transformed into DNF
+    boost::optional<std::string> ltl2daTool, cacheDirectory;
     if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+        ltl2daTool = env.modelchecker().getLtl2daTool();
+    }
+    if (env.modelchecker().isLtl2daCacheDirectorySet()) {
+        cacheDirectory = env.modelchecker().getLtl2daCacheDirectory();
     }
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da =
+        storm::automata::LTL2DeterministicAutomaton::ltl2da(*ltlFormula, Nondeterministic, ltl2daTool, cacheDirectory);
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
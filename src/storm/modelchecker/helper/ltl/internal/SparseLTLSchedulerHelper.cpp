@@ -84,7 +84,7 @@ void SparseLTLSchedulerHelper<ValueType, Nondeterministic>::saveProductEcChoices
             // Compute a scheduler that, with prob=1 reaches the overlap states
             storm::storage::Scheduler<ValueType> mecScheduler(product->getProductModel().getNumberOfStates());
             storm::utility::graph::computeSchedulerProb1E<ValueType>(mecStates, product->getProductModel().getTransitionMatrix(),
-                                                                     product->getProductModel().getBackwardTransitions(), mecStates, overlapStates,
+                                                                     *product->getProductModel().getBackwardTransitions(), mecStates, overlapStates,
                                                                      mecScheduler);
 
             // Extract scheduler choices
@@ -136,7 +136,7 @@ void SparseLTLSchedulerHelper<ValueType, Nondeterministic>::saveProductEcChoices
             storm::storage::BitVector infStatesWithinMec = _infSets.get(id) & mecStates;
             // States not in InfSet: Compute a scheduler that, with prob=1, reaches the infSet via mecStates
             storm::utility::graph::computeSchedulerProb1E<ValueType>(mecStates, product->getProductModel().getTransitionMatrix(),
-                                                                     product->getProductModel().getBackwardTransitions(), mecStates, infStatesWithinMec,
+                                                                     *product->getProductModel().getBackwardTransitions(), mecStates, infStatesWithinMec,
                                                                      mecScheduler);
 
             // States that already reached the InfSet
@@ -59,9 +59,9 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     boost::optional<std::vector<ValueType>> resultHint;
     boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
 
-    bool computeOnlyMaybeStates;
+    bool computeOnlyMaybeStates = false;
     boost::optional<storm::storage::BitVector> maybeStates;
-    bool noEndComponentsInMaybeStates;
+    bool noEndComponentsInMaybeStates = false;
 };
 
 }  // namespace modelchecker
@@ -0,0 +1,160 @@
+#include "storm/modelchecker/hints/WarmStartStore.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace detail {
+std::string const formulaKey = "formula";
+std::string const matrixHashKey = "matrix-hash";
+std::string const valuesKey = "values";
+std::string const schedulerKey = "scheduler";
+std::string const stateValuationsKey = "state-valuations";
+}  // namespace detail
+
+template<typename ValueType>
+WarmStartStore<ValueType>::WarmStartStore(std::string const& directory) : directory(directory) {
+    std::error_code errorCode;
+    std::filesystem::create_directories(directory, errorCode);
+    STORM_LOG_THROW(!errorCode && std::filesystem::is_directory(directory), storm::exceptions::FileIoException,
+                    "Could not create warm start directory '" << directory << "'.");
+}
+
+template<typename ValueType>
+std::optional<ExplicitModelCheckerHint<ValueType>> WarmStartStore<ValueType>::load(storm::models::sparse::Model<ValueType> const& model,
+                                                                                   storm::logic::Formula const& formula) const {
+    std::string const formulaString = formula.toString();
+    std::string const filename = getFilename(formulaString);
+    if (!storm::utility::fileExistsAndIsReadable(filename)) {
+        STORM_LOG_INFO("No warm start entry for formula " << formulaString << ".");
+        return std::nullopt;
+    }
+
+    storm::json<ValueType> entry;
+    std::ifstream stream;
+    storm::utility::openFile(filename, stream);
+    stream >> entry;
+    storm::utility::closeFile(stream);
+    if (entry.at(detail::formulaKey).template get<std::string>() != formulaString) {
+        STORM_LOG_WARN("Ignoring warm start entry in " << filename << " because it has been stored for a different formula.");
+        return std::nullopt;
+    }
+
+    auto storedValues = entry.at(detail::valuesKey).template get<std::vector<ValueType>>();
+    std::vector<uint64_t> storedChoices;
+    if (entry.count(detail::schedulerKey) > 0) {
+        storedChoices = entry.at(detail::schedulerKey).template get<std::vector<uint64_t>>();
+    }
+    uint64_t const numberOfStates = model.getNumberOfStates();
+
+    // For each state of the model, the index of the corresponding state in the stored entry (if there is one).
+    std::vector<std::optional<uint64_t>> storedStateIndices(numberOfStates);
+    if (entry.at(detail::matrixHashKey).template get<uint64_t>() == model.getTransitionMatrix().hash() && storedValues.size() == numberOfStates) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            storedStateIndices[state] = state;
+        }
+    } else if (entry.count(detail::stateValuationsKey) > 0 && model.hasStateValuations()) {
+        auto const storedValuations = entry.at(detail::stateValuationsKey).template get<std::vector<std::string>>();
+        STORM_LOG_THROW(storedValuations.size() == storedValues.size(), storm::exceptions::FileIoException,
+                        "Inconsistent warm start entry in " << filename << ".");
+        std::unordered_map<std::string, uint64_t> valuationToStoredIndex;
+        for (uint64_t storedIndex = 0; storedIndex < storedValuations.size(); ++storedIndex) {
+            valuationToStoredIndex.emplace(storedValuations[storedIndex], storedIndex);
+        }
+        uint64_t numberOfMatchedStates = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            auto findRes = valuationToStoredIndex.find(model.getStateValuations().toString(state, false));
+            if (findRes != valuationToStoredIndex.end()) {
+                storedStateIndices[state] = findRes->second;
+                ++numberOfMatchedStates;
+            }
+        }
+        STORM_LOG_INFO("Transferred warm start values of " << numberOfMatchedStates << " of " << numberOfStates << " states using state valuations.");
+    } else {
+        STORM_LOG_INFO("Ignoring warm start entry in " << filename << " because the model changed and no state valuations are available.");
+        return std::nullopt;
+    }
+
+    std::vector<ValueType> values(numberOfStates, storm::utility::zero<ValueType>());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (storedStateIndices[state]) {
+            values[state] = storedValues[*storedStateIndices[state]];
+        }
+    }
+    ExplicitModelCheckerHint<ValueType> hint;
+    hint.setResultHint(std::move(values));
+
+    if (!storedChoices.empty() && model.isNondeterministicModel()) {
+        STORM_LOG_THROW(storedChoices.size() == storedValues.size(), storm::exceptions::FileIoException, "Inconsistent warm start entry in " << filename << ".");
+        storm::storage::Scheduler<ValueType> scheduler(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t choice = 0;
+            if (storedStateIndices[state] && storedChoices[*storedStateIndices[state]] < model.getTransitionMatrix().getRowGroupSize(state)) {
+                choice = storedChoices[*storedStateIndices[state]];
+            }
+            scheduler.setChoice(choice, state);
+        }
+        hint.setSchedulerHint(std::move(scheduler));
+    }
+    STORM_LOG_INFO("Loaded warm start entry from " << filename << ".");
+    return hint;
+}
+
+template<typename ValueType>
+void WarmStartStore<ValueType>::store(storm::models::sparse::Model<ValueType> const& model, storm::logic::Formula const& formula,
+                                      std::vector<ValueType> const& values, storm::storage::Scheduler<ValueType> const* scheduler) const {
+    STORM_LOG_ASSERT(values.size() == model.getNumberOfStates(), "Unexpected size of the value vector.");
+    std::string const formulaString = formula.toString();
+    storm::json<ValueType> entry;
+    entry[detail::formulaKey] = formulaString;
+    entry[detail::matrixHashKey] = static_cast<uint64_t>(model.getTransitionMatrix().hash());
+    entry[detail::valuesKey] = values;
+    if (scheduler && scheduler->isMemorylessScheduler() && scheduler->isDeterministicScheduler()) {
+        std::vector<uint64_t> choices(model.getNumberOfStates(), 0);
+        for (uint64_t state = 0; state < choices.size(); ++state) {
+            if (scheduler->getChoice(state).isDefined()) {
+                choices[state] = scheduler->getChoice(state).getDeterministicChoice();
+            }
+        }
+        entry[detail::schedulerKey] = std::move(choices);
+    }
+    if (model.hasStateValuations()) {
+        std::vector<std::string> valuations;
+        valuations.reserve(model.getNumberOfStates());
+        for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+            valuations.push_back(model.getStateValuations().toString(state, false));
+        }
+        entry[detail::stateValuationsKey] = std::move(valuations);
+    }
+
+    std::ofstream stream;
+    storm::utility::openFile(getFilename(formulaString), stream, false, true);
+    stream << storm::dumpJson(entry, true);
+    storm::utility::closeFile(stream);
+}
+
+template<typename ValueType>
+std::string WarmStartStore<ValueType>::getFilename(std::string const& formulaString) const {
+    std::stringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>()(formulaString) << ".json";
+    return (std::filesystem::path(directory) / filename.str()).string();
+}
+
+template class WarmStartStore<double>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+
+namespace logic {
+class Formula;
+}
+
+namespace modelchecker {
+
+/*!
+ * Stores solution vectors (and schedulers) on disk such that they can be used as hints (e.g. as initial values for value iteration) in a later run.
+ * Entries are identified by the formula. If the transition matrix did not change (as indicated by its hash value), the stored values are used as they are.
+ * Otherwise, the stored values are transferred to the states with the same state valuation, provided that the state valuations are available.
+ */
+template<typename ValueType>
+class WarmStartStore {
+   public:
+    /*!
+     * @param directory the directory in which the entries are stored. It is created if it does not exist.
+     */
+    explicit WarmStartStore(std::string const& directory);
+
+    /*!
+     * Retrieves a hint for the given formula from a previously stored entry.
+     * If the entry has been stored for a different model, states that can not be matched get value zero and choice zero.
+     * @return the hint or nothing if there is no entry applicable to the given model.
+     */
+    std::optional<ExplicitModelCheckerHint<ValueType>> load(storm::models::sparse::Model<ValueType> const& model, storm::logic::Formula const& formula) const;
+
+    /*!
+     * Stores the given values and the (optional) scheduler for the given formula, replacing a previously stored entry.
+     * @note Only memoryless, deterministic schedulers are stored.
+     */
+    void store(storm::models::sparse::Model<ValueType> const& model, storm::logic::Formula const& formula, std::vector<ValueType> const& values,
+               storm::storage::Scheduler<ValueType> const* scheduler = nullptr) const;
+
+   private:
+    std::string getFilename(std::string const& formulaString) const;
+
+    std::string directory;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
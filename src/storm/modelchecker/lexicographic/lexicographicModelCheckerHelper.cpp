@@ -3,6 +3,7 @@
 #include "storm/automata/APSet.h"
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/environment/SubEnvironment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
 #include "storm/logic/Formula.h"
@@ -10,8 +11,12 @@
 #include "storm/modelchecker/lexicographic/spotHelper/spotProduct.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SchedulerChoice.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/transformer/EndComponentEliminator.h"
-#include "storm/transformer/SubsystemBuilder.h"
+
+#include <exception>
+#include <mutex>
+#include <thread>
 
 namespace storm {
 namespace modelchecker {
@@ -60,13 +65,16 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 std::pair<storm::storage::MaximalEndComponentDecomposition<ValueType>, std::vector<std::vector<bool>>>
 lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getLexArrays(
-    std::shared_ptr<storm::transformer::DAProduct<productModelType>> productModel, std::vector<uint>& acceptanceConditions) {
+    Environment const& env, std::shared_ptr<storm::transformer::DAProduct<productModelType>> productModel, std::vector<uint>& acceptanceConditions) {
     storm::storage::BitVector allowed(productModel->getProductModel().getTransitionMatrix().getRowGroupCount(), true);
+    // get easy access to incoming transitions of a state. These matrices are shared by the analyses of all MECs
+    storm::storage::SparseMatrix<ValueType> incomingChoicesMatrix = productModel->getProductModel().getTransitionMatrix().transpose();
+    auto const incomingStatesMatrixPtr = productModel->getProductModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& incomingStatesMatrix = *incomingStatesMatrixPtr;
     // get MEC decomposition
-    storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(productModel->getProductModel().getTransitionMatrix(),
-                                                                     productModel->getProductModel().getBackwardTransitions(), allowed);
+    storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(productModel->getProductModel().getTransitionMatrix(), incomingStatesMatrix, allowed);
 
-    std::vector<std::vector<bool>> bscc_satisfaction;
+    std::vector<std::vector<bool>> bscc_satisfaction(mecs.size());
     storm::automata::AcceptanceCondition::ptr acceptance = productModel->getAcceptance();
 
     // Get all the Streett-pairs
@@ -75,10 +83,11 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
     // they are ordered from last to first, so reverse the array
     std::reverse(acceptancePairs.begin(), acceptancePairs.end());
 
-    // Iterate over the end-components and find their lex-array
-    for (storm::storage::MaximalEndComponent& mec : mecs) {
+    // Find the lex-array of an end-component
+    auto analyzeMec = [&](uint64_t mecIndex, storm::storage::SccDecompositionMemoryCache& sccDecompositionCache) {
+        storm::storage::MaximalEndComponent const& mec = mecs[mecIndex];
         std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> sprime;
-        std::vector<bool> bsccAccepting;
+        std::vector<bool>& bsccAccepting = bscc_satisfaction[mecIndex];
         for (uint i = 0; i < acceptanceConditions.size() - 1; i++) {
             // copy the current list of Streett-pairs that can be fulfilled together
             std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> sprimeTemp(sprime);
@@ -88,7 +97,8 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
             sprimeTemp.insert(sprimeTemp.end(), sub.begin(), sub.end());
 
             // check whether the Streett-condition in sprimeTemp can be fulfilled in the mec
-            bool accepts = isAcceptingStreettConditions(mec, sprimeTemp, acceptance, productModel->getProductModel());
+            bool accepts = isAcceptingStreettConditions(mec, sprimeTemp, acceptance, productModel->getProductModel(), incomingChoicesMatrix,
+                                                        incomingStatesMatrix, sccDecompositionCache);
 
             if (accepts) {
                 // if the condition can be fulfilled, add the Streett-pairs to the current list of pairs, and mark this property as true for this MEC
@@ -98,14 +108,49 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
                 bsccAccepting.push_back(false);
             }
         }
-        bscc_satisfaction.push_back(bsccAccepting);
+    };
+
+    // The end-components are analyzed concurrently, each thread reuses its memory for the decompositions
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.modelchecker().getLtlThreads(), mecs.size());
+    std::mutex mutex;
+    uint64_t nextMec = 0;
+    std::exception_ptr exception;
+    auto work = [&]() {
+        storm::storage::SccDecompositionMemoryCache sccDecompositionCache;
+        try {
+            while (true) {
+                uint64_t mecIndex;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception || nextMec >= mecs.size()) {
+                        break;
+                    }
+                    mecIndex = nextMec++;
+                }
+                analyzeMec(mecIndex, sccDecompositionCache);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
     }
     return std::pair<storm::storage::MaximalEndComponentDecomposition<ValueType>&, std::vector<std::vector<bool>>&>(mecs, bscc_satisfaction);
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::lexReachability(
-    storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecs, std::vector<std::vector<bool>> const& mecLexArray,
+    Environment const& env, storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecs, std::vector<std::vector<bool>> const& mecLexArray,
     std::shared_ptr<storm::transformer::DAProduct<SparseModelType>> const& productModel, SparseModelType const& originalMdp) {
     // Eliminate all MECs and generate one sink state instead
     // Add first new states for each MEC
@@ -120,18 +165,16 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
         eliminator.transform(newMatrixWithNewStates, mecs, eliminationStates, storm::storage::BitVector(eliminationStates.size(), false), true);
 
     STORM_LOG_ASSERT(!mecLexArray.empty(), "No MECs in the model!");
-    std::vector<std::vector<bool>> bccLexArrayCurrent(mecLexArray);
     // prepare the result (one reachability probability for each objective)
     MDPSparseModelCheckingHelperReturnType<ValueType> retResult(std::vector<ValueType>(mecLexArray[0].size()));
-    std::vector<uint_fast64_t> compressedToReducedMapping(compressionResult.matrix.getColumnCount());
-    std::iota(std::begin(compressedToReducedMapping), std::end(compressedToReducedMapping), 0);
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = compressionResult.matrix;
+    // the collapsed model restricted to the choices that are optimal for the objectives considered so far. Restricting the rows keeps the state indices.
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = std::move(compressionResult.matrix);
 
     // check reachability for each condition and restrict the model to optimal choices
     for (uint condition = 0; condition < mecLexArray[0].size(); condition++) {
         // get the goal-states for this objective (i.e. the st-states of the MECs where the objective can be fulfilled
-        storm::storage::BitVector psiStates = getGoodStates(mecs, bccLexArrayCurrent, compressionResult.oldToNewStateMapping, condition,
-                                                            transitionMatrix.getColumnCount(), compressedToReducedMapping, bccToStStateMapping);
+        storm::storage::BitVector psiStates = getGoodStates(mecs, mecLexArray, compressionResult.oldToNewStateMapping, condition,
+                                                            transitionMatrix.getColumnCount(), bccToStStateMapping);
         if (psiStates.getNumberOfSetBits() == 0) {
             retResult.values[condition] = 0;
             continue;
@@ -139,24 +182,20 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
 
         // solve the reachability query for this set of goal states
         std::vector<uint_fast64_t> newInitalStates;
-        auto res =
-            solveOneReachability(newInitalStates, psiStates, transitionMatrix, originalMdp, compressedToReducedMapping, compressionResult.oldToNewStateMapping);
+        auto res = solveOneReachability(env, newInitalStates, psiStates, transitionMatrix, originalMdp, compressionResult.oldToNewStateMapping);
         if (newInitalStates.empty()) {
             retResult.values[condition] = 0;
             continue;
         }
         retResult.values[condition] = res.values[newInitalStates[0]];
 
-        // create a reduced subsystem that only contains the optimal actions for this objective
-        auto subsystem = getReducedSubsystem(transitionMatrix, res, newInitalStates, psiStates);
-        std::vector<uint_fast64_t> compressedToReducedMappingTemp;
-        compressedToReducedMappingTemp.reserve(compressedToReducedMapping.size());
-        // create a new mapping for the states
-        for (uint_fast64_t newState : subsystem.newToOldStateIndexMapping) {
-            compressedToReducedMappingTemp.push_back(compressedToReducedMapping[newState]);
+        // filter the choices such that only the optimal actions for this objective remain (not needed after the last objective)
+        if (condition + 1 < mecLexArray[0].size()) {
+            storm::storage::BitVector optimalChoices = getOptimalChoices(transitionMatrix, res);
+            if (!optimalChoices.full()) {
+                transitionMatrix = transitionMatrix.restrictRows(optimalChoices);
+            }
         }
-        compressedToReducedMapping = compressedToReducedMappingTemp;
-        transitionMatrix = subsystem.model->getTransitionMatrix();
     }
     return retResult;
 }
@@ -192,7 +231,9 @@ const storm::storage::BitVector& getStreettSet(storm::automata::AcceptanceCondit
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::isAcceptingStreettConditions(
     storm::storage::MaximalEndComponent const& scc, std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-    storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model) {
+    storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model,
+    storm::storage::SparseMatrix<ValueType> const& incomingChoicesMatrix, storm::storage::SparseMatrix<ValueType> const& incomingStatesMatrix,
+    storm::storage::SccDecompositionMemoryCache& sccDecompositionCache) {
     // initialize the states and choices we have to consider for mec decomposition
     storm::storage::BitVector mecStates = storm::storage::BitVector(model.getNumberOfStates(), false);
     std::for_each(scc.begin(), scc.end(), [&mecStates](auto const& state) { mecStates.set(state.first); });
@@ -201,24 +242,21 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
     if (mecChoices.empty()) {
         return false;
     }
-    // get easy access to incoming transitions of a state
-    auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
-    auto incomingStatesMatrix = model.getBackwardTransitions();
     bool changedSomething = true;
     while (changedSomething) {
         // iterate until there is no change
         changedSomething = false;
         // decompose the MEC, if possible
-        auto subMecDecomposition =
-            storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates, mecChoices);
+        auto subMecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates,
+                                                                                               mecChoices, sccDecompositionCache);
         // iterate over all sub-MECs in the big MEC
         for (storm::storage::MaximalEndComponent const& mec : subMecDecomposition) {
             // iterate over all Streett-pairs
             for (storm::automata::AcceptanceCondition::acceptance_expr::ptr const& streettPair : acceptancePairs) {
                 // check whether (i) the MEC contains states from the Inf-set (the condition holds) or (ii) states from the Fin-set (unclear whether it can be
                 // fulfilled)
-                auto infSet = getStreettSet(acceptance, streettPair->getRight());
-                auto finSet = getStreettSet(acceptance, streettPair->getLeft());
+                auto const& infSet = getStreettSet(acceptance, streettPair->getRight());
+                auto const& finSet = getStreettSet(acceptance, streettPair->getLeft());
                 if (mec.containsAnyState(infSet)) {
                     // streett-condition is true (INF is fulfilled)
                     continue;
@@ -241,8 +279,8 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
         }
     }
     // decompose one last time
-    auto subMecDecomposition =
-        storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates, mecChoices);
+    auto subMecDecomposition = storm::storage::MaximalEndComponentDecomposition<ValueType>(model.getTransitionMatrix(), incomingStatesMatrix, mecStates,
+                                                                                           mecChoices, sccDecompositionCache);
     if (subMecDecomposition.empty()) {
         // there are no more ECs in this set of states
         return false;
@@ -256,7 +294,7 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getGoodStates(
     storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc, std::vector<std::vector<bool>> const& bccLexArray,
     std::vector<uint_fast64_t> const& oldToNewStateMapping, uint const& condition, uint const numStates,
-    std::vector<uint_fast64_t> const& compressedToReducedMapping, std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
+    std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
     STORM_LOG_ASSERT(!bccLexArray.empty(), "Lex-Array is empty!");
     STORM_LOG_ASSERT(condition < bccLexArray[0].size(), "Condition is not in Lex-Array!");
     std::vector<uint_fast64_t> goodStates;
@@ -264,13 +302,7 @@ storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, Value
         std::vector<bool> const& bccLex = bccLexArray[i];
         if (bccLex[condition]) {
             uint_fast64_t bccStateOld = bccToStStateMapping.at(i);
-            uint_fast64_t bccState = oldToNewStateMapping[bccStateOld];
-            auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), bccState);
-            if (pointer != compressedToReducedMapping.end()) {
-                // We have to check whether the state has already been removed
-                uint_fast64_t bccStateReduced = pointer - compressedToReducedMapping.begin();
-                goodStates.push_back(bccStateReduced);
-            }
+            goodStates.push_back(oldToNewStateMapping[bccStateOld]);
         }
     }
     return {numStates, goodStates};
@@ -278,23 +310,19 @@ storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, Value
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::solveOneReachability(
-    std::vector<uint_fast64_t>& newInitalStates, storm::storage::BitVector const& psiStates, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    SparseModelType const& originalMdp, std::vector<uint_fast64_t> const& compressedToReducedMapping, std::vector<uint_fast64_t> const& oldToNewStateMapping) {
-    Environment env;
+    Environment const& env, std::vector<uint_fast64_t>& newInitalStates, storm::storage::BitVector const& psiStates,
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, SparseModelType const& originalMdp,
+    std::vector<uint_fast64_t> const& oldToNewStateMapping) {
     // A reachability condition "F x" is transformed to "true U x"
     // phi states are all states
     // psi states are the ones from the "good bccs"
     storm::storage::BitVector phiStates(transitionMatrix.getColumnCount(), true);
 
     // Get initial states in the compressed model
-    storm::storage::BitVector const& originalInitialStates = originalMdp.getInitialStates();
-
-    uint pos = 0;
-    while (originalInitialStates.getNextSetIndex(pos) != originalInitialStates.size()) {
-        pos = originalInitialStates.getNextSetIndex(pos) + 1;
-        auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), oldToNewStateMapping[pos - 1]);
-        if (pointer != compressedToReducedMapping.end()) {
-            newInitalStates.push_back(pointer - compressedToReducedMapping.begin());
+    for (auto const& initialState : originalMdp.getInitialStates()) {
+        uint_fast64_t newInitialState = oldToNewStateMapping[initialState];
+        if (newInitialState < transitionMatrix.getRowGroupCount()) {
+            newInitalStates.push_back(newInitialState);
         }
     }
     storm::storage::BitVector i(transitionMatrix.getColumnCount(), newInitalStates);
@@ -307,17 +335,13 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
-typename lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::SubsystemReturnType
-lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getReducedSubsystem(
-    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-    std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates) {
-    std::vector<std::vector<uint>> optimalActions;
-    std::vector<uint_fast64_t> keptActions;
+storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getOptimalChoices(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult) {
+    storm::storage::BitVector optimalChoices(transitionMatrix.getRowCount(), false);
     std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
 
     // iterate over the states
     for (uint currentState = 0; currentState < reachabilityResult.values.size(); currentState++) {
-        std::vector<uint> goodActionsForState;
         uint_fast64_t bestAction = reachabilityResult.scheduler->getChoice(currentState).getDeterministicChoice();
         // determine the value of the best action
         ValueType bestActionValue(0);
@@ -332,24 +356,11 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
                 actionValue += rowEntry.getValue() * reachabilityResult.values[rowEntry.getColumn()];
             }
             if (actionValue == bestActionValue) {
-                goodActionsForState.push_back(action);
-                keptActions.push_back(action);
+                optimalChoices.set(action);
             }
         }
-        optimalActions.push_back(goodActionsForState);
-    }
-    storm::storage::BitVector subSystemActions(transitionMatrix.getRowCount(), keptActions);
-    storm::storage::BitVector subSystemStates(transitionMatrix.getRowGroupCount(), true);
-    transformer::SubsystemBuilderOptions sbo;
-    sbo.fixDeadlocks = true;
-    storm::models::sparse::StateLabeling stateLabelling(transitionMatrix.getColumnCount());
-    stateLabelling.addLabel("init");
-    for (auto const& state : newInitalStates) {
-        stateLabelling.addLabelToState("init", state);
     }
-    storm::models::sparse::Mdp<ValueType> newModel(transitionMatrix, stateLabelling);
-    SubsystemReturnType subsystemReturn = transformer::buildSubsystem(newModel, subSystemStates, subSystemActions, false, sbo);
-    return subsystemReturn;
+    return optimalChoices;
 }
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
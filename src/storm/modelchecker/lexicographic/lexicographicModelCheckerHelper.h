@@ -12,7 +12,6 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/transformer/DAProductBuilder.h"
-#include "storm/transformer/SubsystemBuilder.h"
 
 namespace storm {
 
@@ -26,7 +25,6 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHelper<ValueType, storm::models::ModelRepresentation::Sparse> {
    public:
     typedef std::function<storm::storage::BitVector(storm::logic::Formula const&)> CheckFormulaCallback;
-    typedef storm::transformer::SubsystemBuilderReturnType<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> SubsystemReturnType;
     using StateType = storm::storage::sparse::state_type;
     using productModelType = typename storm::models::sparse::Mdp<ValueType>;
 
@@ -46,26 +44,32 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
     /*!
      * Given a product of an MDP and a automaton, returns the MECs and their corresponding Lex-Arrays
      * First: get MEC-decomposition
-     * Second: for each MEC, run an algorithm to get Lex-arrays
+     * Second: for each MEC, run an algorithm to get Lex-arrays. The MECs are independent of each other and are analyzed concurrently using the number of
+     * threads for LTL model checking given in the environment.
+     * @param env the environment
      * @param productModel product of MDP and automaton
      * @param acceptanceConditions indication which Streett-pairs belong to which subformula
      * @return MECs, corresp. Lex-arrays
      */
     std::pair<storm::storage::MaximalEndComponentDecomposition<ValueType>, std::vector<std::vector<bool>>> getLexArrays(
-        std::shared_ptr<storm::transformer::DAProduct<productModelType>> productModel, std::vector<uint>& acceptanceConditions);
+        Environment const& env, std::shared_ptr<storm::transformer::DAProduct<productModelType>> productModel, std::vector<uint>& acceptanceConditions);
 
     /*!
      * Solves the reachability query for a lexicographic objective
      * In lexicographic order, each objective is solved for reachability, i.e. the MECs where the property can be fulfilled are the goal-states
      * The model is restricted to optimal actions concerning this reachability query
      * This is repeated for all objectives.
+     * The MECs are collapsed only once. The restrictions to optimal actions are applied by filtering the choices of the collapsed model, i.e., the
+     * states keep their indices across all objectives.
+     * @param env the environment
      * @param mecs MaximalEndcomponents in the product-model
      * @param mecLexArray corresponding Lex-arrays for each MEC
      * @param productModel the product of MDP and automaton
      * @param originalMdp the original MDP
      * @return
      */
-    MDPSparseModelCheckingHelperReturnType<ValueType> lexReachability(storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecs,
+    MDPSparseModelCheckingHelperReturnType<ValueType> lexReachability(Environment const& env,
+                                                                      storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecs,
                                                                       std::vector<std::vector<bool>> const& mecLexArray,
                                                                       std::shared_ptr<storm::transformer::DAProduct<SparseModelType>> const& productModel,
                                                                       SparseModelType const& originalMdp);
@@ -90,11 +94,17 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param acceptancePairs list of Streett-pairs that create the Streett-condition
      * @param acceptance original acceptance condition of the automaton
      * @param model copy of the product-model
+     * @param incomingChoicesMatrix the transposed transition matrix of the model (without joined row groups)
+     * @param incomingStatesMatrix the backward transitions of the model
+     * @param sccDecompositionCache memory used by the MEC decompositions
      * @return whether the condition can be fulfilled or not
      */
     bool isAcceptingStreettConditions(storm::storage::MaximalEndComponent const& scc,
                                       std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model);
+                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model,
+                                      storm::storage::SparseMatrix<ValueType> const& incomingChoicesMatrix,
+                                      storm::storage::SparseMatrix<ValueType> const& incomingStatesMatrix,
+                                      storm::storage::SccDecompositionMemoryCache& sccDecompositionCache);
 
     /*!
      * For a given objective, iterates over the MECs and finds the corresponding sink state
@@ -104,33 +114,29 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param condition the condition to be checked
      * @param numStatesTotal the number of states in total in the compressed model
      * @param mecToStateMapping mapping of the MECs to their corresponding sink state
-     * @param compressedToReducedMapping mapping of the compressed model to the reduced to optimal
      * @return set of "good" states for the given condition
      */
     storm::storage::BitVector getGoodStates(storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc,
                                             std::vector<std::vector<bool>> const& bccLexArray, std::vector<uint_fast64_t> const& oldToNewStateMapping,
-                                            uint const& condition, uint const numStates, std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                            std::map<uint, uint_fast64_t> const& bccToStStateMapping);
+                                            uint const& condition, uint const numStates, std::map<uint, uint_fast64_t> const& bccToStStateMapping);
 
     /*!
      * Solves the reachability-query for a given set of goal-states and initial-states
      */
-    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(std::vector<uint_fast64_t>& newInitalStates,
+    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(Environment const& env, std::vector<uint_fast64_t>& newInitalStates,
                                                                            storm::storage::BitVector const& psiStates,
                                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                            SparseModelType const& originalMdp,
-                                                                           std::vector<uint_fast64_t> const& compressedToReducedMapping,
                                                                            std::vector<uint_fast64_t> const& oldToNewStateMapping);
 
     /*!
-     * Reduces the model to actions that are optimal for the given strategy.
+     * Determines the actions that are optimal for the given strategy.
      * @param transitionMatrix current transition matrix
      * @param reachabilityResult result of the reachability query, that contains (i) the reachability value for each state, and (ii) the optimal scheduler
-     * @return
+     * @return the rows of the transition matrix that correspond to optimal actions
      */
-    SubsystemReturnType getReducedSubsystem(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                            MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult,
-                                            std::vector<uint_fast64_t> const& newInitalStates, storm::storage::BitVector const& goodStates);
+    storm::storage::BitVector getOptimalChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                MDPSparseModelCheckingHelperReturnType<ValueType> const& reachabilityResult);
 
     /*!
      * add a new sink-state for each MEC
@@ -14,7 +14,7 @@ namespace modelchecker {
 namespace lexicographic {
 
 template<typename SparseModelType, typename ValueType>
-helper::MDPSparseModelCheckingHelperReturnType<ValueType> check(Environment const&, SparseModelType const& model,
+helper::MDPSparseModelCheckingHelperReturnType<ValueType> check(Environment const& env, SparseModelType const& model,
                                                                 CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask,
                                                                 CheckFormulaCallback const& formulaChecker) {
     STORM_LOG_ASSERT(model.getInitialStates().getNumberOfSetBits() == 1,
@@ -33,13 +33,13 @@ helper::MDPSparseModelCheckingHelperReturnType<ValueType> check(Environment cons
 
     // get the lexicogrpahic array for all MEC of the product-model
     std::pair<storm::storage::MaximalEndComponentDecomposition<ValueType>, std::vector<std::vector<bool>>> result =
-        lMC.getLexArrays(completeProductModel, accCond);
+        lMC.getLexArrays(env, completeProductModel, accCond);
     storm::storage::MaximalEndComponentDecomposition<ValueType> mecs = result.first;
     std::vector<std::vector<bool>> mecLexArrays = result.second;
 
     // solve the reachability query
     // That is: solve reachability for the lexicographic highest condition, restrict the model to optimal actions, repeat
-    return lMC.lexReachability(mecs, mecLexArrays, completeProductModel, model);
+    return lMC.lexReachability(env, mecs, mecLexArrays, completeProductModel, model);
 }
 
 template helper::MDPSparseModelCheckingHelperReturnType<double> check<storm::models::sparse::Mdp<double>, double>(
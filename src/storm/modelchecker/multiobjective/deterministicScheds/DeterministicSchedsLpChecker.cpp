@@ -51,21 +51,11 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
     swAll.start();
     initialize(env);
     STORM_LOG_ASSERT(weightVector.size() == objectiveHelper.size(), "Setting a weight vector with invalid number of entries.");
-    if (!currentWeightVector.empty()) {
-        // Pop information of the current weight vector.
-        lpModel->pop();
-        lpModel->update();
-        currentObjectiveVariables.clear();
-    }
-
     currentWeightVector = weightVector;
 
-    lpModel->push();
-    // set up objective function for the given weight vector
-    for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
-        currentObjectiveVariables.push_back(
-            lpModel->addUnboundedContinuousVariable("w_" + std::to_string(objIndex), storm::utility::convertNumber<ValueType>(weightVector[objIndex])));
-        lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == initialStateResults[objIndex]);
+    // Only the objective function changes, so the solver can start from the solution for the previous weight vector.
+    for (uint64_t objIndex = 0; objIndex < objectiveVariables.size(); ++objIndex) {
+        lpModel->setObjectiveFunctionCoefficient(objectiveVariables[objIndex], storm::utility::convertNumber<ValueType>(weightVector[objIndex]));
     }
     lpModel->update();
     swAll.stop();
@@ -79,7 +69,7 @@ std::optional<std::pair<std::vector<GeometryValueType>, GeometryValueType>> Dete
     STORM_LOG_ASSERT(!currentWeightVector.empty(), "Checking invoked before specifying a weight vector.");
     STORM_LOG_TRACE("Checking a vertex...");
     lpModel->push();
-    auto areaConstraints = overapproximation->getConstraints(lpModel->getManager(), currentObjectiveVariables);
+    auto areaConstraints = overapproximation->getConstraints(lpModel->getManager(), objectiveVariables);
     for (auto const& c : areaConstraints) {
         lpModel->addConstraint("", c);
     }
@@ -579,7 +569,8 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::initializeLpMod
     flowEncoding = useFlowEncoding(env, objectiveHelper);
     STORM_LOG_INFO("Using " << (flowEncoding ? "flow" : "classical") << " encoding.\n");
     uint64_t initialState = *model.getInitialStates().begin();
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const backwardTransitionsPtr = model.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     auto backwardChoices = model.getTransitionMatrix().transpose();
     STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::CoreSettings>().isLpSolverSetFromDefaultValue() ||
                             storm::settings::getModule<storm::settings::modules::CoreSettings>().getLpSolver() == storm::solver::LpSolverType::Gurobi,
@@ -623,6 +614,12 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::initializeLpMod
             ++mecIndex;
         }
     }
+    // Variables for the objective values. Their coefficients in the objective function are set according to the current weight vector.
+    objectiveVariables.clear();
+    for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
+        objectiveVariables.push_back(lpModel->addUnboundedContinuousVariable("w_" + std::to_string(objIndex)));
+        lpModel->addConstraint("", objectiveVariables.back().getExpression() == initialStateResults[objIndex]);
+    }
     lpModel->update();
     STORM_LOG_INFO("Done initializing LP model.");
 }
@@ -638,7 +635,7 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::checkRecursive(
 
     lpModel->push();
     // Assert the constraints of the current polytope
-    auto nodeConstraints = polytopeTree.getPolytope()->getConstraints(lpModel->getManager(), currentObjectiveVariables);
+    auto nodeConstraints = polytopeTree.getPolytope()->getConstraints(lpModel->getManager(), objectiveVariables);
     for (auto const& constr : nodeConstraints) {
         lpModel->addConstraint("", constr);
     }
@@ -720,7 +717,7 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::checkRecursive(
                                 if (num_sharpen == 0) {
                                     lpModel->push();
                                 }
-                                lpModel->addConstraint("", h.toExpression(lpModel->getManager(), currentObjectiveVariables));
+                                lpModel->addConstraint("", h.toExpression(lpModel->getManager(), objectiveVariables));
                                 ++num_sharpen;
                                 break;
                             }
@@ -790,7 +787,7 @@ typename DeterministicSchedsLpChecker<ModelType, GeometryValueType>::Point Deter
         inducedPoint.push_back(storm::utility::convertNumber<GeometryValueType>(inducedValue));
         // If this objective has weight zero, the lp solution is not necessarily correct
         if (!storm::utility::isZero(currentWeightVector[objIndex])) {
-            ValueType lpValue = lpModel->getContinuousValue(currentObjectiveVariables[objIndex]);
+            ValueType lpValue = lpModel->getContinuousValue(objectiveVariables[objIndex]);
             double diff = storm::utility::convertNumber<double>(storm::utility::abs<ValueType>(inducedValue - lpValue));
             STORM_LOG_WARN_COND(diff <= 1e-4 * std::abs(storm::utility::convertNumber<double>(inducedValue)),
                                 "Imprecise value for objective " << objIndex << ": LP says " << lpValue << " but scheduler induces " << inducedValue
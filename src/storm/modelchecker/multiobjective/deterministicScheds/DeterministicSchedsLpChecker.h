@@ -80,7 +80,7 @@ class DeterministicSchedsLpChecker {
     std::unique_ptr<storm::solver::LpSolver<ValueType>> lpModel;
     std::vector<storm::expressions::Expression> choiceVariables;
     std::vector<storm::expressions::Expression> initialStateResults;
-    std::vector<storm::expressions::Variable> currentObjectiveVariables;
+    std::vector<storm::expressions::Variable> objectiveVariables;
     std::vector<GeometryValueType> currentWeightVector;
     bool flowEncoding;
 
@@ -89,7 +89,8 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
     if (formula.isProbabilityOperatorFormula() && formula.getSubformula().isUntilFormula()) {
         storm::storage::BitVector phiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getLeftSubformula());
         storm::storage::BitVector psiStates = evaluatePropositionalFormula(model, formula.getSubformula().asUntilFormula().getRightSubformula());
-        auto backwardTransitions = model.getBackwardTransitions();
+        auto const backwardTransitionsPtr = model.getBackwardTransitions();
+        auto const& backwardTransitions = *backwardTransitionsPtr;
         auto prob1States = storm::utility::graph::performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions,
                                                                 phiStates, psiStates);
         auto prob0States = storm::utility::graph::performProb0A(backwardTransitions, phiStates, psiStates);
@@ -121,7 +122,7 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
                 storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), formula.getSubformula().asEventuallyFormula());
             storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
             rew0States = storm::utility::graph::performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(),
-                                                              model.getBackwardTransitions(), statesWithoutReward, rew0States);
+                                                              *model.getBackwardTransitions(), statesWithoutReward, rew0States);
         }
         if (rew0States.get(initialState)) {
             constantInitialStateValue = storm::utility::zero<ValueType>();
@@ -148,7 +149,7 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
             storm::utility::createFilteredRewardModel(baseRewardModel, model.isDiscreteTimeModel(), formula.getSubformula().asTotalRewardFormula());
         storm::storage::BitVector statesWithoutReward = rewardModel.get().getStatesWithZeroReward(model.getTransitionMatrix());
         storm::storage::BitVector rew0States =
-            storm::utility::graph::performProbGreater0E(model.getBackwardTransitions(), statesWithoutReward, ~statesWithoutReward);
+            storm::utility::graph::performProbGreater0E(*model.getBackwardTransitions(), statesWithoutReward, ~statesWithoutReward);
         rew0States.complement();
         if (rew0States.get(initialState)) {
             constantInitialStateValue = storm::utility::zero<ValueType>();
@@ -189,7 +190,8 @@ void DeterministicSchedsObjectiveHelper<ModelType>::initialize() {
             negativeRewardChoices.set(rew.first, true);
         }
     }
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const backwardTransitionsPtr = model.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     bool hasNegativeEC =
         storm::utility::graph::checkIfECWithChoiceExists(model.getTransitionMatrix(), backwardTransitions, getMaybeStates(), negativeRewardChoices);
     bool hasPositiveEc =
@@ -491,7 +493,8 @@ ValueType getLowerBoundForNonZeroReachProb(storm::storage::SparseMatrix<ValueTyp
 template<typename ModelType>
 void DeterministicSchedsObjectiveHelper<ModelType>::computeLowerUpperBounds(Environment const& env) const {
     assert(!upperResultBounds.has_value() && !lowerResultBounds.has_value());
-    auto backwardTransitions = model.getBackwardTransitions();
+    auto const backwardTransitionsPtr = model.getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     auto nonMaybeStates = ~maybeStates;
     // Eliminate problematic mecs
     storm::storage::MaximalEndComponentDecomposition<ValueType> problMecs(model.getTransitionMatrix(), backwardTransitions, maybeStates,
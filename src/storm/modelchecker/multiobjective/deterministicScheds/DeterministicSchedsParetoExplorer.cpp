@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <exception>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -355,10 +358,18 @@ std::unique_ptr<CheckResult> DeterministicSchedsParetoExplorer<SparseModelType,
         ei += ei;
         eps = std::vector<GeometryValueType>(objectives.size(), ei);
     }
+    uint64_t const batchSize = env.modelchecker().multi().getRefinementBatchSize();
     while (!unprocessedFacets.empty()) {
-        Facet f = std::move(unprocessedFacets.front());
-        unprocessedFacets.pop();
-        processFacet(env, f);
+        // Optimizing in the direction of a facet does not depend on the other facets, so the directions of several facets can be optimized at once.
+        std::vector<Facet> facets;
+        while (!unprocessedFacets.empty() && facets.size() < batchSize) {
+            facets.push_back(std::move(unprocessedFacets.front()));
+            unprocessedFacets.pop();
+        }
+        auto optimizationResults = optimizeFacets(env, facets);
+        for (uint64_t i = 0; i < facets.size(); ++i) {
+            processFacet(env, facets[i], std::move(optimizationResults[i]));
+        }
     }
 
     std::vector<std::vector<ModelValueType>> paretoPoints;
@@ -516,12 +527,9 @@ std::vector<GeometryValueType> DeterministicSchedsParetoExplorer<SparseModelType
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(Environment const& env, Facet& f) {
-    if (!wvChecker) {
-        lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
-    }
-
-    if (optimizeAndSplitFacet(env, f)) {
+void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(Environment const& env, Facet& f,
+                                                                                         OptimizationResult&& optimizationResult) {
+    if (splitFacet(env, f, std::move(optimizationResult))) {
         return;
     }
 
@@ -533,9 +541,7 @@ void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::proc
         }
     }
     if (!polytopeTree.isEmpty()) {
-        if (wvChecker) {
-            lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
-        }
+        lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
         auto res = lpChecker->check(env, polytopeTree, eps);
         for (auto const& infeasableArea : res.second) {
             addUnachievableArea(env, infeasableArea);
@@ -557,21 +563,22 @@ bool closePoints(std::vector<GeometryValueType> const& first, std::vector<Geomet
 }
 
 template<class SparseModelType, typename GeometryValueType>
-bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(Environment const& env, Facet& f) {
-    // Invoke optimization and insert the explored points
-    boost::optional<PointId> optPointId;
+typename DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::OptimizationResult
+DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeFacet(Environment const& env, Facet const& f, uint64_t checkerIndex) {
     std::vector<GeometryValueType> pointCoord;
     GeometryValueType offset;
     if (wvChecker) {
-        wvChecker->check(env, storm::utility::vector::convertNumericVector<ModelValueType>(f.getHalfspace().normalVector()));
-        pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getUnderApproximationOfInitialStateResults());
+        auto& checker = checkerIndex == 0 ? *wvChecker : *additionalWvCheckers[checkerIndex - 1];
+        checker.check(env, storm::utility::vector::convertNumericVector<ModelValueType>(f.getHalfspace().normalVector()));
+        pointCoord = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
         negateMinObjectives(pointCoord);
-        auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getOverApproximationOfInitialStateResults());
+        auto upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
         negateMinObjectives(upperBoundPoint);
         offset = storm::utility::vector::dotProduct(f.getHalfspace().normalVector(), upperBoundPoint);
     } else {
-        auto currentArea = overApproximation->intersection(f.getHalfspace().invert());
-        auto optionalPoint = lpChecker->check(env, overApproximation, eps);
+        auto& checker = checkerIndex == 0 ? *lpChecker : *additionalLpCheckers[checkerIndex - 1];
+        checker.setCurrentWeightVector(env, f.getHalfspace().normalVector());
+        auto optionalPoint = checker.check(env, overApproximation, eps);
         if (optionalPoint.has_value()) {
             pointCoord = std::move(optionalPoint->first);
         } else {
@@ -580,10 +587,70 @@ bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::opti
         }
         offset = std::move(optionalPoint->second);
     }
+    return {std::move(pointCoord), std::move(offset)};
+}
+
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::OptimizationResult>
+DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeFacets(Environment const& env, std::vector<Facet> const& facets) {
+    // Get a checker for each facet. The additional checkers are kept for subsequent rounds.
+    // Each additional LP checker maintains its own MILP, which is built when it is used for the first time.
+    if (wvChecker) {
+        while (additionalWvCheckers.size() + 1 < facets.size()) {
+            auto checkerCopy = wvChecker->clone();
+            if (!checkerCopy) {
+                break;
+            }
+            additionalWvCheckers.push_back(std::move(checkerCopy));
+        }
+    } else {
+        while (additionalLpCheckers.size() + 1 < facets.size()) {
+            additionalLpCheckers.push_back(std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper));
+        }
+    }
+    uint64_t const numberOfCheckers = 1 + (wvChecker ? additionalWvCheckers.size() : additionalLpCheckers.size());
 
-    Point p(pointCoord);
+    std::vector<OptimizationResult> results(facets.size());
+    if (facets.size() == 1 || numberOfCheckers < facets.size()) {
+        STORM_LOG_INFO_COND(facets.size() == 1, "The weight vector checker can not be copied. Facets are optimized sequentially.");
+        for (uint64_t index = 0; index < facets.size(); ++index) {
+            results[index] = optimizeFacet(env, facets[index], 0);
+        }
+        return results;
+    }
+
+    std::mutex mutex;
+    std::exception_ptr exception;
+    auto work = [&](uint64_t index) {
+        try {
+            results[index] = optimizeFacet(env, facets[index], index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t index = 1; index < facets.size(); ++index) {
+        threads.emplace_back(work, index);
+    }
+    work(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return results;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::splitFacet(Environment const& env, Facet& f,
+                                                                                       OptimizationResult&& optimizationResult) {
+    // Insert the explored point
+    boost::optional<PointId> optPointId;
+    Point p(std::move(optimizationResult.first));
     p.setOnFacet();
-    addHalfspaceToOverApproximation(env, f.getHalfspace().normalVector(), offset);
+    addHalfspaceToOverApproximation(env, f.getHalfspace().normalVector(), optimizationResult.second);
     optPointId = pointset.addPoint(env, std::move(p));
 
     // Potentially generate new facets
@@ -152,18 +152,32 @@ class DeterministicSchedsParetoExplorer {
      */
     std::vector<GeometryValueType> getReferenceCoordinates(Environment const& env) const;
 
+    // An achievable point and the offset of a halfspace with the same normal vector that contains all achievable points
+    typedef std::pair<std::vector<GeometryValueType>, GeometryValueType> OptimizationResult;
+
+    /*!
+     * Optimizes in the direction of the given facet using the checkers with the given index (0 for lpChecker and wvChecker).
+     * Only reads the current approximation, i.e., facets can be optimized concurrently using different checkers.
+     */
+    OptimizationResult optimizeFacet(Environment const& env, Facet const& f, uint64_t checkerIndex);
+
+    /*!
+     * Optimizes in the directions of the given facets. If possible, the facets are optimized concurrently using copies of the checkers.
+     */
+    std::vector<OptimizationResult> optimizeFacets(Environment const& env, std::vector<Facet> const& facets);
+
     /*!
      * Processes the given facet
      */
-    void processFacet(Environment const& env, Facet& f);
+    void processFacet(Environment const& env, Facet& f, OptimizationResult&& optimizationResult);
 
     /*!
-     * Optimizes in the facet direction. If this results in a point that does not lie on the facet,
+     * Considers the result of optimizing in the facet direction. If this results in a point that does not lie on the facet,
      * 1. The new Pareto optimal point is added
      * 2. New facets are generated and (if not already precise enough) added to unprocessedFacets
      * 3. true is returned
      */
-    bool optimizeAndSplitFacet(Environment const& env, Facet& f);
+    bool splitFacet(Environment const& env, Facet& f, OptimizationResult&& optimizationResult);
 
     Polytope negateMinObjectives(Polytope const& polytope) const;
     void negateMinObjectives(std::vector<GeometryValueType>& vector) const;
@@ -175,6 +189,9 @@ class DeterministicSchedsParetoExplorer {
     std::vector<GeometryValueType> eps;
     std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>> lpChecker;
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> wvChecker;
+    // Copies of the checkers used to optimize facets concurrently
+    std::vector<std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>> additionalLpCheckers;
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWvCheckers;
     std::vector<DeterministicSchedsObjectiveHelper<SparseModelType>> objectiveHelper;
 
     std::shared_ptr<SparseModelType> const& model;
@@ -69,6 +69,12 @@ class PcaaWeightVectorChecker {
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const;
 
+    /*!
+     * Creates a copy of this weight vector checker (including its precision) which can check weight vectors concurrently to this checker.
+     * Returns nullptr if copying is not supported for this checker.
+     */
+    virtual std::unique_ptr<PcaaWeightVectorChecker<ModelType>> clone() const;
+
    protected:
     /*!
      * Computes the weighted lower or upper bounds for the provided set of objectives.
@@ -56,9 +56,9 @@ template<class SparseModelType, typename GeometryValueType>
 bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchievability(Environment const& env) {
     // repeatedly refine the over/ under approximation until the threshold point is either in the under approx. or not in the over approx.
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        WeightVector separatingVector = this->findSeparatingVector(thresholds);
-        this->updateWeightedPrecision(separatingVector);
-        this->performRefinementStep(env, std::move(separatingVector));
+        std::vector<WeightVector> separatingVectors = this->findSeparatingVectors(thresholds, this->getRefinementBatchSize(env));
+        this->updateWeightedPrecision(separatingVectors.front());
+        this->performRefinementSteps(env, std::move(separatingVectors));
         if (!checkIfThresholdsAreSatisfied(this->overApproximation)) {
             return false;
         }
@@ -1,11 +1,14 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -63,37 +66,52 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getRefinementBatchSize(env); objIndex < this->objectives.size() && directions.size() < batchSize; ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
+    GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
+    storm::utility::ProgressMeasurement progress("refinement steps");
+    progress.startNewMeasurement(this->refinementSteps.size());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<std::pair<GeometryValueType, uint64_t>> halfspaceDistances;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (farestDistance >= precision && !storm::utility::isZero(farestDistance)) {
+                halfspaceDistances.emplace_back(farestDistance, halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        if (halfspaceDistances.empty()) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        std::sort(halfspaceDistances.begin(), halfspaceDistances.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+        });
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+        progress.setResidual(storm::utility::convertNumber<double>(halfspaceDistances.front().first), storm::utility::convertNumber<double>(precision));
+        progress.updateProgress(this->refinementSteps.size());
+        // Refine in the directions of the farest halfspaces
+        std::vector<WeightVector> directions;
+        for (uint64_t i = 0; i < std::min<uint64_t>(halfspaceDistances.size(), this->getRefinementBatchSize(env)); ++i) {
+            directions.push_back(underApproxHalfspaces[halfspaceDistances[i].second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,10 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -11,6 +16,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -87,18 +93,58 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
     return halfspaces[farestHalfspaceIndex].normalVector();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    std::vector<WeightVector> result = {findSeparatingVector(pointToBeSeparated)};
+    if (underApproximation->isEmpty()) {
+        // Every Dirac weight vector is separating
+        while (result.size() < maxNumberOfVectors && !diracWeightVectorsToBeChecked.empty()) {
+            result.push_back(findSeparatingVector(pointToBeSeparated));
+        }
+    } else if (result.size() < maxNumberOfVectors) {
+        std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
+        std::vector<std::pair<GeometryValueType, uint64_t>> candidates;
+        for (uint64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
+            if (!storm::utility::isZero(distance) && halfspaces[halfspaceIndex].normalVector() != result.front()) {
+                candidates.emplace_back(distance, halfspaceIndex);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) {
+            return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+        });
+        for (auto const& candidate : candidates) {
+            if (result.size() >= maxNumberOfVectors) {
+                break;
+            }
+            result.push_back(halfspaces[candidate.second].normalVector());
+        }
+    }
+    return result;
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    refinementSteps.push_back(computeRefinementStep(env, *weightVectorChecker, std::move(direction)));
+
+    updateOverApproximation();
+    updateUnderApproximation();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::computeRefinementStep(
+    Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const {
     // Normalize the direction vector so that the entries sum up to one
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
     step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -106,12 +152,75 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
             step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
         }
     }
-    refinementSteps.push_back(std::move(step));
+    return step;
+}
 
-    updateOverApproximation();
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    // Get a checker for each direction. The additional checkers are copies of the original one and are kept for subsequent rounds.
+    while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+        auto checkerCopy = weightVectorChecker->clone();
+        if (!checkerCopy) {
+            break;
+        }
+        additionalWeightVectorCheckers.push_back(std::move(checkerCopy));
+    }
+    if (directions.size() == 1 || additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+        STORM_LOG_INFO_COND(directions.size() == 1, "The weight vector checker can not be copied. Weight vectors are checked sequentially.");
+        for (auto& direction : directions) {
+            performRefinementStep(env, std::move(direction));
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+        return;
+    }
+    std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers = {weightVectorChecker.get()};
+    for (uint64_t i = 1; i < directions.size(); ++i) {
+        checkers.push_back(additionalWeightVectorCheckers[i - 1].get());
+        checkers.back()->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+    }
+
+    std::vector<RefinementStep> steps(directions.size());
+    std::mutex mutex;
+    std::exception_ptr exception;
+    auto work = [&](uint64_t index) {
+        try {
+            steps[index] = computeRefinementStep(env, *checkers[index], std::move(directions[index]));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t index = 1; index < directions.size(); ++index) {
+        threads.emplace_back(work, index);
+    }
+    work(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    // Merge the halfspaces of all steps
+    for (auto& step : steps) {
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
     updateUnderApproximation();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) const {
+    uint64_t batchSize = env.modelchecker().multi().getRefinementBatchSize();
+    if (env.modelchecker().multi().isMaxStepsSet() && this->refinementSteps.size() < env.modelchecker().multi().getMaxSteps()) {
+        batchSize = std::min<uint64_t>(batchSize, env.modelchecker().multi().getMaxSteps() - this->refinementSteps.size());
+    }
+    return batchSize;
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
     storm::storage::geometry::Halfspace<GeometryValueType> h(
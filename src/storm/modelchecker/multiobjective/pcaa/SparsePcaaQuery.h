@@ -63,11 +63,38 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns up to the given number of (distinct) weight vectors that separate the under approximation from the given point.
+     * The first one is the vector returned by findSeparatingVector. The remaining ones are normal vectors of further halfspaces of the under
+     * approximation (ordered by decreasing distance to the given point) or further Dirac weight vectors if the under approximation is empty.
+     *
+     * @param pointToBeSeparated the point that is to be seperated
+     * @param maxNumberOfVectors the maximal number of vectors
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Checks the given direction with the given checker and returns the resulting refinement step (without adding it).
+     */
+    RefinementStep computeRefinementStep(Environment const& env, PcaaWeightVectorChecker<SparseModelType>& checker, WeightVector&& direction) const;
+
+    /*
+     * Refines the current result w.r.t. each of the given direction vectors.
+     * The weight vectors are checked concurrently using copies of the weight vector checker (if the checker supports this).
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of weight vectors that are to be checked in the next refinement round,
+     * i.e., the refinement batch size unless fewer steps are left before the maximum number of refinement steps is reached.
+     */
+    uint64_t getRefinementBatchSize(Environment const& env) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -94,6 +121,8 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Copies of the weight vector checker used to check several weight vectors concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
@@ -31,6 +31,12 @@ StandardMaPcaaWeightVectorChecker<SparseMaModelType>::StandardMaPcaaWeightVector
     this->initialize(preprocessorResult);
 }
 
+template<class SparseMaModelType>
+std::unique_ptr<PcaaWeightVectorChecker<SparseMaModelType>> StandardMaPcaaWeightVectorChecker<SparseMaModelType>::clone() const {
+    // The copy owns all data that is modified during a check
+    return std::make_unique<StandardMaPcaaWeightVectorChecker<SparseMaModelType>>(*this);
+}
+
 template<class SparseMaModelType>
 void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeModelTypeSpecificData(SparseMaModelType const& model) {
     markovianStates = model.getMarkovianStates();
@@ -28,6 +28,8 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
 
     virtual ~StandardMaPcaaWeightVectorChecker() = default;
 
+    virtual std::unique_ptr<PcaaWeightVectorChecker<SparseMaModelType>> clone() const override;
+
    protected:
     virtual void initializeModelTypeSpecificData(SparseMaModelType const& model) override;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createNondetInfiniteHorizonHelper(
@@ -24,6 +24,12 @@ StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::StandardMdpPcaaWeightVec
     this->initialize(preprocessorResult);
 }
 
+template<class SparseMdpModelType>
+std::unique_ptr<PcaaWeightVectorChecker<SparseMdpModelType>> StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::clone() const {
+    // The copy owns all data that is modified during a check
+    return std::make_unique<StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>>(*this);
+}
+
 template<class SparseMdpModelType>
 void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::initializeModelTypeSpecificData(SparseMdpModelType const& model) {
     // set the state action rewards. Also do some sanity checks on the objectives.
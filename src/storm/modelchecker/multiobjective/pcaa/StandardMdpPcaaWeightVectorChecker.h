@@ -36,6 +36,8 @@ class StandardMdpPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecke
 
     virtual ~StandardMdpPcaaWeightVectorChecker() = default;
 
+    virtual std::unique_ptr<PcaaWeightVectorChecker<SparseMdpModelType>> clone() const override;
+
    protected:
     virtual void initializeModelTypeSpecificData(SparseMdpModelType const& model) override;
     virtual storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> createNondetInfiniteHorizonHelper(
@@ -319,6 +319,25 @@ std::vector<uint64_t> computeValidInitialScheduler(storm::storage::SparseMatrix<
     return result;
 }
 
+/*!
+ * Checks whether the given scheduler is a valid initial scheduler, i.e., whether under this scheduler the rows with sum less than one are eventually
+ * taken with probability one.
+ */
+template<typename ValueType>
+bool isValidInitialScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowsWithSumLessOne,
+                             std::vector<uint64_t> const& choices) {
+    auto const& groups = matrix.getRowGroupIndices();
+    storm::storage::BitVector leavingStates(choices.size(), false);
+    for (uint64_t state = 0; state < choices.size(); ++state) {
+        if (rowsWithSumLessOne.get(groups[state] + choices[state])) {
+            leavingStates.set(state, true);
+        }
+    }
+    // In the induced Markov chain, the states are left with probability one iff every state can reach a leaving state.
+    auto inducedBackwardTransitions = matrix.selectRowsFromRowGroups(choices, false).transpose();
+    return storm::utility::graph::performProbGreater0(inducedBackwardTransitions, storm::storage::BitVector(choices.size(), true), leavingStates).full();
+}
+
 /*!
  * Computes a scheduler taking the choices from the given set only finitely often
  * @param safeStates it is assumed that reaching such a state is unproblematic. The choice for these states is not set.
@@ -434,6 +453,11 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     solver->setTrackScheduler(true);
     solver->setHasUniqueSolution(true);
     solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
+    // Neighboring weight vectors usually yield the same optimal scheduler. Hence, we start from the scheduler of the previous check (if still valid).
+    bool warmStart = !ecQuotient->optimalChoices.empty();
+    if (warmStart && isValidInitialScheduler(ecQuotient->matrix, ecQuotient->rowsWithSumLessOne, ecQuotient->optimalChoices)) {
+        solver->setInitialScheduler(std::vector<uint_fast64_t>(ecQuotient->optimalChoices.begin(), ecQuotient->optimalChoices.end()));
+    }
     auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
     setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix,
                       ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
@@ -451,14 +475,18 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    if (!warmStart) {
+        // Use the (0...0) vector as initial guess for the solution.
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    }
+    // Otherwise, the solution of the previous check is used as initial guess.
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
 
-    transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
-                                        this->optimalChoices);
+    auto const& ecqOptimalChoices = solver->getSchedulerChoices();
+    transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, ecqOptimalChoices, ecqStateToOptimalMecMap, this->weightedResult, this->optimalChoices);
+    ecQuotient->optimalChoices.assign(ecqOptimalChoices.begin(), ecqOptimalChoices.end());
 }
 
 template<class SparseModelType>
@@ -474,6 +502,10 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                 objectiveResults[objIndex2] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+        individualPhaseChoices.clear();
+    } else if (objectivesWithNoUpperTimeBound.full() && !individualPhaseChoices.empty() && individualPhaseChoices == this->optimalChoices) {
+        // The results of the individual objectives only depend on the scheduler, which did not change since the previous check.
+        STORM_LOG_INFO("Scheduler did not change. Reusing the results for the individual objectives.");
     } else {
         storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
         storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
@@ -570,6 +602,10 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                 objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+        // The bounded phase might change the results of the objectives (even of the unbounded ones), so reuse is only possible without bounded objectives
+        if (objectivesWithNoUpperTimeBound.full()) {
+            individualPhaseChoices = this->optimalChoices;
+        }
     }
 }
 
@@ -157,6 +157,8 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
     std::vector<ValueType> offsetsToOverApproximation;
     // The scheduler choices that optimize the weighted rewards of undounded objectives.
     std::vector<uint64_t> optimalChoices;
+    // The scheduler choices for which the current results of the individual objectives have been computed (empty if the results can not be reused).
+    std::vector<uint64_t> individualPhaseChoices;
 
     struct EcQuotient {
         storm::storage::SparseMatrix<ValueType> matrix;
@@ -170,6 +172,8 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
 
         std::vector<ValueType> auxStateValues;
         std::vector<ValueType> auxChoiceValues;
+        // The optimal choices of the most recent solution (empty if there is none). The auxStateValues then contain the most recent solution.
+        std::vector<uint64_t> optimalChoices;
     };
     boost::optional<EcQuotient> ecQuotient;
 
@@ -99,7 +99,8 @@ void SparseMultiObjectivePreprocessor<SparseModelType>::removeIrrelevantStates(s
     storm::storage::BitVector absorbingStates(model->getNumberOfStates(), true);
 
     storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> mc(*model);
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = model->getBackwardTransitions();
+    auto const backwardTransitionsPtr = model->getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = *backwardTransitionsPtr;
 
     for (auto const& opFormula : originalFormula.getSubformulas()) {
         // Compute a set of states from which we can make any subset absorbing without affecting this subformula
@@ -722,7 +723,8 @@ template<typename SparseModelType>
 typename SparseMultiObjectivePreprocessor<SparseModelType>::ReturnType SparseMultiObjectivePreprocessor<SparseModelType>::buildResult(
     SparseModelType const& originalModel, storm::logic::MultiObjectiveFormula const& originalFormula, PreprocessorData& data) {
     ReturnType result(originalFormula, originalModel);
-    auto backwardTransitions = data.model->getBackwardTransitions();
+    auto const backwardTransitionsPtr = data.model->getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
     result.preprocessedModel = data.model;
 
     for (auto& obj : data.objectives) {
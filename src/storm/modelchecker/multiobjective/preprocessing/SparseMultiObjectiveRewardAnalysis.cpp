@@ -29,7 +29,8 @@ template<typename SparseModelType>
 typename SparseMultiObjectiveRewardAnalysis<SparseModelType>::ReturnType SparseMultiObjectiveRewardAnalysis<SparseModelType>::analyze(
     storm::modelchecker::multiobjective::preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult) {
     ReturnType result;
-    auto backwardTransitions = preprocessorResult.preprocessedModel->getBackwardTransitions();
+    auto const backwardTransitionsPtr = preprocessorResult.preprocessedModel->getBackwardTransitions();
+    auto const& backwardTransitions = *backwardTransitionsPtr;
 
     setReward0States(result, preprocessorResult, backwardTransitions);
     checkRewardFiniteness(result, preprocessorResult, backwardTransitions);
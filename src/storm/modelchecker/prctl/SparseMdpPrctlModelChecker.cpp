@@ -1,5 +1,6 @@
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
@@ -7,6 +8,7 @@
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/lexicographic/lexicographicModelChecking.h"
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -14,6 +16,7 @@
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/modelchecker/results/LexicographicCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/SolveGoal.h"
@@ -26,6 +29,23 @@
 
 namespace storm {
 namespace modelchecker {
+
+/*!
+ * Wraps the values computed by the helper into a check result, along with the scheduler (if requested) and the bounds of an interrupted computation.
+ */
+template<typename SolutionType>
+std::unique_ptr<CheckResult> createQuantitativeResult(helper::MDPSparseModelCheckingHelperReturnType<SolutionType>&& ret, bool produceScheduler) {
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<SolutionType>>(std::move(ret.values));
+    if (produceScheduler && ret.scheduler) {
+        result->setScheduler(std::move(ret.scheduler));
+    }
+    if (ret.bounds) {
+        result->setBounds(ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.bounds->first)),
+                          ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.bounds->second)));
+    }
+    return result;
+}
+
 template<typename SparseMdpModelType>
 SparseMdpPrctlModelChecker<SparseMdpModelType>::SparseMdpPrctlModelChecker(SparseMdpModelType const& model)
     : SparsePropositionalModelChecker<SparseMdpModelType>(model) {
@@ -141,13 +161,41 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
             storm::modelchecker::helper::SparseNondeterministicStepBoundedHorizonHelper<ValueType> helper;
             std::vector<SolutionType> numericResult =
                 helper.compute(env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-                               this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(),
+                               *this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(),
                                pathFormula.getNonStrictLowerBound<uint64_t>(), pathFormula.getNonStrictUpperBound<uint64_t>(), checkTask.getHint());
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(numericResult)));
         }
     }
 }
 
+template<typename SparseMdpModelType>
+std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::computeBoundedUntilProbabilities(
+    Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, SolutionType> const& checkTask, std::vector<uint64_t> const& upperBounds) {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We have not yet implemented bounded until with intervals");
+        return nullptr;
+    } else {
+        storm::logic::BoundedUntilFormula const& pathFormula = checkTask.getFormula();
+        STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                        "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+        STORM_LOG_THROW(!pathFormula.isMultiDimensional() && pathFormula.getTimeBoundReference().isStepBound(), storm::exceptions::NotImplementedException,
+                        "Checking several bounds at once is only supported for step-bounded properties on MDPs.");
+        STORM_LOG_THROW(!pathFormula.hasLowerBound(), storm::exceptions::NotImplementedException,
+                        "Checking several step bounds at once is only supported for properties without lower step bound.");
+        std::unique_ptr<CheckResult> leftResultPointer = this->check(env, pathFormula.getLeftSubformula());
+        std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
+        ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
+        ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+        storm::modelchecker::helper::SparseNondeterministicStepBoundedHorizonHelper<ValueType> helper;
+        std::vector<std::vector<SolutionType>> numericResults =
+            helper.compute(env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                           *this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), upperBounds,
+                           checkTask.getHint());
+        return std::make_unique<ExplicitTimeBoundsCheckResult<SolutionType>>(std::vector<double>(upperBounds.begin(), upperBounds.end()),
+                                                                             std::move(numericResults));
+    }
+}
+
 template<typename SparseMdpModelType>
 std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::computeNextProbabilities(
     Environment const& env, CheckTask<storm::logic::NextFormula, SolutionType> const& checkTask) {
@@ -171,15 +219,36 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    if constexpr (std::is_same_v<ValueType, SolutionType>) {
+        if (env.modelchecker().isAnalysisCacheEnabled() && !checkTask.isProduceSchedulersSet()) {
+            // Reuse the backward transitions and the results of previous computations with the same phi and psi states and optimization direction.
+            auto cache = this->getModel().getAnalysisCache();
+            ExplicitModelCheckerHint<ValueType> cachedHint;
+            auto const* cachedResult =
+                cache->findUntilProbabilities(leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.getOptimizationDirection());
+            if (cachedResult && checkTask.getHint().isEmpty()) {
+                cachedHint.setResultHint(cachedResult->values);
+                cachedHint.setMaybeStates(cachedResult->maybeStates);
+                cachedHint.setComputeOnlyMaybeStates(true);
+            }
+            auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
+                env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                *cache->getBackwardTransitions(this->getModel().getTransitionMatrix()), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(),
+                checkTask.isQualitativeSet(), false, cachedHint.isEmpty() ? checkTask.getHint() : cachedHint);
+            // Values of an interrupted computation are not precise enough to be reused. Moreover, only results whose maybe states stem from our own
+            // graph analysis are cached (a given hint might specify arbitrary maybe states).
+            if (!checkTask.isQualitativeSet() && !ret.bounds && ret.maybeStates && checkTask.getHint().isEmpty()) {
+                cache->storeUntilProbabilities(leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.getOptimizationDirection(),
+                                              *ret.maybeStates, ret.values);
+            }
+            return createQuantitativeResult(std::move(ret), false);
+        }
+    }
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+        *this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
         checkTask.isProduceSchedulersSet(), checkTask.getHint());
-    std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
-    if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
-        result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
-    }
-    return result;
+    return createQuantitativeResult(std::move(ret), checkTask.isProduceSchedulersSet());
 }
 
 template<typename SparseMdpModelType>
@@ -192,12 +261,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeGloballyProbabilities(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet());
-    std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
-    if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
-        result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
-    }
-    return result;
+        *this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet());
+    return createQuantitativeResult(std::move(ret), checkTask.isProduceSchedulersSet());
 }
 
 template<typename SparseMdpModelType>
@@ -276,7 +341,7 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
 
     return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeConditionalProbabilities(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+        *this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
 }
 
 template<typename SparseMdpModelType>
@@ -339,13 +404,9 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
+        *this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
         checkTask.isProduceSchedulersSet(), checkTask.getHint());
-    std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
-    if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
-        result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
-    }
-    return result;
+    return createQuantitativeResult(std::move(ret), checkTask.isProduceSchedulersSet());
 }
 
 template<typename SparseMdpModelType>
@@ -358,13 +419,9 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityTimes(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(),
+        *this->getModel().getBackwardTransitions(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(),
         checkTask.getHint());
-    std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
-    if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
-        result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
-    }
-    return result;
+    return createQuantitativeResult(std::move(ret), checkTask.isProduceSchedulersSet());
 }
 
 template<typename SparseMdpModelType>
@@ -375,12 +432,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeTotalRewards(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), rewardModel.get(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(), checkTask.getHint());
-    std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<SolutionType>(std::move(ret.values)));
-    if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
-        result->asExplicitQuantitativeCheckResult<SolutionType>().setScheduler(std::move(ret.scheduler));
-    }
-    return result;
+        *this->getModel().getBackwardTransitions(), rewardModel.get(), checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(), checkTask.getHint());
+    return createQuantitativeResult(std::move(ret), checkTask.isProduceSchedulersSet());
 }
 
 template<typename SparseMdpModelType>
@@ -28,6 +28,15 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
     virtual bool canHandle(CheckTask<storm::logic::Formula, SolutionType> const& checkTask) const override;
     virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
                                                                           CheckTask<storm::logic::BoundedUntilFormula, SolutionType> const& checkTask) override;
+
+    /*!
+     * Computes the probabilities of the given bounded until formula for several step bounds at once, i.e., the upper step bound of the formula is
+     * replaced by each of the given (ascendingly sorted) step bounds. The formula must not have a lower step bound.
+     */
+    std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                  CheckTask<storm::logic::BoundedUntilFormula, SolutionType> const& checkTask,
+                                                                  std::vector<uint64_t> const& upperBounds);
+
     virtual std::unique_ptr<CheckResult> computeNextProbabilities(Environment const& env,
                                                                   CheckTask<storm::logic::NextFormula, SolutionType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
@@ -0,0 +1,130 @@
+#include "storm/modelchecker/prctl/SparseReachabilityBatch.h"
+
+#include <string>
+#include <utility>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/Telemetry.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+SparseReachabilityBatch<ValueType>::SparseReachabilityBatch(std::shared_ptr<ModelType const> const& model,
+                                                            std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
+    : model(model) {
+    bool const isDtmc = model->isOfType(storm::models::ModelType::Dtmc);
+    bool const isMdp = model->isOfType(storm::models::ModelType::Mdp);
+    if (!isDtmc && !isMdp) {
+        return;
+    }
+
+    std::map<std::pair<std::string, std::optional<storm::solver::OptimizationDirection>>, Group> candidates;
+    for (auto const& formula : formulas) {
+        if (!formula->isProbabilityOperatorFormula()) {
+            continue;
+        }
+        auto const& probabilityOperator = formula->asProbabilityOperatorFormula();
+        if (probabilityOperator.hasBound() || (isMdp && !probabilityOperator.hasOptimalityType())) {
+            continue;
+        }
+        auto const& pathFormula = probabilityOperator.getSubformula();
+        std::shared_ptr<storm::logic::Formula const> phi, psi;
+        if (pathFormula.isEventuallyFormula() && pathFormula.asEventuallyFormula().getSubformula().isInFragment(storm::logic::propositional())) {
+            phi = std::make_shared<storm::logic::BooleanLiteralFormula>(true);
+            psi = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+        } else if (pathFormula.isUntilFormula() && pathFormula.asUntilFormula().getLeftSubformula().isInFragment(storm::logic::propositional()) &&
+                   pathFormula.asUntilFormula().getRightSubformula().isInFragment(storm::logic::propositional())) {
+            phi = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+            psi = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+        } else {
+            continue;
+        }
+        std::optional<storm::solver::OptimizationDirection> direction;
+        if (isMdp) {
+            direction = probabilityOperator.getOptimalityType();
+        }
+        Group& group = candidates[std::make_pair(phi->toString(), direction)];
+        if (!group.phi) {
+            group.phi = phi;
+            group.direction = direction;
+        }
+        group.formulas.push_back(formula.get());
+        group.goals.push_back(psi);
+    }
+
+    for (auto& entry : candidates) {
+        if (entry.second.formulas.size() > 1) {
+            for (auto const& formula : entry.second.formulas) {
+                formulaToGroup[formula] = groups.size();
+            }
+            STORM_LOG_INFO("Checking " << entry.second.formulas.size() << " reachability properties with left subformula " << *entry.second.phi
+                                       << " together.");
+            groups.push_back(std::move(entry.second));
+        }
+    }
+}
+
+template<typename ValueType>
+bool SparseReachabilityBatch<ValueType>::contains(storm::logic::Formula const& formula) const {
+    return results.count(&formula) > 0 || formulaToGroup.count(&formula) > 0;
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> SparseReachabilityBatch<ValueType>::check(Environment const& env, storm::logic::Formula const& formula) {
+    auto resultIt = results.find(&formula);
+    if (resultIt == results.end()) {
+        auto groupIt = formulaToGroup.find(&formula);
+        STORM_LOG_THROW(groupIt != formulaToGroup.end(), storm::exceptions::InvalidArgumentException,
+                        "The formula " << formula << " is not contained in the batch.");
+        computeGroup(env, groups[groupIt->second]);
+        resultIt = results.find(&formula);
+    }
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(resultIt->second));
+    results.erase(resultIt);
+    return result;
+}
+
+template<typename ValueType>
+void SparseReachabilityBatch<ValueType>::computeGroup(Environment const& env, Group const& group) {
+    storm::utility::telemetry::Scope telemetryScope("batched-reachability");
+    storm::utility::telemetry::setAttribute("goals", static_cast<uint64_t>(group.goals.size()));
+
+    SparsePropositionalModelChecker<ModelType> propositionalChecker(*model);
+    auto getStates = [&propositionalChecker](storm::logic::Formula const& stateFormula) {
+        return propositionalChecker.check(stateFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+    };
+    storm::storage::BitVector phiStates = getStates(*group.phi);
+    std::vector<storm::storage::BitVector> psiStates;
+    for (auto const& goal : group.goals) {
+        psiStates.push_back(getStates(*goal));
+    }
+
+    std::vector<std::vector<ValueType>> values;
+    if (group.direction) {
+        values = helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilitiesBatch(env, *group.direction, model->getTransitionMatrix(),
+                                                                                         *model->getBackwardTransitions(), phiStates, psiStates);
+    } else {
+        values = helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilitiesBatch(env, model->getTransitionMatrix(), *model->getBackwardTransitions(),
+                                                                                          phiStates, psiStates);
+    }
+    for (uint64_t goal = 0; goal < group.formulas.size(); ++goal) {
+        formulaToGroup.erase(group.formulas[goal]);
+        results[group.formulas[goal]] = std::move(values[goal]);
+    }
+}
+
+template class SparseReachabilityBatch<double>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+class Environment;
+
+namespace logic {
+class Formula;
+}
+
+namespace models::sparse {
+template<typename ValueType>
+class StandardRewardModel;
+template<typename ValueType, typename RewardModelType>
+class Model;
+}  // namespace models::sparse
+
+namespace modelchecker {
+class CheckResult;
+
+/*!
+ * Checks several reachability probabilities P=? [phi U psi] (or P=? [F psi]) with propositional phi and psi on a DTMC or an MDP together.
+ * Formulas are compatible if they agree on phi (and, for MDPs, on the optimization direction). Each group of at least two compatible formulas is
+ * checked by a single batched computation once the result for one of its formulas is requested.
+ */
+template<typename ValueType>
+class SparseReachabilityBatch {
+   public:
+    typedef storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> ModelType;
+
+    /*!
+     * Groups the compatible formulas among the given ones. The formulas are identified by their address, i.e., they must not be destroyed while this
+     * batch is used.
+     */
+    SparseReachabilityBatch(std::shared_ptr<ModelType const> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
+    /*!
+     * Retrieves whether the result for the given formula can be retrieved from this batch.
+     */
+    bool contains(storm::logic::Formula const& formula) const;
+
+    /*!
+     * Retrieves the result for all states of the given formula, which must be contained in this batch. Computes the results of all formulas of the same
+     * group if necessary. Afterwards, the formula is no longer contained in this batch.
+     */
+    std::unique_ptr<CheckResult> check(Environment const& env, storm::logic::Formula const& formula);
+
+   private:
+    struct Group {
+        std::shared_ptr<storm::logic::Formula const> phi;
+        std::optional<storm::solver::OptimizationDirection> direction;
+        std::vector<storm::logic::Formula const*> formulas;
+        std::vector<std::shared_ptr<storm::logic::Formula const>> goals;
+    };
+
+    void computeGroup(Environment const& env, Group const& group);
+
+    std::shared_ptr<ModelType const> model;
+    std::vector<Group> groups;
+    // The index of the group of the formulas whose results are not computed yet
+    std::map<storm::logic::Formula const*, uint64_t> formulaToGroup;
+    std::map<storm::logic::Formula const*, std::vector<ValueType>> results;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -2,7 +2,10 @@
 
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/helper/infinitehorizon/SymbolicInfiniteHorizonHelper.h"
+#include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 #include "storm/modelchecker/prctl/helper/SymbolicDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
@@ -23,7 +26,8 @@ template<typename ModelType>
 bool SymbolicDtmcPrctlModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
     storm::logic::Formula const& formula = checkTask.getFormula();
     return formula.isInFragment(storm::logic::prctl()
-                                    .setLongRunAverageRewardFormulasAllowed(false)
+                                    .setLongRunAverageRewardFormulasAllowed(std::is_same_v<ValueType, double>)
+                                    .setLongRunAverageProbabilitiesAllowed(std::is_same_v<ValueType, double>)
                                     .setTimeOperatorsAllowed(true)
                                     .setReachbilityTimeFormulasAllowed(true)
                                     .setRewardAccumulationAllowed(true));
@@ -135,6 +139,36 @@ std::unique_ptr<CheckResult> SymbolicDtmcPrctlModelChecker<ModelType>::computeRe
     return std::make_unique<SymbolicQuantitativeCheckResult<DdType, ValueType>>(this->getModel().getReachableStates(), numericResult);
 }
 
+template<typename ModelType>
+std::unique_ptr<CheckResult> SymbolicDtmcPrctlModelChecker<ModelType>::computeLongRunAverageProbabilities(
+    Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+        std::unique_ptr<CheckResult> subResultPointer = this->check(env, stateFormula);
+        SymbolicQualitativeCheckResult<DdType> const& subResult = subResultPointer->asSymbolicQualitativeCheckResult<DdType>();
+
+        storm::modelchecker::helper::SymbolicInfiniteHorizonHelper<ValueType, DdType, false> helper(this->getModel(), this->getModel().getTransitionMatrix());
+        storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+        return helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Long run average computations are only supported for double precision values.");
+    }
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SymbolicDtmcPrctlModelChecker<ModelType>::computeLongRunAverageRewards(
+    Environment const& env, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+
+        storm::modelchecker::helper::SymbolicInfiniteHorizonHelper<ValueType, DdType, false> helper(this->getModel(), this->getModel().getTransitionMatrix());
+        storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+        return helper.computeLongRunAverageRewards(env, rewardModel.get());
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Long run average computations are only supported for double precision values.");
+    }
+}
+
 template class SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>;
 template class SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>;
 
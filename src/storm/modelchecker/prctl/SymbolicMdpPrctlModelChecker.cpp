@@ -3,7 +3,10 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/helper/infinitehorizon/SymbolicInfiniteHorizonHelper.h"
+#include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
@@ -24,7 +27,8 @@ template<typename ModelType>
 bool SymbolicMdpPrctlModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
     storm::logic::Formula const& formula = checkTask.getFormula();
     return formula.isInFragment(storm::logic::prctl()
-                                    .setLongRunAverageRewardFormulasAllowed(false)
+                                    .setLongRunAverageRewardFormulasAllowed(std::is_same_v<ValueType, double>)
+                                    .setLongRunAverageProbabilitiesAllowed(std::is_same_v<ValueType, double>)
                                     .setTimeOperatorsAllowed(true)
                                     .setReachbilityTimeFormulasAllowed(true)
                                     .setRewardAccumulationAllowed(true));
@@ -145,6 +149,40 @@ std::unique_ptr<CheckResult> SymbolicMdpPrctlModelChecker<ModelType>::computeRea
         env, checkTask.getOptimizationDirection(), this->getModel(), this->getModel().getTransitionMatrix(), subResult.getTruthValuesVector());
 }
 
+template<typename ModelType>
+std::unique_ptr<CheckResult> SymbolicMdpPrctlModelChecker<ModelType>::computeLongRunAverageProbabilities(
+    Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+    STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+        std::unique_ptr<CheckResult> subResultPointer = this->check(env, stateFormula);
+        SymbolicQualitativeCheckResult<DdType> const& subResult = subResultPointer->asSymbolicQualitativeCheckResult<DdType>();
+
+        storm::modelchecker::helper::SymbolicInfiniteHorizonHelper<ValueType, DdType, true> helper(this->getModel(), this->getModel().getTransitionMatrix());
+        storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+        return helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Long run average computations are only supported for double precision values.");
+    }
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SymbolicMdpPrctlModelChecker<ModelType>::computeLongRunAverageRewards(
+    Environment const& env, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) {
+    STORM_LOG_THROW(checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException,
+                    "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+
+        storm::modelchecker::helper::SymbolicInfiniteHorizonHelper<ValueType, DdType, true> helper(this->getModel(), this->getModel().getTransitionMatrix());
+        storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+        return helper.computeLongRunAverageRewards(env, rewardModel.get());
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Long run average computations are only supported for double precision values.");
+    }
+}
+
 template class SymbolicMdpPrctlModelChecker<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>;
 template class SymbolicMdpPrctlModelChecker<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>;
 
@@ -36,6 +36,10 @@ class SymbolicMdpPrctlModelChecker : public SymbolicPropositionalModelChecker<Mo
                                                                     CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env,
                                                                   CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeLongRunAverageProbabilities(Environment const& env,
+                                                                            CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(
+        Environment const& env, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
 };
 
 }  // namespace modelchecker
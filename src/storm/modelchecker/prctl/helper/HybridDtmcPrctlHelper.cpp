@@ -212,13 +212,13 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeIn
     storm::utility::Stopwatch conversionWatch(true);
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    // Translate the symbolic matrix to its explicit representations (or reuse a previous translation).
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = model.getExplicitMatrix(transitionMatrix);
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -248,10 +248,10 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeCu
     storm::utility::Stopwatch conversionWatch(true);
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
-    // Translate the symbolic matrix/vector to their explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+    // Translate the symbolic matrix/vector to their explicit representations (or reuse a previous translation of the matrix).
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = model.getExplicitMatrix(transitionMatrix);
     std::vector<ValueType> b = totalRewardVector.toVector(odd);
     conversionWatch.stop();
     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
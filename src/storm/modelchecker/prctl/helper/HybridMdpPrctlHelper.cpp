@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/HybridMdpPrctlHelper.h"
 
+#include <algorithm>
+
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
@@ -9,6 +11,7 @@
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/graph.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -20,6 +23,11 @@
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -133,6 +141,144 @@ void eliminateEndComponentsAndExtendedStatesUntilProbabilities(
     }
 }
 
+/*!
+ * Solves the until probabilities of the given maybe states in topological order of their SCCs. The SCCs are computed symbolically. Batches of SCCs whose
+ * successors are already solved are converted to an explicit representation and solved one after another, where the values of the solved states are kept
+ * symbolically. Hence, the explicit representation of at most one batch (which has at most as many states as the largest SCC) exists at any time.
+ *
+ * @return the values of the maybe states w.r.t. the given ODD.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+std::vector<ValueType> computeUntilProbabilitiesTopologically(Environment const& env, OptimizationDirection dir,
+                                                              storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
+                                                              storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                              storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& targetStates,
+                                                              storm::dd::Odd const& odd) {
+    // The batches are solved with the method underlying the topological solver.
+    Environment subEnv(env);
+    subEnv.solver().minMax().setMethod(env.solver().topological().getUnderlyingMinMaxMethod(),
+                                       env.solver().topological().isUnderlyingMinMaxMethodSetFromDefault());
+
+    // If we minimize, we know that the solution to the equation system has no end components
+    bool hasNoEndComponents = dir == storm::solver::OptimizationDirection::Minimize;
+    storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    storm::solver::MinMaxLinearEquationSolverRequirements requirements =
+        linearEquationSolverFactory.getRequirements(subEnv, hasNoEndComponents, hasNoEndComponents, dir);
+    storm::solver::MinMaxLinearEquationSolverRequirements clearedRequirements = requirements;
+    bool const eliminateEndComponents = requirements.uniqueSolution();
+    if (eliminateEndComponents) {
+        STORM_LOG_DEBUG("Scheduling EC elimination, because the solver requires a unique solution.");
+        clearedRequirements.clearUniqueSolution();
+        hasNoEndComponents = true;
+    }
+    clearedRequirements.clearValidInitialScheduler();
+    clearedRequirements.clearBounds();
+    STORM_LOG_THROW(!clearedRequirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + clearedRequirements.getEnabledRequirementsAsString() + " not checked.");
+
+    // Decompose the maybe states into SCCs and determine for each SCC the maybe states reachable in one step.
+    auto const& pairs = model.getRowColumnMetaVariablePairs();
+    storm::dd::Bdd<DdType> maybeTransitions =
+        (transitionMatrix.notZero() && maybeStates && maybeStates.swapVariables(pairs)).existsAbstract(model.getNondeterminismVariables());
+    std::vector<storm::dd::Bdd<DdType>> components =
+        storm::utility::dd::computeStronglyConnectedComponents(maybeStates, maybeTransitions, model.getRowVariables(), model.getColumnVariables());
+    std::vector<storm::dd::Bdd<DdType>> componentSuccessors;
+    std::vector<uint64_t> componentSizes;
+    uint64_t maximalBatchSize = 0;
+    for (auto const& component : components) {
+        componentSuccessors.push_back(component.relationalProduct(maybeTransitions, model.getRowVariables(), model.getColumnVariables()) && !component);
+        componentSizes.push_back(component.getNonZeroCount());
+        maximalBatchSize = std::max(maximalBatchSize, componentSizes.back());
+    }
+
+    storm::dd::Add<DdType, ValueType> targetStatesAsColumn = targetStates.template toAdd<ValueType>().swapVariables(pairs);
+    storm::dd::Add<DdType, ValueType> solvedValues = model.getManager().template getAddZero<ValueType>();
+    storm::dd::Bdd<DdType> solvedStates = model.getManager().getBddZero();
+    std::vector<bool> componentScheduled(components.size(), false);
+    uint64_t numberOfScheduledComponents = 0;
+    uint64_t numberOfBatches = 0;
+    storm::utility::Stopwatch conversionWatch;
+    while (numberOfScheduledComponents < components.size()) {
+        // Gather SCCs whose successors are solved until the batch has the size of the largest SCC.
+        storm::dd::Bdd<DdType> batch = model.getManager().getBddZero();
+        uint64_t batchSize = 0;
+        for (uint64_t component = 0; component < components.size(); ++component) {
+            if (!componentScheduled[component] && (batchSize == 0 || batchSize + componentSizes[component] <= maximalBatchSize) &&
+                (componentSuccessors[component] && !solvedStates).isZero()) {
+                batch |= components[component];
+                batchSize += componentSizes[component];
+                componentScheduled[component] = true;
+                ++numberOfScheduledComponents;
+            }
+        }
+        STORM_LOG_ASSERT(batchSize > 0, "No SCC can be solved.");
+
+        // Translate the batch. The right-hand side contains the probabilities to move to a target state or to an already solved state.
+        conversionWatch.start();
+        storm::dd::Odd batchOdd = batch.createOdd();
+        storm::dd::Add<DdType, ValueType> batchTransitions = transitionMatrix * batch.template toAdd<ValueType>();
+        storm::dd::Add<DdType, ValueType> rhs =
+            (batchTransitions * (targetStatesAsColumn + solvedValues.swapVariables(pairs))).sumAbstract(model.getColumnVariables());
+        storm::dd::Bdd<DdType> batchAsColumn = batch.swapVariables(pairs);
+        storm::dd::Add<DdType, ValueType> leavingChoices =
+            (batchTransitions.notZero() && !batchAsColumn).existsAbstract(model.getColumnVariables()).template toAdd<ValueType>();
+        auto explicitRepresentation = (batchTransitions * batchAsColumn.template toAdd<ValueType>())
+                                          .toMatrixVectors({rhs, leavingChoices}, model.getNondeterminismVariables(), batchOdd, batchOdd);
+        conversionWatch.stop();
+        storm::storage::SparseMatrix<ValueType>& submatrix = explicitRepresentation.first;
+        std::vector<ValueType>& subvector = explicitRepresentation.second[0];
+        uint64_t const numberOfBatchStates = submatrix.getRowGroupCount();
+        storm::storage::BitVector const allBatchStates(numberOfBatchStates, true);
+
+        // Eliminate the end components within the batch (if required). Only the choices that stay within the batch can be part of an end component.
+        boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
+        if (eliminateEndComponents) {
+            storm::storage::BitVector stayingChoices(submatrix.getRowCount());
+            for (uint64_t row = 0; row < submatrix.getRowCount(); ++row) {
+                stayingChoices.set(row, storm::utility::isZero(explicitRepresentation.second[1][row]));
+            }
+            storm::storage::MaximalEndComponentDecomposition<ValueType> endComponentDecomposition(submatrix, submatrix.transpose(true), allBatchStates,
+                                                                                                  stayingChoices);
+            if (!endComponentDecomposition.empty()) {
+                storm::storage::SparseMatrix<ValueType> reducedMatrix;
+                std::vector<ValueType> reducedVector;
+                ecInformation = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, submatrix, subvector,
+                                                                                                    allBatchStates, reducedMatrix, reducedVector);
+                submatrix = std::move(reducedMatrix);
+                subvector = std::move(reducedVector);
+            }
+        }
+        boost::optional<std::vector<uint64_t>> initialScheduler;
+        if (requirements.validInitialScheduler() && !hasNoEndComponents) {
+            initialScheduler = computeValidInitialSchedulerForUntilProbabilities<ValueType>(submatrix, subvector);
+        }
+
+        std::vector<ValueType> x(submatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(subEnv, std::move(submatrix));
+        solver->setHasUniqueSolution(hasNoEndComponents);
+        solver->setHasNoEndComponents(hasNoEndComponents);
+        if (initialScheduler) {
+            solver->setInitialScheduler(std::move(initialScheduler.get()));
+        }
+        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        solver->setRequirementsChecked();
+        solver->solveEquations(subEnv, dir, x, subvector);
+        if (ecInformation) {
+            std::vector<ValueType> extendedVector(numberOfBatchStates);
+            ecInformation.get().setValues(extendedVector, allBatchStates, x);
+            x = std::move(extendedVector);
+        }
+
+        // Keep the values symbolically, such that the explicit representation of the batch can be released.
+        solvedValues += storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), x, batchOdd, model.getRowVariables());
+        solvedStates |= batch;
+        ++numberOfBatches;
+    }
+    STORM_LOG_INFO("Solved " << components.size() << " SCC(s) of the maybe states in " << numberOfBatches << " batch(es) of at most " << maximalBatchSize
+                             << " states. Converting the batches to an explicit representation took " << conversionWatch.getTimeInMilliseconds() << "ms.");
+    return solvedValues.toVector(odd);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
@@ -162,7 +308,15 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeUnt
                 maybeStates.template toAdd<ValueType>() * model.getManager().getConstant(storm::utility::convertNumber<ValueType>(0.5))));
     } else {
         // If there are maybe states, we need to solve an equation system.
-        if (!maybeStates.isZero()) {
+        if (!maybeStates.isZero() && env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::Topological) {
+            // Avoid translating all maybe states at once by solving their SCCs one after another.
+            storm::dd::Odd odd = maybeStates.createOdd();
+            std::vector<ValueType> x =
+                computeUntilProbabilitiesTopologically(env, dir, model, transitionMatrix, maybeStates, statesWithProbability01.second, odd);
+            return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(), maybeStates,
+                odd, x));
+        } else if (!maybeStates.isZero()) {
             // If we minimize, we know that the solution to the equation system has no end components
             bool hasNoEndComponents = dir == storm::solver::OptimizationDirection::Minimize;
             // Check for requirements of the solver early so we can adjust the maybe state computation accordingly.
@@ -387,10 +541,10 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeIns
     storm::utility::Stopwatch conversionWatch;
 
     // Create the ODD for the translation between symbolic and explicit storage.
-    storm::dd::Odd odd = model.getReachableStates().createOdd();
+    storm::dd::Odd const& odd = model.getReachableStatesOdd();
 
-    // Translate the symbolic matrix to its explicit representations.
-    storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+    // Translate the symbolic matrix to its explicit representations (or reuse a previous translation).
+    storm::storage::SparseMatrix<ValueType> const& explicitMatrix = model.getExplicitMatrix(transitionMatrix);
 
     // Create the solution vector (and initialize it to the state rewards of the model).
     std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
@@ -2,14 +2,13 @@
 #define MDPMODELCHECKINGHELPERRETURNTYPE_H
 
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
+#include "storm/storage/BitVector.h"
 #include "storm/storage/Scheduler.h"
 
 namespace storm {
-namespace storage {
-class BitVector;
-}
-
 namespace modelchecker {
 namespace helper {
 template<typename ValueType>
@@ -31,6 +30,12 @@ struct MDPSparseModelCheckingHelperReturnType {
 
     // A scheduler, if it was computed.
     std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+
+    // Lower and upper bounds on the values, if the computation was interrupted before converging.
+    std::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> bounds;
+
+    // The states whose values are neither zero nor one according to the graph analysis, if such an analysis was performed.
+    std::optional<storm::storage::BitVector> maybeStates;
 };
 }  // namespace helper
 
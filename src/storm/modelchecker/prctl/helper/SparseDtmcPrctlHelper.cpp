@@ -1,5 +1,9 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
@@ -12,6 +16,7 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/BlockValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
@@ -19,6 +24,8 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -31,6 +38,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Telemetry.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/macros.h"
@@ -83,33 +91,49 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     // Set the correct equation problem format.
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
-
-    storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
-    progress.startNewMeasurement(0);
-    uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
+    rewardUnfolding.setEpochSolutionStorage(env);
+
+    uint64_t const numberOfThreads = env.modelchecker().getEpochThreads();
+    bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+    STORM_LOG_WARN_COND(numberOfThreads == 1 || !exportCdf, "Epochs are analyzed sequentially as the cdf is exported.");
+    if (numberOfThreads > 1 && !exportCdf) {
+        // Independent epochs are analyzed concurrently, each thread uses its own solver
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
         swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+        rewardUnfolding.analyzeEpochsConcurrently(
+            initEpoch, numberOfThreads, [&](helper::rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t thread) {
+                return epochModel.analyzeSingleObjective(preciseEnv, threadX[thread], threadB[thread], threadSolvers[thread], lowerBound, upperBound);
+            });
         swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    } else {
+        storm::utility::ProgressMeasurement progress("epochs");
+        progress.setMaxCount(epochOrder.size());
+        progress.startNewMeasurement(0);
+        uint64_t numCheckedEpochs = 0;
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
+            }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
         }
     }
 
@@ -148,7 +172,7 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::storage::BitVector* maybeStatesOut) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
@@ -175,12 +199,14 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits()
                                          << " states remaining).");
     } else {
+        storm::utility::telemetry::Scope telemetryScope("qualitative-analysis");
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
             storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
+        storm::utility::telemetry::setAttribute("maybe-states", maybeStates.getNumberOfSetBits());
 
         STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                          << statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << maybeStates.getNumberOfSetBits()
@@ -240,6 +266,83 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, x);
         }
     }
+    if (maybeStatesOut) {
+        *maybeStatesOut = std::move(maybeStates);
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<std::vector<ValueType>> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, std::vector<storm::storage::BitVector> const& psiStates) {
+    uint64_t const numberOfGoals = psiStates.size();
+    std::vector<std::vector<ValueType>> result(numberOfGoals, std::vector<ValueType>(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>()));
+    std::vector<storm::storage::BitVector> maybeStates, statesWithProbability1;
+    {
+        storm::utility::telemetry::Scope telemetryScope("qualitative-analysis");
+        for (uint64_t goal = 0; goal < numberOfGoals; ++goal) {
+            auto statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates[goal]);
+            maybeStates.push_back(~(statesWithProbability01.first | statesWithProbability01.second));
+            statesWithProbability1.push_back(std::move(statesWithProbability01.second));
+            storm::utility::vector::setVectorValues<ValueType>(result[goal], statesWithProbability1.back(), storm::utility::one<ValueType>());
+        }
+    }
+
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native &&
+            env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power && !env.solver().isForceSoundness()) {
+            // The values of the maybe states are approached from below.
+            std::vector<ValueType> operands(transitionMatrix.getRowCount() * numberOfGoals, storm::utility::zero<ValueType>());
+            for (uint64_t goal = 0; goal < numberOfGoals; ++goal) {
+                for (auto state : statesWithProbability1[goal]) {
+                    operands[state * numberOfGoals + goal] = storm::utility::one<ValueType>();
+                }
+            }
+            storm::solver::helper::BlockValueIterationHelper<ValueType> blockHelper(transitionMatrix, numberOfGoals);
+            uint64_t numIterations = 0;
+            auto status = blockHelper.VI(operands, maybeStates, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                         storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()),
+                                         env.solver().native().getMaximalNumberOfIterations());
+            STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                                "Block value iteration for " << numberOfGoals << " goals did not converge after " << numIterations << " iterations.");
+            STORM_LOG_INFO("Block value iteration for " << numberOfGoals << " goals took " << numIterations << " iterations.");
+            for (uint64_t goal = 0; goal < numberOfGoals; ++goal) {
+                for (auto state : maybeStates[goal]) {
+                    result[goal][state] = operands[state * numberOfGoals + goal];
+                }
+            }
+            return result;
+        }
+    }
+
+    // Goals with the same maybe states have the same equation system, which is only created (and factorized) once.
+    std::map<storm::storage::BitVector, std::vector<uint64_t>> goalsWithMaybeStates;
+    for (uint64_t goal = 0; goal < numberOfGoals; ++goal) {
+        if (!maybeStates[goal].empty()) {
+            goalsWithMaybeStates[maybeStates[goal]].push_back(goal);
+        }
+    }
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    for (auto const& entry : goalsWithMaybeStates) {
+        storm::storage::BitVector const& maybe = entry.first;
+        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybe, maybe, convertToEquationSystem);
+        if (convertToEquationSystem) {
+            submatrix.convertToEquationSystem();
+        }
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::solver::configureLinearEquationSolver(
+            env, storm::solver::SolveGoal<ValueType>(), linearEquationSolverFactory, std::move(submatrix));
+        solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+        solver->setCachingEnabled(true);
+        for (auto goal : entry.second) {
+            std::vector<ValueType> x(maybe.getNumberOfSetBits(), storm::utility::convertNumber<ValueType>(0.5));
+            std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybe, statesWithProbability1[goal]);
+            solver->solveEquations(env, x, b);
+            storm::utility::vector::setVectorValues<ValueType>(result[goal], maybe, x);
+        }
+    }
     return result;
 }
 
@@ -725,6 +828,106 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     return result;
 }
 
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeConditionalProbabilitiesWithProduct(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
+    storm::storage::BitVector const& conditionStates, bool qualitative) {
+    uint64_t const numberOfStates = transitionMatrix.getRowCount();
+    std::vector<ValueType> result(numberOfStates, storm::utility::infinity<ValueType>());
+
+    // The conditional probability is only defined for the states that can reach a condition state.
+    storm::storage::BitVector definedStates =
+        storm::utility::graph::performProbGreater0(backwardTransitions, storm::storage::BitVector(numberOfStates, true), conditionStates);
+    if (definedStates.empty()) {
+        return result;
+    }
+
+    // The memory of the product is a bit mask that tracks whether a target state (first bit) and a condition state (second bit) were visited (including
+    // the current state). Product states in which both were visited are merged into a single absorbing goal state. The copy with memory m only consists
+    // of the states that are consistent with m, e.g., the copy in which only a target state was visited does not contain condition states.
+    uint64_t const targetBit = 1;
+    uint64_t const conditionBit = 2;
+    uint64_t const bothBits = targetBit | conditionBit;
+    auto getMemory = [&](uint64_t state) { return (targetStates.get(state) ? targetBit : 0) | (conditionStates.get(state) ? conditionBit : 0); };
+    std::array<storm::storage::BitVector, 3> copyStates = {~targetStates & ~conditionStates, ~conditionStates, ~targetStates};
+    std::array<std::vector<uint_fast64_t>, 3> numberOfStatesBeforeIndexInCopy;
+    std::array<uint64_t, 3> copyOffsets;
+    uint64_t numberOfProductStates = 0;
+    for (uint64_t memory = 0; memory < 3; ++memory) {
+        numberOfStatesBeforeIndexInCopy[memory] = copyStates[memory].getNumberOfSetBitsBeforeIndices();
+        copyOffsets[memory] = numberOfProductStates;
+        numberOfProductStates += copyStates[memory].getNumberOfSetBits();
+    }
+    uint64_t const goalState = numberOfProductStates++;
+    auto getProductState = [&](uint64_t memory, uint64_t state) { return copyOffsets[memory] + numberOfStatesBeforeIndexInCopy[memory][state]; };
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfProductStates, numberOfProductStates);
+    uint64_t currentRow = 0;
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    for (uint64_t memory = 0; memory < 3; ++memory) {
+        for (auto state : copyStates[memory]) {
+            ValueType goalProbability = storm::utility::zero<ValueType>();
+            rowEntries.clear();
+            for (auto const& successorEntry : transitionMatrix.getRow(state)) {
+                uint64_t const successorMemory = memory | getMemory(successorEntry.getColumn());
+                if (successorMemory == bothBits) {
+                    goalProbability += successorEntry.getValue();
+                } else {
+                    rowEntries.emplace_back(getProductState(successorMemory, successorEntry.getColumn()), successorEntry.getValue());
+                }
+            }
+            // Successors in different copies are not sorted by their column.
+            if (memory == 0) {
+                std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+            }
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(currentRow, entry.first, entry.second);
+            }
+            if (!storm::utility::isZero(goalProbability)) {
+                builder.addNextValue(currentRow, goalState, goalProbability);
+            }
+            ++currentRow;
+        }
+    }
+    builder.addNextValue(currentRow, goalState, storm::utility::one<ValueType>());
+    storm::storage::SparseMatrix<ValueType> productMatrix = builder.build();
+    storm::storage::BitVector productGoalStates(numberOfProductStates);
+    productGoalStates.set(goalState);
+
+    // The probability to reach a condition state is the value in the copy in which (only) a target state was visited.
+    auto getConditionProductState = [&](uint64_t state) -> std::optional<uint64_t> {
+        return conditionStates.get(state) ? std::nullopt : std::optional<uint64_t>(getProductState(targetBit, state));
+    };
+    auto getJointProductState = [&](uint64_t state) -> std::optional<uint64_t> {
+        uint64_t const memory = getMemory(state);
+        return memory == bothBits ? std::nullopt : std::optional<uint64_t>(getProductState(memory, state));
+    };
+    if (goal.hasRelevantValues()) {
+        storm::storage::BitVector productRelevantValues(numberOfProductStates);
+        for (auto state : goal.relevantValues() & definedStates) {
+            for (auto const& productState : {getConditionProductState(state), getJointProductState(state)}) {
+                if (productState) {
+                    productRelevantValues.set(productState.value());
+                }
+            }
+        }
+        goal.setRelevantValues(std::move(productRelevantValues));
+    }
+    std::vector<ValueType> productValues =
+        computeUntilProbabilities(env, std::move(goal), productMatrix, productMatrix.transpose(), storm::storage::BitVector(numberOfProductStates, true),
+                                  productGoalStates, qualitative);
+
+    for (auto state : definedStates) {
+        auto conditionProductState = getConditionProductState(state);
+        auto jointProductState = getJointProductState(state);
+        ValueType const conditionProbability = conditionProductState ? productValues[conditionProductState.value()] : storm::utility::one<ValueType>();
+        ValueType const jointProbability = jointProductState ? productValues[jointProductState.value()] : storm::utility::one<ValueType>();
+        result[state] = jointProbability / conditionProbability;
+    }
+    return result;
+}
+
 template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeConditionalRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
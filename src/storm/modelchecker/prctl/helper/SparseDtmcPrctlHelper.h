@@ -33,11 +33,28 @@ class SparseDtmcPrctlHelper {
     static std::vector<ValueType> computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                            storm::storage::BitVector const& nextStates);
 
+    /*!
+     * Computes the probabilities for phi U psi.
+     * @param maybeStatesOut If given, the states whose values are neither zero nor one according to the graph analysis (or the hint) are written to it.
+     */
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                            storm::storage::BitVector* maybeStatesOut = nullptr);
+
+    /*!
+     * Computes the probabilities of phi U psi_i for several sets psi_i at once. If the native value iteration solver is selected (and soundness is not
+     * required), all probabilities are computed by one block value iteration. Otherwise, the goals with the same maybe states share the equation
+     * system and thus one equation solver, such that, e.g., a direct solver factorizes the system only once.
+     * @return for each goal, the probabilities of all states
+     */
+    static std::vector<std::vector<ValueType>> computeUntilProbabilitiesBatch(Environment const& env,
+                                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              std::vector<storm::storage::BitVector> const& psiStates);
 
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -87,6 +104,21 @@ class SparseDtmcPrctlHelper {
                                                                   storm::storage::BitVector const& targetStates,
                                                                   storm::storage::BitVector const& conditionStates, bool qualitative);
 
+    /*!
+     * Computes the probabilities of eventually reaching the target states under the condition of eventually reaching the condition states as the quotient
+     * of P(F target & F condition) and P(F condition). Both probabilities are obtained from a single reachability query on the product of the model
+     * with a memory that tracks which of the two sets was visited, which is solved with the configured (iterative) linear equation solver. In contrast
+     * to state elimination, this does not introduce fill-in and therefore scales to large models. Note that the precision guarantees of the solver only
+     * hold for the two probabilities and not necessarily for their quotient.
+     *
+     * @return The conditional probabilities of all states. The value of states that can not reach the condition states is infinity.
+     */
+    static std::vector<ValueType> computeConditionalProbabilitiesWithProduct(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
+                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                             storm::storage::BitVector const& targetStates,
+                                                                             storm::storage::BitVector const& conditionStates, bool qualitative);
+
     static std::vector<ValueType> computeConditionalRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
@@ -24,6 +24,7 @@
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/BlockValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -37,10 +38,13 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/Telemetry.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -79,36 +83,52 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
             initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
         Environment preciseEnv = env;
         preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+        rewardUnfolding.setEpochSolutionStorage(env);
 
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
 
-        storm::utility::ProgressMeasurement progress("epochs");
-        progress.setMaxCount(epochOrder.size());
-        progress.startNewMeasurement(0);
-        uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
+        uint64_t const numberOfThreads = env.modelchecker().getEpochThreads();
+        bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+        STORM_LOG_WARN_COND(numberOfThreads == 1 || !exportCdf, "Epochs are analyzed sequentially as the cdf is exported.");
+        if (numberOfThreads > 1 && !exportCdf) {
+            // Independent epochs are analyzed concurrently, each thread uses its own solver
+            std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
             swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            rewardUnfolding.analyzeEpochsConcurrently(
+                initEpoch, numberOfThreads, [&](rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t thread) {
+                    return epochModel.analyzeSingleObjective(preciseEnv, dir, threadX[thread], threadB[thread], threadSolvers[thread], lowerBound, upperBound);
+                });
             swCheck.stop();
-            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                std::vector<ValueType> cdfEntry;
-                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                       rewardUnfolding.getDimension(i).scalingFactor);
+        } else {
+            storm::utility::ProgressMeasurement progress("epochs");
+            progress.setMaxCount(epochOrder.size());
+            progress.startNewMeasurement(0);
+            uint64_t numCheckedEpochs = 0;
+            for (auto const& epoch : epochOrder) {
+                swBuild.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                swBuild.stop();
+                swCheck.start();
+                rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                swCheck.stop();
+                if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                    !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                    std::vector<ValueType> cdfEntry;
+                    for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                        uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                        cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                           rewardUnfolding.getDimension(i).scalingFactor);
+                    }
+                    cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                    cdfData.push_back(std::move(cdfEntry));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                if (storm::utility::resources::isTerminate()) {
+                    break;
                 }
-                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                cdfData.push_back(std::move(cdfEntry));
-            }
-            ++numCheckedEpochs;
-            progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
             }
         }
 
@@ -447,6 +467,8 @@ struct MaybeStateResult {
 
     std::vector<ValueType> values;
     boost::optional<std::vector<uint64_t>> scheduler;
+    // Lower and upper bounds on the values if the solver was interrupted before converging.
+    boost::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> bounds;
 };
 
 template<typename ValueType, typename SolutionType>
@@ -504,6 +526,9 @@ MaybeStateResult<SolutionType> computeValuesForMaybeStates(Environment const& en
     if (produceScheduler) {
         result.scheduler = std::move(solver->getSchedulerChoices());
     }
+    if (solver->hasSolutionBounds()) {
+        result.bounds = solver->getSolutionBounds();
+    }
     return result;
 }
 
@@ -542,6 +567,7 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
                                                                                      storm::storage::BitVector const& psiStates) {
+    storm::utility::telemetry::Scope telemetryScope("qualitative-analysis");
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
@@ -556,6 +582,7 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
     result.maybeStates = ~(result.statesWithProbability0 | result.statesWithProbability1);
+    storm::utility::telemetry::setAttribute("maybe-states", result.maybeStates.getNumberOfSetBits());
 
     return result;
 }
@@ -720,10 +747,13 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     // Check if the values of the maybe states are relevant for the SolveGoal
     bool maybeStatesNotRelevant = goal.hasRelevantValues() && goal.relevantValues().isDisjointFrom(qualitativeStateSets.maybeStates);
 
+    // Bounds on the values in case the solver is interrupted.
+    std::optional<std::pair<std::vector<SolutionType>, std::vector<SolutionType>>> bounds;
+
     // If requested, we will produce a scheduler.
     std::unique_ptr<storm::storage::Scheduler<SolutionType>> scheduler;
     if (produceScheduler) {
-        scheduler = std::make_unique<storm::storage::Scheduler<SolutionType>>(transitionMatrix.getRowGroupCount());
+        scheduler = std::make_unique<storm::storage::Scheduler<SolutionType>>(storm::storage::CompactScheduler(transitionMatrix.getRowGroupIndices()));
         // If maybeStatesNotRelevant is true, we have to set the scheduler for maybe states as "dontCare"
         if (maybeStatesNotRelevant) {
             for (auto state : qualitativeStateSets.maybeStates) {
@@ -763,12 +793,21 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             MaybeStateResult<SolutionType> resultForMaybeStates =
                 computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
+            // The bounds agree with the result on the states whose values are known exactly.
+            if (resultForMaybeStates.bounds) {
+                bounds.emplace(result, result);
+            }
+
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
                 if constexpr (std::is_same_v<ValueType, storm::Interval>) {
                     STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support this end component with interval models.");
                 } else {
                     ecInformation.get().setValues(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
+                    if (bounds) {
+                        ecInformation.get().setValues(bounds->first, qualitativeStateSets.maybeStates, resultForMaybeStates.bounds->first);
+                        ecInformation.get().setValues(bounds->second, qualitativeStateSets.maybeStates, resultForMaybeStates.bounds->second);
+                    }
                     if (produceScheduler) {
                         ecInformation.get().setScheduler(*scheduler, qualitativeStateSets.maybeStates, transitionMatrix, backwardTransitions,
                                                          resultForMaybeStates.getScheduler());
@@ -779,6 +818,12 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
                 if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
                     // For non-interval models, we only operated on the maybe states, and we must recover the qualitative values for the other state.
                     storm::utility::vector::setVectorValues<SolutionType>(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
+                    if (bounds) {
+                        storm::utility::vector::setVectorValues<SolutionType>(bounds->first, qualitativeStateSets.maybeStates,
+                                                                              resultForMaybeStates.bounds->first);
+                        storm::utility::vector::setVectorValues<SolutionType>(bounds->second, qualitativeStateSets.maybeStates,
+                                                                              resultForMaybeStates.bounds->second);
+                    }
                 } else {
                     // For interval models, the result for maybe states indeed also holds values for all qualitative states.
                     STORM_LOG_ASSERT(resultForMaybeStates.getValues().size() == transitionMatrix.getColumnCount(), "Dimensions do not match");
@@ -804,7 +849,57 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     STORM_LOG_ASSERT((!produceScheduler && !scheduler) || scheduler->isMemorylessScheduler(), "Expected a memoryless scheduler");
 
     // Return result.
-    return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result), std::move(scheduler));
+    MDPSparseModelCheckingHelperReturnType<SolutionType> returnValue(std::move(result), std::move(scheduler));
+    returnValue.bounds = std::move(bounds);
+    returnValue.maybeStates = std::move(qualitativeStateSets.maybeStates);
+    return returnValue;
+}
+
+template<typename ValueType, typename SolutionType>
+std::vector<std::vector<SolutionType>> SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilitiesBatch(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    std::vector<storm::storage::BitVector> const& psiStates) {
+    uint64_t const numberOfGoals = psiStates.size();
+    if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double>) {
+        if (env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::ValueIteration && !env.solver().isForceSoundness()) {
+            storm::solver::SolveGoal<ValueType, SolutionType> goal(dir);
+            std::vector<storm::storage::BitVector> maybeStates;
+            // The values of the maybe states are approached from below, which yields the least fixed point also in the presence of end components.
+            std::vector<ValueType> operands(transitionMatrix.getRowGroupCount() * numberOfGoals, storm::utility::zero<ValueType>());
+            for (uint64_t goalIndex = 0; goalIndex < numberOfGoals; ++goalIndex) {
+                QualitativeStateSetsUntilProbabilities qualitativeStateSets =
+                    computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates[goalIndex]);
+                for (auto state : qualitativeStateSets.statesWithProbability1) {
+                    operands[state * numberOfGoals + goalIndex] = storm::utility::one<ValueType>();
+                }
+                maybeStates.push_back(std::move(qualitativeStateSets.maybeStates));
+            }
+            storm::solver::helper::BlockValueIterationHelper<ValueType> blockHelper(transitionMatrix, numberOfGoals);
+            uint64_t numIterations = 0;
+            auto status = blockHelper.VI(operands, maybeStates, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                         storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
+                                         env.solver().minMax().getMaximalNumberOfIterations(), dir);
+            STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                                "Block value iteration for " << numberOfGoals << " goals did not converge after " << numIterations << " iterations.");
+            STORM_LOG_INFO("Block value iteration for " << numberOfGoals << " goals took " << numIterations << " iterations.");
+            std::vector<std::vector<SolutionType>> result(numberOfGoals, std::vector<SolutionType>(transitionMatrix.getRowGroupCount()));
+            for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                for (uint64_t goalIndex = 0; goalIndex < numberOfGoals; ++goalIndex) {
+                    result[goalIndex][state] = operands[state * numberOfGoals + goalIndex];
+                }
+            }
+            return result;
+        }
+    }
+
+    std::vector<std::vector<SolutionType>> result;
+    for (auto const& goalStates : psiStates) {
+        result.push_back(computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType, SolutionType>(dir), transitionMatrix, backwardTransitions,
+                                                   phiStates, goalStates, false, false)
+                             .values);
+    }
+    return result;
 }
 
 template<typename ValueType, typename SolutionType>
@@ -832,6 +927,15 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
         for (auto& element : result.values) {
             element = storm::utility::one<SolutionType>() - element;
         }
+        if (result.bounds) {
+            // Complementing swaps the roles of the lower and upper bounds.
+            std::swap(result.bounds->first, result.bounds->second);
+            for (auto* bound : {&result.bounds->first, &result.bounds->second}) {
+                for (auto& element : *bound) {
+                    element = storm::utility::one<SolutionType>() - element;
+                }
+            }
+        }
         return result;
     }
 }
@@ -975,6 +1079,12 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             std::vector<SolutionType> resultInEcQuotient = std::move(result.values);
             result.values.resize(ecElimResult.oldToNewStateMapping.size());
             storm::utility::vector::selectVectorValues(result.values, ecElimResult.oldToNewStateMapping, resultInEcQuotient);
+            if (result.bounds) {
+                auto boundsInEcQuotient = std::move(*result.bounds);
+                result.bounds.emplace(std::vector<SolutionType>(result.values.size()), std::vector<SolutionType>(result.values.size()));
+                storm::utility::vector::selectVectorValues(result.bounds->first, ecElimResult.oldToNewStateMapping, boundsInEcQuotient.first);
+                storm::utility::vector::selectVectorValues(result.bounds->second, ecElimResult.oldToNewStateMapping, boundsInEcQuotient.second);
+            }
             return result;
         }
     }
@@ -1085,6 +1195,7 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
     storm::solver::SolveGoal<ValueType, SolutionType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+    storm::utility::telemetry::Scope telemetryScope("qualitative-analysis");
     QualitativeStateSetsReachabilityRewards result;
     storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
     if (goal.minimize()) {
@@ -1108,6 +1219,7 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
         result.rewardZeroStates = targetStates;
     }
     result.maybeStates = ~(result.rewardZeroStates | result.infinityStates);
+    storm::utility::telemetry::setAttribute("maybe-states", result.maybeStates.getNumberOfSetBits());
     return result;
 }
 
@@ -1327,13 +1439,16 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
 
     storm::utility::vector::setVectorValues(result, qualitativeStateSets.infinityStates, storm::utility::infinity<SolutionType>());
 
+    // Bounds on the values in case the solver is interrupted.
+    std::optional<std::pair<std::vector<SolutionType>, std::vector<SolutionType>>> bounds;
+
     // If requested, we will produce a scheduler.
     std::unique_ptr<storm::storage::Scheduler<SolutionType>> scheduler;
     if (produceScheduler) {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support producing schedulers in this function with interval models.");
         } else {
-            scheduler = std::make_unique<storm::storage::Scheduler<SolutionType>>(transitionMatrix.getRowGroupCount());
+            scheduler = std::make_unique<storm::storage::Scheduler<SolutionType>>(storm::storage::CompactScheduler(transitionMatrix.getRowGroupIndices()));
         }
     }
 
@@ -1398,12 +1513,21 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             MaybeStateResult<SolutionType> resultForMaybeStates =
                 computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
 
+            // The bounds agree with the result on the states whose values are known exactly.
+            if (resultForMaybeStates.bounds) {
+                bounds.emplace(result, result);
+            }
+
             // If we eliminated end components, we need to extract the result differently.
             if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
                 if constexpr (std::is_same_v<ValueType, storm::Interval>) {
                     STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We do not support eliminating end components with interval models.");
                 } else {
                     ecInformation.get().setValues(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
+                    if (bounds) {
+                        ecInformation.get().setValues(bounds->first, qualitativeStateSets.maybeStates, resultForMaybeStates.bounds->first);
+                        ecInformation.get().setValues(bounds->second, qualitativeStateSets.maybeStates, resultForMaybeStates.bounds->second);
+                    }
                     if (produceScheduler) {
                         ecInformation.get().setScheduler(*scheduler, qualitativeStateSets.maybeStates, transitionMatrix, backwardTransitions,
                                                          resultForMaybeStates.getScheduler());
@@ -1412,6 +1536,11 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
             } else {
                 // Set values of resulting vector according to result.
                 storm::utility::vector::setVectorValues<SolutionType>(result, qualitativeStateSets.maybeStates, resultForMaybeStates.getValues());
+                if (bounds) {
+                    storm::utility::vector::setVectorValues<SolutionType>(bounds->first, qualitativeStateSets.maybeStates, resultForMaybeStates.bounds->first);
+                    storm::utility::vector::setVectorValues<SolutionType>(bounds->second, qualitativeStateSets.maybeStates,
+                                                                          resultForMaybeStates.bounds->second);
+                }
                 if (produceScheduler) {
                     extractSchedulerChoices(*scheduler, transitionMatrix, resultForMaybeStates.getScheduler(), qualitativeStateSets.maybeStates,
                                             selectedChoices);
@@ -1434,7 +1563,9 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     if constexpr (std::is_same_v<ValueType, storm::Interval>) {
         return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result));
     } else {
-        return MDPSparseModelCheckingHelperReturnType<SolutionType>(std::move(result), std::move(scheduler));
+        MDPSparseModelCheckingHelperReturnType<SolutionType> returnValue(std::move(result), std::move(scheduler));
+        returnValue.bounds = std::move(bounds);
+        return returnValue;
     }
 }
 
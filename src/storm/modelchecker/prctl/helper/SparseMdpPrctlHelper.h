@@ -50,6 +50,17 @@ class SparseMdpPrctlHelper {
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
         storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
 
+    /*!
+     * Computes the optimal probabilities of phi U psi_i for several sets psi_i at once. If value iteration is selected (and soundness is not required),
+     * all probabilities are computed by one block value iteration. Otherwise, the probabilities are computed one after another.
+     * @return for each goal, the probabilities of all states
+     */
+    static std::vector<std::vector<SolutionType>> computeUntilProbabilitiesBatch(Environment const& env, OptimizationDirection dir,
+                                                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                 storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 std::vector<storm::storage::BitVector> const& psiStates);
+
     static MDPSparseModelCheckingHelperReturnType<SolutionType> computeGloballyProbabilities(Environment const& env,
                                                                                              storm::solver::SolveGoal<ValueType, SolutionType>&& goal,
                                                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
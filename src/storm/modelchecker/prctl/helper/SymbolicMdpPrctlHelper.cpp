@@ -9,6 +9,7 @@
 #include "storm/environment/Environment.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/graph.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
@@ -41,6 +42,25 @@ storm::dd::Bdd<DdType> computeValidSchedulerHint(EquationSystemType const& type,
     return result;
 }
 
+/*!
+ * Passes the maximal end components of the given transitions to the solver, so that they are collapsed during solving.
+ * @return true iff the solver no longer requires a unique solution. Otherwise, the end components are not passed to the solver.
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+bool collapseEndComponents(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
+                           storm::dd::Bdd<DdType> const& transitions, storm::dd::Bdd<DdType> const& maybeStates,
+                           storm::solver::SymbolicMinMaxLinearEquationSolver<DdType, ValueType>& solver) {
+    auto endComponents = storm::utility::dd::computeMaximalEndComponents(maybeStates, transitions, model.getRowVariables(), model.getColumnVariables(),
+                                                                         model.getNondeterminismVariables(), model.getRowColumnMetaVariablePairs());
+    solver.setEndComponents(endComponents.first, endComponents.second);
+    if (solver.getRequirements(env, dir).uniqueSolution()) {
+        solver.setEndComponents(model.getManager().getBddZero(), model.getManager().getBddZero());
+        return false;
+    }
+    STORM_LOG_DEBUG("Collapsing end components, because the solver requires a unique solution.");
+    return true;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> SymbolicMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model,
@@ -87,6 +107,8 @@ std::unique_ptr<CheckResult> SymbolicMdpPrctlHelper<DdType, ValueType>::computeU
             // Check whether there are end components
             if (storm::utility::graph::performProb0E(model, transitionMatrix.notZero(), maybeStates, !maybeStates && model.getReachableStates()).isZero()) {
                 requirements.clearUniqueSolution();
+            } else if (collapseEndComponents(env, dir, model, transitionMatrix.notZero() && maybeStates, maybeStates, *solver)) {
+                requirements.clearUniqueSolution();
             }
         }
         STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
@@ -302,6 +324,9 @@ std::unique_ptr<CheckResult> SymbolicMdpPrctlHelper<DdType, ValueType>::computeR
             // Check whether there are end components
             if (storm::utility::graph::performProb0E(model, transitionMatrixBdd, maybeStates, !maybeStates && model.getReachableStates()).isZero()) {
                 requirements.clearUniqueSolution();
+            } else if (collapseEndComponents(env, dir, model, transitionMatrixBdd && maybeStates && !subvector.notZero(), maybeStates, *solver)) {
+                // Only end components without rewards prevent a unique solution.
+                requirements.clearUniqueSolution();
             }
         }
         STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
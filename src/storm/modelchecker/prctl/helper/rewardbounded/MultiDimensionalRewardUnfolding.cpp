@@ -1,9 +1,19 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <fstream>
 #include <functional>
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <type_traits>
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/utility/macros.h"
 
@@ -15,9 +25,12 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -68,6 +81,36 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::MultiDimensiona
     initialize(infinityBoundVariables);
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::~MultiDimensionalRewardUnfolding() {
+    // Remove the remaining spill files
+    for (auto& epochSolution : epochSolutions) {
+        if (epochSolution.second.spillFile) {
+            std::error_code errorCode;
+            std::filesystem::remove(epochSolution.second.spillFile.get(), errorCode);
+        }
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEpochSolutionStorage(Environment const& env) {
+    auto const& mcEnv = env.modelchecker();
+    if constexpr (std::is_same<ValueType, double>::value) {
+        storeSinglePrecision = mcEnv.isEpochSolutionSinglePrecisionEnabled();
+        if (mcEnv.isEpochSolutionSpillDirectorySet()) {
+            spillDirectory = mcEnv.getEpochSolutionSpillDirectory();
+            memoryLimit = mcEnv.getEpochSolutionMemoryLimit();
+            std::string uniqueSuffix = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+            spillFilePrefix = (std::filesystem::path(spillDirectory.get()) / ("epoch_solution." + uniqueSuffix + ".")).string();
+        } else {
+            spillDirectory = boost::none;
+        }
+    } else {
+        STORM_LOG_WARN_COND(!mcEnv.isEpochSolutionSinglePrecisionEnabled() && !mcEnv.isEpochSolutionSpillDirectorySet(),
+                            "Compact storage of epoch solutions is only supported for double values. Ignored.");
+    }
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables) {
     STORM_LOG_ASSERT(!SingleObjectiveMode || (this->objectives.size() == 1), "Enabled single objective mode but there are multiple objectives.");
@@ -332,7 +375,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::translateL
                 }
             }
         }
-        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(),
+        storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(model.getTransitionMatrix(), *model.getBackwardTransitions(),
                                                                                      storm::storage::BitVector(model.getNumberOfStates(), true),
                                                                                      choicesWithoutUpperBoundedStep);
         storm::storage::BitVector nonMecChoices(model.getNumberOfChoices(), true);
@@ -377,14 +420,23 @@ typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch
 template<typename ValueType, bool SingleObjectiveMode>
 std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs) {
+    return getEpochComputationOrder(std::vector<Epoch>({startEpoch}), stopAtComputedEpochs);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs) {
     // Perform a DFS to find all the reachable epochs
     std::vector<Epoch> dfsStack;
     std::set<Epoch, std::function<bool(Epoch const&, Epoch const&)>> collectedEpochs(
         std::bind(&EpochManager::epochClassZigZagOrder, &epochManager, std::placeholders::_1, std::placeholders::_2));
 
-    if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
-        collectedEpochs.insert(startEpoch);
-        dfsStack.push_back(startEpoch);
+    for (auto const& startEpoch : startEpochs) {
+        if (!stopAtComputedEpochs || epochSolutions.count(startEpoch) == 0) {
+            if (collectedEpochs.insert(startEpoch).second) {
+                dfsStack.push_back(startEpoch);
+            }
+        }
     }
     while (!dfsStack.empty()) {
         Epoch currentEpoch = dfsStack.back();
@@ -398,9 +450,184 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
             }
         }
     }
+
+    // If all epochs are computed, a solution is needed exactly by the collected epochs that depend on it.
+    // Otherwise, solutions are kept as long as some predecessor in the epoch lattice is not computed such that later calls can reuse them.
+    useDependentEpochCounts = !stopAtComputedEpochs;
+    dependentEpochCounts.clear();
+    if (useDependentEpochCounts) {
+        std::set<Epoch> successorEpochs;
+        for (auto const& epoch : collectedEpochs) {
+            successorEpochs.clear();
+            for (auto const& step : possibleEpochSteps) {
+                successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
+            }
+            successorEpochs.erase(epoch);
+            for (auto const& successorEpoch : successorEpochs) {
+                ++dependentEpochCounts[successorEpoch];
+            }
+        }
+    }
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationWavefronts(Epoch const& startEpoch) {
+    return getEpochComputationWavefronts(std::vector<Epoch>({startEpoch}));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationWavefronts(std::vector<Epoch> const& startEpochs,
+                                                                                               bool stopAtComputedEpochs) {
+    std::vector<std::vector<Epoch>> wavefronts;
+    std::map<Epoch, uint64_t> epochToWavefront;
+    for (auto& epoch : getEpochComputationOrder(startEpochs, stopAtComputedEpochs)) {
+        // The computation order ensures that all successor epochs have been assigned to a wavefront before (or have been computed earlier)
+        uint64_t wavefront = 0;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch && !(stopAtComputedEpochs && epochSolutions.count(successorEpoch) > 0)) {
+                auto successorIt = epochToWavefront.find(successorEpoch);
+                STORM_LOG_ASSERT(successorIt != epochToWavefront.end(),
+                                 "Successor epoch " << epochManager.toString(successorEpoch) << " is not ordered before.");
+                wavefront = std::max(wavefront, successorIt->second + 1);
+            }
+        }
+        epochToWavefront.emplace(epoch, wavefront);
+        if (wavefront >= wavefronts.size()) {
+            wavefronts.resize(wavefront + 1);
+        }
+        wavefronts[wavefront].push_back(std::move(epoch));
+    }
+    return wavefronts;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochsConcurrently(
+    Epoch const& startEpoch, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel) {
+    analyzeEpochsConcurrently(std::vector<Epoch>({startEpoch}), false, numberOfThreads, analyzeEpochModel);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochsConcurrently(
+    std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel,
+    std::function<void(Epoch const&)> const& epochAnalyzedCallback) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "At least one thread is required.");
+    typedef EpochModel<ValueType, SingleObjectiveMode> EpochModelType;
+
+    // An epoch whose model has been set up. The data that only depends on the epoch class (in particular the matrix) is shared.
+    struct EpochTask {
+        Epoch epoch;
+        std::shared_ptr<EpochModelType const> classModel;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
+        std::vector<SolutionType> stepSolutions;
+        std::vector<storm::storage::BitVector> objectiveRewardFilter;
+        std::vector<SolutionType> solutions;
+    };
+    // Each thread keeps the epoch model it analyzed last, such that its solver can be reused for epochs of the same class
+    struct ThreadData {
+        EpochModelType epochModel;
+        std::shared_ptr<EpochModelType const> classModel;
+    };
+    std::vector<ThreadData> threadData(numberOfThreads);
+
+    auto wavefronts = getEpochComputationWavefronts(startEpochs, stopAtComputedEpochs);
+    storm::utility::ProgressMeasurement progress("epochs");
+    uint64_t numberOfEpochs = 0;
+    for (auto const& wavefront : wavefronts) {
+        numberOfEpochs += wavefront.size();
+    }
+    progress.setMaxCount(numberOfEpochs);
+    progress.startNewMeasurement(0);
+    uint64_t numberOfCheckedEpochs = 0;
+
+    // The epochs of a wavefront are handled in batches to limit the number of epoch models that exist at the same time
+    uint64_t const batchSize = 4 * numberOfThreads;
+    std::shared_ptr<EpochModelType const> classModel;
+    for (auto const& wavefront : wavefronts) {
+        for (uint64_t batchStart = 0; batchStart < wavefront.size(); batchStart += batchSize) {
+            uint64_t const batchEnd = std::min<uint64_t>(batchStart + batchSize, wavefront.size());
+            std::vector<EpochTask> tasks;
+            tasks.reserve(batchEnd - batchStart);
+            for (uint64_t i = batchStart; i < batchEnd; ++i) {
+                auto& currentEpochModel = setCurrentEpoch(wavefront[i]);
+                if (!classModel || currentEpochModel.epochMatrixChanged) {
+                    auto newClassModel = std::make_shared<EpochModelType>(currentEpochModel);
+                    newClassModel->stepSolutions.clear();
+                    classModel = std::move(newClassModel);
+                }
+                EpochTask task;
+                task.epoch = wavefront[i];
+                task.classModel = classModel;
+                task.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+                task.stepSolutions = std::move(currentEpochModel.stepSolutions);
+                task.objectiveRewardFilter = currentEpochModel.objectiveRewardFilter;
+                tasks.push_back(std::move(task));
+            }
+
+            std::mutex mutex;
+            uint64_t nextTask = 0;
+            std::exception_ptr exception;
+            auto work = [&](uint64_t thread) {
+                ThreadData& data = threadData[thread];
+                try {
+                    while (true) {
+                        uint64_t index;
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (exception || nextTask >= tasks.size()) {
+                                break;
+                            }
+                            index = nextTask++;
+                        }
+                        EpochTask& task = tasks[index];
+                        bool const matrixChanged = data.classModel != task.classModel;
+                        if (matrixChanged) {
+                            data.epochModel = *task.classModel;
+                            data.classModel = task.classModel;
+                        }
+                        data.epochModel.epochMatrixChanged = matrixChanged;
+                        data.epochModel.stepSolutions = std::move(task.stepSolutions);
+                        data.epochModel.objectiveRewardFilter = std::move(task.objectiveRewardFilter);
+                        task.solutions = analyzeEpochModel(data.epochModel, thread);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    exception = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            for (uint64_t thread = 1; thread < std::min<uint64_t>(numberOfThreads, tasks.size()); ++thread) {
+                threads.emplace_back(work, thread);
+            }
+            work(0);
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+
+            for (auto& task : tasks) {
+                STORM_LOG_ASSERT(task.solutions.size() == task.classModel->epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                setSolutionForEpoch(task.epoch, task.productStateToSolutionVectorMap, std::move(task.solutions));
+                if (epochAnalyzedCallback) {
+                    epochAnalyzedCallback(task.epoch);
+                }
+            }
+            numberOfCheckedEpochs += tasks.size();
+            progress.updateProgress(numberOfCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                return;
+            }
+        }
+    }
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
@@ -426,12 +653,18 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         }
     }
     std::map<Epoch, EpochSolution const*> subSolutions;
+    std::map<Epoch, EpochSolution> loadedSolutions;
     for (auto const& step : possibleEpochSteps) {
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
-        if (successorEpoch != epoch) {
+        if (successorEpoch != epoch && subSolutions.count(successorEpoch) == 0) {
             auto successorSolIt = epochSolutions.find(successorEpoch);
             STORM_LOG_ASSERT(successorSolIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
-            subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            if (successorSolIt->second.isCompact) {
+                auto loadedSolIt = loadedSolutions.emplace(successorEpoch, loadEpochSolution(successorSolIt->second)).first;
+                subSolutions.emplace(successorEpoch, &loadedSolIt->second);
+            } else {
+                subSolutions.emplace(successorEpoch, &successorSolIt->second);
+            }
         }
     }
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
@@ -616,7 +849,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
     } else if (model.isOfType(storm::models::ModelType::Mdp)) {
         // Eliminate zero-reward end components
-        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(epochModel.epochMatrix, consideredStates,
+        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(std::move(epochModel.epochMatrix), consideredStates,
                                                                                              zeroObjRewardChoices & ~stepChoices, consideredStates);
         epochModel.epochMatrix = std::move(ecElimResult.matrix);
         epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
@@ -804,7 +1037,7 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
                     // Get the set of states from which reward is reachable
                     auto nonZeroRewardStates = rewModel.getStatesWithZeroReward(model.getTransitionMatrix());
                     nonZeroRewardStates.complement();
-                    auto expRewGreater0EStates = storm::utility::graph::performProbGreater0E(model.getBackwardTransitions(), allStates, nonZeroRewardStates);
+                    auto expRewGreater0EStates = storm::utility::graph::performProbGreater0E(*model.getBackwardTransitions(), allStates, nonZeroRewardStates);
                     // Eliminate zero-reward ECs
                     auto zeroRewardChoices = rewModel.getChoicesWithZeroReward(model.getTransitionMatrix());
                     auto ecElimRes = storm::transformer::EndComponentEliminator<ValueType>::transform(model.getTransitionMatrix(), expRewGreater0EStates,
@@ -865,38 +1098,185 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    setSolutionForEpoch(currentEpoch.get(), productStateToEpochModelInStateMap, std::move(inStateSolutions));
+}
 
-    std::set<Epoch> predecessorEpochs, successorEpochs;
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(
+    Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
+    std::set<Epoch> successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
         STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+        STORM_LOG_ASSERT(successorEpochSolutionIt->second.count > 0, "Solution for successor epoch is not referenced.");
         --successorEpochSolutionIt->second.count;
         if (successorEpochSolutionIt->second.count == 0) {
-            epochSolutions.erase(successorEpochSolutionIt);
+            releaseEpochSolution(successorEpochSolutionIt);
         }
     }
 
     // add the new solution
     EpochSolution solution;
-    solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    if (useDependentEpochCounts) {
+        auto countIt = dependentEpochCounts.find(epoch);
+        solution.count = countIt == dependentEpochCounts.end() ? 0 : countIt->second;
+    } else {
+        std::set<Epoch> predecessorEpochs;
+        for (auto const& step : possibleEpochSteps) {
+            epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        }
+        predecessorEpochs.erase(epoch);
+        solution.count = predecessorEpochs.size();
+    }
+    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    storeEpochSolution(epoch, std::move(solution));
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(Epoch const& epoch, EpochSolution&& solution) {
+    auto epochSolutionIt = epochSolutions.find(epoch);
+    if (epochSolutionIt != epochSolutions.end()) {
+        releaseEpochSolution(epochSolutionIt);
+    }
+    solution.numberOfSolutions = solution.solutions.size();
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (storeSinglePrecision) {
+            for (auto const& stateSolution : solution.solutions) {
+                if constexpr (SingleObjectiveMode) {
+                    solution.singlePrecisionValues.push_back(static_cast<float>(stateSolution));
+                } else {
+                    STORM_LOG_ASSERT(stateSolution.size() == objectives.size(), "Unexpected size of solution.");
+                    for (auto const& value : stateSolution) {
+                        solution.singlePrecisionValues.push_back(static_cast<float>(value));
+                    }
+                }
+            }
+            solution.solutions = std::vector<SolutionType>();
+            solution.isCompact = true;
+        }
+    }
+    memoryOfEpochSolutions += getMemoryOfEpochSolution(solution);
+    epochSolutions.emplace(epoch, std::move(solution));
+
+    if (spillDirectory) {
+        // Spill the solutions that were stored first as they are (typically) needed last
+        epochsInMemory.push_back(epoch);
+        while (memoryOfEpochSolutions > memoryLimit && !epochsInMemory.empty()) {
+            epochSolutionIt = epochSolutions.find(epochsInMemory.front());
+            epochsInMemory.pop_front();
+            if (epochSolutionIt != epochSolutions.end() && !epochSolutionIt->second.spillFile) {
+                spillEpochSolution(epochSolutionIt->second);
+            }
+        }
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::releaseEpochSolution(typename std::map<Epoch, EpochSolution>::iterator epochSolutionIt) {
+    memoryOfEpochSolutions -= getMemoryOfEpochSolution(epochSolutionIt->second);
+    if (epochSolutionIt->second.spillFile) {
+        std::error_code errorCode;
+        std::filesystem::remove(epochSolutionIt->second.spillFile.get(), errorCode);
+    }
+    epochSolutions.erase(epochSolutionIt);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillEpochSolution(EpochSolution& solution) {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        memoryOfEpochSolutions -= getMemoryOfEpochSolution(solution);
+        std::string filename = spillFilePrefix + std::to_string(numberOfSpillFiles++);
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << filename << " to store an epoch solution.");
+        if (solution.isCompact) {
+            file.write(reinterpret_cast<char const*>(solution.singlePrecisionValues.data()), solution.singlePrecisionValues.size() * sizeof(float));
+        } else {
+            for (auto const& stateSolution : solution.solutions) {
+                if constexpr (SingleObjectiveMode) {
+                    file.write(reinterpret_cast<char const*>(&stateSolution), sizeof(double));
+                } else {
+                    file.write(reinterpret_cast<char const*>(stateSolution.data()), stateSolution.size() * sizeof(double));
+                }
+            }
+        }
+        STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not write epoch solution to file " << filename << ".");
+        solution.spillFile = filename;
+        solution.solutions = std::vector<SolutionType>();
+        solution.singlePrecisionValues = std::vector<float>();
+        solution.isCompact = true;
+    } else {
+        STORM_LOG_ASSERT(false, "Epoch solutions can only be spilled for double values.");
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getMemoryOfEpochSolution(EpochSolution const& solution) const {
+    if (solution.spillFile) {
+        return 0;
+    } else if (solution.isCompact) {
+        return solution.singlePrecisionValues.size() * sizeof(float);
+    } else {
+        return solution.numberOfSolutions * (SingleObjectiveMode ? 1 : objectives.size()) * sizeof(ValueType);
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::loadEpochSolution(EpochSolution const& solution) const {
+    STORM_LOG_ASSERT(solution.isCompact, "Epoch solution is not stored compactly.");
+    EpochSolution result;
+    result.count = solution.count;
+    result.productStateToSolutionVectorMap = solution.productStateToSolutionVectorMap;
+    result.numberOfSolutions = solution.numberOfSolutions;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        uint64_t const solutionSize = SingleObjectiveMode ? 1 : objectives.size();
+        uint64_t const numberOfValues = solution.numberOfSolutions * solutionSize;
+        std::vector<double> values;
+        if (solution.spillFile) {
+            std::ifstream file(solution.spillFile.get(), std::ios::binary);
+            STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not open file " << solution.spillFile.get() << " to load an epoch solution.");
+            if (storeSinglePrecision) {
+                std::vector<float> singlePrecisionValues(numberOfValues);
+                file.read(reinterpret_cast<char*>(singlePrecisionValues.data()), numberOfValues * sizeof(float));
+                values.assign(singlePrecisionValues.begin(), singlePrecisionValues.end());
+            } else {
+                values.resize(numberOfValues);
+                file.read(reinterpret_cast<char*>(values.data()), numberOfValues * sizeof(double));
+            }
+            STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Could not read epoch solution from file " << solution.spillFile.get() << ".");
+        } else {
+            values.assign(solution.singlePrecisionValues.begin(), solution.singlePrecisionValues.end());
+        }
+        STORM_LOG_ASSERT(values.size() == numberOfValues, "Unexpected number of values for epoch solution.");
+        result.solutions.reserve(solution.numberOfSolutions);
+        for (uint64_t i = 0; i < solution.numberOfSolutions; ++i) {
+            if constexpr (SingleObjectiveMode) {
+                result.solutions.push_back(values[i]);
+            } else {
+                result.solutions.emplace_back(values.begin() + i * solutionSize, values.begin() + (i + 1) * solutionSize);
+            }
+        }
+    } else {
+        STORM_LOG_ASSERT(false, "Epoch solutions can only be stored compactly for double values.");
+    }
+    return result;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
     auto epochSolutionIt = epochSolutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
+    if (epochSolutionIt->second.isCompact) {
+        return getStateSolution(loadEpochSolution(epochSolutionIt->second), productState);
+    }
     return getStateSolution(epochSolutionIt->second, productState);
 }
 
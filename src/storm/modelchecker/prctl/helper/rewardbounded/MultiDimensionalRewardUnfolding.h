@@ -1,5 +1,8 @@
 #pragma once
 
+#include <deque>
+#include <functional>
+
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -16,6 +19,8 @@
 #include "storm/utility/vector.h"
 
 namespace storm {
+class Environment;
+
 namespace modelchecker {
 namespace helper {
 namespace rewardbounded {
@@ -47,7 +52,15 @@ class MultiDimensionalRewardUnfolding {
     MultiDimensionalRewardUnfolding(storm::models::sparse::Model<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> objectiveFormula,
                                     std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
-    ~MultiDimensionalRewardUnfolding() = default;
+    ~MultiDimensionalRewardUnfolding();
+
+    /*!
+     * Sets how the solutions of analyzed epochs are stored while other epochs still depend on them, as specified in the model checker environment:
+     * Solutions can be stored in single precision (introducing rounding errors) and the solutions of the epochs that were analyzed first can be
+     * written to files as long as the solutions kept in memory exceed a memory limit. Both are only supported for double values.
+     * Should be called before the first epoch is analyzed.
+     */
+    void setEpochSolutionStorage(Environment const& env);
 
     /*!
      * Retrieves the desired epoch that needs to be analyzed to compute the reward bounded values.
@@ -62,6 +75,50 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Computes a sequence of epochs that need to be analyzed to get a result at each of the given start epochs.
+     * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+     */
+    std::vector<Epoch> getEpochComputationOrder(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs = false);
+
+    /*!
+     * Partitions the epochs that need to be analyzed to get a result at the start epoch into wavefronts.
+     * Epochs only depend on epochs of previous wavefronts, i.e., the epochs of one wavefront can be analyzed independently of each other.
+     * Within a wavefront, the epochs are ordered as in the epoch computation order.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationWavefronts(Epoch const& startEpoch);
+
+    /*!
+     * Partitions the epochs that need to be analyzed to get a result at each of the given start epochs into wavefronts (see above).
+     * @param stopAtComputedEpochs if set, epochs that already have been computed earlier are not analyzed again.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationWavefronts(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs = false);
+
+    /*!
+     * Analyzes all epochs that need to be analyzed to get a result at the start epoch, where independent epochs are analyzed concurrently.
+     * The epoch models are set up sequentially (wavefront by wavefront) and only their analysis is done concurrently. As for
+     * setSolutionForCurrentEpoch, the solution of an epoch is released once all epochs depending on it are analyzed.
+     *
+     * @param startEpoch The epoch for which the result is needed.
+     * @param numberOfThreads The number of threads.
+     * @param analyzeEpochModel Analyzes an epoch model and returns the solutions for its in-states. It is called concurrently together with the
+     * index of the calling thread (less than numberOfThreads) such that each thread can use its own solver.
+     */
+    void analyzeEpochsConcurrently(Epoch const& startEpoch, uint64_t numberOfThreads,
+                                   std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel);
+
+    /*!
+     * Analyzes all epochs that need to be analyzed to get a result at each of the given start epochs, where independent epochs are analyzed
+     * concurrently (see above).
+     *
+     * @param stopAtComputedEpochs if set, epochs that already have been computed earlier are not analyzed again and solutions are kept such that later
+     * calls can reuse them (as for getEpochComputationOrder).
+     * @param epochAnalyzedCallback if given, it is called (sequentially) with each analyzed epoch right after the solution of that epoch has been set.
+     */
+    void analyzeEpochsConcurrently(std::vector<Epoch> const& startEpochs, bool stopAtComputedEpochs, uint64_t numberOfThreads,
+                                   std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel,
+                                   std::function<void(Epoch const&)> const& epochAnalyzedCallback = {});
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -114,16 +171,49 @@ class MultiDimensionalRewardUnfolding {
     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
     std::string solutionToString(SolutionType const& solution) const;
 
-    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
+    SolutionType getStateSolution(Epoch const& epoch, uint64_t const& productState);
+    void setSolutionForEpoch(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                             std::vector<SolutionType>&& inStateSolutions);
     struct EpochSolution {
         uint64_t count;
         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
         std::vector<SolutionType> solutions;
+        // If the solution is stored compactly, the solutions are empty and the values are either stored in single precision or in the spill file.
+        bool isCompact = false;
+        uint64_t numberOfSolutions = 0;
+        std::vector<float> singlePrecisionValues;
+        boost::optional<std::string> spillFile;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
+    /*!
+     * Stores the solution of the given epoch (replacing a previous solution) according to the storage options.
+     */
+    void storeEpochSolution(Epoch const& epoch, EpochSolution&& solution);
+    void releaseEpochSolution(typename std::map<Epoch, EpochSolution>::iterator epochSolutionIt);
+    void spillEpochSolution(EpochSolution& solution);
+    uint64_t getMemoryOfEpochSolution(EpochSolution const& solution) const;
+
+    /*!
+     * Restores the solutions of a compactly stored epoch solution.
+     */
+    EpochSolution loadEpochSolution(EpochSolution const& solution) const;
+
+    // For each epoch of the last computation order, the number of distinct epochs in that order that depend on it.
+    std::map<Epoch, uint64_t> dependentEpochCounts;
+    bool useDependentEpochCounts = false;
+
+    bool storeSinglePrecision = false;
+    boost::optional<std::string> spillDirectory;
+    uint64_t memoryLimit = 0;
+    uint64_t memoryOfEpochSolutions = 0;
+    uint64_t numberOfSpillFiles = 0;
+    std::string spillFilePrefix;
+    // The epochs whose solutions are kept in memory in the order in which they were stored. May contain epochs that have been released.
+    std::deque<Epoch> epochsInMemory;
+
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
 
@@ -1,10 +1,12 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <memory>
 #include <set>
 #include <vector>
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
@@ -16,6 +18,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
 
 #include "storm/logic/BoundedUntilFormula.h"
@@ -401,79 +404,153 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
+    rewardUnfolding.setEpochSolutionStorage(env);
+    EpochManager const& epochManager = rewardUnfolding.getEpochManager();
+    auto const initialStartEpoch = rewardUnfolding.getStartEpoch(true);
+
+    // Transforms candidate cost limits to an appropriate start epoch
+    auto getStartEpoch = [&](CostLimits const& candidate) {
+        auto startEpoch = initialStartEpoch;
+        auto costLimitIt = candidate.begin();
+        for (auto dim : consideredDimensions) {
+            if (lowerBoundedDimensions.get(dim)) {
+                if (costLimitIt->get() > 0) {
+                    epochManager.setDimensionOfEpoch(startEpoch, dim, costLimitIt->get() - 1);
+                } else {
+                    epochManager.setBottomDimension(startEpoch, dim);
+                }
+            } else {
+                epochManager.setDimensionOfEpoch(startEpoch, dim, costLimitIt->get());
+            }
+            ++costLimitIt;
+        }
+        return startEpoch;
+    };
+
+    // Inserts the cost limits that correspond to the given (analyzed) epoch into the (un)sat cost limits.
+    // Returns false if the result is unclear due to insufficient precision.
+    auto classifyEpoch = [&](EpochManager::Epoch const& epoch) {
+        CostLimits epochAsCostLimits;
+        if (translateEpochToCostLimits(epoch, initialStartEpoch, consideredDimensions, lowerBoundedDimensions, epochManager, epochAsCostLimits)) {
+            ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
+            bool propertySatisfied;
+            if (env.solver().isForceSoundness()) {
+                ValueType sumOfEpochDimensions = storm::utility::convertNumber<ValueType>(epochManager.getSumOfDimensions(epoch) + 1);
+                auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
+                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
+                if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
+                    return false;
+                }
+            } else {
+                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
+            }
+            if (propertySatisfied) {
+                satCostLimits.insert(epochAsCostLimits);
+            } else {
+                unsatCostLimits.insert(epochAsCostLimits);
+            }
+        }
+        return true;
+    };
+
+    // Analyzes the epochs that are needed for the given start epoch(s), reusing the solutions of epochs that have been analyzed before.
+    // If multiple threads are available, the epochs needed for all start epochs are analyzed at once such that independent epochs are analyzed concurrently.
+    uint64_t const numberOfThreads = env.modelchecker().getEpochThreads();
+    std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadMinMaxSolvers(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadLinEqSolvers(numberOfThreads);
+    auto analyzeEpochs = [&](std::vector<EpochManager::Epoch> const& startEpochs) {
+        if (numberOfThreads == 1) {
+            STORM_LOG_ASSERT(startEpochs.size() == 1, "Expected a single start epoch.");
+            STORM_LOG_DEBUG("Checking start epoch " << epochManager.toString(startEpochs.front()) << ".");
+            auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpochs.front(), true);
+            for (auto const& epoch : epochSequence) {
+                ++numCheckedEpochs;
+                swEpochAnalysis.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                if (model.isNondeterministicModel()) {
+                    rewardUnfolding.setSolutionForCurrentEpoch(
+                        epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
+                } else {
+                    rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
+                }
+                swEpochAnalysis.stop();
+                if (!classifyEpoch(epoch)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        STORM_LOG_DEBUG("Checking " << startEpochs.size() << " start epochs concurrently.");
+        bool sufficientPrecision = true;
+        swEpochAnalysis.start();
+        rewardUnfolding.analyzeEpochsConcurrently(
+            startEpochs, true, numberOfThreads,
+            [&](EpochModel<ValueType, true>& epochModel, uint64_t thread) {
+                if (model.isNondeterministicModel()) {
+                    return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), threadX[thread], threadB[thread],
+                                                             threadMinMaxSolvers[thread], lowerBound, upperBound);
+                } else {
+                    return epochModel.analyzeSingleObjective(env, threadX[thread], threadB[thread], threadLinEqSolvers[thread], lowerBound, upperBound);
+                }
+            },
+            [&](EpochManager::Epoch const& epoch) {
+                ++numCheckedEpochs;
+                sufficientPrecision = sufficientPrecision && classifyEpoch(epoch);
+            });
+        swEpochAnalysis.stop();
+        return sufficientPrecision;
+    };
 
     swExploration.start();
     bool progress = true;
-    for (CostLimit candidateCostLimitSum(0); progress; ++candidateCostLimitSum.get()) {
-        CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
-        if (!currentCandidate.empty()) {
-            currentCandidate.back() = candidateCostLimitSum;
-        }
+    // With multiple threads, we speculatively check the candidates of several consecutive cost limit sums at once. The number of considered sums grows
+    // exponentially as long as there is progress. Checking candidates that turn out to be unnecessary only costs the analysis of the additional epochs,
+    // since the epochs for smaller cost limits are needed for larger ones anyway.
+    uint64_t firstCostLimitSum = 0;
+    uint64_t numberOfCostLimitSums = 1;
+    while (progress) {
         // We can still have progress if one of the closures is empty and the other is not full.
         // This ensures that we do not terminate too early in case that the (un)satCostLimits are initially non-empty.
         progress = (satCostLimits.empty() && !unsatCostLimits.full()) || (unsatCostLimits.empty() && !satCostLimits.full());
-        do {
-            if (!satCostLimits.contains(currentCandidate) && !unsatCostLimits.contains(currentCandidate)) {
-                progress = true;
-                // Transform candidate cost limits to an appropriate start epoch
-                auto startEpoch = rewardUnfolding.getStartEpoch(true);
-                auto costLimitIt = currentCandidate.begin();
-                for (auto dim : consideredDimensions) {
-                    if (lowerBoundedDimensions.get(dim)) {
-                        if (costLimitIt->get() > 0) {
-                            rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get() - 1);
-                        } else {
-                            rewardUnfolding.getEpochManager().setBottomDimension(startEpoch, dim);
-                        }
-                    } else {
-                        rewardUnfolding.getEpochManager().setDimensionOfEpoch(startEpoch, dim, costLimitIt->get());
-                    }
-                    ++costLimitIt;
-                }
-                STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
-                auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
-
-                    CostLimits epochAsCostLimits;
-                    if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
-                                                   epochAsCostLimits)) {
-                        ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
-                        bool propertySatisfied;
-                        if (env.solver().isForceSoundness()) {
-                            ValueType sumOfEpochDimensions =
-                                storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
-                            auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
-                            if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
-                                // unclear result due to insufficient precision.
-                                swExploration.stop();
-                                return false;
-                            }
-                        } else {
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
-                        }
-                        if (propertySatisfied) {
-                            satCostLimits.insert(epochAsCostLimits);
-                        } else {
-                            unsatCostLimits.insert(epochAsCostLimits);
+        std::vector<EpochManager::Epoch> startEpochs;
+        for (CostLimit candidateCostLimitSum(firstCostLimitSum); candidateCostLimitSum.get() < firstCostLimitSum + numberOfCostLimitSums;
+             ++candidateCostLimitSum.get()) {
+            CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
+            if (!currentCandidate.empty()) {
+                currentCandidate.back() = candidateCostLimitSum;
+            }
+            do {
+                if (!satCostLimits.contains(currentCandidate) && !unsatCostLimits.contains(currentCandidate)) {
+                    progress = true;
+                    startEpochs.push_back(getStartEpoch(currentCandidate));
+                    // Without concurrency, we check each candidate right away as its result might already settle the subsequent candidates.
+                    if (numberOfThreads == 1) {
+                        if (!analyzeEpochs(startEpochs)) {
+                            swExploration.stop();
+                            return false;
                         }
+                        startEpochs.clear();
                     }
                 }
-            }
-        } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
+            } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
+        }
+        if (!startEpochs.empty() && !analyzeEpochs(startEpochs)) {
+            // unclear result due to insufficient precision.
+            swExploration.stop();
+            return false;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Quantile computation aborted. The result is incomplete.");
+            break;
+        }
         if (!progress) {
             progress = !CostLimitClosure::unionFull(satCostLimits, unsatCostLimits);
         }
+        firstCostLimitSum += numberOfCostLimitSums;
+        if (progress && numberOfThreads > 1) {
+            numberOfCostLimitSums = std::min<uint64_t>(2 * numberOfCostLimitSums, numberOfThreads);
+        }
     }
     swExploration.stop();
     return true;
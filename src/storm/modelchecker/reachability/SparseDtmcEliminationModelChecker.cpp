@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <type_traits>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -10,12 +11,14 @@
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
+#include "storm/solver/SolveGoal.h"
 #include "storm/solver/stateelimination/ConditionalStateEliminator.h"
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 #include "storm/solver/stateelimination/MultiValueStateEliminator.h"
@@ -74,7 +77,8 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     STORM_LOG_THROW(checkTask.isOnlyInitialStatesRelevantSet(), storm::exceptions::IllegalArgumentException,
                     "Cannot compute long-run probabilities for all states.");
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    auto const backwardTransitionsPtr = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = *backwardTransitionsPtr;
     storm::storage::BitVector maybeStates =
         storm::utility::graph::performProbGreater0(backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), psiStates);
 
@@ -145,7 +149,8 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
         ++index;
     }
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    auto const backwardTransitionsPtr = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = *backwardTransitionsPtr;
 
     storm::storage::BitVector allStates(numberOfStates, true);
     maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, maybeStates);
@@ -356,7 +361,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     // Start by determining the states that have a non-zero probability of reaching the target states within the
     // time bound.
     storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(
-        this->getModel().getBackwardTransitions(), phiStates, psiStates, true, pathFormula.getUpperBound<uint64_t>());
+        *this->getModel().getBackwardTransitions(), phiStates, psiStates, true, pathFormula.getUpperBound<uint64_t>());
     statesWithProbabilityGreater0 &= ~psiStates;
 
     // Determine whether we need to perform some further computation.
@@ -460,7 +465,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     storm::storage::BitVector const& phiStates = leftResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
     storm::storage::BitVector const& psiStates = rightResultPointer->asExplicitQualitativeCheckResult().getTruthValuesVector();
 
-    return computeUntilProbabilities(this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(),
+    return computeUntilProbabilities(this->getModel().getTransitionMatrix(), *this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(),
                                      phiStates, psiStates, checkTask.isOnlyInitialStatesRelevantSet());
 }
 
@@ -545,7 +550,7 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
 
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::IllegalArgumentException, "Input model does not have a reward model.");
     return computeReachabilityRewards(
-        this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), targetStates,
+        this->getModel().getTransitionMatrix(), *this->getModel().getBackwardTransitions(), this->getModel().getInitialStates(), targetStates,
         [&](uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) {
             return rewardModel.getTotalRewardVector(numberOfRows, transitionMatrix, maybeStates);
         },
@@ -664,7 +669,8 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
                     "Cannot compute conditional probabilities for all states.");
     storm::storage::sparse::state_type initialState = *this->getModel().getInitialStates().begin();
 
-    storm::storage::SparseMatrix<ValueType> backwardTransitions = this->getModel().getBackwardTransitions();
+    auto const backwardTransitionsPtr = this->getModel().getBackwardTransitions();
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions = *backwardTransitionsPtr;
 
     // Compute the 'true' psi states, i.e. those psi states that can be reached without passing through another psi state first.
     psiStates = storm::utility::graph::getReachableStates(this->getModel().getTransitionMatrix(), this->getModel().getInitialStates(), trueStates, psiStates) &
@@ -697,6 +703,20 @@ std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelTy
     // The set of states we need to consider are those that have a non-zero probability to satisfy the condition or are on some path that has a psi state in it.
     storm::storage::BitVector maybeStates = statesWithProbabilityGreater0 | (statesWithPsiPredecessor & statesReachingPhi);
 
+    // On large models, the fill-in of state elimination becomes prohibitive, so we solve the product model with the iterative solvers instead. These
+    // solvers are not available for parametric models.
+    if constexpr (!std::is_same_v<ValueType, storm::RationalFunction>) {
+        uint_fast64_t threshold = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getConditionalIterativeThreshold();
+        if (maybeStates.getNumberOfSetBits() > threshold) {
+            STORM_LOG_INFO("Computing conditional probabilities iteratively as there are more than " << threshold << " relevant states.");
+            storm::solver::SolveGoal<ValueType> goal;
+            goal.setRelevantValues(storm::storage::BitVector(this->getModel().getInitialStates()));
+            std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeConditionalProbabilitiesWithProduct(
+                env, std::move(goal), this->getModel().getTransitionMatrix(), backwardTransitions, phiStates, psiStates, checkTask.isQualitativeSet());
+            return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, result[initialState]));
+        }
+    }
+
     // Determine the set of initial states of the sub-DTMC.
     storm::storage::BitVector newInitialStates = this->getModel().getInitialStates() % maybeStates;
 
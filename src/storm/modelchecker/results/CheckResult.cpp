@@ -6,6 +6,7 @@
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/LexicographicCheckResult.h"
 #include "storm/modelchecker/results/SymbolicParetoCurveCheckResult.h"
@@ -45,6 +46,10 @@ bool CheckResult::isLexicographicCheckResult() const {
     return false;
 }
 
+bool CheckResult::isExplicitTimeBoundsCheckResult() const {
+    return false;
+}
+
 bool CheckResult::isResultForAllStates() const {
     return false;
 }
@@ -120,6 +125,16 @@ LexicographicCheckResult<ValueType> const& CheckResult::asLexicographicCheckResu
     return dynamic_cast<LexicographicCheckResult<ValueType> const&>(*this);
 }
 
+template<typename ValueType>
+ExplicitTimeBoundsCheckResult<ValueType>& CheckResult::asExplicitTimeBoundsCheckResult() {
+    return dynamic_cast<ExplicitTimeBoundsCheckResult<ValueType>&>(*this);
+}
+
+template<typename ValueType>
+ExplicitTimeBoundsCheckResult<ValueType> const& CheckResult::asExplicitTimeBoundsCheckResult() const {
+    return dynamic_cast<ExplicitTimeBoundsCheckResult<ValueType> const&>(*this);
+}
+
 QualitativeCheckResult& CheckResult::asQualitativeCheckResult() {
     return dynamic_cast<QualitativeCheckResult&>(*this);
 }
@@ -192,6 +207,8 @@ template ExplicitParetoCurveCheckResult<double>& CheckResult::asExplicitParetoCu
 template ExplicitParetoCurveCheckResult<double> const& CheckResult::asExplicitParetoCurveCheckResult() const;
 template LexicographicCheckResult<double>& CheckResult::asLexicographicCheckResult();
 template LexicographicCheckResult<double> const& CheckResult::asLexicographicCheckResult() const;
+template ExplicitTimeBoundsCheckResult<double>& CheckResult::asExplicitTimeBoundsCheckResult();
+template ExplicitTimeBoundsCheckResult<double> const& CheckResult::asExplicitTimeBoundsCheckResult() const;
 
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD>& CheckResult::asSymbolicQualitativeCheckResult();
 template SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> const& CheckResult::asSymbolicQualitativeCheckResult() const;
@@ -234,6 +251,11 @@ template ExplicitParetoCurveCheckResult<storm::RationalNumber> const& CheckResul
 template LexicographicCheckResult<storm::RationalNumber>& CheckResult::asLexicographicCheckResult();
 template LexicographicCheckResult<storm::RationalNumber> const& CheckResult::asLexicographicCheckResult() const;
 
+template ExplicitTimeBoundsCheckResult<storm::RationalNumber>& CheckResult::asExplicitTimeBoundsCheckResult();
+template ExplicitTimeBoundsCheckResult<storm::RationalNumber> const& CheckResult::asExplicitTimeBoundsCheckResult() const;
+template ExplicitTimeBoundsCheckResult<storm::RationalFunction>& CheckResult::asExplicitTimeBoundsCheckResult();
+template ExplicitTimeBoundsCheckResult<storm::RationalFunction> const& CheckResult::asExplicitTimeBoundsCheckResult() const;
+
 #endif
 }  // namespace modelchecker
 }  // namespace storm
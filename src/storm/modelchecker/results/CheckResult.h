@@ -24,6 +24,9 @@ class ExplicitParetoCurveCheckResult;
 template<typename ValueType>
 class LexicographicCheckResult;
 
+template<typename ValueType>
+class ExplicitTimeBoundsCheckResult;
+
 template<storm::dd::DdType Type>
 class SymbolicQualitativeCheckResult;
 
@@ -62,6 +65,7 @@ class CheckResult {
     virtual bool isExplicitQualitativeCheckResult() const;
     virtual bool isExplicitQuantitativeCheckResult() const;
     virtual bool isExplicitParetoCurveCheckResult() const;
+    virtual bool isExplicitTimeBoundsCheckResult() const;
     virtual bool isSymbolicQualitativeCheckResult() const;
     virtual bool isSymbolicQuantitativeCheckResult() const;
     virtual bool isSymbolicParetoCurveCheckResult() const;
@@ -98,6 +102,12 @@ class CheckResult {
     template<typename ValueType>
     LexicographicCheckResult<ValueType> const& asLexicographicCheckResult() const;
 
+    template<typename ValueType>
+    ExplicitTimeBoundsCheckResult<ValueType>& asExplicitTimeBoundsCheckResult();
+
+    template<typename ValueType>
+    ExplicitTimeBoundsCheckResult<ValueType> const& asExplicitTimeBoundsCheckResult() const;
+
     template<storm::dd::DdType Type>
     SymbolicQualitativeCheckResult<Type>& asSymbolicQualitativeCheckResult();
 
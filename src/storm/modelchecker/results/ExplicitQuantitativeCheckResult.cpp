@@ -86,7 +86,7 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
 
 template<typename ValueType>
 std::unique_ptr<CheckResult> ExplicitQuantitativeCheckResult<ValueType>::clone() const {
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(*this);
 }
 
 template<typename ValueType>
@@ -135,6 +135,12 @@ void ExplicitQuantitativeCheckResult<ValueType>::filter(QualitativeCheckResult c
 
         this->values = newMap;
     }
+
+    if (bounds) {
+        bounds = std::make_shared<std::pair<ExplicitQuantitativeCheckResult<ValueType>, ExplicitQuantitativeCheckResult<ValueType>>>(*bounds);
+        bounds->first.filter(filter);
+        bounds->second.filter(filter);
+    }
 }
 
 template<typename ValueType>
@@ -235,6 +241,32 @@ storm::storage::Scheduler<ValueType>& ExplicitQuantitativeCheckResult<ValueType>
     return *scheduler.get();
 }
 
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::setBounds(ExplicitQuantitativeCheckResult<ValueType>&& lower,
+                                                           ExplicitQuantitativeCheckResult<ValueType>&& upper) {
+    STORM_LOG_THROW(lower.isResultForAllStates() == this->isResultForAllStates() && upper.isResultForAllStates() == this->isResultForAllStates(),
+                    storm::exceptions::InvalidOperationException, "The bounds must refer to the same states as the values.");
+    bounds = std::make_shared<std::pair<ExplicitQuantitativeCheckResult<ValueType>, ExplicitQuantitativeCheckResult<ValueType>>>(std::move(lower),
+                                                                                                                                 std::move(upper));
+}
+
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::hasBounds() const {
+    return static_cast<bool>(bounds);
+}
+
+template<typename ValueType>
+ExplicitQuantitativeCheckResult<ValueType> const& ExplicitQuantitativeCheckResult<ValueType>::getLowerBounds() const {
+    STORM_LOG_THROW(this->hasBounds(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing bounds.");
+    return bounds->first;
+}
+
+template<typename ValueType>
+ExplicitQuantitativeCheckResult<ValueType> const& ExplicitQuantitativeCheckResult<ValueType>::getUpperBounds() const {
+    STORM_LOG_THROW(this->hasBounds(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing bounds.");
+    return bounds->second;
+}
+
 template<typename ValueType>
 void print(std::ostream& out, ValueType const& value) {
     if (value == storm::utility::infinity<ValueType>()) {
@@ -330,6 +362,14 @@ std::ostream& ExplicitQuantitativeCheckResult<ValueType>::writeToStream(std::ost
         printRange(out, minmax.first, minmax.second);
     }
 
+    if (bounds && minMaxSupported) {
+        out << " (bounds: [";
+        print(out, bounds->first.getMin());
+        out << ", ";
+        print(out, bounds->second.getMax());
+        out << "])";
+    }
+
     return out;
 }
 
@@ -455,6 +495,14 @@ void ExplicitQuantitativeCheckResult<ValueType>::oneMinus() {
             element.second = storm::utility::one<ValueType>() - element.second;
         }
     }
+
+    if (bounds) {
+        // Complementing swaps the roles of the lower and upper bounds.
+        bounds = std::make_shared<std::pair<ExplicitQuantitativeCheckResult<ValueType>, ExplicitQuantitativeCheckResult<ValueType>>>(bounds->second,
+                                                                                                                                     bounds->first);
+        bounds->first.oneMinus();
+        bounds->second.oneMinus();
+    }
 }
 
 template<typename ValueType>
@@ -79,6 +79,15 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     storm::storage::Scheduler<ValueType> const& getScheduler() const;
     storm::storage::Scheduler<ValueType>& getScheduler();
 
+    /*!
+     * Attaches lower and upper bounds on the values. This is used if a computation was interrupted before converging, in which case the values are an
+     * approximation that lies between the bounds. Filtering or complementing this result is applied to the bounds as well.
+     */
+    void setBounds(ExplicitQuantitativeCheckResult<ValueType>&& lower, ExplicitQuantitativeCheckResult<ValueType>&& upper);
+    bool hasBounds() const;
+    ExplicitQuantitativeCheckResult<ValueType> const& getLowerBounds() const;
+    ExplicitQuantitativeCheckResult<ValueType> const& getUpperBounds() const;
+
     storm::json<ValueType> toJson(std::optional<storm::storage::sparse::StateValuations> const& stateValuations = std::nullopt,
                                   std::optional<storm::models::sparse::StateLabeling> const& stateLabels = std::nullopt) const;
 
@@ -88,6 +97,9 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
 
     // An optional scheduler that accompanies the values.
     boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+
+    // Optional lower and upper bounds on the values. They are shared among copies of this result and are copied before being modified.
+    std::shared_ptr<std::pair<ExplicitQuantitativeCheckResult<ValueType>, ExplicitQuantitativeCheckResult<ValueType>>> bounds;
 };
 }  // namespace modelchecker
 }  // namespace storm
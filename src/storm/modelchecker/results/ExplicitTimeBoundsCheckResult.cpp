@@ -0,0 +1,96 @@
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+ExplicitTimeBoundsCheckResult<ValueType>::ExplicitTimeBoundsCheckResult(std::vector<double> const& timeBounds, std::vector<std::vector<ValueType>>&& values)
+    : timeBounds(timeBounds) {
+    STORM_LOG_THROW(timeBounds.size() == values.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of time bounds (" << timeBounds.size() << ") does not match the number of results (" << values.size() << ").");
+    results.reserve(values.size());
+    for (auto& valuesForBound : values) {
+        results.emplace_back(std::move(valuesForBound));
+    }
+}
+
+template<typename ValueType>
+ExplicitTimeBoundsCheckResult<ValueType>::ExplicitTimeBoundsCheckResult(std::vector<double> const& timeBounds,
+                                                                        std::vector<ExplicitQuantitativeCheckResult<ValueType>> const& results)
+    : timeBounds(timeBounds), results(results) {
+    STORM_LOG_THROW(timeBounds.size() == results.size(), storm::exceptions::InvalidArgumentException,
+                    "The number of time bounds (" << timeBounds.size() << ") does not match the number of results (" << results.size() << ").");
+}
+
+template<typename ValueType>
+std::vector<double> const& ExplicitTimeBoundsCheckResult<ValueType>::getTimeBounds() const {
+    return timeBounds;
+}
+
+template<typename ValueType>
+uint64_t ExplicitTimeBoundsCheckResult<ValueType>::getNumberOfTimeBounds() const {
+    return timeBounds.size();
+}
+
+template<typename ValueType>
+ExplicitQuantitativeCheckResult<ValueType> const& ExplicitTimeBoundsCheckResult<ValueType>::getResult(uint64_t timeBoundIndex) const {
+    return results[timeBoundIndex];
+}
+
+template<typename ValueType>
+ExplicitQuantitativeCheckResult<ValueType>& ExplicitTimeBoundsCheckResult<ValueType>::getResult(uint64_t timeBoundIndex) {
+    return results[timeBoundIndex];
+}
+
+template<typename ValueType>
+bool ExplicitTimeBoundsCheckResult<ValueType>::isExplicitTimeBoundsCheckResult() const {
+    return true;
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> ExplicitTimeBoundsCheckResult<ValueType>::clone() const {
+    return std::make_unique<ExplicitTimeBoundsCheckResult<ValueType>>(timeBounds, results);
+}
+
+template<typename ValueType>
+bool ExplicitTimeBoundsCheckResult<ValueType>::isExplicit() const {
+    return true;
+}
+
+template<typename ValueType>
+bool ExplicitTimeBoundsCheckResult<ValueType>::isResultForAllStates() const {
+    for (auto const& result : results) {
+        if (!result.isResultForAllStates()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void ExplicitTimeBoundsCheckResult<ValueType>::filter(QualitativeCheckResult const& filter) {
+    for (auto& result : results) {
+        result.filter(filter);
+    }
+}
+
+template<typename ValueType>
+std::ostream& ExplicitTimeBoundsCheckResult<ValueType>::writeToStream(std::ostream& out) const {
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        out << "t=" << timeBounds[timeBoundIndex] << ": " << results[timeBoundIndex] << '\n';
+    }
+    return out;
+}
+
+template class ExplicitTimeBoundsCheckResult<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ExplicitTimeBoundsCheckResult<storm::RationalNumber>;
+template class ExplicitTimeBoundsCheckResult<storm::RationalFunction>;
+#endif
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace storm {
+namespace modelchecker {
+
+/*!
+ * The result of checking a time-bounded property for several time bounds at once.
+ * For each of the (ascendingly sorted) time bounds, it holds an explicit quantitative result over the states of the model.
+ */
+template<typename ValueType>
+class ExplicitTimeBoundsCheckResult : public CheckResult {
+   public:
+    ExplicitTimeBoundsCheckResult() = default;
+    ExplicitTimeBoundsCheckResult(std::vector<double> const& timeBounds, std::vector<std::vector<ValueType>>&& values);
+    ExplicitTimeBoundsCheckResult(std::vector<double> const& timeBounds, std::vector<ExplicitQuantitativeCheckResult<ValueType>> const& results);
+    virtual ~ExplicitTimeBoundsCheckResult() = default;
+
+    std::vector<double> const& getTimeBounds() const;
+    uint64_t getNumberOfTimeBounds() const;
+
+    /*!
+     * Retrieves the result for the time bound with the given index.
+     */
+    ExplicitQuantitativeCheckResult<ValueType> const& getResult(uint64_t timeBoundIndex) const;
+    ExplicitQuantitativeCheckResult<ValueType>& getResult(uint64_t timeBoundIndex);
+
+    virtual bool isExplicitTimeBoundsCheckResult() const override;
+    virtual std::unique_ptr<CheckResult> clone() const override;
+    virtual bool isExplicit() const override;
+    virtual bool isResultForAllStates() const override;
+    virtual void filter(QualitativeCheckResult const& filter) override;
+
+    virtual std::ostream& writeToStream(std::ostream& out) const override;
+
+   private:
+    std::vector<double> timeBounds;
+    // The result for each of the time bounds.
+    std::vector<ExplicitQuantitativeCheckResult<ValueType>> results;
+};
+}  // namespace modelchecker
+}  // namespace storm
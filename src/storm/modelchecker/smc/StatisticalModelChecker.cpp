@@ -0,0 +1,625 @@
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <thread>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SmcSettings.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/random.h"
+#include "storm/utility/threads.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace smc {
+/*!
+ * A path property that is evaluated on single traces.
+ */
+struct TraceProperty {
+    enum class Type { Until, Next, CumulativeReward, ReachabilityReward };
+
+    bool isReward() const {
+        return type == Type::CumulativeReward || type == Type::ReachabilityReward;
+    }
+
+    Type type;
+    // The formula that has to hold until the target formula holds (only for until properties).
+    std::shared_ptr<storm::logic::Formula const> left;
+    // The target formula (not for cumulative rewards).
+    std::shared_ptr<storm::logic::Formula const> right;
+    // The step bounds (only for until properties and cumulative rewards).
+    uint64_t lowerBound = 0;
+    std::optional<uint64_t> upperBound;
+    std::optional<std::string> rewardModelName;
+};
+}  // namespace smc
+
+namespace {
+// The number of traces a thread samples before its results are merged.
+uint64_t const tracesPerBatch = 64;
+// The minimal number of traces before the confidence interval of an expected reward is trusted.
+uint64_t const minimalNumberOfRewardTraces = 100;
+
+// The indices of the predicates of a trace property.
+uint64_t const leftPredicate = 0;
+uint64_t const rightPredicate = 1;
+
+/*!
+ * Generates the traces of a single thread.
+ */
+template<typename ValueType>
+class TraceGenerator {
+   public:
+    virtual ~TraceGenerator() = default;
+    virtual void resetToInitial() = 0;
+    // Whether the current state can only be left to itself.
+    virtual bool isSink() = 0;
+    virtual bool satisfies(uint64_t predicate) = 0;
+    // Moves to a successor state and returns the reward collected in the current state and for the selected choice.
+    virtual ValueType step() = 0;
+};
+
+template<typename ValueType>
+class ProgramTraceGenerator : public TraceGenerator<ValueType> {
+   public:
+    typedef std::function<uint64_t(storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> const&)> ProgramScheduler;
+
+    ProgramTraceGenerator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                          std::vector<storm::expressions::Expression> const& predicates, bool hasRewardModel, ProgramScheduler const& scheduler, uint64_t seed)
+        : simulator(program, generatorOptions),
+          predicates(predicates),
+          hasRewardModel(hasRewardModel),
+          scheduler(scheduler),
+          choiceGenerator(storm::utility::getStreamSeed(seed, 1)) {
+        simulator.setSeed(storm::utility::getStreamSeed(seed, 0));
+    }
+
+    virtual void resetToInitial() override {
+        simulator.resetToInitial();
+    }
+
+    virtual bool isSink() override {
+        return simulator.isSinkState();
+    }
+
+    virtual bool satisfies(uint64_t predicate) override {
+        return simulator.evaluateBooleanExpressionInCurrentState(predicates[predicate]);
+    }
+
+    virtual ValueType step() override {
+        ValueType reward = storm::utility::zero<ValueType>();
+        if (hasRewardModel && !simulator.getCurrentStateRewards().empty()) {
+            reward += simulator.getCurrentStateRewards().front();
+        }
+        auto const& choices = simulator.getChoices();
+        if (choices.empty()) {
+            // Deadlock states are not left.
+            return reward;
+        }
+        uint64_t choice = 0;
+        if (choices.size() > 1) {
+            choice = scheduler ? scheduler(simulator) : choiceGenerator.random_uint(0, choices.size() - 1);
+            STORM_LOG_THROW(choice < choices.size(), storm::exceptions::InvalidOperationException, "The scheduler selected a choice that does not exist.");
+        }
+        if (hasRewardModel && !choices[choice].getRewards().empty()) {
+            reward += choices[choice].getRewards().front();
+        }
+        simulator.step(choice);
+        return reward;
+    }
+
+   private:
+    storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> simulator;
+    std::vector<storm::expressions::Expression> predicates;
+    bool hasRewardModel;
+    ProgramScheduler const& scheduler;
+    storm::utility::RandomProbabilityGenerator<ValueType> choiceGenerator;
+};
+
+template<typename ValueType>
+class ModelTraceGenerator : public TraceGenerator<ValueType> {
+   public:
+    ModelTraceGenerator(storm::models::sparse::Model<ValueType> const& model, std::vector<storm::storage::BitVector> const& predicates,
+                        storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel, storm::storage::BitVector const& sinkStates,
+                        storm::storage::Scheduler<ValueType> const* scheduler, uint64_t seed)
+        : model(model),
+          simulator(model),
+          predicates(predicates),
+          rewardModel(rewardModel),
+          sinkStates(sinkStates),
+          scheduler(scheduler),
+          choiceGenerator(storm::utility::getStreamSeed(seed, 1)) {
+        simulator.setSeed(storm::utility::getStreamSeed(seed, 0));
+    }
+
+    virtual void resetToInitial() override {
+        simulator.resetToInitial();
+    }
+
+    virtual bool isSink() override {
+        return sinkStates.get(simulator.getCurrentState());
+    }
+
+    virtual bool satisfies(uint64_t predicate) override {
+        return predicates[predicate].get(simulator.getCurrentState());
+    }
+
+    virtual ValueType step() override {
+        uint64_t const state = simulator.getCurrentState();
+        uint64_t choice = 0;
+        if (scheduler) {
+            auto const& schedulerChoice = scheduler->getChoice(state);
+            STORM_LOG_THROW(schedulerChoice.isDefined(), storm::exceptions::InvalidOperationException, "The scheduler is undefined in state " << state << ".");
+            if (schedulerChoice.isDeterministic()) {
+                choice = schedulerChoice.getDeterministicChoice();
+            } else {
+                ValueType const probability = choiceGenerator.random();
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (auto const& entry : schedulerChoice.getChoiceAsDistribution()) {
+                    choice = entry.first;
+                    sum += entry.second;
+                    if (sum >= probability) {
+                        break;
+                    }
+                }
+            }
+        } else if (model.getTransitionMatrix().getRowGroupSize(state) > 1) {
+            choice = choiceGenerator.random_uint(0, model.getTransitionMatrix().getRowGroupSize(state) - 1);
+        }
+        ValueType reward = storm::utility::zero<ValueType>();
+        if (rewardModel) {
+            if (rewardModel->hasStateRewards()) {
+                reward += rewardModel->getStateReward(state);
+            }
+            if (rewardModel->hasStateActionRewards()) {
+                reward += rewardModel->getStateActionReward(model.getTransitionMatrix().getRowGroupIndices()[state] + choice);
+            }
+        }
+        simulator.step(choice);
+        return reward;
+    }
+
+   private:
+    storm::models::sparse::Model<ValueType> const& model;
+    storm::simulator::DiscreteTimeSparseModelSimulator<ValueType> simulator;
+    std::vector<storm::storage::BitVector> const& predicates;
+    storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel;
+    storm::storage::BitVector const& sinkStates;
+    storm::storage::Scheduler<ValueType> const* scheduler;
+    storm::utility::RandomProbabilityGenerator<ValueType> choiceGenerator;
+};
+
+/*!
+ * Samples a single trace and returns its value, i.e., whether it satisfies the property or the collected reward.
+ *
+ * @param isCutOff Is set to true iff the trace was cut off before the property was decided.
+ */
+template<typename ValueType>
+ValueType sampleTrace(TraceGenerator<ValueType>& generator, smc::TraceProperty const& property, uint64_t maximalTraceLength, bool& isCutOff) {
+    typedef smc::TraceProperty::Type Type;
+    isCutOff = false;
+    generator.resetToInitial();
+    switch (property.type) {
+        case Type::Next:
+            if (!generator.isSink()) {
+                generator.step();
+            }
+            return generator.satisfies(rightPredicate) ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>();
+        case Type::Until:
+            for (uint64_t step = 0;; ++step) {
+                if (step >= property.lowerBound && generator.satisfies(rightPredicate)) {
+                    return storm::utility::one<ValueType>();
+                }
+                if (!generator.satisfies(leftPredicate) || (property.upperBound && step >= *property.upperBound)) {
+                    return storm::utility::zero<ValueType>();
+                }
+                if (generator.isSink()) {
+                    // The trace stays in the current state, which satisfies the left formula. It thus only matters whether the lower bound can be reached.
+                    return step < property.lowerBound && generator.satisfies(rightPredicate) ? storm::utility::one<ValueType>()
+                                                                                              : storm::utility::zero<ValueType>();
+                }
+                if (step >= maximalTraceLength) {
+                    isCutOff = true;
+                    return storm::utility::zero<ValueType>();
+                }
+                generator.step();
+            }
+        case Type::CumulativeReward: {
+            ValueType reward = storm::utility::zero<ValueType>();
+            for (uint64_t step = 0; step < *property.upperBound; ++step) {
+                reward += generator.step();
+            }
+            return reward;
+        }
+        case Type::ReachabilityReward: {
+            ValueType reward = storm::utility::zero<ValueType>();
+            for (uint64_t step = 0;; ++step) {
+                if (generator.satisfies(rightPredicate)) {
+                    return reward;
+                }
+                if (generator.isSink()) {
+                    // The target is not reached, so the expected reward is infinite.
+                    return storm::utility::infinity<ValueType>();
+                }
+                if (step >= maximalTraceLength) {
+                    isCutOff = true;
+                    return reward;
+                }
+                reward += generator.step();
+            }
+        }
+    }
+    STORM_LOG_ASSERT(false, "Unknown type of trace property.");
+    return storm::utility::zero<ValueType>();
+}
+
+smc::TraceProperty getTraceProperty(storm::logic::Formula const& pathFormula, std::optional<std::string> const& rewardModelName, bool isReward) {
+    typedef smc::TraceProperty::Type Type;
+    smc::TraceProperty property;
+    if (isReward) {
+        property.rewardModelName = rewardModelName;
+        if (pathFormula.isReachabilityRewardFormula()) {
+            STORM_LOG_THROW(!pathFormula.asEventuallyFormula().hasRewardAccumulation(), storm::exceptions::NotSupportedException,
+                            "Reward accumulations are not supported by statistical model checking.");
+            property.type = Type::ReachabilityReward;
+            property.right = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+        } else if (pathFormula.isCumulativeRewardFormula()) {
+            auto const& cumulativeFormula = pathFormula.asCumulativeRewardFormula();
+            STORM_LOG_THROW(!cumulativeFormula.isMultiDimensional() && !cumulativeFormula.getTimeBoundReference().isRewardBound() &&
+                                !cumulativeFormula.hasRewardAccumulation(),
+                            storm::exceptions::NotSupportedException, "Statistical model checking only supports cumulative rewards with a single step bound.");
+            STORM_LOG_THROW(cumulativeFormula.hasIntegerBound(), storm::exceptions::InvalidPropertyException, "The step bound needs to be an integer.");
+            property.type = Type::CumulativeReward;
+            property.upperBound = cumulativeFormula.getNonStrictBound<uint64_t>();
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The reward formula " << pathFormula << " is not supported.");
+        }
+        return property;
+    }
+
+    if (pathFormula.isUntilFormula()) {
+        property.type = Type::Until;
+        property.left = pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer();
+        property.right = pathFormula.asUntilFormula().getRightSubformula().asSharedPointer();
+    } else if (pathFormula.isEventuallyFormula()) {
+        property.type = Type::Until;
+        property.left = std::make_shared<storm::logic::BooleanLiteralFormula>(true);
+        property.right = pathFormula.asEventuallyFormula().getSubformula().asSharedPointer();
+    } else if (pathFormula.isBoundedUntilFormula()) {
+        auto const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+        STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.getTimeBoundReference().isRewardBound(),
+                        storm::exceptions::NotSupportedException, "Statistical model checking only supports bounded until formulas with a single step bound.");
+        property.type = Type::Until;
+        property.left = boundedUntilFormula.getLeftSubformula().asSharedPointer();
+        property.right = boundedUntilFormula.getRightSubformula().asSharedPointer();
+        if (boundedUntilFormula.hasLowerBound()) {
+            STORM_LOG_THROW(boundedUntilFormula.hasIntegerLowerBound(), storm::exceptions::InvalidPropertyException, "The step bound needs to be an integer.");
+            property.lowerBound = boundedUntilFormula.getNonStrictLowerBound<uint64_t>();
+        }
+        if (boundedUntilFormula.hasUpperBound()) {
+            STORM_LOG_THROW(boundedUntilFormula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException, "The step bound needs to be an integer.");
+            property.upperBound = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+        }
+    } else if (pathFormula.isNextFormula()) {
+        property.type = Type::Next;
+        property.right = pathFormula.asNextFormula().getSubformula().asSharedPointer();
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The path formula " << pathFormula << " is not supported.");
+    }
+    return property;
+}
+}  // namespace
+
+StatisticalModelCheckerOptions::StatisticalModelCheckerOptions() {
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::SmcSettings>();
+    stoppingRule = smcSettings.getStoppingRule();
+    epsilon = smcSettings.getEpsilon();
+    delta = smcSettings.getDelta();
+    numberOfThreads = smcSettings.getNumberOfThreads() > 0 ? smcSettings.getNumberOfThreads() : storm::utility::getNumberOfThreads();
+    maximalTraceLength = smcSettings.getMaximalTraceLength();
+    seed = smcSettings.isSeedSet() ? smcSettings.getSeed() : std::random_device()();
+}
+
+template<typename ModelType>
+struct StatisticalModelChecker<ModelType>::Statistics {
+    void add(ValueType const& value, bool isCutOff) {
+        ++traces;
+        sum += value;
+        sumOfSquares += value * value;
+        if (isCutOff) {
+            ++cutOffTraces;
+        }
+    }
+
+    void add(Statistics const& other) {
+        traces += other.traces;
+        cutOffTraces += other.cutOffTraces;
+        sum += other.sum;
+        sumOfSquares += other.sumOfSquares;
+    }
+
+    // For probabilities, the sum is the number of successful traces.
+    uint64_t getSuccesses() const {
+        return static_cast<uint64_t>(std::llround(sum));
+    }
+
+    ValueType getMean() const {
+        return sum / static_cast<ValueType>(traces);
+    }
+
+    ValueType getVariance() const {
+        ValueType mean = getMean();
+        return traces > 1 ? (sumOfSquares - traces * mean * mean) / static_cast<ValueType>(traces - 1) : storm::utility::zero<ValueType>();
+    }
+
+    uint64_t traces = 0;
+    uint64_t cutOffTraces = 0;
+    ValueType sum = storm::utility::zero<ValueType>();
+    ValueType sumOfSquares = storm::utility::zero<ValueType>();
+};
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckerOptions const& options)
+    : program(program.substituteConstantsFormulas()), model(nullptr), options(options) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC || program.getModelType() == storm::prism::Program::ModelType::MDP,
+                    storm::exceptions::NotSupportedException, "Statistical model checking only supports DTMCs and MDPs.");
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options)
+    : model(&model), options(options) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::~StatisticalModelChecker() = default;
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::setScheduler(ProgramScheduler const& scheduler) {
+    STORM_LOG_THROW(program, storm::exceptions::InvalidOperationException, "Program schedulers can only be used when simulating a program.");
+    programScheduler = scheduler;
+}
+
+template<typename ModelType>
+void StatisticalModelChecker<ModelType>::setScheduler(storm::storage::Scheduler<ValueType> const& scheduler) {
+    STORM_LOG_THROW(model, storm::exceptions::InvalidOperationException, "Schedulers of explicit models can only be used when simulating a model.");
+    STORM_LOG_THROW(scheduler.isMemorylessScheduler(), storm::exceptions::NotSupportedException, "Only memoryless schedulers are supported.");
+    modelScheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(scheduler);
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true).setRewardOperatorsAllowed(true);
+    fragment.setUntilFormulasAllowed(true).setReachabilityProbabilityFormulasAllowed(true).setNextFormulasAllowed(true);
+    fragment.setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true).setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setReachabilityRewardFormulasAllowed(true).setCumulativeRewardFormulasAllowed(true);
+    fragment.setStepBoundedCumulativeRewardFormulasAllowed(true).setTimeBoundedCumulativeRewardFormulasAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false);
+    return checkTask.isOnlyInitialStatesRelevantSet() && checkTask.getFormula().isInFragment(fragment);
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (options.stoppingRule != smc::StoppingRule::Sprt || !checkTask.isBoundSet()) {
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+
+    smc::TraceProperty property = getTraceProperty(checkTask.getFormula().getSubformula(), std::nullopt, false);
+    double const threshold = checkTask.getBoundThreshold();
+    std::optional<bool> isAbove;
+    Statistics statistics = sample(property, [this, &threshold, &isAbove](Statistics const& current) {
+        isAbove = smc::getSprtDecision(current.getSuccesses(), current.traces, threshold, options.epsilon, options.delta);
+        return isAbove.has_value();
+    });
+    STORM_LOG_WARN_COND(statistics.cutOffTraces == 0, statistics.cutOffTraces << " traces were cut off after " << options.maximalTraceLength << " steps.");
+    if (!isAbove) {
+        STORM_LOG_WARN("The sequential probability ratio test was aborted before it reached a decision. Comparing the estimate with the threshold.");
+        isAbove = statistics.getMean() >= threshold;
+    }
+    STORM_LOG_INFO("The sequential probability ratio test decided that the probability is " << (*isAbove ? "above " : "below ") << threshold << " after "
+                                                                                               << statistics.traces << " traces.");
+    bool const isSatisfied = storm::logic::isLowerBound(checkTask.getBoundComparisonType()) ? *isAbove : !*isAbove;
+    return std::make_unique<ExplicitQualitativeCheckResult>(getInitialState(), isSatisfied);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeProbabilities(Environment const&,
+                                                                                      CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    return estimate(getTraceProperty(checkTask.getFormula(), std::nullopt, false));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeRewards(Environment const&,
+                                                                                CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    std::optional<std::string> rewardModelName;
+    if (checkTask.isRewardModelSet()) {
+        rewardModelName = checkTask.getRewardModel();
+    }
+    return estimate(getTraceProperty(checkTask.getFormula(), rewardModelName, true));
+}
+
+template<typename ModelType>
+typename StatisticalModelChecker<ModelType>::Statistics StatisticalModelChecker<ModelType>::sample(
+    smc::TraceProperty const& property, std::function<bool(Statistics const&)> const& isDone) const {
+    storm::utility::telemetry::Scope telemetryScope("statistical-model-checking");
+
+    // Create a trace generator for each thread. This is done sequentially, as setting up the generators is not thread-safe.
+    uint64_t const numberOfThreads = std::max<uint64_t>(options.numberOfThreads, 1);
+    std::vector<std::unique_ptr<TraceGenerator<ValueType>>> generators;
+    std::vector<storm::storage::BitVector> statePredicates;
+    storm::storage::BitVector sinkStates;
+    if (program) {
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        if (property.isReward()) {
+            generatorOptions.addRewardModel(property.rewardModelName.value_or(""));
+        }
+        auto labelToExpressionMapping = program->getLabelToExpressionMapping();
+        std::vector<storm::expressions::Expression> predicates(2, program->getManager().boolean(true));
+        if (property.left) {
+            predicates[leftPredicate] = property.left->toExpression(program->getManager(), labelToExpressionMapping);
+        }
+        if (property.right) {
+            predicates[rightPredicate] = property.right->toExpression(program->getManager(), labelToExpressionMapping);
+        }
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            generators.push_back(std::make_unique<ProgramTraceGenerator<ValueType>>(*program, generatorOptions, predicates, property.isReward(),
+                                                                                     programScheduler, storm::utility::getStreamSeed(options.seed, thread)));
+        }
+    } else {
+        SparsePropositionalModelChecker<ModelType> propositionalChecker(*model);
+        statePredicates.resize(2, storm::storage::BitVector(model->getNumberOfStates(), true));
+        if (property.left) {
+            statePredicates[leftPredicate] = propositionalChecker.check(*property.left)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        }
+        if (property.right) {
+            statePredicates[rightPredicate] = propositionalChecker.check(*property.right)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        }
+        storm::models::sparse::StandardRewardModel<ValueType> const* rewardModel = nullptr;
+        if (property.isReward()) {
+            rewardModel = &model->getRewardModel(property.rewardModelName.value_or(""));
+            STORM_LOG_THROW(!rewardModel->hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                            "Statistical model checking does not support transition rewards.");
+        }
+        auto const& transitionMatrix = model->getTransitionMatrix();
+        sinkStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+        for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+            for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                if (entry.getColumn() != state && !storm::utility::isZero(entry.getValue())) {
+                    sinkStates.set(state, false);
+                    break;
+                }
+            }
+        }
+        // The row group indices are computed lazily, which has to happen before the threads access them.
+        transitionMatrix.getRowGroupIndices();
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            generators.push_back(std::make_unique<ModelTraceGenerator<ValueType>>(*model, statePredicates, rewardModel, sinkStates, modelScheduler.get(),
+                                                                                   storm::utility::getStreamSeed(options.seed, thread)));
+        }
+    }
+
+    // Each thread samples batches of traces and merges them into the overall statistics until enough traces have been sampled.
+    std::mutex mutex;
+    Statistics statistics;
+    bool done = false;
+    std::exception_ptr exception;
+    auto work = [&](TraceGenerator<ValueType>& generator) {
+        try {
+            while (true) {
+                Statistics batch;
+                for (uint64_t trace = 0; trace < tracesPerBatch; ++trace) {
+                    bool isCutOff;
+                    ValueType value = sampleTrace(generator, property, options.maximalTraceLength, isCutOff);
+                    batch.add(value, isCutOff);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (done) {
+                    return;
+                }
+                statistics.add(batch);
+                done = isDone(statistics) || storm::utility::resources::isTerminate();
+                if (done) {
+                    return;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+            done = true;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 1; thread < generators.size(); ++thread) {
+        threads.emplace_back(work, std::ref(*generators[thread]));
+    }
+    work(*generators.front());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    storm::utility::telemetry::setAttribute("traces", statistics.traces);
+    storm::utility::telemetry::setAttribute("threads", static_cast<uint64_t>(generators.size()));
+    return statistics;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::estimate(smc::TraceProperty const& property) const {
+    std::function<bool(Statistics const&)> isDone;
+    if (property.isReward()) {
+        // Rewards are not bounded a priori, so we sample until the confidence interval based on the central limit theorem is narrow enough.
+        STORM_LOG_INFO_COND(options.stoppingRule == smc::StoppingRule::ChernoffHoeffding,
+                            "The stopping rule " << options.stoppingRule << " only applies to probabilities. Using the normal approximation for rewards.");
+        double const quantile = boost::math::quantile(boost::math::normal(), 1.0 - options.delta / 2.0);
+        isDone = [this, quantile](Statistics const& statistics) {
+            return std::isinf(statistics.sum) || (statistics.traces >= minimalNumberOfRewardTraces &&
+                                                  quantile * std::sqrt(statistics.getVariance() / statistics.traces) <= options.epsilon);
+        };
+    } else if (options.stoppingRule == smc::StoppingRule::ClopperPearson) {
+        isDone = [this](Statistics const& statistics) {
+            auto interval = smc::getClopperPearsonInterval(statistics.getSuccesses(), statistics.traces, options.delta);
+            return interval.second - interval.first <= 2 * options.epsilon;
+        };
+    } else {
+        STORM_LOG_WARN_COND(options.stoppingRule == smc::StoppingRule::ChernoffHoeffding,
+                            "The sequential probability ratio test needs a probability bound. Using the Chernoff-Hoeffding bound instead.");
+        uint64_t const numberOfTraces = smc::getChernoffHoeffdingNumberOfTraces(options.epsilon, options.delta);
+        isDone = [numberOfTraces](Statistics const& statistics) { return statistics.traces >= numberOfTraces; };
+    }
+
+    Statistics statistics = sample(property, isDone);
+    STORM_LOG_WARN_COND(statistics.cutOffTraces == 0, statistics.cutOffTraces << " traces were cut off after " << options.maximalTraceLength
+                                                                               << " steps, so the estimate may be too small.");
+    STORM_LOG_INFO("Estimated " << statistics.getMean() << " from " << statistics.traces << " traces.");
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(getInitialState(), statistics.getMean());
+}
+
+template<typename ModelType>
+uint64_t StatisticalModelChecker<ModelType>::getInitialState() const {
+    return model ? *model->getInitialStates().begin() : 0;
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+template class StatisticalModelChecker<storm::models::sparse::Mdp<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
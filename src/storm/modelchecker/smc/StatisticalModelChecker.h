@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/modelchecker/smc/StoppingRule.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class Scheduler;
+}
+
+namespace simulator {
+template<typename ValueType>
+class DiscreteTimePrismProgramSimulator;
+}
+
+namespace modelchecker {
+
+namespace smc {
+struct TraceProperty;
+}
+
+/*!
+ * The parameters of the statistical model checker.
+ */
+struct StatisticalModelCheckerOptions {
+    /*!
+     * Creates options according to the statistical model checking settings.
+     */
+    StatisticalModelCheckerOptions();
+
+    // The rule that decides when enough traces have been sampled.
+    smc::StoppingRule stoppingRule;
+    // The half-width of the confidence interval (and of the indifference region of the SPRT).
+    double epsilon;
+    // The admissible error probability.
+    double delta;
+    // The number of threads that generate traces.
+    uint64_t numberOfThreads;
+    // Traces of unbounded properties are cut off after this number of steps.
+    uint64_t maximalTraceLength;
+    // The seed from which the random streams of all threads are derived.
+    uint64_t seed;
+};
+
+/*!
+ * Estimates probabilities and expected rewards of the initial state of a discrete-time model by sampling traces (statistical model checking).
+ * The traces are either generated on the fly from a PRISM program, so the model does not have to be built, or sampled from an explicitly built model.
+ * Several threads generate traces concurrently, each with its own simulator and an independent random stream.
+ *
+ * Nondeterminism is resolved by a scheduler that picks uniformly among the available choices unless another scheduler is given. The results thus refer
+ * to the induced Markov chain; in particular, the optimization direction of a property is ignored.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+    // Selects the index of a choice of the current state of the given simulator. It is called concurrently and must thus be thread-safe.
+    typedef std::function<uint64_t(storm::simulator::DiscreteTimePrismProgramSimulator<ValueType> const&)> ProgramScheduler;
+
+    /*!
+     * Creates a model checker that generates traces from the given program, which needs to have a unique initial state.
+     */
+    StatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    /*!
+     * Creates a model checker that samples traces from the given model. The traces start in the initial state with the lowest index.
+     */
+    StatisticalModelChecker(ModelType const& model, StatisticalModelCheckerOptions const& options = StatisticalModelCheckerOptions());
+
+    ~StatisticalModelChecker();
+
+    /*!
+     * Sets the scheduler that resolves the nondeterminism of the program.
+     */
+    void setScheduler(ProgramScheduler const& scheduler);
+
+    /*!
+     * Sets the (memoryless) scheduler that resolves the nondeterminism of the model.
+     */
+    void setScheduler(storm::storage::Scheduler<ValueType> const& scheduler);
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeRewards(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) override;
+
+   private:
+    struct Statistics;
+
+    // Samples traces of the given property until the given predicate holds for the aggregated results.
+    Statistics sample(smc::TraceProperty const& property, std::function<bool(Statistics const&)> const& isDone) const;
+
+    // Estimates the probability or the expected reward of the given property.
+    std::unique_ptr<CheckResult> estimate(smc::TraceProperty const& property) const;
+
+    uint64_t getInitialState() const;
+
+    std::optional<storm::prism::Program> program;
+    ModelType const* model;
+    StatisticalModelCheckerOptions options;
+    ProgramScheduler programScheduler;
+    std::unique_ptr<storm::storage::Scheduler<ValueType>> modelScheduler;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,63 @@
+#include "storm/modelchecker/smc/StoppingRule.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+std::string toString(StoppingRule const& rule) {
+    switch (rule) {
+        case StoppingRule::ChernoffHoeffding:
+            return "chernoff";
+        case StoppingRule::ClopperPearson:
+            return "clopper-pearson";
+        case StoppingRule::Sprt:
+            return "sprt";
+    }
+    STORM_LOG_ASSERT(false, "Unknown stopping rule.");
+    return "unknown";
+}
+
+std::ostream& operator<<(std::ostream& out, StoppingRule const& rule) {
+    return out << toString(rule);
+}
+
+uint64_t getChernoffHoeffdingNumberOfTraces(double epsilon, double delta) {
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / delta) / (2.0 * epsilon * epsilon)));
+}
+
+std::pair<double, double> getClopperPearsonInterval(uint64_t successes, uint64_t traces, double delta) {
+    STORM_LOG_ASSERT(successes <= traces, "More successes than traces.");
+    if (traces == 0) {
+        return {0.0, 1.0};
+    }
+    double const failures = static_cast<double>(traces - successes);
+    double lower = successes == 0 ? 0.0 : boost::math::ibeta_inv(static_cast<double>(successes), failures + 1.0, delta / 2.0);
+    double upper = successes == traces ? 1.0 : boost::math::ibeta_inv(static_cast<double>(successes) + 1.0, failures, 1.0 - delta / 2.0);
+    return {lower, upper};
+}
+
+std::optional<bool> getSprtDecision(uint64_t successes, uint64_t traces, double threshold, double epsilon, double delta) {
+    STORM_LOG_ASSERT(successes <= traces, "More successes than traces.");
+    // Keep the hypotheses away from 0 and 1 so that the likelihood ratio stays finite.
+    double const above = std::min(threshold + epsilon, 1.0 - 1e-9);
+    double const below = std::max(threshold - epsilon, 1e-9);
+    double const logLikelihoodRatio = static_cast<double>(successes) * std::log(below / above) +
+                                      static_cast<double>(traces - successes) * std::log((1.0 - below) / (1.0 - above));
+    if (logLikelihoodRatio >= std::log((1.0 - delta) / delta)) {
+        return false;
+    } else if (logLikelihoodRatio <= std::log(delta / (1.0 - delta))) {
+        return true;
+    }
+    return std::nullopt;
+}
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace storm {
+namespace modelchecker {
+namespace smc {
+
+/*!
+ * The rules that decide when enough traces have been sampled to estimate a probability.
+ */
+enum class StoppingRule {
+    // Samples the fixed number of traces given by the Chernoff-Hoeffding bound.
+    ChernoffHoeffding,
+    // Samples until the exact (Clopper-Pearson) confidence interval is narrow enough.
+    ClopperPearson,
+    // Samples until Wald's sequential probability ratio test decides whether the probability is above or below a threshold.
+    Sprt
+};
+
+std::string toString(StoppingRule const& rule);
+std::ostream& operator<<(std::ostream& out, StoppingRule const& rule);
+
+/*!
+ * Computes the number of traces such that the relative frequency deviates from the actual probability by more than epsilon with probability at most
+ * delta.
+ */
+uint64_t getChernoffHoeffdingNumberOfTraces(double epsilon, double delta);
+
+/*!
+ * Computes the Clopper-Pearson confidence interval with confidence 1-delta for a probability with the given number of successful traces.
+ *
+ * @return The lower and the upper bound of the interval.
+ */
+std::pair<double, double> getClopperPearsonInterval(uint64_t successes, uint64_t traces, double delta);
+
+/*!
+ * Evaluates the sequential probability ratio test of the hypothesis p >= threshold + epsilon against p <= threshold - epsilon, where both kinds of
+ * errors have probability at most delta.
+ *
+ * @return True if the probability is above the threshold, false if it is below, and nothing if more traces are needed.
+ */
+std::optional<bool> getSprtDecision(uint64_t successes, uint64_t traces, double threshold, double epsilon, double delta);
+
+}  // namespace smc
+}  // namespace modelchecker
+}  // namespace storm
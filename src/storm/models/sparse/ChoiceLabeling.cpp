@@ -23,21 +23,7 @@ bool ChoiceLabeling::isChoiceLabeling() const {
 }
 
 bool ChoiceLabeling::operator==(ChoiceLabeling const& other) const {
-    if (itemCount != other.itemCount) {
-        return false;
-    }
-    if (this->getNumberOfLabels() != other.getNumberOfLabels()) {
-        return false;
-    }
-    for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        if (!other.containsLabel(labelIndexPair.first)) {
-            return false;
-        }
-        if (labelings[labelIndexPair.second] != other.getChoices(labelIndexPair.first)) {
-            return false;
-        }
-    }
-    return true;
+    return ItemLabeling::operator==(other);
 }
 
 ChoiceLabeling ChoiceLabeling::getSubLabeling(storm::storage::BitVector const& choices) const {
@@ -10,10 +10,61 @@
 namespace storm {
 namespace models {
 namespace sparse {
+
+namespace detail {
+using Labeling = std::variant<storm::storage::BitVector, storm::storage::CompressedBitVector>;
+
+storm::storage::BitVector const& asBitVector(storm::storage::BitVector const& labeling) {
+    return labeling;
+}
+
+storm::storage::BitVector asBitVector(storm::storage::CompressedBitVector const& labeling) {
+    return labeling.toBitVector();
+}
+
+bool haveEqualItems(Labeling const& lhs, Labeling const& rhs) {
+    if (lhs.index() == rhs.index()) {
+        return lhs == rhs;
+    }
+    auto const& compressed = std::holds_alternative<storm::storage::CompressedBitVector>(lhs) ? std::get<storm::storage::CompressedBitVector>(lhs)
+                                                                                              : std::get<storm::storage::CompressedBitVector>(rhs);
+    auto const& dense = std::holds_alternative<storm::storage::BitVector>(lhs) ? std::get<storm::storage::BitVector>(lhs)
+                                                                               : std::get<storm::storage::BitVector>(rhs);
+    return compressed == storm::storage::CompressedBitVector(dense);
+}
+}  // namespace detail
+
 ItemLabeling::ItemLabeling(uint_fast64_t itemCount) : itemCount(itemCount), nameToLabelingIndexMap(), labelings() {
     // Intentionally left empty.
 }
 
+ItemLabeling::ItemLabeling(ItemLabeling const& other) : itemCount(other.itemCount), nameToLabelingIndexMap(other.nameToLabelingIndexMap) {
+    std::lock_guard<std::mutex> lock(other.labelingsMutex);
+    labelings = other.labelings;
+}
+
+ItemLabeling::ItemLabeling(ItemLabeling&& other)
+    : itemCount(other.itemCount), nameToLabelingIndexMap(std::move(other.nameToLabelingIndexMap)), labelings(std::move(other.labelings)) {
+    // Intentionally left empty.
+}
+
+ItemLabeling& ItemLabeling::operator=(ItemLabeling const& other) {
+    if (this != &other) {
+        std::scoped_lock lock(labelingsMutex, other.labelingsMutex);
+        itemCount = other.itemCount;
+        nameToLabelingIndexMap = other.nameToLabelingIndexMap;
+        labelings = other.labelings;
+    }
+    return *this;
+}
+
+ItemLabeling& ItemLabeling::operator=(ItemLabeling&& other) {
+    itemCount = other.itemCount;
+    nameToLabelingIndexMap = std::move(other.nameToLabelingIndexMap);
+    labelings = std::move(other.labelings);
+    return *this;
+}
+
 bool ItemLabeling::isStateLabeling() const {
     return false;
 }
@@ -35,17 +86,22 @@ ChoiceLabeling& ItemLabeling::asChoiceLabeling() {
 }
 
 bool ItemLabeling::operator==(ItemLabeling const& other) const {
+    if (this == &other) {
+        return true;
+    }
     if (itemCount != other.itemCount) {
         return false;
     }
     if (this->getNumberOfLabels() != other.getNumberOfLabels()) {
         return false;
     }
+    std::scoped_lock lock(labelingsMutex, other.labelingsMutex);
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        if (!other.containsLabel(labelIndexPair.first)) {
+        auto otherLabelIt = other.nameToLabelingIndexMap.find(labelIndexPair.first);
+        if (otherLabelIt == other.nameToLabelingIndexMap.end()) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        if (!detail::haveEqualItems(labelings[labelIndexPair.second], other.labelings[otherLabelIt->second])) {
             return false;
         }
     }
@@ -54,8 +110,10 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
     ItemLabeling result(items.getNumberOfSetBits());
+    std::lock_guard<std::mutex> lock(labelingsMutex);
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        result.addLabel(labelIndexPair.first,
+                        std::visit([&items](auto const& labeling) { return detail::asBitVector(labeling) % items; }, labelings[labelIndexPair.second]));
     }
     return result;
 }
@@ -87,10 +145,19 @@ void ItemLabeling::join(ItemLabeling const& other) {
     STORM_LOG_THROW(this->itemCount == other.itemCount, storm::exceptions::InvalidArgumentException,
                     "The item count of the two labelings does not match: " << this->itemCount << " vs. " << other.itemCount << ".");
     for (auto const& label : other.getLabels()) {
+        // Copy the item sets such that compressed labelings remain compressed.
+        storm::storage::BitVector otherItems;
+        {
+            std::lock_guard<std::mutex> lock(other.labelingsMutex);
+            otherItems = std::visit([](auto const& labeling) { return storm::storage::BitVector(detail::asBitVector(labeling)); },
+                                    other.labelings[other.nameToLabelingIndexMap.at(label)]);
+        }
         if (this->containsLabel(label)) {
-            this->setItems(label, this->getItems(label) | other.getItems(label));
+            uint64_t const labelIndex = nameToLabelingIndexMap.at(label);
+            auto joinedItems = std::visit([&otherItems](auto const& labeling) { return detail::asBitVector(labeling) | otherItems; }, labelings[labelIndex]);
+            this->setItems(label, std::move(joinedItems));
         } else {
-            this->addLabel(label, other.getItems(label));
+            this->addLabel(label, std::move(otherItems));
         }
     }
 }
@@ -115,12 +182,19 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
-    std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    for (uint64_t labelIndex = 0; labelIndex < labelings.size(); ++labelIndex) {
+        storeLabeling(labelIndex, std::visit([&inversePermutation](auto const& labeling) { return detail::asBitVector(labeling).permute(inversePermutation); },
+                                             labelings[labelIndex]));
     }
+}
 
-    this->labelings = newLabelings;
+std::size_t ItemLabeling::getSizeInBytes() const {
+    std::size_t result = 0;
+    std::lock_guard<std::mutex> lock(labelingsMutex);
+    for (auto const& labeling : labelings) {
+        result += std::visit([](auto const& labeling) { return labeling.getSizeInBytes(); }, labeling);
+    }
+    return result;
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector const& labeling) {
@@ -128,7 +202,8 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.push_back(labeling);
+    labelings.emplace_back();
+    storeLabeling(labelings.size() - 1, storage::BitVector(labeling));
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -136,7 +211,8 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.emplace_back(std::move(labeling));
+    labelings.emplace_back();
+    storeLabeling(labelings.size() - 1, std::move(labeling));
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -158,20 +234,21 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    std::visit([item](auto& labeling) { labeling.set(item, true); }, this->labelings[nameToLabelingIndexMap.at(label)]);
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    std::visit([item](auto& labeling) { labeling.set(item, false); }, this->labelings[nameToLabelingIndexMap.at(label)]);
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label '" << label << "' is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)].get(item);
+    std::lock_guard<std::mutex> lock(labelingsMutex);
+    return std::visit([item](auto const& labeling) { return labeling.get(item); }, this->labelings[nameToLabelingIndexMap.at(label)]);
 }
 
 std::size_t ItemLabeling::getNumberOfLabels() const {
@@ -185,37 +262,50 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)];
+    return getDenseLabeling(nameToLabelingIndexMap.at(label));
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector const& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    setItems(label, storage::BitVector(labeling));
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    uint64_t const labelIndex = nameToLabelingIndexMap.at(label);
+    if (auto dense = std::get_if<storage::BitVector>(&this->labelings[labelIndex])) {
+        // Keep the labeling dense such that references obtained via getItems remain valid.
+        *dense = std::move(labeling);
+    } else {
+        storeLabeling(labelIndex, std::move(labeling));
+    }
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
     out << this->getNumberOfLabels() << " labels\n";
+    std::lock_guard<std::mutex> lock(labelingsMutex);
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second].getNumberOfSetBits() << " item(s)\n";
+        auto const numberOfItems = std::visit([](auto const& labeling) { return labeling.getNumberOfSetBits(); }, this->labelings[labelIndexPair.second]);
+        out << "   * " << labelIndexPair.first << " -> " << numberOfItems << " item(s)\n";
     }
 }
 
 void ItemLabeling::printCompleteLabelingInformationToStream(std::ostream& out) const {
     out << "Labels: \t" << this->getNumberOfLabels() << '\n';
+    std::lock_guard<std::mutex> lock(labelingsMutex);
     for (auto label : nameToLabelingIndexMap) {
         out << "Label '" << label.first << "': ";
-        for (auto index : this->labelings[label.second]) {
-            out << index << " ";
-        }
+        std::visit(
+            [&out](auto const& labeling) {
+                for (auto index : labeling) {
+                    out << index << " ";
+                }
+            },
+            this->labelings[label.second]);
         out << '\n';
     }
 }
@@ -229,6 +319,25 @@ std::ostream& operator<<(std::ostream& out, ItemLabeling const& labeling) {
     return out;
 }
 
+void ItemLabeling::storeLabeling(uint64_t labelIndex, storage::BitVector&& labeling) {
+    storm::storage::CompressedBitVector compressed(labeling);
+    // Accessing compressed labelings is slower, so we only compress if this saves at least half of the memory.
+    if (2 * compressed.getSizeInBytes() <= labeling.getSizeInBytes()) {
+        labelings[labelIndex] = std::move(compressed);
+    } else {
+        labelings[labelIndex] = std::move(labeling);
+    }
+}
+
+storm::storage::BitVector const& ItemLabeling::getDenseLabeling(uint64_t labelIndex) const {
+    std::lock_guard<std::mutex> lock(labelingsMutex);
+    auto& labeling = labelings[labelIndex];
+    if (auto compressed = std::get_if<storm::storage::CompressedBitVector>(&labeling)) {
+        labeling = compressed->toBitVector();
+    }
+    return std::get<storm::storage::BitVector>(labeling);
+}
+
 std::string ItemLabeling::generateUniqueLabel(const std::string& prefix) const {
     if (!containsLabel(prefix)) {
         return prefix;
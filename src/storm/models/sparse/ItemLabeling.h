@@ -1,11 +1,14 @@
 #pragma once
 
 #include <iostream>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <variant>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -27,8 +30,10 @@ class ItemLabeling {
      */
     explicit ItemLabeling(uint64_t itemCount = 0);
 
-    ItemLabeling(ItemLabeling const& other) = default;
-    ItemLabeling& operator=(ItemLabeling const& other) = default;
+    ItemLabeling(ItemLabeling const& other);
+    ItemLabeling(ItemLabeling&& other);
+    ItemLabeling& operator=(ItemLabeling const& other);
+    ItemLabeling& operator=(ItemLabeling&& other);
 
     virtual ~ItemLabeling() = default;
 
@@ -139,6 +144,11 @@ class ItemLabeling {
 
     void permuteItems(std::vector<uint64_t> const& inversePermutation);
 
+    /*!
+     * Retrieves the (approximate) number of bytes that are occupied by the item sets of all labels.
+     */
+    std::size_t getSizeInBytes() const;
+
     virtual std::size_t hash() const;
 
     /*!
@@ -228,8 +238,22 @@ class ItemLabeling {
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    // A vector that holds the labeling for all known labels. Labelings that compress well are stored in compressed form until they are requested as a
+    // BitVector (which may happen on const access).
+    mutable std::vector<std::variant<storm::storage::BitVector, storm::storage::CompressedBitVector>> labelings;
+
+    // Guards the (lazy) conversion of compressed labelings.
+    mutable std::mutex labelingsMutex;
+
+    /*!
+     * Stores the given labeling for the label with the given index, compressed if this saves a substantial amount of memory.
+     */
+    void storeLabeling(uint64_t labelIndex, storage::BitVector&& labeling);
+
+    /*!
+     * Retrieves the labeling of the label with the given index as a BitVector. If the labeling is compressed, it is converted permanently.
+     */
+    storm::storage::BitVector const& getDenseLabeling(uint64_t labelIndex) const;
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
@@ -238,7 +238,7 @@ bool MarkovAutomaton<ValueType, RewardModelType>::checkContainsZenoCycle() const
         return true;
     }
     storm::storage::BitVector statesWithZenoCycle =
-        storm::utility::graph::performProb0E(*this, this->getBackwardTransitions(), ~markovianStates, markovianStates);
+        storm::utility::graph::performProb0E(*this, *this->getBackwardTransitions(), ~markovianStates, markovianStates);
     return !statesWithZenoCycle.empty();
 }
 
@@ -149,8 +149,22 @@ void Model<ValueType, RewardModelType>::assertValidityOfComponents(
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-    return this->getTransitionMatrix().transpose(true);
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
+    return this->getAnalysisCache()->getBackwardTransitions(this->getTransitionMatrix());
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<ModelAnalysisCache<ValueType>> Model<ValueType, RewardModelType>::getAnalysisCache() const {
+    // The cache might be requested by several threads at once, so only the first one that finishes creating it wins. All accesses to the pointer
+    // have to use the atomic functions.
+    auto cache = std::atomic_load(&analysisCache);
+    if (!cache) {
+        auto newCache = std::make_shared<ModelAnalysisCache<ValueType>>();
+        if (std::atomic_compare_exchange_strong(&analysisCache, &cache, newCache)) {
+            cache = std::move(newCache);
+        }
+    }
+    return cache;
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -200,6 +214,8 @@ storm::storage::SparseMatrix<ValueType> const& Model<ValueType, RewardModelType>
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType>& Model<ValueType, RewardModelType>::getTransitionMatrix() {
+    // The matrix might be changed by the caller, invalidating the cached analyses.
+    std::atomic_store(&analysisCache, std::shared_ptr<ModelAnalysisCache<ValueType>>());
     return transitionMatrix;
 }
 
@@ -620,11 +636,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    std::atomic_store(&analysisCache, std::shared_ptr<ModelAnalysisCache<ValueType>>());
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    std::atomic_store(&analysisCache, std::shared_ptr<ModelAnalysisCache<ValueType>>());
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -7,6 +7,7 @@
 #include "storm/models/Model.h"
 #include "storm/models/ModelRepresentation.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
@@ -54,9 +55,22 @@ class Model : public storm::models::Model<CValueType> {
      * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
      * that correspond to the reversed transition relation of this model.
      *
+     * The backward transitions are computed on the first call and then kept in the analysis cache of this model. The returned pointer keeps them
+     * alive even if the cache is dropped because the transition matrix is accessed in a non-const way. In that case, they might no longer match
+     * the transition matrix.
+     *
      * @return A sparse matrix that represents the backward transitions of this model.
      */
-    storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions() const;
+
+    /*!
+     * Retrieves a cache for analyses on the transition structure of this model, e.g., to reuse results when checking several properties.
+     * The cache is dropped whenever the transition matrix is accessed in a non-const way. The returned pointer keeps the cache alive in that case.
+     * Obtaining the cache is thread-safe.
+     *
+     * @return The analysis cache of this model.
+     */
+    std::shared_ptr<ModelAnalysisCache<ValueType>> getAnalysisCache() const;
 
     /*!
      * Returns an object representing the matrix rows associated with the given state.
@@ -468,6 +482,9 @@ class Model : public storm::models::Model<CValueType> {
 
     // if set, gives information about where each choice originates w.r.t. the input model description
     std::optional<std::shared_ptr<storm::storage::sparse::ChoiceOrigins>> choiceOrigins;
+
+    // Cached data that only depends on the transition matrix, created on demand.
+    mutable std::shared_ptr<ModelAnalysisCache<ValueType>> analysisCache;
 };
 
 /*!
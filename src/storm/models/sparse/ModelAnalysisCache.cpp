@@ -0,0 +1,95 @@
+#include "storm/models/sparse/ModelAnalysisCache.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+namespace detail {
+// Transposing in parallel needs auxiliary memory per thread, which only pays off for large matrices.
+uint64_t const minimalNumberOfEntriesForParallelTranspose = 1 << 20;
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> computeBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+#ifdef STORM_HAVE_INTELTBB
+    if (storm::NumberTraits<ValueType>::IsThreadSafe && transitionMatrix.getEntryCount() >= minimalNumberOfEntriesForParallelTranspose &&
+        storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return transitionMatrix.transposeParallel(true);
+    }
+#endif
+    return transitionMatrix.transpose(true);
+}
+}  // namespace detail
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ModelAnalysisCache<ValueType>::getBackwardTransitions(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    // A separate mutex ensures that other cached data can be accessed while the backward transitions are computed.
+    std::lock_guard<std::mutex> lock(backwardTransitionsMutex);
+    if (!backwardTransitions) {
+        backwardTransitions = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(detail::computeBackwardTransitions(transitionMatrix));
+    }
+    STORM_LOG_ASSERT(backwardTransitions->getRowCount() == transitionMatrix.getColumnCount(), "Cached backward transitions do not match the model.");
+    return backwardTransitions;
+}
+
+template<typename ValueType>
+typename ModelAnalysisCache<ValueType>::UntilProbabilities const* ModelAnalysisCache<ValueType>::findUntilProbabilities(
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::optional<storm::OptimizationDirection> const& dir) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto findRes = untilProbabilities.find(getUntilKey(phiStates, psiStates, dir));
+    if (findRes == untilProbabilities.end()) {
+        return nullptr;
+    }
+    return &findRes->second;
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::storeUntilProbabilities(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            std::optional<storm::OptimizationDirection> const& dir,
+                                                            storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& values) {
+    STORM_LOG_ASSERT(maybeStates.size() == values.size(), "Number of maybe states does not match the number of values.");
+    UntilProbabilities result;
+    result.maybeStates = maybeStates;
+    result.values = values;
+    std::lock_guard<std::mutex> lock(mutex);
+    // Stored results are not replaced as other threads might refer to them
+    untilProbabilities.emplace(getUntilKey(phiStates, psiStates, dir), std::move(result));
+}
+
+template<typename ValueType>
+uint64_t ModelAnalysisCache<ValueType>::getNumberOfCachedUntilProbabilities() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return untilProbabilities.size();
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::clear() {
+    std::scoped_lock lock(mutex, backwardTransitionsMutex);
+    backwardTransitions.reset();
+    untilProbabilities.clear();
+}
+
+template<typename ValueType>
+typename ModelAnalysisCache<ValueType>::UntilKey ModelAnalysisCache<ValueType>::getUntilKey(storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates,
+                                                                                          std::optional<storm::OptimizationDirection> const& dir) {
+    uint64_t dirIndex = dir ? (storm::solver::minimize(*dir) ? 1 : 2) : 0;
+    return UntilKey(phiStates, psiStates, dirIndex);
+}
+
+template class ModelAnalysisCache<double>;
+template class ModelAnalysisCache<storm::RationalNumber>;
+template class ModelAnalysisCache<storm::RationalFunction>;
+template class ModelAnalysisCache<storm::Interval>;
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+/*!
+ * Caches results of analyses on the transition structure of a sparse model so that they can be reused when several properties are checked on the same
+ * model. All cached data only depends on the transition matrix of the model, i.e., the cache has to be invalidated whenever the transition matrix changes.
+ * @note The cache can be used by several threads checking properties on the same model concurrently. Cached data is never changed once it is stored,
+ * so references obtained from the cache remain valid as long as the cache itself is alive and not cleared (which must not happen concurrently).
+ * Models hand out their cache as a shared pointer, so a user keeps it alive even if the model drops it in the meantime.
+ */
+template<typename ValueType>
+class ModelAnalysisCache {
+   public:
+    /*!
+     * The result of a previous computation of (optimal) until probabilities.
+     */
+    struct UntilProbabilities {
+        // The states whose value is neither zero nor one according to the graph analysis
+        storm::storage::BitVector maybeStates;
+        // The values for all states
+        std::vector<ValueType> values;
+    };
+
+    /*!
+     * Retrieves the backward transitions of the given transition matrix. The matrix is only transposed the first time this is called (in parallel,
+     * if enabled and the matrix is large).
+     * @param transitionMatrix The transition matrix of the model that owns this cache.
+     * @return The backward transitions, which remain valid as long as the returned pointer is held (even if the cache is cleared).
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the result of a previous computation of the probabilities for phi U psi, if present.
+     * @param dir The optimization direction (if the model is nondeterministic)
+     * @return the cached probabilities or nullptr if there are none.
+     */
+    UntilProbabilities const* findUntilProbabilities(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                     std::optional<storm::OptimizationDirection> const& dir) const;
+
+    /*!
+     * Stores the given probabilities for phi U psi (unless probabilities for phi U psi are already stored).
+     * @param dir The optimization direction (if the model is nondeterministic)
+     * @param maybeStates The states whose value is neither zero nor one according to the graph analysis. All other states must have value exactly zero
+     * or one, as later computations treat them as states with probability zero or one.
+     */
+    void storeUntilProbabilities(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                 std::optional<storm::OptimizationDirection> const& dir, storm::storage::BitVector const& maybeStates,
+                                 std::vector<ValueType> const& values);
+
+    /*!
+     * @return the number of cached until probability results
+     */
+    uint64_t getNumberOfCachedUntilProbabilities() const;
+
+    /*!
+     * Removes all cached data.
+     */
+    void clear();
+
+   private:
+    // phi states, psi states, and the optimization direction (0 if not given).
+    using UntilKey = std::tuple<storm::storage::BitVector, storm::storage::BitVector, uint64_t>;
+    static UntilKey getUntilKey(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                std::optional<storm::OptimizationDirection> const& dir);
+
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+    std::mutex backwardTransitionsMutex;
+    std::map<UntilKey, UntilProbabilities> untilProbabilities;
+    mutable std::mutex mutex;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -23,21 +23,7 @@ bool StateLabeling::isStateLabeling() const {
 }
 
 bool StateLabeling::operator==(StateLabeling const& other) const {
-    if (itemCount != other.itemCount) {
-        return false;
-    }
-    if (this->getNumberOfLabels() != other.getNumberOfLabels()) {
-        return false;
-    }
-    for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        if (!other.containsLabel(labelIndexPair.first)) {
-            return false;
-        }
-        if (labelings[labelIndexPair.second] != other.getStates(labelIndexPair.first)) {
-            return false;
-        }
-    }
-    return true;
+    return ItemLabeling::operator==(other);
 }
 
 StateLabeling StateLabeling::getSubLabeling(storm::storage::BitVector const& states) const {
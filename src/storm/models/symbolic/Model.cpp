@@ -103,6 +103,45 @@ storm::dd::Bdd<Type> const& Model<Type, ValueType>::getReachableStates() const {
     return reachableStates;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Odd const& Model<Type, ValueType>::getReachableStatesOdd() const {
+    if (!reachableStatesOdd) {
+        reachableStatesOdd = reachableStates.createOdd();
+    }
+    return reachableStatesOdd.value();
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& Model<Type, ValueType>::getExplicitMatrix(storm::dd::Add<Type, ValueType> const& matrix) const {
+    // The number of explicit matrices that are kept in the cache.
+    uint64_t const cacheCapacity = 2;
+
+    for (auto entryIt = explicitMatrixCache.begin(); entryIt != explicitMatrixCache.end(); ++entryIt) {
+        if (entryIt->first == matrix) {
+            STORM_LOG_INFO("Reusing explicit representation of symbolic matrix.");
+            if (entryIt != explicitMatrixCache.begin()) {
+                auto entry = std::move(*entryIt);
+                explicitMatrixCache.erase(entryIt);
+                explicitMatrixCache.push_front(std::move(entry));
+            }
+            return explicitMatrixCache.front().second;
+        }
+    }
+
+    storm::dd::Odd const& odd = this->getReachableStatesOdd();
+    storm::storage::SparseMatrix<ValueType> explicitMatrix;
+    if (this->getNondeterminismVariables().empty()) {
+        explicitMatrix = matrix.toMatrix(odd, odd);
+    } else {
+        explicitMatrix = matrix.toMatrix(this->getNondeterminismVariables(), odd, odd);
+    }
+    if (explicitMatrixCache.size() == cacheCapacity) {
+        explicitMatrixCache.pop_back();
+    }
+    explicitMatrixCache.emplace_front(matrix, std::move(explicitMatrix));
+    return explicitMatrixCache.front().second;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> const& Model<Type, ValueType>::getInitialStates() const {
     return labelToBddMap.at("init");
@@ -227,6 +266,7 @@ std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable
 template<storm::dd::DdType Type, typename ValueType>
 void Model<Type, ValueType>::setTransitionMatrix(storm::dd::Add<Type, ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    explicitMatrixCache.clear();
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -1,12 +1,15 @@
 #ifndef STORM_MODELS_SYMBOLIC_MODEL_H_
 #define STORM_MODELS_SYMBOLIC_MODEL_H_
 
+#include <deque>
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 
 #include "storm/models/Model.h"
 #include "storm/models/ModelRepresentation.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdType.h"
@@ -135,6 +138,24 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::dd::Bdd<Type> const& getReachableStates() const;
 
+    /*!
+     * Retrieves the ODD of the reachable states. It is created upon the first request.
+     *
+     * @return The ODD of the reachable states.
+     */
+    storm::dd::Odd const& getReachableStatesOdd() const;
+
+    /*!
+     * Translates the given matrix over the row, column and nondeterminism variables of this model (e.g. the transition matrix) to an explicit matrix
+     * whose row groups and columns correspond to the reachable states (wrt. the ODD of the reachable states). The most recent translations are
+     * cached, so different model checking helpers that translate the same matrix of this model only translate it once.
+     * NOTE: the cache is not thread-safe.
+     *
+     * @param matrix The matrix to translate.
+     * @return The explicit matrix.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getExplicitMatrix(storm::dd::Add<Type, ValueType> const& matrix) const;
+
     /*!
      * Retrieves the initial states of the model.
      *
@@ -436,6 +457,12 @@ class Model : public storm::models::Model<CValueType> {
 
     // An empty variable set that can be used when references to non-existing sets need to be returned.
     std::set<storm::expressions::Variable> emptyVariableSet;
+
+    // The ODD of the reachable states (if it was already requested).
+    mutable std::optional<storm::dd::Odd> reachableStatesOdd;
+
+    // The most recently translated matrices together with their explicit representation (the most recent one is at the front).
+    mutable std::deque<std::pair<storm::dd::Add<Type, ValueType>, storm::storage::SparseMatrix<ValueType>>> explicitMatrixCache;
 };
 
 }  // namespace symbolic
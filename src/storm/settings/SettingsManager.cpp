@@ -37,6 +37,7 @@
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SmcSettings.h"
 #include "storm/settings/modules/Smt2SmtSolverSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
@@ -146,7 +147,11 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 std::string optionName = currentArgument.substr(2);
                 auto optionIterator = this->longNameToOptions.find(optionName);
                 if (optionIterator == this->longNameToOptions.end()) {
-                    handleUnknownOption(optionName, false);
+                    // The option might belong to a module that has not been constructed yet.
+                    materializeAllModules();
+                    if (this->longNameToOptions.find(optionName) == this->longNameToOptions.end()) {
+                        handleUnknownOption(optionName, false);
+                    }
                 }
                 activeOptionIsShortName = false;
                 activeOptionName = optionName;
@@ -156,7 +161,10 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 std::string optionName = currentArgument.substr(1);
                 auto optionIterator = this->shortNameToOptions.find(optionName);
                 if (optionIterator == this->shortNameToOptions.end()) {
-                    handleUnknownOption(optionName, true);
+                    materializeAllModules();
+                    if (this->shortNameToOptions.find(optionName) == this->shortNameToOptions.end()) {
+                        handleUnknownOption(optionName, true);
+                    }
                 }
                 activeOptionIsShortName = true;
                 activeOptionName = optionName;
@@ -186,6 +194,8 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
 }
 
 void SettingsManager::setFromConfigurationFile(std::string const& configFilename) {
+    // The configuration file might refer to options of any module.
+    materializeAllModules();
     std::map<std::string, std::vector<std::string>> configurationFileSettings = parseConfigFile(configFilename);
 
     for (auto const& optionArgumentsPair : configurationFileSettings) {
@@ -214,6 +224,8 @@ void SettingsManager::setFromConfigurationFile(std::string const& configFilename
 }
 
 void SettingsManager::printHelp(std::string const& filter) const {
+    // Constructing the remaining modules does not change any setting, so it is fine to do so when printing all options.
+    const_cast<SettingsManager*>(this)->materializeAllModules();
     STORM_PRINT("usage: " << executableName << " [options]\n\n");
 
     if (filter == "frequent" || filter == "all") {
@@ -401,28 +413,58 @@ uint_fast64_t SettingsManager::getPrintLengthOfLongestOption(std::string const&
     auto moduleIterator = modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Unable to retrieve option length of unknown module '" << moduleName << "'.");
-    return moduleIterator->second->getPrintLengthOfLongestOption(includeAdvanced);
+    return getModule(moduleName).getPrintLengthOfLongestOption(includeAdvanced);
 }
 
-void SettingsManager::addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
-    auto moduleIterator = this->modules.find(moduleSettings->getModuleName());
-    STORM_LOG_THROW(moduleIterator == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Unable to register module '" << moduleSettings->getModuleName() << "' because a module with the same name already exists.");
+SettingsManager::ModuleEntry::ModuleEntry(std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister)
+    : factory(factory), doRegister(doRegister), materialized(false) {
+    // Intentionally left empty.
+}
 
-    // Take over the module settings object.
+void SettingsManager::addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
+    // Take over the module settings object, which is handed out by the factory when materializing the module right away.
     std::string moduleName = moduleSettings->getModuleName();
+    auto settings = std::make_shared<std::unique_ptr<modules::ModuleSettings>>(std::move(moduleSettings));
+    addLazyModule(moduleName, [settings]() { return std::move(*settings); }, doRegister);
+    materializeModule(this->modules.at(moduleName), false);
+}
+
+void SettingsManager::addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory,
+                                    bool doRegister) {
+    auto moduleIterator = this->modules.find(moduleName);
+    STORM_LOG_THROW(moduleIterator == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
+                    "Unable to register module '" << moduleName << "' because a module with the same name already exists.");
     this->moduleNames.push_back(moduleName);
-    this->modules.emplace(moduleSettings->getModuleName(), std::move(moduleSettings));
-    auto iterator = this->modules.find(moduleName);
-    std::unique_ptr<modules::ModuleSettings> const& settings = iterator->second;
-
-    if (doRegister) {
-        this->moduleOptions.emplace(moduleName, std::vector<std::shared_ptr<Option>>());
-        // Now register the options of the module.
-        for (auto const& option : settings->getOptions()) {
-            this->addOption(option);
+    this->modules.emplace(std::piecewise_construct, std::forward_as_tuple(moduleName), std::forward_as_tuple(factory, doRegister));
+}
+
+modules::ModuleSettings& SettingsManager::materializeModule(ModuleEntry& entry, bool finalize) {
+    if (!entry.materialized.load(std::memory_order_acquire)) {
+        std::lock_guard<std::recursive_mutex> lock(materializationMutex);
+        if (!entry.materialized.load(std::memory_order_relaxed)) {
+            entry.settings = entry.factory();
+            entry.factory = nullptr;
+            if (entry.doRegister) {
+                this->moduleOptions.emplace(entry.settings->getModuleName(), std::vector<std::shared_ptr<Option>>());
+                // Now register the options of the module.
+                for (auto const& option : entry.settings->getOptions()) {
+                    this->addOption(option);
+                }
+            }
+            entry.materialized.store(true, std::memory_order_release);
+            if (finalize) {
+                entry.settings->finalize();
+                entry.settings->check();
+            }
         }
     }
+    return *entry.settings;
+}
+
+void SettingsManager::materializeAllModules() {
+    for (auto const& moduleName : this->moduleNames) {
+        materializeModule(this->modules.at(moduleName), false);
+    }
 }
 
 void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
@@ -457,25 +499,24 @@ void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
 }
 
 bool SettingsManager::hasModule(std::string const& moduleName, bool checkHidden) const {
-    if (checkHidden) {
-        return this->moduleOptions.find(moduleName) != this->moduleOptions.end();
-    } else {
-        return this->modules.find(moduleName) != this->modules.end();
+    auto moduleIterator = this->modules.find(moduleName);
+    if (moduleIterator == this->modules.end()) {
+        return false;
     }
+    // Hidden modules do not register their options.
+    return !checkHidden || moduleIterator->second.doRegister;
 }
 
 modules::ModuleSettings const& SettingsManager::getModule(std::string const& moduleName) const {
-    auto moduleIterator = this->modules.find(moduleName);
-    STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    // Constructing a module on demand does not change any setting, so it is fine to do so when retrieving the module.
+    return const_cast<SettingsManager*>(this)->getModule(moduleName);
 }
 
 modules::ModuleSettings& SettingsManager::getModule(std::string const& moduleName) {
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    return materializeModule(moduleIterator->second, true);
 }
 
 bool SettingsManager::isCompatible(std::shared_ptr<Option> const& option, std::string const& optionName,
@@ -546,8 +587,11 @@ void SettingsManager::addOptionToMap(std::string const& name, std::shared_ptr<Op
 
 void SettingsManager::finalizeAllModules() {
     for (auto const& nameModulePair : this->modules) {
-        nameModulePair.second->finalize();
-        nameModulePair.second->check();
+        // Modules that are constructed later are finalized upon construction.
+        if (nameModulePair.second.materialized) {
+            nameModulePair.second.settings->finalize();
+            nameModulePair.second.settings->check();
+        }
     }
 }
 
@@ -701,6 +745,7 @@ void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
     storm::settings::addModule<storm::settings::modules::Smt2SmtSolverSettings>();
     storm::settings::addModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addModule<storm::settings::modules::SmcSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
     storm::settings::addModule<storm::settings::modules::AbstractionSettings>();
     storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
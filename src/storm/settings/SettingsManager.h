@@ -1,10 +1,12 @@
 #ifndef STORM_SETTINGS_SETTINGSMANAGER_H_
 #define STORM_SETTINGS_SETTINGSMANAGER_H_
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -109,6 +111,16 @@ class SettingsManager {
      */
     void addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister = true);
 
+    /*!
+     * Adds a new module with the given name that is only constructed once it is needed, i.e., when it is retrieved or when the command line (or a
+     * configuration file) refers to an option that is not known otherwise. Deferring the construction of modules that are never used speeds up the
+     * startup. If the module could not be successfully added, an exception is thrown.
+     *
+     * @param moduleName The name of the module to add.
+     * @param factory A function that creates the settings of the module.
+     */
+    void addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister = true);
+
     /*!
      * Checks whether the module with the given name exists.
      *
@@ -161,9 +173,24 @@ class SettingsManager {
     std::string name;
     std::string executableName;
 
+    // A registered module, which is constructed on demand.
+    struct ModuleEntry {
+        ModuleEntry(std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister);
+
+        std::function<std::unique_ptr<modules::ModuleSettings>()> factory;
+        bool doRegister;
+        std::unique_ptr<modules::ModuleSettings> settings;
+        // Set once the settings are constructed and their options are known to the manager.
+        std::atomic<bool> materialized;
+    };
+
     // The registered modules.
     std::vector<std::string> moduleNames;
-    std::unordered_map<std::string, std::unique_ptr<modules::ModuleSettings>> modules;
+    std::unordered_map<std::string, ModuleEntry> modules;
+
+    // Guards the construction of modules, which might be triggered concurrently by retrieving them. Recursive, as constructing a module might retrieve
+    // other modules.
+    std::recursive_mutex materializationMutex;
 
     // Mappings from all known option names to the options that match it. All options for one option name need
     // to be compatible in the sense that calling isCompatible(...) pairwise on all options must always return true.
@@ -225,6 +252,20 @@ class SettingsManager {
      */
     void finalizeAllModules();
 
+    /*!
+     * Constructs the settings of the given module (if not done before) and registers its options.
+     *
+     * @param finalize If set, a newly constructed module is finalized and checked right away. This is not necessary while parsing options, which
+     * finalizes all modules in the end.
+     * @return The settings of the module.
+     */
+    modules::ModuleSettings& materializeModule(ModuleEntry& entry, bool finalize);
+
+    /*!
+     * Constructs the settings of all registered modules, e.g., to know all options.
+     */
+    void materializeAllModules();
+
     /*!
      * Retrieves the (print) length of the longest option of all modules.
      *
@@ -271,7 +312,9 @@ SettingsManager& mutableManager();
 template<typename SettingsType>
 void addModule(bool doRegister = true) {
     static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
-    mutableManager().addModule(std::unique_ptr<modules::ModuleSettings>(new SettingsType()), doRegister);
+    // The module is only constructed once it is needed.
+    mutableManager().addLazyModule(
+        SettingsType::moduleName, []() { return std::unique_ptr<modules::ModuleSettings>(new SettingsType()); }, doRegister);
 }
 
 /*!
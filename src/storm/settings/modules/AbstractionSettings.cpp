@@ -34,6 +34,7 @@ const std::string AbstractionSettings::injectRefinementPredicatesOptionName = "i
 const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
 const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
 const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+const std::string AbstractionSettings::refinementStepsOptionName = "refsteps";
 
 AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -53,6 +54,16 @@ AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementStepsOptionName, false,
+                                                   "The number of partition refinement steps that bisimulation-based abstraction refinement performs "
+                                                   "before solving the next (partial) quotient.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of refinement steps.")
+                                         .setDefaultValueUnsignedInteger(10)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+
     std::vector<std::string> onOff = {"on", "off"};
 
     this->addOption(storm::settings::OptionBuilder(moduleName, useDecompositionOptionName, true, "Sets whether to apply decomposition during the abstraction.")
@@ -312,6 +323,10 @@ uint_fast64_t AbstractionSettings::getMaximalAbstractionCount() const {
     return this->getOption(maximalAbstractionOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
 }
 
+uint_fast64_t AbstractionSettings::getNumberOfRefinementSteps() const {
+    return this->getOption(refinementStepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool AbstractionSettings::isRankRefinementPredicatesSet() const {
     return this->getOption(rankRefinementPredicatesOptionName).getArgumentByName("value").getValueAsString() == "on";
 }
@@ -127,6 +127,14 @@ class AbstractionSettings : public ModuleSettings {
      */
     uint_fast64_t getMaximalAbstractionCount() const;
 
+    /*!
+     * Retrieves the number of partition refinement steps that the bisimulation-based abstraction refinement performs
+     * between two (partial) quotients that are solved.
+     *
+     * @return The number of refinement steps.
+     */
+    uint_fast64_t getNumberOfRefinementSteps() const;
+
     /*
      * Determines whether refinement predicates are to be ranked.
      *
@@ -207,6 +215,7 @@ class AbstractionSettings : public ModuleSettings {
     const static std::string fixPlayer1StrategyOptionName;
     const static std::string fixPlayer2StrategyOptionName;
     const static std::string validBlockModeOptionName;
+    const static std::string refinementStepsOptionName;
 };
 
 }  // namespace modules
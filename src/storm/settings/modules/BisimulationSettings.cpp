@@ -17,11 +17,14 @@ const std::string BisimulationSettings::typeOptionName = "type";
 const std::string BisimulationSettings::representativeOptionName = "repr";
 const std::string BisimulationSettings::originalVariablesOptionName = "origvars";
 const std::string BisimulationSettings::quotientFormatOptionName = "quot";
+const std::string BisimulationSettings::parallelQuotientExtractionOptionName = "parquot";
 const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::sparseRefinementMethodOptionName = "sparserefine";
+const std::string BisimulationSettings::automaticOptionName = "auto";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -51,6 +54,10 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the original variables in the quotient rather than the block variables.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelQuotientExtractionOptionName, false,
+                                                   "Sets whether the sparse quotient of dd-based bisimulation is extracted in parallel (requires Intel TBB).")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exactArithmeticDdOptionName, false, "Sets whether to use exact arithmetic in dd-based bisimulation.")
             .setIsAdvanced()
@@ -91,6 +98,30 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementMethods = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementMethodOptionName, true,
+                                                   "Sets which refinement method to use in sparse bisimulation. 'signature' refines all blocks at once and "
+                                                   "computes the signatures in parallel if Intel TBB is enabled (only applies to strong bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementMethods))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, automaticOptionName, false,
+                                                   "Decides automatically whether sparse bisimulation minimization is applied and whether it is strong or "
+                                                   "weak. The decision is based on a cheap estimate of the quotient size and the refinement is aborted once "
+                                                   "the quotient is known to be too large.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument(
+                                         "ratio", "The maximal ratio of quotient states to model states for which minimizing is considered worthwhile.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0))
+                                         .setDefaultValueDouble(0.8)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -129,6 +160,10 @@ bool BisimulationSettings::isUseOriginalVariablesSet() const {
     return this->getOption(originalVariablesOptionName).getHasOptionBeenSet();
 }
 
+bool BisimulationSettings::isParallelQuotientExtractionSet() const {
+    return this->getOption(parallelQuotientExtractionOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::useExactArithmeticInDdBisimulation() const {
     return this->getOption(exactArithmeticDdOptionName).getHasOptionBeenSet();
 }
@@ -173,7 +208,27 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+storm::storage::BisimulationRefinementMethod BisimulationSettings::getSparseRefinementMethod() const {
+    std::string methodAsString = this->getOption(sparseRefinementMethodOptionName).getArgumentByName("method").getValueAsString();
+    if (methodAsString == "splitter") {
+        return storm::storage::BisimulationRefinementMethod::Splitter;
+    } else if (methodAsString == "signature") {
+        return storm::storage::BisimulationRefinementMethod::Signature;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unknown sparse refinement method '" << methodAsString << "'.");
+}
+
+bool BisimulationSettings::isAutomaticSet() const {
+    return this->getOption(automaticOptionName).getHasOptionBeenSet();
+}
+
+double BisimulationSettings::getAutomaticQuotientRatio() const {
+    return this->getOption(automaticOptionName).getArgumentByName("ratio").getValueAsDouble();
+}
+
 bool BisimulationSettings::check() const {
+    STORM_LOG_WARN_COND(!isAutomaticSet() || !storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet(),
+                        "Bisimulation minimization is selected explicitly, so the automatic decision is skipped.");
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
                         "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
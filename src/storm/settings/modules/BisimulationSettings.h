@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/storage/dd/bisimulation/QuotientFormat.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
 
 namespace storm {
@@ -69,6 +70,12 @@ class BisimulationSettings : public ModuleSettings {
      */
     bool isUseOriginalVariablesSet() const;
 
+    /*!
+     * Retrieves whether the sparse quotient is to be extracted in parallel.
+     * NOTE: only applies to DD-based bisimulation.
+     */
+    bool isParallelQuotientExtractionSet() const;
+
     /*!
      * Retrieves whether exact arithmetic is to be used in symbolic bisimulation minimization.
      *
@@ -96,6 +103,22 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the method that is used to refine the partition in sparse bisimulation minimization.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    storm::storage::BisimulationRefinementMethod getSparseRefinementMethod() const;
+
+    /*!
+     * Retrieves whether it is decided automatically whether (and which) sparse bisimulation minimization is applied.
+     */
+    bool isAutomaticSet() const;
+
+    /*!
+     * Retrieves the maximal ratio of quotient states to model states for which the automatically applied bisimulation minimization is considered worthwhile.
+     */
+    double getAutomaticQuotientRatio() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -107,12 +130,15 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string representativeOptionName;
     static const std::string originalVariablesOptionName;
     static const std::string quotientFormatOptionName;
+    static const std::string parallelQuotientExtractionOptionName;
     static const std::string signatureModeOptionName;
     static const std::string reuseOptionName;
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string sparseRefinementMethodOptionName;
+    static const std::string automaticOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -20,6 +20,7 @@ const std::string BuildSettings::moduleName = "build";
 
 const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
+const std::string symbolicReachabilityOptionName = "ddreach";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
 const std::string prismCompatibilityOptionName = "prismcompat";
@@ -40,6 +41,18 @@ const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
 const std::string explorationStateLimitOptionName = "state-limit";
+const std::string explorationMemoryLimitOptionName = "memory-limit";
+const std::string ddVariableOrderingOptionName = "ddvarorder";
+const std::string ddVariableOrderImportOptionName = "ddvarorder-import";
+const std::string ddVariableOrderExportOptionName = "ddvarorder-export";
+const std::string ddSpillDirectoryOptionName = "ddspill";
+const std::string compileGuardsOptionName = "compile-guards";
+const std::string compressStatesOptionName = "compress-states";
+const std::string streamBuildOptionName = "stream-build";
+const std::string partialOrderReductionOptionName = "por";
+const std::string symmetryReductionOptionName = "symmetry-reduction";
+const std::string bytecodeExpressionsOptionName = "bytecode-expressions";
+const std::string coneOfInfluenceOptionName = "cone-of-influence";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -72,7 +85,7 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, buildAllLabelsOptionName, false, "If set, build all labels").setIsAdvanced().build());
     this->addOption(storm::settings::OptionBuilder(moduleName, noBuildOptionName, false, "If set, do not build the model.").setIsAdvanced().build());
 
-    std::vector<std::string> explorationOrders = {"dfs", "bfs"};
+    std::vector<std::string> explorationOrders = {"dfs", "bfs", "probmass"};
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.")
                         .setShortName(explorationOrderOptionShortName)
                         .setIsAdvanced()
@@ -81,6 +94,18 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    std::vector<std::string> symbolicReachabilityStrategies = {"bfs", "chaining", "saturation"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, symbolicReachabilityOptionName, false,
+                                                   "Sets how the reachable states are computed when building a symbolic (dd) model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the strategy. 'bfs' applies the monolithic transition relation, 'chaining' and 'saturation' apply the "
+                                         "transitions of the individual modules (or automata) one after another.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(symbolicReachabilityStrategies))
+                                         .setDefaultValueString("bfs")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
@@ -122,6 +147,91 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "states to explore before stopping.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationMemoryLimitOptionName, false,
+                                                   "Stops exploration once the memory usage exceeds the given limit. Unexplored states are made absorbing and "
+                                                   "labeled with 'unexplored'.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in MB.").build())
+                        .build());
+
+    std::vector<std::string> ddVariableOrderingHeuristics = {"declaration", "force"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false,
+                                                   "Sets the heuristic for the order of the state variables when building a symbolic (dd) model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name", "The name of the heuristic. 'force' places variables that are used together close to each other.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderingHeuristics))
+                                         .setDefaultValueString("declaration")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderImportOptionName, false,
+                                                   "Reads the order of the state variables of symbolic (dd) models from the given file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderExportOptionName, false,
+                                                   "Writes the order of the state variables of the built symbolic (dd) model to the given file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddSpillDirectoryOptionName, false,
+                                                   "While building symbolic (dd) models, temporarily stores the DDs that are not needed for the reachability "
+                                                   "analysis in the given directory to reduce the peak memory consumption.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The name of the directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compileGuardsOptionName, false,
+                                                   "While building sparse models from PRISM programs, compiles the guards of the commands to native code instead "
+                                                   "of interpreting them. Requires a C++ compiler at runtime.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "cachedir", "The directory in which compiled guards are cached. If empty, the cache directory of the user is used.")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("compiler", "The command that invokes the C++ compiler.")
+                                         .setDefaultValueString("c++")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compressStatesOptionName, false,
+                                                   "While building sparse models, stores the explored states tree-compressed. This reduces the memory "
+                                                   "consumption for models with many state variables at the cost of a slower exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, streamBuildOptionName, false,
+                                                   "Builds sparse models from symbolic descriptions by streaming them into the given file in the drb format (which is "
+                                                   "loaded afterwards) instead of building them in memory. Requires breadth-first exploration.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the drb file.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "tmpdir", "The directory for temporary files. If empty, the directory of the drb file is used.")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "Applies a partial order reduction while building sparse MDPs from PRISM programs. Only used if all properties "
+                                                   "are probabilities of LTL formulas without next and bounded until operators.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "Merges states that only differ in a permutation of the modules renamed from the same PRISM module while "
+                                                   "building sparse models. Only applied if the properties and the other modules are symmetric as well.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bytecodeExpressionsOptionName, false,
+                                                   "While building sparse models, evaluates the expressions of the model by interpreting bytecode instead of "
+                                                   "using exprtk.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, coneOfInfluenceOptionName, false,
+                                                   "If set, variables and modules of PRISM programs that can not influence the labels, reward models and "
+                                                   "expressions used by the properties are removed before building the model.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -186,10 +296,24 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
         return storm::builder::ExplorationOrder::Dfs;
     } else if (explorationOrderAsString == "bfs") {
         return storm::builder::ExplorationOrder::Bfs;
+    } else if (explorationOrderAsString == "probmass") {
+        return storm::builder::ExplorationOrder::ProbabilityMass;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+storm::builder::SymbolicReachabilityStrategy BuildSettings::getSymbolicReachabilityStrategy() const {
+    std::string strategyAsString = this->getOption(symbolicReachabilityOptionName).getArgumentByName("name").getValueAsString();
+    if (strategyAsString == "bfs") {
+        return storm::builder::SymbolicReachabilityStrategy::Bfs;
+    } else if (strategyAsString == "chaining") {
+        return storm::builder::SymbolicReachabilityStrategy::Chaining;
+    } else if (strategyAsString == "saturation") {
+        return storm::builder::SymbolicReachabilityStrategy::Saturation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown symbolic reachability strategy '" << strategyAsString << "'.");
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
@@ -222,6 +346,92 @@ uint64_t BuildSettings::getExplorationStateLimit() const {
     return this->getOption(explorationStateLimitOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+bool BuildSettings::isExplorationMemoryLimitSet() const {
+    return this->getOption(explorationMemoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BuildSettings::getExplorationMemoryLimit() const {
+    return this->getOption(explorationMemoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
+storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+    std::string heuristicAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+    if (heuristicAsString == "declaration") {
+        return storm::builder::DdVariableOrderingHeuristic::Declaration;
+    } else if (heuristicAsString == "force") {
+        return storm::builder::DdVariableOrderingHeuristic::Force;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown variable ordering heuristic '" << heuristicAsString << "'.");
+}
+
+bool BuildSettings::isDdVariableOrderImportSet() const {
+    return this->getOption(ddVariableOrderImportOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getDdVariableOrderImportFilename() const {
+    return this->getOption(ddVariableOrderImportOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool BuildSettings::isDdVariableOrderExportSet() const {
+    return this->getOption(ddVariableOrderExportOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getDdVariableOrderExportFilename() const {
+    return this->getOption(ddVariableOrderExportOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool BuildSettings::isDdSpillDirectorySet() const {
+    return this->getOption(ddSpillDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getDdSpillDirectory() const {
+    return this->getOption(ddSpillDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool BuildSettings::isCompileGuardsSet() const {
+    return this->getOption(compileGuardsOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getCompiledGuardsCacheDirectory() const {
+    return this->getOption(compileGuardsOptionName).getArgumentByName("cachedir").getValueAsString();
+}
+
+std::string BuildSettings::getGuardCompiler() const {
+    return this->getOption(compileGuardsOptionName).getArgumentByName("compiler").getValueAsString();
+}
+
+bool BuildSettings::isCompressStatesSet() const {
+    return this->getOption(compressStatesOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isStreamBuildSet() const {
+    return this->getOption(streamBuildOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getStreamBuildFilename() const {
+    return this->getOption(streamBuildOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+std::string BuildSettings::getStreamBuildTemporaryDirectory() const {
+    return this->getOption(streamBuildOptionName).getArgumentByName("tmpdir").getValueAsString();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isBytecodeExpressionsSet() const {
+    return this->getOption(bytecodeExpressionsOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isConeOfInfluenceSet() const {
+    return this->getOption(coneOfInfluenceOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 
 }  // namespace settings
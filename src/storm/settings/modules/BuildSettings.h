@@ -1,7 +1,9 @@
 #pragma once
 
 #include "storm-config.h"
+#include "storm/builder/DdVariableOrderingHeuristic.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
 namespace storm {
@@ -35,6 +37,13 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the strategy that is used to compute the reachable states of symbolic (dd) models.
+     *
+     * @return The chosen strategy.
+     */
+    storm::builder::SymbolicReachabilityStrategy getSymbolicReachabilityStrategy() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
@@ -149,6 +158,106 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getExplorationStateLimit() const;
 
+    /*!
+     * Retrieves whether an exploration memory limit has been set in which case state space exploration is stopped once the memory usage exceeds it.
+     */
+    bool isExplorationMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the exploration memory limit in MB (if set).
+     */
+    uint64_t getExplorationMemoryLimit() const;
+
+    /*!
+     * Retrieves the heuristic for the order of the state variables of symbolic (dd) models.
+     */
+    storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
+
+    /*!
+     * Retrieves whether the order of the state variables of symbolic (dd) models is to be read from a file.
+     */
+    bool isDdVariableOrderImportSet() const;
+
+    /*!
+     * Retrieves the name of the file from which the order of the state variables is read.
+     */
+    std::string getDdVariableOrderImportFilename() const;
+
+    /*!
+     * Retrieves whether the order of the state variables of the built symbolic (dd) model is to be written to a file.
+     */
+    bool isDdVariableOrderExportSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the order of the state variables is written.
+     */
+    std::string getDdVariableOrderExportFilename() const;
+
+    /*!
+     * Retrieves whether DDs that are temporarily not needed while building symbolic (dd) models are to be stored on disk.
+     */
+    bool isDdSpillDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which DDs that are temporarily not needed are stored.
+     */
+    std::string getDdSpillDirectory() const;
+
+    /*!
+     * Retrieves whether the guards of PRISM commands are to be compiled to native code.
+     */
+    bool isCompileGuardsSet() const;
+
+    /*!
+     * Retrieves the directory in which compiled guards are cached. An empty string refers to the cache directory of the user.
+     */
+    std::string getCompiledGuardsCacheDirectory() const;
+
+    /*!
+     * Retrieves the command that invokes the C++ compiler used for compiling guards.
+     */
+    std::string getGuardCompiler() const;
+
+    /*!
+     * Retrieves whether the explored states are to be stored tree-compressed while building sparse models.
+     */
+    bool isCompressStatesSet() const;
+
+    /*!
+     * Retrieves whether sparse models are to be streamed into a drb file instead of being built in memory.
+     */
+    bool isStreamBuildSet() const;
+
+    /*!
+     * Retrieves the name of the drb file into which sparse models are streamed.
+     */
+    std::string getStreamBuildFilename() const;
+
+    /*!
+     * Retrieves the directory for the temporary files of the streaming model construction (empty for the directory of the drb file).
+     */
+    std::string getStreamBuildTemporaryDirectory() const;
+
+    /*!
+     * Retrieves whether a partial order reduction is to be applied while building sparse models.
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves whether symmetric PRISM modules are to be exploited while building sparse models.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether expressions are to be evaluated by interpreting bytecode while building sparse models.
+     */
+    bool isBytecodeExpressionsSet() const;
+
+    /*!
+     * Retrieves whether PRISM programs are to be restricted to the cone of influence of the properties before building the model.
+     */
+    bool isConeOfInfluenceSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
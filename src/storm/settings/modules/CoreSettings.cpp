@@ -30,6 +30,7 @@ const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::numaOptionName = "numa";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -86,6 +87,10 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, numaOptionName, true,
+                                                   "Sets whether parallel solvers pin their threads and place their data on the NUMA node of the thread that "
+                                                   "processes it (requires Intel TBB and Linux).")
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -164,6 +169,10 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isNumaSet() const {
+    return this->getOption(numaOptionName).getHasOptionBeenSet();
+}
+
 storm::utility::Engine CoreSettings::getEngine() const {
     return engine;
 }
@@ -181,9 +190,11 @@ void CoreSettings::finalize() {
 
 bool CoreSettings::check() const {
 #ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!isNumaSet() || isUseIntelTbbSet(), "NUMA-aware placement only affects parallel solvers, which require TBB to be enabled.");
     return true;
 #else
     STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+    STORM_LOG_WARN_COND(!isNumaSet(), "NUMA-aware placement is not supported in this version of Storm as it was not built with support for TBB.");
     return true;
 #endif
 }
@@ -102,6 +102,13 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves whether the option to place data and pin threads for NUMA systems is set.
+     *
+     * @return True iff the option was set.
+     */
+    bool isNumaSet() const;
+
     /*!
      * Retrieves the selected engine.
      *
@@ -134,6 +141,7 @@ class CoreSettings : public ModuleSettings {
     static const std::string ddLibraryOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
+    static const std::string numaOptionName;
 };
 
 }  // namespace modules
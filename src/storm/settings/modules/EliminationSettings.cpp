@@ -18,9 +18,10 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::conditionalIterativeThresholdOptionName = "conditional-iterative-threshold";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "amd", "nd"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -54,6 +55,14 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, conditionalIterativeThresholdOptionName, true,
+                                                   "Sets the number of states above which conditional probabilities are computed iteratively on a product "
+                                                   "model instead of with state elimination.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states.")
+                                         .setDefaultValueUnsignedInteger(10000)
+                                         .build())
+                        .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -85,6 +94,10 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::DynamicPenalty;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
+    } else if (eliminationOrderAsString == "amd") {
+        return EliminationOrder::ApproximateMinimumDegree;
+    } else if (eliminationOrderAsString == "nd") {
+        return EliminationOrder::NestedDissection;
     } else {
         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
     }
@@ -101,6 +114,10 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+uint_fast64_t EliminationSettings::getConditionalIterativeThreshold() const {
+    return this->getOption(conditionalIterativeThresholdOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -15,7 +15,18 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder {
+        Forward,
+        ForwardReversed,
+        Backward,
+        BackwardReversed,
+        Random,
+        StaticPenalty,
+        DynamicPenalty,
+        RegularExpression,
+        ApproximateMinimumDegree,
+        NestedDissection
+    };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -62,6 +73,14 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the number of states above which conditional probabilities are computed with iterative solvers on a product model instead of state
+     * elimination.
+     *
+     * @return The threshold.
+     */
+    uint_fast64_t getConditionalIterativeThreshold() const;
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +89,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string conditionalIterativeThresholdOptionName;
 };
 
 }  // namespace modules
@@ -21,6 +21,7 @@ const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOp
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
+const std::string ExplorationSettings::threadsOptionName = "threads";
 
 ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"local", "global"};
@@ -67,6 +68,13 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that concurrently sample paths.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available cores is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -121,11 +129,15 @@ double ExplorationSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint64_t ExplorationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool ExplorationSettings::check() const {
     bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() || this->getOption(threadsOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Exploration || !optionsSet,
                         "Exploration engine is not selected, so setting options for it has no effect.");
     return true;
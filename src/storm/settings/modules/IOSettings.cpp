@@ -27,10 +27,17 @@ const std::string IOSettings::exportCdfOptionName = "exportcdf";
 const std::string IOSettings::exportCdfOptionShortName = "cdf";
 const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
 const std::string IOSettings::exportCheckResultOptionName = "exportresult";
+const std::string IOSettings::exportCheckResultLabelOptionName = "exportresultlabel";
+const std::string IOSettings::exportCheckResultTopKOptionName = "exportresulttopk";
+const std::string IOSettings::exportDdStatisticsOptionName = "exportddstats";
+const std::string IOSettings::exportTelemetryOptionName = "exporttelemetry";
+const std::string IOSettings::serverOptionName = "server";
 const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitDrbOptionName = "explicit-drb";
+const std::string IOSettings::explicitDrbOptionShortName = "drb";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -74,7 +81,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -107,10 +114,51 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                 storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false,
-                                                   "Exports the result to a given file (if supported by engine). The export will be in json.")
+                                                   "Exports the result to a given file (if supported by engine). The format is derived from the file "
+                                                   "extension: '.csv', '.jsonl' (one json object per line), '.srb' (binary columnar) and json otherwise.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultLabelOptionName, false,
+                                                   "Only exports the result for the states with the given label.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("label", "The state label.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultTopKOptionName, false,
+                                                   "Only exports the result for the given number of states with the largest values.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("k", "The number of states.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportDdStatisticsOptionName, false,
+                                                   "Exports statistics of the DD library after model building and model checking. The export will be in json.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
+    std::vector<std::string> telemetryFormats({"json", "chrome"});
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, exportTelemetryOptionName, false,
+                                       "Records the time, peak memory and statistics of the phases of the computation (parsing, building, preprocessing, "
+                                       "qualitative analysis, solver invocations, export) and exports them to a file.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "format", "The output format. 'json' exports nested scopes, 'chrome' exports events in the Chrome trace format.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(telemetryFormats))
+                             .setDefaultValueString("json")
+                             .makeOptional()
+                             .build())
+            .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, serverOptionName, false,
+                                       "Runs Storm as a server that keeps loaded models in memory and answers queries given as json objects (one per line), "
+                                       "either on the standard input or on a unix domain socket. Model and property inputs are ignored.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "socket", "The path of the unix domain socket. If empty, queries are read from the standard input.")
+                             .setDefaultValueString("")
+                             .makeOptional()
+                             .build())
+            .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "",
                                        "If given, the loaded model will be written to the specified file in the drn format.")
@@ -143,6 +191,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrbOptionName, false, "Parses the model given in the binary DRB format.")
+                        .setShortName(explicitDrbOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drb filename", "The name of the DRB file containing the model.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -219,7 +273,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
-    std::vector<std::string> steadyStateDistrAlgorithms({"auto", "eqsys", "evt", "classic"});
+    std::vector<std::string> steadyStateDistrAlgorithms({"auto", "eqsys", "evt", "classic", "iad"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, steadyStateDistrOptionName, false,
                                        "Computes the steady state distribution. Result can be exported using --" + exportCheckResultOptionName + ".")
@@ -351,6 +405,50 @@ std::string IOSettings::getExportCheckResultFilename() const {
     return this->getOption(exportCheckResultOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool IOSettings::isExportCheckResultLabelSet() const {
+    return this->getOption(exportCheckResultLabelOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportCheckResultLabel() const {
+    return this->getOption(exportCheckResultLabelOptionName).getArgumentByName("label").getValueAsString();
+}
+
+bool IOSettings::isExportCheckResultTopKSet() const {
+    return this->getOption(exportCheckResultTopKOptionName).getHasOptionBeenSet();
+}
+
+uint64_t IOSettings::getExportCheckResultTopK() const {
+    return this->getOption(exportCheckResultTopKOptionName).getArgumentByName("k").getValueAsUnsignedInteger();
+}
+
+bool IOSettings::isExportDdStatisticsSet() const {
+    return this->getOption(exportDdStatisticsOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportDdStatisticsFilename() const {
+    return this->getOption(exportDdStatisticsOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool IOSettings::isExportTelemetrySet() const {
+    return this->getOption(exportTelemetryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportTelemetryFilename() const {
+    return this->getOption(exportTelemetryOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+std::string IOSettings::getExportTelemetryFormat() const {
+    return this->getOption(exportTelemetryOptionName).getArgumentByName("format").getValueAsString();
+}
+
+bool IOSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getServerSocket() const {
+    return this->getOption(serverOptionName).getArgumentByName("socket").getValueAsString();
+}
+
 bool IOSettings::isExplicitSet() const {
     return this->getOption(explicitOptionName).getHasOptionBeenSet();
 }
@@ -371,6 +469,14 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitDRBSet() const {
+    return this->getOption(explicitDrbOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitDRBFilename() const {
+    return this->getOption(explicitDrbOptionName).getArgumentByName("drb filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -472,6 +578,8 @@ storm::SteadyStateDistributionAlgorithm IOSettings::getSteadyStateDistributionAl
         return storm::SteadyStateDistributionAlgorithm::EquationSystem;
     } else if (alg == "classic") {
         return storm::SteadyStateDistributionAlgorithm::Classic;
+    } else if (alg == "iad") {
+        return storm::SteadyStateDistributionAlgorithm::AggregationDisaggregation;
     } else {
         STORM_LOG_ASSERT(alg == "evt", "Unexpected algorithm type.");
         return storm::SteadyStateDistributionAlgorithm::ExpectedVisitingTimes;
@@ -541,6 +649,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitDRBSet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -131,6 +131,61 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExportCheckResultFilename() const;
 
+    /*!
+     * Retrieves whether the check result export should be restricted to the states with a given label.
+     */
+    bool isExportCheckResultLabelSet() const;
+
+    /*!
+     * Retrieves the label of the states whose check result is exported.
+     */
+    std::string getExportCheckResultLabel() const;
+
+    /*!
+     * Retrieves whether only the states with the largest values should be exported.
+     */
+    bool isExportCheckResultTopKSet() const;
+
+    /*!
+     * Retrieves the number of states with the largest values that are exported.
+     */
+    uint64_t getExportCheckResultTopK() const;
+
+    /*!
+     * Retrieves whether the statistics of the DD library should be exported.
+     */
+    bool isExportDdStatisticsSet() const;
+
+    /*!
+     * Retrieves a filename to which the statistics of the DD library should be exported.
+     */
+    std::string getExportDdStatisticsFilename() const;
+
+    /*!
+     * Retrieves whether telemetry should be recorded and exported.
+     */
+    bool isExportTelemetrySet() const;
+
+    /*!
+     * Retrieves a filename to which the telemetry should be exported.
+     */
+    std::string getExportTelemetryFilename() const;
+
+    /*!
+     * Retrieves the format ("json" or "chrome") in which the telemetry should be exported.
+     */
+    std::string getExportTelemetryFormat() const;
+
+    /*!
+     * Retrieves whether Storm should run as a server.
+     */
+    bool isServerSet() const;
+
+    /*!
+     * Retrieves the path of the unix domain socket on which the server listens (or the empty string if queries are read from the standard input).
+     */
+    std::string getServerSocket() const;
+
     /*!
      * Retrieves whether the explicit option was set.
      *
@@ -168,6 +223,20 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves whether the explicit option with DRB was set.
+     *
+     * @return True if the explicit option with DRB was set.
+     */
+    bool isExplicitDRBSet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary DRB format.
+     *
+     * @return The name of the DRB file that contains the model.
+     */
+    std::string getExplicitDRBFilename() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -392,10 +461,17 @@ class IOSettings : public ModuleSettings {
     static const std::string exportCdfOptionShortName;
     static const std::string exportSchedulerOptionName;
     static const std::string exportCheckResultOptionName;
+    static const std::string exportCheckResultLabelOptionName;
+    static const std::string exportCheckResultTopKOptionName;
+    static const std::string exportDdStatisticsOptionName;
+    static const std::string exportTelemetryOptionName;
+    static const std::string serverOptionName;
     static const std::string explicitOptionName;
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitDrbOptionName;
+    static const std::string explicitDrbOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
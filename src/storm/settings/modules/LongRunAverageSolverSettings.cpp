@@ -19,6 +19,7 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::parallelComponentSolvingOptionName = "parallel";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
@@ -69,6 +70,12 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelComponentSolvingOptionName, false,
+                                                   "If set, the long run average values (or steady state distributions) of different end components are computed "
+                                                   "concurrently. Requires Intel TBB.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -131,6 +138,10 @@ double LongRunAverageSolverSettings::getAperiodicFactor() const {
     return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+bool LongRunAverageSolverSettings::isParallelComponentSolvingSet() const {
+    return this->getOption(parallelComponentSolvingOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -73,6 +73,11 @@ class LongRunAverageSolverSettings : public ModuleSettings {
      */
     double getAperiodicFactor() const;
 
+    /*!
+     * Retrieves whether the long run average values of different components (MECs or BSCCs) are to be computed concurrently.
+     */
+    bool isParallelComponentSolvingSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -84,6 +89,7 @@ class LongRunAverageSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string aperiodicFactorOptionName;
+    static const std::string parallelComponentSolvingOptionName;
 };
 
 }  // namespace modules
@@ -19,12 +19,14 @@ const std::string precisionOptionName = "precision";
 const std::string absoluteOptionName = "absolute";
 const std::string valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string forceUniqueSolutionRequirementOptionName = "force-require-unique";
+const std::string mixedPrecisionOptionName = "mixed-precision";
+const std::string stateOrderOptionName = "reorder";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "async-gaussseidel", "ags"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -69,6 +71,23 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "simplify solving but causes some overhead.")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, value iteration first iterates on a single precision copy of the equation system and only then "
+                                                   "refines the result in double precision. Reduces memory traffic for large systems.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, stateOrderOptionName, false,
+                                       "If set, value iteration operates on a copy of the equation system whose states are renumbered in the given order to "
+                                       "improve memory locality.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("order", "The order.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(storm::utility::permutation::orderKinds()))
+                             .setDefaultValueString(storm::utility::permutation::orderKindtoString(storm::utility::permutation::OrderKind::SccTopological))
+                             .build())
+            .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -93,6 +112,8 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "async-gaussseidel" || minMaxEquationSolvingTechnique == "ags") {
+        return storm::solver::MinMaxMethod::AsyncGaussSeidel;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -147,6 +168,17 @@ bool MinMaxEquationSolverSettings::isForceUniqueSolutionRequirementSet() const {
     return this->getOption(forceUniqueSolutionRequirementOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+std::optional<storm::utility::permutation::OrderKind> MinMaxEquationSolverSettings::getStateOrder() const {
+    if (this->getOption(stateOrderOptionName).getHasOptionBeenSet()) {
+        return storm::utility::permutation::orderKindFromString(this->getOption(stateOrderOptionName).getArgumentByName("order").getValueAsString());
+    }
+    return std::nullopt;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <optional>
+
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
 namespace settings {
@@ -95,6 +98,16 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceUniqueSolutionRequirementSet() const;
 
+    /*!
+     * @return if value iteration should first iterate in single precision before refining the result in double precision.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * @return the order in which the states of the equation system should be renumbered for value iteration (if any).
+     */
+    std::optional<storm::utility::permutation::OrderKind> getStateOrder() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -1,5 +1,9 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 
+#include <algorithm>
+
+#include <boost/algorithm/string.hpp>
+
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
@@ -7,6 +11,10 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
 namespace storm {
 namespace settings {
 namespace modules {
@@ -14,6 +22,17 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheOptionName = "ltl2dacache";
+const std::string ModelCheckerSettings::ltlThreadsOptionName = "ltlthreads";
+const std::string ModelCheckerSettings::timeBoundsOptionName = "timebounds";
+const std::string ModelCheckerSettings::analysisCacheOptionName = "analysiscache";
+const std::string ModelCheckerSettings::batchReachabilityOptionName = "batchreach";
+const std::string ModelCheckerSettings::warmStartOptionName = "warmstart";
+const std::string ModelCheckerSettings::epochThreadsOptionName = "epochthreads";
+const std::string ModelCheckerSettings::epochSinglePrecisionOptionName = "epochsingleprecision";
+const std::string ModelCheckerSettings::epochSpillOptionName = "epochspill";
+const std::string ModelCheckerSettings::parallelPropertiesOptionName = "parallel-properties";
+const std::string ModelCheckerSettings::outOfCoreOptionName = "out-of-core";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +46,86 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheOptionName, false,
+                                                   "If set, deterministic automata for LTL formulas are stored in the given directory and reused "
+                                                   "when translating the same formula in a later run.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory in which the automata are stored.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltlThreadsOptionName, false,
+                                                   "Sets the number of threads used to search for accepting end components of the disjuncts of an "
+                                                   "acceptance condition (or to analyze the end components for lexicographic objectives) concurrently "
+                                                   "during LTL model checking.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundsOptionName, false,
+                                                   "If set, time-bounded reachability properties on CTMCs (and step-bounded reachability properties on "
+                                                   "DTMCs and MDPs) are checked for all given bounds at once (replacing the bound of the property).")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "values", "A comma separated list of time bounds in ascending order, e.g. 0.5,1,2.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analysisCacheOptionName, false,
+                                                   "If set, results of previously checked (unbounded) reachability probabilities are cached and reused "
+                                                   "for subsequent properties with the same target states.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchReachabilityOptionName, false,
+                                                   "If set, reachability probabilities P=? [phi U psi] with propositional subformulas that agree on phi (and "
+                                                   "on the optimization direction) are computed together for DTMCs and MDPs in the sparse engine.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, warmStartOptionName, false,
+                                                   "If set, solution vectors (and schedulers) are stored in the given directory and reused as hints "
+                                                   "(e.g. initial values) when checking the same property in a later run.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory in which the solutions are stored.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false,
+                                                   "Sets the number of threads used to analyze independent epochs of reward-bounded properties concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochSinglePrecisionOptionName, false,
+                                                   "If set, the solutions of epochs of reward-bounded properties are stored in single precision while "
+                                                   "they are still needed. This halves the memory consumption but introduces rounding errors.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochSpillOptionName, false,
+                                                   "If set, the solutions of epochs of reward-bounded properties are written to the given directory "
+                                                   "once the solutions kept in memory exceed the given limit.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory in which the solutions are stored.")
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("limit", "The memory limit in MB.")
+                                         .setDefaultValueUnsignedInteger(1024)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelPropertiesOptionName, false,
+                                                   "Sets the number of properties that are checked concurrently on the same model (sparse engine only). "
+                                                   "The threads available to the process are shared between the properties.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of properties.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, outOfCoreOptionName, false,
+                                                   "If set, models given in the drb format are not loaded into memory. Instead, unbounded reachability "
+                                                   "probabilities (DTMCs and MDPs) and expected rewards (DTMCs) are computed by value iteration directly on "
+                                                   "the mapped file.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +140,84 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtl2daCacheSet() const {
+    return this->getOption(ltl2daCacheOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t ModelCheckerSettings::getLtlThreads() const {
+    return this->getOption(ltlThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isTimeBoundsSet() const {
+    return this->getOption(timeBoundsOptionName).getHasOptionBeenSet();
+}
+
+std::vector<double> ModelCheckerSettings::getTimeBounds() const {
+    std::vector<std::string> timeBoundStrings;
+    std::string const timeBoundsString = this->getOption(timeBoundsOptionName).getArgumentByName("values").getValueAsString();
+    boost::split(timeBoundStrings, timeBoundsString, boost::is_any_of(","));
+    std::vector<double> result;
+    for (auto const& timeBoundString : timeBoundStrings) {
+        std::string const trimmedTimeBoundString = boost::trim_copy(timeBoundString);
+        if (!trimmedTimeBoundString.empty()) {
+            result.push_back(storm::utility::convertNumber<double>(trimmedTimeBoundString));
+            STORM_LOG_THROW(result.back() >= 0.0, storm::exceptions::InvalidSettingsException,
+                            "Time bound '" << trimmedTimeBoundString << "' must be non-negative.");
+        }
+    }
+    STORM_LOG_THROW(std::is_sorted(result.begin(), result.end()), storm::exceptions::InvalidSettingsException,
+                    "The time bounds '" << timeBoundsString << "' must be given in ascending order.");
+    return result;
+}
+
+bool ModelCheckerSettings::isAnalysisCacheSet() const {
+    return this->getOption(analysisCacheOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isBatchReachabilitySet() const {
+    return this->getOption(batchReachabilityOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isWarmStartSet() const {
+    return this->getOption(warmStartOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getWarmStartDirectory() const {
+    return this->getOption(warmStartOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t ModelCheckerSettings::getEpochThreads() const {
+    return this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isEpochSinglePrecisionSet() const {
+    return this->getOption(epochSinglePrecisionOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isEpochSpillSet() const {
+    return this->getOption(epochSpillOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getEpochSpillDirectory() const {
+    return this->getOption(epochSpillOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t ModelCheckerSettings::getEpochSpillMemoryLimit() const {
+    return this->getOption(epochSpillOptionName).getArgumentByName("limit").getValueAsUnsignedInteger();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfParallelProperties() const {
+    return this->getOption(parallelPropertiesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isOutOfCoreSet() const {
+    return this->getOption(outOfCoreOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -35,6 +37,119 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether deterministic automata for LTL formulas are to be stored on disk and reused in later runs.
+     *
+     * @return True iff the option was set.
+     */
+    bool isLtl2daCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which deterministic automata for LTL formulas are stored.
+     *
+     * @return The directory.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves the number of threads used to search for accepting end components of LTL products (or to analyze the end components for
+     * lexicographic objectives) concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getLtlThreads() const;
+
+    /*!
+     * Retrieves whether time-bounded properties are to be checked for several time bounds at once.
+     *
+     * @return True iff time bounds have been set.
+     */
+    bool isTimeBoundsSet() const;
+
+    /*!
+     * Retrieves the (ascendingly sorted) time bounds that replace the time bound of time-bounded properties.
+     *
+     * @return The time bounds.
+     */
+    std::vector<double> getTimeBounds() const;
+
+    /*!
+     * Retrieves whether results of analyses on a model are to be cached and reused when checking several properties.
+     *
+     * @return True iff the option was set.
+     */
+    bool isAnalysisCacheSet() const;
+
+    /*!
+     * Retrieves whether compatible reachability properties are to be checked together.
+     *
+     * @return True iff the option was set.
+     */
+    bool isBatchReachabilitySet() const;
+
+    /*!
+     * Retrieves whether solutions are to be stored on disk and reused as hints in later runs.
+     *
+     * @return True iff the option was set.
+     */
+    bool isWarmStartSet() const;
+
+    /*!
+     * Retrieves the directory in which solutions are stored for later runs.
+     *
+     * @return The directory.
+     */
+    std::string getWarmStartDirectory() const;
+
+    /*!
+     * Retrieves the number of threads used to analyze independent epochs of reward-bounded properties concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getEpochThreads() const;
+
+    /*!
+     * Retrieves whether the solutions of epochs of reward-bounded properties are stored in single precision.
+     *
+     * @return True iff the option was set.
+     */
+    bool isEpochSinglePrecisionSet() const;
+
+    /*!
+     * Retrieves whether the solutions of epochs of reward-bounded properties are written to disk when exceeding the memory limit.
+     *
+     * @return True iff the option was set.
+     */
+    bool isEpochSpillSet() const;
+
+    /*!
+     * Retrieves the directory to which solutions of epochs are written.
+     *
+     * @return The directory.
+     */
+    std::string getEpochSpillDirectory() const;
+
+    /*!
+     * Retrieves the memory limit (in MB) for the solutions of epochs kept in memory.
+     *
+     * @return The memory limit.
+     */
+    uint64_t getEpochSpillMemoryLimit() const;
+
+    /*!
+     * Retrieves the number of properties that are checked concurrently on the same model.
+     *
+     * @return The number of properties.
+     */
+    uint64_t getNumberOfParallelProperties() const;
+
+    /*!
+     * Retrieves whether models in the drb format are checked directly on the mapped file.
+     *
+     * @return True iff the option was set.
+     */
+    bool isOutOfCoreSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +157,17 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheOptionName;
+    static const std::string ltlThreadsOptionName;
+    static const std::string timeBoundsOptionName;
+    static const std::string analysisCacheOptionName;
+    static const std::string batchReachabilityOptionName;
+    static const std::string warmStartOptionName;
+    static const std::string epochThreadsOptionName;
+    static const std::string epochSinglePrecisionOptionName;
+    static const std::string epochSpillOptionName;
+    static const std::string parallelPropertiesOptionName;
+    static const std::string outOfCoreOptionName;
 };
 
 }  // namespace modules
@@ -19,6 +19,7 @@ const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "pure
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
 const std::string MultiObjectiveSettings::lexicographicOptionName = "lex";
+const std::string MultiObjectiveSettings::refinementBatchOptionName = "refinementbatch";
 
 MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -101,6 +102,15 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, lexicographicOptionName, false,
                                                    "If set, lexicographic model checking instead of normal multi objective is performed.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, refinementBatchOptionName, false,
+                                                   "Sets the number of weight vectors that are checked concurrently in each refinement round of the pcaa "
+                                                   "method and when exploring Pareto fronts under deterministic schedulers.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of weight vectors per round.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -219,6 +229,10 @@ bool MultiObjectiveSettings::isLexicographicModelCheckingSet() const {
     return this->getOption(lexicographicOptionName).getHasOptionBeenSet();
 }
 
+uint64_t MultiObjectiveSettings::getRefinementBatchSize() const {
+    return this->getOption(refinementBatchOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool MultiObjectiveSettings::check() const {
     std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
 
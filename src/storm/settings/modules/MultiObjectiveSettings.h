@@ -121,6 +121,12 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isLexicographicModelCheckingSet() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked concurrently in each refinement round of the pcaa method and when exploring Pareto
+     * fronts under deterministic schedulers.
+     */
+    uint64_t getRefinementBatchSize() const;
+
     /*!
      * Retrieves whether redundant BSCC constraints are to be added
      */
@@ -144,6 +150,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string refinementBatchOptionName;
 };
 
 }  // namespace modules
@@ -24,11 +24,14 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::restartOptionName = "restart";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
                                         "power",  "sound-value-iteration", "svi", "optimistic-value-iteration",
-                                        "ovi",    "interval-iteration",    "ii",  "ratsearch"};
+                                        "ovi",    "interval-iteration",    "ii",  "ratsearch",
+                                        "async-gaussseidel", "ags", "bicgstab", "gmres",
+                                        "ratrecon"};
     this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true,
                                                    "The method to be used for solving linear equation systems with the native engine.")
                         .setIsAdvanced()
@@ -80,6 +83,14 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false, "The number of iterations after which GMRES is restarted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.")
+                                         .setDefaultValueUnsignedInteger(50)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -111,6 +122,14 @@ storm::solver::NativeLinearEquationSolverMethod NativeEquationSolverSettings::ge
         return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
     } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
         return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+    } else if (linearEquationSystemTechniqueAsString == "async-gaussseidel" || linearEquationSystemTechniqueAsString == "ags") {
+        return storm::solver::NativeLinearEquationSolverMethod::AsyncGaussSeidel;
+    } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+        return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
+    } else if (linearEquationSystemTechniqueAsString == "gmres") {
+        return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+    } else if (linearEquationSystemTechniqueAsString == "ratrecon") {
+        return storm::solver::NativeLinearEquationSolverMethod::RationalReconstruction;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
                     "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
@@ -159,6 +178,10 @@ bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+    return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::check() const {
     return true;
 }
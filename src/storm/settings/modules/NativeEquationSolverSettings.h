@@ -98,6 +98,13 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves the number of iterations after which GMRES is restarted.
+     *
+     * @return The number of iterations after which GMRES is restarted.
+     */
+    uint_fast64_t getRestartIterationCount() const;
+
     /*!
      * Retrieves the multiplication style to use in the power method.
      *
@@ -125,6 +132,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
+    static const std::string restartOptionName;
     static const std::string forceBoundsOptionName;
 };
 
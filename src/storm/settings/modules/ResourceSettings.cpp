@@ -2,10 +2,14 @@
 
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/macros.h"
+
 namespace storm {
 namespace settings {
 namespace modules {
@@ -16,6 +20,10 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::checkpointDirectoryOptionName = "checkpoint";
+const std::string ResourceSettings::checkpointIntervalOptionName = "checkpoint-interval";
+const std::string ResourceSettings::resumeOptionName = "resume";
+const std::string ResourceSettings::memoryLimitOptionName = "memory-limit";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +43,30 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, checkpointDirectoryOptionName, false,
+                                                   "If given, long-running equation solving periodically writes checkpoints to the given directory. A "
+                                                   "checkpoint is also written when a termination signal is received.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory for the checkpoints.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, checkpointIntervalOptionName, false, "Specifies how much time passes between two checkpoints.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "Seconds between two checkpoints.")
+                                         .setDefaultValueUnsignedInteger(600)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false,
+                                                   "If set, computations resume from the matching checkpoints in the checkpoint directory.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitOptionName, false,
+                                                   "If given, the automatic engine and the selection of solution methods prefer alternatives whose estimated "
+                                                   "memory consumption stays below the limit.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +85,36 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isCheckpointDirectorySet() const {
+    return this->getOption(checkpointDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getCheckpointDirectory() const {
+    return this->getOption(checkpointDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint_fast64_t ResourceSettings::getCheckpointIntervalInSeconds() const {
+    return this->getOption(checkpointIntervalOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isResumeSet() const {
+    return this->getOption(resumeOptionName).getHasOptionBeenSet();
+}
+
+bool ResourceSettings::isMemoryLimitSet() const {
+    return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ResourceSettings::getMemoryLimitInBytes() const {
+    return this->getOption(memoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger() << 20;
+}
+
+bool ResourceSettings::check() const {
+    STORM_LOG_THROW(!isResumeSet() || isCheckpointDirectorySet(), storm::exceptions::InvalidSettingsException,
+                    "Resuming requires a checkpoint directory (option --" << checkpointDirectoryOptionName << ").");
+    return true;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
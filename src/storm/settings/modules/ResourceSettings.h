@@ -47,6 +47,50 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether a directory for checkpoints of long-running computations was set.
+     *
+     * @return True iff the checkpoint option was set.
+     */
+    bool isCheckpointDirectorySet() const;
+
+    /*!
+     * Retrieves the directory to which checkpoints of long-running computations are written.
+     *
+     * @return The checkpoint directory.
+     */
+    std::string getCheckpointDirectory() const;
+
+    /*!
+     * Retrieves the time that has to pass between two checkpoints of the same computation.
+     *
+     * @return The number of seconds between two checkpoints.
+     */
+    uint_fast64_t getCheckpointIntervalInSeconds() const;
+
+    /*!
+     * Retrieves whether computations are to be resumed from the checkpoints in the checkpoint directory.
+     *
+     * @return True iff the resume option was set.
+     */
+    bool isResumeSet() const;
+
+    /*!
+     * Retrieves whether a memory limit was set.
+     *
+     * @return True iff the memory limit option was set.
+     */
+    bool isMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the memory limit that engine and solver selection try to respect.
+     *
+     * @return The memory limit in bytes.
+     */
+    uint64_t getMemoryLimitInBytes() const;
+
+    virtual bool check() const override;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +101,10 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string checkpointDirectoryOptionName;
+    static const std::string checkpointIntervalOptionName;
+    static const std::string resumeOptionName;
+    static const std::string memoryLimitOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -0,0 +1,119 @@
+#include "storm/settings/modules/SmcSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string SmcSettings::moduleName = "smc";
+const std::string SmcSettings::stoppingRuleOptionName = "stoppingrule";
+const std::string SmcSettings::epsilonOptionName = "epsilon";
+const std::string SmcSettings::deltaOptionName = "delta";
+const std::string SmcSettings::threadsOptionName = "threads";
+const std::string SmcSettings::maxTraceLengthOptionName = "maxlength";
+const std::string SmcSettings::seedOptionName = "seed";
+
+SmcSettings::SmcSettings() : ModuleSettings(moduleName) {
+    std::vector<std::string> stoppingRules = {"chernoff", "clopper-pearson", "sprt"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, stoppingRuleOptionName, true, "Sets the rule that decides when enough traces are sampled.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the rule. 'chernoff' samples the number of traces given by the Chernoff-Hoeffding bound, "
+                                         "'clopper-pearson' samples until the exact confidence interval is narrow enough and 'sprt' performs a sequential "
+                                         "probability ratio test for properties with a probability bound.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stoppingRules))
+                                         .setDefaultValueString("chernoff")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epsilonOptionName, true,
+                                                   "Sets the half-width of the confidence interval (and of the indifference region of the SPRT).")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, deltaOptionName, true, "Sets the admissible error probability, i.e., one minus the confidence.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .setDefaultValueDouble(0.05)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads that generate traces.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, the number of available cores is used.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maxTraceLengthOptionName, true,
+                                                   "Sets the maximal length of traces for unbounded properties. Longer traces are cut off and counted as "
+                                                   "not satisfying the property.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("length", "The maximal number of steps.")
+                                         .setDefaultValueUnsignedInteger(100000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true, "Sets the seed of the random number generators.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+}
+
+storm::modelchecker::smc::StoppingRule SmcSettings::getStoppingRule() const {
+    std::string ruleAsString = this->getOption(stoppingRuleOptionName).getArgumentByName("name").getValueAsString();
+    if (ruleAsString == "chernoff") {
+        return storm::modelchecker::smc::StoppingRule::ChernoffHoeffding;
+    } else if (ruleAsString == "clopper-pearson") {
+        return storm::modelchecker::smc::StoppingRule::ClopperPearson;
+    } else if (ruleAsString == "sprt") {
+        return storm::modelchecker::smc::StoppingRule::Sprt;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown stopping rule '" << ruleAsString << "'.");
+}
+
+double SmcSettings::getEpsilon() const {
+    return this->getOption(epsilonOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SmcSettings::getDelta() const {
+    return this->getOption(deltaOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t SmcSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t SmcSettings::getMaximalTraceLength() const {
+    return this->getOption(maxTraceLengthOptionName).getArgumentByName("length").getValueAsUnsignedInteger();
+}
+
+bool SmcSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t SmcSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+bool SmcSettings::check() const {
+    bool optionsSet = this->getOption(stoppingRuleOptionName).getHasOptionBeenSet() || this->getOption(epsilonOptionName).getHasOptionBeenSet() ||
+                      this->getOption(deltaOptionName).getHasOptionBeenSet() || this->getOption(threadsOptionName).getHasOptionBeenSet() ||
+                      this->getOption(maxTraceLengthOptionName).getHasOptionBeenSet() || this->getOption(seedOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Smc || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
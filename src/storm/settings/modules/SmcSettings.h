@@ -0,0 +1,72 @@
+#pragma once
+
+#include "storm/modelchecker/smc/StoppingRule.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class SmcSettings : public ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    SmcSettings();
+
+    /*!
+     * Retrieves the rule that decides when enough traces have been sampled.
+     */
+    storm::modelchecker::smc::StoppingRule getStoppingRule() const;
+
+    /*!
+     * Retrieves the half-width of the confidence interval (and of the indifference region of the sequential probability ratio test).
+     */
+    double getEpsilon() const;
+
+    /*!
+     * Retrieves the admissible probability of an error, i.e., one minus the confidence.
+     */
+    double getDelta() const;
+
+    /*!
+     * Retrieves the number of threads that generate traces. Zero means that the number is chosen automatically.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the maximal length of a trace for unbounded properties.
+     */
+    uint64_t getMaximalTraceLength() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators was given.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     */
+    uint64_t getSeed() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string stoppingRuleOptionName;
+    static const std::string epsilonOptionName;
+    static const std::string deltaOptionName;
+    static const std::string threadsOptionName;
+    static const std::string maxTraceLengthOptionName;
+    static const std::string seedOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -13,6 +13,7 @@ namespace modules {
 const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
 
 const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
@@ -27,6 +28,18 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                                          .build())
                         .build());
 
+    std::vector<std::string> ctmcMethods = {"unif", "adaptive", "krylov"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false,
+                                                   "The method to compute transient probabilities of CTMCs. 'unif' is standard uniformization, 'adaptive' "
+                                                   "uniformizes with the rates of the states that are already relevant and 'krylov' approximates the matrix "
+                                                   "exponential in Krylov subspaces (suited for stiff models with large time bounds).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                                         .setDefaultValueString("unif")
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
@@ -70,6 +83,16 @@ storm::solver::MaBoundedReachabilityMethod TimeBoundedSolverSettings::getMaMetho
     return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "adaptive") {
+        return storm::solver::CtmcTransientMethod::AdaptiveUniformization;
+    } else if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
 bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
     return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
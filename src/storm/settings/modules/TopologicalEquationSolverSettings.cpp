@@ -23,6 +23,8 @@ namespace modules {
 const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
+const std::string TopologicalEquationSolverSettings::parallelSccSolvingOptionName = "parallel";
+const std::string TopologicalEquationSolverSettings::adaptiveSccSolvingOptionName = "adaptive";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
@@ -36,7 +38,8 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                         .build());
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi", "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",      "ratsearch",
-        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi"};
+        "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "vi-to-pi",
+        "async-gaussseidel", "ags"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingMinMaxMethodOptionName, true,
                                                    "Sets which minmax method is considered for solving the underlying minmax equation systems.")
                         .setIsAdvanced()
@@ -45,6 +48,15 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
                                          .setDefaultValueString("value-iteration")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelSccSolvingOptionName, false,
+                                                   "If set, SCCs that do not depend on each other are solved concurrently. Requires Intel TBB.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveSccSolvingOptionName, false,
+                                                   "If set, the method for solving an SCC is chosen based on its size and density. Overrides the "
+                                                   "underlying solver and method for non-exact computations.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -97,11 +109,21 @@ storm::solver::MinMaxMethod TopologicalEquationSolverSettings::getUnderlyingMinM
         return storm::solver::MinMaxMethod::OptimisticValueIteration;
     } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
         return storm::solver::MinMaxMethod::ViToPi;
+    } else if (minMaxEquationSolvingTechnique == "async-gaussseidel" || minMaxEquationSolvingTechnique == "ags") {
+        return storm::solver::MinMaxMethod::AsyncGaussSeidel;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << minMaxEquationSolvingTechnique << "'.");
 }
 
+bool TopologicalEquationSolverSettings::isParallelSccSolvingSet() const {
+    return this->getOption(parallelSccSolvingOptionName).getHasOptionBeenSet();
+}
+
+bool TopologicalEquationSolverSettings::isAdaptiveSccSolvingSet() const {
+    return this->getOption(adaptiveSccSolvingOptionName).getHasOptionBeenSet();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
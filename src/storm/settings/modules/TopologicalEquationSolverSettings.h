@@ -60,6 +60,20 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves whether independent SCCs are to be solved concurrently.
+     *
+     * @return True iff independent SCCs are to be solved concurrently.
+     */
+    bool isParallelSccSolvingSet() const;
+
+    /*!
+     * Retrieves whether the method for solving an SCC is to be chosen based on the size and density of the SCC.
+     *
+     * @return True iff the method is to be chosen per SCC.
+     */
+    bool isAdaptiveSccSolvingSet() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +83,8 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string parallelSccSolvingOptionName;
+    static const std::string adaptiveSccSolvingOptionName;
 };
 
 }  // namespace modules
@@ -18,6 +18,7 @@ const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-be
 const std::string TransformationSettings::toNondetOptionName = "to-nondet";
 const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
 const std::string TransformationSettings::permuteModelOptionName = "permute";
+const std::string TransformationSettings::removeDuplicateChoicesOptionName = "remove-duplicate-choices";
 
 TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, chainEliminationOptionName, false,
@@ -61,6 +62,11 @@ TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
                              .makeOptional()
                              .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, removeDuplicateChoicesOptionName, false,
+                                                   "If set, choices of MDPs that have the same distribution and rewards as another choice of the same state "
+                                                   "are removed after building the model.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TransformationSettings::isChainEliminationSet() const {
@@ -104,6 +110,10 @@ std::optional<uint64_t> TransformationSettings::getModelPermutationSeed() const
     return std::nullopt;
 }
 
+bool TransformationSettings::isRemoveDuplicateChoicesSet() const {
+    return this->getOption(removeDuplicateChoicesOptionName).getHasOptionBeenSet();
+}
+
 bool TransformationSettings::check() const {
     // Ensure that labeling preservation is only set if chain elimination is set
     STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(), storm::exceptions::InvalidSettingsException,
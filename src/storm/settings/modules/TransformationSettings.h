@@ -58,6 +58,11 @@ class TransformationSettings : public ModuleSettings {
      */
     std::optional<uint64_t> getModelPermutationSeed() const;
 
+    /*!
+     * Retrieves whether duplicate choices of MDPs should be removed
+     */
+    bool isRemoveDuplicateChoicesSet() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -72,6 +77,7 @@ class TransformationSettings : public ModuleSettings {
     static const std::string toNondetOptionName;
     static const std::string toDiscreteTimeOptionName;
     static const std::string permuteModelOptionName;
+    static const std::string removeDuplicateChoicesOptionName;
 };
 
 }  // namespace settings::modules
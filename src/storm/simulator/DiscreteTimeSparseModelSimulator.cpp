@@ -1,70 +1,58 @@
 #include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/macros.h"
 
 namespace storm {
 namespace simulator {
 template<typename ValueType, typename RewardModelType>
 DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::DiscreteTimeSparseModelSimulator(
     storm::models::sparse::Model<ValueType, RewardModelType> const& model)
-    : model(model), currentState(*model.getInitialStates().begin()), zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()) {
+    : model(model),
+      currentState(*model.getInitialStates().begin()),
+      zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()),
+      rowsWithAliasTable(model.getTransitionMatrix().getRowCount()),
+      batchFirstTraceIndex(0) {
     STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
                         "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
     lastRewards = zeroRewards;
-    uint64_t i = 0;
-    for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateRewards()) {
-            lastRewards[i] += rewModPair.second.getStateReward(currentState);
-        }
-        ++i;
-    }
+    addRewards(lastRewards, 0, std::nullopt, currentState);
 }
 
 template<typename ValueType, typename RewardModelType>
 void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
     generator = storm::utility::RandomProbabilityGenerator<ValueType>(seed);
+    batchGenerator = storm::utility::CounterBasedRandomGenerator(seed);
 }
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep() {
-    // TODO random_uint is slow
-    if (model.getTransitionMatrix().getRowGroupSize(currentState) == 0) {
+    uint64_t const numberOfActions = model.getTransitionMatrix().getRowGroupSize(currentState);
+    if (numberOfActions == 0) {
         return false;
     }
-    return step(generator.random_uint(0, model.getTransitionMatrix().getRowGroupSize(currentState) - 1));
+    return step(numberOfActions == 1 ? 0 : generator.random_uint(0, numberOfActions - 1));
 }
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action) {
-    // TODO lots of optimization potential.
-    //  E.g., do not sample random numbers if there is only a single transition
-    lastRewards = zeroRewards;
-    ValueType probability = generator.random();
     STORM_LOG_ASSERT(action < model.getTransitionMatrix().getRowGroupSize(currentState), "Action index higher than number of actions");
     uint64_t row = model.getTransitionMatrix().getRowGroupIndices()[currentState] + action;
-    uint64_t i = 0;
-    for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateActionRewards()) {
-            lastRewards[i] += rewModPair.second.getStateActionReward(row);
-        }
-        ++i;
-    }
-    ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
-        sum += entry.getValue();
-        if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
-            }
-            return true;
-        }
+    if (model.getTransitionMatrix().getRow(row).getNumberOfEntries() == 0) {
+        // This position should never be reached
+        lastRewards = zeroRewards;
+        return false;
     }
-    // This position should never be reached
-    return false;
+    buildAliasTable(row);
+    // Rows with a single successor do not need a random number.
+    ValueType probability = model.getTransitionMatrix().getRow(row).getNumberOfEntries() == 1 ? storm::utility::zero<ValueType>() : generator.random();
+    currentState = sampleSuccessor(row, probability);
+    lastRewards = zeroRewards;
+    addRewards(lastRewards, 0, row, currentState);
+    return true;
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -76,13 +64,7 @@ template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::resetToInitial() {
     currentState = *model.getInitialStates().begin();
     lastRewards = zeroRewards;
-    uint64_t i = 0;
-    for (auto const& rewModPair : model.getRewardModels()) {
-        if (rewModPair.second.hasStateRewards()) {
-            lastRewards[i] += rewModPair.second.getStateReward(currentState);
-        }
-        ++i;
-    }
+    addRewards(lastRewards, 0, std::nullopt, currentState);
     return true;
 }
 
@@ -91,6 +73,168 @@ std::vector<ValueType> const& DiscreteTimeSparseModelSimulator<ValueType, Reward
     return lastRewards;
 }
 
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::resetBatchToInitial(uint64_t numberOfTraces, uint64_t firstTraceIndex) {
+    uint64_t const initialState = *model.getInitialStates().begin();
+    batchFirstTraceIndex = firstTraceIndex;
+    batchStates.assign(numberOfTraces, initialState);
+    batchStepCounts.assign(numberOfTraces, 0);
+    batchLastRewards.assign(numberOfTraces * zeroRewards.size(), storm::utility::zero<ValueType>());
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        addRewards(batchLastRewards, trace * zeroRewards.size(), std::nullopt, initialState);
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::batchStep(std::vector<uint64_t> const& actions) {
+    STORM_LOG_ASSERT(actions.size() == batchStates.size(), "The number of actions does not match the number of traces.");
+    std::fill(batchLastRewards.begin(), batchLastRewards.end(), storm::utility::zero<ValueType>());
+    // All traces take their step before any trace takes its next one. As the steps of different traces are independent, their memory accesses can
+    // overlap and rows that are visited by several traces stay in the cache.
+    uint64_t numberOfAdvancedTraces = 0;
+    for (uint64_t trace = 0; trace < batchStates.size(); ++trace) {
+        if (stepTraceOfBatch(trace, actions[trace])) {
+            ++numberOfAdvancedTraces;
+        }
+    }
+    return numberOfAdvancedTraces;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::batchRandomStep() {
+    auto const& matrix = model.getTransitionMatrix();
+    std::fill(batchLastRewards.begin(), batchLastRewards.end(), storm::utility::zero<ValueType>());
+    uint64_t numberOfAdvancedTraces = 0;
+    for (uint64_t trace = 0; trace < batchStates.size(); ++trace) {
+        uint64_t const numberOfActions = matrix.getRowGroupSize(batchStates[trace]);
+        if (numberOfActions == 0) {
+            continue;
+        }
+        uint64_t action = 0;
+        if (numberOfActions > 1) {
+            action = batchGenerator.random_uint(batchFirstTraceIndex + trace, 2 * batchStepCounts[trace], 0, numberOfActions - 1);
+        }
+        if (stepTraceOfBatch(trace, action)) {
+            ++numberOfAdvancedTraces;
+        }
+    }
+    return numberOfAdvancedTraces;
+}
+
+template<typename ValueType, typename RewardModelType>
+bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::stepTraceOfBatch(uint64_t trace, uint64_t action) {
+    auto const& matrix = model.getTransitionMatrix();
+    uint64_t& state = batchStates[trace];
+    STORM_LOG_ASSERT(action < matrix.getRowGroupSize(state), "Action index higher than number of actions");
+    uint64_t const row = matrix.getRowGroupIndices()[state] + action;
+    uint64_t const numberOfEntries = matrix.getRow(row).getNumberOfEntries();
+    if (numberOfEntries == 0) {
+        return false;
+    }
+    buildAliasTable(row);
+    ValueType probability = storm::utility::zero<ValueType>();
+    if (numberOfEntries > 1) {
+        probability = storm::utility::convertNumber<ValueType>(batchGenerator.random(batchFirstTraceIndex + trace, 2 * batchStepCounts[trace] + 1));
+    }
+    state = sampleSuccessor(row, probability);
+    ++batchStepCounts[trace];
+    addRewards(batchLastRewards, trace * zeroRewards.size(), row, state);
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<uint64_t> const& DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getBatchStates() const {
+    return batchStates;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> const& DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getBatchLastRewards() const {
+    return batchLastRewards;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::sampleSuccessor(uint64_t row, ValueType const& random) const {
+    auto const& matrix = model.getTransitionMatrix();
+    uint64_t const firstEntry = std::distance(matrix.begin(), matrix.begin(row));
+    uint64_t const numberOfEntries = matrix.getRow(row).getNumberOfEntries();
+    STORM_LOG_ASSERT(rowsWithAliasTable.get(row), "The alias table of row " << row << " was not built.");
+    // The integral part of the scaled number selects the entry of the table, the fractional part decides between the entry and its alias.
+    ValueType const scaled = random * storm::utility::convertNumber<ValueType>(numberOfEntries);
+    uint64_t const index = std::min<uint64_t>(storm::utility::convertNumber<uint_fast64_t>(storm::utility::floor(scaled)), numberOfEntries - 1);
+    AliasEntry const& entry = aliasTables[firstEntry + index];
+    return scaled - storm::utility::convertNumber<ValueType>(index) < entry.threshold ? entry.column : entry.aliasColumn;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::buildAliasTable(uint64_t row) {
+    if (rowsWithAliasTable.get(row)) {
+        return;
+    }
+    auto const& matrix = model.getTransitionMatrix();
+    if (aliasTables.empty()) {
+        // Only allocate the tables once they are needed.
+        aliasTables.resize(matrix.getEntryCount());
+    }
+    uint64_t const firstEntry = std::distance(matrix.begin(), matrix.begin(row));
+    auto const rowEntries = matrix.getRow(row);
+    uint64_t const numberOfEntries = rowEntries.getNumberOfEntries();
+
+    // Scale the probabilities such that their average is one. Normalizing by the sum makes the table robust against rows that do not sum up to one
+    // exactly due to floating point errors.
+    ValueType sum = storm::utility::zero<ValueType>();
+    for (auto const& entry : rowEntries) {
+        sum += entry.getValue();
+    }
+    STORM_LOG_THROW(!storm::utility::isZero(sum), storm::exceptions::InvalidArgumentException, "The probabilities of row " << row << " sum up to zero.");
+    ValueType const factor = storm::utility::convertNumber<ValueType>(numberOfEntries) / sum;
+    std::vector<uint64_t> small, large;
+    uint64_t index = 0;
+    for (auto const& entry : rowEntries) {
+        AliasEntry& aliasEntry = aliasTables[firstEntry + index];
+        aliasEntry.threshold = entry.getValue() * factor;
+        aliasEntry.column = entry.getColumn();
+        aliasEntry.aliasColumn = entry.getColumn();
+        (aliasEntry.threshold < storm::utility::one<ValueType>() ? small : large).push_back(index);
+        ++index;
+    }
+
+    // Vose's method: repeatedly fill the remaining space of a small entry with the mass of a large entry.
+    while (!small.empty() && !large.empty()) {
+        AliasEntry& smallEntry = aliasTables[firstEntry + small.back()];
+        small.pop_back();
+        uint64_t const largeIndex = large.back();
+        AliasEntry& largeEntry = aliasTables[firstEntry + largeIndex];
+        smallEntry.aliasColumn = largeEntry.column;
+        largeEntry.threshold -= storm::utility::one<ValueType>() - smallEntry.threshold;
+        if (largeEntry.threshold < storm::utility::one<ValueType>()) {
+            large.pop_back();
+            small.push_back(largeIndex);
+        }
+    }
+    // The remaining entries have (up to numerical errors) a scaled probability of one.
+    for (auto const& remaining : {small, large}) {
+        for (auto const& remainingIndex : remaining) {
+            aliasTables[firstEntry + remainingIndex].threshold = storm::utility::one<ValueType>();
+        }
+    }
+    rowsWithAliasTable.set(row);
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::addRewards(std::vector<ValueType>& rewards, uint64_t rewardsOffset,
+                                                                              std::optional<uint64_t> const& row, uint64_t state) const {
+    uint64_t i = rewardsOffset;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (row && rewModPair.second.hasStateActionRewards()) {
+            rewards[i] += rewModPair.second.getStateActionReward(*row);
+        }
+        if (rewModPair.second.hasStateRewards()) {
+            rewards[i] += rewModPair.second.getStateReward(state);
+        }
+        ++i;
+    }
+}
+
 template class DiscreteTimeSparseModelSimulator<double>;
 template class DiscreteTimeSparseModelSimulator<storm::RationalNumber>;
 
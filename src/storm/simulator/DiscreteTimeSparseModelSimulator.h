@@ -1,5 +1,7 @@
 #include <cstdint>
+#include <optional>
 #include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -10,6 +12,10 @@ namespace simulator {
  * stored explicitly as a SparseModel.
  * Additional information about state, actions, should be obtained via the model itself.
  *
+ * Successors are sampled in constant time with alias tables, which are built lazily for the rows that are actually visited.
+ * Besides a single trace, the simulator can advance a batch of traces in lockstep. Each trace of a batch draws its random numbers from its own
+ * stream of a counter-based generator, so the sampled traces only depend on the seed and the index of the trace.
+ *
  * TODO: It may be nice to write a CPP wrapper that does not require to actually obtain such informations yourself.
  * @tparam ModelType
  */
@@ -24,12 +30,89 @@ class DiscreteTimeSparseModelSimulator {
     uint64_t getCurrentState() const;
     bool resetToInitial();
 
+    /*!
+     * Resets the batch to the given number of traces that start in the initial state.
+     *
+     * @param numberOfTraces The number of traces in the batch.
+     * @param firstTraceIndex The index of the first trace of the batch. Trace i of the batch uses the random stream firstTraceIndex + i, so batches with
+     * disjoint ranges of trace indices (e.g., of different threads) are independent.
+     */
+    void resetBatchToInitial(uint64_t numberOfTraces, uint64_t firstTraceIndex = 0);
+
+    /*!
+     * Advances every trace of the batch by one step with the given action (relative to the current state of the trace).
+     *
+     * @return The number of traces that were advanced, i.e., traces whose current row has no successor remain in their state.
+     */
+    uint64_t batchStep(std::vector<uint64_t> const& actions);
+
+    /*!
+     * Advances every trace of the batch by one step with an action that is chosen uniformly at random.
+     *
+     * @return The number of traces that were advanced, i.e., traces in states without actions remain in their state.
+     */
+    uint64_t batchRandomStep();
+
+    /*!
+     * Retrieves the current states of the traces of the batch.
+     */
+    std::vector<uint64_t> const& getBatchStates() const;
+
+    /*!
+     * Retrieves the rewards collected by the traces of the batch in their last step. The reward of the r-th reward model for the i-th trace is at
+     * position i * (number of reward models) + r.
+     */
+    std::vector<ValueType> const& getBatchLastRewards() const;
+
    protected:
+    /*!
+     * An entry of the alias table of a row: a sample that falls into this entry yields the successor with the given column if the residual is below
+     * the threshold and the successor with the alias column otherwise.
+     */
+    struct AliasEntry {
+        ValueType threshold;
+        uint64_t column;
+        uint64_t aliasColumn;
+    };
+
+    /*!
+     * Samples a successor of the given row from the given number that is uniformly distributed in [0, 1].
+     */
+    uint64_t sampleSuccessor(uint64_t row, ValueType const& random) const;
+
+    /*!
+     * Builds the alias table of the given row (with Vose's method) unless it was built before.
+     */
+    void buildAliasTable(uint64_t row);
+
+    /*!
+     * Advances the given trace of the batch with the given action.
+     *
+     * @return False iff the row of the action has no successor.
+     */
+    bool stepTraceOfBatch(uint64_t trace, uint64_t action);
+
+    /*!
+     * Adds the rewards of taking the given row and of then being in the given state to the given rewards.
+     */
+    void addRewards(std::vector<ValueType>& rewards, uint64_t rewardsOffset, std::optional<uint64_t> const& row, uint64_t state) const;
+
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
     uint64_t currentState;
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+
+    // The alias tables of all rows whose table was built. The table of a row occupies the positions of the row's entries in the transition matrix.
+    std::vector<AliasEntry> aliasTables;
+    storm::storage::BitVector rowsWithAliasTable;
+
+    // The traces of the batch. Step i of trace j draws the numbers with counters 2i and 2i + 1 from stream batchFirstTraceIndex + j.
+    std::vector<uint64_t> batchStates;
+    std::vector<uint64_t> batchStepCounts;
+    std::vector<ValueType> batchLastRewards;
+    uint64_t batchFirstTraceIndex;
+    storm::utility::CounterBasedRandomGenerator batchGenerator;
 };
 }  // namespace simulator
-}  // namespace storm
\ No newline at end of file
+}  // namespace storm
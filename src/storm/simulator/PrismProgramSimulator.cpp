@@ -95,6 +95,16 @@ std::vector<ValueType> const& DiscreteTimePrismProgramSimulator<ValueType>::getL
     return lastActionRewards;
 }
 
+template<typename ValueType>
+std::vector<ValueType> const& DiscreteTimePrismProgramSimulator<ValueType>::getCurrentStateRewards() const {
+    return behavior.getStateRewards();
+}
+
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const {
+    return stateGenerator->evaluateBooleanExpressionInCurrentState(expression);
+}
+
 template<typename ValueType>
 CompressedState const& DiscreteTimePrismProgramSimulator<ValueType>::getCurrentState() const {
     return currentState;
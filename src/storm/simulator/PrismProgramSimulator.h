@@ -57,6 +57,15 @@ class DiscreteTimePrismProgramSimulator {
      * @return A vector with te number of rewards.
      */
     std::vector<ValueType> const& getLastRewards() const;
+    /**
+     * Accessor for the state rewards of the current state.
+     * @return A vector with the state reward of the current state for each reward model.
+     */
+    std::vector<ValueType> const& getCurrentStateRewards() const;
+    /**
+     * Evaluates the given expression (over the variables of the program) in the current state.
+     */
+    bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const;
     generator::CompressedState const& getCurrentState() const;
     expressions::SimpleValuation getCurrentStateAsValuation() const;
     std::vector<std::string> getCurrentStateLabelling() const;
@@ -1,5 +1,7 @@
 #include "storm/solver/AbstractEquationSolver.h"
 
+#include <sstream>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -8,6 +10,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -16,7 +19,7 @@ namespace solver {
 
 template<typename ValueType>
 AbstractEquationSolver<ValueType>::AbstractEquationSolver() {
-    if (storm::settings::getModule<storm::settings::modules::GeneralSettings>().isVerboseSet()) {
+    if (storm::settings::getModule<storm::settings::modules::GeneralSettings>().isVerboseSet() || storm::utility::hasProgressCallback()) {
         this->progressMeasurement = storm::utility::ProgressMeasurement("iterations");
     }
 }
@@ -309,6 +312,14 @@ void AbstractEquationSolver<ValueType>::showProgressIterative(uint64_t iteration
 
 template<typename ValueType>
 void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
+    if (storm::utility::telemetry::isRecording()) {
+        std::stringstream statusString;
+        statusString << status;
+        storm::utility::telemetry::setAttribute("status", statusString.str());
+        if (iterations) {
+            storm::utility::telemetry::setAttribute("iterations", iterations.get());
+        }
+    }
     if (iterations) {
         switch (status) {
             case SolverStatus::Converged:
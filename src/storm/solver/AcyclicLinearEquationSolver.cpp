@@ -1,8 +1,11 @@
 #include "storm/solver/AcyclicLinearEquationSolver.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/helper/AcyclicSolverHelper.h"
 
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -65,6 +68,16 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         }
         auxiliaryRowVector = std::vector<ValueType>(this->A->getRowCount());
         auxiliaryRowVector2 = std::vector<ValueType>(this->A->getRowCount());
+#ifdef STORM_HAVE_INTELTBB
+        if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                levels = helper::computeTopologicalLevels(orderedMatrix ? *orderedMatrix : *this->A);
+                if (!helper::isLevelParallelSolvingBeneficial(*levels)) {
+                    levels = boost::none;
+                }
+            }
+        }
+#endif
     }
 
     std::vector<ValueType>* xPtr = &x;
@@ -80,7 +93,11 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         xPtr = &auxiliaryRowVector2.get();
     }
 
-    this->multiplier->multiplyGaussSeidel(env, *xPtr, bPtr, true);
+    if (levels) {
+        helper::solveLevelsInParallel(orderedMatrix ? *orderedMatrix : *this->A, *levels, *xPtr, bPtr);
+    } else {
+        this->multiplier->multiplyGaussSeidel(env, *xPtr, bPtr, true);
+    }
 
     if (rowOrdering) {
         for (uint64_t newRow = 0; newRow < x.size(); ++newRow) {
@@ -115,6 +132,7 @@ void AcyclicLinearEquationSolver<ValueType>::clearCache() const {
     auxiliaryRowVector = boost::none;
     auxiliaryRowVector2 = boost::none;
     bFactors.clear();
+    levels = boost::none;
 }
 
 // Explicitly instantiate the min max linear equation solver.
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 namespace storm {
@@ -57,6 +58,8 @@ class AcyclicLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable boost::optional<std::vector<ValueType>> auxiliaryRowVector2;  // A.rowCount() entries
     // contains factors applied to scale the entries of the 'b' vector
     mutable std::vector<std::pair<uint64_t, ValueType>> bFactors;
+    // cached topological levels of the (ordered) matrix (only if the levels are solved in parallel)
+    mutable boost::optional<helper::TopologicalLevels> levels;
 };
 }  // namespace solver
 }  // namespace storm
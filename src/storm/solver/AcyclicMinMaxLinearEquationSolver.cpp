@@ -1,7 +1,10 @@
 #include "storm/solver/AcyclicMinMaxLinearEquationSolver.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/helper/AcyclicSolverHelper.h"
 
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -43,6 +46,14 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
         }
         auxiliaryRowVector = std::vector<ValueType>(this->A->getRowCount());
         auxiliaryRowGroupVector = std::vector<ValueType>(this->A->getRowGroupCount());
+#ifdef STORM_HAVE_INTELTBB
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            levels = helper::computeTopologicalLevels(orderedMatrix ? *orderedMatrix : *this->A);
+            if (!helper::isLevelParallelSolvingBeneficial(*levels)) {
+                levels = boost::none;
+            }
+        }
+#endif
     }
 
     std::vector<ValueType>* xPtr = &x;
@@ -87,7 +98,11 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
     }
 
     // Since a topological ordering is guaranteed, we can solve the equations with a single matrix-vector Multiplication step.
-    this->multiplier->multiplyAndReduceGaussSeidel(env, dir, *xPtr, bPtr, choicesPtr, true);
+    if (levels) {
+        helper::solveLevelsInParallel(orderedMatrix ? *orderedMatrix : *this->A, dir, *levels, *xPtr, bPtr, choicesPtr);
+    } else {
+        this->multiplier->multiplyAndReduceGaussSeidel(env, dir, *xPtr, bPtr, choicesPtr, true);
+    }
 
     if (rowGroupOrdering) {
         // Restore the correct input-order for the output vector
@@ -126,6 +141,7 @@ void AcyclicMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     auxiliaryRowGroupVector = boost::none;
     auxiliaryRowGroupIndexVector = boost::none;
     bFactors.clear();
+    levels = boost::none;
 }
 
 // Explicitly instantiate the min max linear equation solver.
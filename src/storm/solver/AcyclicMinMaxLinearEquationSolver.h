@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 namespace storm {
@@ -49,6 +50,8 @@ class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSol
     mutable boost::optional<std::vector<uint64_t>> auxiliaryRowGroupIndexVector;  // A.rowGroupCount() entries
     // contains factors applied to scale the entries of the 'b' vector
     mutable std::vector<std::pair<uint64_t, ValueType>> bFactors;
+    // cached topological levels of the (ordered) matrix (only if the levels are solved in parallel)
+    mutable boost::optional<helper::TopologicalLevels> levels;
 };
 }  // namespace solver
 }  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/adapters/EigenAdapter.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -7,6 +10,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -28,10 +32,28 @@ EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::
     this->setMatrix(std::move(A));
 }
 
+namespace detail {
+// Bounds the number of rows in which a matrix may differ from a factorized one such that the factorization is reused.
+// For each such row, a dense vector of the matrix dimension is stored.
+uint64_t getMaximalNumberOfUpdatedRows(uint64_t dimension) {
+    return std::min<uint64_t>(64, (1ull << 24) / std::max<uint64_t>(dimension, 1));
+}
+}  // namespace detail
+
 template<typename ValueType>
 void EigenLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
     eigenA = storm::adapters::EigenAdapter::toEigenSparseMatrix<ValueType>(A);
-    this->clearCache();
+    if (updateLowRankCorrection(A)) {
+        // Only clear the data that does not depend on the factorization.
+        LinearEquationSolver<ValueType>::clearCache();
+    } else {
+        this->clearCache();
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (this->isCachingEnabled()) {
+                unfactorizedMatrix = A;
+            }
+        }
+    }
 }
 
 template<typename ValueType>
@@ -39,7 +61,75 @@ void EigenLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatri
     // Take ownership of the matrix so it is destroyed after we have translated it to Eigen's format.
     storm::storage::SparseMatrix<ValueType> localA(std::move(A));
     this->setMatrix(localA);
-    this->clearCache();
+}
+
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::updateLowRankCorrection(storm::storage::SparseMatrix<ValueType> const& A) {
+    if (!this->isCachingEnabled() || !cachedFactorization) {
+        return false;
+    }
+    auto const& factorizedMatrix = cachedFactorization->matrix;
+    if (factorizedMatrix.getRowCount() != A.getRowCount() || factorizedMatrix.getColumnCount() != A.getColumnCount()) {
+        return false;
+    }
+    uint64_t const maxNumberOfUpdatedRows = detail::getMaximalNumberOfUpdatedRows(A.getRowCount());
+    std::vector<uint64_t> newUpdatedRows;
+    for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+        auto newRow = A.getRow(row);
+        auto oldRow = factorizedMatrix.getRow(row);
+        if (!std::equal(newRow.begin(), newRow.end(), oldRow.begin(), oldRow.end())) {
+            if (newUpdatedRows.size() == maxNumberOfUpdatedRows) {
+                return false;
+            }
+            newUpdatedRows.push_back(row);
+        }
+    }
+
+    // Build the difference of the updated rows. Both rows have their entries ordered by column.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(newUpdatedRows.size(), A.getColumnCount());
+    for (uint64_t i = 0; i < newUpdatedRows.size(); ++i) {
+        auto newRow = A.getRow(newUpdatedRows[i]);
+        auto oldRow = factorizedMatrix.getRow(newUpdatedRows[i]);
+        auto newIt = newRow.begin();
+        auto oldIt = oldRow.begin();
+        while (newIt != newRow.end() || oldIt != oldRow.end()) {
+            if (oldIt == oldRow.end() || (newIt != newRow.end() && newIt->getColumn() < oldIt->getColumn())) {
+                builder.addNextValue(i, newIt->getColumn(), newIt->getValue());
+                ++newIt;
+            } else if (newIt == newRow.end() || oldIt->getColumn() < newIt->getColumn()) {
+                builder.addNextValue(i, oldIt->getColumn(), -oldIt->getValue());
+                ++oldIt;
+            } else {
+                ValueType difference = newIt->getValue() - oldIt->getValue();
+                if (!storm::utility::isZero(difference)) {
+                    builder.addNextValue(i, newIt->getColumn(), difference);
+                }
+                ++newIt;
+                ++oldIt;
+            }
+        }
+    }
+    lowRankCorrection = builder.build(newUpdatedRows.size(), A.getColumnCount());
+    updatedRows = std::move(newUpdatedRows);
+
+    // Drop the solutions for unit vectors that are no longer needed.
+    for (auto it = cachedFactorization->solvedUnitVectors.begin(); it != cachedFactorization->solvedUnitVectors.end();) {
+        if (std::binary_search(updatedRows.begin(), updatedRows.end(), it->first)) {
+            ++it;
+        } else {
+            it = cachedFactorization->solvedUnitVectors.erase(it);
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void EigenLinearEquationSolver<ValueType>::clearCache() const {
+    unfactorizedMatrix.reset();
+    cachedFactorization.reset();
+    updatedRows.clear();
+    lowRankCorrection = storm::storage::SparseMatrix<ValueType>();
+    LinearEquationSolver<ValueType>::clearCache();
 }
 
 template<typename ValueType>
@@ -115,6 +205,9 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     auto solutionMethod = getMethod(env, env.solver().isForceExact());
     if (solutionMethod == EigenLinearEquationSolverMethod::SparseLU) {
         STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with sparse LU factorization (Eigen library).");
+        if (this->isCachingEnabled() && (cachedFactorization || unfactorizedMatrix)) {
+            return solveEquationsWithCachedFactorization(x, b);
+        }
         Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
         solver.compute(*this->eigenA);
         solver._solve_impl(eigenB, eigenX);
@@ -248,6 +341,75 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     return true;
 }
 
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::solveEquationsWithCachedFactorization(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    if constexpr (std::is_same_v<ValueType, double>) {
+        typedef Eigen::Matrix<ValueType, Eigen::Dynamic, 1> EigenVector;
+        if (!cachedFactorization) {
+            STORM_LOG_ASSERT(unfactorizedMatrix.has_value(), "Expected the matrix to be factorized.");
+            cachedFactorization = std::make_unique<CachedFactorization>();
+            cachedFactorization->lu.compute(*this->eigenA);
+            if (cachedFactorization->lu.info() != Eigen::ComputationInfo::Success) {
+                cachedFactorization.reset();
+                return false;
+            }
+            cachedFactorization->matrix = std::move(*unfactorizedMatrix);
+            unfactorizedMatrix.reset();
+            STORM_LOG_ASSERT(updatedRows.empty(), "Unexpected low rank correction without a factorization.");
+        } else {
+            STORM_LOG_INFO("Reusing LU factorization of a matrix that differs in " << updatedRows.size() << " rows.");
+        }
+        auto& lu = cachedFactorization->lu;
+
+        // Solve the system for the factorized matrix M.
+        auto eigenX = EigenVector::Map(x.data(), x.size());
+        auto eigenB = EigenVector::Map(b.data(), b.size());
+        lu._solve_impl(eigenB, eigenX);
+        if (updatedRows.empty()) {
+            return lu.info() == Eigen::ComputationInfo::Success;
+        }
+
+        // The current matrix is M + U * W, where the columns of U are the unit vectors of the updated rows and W is the low rank correction.
+        // By the Sherman-Morrison-Woodbury formula, the solution is x - Z * (I + W * Z)^-1 * W * x with Z = M^-1 * U.
+        uint64_t const k = updatedRows.size();
+        std::vector<std::vector<ValueType> const*> z;
+        z.reserve(k);
+        for (auto const& row : updatedRows) {
+            auto& solvedUnitVector = cachedFactorization->solvedUnitVectors[row];
+            if (solvedUnitVector.empty()) {
+                EigenVector unitVector = EigenVector::Unit(x.size(), row);
+                solvedUnitVector.resize(x.size());
+                auto eigenSolvedUnitVector = EigenVector::Map(solvedUnitVector.data(), solvedUnitVector.size());
+                lu._solve_impl(unitVector, eigenSolvedUnitVector);
+            }
+            z.push_back(&solvedUnitVector);
+        }
+        Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic> capacitance = Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic>::Identity(k, k);
+        EigenVector correctedX(k);
+        for (uint64_t i = 0; i < k; ++i) {
+            correctedX(i) = lowRankCorrection.multiplyRowWithVector(i, x);
+            for (uint64_t j = 0; j < k; ++j) {
+                capacitance(i, j) += lowRankCorrection.multiplyRowWithVector(i, *z[j]);
+            }
+        }
+        Eigen::FullPivLU<Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic>> capacitanceLu(capacitance);
+        if (!capacitanceLu.isInvertible()) {
+            STORM_LOG_WARN("Unable to reuse LU factorization. Factorizing the matrix from scratch.");
+            Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
+            solver.compute(*this->eigenA);
+            solver._solve_impl(eigenB, eigenX);
+            return solver.info() == Eigen::ComputationInfo::Success;
+        }
+        EigenVector s = capacitanceLu.solve(correctedX);
+        for (uint64_t j = 0; j < k; ++j) {
+            storm::utility::vector::addScaledVector(x, *z[j], -s(j));
+        }
+        return true;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Reusing factorizations is only supported for double precision.");
+    }
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
     return LinearEquationSolverProblemFormat::EquationSystem;
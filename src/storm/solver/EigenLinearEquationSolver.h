@@ -1,5 +1,8 @@
 #pragma once
 
+#include <map>
+#include <optional>
+
 #include "storm/adapters/eigen.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
@@ -22,6 +25,8 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
+    virtual void clearCache() const override;
+
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
@@ -31,8 +36,36 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual uint64_t getMatrixRowCount() const override;
     virtual uint64_t getMatrixColumnCount() const override;
 
+    /*!
+     * If caching is enabled and a factorization of a previous matrix is present, this checks whether the given matrix only differs from the factorized one
+     * in a few rows. If so, the factorization is kept and the difference is stored as a low-rank correction.
+     * @return true iff the cached factorization can be reused for the given matrix.
+     */
+    bool updateLowRankCorrection(storm::storage::SparseMatrix<ValueType> const& A);
+
+    /*!
+     * Solves the equation system using a cached LU factorization of a previous matrix and applies the Sherman-Morrison-Woodbury formula to account for
+     * the rows that have changed since then. Creates the factorization if there is none.
+     */
+    bool solveEquationsWithCachedFactorization(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
     // The (eigen) matrix associated with this equation solver.
     std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
+
+    struct CachedFactorization {
+        // The matrix that has been factorized.
+        storm::storage::SparseMatrix<ValueType> matrix;
+        Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> lu;
+        // Maps a row index r to the solution of matrix * z = e_r, where e_r is the r-th unit vector.
+        std::map<uint64_t, std::vector<ValueType>> solvedUnitVectors;
+    };
+
+    // If caching is enabled, this is a copy of the current matrix which is needed to create a factorization that can be reused for later matrices.
+    mutable std::optional<storm::storage::SparseMatrix<ValueType>> unfactorizedMatrix;
+    mutable std::unique_ptr<CachedFactorization> cachedFactorization;
+    // The rows in which the current matrix differs from the factorized one and a matrix whose i-th row is the difference of the updatedRows[i]-th rows.
+    mutable std::vector<uint64_t> updatedRows;
+    mutable storm::storage::SparseMatrix<ValueType> lowRankCorrection;
 };
 
 template<typename ValueType>
@@ -35,7 +35,8 @@ GlpkLpSolver<ValueType, RawMode>::GlpkLpSolver(std::string const& name, Optimiza
       variableToIndexMap(),
       modelContainsIntegerVariables(false),
       isInfeasibleFlag(false),
-      isUnboundedFlag(false) {
+      isUnboundedFlag(false),
+      useDualSimplex(false) {
     // Create the LP problem for glpk.
     lp = glp_create_prob();
 
@@ -137,6 +138,13 @@ typename GlpkLpSolver<ValueType, RawMode>::Variable GlpkLpSolver<ValueType, RawM
     return resultVar;
 }
 
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    glp_set_obj_coef(this->lp, variableToIndexMap.at(variable), storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    this->useDualSimplex = false;
+    this->currentModelHasBeenOptimized = false;
+}
+
 template<typename ValueType, bool RawMode>
 void GlpkLpSolver<ValueType, RawMode>::update() const {
     // Intentionally left empty.
@@ -146,6 +154,51 @@ template<typename ValueType, bool RawMode>
 void GlpkLpSolver<ValueType, RawMode>::addConstraint(std::string const& name, Constraint const& constraint) {
     // Add the row that will represent this constraint.
     int constraintIndex = glp_add_rows(this->lp, 1);
+    setConstraint(constraintIndex, name, constraint);
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    if (constraints.empty()) {
+        return;
+    }
+    // Add all rows at once to avoid repeated reallocations within glpk.
+    int constraintIndex = glp_add_rows(this->lp, constraints.size());
+    for (auto const& constraint : constraints) {
+        setConstraint(constraintIndex, "", constraint);
+        ++constraintIndex;
+    }
+}
+
+template<typename ValueType, bool RawMode>
+bool GlpkLpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    return true;
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) {
+    // glpk uses 1-based indexing
+    int const rowIndex = constraintIndex + 1;
+    double const value = storm::utility::convertNumber<double>(rhs);
+    switch (glp_get_row_type(this->lp, rowIndex)) {
+        case GLP_UP:
+            glp_set_row_bnds(this->lp, rowIndex, GLP_UP, 0, value);
+            break;
+        case GLP_LO:
+            glp_set_row_bnds(this->lp, rowIndex, GLP_LO, value, 0);
+            break;
+        case GLP_FX:
+            glp_set_row_bnds(this->lp, rowIndex, GLP_FX, value, value);
+            break;
+        default:
+            STORM_LOG_ASSERT(false, "Unexpected type of row " << rowIndex << ".");
+    }
+    this->useDualSimplex = this->currentModelHasBeenOptimized || this->useDualSimplex;
+    this->currentModelHasBeenOptimized = false;
+}
+
+template<typename ValueType, bool RawMode>
+void GlpkLpSolver<ValueType, RawMode>::setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint) {
     glp_set_row_name(this->lp, constraintIndex, name.c_str());
 
     // Extract constraint data
@@ -306,9 +359,16 @@ void GlpkLpSolver<ValueType, RawMode>::optimize() const {
                     << "The bounds of some variables are illegal. Note that glpk only accepts integer bounds for integer variables.";
             }
         }
+    } else if (this->useDualSimplex) {
+        // The basis of the previous optimization remains dual feasible, so we warm-start the dual simplex.
+        glp_smcp parameters;
+        glp_init_smcp(&parameters);
+        parameters.meth = GLP_DUALP;
+        error = glp_simplex(this->lp, &parameters);
     } else {
         error = glp_simplex(this->lp, nullptr);
     }
+    this->useDualSimplex = false;
 
     STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException, "Unable to optimize glpk model (" << error << ").");
     this->currentModelHasBeenOptimized = true;
@@ -64,14 +64,20 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
 
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
 
     // Methods to incorporate recent changes.
     virtual void update() const override;
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
+    // Methods to change constraints
+    virtual bool isConstraintRhsChangeSupported() const override;
+    virtual void setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -94,6 +100,11 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
     virtual ValueType getMILPGap(bool relative) const override;
 
    private:
+    /*!
+     * Sets the bounds and coefficients of the (already added) row with the given index such that it represents the given constraint.
+     */
+    void setConstraint(int constraintIndex, std::string const& name, Constraint const& constraint);
+
     // The glpk LP problem.
     glp_prob* lp;
 
@@ -107,6 +118,9 @@ class GlpkLpSolver : public LpSolver<ValueType, RawMode> {
     mutable bool isInfeasibleFlag;
     mutable bool isUnboundedFlag;
 
+    // A flag that stores whether only right-hand sides changed since the last optimization, in which case the previous basis is dual feasible.
+    mutable bool useDualSimplex;
+
     mutable double maxMILPGap;
     mutable bool maxMILPGapRelative;
     mutable double actualRelativeMILPGap;
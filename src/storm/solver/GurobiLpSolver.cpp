@@ -186,6 +186,22 @@ typename GurobiLpSolver<ValueType, RawMode>::Variable GurobiLpSolver<ValueType,
     return resultVar;
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    int variableIndex;
+    if constexpr (RawMode) {
+        variableIndex = variable;
+    } else {
+        STORM_LOG_ASSERT(variableToIndexMap.count(variable) != 0, "Accessing unknown variable '" << variable.getName() << "'.");
+        variableIndex = variableToIndexMap.at(variable);
+    }
+    // Gurobi keeps the previous solution and uses it as a start for the next optimization.
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_OBJ, variableIndex, storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set objective coefficient of Gurobi variable (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    this->currentModelHasBeenOptimized = false;
+}
+
 struct GurobiConstraint {
     std::vector<int> variableIndices;
     std::vector<double> coefficients;
@@ -266,6 +282,46 @@ void GurobiLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
                     "Could not assert constraint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    if (constraints.empty()) {
+        return;
+    }
+    // Gather the constraints in compressed sparse row format.
+    std::vector<int> beginIndices, variableIndices;
+    std::vector<double> coefficients, rhs;
+    std::vector<char> senses;
+    beginIndices.reserve(constraints.size());
+    rhs.reserve(constraints.size());
+    senses.reserve(constraints.size());
+    for (auto const& constraint : constraints) {
+        auto grbConstr = createConstraint<ValueType, RawMode>(constraint, this->variableToIndexMap);
+        beginIndices.push_back(variableIndices.size());
+        variableIndices.insert(variableIndices.end(), grbConstr.variableIndices.begin(), grbConstr.variableIndices.end());
+        coefficients.insert(coefficients.end(), grbConstr.coefficients.begin(), grbConstr.coefficients.end());
+        senses.push_back(grbConstr.sense);
+        rhs.push_back(grbConstr.rhs);
+    }
+    int error = GRBaddconstrs(model, constraints.size(), variableIndices.size(), beginIndices.data(), variableIndices.data(), coefficients.data(),
+                              senses.data(), rhs.data(), nullptr);
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Could not assert constraints (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    return true;
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) {
+    // Gurobi keeps the basis of the previous optimization, so the next optimization is warm-started.
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_RHS, constraintIndex, storm::utility::convertNumber<double>(rhs));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to change right-hand side of constraint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    this->currentModelHasBeenOptimized = false;
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue,
                                                                 Constraint const& constraint) {
@@ -780,6 +836,12 @@ typename GurobiLpSolver<ValueType, RawMode>::Variable GurobiLpSolver<ValueType,
                                                           "requires this support. Please choose a version of support with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::update() const {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
@@ -792,6 +854,24 @@ void GurobiLpSolver<ValueType, RawMode>::addConstraint(std::string const&, Const
                                                           "requires this support. Please choose a version of support with Gurobi support.";
 }
 
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+bool GurobiLpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
+template<typename ValueType, bool RawMode>
+void GurobiLpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Gurobi support.";
+}
+
 template<typename ValueType, bool RawMode>
 void GurobiLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const&, Variable, bool, Constraint const&) {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
@@ -95,14 +95,20 @@ class GurobiLpSolver : public LpSolver<ValueType, RawMode> {
     // Methods to add variables.
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
 
     // Methods to incorporate recent changes.
     virtual void update() const override;
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
+    // Methods to change constraints
+    virtual bool isConstraintRhsChangeSupported() const override;
+    virtual void setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -4,20 +4,27 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
 #include "storm/solver/helper/SchedulerTrackingHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -73,12 +80,16 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::getMe
                 << toString(method)
                 << "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
         } else {
+            // There is no sound variant of the asynchronous method, so we do not silently return an uncertified result.
+            STORM_LOG_THROW(method != MinMaxMethod::AsyncGaussSeidel, storm::exceptions::InvalidEnvironmentException,
+                            "The selected solution method " << toString(method)
+                                                            << " does not guarantee sound results. Please select a sound method, e.g., interval iteration.");
             STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
         }
     }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsyncGaussSeidel,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method '" << toString(method) << "'.");
     return method;
 }
@@ -87,7 +98,13 @@ template<typename ValueType, typename SolutionType>
 bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolveEquations(Environment const& env, OptimizationDirection dir,
                                                                                           std::vector<SolutionType>& x, std::vector<ValueType> const& b) const {
     bool result = false;
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    if (storm::utility::telemetry::isRecording()) {
+        storm::utility::telemetry::setAttribute("method", toString(method));
+        storm::utility::telemetry::setAttribute("rows", this->A->getRowCount());
+        storm::utility::telemetry::setAttribute("entries", this->A->getEntryCount());
+    }
+    switch (method) {
         case MinMaxMethod::ValueIteration:
             result = solveEquationsValueIteration(env, dir, x, b);
             break;
@@ -109,6 +126,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolve
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::AsyncGaussSeidel:
+            result = solveEquationsAsynchronousGaussSeidel(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -121,6 +141,10 @@ void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperat
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false, SolutionType>>();
         viOperator->setMatrixBackwards(*this->A);
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::NumberTraits<SolutionType>::IsThreadSafe &&
+            storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            viOperator->setParallelApply(storm::utility::getNumberOfThreads());
+        }
     }
     if (this->choiceFixedForRowGroup) {
         // Ignore those rows that are not selected
@@ -132,6 +156,20 @@ void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpViOperat
     }
 }
 
+template<typename ValueType, typename SolutionType>
+void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::setUpReorderedViOperator(storm::utility::permutation::OrderKind order,
+                                                                                            std::vector<ValueType> const& b) const {
+    if (!stateReordering || stateReordering->getOrder() != order) {
+        stateReordering = std::make_unique<helper::StateReordering<ValueType>>(order, *this->A, b);
+        reorderedViOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false, SolutionType>>();
+        reorderedViOperator->setMatrixBackwards(stateReordering->getMatrix());
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::NumberTraits<SolutionType>::IsThreadSafe &&
+            storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            reorderedViOperator->setParallelApply(storm::utility::getNumberOfThreads());
+        }
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::extractScheduler(std::vector<SolutionType>& x, std::vector<ValueType> const& b,
                                                                                     OptimizationDirection const& dir, bool updateX, bool robust) const {
@@ -322,7 +360,8 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
     // Check whether a linear equation solver is needed and potentially start with its requirements
     bool needsLinEqSolver = false;
     needsLinEqSolver |= method == MinMaxMethod::PolicyIteration;
-    needsLinEqSolver |= method == MinMaxMethod::ValueIteration && (this->hasInitialScheduler() || hasInitialScheduler);
+    needsLinEqSolver |=
+        (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::AsyncGaussSeidel) && (this->hasInitialScheduler() || hasInitialScheduler);
     needsLinEqSolver |= method == MinMaxMethod::ViToPi;
 
     MinMaxLinearEquationSolverRequirements requirements;
@@ -335,7 +374,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
         // nothing to be done.
     }
 
-    if (method == MinMaxMethod::ValueIteration) {
+    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::AsyncGaussSeidel) {
         if (!this->hasUniqueSolution()) {  // Traditional value iteration has no requirements if the solution is unique.
             // Computing a scheduler is only possible if the solution is unique
             if (env.solver().minMax().isForceRequireUnique() || this->isTrackSchedulerSet()) {
@@ -448,7 +487,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         uint64_t numIterations{0};
         auto oviCallback = [&](SolverStatus const& current, std::vector<ValueType> const& v) {
             this->showProgressIterative(numIterations);
-            return this->updateStatus(current, v, SolverGuarantee::LessOrEqual, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            auto status = this->updateStatus(current, v, SolverGuarantee::LessOrEqual, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if ((status == SolverStatus::Aborted || status == SolverStatus::MaximalIterationsExceeded) && this->hasUpperBound()) {
+                // The iterates approach the solution from below. A guessed upper bound has not been verified, so we fall back to the known upper bound.
+                std::vector<ValueType> upper(v.size());
+                this->createUpperBoundsVector(upper);
+                this->solutionBounds.emplace(v, std::move(upper));
+            }
+            return status;
         };
         this->createLowerBoundsVector(x);
         std::optional<ValueType> guessingFactor;
@@ -530,16 +576,74 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         }
     }
 
-    storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(viOperator);
+    // Checkpoints are only supported for floating point values, which can be written to disk as they are.
+    std::optional<helper::SolverCheckpoint> checkpoint;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        checkpoint = helper::SolverCheckpoint::create(env, "minmax-vi", *this->A, b, dir,
+                                                      storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()));
+    }
+
+    // If requested, the iterations are performed on a copy of the equation system whose states are renumbered for better memory locality.
+    // Custom termination conditions, fixed choices and checkpoints refer to the original state indices, so we do not reorder in their presence.
+    auto const& stateOrder = env.solver().minMax().getStateOrder();
+    bool const reorderStates = stateOrder.has_value() && !this->hasCustomTerminationCondition() && !this->choiceFixedForRowGroup && !checkpoint.has_value();
+    STORM_LOG_WARN_COND(!stateOrder.has_value() || reorderStates,
+                        "The states of the equation system are not reordered as this is not supported for custom termination conditions, fixed choices or "
+                        "checkpoints.");
+    if (reorderStates) {
+        setUpReorderedViOperator(stateOrder.value(), b);
+    }
+
+    storm::solver::helper::ValueIterationHelper<ValueType, false, SolutionType> viHelper(reorderStates ? reorderedViOperator : viOperator);
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (checkpoint) {
+                checkpoint->update(x, numIterations);
+            }
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
-                              env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+    SolverStatus status = SolverStatus::InProgress;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpoint) {
+            status = checkpoint->restore(x, numIterations);
+        }
+    }
+    if (status == SolverStatus::InProgress && numIterations == 0 && env.solver().minMax().isMixedPrecision()) {
+        if constexpr (std::is_same_v<ValueType, double> && std::is_same_v<SolutionType, double>) {
+            // Custom termination conditions are checked on the double precision iterates only, we therefore do not want to skip them.
+            STORM_LOG_WARN_COND(!this->hasCustomTerminationCondition(), "Mixed precision value iteration is disabled due to a custom termination condition.");
+            if (!this->hasCustomTerminationCondition()) {
+                numIterations = performSinglePrecisionValueIteration(env, dir, x, b);
+                // Due to rounding errors, we can no longer guarantee that x is a lower or upper bound.
+                guarantee = SolverGuarantee::None;
+            }
+        } else {
+            STORM_LOG_WARN("Mixed precision value iteration is only supported for double precision equation systems.");
+        }
+    }
+    if (status == SolverStatus::InProgress) {
+        auto performValueIteration = [&](std::vector<SolutionType>& operand, std::vector<ValueType> const& offsets) {
+            return viHelper.VI(operand, offsets, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                               storm::utility::convertNumber<SolutionType>(env.solver().minMax().getPrecision()), dir, viCallback,
+                               env.solver().minMax().getMultiplicationStyle(), this->isUncertaintyRobust());
+        };
+        if (reorderStates) {
+            auto reorderedX = stateReordering->reorderStates(x);
+            status = performValueIteration(reorderedX, stateReordering->reorderRows(b));
+            stateReordering->restoreStates(reorderedX, x);
+        } else {
+            status = performValueIteration(x, b);
+        }
+    }
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpoint && status == SolverStatus::Converged) {
+            checkpoint->finish(x, numIterations);
+        }
+    }
     this->reportStatus(status, numIterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -554,6 +658,118 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType, typename SolutionType>
+bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquationsAsynchronousGaussSeidel(Environment const& env, OptimizationDirection dir,
+                                                                                                         std::vector<SolutionType>& x,
+                                                                                                         std::vector<ValueType> const& b) const {
+    if constexpr (!std::is_same_v<ValueType, SolutionType>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "We did not implement asynchronous Gauss-Seidel for interval-based models.");
+        return false;
+    } else {
+        if (this->hasInitialScheduler()) {
+            // The fixed choices and the initial scheduler are handled by the value iteration implementation.
+            STORM_LOG_INFO("Using value iteration instead of asynchronous Gauss-Seidel because an initial scheduler is given.");
+            return solveEquationsValueIteration(env, dir, x, b);
+        }
+
+        // By default, we can not provide any guarantee
+        SolverGuarantee guarantee = SolverGuarantee::None;
+        if (!this->hasUniqueSolution()) {
+            // The operator is monotone, so (asynchronous) in-place updates preserve the guarantee of the initial values.
+            if (maximize(dir)) {
+                this->createLowerBoundsVector(x);
+                guarantee = SolverGuarantee::LessOrEqual;
+            } else {
+                this->createUpperBoundsVector(x);
+                guarantee = SolverGuarantee::GreaterOrEqual;
+            }
+        } else if (this->hasCustomTerminationCondition()) {
+            if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
+                this->createLowerBoundsVector(x);
+                guarantee = SolverGuarantee::LessOrEqual;
+            } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
+                this->createUpperBoundsVector(x);
+                guarantee = SolverGuarantee::GreaterOrEqual;
+            }
+        }
+
+        if (!asyncGaussSeidelHelper) {
+            asyncGaussSeidelHelper = std::make_unique<storm::solver::helper::AsynchronousGaussSeidelHelper<ValueType>>(*this->A, false);
+            STORM_LOG_INFO("Processing the equation system in " << asyncGaussSeidelHelper->getNumberOfBlocks() << " block(s).");
+        }
+        uint64_t numIterations{0};
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, x, guarantee, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+        };
+        this->startMeasureProgress();
+        auto status = asyncGaussSeidelHelper->solve(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(),
+                                                    storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), dir, callback);
+        this->reportStatus(status, numIterations);
+
+        // If requested, we store the scheduler for retrieval.
+        if (this->isTrackSchedulerSet()) {
+            this->extractScheduler(x, b, dir, this->isUncertaintyRobust());
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    }
+}
+
+template<typename ValueType, typename SolutionType>
+uint64_t IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir,
+                                                                                                           std::vector<SolutionType>& x,
+                                                                                                           std::vector<ValueType> const& b) const {
+    if constexpr (!std::is_same_v<ValueType, double> || !std::is_same_v<SolutionType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Mixed precision value iteration requires a double precision equation system.");
+        return 0;
+    } else {
+        // Differences below this threshold can not be reliably detected in single precision.
+        float const minimalSinglePrecision = 1e-6f;
+
+        if (!singlePrecisionViOperator) {
+            singlePrecisionViOperator = std::make_shared<helper::ValueIterationOperator<float, false>>();
+            singlePrecisionViOperator->setMatrixBackwards(*this->A);
+            if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                singlePrecisionViOperator->setParallelApply(storm::utility::getNumberOfThreads());
+            }
+        }
+        if (this->choiceFixedForRowGroup) {
+            // Ignore those rows that are not selected
+            assert(this->initialScheduler);
+            auto callback = [&](uint64_t groupIndex, uint64_t localRowIndex) {
+                return this->choiceFixedForRowGroup->get(groupIndex) && this->initialScheduler->at(groupIndex) != localRowIndex;
+            };
+            singlePrecisionViOperator->setIgnoredRows(true, callback);
+        }
+
+        std::vector<float> singlePrecisionX(x.begin(), x.end());
+        std::vector<float> singlePrecisionB(b.begin(), b.end());
+        float precision = std::max(static_cast<float>(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision())),
+                                   minimalSinglePrecision);
+        storm::solver::helper::ValueIterationHelper<float, false> viHelper(singlePrecisionViOperator);
+        uint64_t numIterations{0};
+        auto viCallback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, false, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+        };
+        auto status = viHelper.VI(singlePrecisionX, singlePrecisionB, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), precision, dir,
+                                  viCallback, env.solver().minMax().getMultiplicationStyle());
+        STORM_LOG_INFO("Single precision value iteration " << (status == SolverStatus::Converged ? "converged" : "stopped") << " after " << numIterations
+                                                           << " iterations.");
+        x.assign(singlePrecisionX.begin(), singlePrecisionX.end());
+        if (!this->isCachingEnabled()) {
+            // Free the single precision copy before the double precision iterations start.
+            singlePrecisionViOperator.reset();
+        }
+        return numIterations;
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
     storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -584,15 +800,21 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
             this->showProgressIterative(numIterations);
             bool terminateEarly = this->hasCustomTerminationCondition() && this->getTerminationCondition().terminateNow(data.x, SolverGuarantee::LessOrEqual) &&
                                   this->getTerminationCondition().terminateNow(data.y, SolverGuarantee::GreaterOrEqual);
-            return this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            auto status = this->updateStatus(data.status, terminateEarly, numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if (status == SolverStatus::Aborted || status == SolverStatus::MaximalIterationsExceeded) {
+                this->solutionBounds.emplace(data.x, data.y);
+            }
+            return status;
         };
         std::optional<storm::storage::BitVector> optionalRelevantValues;
         if (this->hasRelevantValues()) {
             optionalRelevantValues = this->getRelevantValues();
         }
+        // With Gauss-Seidel style multiplications, parallel sweeps use bounds that other threads have already tightened in the current sweep.
+        bool const asynchronous = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
         this->startMeasureProgress();
         auto status = iiHelper.II(x, b, numIterations, env.solver().minMax().getRelativeTerminationCriterion(), prec, lowerBoundsCallback, upperBoundsCallback,
-                                  dir, iiCallback, optionalRelevantValues);
+                                  dir, iiCallback, optionalRelevantValues, asynchronous);
         this->reportStatus(status, numIterations);
 
         // If requested, we store the scheduler for retrieval.
@@ -633,9 +855,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         uint64_t numIterations{0};
         auto sviCallback = [&](typename helper::SoundValueIterationHelper<ValueType, false>::SVIData const& current) {
             this->showProgressIterative(numIterations);
-            return this->updateStatus(current.status,
-                                      this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
-                                      numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            auto status = this->updateStatus(current.status,
+                                             this->hasCustomTerminationCondition() && current.checkCustomTerminationCondition(this->getTerminationCondition()),
+                                             numIterations, env.solver().minMax().getMaximalNumberOfIterations());
+            if ((status == SolverStatus::Aborted || status == SolverStatus::MaximalIterationsExceeded) && current.a.has_value() && current.b.has_value()) {
+                auto& bounds = this->solutionBounds.emplace(std::vector<ValueType>(current.xy.first.size()), std::vector<ValueType>(current.xy.first.size()));
+                current.trySetLowerUpper(bounds.first, bounds.second);
+            }
+            return status;
         };
         this->startMeasureProgress();
         helper::SoundValueIterationHelper<ValueType, false> sviHelper(viOperator);
@@ -692,6 +919,15 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
         initialSched = impreciseSolver->getSchedulerChoices();
     }
     STORM_LOG_INFO("Found initial policy using Value Iteration. Starting Policy iteration now.");
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        // Unless specified otherwise, the induced equation systems are solved exactly using floating point guided rational reconstruction.
+        if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue() && env.solver().native().isMethodSetFromDefault()) {
+            Environment piEnv = env;
+            piEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            piEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::RationalReconstruction);
+            return performPolicyIteration(piEnv, dir, x, b, std::move(initialSched));
+        }
+    }
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
 
@@ -760,6 +996,10 @@ template<typename ValueType, typename SolutionType>
 void IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache() const {
     auxiliaryRowGroupVector.reset();
     viOperator.reset();
+    singlePrecisionViOperator.reset();
+    asyncGaussSeidelHelper.reset();
+    stateReordering.reset();
+    reorderedViOperator.reset();
     StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache();
 }
 
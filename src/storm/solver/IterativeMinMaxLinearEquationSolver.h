@@ -7,6 +7,8 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include "storm/solver/helper/AsynchronousGaussSeidelHelper.h"
+#include "storm/solver/helper/StateReordering.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 
 #include "storm/solver/SolverStatus.h"
@@ -57,8 +59,19 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
 
     bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsAsynchronousGaussSeidel(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
+                                               std::vector<ValueType> const& b) const;
+
+    /*!
+     * Performs value iteration on a single precision copy of the equation system, starting from and writing the result to x.
+     * This only yields a starting point for subsequent (double precision) iterations, the result is subject to single precision rounding errors.
+     * @return the number of performed iterations
+     */
+    uint64_t performSinglePrecisionValueIteration(Environment const& env, OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                  std::vector<ValueType> const& b) const;
 
     void setUpViOperator() const;
+    void setUpReorderedViOperator(storm::utility::permutation::OrderKind order, std::vector<ValueType> const& b) const;
     void extractScheduler(std::vector<SolutionType>& x, std::vector<ValueType> const& b, OptimizationDirection const& dir, bool robust,
                           bool updateX = true) const;
 
@@ -69,7 +82,11 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     // possibly cached data
     mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false, SolutionType>> viOperator;
+    mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<float, false>> singlePrecisionViOperator;  // only used for mixed precision VI
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable std::unique_ptr<storm::solver::helper::AsynchronousGaussSeidelHelper<ValueType>> asyncGaussSeidelHelper;
+    mutable std::unique_ptr<storm::solver::helper::StateReordering<ValueType>> stateReordering;  // only used if the states are reordered for VI
+    mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false, SolutionType>> reorderedViOperator;
 };
 
 }  // namespace solver
@@ -11,6 +11,7 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
@@ -29,6 +30,8 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    storm::utility::telemetry::Scope telemetryScope("linear-solver");
+    storm::utility::telemetry::setAttribute("unknowns", static_cast<uint64_t>(x.size()));
     return this->internalSolveEquations(env, x, b);
 }
 
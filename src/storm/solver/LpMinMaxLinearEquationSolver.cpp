@@ -3,9 +3,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/UnexpectedException.h"
-#include "storm/storage/expressions/Expression.h"
-#include "storm/storage/expressions/RationalLiteralExpression.h"
-#include "storm/storage/expressions/VariableExpression.h"
+#include "storm/storage/expressions/BinaryRelationType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
 
@@ -33,93 +31,145 @@ LpMinMaxLinearEquationSolver<ValueType>::LpMinMaxLinearEquationSolver(storm::sto
 }
 
 template<typename ValueType>
-bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
-                                                                     std::vector<ValueType> const& b) const {
-    STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
-                    "This min max solver does not support the selected technique.");
-
-    // Set up the LP solver
-    std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
-    solver->setOptimizationDirection(invert(dir));
-    // Create a variable for each row group
-    std::vector<storm::expressions::Expression> variableExpressions;
-    variableExpressions.reserve(this->A->getRowGroupCount());
+typename LpMinMaxLinearEquationSolver<ValueType>::VariableBounds LpMinMaxLinearEquationSolver<ValueType>::getVariableBounds() const {
+    VariableBounds result(this->A->getRowGroupCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
         if (this->hasLowerBound()) {
-            ValueType lowerBound = this->getLowerBound(rowGroup);
-            if (this->hasUpperBound()) {
-                ValueType upperBound = this->getUpperBound(rowGroup);
-                if (lowerBound == upperBound) {
-                    // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
-                    // efficient anyways.
-                    variableExpressions.push_back(solver->getConstant(lowerBound));
-                } else {
-                    STORM_LOG_ASSERT(lowerBound <= upperBound,
-                                     "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                    variableExpressions.emplace_back(
-                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
-                }
-            } else {
-                variableExpressions.emplace_back(
-                    solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
-            }
-        } else {
-            if (this->upperBound) {
-                variableExpressions.emplace_back(
-                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
-            } else {
-                variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
-            }
+            result[rowGroup].first = this->getLowerBound(rowGroup);
+        }
+        if (this->hasUpperBound()) {
+            result[rowGroup].second = this->getUpperBound(rowGroup);
         }
+        STORM_LOG_ASSERT(!result[rowGroup].first || !result[rowGroup].second || *result[rowGroup].first <= *result[rowGroup].second,
+                         "Lower Bound at row group " << rowGroup << " is " << *result[rowGroup].first << " which exceeds the upper bound "
+                                                     << *result[rowGroup].second << ".");
     }
-    solver->update();
+    return result;
+}
 
-    // Add a constraint for each row
+template<typename ValueType>
+std::vector<uint64_t> LpMinMaxLinearEquationSolver<ValueType>::getSelectedRows() const {
+    std::vector<uint64_t> result;
+    result.reserve(this->A->getRowCount());
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
-        // The rowgroup refers to the state number
-        uint64_t rowIndex, rowGroupEnd;
         if (this->choiceFixedForRowGroup && this->choiceFixedForRowGroup.get()[rowGroup]) {
-            rowIndex = this->A->getRowGroupIndices()[rowGroup] + this->getInitialScheduler()[rowGroup];
-            rowGroupEnd = rowIndex + 1;
+            result.push_back(this->A->getRowGroupIndices()[rowGroup] + this->getInitialScheduler()[rowGroup]);
         } else {
-            rowIndex = this->A->getRowGroupIndices()[rowGroup];
-            rowGroupEnd = this->A->getRowGroupIndices()[rowGroup + 1];
-        }
-        for (; rowIndex < rowGroupEnd; ++rowIndex) {
-            auto row = this->A->getRow(rowIndex);
-            std::vector<storm::expressions::Expression> summands;
-            summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
-            for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+            for (uint64_t row = this->A->getRowGroupIndices()[rowGroup]; row < this->A->getRowGroupIndices()[rowGroup + 1]; ++row) {
+                result.push_back(row);
             }
-            storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
-            if (minimize(dir)) {
-                rowConstraint = variableExpressions[rowGroup] <= rowConstraint;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void LpMinMaxLinearEquationSolver<ValueType>::createLp(OptimizationDirection dir, std::vector<ValueType> const& b, VariableBounds&& variableBounds,
+                                                       std::vector<uint64_t>&& selectedRows) const {
+    lpData = std::make_unique<LpData>();
+    lpData->solver = lpSolverFactory->createRaw("");
+    auto& solver = *lpData->solver;
+    solver.setOptimizationDirection(invert(dir));
+    lpData->direction = dir;
+
+    // Create a variable for each row group
+    uint64_t const numRowGroups = this->A->getRowGroupCount();
+    lpData->constants.resize(numRowGroups);
+    lpData->variables.resize(numRowGroups);
+    for (uint64_t rowGroup = 0; rowGroup < numRowGroups; ++rowGroup) {
+        auto const& [lowerBound, upperBound] = variableBounds[rowGroup];
+        if (lowerBound && upperBound && *lowerBound == *upperBound) {
+            // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
+            // efficient anyways.
+            lpData->constants[rowGroup] = *lowerBound;
+        } else {
+            lpData->variables[rowGroup] =
+                solver.addContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>());
+        }
+    }
+    solver.update();
+
+    // Add a constraint for each row. For minimizing, the constraint for row r of row group s is x_s <= b_r + sum_j A_rj * x_j. We bring all variables to
+    // the left-hand side, so that the constraint matrix corresponds to the (sparse) equation system and only the right-hand side depends on b.
+    auto const relationType = minimize(dir) ? storm::expressions::RelationType::LessOrEqual : storm::expressions::RelationType::GreaterOrEqual;
+    std::vector<RawLpConstraint<ValueType>> constraints;
+    constraints.reserve(selectedRows.size());
+    uint64_t rowGroup = 0;
+    for (auto const& rowIndex : selectedRows) {
+        while (rowIndex >= this->A->getRowGroupIndices()[rowGroup + 1]) {
+            ++rowGroup;
+        }
+        auto row = this->A->getRow(rowIndex);
+        RawLpConstraint<ValueType> constraint(relationType, storm::utility::zero<ValueType>(), row.getNumberOfEntries());
+        ValueType offset = storm::utility::zero<ValueType>();
+        ValueType diagonalCoefficient = storm::utility::one<ValueType>();
+        for (auto const& entry : row) {
+            if (entry.getColumn() == rowGroup) {
+                diagonalCoefficient -= entry.getValue();
+            } else if (lpData->constants[entry.getColumn()]) {
+                offset += entry.getValue() * lpData->constants[entry.getColumn()].value();
             } else {
-                rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
+                constraint.addToLhs(lpData->variables[entry.getColumn()], -entry.getValue());
             }
-            solver->addConstraint("", rowConstraint);
         }
+        if (lpData->constants[rowGroup]) {
+            offset -= diagonalCoefficient * lpData->constants[rowGroup].value();
+        } else if (!storm::utility::isZero(diagonalCoefficient)) {
+            constraint.addToLhs(lpData->variables[rowGroup], diagonalCoefficient);
+        }
+        if (constraint.lhsVariableIndices.empty()) {
+            // The constraint does not restrict any variable.
+            continue;
+        }
+        constraint.rhs = b[rowIndex] + offset;
+        lpData->constraintRows.push_back(rowIndex);
+        lpData->constraintOffsets.push_back(std::move(offset));
+        lpData->constraintRhs.push_back(constraint.rhs);
+        constraints.push_back(std::move(constraint));
     }
+    solver.addConstraints(constraints);
+
+    lpData->variableBounds = std::move(variableBounds);
+    lpData->selectedRows = std::move(selectedRows);
+}
+
+template<typename ValueType>
+bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const& b) const {
+    STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
+                    "This min max solver does not support the selected technique.");
+
+    // Set up the LP. If we have solved the same system before, we only need to update the right-hand sides.
+    auto variableBounds = getVariableBounds();
+    auto selectedRows = getSelectedRows();
+    if (lpData && lpData->direction == dir && lpData->solver->isConstraintRhsChangeSupported() && lpData->variableBounds == variableBounds &&
+        lpData->selectedRows == selectedRows) {
+        STORM_LOG_INFO("Re-using the LP of the previous call.");
+        for (uint64_t constraintIndex = 0; constraintIndex < lpData->constraintRows.size(); ++constraintIndex) {
+            ValueType rhs = b[lpData->constraintRows[constraintIndex]] + lpData->constraintOffsets[constraintIndex];
+            if (rhs != lpData->constraintRhs[constraintIndex]) {
+                lpData->solver->setConstraintRhs(constraintIndex, rhs);
+                lpData->constraintRhs[constraintIndex] = std::move(rhs);
+            }
+        }
+    } else {
+        createLp(dir, b, std::move(variableBounds), std::move(selectedRows));
+    }
+    auto const& solver = *lpData->solver;
 
     // Invoke optimization
-    solver->optimize();
-    STORM_LOG_THROW(!solver->isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
-    STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
-    STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
+    solver.optimize();
+    STORM_LOG_THROW(!solver.isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
+    STORM_LOG_THROW(!solver.isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
+    STORM_LOG_THROW(solver.isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
 
     // write the solution into the solution vector
-    STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
-    auto xIt = x.begin();
-    auto vIt = variableExpressions.begin();
-    for (; xIt != x.end(); ++xIt, ++vIt) {
-        auto const& vBaseExpr = vIt->getBaseExpression();
-        if (vBaseExpr.isVariable()) {
-            *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
+    STORM_LOG_ASSERT(x.size() == lpData->constants.size(), "Dimension of x-vector does not match number of varibales.");
+    for (uint64_t rowGroup = 0; rowGroup < x.size(); ++rowGroup) {
+        if (lpData->constants[rowGroup]) {
+            x[rowGroup] = lpData->constants[rowGroup].value();
         } else {
-            STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
-            *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
+            x[rowGroup] = solver.getContinuousValue(lpData->variables[rowGroup]);
         }
     }
 
@@ -144,11 +194,16 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
             }
         }
     }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
     return true;
 }
 
 template<typename ValueType>
 void LpMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+    lpData.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
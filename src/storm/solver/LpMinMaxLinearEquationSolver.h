@@ -1,5 +1,9 @@
 #pragma once
 
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/utility/solver.h"
@@ -29,7 +33,40 @@ class LpMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<V
                                                                    bool const& hasInitialScheduler = false) const override;
 
    private:
+    typedef std::vector<std::pair<std::optional<ValueType>, std::optional<ValueType>>> VariableBounds;
+
+    /*!
+     * Retrieves the lower and upper bounds (if any) for the value of each row group.
+     */
+    VariableBounds getVariableBounds() const;
+
+    /*!
+     * Retrieves the rows that are to be considered, i.e., all rows except those excluded by fixed choices.
+     */
+    std::vector<uint64_t> getSelectedRows() const;
+
+    /*!
+     * Builds the LP for the given direction and right-hand side.
+     */
+    void createLp(OptimizationDirection dir, std::vector<ValueType> const& b, VariableBounds&& variableBounds, std::vector<uint64_t>&& selectedRows) const;
+
     std::unique_ptr<storm::utility::solver::LpSolverFactory<ValueType>> lpSolverFactory;
+
+    // The LP of the most recent call. If the same system is solved again, we only update the right-hand sides, so that the solver is warm-started.
+    struct LpData {
+        std::unique_ptr<storm::solver::LpSolver<ValueType, true>> solver;
+        OptimizationDirection direction;
+        VariableBounds variableBounds;
+        std::vector<uint64_t> selectedRows;
+        // For each row group, the constant value if the value is fixed by the bounds and the index of the LP variable otherwise.
+        std::vector<std::optional<ValueType>> constants;
+        std::vector<uint64_t> variables;
+        // For each constraint, the row it encodes, the part of the right-hand side that does not stem from the vector b and the current right-hand side.
+        std::vector<uint64_t> constraintRows;
+        std::vector<ValueType> constraintOffsets;
+        std::vector<ValueType> constraintRhs;
+    };
+    mutable std::unique_ptr<LpData> lpData;
 };
 
 }  // namespace solver
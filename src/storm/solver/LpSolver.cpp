@@ -6,6 +6,8 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+
 namespace storm {
 namespace solver {
 
@@ -114,6 +116,23 @@ typename LpSolver<ValueType, RawMode>::Constant LpSolver<ValueType, RawMode>::ge
     }
 }
 
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    for (auto const& constraint : constraints) {
+        addConstraint("", constraint);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+bool LpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    return false;
+}
+
+template<typename ValueType, bool RawMode>
+void LpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t, ValueType const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This LP solver does not support changing the right-hand side of constraints.");
+}
+
 template<typename ValueType, bool RawMode>
 void LpSolver<ValueType, RawMode>::setOptimizationDirection(OptimizationDirection const& optimizationDirection) {
     if (optimizationDirection != this->optimizationDirection) {
@@ -229,6 +229,16 @@ class LpSolver {
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) = 0;
 
+    /*!
+     * Changes the coefficient with which the given (already registered) variable appears in the objective function.
+     * This allows to optimize the same model w.r.t. different objective functions without rebuilding it. Solvers that support it then use
+     * the previously found solution as a starting point. Note that the change is not reverted by pop().
+     *
+     * @param variable The variable.
+     * @param objectiveFunctionCoefficient The new coefficient with which the variable appears in the objective function.
+     */
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) = 0;
+
     /*!
      * Retrieves an expression that characterizes the given constant value.
      * In RawMode, this just returns the given value
@@ -253,6 +263,29 @@ class LpSolver {
      */
     virtual void addConstraint(std::string const& name, Constraint const& constraint) = 0;
 
+    /*!
+     * Adds the given (unnamed) constraints to the LP problem. Solvers that support it pass all constraints to the backend at once, which is
+     * considerably faster than adding them one by one.
+     *
+     * @param constraints The constraints, each of which must be a linear (in)equality over the registered variables.
+     */
+    virtual void addConstraints(std::vector<Constraint> const& constraints);
+
+    /*!
+     * Retrieves whether the solver supports changing the right-hand side of constraints via setConstraintRhs.
+     */
+    virtual bool isConstraintRhsChangeSupported() const;
+
+    /*!
+     * Changes the right-hand side of a (non-strict) constraint that has already been added. The relation of the constraint is kept.
+     * This allows to re-optimize the same model for different right-hand sides without rebuilding it. Solvers that support it then start from the
+     * previously found basis, which remains dual feasible, i.e., re-optimizing is a warm-started dual simplex.
+     *
+     * @param constraintIndex The index of the constraint, where constraints are indexed in the order in which they have been added, starting at 0.
+     * @param rhs The new right-hand side.
+     */
+    virtual void setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs);
+
     /*!
      * Adds the given indicator constraint to the LP problem:
      * "If indicatorVariable == indicatorValue, then constraint"
@@ -15,6 +15,7 @@
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/macros.h"
 
 namespace storm::solver {
@@ -36,6 +37,9 @@ bool MinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquations(Environ
     STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
+    storm::utility::telemetry::Scope telemetryScope("minmax-solver");
+    storm::utility::telemetry::setAttribute("unknowns", static_cast<uint64_t>(x.size()));
+    solutionBounds.reset();
     return internalSolveEquations(env, d, x, b);
 }
 
@@ -112,6 +116,17 @@ std::vector<uint_fast64_t> const& MinMaxLinearEquationSolver<ValueType, Solution
     return schedulerChoices.get();
 }
 
+template<typename ValueType, typename SolutionType>
+bool MinMaxLinearEquationSolver<ValueType, SolutionType>::hasSolutionBounds() const {
+    return solutionBounds.has_value();
+}
+
+template<typename ValueType, typename SolutionType>
+std::pair<std::vector<SolutionType>, std::vector<SolutionType>> const& MinMaxLinearEquationSolver<ValueType, SolutionType>::getSolutionBounds() const {
+    STORM_LOG_THROW(hasSolutionBounds(), storm::exceptions::IllegalFunctionCallException, "Cannot retrieve solution bounds, because none are available.");
+    return solutionBounds.value();
+}
+
 template<typename ValueType, typename SolutionType>
 void MinMaxLinearEquationSolver<ValueType, SolutionType>::setCachingEnabled(bool value) {
     if (cachingEnabled && !value) {
@@ -239,7 +254,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType, SolutionType>> GeneralMinM
         auto method = env.solver().minMax().getMethod();
         if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
             method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-            method == MinMaxMethod::ViToPi) {
+            method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsyncGaussSeidel) {
             result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>>(
                 std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
         } else if (method == MinMaxMethod::Topological) {
@@ -263,7 +278,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsyncGaussSeidel) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(
             std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
     } else if (method == MinMaxMethod::LinearProgramming) {
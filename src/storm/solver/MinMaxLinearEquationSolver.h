@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -137,6 +138,18 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<SolutionType> {
      */
     std::vector<uint_fast64_t> const& getSchedulerChoices() const;
 
+    /*!
+     * Retrieves whether the last call to solveEquations was interrupted (e.g. by a timeout, a termination signal or the maximal number of iterations)
+     * before converging but a sound method could still provide lower and upper bounds on the solution.
+     */
+    bool hasSolutionBounds() const;
+
+    /*!
+     * Retrieves the lower (first) and upper (second) bounds on the solution that were known when the last call to solveEquations was interrupted.
+     * Note: it is only legal to call this function if such bounds are available.
+     */
+    std::pair<std::vector<SolutionType>, std::vector<SolutionType>> const& getSolutionBounds() const;
+
     /*!
      * Sets whether some of the generated data during solver calls should be cached.
      * This possibly decreases the runtime of subsequent calls but also increases memory consumption.
@@ -200,6 +213,9 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<SolutionType> {
     /// The scheduler choices that induce the optimal values (if they could be successfully generated).
     mutable boost::optional<std::vector<uint_fast64_t>> schedulerChoices;
 
+    /// Lower and upper bounds on the solution in case the last solver call was interrupted before converging.
+    mutable std::optional<std::pair<std::vector<SolutionType>, std::vector<SolutionType>>> solutionBounds;
+
     /// A scheduler that can be used by solvers that require a valid initial scheduler.
     boost::optional<std::vector<uint_fast64_t>> initialScheduler;
 
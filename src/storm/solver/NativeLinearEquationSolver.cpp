@@ -1,22 +1,30 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
 #include <limits>
+#include <type_traits>
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/helper/IntervalterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/RationalSearchHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/ValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -56,6 +64,9 @@ void NativeLinearEquationSolver<ValueType>::setUpViOperator() const {
     if (!viOperator) {
         viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, true>>();
         viOperator->setMatrixBackwards(*this->A);
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            viOperator->setParallelApply(storm::utility::getNumberOfThreads());
+        }
     }
 }
 
@@ -373,16 +384,41 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
         }
     }
 
+    // Checkpoints are only supported for floating point values, which can be written to disk as they are.
+    std::optional<helper::SolverCheckpoint> checkpoint;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        checkpoint = helper::SolverCheckpoint::create(env, "native-power", *this->A, b, std::nullopt,
+                                                      storm::utility::convertNumber<double>(env.solver().native().getPrecision()));
+    }
+
     storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
     uint64_t numIterations{0};
     auto viCallback = [&](SolverStatus const& current) {
         this->showProgressIterative(numIterations);
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (checkpoint) {
+                checkpoint->update(x, numIterations);
+            }
+        }
         return this->updateStatus(current, x, guarantee, numIterations, env.solver().native().getMaximalNumberOfIterations());
     };
     this->startMeasureProgress();
-    auto status = viHelper.VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
-                              storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
-                              env.solver().native().getPowerMethodMultiplicationStyle());
+    SolverStatus status = SolverStatus::InProgress;
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpoint) {
+            status = checkpoint->restore(x, numIterations);
+        }
+    }
+    if (status == SolverStatus::InProgress) {
+        status = viHelper.VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                             storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, viCallback,
+                             env.solver().native().getPowerMethodMultiplicationStyle());
+    }
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (checkpoint && status == SolverStatus::Converged) {
+            checkpoint->finish(x, numIterations);
+        }
+    }
 
     this->reportStatus(status, numIterations);
 
@@ -572,12 +608,122 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environ
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsAsynchronousGaussSeidel(Environment const& env, std::vector<ValueType>& x,
+                                                                                  std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Asynchronous Gauss-Seidel)");
+    if (!asyncGaussSeidelHelper) {
+        asyncGaussSeidelHelper = std::make_unique<storm::solver::helper::AsynchronousGaussSeidelHelper<ValueType>>(*this->A, true);
+        STORM_LOG_INFO("Processing the equation system in " << asyncGaussSeidelHelper->getNumberOfBlocks() << " block(s).");
+    }
+
+    uint64_t numIterations{0};
+    uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+    auto callback = [&](SolverStatus const& current) {
+        this->showProgressIterative(numIterations);
+        return this->updateStatus(current, x, SolverGuarantee::None, numIterations, maxIter);
+    };
+    this->startMeasureProgress();
+    auto status = asyncGaussSeidelHelper->solve(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                                storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), {}, callback);
+
+    this->reportStatus(status, numIterations);
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsKrylov(Environment const& env, NativeLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                                                 std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (" << toString(method) << ")");
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (!krylovHelper) {
+            krylovHelper = std::make_unique<storm::solver::helper::KrylovHelper<ValueType>>(*this->A);
+        }
+
+        uint64_t numIterations{0};
+        uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+        auto callback = [&](SolverStatus const& current) {
+            this->showProgressIterative(numIterations);
+            return this->updateStatus(current, x, SolverGuarantee::None, numIterations, maxIter);
+        };
+        this->startMeasureProgress();
+        bool const relative = env.solver().native().getRelativeTerminationCriterion();
+        ValueType const precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+        SolverStatus status;
+        if (method == NativeLinearEquationSolverMethod::Bicgstab) {
+            status = krylovHelper->bicgstab(x, b, numIterations, relative, precision, callback);
+        } else {
+            STORM_LOG_ASSERT(method == NativeLinearEquationSolverMethod::Gmres, "Unexpected method.");
+            status = krylovHelper->gmres(x, b, numIterations, relative, precision, env.solver().native().getRestartIterationCount(), callback);
+        }
+
+        this->reportStatus(status, numIterations);
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The method '" << toString(method) << "' is only supported for floating point numbers.");
+        return false;
+    }
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalReconstruction(Environment const& env, std::vector<ValueType>& x,
+                                                                                 std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Rational reconstruction)");
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        if (!rationalReconstructionHelper) {
+            rationalReconstructionHelper = std::make_unique<storm::solver::helper::RationalReconstructionHelper>(*this->A);
+        }
+
+        SolverStatus status = SolverStatus::Aborted;
+        if (rationalReconstructionHelper->isFactorized()) {
+            uint64_t numIterations{0};
+            uint64_t const maxIter = env.solver().native().getMaximalNumberOfIterations();
+            auto callback = [&](SolverStatus const& current) {
+                this->showProgressIterative(numIterations);
+                return this->updateStatus(current, x, SolverGuarantee::None, numIterations, maxIter);
+            };
+            this->startMeasureProgress();
+            status = rationalReconstructionHelper->solve(x, b, numIterations, callback);
+            this->reportStatus(status, numIterations);
+        }
+
+        if (status != SolverStatus::Converged && status != SolverStatus::TerminatedEarly && !storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Rational reconstruction failed. Falling back to an exact LU factorization.");
+            storm::solver::EigenLinearEquationSolver<ValueType> fallbackSolver(*this->A);
+            if (fallbackSolver.solveEquations(env, x, b)) {
+                status = SolverStatus::Converged;
+            }
+        }
+
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
+
+        return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The method '" << toString(NativeLinearEquationSolverMethod::RationalReconstruction) << "' is only supported for exact numbers.");
+        return false;
+    }
+}
+
 template<typename ValueType>
 NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
     // Adjust the method if none was specified and we want exact or sound computations
     auto method = env.solver().native().getMethod();
 
-    if (isExactMode && method != NativeLinearEquationSolverMethod::RationalSearch) {
+    if (isExactMode && method != NativeLinearEquationSolverMethod::RationalSearch && method != NativeLinearEquationSolverMethod::RationalReconstruction) {
         if (env.solver().native().isMethodSetFromDefault()) {
             method = NativeLinearEquationSolverMethod::RationalSearch;
             STORM_LOG_INFO(
@@ -595,6 +741,10 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
                 "Selecting '" + toString(method) +
                 "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
         } else {
+            // There is no sound variant of the asynchronous method, so we do not silently return an uncertified result.
+            STORM_LOG_THROW(method != NativeLinearEquationSolverMethod::AsyncGaussSeidel, storm::exceptions::InvalidEnvironmentException,
+                            "The selected solution method " << toString(method)
+                                                            << " does not guarantee sound results. Please select a sound method, e.g., interval iteration.");
             STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
         }
     }
@@ -603,7 +753,13 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
 
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    if (storm::utility::telemetry::isRecording()) {
+        storm::utility::telemetry::setAttribute("method", toString(method));
+        storm::utility::telemetry::setAttribute("rows", this->A->getRowCount());
+        storm::utility::telemetry::setAttribute("entries", this->A->getEntryCount());
+    }
+    switch (method) {
         case NativeLinearEquationSolverMethod::SOR:
             return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
         case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -622,6 +778,13 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
+        case NativeLinearEquationSolverMethod::AsyncGaussSeidel:
+            return this->solveEquationsAsynchronousGaussSeidel(env, x, b);
+        case NativeLinearEquationSolverMethod::Bicgstab:
+        case NativeLinearEquationSolverMethod::Gmres:
+            return this->solveEquationsKrylov(env, method, x, b);
+        case NativeLinearEquationSolverMethod::RationalReconstruction:
+            return this->solveEquationsRationalReconstruction(env, x, b);
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
     return false;
@@ -632,7 +795,7 @@ LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEqua
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
     if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration ||
         method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch ||
-        method == NativeLinearEquationSolverMethod::IntervalIteration) {
+        method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::AsyncGaussSeidel) {
         return LinearEquationSolverProblemFormat::FixedPointSystem;
     } else {
         return LinearEquationSolverProblemFormat::EquationSystem;
@@ -659,6 +822,9 @@ void NativeLinearEquationSolver<ValueType>::clearCache() const {
     walkerChaeData.reset();
     multiplier.reset();
     viOperator.reset();
+    asyncGaussSeidelHelper.reset();
+    krylovHelper.reset();
+    rationalReconstructionHelper.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
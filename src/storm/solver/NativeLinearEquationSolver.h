@@ -7,6 +7,9 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/AsynchronousGaussSeidelHelper.h"
+#include "storm/solver/helper/KrylovHelper.h"
+#include "storm/solver/helper/RationalReconstructionHelper.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 
@@ -72,6 +75,10 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsAsynchronousGaussSeidel(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsKrylov(storm::Environment const& env, NativeLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                      std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsRationalReconstruction(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     void setUpViOperator() const;
 
@@ -114,6 +121,15 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
         std::vector<ValueType> newX;
     };
     mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+
+    // The partitioning of the matrix into blocks used by the asynchronous Gauss-Seidel method.
+    mutable std::unique_ptr<storm::solver::helper::AsynchronousGaussSeidelHelper<ValueType>> asyncGaussSeidelHelper;
+
+    // The (preconditioned) Krylov subspace methods.
+    mutable std::unique_ptr<storm::solver::helper::KrylovHelper<ValueType>> krylovHelper;
+
+    // The floating point factorization used to solve exactly via iterative refinement and rational reconstruction.
+    mutable std::unique_ptr<storm::solver::helper::RationalReconstructionHelper> rationalReconstructionHelper;
 };
 
 template<typename ValueType>
@@ -24,6 +24,8 @@ std::string toString(MinMaxMethod m) {
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::AsyncGaussSeidel:
+            return "asyncgaussseidel";
     }
     return "invalid";
 }
@@ -34,6 +36,8 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Cuda:
+            return "Cuda";
     }
     return "invalid";
 }
@@ -44,6 +48,8 @@ std::string toString(GameMethod m) {
             return "valueiteration";
         case GameMethod::PolicyIteration:
             return "PolicyIteration";
+        case GameMethod::IntervalIteration:
+            return "IntervalIteration";
     }
     return "invalid";
 }
@@ -72,6 +78,18 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "unif";
+        case CtmcTransientMethod::AdaptiveUniformization:
+            return "adaptive";
+        case CtmcTransientMethod::Krylov:
+            return "krylov";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -134,6 +152,14 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "IntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
+        case NativeLinearEquationSolverMethod::AsyncGaussSeidel:
+            return "AsyncGaussSeidel";
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return "BiCGSTAB";
+        case NativeLinearEquationSolverMethod::Gmres:
+            return "GMRES";
+        case NativeLinearEquationSolverMethod::RationalReconstruction:
+            return "RationalReconstruction";
     }
     return "invalid";
 }
@@ -6,17 +6,20 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
-    ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
+                              SoundValueIteration, OptimisticValueIteration, ViToPi, Acyclic,
+                              AsyncGaussSeidel) ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Cuda)
+    ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, IntervalIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+                ExtendEnumsWithSelectionField(CtmcTransientMethod, Uniformization, AdaptiveUniformization, Krylov)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3, Soplex)
                     ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
                         ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
-                                                          OptimisticValueIteration, IntervalIteration, RationalSearch)
+                                                          OptimisticValueIteration, IntervalIteration, RationalSearch, AsyncGaussSeidel, Bicgstab,
+                                                          Gmres, RationalReconstruction)
                                 ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
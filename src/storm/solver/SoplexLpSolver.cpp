@@ -94,12 +94,79 @@ typename SoplexLpSolver<ValueType, RawMode>::Variable SoplexLpSolver<ValueType,
     return resultVar;
 }
 
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    uint64_t varIndex;
+    if constexpr (RawMode) {
+        varIndex = variable;
+    } else {
+        STORM_LOG_THROW(variableToIndexMap.count(variable) != 0, storm::exceptions::InvalidAccessException,
+                        "Accessing unknown variable '" << variable.getName() << "'.");
+        varIndex = variableToIndexMap.at(variable);
+    }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.changeObjRational(varIndex, to_soplex_rational(objectiveFunctionCoefficient));
+    } else {
+        solver.changeObjReal(varIndex, objectiveFunctionCoefficient);
+    }
+    // The previous solution is no longer valid.
+    primalSolution = TypedDVector(0);
+    this->currentModelHasBeenOptimized = false;
+}
+
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name, Constraint const& constraint) {
     if constexpr (!RawMode) {
         STORM_LOG_TRACE("Adding constraint " << (name == "" ? std::to_string(nextConstraintIndex) : name) << " to SoplexLpSolver:\n"
                                              << "\t" << constraint);
     }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowRational(createRow(constraint));
+    } else {
+        solver.addRowReal(createRow(constraint));
+    }
+}
+
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const& constraints) {
+    // Pass all rows to soplex at once.
+    TypedLPRowSet rows(constraints.size());
+    for (auto const& constraint : constraints) {
+        rows.add(createRow(constraint));
+    }
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        solver.addRowsRational(rows);
+    } else {
+        solver.addRowsReal(rows);
+    }
+}
+
+template<typename ValueType, bool RawMode>
+bool SoplexLpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    return true;
+}
+
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) {
+    STORM_LOG_ASSERT(constraintIndex < constraintRelationTypes.size(), "Invalid constraint index " << constraintIndex << ".");
+    // Soplex keeps the basis of the previous optimization, so the next optimization is warm-started.
+    auto const relationType = constraintRelationTypes[constraintIndex];
+    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
+        soplex::Rational const value = to_soplex_rational(rhs);
+        soplex::Rational const ratInf(soplex::infinity);
+        solver.changeRangeRational(constraintIndex, relationType == storm::expressions::RelationType::LessOrEqual ? -ratInf : value,
+                                   relationType == storm::expressions::RelationType::GreaterOrEqual ? ratInf : value);
+    } else {
+        solver.changeRangeReal(constraintIndex, relationType == storm::expressions::RelationType::LessOrEqual ? -soplex::infinity : rhs,
+                               relationType == storm::expressions::RelationType::GreaterOrEqual ? soplex::infinity : rhs);
+    }
+    // The previous solution is no longer valid.
+    primalSolution = TypedDVector(0);
+    this->currentModelHasBeenOptimized = false;
+}
+
+template<typename ValueType, bool RawMode>
+typename SoplexLpSolver<ValueType, RawMode>::TypedLPRow SoplexLpSolver<ValueType, RawMode>::createRow(Constraint const& constraint) {
     using SoplexValueType = std::conditional_t<std::is_same_v<ValueType, storm::RationalNumber>, soplex::Rational, soplex::Real>;
     // Extract constraint data
     SoplexValueType rhs;
@@ -167,11 +234,8 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const& name,
         default:
             STORM_LOG_ASSERT(false, "Illegal operator in LP solver constraint.");
     }
-    if constexpr (std::is_same_v<ValueType, storm::RationalNumber>) {
-        solver.addRowRational(LPRowRational(l, row, r));
-    } else {
-        solver.addRowReal(LPRow(l, row, r));
-    }
+    constraintRelationTypes.push_back(relationType);
+    return TypedLPRow(l, row, r);
 }
 
 template<typename ValueType, bool RawMode>
@@ -325,6 +389,12 @@ typename SoplexLpSolver<ValueType, RawMode>::Variable SoplexLpSolver<ValueType,
                                                           "requires this support. Please choose a version of support with Soplex support.";
 }
 
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::update() const {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
@@ -337,6 +407,24 @@ void SoplexLpSolver<ValueType, RawMode>::addConstraint(std::string const&, Const
                                                           "requires this support. Please choose a version of support with Soplex support.";
 }
 
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::addConstraints(std::vector<Constraint> const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
+template<typename ValueType, bool RawMode>
+bool SoplexLpSolver<ValueType, RawMode>::isConstraintRhsChangeSupported() const {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
+template<typename ValueType, bool RawMode>
+void SoplexLpSolver<ValueType, RawMode>::setConstraintRhs(uint64_t, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of support with Soplex support.";
+}
+
 template<typename ValueType, bool RawMode>
 void SoplexLpSolver<ValueType, RawMode>::addIndicatorConstraint(std::string const&, Variable, bool, Constraint const&) {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Soplex. Yet, a method was called that "
@@ -58,14 +58,20 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
     // Methods to add variables.
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
 
     // Methods to incorporate recent changes.
     virtual void update() const override;
 
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, Constraint const& constraint) override;
+    virtual void addConstraints(std::vector<Constraint> const& constraints) override;
     virtual void addIndicatorConstraint(std::string const& name, Variable indicatorVariable, bool indicatorValue, Constraint const& constraint) override;
 
+    // Methods to change constraints
+    virtual bool isConstraintRhsChangeSupported() const override;
+    virtual void setConstraintRhs(uint64_t constraintIndex, ValueType const& rhs) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -95,6 +101,13 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
 #ifdef STORM_HAVE_SOPLEX
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DVector, soplex::DVectorRational> TypedDVector;
     typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::DSVector, soplex::DSVectorRational> TypedDSVector;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRowReal, soplex::LPRowRational> TypedLPRow;
+    typedef std::conditional_t<std::is_same_v<ValueType, double>, soplex::LPRowSetReal, soplex::LPRowSetRational> TypedLPRowSet;
+
+    /*!
+     * Translates the given constraint into a row and records its relation type.
+     */
+    TypedLPRow createRow(Constraint const& constraint);
 
     uint64_t nextVariableIndex = 0;
     uint64_t nextConstraintIndex = 0;
@@ -110,6 +123,8 @@ class SoplexLpSolver : public LpSolver<ValueType, RawMode> {
     TypedDSVector variables = TypedDSVector(0);
     // A mapping from variables to their indices.
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+    // The relation types of the constraints (in the order in which they were added).
+    std::vector<storm::expressions::RelationType> constraintRelationTypes;
 #endif
 };
 }  // namespace storm::solver
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "storm/solver/StandardGameSolver.h"
 
+#include <algorithm>
+
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
@@ -9,17 +11,168 @@
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+template<typename ValueType>
+bool isBetter(bool maximize, ValueType const& value, ValueType const& other) {
+    return maximize ? value > other : value < other;
+}
+
+/*!
+ * Backend for value iteration on the flat game. The row groups of both players are processed within the same sweep, where row groups with an
+ * index below the number of player 1 states belong to player 1.
+ */
+template<typename ValueType>
+class GameViBackend {
+   public:
+    GameViBackend(uint64_t numberOfPlayer1States, bool player1Maximizes, bool player2Maximizes, ValueType const& precision, bool relative)
+        : numberOfPlayer1States(numberOfPlayer1States),
+          player1Maximizes(player1Maximizes),
+          player2Maximizes(player2Maximizes),
+          precision(precision),
+          relative(relative) {
+        // Intentionally left empty.
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(ValueType&& value, uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        if (isBetter(rowGroup < numberOfPlayer1States ? player1Maximizes : player2Maximizes, value, best)) {
+            best = std::move(value);
+        }
+    }
+
+    void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if (isConverged) {
+            if (relative) {
+                isConverged = storm::utility::abs<ValueType>(currValue - best) <= storm::utility::abs<ValueType>(precision * currValue);
+            } else {
+                isConverged = storm::utility::abs<ValueType>(currValue - best) <= precision;
+            }
+        }
+        currValue = std::move(best);
+    }
+
+    void endOfIteration() const {
+        // Intentionally left empty.
+    }
+
+    void mergeChunk(GameViBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    uint64_t const numberOfPlayer1States;
+    bool const player1Maximizes, player2Maximizes;
+    ValueType const precision;
+    bool const relative;
+    ValueType best;
+    bool isConverged{true};
+};
+
+/*!
+ * Backend for interval iteration on the flat game, i.e., lower and upper bounds are updated simultaneously. If requested, the choices that are optimal
+ * w.r.t. the lower bounds are stored (as local choice indices for each row group).
+ */
+template<typename ValueType>
+class GameIiBackend {
+   public:
+    GameIiBackend(uint64_t numberOfPlayer1States, bool player1Maximizes, bool player2Maximizes, std::vector<uint64_t> const& rowGroupIndices,
+                  std::vector<uint64_t>* choices)
+        : numberOfPlayer1States(numberOfPlayer1States),
+          player1Maximizes(player1Maximizes),
+          player2Maximizes(player2Maximizes),
+          rowGroupIndices(rowGroupIndices),
+          choices(choices) {
+        // Intentionally left empty.
+    }
+
+    void startNewIteration() {
+        // Intentionally left empty.
+    }
+
+    void firstRow(std::pair<ValueType, ValueType>&& value, [[maybe_unused]] uint64_t rowGroup, uint64_t row) {
+        lowerBest = std::move(value.first);
+        upperBest = std::move(value.second);
+        bestRow = row;
+    }
+
+    void nextRow(std::pair<ValueType, ValueType>&& value, uint64_t rowGroup, uint64_t row) {
+        bool maximize = rowGroup < numberOfPlayer1States ? player1Maximizes : player2Maximizes;
+        if (isBetter(maximize, value.first, lowerBest)) {
+            lowerBest = std::move(value.first);
+            bestRow = row;
+        }
+        if (isBetter(maximize, value.second, upperBest)) {
+            upperBest = std::move(value.second);
+        }
+    }
+
+    void applyUpdate(ValueType& lowerCurr, ValueType& upperCurr, uint64_t rowGroup) {
+        // The bounds are only ever improved, which keeps them sound even if the operator is applied in parallel.
+        lowerCurr = std::max(lowerCurr, lowerBest);
+        upperCurr = std::min(upperCurr, upperBest);
+        if (choices) {
+            (*choices)[rowGroup] = bestRow - rowGroupIndices[rowGroup];
+        }
+    }
+
+    void endOfIteration() const {
+        // Intentionally left empty.
+    }
+
+    void mergeChunk([[maybe_unused]] GameIiBackend const& chunkBackend) {
+        // Intentionally left empty. Each chunk writes the choices of its own row groups.
+    }
+
+    bool constexpr converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    uint64_t const numberOfPlayer1States;
+    bool const player1Maximizes, player2Maximizes;
+    std::vector<uint64_t> const& rowGroupIndices;
+    std::vector<uint64_t>* choices;
+    ValueType lowerBest, upperBest;
+    uint64_t bestRow;
+};
+}  // namespace
+
 template<typename ValueType>
 StandardGameSolver<ValueType>::StandardGameSolver(storm::storage::SparseMatrix<storm::storage::sparse::state_type> const& player1Matrix,
                                                   storm::storage::SparseMatrix<ValueType> const& player2Matrix,
@@ -92,10 +245,17 @@ GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee exact results.");
         }
-    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration) {
+    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration && method != GameMethod::IntervalIteration) {
         if (env.solver().game().isMethodSetFromDefault()) {
-            method = GameMethod::PolicyIteration;
-            STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
+            // Interval iteration needs bounds on the solution to start from.
+            if (this->hasLowerBound() && this->hasUpperBound()) {
+                method = GameMethod::IntervalIteration;
+                STORM_LOG_INFO(
+                    "Changing game method to interval-iteration to guarantee sound results. If you want to override this, specify another method.");
+            } else {
+                method = GameMethod::PolicyIteration;
+                STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
+            }
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee sound results.");
         }
@@ -109,11 +269,20 @@ bool StandardGameSolver<ValueType>::solveGame(Environment const& env, Optimizati
                                               std::vector<uint64_t>* player2Choices) const {
     auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value || env.solver().isForceExact());
     STORM_LOG_INFO("Solving stochastic two player game over " << x.size() << " states using " << toString(method) << ".");
+    storm::utility::telemetry::Scope telemetryScope("game-solver");
+    if (storm::utility::telemetry::isRecording()) {
+        storm::utility::telemetry::setAttribute("method", toString(method));
+        storm::utility::telemetry::setAttribute("unknowns", static_cast<uint64_t>(x.size()));
+        storm::utility::telemetry::setAttribute("rows", player2Matrix.getRowCount());
+        storm::utility::telemetry::setAttribute("entries", player2Matrix.getEntryCount());
+    }
     switch (method) {
         case GameMethod::ValueIteration:
             return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         case GameMethod::PolicyIteration:
             return solveGamePolicyIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::IntervalIteration:
+            return solveGameIntervalIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -349,38 +518,43 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
         this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
     }
 
-    std::vector<ValueType>* newX = auxiliaryP1RowGroupVector.get();
-    std::vector<ValueType>* currentX = &x;
-
     // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
     uint64_t iterations = 0;
 
     SolverStatus status = SolverStatus::InProgress;
-    while (status == SolverStatus::InProgress) {
-        multiplyAndReduce(
-            env, player1Dir, player2Dir, *currentX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newX,
-            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get()) : nullptr,
-            trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get()) : nullptr);
+    if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() &&
+        !trackSchedulersInValueIteration) {
+        status = performFlatValueIteration(env, player1Dir, player2Dir, x, b, iterations);
+    } else {
+        std::vector<ValueType>* newX = auxiliaryP1RowGroupVector.get();
+        std::vector<ValueType>* currentX = &x;
+
+        while (status == SolverStatus::InProgress) {
+            multiplyAndReduce(
+                env, player1Dir, player2Dir, *currentX, &b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newX,
+                trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player1Choices : &this->player1SchedulerChoices.get()) : nullptr,
+                trackSchedulersInValueIteration ? (trackingSchedulersInProvidedStorage ? player2Choices : &this->player2SchedulerChoices.get()) : nullptr);
+
+            // Determine whether the method converged.
+            if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+                status = SolverStatus::Converged;
+            }
 
-        // Determine whether the method converged.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
-            status = SolverStatus::Converged;
+            // Update environment variables.
+            std::swap(currentX, newX);
+            ++iterations;
+            status = this->updateStatus(status, *currentX, SolverGuarantee::None, iterations, maxIter);
         }
 
-        // Update environment variables.
-        std::swap(currentX, newX);
-        ++iterations;
-        status = this->updateStatus(status, *currentX, SolverGuarantee::None, iterations, maxIter);
+        // If we performed an odd number of iterations, we need to swap the x and currentX, because the newest result
+        // is currently stored in currentX, but x is the output vector.
+        if (currentX == auxiliaryP1RowGroupVector.get()) {
+            std::swap(x, *currentX);
+        }
     }
 
     this->reportStatus(status, iterations);
 
-    // If we performed an odd number of iterations, we need to swap the x and currentX, because the newest result
-    // is currently stored in currentX, but x is the output vector.
-    if (currentX == auxiliaryP1RowGroupVector.get()) {
-        std::swap(x, *currentX);
-    }
-
     // If requested, we store the scheduler for retrieval.
     if (trackSchedulers && this->hasUniqueSolution()) {
         if (trackingSchedulersInProvidedStorage) {
@@ -400,6 +574,265 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
 }
 
+template<typename ValueType>
+SolverStatus StandardGameSolver<ValueType>::performFlatValueIteration(Environment const& env, OptimizationDirection player1Dir,
+                                                                      OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                                                      std::vector<ValueType> const& b, uint64_t& iterations) const {
+    setUpViOperator();
+    uint64_t const numberOfPlayer1States = this->getNumberOfPlayer1States();
+    std::vector<ValueType> const offsets = getFlatGameOffsets(b);
+
+    // The values of the player 2 states are appended to the values of the player 1 states.
+    std::vector<ValueType> flatX = x;
+    flatX.resize(flatGameMatrix->getRowGroupCount(), storm::utility::zero<ValueType>());
+
+    GameViBackend<ValueType> backend(numberOfPlayer1States, maximize(player1Dir), maximize(player2Dir),
+                                     storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision()),
+                                     env.solver().game().getRelativeTerminationCriterion());
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        if (viOperator->applyInPlace(flatX, offsets, backend)) {
+            status = SolverStatus::Converged;
+        }
+        ++iterations;
+        bool terminateEarly = this->hasCustomTerminationCondition() &&
+                              this->getTerminationCondition().terminateNow([&flatX](uint64_t const& i) { return flatX[i]; }, SolverGuarantee::None);
+        status = this->updateStatus(status, terminateEarly, iterations, maxIter);
+    }
+    x.assign(flatX.begin(), flatX.begin() + numberOfPlayer1States);
+    return status;
+}
+
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                               std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                               std::vector<uint64_t>* player1Choices, std::vector<uint64_t>* player2Choices) const {
+    STORM_LOG_THROW(this->hasLowerBound() && this->hasUpperBound(), storm::exceptions::UnmetRequirementException,
+                    "Interval iteration for games requires a lower and an upper bound on the solution.");
+    setUpViOperator();
+    if (!multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
+    if (!auxiliaryP2RowGroupVector) {
+        auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+    }
+    uint64_t const numberOfPlayer1States = this->getNumberOfPlayer1States();
+    std::vector<ValueType> const offsets = getFlatGameOffsets(b);
+
+    // Initialize the bounds of the player 1 states. The bounds of the player 2 states are derived from them such that they are sound, too.
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
+    xy.first.resize(numberOfPlayer1States);
+    xy.second.resize(numberOfPlayer1States);
+    this->createLowerBoundsVector(xy.first);
+    this->createUpperBoundsVector(xy.second);
+    for (auto* bounds : {&xy.first, &xy.second}) {
+        multiplierPlayer2Matrix->multiplyAndReduce(env, player2Dir, *bounds, &b, *auxiliaryP2RowGroupVector);
+        bounds->insert(bounds->end(), auxiliaryP2RowGroupVector->begin(), auxiliaryP2RowGroupVector->end());
+    }
+
+    // If the solution is not unique, the choices that are optimal w.r.t. the lower bounds are tracked (as in value iteration).
+    bool trackingSchedulersInProvidedStorage = player1Choices && player2Choices;
+    bool trackSchedulers = this->isTrackSchedulersSet() || trackingSchedulersInProvidedStorage;
+    std::vector<uint64_t> flatChoices;
+    if (trackSchedulers && !this->hasUniqueSolution()) {
+        flatChoices.assign(flatGameMatrix->getRowGroupCount(), 0);
+    }
+    GameIiBackend<ValueType> backend(numberOfPlayer1States, maximize(player1Dir), maximize(player2Dir), flatGameMatrix->getRowGroupIndices(),
+                                     flatChoices.empty() ? nullptr : &flatChoices);
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+    auto boundsConverged = [&xy, &precision, &relative, &numberOfPlayer1States]() {
+        for (uint64_t state = 0; state < numberOfPlayer1States; ++state) {
+            ValueType const& l = xy.first[state];
+            ValueType const& u = xy.second[state];
+            if (relative) {
+                if (l > storm::utility::zero<ValueType>()) {
+                    if (u - l > l * precision) {
+                        return false;
+                    }
+                } else if (u < storm::utility::zero<ValueType>()) {
+                    if (l - u < u * precision) {
+                        return false;
+                    }
+                } else if (l != u) {
+                    return false;
+                }
+            } else if (u - l > precision) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        viOperator->applyInPlace(xy, offsets, backend);
+        if (!this->hasUniqueSolution()) {
+            deflate(player1Dir, player2Dir, xy.first, xy.second, offsets);
+        }
+        if (boundsConverged()) {
+            status = SolverStatus::Converged;
+        }
+        ++iterations;
+        bool terminateEarly = this->hasCustomTerminationCondition() &&
+                              this->getTerminationCondition().terminateNow([&xy](uint64_t const& i) { return xy.first[i]; }, SolverGuarantee::LessOrEqual);
+        status = this->updateStatus(status, terminateEarly, iterations, maxIter);
+    }
+    this->reportStatus(status, iterations);
+
+    // The result is the center of the interval given by the bounds.
+    ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+    x.resize(numberOfPlayer1States);
+    for (uint64_t state = 0; state < numberOfPlayer1States; ++state) {
+        x[state] = (xy.first[state] + xy.second[state]) / two;
+    }
+
+    if (trackSchedulers) {
+        if (!trackingSchedulersInProvidedStorage) {
+            this->player1SchedulerChoices = std::vector<uint_fast64_t>();
+            this->player2SchedulerChoices = std::vector<uint_fast64_t>();
+        }
+        std::vector<uint64_t>& player1SchedulerChoices = trackingSchedulersInProvidedStorage ? *player1Choices : this->player1SchedulerChoices.get();
+        std::vector<uint64_t>& player2SchedulerChoices = trackingSchedulersInProvidedStorage ? *player2Choices : this->player2SchedulerChoices.get();
+        player1SchedulerChoices.assign(numberOfPlayer1States, 0);
+        player2SchedulerChoices.assign(this->getNumberOfPlayer2States(), 0);
+        if (this->hasUniqueSolution()) {
+            extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, player1SchedulerChoices, player2SchedulerChoices);
+        } else {
+            std::copy(flatChoices.begin(), flatChoices.begin() + numberOfPlayer1States, player1SchedulerChoices.begin());
+            std::copy(flatChoices.begin() + numberOfPlayer1States, flatChoices.end(), player2SchedulerChoices.begin());
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
+template<typename ValueType>
+void StandardGameSolver<ValueType>::setUpViOperator() const {
+    if (!flatGameMatrix) {
+        uint64_t const numberOfPlayer1States = this->getNumberOfPlayer1States();
+        uint64_t const numberOfPlayer1Choices = this->player1RepresentedByMatrix() ? this->getPlayer1Matrix().getRowCount() : this->getPlayer1Grouping().back();
+        uint64_t const numberOfStates = numberOfPlayer1States + this->getNumberOfPlayer2States();
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfPlayer1Choices + player2Matrix.getRowCount(), numberOfStates,
+                                                               numberOfPlayer1Choices + player2Matrix.getEntryCount(), true, true, numberOfStates);
+        uint64_t row = 0;
+        for (uint64_t player1State = 0; player1State < numberOfPlayer1States; ++player1State) {
+            builder.newRowGroup(row);
+            if (this->player1RepresentedByMatrix()) {
+                for (auto player1Row : this->getPlayer1Matrix().getRowGroupIndices(player1State)) {
+                    STORM_LOG_ASSERT(this->getPlayer1Matrix().getRow(player1Row).getNumberOfEntries() == 1,
+                                     "It is assumed that rows of player one have one entry, but this is not the case.");
+                    builder.addNextValue(row, numberOfPlayer1States + this->getPlayer1Matrix().getRow(player1Row).begin()->getColumn(),
+                                         storm::utility::one<ValueType>());
+                    ++row;
+                }
+            } else {
+                for (uint64_t player2State = this->getPlayer1Grouping()[player1State]; player2State < this->getPlayer1Grouping()[player1State + 1];
+                     ++player2State) {
+                    builder.addNextValue(row, numberOfPlayer1States + player2State, storm::utility::one<ValueType>());
+                    ++row;
+                }
+            }
+        }
+        for (uint64_t player2State = 0; player2State < this->getNumberOfPlayer2States(); ++player2State) {
+            builder.newRowGroup(row);
+            for (auto player2Row : player2Matrix.getRowGroupIndices(player2State)) {
+                for (auto const& entry : player2Matrix.getRow(player2Row)) {
+                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                }
+                ++row;
+            }
+        }
+        flatGameMatrix = std::make_unique<storm::storage::SparseMatrix<ValueType>>(builder.build());
+    }
+    if (!viOperator) {
+        // As the player 2 states come last, backward iterations process each player 2 state before the player 1 states that depend on it.
+        viOperator = std::make_shared<helper::ValueIterationOperator<ValueType, false>>();
+        viOperator->setMatrixBackwards(*flatGameMatrix);
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            viOperator->setParallelApply(storm::utility::getNumberOfThreads());
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<ValueType> StandardGameSolver<ValueType>::getFlatGameOffsets(std::vector<ValueType> const& b) const {
+    STORM_LOG_ASSERT(flatGameMatrix, "The flat game has not been created.");
+    std::vector<ValueType> offsets(flatGameMatrix->getRowCount() - player2Matrix.getRowCount(), storm::utility::zero<ValueType>());
+    offsets.insert(offsets.end(), b.begin(), b.end());
+    return offsets;
+}
+
+template<typename ValueType>
+void StandardGameSolver<ValueType>::deflate(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType> const& lowerX,
+                                            std::vector<ValueType>& upperX, std::vector<ValueType> const& offsets) const {
+    auto const& rowGroupIndices = flatGameMatrix->getRowGroupIndices();
+    uint64_t const numberOfPlayer1States = this->getNumberOfPlayer1States();
+    uint64_t const numberOfStates = flatGameMatrix->getRowGroupCount();
+    auto isMinimizing = [&](uint64_t state) { return minimize(state < numberOfPlayer1States ? player1Dir : player2Dir); };
+
+    // Only choices that yield no value can be taken forever. The minimizing states are further restricted to the choices that are optimal
+    // w.r.t. the lower bounds such that the end components are the ones in which the minimizer is going to stay (see KKKW18).
+    if (!auxiliaryFlatRowVector) {
+        auxiliaryFlatRowVector = std::make_unique<std::vector<ValueType>>(flatGameMatrix->getRowCount());
+    }
+    std::vector<ValueType>& choiceValues = *auxiliaryFlatRowVector;
+    flatGameMatrix->multiplyWithVector(lowerX, choiceValues, &offsets);
+    storm::storage::BitVector choices(flatGameMatrix->getRowCount(), false);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        auto groupBegin = choiceValues.begin() + rowGroupIndices[state];
+        auto groupEnd = choiceValues.begin() + rowGroupIndices[state + 1];
+        bool minimizing = isMinimizing(state);
+        ValueType const bestValue = minimizing ? *std::min_element(groupBegin, groupEnd) : storm::utility::zero<ValueType>();
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            if (storm::utility::isZero(offsets[row]) && (!minimizing || choiceValues[row] == bestValue)) {
+                choices.set(row);
+            }
+        }
+    }
+
+    // The end components only need to be recomputed if the considered choices changed.
+    if (!deflationChoices || *deflationChoices != choices) {
+        if (!flatGameBackwardTransitions) {
+            flatGameBackwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(flatGameMatrix->transpose(true));
+        }
+        deflationEndComponents = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+            *flatGameMatrix, *flatGameBackwardTransitions, storm::storage::BitVector(numberOfStates, true), choices);
+        deflationChoices = std::make_unique<storm::storage::BitVector>(std::move(choices));
+    }
+
+    // Within an end component, the value is at most the best value of a maximizing choice that leaves it (or zero if it is never left).
+    for (auto const& endComponent : *deflationEndComponents) {
+        ValueType bestExit = storm::utility::zero<ValueType>();
+        for (auto const& stateChoices : endComponent) {
+            uint64_t state = stateChoices.first;
+            if (isMinimizing(state)) {
+                continue;
+            }
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                if (!endComponent.containsChoice(state, row)) {
+                    ValueType exitValue = offsets[row];
+                    for (auto const& entry : flatGameMatrix->getRow(row)) {
+                        exitValue += entry.getValue() * upperX[entry.getColumn()];
+                    }
+                    bestExit = std::max(bestExit, exitValue);
+                }
+            }
+        }
+        for (auto const& stateChoices : endComponent) {
+            upperX[stateChoices.first] = std::min(upperX[stateChoices.first], bestExit);
+        }
+    }
+}
+
 template<typename ValueType>
 void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
@@ -623,6 +1056,12 @@ void StandardGameSolver<ValueType>::clearCache() const {
     auxiliaryP2RowVector.reset();
     auxiliaryP2RowGroupVector.reset();
     auxiliaryP1RowGroupVector.reset();
+    flatGameMatrix.reset();
+    flatGameBackwardTransitions.reset();
+    viOperator.reset();
+    auxiliaryFlatRowVector.reset();
+    deflationChoices.reset();
+    deflationEndComponents.reset();
     GameSolver<ValueType>::clearCache();
 }
 
@@ -4,7 +4,10 @@
 #include "storm/solver/GameSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 
 namespace storm {
 namespace solver {
@@ -43,6 +46,24 @@ class StandardGameSolver : public GameSolver<ValueType> {
     bool solveGameValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
                                  std::vector<uint64_t>* player2Choices = nullptr) const;
+    bool solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                                    std::vector<uint64_t>* player2Choices = nullptr) const;
+
+    // Performs value iteration on the flat game, where the states of both players are processed within the same (possibly parallel) sweep.
+    SolverStatus performFlatValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                           std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& iterations) const;
+
+    // Creates the flat game (if not done already) and the value iteration operator on it.
+    void setUpViOperator() const;
+
+    // Retrieves the row offsets of the flat game, i.e., zeros for the choices of player 1 followed by the given vector b.
+    std::vector<ValueType> getFlatGameOffsets(std::vector<ValueType> const& b) const;
+
+    // Lowers the upper bounds of the states in end components of the flat game in which the maximizing states can not leave to a better value.
+    // Without this, the upper bounds do not converge to the solution if it is not unique.
+    void deflate(OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType> const& lowerX, std::vector<ValueType>& upperX,
+                 std::vector<ValueType> const& offsets) const;
 
     // Computes p2Matrix * x + b, reduces the result w.r.t. player 2 choices, and then reduces the result w.r.t. player 1 choices.
     void multiplyAndReduce(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
@@ -76,6 +97,16 @@ class StandardGameSolver : public GameSolver<ValueType> {
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP2RowGroupVector;  // player2Matrix.rowGroupCount() entries
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP1RowGroupVector;  // player1Matrix.rowGroupCount() entries
 
+    // The flat game is a single row-grouped matrix whose first row groups are the player 1 states, followed by the player 2 states.
+    // The choices of a player 1 state lead to the corresponding player 2 states with probability one.
+    mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> flatGameMatrix;
+    mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> flatGameBackwardTransitions;
+    mutable std::shared_ptr<storm::solver::helper::ValueIterationOperator<ValueType, false>> viOperator;
+    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryFlatRowVector;  // flatGameMatrix.rowCount() entries
+    // The choices considered in the most recent end component decomposition for deflation and the resulting decomposition
+    mutable std::unique_ptr<storm::storage::BitVector> deflationChoices;
+    mutable std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>> deflationEndComponents;
+
     /// The factory used to obtain linear equation solvers.
     std::unique_ptr<LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
 
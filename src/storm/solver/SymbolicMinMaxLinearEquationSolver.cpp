@@ -8,9 +8,11 @@
 #include "storm/utility/constants.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
+#include "storm/solver/helper/SymbolicIntervalIterationHelper.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
@@ -60,7 +62,19 @@ MinMaxMethod SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::getMethod(En
             STORM_LOG_WARN("The selected solution method does not guarantee exact results.");
         }
     }
-    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch) {
+    if (!isExactMode && env.solver().isForceSoundness() && method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::OptimisticValueIteration &&
+        method != MinMaxMethod::RationalSearch) {
+        if (env.solver().minMax().isMethodSetFromDefault()) {
+            method = MinMaxMethod::OptimisticValueIteration;
+            STORM_LOG_INFO("Selecting '" << toString(method)
+                                         << "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a "
+                                            "different method.");
+        } else {
+            STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
+        }
+    }
+    if (method != MinMaxMethod::ValueIteration && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch &&
+        method != MinMaxMethod::IntervalIteration && method != MinMaxMethod::OptimisticValueIteration) {
         STORM_LOG_WARN("Selected method is not supported for this solver, switching to value iteration.");
         method = MinMaxMethod::ValueIteration;
     }
@@ -77,10 +91,15 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
 
-    switch (getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
+    auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value);
+    switch (method) {
         case MinMaxMethod::ValueIteration:
             return solveEquationsValueIteration(env, dir, x, b);
             break;
+        case MinMaxMethod::IntervalIteration:
+        case MinMaxMethod::OptimisticValueIteration:
+            return solveEquationsSoundValueIteration(env, dir, b, method);
+            break;
         case MinMaxMethod::PolicyIteration:
             return solveEquationsPolicyIteration(env, dir, x, b);
             break;
@@ -106,17 +125,8 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
     // Value iteration loop.
     SolverStatus status = SolverStatus::InProgress;
     while (status == SolverStatus::InProgress && iterations < maximalIterations) {
-        // Compute tmp = A * x + b
-        storm::dd::Add<DdType, ValueType> localXAsColumn = localX.swapVariables(this->rowColumnMetaVariablePairs);
-        storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(localXAsColumn, this->columnMetaVariables);
-        tmp += b;
-
-        if (dir == storm::solver::OptimizationDirection::Minimize) {
-            tmp += illegalMaskAdd;
-            tmp = tmp.minAbstract(this->choiceVariables);
-        } else {
-            tmp = tmp.maxAbstract(this->choiceVariables);
-        }
+        // Compute tmp = min/max A * x + b
+        storm::dd::Add<DdType, ValueType> tmp = applyBellmanOperator(dir, localX, b);
 
         // Now check if the process already converged within our precision.
         if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
@@ -141,18 +151,35 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
 template<storm::dd::DdType DdType, typename ValueType>
 bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::isSolution(OptimizationDirection dir, storm::dd::Add<DdType, ValueType> const& x,
                                                                        storm::dd::Add<DdType, ValueType> const& b) const {
-    storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
-    storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(xAsColumn, this->columnMetaVariables);
-    tmp += b;
+    return x == applyBellmanOperator(dir, x, b);
+}
 
-    if (dir == storm::solver::OptimizationDirection::Minimize) {
-        tmp += illegalMaskAdd;
-        tmp = tmp.minAbstract(this->choiceVariables);
-    } else {
-        tmp = tmp.maxAbstract(this->choiceVariables);
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::applyBellmanOperator(
+    storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+    storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
+    storm::dd::Add<DdType, ValueType> choiceValues = this->A.multiplyMatrix(xAsColumn, this->columnMetaVariables);
+    choiceValues += b;
+
+    bool const minimize = dir == storm::solver::OptimizationDirection::Minimize;
+    auto optimize = [minimize](storm::dd::Add<DdType, ValueType> const& values, std::set<storm::expressions::Variable> const& variables) {
+        return minimize ? values.minAbstract(variables) : values.maxAbstract(variables);
+    };
+    if (minimize) {
+        choiceValues += illegalMaskAdd;
     }
-
-    return x == tmp;
+    storm::dd::Add<DdType, ValueType> result = optimize(choiceValues, this->choiceVariables);
+
+    if (this->hasEndComponents()) {
+        // Collapse the end components: the states of an end component get the best value among all choices that leave the end component.
+        storm::dd::Add<DdType, ValueType> neutral =
+            x.getDdManager().getConstant(minimize ? storm::utility::infinity<ValueType>() : -storm::utility::infinity<ValueType>());
+        storm::dd::Add<DdType, ValueType> exitValues = optimize(endComponentChoices.get().ite(neutral, choiceValues), this->choiceVariables);
+        storm::dd::Add<DdType, ValueType> collapsedValues =
+            optimize(endComponentRelation.get().ite(exitValues.swapVariables(this->rowColumnMetaVariablePairs), neutral), this->columnMetaVariables);
+        result = endComponentStates.get().ite(collapsedValues, result);
+    }
+    return result;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -254,6 +281,9 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsRationalSea
     SymbolicMinMaxLinearEquationSolver<DdType, storm::RationalNumber> rationalSolver(
         this->A.template toValueType<storm::RationalNumber>(), this->allRows, this->illegalMask, this->rowMetaVariables, this->columnMetaVariables,
         this->choiceVariables, this->rowColumnMetaVariablePairs, std::make_unique<GeneralSymbolicLinearEquationSolverFactory<DdType, storm::RationalNumber>>());
+    if (this->hasEndComponents()) {
+        rationalSolver.setEndComponents(this->endComponentRelation.get(), this->endComponentChoices.get());
+    }
 
     storm::dd::Add<DdType, storm::RationalNumber> rationalResult =
         solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, dir, rationalSolver, *this, rationalB, this->getLowerBoundsVector(), b);
@@ -276,6 +306,9 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsRationalSea
         SymbolicMinMaxLinearEquationSolver<DdType, ImpreciseType> impreciseSolver(
             this->A.template toValueType<ImpreciseType>(), this->allRows, this->illegalMask, this->rowMetaVariables, this->columnMetaVariables,
             this->choiceVariables, this->rowColumnMetaVariablePairs, std::make_unique<GeneralSymbolicLinearEquationSolverFactory<DdType, ImpreciseType>>());
+        if (this->hasEndComponents()) {
+            impreciseSolver.setEndComponents(this->endComponentRelation.get(), this->endComponentChoices.get());
+        }
 
         rationalResult = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, *this, impreciseSolver, b, impreciseX, impreciseB);
     } catch (storm::exceptions::PrecisionExceededException const& e) {
@@ -345,6 +378,40 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     return viResult.values;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsSoundValueIteration(
+    Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& b, MinMaxMethod const& method) const {
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().minMax().getMaximalNumberOfIterations();
+    storm::solver::helper::SymbolicIntervalIterationHelper<DdType, ValueType> helper(
+        [&](storm::dd::Add<DdType, ValueType> const& x) { return applyBellmanOperator(dir, x, b); }, this->allRows);
+
+    storm::dd::Add<DdType, ValueType> lower = this->getLowerBoundsVector();
+    storm::dd::Add<DdType, ValueType> upper;
+    uint64_t iterations = 0;
+    SolverStatus status;
+    bool const hasUpperBounds = this->hasUpperBound() || this->hasUpperBounds();
+    if (method == MinMaxMethod::IntervalIteration && hasUpperBounds) {
+        upper = this->getUpperBoundsVector();
+        status = helper.performIntervalIteration(lower, upper, iterations, precision, relative, maxIter);
+    } else {
+        STORM_LOG_INFO_COND(method == MinMaxMethod::OptimisticValueIteration, "No upper bounds available for interval iteration. Guessing upper bounds.");
+        std::optional<storm::dd::Add<DdType, ValueType>> upperBounds;
+        if (hasUpperBounds) {
+            upperBounds = this->getUpperBoundsVector();
+        }
+        status = helper.performOptimisticValueIteration(lower, upper, upperBounds, iterations, precision, relative, maxIter);
+    }
+
+    if (status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (" << toString(method) << ") converged in " << iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (" << toString(method) << ") did not converge in " << iterations << " iterations.");
+    }
+    return helper.getMidpoint(lower, upper);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithScheduler(
     Environment const& env, storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x,
@@ -532,6 +599,15 @@ MinMaxLinearEquationSolverRequirements SymbolicMinMaxLinearEquationSolver<DdType
                 requirements.requireValidInitialScheduler();
             }
         }
+    } else if (method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration) {
+        if (!this->hasUniqueSolution() && !this->hasEndComponents()) {
+            requirements.requireUniqueSolution();
+        }
+        requirements.requireLowerBounds();
+        if (method == MinMaxMethod::IntervalIteration) {
+            // Without upper bounds, we guess them as in optimistic value iteration.
+            requirements.requireUpperBounds(false);
+        }
     } else if (method == MinMaxMethod::RationalSearch) {
         requirements.requireLowerBounds();
         if (!this->hasUniqueSolution() && (!direction || direction.get() == storm::solver::OptimizationDirection::Minimize)) {
@@ -554,6 +630,25 @@ bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::hasUniqueSolution()
     return this->uniqueSolution;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::setEndComponents(storm::dd::Bdd<DdType> const& endComponentRelation,
+                                                                             storm::dd::Bdd<DdType> const& endComponentChoices) {
+    if (endComponentRelation.isZero()) {
+        this->endComponentRelation = boost::none;
+        this->endComponentStates = boost::none;
+        this->endComponentChoices = boost::none;
+    } else {
+        this->endComponentRelation = endComponentRelation;
+        this->endComponentStates = endComponentRelation.existsAbstract(this->columnMetaVariables);
+        this->endComponentChoices = endComponentChoices;
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::hasEndComponents() const {
+    return static_cast<bool>(this->endComponentRelation);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 void SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::setRequirementsChecked(bool value) {
     this->requirementsChecked = value;
@@ -134,6 +134,22 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
      */
     bool isRequirementsCheckedSet() const;
 
+    /*!
+     * Sets the maximal end components of the equation system. The solver then treats each end component as a single state whose choices are the choices
+     * that leave the end component, i.e., every state of an end component gets the optimal value among these choices. This is required for a unique
+     * solution if the values of the states in an end component coincide with the best value that can be achieved by leaving it (e.g. when maximizing
+     * reachability probabilities).
+     *
+     * @param endComponentRelation A BDD over the row and column variables that relates all states that belong to the same end component.
+     * @param endComponentChoices A BDD over the row and choice variables that characterizes the choices that stay within the end component of their state.
+     */
+    void setEndComponents(storm::dd::Bdd<DdType> const& endComponentRelation, storm::dd::Bdd<DdType> const& endComponentChoices);
+
+    /*!
+     * Retrieves whether end components were set.
+     */
+    bool hasEndComponents() const;
+
     /*!
      * Determines whether the given vector x satisfies x = min/max Ax + b.
      */
@@ -158,6 +174,14 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
     storm::dd::Add<DdType, ValueType> solveEquationsRationalSearch(Environment const& env, storm::solver::OptimizationDirection const& dir,
                                                                    storm::dd::Add<DdType, ValueType> const& x,
                                                                    storm::dd::Add<DdType, ValueType> const& b) const;
+    storm::dd::Add<DdType, ValueType> solveEquationsSoundValueIteration(Environment const& env, storm::solver::OptimizationDirection const& dir,
+                                                                        storm::dd::Add<DdType, ValueType> const& b, MinMaxMethod const& method) const;
+
+    /*!
+     * Computes min/max Ax + b (taking the end components into account, if there are any).
+     */
+    storm::dd::Add<DdType, ValueType> applyBellmanOperator(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
+                                                           storm::dd::Add<DdType, ValueType> const& b) const;
 
     template<typename RationalType, typename ImpreciseType>
     static storm::dd::Add<DdType, RationalType> sharpen(OptimizationDirection dir, uint64_t precision,
@@ -237,6 +261,11 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
     // A scheduler that specifies with which schedulers to start.
     boost::optional<storm::dd::Bdd<DdType>> initialScheduler;
 
+    // The relation between states of the same end component, the states contained in some end component and the choices that stay in the end components.
+    boost::optional<storm::dd::Bdd<DdType>> endComponentRelation;
+    boost::optional<storm::dd::Bdd<DdType>> endComponentStates;
+    boost::optional<storm::dd::Bdd<DdType>> endComponentChoices;
+
    private:
     /*!
      * Forwards the known bounds of this solver to the given linear equation solver.
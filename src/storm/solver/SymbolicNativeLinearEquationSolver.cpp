@@ -1,8 +1,10 @@
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
+#include "storm/solver/helper/SymbolicIntervalIterationHelper.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -55,12 +57,23 @@ NativeLinearEquationSolverMethod SymbolicNativeLinearEquationSolver<DdType, Valu
             }
         }
     } else {
+        if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::IntervalIteration &&
+            method != NativeLinearEquationSolverMethod::OptimisticValueIteration && method != NativeLinearEquationSolverMethod::RationalSearch) {
+            if (env.solver().native().isMethodSetFromDefault()) {
+                method = NativeLinearEquationSolverMethod::OptimisticValueIteration;
+                STORM_LOG_INFO(
+                    "Selecting '" + toString(method) +
+                    "' as the solution technique to guarantee sound results. If you want to override this, please explicitly specify a different method.");
+            } else {
+                STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
+            }
+        }
         if (method != NativeLinearEquationSolverMethod::Power && method != NativeLinearEquationSolverMethod::RationalSearch &&
-            method != NativeLinearEquationSolverMethod::Jacobi) {
+            method != NativeLinearEquationSolverMethod::Jacobi && method != NativeLinearEquationSolverMethod::IntervalIteration &&
+            method != NativeLinearEquationSolverMethod::OptimisticValueIteration) {
             method = NativeLinearEquationSolverMethod::Jacobi;
             STORM_LOG_INFO("The selected solution method is not supported in the dd engine. Falling back to '" + toString(method) + "'.");
         }
-        STORM_LOG_WARN_COND_DEBUG(!env.solver().isForceSoundness(), "Sound computations are not supported in the Dd engine.");
     }
     return method;
 }
@@ -69,9 +82,13 @@ template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquations(Environment const& env,
                                                                                                         storm::dd::Add<DdType, ValueType> const& x,
                                                                                                         storm::dd::Add<DdType, ValueType> const& b) const {
-    switch (getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
+    auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value);
+    switch (method) {
         case NativeLinearEquationSolverMethod::Jacobi:
             return solveEquationsJacobi(env, x, b);
+        case NativeLinearEquationSolverMethod::IntervalIteration:
+        case NativeLinearEquationSolverMethod::OptimisticValueIteration:
+            return solveEquationsSoundValueIteration(env, b, method);
         case NativeLinearEquationSolverMethod::Power:
             return solveEquationsPower(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
@@ -318,6 +335,45 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     return solveEquationsRationalSearchHelper<double>(env, x, b);
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsSoundValueIteration(
+    Environment const& env, storm::dd::Add<DdType, ValueType> const& b, NativeLinearEquationSolverMethod const& method) const {
+    STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (" << toString(method) << ")");
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    storm::solver::helper::SymbolicIntervalIterationHelper<DdType, ValueType> helper(
+        [&](storm::dd::Add<DdType, ValueType> const& x) {
+            return this->A.multiplyMatrix(x.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+        },
+        this->allRows);
+
+    storm::dd::Add<DdType, ValueType> lower = this->getLowerBoundsVector();
+    storm::dd::Add<DdType, ValueType> upper;
+    uint64_t iterations = 0;
+    SolverStatus status;
+    bool const hasUpperBounds = this->hasUpperBound() || this->hasUpperBounds();
+    if (method == NativeLinearEquationSolverMethod::IntervalIteration && hasUpperBounds) {
+        upper = this->getUpperBoundsVector();
+        status = helper.performIntervalIteration(lower, upper, iterations, precision, relative, maxIter);
+    } else {
+        STORM_LOG_INFO_COND(method == NativeLinearEquationSolverMethod::OptimisticValueIteration,
+                            "No upper bounds available for interval iteration. Guessing upper bounds.");
+        std::optional<storm::dd::Add<DdType, ValueType>> upperBounds;
+        if (hasUpperBounds) {
+            upperBounds = this->getUpperBoundsVector();
+        }
+        status = helper.performOptimisticValueIteration(lower, upper, upperBounds, iterations, precision, relative, maxIter);
+    }
+
+    if (status == SolverStatus::Converged) {
+        STORM_LOG_INFO("Iterative solver (" << toString(method) << ") converged in " << iterations << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver (" << toString(method) << ") did not converge in " << iterations << " iterations.");
+    }
+    return helper.getMidpoint(lower, upper);
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 LinearEquationSolverProblemFormat SymbolicNativeLinearEquationSolver<DdType, ValueType>::getEquationProblemFormat(Environment const& env) const {
     auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value);
@@ -331,8 +387,12 @@ template<storm::dd::DdType DdType, typename ValueType>
 LinearEquationSolverRequirements SymbolicNativeLinearEquationSolver<DdType, ValueType>::getRequirements(Environment const& env) const {
     LinearEquationSolverRequirements requirements;
     auto method = getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value);
-    if (method == NativeLinearEquationSolverMethod::RationalSearch) {
+    if (method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::OptimisticValueIteration) {
+        requirements.requireLowerBounds();
+    } else if (method == NativeLinearEquationSolverMethod::IntervalIteration) {
         requirements.requireLowerBounds();
+        // Without upper bounds, we guess them as in optimistic value iteration.
+        requirements.requireUpperBounds(false);
     }
     return requirements;
 }
@@ -80,6 +80,12 @@ class SymbolicNativeLinearEquationSolver : public SymbolicLinearEquationSolver<D
     storm::dd::Add<DdType, ValueType> solveEquationsRationalSearch(Environment const& env, storm::dd::Add<DdType, ValueType> const& x,
                                                                    storm::dd::Add<DdType, ValueType> const& b) const;
 
+    /*!
+     * Solves the equation system with interval iteration or optimistic value iteration, starting from the lower bounds.
+     */
+    storm::dd::Add<DdType, ValueType> solveEquationsSoundValueIteration(Environment const& env, storm::dd::Add<DdType, ValueType> const& b,
+                                                                        NativeLinearEquationSolverMethod const& method) const;
+
     /*!
      * Determines whether the given vector x satisfies x = Ax + b.
      */
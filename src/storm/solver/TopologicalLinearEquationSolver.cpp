@@ -1,11 +1,19 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/AdaptiveSccSolverSelection.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -58,6 +66,19 @@ storm::Environment TopologicalLinearEquationSolver<ValueType>::getEnvironmentFor
     return subEnv;
 }
 
+template<typename ValueType>
+std::vector<storm::Environment> TopologicalLinearEquationSolver<ValueType>::getEnvironmentsForUnderlyingSolver(storm::Environment const& env,
+                                                                                                            bool adaptPrecision) const {
+    storm::Environment subEnv = getEnvironmentForUnderlyingSolver(env, adaptPrecision);
+    // Exact computations always use the configured solver as the alternative methods are not exact.
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().topological().isAdaptiveSccSolvingSet() && !env.solver().isForceExact()) {
+            return storm::solver::helper::getAdaptiveLinearEquationSolverEnvironments(subEnv);
+        }
+    }
+    return {std::move(subEnv)};
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x,
                                                                         std::vector<ValueType> const& b) const {
@@ -66,10 +87,21 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         env.solver().isForceSoundness() &&
         env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    bool solveSccsInParallel = env.solver().topological().isParallelSccSolvingSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!solveSccsInParallel, "Storm was built without support for Intel TBB, defaulting to sequential SCC solving.");
+    solveSccsInParallel = false;
+#endif
+    if constexpr (!storm::NumberTraits<ValueType>::IsThreadSafe) {
+        STORM_LOG_WARN_COND(!solveSccsInParallel, "Concurrent SCC solving is not supported for this value type, defaulting to sequential SCC solving.");
+        solveSccsInParallel = false;
+    }
+
+    // Solving SCCs concurrently requires the SCC depths (which also yield the longest SCC chain size)
+    if (!this->sortedSccDecomposition || ((needAdaptPrecision || solveSccsInParallel) && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision || solveSccsInParallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -80,7 +112,11 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     // We do not need to adapt the precision if all SCCs are trivial (i.e., the system is acyclic)
     needAdaptPrecision = needAdaptPrecision && (this->sortedSccDecomposition->size() != this->getMatrixRowCount());
 
-    storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env, needAdaptPrecision);
+    std::vector<storm::Environment> sccSolverEnvironments = getEnvironmentsForUnderlyingSolver(env, needAdaptPrecision);
+    if (this->sccSolvers.size() != sccSolverEnvironments.size()) {
+        this->sccSolvers.clear();
+        this->sccSolvers.resize(sccSolverEnvironments.size());
+    }
 
     if (this->longestSccChainSize) {
         STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get() << ".");
@@ -93,14 +129,16 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
             // Catch the trivial case where the whole system is just a single state.
             returnValue = solveTrivialScc(*scc.begin(), x, b);
         } else {
-            returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironments, x, b);
         }
+    } else if (solveSccsInParallel) {
+        returnValue = solveSccsConcurrently(sccSolverEnvironments, x, b);
     } else {
         // Solve each SCC individually
         storm::storage::BitVector sccAsBitVector(x.size(), false);
         uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
+        storm::utility::ProgressMeasurement progress("SCCs");
+        progress.setMaxCount(this->sortedSccDecomposition->size());
         progress.startNewMeasurement(0);
         for (auto const& scc : *this->sortedSccDecomposition) {
             if (scc.size() == 1) {
@@ -110,7 +148,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                 for (auto const& state : scc) {
                     sccAsBitVector.set(state, true);
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                returnValue = solveScc(sccSolverEnvironments, sccAsBitVector, x, b, this->sccSolvers) && returnValue;
             }
             ++sccIndex;
             progress.updateProgress(sccIndex);
@@ -128,11 +166,69 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     return returnValue;
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(std::vector<storm::Environment> const& sccSolverEnvironments, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Group the SCCs by their depth. There are no transitions between SCCs of the same depth, so these SCCs can be solved independently as soon as all
+    // SCCs with a smaller depth are solved.
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "Did not compute the SCC depths although they are needed.");
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    std::atomic<bool> returnValue{true};
+    uint64_t numSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            // Each task uses its own environment, solver and auxiliary data
+            std::vector<storm::Environment> taskSolverEnvironments(sccSolverEnvironments);
+            std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> taskSccSolvers(sccSolverEnvironments.size());
+            std::optional<storm::storage::BitVector> sccAsBitVector;
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[i]);
+                bool sccResult;
+                if (scc.size() == 1) {
+                    sccResult = solveTrivialScc(*scc.begin(), x, b);
+                } else {
+                    if (sccAsBitVector) {
+                        sccAsBitVector->clear();
+                    } else {
+                        sccAsBitVector.emplace(x.size(), false);
+                    }
+                    for (auto const& state : scc) {
+                        sccAsBitVector->set(state, true);
+                    }
+                    sccResult = solveScc(taskSolverEnvironments, *sccAsBitVector, x, b, taskSccSolvers);
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            }
+        });
+        numSolvedSccs += sccIndices.size();
+        progress.updateProgress(numSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Concurrent SCC solving requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType>
 void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
     // Obtain the scc decomposition
-    this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+    auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize);
+    options.parallel(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
+    this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, options);
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -169,40 +265,57 @@ bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const&
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
-                                                                                   std::vector<ValueType> const& b) const {
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
-        this->sccSolver->setBoundsFromOtherSolver(*this);
-        if (this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem) {
+bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSystem(std::vector<storm::Environment> const& sccSolverEnvironments,
+                                                                                   std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    uint64_t const solverIndex = storm::solver::helper::getSccSolverIndex(sccSolverEnvironments, this->A->getRowCount(), this->A->getEntryCount());
+    storm::Environment const& sccSolverEnvironment = sccSolverEnvironments[solverIndex];
+    auto& sccSolver = this->sccSolvers[solverIndex];
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
+        sccSolver->setBoundsFromOtherSolver(*this);
+        if (sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem) {
             // Convert the matrix to an equation system. Note that we need to insert diagonal entries.
             storm::storage::SparseMatrix<ValueType> eqSysA(*this->A, true);
             eqSysA.convertToEquationSystem();
-            this->sccSolver->setMatrix(std::move(eqSysA));
+            sccSolver->setMatrix(std::move(eqSysA));
         } else {
-            this->sccSolver->setMatrix(*this->A);
+            sccSolver->setMatrix(*this->A);
         }
     }
-    return this->sccSolver->solveEquations(sccSolverEnvironment, x, b);
+    return sccSolver->solveEquations(sccSolverEnvironment, x, b);
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(std::vector<storm::Environment> const& sccSolverEnvironments,
+                                                          storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                                                          std::vector<ValueType> const& globalB,
+                                                          std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>& solvers) const {
+    // Pick the environment and the solver for this SCC
+    uint64_t solverIndex = 0;
+    if (sccSolverEnvironments.size() > 1) {
+        uint64_t numberOfEntries = 0;
+        for (auto row : scc) {
+            numberOfEntries += this->A->getRow(row).getNumberOfEntries();
+        }
+        solverIndex = storm::solver::helper::getSccSolverIndex(sccSolverEnvironments, scc.getNumberOfSetBits(), numberOfEntries);
+    }
+    storm::Environment const& sccSolverEnvironment = sccSolverEnvironments[solverIndex];
+    auto& solver = solvers[solverIndex];
+
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = solver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,20 +335,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = solver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
@@ -247,15 +360,19 @@ LinearEquationSolverProblemFormat TopologicalLinearEquationSolver<ValueType>::ge
 
 template<typename ValueType>
 LinearEquationSolverRequirements TopologicalLinearEquationSolver<ValueType>::getRequirements(Environment const& env) const {
-    // Return the requirements of the underlying solver
-    return GeneralLinearEquationSolverFactory<ValueType>().getRequirements(getEnvironmentForUnderlyingSolver(env));
+    // Return the requirements of the underlying solver(s)
+    LinearEquationSolverRequirements requirements;
+    for (auto const& subEnv : getEnvironmentsForUnderlyingSolver(env)) {
+        storm::solver::helper::addRequirements(requirements, GeneralLinearEquationSolverFactory<ValueType>().getRequirements(subEnv));
+    }
+    return requirements;
 }
 
 template<typename ValueType>
 void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
-    sccSolver.reset();
+    sccSolvers.clear();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -36,6 +36,9 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+    // Retrieves the environments for the underlying solver. If SCCs are solved adaptively, there is one environment per helper::SccSolverClass.
+    std::vector<storm::Environment> getEnvironmentsForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
+
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
     void createSortedSccDecomposition(bool needLongestChainSize) const;
 
@@ -43,10 +46,15 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // ... for the case that the SCC is trivial
     bool solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
     // ... for the case that there is just one large SCC
-    bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    bool solveFullyConnectedEquationSystem(std::vector<storm::Environment> const& sccSolverEnvironments, std::vector<ValueType>& x,
+                                           std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    bool solveScc(std::vector<storm::Environment> const& sccSolverEnvironments, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                  std::vector<ValueType> const& globalB, std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>>& solvers) const;
+
+    // Solves all SCCs of the sorted SCC decomposition. SCCs with the same depth are solved concurrently.
+    bool solveSccsConcurrently(std::vector<storm::Environment> const& sccSolverEnvironments, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -59,7 +67,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
-    mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+    // One solver per environment of the underlying solver
+    mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> sccSolvers;
 };
 
 template<typename ValueType>
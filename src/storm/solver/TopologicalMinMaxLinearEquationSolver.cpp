@@ -1,12 +1,20 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <atomic>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/AdaptiveSccSolverSelection.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
@@ -48,6 +56,19 @@ storm::Environment TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType
     return subEnv;
 }
 
+template<typename ValueType, typename SolutionType>
+std::vector<storm::Environment> TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::getEnvironmentsForUnderlyingSolver(
+    storm::Environment const& env, bool adaptPrecision) const {
+    storm::Environment subEnv = getEnvironmentForUnderlyingSolver(env, adaptPrecision);
+    // Exact computations always use the configured method as the alternative methods are not exact.
+    if constexpr (std::is_same_v<ValueType, double>) {
+        if (env.solver().topological().isAdaptiveSccSolvingSet() && !env.solver().isForceExact()) {
+            return storm::solver::helper::getAdaptiveMinMaxSolverEnvironments(subEnv);
+        }
+    }
+    return {std::move(subEnv)};
+}
+
 template<typename ValueType, typename SolutionType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSolveEquations(Environment const& env, OptimizationDirection dir,
                                                                                             std::vector<SolutionType>& x,
@@ -58,10 +79,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    bool solveSccsInParallel = env.solver().topological().isParallelSccSolvingSet();
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(!solveSccsInParallel, "Storm was built without support for Intel TBB, defaulting to sequential SCC solving.");
+    solveSccsInParallel = false;
+#endif
+    if constexpr (!storm::NumberTraits<ValueType>::IsThreadSafe || !storm::NumberTraits<SolutionType>::IsThreadSafe) {
+        STORM_LOG_WARN_COND(!solveSccsInParallel, "Concurrent SCC solving is not supported for this value type, defaulting to sequential SCC solving.");
+        solveSccsInParallel = false;
+    }
+
+    // Solving SCCs concurrently requires the SCC depths (which also yield the longest SCC chain size)
+    if (!this->sortedSccDecomposition || ((needAdaptPrecision || solveSccsInParallel) && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision || solveSccsInParallel);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -72,11 +104,19 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     // We do not need to adapt the precision if all SCCs are trivial (i.e., the system is acyclic)
     needAdaptPrecision = needAdaptPrecision && (this->sortedSccDecomposition->size() != this->A->getRowGroupCount());
 
-    storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env, needAdaptPrecision);
+    std::vector<storm::Environment> sccSolverEnvironments = getEnvironmentsForUnderlyingSolver(env, needAdaptPrecision);
+    if (this->sccSolvers.size() != sccSolverEnvironments.size()) {
+        this->sccSolvers.clear();
+        this->sccSolvers.resize(sccSolverEnvironments.size());
+    }
 
     if (this->longestSccChainSize) {
         STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get());
     }
+    // The SCCs might be solved concurrently, so the states with a fixed choice are reported here rather than for each SCC.
+    if (this->choiceFixedForRowGroup && !this->choiceFixedForRowGroup.get().empty()) {
+        STORM_LOG_INFO("Fixing " << this->choiceFixedForRowGroup.get().getNumberOfSetBits() << " states to the choices of the initial scheduler.");
+    }
 
     bool returnValue = true;
     if (this->sortedSccDecomposition->size() == 1 && (!this->choiceFixedForRowGroup || this->choiceFixedForRowGroup.get().empty())) {
@@ -88,7 +128,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
             }
             returnValue = solveTrivialScc(*scc.begin(), dir, x, b);
         } else {
-            returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, dir, x, b);
+            returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironments, dir, x, b);
         }
     } else {
         // Solve each SCC individually
@@ -99,39 +139,33 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        if (solveSccsInParallel) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironments, dir, x, b);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("SCCs");
+            progress.setMaxCount(this->sortedSccDecomposition->size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    sccRowGroupsAsBitVector.clear();
+                    for (auto const& group : scc) {  // Group refers to state
+                        sccRowGroupsAsBitVector.set(group, true);
                     }
+                    setSccRows(sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                    returnValue = solveScc(sccSolverEnvironments, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, this->sccSolvers) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
@@ -152,11 +186,89 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
     return returnValue;
 }
 
+template<typename ValueType, typename SolutionType>
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::setSccRows(storm::storage::BitVector const& sccRowGroups,
+                                                                                storm::storage::BitVector& sccRows) const {
+    sccRows.clear();
+    for (auto const& group : sccRowGroups) {  // Group refers to state
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, true);
+        }
+    }
+}
+
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccsConcurrently(std::vector<storm::Environment> const& sccSolverEnvironments,
+                                                                                           OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                                           std::vector<ValueType> const& b) const {
+#ifdef STORM_HAVE_INTELTBB
+    // Group the SCCs by their depth. There are no transitions between SCCs of the same depth, so these SCCs can be solved independently as soon as all
+    // SCCs with a smaller depth are solved.
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "Did not compute the SCC depths although they are needed.");
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    std::atomic<bool> returnValue{true};
+    uint64_t numSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, sccIndices.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            // Each task uses its own environment, solver and auxiliary data
+            std::vector<storm::Environment> taskSolverEnvironments(sccSolverEnvironments);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> taskSccSolvers(sccSolverEnvironments.size());
+            std::optional<storm::storage::BitVector> sccRowGroupsAsBitVector, sccRowsAsBitVector;
+            for (auto i = range.begin(); i < range.end(); ++i) {
+                auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[i]);
+                bool sccResult;
+                if (scc.size() == 1) {
+                    sccResult = solveTrivialScc(*scc.begin(), dir, x, b);
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    if (sccRowGroupsAsBitVector) {
+                        sccRowGroupsAsBitVector->clear();
+                    } else {
+                        sccRowGroupsAsBitVector.emplace(x.size(), false);
+                        sccRowsAsBitVector.emplace(b.size(), false);
+                    }
+                    for (auto const& group : scc) {  // Group refers to state
+                        sccRowGroupsAsBitVector->set(group, true);
+                    }
+                    setSccRows(*sccRowGroupsAsBitVector, *sccRowsAsBitVector);
+                    sccResult = solveScc(taskSolverEnvironments, dir, *sccRowGroupsAsBitVector, *sccRowsAsBitVector, x, b, taskSccSolvers);
+                }
+                if (!sccResult) {
+                    returnValue = false;
+                }
+            }
+        });
+        numSolvedSccs += sccIndices.size();
+        progress.updateProgress(numSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return returnValue;
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Concurrent SCC solving requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType, typename SolutionType>
 void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize) const {
     // Obtain the scc decomposition
-    this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+    auto options = storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize);
+    options.parallel(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet());
+    this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, options);
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
@@ -249,25 +361,28 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveTrivia
 }
 
 template<typename ValueType, typename SolutionType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment,
-                                                                                                       OptimizationDirection dir, std::vector<SolutionType>& x,
-                                                                                                       std::vector<ValueType> const& b) const {
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyConnectedEquationSystem(
+    std::vector<storm::Environment> const& sccSolverEnvironments, OptimizationDirection dir, std::vector<SolutionType>& x,
+    std::vector<ValueType> const& b) const {
     STORM_LOG_ASSERT(!this->choiceFixedForRowGroup || this->choiceFixedForRowGroup.get().empty(),
                      "Expecting no fixed choices for states when solving the fully connected equation system");
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
-    }
-    this->sccSolver->setMatrix(*this->A);
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setBoundsFromOtherSolver(*this);
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    uint64_t const solverIndex = storm::solver::helper::getSccSolverIndex(sccSolverEnvironments, this->A->getRowGroupCount(), this->A->getEntryCount());
+    storm::Environment const& sccSolverEnvironment = sccSolverEnvironments[solverIndex];
+    auto& sccSolver = this->sccSolvers[solverIndex];
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
+    }
+    sccSolver->setMatrix(*this->A);
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setBoundsFromOtherSolver(*this);
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
     if (this->hasInitialScheduler()) {
         auto choices = this->getInitialScheduler();
-        this->sccSolver->setInitialScheduler(std::move(choices));
+        sccSolver->setInitialScheduler(std::move(choices));
     }
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -282,28 +397,40 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyC
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, x, b);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, x, b);
     if (this->isTrackSchedulerSet()) {
-        this->schedulerChoices = this->sccSolver->getSchedulerChoices();
+        this->schedulerChoices = sccSolver->getSchedulerChoices();
     }
     return res;
 }
 
 template<typename ValueType, typename SolutionType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
-                                                                              storm::storage::BitVector const& sccRowGroups,
-                                                                              storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
-                                                                              std::vector<ValueType> const& globalB) const {
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(
+    std::vector<storm::Environment> const& sccSolverEnvironments, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups,
+    storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>& solvers) const {
+    // Pick the environment and the solver for this SCC
+    uint64_t solverIndex = 0;
+    if (sccSolverEnvironments.size() > 1) {
+        uint64_t numberOfEntries = 0;
+        for (auto row : sccRows) {
+            numberOfEntries += this->A->getRow(row).getNumberOfEntries();
+        }
+        solverIndex = storm::solver::helper::getSccSolverIndex(sccSolverEnvironments, sccRowGroups.getNumberOfSetBits(), numberOfEntries);
+    }
+    storm::Environment const& sccSolverEnvironment = sccSolverEnvironments[solverIndex];
+    auto& solver = solvers[solverIndex];
+
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!solver) {
+        solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        solver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    solver->setHasUniqueSolution(this->hasUniqueSolution());
+    solver->setHasNoEndComponents(this->hasNoEndComponents());
+    solver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -317,7 +444,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -326,11 +453,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            solver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    solver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -350,18 +477,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        solver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        solver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = solver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -376,14 +503,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    solver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = solver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, solver->getSchedulerChoices());
     }
 
     // Set solution
@@ -395,17 +522,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
 template<typename ValueType, typename SolutionType>
 MinMaxLinearEquationSolverRequirements TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::getRequirements(
     Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
-    // Return the requirements of the underlying solver
-    return GeneralMinMaxLinearEquationSolverFactory<ValueType>().getRequirements(getEnvironmentForUnderlyingSolver(env), this->hasUniqueSolution(),
-                                                                                 this->hasNoEndComponents(), direction, hasInitialScheduler,
-                                                                                 this->isTrackSchedulerSet());
+    // Return the requirements of the underlying solver(s)
+    MinMaxLinearEquationSolverRequirements requirements;
+    for (auto const& subEnv : getEnvironmentsForUnderlyingSolver(env)) {
+        storm::solver::helper::addRequirements(
+            requirements, GeneralMinMaxLinearEquationSolverFactory<ValueType>().getRequirements(subEnv, this->hasUniqueSolution(), this->hasNoEndComponents(),
+                                                                                               direction, hasInitialScheduler, this->isTrackSchedulerSet()));
+    }
+    return requirements;
 }
 
 template<typename ValueType, typename SolutionType>
 void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
-    sccSolver.reset();
+    sccSolvers.clear();
     auxiliaryRowGroupVector.reset();
     StandardMinMaxLinearEquationSolver<ValueType, SolutionType>::clearCache();
 }
@@ -33,6 +33,9 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
    private:
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+    // Retrieves the environments for the underlying solver. If SCCs are solved adaptively, there is one environment per helper::SccSolverClass.
+    std::vector<storm::Environment> getEnvironmentsForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
+
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
     void createSortedSccDecomposition(bool needLongestChainSize) const;
 
@@ -40,16 +43,25 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     // ... for the case that the SCC is trivial
     bool solveTrivialScc(uint64_t const& sccState, OptimizationDirection d, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
     // ... for the case that there is just one large SCC
-    bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<SolutionType>& x,
+    bool solveFullyConnectedEquationSystem(std::vector<storm::Environment> const& sccSolverEnvironments, OptimizationDirection d, std::vector<SolutionType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+    bool solveScc(std::vector<storm::Environment> const& sccSolverEnvironments, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
+                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
+                  std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>>& solvers) const;
+
+    // Computes the rows of the given SCC, considering the choices that are fixed for some row groups.
+    void setSccRows(storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector& sccRows) const;
+
+    // Solves all SCCs of the sorted SCC decomposition. SCCs with the same depth are solved concurrently.
+    bool solveSccsConcurrently(std::vector<storm::Environment> const& sccSolverEnvironments, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
-    mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+    // One solver per environment of the underlying solver
+    mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> sccSolvers;
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 }  // namespace solver
@@ -89,6 +89,29 @@ typename Z3LpSolver<ValueType, RawMode>::Variable Z3LpSolver<ValueType, RawMode>
     }
 }
 
+template<typename ValueType, bool RawMode>
+void Z3LpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    storm::expressions::Variable var;
+    if constexpr (RawMode) {
+        var = rawIndexToVariableMap[variable];
+    } else {
+        var = variable;
+    }
+    // Replace the summands of the variable in-place so that the summand indicators for push() and pop() remain valid.
+    storm::expressions::Expression newSummand = this->manager->rational(objectiveFunctionCoefficient) * var;
+    bool replaced = false;
+    for (auto& summand : optimizationSummands) {
+        if (summand.getVariables().count(var) > 0) {
+            summand = replaced ? this->manager->rational(storm::utility::zero<ValueType>()) : newSummand;
+            replaced = true;
+        }
+    }
+    if (!replaced && !storm::utility::isZero(objectiveFunctionCoefficient)) {
+        optimizationSummands.push_back(newSummand);
+    }
+    update();
+}
+
 template<typename ValueType, bool RawMode>
 void Z3LpSolver<ValueType, RawMode>::addConstraint(std::string const& name, Constraint const& constraint) {
     if constexpr (RawMode) {
@@ -346,6 +369,12 @@ typename Z3LpSolver<ValueType, RawMode>::Variable Z3LpSolver<ValueType, RawMode>
                                                           "Yet, a method was called that requires this support.";
 }
 
+template<typename ValueType, bool RawMode>
+void Z3LpSolver<ValueType, RawMode>::setObjectiveFunctionCoefficient(Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without Z3 or the version of Z3 does not support optimization. "
+                                                          "Yet, a method was called that requires this support.";
+}
+
 template<typename ValueType, bool RawMode>
 void Z3LpSolver<ValueType, RawMode>::update() const {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without Z3 or the version of Z3 does not support optimization. "
@@ -66,6 +66,7 @@ class Z3LpSolver : public LpSolver<ValueType, RawMode> {
     // Methods to add variables.
     virtual Variable addVariable(std::string const& name, VariableType const& type, std::optional<ValueType> const& lowerBound = std::nullopt,
                                  std::optional<ValueType> const& upperBound = std::nullopt, ValueType objectiveFunctionCoefficient = 0) override;
+    virtual void setObjectiveFunctionCoefficient(Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
 
     // Methods to incorporate recent changes.
     virtual void update() const override;
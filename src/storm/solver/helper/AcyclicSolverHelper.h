@@ -1,7 +1,13 @@
+#pragma once
+
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -122,6 +128,157 @@ storm::storage::SparseMatrix<ValueType> createReorderedMatrix(storm::storage::Sp
     STORM_LOG_DEBUG("Reordered " << matrix.getDimensionsAsString() << " with " << bFactors.size() << " selfloop entries for acyclic solving.");
     return result;
 }
+/*!
+ * A partition of the row groups of an acyclic matrix into levels. A row group only depends on row groups of smaller levels.
+ * The row groups of level l are groups[levelIndications[l]], ..., groups[levelIndications[l + 1] - 1].
+ */
+struct TopologicalLevels {
+    std::vector<uint64_t> levelIndications;
+    std::vector<uint64_t> groups;
+
+    uint64_t getNumberOfLevels() const {
+        return levelIndications.size() - 1;
+    }
+};
+
+/*!
+ * Computes the topological levels of the given matrix, which has to be ordered such that row group i only depends on row groups i, i+1, ...
+ * (e.g. the result of createReorderedMatrix). Row groups without successors (except for themselves) have level 0.
+ */
+template<typename ValueType>
+TopologicalLevels computeTopologicalLevels(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    uint64_t const numGroups = matrix.getRowGroupCount();
+    std::vector<uint64_t> levelOfGroup(numGroups, 0);
+    uint64_t maxLevel = 0;
+    for (uint64_t group = numGroups; group > 0;) {
+        --group;
+        uint64_t level = 0;
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (entry.getColumn() > group) {
+                level = std::max(level, levelOfGroup[entry.getColumn()] + 1);
+            } else {
+                STORM_LOG_ASSERT(entry.getColumn() == group || storm::utility::isZero(entry.getValue()), "The matrix is not ordered topologically.");
+            }
+        }
+        levelOfGroup[group] = level;
+        maxLevel = std::max(maxLevel, level);
+    }
+
+    // Sort the groups by their level (counting sort)
+    TopologicalLevels result;
+    result.levelIndications.assign(maxLevel + 2, 0);
+    for (auto const& level : levelOfGroup) {
+        ++result.levelIndications[level + 1];
+    }
+    for (uint64_t level = 1; level < result.levelIndications.size(); ++level) {
+        result.levelIndications[level] += result.levelIndications[level - 1];
+    }
+    result.groups.resize(numGroups);
+    std::vector<uint64_t> insertPositions(result.levelIndications.begin(), result.levelIndications.end() - 1);
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        result.groups[insertPositions[levelOfGroup[group]]++] = group;
+    }
+    return result;
+}
+
+/*!
+ * Solving the levels concurrently only pays off if the levels are large enough on average.
+ */
+inline bool isLevelParallelSolvingBeneficial(TopologicalLevels const& levels) {
+    return levels.groups.size() >= 1024 * levels.getNumberOfLevels();
+}
+
+/*!
+ * Computes b[row] + A[row] * x for a row of the given row group. Entries leading to smaller row groups are zero (as the matrix is ordered topologically)
+ * and are skipped, so this never reads values of row groups that might be written concurrently.
+ */
+template<typename ValueType>
+ValueType multiplyAcyclicRow(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t row, uint64_t group, std::vector<ValueType> const& x,
+                             std::vector<ValueType> const* b) {
+    ValueType result = b ? (*b)[row] : storm::utility::zero<ValueType>();
+    for (auto const& entry : matrix.getRow(row)) {
+        if (entry.getColumn() >= group) {
+            result += entry.getValue() * x[entry.getColumn()];
+        }
+    }
+    return result;
+}
+
+/*!
+ * Solves the linear equation system x = A*x + b for the given (topologically ordered) matrix level by level.
+ * The rows within a level are solved in parallel. Up to the order of summation, this yields the same result as a backwards Gauss-Seidel multiplication.
+ */
+template<typename ValueType>
+void solveLevelsInParallel(storm::storage::SparseMatrix<ValueType> const& matrix, TopologicalLevels const& levels, std::vector<ValueType>& x,
+                           std::vector<ValueType> const* b) {
+#ifdef STORM_HAVE_INTELTBB
+    for (uint64_t level = 0; level < levels.getNumberOfLevels(); ++level) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(levels.levelIndications[level], levels.levelIndications[level + 1]),
+                          [&](tbb::blocked_range<uint64_t> const& range) {
+                              for (auto i = range.begin(); i < range.end(); ++i) {
+                                  uint64_t const row = levels.groups[i];
+                                  x[row] = multiplyAcyclicRow(matrix, row, row, x, b);
+                              }
+                          });
+    }
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Solving levels in parallel requires Intel TBB.");
+#endif
+}
+
+/*!
+ * Solves the min max equation system x = min/max (A*x + b) for the given (topologically ordered) matrix level by level.
+ * The row groups within a level are solved in parallel. Up to the order of summation, this yields the same result (and choices) as a backwards Gauss-Seidel
+ * multiplication.
+ */
+template<typename ValueType>
+void solveLevelsInParallel(storm::storage::SparseMatrix<ValueType> const& matrix, storm::solver::OptimizationDirection dir, TopologicalLevels const& levels,
+                           std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices) {
+#ifdef STORM_HAVE_INTELTBB
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    auto isBetter = [dir](ValueType const& lhs, ValueType const& rhs) { return minimize(dir) ? lhs < rhs : lhs > rhs; };
+    auto solveGroup = [&](uint64_t group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        if (groupStart == groupEnd) {
+            x[group] = storm::utility::zero<ValueType>();
+            return;
+        }
+        // As in the backwards multiplication, the rows are considered in reverse order and ties are resolved in favor of the last row.
+        ValueType bestValue = multiplyAcyclicRow(matrix, groupEnd - 1, group, x, b);
+        uint64_t bestChoice = groupEnd - 1 - groupStart;
+        bool const hasOldChoice = choices && (*choices)[group] < groupEnd - groupStart;
+        ValueType oldChoiceValue = bestValue;
+        for (uint64_t row = groupEnd - 1; row > groupStart;) {
+            --row;
+            ValueType value = multiplyAcyclicRow(matrix, row, group, x, b);
+            if (hasOldChoice && row - groupStart == (*choices)[group]) {
+                oldChoiceValue = value;
+            }
+            if (isBetter(value, bestValue)) {
+                bestValue = std::move(value);
+                bestChoice = row - groupStart;
+            }
+        }
+        // The previous choice is only changed if the new one is strictly better.
+        if (choices && (!hasOldChoice || isBetter(bestValue, oldChoiceValue))) {
+            (*choices)[group] = bestChoice;
+        }
+        x[group] = std::move(bestValue);
+    };
+    for (uint64_t level = 0; level < levels.getNumberOfLevels(); ++level) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(levels.levelIndications[level], levels.levelIndications[level + 1]),
+                          [&](tbb::blocked_range<uint64_t> const& range) {
+                              for (auto i = range.begin(); i < range.end(); ++i) {
+                                  solveGroup(levels.groups[i]);
+                              }
+                          });
+    }
+#else
+    STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Solving levels in parallel requires Intel TBB.");
+#endif
+}
+
 }  // namespace helper
 }  // namespace solver
 }  // namespace storm
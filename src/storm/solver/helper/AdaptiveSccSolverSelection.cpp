@@ -0,0 +1,103 @@
+#include "storm/solver/helper/AdaptiveSccSolverSelection.h"
+
+#include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+// SCCs with at most this many states are solved directly. Dense factorizations of such systems are cheap and avoid slow convergence.
+uint64_t const maxNumberOfStatesOfSmallScc = 256;
+// SCCs with at least this many entries are iterated in parallel. Below, the synchronization overhead of each iteration does not pay off.
+uint64_t const minNumberOfEntriesOfLargeScc = 1ull << 20;
+
+void addRequirement(SolverRequirement const& other, SolverRequirement const& current, auto&& require) {
+    if (other) {
+        require(other.isCritical() || (current && current.isCritical()));
+    }
+}
+}  // namespace detail
+
+SccSolverClass classifyScc(uint64_t numberOfStates, uint64_t numberOfEntries) {
+    if (numberOfStates <= detail::maxNumberOfStatesOfSmallScc) {
+        return SccSolverClass::Small;
+    } else if (numberOfEntries >= detail::minNumberOfEntriesOfLargeScc) {
+        return SccSolverClass::Large;
+    } else {
+        return SccSolverClass::Medium;
+    }
+}
+
+uint64_t getSccSolverIndex(std::vector<storm::Environment> const& environments, uint64_t numberOfStates, uint64_t numberOfEntries) {
+    if (environments.size() == 1) {
+        return 0;
+    }
+    STORM_LOG_ASSERT(environments.size() == 3, "Unexpected number of environments for adaptive SCC solving.");
+    return static_cast<uint64_t>(classifyScc(numberOfStates, numberOfEntries));
+}
+
+std::vector<storm::Environment> getAdaptiveLinearEquationSolverEnvironments(storm::Environment const& env) {
+    if (env.solver().isForceSoundness()) {
+        // The native solver already picks a sound method and none of the faster alternatives below is sound.
+        return {env};
+    }
+    std::vector<storm::Environment> result(3, env);
+    auto& smallEnv = result[static_cast<uint64_t>(SccSolverClass::Small)];
+    smallEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+    smallEnv.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+
+    auto& mediumEnv = result[static_cast<uint64_t>(SccSolverClass::Medium)];
+    mediumEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    mediumEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+
+    // Regular (Jacobi style) multiplications of the power method are parallelized by the value iteration operator.
+    auto& largeEnv = result[static_cast<uint64_t>(SccSolverClass::Large)];
+    largeEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    largeEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+    largeEnv.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+    return result;
+}
+
+std::vector<storm::Environment> getAdaptiveMinMaxSolverEnvironments(storm::Environment const& env) {
+    std::vector<storm::Environment> result(3, env);
+    // Policy iteration typically needs few iterations. For small SCCs, each of them is cheap.
+    auto& smallEnv = result[static_cast<uint64_t>(SccSolverClass::Small)];
+    smallEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+    if (!env.solver().isForceSoundness()) {
+        smallEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        smallEnv.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+    }
+
+    auto& mediumEnv = result[static_cast<uint64_t>(SccSolverClass::Medium)];
+    auto& largeEnv = result[static_cast<uint64_t>(SccSolverClass::Large)];
+    if (env.solver().isForceSoundness()) {
+        mediumEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        largeEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+    } else {
+        mediumEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        largeEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    }
+    mediumEnv.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::GaussSeidel);
+    largeEnv.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+    return result;
+}
+
+void addRequirements(storm::solver::LinearEquationSolverRequirements& result, storm::solver::LinearEquationSolverRequirements const& other) {
+    detail::addRequirement(other.acyclic(), result.acyclic(), [&result](bool critical) { result.requireAcyclic(critical); });
+    detail::addRequirement(other.lowerBounds(), result.lowerBounds(), [&result](bool critical) { result.requireLowerBounds(critical); });
+    detail::addRequirement(other.upperBounds(), result.upperBounds(), [&result](bool critical) { result.requireUpperBounds(critical); });
+}
+
+void addRequirements(storm::solver::MinMaxLinearEquationSolverRequirements& result, storm::solver::MinMaxLinearEquationSolverRequirements const& other) {
+    detail::addRequirement(other.acyclic(), result.acyclic(), [&result](bool critical) { result.requireAcyclic(critical); });
+    detail::addRequirement(other.uniqueSolution(), result.uniqueSolution(), [&result](bool critical) { result.requireUniqueSolution(critical); });
+    detail::addRequirement(other.validInitialScheduler(), result.validInitialScheduler(),
+                           [&result](bool critical) { result.requireValidInitialScheduler(critical); });
+    detail::addRequirement(other.lowerBounds(), result.lowerBounds(), [&result](bool critical) { result.requireLowerBounds(critical); });
+    detail::addRequirement(other.upperBounds(), result.upperBounds(), [&result](bool critical) { result.requireUpperBounds(critical); });
+}
+
+}  // namespace storm::solver::helper
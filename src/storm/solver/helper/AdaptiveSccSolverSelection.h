@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/environment/Environment.h"
+#include "storm/solver/LinearEquationSolverRequirements.h"
+#include "storm/solver/MinMaxLinearEquationSolverRequirements.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Classes of (non-trivial) SCCs for which the topological solvers pick different solution methods.
+ * The values are used as indices into the environments returned by the functions below.
+ */
+enum class SccSolverClass : uint64_t {
+    // SCCs that are small enough to be solved directly (e.g. via LU factorization or policy iteration)
+    Small = 0,
+    // SCCs for which a sequential Gauss-Seidel style iteration is the best choice
+    Medium = 1,
+    // SCCs that are large enough such that parallelizing a single iteration pays off
+    Large = 2
+};
+
+/*!
+ * Classifies an SCC based on its number of states and the number of matrix entries of its rows. The latter also reflects the density of the SCC.
+ */
+SccSolverClass classifyScc(uint64_t numberOfStates, uint64_t numberOfEntries);
+
+/*!
+ * Retrieves the index of the environment (as returned by the functions below) that is to be used for the given SCC.
+ * If there is just a single environment, this is always 0.
+ */
+uint64_t getSccSolverIndex(std::vector<storm::Environment> const& environments, uint64_t numberOfStates, uint64_t numberOfEntries);
+
+/*!
+ * Derives one environment per SccSolverClass from the given environment of the underlying linear equation solver.
+ * Precisions are kept, only the solver types and methods are changed.
+ */
+std::vector<storm::Environment> getAdaptiveLinearEquationSolverEnvironments(storm::Environment const& env);
+
+/*!
+ * Derives one environment per SccSolverClass from the given environment of the underlying min max equation solver.
+ * Precisions are kept, only the solver types and methods are changed.
+ */
+std::vector<storm::Environment> getAdaptiveMinMaxSolverEnvironments(storm::Environment const& env);
+
+/*!
+ * Adds the requirements of other to result. Requirements that are critical in either of the two remain critical.
+ */
+void addRequirements(storm::solver::LinearEquationSolverRequirements& result, storm::solver::LinearEquationSolverRequirements const& other);
+void addRequirements(storm::solver::MinMaxLinearEquationSolverRequirements& result, storm::solver::MinMaxLinearEquationSolverRequirements const& other);
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,181 @@
+#include "storm/solver/helper/AsynchronousGaussSeidelHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+// Values of other blocks might be written concurrently. For floating point types, we therefore access the values atomically (without imposing any ordering).
+template<typename ValueType>
+constexpr bool AsynchronousAccess = std::is_floating_point_v<ValueType>;
+
+template<typename ValueType>
+ValueType loadValue(std::vector<ValueType>& x, uint64_t index) {
+    if constexpr (AsynchronousAccess<ValueType>) {
+        return std::atomic_ref<ValueType>(x[index]).load(std::memory_order_relaxed);
+    } else {
+        return x[index];
+    }
+}
+
+template<typename ValueType>
+void storeValue(std::vector<ValueType>& x, uint64_t index, ValueType const& value) {
+    if constexpr (AsynchronousAccess<ValueType>) {
+        std::atomic_ref<ValueType>(x[index]).store(value, std::memory_order_relaxed);
+    } else {
+        x[index] = value;
+    }
+}
+}  // namespace detail
+
+template<typename ValueType>
+AsynchronousGaussSeidelHelper<ValueType>::AsynchronousGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool trivialRowGrouping,
+                                                                        uint64_t numberOfBlocks)
+    : matrix(matrix), trivialRowGrouping(trivialRowGrouping || matrix.hasTrivialRowGrouping()) {
+    STORM_LOG_ASSERT(this->trivialRowGrouping || matrix.getRowGroupCount() == matrix.getColumnCount(), "Expected a square equation system.");
+    STORM_LOG_ASSERT(!this->trivialRowGrouping || matrix.getRowCount() == matrix.getColumnCount(), "Expected a square equation system.");
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfBlocks == 0) {
+        numberOfBlocks = storm::utility::getNumberOfThreads();
+    }
+#else
+    numberOfBlocks = 1;
+#endif
+    if constexpr (!detail::AsynchronousAccess<ValueType>) {
+        numberOfBlocks = 1;
+    }
+    uint64_t const numGroups = getRowGroupCount();
+    numberOfBlocks = std::max<uint64_t>(1, std::min<uint64_t>(numberOfBlocks, numGroups));
+
+    // Cut the row groups into contiguous blocks such that each block has roughly the same number of entries.
+    uint64_t const entriesPerBlock = std::max<uint64_t>(1, matrix.getEntryCount() / numberOfBlocks);
+    blockStarts.push_back(0);
+    uint64_t entriesInCurrentBlock = 0;
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        uint64_t const firstRow = this->trivialRowGrouping ? group : matrix.getRowGroupIndices()[group];
+        uint64_t const lastRow = this->trivialRowGrouping ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+        for (uint64_t row = firstRow; row < lastRow; ++row) {
+            entriesInCurrentBlock += matrix.getRow(row).getNumberOfEntries();
+        }
+        if (entriesInCurrentBlock >= entriesPerBlock && blockStarts.size() < numberOfBlocks && group + 1 < numGroups) {
+            blockStarts.push_back(group + 1);
+            entriesInCurrentBlock = 0;
+        }
+    }
+    blockStarts.push_back(numGroups);
+}
+
+template<typename ValueType>
+uint64_t AsynchronousGaussSeidelHelper<ValueType>::getNumberOfBlocks() const {
+    return blockStarts.size() - 1;
+}
+
+template<typename ValueType>
+uint64_t AsynchronousGaussSeidelHelper<ValueType>::getRowGroupCount() const {
+    return trivialRowGrouping ? matrix.getRowCount() : matrix.getRowGroupCount();
+}
+
+template<typename ValueType>
+template<storm::OptimizationDirection Dir, bool Relative>
+bool AsynchronousGaussSeidelHelper<ValueType>::sweepBlock(uint64_t block, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                          ValueType const& precision) const {
+    bool converged = true;
+    for (uint64_t group = blockStarts[block]; group < blockStarts[block + 1]; ++group) {
+        uint64_t const firstRow = trivialRowGrouping ? group : matrix.getRowGroupIndices()[group];
+        uint64_t const lastRow = trivialRowGrouping ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+        std::optional<ValueType> best;
+        for (uint64_t row = firstRow; row < lastRow; ++row) {
+            ValueType rowValue = b[row];
+            for (auto const& entry : matrix.getRow(row)) {
+                rowValue += entry.getValue() * detail::loadValue(x, entry.getColumn());
+            }
+            if (!best || (maximize(Dir) ? rowValue > *best : rowValue < *best)) {
+                best = std::move(rowValue);
+            }
+        }
+        if (!best) {
+            // Row groups without rows are not touched.
+            continue;
+        }
+        if (converged) {
+            ValueType const oldValue = detail::loadValue(x, group);
+            if constexpr (Relative) {
+                converged = storm::utility::abs<ValueType>(*best - oldValue) <= storm::utility::abs<ValueType>(precision * *best);
+            } else {
+                converged = storm::utility::abs<ValueType>(*best - oldValue) <= precision;
+            }
+        }
+        detail::storeValue(x, group, *best);
+    }
+    return converged;
+}
+
+template<typename ValueType>
+template<storm::OptimizationDirection Dir, bool Relative>
+SolverStatus AsynchronousGaussSeidelHelper<ValueType>::solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations,
+                                                             ValueType const& precision,
+                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_ASSERT(x.size() == getRowGroupCount(), "Unexpected size of the solution vector.");
+    STORM_LOG_ASSERT(b.size() == matrix.getRowCount(), "Unexpected size of the offset vector.");
+    uint64_t const numBlocks = getNumberOfBlocks();
+    // One flag per block. We use char instead of bool to avoid concurrent writes to the same byte of a std::vector<bool>.
+    std::vector<char> blockConverged(numBlocks, false);
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+#ifdef STORM_HAVE_INTELTBB
+        if (numBlocks > 1) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numBlocks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (auto block = range.begin(); block < range.end(); ++block) {
+                    blockConverged[block] = sweepBlock<Dir, Relative>(block, x, b, precision);
+                }
+            });
+        } else {
+            blockConverged.front() = sweepBlock<Dir, Relative>(0, x, b, precision);
+        }
+#else
+        for (uint64_t block = 0; block < numBlocks; ++block) {
+            blockConverged[block] = sweepBlock<Dir, Relative>(block, x, b, precision);
+        }
+#endif
+        if (std::all_of(blockConverged.begin(), blockConverged.end(), [](char c) { return c; })) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    return status;
+}
+
+template<typename ValueType>
+SolverStatus AsynchronousGaussSeidelHelper<ValueType>::solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations,
+                                                             bool relative, ValueType const& precision, std::optional<storm::OptimizationDirection> const& dir,
+                                                             std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_ASSERT(trivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if (!dir.has_value() || maximize(*dir)) {
+        if (relative) {
+            return solve<storm::OptimizationDirection::Maximize, true>(x, b, numIterations, precision, iterationCallback);
+        } else {
+            return solve<storm::OptimizationDirection::Maximize, false>(x, b, numIterations, precision, iterationCallback);
+        }
+    } else {
+        if (relative) {
+            return solve<storm::OptimizationDirection::Minimize, true>(x, b, numIterations, precision, iterationCallback);
+        } else {
+            return solve<storm::OptimizationDirection::Minimize, false>(x, b, numIterations, precision, iterationCallback);
+        }
+    }
+}
+
+template class AsynchronousGaussSeidelHelper<double>;
+template class AsynchronousGaussSeidelHelper<storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
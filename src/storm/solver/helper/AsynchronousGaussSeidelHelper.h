@@ -0,0 +1,67 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements an asynchronous block Gauss-Seidel iteration for fixed point equation systems of the form x = A*x + b (or x = min/max (A*x + b) if the matrix
+ * has a non-trivial row grouping).
+ * The row groups are partitioned into contiguous blocks of roughly the same number of matrix entries. In each sweep, the blocks are processed concurrently.
+ * Within a block, the values are updated in place (as in Gauss-Seidel) and reads of values of other blocks see whatever value has been written last, i.e.,
+ * there is no synchronization between the blocks during a sweep. Convergence is checked after each sweep by a reduction over the blocks.
+ * @note Concurrent processing is only performed for floating point value types. For other types, a single block is used.
+ */
+template<typename ValueType>
+class AsynchronousGaussSeidelHelper {
+   public:
+    /*!
+     * @param matrix the matrix A. The matrix is not copied, i.e., it has to remain valid as long as this helper is used.
+     * @param trivialRowGrouping if true, the row grouping of the matrix is ignored and each row is considered to be its own row group
+     * @param numberOfBlocks the desired number of blocks. Zero means that the number of threads is used.
+     */
+    AsynchronousGaussSeidelHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool trivialRowGrouping, uint64_t numberOfBlocks = 0);
+
+    /*!
+     * Iterates until the maximal (relative) difference between two sweeps is below the given precision or the callback signals termination.
+     * @param x the initial values, will be overwritten with the result
+     * @param numIterations will be increased by the number of performed sweeps
+     * @param dir the optimization direction. Has to be given iff the row grouping is non-trivial.
+     * @param iterationCallback called after each sweep. Can be used to check for early termination.
+     */
+    SolverStatus solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                       std::optional<storm::OptimizationDirection> const& dir = {},
+                       std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * @return the number of blocks in which the row groups are partitioned.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+   private:
+    template<storm::OptimizationDirection Dir, bool Relative>
+    SolverStatus solve(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, ValueType const& precision,
+                       std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const;
+
+    /*!
+     * Updates the values of the row groups in the given block in place.
+     * @return true iff for all row groups in the block, the (relative) difference between the old and the new value is at most the precision
+     */
+    template<storm::OptimizationDirection Dir, bool Relative>
+    bool sweepBlock(uint64_t block, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision) const;
+
+    uint64_t getRowGroupCount() const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    bool trivialRowGrouping;
+    // The i-th block consists of the row groups in [blockStarts[i], blockStarts[i+1])
+    std::vector<uint64_t> blockStarts;
+};
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,100 @@
+#include "storm/solver/helper/BlockValueIterationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Telemetry.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+BlockValueIterationHelper<ValueType>::BlockValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfOperands)
+    : matrix(matrix), numberOfOperands(numberOfOperands) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SolverStatus BlockValueIterationHelper<ValueType>::VI(std::vector<ValueType>& operands, std::vector<storm::storage::BitVector> const& updatedStates,
+                                                      uint64_t& numIterations, bool relative, ValueType const& precision, uint64_t maxIterations,
+                                                      std::optional<storm::OptimizationDirection> const& dir) const {
+    uint64_t const numberOfGroups = matrix.getRowGroupCount();
+    STORM_LOG_ASSERT(operands.size() == numberOfGroups * numberOfOperands, "Unexpected size of block vector.");
+    STORM_LOG_ASSERT(updatedStates.size() == numberOfOperands, "Unexpected number of updated state sets.");
+    STORM_LOG_ASSERT(dir.has_value() || matrix.hasTrivialRowGrouping(), "No optimization direction given for matrix with nontrivial row grouping.");
+    storm::utility::telemetry::Scope telemetryScope("block-value-iteration");
+    storm::utility::telemetry::setAttribute("operands", numberOfOperands);
+
+    // For each entry of the block vector, whether it is updated. Groups without any updated entry are skipped entirely.
+    std::vector<uint8_t> isUpdated(operands.size(), 0);
+    storm::storage::BitVector groupsWithUpdates(numberOfGroups, false);
+    for (uint64_t operand = 0; operand < numberOfOperands; ++operand) {
+        for (auto group : updatedStates[operand]) {
+            isUpdated[group * numberOfOperands + operand] = 1;
+            groupsWithUpdates.set(group, true);
+        }
+    }
+
+    bool const isMinimizing = dir.has_value() && storm::solver::minimize(*dir);
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<ValueType> rowValues(numberOfOperands);
+    std::vector<ValueType> groupValues(numberOfOperands);
+    numIterations = 0;
+    while (true) {
+        bool converged = true;
+        for (auto group : groupsWithUpdates) {
+            for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                std::fill(rowValues.begin(), rowValues.end(), storm::utility::zero<ValueType>());
+                for (auto const& entry : matrix.getRow(row)) {
+                    ValueType const* successorValues = operands.data() + entry.getColumn() * numberOfOperands;
+                    ValueType const& probability = entry.getValue();
+                    for (uint64_t operand = 0; operand < numberOfOperands; ++operand) {
+                        rowValues[operand] += probability * successorValues[operand];
+                    }
+                }
+                if (row == rowGroupIndices[group]) {
+                    std::swap(rowValues, groupValues);
+                } else if (isMinimizing) {
+                    for (uint64_t operand = 0; operand < numberOfOperands; ++operand) {
+                        groupValues[operand] = std::min(groupValues[operand], rowValues[operand]);
+                    }
+                } else {
+                    for (uint64_t operand = 0; operand < numberOfOperands; ++operand) {
+                        groupValues[operand] = std::max(groupValues[operand], rowValues[operand]);
+                    }
+                }
+            }
+            uint64_t const offset = group * numberOfOperands;
+            for (uint64_t operand = 0; operand < numberOfOperands; ++operand) {
+                if (isUpdated[offset + operand]) {
+                    ValueType& value = operands[offset + operand];
+                    if (converged) {
+                        ValueType difference = std::abs(groupValues[operand] - value);
+                        converged = relative ? difference <= precision * std::abs(groupValues[operand]) : difference <= precision;
+                    }
+                    value = groupValues[operand];
+                }
+            }
+        }
+        ++numIterations;
+        if (converged) {
+            storm::utility::telemetry::setAttribute("iterations", numIterations);
+            return SolverStatus::Converged;
+        }
+        if (numIterations >= maxIterations) {
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            return SolverStatus::Aborted;
+        }
+    }
+}
+
+template class BlockValueIterationHelper<double>;
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+namespace storage {
+template<typename T>
+class SparseMatrix;
+class BitVector;
+}  // namespace storage
+
+namespace solver::helper {
+
+/*!
+ * Performs value iteration for several operands at once, e.g., to compute the reachability probabilities of several goal sets.
+ * The operands are stored in a block vector, i.e., the values of all operands for a row group are stored consecutively. A sweep over the matrix thus
+ * processes each matrix entry once for all operands, which makes much better use of the cache than separate iterations for each operand.
+ */
+template<typename ValueType>
+class BlockValueIterationHelper {
+   public:
+    /*!
+     * @param matrix The matrix (with one row group per state). The reference must not be invalidated as long as this helper is used.
+     * @param numberOfOperands The number of operands that are iterated at once.
+     */
+    BlockValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfOperands);
+
+    /*!
+     * Performs Gauss-Seidel style value iterations x_k(s) = opt_{rows r of s} sum_j A(r,j) * x_k(j), where only the values of the updated states of
+     * each operand are changed. The remaining values of an operand are fixed.
+     * @param operands The block vector with entry operands[s * numberOfOperands + k] for the value of operand k at row group s. Contains the initial
+     * values (in particular the fixed ones) and is set to the result.
+     * @param updatedStates For each operand the row groups whose values are updated.
+     * @param numIterations Is set to the number of performed iterations.
+     * @param relative Whether the precision is relative.
+     * @param precision The precision that is required for all operands.
+     * @param maxIterations The maximal number of iterations.
+     * @param dir The optimization direction (only if the matrix has non-trivial row groups).
+     */
+    SolverStatus VI(std::vector<ValueType>& operands, std::vector<storm::storage::BitVector> const& updatedStates, uint64_t& numIterations, bool relative,
+                    ValueType const& precision, uint64_t maxIterations, std::optional<storm::OptimizationDirection> const& dir = {}) const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    uint64_t numberOfOperands;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
@@ -1,5 +1,6 @@
 #include "storm/solver/helper/IntervalterationHelper.h"
 
+#include <atomic>
 #include <type_traits>
 
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -17,10 +18,18 @@ IntervalIterationHelper<ValueType, TrivialRowGrouping>::IntervalIterationHelper(
     // Intentionally left empty.
 }
 
-template<typename ValueType, OptimizationDirection Dir>
+template<typename ValueType, OptimizationDirection Dir, bool Relative>
 class IIBackend {
    public:
-    void startNewIteration() {}
+    IIBackend(ValueType const& precision, storm::storage::BitVector const* relevantValues, bool asynchronous)
+        : precision(precision), relevantValues(relevantValues), asynchronous(asynchronous) {
+        // intentionally left empty.
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+        maximalDifference = storm::utility::zero<ValueType>();
+    }
 
     void firstRow(std::pair<ValueType, ValueType>&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
         xBest = std::move(value.first);
@@ -32,57 +41,77 @@ class IIBackend {
         yBest &= std::move(value.second);
     }
 
-    void applyUpdate(ValueType& xCurr, ValueType& yCurr, [[maybe_unused]] uint64_t rowGroup) {
-        xCurr = std::max(xCurr, *xBest);
-        yCurr = std::min(yCurr, *yBest);
+    void applyUpdate(ValueType& xCurr, ValueType& yCurr, uint64_t rowGroup) {
+        // Only this chunk writes the values of the current group, so we can read them without synchronization.
+        ValueType const& xNew = std::max(xCurr, *xBest);
+        ValueType const& yNew = std::min(yCurr, *yBest);
+        if (!relevantValues || relevantValues->get(rowGroup)) {
+            checkConvergence(xNew, yNew);
+        }
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            if (asynchronous) {
+                // Other chunks might read the values concurrently (see ValueIterationOperator::apply)
+                std::atomic_ref<ValueType>(xCurr).store(xNew, std::memory_order_relaxed);
+                std::atomic_ref<ValueType>(yCurr).store(yNew, std::memory_order_relaxed);
+                return;
+            }
+        }
+        xCurr = xNew;
+        yCurr = yNew;
     }
 
     void endOfIteration() const {
         // intentionally left empty.
     }
 
-    bool constexpr converged() const {
-        return false;
+    bool converged() const {
+        if constexpr (Relative) {
+            return isConverged;
+        } else {
+            return maximalDifference <= precision;
+        }
     }
 
     bool constexpr abort() const {
         return false;
     }
 
-   private:
-    storm::utility::Extremum<Dir, ValueType> xBest, yBest;
-};
+    bool isAsynchronous() const {
+        return asynchronous;
+    }
 
-template<typename ValueType>
-bool checkConvergence(std::pair<std::vector<ValueType>, std::vector<ValueType>> const& xy, uint64_t& convergenceCheckState,
-                      std::function<void()> const& getNextConvergenceCheckState, bool relative, ValueType const& precision) {
-    if (relative) {
-        for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
-            ValueType const& l = xy.first[convergenceCheckState];
-            ValueType const& u = xy.second[convergenceCheckState];
+    void mergeChunk(IIBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+        maximalDifference = std::max(maximalDifference, chunkBackend.maximalDifference);
+    }
+
+   private:
+    void checkConvergence(ValueType const& l, ValueType const& u) {
+        if constexpr (Relative) {
+            if (!isConverged) {
+                return;
+            }
             if (l > storm::utility::zero<ValueType>()) {
-                if ((u - l) > l * precision) {
-                    return false;
-                }
+                isConverged = (u - l) <= l * precision;
             } else if (u < storm::utility::zero<ValueType>()) {
-                if ((l - u) < u * precision) {
-                    return false;
-                }
+                isConverged = (l - u) >= u * precision;
             } else {  //  l <= 0 <= u
-                if (l != u) {
-                    return false;
-                }
+                isConverged = l == u;
             }
-        }
-    } else {
-        for (; convergenceCheckState < xy.first.size(); getNextConvergenceCheckState()) {
-            if (xy.second[convergenceCheckState] - xy.first[convergenceCheckState] > precision) {
-                return false;
+        } else {
+            if (u - l > maximalDifference) {
+                maximalDifference = u - l;
             }
         }
     }
-    return true;
-}
+
+    storm::utility::Extremum<Dir, ValueType> xBest, yBest;
+    ValueType const precision;
+    storm::storage::BitVector const* relevantValues;
+    bool const asynchronous;
+    bool isConverged{true};
+    ValueType maximalDifference;
+};
 
 template<typename ValueType, bool TrivialRowGrouping>
 template<OptimizationDirection Dir>
@@ -90,23 +119,29 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pai
                                                                         std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative,
                                                                         ValueType const& precision,
                                                                         std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
-    SolverStatus status{SolverStatus::InProgress};
-    IIBackend<ValueType, Dir> backend;
-    uint64_t convergenceCheckState = 0;
-    std::function<void()> getNextConvergenceCheckState;
-    if (relevantValues) {
-        convergenceCheckState = relevantValues->getNextSetIndex(0);
-        getNextConvergenceCheckState = [&convergenceCheckState, &relevantValues]() {
-            convergenceCheckState = relevantValues->getNextSetIndex(++convergenceCheckState);
-        };
+                                                                        std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                        bool asynchronous) const {
+    if (relative) {
+        return II<Dir, true>(xy, offsets, numIterations, precision, iterationCallback, relevantValues, asynchronous);
     } else {
-        getNextConvergenceCheckState = [&convergenceCheckState]() { ++convergenceCheckState; };
+        return II<Dir, false>(xy, offsets, numIterations, precision, iterationCallback, relevantValues, asynchronous);
     }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<OptimizationDirection Dir, bool Relative>
+SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy,
+                                                                        std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                                                                        ValueType const& precision,
+                                                                        std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                                                                        std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                        bool asynchronous) const {
+    SolverStatus status{SolverStatus::InProgress};
+    // The convergence check is fused into the application of the operator, i.e., each (chunk of a) sweep reports whether the bounds are close enough.
+    IIBackend<ValueType, Dir, Relative> backend(precision, relevantValues ? &relevantValues.value() : nullptr, asynchronous);
     while (status == SolverStatus::InProgress) {
         ++numIterations;
-        viOperator->template applyInPlace(xy, offsets, backend);
-        if (checkConvergence(xy, convergenceCheckState, getNextConvergenceCheckState, relative, precision)) {
+        if (viOperator->template applyInPlace(xy, offsets, backend)) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
             status = iterationCallback(IIData<ValueType>({xy.first, xy.second, status}));
@@ -122,7 +157,8 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
                                                                         std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
                                                                         std::optional<storm::OptimizationDirection> const& dir,
                                                                         std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+                                                                        std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                        bool asynchronous) const {
     // Create two vectors x and y using the given operand plus an auxiliary vector.
     std::pair<std::vector<ValueType>, std::vector<ValueType>> xy;
     auto& auxVector = viOperator->allocateAuxiliaryVector(operand.size());
@@ -136,9 +172,9 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
     }
     SolverStatus status;
     if (!dir.has_value() || maximize(*dir)) {
-        status = II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+        status = II<OptimizationDirection::Maximize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues, asynchronous);
     } else {
-        status = II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues);
+        status = II<OptimizationDirection::Minimize>(xy, offsets, numIterations, relative, precision, iterationCallback, relevantValues, asynchronous);
     }
     auto two = storm::utility::convertNumber<ValueType>(2.0);
     // get the average of lower- and upper result
@@ -158,9 +194,11 @@ SolverStatus IntervalIterationHelper<ValueType, TrivialRowGrouping>::II(std::vec
                                                                         std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds,
                                                                         std::optional<storm::OptimizationDirection> const& dir,
                                                                         std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
-                                                                        std::optional<storm::storage::BitVector> const& relevantValues) const {
+                                                                        std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                        bool asynchronous) const {
     uint64_t numIterations = 0;
-    return II(operand, offsets, numIterations, relative, precision, prepareLowerBounds, prepareUpperBounds, dir, iterationCallback, relevantValues);
+    return II(operand, offsets, numIterations, relative, precision, prepareLowerBounds, prepareUpperBounds, dir, iterationCallback, relevantValues,
+              asynchronous);
 }
 
 template class IntervalIterationHelper<double, true>;
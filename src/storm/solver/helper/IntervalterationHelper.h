@@ -26,24 +26,37 @@ class IntervalIterationHelper {
    public:
     IntervalIterationHelper(std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator);
 
+    /*!
+     * Performs interval iteration on the given lower (first) and upper (second) bounds.
+     * The convergence check is part of the operator application. If the operator is applied in parallel (see ValueIterationOperator::setParallelApply),
+     * each chunk determines the largest gap between the bounds of its groups and the results are merged after each sweep.
+     * @param asynchronous if true and the operator is applied in parallel, the chunks update the bounds in place and read values that are concurrently
+     * written by other chunks, i.e., we do not wait for a sweep to finish before using the tightened bounds. This is sound as the operator is monotone and
+     * the bounds are only ever tightened. Only has an effect for floating point values.
+     */
     template<OptimizationDirection Dir>
     SolverStatus II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::vector<ValueType> const& offsets, uint64_t& numIterations,
                     bool relative, ValueType const& precision, std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
-                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}, bool asynchronous = false) const;
 
     SolverStatus II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t& numIterations, bool relative, ValueType const& precision,
                     std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
                     std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
                     std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
-                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}, bool asynchronous = false) const;
 
     SolverStatus II(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, bool relative, ValueType const& precision,
                     std::function<void(std::vector<ValueType>&)> const& prepareLowerBounds,
                     std::function<void(std::vector<ValueType>&)> const& prepareUpperBounds, std::optional<storm::OptimizationDirection> const& dir = {},
                     std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback = {},
-                    std::optional<storm::storage::BitVector> const& relevantValues = {}) const;
+                    std::optional<storm::storage::BitVector> const& relevantValues = {}, bool asynchronous = false) const;
 
    private:
+    template<OptimizationDirection Dir, bool Relative>
+    SolverStatus II(std::pair<std::vector<ValueType>, std::vector<ValueType>>& xy, std::vector<ValueType> const& offsets, uint64_t& numIterations,
+                    ValueType const& precision, std::function<SolverStatus(IIData<ValueType> const&)> const& iterationCallback,
+                    std::optional<storm::storage::BitVector> const& relevantValues, bool asynchronous) const;
+
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
 };
 
@@ -0,0 +1,309 @@
+#include "storm/solver/helper/KrylovHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/Telemetry.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+Ilu0Preconditioner<ValueType>::Ilu0Preconditioner(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : factors(matrix), inverseDiagonal(matrix.getRowCount(), storm::utility::one<ValueType>()) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "ILU(0) factorization requires a square matrix.");
+    uint64_t const noPosition = std::numeric_limits<uint64_t>::max();
+    uint64_t const numRows = factors.getRowCount();
+    // positions[j] is the offset of the entry in column j within the current row (if there is one)
+    std::vector<uint64_t> positions(numRows, noPosition);
+    uint64_t numReplacedPivots = 0;
+    for (uint64_t row = 0; row < numRows; ++row) {
+        auto const rowBegin = factors.begin(row);
+        auto const rowEnd = factors.end(row);
+        for (auto entryIt = rowBegin; entryIt != rowEnd; ++entryIt) {
+            positions[entryIt->getColumn()] = entryIt - rowBegin;
+        }
+        // Eliminate the entries left of the diagonal in ascending column order. This only modifies entries in larger columns.
+        for (auto entryIt = rowBegin; entryIt != rowEnd && entryIt->getColumn() < row; ++entryIt) {
+            uint64_t const pivotRow = entryIt->getColumn();
+            ValueType const factor = entryIt->getValue() * inverseDiagonal[pivotRow];
+            entryIt->setValue(factor);
+            for (auto pivotIt = factors.begin(pivotRow), pivotEnd = factors.end(pivotRow); pivotIt != pivotEnd; ++pivotIt) {
+                if (pivotIt->getColumn() > pivotRow && positions[pivotIt->getColumn()] != noPosition) {
+                    auto targetIt = rowBegin + positions[pivotIt->getColumn()];
+                    targetIt->setValue(targetIt->getValue() - factor * pivotIt->getValue());
+                }
+            }
+        }
+        if (positions[row] != noPosition && !storm::utility::isZero((rowBegin + positions[row])->getValue())) {
+            inverseDiagonal[row] = storm::utility::one<ValueType>() / (rowBegin + positions[row])->getValue();
+        } else {
+            ++numReplacedPivots;
+        }
+        for (auto entryIt = rowBegin; entryIt != rowEnd; ++entryIt) {
+            positions[entryIt->getColumn()] = noPosition;
+        }
+    }
+    STORM_LOG_WARN_COND(numReplacedPivots == 0, "Replaced " << numReplacedPivots << " vanishing pivot(s) of the ILU(0) factorization.");
+}
+
+template<typename ValueType>
+void Ilu0Preconditioner<ValueType>::apply(std::vector<ValueType> const& b, std::vector<ValueType>& x) const {
+    if (&x != &b) {
+        x = b;
+    }
+    uint64_t const numRows = factors.getRowCount();
+    // Forward substitution with L
+    for (uint64_t row = 0; row < numRows; ++row) {
+        ValueType value = x[row];
+        for (auto const& entry : factors.getRow(row)) {
+            if (entry.getColumn() >= row) {
+                break;
+            }
+            value -= entry.getValue() * x[entry.getColumn()];
+        }
+        x[row] = value;
+    }
+    // Backward substitution with U
+    for (uint64_t row = numRows; row > 0;) {
+        --row;
+        ValueType value = x[row];
+        for (auto const& entry : factors.getRow(row)) {
+            if (entry.getColumn() > row) {
+                value -= entry.getValue() * x[entry.getColumn()];
+            }
+        }
+        x[row] = value * inverseDiagonal[row];
+    }
+}
+
+template<typename ValueType>
+KrylovHelper<ValueType>::KrylovHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool usePreconditioner) : matrix(matrix) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Krylov subspace methods require a square matrix.");
+    if (usePreconditioner) {
+        preconditioner.emplace(matrix);
+    }
+}
+
+template<typename ValueType>
+void KrylovHelper<ValueType>::precondition(std::vector<ValueType> const& in, std::vector<ValueType>& out) const {
+    if (preconditioner) {
+        preconditioner->apply(in, out);
+    } else if (&in != &out) {
+        out = in;
+    }
+}
+
+template<typename ValueType>
+ValueType KrylovHelper<ValueType>::computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& r) const {
+    matrix.multiplyWithVector(x, r);
+    storm::utility::vector::applyPointwise(b, r, r, [](ValueType const& bi, ValueType const& axi) { return bi - axi; });
+    return storm::utility::sqrt(storm::utility::vector::dotProduct(r, r));
+}
+
+template<typename ValueType>
+ValueType KrylovHelper<ValueType>::getTargetResidual(std::vector<ValueType> const& b, bool relative, ValueType const& precision) const {
+    if (relative) {
+        return precision * storm::utility::sqrt(storm::utility::vector::dotProduct(b, b));
+    } else {
+        return precision;
+    }
+}
+
+namespace detail {
+template<typename ValueType>
+void recordResidual(ValueType const& residual) {
+    if (storm::utility::telemetry::isRecording()) {
+        storm::utility::telemetry::appendToSeries("residual", storm::utility::convertNumber<double>(residual));
+    }
+}
+}  // namespace detail
+
+template<typename ValueType>
+SolverStatus KrylovHelper<ValueType>::bicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative,
+                                               ValueType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    uint64_t const n = x.size();
+    ValueType const targetResidual = getTargetResidual(b, relative, precision);
+    std::vector<ValueType> r(n);
+    ValueType residual = computeResidual(x, b, r);
+    if (residual <= targetResidual) {
+        return SolverStatus::Converged;
+    }
+
+    std::vector<ValueType> rHat, p, v, pHat(n), s(n), sHat(n), t(n);
+    ValueType rho, alpha, omega;
+    // (Re-)starts the method at the current residual. This is also done in case of a (near) breakdown.
+    auto restart = [&]() {
+        rHat = r;
+        p.assign(n, storm::utility::zero<ValueType>());
+        v.assign(n, storm::utility::zero<ValueType>());
+        rho = alpha = omega = storm::utility::one<ValueType>();
+    };
+    restart();
+
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        ValueType rhoNew = storm::utility::vector::dotProduct(rHat, r);
+        if (storm::utility::isZero(rhoNew)) {
+            restart();
+            rhoNew = storm::utility::vector::dotProduct(rHat, r);
+        }
+        ValueType const beta = (rhoNew / rho) * (alpha / omega);
+        for (uint64_t i = 0; i < n; ++i) {
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+        }
+        precondition(p, pHat);
+        matrix.multiplyWithVector(pHat, v);
+        ValueType const rHatV = storm::utility::vector::dotProduct(rHat, v);
+        bool needsRestart = storm::utility::isZero(rHatV);
+        if (!needsRestart) {
+            alpha = rhoNew / rHatV;
+            storm::utility::vector::applyPointwise(r, v, s, [&alpha](ValueType const& ri, ValueType const& vi) { return ri - alpha * vi; });
+            storm::utility::vector::addScaledVector(x, pHat, alpha);
+            residual = storm::utility::sqrt(storm::utility::vector::dotProduct(s, s));
+            if (residual <= targetResidual) {
+                std::swap(r, s);
+            } else {
+                precondition(s, sHat);
+                matrix.multiplyWithVector(sHat, t);
+                ValueType const tt = storm::utility::vector::dotProduct(t, t);
+                omega = storm::utility::isZero(tt) ? storm::utility::zero<ValueType>() : ValueType(storm::utility::vector::dotProduct(t, s) / tt);
+                storm::utility::vector::addScaledVector(x, sHat, omega);
+                storm::utility::vector::applyPointwise(s, t, r, [&omega](ValueType const& si, ValueType const& ti) { return si - omega * ti; });
+                residual = storm::utility::sqrt(storm::utility::vector::dotProduct(r, r));
+                needsRestart = storm::utility::isZero(omega);
+            }
+            rho = rhoNew;
+        }
+        detail::recordResidual(residual);
+
+        if (residual <= targetResidual) {
+            // The recursively updated residual might deviate from the actual one due to rounding errors.
+            residual = computeResidual(x, b, r);
+            if (residual <= targetResidual) {
+                status = SolverStatus::Converged;
+            } else {
+                needsRestart = true;
+            }
+        }
+        if (needsRestart && status == SolverStatus::InProgress) {
+            restart();
+        }
+        if (status == SolverStatus::InProgress && iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    return status;
+}
+
+template<typename ValueType>
+SolverStatus KrylovHelper<ValueType>::gmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative,
+                                            ValueType const& precision, uint64_t restart,
+                                            std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_THROW(restart > 0, storm::exceptions::InvalidArgumentException, "The restart of GMRES has to be positive.");
+    uint64_t const n = x.size();
+    ValueType const targetResidual = getTargetResidual(b, relative, precision);
+    std::vector<ValueType> r(n);
+    ValueType residual = computeResidual(x, b, r);
+    if (residual <= targetResidual) {
+        return SolverStatus::Converged;
+    }
+
+    // The orthonormal basis of the Krylov subspace
+    std::vector<std::vector<ValueType>> basis;
+    // The j-th column of the Hessenberg matrix. After applying the Givens rotations, this is the j-th column of an upper triangular matrix.
+    std::vector<std::vector<ValueType>> hessenberg(restart);
+    // The cosines and sines of the Givens rotations and the right-hand side of the least squares problem
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), y(restart);
+    std::vector<ValueType> z(n), w(n);
+
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        basis.assign(1, r);
+        storm::utility::vector::scaleVectorInPlace(basis.front(), storm::utility::one<ValueType>() / residual);
+        std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+        g.front() = residual;
+
+        uint64_t dimension = 0;
+        while (dimension < restart && status == SolverStatus::InProgress) {
+            uint64_t const j = dimension++;
+            ++numIterations;
+            precondition(basis[j], z);
+            matrix.multiplyWithVector(z, w);
+            // Orthogonalize w against the current basis (modified Gram-Schmidt)
+            auto& column = hessenberg[j];
+            column.resize(j + 2);
+            for (uint64_t i = 0; i <= j; ++i) {
+                column[i] = storm::utility::vector::dotProduct(w, basis[i]);
+                storm::utility::vector::addScaledVector(w, basis[i], -column[i]);
+            }
+            ValueType const wNorm = storm::utility::sqrt(storm::utility::vector::dotProduct(w, w));
+            column[j + 1] = wNorm;
+
+            // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+            for (uint64_t i = 0; i < j; ++i) {
+                ValueType const tmp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                column[i + 1] = cosines[i] * column[i + 1] - sines[i] * column[i];
+                column[i] = tmp;
+            }
+            ValueType const denominator = storm::utility::sqrt(column[j] * column[j] + column[j + 1] * column[j + 1]);
+            if (storm::utility::isZero(denominator)) {
+                cosines[j] = storm::utility::one<ValueType>();
+                sines[j] = storm::utility::zero<ValueType>();
+            } else {
+                cosines[j] = column[j] / denominator;
+                sines[j] = column[j + 1] / denominator;
+            }
+            column[j] = denominator;
+            column[j + 1] = storm::utility::zero<ValueType>();
+            g[j + 1] = -sines[j] * g[j];
+            g[j] = cosines[j] * g[j];
+            residual = storm::utility::abs(g[j + 1]);
+            detail::recordResidual(residual);
+
+            if (iterationCallback) {
+                status = iterationCallback(status);
+            }
+            if (residual <= targetResidual || storm::utility::isZero(wNorm)) {
+                // Either the estimated residual is small enough or the Krylov subspace is invariant under the (preconditioned) matrix.
+                break;
+            }
+            basis.push_back(w);
+            storm::utility::vector::scaleVectorInPlace(basis.back(), storm::utility::one<ValueType>() / wNorm);
+        }
+
+        // Solve the triangular system and update x with the preconditioned linear combination of the basis vectors.
+        for (uint64_t i = dimension; i > 0;) {
+            --i;
+            ValueType value = g[i];
+            for (uint64_t l = i + 1; l < dimension; ++l) {
+                value -= hessenberg[l][i] * y[l];
+            }
+            y[i] = storm::utility::isZero(hessenberg[i][i]) ? storm::utility::zero<ValueType>() : ValueType(value / hessenberg[i][i]);
+        }
+        std::fill(w.begin(), w.end(), storm::utility::zero<ValueType>());
+        for (uint64_t i = 0; i < dimension; ++i) {
+            storm::utility::vector::addScaledVector(w, basis[i], y[i]);
+        }
+        precondition(w, z);
+        storm::utility::vector::addScaledVector(x, z, storm::utility::one<ValueType>());
+
+        // The estimated residual might deviate from the actual one due to rounding errors.
+        residual = computeResidual(x, b, r);
+        if (residual <= targetResidual) {
+            status = SolverStatus::Converged;
+        }
+    }
+    return status;
+}
+
+template class Ilu0Preconditioner<double>;
+template class KrylovHelper<double>;
+
+}  // namespace storm::solver::helper
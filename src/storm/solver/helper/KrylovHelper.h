@@ -0,0 +1,90 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Incomplete LU factorization without fill-in (ILU(0)) of a square matrix A, i.e., L*U approximates A where L (with unit diagonal) and U have the sparsity
+ * pattern of the lower and upper triangular part of A, respectively.
+ */
+template<typename ValueType>
+class Ilu0Preconditioner {
+   public:
+    /*!
+     * Computes the factorization. Pivots that vanish (in particular those of rows without diagonal entry) are replaced by one.
+     * @param matrix the square matrix A. The matrix is copied.
+     */
+    explicit Ilu0Preconditioner(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Solves L*U*x = b. The vectors x and b may be the same.
+     */
+    void apply(std::vector<ValueType> const& b, std::vector<ValueType>& x) const;
+
+   private:
+    // Stores the strictly lower part of L and the strictly upper part of U. Diagonal entries (if present) are not used.
+    storm::storage::SparseMatrix<ValueType> factors;
+    // The inverses of the diagonal entries of U.
+    std::vector<ValueType> inverseDiagonal;
+};
+
+/*!
+ * Implements Krylov subspace methods for equation systems A*x = b with a square matrix A. The methods are right-preconditioned with ILU(0) and solely
+ * rely on sparse matrix-vector products with A, i.e., there is no conversion to other matrix formats.
+ * The methods terminate as soon as the (Euclidean) norm of the residual b - A*x is at most precision (times the norm of b, if relative is set).
+ */
+template<typename ValueType>
+class KrylovHelper {
+   public:
+    /*!
+     * @param matrix the matrix A. The matrix is not copied, i.e., it has to remain valid as long as this helper is used.
+     * @param usePreconditioner if set, an ILU(0) preconditioner is computed.
+     */
+    KrylovHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool usePreconditioner = true);
+
+    /*!
+     * Applies the stabilized bi-conjugate gradient method (BiCGSTAB).
+     * @param x the initial guess, will be overwritten with the result
+     * @param numIterations will be increased by the number of performed iterations
+     * @param iterationCallback called after each iteration. Can be used to check for early termination.
+     */
+    SolverStatus bicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                          std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+    /*!
+     * Applies the generalized minimal residual method (GMRES) which is restarted after the given number of iterations.
+     * @param x the initial guess, will be overwritten with the result
+     * @param numIterations will be increased by the number of performed iterations
+     * @param iterationCallback called after each iteration. Can be used to check for early termination.
+     * @note x is only updated at the end of each restart cycle, i.e., the callback might see an outdated solution.
+     */
+    SolverStatus gmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t& numIterations, bool relative, ValueType const& precision,
+                       uint64_t restart, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+   private:
+    /*!
+     * Sets out to M^-1 * in where M is the preconditioner (or the identity if there is none).
+     */
+    void precondition(std::vector<ValueType> const& in, std::vector<ValueType>& out) const;
+
+    /*!
+     * Sets r to b - A*x and returns the norm of r.
+     */
+    ValueType computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& r) const;
+
+    /*!
+     * Retrieves the bound for the norm of the residual.
+     */
+    ValueType getTargetResidual(std::vector<ValueType> const& b, bool relative, ValueType const& precision) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    std::optional<Ilu0Preconditioner<ValueType>> preconditioner;
+};
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,225 @@
+#include "storm/solver/helper/MappedValueIterationHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::solver::helper {
+
+namespace {
+// Values of other blocks might be written concurrently, so we access the values atomically (without imposing any ordering).
+double loadValue(std::vector<double>& x, uint64_t index) {
+    return std::atomic_ref<double>(x[index]).load(std::memory_order_relaxed);
+}
+
+void storeValue(std::vector<double>& x, uint64_t index, double value) {
+    std::atomic_ref<double>(x[index]).store(value, std::memory_order_relaxed);
+}
+}  // namespace
+
+MappedValueIterationHelper::MappedValueIterationHelper(MappedSparseMatrix const& matrix, uint64_t numberOfBlocks) : matrix(matrix) {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfBlocks == 0) {
+        numberOfBlocks = storm::utility::getNumberOfThreads();
+    }
+#else
+    numberOfBlocks = 1;
+#endif
+    numberOfBlocks = std::max<uint64_t>(1, std::min<uint64_t>(numberOfBlocks, matrix.numberOfStates));
+
+    // Cut the states into contiguous blocks such that each block has roughly the same number of entries. This only touches the row (group) indications.
+    uint64_t const numberOfEntries = matrix.rowIndications[matrix.numberOfRows];
+    uint64_t const entriesPerBlock = std::max<uint64_t>(1, numberOfEntries / numberOfBlocks);
+    blockStarts.push_back(0);
+    uint64_t blockBegin = 0;
+    for (uint64_t state = 0; state < matrix.numberOfStates; ++state) {
+        uint64_t const entriesInCurrentBlock = matrix.rowIndications[matrix.getLastRow(state)] - blockBegin;
+        if (entriesInCurrentBlock >= entriesPerBlock && blockStarts.size() < numberOfBlocks && state + 1 < matrix.numberOfStates) {
+            blockStarts.push_back(state + 1);
+            blockBegin = matrix.rowIndications[matrix.getLastRow(state)];
+        }
+    }
+    blockStarts.push_back(matrix.numberOfStates);
+}
+
+uint64_t MappedValueIterationHelper::getNumberOfBlocks() const {
+    return blockStarts.size() - 1;
+}
+
+std::vector<double> MappedValueIterationHelper::computeReachabilityProbabilities(storm::storage::BitVector const& targetStates,
+                                                                                 std::optional<storm::OptimizationDirection> const& dir, bool relative,
+                                                                                 double precision, uint64_t maximalNumberOfIterations,
+                                                                                 uint64_t& numIterations) const {
+    STORM_LOG_ASSERT(targetStates.size() == matrix.numberOfStates, "Unexpected size of the target states.");
+    // Iterating from below converges to the least fixed point, which is the (optimal) reachability probability. Hence, no graph analysis is needed.
+    std::vector<double> x(matrix.numberOfStates, 0.0);
+    for (auto state : targetStates) {
+        x[state] = 1.0;
+    }
+    solve(x, targetStates, nullptr, nullptr, dir, relative, precision, maximalNumberOfIterations, numIterations);
+    return x;
+}
+
+std::vector<double> MappedValueIterationHelper::computeExpectedRewards(storm::storage::BitVector const& targetStates, double const* stateRewards,
+                                                                       double const* actionRewards, bool relative, double precision,
+                                                                       uint64_t maximalNumberOfIterations, uint64_t& numIterations) const {
+    STORM_LOG_ASSERT(targetStates.size() == matrix.numberOfStates, "Unexpected size of the target states.");
+    STORM_LOG_THROW(matrix.rowGroupIndices == nullptr, storm::exceptions::NotSupportedException,
+                    "Expected rewards on mapped matrices are only supported for deterministic models.");
+
+    // States that reach a target state with probability less than one are exactly those that can reach a state from which no target state is
+    // reachable (without visiting a target state before).
+    storm::storage::BitVector const allStates(matrix.numberOfStates, true);
+    storm::storage::BitVector const infinityStates = computeStatesReaching(~computeStatesReaching(targetStates, allStates), ~targetStates);
+    STORM_LOG_INFO("Found " << infinityStates.getNumberOfSetBits() << " states with infinite expected reward.");
+
+    std::vector<double> x(matrix.numberOfStates, 0.0);
+    for (auto state : infinityStates) {
+        x[state] = std::numeric_limits<double>::infinity();
+    }
+    // For deterministic models, each state has exactly one row, so the state and action rewards can be used as offsets of the same equation.
+    std::vector<double> offsets;
+    if (stateRewards && actionRewards) {
+        offsets.resize(matrix.numberOfStates);
+        std::transform(stateRewards, stateRewards + matrix.numberOfStates, actionRewards, offsets.begin(), std::plus<double>());
+        stateRewards = offsets.data();
+        actionRewards = nullptr;
+    }
+    solve(x, targetStates | infinityStates, stateRewards, actionRewards, std::nullopt, relative, precision, maximalNumberOfIterations, numIterations);
+    return x;
+}
+
+storm::storage::BitVector MappedValueIterationHelper::computeStatesReaching(storm::storage::BitVector const& targetStates,
+                                                                            storm::storage::BitVector const& allowedStates) const {
+    storm::storage::BitVector result = targetStates;
+    auto updateState = [this, &result, &allowedStates](uint64_t state) {
+        if (result.get(state) || !allowedStates.get(state)) {
+            return false;
+        }
+        for (uint64_t entry = matrix.rowIndications[matrix.getFirstRow(state)]; entry < matrix.rowIndications[matrix.getLastRow(state)]; ++entry) {
+            if (matrix.values[entry] > 0.0 && result.get(matrix.columns[entry])) {
+                result.set(state);
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Without the backward transitions, we sweep over the states until nothing changes. Alternating the direction of the sweeps propagates the information
+    // along paths in both directions of the state ordering.
+    bool changed = true;
+    bool forward = true;
+    while (changed) {
+        changed = false;
+        if (forward) {
+            for (uint64_t state = 0; state < matrix.numberOfStates; ++state) {
+                changed |= updateState(state);
+            }
+        } else {
+            for (uint64_t state = matrix.numberOfStates; state > 0; --state) {
+                changed |= updateState(state - 1);
+            }
+        }
+        forward = !forward;
+    }
+    return result;
+}
+
+template<storm::OptimizationDirection Dir, bool Relative>
+bool MappedValueIterationHelper::sweepBlock(uint64_t block, std::vector<double>& x, storm::storage::BitVector const& fixedStates, double const* stateOffsets,
+                                            double const* rowOffsets, double precision) const {
+    bool converged = true;
+    for (uint64_t state = blockStarts[block]; state < blockStarts[block + 1]; ++state) {
+        if (fixedStates.get(state)) {
+            continue;
+        }
+        std::optional<double> best;
+        for (uint64_t row = matrix.getFirstRow(state); row < matrix.getLastRow(state); ++row) {
+            double rowValue = rowOffsets ? rowOffsets[row] : 0.0;
+            for (uint64_t entry = matrix.rowIndications[row]; entry < matrix.rowIndications[row + 1]; ++entry) {
+                rowValue += matrix.values[entry] * loadValue(x, matrix.columns[entry]);
+            }
+            if (!best || (maximize(Dir) ? rowValue > *best : rowValue < *best)) {
+                best = rowValue;
+            }
+        }
+        if (!best) {
+            // States without rows are not touched.
+            continue;
+        }
+        if (stateOffsets) {
+            *best += stateOffsets[state];
+        }
+        if (converged) {
+            double const oldValue = loadValue(x, state);
+            if constexpr (Relative) {
+                converged = std::abs(*best - oldValue) <= std::abs(precision * *best);
+            } else {
+                converged = std::abs(*best - oldValue) <= precision;
+            }
+        }
+        storeValue(x, state, *best);
+    }
+    return converged;
+}
+
+SolverStatus MappedValueIterationHelper::solve(std::vector<double>& x, storm::storage::BitVector const& fixedStates, double const* stateOffsets,
+                                               double const* rowOffsets, std::optional<storm::OptimizationDirection> const& dir, bool relative,
+                                               double precision, uint64_t maximalNumberOfIterations, uint64_t& numIterations) const {
+    STORM_LOG_ASSERT(matrix.rowGroupIndices == nullptr || dir.has_value(), "no optimization direction given!");
+    auto sweep = [&](uint64_t block) {
+        if (!dir.has_value() || maximize(*dir)) {
+            return relative ? sweepBlock<storm::OptimizationDirection::Maximize, true>(block, x, fixedStates, stateOffsets, rowOffsets, precision)
+                            : sweepBlock<storm::OptimizationDirection::Maximize, false>(block, x, fixedStates, stateOffsets, rowOffsets, precision);
+        } else {
+            return relative ? sweepBlock<storm::OptimizationDirection::Minimize, true>(block, x, fixedStates, stateOffsets, rowOffsets, precision)
+                            : sweepBlock<storm::OptimizationDirection::Minimize, false>(block, x, fixedStates, stateOffsets, rowOffsets, precision);
+        }
+    };
+
+    uint64_t const numBlocks = getNumberOfBlocks();
+    // One flag per block. We use char instead of bool to avoid concurrent writes to the same byte of a std::vector<bool>.
+    std::vector<char> blockConverged(numBlocks, false);
+    SolverStatus status{SolverStatus::InProgress};
+    uint64_t localIterations = 0;
+    while (status == SolverStatus::InProgress) {
+        ++localIterations;
+#ifdef STORM_HAVE_INTELTBB
+        if (numBlocks > 1) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numBlocks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (auto block = range.begin(); block < range.end(); ++block) {
+                    blockConverged[block] = sweep(block);
+                }
+            });
+        } else {
+            blockConverged.front() = sweep(0);
+        }
+#else
+        for (uint64_t block = 0; block < numBlocks; ++block) {
+            blockConverged[block] = sweep(block);
+        }
+#endif
+        if (std::all_of(blockConverged.begin(), blockConverged.end(), [](char c) { return c; })) {
+            status = SolverStatus::Converged;
+        } else if (localIterations >= maximalNumberOfIterations) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+    }
+    numIterations += localIterations;
+    STORM_LOG_WARN_COND(status == SolverStatus::Converged, "Value iteration on the mapped matrix did not converge after " << localIterations
+                                                                                                                          << " iterations (" << status << ").");
+    STORM_LOG_INFO("Value iteration on the mapped matrix performed " << localIterations << " sweeps.");
+    return status;
+}
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * A read-only view on a transition matrix in compressed row format with separate arrays for the columns and values (as in the drb format).
+ * The arrays are not owned by the view. Typically, they are mapped from a file such that the operating system pages them in and out as needed.
+ */
+struct MappedSparseMatrix {
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    // numberOfRows + 1 offsets into the columns and values
+    uint64_t const* rowIndications = nullptr;
+    uint64_t const* columns = nullptr;
+    double const* values = nullptr;
+    // numberOfStates + 1 offsets into the rows. Null iff each state has exactly one row.
+    uint64_t const* rowGroupIndices = nullptr;
+
+    uint64_t getFirstRow(uint64_t state) const {
+        return rowGroupIndices ? rowGroupIndices[state] : state;
+    }
+
+    uint64_t getLastRow(uint64_t state) const {
+        return rowGroupIndices ? rowGroupIndices[state + 1] : state + 1;
+    }
+};
+
+/*!
+ * Computes unbounded reachability probabilities and expected rewards on a (memory mapped) matrix that is never loaded into memory as a whole.
+ * Only the solution vector and a few bit vectors over the states are kept in memory, the matrix is streamed in each sweep.
+ *
+ * As for the AsynchronousGaussSeidelHelper, the states are partitioned into contiguous blocks of roughly the same number of matrix entries that are swept
+ * concurrently. Values of states of other blocks are read as they are, i.e., without synchronization between the blocks during a sweep.
+ * The graph analyses are performed without the backward transitions (whose construction would require another copy of the matrix) by sweeping forward
+ * until a fixed point is reached.
+ */
+class MappedValueIterationHelper {
+   public:
+    /*!
+     * @param matrix the matrix. The arrays are not copied, i.e., they have to remain valid as long as this helper is used.
+     * @param numberOfBlocks the desired number of blocks. Zero means that the number of threads is used.
+     */
+    MappedValueIterationHelper(MappedSparseMatrix const& matrix, uint64_t numberOfBlocks = 0);
+
+    /*!
+     * Computes the (optimal) probability to eventually reach a target state.
+     * @param dir the optimization direction. Has to be given iff some state has more than one row.
+     * @param numIterations will be increased by the number of performed sweeps
+     */
+    std::vector<double> computeReachabilityProbabilities(storm::storage::BitVector const& targetStates, std::optional<storm::OptimizationDirection> const& dir,
+                                                         bool relative, double precision, uint64_t maximalNumberOfIterations, uint64_t& numIterations) const;
+
+    /*!
+     * Computes the expected reward collected until a target state is reached. States that reach a target state with probability less than one get value
+     * infinity. Only supported if each state has exactly one row.
+     * @param stateRewards the reward of each state (or null)
+     * @param actionRewards the reward of each row (or null)
+     * @param numIterations will be increased by the number of performed sweeps
+     */
+    std::vector<double> computeExpectedRewards(storm::storage::BitVector const& targetStates, double const* stateRewards, double const* actionRewards,
+                                               bool relative, double precision, uint64_t maximalNumberOfIterations, uint64_t& numIterations) const;
+
+    /*!
+     * @return the number of blocks in which the states are partitioned.
+     */
+    uint64_t getNumberOfBlocks() const;
+
+   private:
+    /*!
+     * Computes the states from which a target state can be reached (with positive probability) by only visiting allowed states before.
+     */
+    storm::storage::BitVector computeStatesReaching(storm::storage::BitVector const& targetStates, storm::storage::BitVector const& allowedStates) const;
+
+    /*!
+     * Iterates x = opt (A*x + b) until the maximal (relative) difference between two sweeps is below the precision. The values of fixed states are not
+     * updated.
+     */
+    SolverStatus solve(std::vector<double>& x, storm::storage::BitVector const& fixedStates, double const* stateOffsets, double const* rowOffsets,
+                       std::optional<storm::OptimizationDirection> const& dir, bool relative, double precision, uint64_t maximalNumberOfIterations,
+                       uint64_t& numIterations) const;
+
+    template<storm::OptimizationDirection Dir, bool Relative>
+    bool sweepBlock(uint64_t block, std::vector<double>& x, storm::storage::BitVector const& fixedStates, double const* stateOffsets,
+                    double const* rowOffsets, double precision) const;
+
+    MappedSparseMatrix matrix;
+    // The i-th block consists of the states in [blockStarts[i], blockStarts[i+1])
+    std::vector<uint64_t> blockStarts;
+};
+
+}  // namespace storm::solver::helper
@@ -50,6 +50,10 @@ class GSVIBackend {
         // intentionally left empty.
     }
 
+    void mergeChunk(GSVIBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+    }
+
     bool converged() const {
         return isConverged;
     }
@@ -152,6 +156,13 @@ class OVIBackend {
         // intentionally left empty.
     }
 
+    void mergeChunk(OVIBackend const& chunkBackend) {
+        isAllUp &= chunkBackend.isAllUp;
+        isAllDown &= chunkBackend.isAllDown;
+        crossed |= chunkBackend.crossed;
+        errorValue &= chunkBackend.errorValue;
+    }
+
     bool converged() const {
         return isAllDown || isAllUp;
     }
@@ -0,0 +1,137 @@
+#include "storm/solver/helper/RationalReconstructionHelper.h"
+
+#include <cmath>
+#include <optional>
+
+#include "storm/adapters/EigenAdapter.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/utility/KwekMehlhorn.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+// We give up if the norm of the corrections did not halve for this many consecutive refinement steps.
+uint64_t const maxNumberOfStagnatingSteps = 3;
+}  // namespace detail
+
+struct RationalReconstructionHelper::Factorization {
+    Eigen::SparseLU<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> solver;
+    bool success;
+};
+
+RationalReconstructionHelper::RationalReconstructionHelper(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix)
+    : matrix(matrix), factorization(std::make_unique<Factorization>()) {
+    STORM_LOG_ASSERT(matrix.getRowCount() == matrix.getColumnCount(), "Expected a square matrix.");
+    auto eigenMatrix = storm::adapters::EigenAdapter::toEigenSparseMatrix(matrix.toValueType<double>());
+    factorization->solver.compute(*eigenMatrix);
+    factorization->success = factorization->solver.info() == Eigen::ComputationInfo::Success;
+    STORM_LOG_WARN_COND(factorization->success, "Unable to factorize the matrix in floating point arithmetic.");
+}
+
+RationalReconstructionHelper::~RationalReconstructionHelper() = default;
+
+bool RationalReconstructionHelper::isFactorized() const {
+    return factorization->success;
+}
+
+bool RationalReconstructionHelper::isSolution(std::vector<storm::RationalNumber> const& x, std::vector<storm::RationalNumber> const& b) const {
+    // Candidates are typically rejected in one of the first rows, so we check row by row instead of computing A*x entirely.
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        storm::RationalNumber rowValue = storm::utility::zero<storm::RationalNumber>();
+        for (auto const& entry : matrix.getRow(row)) {
+            rowValue += entry.getValue() * x[entry.getColumn()];
+        }
+        if (rowValue != b[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SolverStatus RationalReconstructionHelper::solve(std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const& b, uint64_t& numIterations,
+                                                 std::function<SolverStatus(SolverStatus const&)> const& iterationCallback) const {
+    STORM_LOG_THROW(isFactorized(), storm::exceptions::InvalidOperationException, "Solving requires a factorized matrix.");
+    uint64_t const dimension = x.size();
+    std::vector<storm::RationalNumber> residual(dimension), correction(dimension), candidate(dimension);
+    Eigen::VectorXd doubleResidual(dimension), doubleCorrection(dimension);
+
+    matrix.multiplyWithVector(x, residual);
+    for (uint64_t i = 0; i < dimension; ++i) {
+        residual[i] = b[i] - residual[i];
+    }
+
+    std::optional<storm::RationalNumber> previousCorrectionNorm;
+    uint64_t numStagnatingSteps = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        storm::RationalNumber residualNorm = storm::utility::zero<storm::RationalNumber>();
+        for (auto const& value : residual) {
+            residualNorm = std::max(residualNorm, storm::utility::abs(value));
+        }
+        if (storm::utility::isZero(residualNorm)) {
+            status = SolverStatus::Converged;
+            break;
+        }
+
+        // Solve A*d = r in floating point arithmetic. The residual is scaled with a power of two, so that the scaling is exact and the entries neither
+        // underflow nor overflow.
+        int exponent;
+        std::frexp(storm::utility::convertNumber<double>(residualNorm), &exponent);
+        storm::RationalNumber const scale = storm::utility::convertNumber<storm::RationalNumber>(std::ldexp(1.0, exponent));
+        for (uint64_t i = 0; i < dimension; ++i) {
+            doubleResidual(i) = storm::utility::convertNumber<double>(storm::RationalNumber(residual[i] / scale));
+        }
+        doubleCorrection = factorization->solver.solve(doubleResidual);
+
+        storm::RationalNumber correctionNorm = storm::utility::zero<storm::RationalNumber>();
+        for (uint64_t i = 0; i < dimension; ++i) {
+            if (!std::isfinite(doubleCorrection(i))) {
+                STORM_LOG_WARN("Floating point solution of the correction equation yields non-finite values.");
+                return SolverStatus::Aborted;
+            }
+            correction[i] = storm::utility::convertNumber<storm::RationalNumber>(doubleCorrection(i)) * scale;
+            correctionNorm = std::max(correctionNorm, storm::utility::abs(correction[i]));
+        }
+        if (previousCorrectionNorm && correctionNorm * storm::utility::convertNumber<storm::RationalNumber>(2) > *previousCorrectionNorm) {
+            if (++numStagnatingSteps > detail::maxNumberOfStagnatingSteps) {
+                STORM_LOG_WARN("Iterative refinement does not converge. The matrix might be too ill-conditioned.");
+                return SolverStatus::Aborted;
+            }
+        } else {
+            numStagnatingSteps = 0;
+        }
+        previousCorrectionNorm = correctionNorm;
+
+        // Update the solution and the residual exactly.
+        matrix.multiplyWithVector(correction, candidate);
+        for (uint64_t i = 0; i < dimension; ++i) {
+            x[i] += correction[i];
+            residual[i] -= candidate[i];
+        }
+        ++numIterations;
+
+        // As the refinement converges, the error of the updated solution is much smaller than the last correction. We therefore look for the simplest
+        // rational numbers within this bound.
+        bool candidateDiffers = false;
+        for (uint64_t i = 0; i < dimension; ++i) {
+            candidate[i] = storm::utility::kwek_mehlhorn::findRationalInInterval(storm::RationalNumber(x[i] - correctionNorm),
+                                                                                 storm::RationalNumber(x[i] + correctionNorm));
+            candidateDiffers |= candidate[i] != x[i];
+        }
+        if (candidateDiffers && isSolution(candidate, b)) {
+            x = std::move(candidate);
+            status = SolverStatus::Converged;
+            break;
+        }
+
+        if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+    }
+    STORM_LOG_TRACE("Rational reconstruction finished after " << numIterations << " refinement steps with status " << status << ".");
+    return status;
+}
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Solves equation systems A*x = b exactly while doing the expensive part of the computation in floating point arithmetic.
+ * The matrix A is factorized (once) in double precision. We then perform iterative refinement, i.e., we repeatedly
+ *  - compute the exact residual r = b - A*x,
+ *  - solve A*d = r using the floating point factorization (after scaling r with a power of two to avoid underflows) and
+ *  - add the (exactly converted) correction d to x.
+ * All corrections are dyadic numbers, so that the size of the numbers in x and r only grows slowly.
+ * Whenever the corrections become smaller, we reconstruct a candidate solution by choosing the simplest rational number within the error bound of each
+ * entry of x. The candidate is returned if it satisfies the equation system exactly.
+ * The refinement converges (linearly) as long as the matrix is not too ill-conditioned. Otherwise, we give up and the caller needs to resort to a
+ * different method.
+ *
+ * @see Wan: An algorithm to solve integer linear systems exactly using numerical methods (2006), https://doi.org/10.1016/j.jsc.2005.09.012
+ */
+class RationalReconstructionHelper {
+   public:
+    /*!
+     * Factorizes the given matrix in floating point arithmetic.
+     * @param matrix the square matrix A. The matrix is not copied, i.e., it has to remain valid as long as this helper is used.
+     */
+    explicit RationalReconstructionHelper(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+    ~RationalReconstructionHelper();
+
+    /*!
+     * @return true iff the matrix could be factorized in floating point arithmetic. If this is not the case, solving will fail.
+     */
+    bool isFactorized() const;
+
+    /*!
+     * Solves the equation system.
+     * @param x the initial guess. Will be overwritten with the exact solution if one is found.
+     * @param numIterations will be increased by the number of performed refinement steps
+     * @param iterationCallback called after each refinement step. Can be used to check for early termination.
+     * @return Converged iff the exact solution has been found. Aborted if the refinement does not make progress.
+     */
+    SolverStatus solve(std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const& b, uint64_t& numIterations,
+                       std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {}) const;
+
+   private:
+    /*!
+     * Checks whether A*x = b holds exactly.
+     */
+    bool isSolution(std::vector<storm::RationalNumber> const& x, std::vector<storm::RationalNumber> const& b) const;
+
+    storm::storage::SparseMatrix<storm::RationalNumber> const& matrix;
+
+    // The floating point factorization of the matrix (defined in the translation unit to not expose Eigen).
+    struct Factorization;
+    std::unique_ptr<Factorization> factorization;
+};
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,128 @@
+#include "storm/solver/helper/SolverCheckpoint.h"
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+std::array<char, 8> const checkpointMagic = {'S', 'T', 'O', 'R', 'M', 'C', 'K', 'P'};
+uint64_t const checkpointVersion = 1;
+
+struct CheckpointHeader {
+    std::array<char, 8> magic;
+    uint64_t version;
+    uint64_t fingerprint;
+    uint64_t size;
+    uint64_t numIterations;
+    uint64_t converged;
+};
+}  // namespace detail
+
+template<typename ValueType>
+std::optional<SolverCheckpoint> SolverCheckpoint::create(Environment const& env, std::string const& method,
+                                                         storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& offsets,
+                                                         std::optional<storm::OptimizationDirection> const& dir, double precision) {
+    auto const& directory = env.solver().getCheckpointDirectory();
+    if (!directory) {
+        return std::nullopt;
+    }
+    std::error_code errorCode;
+    std::filesystem::create_directories(directory.get(), errorCode);
+    STORM_LOG_THROW(!errorCode && std::filesystem::is_directory(directory.get()), storm::exceptions::FileIoException,
+                    "Could not create checkpoint directory '" << directory.get() << "'.");
+
+    std::size_t fingerprint = 0;
+    boost::hash_combine(fingerprint, method);
+    boost::hash_combine(fingerprint, matrix.hash());
+    boost::hash_combine(fingerprint, matrix.getRowGroupCount());
+    boost::hash_range(fingerprint, offsets.begin(), offsets.end());
+    boost::hash_combine(fingerprint, dir ? static_cast<int>(*dir) : -1);
+    boost::hash_combine(fingerprint, precision);
+
+    std::stringstream filename;
+    filename << directory.get() << "/" << std::hex << std::setw(16) << std::setfill('0') << fingerprint << ".ckp";
+    return SolverCheckpoint(filename.str(), fingerprint, std::chrono::seconds(env.solver().getCheckpointInterval()), env.solver().isResumeFromCheckpoints());
+}
+
+SolverCheckpoint::SolverCheckpoint(std::string const& filename, uint64_t fingerprint, std::chrono::seconds const& interval, bool resume)
+    : filename(filename), fingerprint(fingerprint), interval(interval), resume(resume), lastCheckpoint(std::chrono::steady_clock::now()) {
+    // Intentionally left empty.
+}
+
+SolverStatus SolverCheckpoint::restore(std::vector<double>& x, uint64_t& numIterations) const {
+    if (!resume) {
+        return SolverStatus::InProgress;
+    }
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    if (!stream) {
+        STORM_LOG_INFO("No checkpoint to resume from in " << filename << ".");
+        return SolverStatus::InProgress;
+    }
+
+    detail::CheckpointHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!stream || header.magic != detail::checkpointMagic || header.version != detail::checkpointVersion || header.fingerprint != fingerprint ||
+        header.size != x.size()) {
+        STORM_LOG_WARN("Ignoring checkpoint " << filename << " because it does not match the equation system.");
+        return SolverStatus::InProgress;
+    }
+    std::vector<double> values(header.size);
+    stream.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double));
+    if (!stream) {
+        STORM_LOG_WARN("Ignoring checkpoint " << filename << " because it is truncated.");
+        return SolverStatus::InProgress;
+    }
+
+    x = std::move(values);
+    numIterations = header.numIterations;
+    STORM_LOG_INFO("Resuming from checkpoint " << filename << " after " << numIterations << " iterations.");
+    return header.converged ? SolverStatus::Converged : SolverStatus::InProgress;
+}
+
+void SolverCheckpoint::update(std::vector<double> const& x, uint64_t numIterations) {
+    if (storm::utility::resources::isTerminate() || std::chrono::steady_clock::now() - lastCheckpoint >= interval) {
+        write(x, numIterations, false);
+    }
+}
+
+void SolverCheckpoint::finish(std::vector<double> const& x, uint64_t numIterations) {
+    write(x, numIterations, true);
+}
+
+void SolverCheckpoint::write(std::vector<double> const& x, uint64_t numIterations, bool converged) {
+    // Write to a temporary file first, such that an interruption while writing does not destroy the previous checkpoint.
+    std::string const temporaryFilename = filename + ".tmp";
+    {
+        std::ofstream stream(temporaryFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open checkpoint file " << temporaryFilename << ".");
+        detail::CheckpointHeader header{
+            detail::checkpointMagic, detail::checkpointVersion, fingerprint, x.size(), numIterations, static_cast<uint64_t>(converged)};
+        stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<char const*>(x.data()), x.size() * sizeof(double));
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write checkpoint file " << temporaryFilename << ".");
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryFilename, filename, errorCode);
+    STORM_LOG_THROW(!errorCode, storm::exceptions::FileIoException, "Could not move checkpoint to " << filename << ".");
+    STORM_LOG_INFO("Wrote checkpoint " << filename << " after " << numIterations << " iterations.");
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+template std::optional<SolverCheckpoint> SolverCheckpoint::create(Environment const& env, std::string const& method,
+                                                                  storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& offsets,
+                                                                  std::optional<storm::OptimizationDirection> const& dir, double precision);
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+template<typename T>
+class SparseMatrix;
+}
+
+namespace solver::helper {
+
+/*!
+ * Periodically writes the iterate of an iterative solver to a file, such that a later run can resume the computation, e.g., after the machine was
+ * preempted. The file is named after a fingerprint of the equation system (and the solution method), so a resumed run only picks up checkpoints of
+ * identical equation systems. Once the solver converged, the final solution is kept, which lets a resumed run skip already completed solver calls.
+ * If termination is requested (e.g., by a termination signal), a checkpoint is written at the next opportunity.
+ */
+class SolverCheckpoint {
+   public:
+    /*!
+     * Creates a checkpoint for solving the given equation system if checkpoints are enabled in the environment.
+     *
+     * @param method A name of the solution method. Checkpoints of different methods are never mixed.
+     * @param dir The optimization direction, if any.
+     * @param precision The precision of the solution method.
+     */
+    template<typename ValueType>
+    static std::optional<SolverCheckpoint> create(Environment const& env, std::string const& method, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                  std::vector<ValueType> const& offsets, std::optional<storm::OptimizationDirection> const& dir,
+                                                  double precision);
+
+    SolverCheckpoint(std::string const& filename, uint64_t fingerprint, std::chrono::seconds const& interval, bool resume);
+
+    /*!
+     * If the run is resumed and a matching checkpoint exists, the iterate and the number of iterations are restored from it.
+     *
+     * @return Converged if the checkpoint holds a final solution and InProgress otherwise.
+     */
+    SolverStatus restore(std::vector<double>& x, uint64_t& numIterations) const;
+
+    /*!
+     * Writes the given iterate if enough time passed since the last checkpoint or if termination is requested.
+     */
+    void update(std::vector<double> const& x, uint64_t numIterations);
+
+    /*!
+     * Writes the given final solution.
+     */
+    void finish(std::vector<double> const& x, uint64_t numIterations);
+
+   private:
+    void write(std::vector<double> const& x, uint64_t numIterations, bool converged);
+
+    std::string filename;
+    uint64_t fingerprint;
+    std::chrono::seconds interval;
+    bool resume;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
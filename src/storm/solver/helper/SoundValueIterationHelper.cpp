@@ -34,9 +34,9 @@ class SVIBackend {
     static const SVIStage CurrentStage = Stage;
     using RowValueStorageType = std::vector<std::pair<ValueType, ValueType>>;
 
-    SVIBackend(RowValueStorageType& rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
+    SVIBackend(RowValueStorageType rowValueStorage, std::optional<ValueType> const& a, std::optional<ValueType> const& b,
                std::optional<ValueType> const& d = {})
-        : currRowValues(rowValueStorage) {
+        : currRowValues(std::move(rowValueStorage)) {
         if (a.has_value()) {
             aValue &= *a;
         }
@@ -150,6 +150,13 @@ class SVIBackend {
         }
     }
 
+    void mergeChunk(SVIBackend const& chunkBackend) {
+        allYLessOne &= chunkBackend.allYLessOne;
+        curr_a &= chunkBackend.curr_a;
+        curr_b &= chunkBackend.curr_b;
+        dValue &= chunkBackend.dValue;
+    }
+
     bool constexpr converged() const {
         return false;
     }
@@ -211,7 +218,8 @@ class SVIBackend {
 
     std::pair<ValueType, ValueType> best;
     ExtremumDir bestValue;
-    RowValueStorageType& currRowValues;
+    // Each backend owns its storage so that copies of the backend can be used concurrently when the operator is applied in parallel.
+    RowValueStorageType currRowValues;
     uint64_t currRowValuesIndex{0};
 };
 
@@ -367,7 +375,8 @@ typename SoundValueIterationHelper<ValueType, TrivialRowGrouping>::SVIData Sound
     std::function<SolverStatus(SVIData const&)> const& iterationCallback, std::optional<storm::storage::BitVector> const& relevantValues) const {
     typename SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>::RowValueStorageType rowValueStorage;
     rowValueStorage.resize(sizeOfLargestRowGroup - 1);
-    return SVI(xy, offsets, numIterations, relative, precision, SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(rowValueStorage, a, b),
+    return SVI(xy, offsets, numIterations, relative, precision,
+               SVIBackend<ValueType, Dir, SVIStage::Initial, TrivialRowGrouping>(std::move(rowValueStorage), a, b),
                iterationCallback, relevantValues);
 }
 
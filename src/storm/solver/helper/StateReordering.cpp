@@ -0,0 +1,50 @@
+#include "storm/solver/helper/StateReordering.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+StateReordering<ValueType>::StateReordering(storm::utility::permutation::OrderKind order, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                            std::vector<ValueType> const& offsets)
+    : order(order), originalRowGroupIndices(matrix.getRowGroupIndices()) {
+    STORM_LOG_ASSERT(matrix.getRowGroupCount() == matrix.getColumnCount(), "Expected a square matrix.");
+    storm::storage::BitVector startStates(matrix.getRowGroupCount(), false);
+    for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+        for (auto row : matrix.getRowGroupIndices(state)) {
+            if (offsets[row] != storm::utility::zero<ValueType>()) {
+                startStates.set(state, true);
+                break;
+            }
+        }
+    }
+    permutation = storm::utility::permutation::createPermutation(order, matrix, startStates);
+    inversePermutation = storm::utility::permutation::invertPermutation(permutation);
+    this->matrix = matrix.permuteRowGroupsAndColumns(inversePermutation, permutation);
+    STORM_LOG_INFO("Reordered the " << permutation.size() << " states of the equation system using order "
+                                    << storm::utility::permutation::orderKindtoString(order) << ".");
+}
+
+template<typename ValueType>
+storm::utility::permutation::OrderKind StateReordering<ValueType>::getOrder() const {
+    return order;
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& StateReordering<ValueType>::getMatrix() const {
+    return matrix;
+}
+
+template<typename ValueType>
+std::vector<ValueType> StateReordering<ValueType>::reorderRows(std::vector<ValueType> const& values) const {
+    return storm::utility::vector::applyInversePermutationToGroupedVector(inversePermutation, values, originalRowGroupIndices);
+}
+
+template class StateReordering<double>;
+template class StateReordering<storm::RationalNumber>;
+template class StateReordering<storm::Interval>;
+
+}  // namespace storm::solver::helper
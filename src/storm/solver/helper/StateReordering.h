@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/permutation.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Renumbers the states (i.e., the row groups and columns) of an equation system x = min/max (A*x + b) such that iterative solvers access the operand
+ * with better memory locality. The solution of the reordered system is mapped back to the original state indices afterwards.
+ */
+template<typename ValueType>
+class StateReordering {
+   public:
+    /*!
+     * Reorders the given (square) matrix according to the given order.
+     * @param offsets the right-hand side b. Orders that search backwards start from the states that have a non-zero entry in b.
+     */
+    StateReordering(storm::utility::permutation::OrderKind order, storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& offsets);
+
+    storm::utility::permutation::OrderKind getOrder() const;
+
+    /*!
+     * Retrieves the reordered matrix.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+
+    /*!
+     * Reorders the given vector with one entry per row of the original matrix.
+     */
+    std::vector<ValueType> reorderRows(std::vector<ValueType> const& values) const;
+
+    /*!
+     * Reorders the given vector with one entry per state of the original matrix.
+     */
+    template<typename T>
+    std::vector<T> reorderStates(std::vector<T> const& values) const {
+        return storm::utility::vector::applyInversePermutation(inversePermutation, values);
+    }
+
+    /*!
+     * Writes the given values of the reordered states to the original state indices.
+     */
+    template<typename T>
+    void restoreStates(std::vector<T> const& reorderedValues, std::vector<T>& values) const {
+        for (uint64_t state = 0; state < permutation.size(); ++state) {
+            values[state] = reorderedValues[permutation[state]];
+        }
+    }
+
+   private:
+    storm::utility::permutation::OrderKind order;
+    /// Maps each original state to its index in the reordered system.
+    std::vector<uint64_t> permutation;
+    std::vector<uint64_t> inversePermutation;
+    std::vector<uint64_t> originalRowGroupIndices;
+    storm::storage::SparseMatrix<ValueType> matrix;
+};
+
+}  // namespace storm::solver::helper
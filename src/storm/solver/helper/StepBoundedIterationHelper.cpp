@@ -0,0 +1,141 @@
+#include "storm/solver/helper/StepBoundedIterationHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/utility/Extremum.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::solver::helper {
+
+template<typename ValueType, storm::OptimizationDirection Dir>
+class StepBoundedOperatorBackend {
+   public:
+    void startNewIteration() {
+        // intentionally left empty.
+    }
+
+    void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best = std::move(value);
+    }
+
+    void nextRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        best &= value;
+    }
+
+    void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        currValue = std::move(*best);
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    void mergeChunk([[maybe_unused]] StepBoundedOperatorBackend const& chunkBackend) {
+        // intentionally left empty.
+    }
+
+    bool constexpr converged() const {
+        return false;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    storm::utility::Extremum<Dir, ValueType> best;
+};
+
+template<typename ValueType, bool TrivialRowGrouping>
+StepBoundedIterationHelper<ValueType, TrivialRowGrouping>::StepBoundedIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel)
+    : viOperator(std::make_shared<ValueIterationOperator<ValueType, TrivialRowGrouping>>()) {
+    viOperator->setMatrixForwards(matrix);
+    if (parallel && storm::NumberTraits<ValueType>::IsThreadSafe) {
+        viOperator->setParallelApply(storm::utility::getNumberOfThreads());
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+StepBoundedIterationHelper<ValueType, TrivialRowGrouping>::StepBoundedIterationHelper(storm::storage::SubmatrixView<ValueType> const& matrix, bool parallel)
+    : viOperator(std::make_shared<ValueIterationOperator<ValueType, TrivialRowGrouping>>()) {
+    viOperator->setMatrixForwards(matrix);
+    if (parallel && storm::NumberTraits<ValueType>::IsThreadSafe) {
+        viOperator->setParallelApply(storm::utility::getNumberOfThreads());
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+template<storm::OptimizationDirection Dir>
+uint64_t StepBoundedIterationHelper<ValueType, TrivialRowGrouping>::performSteps(
+    std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, std::vector<uint64_t> const& stepBounds,
+    std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback) const {
+    STORM_LOG_ASSERT(std::is_sorted(stepBounds.begin(), stepBounds.end()), "Step bounds are not sorted.");
+    if (stepBounds.empty()) {
+        return 0;
+    }
+    uint64_t const numberOfSteps = stepBounds.back();
+    StepBoundedOperatorBackend<ValueType, Dir> backend;
+    std::vector<ValueType>* currentOperand{&operand};
+    std::vector<ValueType>* nextOperand{&viOperator->allocateAuxiliaryVector(operand.size())};
+
+    storm::utility::ProgressMeasurement progress("steps");
+    progress.setMaxCount(numberOfSteps);
+    progress.startNewMeasurement(0);
+    auto stepBoundIt = stepBounds.begin();
+    uint64_t step = 0;
+    while (true) {
+        for (; stepBoundIt != stepBounds.end() && *stepBoundIt == step; ++stepBoundIt) {
+            if (stepBoundCallback) {
+                stepBoundCallback(std::distance(stepBounds.begin(), stepBoundIt), *currentOperand);
+            }
+        }
+        if (step == numberOfSteps) {
+            break;
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << step << " of " << numberOfSteps << " steps.");
+            break;
+        }
+        viOperator->apply(*currentOperand, *nextOperand, offsets, backend);
+        std::swap(currentOperand, nextOperand);
+        ++step;
+        progress.updateProgress(step);
+    }
+    if (currentOperand != &operand) {
+        std::swap(*currentOperand, *nextOperand);
+    }
+    viOperator->freeAuxiliaryVector();
+    return step;
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+uint64_t StepBoundedIterationHelper<ValueType, TrivialRowGrouping>::performSteps(
+    std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, std::vector<uint64_t> const& stepBounds,
+    std::optional<storm::OptimizationDirection> const& dir, std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback) const {
+    STORM_LOG_ASSERT(TrivialRowGrouping || dir.has_value(), "no optimization direction given!");
+    if (!dir.has_value() || maximize(*dir)) {
+        return performSteps<storm::OptimizationDirection::Maximize>(operand, offsets, stepBounds, stepBoundCallback);
+    } else {
+        return performSteps<storm::OptimizationDirection::Minimize>(operand, offsets, stepBounds, stepBoundCallback);
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+uint64_t StepBoundedIterationHelper<ValueType, TrivialRowGrouping>::performSteps(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets,
+                                                                                 uint64_t numberOfSteps,
+                                                                                 std::optional<storm::OptimizationDirection> const& dir) const {
+    return performSteps(operand, offsets, std::vector<uint64_t>({numberOfSteps}), dir);
+}
+
+template class StepBoundedIterationHelper<double, true>;
+template class StepBoundedIterationHelper<double, false>;
+template class StepBoundedIterationHelper<storm::RationalNumber, true>;
+template class StepBoundedIterationHelper<storm::RationalNumber, false>;
+
+}  // namespace storm::solver::helper
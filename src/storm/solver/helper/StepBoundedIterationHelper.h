@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/ValueIterationOperatorForward.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SubmatrixView.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Performs a fixed number of steps x <- A*x + b (or x <- min/max (A*x + b) if the matrix has a non-trivial row grouping), as required for step-bounded
+ * reachability properties. The steps are performed with a value iteration operator, which applies the row groups concurrently if requested.
+ */
+template<typename ValueType, bool TrivialRowGrouping>
+class StepBoundedIterationHelper {
+   public:
+    /*!
+     * @param matrix the matrix A. The matrix is not copied, i.e., it has to remain valid as long as this helper is used.
+     * @param parallel if true, the row groups are split into chunks that are processed concurrently (using the chunking of the value iteration operator).
+     * Ignored if the value type is not thread-safe.
+     */
+    StepBoundedIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel);
+
+    /*!
+     * @param matrix a view on the submatrix A. The submatrix is not materialized. The view has to remain valid as long as this helper is used.
+     * @param parallel if true, the row groups are split into chunks that are processed concurrently (using the chunking of the value iteration operator).
+     * Ignored if the value type is not thread-safe.
+     */
+    StepBoundedIterationHelper(storm::storage::SubmatrixView<ValueType> const& matrix, bool parallel);
+
+    /*!
+     * Performs stepBounds.back() steps on the given operand.
+     * @param stepBounds ascendingly sorted step bounds. After the i-th bound is reached, the callback is invoked with i and the current operand.
+     * @param dir the optimization direction. Has to be given iff the row grouping is non-trivial.
+     * @return the number of performed steps. This is smaller than stepBounds.back() if the computation has been aborted.
+     */
+    uint64_t performSteps(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, std::vector<uint64_t> const& stepBounds,
+                          std::optional<storm::OptimizationDirection> const& dir = {},
+                          std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback = {}) const;
+
+    /*!
+     * Performs the given number of steps on the given operand.
+     * @return the number of performed steps. This is smaller than numberOfSteps if the computation has been aborted.
+     */
+    uint64_t performSteps(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, uint64_t numberOfSteps,
+                          std::optional<storm::OptimizationDirection> const& dir = {}) const;
+
+   private:
+    template<storm::OptimizationDirection Dir>
+    uint64_t performSteps(std::vector<ValueType>& operand, std::vector<ValueType> const& offsets, std::vector<uint64_t> const& stepBounds,
+                          std::function<void(uint64_t, std::vector<ValueType> const&)> const& stepBoundCallback) const;
+
+    std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping>> viOperator;
+};
+
+}  // namespace storm::solver::helper
@@ -0,0 +1,146 @@
+#include "storm/solver/helper/SymbolicIntervalIterationHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm::solver::helper {
+
+template<storm::dd::DdType DdType, typename ValueType>
+SymbolicIntervalIterationHelper<DdType, ValueType>::SymbolicIntervalIterationHelper(Operator const& op, storm::dd::Bdd<DdType> const& allRows)
+    : op(op), allRows(allRows) {
+    // Intentionally left empty.
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SolverStatus SymbolicIntervalIterationHelper<DdType, ValueType>::performIntervalIteration(storm::dd::Add<DdType, ValueType>& lower,
+                                                                                          storm::dd::Add<DdType, ValueType>& upper, uint64_t& numIterations,
+                                                                                          ValueType const& precision, bool relative,
+                                                                                          uint64_t maximalNumberOfIterations) const {
+    // If the bounds are within twice the precision, their midpoint is within the precision of the solution.
+    ValueType const boundPrecision = precision * storm::utility::convertNumber<ValueType, uint64_t>(2);
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        if (lower.equalModuloPrecision(upper, boundPrecision, relative)) {
+            status = SolverStatus::Converged;
+        } else if (numIterations >= maximalNumberOfIterations) {
+            status = SolverStatus::MaximalIterationsExceeded;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        } else {
+            // Applying the operator to a bound yields a bound. Taking the maximum (minimum) keeps the bounds monotone, even if the initial bounds were not
+            // (post-)fixed points of the operator.
+            lower = op(lower).maximum(lower);
+            upper = op(upper).minimum(upper);
+            ++numIterations;
+        }
+    }
+    return status;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SolverStatus SymbolicIntervalIterationHelper<DdType, ValueType>::performValueIteration(storm::dd::Add<DdType, ValueType>& values, uint64_t& numIterations,
+                                                                                       ValueType const& precision, bool relative,
+                                                                                       uint64_t maximalNumberOfIterations) const {
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && numIterations < maximalNumberOfIterations) {
+        storm::dd::Add<DdType, ValueType> newValues = op(values);
+        ++numIterations;
+        if (newValues.equalModuloPrecision(values, precision, relative)) {
+            status = SolverStatus::Converged;
+        } else if (storm::utility::resources::isTerminate()) {
+            status = SolverStatus::Aborted;
+        }
+        values = std::move(newValues);
+    }
+    if (status == SolverStatus::InProgress) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+    return status;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicIntervalIterationHelper<DdType, ValueType>::guessUpperBound(storm::dd::Add<DdType, ValueType> const& lower,
+                                                                                                    ValueType const& precision, bool relative) const {
+    auto const& manager = lower.getDdManager();
+    storm::dd::Add<DdType, ValueType> precisionAdd = manager.getConstant(precision);
+    if (relative) {
+        storm::dd::Add<DdType, ValueType> scaled = lower * precisionAdd;
+        return lower + scaled.maximum(-scaled);
+    } else {
+        return lower + allRows.ite(precisionAdd, manager.template getAddZero<ValueType>());
+    }
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+SolverStatus SymbolicIntervalIterationHelper<DdType, ValueType>::performOptimisticValueIteration(
+    storm::dd::Add<DdType, ValueType>& lower, storm::dd::Add<DdType, ValueType>& upper, std::optional<storm::dd::Add<DdType, ValueType>> const& upperBounds,
+    uint64_t& numIterations, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations) const {
+    ValueType viPrecision = precision;
+    upper = lower;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        uint64_t const previousIterations = numIterations;
+        status = performValueIteration(lower, numIterations, viPrecision, relative, maximalNumberOfIterations);
+        if (status != SolverStatus::Converged) {
+            break;
+        }
+        status = SolverStatus::InProgress;
+
+        upper = guessUpperBound(lower, precision, relative);
+        if (upperBounds) {
+            upper = upper.minimum(upperBounds.value());
+        }
+
+        // Verify the guess. We spend at most as many iterations as value iteration needed to converge.
+        uint64_t const maxVerificationIterations = std::max<uint64_t>(numIterations - previousIterations, 1);
+        for (uint64_t verificationIteration = 0; verificationIteration < maxVerificationIterations && numIterations < maximalNumberOfIterations;
+             ++verificationIteration) {
+            storm::dd::Add<DdType, ValueType> newUpper = op(upper);
+            lower = op(lower).maximum(lower);
+            ++numIterations;
+            if (newUpper.lessOrEqual(upper).isOne()) {
+                // As the operator has a unique fixed point, every vector that is not increased by the operator is an upper bound of the solution.
+                STORM_LOG_TRACE("Verified the guessed upper bound after " << verificationIteration + 1 << " verification iterations.");
+                upper = std::move(newUpper);
+                status = performIntervalIteration(lower, upper, numIterations, precision, relative, maximalNumberOfIterations);
+                break;
+            }
+            if (!lower.greater(newUpper).isZero() || newUpper.greaterOrEqual(upper).isOne()) {
+                // The guess was too small.
+                break;
+            }
+            upper = std::move(newUpper);
+        }
+
+        if (status == SolverStatus::InProgress) {
+            if (numIterations >= maximalNumberOfIterations) {
+                status = SolverStatus::MaximalIterationsExceeded;
+            } else if (storm::utility::resources::isTerminate()) {
+                status = SolverStatus::Aborted;
+            } else {
+                // Retry with a more precise lower bound.
+                viPrecision /= storm::utility::convertNumber<ValueType, uint64_t>(2);
+                STORM_LOG_TRACE("Guessed upper bound could not be verified. Continuing value iteration with precision " << viPrecision << ".");
+            }
+        }
+    }
+    return status;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> SymbolicIntervalIterationHelper<DdType, ValueType>::getMidpoint(storm::dd::Add<DdType, ValueType> const& lower,
+                                                                                                storm::dd::Add<DdType, ValueType> const& upper) const {
+    return (lower + upper) / lower.getDdManager().getConstant(storm::utility::convertNumber<ValueType, uint64_t>(2));
+}
+
+template class SymbolicIntervalIterationHelper<storm::dd::DdType::CUDD, double>;
+template class SymbolicIntervalIterationHelper<storm::dd::DdType::Sylvan, double>;
+template class SymbolicIntervalIterationHelper<storm::dd::DdType::CUDD, storm::RationalNumber>;
+template class SymbolicIntervalIterationHelper<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+
+}  // namespace storm::solver::helper
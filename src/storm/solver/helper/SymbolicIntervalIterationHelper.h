@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+namespace storm::solver::helper {
+
+/*!
+ * Implements sound value iteration techniques for equation systems that are given in terms of decision diagrams, i.e., for the dd engine.
+ * The system is given by a monotone operator (e.g. x -> min/max A*x + b) that is assumed to have a unique fixed point. All computations are performed with
+ * ADD operations, so that the values remain in the symbolic representation (and Sylvan's apply operations are executed in parallel).
+ *
+ * @see Baier et al.: Ensuring the Reliability of Your Model Checker: Interval Iteration for Markov Decision Processes (2017),
+ *      https://doi.org/10.1007/978-3-319-63387-9_8
+ * @see Hartmanns, Kaminski: Optimistic Value Iteration (2020), https://doi.org/10.1007/978-3-030-53291-8_26
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+class SymbolicIntervalIterationHelper {
+   public:
+    typedef std::function<storm::dd::Add<DdType, ValueType>(storm::dd::Add<DdType, ValueType> const&)> Operator;
+
+    /*!
+     * @param op Applies the operator once to the given vector.
+     * @param allRows The rows of the equation system. Values outside of these rows are kept at zero.
+     */
+    SymbolicIntervalIterationHelper(Operator const& op, storm::dd::Bdd<DdType> const& allRows);
+
+    /*!
+     * Iterates the given lower and upper bounds until they are close enough.
+     *
+     * @param lower A vector of lower bounds for the solution. Will be overwritten with the final lower bounds.
+     * @param upper A vector of upper bounds for the solution. Will be overwritten with the final upper bounds.
+     * @param numIterations Will be increased by the number of performed iterations.
+     * @return Converged iff the (relative) difference between the bounds is at most twice the precision, i.e., the midpoint of the bounds is precise enough.
+     */
+    SolverStatus performIntervalIteration(storm::dd::Add<DdType, ValueType>& lower, storm::dd::Add<DdType, ValueType>& upper, uint64_t& numIterations,
+                                          ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Performs value iteration from below, guesses an upper bound and verifies the guess by applying the operator. Once an upper bound is verified,
+     * the bounds are refined with interval iteration. If the verification fails, value iteration is resumed with a smaller precision.
+     *
+     * @param lower A vector of lower bounds for the solution. Will be overwritten with the final lower bounds.
+     * @param upper Will be set to the final (verified) upper bounds. If no upper bound could be verified, the lower bounds are used.
+     * @param upperBounds If given, a vector of (known) upper bounds that is used to restrict the guesses.
+     * @param numIterations Will be increased by the number of performed iterations.
+     */
+    SolverStatus performOptimisticValueIteration(storm::dd::Add<DdType, ValueType>& lower, storm::dd::Add<DdType, ValueType>& upper,
+                                                 std::optional<storm::dd::Add<DdType, ValueType>> const& upperBounds, uint64_t& numIterations,
+                                                 ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * @return the midpoint of the given bounds.
+     */
+    storm::dd::Add<DdType, ValueType> getMidpoint(storm::dd::Add<DdType, ValueType> const& lower, storm::dd::Add<DdType, ValueType> const& upper) const;
+
+   private:
+    /*!
+     * Performs value iteration until two consecutive iterates differ by at most the given precision.
+     */
+    SolverStatus performValueIteration(storm::dd::Add<DdType, ValueType>& values, uint64_t& numIterations, ValueType const& precision, bool relative,
+                                       uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Guesses an upper bound that is slightly larger than the given lower bound.
+     */
+    storm::dd::Add<DdType, ValueType> guessUpperBound(storm::dd::Add<DdType, ValueType> const& lower, ValueType const& precision, bool relative) const;
+
+    Operator op;
+    storm::dd::Bdd<DdType> allRows;
+};
+
+}  // namespace storm::solver::helper
@@ -3,18 +3,22 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/Telemetry.h"
+#include "storm/utility/constants.h"
 
 namespace storm::solver::helper {
 
 template<typename ValueType, storm::OptimizationDirection Dir, bool Relative>
 class VIOperatorBackend {
    public:
-    VIOperatorBackend(ValueType const& precision) : precision{precision} {
+    VIOperatorBackend(ValueType const& precision, bool trackResidual = false) : precision{precision}, trackResidual{trackResidual} {
         // intentionally empty
     }
 
     void startNewIteration() {
         isConverged = true;
+        maximalDifference = storm::utility::zero<ValueType>();
     }
 
     void firstRow(ValueType&& value, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
@@ -26,6 +30,12 @@ class VIOperatorBackend {
     }
 
     void applyUpdate(ValueType& currValue, [[maybe_unused]] uint64_t rowGroup) {
+        if (trackResidual) {
+            ValueType difference = storm::utility::abs<ValueType>(currValue - *best);
+            if (difference > maximalDifference) {
+                maximalDifference = std::move(difference);
+            }
+        }
         if (isConverged) {
             if constexpr (Relative) {
                 isConverged = storm::utility::abs<ValueType>(currValue - *best) <= storm::utility::abs<ValueType>(precision * currValue);
@@ -40,10 +50,28 @@ class VIOperatorBackend {
         // intentionally left empty.
     }
 
+    void mergeChunk(VIOperatorBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+        if (chunkBackend.maximalDifference > maximalDifference) {
+            maximalDifference = chunkBackend.maximalDifference;
+        }
+    }
+
     bool converged() const {
         return isConverged;
     }
 
+    /*!
+     * The maximal absolute change of a value in the last iteration (only if the residual is tracked).
+     */
+    double residual() const {
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            return static_cast<double>(maximalDifference);
+        } else {
+            return storm::utility::convertNumber<double>(maximalDifference);
+        }
+    }
+
     bool constexpr abort() const {
         return false;
     }
@@ -52,6 +80,8 @@ class VIOperatorBackend {
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
     bool isConverged{true};
+    bool const trackResidual;
+    ValueType maximalDifference{storm::utility::zero<ValueType>()};
 };
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -67,7 +97,18 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
                                                                                    uint64_t& numIterations, SolutionType const& precision,
                                                                                    std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
                                                                                    MultiplicationStyle mult) const {
-    VIOperatorBackend<SolutionType, Dir, Relative> backend{precision};
+    // The residuals are only computed if they are recorded as telemetry or reported to a progress callback
+    bool const reportResidual = storm::utility::hasProgressCallback();
+    bool const trackResidual = storm::utility::telemetry::isRecording() || reportResidual;
+    double targetResidual = 0.0;
+    if (reportResidual) {
+        if constexpr (std::is_floating_point_v<SolutionType>) {
+            targetResidual = static_cast<double>(precision);
+        } else {
+            targetResidual = storm::utility::convertNumber<double>(precision);
+        }
+    }
+    VIOperatorBackend<SolutionType, Dir, Relative> backend{precision, trackResidual};
     std::vector<SolutionType>* operand1{&operand};
     std::vector<SolutionType>* operand2{&operand};
     if (mult == MultiplicationStyle::Regular) {
@@ -78,6 +119,12 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     while (status == SolverStatus::InProgress) {
         ++numIterations;
         bool applyResult = viOperator->template applyRobust<RobustDir>(*operand1, *operand2, offsets, backend);
+        if (trackResidual) {
+            storm::utility::telemetry::appendToSeries("residual", backend.residual());
+        }
+        if (reportResidual) {
+            storm::utility::publishResidual(backend.residual(), targetResidual);
+        }
         if (applyResult) {
             status = SolverStatus::Converged;
         } else if (iterationCallback) {
@@ -149,5 +196,7 @@ template class ValueIterationHelper<storm::RationalNumber, true>;
 template class ValueIterationHelper<storm::RationalNumber, false>;
 template class ValueIterationHelper<storm::Interval, true, double>;
 template class ValueIterationHelper<storm::Interval, false, double>;
+template class ValueIterationHelper<float, true>;
+template class ValueIterationHelper<float, false>;
 
 }  // namespace storm::solver::helper
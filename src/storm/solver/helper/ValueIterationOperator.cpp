@@ -1,15 +1,59 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
 #include <optional>
+#include <type_traits>
+#include <unordered_map>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SubmatrixView.h"
 
 namespace storm::solver::helper {
 
+namespace detail {
+template<typename ValueType, typename MatrixValueType>
+ValueType convertMatrixValue(MatrixValueType const& value) {
+    if constexpr (std::is_same_v<ValueType, MatrixValueType>) {
+        return value;
+    } else {
+        return static_cast<ValueType>(value);
+    }
+}
+
+template<typename MatrixValueType, typename Function>
+void forEachEntryOfRow(storm::storage::SparseMatrix<MatrixValueType> const& matrix, uint64_t row, Function const& function) {
+    for (auto const& entry : matrix.getRow(row)) {
+        function(entry.getColumn(), entry.getValue());
+    }
+}
+
+template<typename MatrixValueType, typename Function>
+void forEachEntryOfRow(storm::storage::SubmatrixView<MatrixValueType> const& matrix, uint64_t row, Function const& function) {
+    matrix.forEachEntry(row, function);
+}
+
+template<typename MatrixValueType>
+uint64_t getEntryCount(storm::storage::SparseMatrix<MatrixValueType> const& matrix) {
+    return matrix.getNonzeroEntryCount();
+}
+
+template<typename MatrixValueType>
+uint64_t getEntryCount(storm::storage::SubmatrixView<MatrixValueType> const& matrix) {
+    return matrix.getEntryCount();
+}
+
+/*!
+ * @return true iff the given column of an entry in the given row group can be stored in the delta encoding
+ */
+bool isDeltaColumn(uint64_t column, uint64_t groupIndex, uint64_t bias, uint64_t escape) {
+    return column + bias >= groupIndex && column + bias - groupIndex < escape;
+}
+}  // namespace detail
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-template<bool Backward>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix,
+template<bool Backward, typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix,
                                                                                     std::vector<IndexType> const* rowGroupIndices) {
     if constexpr (TrivialRowGrouping) {
         STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
@@ -22,99 +66,436 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
             this->rowGroupIndices = &matrix.getRowGroupIndices();
         }
     }
+    uint64_t maxRowSize = 0;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        maxRowSize = std::max<uint64_t>(maxRowSize, matrix.getRow(row).getNumberOfEntries());
+    }
+    setMatrixInternal<Backward>(matrix, maxRowSize);
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward, typename MatrixValueType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrix(storm::storage::SubmatrixView<MatrixValueType> const& matrix) {
+    if constexpr (TrivialRowGrouping) {
+        STORM_LOG_ASSERT(matrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping");
+        this->rowGroupIndices = nullptr;
+    } else {
+        this->rowGroupIndices = &matrix.getRowGroupIndices();
+    }
+    setMatrixInternal<Backward>(matrix, matrix.getMaximalRowEntryCount());
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<bool Backward, typename MatrixType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixInternal(MatrixType const& matrix, uint64_t maxRowSize) {
     this->backwards = Backward;
     this->hasSkippedRows = false;
-    auto const numRows = matrix.getRowCount();
     matrixValues.clear();
+    valueDictionary.clear();
+    byteValueIndices.clear();
+    shortValueIndices.clear();
+    valueEncoding = ValueEncoding::Plain;
     matrixColumns.clear();
-    matrixValues.reserve(matrix.getNonzeroEntryCount());
-    matrixColumns.reserve(matrix.getNonzeroEntryCount() + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
+    compactMatrixColumns.clear();
+    deltaMatrixColumns.clear();
+    escapedColumns.clear();
+    // The compact representations can be used if all numbers of entries in a row (that we might need to skip) are below the indicator bits.
+    // For the compact columns, this also has to hold for all columns. For the delta columns, we only accept a few escaped columns as their lookup is
+    // much more expensive than reading the larger columns.
+    if (maxRowSize + 1 <= SkipNumEntriesMask<DeltaColumnType> && getNumberOfEscapedDeltaColumns(matrix) <= detail::getEntryCount(matrix) / 100) {
+        columnEncoding = ColumnEncoding::Delta;
+        setMatrixColumnsAndValues<DeltaColumnType, Backward>(matrix);
+    } else if (std::max<uint64_t>(matrix.getColumnCount(), maxRowSize + 1) <= SkipNumEntriesMask<CompactColumnType>) {
+        columnEncoding = ColumnEncoding::Compact;
+        setMatrixColumnsAndValues<CompactColumnType, Backward>(matrix);
+    } else {
+        columnEncoding = ColumnEncoding::Plain;
+        setMatrixColumnsAndValues<IndexType, Backward>(matrix);
+    }
+    setValueDictionary();
+    switch (columnEncoding) {
+        case ColumnEncoding::Delta:
+            initializeRobustOrder<DeltaColumnType>();
+            break;
+        case ColumnEncoding::Compact:
+            initializeRobustOrder<CompactColumnType>();
+            break;
+        case ColumnEncoding::Plain:
+            initializeRobustOrder<IndexType>();
+            break;
+    }
+    computeApplyChunks();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType, bool Backward, typename MatrixType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixColumnsAndValues(MatrixType const& matrix) {
+    auto const numRows = matrix.getRowCount();
+    auto& matrixColumns = getColumns<ColumnType>();
+    auto const numEntries = detail::getEntryCount(matrix);
+    matrixValues.reserve(numEntries);
+    matrixColumns.reserve(numEntries + numRows + 1);  // matrixColumns also contain indications for when a row(group) starts
     if constexpr (!TrivialRowGrouping) {
-        matrixColumns.push_back(StartOfRowGroupIndicator);  // indicate start of first row(group)
+        matrixColumns.push_back(StartOfRowGroupIndicator<ColumnType>);  // indicate start of first row(group)
         for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
             STORM_LOG_ASSERT(this->rowGroupIndices->at(groupIndex) != this->rowGroupIndices->at(groupIndex + 1),
                              "There is an empty row group. This is not expected.");
             for (auto rowIndex : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1])) {
-                for (auto const& entry : matrix.getRow(rowIndex)) {
-                    matrixValues.push_back(entry.getValue());
-                    matrixColumns.push_back(entry.getColumn());
-                }
-                matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
+                detail::forEachEntryOfRow(matrix, rowIndex, [this, &matrixColumns, &groupIndex](auto column, auto const& value) {
+                    matrixColumns.push_back(encodeColumn<ColumnType>(column, groupIndex));
+                    matrixValues.push_back(detail::convertMatrixValue<ValueType>(value));
+                });
+                matrixColumns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
             }
-            matrixColumns.back() = StartOfRowGroupIndicator;  // This is the start of the next row group
+            matrixColumns.back() = StartOfRowGroupIndicator<ColumnType>;  // This is the start of the next row group
         }
     } else {
-        matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of first row
+        matrixColumns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of first row
         for (auto rowIndex : indexRange<Backward>(0, numRows)) {
-            for (auto const& entry : matrix.getRow(rowIndex)) {
-                matrixValues.push_back(entry.getValue());
-                matrixColumns.push_back(entry.getColumn());
+            detail::forEachEntryOfRow(matrix, rowIndex, [this, &matrixColumns, &rowIndex](auto column, auto const& value) {
+                matrixColumns.push_back(encodeColumn<ColumnType>(column, rowIndex));
+                matrixValues.push_back(detail::convertMatrixValue<ValueType>(value));
+            });
+            matrixColumns.push_back(StartOfRowIndicator<ColumnType>);  // Indicate start of next row
+        }
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename MatrixType>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getNumberOfEscapedDeltaColumns(MatrixType const& matrix) const {
+    uint64_t result{0};
+    auto countEscapedColumns = [&result](IndexType groupIndex) {
+        return [&result, groupIndex](auto column, auto const&) {
+            if (!detail::isDeltaColumn(column, groupIndex, DeltaBias, DeltaEscape)) {
+                ++result;
+            }
+        };
+    };
+    if constexpr (TrivialRowGrouping) {
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            detail::forEachEntryOfRow(matrix, row, countEscapedColumns(row));
+        }
+    } else {
+        for (uint64_t groupIndex = 0; groupIndex + 1 < rowGroupIndices->size(); ++groupIndex) {
+            for (auto row = (*rowGroupIndices)[groupIndex]; row < (*rowGroupIndices)[groupIndex + 1]; ++row) {
+                detail::forEachEntryOfRow(matrix, row, countEscapedColumns(groupIndex));
             }
-            matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
         }
     }
+    return result;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixForwards(storm::storage::SparseMatrix<ValueType> const& matrix,
-                                                                                            std::vector<IndexType> const* rowGroupIndices) {
-    setMatrix<false>(matrix, rowGroupIndices);
+template<typename ColumnType>
+ColumnType ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::encodeColumn(IndexType column, IndexType groupIndex) {
+    if constexpr (std::is_same_v<ColumnType, DeltaColumnType>) {
+        if (detail::isDeltaColumn(column, groupIndex, DeltaBias, DeltaEscape)) {
+            return static_cast<DeltaColumnType>(column + DeltaBias - groupIndex);
+        }
+        // The entries are added in order, so the escaped columns are sorted by their entry index.
+        escapedColumns.emplace_back(matrixValues.size(), column);
+        return DeltaEscape;
+    } else {
+        return static_cast<ColumnType>(column);
+    }
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMatrixBackwards(storm::storage::SparseMatrix<ValueType> const& matrix,
-                                                                                             std::vector<IndexType> const* rowGroupIndices) {
-    setMatrix<true>(matrix, rowGroupIndices);
+typename ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::IndexType
+ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::getEscapedColumn(uint64_t entryIndex) const {
+    auto it = std::lower_bound(escapedColumns.begin(), escapedColumns.end(), entryIndex,
+                               [](std::pair<uint64_t, IndexType> const& escapedColumn, uint64_t index) { return escapedColumn.first < index; });
+    STORM_LOG_ASSERT(it != escapedColumns.end() && it->first == entryIndex, "No escaped column for entry " << entryIndex << ".");
+    return it->second;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
-    for (auto& c : matrixColumns) {
-        if (c >= StartOfRowIndicator) {
-            c &= StartOfRowGroupIndicator;
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setValueDictionary() {
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        // Larger dictionaries would no longer fit into the L1 cache, so that the indirection is likely to cost more than the saved memory traffic.
+        uint64_t const maximalDictionarySize = 1ull << 12;
+        std::unordered_map<ValueType, uint64_t> dictionaryIndices;
+        for (auto const& value : matrixValues) {
+            if (dictionaryIndices.try_emplace(value, dictionaryIndices.size()).second && dictionaryIndices.size() > maximalDictionarySize) {
+                return;
+            }
+        }
+        if (dictionaryIndices.empty()) {
+            return;
+        }
+        valueDictionary.resize(dictionaryIndices.size());
+        for (auto const& [value, index] : dictionaryIndices) {
+            valueDictionary[index] = value;
+        }
+        auto setValueIndices = [this, &dictionaryIndices](auto& valueIndices) {
+            using ValueIndexType = typename std::decay_t<decltype(valueIndices)>::value_type;
+            valueIndices.reserve(matrixValues.size());
+            for (auto const& value : matrixValues) {
+                valueIndices.push_back(static_cast<ValueIndexType>(dictionaryIndices.at(value)));
+            }
+        };
+        if (valueDictionary.size() <= std::numeric_limits<ByteValueIndexType>::max() + 1ull) {
+            setValueIndices(byteValueIndices);
+            valueEncoding = ValueEncoding::ByteDictionary;
+        } else {
+            setValueIndices(shortValueIndices);
+            valueEncoding = ValueEncoding::ShortDictionary;
+        }
+        // Release the memory of the plain values
+        decltype(matrixValues)().swap(matrixValues);
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::initializeRobustOrder() {
+    if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+        auto& robustOrder = applyCache.robustOrder;
+        robustOrder.assign(matrixValues.size(), 0);
+        // Initially, the entries with a non-trivial interval are ordered as in the matrix.
+        uint64_t entryIndex{0}, rowStart{0}, orderPosition{0};
+        for (auto const& column : getColumns<ColumnType>()) {
+            if (column >= StartOfRowIndicator<ColumnType>) {
+                rowStart = entryIndex;
+                orderPosition = entryIndex;
+                continue;
+            }
+            auto const& value = matrixValues[entryIndex];
+            if (!storm::utility::isZero(value.upper() - value.lower())) {
+                STORM_LOG_ASSERT(entryIndex - rowStart <= std::numeric_limits<uint32_t>::max(), "Row is too large.");
+                robustOrder[orderPosition++] = static_cast<uint32_t>(entryIndex - rowStart);
+            }
+            ++entryIndex;
         }
     }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::usesValueDictionary() const {
+    return valueEncoding != ValueEncoding::Plain;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::usesDeltaColumns() const {
+    return columnEncoding == ColumnEncoding::Delta;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
+    switch (columnEncoding) {
+        case ColumnEncoding::Delta:
+            unsetIgnoredRows<DeltaColumnType>();
+            break;
+        case ColumnEncoding::Compact:
+            unsetIgnoredRows<CompactColumnType>();
+            break;
+        case ColumnEncoding::Plain:
+            unsetIgnoredRows<IndexType>();
+            break;
+    }
     hasSkippedRows = false;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-template<bool Backward>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
+    for (auto& c : getColumns<ColumnType>()) {
+        if (c >= StartOfRowIndicator<ColumnType>) {
+            c &= StartOfRowGroupIndicator<ColumnType>;
+        }
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType, bool Backward>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
                                                                                          std::function<bool(IndexType, IndexType)> const& ignore) {
     STORM_LOG_ASSERT(!TrivialRowGrouping, "Tried to ignroe rows but the row grouping is trivial.");
+    auto& matrixColumns = getColumns<ColumnType>();
     auto colIt = matrixColumns.begin();
     for (auto groupIndex : indexRange<Backward>(0, this->rowGroupIndices->size() - 1)) {
         STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt >= StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
         auto const rowIndexRange = useLocalRowIndices ? indexRange<false>(0ull, (*this->rowGroupIndices)[groupIndex + 1] - (*this->rowGroupIndices)[groupIndex])
                                                       : indexRange<false>((*this->rowGroupIndices)[groupIndex], (*this->rowGroupIndices)[groupIndex + 1]);
         for (auto const rowIndex : rowIndexRange) {
             if (!ignore(groupIndex, rowIndex)) {
-                *colIt &= StartOfRowGroupIndicator;  // Clear number of skipped entries
-                moveToEndOfRow(colIt);
-            } else if ((*colIt & SkipNumEntriesMask) == 0) {  // i.e. should ignore but is not already ignored
+                *colIt &= StartOfRowGroupIndicator<ColumnType>;  // Clear number of skipped entries
+                moveToEndOfRow<ColumnType>(colIt);
+            } else if ((*colIt & SkipNumEntriesMask<ColumnType>) == 0) {  // i.e. should ignore but is not already ignored
                 auto currColIt = colIt;
-                moveToEndOfRow(colIt);
-                *currColIt += std::distance(currColIt, colIt);  // set number of skipped entries
+                moveToEndOfRow<ColumnType>(colIt);
+                *currColIt += static_cast<ColumnType>(std::distance(currColIt, colIt));  // set number of skipped entries
             }
             STORM_LOG_ASSERT(
                 !std::all_of(rowIndexRange.begin(), rowIndexRange.end(), [&ignore, &groupIndex](IndexType rowIndex) { return ignore(groupIndex, rowIndex); }),
                 "All rows in row group " << groupIndex << " are ignored.");
             STORM_LOG_ASSERT(colIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*colIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         }
-        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(*colIt == StartOfRowGroupIndicator<ColumnType>, "VI Operator in invalid state.");
     }
-    hasSkippedRows = true;
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setIgnoredRows(bool useLocalRowIndices,
                                                                                          std::function<bool(IndexType, IndexType)> const& ignore) {
-    if (backwards) {
-        setIgnoredRows<true>(useLocalRowIndices, ignore);
-    } else {
-        setIgnoredRows<false>(useLocalRowIndices, ignore);
+    auto setIgnoredRowsWithColumnType = [this, useLocalRowIndices, &ignore](auto columnTypeTag) {
+        using ColumnType = decltype(columnTypeTag);
+        if (backwards) {
+            setIgnoredRows<ColumnType, true>(useLocalRowIndices, ignore);
+        } else {
+            setIgnoredRows<ColumnType, false>(useLocalRowIndices, ignore);
+        }
+    };
+    switch (columnEncoding) {
+        case ColumnEncoding::Delta:
+            setIgnoredRowsWithColumnType(DeltaColumnType{});
+            break;
+        case ColumnEncoding::Compact:
+            setIgnoredRowsWithColumnType(CompactColumnType{});
+            break;
+        case ColumnEncoding::Plain:
+            setIgnoredRowsWithColumnType(IndexType{});
+            break;
+    }
+    hasSkippedRows = true;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setParallelApply(uint64_t numberOfThreads) {
+#ifdef STORM_HAVE_INTELTBB
+    numberOfApplyThreads = numberOfThreads > 1 ? numberOfThreads : 0;
+#else
+    STORM_LOG_WARN_COND(numberOfThreads <= 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    numberOfApplyThreads = 0;
+#endif
+    computeApplyChunks();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::isParallelApplySet() const {
+    return !applyChunks.empty();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::computeApplyChunks() {
+    applyChunks.clear();
+    switch (columnEncoding) {
+        case ColumnEncoding::Delta:
+            computeApplyChunks<DeltaColumnType>();
+            break;
+        case ColumnEncoding::Compact:
+            computeApplyChunks<CompactColumnType>();
+            break;
+        case ColumnEncoding::Plain:
+            computeApplyChunks<IndexType>();
+            break;
+    }
+    placeApplyChunks();
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::placeApplyChunks() {
+    numaAware = false;
+    numaPlacedOperands.clear();
+#ifdef STORM_HAVE_INTELTBB
+    if (applyChunks.empty() || !storm::utility::numa::isEnabled()) {
+        return;
+    }
+    storm::utility::numa::pinThreads();
+    numaAware = true;
+    // The data of a chunk ends where the data of the next chunk (in the order of the chunks) starts.
+    auto placeChunkData = [this](auto const& data, uint64_t chunkIndex, auto getOffset) {
+        uint64_t const end = chunkIndex + 1 < applyChunks.size() ? getOffset(applyChunks[chunkIndex + 1]) : data.size();
+        storm::utility::numa::moveToCurrentNode(data, getOffset(applyChunks[chunkIndex]), end);
+    };
+    auto getColumnOffset = [](ApplyChunk const& chunk) { return chunk.matrixColumnOffset; };
+    auto getValueOffset = [](ApplyChunk const& chunk) { return chunk.matrixValueOffset; };
+    // We use the same (static) assignment of chunks to threads as the parallel application.
+    tbb::parallel_for(
+        tbb::blocked_range<uint64_t>(0, applyChunks.size(), 1),
+        [&](tbb::blocked_range<uint64_t> const& range) {
+            for (auto chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                switch (columnEncoding) {
+                    case ColumnEncoding::Delta:
+                        placeChunkData(deltaMatrixColumns, chunkIndex, getColumnOffset);
+                        break;
+                    case ColumnEncoding::Compact:
+                        placeChunkData(compactMatrixColumns, chunkIndex, getColumnOffset);
+                        break;
+                    case ColumnEncoding::Plain:
+                        placeChunkData(matrixColumns, chunkIndex, getColumnOffset);
+                        break;
+                }
+                switch (valueEncoding) {
+                    case ValueEncoding::Plain:
+                        placeChunkData(matrixValues, chunkIndex, getValueOffset);
+                        break;
+                    case ValueEncoding::ByteDictionary:
+                        placeChunkData(byteValueIndices, chunkIndex, getValueOffset);
+                        break;
+                    case ValueEncoding::ShortDictionary:
+                        placeChunkData(shortValueIndices, chunkIndex, getValueOffset);
+                        break;
+                }
+            }
+        },
+        tbb::static_partitioner());
+#endif
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::computeApplyChunks() {
+    auto const& matrixColumns = getColumns<ColumnType>();
+    if (numberOfApplyThreads == 0 || matrixColumns.empty()) {
+        return;
+    }
+    // We use several chunks per thread so that the work is distributed evenly, even if some rows are more expensive than others.
+    // Chunks should not be too small as otherwise the overhead for scheduling and merging the backends dominates.
+    uint64_t const chunksPerThread = 4;
+    uint64_t const minimalChunkSize = 4096;
+    uint64_t const numberOfChunks = std::min(numberOfApplyThreads * chunksPerThread, matrixColumns.size() / minimalChunkSize);
+    if (numberOfChunks <= 1) {
+        return;
+    }
+    uint64_t const numGroups = TrivialRowGrouping ? matrixColumns.size() - getNumberOfEntries() - 1 : rowGroupIndices->size() - 1;
+    uint64_t const entriesPerChunk = matrixColumns.size() / numberOfChunks;
+
+    // Positions refer to the order in which the row groups are processed (which is reversed for backwards iterations)
+    auto addChunk = [this, &numGroups](uint64_t firstPosition, uint64_t endPosition, uint64_t columnOffset, uint64_t valueOffset) {
+        if (backwards) {
+            applyChunks.push_back({numGroups - endPosition, numGroups - firstPosition, columnOffset, valueOffset});
+        } else {
+            applyChunks.push_back({firstPosition, endPosition, columnOffset, valueOffset});
+        }
+    };
+    uint64_t chunkStartPosition{0}, chunkColumnOffset{0}, chunkValueOffset{0};
+    uint64_t position{0}, valueOffset{0};
+    for (uint64_t columnOffset = 1; columnOffset < matrixColumns.size(); ++columnOffset) {
+        auto const& entry = matrixColumns[columnOffset];
+        if (entry < StartOfRowIndicator<ColumnType>) {
+            ++valueOffset;
+            continue;
+        }
+        if (!TrivialRowGrouping && (entry & StartOfRowGroupIndicator<ColumnType>) != StartOfRowGroupIndicator<ColumnType>) {
+            continue;  // Start of a row that is not the first row of its group
+        }
+        // At this point, a new row group starts
+        ++position;
+        if (columnOffset - chunkColumnOffset >= entriesPerChunk && position < numGroups) {
+            addChunk(chunkStartPosition, position, chunkColumnOffset, chunkValueOffset);
+            chunkStartPosition = position;
+            chunkColumnOffset = columnOffset;
+            chunkValueOffset = valueOffset;
+        }
+    }
+    STORM_LOG_ASSERT(position == numGroups, "Unexpected number of row groups.");
+    addChunk(chunkStartPosition, numGroups, chunkColumnOffset, chunkValueOffset);
+    if (applyChunks.size() == 1) {
+        applyChunks.clear();
     }
 }
 
@@ -129,6 +510,12 @@ template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 std::vector<SolutionType>& ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::allocateAuxiliaryVector(
     uint64_t size, std::optional<SolutionType> const& initialValue) {
     STORM_LOG_ASSERT(!auxiliaryVectorUsedExternally, "Auxiliary vector already in use.");
+    if (auxiliaryVector.capacity() < size) {
+        // Allocate the new memory explicitly such that huge pages can be requested before it is touched.
+        std::vector<SolutionType>().swap(auxiliaryVector);
+        auxiliaryVector.reserve(size);
+        storm::utility::adviseHugePages(auxiliaryVector);
+    }
     if (initialValue) {
         auxiliaryVector.assign(size, *initialValue);
     } else {
@@ -144,35 +531,19 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::freeAu
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const {
+template<typename ColumnType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::moveToEndOfRow(
+    typename storm::utility::AlignedVector<ColumnType>::iterator& matrixColumnIt) const {
     do {
         ++matrixColumnIt;
-    } while (*matrixColumnIt < StartOfRowIndicator);
+    } while (*matrixColumnIt < StartOfRowIndicator<ColumnType>);
 }
 
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-bool ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                                                                         typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask)) {
-        matrixColumnIt += entriesToSkip;
-        matrixValueIt += entriesToSkip - 1;
-        return true;
-    }
-    return false;
-}
-
-template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
-uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::skipMultipleIgnoredRows(
-    std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
-    IndexType result{0ull};
-    while (skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-        ++result;
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "Undexpected state of VI operator");
-        // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
-        STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator, "Undexpected state of VI operator");
-    }
-    return result;
-}
+#define INSTANTIATE_SET_MATRIX(VT, TRG, ST, MVT)                                                                                                      \
+    template void ValueIterationOperator<VT, TRG, ST>::setMatrix<true, MVT>(storm::storage::SparseMatrix<MVT> const&, std::vector<uint64_t> const*);  \
+    template void ValueIterationOperator<VT, TRG, ST>::setMatrix<false, MVT>(storm::storage::SparseMatrix<MVT> const&, std::vector<uint64_t> const*); \
+    template void ValueIterationOperator<VT, TRG, ST>::setMatrix<true, MVT>(storm::storage::SubmatrixView<MVT> const&);                               \
+    template void ValueIterationOperator<VT, TRG, ST>::setMatrix<false, MVT>(storm::storage::SubmatrixView<MVT> const&);
 
 template class ValueIterationOperator<double, true>;
 template class ValueIterationOperator<double, false>;
@@ -180,5 +551,18 @@ template class ValueIterationOperator<storm::RationalNumber, true>;
 template class ValueIterationOperator<storm::RationalNumber, false>;
 template class ValueIterationOperator<storm::Interval, true, double>;
 template class ValueIterationOperator<storm::Interval, false, double>;
+template class ValueIterationOperator<float, true>;
+template class ValueIterationOperator<float, false>;
+
+INSTANTIATE_SET_MATRIX(double, true, double, double)
+INSTANTIATE_SET_MATRIX(double, false, double, double)
+INSTANTIATE_SET_MATRIX(storm::RationalNumber, true, storm::RationalNumber, storm::RationalNumber)
+INSTANTIATE_SET_MATRIX(storm::RationalNumber, false, storm::RationalNumber, storm::RationalNumber)
+INSTANTIATE_SET_MATRIX(storm::Interval, true, double, storm::Interval)
+INSTANTIATE_SET_MATRIX(storm::Interval, false, double, storm::Interval)
+// Single precision operators are obtained from double precision matrices.
+INSTANTIATE_SET_MATRIX(float, true, float, double)
+INSTANTIATE_SET_MATRIX(float, false, float, double)
+#undef INSTANTIATE_SET_MATRIX
 
 }  // namespace storm::solver::helper
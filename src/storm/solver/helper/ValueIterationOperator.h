@@ -1,15 +1,24 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/AlignedAllocator.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/numa.h"
 #include "storm/utility/vector.h"  // TODO
 
 namespace storm {
@@ -18,6 +27,8 @@ class Environment;
 namespace storage {
 template<typename T>
 class SparseMatrix;
+template<typename T>
+class SubmatrixView;
 }
 
 namespace solver::helper {
@@ -39,11 +50,13 @@ class ValueIterationOperator {
      * Initializes this operator with the given data
      * @tparam backwards if true, we iterate backwards starting with the largest rowgroup. This often makes in place (Gauss-Seidel) iterations more efficient
      * @param matrix the transition matrix
+     * @tparam MatrixValueType the value type of the given matrix. If this differs from ValueType, the entries are converted (e.g. to iterate on a single
+     * precision copy of a double precision matrix)
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
      * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
-    template<bool Backward = true>
-    void setMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    template<bool Backward = true, typename MatrixValueType = ValueType>
+    void setMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
 
     /*!
      * Initializes this operator with the given data for forward iterations (starting with the smallest row group
@@ -51,7 +64,10 @@ class ValueIterationOperator {
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
      * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
-    void setMatrixForwards(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    template<typename MatrixValueType = ValueType>
+    void setMatrixForwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr) {
+        setMatrix<false>(matrix, rowGroupIndices);
+    }
 
     /*!
      * Initializes this operator with the given data for backward iterations (starting with the largest row group)
@@ -59,7 +75,28 @@ class ValueIterationOperator {
      * @param rowGroupIndices if given, overwrites the rowGroupIndices of the matrix. Must be nullptr if TrivialRowGrouping is true
      * @note The reference to the row group indices (either of the matrix or the given pointer) must not be invalidated as long as this operator is used.
      */
-    void setMatrixBackwards(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr);
+    template<typename MatrixValueType = ValueType>
+    void setMatrixBackwards(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<IndexType> const* rowGroupIndices = nullptr) {
+        setMatrix<true>(matrix, rowGroupIndices);
+    }
+
+    /*!
+     * Initializes this operator with the given view on a submatrix. The entries are directly taken from the original matrix, i.e., the submatrix does not
+     * need to be materialized.
+     * @note The view (in particular its row group indices) must not be invalidated as long as this operator is used.
+     */
+    template<bool Backward = true, typename MatrixValueType = ValueType>
+    void setMatrix(storm::storage::SubmatrixView<MatrixValueType> const& matrix);
+
+    template<typename MatrixValueType = ValueType>
+    void setMatrixForwards(storm::storage::SubmatrixView<MatrixValueType> const& matrix) {
+        setMatrix<false>(matrix);
+    }
+
+    template<typename MatrixValueType = ValueType>
+    void setMatrixBackwards(storm::storage::SubmatrixView<MatrixValueType> const& matrix) {
+        setMatrix<true>(matrix);
+    }
 
     /*!
      * Applies the operator with the given operands, offsets, and backend.
@@ -75,6 +112,12 @@ class ValueIterationOperator {
      * * backend.abort(); invoked after a group is processed. If this returns true, the method is aborted, even if some groups have not been processed yet
      * * backend.endOfIteration(); invoked when all groups are processed
      * * backend.converged(); invoked when abort() returns true or all groups are processed. Determines the return value of this method
+     * If parallel application is enabled (see `setParallelApply`), the backend may additionally implement
+     * * backend.mergeChunk(chunkBackend); invoked for each processed chunk with the copy of the backend that processed the chunk.
+     *   The copies are created after backend.startNewIteration(). Backends without this method are always processed sequentially.
+     * * backend.isAsynchronous(); (optional) if this returns true for a parallel in-place application with floating point operands, the chunks read the
+     *   current operand values (which might be concurrently written by other chunks) instead of a copy. In this case, applyUpdate has to write its values
+     *   atomically (e.g. using relaxed std::atomic_ref stores).
      *
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
@@ -140,11 +183,39 @@ class ValueIterationOperator {
      */
     void unsetIgnoredRows();
 
+    /*!
+     * Enables parallel application of this operator (only if Storm is built with Intel TBB).
+     * The row groups are split into contiguous chunks with roughly the same number of matrix entries. The chunks are processed concurrently,
+     * each one with its own copy of the backend (see `apply`).
+     * In-place applications read the operand values from before the application (i.e., updates are Jacobi-style instead of Gauss-Seidel-style),
+     * unless the backend requests asynchronous updates (see `apply`).
+     * If NUMA-aware placement is enabled (see `storm::utility::numa`), the threads are pinned and each chunk is statically assigned to a thread. The
+     * matrix data of a chunk and the corresponding operand entries are then moved to the NUMA node of that thread.
+     * @param numberOfThreads the number of threads that shall be utilized. A value <= 1 disables parallel application.
+     * @note The chunks are recomputed whenever a new matrix is set.
+     */
+    void setParallelApply(uint64_t numberOfThreads);
+
+    /*!
+     * @return true iff the operator is applied in parallel for backends that support it
+     */
+    bool isParallelApplySet() const;
+
     /*!
      * @return The considered row group indices
      */
     std::vector<IndexType> const& getRowGroupIndices() const;
 
+    /*!
+     * @return true iff the matrix values are stored as indices into a dictionary of the distinct values (see `setMatrix`)
+     */
+    bool usesValueDictionary() const;
+
+    /*!
+     * @return true iff the columns of the matrix entries are stored as 16 bit offsets to the index of their row group (see `setMatrix`)
+     */
+    bool usesDeltaColumns() const;
+
     /*!
      * Allocates additional storage that can be used e.g. when applying the operand
      * @param size the size of the auxiliary vector
@@ -159,34 +230,201 @@ class ValueIterationOperator {
     void freeAuxiliaryVector();
 
    private:
+    /// Type of column entries for matrices whose column indices and row sizes can be represented with 30 bits
+    using CompactColumnType = uint32_t;
+
+    /// Type of column entries that store the offset of the column to the index of the row group (see ColumnEncoding::Delta)
+    using DeltaColumnType = uint16_t;
+
+    /*!
+     * How the columns of the matrix entries are stored
+     * * Plain: as IndexType
+     * * Compact: as CompactColumnType
+     * * Delta: as DeltaColumnType. A column c of an entry in row group g is stored as c - g + DeltaBias. Columns for which this does not yield a
+     *   valid entry are replaced by the escape code DeltaEscape and looked up in `escapedColumns`.
+     */
+    enum class ColumnEncoding { Plain, Compact, Delta };
+
+    template<typename ColumnType>
+    using ColumnIterator = typename storm::utility::AlignedVector<ColumnType>::const_iterator;
+
+    using ValueIterator = typename storm::utility::AlignedVector<ValueType>::const_iterator;
+
+    /// Types of the indices into the value dictionary
+    using ByteValueIndexType = uint8_t;
+    using ShortValueIndexType = uint16_t;
+
+    /*!
+     * How the values of the matrix entries are stored
+     */
+    enum class ValueEncoding { Plain, ByteDictionary, ShortDictionary };
+
+    /*!
+     * Iterates over matrix values that are stored as indices into the value dictionary. Provides the operations of ValueIterator that we need.
+     */
+    template<typename ValueIndexType>
+    class DictionaryValueIterator {
+       public:
+        DictionaryValueIterator(ValueIndexType const* index, ValueType const* dictionary) : index(index), dictionary(dictionary) {
+            // Intentionally left empty
+        }
+
+        ValueType const& operator*() const {
+            return dictionary[*index];
+        }
+
+        ValueType const* operator->() const {
+            return dictionary + *index;
+        }
+
+        ValueType const& operator[](uint64_t offset) const {
+            return dictionary[index[offset]];
+        }
+
+        DictionaryValueIterator& operator++() {
+            ++index;
+            return *this;
+        }
+
+        DictionaryValueIterator& operator+=(uint64_t offset) {
+            index += offset;
+            return *this;
+        }
+
+        DictionaryValueIterator operator+(uint64_t offset) const {
+            return DictionaryValueIterator(index + offset, dictionary);
+        }
+
+        bool operator==(DictionaryValueIterator const& other) const {
+            return index == other.index;
+        }
+
+        bool operator!=(DictionaryValueIterator const& other) const {
+            return index != other.index;
+        }
+
+        int64_t operator-(DictionaryValueIterator const& other) const {
+            return index - other.index;
+        }
+
+       private:
+        ValueIndexType const* index;
+        ValueType const* dictionary;
+    };
+
+    // Due to a GCC bug we have to add this dummy template type here (see ApplyCache)
+    template<typename ApplyValueType, typename Dummy>
+    struct RobustScratch {};
+
+    /*!
+     * Scratch space for robust value iteration. Every thread uses its own instance.
+     */
+    template<typename Dummy>
+    struct RobustScratch<storm::Interval, Dummy> {
+        /// The operand value and the diameter of each entry of the current row
+        std::vector<std::pair<SolutionType, SolutionType>> rowEntries;
+    };
+
     /*!
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
     bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        switch (columnEncoding) {
+            case ColumnEncoding::Delta:
+                return applyWithColumns<DeltaColumnType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, backend);
+            case ColumnEncoding::Compact:
+                return applyWithColumns<CompactColumnType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, backend);
+            default:
+                return applyWithColumns<IndexType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn,
+                                                                                                                                     offsets, backend);
+        }
+    }
+
+    /*!
+     * Internal variant of `apply` for the given type of column entries
+     */
+    template<typename ColumnType, typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows,
+             OptimizationDirection RobustDirection>
+    bool applyWithColumns(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        if constexpr (std::is_floating_point_v<ValueType>) {
+            if (valueEncoding == ValueEncoding::ByteDictionary) {
+                return applyImpl<ColumnType, DictionaryValueIterator<ByteValueIndexType>, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows,
+                                 RobustDirection>(operandOut, operandIn, offsets, backend);
+            } else if (valueEncoding == ValueEncoding::ShortDictionary) {
+                return applyImpl<ColumnType, DictionaryValueIterator<ShortValueIndexType>, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows,
+                                 RobustDirection>(operandOut, operandIn, offsets, backend);
+            }
+        }
+        return applyImpl<ColumnType, ValueIterator, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn,
+                                                                                                                                      offsets, backend);
+    }
+
+    /*!
+     * Internal variant of `apply` for the given type of column entries and the given way to access the values
+     */
+    template<typename ColumnType, typename ValueIteratorType, typename OperandType, typename OffsetType, typename BackendType, bool Backward,
+             bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    bool applyImpl(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
         STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
+#ifdef STORM_HAVE_INTELTBB
+        if constexpr (SupportsParallelApply<BackendType>::value) {
+            if (!applyChunks.empty()) {
+                return applyParallel<ColumnType, ValueIteratorType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, backend);
+            }
+        }
+#endif
         backend.startNewIteration();
-        auto matrixValueIt = matrixValues.cbegin();
-        auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
-            STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
-            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        auto matrixValueIt = getValues<ValueIteratorType>();
+        auto matrixColumnIt = getColumns<ColumnType>().cbegin();
+        RobustScratch<ValueType, int> robustScratch;
+        if (!applyGroups<ColumnType, ValueIteratorType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                0, operandSize, matrixColumnIt, matrixValueIt, operandOut, operandIn, offsets, backend, robustScratch)) {
+            return backend.converged();
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == getColumns<ColumnType>().cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == getValues<ValueIteratorType>() + getNumberOfEntries(), "Unexpected position of matrix value iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Processes the row groups with index in [groupBegin, groupEnd) (in the order given by Backward), starting at the given iterator positions.
+     * @return false iff the application was aborted by the backend
+     */
+    template<typename ColumnType, typename ValueIteratorType, typename OperandType, typename OffsetType, typename BackendType, bool Backward,
+             bool SkipIgnoredRows, OptimizationDirection RobustDirection, bool Asynchronous = false>
+    bool applyGroups(IndexType groupBegin, IndexType groupEnd, ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt,
+                     OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend,
+                     RobustScratch<ValueType, int>& robustScratch) const {
+        for (auto groupIndex : indexRange<Backward>(groupBegin, groupEnd)) {
+            STORM_LOG_ASSERT(matrixColumnIt != getColumns<ColumnType>().end(), "VI Operator in invalid state.");
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+                backend.firstRow(applyRow<ColumnType, RobustDirection, Asynchronous>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex, groupIndex,
+                                                                                     robustScratch),
+                                 groupIndex, groupIndex);
             } else {
                 IndexType rowIndex = (*rowGroupIndices)[groupIndex];
                 if constexpr (SkipIgnoredRows) {
-                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                    rowIndex += skipMultipleIgnoredRows<ColumnType>(matrixColumnIt, matrixValueIt);
                 }
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
-                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                backend.firstRow(applyRow<ColumnType, RobustDirection, Asynchronous>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, groupIndex,
+                                                                                     robustScratch),
+                                 groupIndex, rowIndex);
+                while (*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>) {
                     ++rowIndex;
-                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                    if (!SkipIgnoredRows || !skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+                        backend.nextRow(applyRow<ColumnType, RobustDirection, Asynchronous>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex,
+                                                                                            groupIndex, robustScratch),
+                                        groupIndex, rowIndex);
                     }
                 }
             }
@@ -196,14 +434,105 @@ class ValueIterationOperator {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
             if (backend.abort()) {
-                return backend.converged();
+                return false;
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        return true;
+    }
+
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Parallel variant of `apply` that processes the chunks concurrently.
+     */
+    template<typename ColumnType, typename ValueIteratorType, typename OperandType, typename OffsetType, typename BackendType, bool Backward,
+             bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        // For in-place applications, chunks would read values that are concurrently written by other chunks. We avoid this by reading from a copy,
+        // unless the backend explicitly asks for asynchronous updates.
+        constexpr bool AsynchronousSupported = std::is_floating_point_v<SolutionType> && SupportsAsynchronousApply<BackendType>::value;
+        bool asynchronous = false;
+        if constexpr (AsynchronousSupported) {
+            asynchronous = &operandIn == &operandOut && backend.isAsynchronous();
+        }
+        std::optional<OperandType> operandInCopy;
+        if (&operandIn == &operandOut && !asynchronous) {
+            operandInCopy.emplace(operandIn);
+        }
+        OperandType const& input = operandInCopy.has_value() ? *operandInCopy : operandIn;
+
+        bool const placeOperands = numaAware && registerNumaOperand(operandOut);
+
+        backend.startNewIteration();
+        std::vector<BackendType> chunkBackends(applyChunks.size(), backend);
+        auto processChunks = [&](tbb::blocked_range<uint64_t> const& range) {
+            RobustScratch<ValueType, int> robustScratch;
+            for (auto chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                auto const& chunk = applyChunks[chunkIndex];
+                if (placeOperands) {
+                    moveOperandToCurrentNode(operandOut, chunk.groupBegin, chunk.groupEnd);
+                }
+                auto matrixColumnIt = getColumns<ColumnType>().cbegin() + chunk.matrixColumnOffset;
+                auto matrixValueIt = getValues<ValueIteratorType>() + chunk.matrixValueOffset;
+                if constexpr (AsynchronousSupported) {
+                    if (asynchronous) {
+                        applyGroups<ColumnType, ValueIteratorType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection, true>(
+                            chunk.groupBegin, chunk.groupEnd, matrixColumnIt, matrixValueIt, operandOut, input, offsets, chunkBackends[chunkIndex],
+                            robustScratch);
+                        continue;
+                    }
+                }
+                applyGroups<ColumnType, ValueIteratorType, OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    chunk.groupBegin, chunk.groupEnd, matrixColumnIt, matrixValueIt, operandOut, input, offsets, chunkBackends[chunkIndex], robustScratch);
+            }
+        };
+        if (numaAware) {
+            // A static partitioning assigns the chunks to the same threads in every application, which keeps the accesses local to the NUMA node.
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, applyChunks.size(), 1), processChunks, tbb::static_partitioner());
+        } else {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, applyChunks.size(), 1), processChunks);
+        }
+        for (auto const& chunkBackend : chunkBackends) {
+            backend.mergeChunk(chunkBackend);
+        }
+        if (backend.abort()) {
+            return backend.converged();
+        }
         backend.endOfIteration();
         return backend.converged();
     }
+    /*!
+     * Remembers the given operand for NUMA-aware placement.
+     * @return true iff the operand was not placed before, i.e., iff its entries still need to be moved to the nodes of the threads processing them.
+     */
+    template<typename OperandType>
+    bool registerNumaOperand(OperandType const& operand) const {
+        void const* data;
+        if constexpr (isPair<OperandType>::value) {
+            data = operand.first.data();
+        } else {
+            data = operand.data();
+        }
+        if (std::find(numaPlacedOperands.begin(), numaPlacedOperands.end(), data) != numaPlacedOperands.end()) {
+            return false;
+        }
+        // Solvers only use a few operands, so the oldest entry most likely belongs to a vector that no longer exists.
+        if (numaPlacedOperands.size() >= 8) {
+            numaPlacedOperands.erase(numaPlacedOperands.begin());
+        }
+        numaPlacedOperands.push_back(data);
+        return true;
+    }
+
+    template<typename OperandType>
+    void moveOperandToCurrentNode(OperandType const& operand, uint64_t groupBegin, uint64_t groupEnd) const {
+        if constexpr (isPair<OperandType>::value) {
+            storm::utility::numa::moveToCurrentNode(operand.first, groupBegin, groupEnd);
+            storm::utility::numa::moveToCurrentNode(operand.second, groupBegin, groupEnd);
+        } else {
+            storm::utility::numa::moveToCurrentNode(operand, groupBegin, groupEnd);
+        }
+    }
+#endif
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
 
@@ -247,75 +576,106 @@ class ValueIterationOperator {
 
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
+     * @param groupIndex the index of the row group of the row (needed to decode delta columns)
      */
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
+    template<typename ColumnType, OptimizationDirection RobustDirection, bool Asynchronous = false, typename ValueIteratorType, typename OperandType,
+             typename OffsetType>
+    auto applyRow(ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt, OperandType const& operand, OffsetType const& offsets,
+                  uint64_t offsetIndex, IndexType groupIndex, RobustScratch<ValueType, int>& robustScratch) const {
         if constexpr (std::is_same_v<ValueType, storm::Interval>) {
-            return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowRobust<ColumnType, RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex, groupIndex, robustScratch);
         } else {
-            return applyRowStandard(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
+            return applyRowStandard<ColumnType, Asynchronous>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex, groupIndex);
         }
     }
 
-    template<typename OperandType, typename OffsetType>
-    auto applyRowStandard(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                          OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    template<typename ColumnType, bool Asynchronous = false, typename ValueIteratorType, typename OperandType, typename OffsetType>
+    auto applyRowStandard(ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt, OperandType const& operand, OffsetType const& offsets,
+                          uint64_t offsetIndex, IndexType groupIndex) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         auto result{initializeRowRes(operand, offsets, offsetIndex)};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
-            if constexpr (isPair<OperandType>::value) {
-                result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
-                result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
+        ++matrixColumnIt;
+        if constexpr (std::is_floating_point_v<ValueType> && !isPair<OperandType>::value && !Asynchronous) {
+            // Process four entries at a time using independent accumulators, which breaks the dependency chain of the additions.
+            // Due to short-circuit evaluation, we only look at an entry if all previous entries belong to the current row, so we never read past the end.
+            constexpr ColumnType Ind = StartOfRowIndicator<ColumnType>;
+            ValueType acc0{0}, acc1{0}, acc2{0}, acc3{0};
+            while (matrixColumnIt[0] < Ind && matrixColumnIt[1] < Ind && matrixColumnIt[2] < Ind && matrixColumnIt[3] < Ind) {
+                acc0 += operand[getColumn(matrixColumnIt[0], groupIndex, matrixValueIt)] * matrixValueIt[0];
+                acc1 += operand[getColumn(matrixColumnIt[1], groupIndex, matrixValueIt + 1)] * matrixValueIt[1];
+                acc2 += operand[getColumn(matrixColumnIt[2], groupIndex, matrixValueIt + 2)] * matrixValueIt[2];
+                acc3 += operand[getColumn(matrixColumnIt[3], groupIndex, matrixValueIt + 3)] * matrixValueIt[3];
+                matrixColumnIt += 4;
+                matrixValueIt += 4;
+            }
+            result += (acc0 + acc1) + (acc2 + acc3);
+        }
+        for (; *matrixColumnIt < StartOfRowIndicator<ColumnType>; ++matrixColumnIt, ++matrixValueIt) {
+            auto const column = getColumn(*matrixColumnIt, groupIndex, matrixValueIt);
+            if constexpr (Asynchronous) {
+                if constexpr (isPair<OperandType>::value) {
+                    result.first += loadAsynchronously(operand.first[column]) * (*matrixValueIt);
+                    result.second += loadAsynchronously(operand.second[column]) * (*matrixValueIt);
+                } else {
+                    result += loadAsynchronously(operand[column]) * (*matrixValueIt);
+                }
+            } else if constexpr (isPair<OperandType>::value) {
+                result.first += operand.first[column] * (*matrixValueIt);
+                result.second += operand.second[column] * (*matrixValueIt);
             } else {
-                result += operand[*matrixColumnIt] * (*matrixValueIt);
+                result += operand[column] * (*matrixValueIt);
             }
         }
         return result;
     }
 
-    // Aux function for applyRowRobust
-    template<OptimizationDirection RobustDirection>
-    struct AuxCompare {
-        bool operator()(const std::pair<SolutionType, SolutionType>& a, const std::pair<SolutionType, SolutionType>& b) const {
-            if constexpr (RobustDirection == OptimizationDirection::Maximize) {
-                return a.first > b.first;
-            } else {
-                return a.first < b.first;
-            }
-        }
-    };
+    /*!
+     * Reads an operand value that might be concurrently written by another chunk (see `apply`). No ordering is imposed.
+     */
+    static SolutionType loadAsynchronously(SolutionType const& value) {
+        return std::atomic_ref<SolutionType>(const_cast<SolutionType&>(value)).load(std::memory_order_relaxed);
+    }
 
-    template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRowRobust(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                        OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+    /*!
+     * Computes the result for a single row of an interval model, i.e., distributes the probability mass that exceeds the lower bounds to the best
+     * (w.r.t. RobustDirection) successors first. The order of the successors from the previous application is stored in the applyCache. Near
+     * convergence, it rarely changes, so an insertion sort repairs it in almost linear time.
+     */
+    template<typename ColumnType, OptimizationDirection RobustDirection, typename ValueIteratorType, typename OperandType, typename OffsetType>
+    auto applyRowRobust(ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt, OperandType const& operand, OffsetType const& offsets,
+                        uint64_t offsetIndex, IndexType groupIndex, RobustScratch<ValueType, int>& robustScratch) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "VI Operator in invalid state.");
         auto result{robustInitializeRowRes<RobustDirection>(operand, offsets, offsetIndex)};
-        AuxCompare<RobustDirection> compare;
-        applyCache.robustOrder.clear();
+        auto& rowEntries = robustScratch.rowEntries;
+        rowEntries.clear();
+        auto const orderBegin = applyCache.robustOrder.begin() + std::distance(getValues<ValueIteratorType>(), matrixValueIt);
+        uint64_t numberOfUncertainEntries{0};
 
         SolutionType remainingValue{storm::utility::one<SolutionType>()};
-        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator<ColumnType>; ++matrixColumnIt, ++matrixValueIt) {
             auto const lower = matrixValueIt->lower();
             if constexpr (isPair<OperandType>::value) {
                 STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Value Iteration is not implemented with pairs and interval-models.");
                 // Notice the unclear semantics here in terms of how to order things.
             } else {
-                result += operand[*matrixColumnIt] * lower;
+                auto const column = getColumn(*matrixColumnIt, groupIndex, matrixValueIt);
+                result += operand[column] * lower;
+                auto const diameter = matrixValueIt->upper() - lower;
+                rowEntries.emplace_back(operand[column], diameter);
+                if (!storm::utility::isZero(diameter)) {
+                    ++numberOfUncertainEntries;
+                }
             }
             remainingValue -= lower;
-            auto const diameter = matrixValueIt->upper() - lower;
-            if (!storm::utility::isZero(diameter)) {
-                applyCache.robustOrder.emplace_back(operand[*matrixColumnIt], diameter);
-            }
         }
         if (storm::utility::isZero(remainingValue) || storm::utility::isOne(remainingValue)) {
             return result;
         }
 
-        std::sort(applyCache.robustOrder.begin(), applyCache.robustOrder.end(), compare);
-
-        for (auto const& pair : applyCache.robustOrder) {
+        auto const orderEnd = orderBegin + numberOfUncertainEntries;
+        sortRobustOrder<RobustDirection>(orderBegin, orderEnd, rowEntries);
+        for (auto entryIt = orderBegin; entryIt != orderEnd; ++entryIt) {
+            auto const& pair = rowEntries[*entryIt];
             auto availableMass = std::min(pair.second, remainingValue);
             result += availableMass * pair.first;
             remainingValue -= availableMass;
@@ -327,6 +687,35 @@ class ValueIterationOperator {
         return result;
     }
 
+    /*!
+     * Sorts the given (local) entry indices by the operand values of the entries, the best successor (w.r.t. RobustDirection) first.
+     * Uses an insertion sort as the order is usually almost unchanged since the last application, but falls back to a regular sort if it changed a lot.
+     */
+    template<OptimizationDirection RobustDirection, typename OrderIterator>
+    void sortRobustOrder(OrderIterator orderBegin, OrderIterator orderEnd, std::vector<std::pair<SolutionType, SolutionType>> const& rowEntries) const {
+        auto const isBetter = [&rowEntries](auto const& lhs, auto const& rhs) {
+            if constexpr (RobustDirection == OptimizationDirection::Maximize) {
+                return rowEntries[lhs].first > rowEntries[rhs].first;
+            } else {
+                return rowEntries[lhs].first < rowEntries[rhs].first;
+            }
+        };
+        uint64_t remainingMoves = 4 * static_cast<uint64_t>(std::distance(orderBegin, orderEnd));
+        for (auto it = orderBegin; it != orderEnd; ++it) {
+            auto const entry = *it;
+            auto insertIt = it;
+            for (; insertIt != orderBegin && isBetter(entry, *std::prev(insertIt)); --insertIt) {
+                if (remainingMoves-- == 0) {
+                    *insertIt = entry;
+                    std::sort(orderBegin, orderEnd, isBetter);
+                    return;
+                }
+                *insertIt = *std::prev(insertIt);
+            }
+            *insertIt = entry;
+        }
+    }
+
     // Auxiliary helpers used for metaprogramming
     template<bool Backward>
     auto indexRange(IndexType start, IndexType end) const {
@@ -353,38 +742,238 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename BackendType, typename = void>
+    struct SupportsParallelApply : std::false_type {};
+
+    template<typename BackendType>
+    struct SupportsParallelApply<BackendType, std::void_t<decltype(std::declval<BackendType&>().mergeChunk(std::declval<BackendType const&>()))>>
+        : std::is_copy_constructible<BackendType> {};
+
+    template<typename BackendType, typename = void>
+    struct SupportsAsynchronousApply : std::false_type {};
+
+    template<typename BackendType>
+    struct SupportsAsynchronousApply<BackendType, std::void_t<decltype(std::declval<BackendType const&>().isAsynchronous())>> : std::true_type {};
+
+    /*!
+     * Splits the row groups into chunks for parallel application
+     */
+    void computeApplyChunks();
+
+    template<typename ColumnType>
+    void computeApplyChunks();
+
+    /*!
+     * Moves the matrix data of each chunk to the NUMA node of the thread that processes the chunk
+     */
+    void placeApplyChunks();
+
+    /*!
+     * Internal variant of setMatrix for the given matrix (or submatrix view) with the given number of entries of its largest row
+     */
+    template<bool Backward, typename MatrixType>
+    void setMatrixInternal(MatrixType const& matrix, uint64_t maxRowSize);
+
+    /*!
+     * Internal variant of setMatrix for the given type of column entries
+     */
+    template<typename ColumnType, bool Backward, typename MatrixType>
+    void setMatrixColumnsAndValues(MatrixType const& matrix);
+
+    /*!
+     * Replaces the matrix values by indices into a dictionary of the distinct values, if there are few enough of them.
+     */
+    void setValueDictionary();
+
+    /*!
+     * @return the number of entries of the given matrix whose column can not be stored as DeltaColumnType (see ColumnEncoding::Delta)
+     */
+    template<typename MatrixType>
+    uint64_t getNumberOfEscapedDeltaColumns(MatrixType const& matrix) const;
+
+    /*!
+     * @return the representation of the given column of an entry in the given row group, where the entry is the next one added to the matrix values
+     */
+    template<typename ColumnType>
+    ColumnType encodeColumn(IndexType column, IndexType groupIndex);
+
+    /*!
+     * Initializes the order of the successors that is cached for robust value iteration
+     */
+    template<typename ColumnType>
+    void initializeRobustOrder();
+
     /*!
      * Internal variant of setIgnoredRows
      */
-    template<bool Backward = true>
+    template<typename ColumnType, bool Backward>
     void setIgnoredRows(bool useLocalRowIndices, std::function<bool(IndexType, IndexType)> const& ignore);
 
+    /*!
+     * Internal variant of unsetIgnoredRows
+     */
+    template<typename ColumnType>
+    void unsetIgnoredRows();
+
     /*!
      * Moves the given iterator to the end of the current row
      */
-    void moveToEndOfRow(std::vector<IndexType>::iterator& matrixColumnIt) const;
+    template<typename ColumnType>
+    void moveToEndOfRow(typename storm::utility::AlignedVector<ColumnType>::iterator& matrixColumnIt) const;
 
     /*!
      * Skips the current row, if it is ignored. Advances the iterators accordingly
      */
-    bool skipIgnoredRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType, typename ValueIteratorType>
+    bool skipIgnoredRow(ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt) const {
+        if (IndexType entriesToSkip = (*matrixColumnIt & SkipNumEntriesMask<ColumnType>)) {
+            matrixColumnIt += entriesToSkip;
+            matrixValueIt += entriesToSkip - 1;
+            return true;
+        }
+        return false;
+    }
 
     /*!
      * Skips all ignored rows, advancing the iterators to the first successor row that is not ignored
      */
-    uint64_t skipMultipleIgnoredRows(std::vector<IndexType>::const_iterator& matrixColumnIt,
-                                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const;
+    template<typename ColumnType, typename ValueIteratorType>
+    uint64_t skipMultipleIgnoredRows(ColumnIterator<ColumnType>& matrixColumnIt, ValueIteratorType& matrixValueIt) const {
+        IndexType result{0ull};
+        while (skipIgnoredRow<ColumnType>(matrixColumnIt, matrixValueIt)) {
+            ++result;
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator<ColumnType>, "Undexpected state of VI operator");
+            // We (currently) don't use this past the end of a row group, so we may have this additional sanity check:
+            STORM_LOG_ASSERT(*matrixColumnIt < StartOfRowGroupIndicator<ColumnType>, "Undexpected state of VI operator");
+        }
+        return result;
+    }
 
     /*!
-     * The non-zero matrix entries.
+     * @return the row indicators and columns of the matrix entries for the given type of column entries
      */
-    std::vector<ValueType> matrixValues;
+    template<typename ColumnType>
+    storm::utility::AlignedVector<ColumnType> const& getColumns() const {
+        if constexpr (std::is_same_v<ColumnType, DeltaColumnType>) {
+            return deltaMatrixColumns;
+        } else if constexpr (std::is_same_v<ColumnType, CompactColumnType>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
+
+    template<typename ColumnType>
+    storm::utility::AlignedVector<ColumnType>& getColumns() {
+        if constexpr (std::is_same_v<ColumnType, DeltaColumnType>) {
+            return deltaMatrixColumns;
+        } else if constexpr (std::is_same_v<ColumnType, CompactColumnType>) {
+            return compactMatrixColumns;
+        } else {
+            return matrixColumns;
+        }
+    }
+
+    /*!
+     * @return the column of an entry given its stored column, the index of its row group, and an iterator to its value
+     */
+    template<typename ColumnType, typename ValueIteratorType>
+    IndexType getColumn(ColumnType const& storedColumn, IndexType groupIndex, ValueIteratorType const& matrixValueIt) const {
+        if constexpr (std::is_same_v<ColumnType, DeltaColumnType>) {
+            if (storedColumn == DeltaEscape) {
+                return getEscapedColumn(static_cast<uint64_t>(matrixValueIt - getValues<ValueIteratorType>()));
+            }
+            return groupIndex + storedColumn - DeltaBias;
+        } else {
+            return storedColumn;
+        }
+    }
+
+    /*!
+     * @return the column of the entry with the given index, whose column is stored in `escapedColumns`
+     */
+    IndexType getEscapedColumn(uint64_t entryIndex) const;
+
+    /*!
+     * @return an iterator to the first matrix value for the given way to access the values
+     */
+    template<typename ValueIteratorType>
+    ValueIteratorType getValues() const {
+        if constexpr (std::is_same_v<ValueIteratorType, DictionaryValueIterator<ByteValueIndexType>>) {
+            return ValueIteratorType(byteValueIndices.data(), valueDictionary.data());
+        } else if constexpr (std::is_same_v<ValueIteratorType, DictionaryValueIterator<ShortValueIndexType>>) {
+            return ValueIteratorType(shortValueIndices.data(), valueDictionary.data());
+        } else {
+            return matrixValues.cbegin();
+        }
+    }
+
+    /*!
+     * @return the number of (non-zero) matrix entries
+     */
+    uint64_t getNumberOfEntries() const {
+        switch (valueEncoding) {
+            case ValueEncoding::ByteDictionary:
+                return byteValueIndices.size();
+            case ValueEncoding::ShortDictionary:
+                return shortValueIndices.size();
+            default:
+                return matrixValues.size();
+        }
+    }
+
+    /*!
+     * The non-zero matrix entries. Only used if valueEncoding is Plain.
+     */
+    storm::utility::AlignedVector<ValueType> matrixValues;
+
+    /*!
+     * The distinct values of the non-zero matrix entries. Only used if valueEncoding is not Plain.
+     */
+    std::vector<ValueType> valueDictionary;
+
+    /*!
+     * For each non-zero matrix entry the position of its value in the valueDictionary. Only the vector matching the valueEncoding is used.
+     */
+    storm::utility::AlignedVector<ByteValueIndexType> byteValueIndices;
+    storm::utility::AlignedVector<ShortValueIndexType> shortValueIndices;
+
+    /*!
+     * How the values of the matrix entries are stored. Dictionaries are only used for floating point values, where they reduce the memory traffic per
+     * entry from 8 (double) to 1 or 2 bytes.
+     */
+    ValueEncoding valueEncoding{ValueEncoding::Plain};
 
     /*!
      * Row indicators and columns of the matrix entries. Has size #non-zero matrix entries + #rows + 1
      * A row indicator is an index >= 1000...000. Before and after each row there is a row indicator.
+     * Only used if columnEncoding is Plain.
+     */
+    storm::utility::AlignedVector<IndexType> matrixColumns;
+
+    /*!
+     * Same as matrixColumns but with 32 bit entries. Only used if columnEncoding is Compact.
      */
-    std::vector<IndexType> matrixColumns;
+    storm::utility::AlignedVector<CompactColumnType> compactMatrixColumns;
+
+    /*!
+     * Same as matrixColumns but with 16 bit entries that store the offsets of the columns to their row groups. Only used if columnEncoding is Delta.
+     */
+    storm::utility::AlignedVector<DeltaColumnType> deltaMatrixColumns;
+
+    /*!
+     * The entry indices and columns of the entries whose column is replaced by DeltaEscape, sorted by the entry index. Only used if columnEncoding is
+     * Delta.
+     */
+    std::vector<std::pair<uint64_t, IndexType>> escapedColumns;
+
+    /*!
+     * How the columns of the matrix entries are stored. The compact representation is used iff all columns and row sizes fit into it, which reduces
+     * the memory consumption of the operator from 16 to 12 bytes per entry (for double values). If the columns are mostly close to the index of
+     * their row group (e.g. for models explored in BFS order) and the rows are not too large, the delta encoding needs only 2 bytes per column.
+     * Together with a value dictionary, this gets us to about 3 bytes per entry.
+     */
+    ColumnEncoding columnEncoding{ColumnEncoding::Plain};
 
     /*!
      * Row group indices as in the sparse matrix (even if the matrix is set in backwards order, this vector will not be reversed)
@@ -401,6 +990,36 @@ class ValueIterationOperator {
      */
     bool hasSkippedRows{false};
 
+    /*!
+     * A contiguous range of row groups that can be processed independently of the other chunks
+     */
+    struct ApplyChunk {
+        IndexType groupBegin;         /// the first row group index of this chunk
+        IndexType groupEnd;           /// one past the last row group index of this chunk
+        uint64_t matrixColumnOffset;  /// position of the first processed row (group) indicator of this chunk in the columns
+        uint64_t matrixValueOffset;   /// position of the first processed value of this chunk (in `matrixValues` or the value indices)
+    };
+
+    /*!
+     * The chunks for parallel application. Empty if the operator is applied sequentially.
+     */
+    std::vector<ApplyChunk> applyChunks;
+
+    /*!
+     * The number of threads used for parallel application (0 if parallel application is disabled)
+     */
+    uint64_t numberOfApplyThreads{0};
+
+    /*!
+     * True iff the chunks are placed on (and statically assigned to the threads of) the NUMA nodes
+     */
+    bool numaAware{false};
+
+    /*!
+     * The (data pointers of) operands whose entries have already been moved to the NUMA nodes of the threads processing them
+     */
+    mutable std::vector<void const*> numaPlacedOperands;
+
     /*!
      * Storage for the auxiliary vector
      */
@@ -418,7 +1037,9 @@ class ValueIterationOperator {
 
     template<typename Dummy>
     struct ApplyCache<storm::Interval, Dummy> {
-        mutable std::vector<std::pair<SolutionType, SolutionType>> robustOrder;
+        /// For each row, the indices (local to the row) of the entries with a non-trivial interval, ordered as in the previous application.
+        /// The indices for a row are stored at the positions of the row's entries, so rows processed concurrently never share data.
+        mutable std::vector<uint32_t> robustOrder;
     };
 
     /*!
@@ -429,17 +1050,32 @@ class ValueIterationOperator {
     /*!
      * Bitmask that indicates the start of a row in the 'matrixColumns' vector
      */
-    IndexType const StartOfRowIndicator = 1ull << 63;  // 10000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowIndicator = ColumnType(1) << (std::numeric_limits<ColumnType>::digits - 1);  // 10000..0
 
     /*!
      * Bitmask that indicates the start of a row group in the 'matrixColumns' vector
      */
-    IndexType const StartOfRowGroupIndicator = StartOfRowIndicator + (1ull << 62);  // 11000..0
+    template<typename ColumnType>
+    static constexpr ColumnType StartOfRowGroupIndicator =
+        StartOfRowIndicator<ColumnType> + (ColumnType(1) << (std::numeric_limits<ColumnType>::digits - 2));  // 11000..0
 
     /*!
      * Ignored rows are encoded by adding the number of skipped entries to the row indicator. This Bitmask helps to get the number of skipped entries
      */
-    IndexType const SkipNumEntriesMask = ~StartOfRowGroupIndicator;  // 00111..1
+    template<typename ColumnType>
+    static constexpr ColumnType SkipNumEntriesMask = ~StartOfRowGroupIndicator<ColumnType>;  // 00111..1
+
+    /*!
+     * Offset that is added to the difference of a column and its row group in the delta encoding, i.e., differences in [-DeltaBias, DeltaEscape -
+     * DeltaBias) can be stored
+     */
+    static constexpr DeltaColumnType DeltaBias = DeltaColumnType(1) << 14;
+
+    /*!
+     * The largest value below the row indicators, which indicates that the column is stored in `escapedColumns`
+     */
+    static constexpr DeltaColumnType DeltaEscape = StartOfRowIndicator<DeltaColumnType> - 1;
 };
 
 }  // namespace solver::helper
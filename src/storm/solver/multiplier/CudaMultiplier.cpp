@@ -0,0 +1,89 @@
+#include "storm/solver/multiplier/CudaMultiplier.h"
+
+#ifdef STORM_HAVE_CUDA
+
+#include <algorithm>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/solver/multiplier/cuda/DeviceMultiplication.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+// Repeated multiplications are split into batches. The operand is only transferred between the batches, which allows to report the progress and to
+// react to termination requests without transferring the operand in every iteration.
+uint64_t const MultiplicationsPerBatch = 100;
+}  // namespace
+
+CudaMultiplier::CudaMultiplier(storm::storage::SparseMatrix<double> const& matrix) : NativeMultiplier<double>(matrix) {
+    STORM_LOG_THROW(cuda::DeviceMultiplication::isDeviceAvailable(), storm::exceptions::NotSupportedException,
+                    "The CUDA multiplier was selected, but no CUDA capable device is available.");
+    std::vector<uint64_t> rowIndications;
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    std::vector<uint64_t> columns;
+    std::vector<double> values;
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(entry.getColumn());
+            values.push_back(entry.getValue());
+        }
+        rowIndications.push_back(columns.size());
+    }
+    deviceMultiplication = std::make_unique<cuda::DeviceMultiplication>(rowIndications, columns, values, matrix.getColumnCount());
+    STORM_LOG_INFO("Transferred matrix with " << matrix.getRowCount() << " rows and " << matrix.getEntryCount() << " entries to the CUDA device.");
+}
+
+CudaMultiplier::~CudaMultiplier() = default;
+
+void CudaMultiplier::multiply(Environment const&, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) const {
+    deviceMultiplication->multiply(x, b, result);
+}
+
+void CudaMultiplier::multiplyAndReduce(Environment const&, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                       std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result,
+                                       std::vector<uint_fast64_t>* choices) const {
+    deviceMultiplication->multiplyAndReduce(storm::solver::minimize(dir), rowGroupIndices, x, b, result, choices);
+}
+
+void CudaMultiplier::repeatedMultiply(Environment const&, std::vector<double>& x, std::vector<double> const* b, uint64_t n) const {
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    for (uint64_t i = 0; i < n; i += MultiplicationsPerBatch) {
+        progress.updateProgress(i);
+        deviceMultiplication->multiply(x, b, x, std::min(MultiplicationsPerBatch, n - i));
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << std::min(i + MultiplicationsPerBatch, n) << " of " << n << " multiplications.");
+            break;
+        }
+    }
+}
+
+void CudaMultiplier::repeatedMultiplyAndReduce(Environment const&, OptimizationDirection const& dir, std::vector<double>& x, std::vector<double> const* b,
+                                               uint64_t n) const {
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    for (uint64_t i = 0; i < n; i += MultiplicationsPerBatch) {
+        progress.updateProgress(i);
+        deviceMultiplication->multiplyAndReduce(storm::solver::minimize(dir), this->matrix.getRowGroupIndices(), x, b, x, nullptr,
+                                                std::min(MultiplicationsPerBatch, n - i));
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << std::min(i + MultiplicationsPerBatch, n) << " of " << n << " multiplications.");
+            break;
+        }
+    }
+}
+
+}  // namespace solver
+}  // namespace storm
+
+#endif
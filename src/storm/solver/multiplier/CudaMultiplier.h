@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include "storm-config.h"
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+
+namespace storm {
+namespace solver {
+
+namespace cuda {
+class DeviceMultiplication;
+}
+
+/*!
+ * A multiplier that performs (repeated) matrix-vector multiplications on a CUDA device. The matrix is transferred to the device once upon
+ * construction. Gauss-Seidel style multiplications and multiplications of single rows are inherently sequential and are therefore performed on the
+ * host, just as for the native multiplier.
+ *
+ * This multiplier is only available for double precision and if Storm is built with CUDA support (STORM_HAVE_CUDA).
+ */
+class CudaMultiplier : public NativeMultiplier<double> {
+   public:
+    CudaMultiplier(storm::storage::SparseMatrix<double> const& matrix);
+    virtual ~CudaMultiplier();
+
+    virtual void multiply(Environment const& env, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void repeatedMultiply(Environment const& env, std::vector<double>& x, std::vector<double> const* b, uint64_t n) const override;
+    virtual void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<double>& x, std::vector<double> const* b,
+                                           uint64_t n) const override;
+
+   private:
+    std::unique_ptr<cuda::DeviceMultiplication> deviceMultiplication;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -11,8 +11,10 @@
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/multiplier/CudaMultiplier.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
@@ -107,6 +109,16 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Cuda:
+#ifdef STORM_HAVE_CUDA
+            if constexpr (std::is_same_v<ValueType, double>) {
+                return std::make_unique<CudaMultiplier>(matrix);
+            }
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The CUDA multiplier only supports double precision.");
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                            "Storm was built without CUDA support. Configure Storm with STORM_USE_CUDA to use the CUDA multiplier.");
+#endif
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
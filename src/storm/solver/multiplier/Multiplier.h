@@ -104,7 +104,7 @@ class Multiplier {
      * to the number of rows of A.
      * @param n The number of times to perform the multiplication.
      */
-    void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
+    virtual void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
 
     /*!
      * Performs repeated matrix-vector multiplication x' = A*x + b and then minimizes/maximizes over the row groups
@@ -119,8 +119,8 @@ class Multiplier {
      * to the number of rows of A.
      * @param n The number of times to perform the multiplication.
      */
-    void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
-                                   uint64_t n) const;
+    virtual void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                           uint64_t n) const;
 
     /*!
      * Multiplies the row with the given index with x and adds the result to the provided value
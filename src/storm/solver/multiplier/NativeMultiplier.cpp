@@ -1,5 +1,8 @@
 #include "NativeMultiplier.h"
 
+#include <limits>
+#include <type_traits>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
@@ -10,6 +13,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -20,6 +24,35 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+void NativeMultiplier<ValueType>::clearCache() const {
+    compactMatrix.reset();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+typename NativeMultiplier<ValueType>::CompactMatrix const* NativeMultiplier<ValueType>::getCompactMatrix() const {
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        if (!compactMatrix && this->matrix.getColumnCount() <= std::numeric_limits<uint32_t>::max()) {
+            compactMatrix = std::make_unique<CompactMatrix>();
+            compactMatrix->rowIndications.reserve(this->matrix.getRowCount() + 1);
+            compactMatrix->columns.reserve(this->matrix.getEntryCount());
+            compactMatrix->values.reserve(this->matrix.getEntryCount());
+            compactMatrix->rowIndications.push_back(0);
+            for (uint64_t row = 0; row < this->matrix.getRowCount(); ++row) {
+                for (auto const& entry : this->matrix.getRow(row)) {
+                    compactMatrix->columns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    compactMatrix->values.push_back(entry.getValue());
+                }
+                compactMatrix->rowIndications.push_back(compactMatrix->values.size());
+            }
+        }
+        return compactMatrix.get();
+    } else {
+        return nullptr;
+    }
+}
+
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
     return false;
@@ -93,30 +126,131 @@ void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
-    for (auto const& entry : this->matrix.getRow(rowIndex)) {
-        value += entry.getValue() * x[entry.getColumn()];
+    auto row = this->matrix.getRow(rowIndex);
+    auto entryIt = row.begin();
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        // Use independent accumulators to break the dependency chain of the additions.
+        ValueType acc0{0}, acc1{0}, acc2{0}, acc3{0};
+        for (auto const entryEnd4 = entryIt + (row.getNumberOfEntries() / 4) * 4; entryIt != entryEnd4; entryIt += 4) {
+            acc0 += entryIt[0].getValue() * x[entryIt[0].getColumn()];
+            acc1 += entryIt[1].getValue() * x[entryIt[1].getColumn()];
+            acc2 += entryIt[2].getValue() * x[entryIt[2].getColumn()];
+            acc3 += entryIt[3].getValue() * x[entryIt[3].getColumn()];
+        }
+        value += (acc0 + acc1) + (acc2 + acc3);
+    }
+    for (; entryIt != row.end(); ++entryIt) {
+        value += entryIt->getValue() * x[entryIt->getColumn()];
     }
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                                                ValueType& val2) const {
-    for (auto const& entry : this->matrix.getRow(rowIndex)) {
-        val1 += entry.getValue() * x1[entry.getColumn()];
-        val2 += entry.getValue() * x2[entry.getColumn()];
+    auto row = this->matrix.getRow(rowIndex);
+    auto entryIt = row.begin();
+    if constexpr (std::is_floating_point_v<ValueType>) {
+        // Use independent accumulators for both vectors to break the dependency chain of the additions.
+        ValueType acc10{0}, acc11{0}, acc20{0}, acc21{0};
+        for (auto const entryEnd2 = entryIt + (row.getNumberOfEntries() / 2) * 2; entryIt != entryEnd2; entryIt += 2) {
+            acc10 += entryIt[0].getValue() * x1[entryIt[0].getColumn()];
+            acc20 += entryIt[0].getValue() * x2[entryIt[0].getColumn()];
+            acc11 += entryIt[1].getValue() * x1[entryIt[1].getColumn()];
+            acc21 += entryIt[1].getValue() * x2[entryIt[1].getColumn()];
+        }
+        val1 += acc10 + acc11;
+        val2 += acc20 + acc21;
+    }
+    for (; entryIt != row.end(); ++entryIt) {
+        val1 += entryIt->getValue() * x1[entryIt->getColumn()];
+        val2 += entryIt->getValue() * x2[entryIt->getColumn()];
     }
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-    this->matrix.multiplyWithVector(x, result, b);
+    if (auto const* compact = getCompactMatrix()) {
+        multAddCompact(*compact, x, b, result);
+    } else {
+        this->matrix.multiplyWithVector(x, result, b);
+    }
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                 std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                 std::vector<uint64_t>* choices) const {
-    this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    if (auto const* compact = getCompactMatrix()) {
+        if (dir == OptimizationDirection::Minimize) {
+            multAddReduceCompact<storm::utility::ElementLess<ValueType>>(*compact, rowGroupIndices, x, b, result, choices);
+        } else {
+            multAddReduceCompact<storm::utility::ElementGreater<ValueType>>(*compact, rowGroupIndices, x, b, result, choices);
+        }
+    } else {
+        this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices);
+    }
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddCompact(CompactMatrix const& compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                 std::vector<ValueType>& result) const {
+    STORM_LOG_ASSERT(&x != &result, "Vectors are aliased.");
+    STORM_LOG_ASSERT(result.size() + 1 == compact.rowIndications.size(), "Dimension mismatch.");
+    auto const* columns = compact.columns.data();
+    auto const* values = compact.values.data();
+    for (uint64_t row = 0; row < result.size(); ++row) {
+        ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        for (uint64_t entry = compact.rowIndications[row], entryEnd = compact.rowIndications[row + 1]; entry < entryEnd; ++entry) {
+            newValue += values[entry] * x[columns[entry]];
+        }
+        result[row] = newValue;
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+void NativeMultiplier<ValueType>::multAddReduceCompact(CompactMatrix const& compact, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                       std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&x != &result, "Vectors are aliased.");
+    STORM_LOG_ASSERT(result.size() + 1 <= rowGroupIndices.size(), "Dimension mismatch.");
+    Compare compare;
+    auto const* columns = compact.columns.data();
+    auto const* values = compact.values.data();
+    auto multiplyRow = [&](uint64_t row) {
+        ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        for (uint64_t entry = compact.rowIndications[row], entryEnd = compact.rowIndications[row + 1]; entry < entryEnd; ++entry) {
+            newValue += values[entry] * x[columns[entry]];
+        }
+        return newValue;
+    };
+
+    for (uint64_t group = 0; group < result.size(); ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+        // As in SparseMatrix::multiplyAndReduce, empty row groups leave the result untouched.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+        ValueType currentValue = multiplyRow(groupStart);
+        // Only change the choice if the new choice is strictly better than the old one.
+        uint64_t selectedChoice = 0;
+        ValueType oldSelectedChoiceValue = currentValue;
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRow(row);
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
 }
 
 template<typename ValueType>
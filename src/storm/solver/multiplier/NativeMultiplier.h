@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
@@ -30,8 +34,25 @@ class NativeMultiplier : public Multiplier<ValueType> {
     virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
     virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                               ValueType& val2) const override;
+    virtual void clearCache() const override;
 
    private:
+    /*!
+     * A copy of the matrix in a structure-of-arrays layout whose column indices are stored with 32 bits.
+     * This reduces the memory traffic per entry from 16 to 12 bytes for doubles.
+     */
+    struct CompactMatrix {
+        std::vector<uint64_t> rowIndications;
+        std::vector<uint32_t> columns;
+        std::vector<ValueType> values;
+    };
+
+    /*!
+     * Retrieves the compact copy of the matrix, which is created upon first use.
+     * @return nullptr if the value type is not a floating point type or if the column indices do not fit into 32 bits.
+     */
+    CompactMatrix const* getCompactMatrix() const;
+
     bool parallelize(Environment const& env) const;
 
     void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
@@ -42,6 +63,14 @@ class NativeMultiplier : public Multiplier<ValueType> {
     void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
     void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                                std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    void multAddCompact(CompactMatrix const& compact, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+    template<typename Compare>
+    void multAddReduceCompact(CompactMatrix const& compact, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                              std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    mutable std::unique_ptr<CompactMatrix> compactMatrix;
 };
 
 }  // namespace solver
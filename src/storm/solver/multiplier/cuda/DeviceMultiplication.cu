@@ -0,0 +1,300 @@
+#include "storm/solver/multiplier/cuda/DeviceMultiplication.h"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+namespace solver {
+namespace cuda {
+
+namespace {
+uint64_t const ThreadsPerBlock = 256;
+
+void checkCudaError(cudaError_t error, char const* operation) {
+    if (error != cudaSuccess) {
+        throw storm::exceptions::UnexpectedException() << "CUDA error while " << operation << ": " << cudaGetErrorString(error) << ".";
+    }
+}
+
+uint64_t getNumberOfBlocks(uint64_t numberOfThreads) {
+    return (numberOfThreads + ThreadsPerBlock - 1) / ThreadsPerBlock;
+}
+
+/*!
+ * A buffer in device memory. The buffer is only reallocated if it has to grow.
+ */
+template<typename T>
+class DeviceVector {
+   public:
+    DeviceVector() = default;
+
+    ~DeviceVector() {
+        if (pointer) {
+            cudaFree(pointer);
+        }
+    }
+
+    DeviceVector(DeviceVector const&) = delete;
+    DeviceVector& operator=(DeviceVector const&) = delete;
+
+    void swap(DeviceVector& other) {
+        std::swap(pointer, other.pointer);
+        std::swap(size, other.size);
+        std::swap(capacity, other.capacity);
+    }
+
+    void resize(uint64_t newSize) {
+        if (newSize > capacity) {
+            if (pointer) {
+                checkCudaError(cudaFree(pointer), "freeing device memory");
+                pointer = nullptr;
+                capacity = 0;
+            }
+            checkCudaError(cudaMalloc(reinterpret_cast<void**>(&pointer), newSize * sizeof(T)), "allocating device memory");
+            capacity = newSize;
+        }
+        size = newSize;
+    }
+
+    void upload(std::vector<T> const& source) {
+        resize(source.size());
+        checkCudaError(cudaMemcpy(pointer, source.data(), source.size() * sizeof(T), cudaMemcpyHostToDevice), "copying data to the device");
+    }
+
+    void download(std::vector<T>& target) const {
+        target.resize(size);
+        checkCudaError(cudaMemcpy(target.data(), pointer, size * sizeof(T), cudaMemcpyDeviceToHost), "copying data from the device");
+    }
+
+    T* get() {
+        return pointer;
+    }
+
+    T const* get() const {
+        return pointer;
+    }
+
+   private:
+    T* pointer = nullptr;
+    uint64_t size = 0;
+    uint64_t capacity = 0;
+};
+
+template<typename ColumnType>
+__device__ double multiplyRow(uint64_t row, uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x,
+                              double const* b) {
+    double result = b ? b[row] : 0.0;
+    for (uint64_t entry = rowIndications[row], end = rowIndications[row + 1]; entry < end; ++entry) {
+        result += values[entry] * x[columns[entry]];
+    }
+    return result;
+}
+
+template<typename ColumnType>
+__global__ void multiplyKernel(uint64_t rowCount, uint64_t const* rowIndications, ColumnType const* columns, double const* values, double const* x,
+                               double const* b, double* result) {
+    uint64_t const row = blockIdx.x * static_cast<uint64_t>(blockDim.x) + threadIdx.x;
+    if (row < rowCount) {
+        result[row] = multiplyRow(row, rowIndications, columns, values, x, b);
+    }
+}
+
+template<typename ColumnType, bool Minimize>
+__global__ void multiplyAndReduceKernel(uint64_t rowGroupCount, uint64_t const* rowGroupIndices, uint64_t const* rowIndications, ColumnType const* columns,
+                                        double const* values, double const* x, double const* b, double* result, uint64_t* choices) {
+    uint64_t const group = blockIdx.x * static_cast<uint64_t>(blockDim.x) + threadIdx.x;
+    if (group >= rowGroupCount) {
+        return;
+    }
+    uint64_t const firstRow = rowGroupIndices[group];
+    uint64_t const endRow = rowGroupIndices[group + 1];
+    // As for the host multipliers, empty row groups leave the result untouched.
+    if (firstRow == endRow) {
+        return;
+    }
+
+    double bestValue = multiplyRow(firstRow, rowIndications, columns, values, x, b);
+    uint64_t bestChoice = 0;
+    uint64_t const oldChoice = choices ? choices[group] : 0;
+    double oldChoiceValue = bestValue;
+    for (uint64_t row = firstRow + 1; row < endRow; ++row) {
+        double const value = multiplyRow(row, rowIndications, columns, values, x, b);
+        if (row - firstRow == oldChoice) {
+            oldChoiceValue = value;
+        }
+        if (Minimize ? value < bestValue : value > bestValue) {
+            bestValue = value;
+            bestChoice = row - firstRow;
+        }
+    }
+    result[group] = bestValue;
+    // As for the host multipliers, the choice is only changed if the new choice is strictly better.
+    if (choices && (Minimize ? bestValue < oldChoiceValue : bestValue > oldChoiceValue)) {
+        choices[group] = bestChoice;
+    }
+}
+}  // namespace
+
+struct DeviceMultiplication::DeviceData {
+    uint64_t rowCount;
+    uint64_t columnCount;
+
+    // The matrix. If all columns fit into 32 bits, only the compact column indices are stored to save memory bandwidth.
+    DeviceVector<uint64_t> rowIndications;
+    DeviceVector<uint32_t> compactColumns;
+    DeviceVector<uint64_t> columns;
+    DeviceVector<double> values;
+
+    // Buffers that are reused by subsequent multiplications.
+    DeviceVector<double> operand;
+    DeviceVector<double> result;
+    DeviceVector<double> offsets;
+    DeviceVector<uint64_t> rowGroupIndices;
+    DeviceVector<uint64_t> choices;
+
+    // The row group indices that are currently stored on the device.
+    std::vector<uint64_t> uploadedRowGroupIndices;
+    bool uploadedRowGroupsContainEmptyGroup = false;
+
+    bool useCompactColumns() const {
+        return columnCount <= std::numeric_limits<uint32_t>::max();
+    }
+
+    template<typename Function>
+    void launch(uint64_t numberOfThreads, Function const& kernel) {
+        if (numberOfThreads > 0) {
+            kernel(getNumberOfBlocks(numberOfThreads), ThreadsPerBlock);
+            checkCudaError(cudaGetLastError(), "launching a kernel");
+        }
+    }
+};
+
+DeviceMultiplication::DeviceMultiplication(std::vector<uint64_t> const& rowIndications, std::vector<uint64_t> const& columns,
+                                           std::vector<double> const& values, uint64_t columnCount)
+    : data(std::make_unique<DeviceData>()) {
+    if (rowIndications.empty() || columns.size() != values.size() || rowIndications.back() != values.size()) {
+        throw storm::exceptions::InvalidArgumentException() << "Invalid CSR matrix.";
+    }
+    data->rowCount = rowIndications.size() - 1;
+    data->columnCount = columnCount;
+    data->rowIndications.upload(rowIndications);
+    if (data->useCompactColumns()) {
+        data->compactColumns.upload(std::vector<uint32_t>(columns.begin(), columns.end()));
+    } else {
+        data->columns.upload(columns);
+    }
+    data->values.upload(values);
+}
+
+DeviceMultiplication::~DeviceMultiplication() = default;
+
+void DeviceMultiplication::multiply(std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, uint64_t n) const {
+    if (x.size() != data->columnCount || (b && b->size() != data->rowCount) || (n > 1 && data->rowCount != data->columnCount)) {
+        throw storm::exceptions::InvalidArgumentException() << "Dimension mismatch in matrix-vector multiplication on the device.";
+    }
+    data->operand.upload(x);
+    double const* offsets = nullptr;
+    if (b) {
+        data->offsets.upload(*b);
+        offsets = data->offsets.get();
+    }
+    data->result.resize(data->rowCount);
+    for (uint64_t iteration = 0; iteration < n; ++iteration) {
+        if (iteration > 0) {
+            data->operand.swap(data->result);
+        }
+        data->launch(data->rowCount, [&](uint64_t blocks, uint64_t threads) {
+            if (data->useCompactColumns()) {
+                multiplyKernel<<<blocks, threads>>>(data->rowCount, data->rowIndications.get(), data->compactColumns.get(), data->values.get(),
+                                                    data->operand.get(), offsets, data->result.get());
+            } else {
+                multiplyKernel<<<blocks, threads>>>(data->rowCount, data->rowIndications.get(), data->columns.get(), data->values.get(), data->operand.get(),
+                                                    offsets, data->result.get());
+            }
+        });
+    }
+    data->result.download(result);
+}
+
+void DeviceMultiplication::multiplyAndReduce(bool minimize, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x,
+                                             std::vector<double> const* b, std::vector<double>& result, std::vector<uint64_t>* choices, uint64_t n) const {
+    uint64_t const rowGroupCount = rowGroupIndices.size() - 1;
+    if (rowGroupIndices.empty() || rowGroupIndices.back() != data->rowCount || x.size() != data->columnCount || (b && b->size() != data->rowCount) ||
+        (choices && choices->size() != rowGroupCount) || (n > 1 && rowGroupCount != data->columnCount)) {
+        throw storm::exceptions::InvalidArgumentException() << "Dimension mismatch in matrix-vector multiplication on the device.";
+    }
+    if (rowGroupIndices != data->uploadedRowGroupIndices) {
+        data->rowGroupIndices.upload(rowGroupIndices);
+        data->uploadedRowGroupIndices = rowGroupIndices;
+        data->uploadedRowGroupsContainEmptyGroup = std::adjacent_find(rowGroupIndices.begin(), rowGroupIndices.end()) != rowGroupIndices.end();
+    }
+    data->operand.upload(x);
+    double const* offsets = nullptr;
+    if (b) {
+        data->offsets.upload(*b);
+        offsets = data->offsets.get();
+    }
+    uint64_t* deviceChoices = nullptr;
+    if (choices) {
+        data->choices.upload(*choices);
+        deviceChoices = data->choices.get();
+    }
+    if (data->uploadedRowGroupsContainEmptyGroup) {
+        // The kernel does not write the entries of empty row groups, so they have to be initialized with the values they keep.
+        if (n > 1) {
+            data->result.upload(x);
+        } else {
+            result.resize(rowGroupCount);
+            data->result.upload(result);
+        }
+    } else {
+        data->result.resize(rowGroupCount);
+    }
+    for (uint64_t iteration = 0; iteration < n; ++iteration) {
+        if (iteration > 0) {
+            data->operand.swap(data->result);
+        }
+        data->launch(rowGroupCount, [&](uint64_t blocks, uint64_t threads) {
+            auto const* groups = data->rowGroupIndices.get();
+            auto const* rows = data->rowIndications.get();
+            if (data->useCompactColumns()) {
+                auto const* columns = data->compactColumns.get();
+                if (minimize) {
+                    multiplyAndReduceKernel<uint32_t, true><<<blocks, threads>>>(rowGroupCount, groups, rows, columns, data->values.get(),
+                                                                                 data->operand.get(), offsets, data->result.get(), deviceChoices);
+                } else {
+                    multiplyAndReduceKernel<uint32_t, false><<<blocks, threads>>>(rowGroupCount, groups, rows, columns, data->values.get(),
+                                                                                  data->operand.get(), offsets, data->result.get(), deviceChoices);
+                }
+            } else {
+                auto const* columns = data->columns.get();
+                if (minimize) {
+                    multiplyAndReduceKernel<uint64_t, true><<<blocks, threads>>>(rowGroupCount, groups, rows, columns, data->values.get(),
+                                                                                 data->operand.get(), offsets, data->result.get(), deviceChoices);
+                } else {
+                    multiplyAndReduceKernel<uint64_t, false><<<blocks, threads>>>(rowGroupCount, groups, rows, columns, data->values.get(),
+                                                                                  data->operand.get(), offsets, data->result.get(), deviceChoices);
+                }
+            }
+        });
+    }
+    data->result.download(result);
+    if (choices) {
+        data->choices.download(*choices);
+    }
+}
+
+bool DeviceMultiplication::isDeviceAvailable() {
+    int numberOfDevices = 0;
+    return cudaGetDeviceCount(&numberOfDevices) == cudaSuccess && numberOfDevices > 0;
+}
+
+}  // namespace cuda
+}  // namespace solver
+}  // namespace storm
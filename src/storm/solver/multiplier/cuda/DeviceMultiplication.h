@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace storm {
+namespace solver {
+namespace cuda {
+
+/*!
+ * Performs (repeated) matrix-vector multiplications with a matrix in CSR format that is kept in device memory.
+ * For repeated multiplications, the intermediate results stay on the device, i.e., only the initial operand and the final result are transferred.
+ *
+ * This class is only available if Storm is built with CUDA support (STORM_HAVE_CUDA). Its interface does not depend on CUDA headers.
+ */
+class DeviceMultiplication {
+   public:
+    /*!
+     * Transfers the given matrix to the device.
+     *
+     * @param rowIndications The CSR row indications, i.e., the entries of row i are at positions rowIndications[i], ..., rowIndications[i + 1] - 1.
+     * @param columns The column of each entry.
+     * @param values The value of each entry.
+     * @param columnCount The number of columns of the matrix.
+     */
+    DeviceMultiplication(std::vector<uint64_t> const& rowIndications, std::vector<uint64_t> const& columns, std::vector<double> const& values,
+                         uint64_t columnCount);
+
+    ~DeviceMultiplication();
+
+    DeviceMultiplication(DeviceMultiplication const&) = delete;
+    DeviceMultiplication& operator=(DeviceMultiplication const&) = delete;
+
+    /*!
+     * Computes result = A*x + b. If n > 1, the multiplication is repeated n times, where the result of one multiplication is the operand of the next
+     * one. This requires the matrix to be square.
+     *
+     * @param x The operand. Its length must be equal to the number of columns of A.
+     * @param b If non-null, this vector is added after each multiplication.
+     * @param result The target vector, which is resized to the number of rows of A. Can be the same as x.
+     * @param n The number of multiplications.
+     */
+    void multiply(std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result, uint64_t n = 1) const;
+
+    /*!
+     * Computes result = A*x + b and minimizes/maximizes over the given row groups. If n > 1, this is repeated n times, where the result of one
+     * multiplication is the operand of the next one. This requires the number of row groups to be equal to the number of columns.
+     * Choices are treated as in SparseMatrix::multiplyAndReduce, i.e., a choice is only changed if the new choice is strictly better.
+     *
+     * @param minimize If true, the minimum over each row group is taken and otherwise the maximum.
+     * @param rowGroupIndices The row groups over which to reduce. As for the host multipliers, the entries of empty row groups are not changed, i.e.,
+     * they keep the value of result (or of x if n > 1).
+     * @param x The operand. Its length must be equal to the number of columns of A.
+     * @param b If non-null, this vector is added after each multiplication.
+     * @param result The target vector, which is resized to the number of row groups. Can be the same as x.
+     * @param choices If non-null, the choices made in the (last) reduction are written to this vector.
+     * @param n The number of multiplications.
+     */
+    void multiplyAndReduce(bool minimize, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& x, std::vector<double> const* b,
+                           std::vector<double>& result, std::vector<uint64_t>* choices, uint64_t n = 1) const;
+
+    /*!
+     * Retrieves whether a CUDA capable device is available.
+     */
+    static bool isDeviceAvailable();
+
+   private:
+    struct DeviceData;
+    std::unique_ptr<DeviceData> data;
+};
+
+}  // namespace cuda
+}  // namespace solver
+}  // namespace storm
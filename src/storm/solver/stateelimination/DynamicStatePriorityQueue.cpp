@@ -35,35 +35,35 @@ bool DynamicStatePriorityQueue<ValueType>::hasNext() const {
 
 template<typename ValueType>
 storm::storage::sparse::state_type DynamicStatePriorityQueue<ValueType>::pop() {
+    // Recompute the outdated penalty of the first state until the first state has an up-to-date penalty.
     auto it = priorityQueue.begin();
+    while (statesWithOutdatedPenalty.erase(it->first) > 0) {
+        storm::storage::sparse::state_type state = it->first;
+        uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
+        if (it->second != newPriority) {
+            // Erase and re-insert the entry into priority queue (with the new priority).
+            priorityQueue.erase(it);
+            stateToPriorityQueueEntry[state] = priorityQueue.emplace(state, newPriority).first;
+            it = priorityQueue.begin();
+        }
+    }
+
     STORM_LOG_TRACE("Popping state " << it->first << " with priority " << it->second << ".");
     storm::storage::sparse::state_type result = it->first;
-    priorityQueue.erase(priorityQueue.begin());
+    priorityQueue.erase(it);
     stateToPriorityQueueEntry.erase(result);
     return result;
 }
 
 template<typename ValueType>
 void DynamicStatePriorityQueue<ValueType>::update(storm::storage::sparse::state_type state) {
-    // First, we need to find the old priority queue entry for the state.
-    auto priorityQueueEntryIt = stateToPriorityQueueEntry.find(state);
-
     // If the priority queue does not store the priority of the given state, we must not update it.
-    if (priorityQueueEntryIt == stateToPriorityQueueEntry.end()) {
+    if (stateToPriorityQueueEntry.count(state) == 0) {
         return;
     }
 
-    // Compute the new priority.
-    uint_fast64_t newPriority = penaltyFunction(state, transitionMatrix, backwardTransitions, oneStepProbabilities);
-
-    if (priorityQueueEntryIt->second->second != newPriority) {
-        // Erase and re-insert the entry into priority queue (with the new priority).
-        priorityQueue.erase(priorityQueueEntryIt->second);
-        stateToPriorityQueueEntry.erase(priorityQueueEntryIt);
-
-        auto newElementIt = priorityQueue.emplace(state, newPriority);
-        stateToPriorityQueueEntry.emplace(state, newElementIt.first);
-    }
+    // The new priority is only computed once it is needed.
+    statesWithOutdatedPenalty.insert(state);
 }
 
 template<typename ValueType>
@@ -3,6 +3,7 @@
 #include <functional>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -23,6 +24,12 @@ struct PriorityComparator {
     }
 };
 
+/*!
+ * A priority queue whose priorities (penalties) change as states are eliminated. Penalties are updated lazily: Updating a state only marks its
+ * penalty as outdated and the penalty is recomputed once the state is about to be popped. If the recomputed penalty differs, the state is moved
+ * accordingly and the next candidate is considered. This way, the (possibly expensive) penalty function is evaluated for few states per elimination.
+ * Note that a state whose outdated penalty is too high is not considered before its turn, so the order is exact only if penalties do not decrease.
+ */
 template<typename ValueType>
 class DynamicStatePriorityQueue : public StatePriorityQueue {
    public:
@@ -50,6 +57,7 @@ class DynamicStatePriorityQueue : public StatePriorityQueue {
     std::vector<ValueType> const& oneStepProbabilities;
     PriorityQueue priorityQueue;
     StatePriorityQueueEntryMap stateToPriorityQueueEntry;
+    std::unordered_set<storm::storage::sparse::state_type> statesWithOutdatedPenalty;
     PenaltyFunctionType penaltyFunction;
 };
 
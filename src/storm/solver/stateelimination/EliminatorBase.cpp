@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <type_traits>
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -84,6 +86,15 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
+    // Many predecessors typically reach the current row with the same probability (e.g. the same parametric function). For exact value types, where
+    // multiplying and simplifying is expensive, we therefore memoize the scaled entries of the current row for the factors that occurred so far.
+    uint64_t const maxNumberOfScaledRows = 16;
+    std::vector<std::pair<ValueType, std::vector<ValueType>>> scaledRows;
+    scaledRows.reserve(maxNumberOfScaledRows);
+
+    // The buffer of the new successors is swapped with the old successors of each predecessor, so its memory is reused for the next predecessor.
+    FlexibleRowType newSuccessors;
+
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
     // the elements of this row unless the elimination is filtered.
     for (auto const& predecessorEntry : elementsWithEntryInColumnEqualRow) {
@@ -116,13 +127,39 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         ValueType multiplyFactor = multiplyElement->getValue();
         multiplyElement->setValue(storm::utility::zero<ValueType>());
 
+        std::vector<ValueType> const* scaledRow = nullptr;
+        if (!std::is_same<ValueType, double>::value) {
+            for (auto const& cachedRow : scaledRows) {
+                if (cachedRow.first == multiplyFactor) {
+                    scaledRow = &cachedRow.second;
+                    break;
+                }
+            }
+            if (scaledRow == nullptr && scaledRows.size() < maxNumberOfScaledRows) {
+                std::vector<ValueType> newScaledRow;
+                newScaledRow.reserve(entriesInRow.size());
+                for (auto const& entry : entriesInRow) {
+                    newScaledRow.push_back(entry.getColumn() == column ? storm::utility::zero<ValueType>()
+                                                                       : storm::utility::simplify<ValueType>(entry.getValue() * multiplyFactor));
+                }
+                scaledRows.emplace_back(multiplyFactor, std::move(newScaledRow));
+                scaledRow = &scaledRows.back().second;
+            }
+        }
+        auto getScaledValue = [&](FlexibleRowIterator const& entryIt) -> ValueType {
+            if (scaledRow != nullptr) {
+                return (*scaledRow)[entryIt - entriesInRow.begin()];
+            }
+            return storm::utility::simplify<ValueType>(entryIt->getValue() * multiplyFactor);
+        };
+
         // At this point, we need to update the (forward) transitions of the predecessor.
         FlexibleRowIterator first1 = predecessorForwardTransitions.begin();
         FlexibleRowIterator last1 = predecessorForwardTransitions.end();
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
+        newSuccessors.clear();
         newSuccessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
 
@@ -145,7 +182,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                ValueType successorValue = storm::utility::simplify<ValueType>((first2->getValue() * multiplyFactor));
+                ValueType successorValue = getScaledValue(first2);
                 *result = MatrixEntry(first2->getColumn(), successorValue);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorValue);
                 ++first2;
@@ -154,8 +191,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
+                ValueType sum = first1->getValue() + getScaledValue(first2);
                 auto probability = storm::utility::simplify(sum);
                 *result = MatrixEntry(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
@@ -166,7 +202,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                ValueType probability = storm::utility::simplify<ValueType>(first2->getValue() * multiplyFactor);
+                ValueType probability = getScaledValue(first2);
                 *result = MatrixEntry(first2->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
                 ++successorOffsetInNewBackwardTransitions;
@@ -174,7 +210,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
 
         // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        predecessorForwardTransitions.swap(newSuccessors);
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -185,6 +221,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // Finally, we need to add the predecessor to the set of predecessors of every successor.
     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
+    FlexibleRowType newPredecessors;
     for (auto const& successorEntry : entriesInRow) {
         if (successorEntry.getColumn() == column) {
             continue;
@@ -207,7 +244,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
+        newPredecessors.clear();
         newPredecessors.reserve((last1 - first1) + (last2 - first2));
         std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
 
@@ -240,7 +277,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
             std::copy_if(first2, last2, result, [&](MatrixEntry const& a) { return a.getColumn() != row; });
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        successorBackwardTransitions.swap(newPredecessors);
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
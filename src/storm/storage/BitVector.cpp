@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <atomic>
 #include <bitset>
 #include <iostream>
 
@@ -16,6 +17,64 @@
 namespace storm {
 namespace storage {
 
+namespace {
+// The number of buckets that are inspected at once when scanning for a (rare) event. Inspecting a block has no early exits, which allows the compiler to
+// vectorize it and avoids a branch per bucket.
+constexpr uint64_t bucketsPerBlock = 8;
+
+inline uint64_t popcount(uint64_t bucket) {
+#if (defined(__GNUG__) || defined(__clang__))
+    return __builtin_popcountll(bucket);
+#else
+    uint64_t cnt;
+    for (cnt = 0; bucket; cnt++) {
+        bucket &= bucket - 1;
+    }
+    return cnt;
+#endif
+}
+
+/*!
+ * Counts the set bits in the given range of buckets. Independent partial sums avoid that each popcount has to wait for the previous addition.
+ */
+uint64_t countSetBits(uint64_t const* begin, uint64_t const* end) {
+    uint64_t counts[4] = {0, 0, 0, 0};
+    for (; end - begin >= 4; begin += 4) {
+        counts[0] += popcount(begin[0]);
+        counts[1] += popcount(begin[1]);
+        counts[2] += popcount(begin[2]);
+        counts[3] += popcount(begin[3]);
+    }
+    uint64_t result = counts[0] + counts[1] + counts[2] + counts[3];
+    for (; begin != end; ++begin) {
+        result += popcount(*begin);
+    }
+    return result;
+}
+
+/*!
+ * Checks whether combining the buckets of the two given ranges yields zero for all buckets.
+ */
+template<typename Combine>
+bool combinesToZero(uint64_t const* it1, uint64_t const* ite1, uint64_t const* it2, Combine const& combine) {
+    for (; static_cast<uint64_t>(ite1 - it1) >= bucketsPerBlock; it1 += bucketsPerBlock, it2 += bucketsPerBlock) {
+        uint64_t block = 0;
+        for (uint64_t i = 0; i < bucketsPerBlock; ++i) {
+            block |= combine(it1[i], it2[i]);
+        }
+        if (block != 0) {
+            return false;
+        }
+    }
+    for (; it1 != ite1; ++it1, ++it2) {
+        if (combine(*it1, *it2) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
     : dataPtr(dataPtr), endIndex(endIndex) {
     if (setOnFirstBit) {
@@ -255,6 +314,18 @@ bool BitVector::get(uint_fast64_t index) const {
     return (*this)[index];
 }
 
+bool BitVector::setAtomically(uint_fast64_t index) {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to BitVector::setAtomically: written index " << index << " out of bounds.");
+    uint64_t mask = 1ull << (63 - (index & mod64mask));
+    return (std::atomic_ref<uint64_t>(buckets[index >> 6]).fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+}
+
+bool BitVector::getAtomically(uint_fast64_t index) const {
+    STORM_LOG_ASSERT(index < bitCount, "Invalid call to BitVector::getAtomically: read index " << index << " out of bounds.");
+    uint64_t mask = 1ull << (63 - (index & mod64mask));
+    return (std::atomic_ref<uint64_t>(buckets[index >> 6]).load(std::memory_order_relaxed) & mask) != 0;
+}
+
 void BitVector::resize(uint_fast64_t newLength, bool init) {
     if (newLength > bitCount) {
         uint_fast64_t newBucketCount = newLength >> 6;
@@ -388,11 +459,18 @@ BitVector BitVector::operator%(BitVector const& filter) const {
             ++position;
         }
     } else {
-        // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-        // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+        // If the given bit vector had much fewer elements, we iterate over its elements and compute the number of set bits of the filter before each
+        // element. As the elements are visited in ascending order, the count for all buckets before the current one can be reused.
+        uint64_t countedBuckets = 0;
+        uint64_t setBitsInCountedBuckets = 0;
         for (auto bit : (*this)) {
             if (filter[bit]) {
-                result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                uint64_t bucket = bit >> 6;
+                setBitsInCountedBuckets += countSetBits(filter.buckets + countedBuckets, filter.buckets + bucket);
+                countedBuckets = bucket;
+                uint64_t bitIndexInBucket = bit & mod64mask;
+                uint64_t setBitsInBucket = bitIndexInBucket == 0 ? 0 : popcount(filter.buckets[bucket] >> (64 - bitIndexInBucket));
+                result.set(setBitsInCountedBuckets + setBitsInBucket);
             }
         }
     }
@@ -451,31 +529,13 @@ BitVector BitVector::implies(BitVector const& other) const {
 bool BitVector::isSubsetOf(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
-
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != *it1) {
-            return false;
-        }
-    }
-    return true;
+    return combinesToZero(buckets, buckets + bucketCount(), other.buckets, [](uint64_t const& a, uint64_t const& b) { return a & ~b; });
 }
 
 bool BitVector::isDisjointFrom(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
 
-    uint64_t const* it1 = buckets;
-    uint64_t const* ite1 = buckets + bucketCount();
-    uint64_t const* it2 = other.buckets;
-
-    for (; it1 != ite1; ++it1, ++it2) {
-        if ((*it1 & *it2) != 0) {
-            return false;
-        }
-    }
-    return true;
+    return combinesToZero(buckets, buckets + bucketCount(), other.buckets, [](uint64_t const& a, uint64_t const& b) { return a & b; });
 }
 
 bool BitVector::matches(uint_fast64_t bitIndex, BitVector const& other) const {
@@ -597,6 +657,10 @@ uint_fast64_t BitVector::getAsInt(uint_fast64_t bitIndex, uint_fast64_t numberOf
     }
 }
 
+uint64_t const* BitVector::data() const {
+    return buckets;
+}
+
 uint_fast64_t BitVector::getTwoBitsAligned(uint_fast64_t bitIndex) const {
     // Check whether it is aligned.
     STORM_LOG_ASSERT(bitIndex % 64 != 63, "Bits not aligned.");
@@ -659,9 +723,7 @@ void BitVector::setFromInt(uint_fast64_t bitIndex, uint_fast64_t numberOfBits, u
 }
 
 bool BitVector::empty() const {
-    uint64_t* last = buckets + bucketCount();
-    uint64_t* it = std::find_if(buckets, last, [](uint64_t const& a) { return a != 0; });
-    return it == last;
+    return combinesToZero(buckets, buckets + bucketCount(), buckets, [](uint64_t const& a, uint64_t const&) { return a; });
 }
 
 bool BitVector::full() const {
@@ -698,44 +760,16 @@ uint_fast64_t BitVector::getNumberOfSetBits() const {
 }
 
 uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
-    uint_fast64_t result = 0;
-
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    uint_fast64_t result = countSetBits(buckets, buckets + bucket);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
     if (tmp != 0) {
         tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
         tmp &= buckets[bucket];
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(tmp);
-#else
-        uint_fast32_t cnt;
-        uint64_t bitset = tmp;
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
+        result += popcount(tmp);
     }
 
     return result;
@@ -834,6 +868,35 @@ uint_fast64_t BitVector::getNextIndexWithValue(uint64_t const* dataPtr, uint64_t
     // Find the right bucket
     if (currentBucket == (Value ? 0ull : -1ull)) {
         // The first bucket does not contain a bit with the desired value...
+        // Skip long runs of buckets without the desired value block-wise. Only buckets that lie completely within the search range are skipped.
+        uint64_t const skippedBucket = Value ? 0ull : -1ull;
+        if constexpr (Backward) {
+            uint64_t const* firstBucketIt = dataPtr + (startingIndex >> 6);
+            while (static_cast<uint64_t>(bucketIt - firstBucketIt) > bucketsPerBlock) {
+                uint64_t block = skippedBucket;
+                for (uint64_t i = 1; i <= bucketsPerBlock; ++i) {
+                    block = Value ? (block | *(bucketIt - i)) : (block & *(bucketIt - i));
+                }
+                if (block != skippedBucket) {
+                    break;
+                }
+                bucketIt -= bucketsPerBlock;
+                currentBucketIndexOffset -= 64 * bucketsPerBlock;
+            }
+        } else {
+            uint64_t const* lastBucketIt = dataPtr + ((endIndex - 1) >> 6);
+            while (static_cast<uint64_t>(lastBucketIt - bucketIt) > bucketsPerBlock) {
+                uint64_t block = skippedBucket;
+                for (uint64_t i = 1; i <= bucketsPerBlock; ++i) {
+                    block = Value ? (block | bucketIt[i]) : (block & bucketIt[i]);
+                }
+                if (block != skippedBucket) {
+                    break;
+                }
+                bucketIt += bucketsPerBlock;
+                currentBucketIndexOffset += 64 * bucketsPerBlock;
+            }
+        }
         do {
             // Move to next bucket (if there is some)
             if constexpr (Backward) {
@@ -1397,6 +1460,34 @@ uint64_t Murmur3BitVectorHash<uint64_t>::operator()(storm::storage::BitVector co
     return h1 ^ h2;
 }
 
+namespace {
+// Hashes the given bucket of a bit vector with the given index. The index is mixed into the bucket, so that equal buckets at different positions
+// contribute differently to the hash.
+inline uint64_t zobristBucketHash(uint64_t bucketIndex, uint64_t bucket) {
+    return fmix64(bucket ^ ((bucketIndex + 1) * 0x9e3779b97f4a7c15ull));
+}
+}  // namespace
+
+uint64_t ZobristBitVectorHash::operator()(storm::storage::BitVector const& bv) const {
+    uint64_t result = 0;
+    for (uint64_t bucketIndex = 0, bucketCount = bv.bucketCount(); bucketIndex < bucketCount; ++bucketIndex) {
+        result ^= zobristBucketHash(bucketIndex, bv.buckets[bucketIndex]);
+    }
+    return result;
+}
+
+uint64_t ZobristBitVectorHash::update(uint64_t hash, storm::storage::BitVector const& oldBitVector,
+                                      storm::storage::BitVector const& newBitVector) const {
+    STORM_LOG_ASSERT(oldBitVector.size() == newBitVector.size(), "Bit vectors must be of equal size.");
+    for (uint64_t bucketIndex = 0, bucketCount = oldBitVector.bucketCount(); bucketIndex < bucketCount; ++bucketIndex) {
+        if (oldBitVector.buckets[bucketIndex] != newBitVector.buckets[bucketIndex]) {
+            hash ^= zobristBucketHash(bucketIndex, oldBitVector.buckets[bucketIndex]);
+            hash ^= zobristBucketHash(bucketIndex, newBitVector.buckets[bucketIndex]);
+        }
+    }
+    return hash;
+}
+
 void BitVector::store(std::ostream& os) const {
     os << bitCount;
     for (uint64_t i = 0; i < bucketCount(); ++i) {
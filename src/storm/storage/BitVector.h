@@ -308,6 +308,22 @@ class BitVector {
      */
     bool get(uint_fast64_t index) const;
 
+    /*!
+     * Sets the bit at the given index. As opposed to set, this may be called concurrently from several threads, even if the indices share a bucket.
+     *
+     * @param index The index where to set the bit.
+     * @return True iff the bit was not set before, i.e., iff this call changed the bit vector.
+     */
+    bool setAtomically(uint_fast64_t index);
+
+    /*!
+     * Retrieves the truth value of the bit at the given index. As opposed to get, this may be called while other threads call setAtomically.
+     *
+     * @param index The index of the bit to access.
+     * @return True iff the bit at the given index is set.
+     */
+    bool getAtomically(uint_fast64_t index) const;
+
     /*!
      * Resizes the bit vector to hold the given new number of bits. If the bit vector becomes smaller this way,
      * the bits are truncated. Otherwise, the new bits are initialized to the given value.
@@ -519,6 +535,15 @@ class BitVector {
      */
     uint_fast64_t getTwoBitsAligned(uint_fast64_t bitIndex) const;
 
+    /*!
+     * Retrieves a pointer to the buckets storing the bits of this bit vector. Bit i is stored in bucket i / 64 at position 63 - (i % 64), i.e.
+     * the first bit of each bucket is its most significant one. This gives code that is generated for a particular state layout (see
+     * CompiledStatePredicates) direct access to the bits.
+     *
+     * @return A pointer to the first bucket.
+     */
+    uint64_t const* data() const;
+
     /*!
      * Sets the selected number of lowermost bits of the provided value at the given bit index.
      *
@@ -688,6 +713,7 @@ class BitVector {
 
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
+    friend struct ZobristBitVectorHash;
 
    private:
     /*!
@@ -770,6 +796,25 @@ struct Murmur3BitVectorHash {
     StateType operator()(storm::storage::BitVector const& bv) const;
 };
 
+/*!
+ * A Zobrist-style hash for bit vectors: the hash is the XOR of the hashes of the individual buckets (each combined with the position of the
+ * bucket). Consequently, the hash of a bit vector that differs from another one in only a few buckets can be obtained from the hash of the
+ * other one by updating the contributions of the differing buckets, which is much cheaper than rehashing long bit vectors.
+ */
+struct ZobristBitVectorHash {
+    uint64_t operator()(storm::storage::BitVector const& bv) const;
+
+    /*!
+     * Computes the hash of the new bit vector from the hash of the old one.
+     *
+     * @param hash The hash of the old bit vector.
+     * @param oldBitVector The old bit vector.
+     * @param newBitVector The new bit vector. It must have the same size as the old one.
+     * @return The hash of the new bit vector.
+     */
+    uint64_t update(uint64_t hash, storm::storage::BitVector const& oldBitVector, storm::storage::BitVector const& newBitVector) const;
+};
+
 }  // namespace storage
 }  // namespace storm
 
@@ -42,9 +42,12 @@ std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash
 }
 
 template<class ValueType, class Hash>
-BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
-    : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor, bool treeCompression)
+    : loadFactor(loadFactor), bucketSize(treeCompression ? 64 : bucketSize), currentSize(1), numberOfElements(0) {
     STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    if (treeCompression) {
+        treeCompressor = std::make_shared<BitVectorTreeCompressor>(bucketSize);
+    }
 
     while (initialSize > 0) {
         ++currentSize;
@@ -52,7 +55,7 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_
     }
 
     // Create the underlying containers.
-    buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    buckets = storm::storage::BitVector(this->bucketSize * (1ull << currentSize));
     occupied = storm::storage::BitVector(1ull << currentSize);
     values = std::vector<ValueType>(1ull << currentSize);
 }
@@ -89,7 +92,8 @@ void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     [[maybe_unused]] uint64_t oldSize = numberOfElements;
     numberOfElements = 0;
     for (auto bucketIndex : oldOccupied) {
-        findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+        storm::storage::BitVector storedKey = oldBuckets.get(bucketIndex * bucketSize, bucketSize);
+        findOrAddStoredKeyAndGetBucket(storedKey, oldValues[bucketIndex], hasher(storedKey));
     }
     STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
 }
@@ -101,9 +105,35 @@ ValueType BitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector
 
 template<class ValueType, class Hash>
 std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+    if (treeCompressor) {
+        storm::storage::BitVector storedKey = getStoredKey(treeCompressor->compress(key));
+        return findOrAddStoredKeyAndGetBucket(storedKey, value, hasher(storedKey));
+    }
+    return findOrAddStoredKeyAndGetBucket(key, value, hasher(key));
+}
+
+template<class ValueType, class Hash>
+ValueType BitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value, uint64_t hash) {
+    return findOrAddAndGetBucket(key, value, hash).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value,
+                                                                                        uint64_t hash) {
+    if (treeCompressor) {
+        // The hash refers to the uncompressed key, so it is of no use here.
+        return findOrAddAndGetBucket(key, value);
+    }
+    STORM_LOG_ASSERT(hash == static_cast<uint64_t>(hasher(key)), "The given hash does not match the hash of the key.");
+    return findOrAddStoredKeyAndGetBucket(key, value, hash);
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddStoredKeyAndGetBucket(storm::storage::BitVector const& key, ValueType const& value,
+                                                                                                 uint64_t hash) {
     checkIncreaseSize();
 
-    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key);
+    std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key, hash);
     if (flagAndBucket.first) {
         return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
     } else {
@@ -138,6 +168,15 @@ ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
     return values[bucket];
 }
 
+template<class ValueType, class Hash>
+boost::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    if (!flagBucketPair.first) {
+        return boost::none;
+    }
+    return values[flagBucketPair.second];
+}
+
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
     return findBucket(key).first;
@@ -160,8 +199,22 @@ uint64_t BitVectorHashMap<ValueType, Hash>::getCurrentShiftWidth() const {
 
 template<class ValueType, class Hash>
 std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
+    if (treeCompressor) {
+        boost::optional<uint64_t> handle = treeCompressor->find(key);
+        if (!handle) {
+            // If the tree of the key is not (completely) stored, the key cannot be contained in the map.
+            return std::make_pair(false, 0);
+        }
+        storm::storage::BitVector storedKey = getStoredKey(handle.get());
+        return findBucket(storedKey, hasher(storedKey));
+    }
+    return findBucket(key, hasher(key));
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key, uint64_t hash) const {
     STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
-    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+    uint64_t bucket = hash >> this->getCurrentShiftWidth();
 
     while (isBucketOccupied(bucket)) {
         if (buckets.matches(bucket * bucketSize, key)) {
@@ -178,9 +231,19 @@ std::pair<bool, uint64_t> BitVectorHashMap<ValueType, Hash>::findBucket(storm::s
 
 template<class ValueType, class Hash>
 std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    if (treeCompressor) {
+        return std::make_pair(treeCompressor->decompress(buckets.getAsInt(bucket * bucketSize, 64)), values[bucket]);
+    }
     return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
 }
 
+template<class ValueType, class Hash>
+storm::storage::BitVector BitVectorHashMap<ValueType, Hash>::getStoredKey(uint64_t handle) {
+    storm::storage::BitVector result(64);
+    result.setFromInt(0, 64, handle);
+    return result;
+}
+
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
     for (auto pos : occupied) {
@@ -190,6 +253,8 @@ void BitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType
 
 template class BitVectorHashMap<uint64_t>;
 template class BitVectorHashMap<uint32_t>;
+template class BitVectorHashMap<uint64_t, ZobristBitVectorHash>;
+template class BitVectorHashMap<uint32_t, ZobristBitVectorHash>;
 // These instantiations allow you to "group" states in a BitVectorHashMap. I.e.,
 // if you want to look at a state and know what "group" it is in (with groups
 // controlled by an 8 bit group index) you can instantiate a BitVectorHashMap<uint8_t>
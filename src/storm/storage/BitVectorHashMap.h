@@ -3,8 +3,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorTreeCompressor.h"
 
 namespace storm {
 namespace storage {
@@ -56,8 +60,11 @@ class BitVectorHashMap {
      * @param initialSize The number of buckets that is initially available.
      * @param loadFactor The load factor that determines at which point the size of the underlying storage is
      * increased.
+     * @param treeCompression If set, the keys are stored tree-compressed (see BitVectorTreeCompressor), which
+     * reduces the memory consumption if the keys share many of their parts. Instead of the keys, their 64-bit
+     * handles are then hashed and stored in the buckets.
      */
-    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+    BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, bool treeCompression = false);
 
     BitVectorHashMap(BitVectorHashMap const&) = default;
     BitVectorHashMap(BitVectorHashMap&&) = default;
@@ -86,6 +93,33 @@ class BitVectorHashMap {
      */
     std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
 
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. Instead of hashing the key, the given (e.g. incrementally computed)
+     * hash is used.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @param hash The hash of the key. This must coincide with the value that the hash functor of this map
+     * computes for the key. If the keys are tree-compressed, the hash is ignored.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value, uint64_t hash);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. Instead of hashing the key, the given hash is used.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @param hash The hash of the key. This must coincide with the value that the hash functor of this map
+     * computes for the key. If the keys are tree-compressed, the hash is ignored.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the bucket into which the key
+     * was inserted.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value, uint64_t hash);
+
     /*!
      * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
      *
@@ -109,6 +143,15 @@ class BitVectorHashMap {
      */
     ValueType getValue(uint64_t bucket) const;
 
+    /*!
+     * Retrieves the value associated with the given key, if the key is contained in the map. In contrast to
+     * checking with contains and retrieving with getValue, this searches the key only once.
+     *
+     * @param key The key to search.
+     * @return The value associated with the key, if the key is contained in the map.
+     */
+    boost::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Checks if the given key is already contained in the map.
      *
@@ -170,6 +213,17 @@ class BitVectorHashMap {
      */
     std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Searches for the bucket with the given stored key (i.e. the handle of the key if the keys are
+     * tree-compressed), whose hash is known.
+     *
+     * @param key The stored key to search for.
+     * @param hash The hash of the key.
+     * @return A pair whose first component indicates whether the key is already contained in the map and whose
+     * second component indicates in which bucket the key is stored.
+     */
+    std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key, uint64_t hash) const;
+
     /*!
      * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
      * indicated by the return value.
@@ -180,6 +234,17 @@ class BitVectorHashMap {
      */
     bool insertWithoutIncreasingSize(storm::storage::BitVector const& key, ValueType const& value);
 
+    /*!
+     * Searches for the given stored key (i.e. the handle of the key if the keys are tree-compressed), whose
+     * hash is known, and inserts it with the given value if it is not found.
+     */
+    std::pair<ValueType, uint64_t> findOrAddStoredKeyAndGetBucket(storm::storage::BitVector const& storedKey, ValueType const& value, uint64_t hash);
+
+    /*!
+     * Retrieves the stored key for the given handle of a tree-compressed key.
+     */
+    static storm::storage::BitVector getStoredKey(uint64_t handle);
+
     /*!
      * Increases the size of the hash map and performs the necessary rehashing of all entries.
      */
@@ -200,7 +265,7 @@ class BitVectorHashMap {
     // The load factor determining when the size of the map is increased.
     double loadFactor;
 
-    // The size of one bucket.
+    // The size of one bucket. If the keys are tree-compressed, the buckets hold 64-bit handles.
     uint64_t bucketSize;
 
     // The number of buckets is 2^currentSize.
@@ -220,6 +285,9 @@ class BitVectorHashMap {
 
     // Functor object that are used to perform the actual hashing.
     Hash hasher;
+
+    // If the keys are tree-compressed, the compressor holding their trees. It is shared between copies of the map.
+    std::shared_ptr<BitVectorTreeCompressor> treeCompressor;
 };
 
 }  // namespace storage
@@ -0,0 +1,165 @@
+#include "storm/storage/BitVectorTreeCompressor.h"
+
+#include <limits>
+
+#include "storm/exceptions/OutOfRangeException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The initial number of slots of the node table.
+uint64_t constexpr initialTableSize = 1ull << 16;
+
+inline uint64_t hashNodeKey(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ull;
+    key ^= key >> 33;
+    return key;
+}
+
+// Retrieves the position at which the range [begin, end) is split into the ranges of the two children of its node.
+inline uint64_t getSplitPosition(uint64_t begin, uint64_t end) {
+    return begin + (end - begin + 1) / 2;
+}
+
+inline uint64_t makePair(uint32_t first, uint32_t second) {
+    return (static_cast<uint64_t>(first) << 32) | second;
+}
+}  // namespace
+
+BitVectorTreeCompressor::BitVectorTreeCompressor(uint64_t bitsPerVector) : bucketsPerVector(bitsPerVector / 64), table(initialTableSize, 0) {
+    STORM_LOG_ASSERT(bitsPerVector % 64 == 0 && bitsPerVector > 0, "The size of the bit vectors must be a positive multiple of 64.");
+}
+
+uint64_t BitVectorTreeCompressor::compress(storm::storage::BitVector const& bitVector) {
+    STORM_LOG_ASSERT(bitVector.size() == bucketsPerVector * 64, "Unexpected size of bit vector.");
+    uint64_t const* buckets = bitVector.data();
+    if (bucketsPerVector == 1) {
+        return buckets[0];
+    }
+    uint64_t split = getSplitPosition(0, bucketsPerVector);
+    uint32_t left = findOrAddRange(buckets, 0, split);
+    uint32_t right = findOrAddRange(buckets, split, bucketsPerVector);
+    return makePair(left, right);
+}
+
+boost::optional<uint64_t> BitVectorTreeCompressor::find(storm::storage::BitVector const& bitVector) const {
+    STORM_LOG_ASSERT(bitVector.size() == bucketsPerVector * 64, "Unexpected size of bit vector.");
+    uint64_t const* buckets = bitVector.data();
+    if (bucketsPerVector == 1) {
+        return buckets[0];
+    }
+    uint64_t split = getSplitPosition(0, bucketsPerVector);
+    auto left = findRange(buckets, 0, split);
+    if (!left) {
+        return boost::none;
+    }
+    auto right = findRange(buckets, split, bucketsPerVector);
+    if (!right) {
+        return boost::none;
+    }
+    return makePair(left.get(), right.get());
+}
+
+storm::storage::BitVector BitVectorTreeCompressor::decompress(uint64_t handle) const {
+    storm::storage::BitVector result(bucketsPerVector * 64);
+    if (bucketsPerVector == 1) {
+        result.setFromInt(0, 64, handle);
+    } else {
+        uint64_t split = getSplitPosition(0, bucketsPerVector);
+        decompressRange(static_cast<uint32_t>(handle >> 32), 0, split, result);
+        decompressRange(static_cast<uint32_t>(handle), split, bucketsPerVector, result);
+    }
+    return result;
+}
+
+uint64_t BitVectorTreeCompressor::getNumberOfNodes() const {
+    return nodeKeys.size();
+}
+
+boost::optional<uint32_t> BitVectorTreeCompressor::findNode(uint64_t key) const {
+    uint64_t mask = table.size() - 1;
+    for (uint64_t slot = hashNodeKey(key) & mask; table[slot] != 0; slot = (slot + 1) & mask) {
+        if (nodeKeys[table[slot] - 1] == key) {
+            return table[slot] - 1;
+        }
+    }
+    return boost::none;
+}
+
+uint32_t BitVectorTreeCompressor::findOrAddNode(uint64_t key) {
+    uint64_t mask = table.size() - 1;
+    uint64_t slot = hashNodeKey(key) & mask;
+    for (; table[slot] != 0; slot = (slot + 1) & mask) {
+        if (nodeKeys[table[slot] - 1] == key) {
+            return table[slot] - 1;
+        }
+    }
+
+    STORM_LOG_THROW(nodeKeys.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::OutOfRangeException,
+                    "Too many nodes for tree compression of bit vectors.");
+    uint32_t node = static_cast<uint32_t>(nodeKeys.size());
+    nodeKeys.push_back(key);
+    table[slot] = node + 1;
+    // Keep the load factor of the table below 3/4.
+    if (4 * nodeKeys.size() >= 3 * table.size()) {
+        increaseTableSize();
+    }
+    return node;
+}
+
+boost::optional<uint32_t> BitVectorTreeCompressor::findRange(uint64_t const* buckets, uint64_t begin, uint64_t end) const {
+    if (end - begin == 1) {
+        return findNode(buckets[begin]);
+    }
+    uint64_t split = getSplitPosition(begin, end);
+    auto left = findRange(buckets, begin, split);
+    if (!left) {
+        return boost::none;
+    }
+    auto right = findRange(buckets, split, end);
+    if (!right) {
+        return boost::none;
+    }
+    return findNode(makePair(left.get(), right.get()));
+}
+
+uint32_t BitVectorTreeCompressor::findOrAddRange(uint64_t const* buckets, uint64_t begin, uint64_t end) {
+    if (end - begin == 1) {
+        return findOrAddNode(buckets[begin]);
+    }
+    uint64_t split = getSplitPosition(begin, end);
+    uint32_t left = findOrAddRange(buckets, begin, split);
+    uint32_t right = findOrAddRange(buckets, split, end);
+    return findOrAddNode(makePair(left, right));
+}
+
+void BitVectorTreeCompressor::decompressRange(uint32_t node, uint64_t begin, uint64_t end, storm::storage::BitVector& result) const {
+    uint64_t key = nodeKeys[node];
+    if (end - begin == 1) {
+        result.setFromInt(begin * 64, 64, key);
+    } else {
+        uint64_t split = getSplitPosition(begin, end);
+        decompressRange(static_cast<uint32_t>(key >> 32), begin, split, result);
+        decompressRange(static_cast<uint32_t>(key), split, end, result);
+    }
+}
+
+void BitVectorTreeCompressor::increaseTableSize() {
+    table = std::vector<uint32_t>(2 * table.size(), 0);
+    uint64_t mask = table.size() - 1;
+    for (uint64_t node = 0; node < nodeKeys.size(); ++node) {
+        uint64_t slot = hashNodeKey(nodeKeys[node]) & mask;
+        while (table[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = static_cast<uint32_t>(node + 1);
+    }
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Compresses bit vectors of a fixed length by recursively splitting them into halves (tree compression). The 64-bit buckets of a bit vector are the
+ * leaves of a binary tree and every inner node is identified by the pair of the identifiers of its children. Nodes are stored only once, so bit
+ * vectors that share parts (as the states of a model typically do) share the corresponding subtrees. Each bit vector is represented by a 64-bit handle,
+ * namely the pair of the identifiers of the two children of its root (or its only bucket, if the bit vector consists of a single bucket).
+ */
+class BitVectorTreeCompressor {
+   public:
+    /*!
+     * Creates a compressor for bit vectors of the given size.
+     *
+     * @param bitsPerVector The size of the bit vectors. This value must be a multiple of 64.
+     */
+    explicit BitVectorTreeCompressor(uint64_t bitsPerVector);
+
+    /*!
+     * Retrieves the handle of the given bit vector and inserts the missing nodes of its tree.
+     */
+    uint64_t compress(storm::storage::BitVector const& bitVector);
+
+    /*!
+     * Retrieves the handle of the given bit vector, if all nodes of its tree are already stored.
+     */
+    boost::optional<uint64_t> find(storm::storage::BitVector const& bitVector) const;
+
+    /*!
+     * Retrieves the bit vector with the given handle.
+     */
+    storm::storage::BitVector decompress(uint64_t handle) const;
+
+    /*!
+     * Retrieves the number of stored nodes.
+     */
+    uint64_t getNumberOfNodes() const;
+
+   private:
+    /*!
+     * Retrieves the identifier of the node with the given key (if any). The key of a node is a bucket for leaves and the pair of the identifiers
+     * of the children otherwise.
+     */
+    boost::optional<uint32_t> findNode(uint64_t key) const;
+
+    /*!
+     * Retrieves the identifier of the node with the given key and inserts the node if it is missing.
+     */
+    uint32_t findOrAddNode(uint64_t key);
+
+    /*!
+     * Retrieves the identifier of the node representing the given range of buckets (if any).
+     */
+    boost::optional<uint32_t> findRange(uint64_t const* buckets, uint64_t begin, uint64_t end) const;
+
+    /*!
+     * Retrieves the identifier of the node representing the given range of buckets and inserts the missing nodes.
+     */
+    uint32_t findOrAddRange(uint64_t const* buckets, uint64_t begin, uint64_t end);
+
+    /*!
+     * Writes the buckets of the range represented by the given node to the given bit vector.
+     */
+    void decompressRange(uint32_t node, uint64_t begin, uint64_t end, storm::storage::BitVector& result) const;
+
+    /*!
+     * Doubles the size of the table and reinserts all nodes.
+     */
+    void increaseTableSize();
+
+    // The number of buckets of each bit vector.
+    uint64_t bucketsPerVector;
+
+    // The key of each node, indexed by the identifier of the node.
+    std::vector<uint64_t> nodeKeys;
+
+    // An open-addressing table storing the identifier of each node plus one (zero marks free slots). Its size is a power of two.
+    std::vector<uint32_t> table;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,85 @@
+#include "storm/storage/CompactScheduler.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+uint64_t getNumberOfBitsForChoice(uint64_t choice) {
+    // We always use at least one bit, even if all states have a single choice.
+    return std::max<uint64_t>(1, std::bit_width(choice));
+}
+}  // namespace detail
+
+CompactScheduler::CompactScheduler(uint64_t numberOfStates, uint64_t maximalNumberOfChoices)
+    : numberOfStates(numberOfStates),
+      bitsPerChoice(detail::getNumberOfBitsForChoice(maximalNumberOfChoices > 0 ? maximalNumberOfChoices - 1 : 0)),
+      choices(numberOfStates * bitsPerChoice, false),
+      statesWithDefinedChoice(numberOfStates, false) {
+    // Intentionally left empty.
+}
+
+CompactScheduler::CompactScheduler(std::vector<uint64_t> const& rowGroupIndices) : CompactScheduler(rowGroupIndices.size() - 1) {
+    uint64_t maximalNumberOfChoices = 1;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        maximalNumberOfChoices = std::max(maximalNumberOfChoices, rowGroupIndices[state + 1] - rowGroupIndices[state]);
+    }
+    setNumberOfBitsPerChoice(detail::getNumberOfBitsForChoice(maximalNumberOfChoices - 1));
+}
+
+void CompactScheduler::setChoice(uint64_t choice, uint64_t state) {
+    STORM_LOG_ASSERT(state < numberOfStates, "Illegal model state index");
+    uint64_t const requiredBits = detail::getNumberOfBitsForChoice(choice);
+    if (requiredBits > bitsPerChoice) {
+        setNumberOfBitsPerChoice(requiredBits);
+    }
+    choices.setFromInt(state * bitsPerChoice, bitsPerChoice, choice);
+    statesWithDefinedChoice.set(state, true);
+}
+
+void CompactScheduler::clearChoice(uint64_t state) {
+    STORM_LOG_ASSERT(state < numberOfStates, "Illegal model state index");
+    statesWithDefinedChoice.set(state, false);
+}
+
+bool CompactScheduler::isChoiceDefined(uint64_t state) const {
+    STORM_LOG_ASSERT(state < numberOfStates, "Illegal model state index");
+    return statesWithDefinedChoice.get(state);
+}
+
+uint64_t CompactScheduler::getChoice(uint64_t state) const {
+    STORM_LOG_ASSERT(isChoiceDefined(state), "No choice defined for state " << state << ".");
+    return choices.getAsInt(state * bitsPerChoice, bitsPerChoice);
+}
+
+storm::storage::BitVector const& CompactScheduler::getStatesWithDefinedChoice() const {
+    return statesWithDefinedChoice;
+}
+
+uint64_t CompactScheduler::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+uint64_t CompactScheduler::getNumberOfBitsPerChoice() const {
+    return bitsPerChoice;
+}
+
+void CompactScheduler::setNumberOfBitsPerChoice(uint64_t newBitsPerChoice) {
+    if (newBitsPerChoice == bitsPerChoice) {
+        return;
+    }
+    STORM_LOG_ASSERT(newBitsPerChoice > bitsPerChoice, "Shrinking the choice storage is not supported.");
+    storm::storage::BitVector newChoices(numberOfStates * newBitsPerChoice, false);
+    for (auto state : statesWithDefinedChoice) {
+        newChoices.setFromInt(state * newBitsPerChoice, newBitsPerChoice, choices.getAsInt(state * bitsPerChoice, bitsPerChoice));
+    }
+    choices = std::move(newChoices);
+    bitsPerChoice = newBitsPerChoice;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A memory efficient representation of memoryless deterministic schedulers.
+ * For each state, the chosen (local) choice index is stored in a bit-packed array where each entry occupies as many bits as needed to represent the
+ * largest choice index. Additionally, one bit per state indicates whether the choice for the state is defined.
+ * Compared to the general Scheduler (which stores a distribution for each state), this only needs a few bits per state.
+ *
+ * @see Scheduler, which uses this representation as long as all choices are deterministic and no memory is involved.
+ */
+class CompactScheduler {
+   public:
+    /*!
+     * Initializes a scheduler for the given number of states where no choice is defined.
+     * @param numberOfStates the number of states of the model
+     * @param maximalNumberOfChoices the maximal number of choices of a state (i.e., the maximal row group size). Larger choice indices can still be set but
+     *                               then the storage has to be re-allocated.
+     */
+    explicit CompactScheduler(uint64_t numberOfStates, uint64_t maximalNumberOfChoices = 1);
+
+    /*!
+     * Initializes a scheduler for a model with the given row group indices where no choice is defined.
+     */
+    explicit CompactScheduler(std::vector<uint64_t> const& rowGroupIndices);
+
+    /*!
+     * Sets the choice for the given state.
+     * @param choice the local choice index, i.e., the index of the chosen row within the row group of the state
+     * @param state the state for which to set the choice
+     */
+    void setChoice(uint64_t choice, uint64_t state);
+
+    /*!
+     * Clears the choice for the given state.
+     */
+    void clearChoice(uint64_t state);
+
+    /*!
+     * @return true iff there is a choice defined for the given state
+     */
+    bool isChoiceDefined(uint64_t state) const;
+
+    /*!
+     * @return the (local) choice index for the given state.
+     * @pre the choice for the given state is defined.
+     */
+    uint64_t getChoice(uint64_t state) const;
+
+    /*!
+     * @return the states for which a choice is defined
+     */
+    storm::storage::BitVector const& getStatesWithDefinedChoice() const;
+
+    /*!
+     * @return the number of states of the model
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * @return the number of bits used to store the choice for a single state
+     */
+    uint64_t getNumberOfBitsPerChoice() const;
+
+   private:
+    /*!
+     * Re-allocates the storage such that the given number of bits is used for each choice.
+     */
+    void setNumberOfBitsPerChoice(uint64_t newBitsPerChoice);
+
+    uint64_t numberOfStates;
+    uint64_t bitsPerChoice;
+    storm::storage::BitVector choices;
+    storm::storage::BitVector statesWithDefinedChoice;
+};
+
+}  // namespace storage
+}  // namespace storm
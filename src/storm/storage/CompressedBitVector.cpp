@@ -0,0 +1,490 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/OutOfRangeException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace detail {
+// An array container with more positions would be larger than a bitmap.
+uint64_t const maximalArrayCardinality = 4096;
+
+uint64_t getNextIndexWithValue(std::array<uint64_t, 1024> const& words, uint64_t position, bool value) {
+    uint64_t wordIndex = position / 64;
+    if (wordIndex >= words.size()) {
+        return words.size() * 64;
+    }
+    uint64_t word = (value ? words[wordIndex] : ~words[wordIndex]) & (~0ull << (position % 64));
+    while (word == 0) {
+        if (++wordIndex == words.size()) {
+            return words.size() * 64;
+        }
+        word = value ? words[wordIndex] : ~words[wordIndex];
+    }
+    return wordIndex * 64 + std::countr_zero(word);
+}
+}  // namespace detail
+
+CompressedBitVector::const_iterator::const_iterator(CompressedBitVector const& bitVector, uint64_t currentIndex)
+    : bitVector(&bitVector), currentIndex(currentIndex) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::const_iterator& CompressedBitVector::const_iterator::operator++() {
+    currentIndex = bitVector->getNextSetIndex(currentIndex + 1);
+    return *this;
+}
+
+uint64_t CompressedBitVector::const_iterator::operator*() const {
+    return currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return currentIndex != other.currentIndex;
+}
+
+bool CompressedBitVector::const_iterator::operator==(const_iterator const& other) const {
+    return currentIndex == other.currentIndex;
+}
+
+CompressedBitVector::CompressedBitVector() : CompressedBitVector(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(uint64_t length) : bitCount(length) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : bitCount(bitVector.size()) {
+    ChunkWords words{};
+    uint64_t currentKey = 0;
+    for (auto index : bitVector) {
+        if (index / chunkBits != currentKey) {
+            appendChunk(currentKey, words);
+            words.fill(0);
+            currentKey = index / chunkBits;
+        }
+        uint64_t const position = index % chunkBits;
+        words[position / 64] |= 1ull << (position % 64);
+    }
+    appendChunk(currentKey, words);
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    BitVector result(bitCount);
+    for (auto const& container : containers) {
+        uint64_t const offset = container.key * chunkBits;
+        switch (container.kind) {
+            case ContainerKind::Array:
+                for (auto position : container.positions) {
+                    result.set(offset + position);
+                }
+                break;
+            case ContainerKind::Runs:
+                for (uint64_t run = 0; run < container.positions.size(); run += 2) {
+                    result.setMultiple(offset + container.positions[run], container.positions[run + 1] - container.positions[run] + 1);
+                }
+                break;
+            case ContainerKind::Bitmap:
+                for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+                    for (uint64_t word = container.words[wordIndex]; word != 0; word &= word - 1) {
+                        result.set(offset + wordIndex * 64 + std::countr_zero(word));
+                    }
+                }
+                break;
+        }
+    }
+    return result;
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    if (bitCount != other.bitCount || containers.size() != other.containers.size()) {
+        return false;
+    }
+    for (uint64_t containerIndex = 0; containerIndex < containers.size(); ++containerIndex) {
+        auto const& lhs = containers[containerIndex];
+        auto const& rhs = other.containers[containerIndex];
+        if (lhs.key != rhs.key || lhs.cardinality != rhs.cardinality) {
+            return false;
+        }
+        if (lhs.kind == rhs.kind) {
+            if (lhs.positions != rhs.positions || lhs.words != rhs.words) {
+                return false;
+            }
+        } else {
+            // The same chunk might be stored in different containers, depending on how it was constructed.
+            ChunkWords lhsWords, rhsWords;
+            decode(lhs, lhsWords);
+            decode(rhs, rhsWords);
+            if (lhsWords != rhsWords) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+void CompressedBitVector::set(uint64_t index, bool value) {
+    STORM_LOG_THROW(index < bitCount, storm::exceptions::OutOfRangeException,
+                    "Invalid call to CompressedBitVector::set: written index " << index << " out of bounds.");
+    uint64_t const key = index / chunkBits;
+    uint16_t const position = index % chunkBits;
+    auto containerIt = containers.begin() + (findContainer(key) - containers.cbegin());
+    if (containerIt == containers.end() || containerIt->key != key) {
+        if (value) {
+            containers.insert(containerIt, Container{key, ContainerKind::Array, 1, {position}, {}});
+        }
+        return;
+    }
+    auto& container = *containerIt;
+    if (container.kind == ContainerKind::Array) {
+        auto positionIt = std::lower_bound(container.positions.begin(), container.positions.end(), position);
+        bool const isSet = positionIt != container.positions.end() && *positionIt == position;
+        if (value && !isSet) {
+            if (container.cardinality == detail::maximalArrayCardinality) {
+                ChunkWords words;
+                decode(container, words);
+                words[position / 64] |= 1ull << (position % 64);
+                container = encode(key, words);
+            } else {
+                container.positions.insert(positionIt, position);
+                ++container.cardinality;
+            }
+        } else if (!value && isSet) {
+            container.positions.erase(positionIt);
+            if (--container.cardinality == 0) {
+                containers.erase(containerIt);
+            }
+        }
+    } else if (container.kind == ContainerKind::Bitmap) {
+        uint64_t& word = container.words[position / 64];
+        uint64_t const mask = 1ull << (position % 64);
+        if (value && (word & mask) == 0) {
+            word |= mask;
+            ++container.cardinality;
+        } else if (!value && (word & mask) != 0) {
+            word &= ~mask;
+            --container.cardinality;
+            if (container.cardinality == 0) {
+                containers.erase(containerIt);
+            } else if (container.cardinality <= detail::maximalArrayCardinality) {
+                ChunkWords words;
+                decode(container, words);
+                container = encode(key, words);
+            }
+        }
+    } else {
+        std::vector<uint16_t>& runs = container.positions;
+        uint64_t const run = 2 * findRun(container, position > 0 ? position - 1 : 0);
+        if (value) {
+            if (run < runs.size() && runs[run] <= position && position <= runs[run + 1]) {
+                return;
+            }
+            if (run < runs.size() && runs[run] <= position) {
+                // The position directly follows the run.
+                runs[run + 1] = position;
+                if (run + 2 < runs.size() && runs[run + 2] == position + 1) {
+                    runs[run + 1] = runs[run + 3];
+                    runs.erase(runs.begin() + run + 2, runs.begin() + run + 4);
+                }
+            } else if (run < runs.size() && runs[run] == position + 1) {
+                runs[run] = position;
+            } else {
+                runs.insert(runs.begin() + run, {position, position});
+            }
+            ++container.cardinality;
+        } else {
+            uint64_t const containingRun = run < runs.size() && runs[run + 1] < position ? run + 2 : run;
+            if (containingRun >= runs.size() || runs[containingRun] > position) {
+                return;
+            }
+            if (runs[containingRun] == runs[containingRun + 1]) {
+                runs.erase(runs.begin() + containingRun, runs.begin() + containingRun + 2);
+            } else if (runs[containingRun] == position) {
+                ++runs[containingRun];
+            } else if (runs[containingRun + 1] == position) {
+                --runs[containingRun + 1];
+            } else {
+                // Split the run.
+                runs.insert(runs.begin() + containingRun + 1, {static_cast<uint16_t>(position - 1), static_cast<uint16_t>(position + 1)});
+            }
+            if (--container.cardinality == 0) {
+                containers.erase(containerIt);
+                return;
+            }
+        }
+        if (runs.size() * sizeof(uint16_t) > wordsPerChunk * sizeof(uint64_t)) {
+            ChunkWords words;
+            decode(container, words);
+            container = encode(key, words);
+        }
+    }
+}
+
+bool CompressedBitVector::get(uint64_t index) const {
+    STORM_LOG_THROW(index < bitCount, storm::exceptions::OutOfRangeException,
+                    "Invalid call to CompressedBitVector::get: read index " << index << " out of bounds.");
+    uint64_t const key = index / chunkBits;
+    auto containerIt = findContainer(key);
+    if (containerIt == containers.end() || containerIt->key != key) {
+        return false;
+    }
+    return getNextSetPosition(*containerIt, index % chunkBits) == index % chunkBits;
+}
+
+template<typename Operation>
+CompressedBitVector CompressedBitVector::combine(CompressedBitVector const& other, Operation const& operation, bool unionOfChunks) const {
+    STORM_LOG_THROW(bitCount == other.bitCount, storm::exceptions::InvalidArgumentException, "Length of the bit vectors does not match.");
+    CompressedBitVector result(bitCount);
+    ChunkWords lhsWords, rhsWords, resultWords;
+    auto lhsIt = containers.begin();
+    auto rhsIt = other.containers.begin();
+    while (lhsIt != containers.end() || rhsIt != other.containers.end()) {
+        bool const useLhs = lhsIt != containers.end() && (rhsIt == other.containers.end() || lhsIt->key <= rhsIt->key);
+        bool const useRhs = rhsIt != other.containers.end() && (lhsIt == containers.end() || rhsIt->key <= lhsIt->key);
+        uint64_t const key = useLhs ? lhsIt->key : rhsIt->key;
+        if (useLhs && useRhs) {
+            decode(*lhsIt, lhsWords);
+            decode(*rhsIt, rhsWords);
+        } else if (!unionOfChunks) {
+            // The chunk is only present in one of the bit vectors.
+            useLhs ? ++lhsIt : ++rhsIt;
+            continue;
+        } else if (useLhs) {
+            decode(*lhsIt, lhsWords);
+            rhsWords.fill(0);
+        } else {
+            lhsWords.fill(0);
+            decode(*rhsIt, rhsWords);
+        }
+        for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+            resultWords[wordIndex] = operation(lhsWords[wordIndex], rhsWords[wordIndex]);
+        }
+        result.appendChunk(key, resultWords);
+        if (useLhs) {
+            ++lhsIt;
+        }
+        if (useRhs) {
+            ++rhsIt;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector CompressedBitVector::operator&(CompressedBitVector const& other) const {
+    return combine(other, [](uint64_t lhs, uint64_t rhs) { return lhs & rhs; }, false);
+}
+
+CompressedBitVector CompressedBitVector::operator|(CompressedBitVector const& other) const {
+    return combine(other, [](uint64_t lhs, uint64_t rhs) { return lhs | rhs; }, true);
+}
+
+CompressedBitVector CompressedBitVector::operator~() const {
+    CompressedBitVector result(bitCount);
+    ChunkWords words;
+    auto containerIt = containers.begin();
+    uint64_t const numberOfChunks = (bitCount + chunkBits - 1) / chunkBits;
+    for (uint64_t key = 0; key < numberOfChunks; ++key) {
+        if (containerIt != containers.end() && containerIt->key == key) {
+            decode(*containerIt, words);
+            ++containerIt;
+        } else {
+            words.fill(0);
+        }
+        for (auto& word : words) {
+            word = ~word;
+        }
+        // Clear the bits beyond the length of the bit vector.
+        uint64_t const chunkLength = std::min(chunkBits, bitCount - key * chunkBits);
+        for (uint64_t position = chunkLength; position < chunkBits; position = (position / 64 + 1) * 64) {
+            words[position / 64] &= (1ull << (position % 64)) - 1;
+        }
+        result.appendChunk(key, words);
+    }
+    return result;
+}
+
+bool CompressedBitVector::empty() const {
+    return containers.empty();
+}
+
+bool CompressedBitVector::full() const {
+    return getNumberOfSetBits() == bitCount;
+}
+
+uint64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.cardinality;
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::getNextSetIndex(uint64_t startingIndex) const {
+    for (auto containerIt = findContainer(startingIndex / chunkBits); containerIt != containers.end(); ++containerIt) {
+        uint64_t const offset = containerIt->key * chunkBits;
+        uint64_t const position = getNextSetPosition(*containerIt, startingIndex > offset ? startingIndex - offset : 0);
+        if (position < chunkBits) {
+            return offset + position;
+        }
+    }
+    return bitCount;
+}
+
+uint64_t CompressedBitVector::size() const {
+    return bitCount;
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.positions.capacity() * sizeof(uint16_t) + container.words.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::begin() const {
+    return const_iterator(*this, getNextSetIndex(0));
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::end() const {
+    return const_iterator(*this, bitCount);
+}
+
+void CompressedBitVector::decode(Container const& container, ChunkWords& words) {
+    switch (container.kind) {
+        case ContainerKind::Bitmap:
+            std::copy(container.words.begin(), container.words.end(), words.begin());
+            break;
+        case ContainerKind::Array:
+            words.fill(0);
+            for (auto position : container.positions) {
+                words[position / 64] |= 1ull << (position % 64);
+            }
+            break;
+        case ContainerKind::Runs:
+            words.fill(0);
+            for (uint64_t run = 0; run < container.positions.size(); run += 2) {
+                for (uint64_t position = container.positions[run]; position <= container.positions[run + 1]; ++position) {
+                    words[position / 64] |= 1ull << (position % 64);
+                }
+            }
+            break;
+    }
+}
+
+CompressedBitVector::Container CompressedBitVector::encode(uint64_t key, ChunkWords const& words) {
+    Container result{key, ContainerKind::Bitmap, 0, {}, {}};
+    uint64_t numberOfRuns = 0;
+    uint64_t previousWord = 0;
+    for (auto word : words) {
+        result.cardinality += std::popcount(word);
+        // A run starts at every set bit whose predecessor is not set.
+        numberOfRuns += std::popcount(word & ~((word << 1) | (previousWord >> 63)));
+        previousWord = word;
+    }
+
+    uint64_t const arrayBytes = result.cardinality * sizeof(uint16_t);
+    uint64_t const runsBytes = numberOfRuns * 2 * sizeof(uint16_t);
+    uint64_t const bitmapBytes = wordsPerChunk * sizeof(uint64_t);
+    if (arrayBytes <= runsBytes && arrayBytes <= bitmapBytes) {
+        result.kind = ContainerKind::Array;
+        result.positions.reserve(result.cardinality);
+        for (uint64_t wordIndex = 0; wordIndex < wordsPerChunk; ++wordIndex) {
+            for (uint64_t word = words[wordIndex]; word != 0; word &= word - 1) {
+                result.positions.push_back(wordIndex * 64 + std::countr_zero(word));
+            }
+        }
+    } else if (runsBytes <= bitmapBytes) {
+        result.kind = ContainerKind::Runs;
+        result.positions.reserve(2 * numberOfRuns);
+        for (uint64_t start = detail::getNextIndexWithValue(words, 0, true); start < chunkBits;
+             start = detail::getNextIndexWithValue(words, start, true)) {
+            uint64_t const end = detail::getNextIndexWithValue(words, start, false);
+            result.positions.push_back(start);
+            result.positions.push_back(end - 1);
+            start = end;
+        }
+    } else {
+        result.words.assign(words.begin(), words.end());
+    }
+    return result;
+}
+
+uint64_t CompressedBitVector::getNextSetPosition(Container const& container, uint64_t position) {
+    switch (container.kind) {
+        case ContainerKind::Array: {
+            auto positionIt = std::lower_bound(container.positions.begin(), container.positions.end(), position);
+            return positionIt == container.positions.end() ? chunkBits : *positionIt;
+        }
+        case ContainerKind::Runs: {
+            uint64_t const run = 2 * findRun(container, position);
+            return run < container.positions.size() ? std::max<uint64_t>(container.positions[run], position) : chunkBits;
+        }
+        case ContainerKind::Bitmap: {
+            uint64_t wordIndex = position / 64;
+            if (wordIndex >= wordsPerChunk) {
+                return chunkBits;
+            }
+            uint64_t word = container.words[wordIndex] & (~0ull << (position % 64));
+            while (word == 0) {
+                if (++wordIndex == wordsPerChunk) {
+                    return chunkBits;
+                }
+                word = container.words[wordIndex];
+            }
+            return wordIndex * 64 + std::countr_zero(word);
+        }
+    }
+    STORM_LOG_ASSERT(false, "Unknown container kind.");
+    return chunkBits;
+}
+
+uint64_t CompressedBitVector::findRun(Container const& container, uint64_t position) {
+    STORM_LOG_ASSERT(container.kind == ContainerKind::Runs, "Expected a container of runs.");
+    uint64_t low = 0;
+    uint64_t high = container.positions.size() / 2;
+    while (low < high) {
+        uint64_t const middle = (low + high) / 2;
+        if (container.positions[2 * middle + 1] < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+std::vector<CompressedBitVector::Container>::const_iterator CompressedBitVector::findContainer(uint64_t key) const {
+    return std::lower_bound(containers.begin(), containers.end(), key, [](Container const& container, uint64_t key) { return container.key < key; });
+}
+
+void CompressedBitVector::appendChunk(uint64_t key, ChunkWords const& words) {
+    STORM_LOG_ASSERT(containers.empty() || containers.back().key < key, "Chunks have to be appended in ascending order.");
+    auto container = encode(key, words);
+    if (container.cardinality > 0) {
+        containers.push_back(std::move(container));
+    }
+}
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector) {
+    out << "compressed bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.size() << ") [";
+    for (auto index : bitVector) {
+        out << index << " ";
+    }
+    out << "]";
+    return out;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <iterator>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A bit vector that stores its set bits in compressed form, which pays off for sparse sets and for sets that consist of few long runs.
+ * Following the idea of roaring bitmaps, the indices are split into chunks of 2^16 bits. Each chunk that contains a set bit is stored in the smallest of
+ * three containers: a sorted array of the set positions, a plain bitmap or a list of runs of set bits. Chunks without set bits are not stored at all.
+ *
+ * Accessing single bits and iterating over the set bits is slower than for a BitVector, so hot loops should work on the dense representation obtained
+ * via toBitVector().
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * Iterates over the indices of the set bits from smallest to largest.
+     */
+    class const_iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = uint64_t const*;
+        using reference = uint64_t const&;
+
+        const_iterator(CompressedBitVector const& bitVector, uint64_t currentIndex);
+
+        const_iterator& operator++();
+        uint64_t operator*() const;
+        bool operator!=(const_iterator const& other) const;
+        bool operator==(const_iterator const& other) const;
+
+       private:
+        CompressedBitVector const* bitVector;
+        uint64_t currentIndex;
+    };
+
+    /*!
+     * Constructs an empty bit vector of length 0.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Constructs a bit vector of the given length in which no bit is set.
+     */
+    explicit CompressedBitVector(uint64_t length);
+
+    /*!
+     * Constructs a compressed bit vector with the same bits as the given (dense) bit vector.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Retrieves the dense representation of this bit vector.
+     */
+    BitVector toBitVector() const;
+
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+    /*!
+     * Sets the given bit to the given value.
+     */
+    void set(uint64_t index, bool value = true);
+
+    /*!
+     * Retrieves the value of the given bit.
+     */
+    bool get(uint64_t index) const;
+
+    /*!
+     * Performs a bitwise and with the given bit vector of the same length.
+     */
+    CompressedBitVector operator&(CompressedBitVector const& other) const;
+
+    /*!
+     * Performs a bitwise or with the given bit vector of the same length.
+     */
+    CompressedBitVector operator|(CompressedBitVector const& other) const;
+
+    /*!
+     * Retrieves the complement of this bit vector.
+     */
+    CompressedBitVector operator~() const;
+
+    /*!
+     * Retrieves whether no bit is set.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves whether all bits are set.
+     */
+    bool full() const;
+
+    uint64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the index of the first set bit that is greater or equal to the given index (or the size of the bit vector if there is no such bit).
+     */
+    uint64_t getNextSetIndex(uint64_t startingIndex) const;
+
+    /*!
+     * Retrieves the number of bits of this bit vector.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes that are occupied by this bit vector.
+     */
+    std::size_t getSizeInBytes() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    friend std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+   private:
+    static constexpr uint64_t chunkBits = 1ull << 16;
+    static constexpr uint64_t wordsPerChunk = chunkBits / 64;
+    using ChunkWords = std::array<uint64_t, wordsPerChunk>;
+
+    enum class ContainerKind : uint8_t { Array, Bitmap, Runs };
+
+    struct Container {
+        /// The index of the chunk, i.e., the set bits are in [key * 2^16, (key + 1) * 2^16).
+        uint64_t key;
+        ContainerKind kind;
+        uint32_t cardinality;
+        /// The set positions within the chunk (Array) or the first and the last position of each run (Runs).
+        std::vector<uint16_t> positions;
+        /// The bits of the chunk (Bitmap).
+        std::vector<uint64_t> words;
+    };
+
+    /*!
+     * Writes the bits of the given container to the given words.
+     */
+    static void decode(Container const& container, ChunkWords& words);
+
+    /*!
+     * Creates the smallest container for the given bits of the chunk with the given key.
+     */
+    static Container encode(uint64_t key, ChunkWords const& words);
+
+    /*!
+     * Retrieves the first position in the given container that is greater or equal to the given position (or chunkBits if there is no such position).
+     */
+    static uint64_t getNextSetPosition(Container const& container, uint64_t position);
+
+    /*!
+     * Retrieves the index of the first run of the given container whose last position is greater or equal to the given position.
+     */
+    static uint64_t findRun(Container const& container, uint64_t position);
+
+    /*!
+     * Retrieves the container with the given key or the position at which such a container would have to be inserted.
+     */
+    std::vector<Container>::const_iterator findContainer(uint64_t key) const;
+
+    /*!
+     * Adds the container for the given bits of the chunk with the given key, unless no bit is set.
+     */
+    void appendChunk(uint64_t key, ChunkWords const& words);
+
+    /*!
+     * Combines this and the given bit vector chunk by chunk with the given operation.
+     * @param unionOfChunks if true, chunks that are only present in one of the bit vectors are considered as well.
+     */
+    template<typename Operation>
+    CompressedBitVector combine(CompressedBitVector const& other, Operation const& operation, bool unionOfChunks) const;
+
+    /// The number of bits.
+    uint64_t bitCount;
+
+    /// The containers of all chunks that contain a set bit, ordered by their keys.
+    std::vector<Container> containers;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,277 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                     uint64_t bucket)
+    : map(map), bucket(bucket) {
+    while (this->bucket < map.capacity() && !map.isBucketOccupied(this->bucket)) {
+        ++this->bucket;
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+    return &map == &other.map && bucket == other.bucket;
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+    return ++(*this);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    do {
+        ++bucket;
+    } while (bucket < map.capacity() && !map.isBucketOccupied(bucket));
+    return *this;
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    return map.getBucketAndValue(bucket);
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+    while (initialSize > 0) {
+        ++currentSize;
+        initialSize >>= 1;
+    }
+
+    // Create the underlying containers.
+    buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    status = createStatus(1ull << currentSize);
+    values = std::vector<ValueType>(1ull << currentSize);
+}
+
+template<class ValueType, class Hash>
+std::unique_ptr<std::atomic<uint64_t>[]> ConcurrentBitVectorHashMap<ValueType, Hash>::createStatus(uint64_t numberOfBuckets) {
+    uint64_t numberOfWords = (numberOfBuckets + BucketsPerStatusWord - 1) / BucketsPerStatusWord;
+    auto result = std::make_unique<std::atomic<uint64_t>[]>(numberOfWords);
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        result[word].store(0, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketStatus(uint64_t bucket, std::memory_order order) const {
+    return (status[bucket / BucketsPerStatusWord].load(order) >> (2 * (bucket % BucketsPerStatusWord))) & (ClaimedBit | ReadyBit);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::waitUntilReady(uint64_t bucket) const {
+    // The thread that claimed the bucket only needs to copy the key and the value, so we do not have to wait long.
+    while ((getBucketStatus(bucket) & ReadyBit) == 0) {
+        std::this_thread::yield();
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::isBucketOccupied(uint64_t bucket) const {
+    return (getBucketStatus(bucket, std::memory_order_relaxed) & ClaimedBit) != 0;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load(std::memory_order_relaxed);
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    return 1ull << currentSize;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getMaximalNumberOfElements() const {
+    // At least one bucket always remains free, so searching for a key that is not contained terminates.
+    return std::min(static_cast<uint64_t>(loadFactor * capacity()), capacity() - 1);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize() {
+    ++currentSize;
+    STORM_LOG_TRACE("Increasing size of hash map from " << (1ull << (currentSize - 1)) << " to " << (1ull << currentSize) << ".");
+
+    // Create new containers and swap them with the old ones.
+    storm::storage::BitVector oldBuckets(bucketSize * (1ull << currentSize));
+    std::swap(oldBuckets, buckets);
+    std::unique_ptr<std::atomic<uint64_t>[]> oldStatus = createStatus(1ull << currentSize);
+    std::swap(oldStatus, status);
+    std::vector<ValueType> oldValues = std::vector<ValueType>(1ull << currentSize);
+    std::swap(oldValues, values);
+
+    // Now iterate through the elements and reinsert them in the new storage.
+    [[maybe_unused]] uint64_t oldSize = numberOfElements.load(std::memory_order_relaxed);
+    [[maybe_unused]] uint64_t newSize = 0;
+    for (uint64_t bucketIndex = 0; bucketIndex < oldValues.size(); ++bucketIndex) {
+        if (((oldStatus[bucketIndex / BucketsPerStatusWord].load(std::memory_order_relaxed) >> (2 * (bucketIndex % BucketsPerStatusWord))) & ClaimedBit) !=
+            0) {
+            findOrInsertBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+            ++newSize;
+        }
+    }
+    STORM_LOG_ASSERT(oldSize == newSize, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << newSize << ".");
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                  ValueType const& value) {
+    {
+        std::shared_lock<std::shared_mutex> lock(resizeMutex);
+        // Reserve a bucket before searching for the key. As the reservations of all concurrent insertions are counted, the load factor is never exceeded.
+        if (numberOfElements.fetch_add(1, std::memory_order_relaxed) < getMaximalNumberOfElements()) {
+            std::pair<bool, uint64_t> flagAndBucket = findOrInsertBucket(key, value);
+            if (flagAndBucket.first) {
+                // The key was already contained, so the reserved bucket is not needed.
+                numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
+            }
+            return std::make_pair(value, flagAndBucket.second);
+        }
+        numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // If the load of the map is too high, we need exclusive access to increase the size.
+    std::unique_lock<std::shared_mutex> lock(resizeMutex);
+    // Another thread might have increased the size in the meantime.
+    while (numberOfElements.load(std::memory_order_relaxed) >= getMaximalNumberOfElements()) {
+        increaseSize();
+    }
+    std::pair<bool, uint64_t> flagAndBucket = findOrInsertBucket(key, value);
+    if (flagAndBucket.first) {
+        return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
+    }
+    numberOfElements.fetch_add(1, std::memory_order_relaxed);
+    return std::make_pair(value, flagAndBucket.second);
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    std::shared_lock<std::shared_mutex> lock(resizeMutex);
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
+    return values[flagBucketPair.second];
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+    return values[bucket];
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    std::shared_lock<std::shared_mutex> lock(resizeMutex);
+    return findBucket(key).first;
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, capacity());
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getCurrentShiftWidth() const {
+    return (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - currentSize);
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+
+    while (true) {
+        uint64_t bucketStatus = getBucketStatus(bucket);
+        if ((bucketStatus & ClaimedBit) == 0) {
+            return std::make_pair(false, bucket);
+        }
+        if ((bucketStatus & ReadyBit) == 0) {
+            waitUntilReady(bucket);
+        }
+        if (buckets.matches(bucket * bucketSize, key)) {
+            return std::make_pair(true, bucket);
+        }
+        ++bucket;
+        if (bucket == (1ull << currentSize)) {
+            bucket = 0;
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrInsertBucket(storm::storage::BitVector const& key, ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t bucket = hasher(key) >> this->getCurrentShiftWidth();
+
+    while (true) {
+        uint64_t bucketStatus = getBucketStatus(bucket);
+        if ((bucketStatus & ClaimedBit) == 0) {
+            // Try to claim the bucket. If another thread was faster, we need to check whether it inserted the same key.
+            uint64_t const shift = 2 * (bucket % BucketsPerStatusWord);
+            auto& statusWord = status[bucket / BucketsPerStatusWord];
+            if ((statusWord.fetch_or(ClaimedBit << shift, std::memory_order_acq_rel) & (ClaimedBit << shift)) == 0) {
+                // Insert the new bits into the bucket. Since buckets are aligned to 64 bit words, this does not interfere with other buckets.
+                buckets.set(bucket * bucketSize, key);
+                values[bucket] = value;
+                statusWord.fetch_or(ReadyBit << shift, std::memory_order_release);
+                return std::make_pair(false, bucket);
+            }
+        }
+        waitUntilReady(bucket);
+        if (buckets.matches(bucket * bucketSize, key)) {
+            return std::make_pair(true, bucket);
+        }
+        ++bucket;
+        if (bucket == (1ull << currentSize)) {
+            bucket = 0;
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (uint64_t bucket = 0; bucket < capacity(); ++bucket) {
+        if (isBucketOccupied(bucket)) {
+            values[bucket] = remapping(values[bucket]);
+        }
+    }
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,262 @@
+#ifndef STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+#define STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A variant of the BitVectorHashMap that allows multiple threads to concurrently search and insert keys.
+ * As for the BitVectorHashMap, the keys must be bit vectors with a length that is a multiple of 64 and the storage layout is the same (keys are stored
+ * consecutively in one bit vector). The only additional memory is one bit per bucket that indicates whether the key in an occupied bucket has already
+ * been written completely.
+ *
+ * Buckets are claimed using atomic operations, i.e., insertions and queries do not block each other. Only increasing the size of the underlying
+ * storage requires exclusive access to the map, which is amortized over the insertions just like for the BitVectorHashMap.
+ *
+ * Iterating over the map, retrieving values by bucket and remapping the values must not happen concurrently to insertions.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*! Creates an iterator that points to the given bucket (or the next occupied bucket afterwards) of the given map.
+         *
+         * @param map The map of the iterator.
+         * @param bucket The index of the bucket the iterator points to.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++(int);
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // The map this iterator refers to.
+        ConcurrentBitVectorHashMap const& map;
+
+        // The bucket this iterator points to.
+        uint64_t bucket;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available.
+     * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+     * increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @note The returned bucket index is only valid until the next increase of the underlying storage, which might be triggered by any (concurrent)
+     * insertion.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the bucket into which the key
+     * was inserted.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+     *
+     * @param bucket The index of the bucket.
+     * @return The content and value of the named bucket.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined. This method may be called concurrently.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given bucket.
+     *
+     * @return The value associated with the given bucket (if any).
+     */
+    ValueType getValue(uint64_t bucket) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This method may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     * While insertions are in progress, the size might include buckets that are reserved by these insertions.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying container.
+     *
+     * @return The capacity of the underlying container.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+   private:
+    // Each bucket has two status bits: one indicating that it has been claimed by an insertion and one indicating that the key and value are written.
+    static constexpr uint64_t BucketsPerStatusWord = 32;
+    static constexpr uint64_t ClaimedBit = 1ull;
+    static constexpr uint64_t ReadyBit = 2ull;
+
+    /*!
+     * Creates the (cleared) status bits for the given number of buckets.
+     */
+    static std::unique_ptr<std::atomic<uint64_t>[]> createStatus(uint64_t numberOfBuckets);
+
+    /*!
+     * Retrieves the status bits of the given bucket.
+     */
+    uint64_t getBucketStatus(uint64_t bucket, std::memory_order order = std::memory_order_acquire) const;
+
+    /*!
+     * Waits until the key of the given (claimed) bucket has been written.
+     */
+    void waitUntilReady(uint64_t bucket) const;
+
+    /*!
+     * Retrieves whether the given bucket holds a value.
+     *
+     * @param bucket The bucket to check.
+     * @return True iff the bucket is occupied.
+     */
+    bool isBucketOccupied(uint64_t bucket) const;
+
+    /*!
+     * Searches for the bucket with the given key.
+     * The caller needs to hold (at least) a shared lock of the resize mutex.
+     *
+     * @param key The key to search for.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose
+     * second component indicates in which bucket the key is stored.
+     */
+    std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Searches for the bucket with the given key. If the key is not found, it is inserted with the given value into the first free bucket.
+     * The caller needs to hold (at least) a shared lock of the resize mutex and has to account for the inserted key in the number of elements.
+     *
+     * @param key The key to search for.
+     * @param value The value to insert.
+     * @return A pair whose first component indicates whether the key was already contained in the map and whose
+     * second component indicates in which bucket the key is stored.
+     */
+    std::pair<bool, uint64_t> findOrInsertBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Increases the size of the hash map and performs the necessary rehashing of all entries.
+     * The caller needs to hold an exclusive lock of the resize mutex.
+     */
+    void increaseSize();
+
+    /*!
+     * Determines the number of elements (including reserved buckets) up to which insertions may proceed without increasing the size.
+     */
+    uint64_t getMaximalNumberOfElements() const;
+
+    /*!
+     * Determines the number of bits by which the hash value must be shifted to obtain a value in the legal range.
+     */
+    uint64_t getCurrentShiftWidth() const;
+
+    // The load factor determining when the size of the map is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The number of buckets is 2^currentSize.
+    uint64_t currentSize;
+
+    // The buckets that hold the elements of the map. Distinct buckets occupy distinct 64 bit words, so they can be written concurrently.
+    storm::storage::BitVector buckets;
+
+    // The status bits of the buckets.
+    std::unique_ptr<std::atomic<uint64_t>[]> status;
+
+    // A vector of the mapped-to values. The entry at position i is the "target" of the key in bucket i.
+    std::vector<ValueType> values;
+
+    // The number of elements in this map plus the number of buckets that are currently reserved by insertions.
+    std::atomic<uint64_t> numberOfElements;
+
+    // Insertions and queries hold a shared lock, increasing the size of the storage requires an exclusive lock.
+    mutable std::shared_mutex resizeMutex;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
+
+#endif /* STORM_STORAGE_CONCURRENTBITVECTORHASHMAP_H_ */
@@ -67,6 +67,13 @@ void FlexibleSparseMatrix<ValueType>::reserveInRow(index_type row, index_type nu
     this->data[row].reserve(numberOfElements);
 }
 
+template<typename ValueType>
+void FlexibleSparseMatrix<ValueType>::appendEmptyRowsAndColumns(index_type numberOfRows) {
+    STORM_LOG_THROW(hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException, "Can only append rows to a matrix with trivial row grouping.");
+    this->data.resize(this->data.size() + numberOfRows);
+    this->columnCount += numberOfRows;
+}
+
 template<typename ValueType>
 typename FlexibleSparseMatrix<ValueType>::row_type& FlexibleSparseMatrix<ValueType>::getRow(index_type index) {
     return this->data[index];
@@ -56,6 +56,12 @@ class FlexibleSparseMatrix {
      */
     void reserveInRow(index_type row, index_type numberOfElements);
 
+    /*!
+     * Appends empty rows and equally many columns to the matrix, which needs to have a trivial row grouping.
+     * @param numberOfRows Number of rows (and columns) to append.
+     */
+    void appendEmptyRowsAndColumns(index_type numberOfRows);
+
     /*!
      * Returns an object representing the given row.
      *
@@ -1,9 +1,13 @@
 #include <algorithm>
+#include <iterator>
 #include <sstream>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/graph.h"
@@ -11,6 +15,108 @@
 namespace storm {
 namespace storage {
 
+namespace detail {
+// Refining the unstable SCCs concurrently only pays off if there is enough work to distribute.
+uint64_t const minimalNumberOfStatesForParallelRefinement = 1 << 14;
+
+/*!
+ * Computes the MECs of the sub-model given by the states of a single SCC (or MEC) and the given choices.
+ * The sub-model is copied into a compact matrix so that the decomposition does not touch the remainder of the (potentially huge) model.
+ *
+ * @param subsystemStates The states of the sub-model in ascending order. Every selected choice of these states must stay within these states.
+ * @param candidates The states that might still be on an end component.
+ * @param choices The choices that might still be part of an end component.
+ * @param globalToLocal Scratch memory with one entry per state of the model. Only the entries of the subsystem states are written.
+ */
+template<typename ValueType>
+std::vector<MaximalEndComponent> decomposeSubsystem(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                    std::vector<uint64_t> const& subsystemStates, storm::storage::BitVector const& candidates,
+                                                    storm::storage::BitVector const& choices, std::vector<uint64_t>& globalToLocal) {
+    uint64_t numRows = 0;
+    for (uint64_t localState = 0; localState < subsystemStates.size(); ++localState) {
+        globalToLocal[subsystemStates[localState]] = localState;
+        numRows += transitionMatrix.getRowGroupSize(subsystemStates[localState]);
+    }
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, subsystemStates.size(), 0, true, true, subsystemStates.size());
+    storm::storage::BitVector localCandidates(subsystemStates.size(), false);
+    storm::storage::BitVector localChoices(numRows, false);
+    std::vector<uint64_t> localToGlobalChoice;
+    localToGlobalChoice.reserve(numRows);
+    uint64_t localRow = 0;
+    for (uint64_t localState = 0; localState < subsystemStates.size(); ++localState) {
+        auto const state = subsystemStates[localState];
+        localCandidates.set(localState, candidates.get(state));
+        builder.newRowGroup(localRow);
+        for (auto const choice : transitionMatrix.getRowGroupIndices(state)) {
+            // Choices that can not be part of an end component are kept as empty rows to preserve the choice indices within each state.
+            if (choices.get(choice)) {
+                localChoices.set(localRow, true);
+                for (auto const& entry : transitionMatrix.getRow(choice)) {
+                    if (storm::utility::isZero(entry.getValue())) {
+                        continue;
+                    }
+                    STORM_LOG_ASSERT(std::binary_search(subsystemStates.begin(), subsystemStates.end(), entry.getColumn()),
+                                     "Choice " << choice << " leaves the subsystem.");
+                    builder.addNextValue(localRow, globalToLocal[entry.getColumn()], entry.getValue());
+                }
+            }
+            localToGlobalChoice.push_back(choice);
+            ++localRow;
+        }
+    }
+    auto localMatrix = builder.build();
+    MaximalEndComponentDecomposition<ValueType> localMecs(localMatrix, localMatrix.transpose(true), localCandidates, localChoices);
+
+    // Translate the MECs back to the original model.
+    std::vector<MaximalEndComponent> result;
+    result.reserve(localMecs.size());
+    for (auto const& localMec : localMecs) {
+        MaximalEndComponent mec;
+        for (auto const& [localState, localStateChoices] : localMec) {
+            MaximalEndComponent::set_type stateChoices;
+            for (auto const localChoice : localStateChoices) {
+                stateChoices.insert(localToGlobalChoice[localChoice]);
+            }
+            mec.addState(subsystemStates[localState], std::move(stateChoices));
+        }
+        result.push_back(std::move(mec));
+    }
+    return result;
+}
+
+/*!
+ * Computes the MECs of each of the given (pairwise disjoint) sub-models. If enabled, the sub-models are processed concurrently.
+ *
+ * @return the MECs of each sub-model (in the order of the given sub-models).
+ */
+template<typename ValueType>
+std::vector<std::vector<MaximalEndComponent>> decomposeSubsystems(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                  std::vector<std::vector<uint64_t>> const& subsystems,
+                                                                  storm::storage::BitVector const& candidates, storm::storage::BitVector const& choices,
+                                                                  bool parallel) {
+    std::vector<std::vector<MaximalEndComponent>> result(subsystems.size());
+    // The subsystems are disjoint, so the tasks write to disjoint entries of the scratch memory.
+    std::vector<uint64_t> globalToLocal(transitionMatrix.getRowGroupCount());
+    if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, subsystems.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                result[index] = decomposeSubsystem(transitionMatrix, subsystems[index], candidates, choices, globalToLocal);
+            }
+        });
+        return result;
+#else
+        STORM_LOG_WARN("Refining end components in parallel requires Intel TBB. Falling back to sequential refinement.");
+#endif
+    }
+    for (uint64_t index = 0; index < subsystems.size(); ++index) {
+        result[index] = decomposeSubsystem(transitionMatrix, subsystems[index], candidates, choices, globalToLocal);
+    }
+    return result;
+}
+}  // namespace detail
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition() : Decomposition() {
     // Intentionally left empty.
@@ -20,7 +126,7 @@ template<typename ValueType>
 template<typename RewardModelType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
     storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), *model.getBackwardTransitions());
 }
 
 template<typename ValueType>
@@ -44,10 +150,19 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(st
     performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices);
 }
 
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& states,
+                                                                              storm::storage::BitVector const& choices,
+                                                                              SccDecompositionMemoryCache& sccDecompositionCache) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices, sccDecompositionCache);
+}
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
                                                                               storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), states);
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), *model.getBackwardTransitions(), states);
 }
 
 template<typename ValueType>
@@ -110,15 +225,18 @@ template<typename ValueType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                           storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                           storm::OptionalRef<storm::storage::BitVector const> states,
-                                                                                          storm::OptionalRef<storm::storage::BitVector const> choices) {
+                                                                                          storm::OptionalRef<storm::storage::BitVector const> choices,
+                                                                                          storm::OptionalRef<SccDecompositionMemoryCache> sccCache) {
     // Get some data for convenient access.
     auto const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
     storm::storage::BitVector remainingEcCandidates, ecChoices;
     SccDecompositionResult sccDecRes;
-    SccDecompositionMemoryCache sccDecCache;
+    SccDecompositionMemoryCache localSccDecCache;
+    SccDecompositionMemoryCache& sccDecCache = sccCache ? *sccCache : localSccDecCache;
     StronglyConnectedComponentDecompositionOptions sccDecOptions;
-    sccDecOptions.dropNaiveSccs();
+    bool const parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    sccDecOptions.dropNaiveSccs().parallel(parallel);
     if (states) {
         sccDecOptions.subsystem(*states);
     }
@@ -161,11 +279,18 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
 
         // process the MECs that we've found, i.e. SCCs where every state can stay inside the SCC
         ecSccIndices &= nonTrivSccIndices;
-        for (auto sccIndex : ecSccIndices) {
-            MaximalEndComponent newMec;
+        if (!ecSccIndices.empty()) {
+            // Collect the states of all new MECs within a single pass over the candidates.
+            uint64_t const noMec = std::numeric_limits<uint64_t>::max();
+            std::vector<uint64_t> sccToMecIndex(sccDecRes.sccCount, noMec);
+            for (auto sccIndex : ecSccIndices) {
+                sccToMecIndex[sccIndex] = this->blocks.size();
+                this->blocks.emplace_back();
+            }
             for (auto state : remainingEcCandidates) {
-                // skip states from different SCCs
-                if (sccDecRes.stateToSccMapping[state] != sccIndex) {
+                auto const mecIndex = sccToMecIndex[sccDecRes.stateToSccMapping[state]];
+                // skip states from SCCs that are not stable yet
+                if (mecIndex == noMec) {
                     continue;
                 }
                 // This is no longer a candidate
@@ -177,9 +302,8 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
                     containedChoices.insert(*ecChoiceIt);
                 }
                 STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
-                newMec.addState(state, std::move(containedChoices));
+                this->blocks[mecIndex].addState(state, std::move(containedChoices));
             }
-            this->blocks.emplace_back(std::move(newMec));
         }
 
         if (nonTrivSccIndices == ecSccIndices) {
@@ -187,6 +311,32 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
             break;
         }
 
+        if (parallel && remainingEcCandidates.getNumberOfSetBits() >= detail::minimalNumberOfStatesForParallelRefinement) {
+            // Every remaining choice stays within its SCC. Hence, the unstable SCCs can be refined independently of each other.
+            uint64_t const noSubsystem = std::numeric_limits<uint64_t>::max();
+            std::vector<uint64_t> sccToSubsystem(sccDecRes.sccCount, noSubsystem);
+            std::vector<std::vector<uint64_t>> subsystems;
+            for (auto sccIndex : nonTrivSccIndices) {
+                if (!ecSccIndices.get(sccIndex)) {
+                    sccToSubsystem[sccIndex] = subsystems.size();
+                    subsystems.emplace_back();
+                }
+            }
+            if (subsystems.size() > 1) {
+                // States that can not stay in their SCC are still needed as the targets of the remaining choices.
+                for (auto state : sccDecRes.nonTrivialStates) {
+                    auto const subsystemIndex = sccToSubsystem[sccDecRes.stateToSccMapping[state]];
+                    if (subsystemIndex != noSubsystem) {
+                        subsystems[subsystemIndex].push_back(state);
+                    }
+                }
+                for (auto& subsystemMecs : detail::decomposeSubsystems(transitionMatrix, subsystems, remainingEcCandidates, ecChoices, true)) {
+                    std::move(subsystemMecs.begin(), subsystemMecs.end(), std::back_inserter(this->blocks));
+                }
+                break;
+            }
+        }
+
         // prepare next iteration.
         // It suffices to keep the candidates that have the possibility to always stay in the candidate set
         remainingEcCandidates = storm::utility::graph::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions,
@@ -199,6 +349,58 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
 }
 
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::updateForRemovedChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                          storm::storage::BitVector const& removedChoices) {
+    // Find the MECs that lost a choice. Every end component of the restricted model is contained in one of the original MECs.
+    std::vector<uint64_t> affectedMecs;
+    std::vector<std::vector<uint64_t>> subsystems;
+    storm::storage::BitVector candidates(transitionMatrix.getRowGroupCount(), false);
+    storm::storage::BitVector choices(transitionMatrix.getRowCount(), false);
+    for (uint64_t mecIndex = 0; mecIndex < this->blocks.size(); ++mecIndex) {
+        auto const& mec = this->blocks[mecIndex];
+        if (std::none_of(mec.begin(), mec.end(), [&removedChoices](auto const& stateChoices) {
+                auto const& choicesOfState = stateChoices.second;
+                return std::any_of(choicesOfState.begin(), choicesOfState.end(), [&removedChoices](auto choice) { return removedChoices.get(choice); });
+            })) {
+            continue;
+        }
+        affectedMecs.push_back(mecIndex);
+        auto& subsystem = subsystems.emplace_back();
+        for (auto const& [state, stateChoices] : mec) {
+            subsystem.push_back(state);
+            candidates.set(state, true);
+            for (auto const choice : stateChoices) {
+                choices.set(choice, !removedChoices.get(choice));
+            }
+        }
+        std::sort(subsystem.begin(), subsystem.end());
+    }
+    if (affectedMecs.empty()) {
+        return;
+    }
+
+    bool const parallel = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && affectedMecs.size() > 1 &&
+                          candidates.getNumberOfSetBits() >= detail::minimalNumberOfStatesForParallelRefinement;
+    auto refinedMecs = detail::decomposeSubsystems(transitionMatrix, subsystems, candidates, choices, parallel);
+
+    // Replace each affected MEC by its refinement.
+    std::vector<MaximalEndComponent> newBlocks;
+    newBlocks.reserve(this->blocks.size());
+    auto affectedIt = affectedMecs.begin();
+    for (uint64_t mecIndex = 0; mecIndex < this->blocks.size(); ++mecIndex) {
+        if (affectedIt != affectedMecs.end() && *affectedIt == mecIndex) {
+            auto& refinement = refinedMecs[affectedIt - affectedMecs.begin()];
+            std::move(refinement.begin(), refinement.end(), std::back_inserter(newBlocks));
+            ++affectedIt;
+        } else {
+            newBlocks.push_back(std::move(this->blocks[mecIndex]));
+        }
+    }
+    this->blocks = std::move(newBlocks);
+    STORM_LOG_DEBUG("Updated MEC decomposition has " << this->size() << " MEC(s) after refining " << affectedMecs.size() << " MEC(s).");
+}
+
 // Explicitly instantiate the MEC decomposition.
 template class MaximalEndComponentDecomposition<double>;
 template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
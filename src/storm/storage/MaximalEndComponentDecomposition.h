@@ -9,6 +9,8 @@
 
 namespace storm::storage {
 
+struct SccDecompositionMemoryCache;
+
 /*!
  * This class represents the decomposition of a nondeterministic model into its maximal end components.
  */
@@ -62,6 +64,20 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
                                      storm::storage::BitVector const& choices);
 
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix), where the memory of the underlying SCC
+     * decompositions is taken from the given cache. Reusing the cache for several decompositions avoids re-allocations.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransition The reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     * @param choices The choices of the subsystem to decompose.
+     * @param sccDecompositionCache Memory used by the SCC decompositions.
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
+                                     storm::storage::BitVector const& choices, SccDecompositionMemoryCache& sccDecompositionCache);
+
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
@@ -105,6 +121,15 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      */
     std::string statistics(uint64_t totalNumberOfStates) const;
 
+    /*!
+     * Updates the decomposition after the given choices have been removed from the underlying model. Removing choices can only split or shrink
+     * MECs, so only the MECs that contain a removed choice are recomputed. All other MECs are kept as they are.
+     *
+     * @param transitionMatrix The transition matrix of the model that this decomposition was computed for.
+     * @param removedChoices The choices that are no longer available.
+     */
+    void updateForRemovedChoices(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& removedChoices);
+
    private:
     /*!
      * Performs the actual decomposition of the given subsystem in the given model into MECs. Stores the MECs found in the current decomposition.
@@ -113,11 +138,13 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * @param backwardTransitions The reversed transition relation.
      * @param states The states of the subsystem to decompose. If not given, all states are considered.
      * @param choices The choices of the subsystem to decompose. If not given, all choices are considered.
+     * @param sccCache Memory used by the SCC decompositions. If not given, new memory is allocated.
      *
      */
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                  storm::OptionalRef<storm::storage::BitVector const> states = storm::NullRef,
-                                                 storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef);
+                                                 storm::OptionalRef<storm::storage::BitVector const> choices = storm::NullRef,
+                                                 storm::OptionalRef<SccDecompositionMemoryCache> sccCache = storm::NullRef);
 };
 }  // namespace storm::storage
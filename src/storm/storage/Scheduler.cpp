@@ -15,7 +15,12 @@ template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure)
     : memoryStructure(memoryStructure) {
     uint_fast64_t numOfMemoryStates = memoryStructure ? memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    if (memoryStructure) {
+        schedulerChoices =
+            std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    } else {
+        compactScheduler.emplace(numberOfModelStates);
+    }
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
@@ -26,15 +31,39 @@ template<typename ValueType>
 Scheduler<ValueType>::Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure)
     : memoryStructure(std::move(memoryStructure)) {
     uint_fast64_t numOfMemoryStates = this->memoryStructure ? this->memoryStructure->getNumberOfStates() : 1;
-    schedulerChoices = std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    if (this->memoryStructure) {
+        schedulerChoices =
+            std::vector<std::vector<SchedulerChoice<ValueType>>>(numOfMemoryStates, std::vector<SchedulerChoice<ValueType>>(numberOfModelStates));
+    } else {
+        compactScheduler.emplace(numberOfModelStates);
+    }
     dontCareStates = std::vector<storm::storage::BitVector>(numOfMemoryStates, storm::storage::BitVector(numberOfModelStates, false));
     numOfUndefinedChoices = numOfMemoryStates * numberOfModelStates;
     numOfDeterministicChoices = 0;
     numOfDontCareStates = 0;
 }
 
+template<typename ValueType>
+Scheduler<ValueType>::Scheduler(CompactScheduler&& compactScheduler) : compactScheduler(std::move(compactScheduler)) {
+    uint_fast64_t numberOfModelStates = this->compactScheduler->getNumberOfStates();
+    dontCareStates = std::vector<storm::storage::BitVector>(1, storm::storage::BitVector(numberOfModelStates, false));
+    numOfDeterministicChoices = this->compactScheduler->getStatesWithDefinedChoice().getNumberOfSetBits();
+    numOfUndefinedChoices = numberOfModelStates - numOfDeterministicChoices;
+    numOfDontCareStates = 0;
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
+    if (compactScheduler) {
+        if (!choice.isDefined()) {
+            clearChoice(modelState, memoryState);
+            return;
+        } else if (choice.isDeterministic()) {
+            setChoice(choice.getDeterministicChoice(), modelState, memoryState);
+            return;
+        }
+        convertToGeneralRepresentation();
+    }
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
     STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
 
@@ -64,11 +93,25 @@ void Scheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, u
     schedulerChoice = choice;
 }
 
+template<typename ValueType>
+void Scheduler<ValueType>::setChoice(uint64_t choice, uint_fast64_t modelState, uint_fast64_t memoryState) {
+    if (!compactScheduler) {
+        setChoice(SchedulerChoice<ValueType>(choice), modelState, memoryState);
+        return;
+    }
+    STORM_LOG_ASSERT(memoryState == 0, "Illegal memory state index");
+    if (!compactScheduler->isChoiceDefined(modelState)) {
+        assert(numOfUndefinedChoices > 0);
+        --numOfUndefinedChoices;
+        ++numOfDeterministicChoices;
+    }
+    compactScheduler->setChoice(choice, modelState);
+}
+
 template<typename ValueType>
 bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uint64_t memoryState) const {
     for (auto selectedState : selectedStates) {
-        auto& schedulerChoice = schedulerChoices[memoryState][selectedState];
-        if (!schedulerChoice.isDefined()) {
+        if (!isChoiceDefined(selectedState, memoryState)) {
             return false;
         }
     }
@@ -78,25 +121,87 @@ bool Scheduler<ValueType>::isChoiceSelected(BitVector const& selectedStates, uin
 template<typename ValueType>
 void Scheduler<ValueType>::clearChoice(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
-    setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
+    STORM_LOG_ASSERT(modelState < getNumberOfModelStates(), "Illegal model state index");
+    if (compactScheduler) {
+        if (compactScheduler->isChoiceDefined(modelState)) {
+            assert(numOfDeterministicChoices > 0);
+            --numOfDeterministicChoices;
+            ++numOfUndefinedChoices;
+            compactScheduler->clearChoice(modelState);
+        }
+    } else {
+        setChoice(SchedulerChoice<ValueType>(), modelState, memoryState);
+    }
 }
 
 template<typename ValueType>
 SchedulerChoice<ValueType> const& Scheduler<ValueType>::getChoice(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    convertToGeneralRepresentation();
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
     STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
     return schedulerChoices[memoryState][modelState];
 }
 
+template<typename ValueType>
+bool Scheduler<ValueType>::isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
+    STORM_LOG_ASSERT(modelState < getNumberOfModelStates(), "Illegal model state index");
+    if (compactScheduler) {
+        return compactScheduler->isChoiceDefined(modelState);
+    } else {
+        return schedulerChoices[memoryState][modelState].isDefined();
+    }
+}
+
+template<typename ValueType>
+bool Scheduler<ValueType>::hasCompactRepresentation() const {
+    return compactScheduler.has_value();
+}
+
+template<typename ValueType>
+CompactScheduler const& Scheduler<ValueType>::getCompactRepresentation() const {
+    STORM_LOG_ASSERT(hasCompactRepresentation(), "The scheduler is not stored in the compact representation.");
+    return *compactScheduler;
+}
+
+template<typename ValueType>
+void Scheduler<ValueType>::convertToGeneralRepresentation() const {
+    if (!compactScheduler) {
+        return;
+    }
+    STORM_LOG_TRACE("Converting the compact scheduler representation to the general representation.");
+    schedulerChoices.assign(1, std::vector<SchedulerChoice<ValueType>>(compactScheduler->getNumberOfStates()));
+    for (auto modelState : compactScheduler->getStatesWithDefinedChoice()) {
+        schedulerChoices.front()[modelState] = SchedulerChoice<ValueType>(compactScheduler->getChoice(modelState));
+    }
+    compactScheduler.reset();
+}
+
+template<typename ValueType>
+SchedulerChoice<ValueType> Scheduler<ValueType>::getChoiceForPrinting(uint_fast64_t modelState, uint_fast64_t memoryState) const {
+    if (compactScheduler) {
+        if (compactScheduler->isChoiceDefined(modelState)) {
+            return SchedulerChoice<ValueType>(compactScheduler->getChoice(modelState));
+        } else {
+            return SchedulerChoice<ValueType>();
+        }
+    } else {
+        return schedulerChoices[memoryState][modelState];
+    }
+}
+
+template<typename ValueType>
+uint_fast64_t Scheduler<ValueType>::getNumberOfModelStates() const {
+    return compactScheduler ? compactScheduler->getNumberOfStates() : schedulerChoices.front().size();
+}
+
 template<typename ValueType>
 void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t memoryState, bool setArbitraryChoice) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < getNumberOfModelStates(), "Illegal model state index");
 
     if (!dontCareStates[memoryState].get(modelState)) {
-        auto& schedulerChoice = schedulerChoices[memoryState][modelState];
-        if (!schedulerChoice.isDefined() && setArbitraryChoice) {
+        if (!isChoiceDefined(modelState, memoryState) && setArbitraryChoice) {
             // Set an arbitrary choice
             this->setChoice(0, modelState, memoryState);
         }
@@ -108,7 +213,7 @@ void Scheduler<ValueType>::setDontCare(uint_fast64_t modelState, uint_fast64_t m
 template<typename ValueType>
 void Scheduler<ValueType>::unSetDontCare(uint_fast64_t modelState, uint_fast64_t memoryState) {
     STORM_LOG_ASSERT(memoryState < getNumberOfMemoryStates(), "Illegal memory state index");
-    STORM_LOG_ASSERT(modelState < schedulerChoices[memoryState].size(), "Illegal model state index");
+    STORM_LOG_ASSERT(modelState < getNumberOfModelStates(), "Illegal model state index");
 
     if (dontCareStates[memoryState].get(modelState)) {
         dontCareStates[memoryState].set(modelState, false);
@@ -126,6 +231,18 @@ storm::storage::BitVector Scheduler<ValueType>::computeActionSupport(std::vector
     auto nrActions = nondeterministicChoiceIndices.back();
     storm::storage::BitVector result(nrActions);
 
+    if (compactScheduler) {
+        STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 1 == compactScheduler->getNumberOfStates(), "Illegal model state index");
+        for (auto stateId : compactScheduler->getStatesWithDefinedChoice()) {
+            uint64_t const choice = compactScheduler->getChoice(stateId);
+            STORM_LOG_ASSERT(choice < nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId],
+                             "Scheduler chooses action indexed " << choice << " in state id " << stateId << " but state contains only "
+                                                                 << nondeterministicChoiceIndices[stateId + 1] - nondeterministicChoiceIndices[stateId]
+                                                                 << " choices .");
+            result.set(nondeterministicChoiceIndices[stateId] + choice);
+        }
+        return result;
+    }
     for (auto const& choicesPerMemoryNode : schedulerChoices) {
         STORM_LOG_ASSERT(nondeterministicChoiceIndices.size() - 2 < choicesPerMemoryNode.size(), "Illegal model state index");
         for (uint64_t stateId = 0; stateId < nondeterministicChoiceIndices.size() - 1; ++stateId) {
@@ -148,7 +265,7 @@ bool Scheduler<ValueType>::isPartialScheduler() const {
 
 template<typename ValueType>
 bool Scheduler<ValueType>::isDeterministicScheduler() const {
-    return numOfDeterministicChoices == (schedulerChoices.size() * schedulerChoices.begin()->size()) - numOfUndefinedChoices;
+    return numOfDeterministicChoices == (getNumberOfMemoryStates() * getNumberOfModelStates()) - numOfUndefinedChoices;
 }
 
 template<typename ValueType>
@@ -169,15 +286,15 @@ boost::optional<storm::storage::MemoryStructure> const& Scheduler<ValueType>::ge
 template<typename ValueType>
 void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                          bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == getNumberOfModelStates(), storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
 
     bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
     bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
     bool const choiceOriginsGiven = model != nullptr && model->hasChoiceOrigins();
-    uint_fast64_t widthOfStates = std::to_string(schedulerChoices.front().size()).length();
+    uint_fast64_t widthOfStates = std::to_string(getNumberOfModelStates()).length();
     if (stateValuationsGiven) {
-        widthOfStates += model->getStateValuations().getStateInfo(schedulerChoices.front().size() - 1).length() + 5;
+        widthOfStates += model->getStateValuations().getStateInfo(getNumberOfModelStates() - 1).length() + 5;
     }
     widthOfStates = std::max(widthOfStates, (uint_fast64_t)12);
     uint_fast64_t numOfSkippedStatesWithUniqueChoice = 0;
@@ -193,7 +310,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
     out << std::setw(widthOfStates) << "model state:" << "    " << (isMemorylessScheduler() ? "" : " memory:     ") << "choice(s)"
         << (isMemorylessScheduler() ? "" : "     memory updates:     ") << '\n';
-    for (uint_fast64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    for (uint_fast64_t state = 0; state < getNumberOfModelStates(); ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             ++numOfSkippedStatesWithUniqueChoice;
@@ -228,7 +345,7 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
             }
 
             // Print choice info
-            SchedulerChoice<ValueType> const& choice = schedulerChoices[memoryState][state];
+            SchedulerChoice<ValueType> const choice = getChoiceForPrinting(state, memoryState);
             if (choice.isDefined()) {
                 if (choice.isDeterministic()) {
                     if (choiceOriginsGiven) {
@@ -304,11 +421,11 @@ void Scheduler<ValueType>::printToStream(std::ostream& out, std::shared_ptr<stor
 template<typename ValueType>
 void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> model, bool skipUniqueChoices,
                                              bool skipDontCareStates) const {
-    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == schedulerChoices.front().size(), storm::exceptions::InvalidOperationException,
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == getNumberOfModelStates(), storm::exceptions::InvalidOperationException,
                     "The given model is not compatible with this scheduler.");
     STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
     storm::json<storm::RationalNumber> output;
-    for (uint64_t state = 0; state < schedulerChoices.front().size(); ++state) {
+    for (uint64_t state = 0; state < getNumberOfModelStates(); ++state) {
         // Check whether the state is skipped
         if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
             continue;
@@ -331,7 +448,7 @@ void Scheduler<ValueType>::printJsonToStream(std::ostream& out, std::shared_ptr<
                 stateChoicesJson["m"] = memoryState;
             }
 
-            auto const& choice = schedulerChoices[memoryState][state];
+            auto const choice = getChoiceForPrinting(state, memoryState);
             storm::json<storm::RationalNumber> choicesJson;
             if (choice.isDefined()) {
                 for (auto const& choiceProbPair : choice.getChoiceAsDistribution()) {
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include "storm/storage/BitVector.h"
+#include "storm/storage/CompactScheduler.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
 
@@ -13,6 +15,10 @@ namespace storage {
  * This class defines which action is chosen in a particular state of a non-deterministic model. More concretely, a scheduler maps a state s to i
  * if the scheduler takes the i-th action available in s (i.e. the choices are relative to the states).
  * A Choice can be undefined, deterministic
+ *
+ * As long as the scheduler is memoryless and all choices are deterministic, the choices are stored compactly (see CompactScheduler). The general
+ * representation (a distribution over choices for each state) is only created once it is needed, i.e., if a randomized choice is set or if a choice is
+ * accessed via getChoice. As this might happen in const methods, concurrent accesses to a scheduler in the compact representation are not thread-safe.
  */
 template<typename ValueType>
 class Scheduler {
@@ -26,6 +32,11 @@ class Scheduler {
     Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure> const& memoryStructure = boost::none);
     Scheduler(uint_fast64_t numberOfModelStates, boost::optional<storm::storage::MemoryStructure>&& memoryStructure);
 
+    /*!
+     * Initializes a memoryless deterministic scheduler with the given choices.
+     */
+    explicit Scheduler(CompactScheduler&& compactScheduler);
+
     /*!
      * Sets the choice defined by the scheduler for the given state.
      *
@@ -35,6 +46,15 @@ class Scheduler {
      */
     void setChoice(SchedulerChoice<ValueType> const& choice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
 
+    /*!
+     * Sets the given deterministic choice for the given state. Same as setChoice(SchedulerChoice(choice), ...) but keeps the compact representation.
+     *
+     * @param choice The (local) index of the choice to set for the given state.
+     * @param modelState The state of the model for which to set the choice.
+     * @param memoryState The state of the memoryStructure for which to set the choice.
+     */
+    void setChoice(uint64_t choice, uint_fast64_t modelState, uint_fast64_t memoryState = 0);
+
     /*!
      * Is the scheduler defined on the states indicated by the selected-states bitvector?
      */
@@ -56,6 +76,22 @@ class Scheduler {
      */
     SchedulerChoice<ValueType> const& getChoice(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
 
+    /*!
+     * Is the choice for the given model and memory state defined? Does not require the general representation of the scheduler.
+     */
+    bool isChoiceDefined(uint_fast64_t modelState, uint_fast64_t memoryState = 0) const;
+
+    /*!
+     * Retrieves whether the choices are (still) stored in the compact representation.
+     */
+    bool hasCompactRepresentation() const;
+
+    /*!
+     * Retrieves the compact representation of the choices.
+     * @pre hasCompactRepresentation() holds.
+     */
+    CompactScheduler const& getCompactRepresentation() const;
+
     /*!
      * Set the combination of model state and memoryStructure state to dontCare.
      * These states are considered unreachable and are ignored when printing the scheduler.
@@ -115,7 +151,14 @@ class Scheduler {
      */
     template<typename NewValueType>
     Scheduler<NewValueType> toValueType() const {
-        uint_fast64_t numModelStates = schedulerChoices.front().size();
+        if (compactScheduler) {
+            Scheduler<NewValueType> newScheduler{CompactScheduler(*compactScheduler)};
+            for (auto modelState : dontCareStates.front()) {
+                newScheduler.setDontCare(modelState, 0, false);
+            }
+            return newScheduler;
+        }
+        uint_fast64_t numModelStates = getNumberOfModelStates();
         Scheduler<NewValueType> newScheduler(numModelStates, memoryStructure);
         for (uint_fast64_t memState = 0; memState < this->getNumberOfMemoryStates(); ++memState) {
             for (uint_fast64_t modelState = 0; modelState < numModelStates; ++modelState) {
@@ -150,8 +193,22 @@ class Scheduler {
                            bool skipDontCareStates = false) const;
 
    private:
+    /*!
+     * Creates the general representation of the choices from the compact one (if not already done).
+     */
+    void convertToGeneralRepresentation() const;
+
+    /*!
+     * Retrieves the choice for the given state without converting to the general representation.
+     */
+    SchedulerChoice<ValueType> getChoiceForPrinting(uint_fast64_t modelState, uint_fast64_t memoryState) const;
+
+    uint_fast64_t getNumberOfModelStates() const;
+
     boost::optional<storm::storage::MemoryStructure> memoryStructure;
-    std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
+    // Only one of the two representations of the choices is used at a time.
+    mutable std::optional<CompactScheduler> compactScheduler;
+    mutable std::vector<std::vector<SchedulerChoice<ValueType>>> schedulerChoices;
     std::vector<storm::storage::BitVector> dontCareStates;
     uint_fast64_t numOfUndefinedChoices;
     uint_fast64_t numOfDeterministicChoices;
@@ -5,6 +5,7 @@
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/utility/AlignedAllocator.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/permutation.h"
@@ -101,17 +102,21 @@ SparseMatrixBuilder<ValueType>::SparseMatrixBuilder(index_type rows, index_type
       highestColumn(0),
       currentRowGroupCount(0) {
     // Prepare the internal storage.
+    // For large matrices, huge pages are requested before the reserved memory is touched.
     if (initialRowCountSet) {
         rowIndications.reserve(initialRowCount + 1);
+        storm::utility::adviseHugePages(rowIndications);
     }
     if (initialEntryCountSet) {
         columnsAndValues.reserve(initialEntryCount);
+        storm::utility::adviseHugePages(columnsAndValues);
     }
     if (hasCustomRowGrouping) {
         rowGroupIndices = std::vector<index_type>();
     }
     if (initialRowGroupCountSet && hasCustomRowGrouping) {
         rowGroupIndices.get().reserve(initialRowGroupCount + 1);
+        storm::utility::adviseHugePages(rowGroupIndices.get());
     }
     rowIndications.push_back(0);
 }
@@ -349,6 +354,10 @@ SparseMatrix<ValueType> SparseMatrixBuilder<ValueType>::build(index_type overrid
         }
     }
 
+    if (!initialEntryCountSet) {
+        // The memory was already touched while growing, but its pages may still be collapsed into huge pages.
+        storm::utility::adviseHugePages(columnsAndValues);
+    }
     return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
 }
 
@@ -794,6 +803,14 @@ std::vector<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType
     return result;
 }
 
+template<typename ValueType>
+std::pair<std::vector<typename SparseMatrix<ValueType>::index_type>, std::vector<MatrixEntry<typename SparseMatrix<ValueType>::index_type, ValueType>>>
+SparseMatrix<ValueType>::releaseRowsAndEntries() {
+    auto result = std::make_pair(std::move(rowIndications), std::move(columnsAndValues));
+    *this = SparseMatrix<ValueType>();
+    return result;
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::setRowGroupIndices(std::vector<index_type> const& newRowGroupIndices) {
     trivialRowGrouping = false;
@@ -1523,6 +1540,77 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool
     return transposedMatrix;
 }
 
+#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeParallel(bool joinGroups, bool keepZeros) const {
+    index_type rowCount = this->getColumnCount();
+    index_type columnCount = joinGroups ? this->getRowGroupCount() : this->getRowCount();
+    index_type entryCount;
+    if (keepZeros) {
+        entryCount = this->getEntryCount();
+    } else {
+        this->updateNonzeroEntryCount();
+        entryCount = this->getNonzeroEntryCount();
+    }
+
+    // Split the rows (or row groups) of this matrix into consecutive chunks, one for each thread.
+    index_type const chunkCount =
+        std::max<index_type>(1, std::min<index_type>(columnCount, static_cast<index_type>(tbb::this_task_arena::max_concurrency())));
+    index_type const chunkSize = (columnCount + chunkCount - 1) / chunkCount;
+    auto forEachEntryOfChunk = [&](index_type chunk, auto&& function) {
+        index_type const chunkEnd = std::min<index_type>(columnCount, (chunk + 1) * chunkSize);
+        for (index_type group = chunk * chunkSize; group < chunkEnd; ++group) {
+            for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
+                if (transition.getValue() != storm::utility::zero<ValueType>() || keepZeros) {
+                    function(group, transition);
+                }
+            }
+        }
+    };
+
+    // First, count how many entries each chunk has in each column.
+    std::vector<index_type> chunkOffsets(chunkCount * rowCount, 0);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, chunkCount, 1), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type chunk = range.begin(); chunk < range.end(); ++chunk) {
+            index_type* counts = chunkOffsets.data() + chunk * rowCount;
+            forEachEntryOfChunk(chunk, [counts](index_type, auto const& transition) { ++counts[transition.getColumn()]; });
+        }
+    });
+
+    // Now compute the size of each row of the transposed matrix and the offset at which each chunk writes its entries within that row.
+    std::vector<index_type> rowIndications(rowCount + 1);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, rowCount), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type row = range.begin(); row < range.end(); ++row) {
+            index_type rowSize = 0;
+            for (index_type chunk = 0; chunk < chunkCount; ++chunk) {
+                index_type& offset = chunkOffsets[chunk * rowCount + row];
+                index_type const chunkEntries = offset;
+                offset = rowSize;
+                rowSize += chunkEntries;
+            }
+            rowIndications[row + 1] = rowSize;
+        }
+    });
+    for (index_type i = 1; i < rowCount + 1; ++i) {
+        rowIndications[i] = rowIndications[i - 1] + rowIndications[i];
+    }
+
+    // Finally, each chunk fills in its values. As the chunks are ordered, the entries of each row of the transposed matrix remain sorted.
+    std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(entryCount);
+    tbb::parallel_for(tbb::blocked_range<index_type>(0, chunkCount, 1), [&](tbb::blocked_range<index_type> const& range) {
+        for (index_type chunk = range.begin(); chunk < range.end(); ++chunk) {
+            index_type* offsets = chunkOffsets.data() + chunk * rowCount;
+            forEachEntryOfChunk(chunk, [&](index_type group, auto const& transition) {
+                columnsAndValues[rowIndications[transition.getColumn()] + offsets[transition.getColumn()]] = std::make_pair(group, transition.getValue());
+                ++offsets[transition.getColumn()];
+            });
+        }
+    });
+
+    return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+#endif
+
 template<typename ValueType>
 SparseMatrix<ValueType> SparseMatrix<ValueType>::transposeSelectedRowsFromRowGroups(std::vector<uint64_t> const& rowGroupChoices, bool keepZeros) const {
     index_type rowCount = this->getColumnCount();
@@ -605,6 +605,14 @@ class SparseMatrix {
      */
     std::vector<index_type> swapRowGroupIndices(std::vector<index_type>&& newRowGrouping);
 
+    /*!
+     * Moves the row indications and the entries out of this matrix, which is left empty.
+     * Together with the constructor that moves the given contents, this allows to transform a matrix that is no longer needed without copying its entries.
+     *
+     * @return The row indications and the entries of this matrix.
+     */
+    std::pair<std::vector<index_type>, std::vector<MatrixEntry<index_type, value_type>>> releaseRowsAndEntries();
+
     /*!
      * Sets the row grouping to the given one.
      * @note It is assumed that the new row grouping is non-trivial.
@@ -835,6 +843,20 @@ class SparseMatrix {
      */
     storm::storage::SparseMatrix<value_type> transpose(bool joinGroups = false, bool keepZeros = false) const;
 
+#ifdef STORM_HAVE_INTELTBB
+    /*!
+     * Transposes the matrix using multiple threads. The result is the same as for transpose(joinGroups, keepZeros).
+     * The rows of this matrix are split into one chunk per thread. Each chunk counts its entries per column so that the chunks can afterwards write
+     * their entries to disjoint parts of the transposed matrix. This requires one index per chunk and column of this matrix as auxiliary memory.
+     *
+     * @param joinGroups A flag indicating whether the row groups are supposed to be treated as single rows.
+     * @param keepZeros A flag indicating whether entries with value zero should be kept.
+     *
+     * @return A sparse matrix that represents the transpose of this matrix.
+     */
+    storm::storage::SparseMatrix<value_type> transposeParallel(bool joinGroups = false, bool keepZeros = false) const;
+#endif
+
     /*!
      * Transposes the matrix w.r.t. the selected rows.
      * This is equivalent to selectRowsFromRowGroups(rowGroupChoices, false).transpose(false, keepZeros) but avoids creating one intermediate matrix.
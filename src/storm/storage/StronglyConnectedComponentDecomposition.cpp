@@ -1,5 +1,10 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include <atomic>
+#include <mutex>
+#include <numeric>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
@@ -40,6 +45,11 @@ StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecomp
     return *this;
 }
 
+StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecompositionOptions::parallel(bool value) {
+    isParallelDecompositionSet = value;
+    return *this;
+}
+
 void SccDecompositionMemoryCache::initialize(uint64_t numStates) {
     preorderNumbers.assign(numStates, std::numeric_limits<uint64_t>::max());
     recursionStateStack.clear();
@@ -223,6 +233,421 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+#ifdef STORM_HAVE_INTELTBB
+namespace {
+
+uint64_t constexpr ParallelSccDecompositionMinimalNumberOfStates = 16384;
+
+/*!
+ * Computes SCCs in parallel using the forward-backward algorithm with trimming (see e.g. Fleischer et al., "On Identifying Strongly Connected Components in
+ * Parallel", and McLendon et al., "Finding strongly connected components in distributed graphs").
+ *
+ * Every state carries a color. Initially, all states have the same color. The forward and backward searches from a pivot state refine the states with the
+ * pivot's color into the SCC of the pivot, the states that are only forward reachable, the states that are only backward reachable and the remaining states.
+ * The latter three sets are independent of each other and are decomposed recursively (in parallel). Small sets are decomposed using a sequential algorithm.
+ * Upon termination, the color of a state identifies its SCC.
+ *
+ * The SCCs are then numbered according to their depth in the condensation, which yields a topological sort as in the sequential algorithm.
+ */
+class ParallelSccDecomposer {
+   public:
+    template<typename ValueType>
+    ParallelSccDecomposer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> subsystem,
+                          storm::OptionalRef<storm::storage::BitVector const> choices)
+        : numberOfStates(transitionMatrix.getRowGroupCount()) {
+        buildGraph(transitionMatrix, subsystem, choices);
+    }
+
+    void decompose(SccDecompositionResult& result) {
+        std::vector<uint64_t> states = trim();
+        decompose(states, InitialColor);
+        processResult(result);
+    }
+
+   private:
+    static constexpr uint64_t NoColor = std::numeric_limits<uint64_t>::max();
+    static constexpr uint64_t InitialColor = 0;
+    // Sets with at most this many states are decomposed sequentially.
+    static constexpr uint64_t SequentialThreshold = 4096;
+    // Frontiers of a search with at most this many states are expanded sequentially.
+    static constexpr uint64_t SequentialFrontierThreshold = 1024;
+    static constexpr uint64_t MaxTrimRounds = 8;
+    // If a forward-backward step resolves less than 1/MinimalProgressDenominator of the states, the remaining states are decomposed sequentially.
+    static constexpr uint64_t MinimalProgressDenominator = 16;
+
+    template<typename ValueType>
+    void buildGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> subsystem,
+                    storm::OptionalRef<storm::storage::BitVector const> choices) {
+        auto isRelevantState = [&subsystem](uint64_t state) { return !subsystem || subsystem->get(state); };
+        auto forEachSuccessor = [&](uint64_t state, auto const& function) {
+            for (auto row : transitionMatrix.getRowGroupIndices(state)) {
+                if (choices && !choices->get(row)) {
+                    continue;
+                }
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    if (isRelevantState(entry.getColumn()) && !storm::utility::isZero(entry.getValue())) {
+                        function(entry.getColumn());
+                    }
+                }
+            }
+        };
+
+        colors.assign(numberOfStates, NoColor);
+        preorderNumbers.assign(numberOfStates, NoColor);
+        hasSelfLoop.assign(numberOfStates, false);
+        forwardOffsets.assign(numberOfStates + 1, 0);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                if (isRelevantState(state)) {
+                    colors[state] = InitialColor;
+                    forEachSuccessor(state, [&](uint64_t successor) {
+                        if (successor == state) {
+                            hasSelfLoop[state] = true;
+                        } else {
+                            ++forwardOffsets[state + 1];
+                        }
+                    });
+                }
+            }
+        });
+        std::partial_sum(forwardOffsets.begin(), forwardOffsets.end(), forwardOffsets.begin());
+        forwardTargets.resize(forwardOffsets.back());
+        backwardOffsets.assign(numberOfStates + 1, 0);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                if (isRelevantState(state)) {
+                    auto targetIt = forwardTargets.begin() + forwardOffsets[state];
+                    forEachSuccessor(state, [&](uint64_t successor) {
+                        if (successor != state) {
+                            *targetIt = successor;
+                            ++targetIt;
+                            std::atomic_ref<uint64_t>(backwardOffsets[successor + 1]).fetch_add(1, std::memory_order_relaxed);
+                        }
+                    });
+                }
+            }
+        });
+        std::partial_sum(backwardOffsets.begin(), backwardOffsets.end(), backwardOffsets.begin());
+        backwardTargets.resize(backwardOffsets.back());
+        std::vector<uint64_t> insertPositions(backwardOffsets.begin(), backwardOffsets.end() - 1);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                for (uint64_t i = forwardOffsets[state]; i < forwardOffsets[state + 1]; ++i) {
+                    auto const position = std::atomic_ref<uint64_t>(insertPositions[forwardTargets[i]]).fetch_add(1, std::memory_order_relaxed);
+                    backwardTargets[position] = state;
+                }
+            }
+        });
+        nextColor = InitialColor + 1;
+    }
+
+    uint64_t getColor(uint64_t state) const {
+        return std::atomic_ref<uint64_t>(const_cast<uint64_t&>(colors[state])).load(std::memory_order_relaxed);
+    }
+
+    void setColor(uint64_t state, uint64_t color) {
+        std::atomic_ref<uint64_t>(colors[state]).store(color, std::memory_order_relaxed);
+    }
+
+    bool changeColor(uint64_t state, uint64_t oldColor, uint64_t newColor) {
+        return std::atomic_ref<uint64_t>(colors[state]).compare_exchange_strong(oldColor, newColor, std::memory_order_relaxed);
+    }
+
+    uint64_t getFreshColor() {
+        return nextColor.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool hasSuccessorWithColor(std::vector<uint64_t> const& offsets, std::vector<uint64_t> const& targets, uint64_t state, uint64_t color) const {
+        for (uint64_t i = offsets[state]; i < offsets[state + 1]; ++i) {
+            if (getColor(targets[i]) == color) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+     * Repeatedly removes states that have no predecessor or no successor among the remaining states. Such states form a singleton SCC.
+     * @return the remaining states
+     */
+    std::vector<uint64_t> trim() {
+        std::vector<uint64_t> remainingStates;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (colors[state] == InitialColor) {
+                remainingStates.push_back(state);
+            }
+        }
+        for (uint64_t round = 0; round < MaxTrimRounds && !remainingStates.empty(); ++round) {
+            std::atomic<bool> changed{false};
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, remainingStates.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                    uint64_t const state = remainingStates[i];
+                    // Removing states concurrently is fine: a state that is trimmed away can not be part of a non-singleton SCC.
+                    if (!hasSuccessorWithColor(forwardOffsets, forwardTargets, state, InitialColor) ||
+                        !hasSuccessorWithColor(backwardOffsets, backwardTargets, state, InitialColor)) {
+                        setColor(state, getFreshColor());
+                        changed = true;
+                    }
+                }
+            });
+            if (!changed) {
+                break;
+            }
+            std::erase_if(remainingStates, [this](uint64_t state) { return colors[state] != InitialColor; });
+        }
+        return remainingStates;
+    }
+
+    /*!
+     * Performs a (parallel) breadth first search from the given start state. A state is visited iff the given function returns true for that state.
+     * @return all visited states (including the start state)
+     */
+    template<typename VisitFunction>
+    std::vector<uint64_t> search(std::vector<uint64_t> const& offsets, std::vector<uint64_t> const& targets, uint64_t startState, VisitFunction const& visit) {
+        std::vector<uint64_t> visitedStates{startState}, frontier{startState}, nextFrontier;
+        while (!frontier.empty()) {
+            nextFrontier.clear();
+            if (frontier.size() <= SequentialFrontierThreshold) {
+                for (auto const state : frontier) {
+                    for (uint64_t i = offsets[state]; i < offsets[state + 1]; ++i) {
+                        if (visit(targets[i])) {
+                            nextFrontier.push_back(targets[i]);
+                        }
+                    }
+                }
+            } else {
+                std::mutex nextFrontierMutex;
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, frontier.size(), 64), [&](tbb::blocked_range<uint64_t> const& range) {
+                    std::vector<uint64_t> localFrontier;
+                    for (uint64_t frontierIndex = range.begin(); frontierIndex < range.end(); ++frontierIndex) {
+                        uint64_t const state = frontier[frontierIndex];
+                        for (uint64_t i = offsets[state]; i < offsets[state + 1]; ++i) {
+                            if (visit(targets[i])) {
+                                localFrontier.push_back(targets[i]);
+                            }
+                        }
+                    }
+                    std::lock_guard<std::mutex> lock(nextFrontierMutex);
+                    nextFrontier.insert(nextFrontier.end(), localFrontier.begin(), localFrontier.end());
+                });
+            }
+            visitedStates.insert(visitedStates.end(), nextFrontier.begin(), nextFrontier.end());
+            std::swap(frontier, nextFrontier);
+        }
+        return visitedStates;
+    }
+
+    /*!
+     * Decomposes the given states which all have the given color
+     */
+    void decompose(std::vector<uint64_t> const& states, uint64_t color) {
+        if (states.size() <= SequentialThreshold) {
+            decomposeSequentially(states, color);
+            return;
+        }
+
+        // Forward search
+        uint64_t const pivot = states[states.size() / 2];
+        uint64_t const forwardColor = getFreshColor();
+        setColor(pivot, forwardColor);
+        auto forwardStates = search(forwardOffsets, forwardTargets, pivot, [&](uint64_t state) { return changeColor(state, color, forwardColor); });
+
+        // Backward search. States that are reached in both directions form the SCC of the pivot.
+        uint64_t const backwardColor = getFreshColor();
+        uint64_t const sccColor = getFreshColor();
+        setColor(pivot, sccColor);
+        auto backwardStates = search(backwardOffsets, backwardTargets, pivot, [&](uint64_t state) {
+            return changeColor(state, color, backwardColor) || changeColor(state, forwardColor, sccColor);
+        });
+
+        std::erase_if(forwardStates, [&](uint64_t state) { return getColor(state) != forwardColor; });
+        std::erase_if(backwardStates, [&](uint64_t state) { return getColor(state) != backwardColor; });
+        std::vector<uint64_t> remainingStates;
+        std::copy_if(states.begin(), states.end(), std::back_inserter(remainingStates), [&](uint64_t state) { return getColor(state) == color; });
+
+        // The three remaining sets do not share an SCC
+        tbb::task_group taskGroup;
+        if (!forwardStates.empty()) {
+            taskGroup.run([this, forwardStates = std::move(forwardStates), forwardColor]() { decompose(forwardStates, forwardColor); });
+        }
+        if (!backwardStates.empty()) {
+            taskGroup.run([this, backwardStates = std::move(backwardStates), backwardColor]() { decompose(backwardStates, backwardColor); });
+        }
+        if (remainingStates.size() > states.size() - states.size() / MinimalProgressDenominator) {
+            // The pivot failed to split off a significant part of the states, which happens if there are many small SCCs that are not connected to the
+            // pivot. Forward-backward does not perform well in this case.
+            decomposeSequentially(remainingStates, color);
+        } else if (!remainingStates.empty()) {
+            decompose(remainingStates, color);
+        }
+        taskGroup.wait();
+    }
+
+    /*!
+     * Decomposes the given states which all have the given color using the path-based algorithm.
+     * Each found SCC gets a fresh color.
+     */
+    void decomposeSequentially(std::vector<uint64_t> const& states, uint64_t color) {
+        std::vector<uint64_t> recursionStateStack, s, p;
+        uint64_t currentIndex = 0;
+        for (auto const startState : states) {
+            if (getColor(startState) != color || preorderNumbers[startState] != NoColor) {
+                continue;
+            }
+            recursionStateStack.push_back(startState);
+            while (!recursionStateStack.empty()) {
+                uint64_t currentState = recursionStateStack.back();
+                if (preorderNumbers[currentState] == NoColor) {
+                    preorderNumbers[currentState] = currentIndex++;
+                    s.push_back(currentState);
+                    p.push_back(currentState);
+                    for (uint64_t i = forwardOffsets[currentState]; i < forwardOffsets[currentState + 1]; ++i) {
+                        auto const successor = forwardTargets[i];
+                        // Successors with a different color are either outside of the considered set or have already been assigned to an SCC.
+                        if (getColor(successor) != color) {
+                            continue;
+                        }
+                        if (preorderNumbers[successor] == NoColor) {
+                            recursionStateStack.push_back(successor);
+                        } else {
+                            while (preorderNumbers[p.back()] > preorderNumbers[successor]) {
+                                p.pop_back();
+                            }
+                        }
+                    }
+                } else {
+                    if (currentState == p.back()) {
+                        p.pop_back();
+                        uint64_t const sccColor = getFreshColor();
+                        uint64_t poppedState = 0;
+                        do {
+                            poppedState = s.back();
+                            s.pop_back();
+                            setColor(poppedState, sccColor);
+                        } while (poppedState != currentState);
+                    }
+                    recursionStateStack.pop_back();
+                }
+            }
+        }
+    }
+
+    /*!
+     * Numbers the SCCs according to their depth and stores the information in the given result.
+     */
+    void processResult(SccDecompositionResult& result) {
+        // Identify each SCC with its smallest state. This makes the result independent of the order in which SCCs were found.
+        std::vector<uint64_t> colorToRepresentative(nextColor.load(), NoColor);
+        for (uint64_t state = numberOfStates; state > 0; --state) {
+            if (colors[state - 1] != NoColor) {
+                colorToRepresentative[colors[state - 1]] = state - 1;
+            }
+        }
+        std::vector<uint64_t> sccSize(numberOfStates, 0);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (colors[state] != NoColor) {
+                colors[state] = colorToRepresentative[colors[state]];
+                ++sccSize[colors[state]];
+            }
+        }
+        colorToRepresentative.clear();
+        colorToRepresentative.shrink_to_fit();
+
+        // For each SCC, count the number of transitions leaving the SCC
+        std::vector<uint64_t> remainingOutgoingTransitions(numberOfStates, 0);
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t state = range.begin(); state < range.end(); ++state) {
+                if (colors[state] != NoColor) {
+                    uint64_t count = 0;
+                    for (uint64_t i = forwardOffsets[state]; i < forwardOffsets[state + 1]; ++i) {
+                        if (colors[forwardTargets[i]] != colors[state]) {
+                            ++count;
+                        }
+                    }
+                    if (count > 0) {
+                        std::atomic_ref<uint64_t>(remainingOutgoingTransitions[colors[state]]).fetch_add(count, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+
+        // Group the states by their SCC
+        std::vector<uint64_t> sccOffsets(numberOfStates + 1, 0);
+        for (uint64_t representative = 0; representative < numberOfStates; ++representative) {
+            sccOffsets[representative + 1] = sccOffsets[representative] + sccSize[representative];
+        }
+        std::vector<uint64_t> sccStates(sccOffsets.back());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (colors[state] != NoColor) {
+                sccStates[sccOffsets[colors[state]]++] = state;
+            }
+        }
+        for (uint64_t representative = numberOfStates; representative > 0; --representative) {
+            sccOffsets[representative] = sccOffsets[representative - 1];
+        }
+        sccOffsets[0] = 0;
+
+        // Process the SCCs layer by layer, starting with the bottom SCCs. An SCC is processed once all its successor SCCs have been processed.
+        std::vector<uint64_t> currentLayer, nextLayer;
+        for (uint64_t representative = 0; representative < numberOfStates; ++representative) {
+            if (sccSize[representative] > 0 && remainingOutgoingTransitions[representative] == 0) {
+                currentLayer.push_back(representative);
+            }
+        }
+        std::vector<uint64_t> representativeToSccIndex(numberOfStates, NoColor);
+        for (uint64_t depth = 0; !currentLayer.empty(); ++depth) {
+            for (auto const representative : currentLayer) {
+                representativeToSccIndex[representative] = result.sccCount++;
+                if (result.sccDepths) {
+                    result.sccDepths->push_back(depth);
+                }
+            }
+            nextLayer.clear();
+            std::mutex nextLayerMutex;
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, currentLayer.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                std::vector<uint64_t> localLayer;
+                for (uint64_t layerIndex = range.begin(); layerIndex < range.end(); ++layerIndex) {
+                    auto const representative = currentLayer[layerIndex];
+                    for (uint64_t stateIndex = sccOffsets[representative]; stateIndex < sccOffsets[representative + 1]; ++stateIndex) {
+                        auto const state = sccStates[stateIndex];
+                        for (uint64_t i = backwardOffsets[state]; i < backwardOffsets[state + 1]; ++i) {
+                            auto const predecessorScc = colors[backwardTargets[i]];
+                            if (predecessorScc != representative &&
+                                std::atomic_ref<uint64_t>(remainingOutgoingTransitions[predecessorScc]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                                localLayer.push_back(predecessorScc);
+                            }
+                        }
+                    }
+                }
+                std::lock_guard<std::mutex> lock(nextLayerMutex);
+                nextLayer.insert(nextLayer.end(), localLayer.begin(), localLayer.end());
+            });
+            std::sort(nextLayer.begin(), nextLayer.end());
+            std::swap(currentLayer, nextLayer);
+        }
+
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (auto const representative = colors[state]; representative != NoColor) {
+                STORM_LOG_ASSERT(representativeToSccIndex[representative] != NoColor, "SCC of state " << state << " was not processed.");
+                result.stateToSccMapping[state] = representativeToSccIndex[representative];
+                if (hasSelfLoop[state] || sccSize[representative] > 1) {
+                    result.nonTrivialStates.set(state, true);
+                }
+            }
+        }
+    }
+
+    uint64_t const numberOfStates;
+    std::vector<uint64_t> forwardOffsets, forwardTargets, backwardOffsets, backwardTargets;
+    std::vector<uint64_t> colors;
+    std::vector<uint64_t> preorderNumbers;  // Used by the sequential algorithm. Each state is only accessed by the task that is responsible for it.
+    std::vector<uint8_t> hasSelfLoop;  // Not a std::vector<bool> as the entries are written concurrently
+    std::atomic<uint64_t> nextColor;
+};
+
+}  // namespace
+#endif
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -282,6 +707,19 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
 
     uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
     result.initialize(numberOfStates, options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered);
+
+    if (options.isParallelDecompositionSet) {
+#ifdef STORM_HAVE_INTELTBB
+        // For small graphs, the overhead of the parallel algorithm does not pay off.
+        if (numberOfStates >= ParallelSccDecompositionMinimalNumberOfStates) {
+            ParallelSccDecomposer(transitionMatrix, options.optSubsystem, options.optChoices).decompose(result);
+            return;
+        }
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential SCC decomposition.");
+#endif
+    }
+
     cache.initialize(numberOfStates);
 
     // Start the search for SCCs from every state in the block.
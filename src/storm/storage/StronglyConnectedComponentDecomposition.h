@@ -33,12 +33,16 @@ struct StronglyConnectedComponentDecompositionOptions {
     /// Sets if scc depths can be retrieved.
     StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true);
 
+    /// Sets if a parallel (forward-backward) algorithm is used for large graphs. Requires Intel TBB.
+    StronglyConnectedComponentDecompositionOptions& parallel(bool value = true);
+
     storm::OptionalRef<storm::storage::BitVector const> optSubsystem;
     storm::OptionalRef<storm::storage::BitVector const> optChoices;
     bool areNaiveSccsDropped = false;
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    bool isParallelDecompositionSet = false;
 };
 
 /*!
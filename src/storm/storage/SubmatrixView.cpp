@@ -0,0 +1,109 @@
+#include "storm/storage/SubmatrixView.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SubmatrixView<ValueType>::SubmatrixView(SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowGroupConstraint,
+                                        storm::storage::BitVector const& columnConstraint, storm::storage::BitVector const& makeZeroColumns)
+    : matrix(matrix), columnMapping(matrix.getColumnCount(), NoColumn), columnCount(0), entryCount(0), maximalRowEntryCount(0) {
+    STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
+    STORM_LOG_ASSERT(columnConstraint.size() == matrix.getColumnCount(), "Column constraint has unexpected size.");
+    for (auto column : columnConstraint) {
+        if (makeZeroColumns.size() == 0 || !makeZeroColumns.get(column)) {
+            columnMapping[column] = columnCount;
+        }
+        ++columnCount;
+    }
+
+    rowGroupIndices.reserve(rowGroupConstraint.getNumberOfSetBits() + 1);
+    rowGroupIndices.push_back(0);
+    for (auto group : rowGroupConstraint) {
+        for (auto row : matrix.getRowGroupIndices(group)) {
+            rowToOriginalRow.push_back(row);
+            index_type rowEntryCount = 0;
+            for (auto const& entry : matrix.getRow(row)) {
+                if (columnMapping[entry.getColumn()] != NoColumn) {
+                    ++rowEntryCount;
+                }
+            }
+            entryCount += rowEntryCount;
+            maximalRowEntryCount = std::max(maximalRowEntryCount, rowEntryCount);
+        }
+        rowGroupIndices.push_back(rowToOriginalRow.size());
+    }
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getRowCount() const {
+    return rowToOriginalRow.size();
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+bool SubmatrixView<ValueType>::hasTrivialRowGrouping() const {
+    return matrix.hasTrivialRowGrouping();
+}
+
+template<typename ValueType>
+std::vector<typename SubmatrixView<ValueType>::index_type> const& SubmatrixView<ValueType>::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getEntryCount() const {
+    return entryCount;
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getMaximalRowEntryCount() const {
+    return maximalRowEntryCount;
+}
+
+template<typename ValueType>
+typename SubmatrixView<ValueType>::index_type SubmatrixView<ValueType>::getOriginalRow(index_type row) const {
+    return rowToOriginalRow[row];
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> const& SubmatrixView<ValueType>::getOriginalMatrix() const {
+    return matrix;
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SubmatrixView<ValueType>::toSparseMatrix() const {
+    SparseMatrixBuilder<ValueType> builder(getRowCount(), getColumnCount(), getEntryCount(), true, !hasTrivialRowGrouping(), getRowGroupCount());
+    for (index_type group = 0; group < getRowGroupCount(); ++group) {
+        if (!hasTrivialRowGrouping()) {
+            builder.newRowGroup(rowGroupIndices[group]);
+        }
+        for (index_type row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+            forEachEntry(row, [&builder, &row](index_type column, ValueType const& value) { builder.addNextValue(row, column, value); });
+        }
+    }
+    return builder.build();
+}
+
+template class SubmatrixView<double>;
+template class SubmatrixView<storm::RationalNumber>;
+template class SubmatrixView<storm::RationalFunction>;
+template class SubmatrixView<storm::Interval>;
+
+}  // namespace storage
+}  // namespace storm
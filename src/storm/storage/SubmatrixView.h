@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only view on the submatrix of a sparse matrix that consists of the selected row groups and columns. It yields the same rows, columns and
+ * entries as SparseMatrix::getSubmatrix(true, rowGroupConstraint, columnConstraint, false, makeZeroColumns) but only stores index remappings
+ * instead of copying the entries of the matrix.
+ *
+ * Consumers that iterate the matrix only (e.g. to build their own representation of it) can thus avoid materializing the submatrix.
+ * @note The view refers to the given matrix, which must not be changed or destroyed as long as the view is used.
+ */
+template<typename ValueType>
+class SubmatrixView {
+   public:
+    typedef uint_fast64_t index_type;
+
+    /*!
+     * Creates a view on the submatrix of the given matrix.
+     *
+     * @param matrix The matrix to restrict.
+     * @param rowGroupConstraint The row groups (or rows, if the row grouping is trivial) to keep.
+     * @param columnConstraint The columns to keep.
+     * @param makeZeroColumns If given, the entries of these columns are dropped (although the columns are kept).
+     */
+    SubmatrixView(SparseMatrix<ValueType> const& matrix, storm::storage::BitVector const& rowGroupConstraint, storm::storage::BitVector const& columnConstraint,
+                  storm::storage::BitVector const& makeZeroColumns = storm::storage::BitVector());
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getRowGroupCount() const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Retrieves the row group indices of the submatrix. These are given even if the row grouping is trivial.
+     */
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    /*!
+     * Retrieves the number of entries (including the ones with value zero) of the submatrix.
+     */
+    index_type getEntryCount() const;
+
+    /*!
+     * Retrieves the number of entries of the largest row of the submatrix.
+     */
+    index_type getMaximalRowEntryCount() const;
+
+    /*!
+     * Retrieves the row of the original matrix that corresponds to the given row of the submatrix.
+     */
+    index_type getOriginalRow(index_type row) const;
+
+    /*!
+     * Retrieves the matrix that this view refers to.
+     */
+    SparseMatrix<ValueType> const& getOriginalMatrix() const;
+
+    /*!
+     * Invokes the given function with the column (w.r.t. the submatrix) and the value of each entry of the given row of the submatrix.
+     */
+    template<typename Function>
+    void forEachEntry(index_type row, Function const& function) const {
+        for (auto const& entry : matrix.getRow(rowToOriginalRow[row])) {
+            auto const column = columnMapping[entry.getColumn()];
+            if (column != NoColumn) {
+                function(column, entry.getValue());
+            }
+        }
+    }
+
+    /*!
+     * Copies the submatrix into a new sparse matrix. This should only be done if a contiguous representation is really needed.
+     */
+    SparseMatrix<ValueType> toSparseMatrix() const;
+
+   private:
+    static constexpr index_type NoColumn = std::numeric_limits<index_type>::max();
+
+    SparseMatrix<ValueType> const& matrix;
+    // For each row of the submatrix the corresponding row of the original matrix.
+    std::vector<index_type> rowToOriginalRow;
+    // For each column of the original matrix the corresponding column of the submatrix (or NoColumn if the entries of the column are dropped).
+    std::vector<index_type> columnMapping;
+    std::vector<index_type> rowGroupIndices;
+    index_type columnCount;
+    index_type entryCount;
+    index_type maximalRowEntryCount;
+};
+
+}  // namespace storage
+}  // namespace storm
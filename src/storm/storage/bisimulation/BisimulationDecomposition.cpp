@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -21,8 +22,11 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 
+#include "storm/storage/DistributionWithReward.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
@@ -60,9 +64,11 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      maximalNumberOfBlocks(),
       keepRewards(false),
       type(BisimulationType::Strong),
-      bounded(false) {
+      bounded(false),
+      refinementMethod(BisimulationRefinementMethod::Splitter) {
     // Intentionally left empty.
 }
 
@@ -180,7 +186,7 @@ void BisimulationDecomposition<ModelType, BlockDataType>::Options::addToRespecte
 
 template<typename ModelType, typename BlockDataType>
 BisimulationDecomposition<ModelType, BlockDataType>::BisimulationDecomposition(ModelType const& model, Options const& options)
-    : BisimulationDecomposition(model, model.getBackwardTransitions(), options) {
+    : BisimulationDecomposition(model, *model.getBackwardTransitions(), options) {
     // Intentionally left empty.
 }
 
@@ -188,7 +194,13 @@ template<typename ModelType, typename BlockDataType>
 BisimulationDecomposition<ModelType, BlockDataType>::BisimulationDecomposition(ModelType const& model,
                                                                                storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                Options const& options)
-    : model(model), backwardTransitions(backwardTransitions), options(options), partition(), comparator(), quotient(nullptr) {
+    : model(model),
+      backwardTransitions(backwardTransitions),
+      options(options),
+      partition(),
+      comparator(),
+      quotient(nullptr),
+      exceededMaximalNumberOfBlocks(false) {
     STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || model.hasUniqueRewardModel(), storm::exceptions::IllegalFunctionCallException,
                     "Bisimulation currently only supports models with at most one reward model.");
     STORM_LOG_THROW(!options.getKeepRewards() || !model.hasRewardModel() || !model.getUniqueRewardModel().hasTransitionRewards(),
@@ -223,8 +235,20 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     this->initialize();
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (checkMaximalNumberOfBlocks()) {
+        // The initial partition is already too fine.
+    } else if (options.getRefinementMethod() == BisimulationRefinementMethod::Signature && options.getType() == BisimulationType::Strong) {
+        this->performSignatureRefinement();
+    } else {
+        STORM_LOG_WARN_COND(options.getRefinementMethod() == BisimulationRefinementMethod::Splitter,
+                            "Signature-based refinement is only supported for strong bisimulation. Falling back to splitter-based refinement.");
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
+    if (exceededMaximalNumberOfBlocks) {
+        STORM_LOG_INFO("Aborted bisimulation refinement as the partition has more than " << options.maximalNumberOfBlocks.get() << " blocks.");
+        return;
+    }
 
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
     this->extractDecompositionBlocks();
@@ -254,6 +278,19 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::hasExceededMaximalNumberOfBlocks() const {
+    return exceededMaximalNumberOfBlocks;
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::checkMaximalNumberOfBlocks() {
+    if (options.maximalNumberOfBlocks && partition.size() > options.maximalNumberOfBlocks.get()) {
+        exceededMaximalNumberOfBlocks = true;
+    }
+    return exceededMaximalNumberOfBlocks;
+}
+
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
     // Insert all blocks into the splitter queue as a (potential) splitter.
@@ -265,6 +302,11 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
 
     // Then perform the actual splitting until there are no more splitters.
     uint_fast64_t iterations = 0;
+    std::optional<storm::utility::ProgressMeasurement> progress;
+    if (storm::utility::hasProgressCallback()) {
+        progress.emplace("splitters");
+        progress->startNewMeasurement(0);
+    }
     while (!splitterQueue.empty()) {
         ++iterations;
 
@@ -279,6 +321,13 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
 
         // Now refine the partition using the current splitter.
         refinePartitionBasedOnSplitter(*splitter, splitterQueue);
+        if (checkMaximalNumberOfBlocks()) {
+            return;
+        }
+        if (progress) {
+            progress->setFrontierSize(splitterQueue.size());
+            progress->reportProgress(iterations);
+        }
 
         if (storm::utility::resources::isTerminate()) {
             std::cout << "Performed " << iterations << " iterations of partition refinement before abort.\n";
@@ -288,6 +337,123 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    typedef std::vector<storm::storage::DistributionWithReward<ValueType>> Signature;
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+    std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    bool const considerChoiceRewards =
+        model.isNondeterministicModel() && options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards();
+
+    auto distributionLess = [this](storm::storage::DistributionWithReward<ValueType> const& first,
+                                   storm::storage::DistributionWithReward<ValueType> const& second) { return first.less(second, comparator); };
+    auto distributionEqual = [this](storm::storage::DistributionWithReward<ValueType> const& first,
+                                    storm::storage::DistributionWithReward<ValueType> const& second) { return first.equals(second, comparator); };
+
+    // The signature of a state is the ordered set of its distributions over the blocks of the current partition.
+    // States in absorbing blocks are never split, so they get an empty signature.
+    std::vector<Signature> signatures(model.getNumberOfStates());
+    auto computeSignature = [&](storm::storage::sparse::state_type state) {
+        Signature& signature = signatures[state];
+        signature.clear();
+        if (partition.getBlock(state).data().absorbing()) {
+            return;
+        }
+        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+            storm::storage::DistributionWithReward<ValueType> distribution;
+            if (considerChoiceRewards) {
+                distribution.setReward(model.getUniqueRewardModel().getStateActionReward(choice));
+            }
+            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                if (!comparator.isZero(entry.getValue())) {
+                    distribution.addProbability(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                }
+            }
+            signature.push_back(std::move(distribution));
+        }
+        std::sort(signature.begin(), signature.end(), distributionLess);
+        signature.erase(std::unique(signature.begin(), signature.end(), distributionEqual), signature.end());
+    };
+    std::function<bool(storm::storage::sparse::state_type, storm::storage::sparse::state_type)> stateLess =
+        [&](storm::storage::sparse::state_type first, storm::storage::sparse::state_type second) {
+            return std::lexicographical_compare(signatures[first].begin(), signatures[first].end(), signatures[second].begin(), signatures[second].end(),
+                                                distributionLess);
+        };
+
+    [[maybe_unused]] bool const parallel =
+        storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    while (partitionChanged) {
+        ++iterations;
+        partitionChanged = false;
+
+        // Only non-absorbing blocks with more than one state can be split.
+        std::vector<Block<BlockDataType>*> candidateBlocks;
+        for (auto const& block : partition.getBlocks()) {
+            if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                candidateBlocks.push_back(block.get());
+            }
+        }
+
+        // Compute the signatures wrt. the current partition and sort the candidate blocks accordingly. As the
+        // blocks occupy disjoint ranges of the partition, they can be sorted concurrently.
+#ifdef STORM_HAVE_INTELTBB
+        if (parallel) {
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, model.getNumberOfStates(), 256), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (auto state = range.begin(); state < range.end(); ++state) {
+                    computeSignature(state);
+                }
+            });
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, candidateBlocks.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                for (auto blockIndex = range.begin(); blockIndex < range.end(); ++blockIndex) {
+                    partition.sortBlock(*candidateBlocks[blockIndex], stateLess);
+                }
+            });
+        } else {
+#endif
+            for (storm::storage::sparse::state_type state = 0; state < model.getNumberOfStates(); ++state) {
+                computeSignature(state);
+            }
+            for (auto block : candidateBlocks) {
+                partition.sortBlock(*block, stateLess);
+            }
+#ifdef STORM_HAVE_INTELTBB
+        }
+#endif
+
+        // Now split the (sorted) candidate blocks at the borders of equal signatures. The partition itself is not
+        // thread-safe, so this is done sequentially.
+        for (auto block : candidateBlocks) {
+            std::vector<uint_fast64_t> ranges = partition.computeRangesOfEqualValue(block->getBeginIndex(), block->getEndIndex(), stateLess);
+            // The states of the last range remain in the given block.
+            for (uint_fast64_t rangeIndex = 1; rangeIndex + 1 < ranges.size(); ++rangeIndex) {
+                partition.splitBlock(*block, ranges[rangeIndex]);
+                partitionChanged = true;
+            }
+        }
+        if (checkMaximalNumberOfBlocks()) {
+            return;
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " rounds of signature-based refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_INFO("Signature-based refinement converged after " << iterations << " rounds with " << partition.size() << " blocks.");
+    STORM_LOG_ASSERT(partition.check(), "Partition corrupted.");
+
+    this->finalizeSignatureRefinement();
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::finalizeSignatureRefinement() {
+    // Intentionally left empty.
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -95,6 +95,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
             return this->type;
         }
 
+        void setRefinementMethod(BisimulationRefinementMethod method) {
+            refinementMethod = method;
+        }
+
+        BisimulationRefinementMethod getRefinementMethod() const {
+            return this->refinementMethod;
+        }
+
         bool getBounded() const {
             return this->bounded;
         }
@@ -126,6 +134,10 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// If set, the refinement is aborted as soon as the partition has more blocks than the given number. As refinement only splits
+        /// blocks, the quotient would have more states in this case. Then, neither the decomposition nor the quotient are available.
+        boost::optional<uint_fast64_t> maximalNumberOfBlocks;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -140,6 +152,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// when computing strong bisimulation equivalence.
         bool bounded;
 
+        /// The method used to refine the partition.
+        BisimulationRefinementMethod refinementMethod;
+
         /*!
          * Sets the options under the assumption that the given formula is the only one that is to be checked.
          *
@@ -191,6 +206,11 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void computeBisimulationDecomposition();
 
+    /*!
+     * Retrieves whether the refinement was aborted because the partition exceeded the maximal number of blocks.
+     */
+    bool hasExceededMaximalNumberOfBlocks() const;
+
    protected:
     /*!
      * Decomposes the given model into equivalance classes of a bisimulation.
@@ -208,6 +228,25 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Checks whether the partition exceeds the maximal number of blocks (if given) and, if so, remembers that the refinement is aborted.
+     */
+    bool checkMaximalNumberOfBlocks();
+
+    /*!
+     * Performs signature-based partition refinement: in each round, the signature of every state (the set of its
+     * distributions over the current blocks) is computed and all blocks are split wrt. these signatures. This is
+     * repeated until no block is split anymore. The signatures are computed in parallel if Intel TBB is enabled.
+     * This is only applicable to strong bisimulation.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * A function that can update auxiliary data structures to the partition obtained by signature-based
+     * refinement. It is called after the refinement has finished.
+     */
+    virtual void finalizeSignatureRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -284,6 +323,9 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
 
     // The quotient, if it was build. Otherwhise a null pointer.
     std::shared_ptr<ModelType> quotient;
+
+    // Whether the refinement was aborted because the partition exceeded the maximal number of blocks.
+    bool exceededMaximalNumberOfBlocks;
 };
 }  // namespace storage
 }  // namespace storm
@@ -0,0 +1,142 @@
+#include "storm/storage/bisimulation/BisimulationReductionEstimate.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace storage {
+
+double BisimulationReductionEstimate::getQuotientRatio() const {
+    return numberOfStates == 0 ? 1.0 : static_cast<double>(numberOfBlocks) / static_cast<double>(numberOfStates);
+}
+
+template<typename ValueType>
+BisimulationReductionEstimate estimateBisimulationReduction(storm::models::sparse::Model<ValueType> const& model,
+                                                            std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                            uint64_t maximalNumberOfRounds) {
+    uint64_t const numberOfStates = model.getNumberOfStates();
+    std::vector<uint_fast64_t> const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+    std::hash<ValueType> valueHasher;
+
+    // Determine the respected labels and whether rewards are respected in the same way as the bisimulation decomposition does.
+    std::set<std::string> respectedLabels;
+    bool keepRewards = formulas.empty();
+    if (formulas.empty()) {
+        respectedLabels = model.getStateLabeling().getLabels();
+    }
+    for (auto const& formula : formulas) {
+        storm::logic::FormulaInformation info = formula->info();
+        keepRewards |= info.containsRewardOperator() || info.containsRewardBoundedFormula();
+        for (auto const& labelFormula : formula->getAtomicLabelFormulas()) {
+            respectedLabels.insert(labelFormula->getLabel());
+        }
+        for (auto const& expressionFormula : formula->getAtomicExpressionFormulas()) {
+            respectedLabels.insert(expressionFormula->toString());
+        }
+    }
+
+    // The initial signature of a state consists of its respected labels and rewards.
+    std::vector<std::size_t> signatures(numberOfStates, 0);
+    for (auto const& label : respectedLabels) {
+        if (model.getStateLabeling().containsLabel(label)) {
+            std::size_t const labelHash = std::hash<std::string>()(label);
+            for (auto state : model.getStateLabeling().getStates(label)) {
+                boost::hash_combine(signatures[state], labelHash);
+            }
+        }
+    }
+    if (keepRewards && model.hasUniqueRewardModel()) {
+        auto const& rewardModel = model.getUniqueRewardModel();
+        std::vector<std::size_t> actionRewardHashes;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (rewardModel.hasStateRewards()) {
+                boost::hash_combine(signatures[state], valueHasher(rewardModel.getStateReward(state)));
+            }
+            if (rewardModel.hasStateActionRewards()) {
+                actionRewardHashes.clear();
+                for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                    actionRewardHashes.push_back(valueHasher(rewardModel.getStateActionReward(choice)));
+                }
+                std::sort(actionRewardHashes.begin(), actionRewardHashes.end());
+                actionRewardHashes.erase(std::unique(actionRewardHashes.begin(), actionRewardHashes.end()), actionRewardHashes.end());
+                boost::hash_range(signatures[state], actionRewardHashes.begin(), actionRewardHashes.end());
+            }
+        }
+    }
+
+    // Assigns the same block to all states with the same signature and returns the number of blocks.
+    std::vector<uint64_t> blocks(numberOfStates);
+    auto assignBlocks = [&]() {
+        std::unordered_map<std::size_t, uint64_t> signatureToBlock;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            blocks[state] = signatureToBlock.emplace(signatures[state], signatureToBlock.size()).first->second;
+        }
+        return static_cast<uint64_t>(signatureToBlock.size());
+    };
+
+    BisimulationReductionEstimate result;
+    result.numberOfStates = numberOfStates;
+    result.numberOfBlocks = assignBlocks();
+    result.converged = result.numberOfBlocks == numberOfStates;
+
+    std::vector<std::pair<uint64_t, ValueType>> distribution;
+    std::vector<std::size_t> choiceHashes;
+    for (uint64_t round = 0; round < maximalNumberOfRounds && !result.converged; ++round) {
+        // The signature of a state is its current block together with the set of its distributions over the current blocks.
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            choiceHashes.clear();
+            for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                distribution.clear();
+                for (auto const& entry : model.getTransitionMatrix().getRow(choice)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        distribution.emplace_back(blocks[entry.getColumn()], entry.getValue());
+                    }
+                }
+                std::sort(distribution.begin(), distribution.end(),
+                          [](std::pair<uint64_t, ValueType> const& lhs, std::pair<uint64_t, ValueType> const& rhs) { return lhs.first < rhs.first; });
+                std::size_t choiceHash = 0;
+                for (auto entryIt = distribution.begin(); entryIt != distribution.end();) {
+                    uint64_t const block = entryIt->first;
+                    ValueType probability = storm::utility::zero<ValueType>();
+                    for (; entryIt != distribution.end() && entryIt->first == block; ++entryIt) {
+                        probability += entryIt->second;
+                    }
+                    boost::hash_combine(choiceHash, block);
+                    boost::hash_combine(choiceHash, valueHasher(probability));
+                }
+                choiceHashes.push_back(choiceHash);
+            }
+            std::sort(choiceHashes.begin(), choiceHashes.end());
+            choiceHashes.erase(std::unique(choiceHashes.begin(), choiceHashes.end()), choiceHashes.end());
+            std::size_t signature = std::hash<uint64_t>()(blocks[state]);
+            boost::hash_range(signature, choiceHashes.begin(), choiceHashes.end());
+            signatures[state] = signature;
+        }
+
+        uint64_t const numberOfBlocks = assignBlocks();
+        result.converged = numberOfBlocks == result.numberOfBlocks || numberOfBlocks == numberOfStates;
+        result.numberOfBlocks = numberOfBlocks;
+    }
+    return result;
+}
+
+template BisimulationReductionEstimate estimateBisimulationReduction(storm::models::sparse::Model<double> const& model,
+                                                                     std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                     uint64_t maximalNumberOfRounds);
+template BisimulationReductionEstimate estimateBisimulationReduction(storm::models::sparse::Model<storm::RationalNumber> const& model,
+                                                                     std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                     uint64_t maximalNumberOfRounds);
+template BisimulationReductionEstimate estimateBisimulationReduction(storm::models::sparse::Model<storm::RationalFunction> const& model,
+                                                                     std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                     uint64_t maximalNumberOfRounds);
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace logic {
+class Formula;
+}
+
+namespace storage {
+
+/*!
+ * A cheap estimate of the reduction that can be achieved by (strong) bisimulation minimization.
+ */
+struct BisimulationReductionEstimate {
+    // The number of states of the model.
+    uint64_t numberOfStates;
+
+    // The number of blocks after a bounded number of signature-based refinement rounds. As refinement only splits blocks, this is a lower bound on the
+    // number of states of the strong bisimulation quotient (up to hash collisions).
+    uint64_t numberOfBlocks;
+
+    // Whether the refinement converged within the considered rounds. In this case, numberOfBlocks is the number of states of the quotient.
+    bool converged;
+
+    /*!
+     * Retrieves the (estimated) ratio of quotient states to model states.
+     */
+    double getQuotientRatio() const;
+};
+
+/*!
+ * Estimates the number of states of the strong bisimulation quotient of the given model that preserves the given formulas. The initial partition
+ * respects the same labels and rewards as the bisimulation decomposition. Then, a bounded number of refinement rounds is performed in which the
+ * signature of each state is hashed instead of computing it explicitly. This takes linear time per round.
+ *
+ * @param model The model.
+ * @param formulas The formulas that are to be preserved. If empty, all labels and rewards are respected.
+ * @param maximalNumberOfRounds The maximal number of refinement rounds.
+ */
+template<typename ValueType>
+BisimulationReductionEstimate estimateBisimulationReduction(storm::models::sparse::Model<ValueType> const& model,
+                                                            std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                            uint64_t maximalNumberOfRounds = 3);
+
+}  // namespace storage
+}  // namespace storm
@@ -6,5 +6,9 @@ namespace storage {
 enum class BisimulationType { Strong, Weak };
 enum class BisimulationTypeChoice { Strong, Weak, FromSettings };
 
+// The method used to refine the partition of a sparse model. Splitter-based refinement refines the partition wrt. one splitter block at a time, whereas
+// signature-based refinement recomputes the signatures of all states and splits all blocks in each round.
+enum class BisimulationRefinementMethod { Splitter, Signature };
+
 }  // namespace storage
 }  // namespace storm
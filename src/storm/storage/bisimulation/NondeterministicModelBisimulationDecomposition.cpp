@@ -34,10 +34,10 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> Nondeterministic
                     "Can only compute states with probability 0/1 with an optimization direction (min/max).");
     if (this->options.getOptimizationDirection() == OptimizationDirection::Minimize) {
         return storm::utility::graph::performProb01Min(this->model.getTransitionMatrix(), this->model.getTransitionMatrix().getRowGroupIndices(),
-                                                       this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
+                                                       *this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
     } else {
         return storm::utility::graph::performProb01Max(this->model.getTransitionMatrix(), this->model.getTransitionMatrix().getRowGroupIndices(),
-                                                       this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
+                                                       *this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
     }
 }
 
@@ -57,6 +57,13 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToSt
     }
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::finalizeSignatureRefinement() {
+    // The quotient distributions still refer to the initial partition, so we recompute them wrt. the final one.
+    this->quotientDistributions.assign(this->model.getNumberOfChoices(), storm::storage::DistributionWithReward<ValueType>());
+    this->initializeQuotientDistributions();
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotientDistributions() {
     std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
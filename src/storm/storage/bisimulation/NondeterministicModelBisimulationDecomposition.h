@@ -40,6 +40,8 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual void finalizeSignatureRefinement() override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -6,6 +6,7 @@
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdSerialization.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/storage/BitVector.h"
@@ -176,6 +177,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::maximum(Add<LibraryType
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::sumAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.sumAbstract(cube.getInternalBdd()),
                                        Dd<LibraryType>::subtractMetaVariables(*this, cube));
@@ -183,6 +185,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::sumAbstract(std::set<st
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::minAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.minAbstract(cube.getInternalBdd()),
                                        Dd<LibraryType>::subtractMetaVariables(*this, cube));
@@ -190,12 +193,14 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::minAbstract(std::set<st
 
 template<DdType LibraryType, typename ValueType>
 Bdd<LibraryType> Add<LibraryType, ValueType>::minAbstractRepresentative(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
     return Bdd<LibraryType>(this->getDdManager(), internalAdd.minAbstractRepresentative(cube.getInternalBdd()), this->getContainedMetaVariables());
 }
 
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::maxAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
     return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.maxAbstract(cube.getInternalBdd()),
                                        Dd<LibraryType>::subtractMetaVariables(*this, cube));
@@ -203,6 +208,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::maxAbstract(std::set<st
 
 template<DdType LibraryType, typename ValueType>
 Bdd<LibraryType> Add<LibraryType, ValueType>::maxAbstractRepresentative(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
     return Bdd<LibraryType>(this->getDdManager(), internalAdd.maxAbstractRepresentative(cube.getInternalBdd()), this->getContainedMetaVariables());
 }
@@ -371,6 +377,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::permuteVariables(
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Add<LibraryType, ValueType> const& otherMatrix,
                                                                         std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     // Create the summation variables.
     std::vector<InternalBdd<LibraryType>> summationDdVariables;
     for (auto const& metaVariable : summationMetaVariables) {
@@ -390,6 +397,7 @@ Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Add<Libr
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Bdd<LibraryType> const& otherMatrix,
                                                                         std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     // Create the summation variables.
     std::vector<InternalBdd<LibraryType>> summationDdVariables;
     for (auto const& metaVariable : summationMetaVariables) {
@@ -1145,6 +1153,21 @@ void Add<LibraryType, ValueType>::exportToText(std::string const& filename) cons
     internalAdd.exportToText(filename);
 }
 
+template<DdType LibraryType, typename ValueType>
+void Add<LibraryType, ValueType>::exportToBinary(std::string const& filename) const {
+    writeSerializedDd(filename, SerializedDdKind::Add, this->getContainedMetaVariableNames(), internalAdd.toSerializedNodes());
+}
+
+template<DdType LibraryType, typename ValueType>
+Add<LibraryType, ValueType> Add<LibraryType, ValueType>::fromBinary(DdManager<LibraryType> const& ddManager, std::string const& filename) {
+    std::vector<std::string> metaVariableNames;
+    std::vector<SerializedDdNode> nodes;
+    readSerializedDd(filename, SerializedDdKind::Add, metaVariableNames, nodes);
+    std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::getMetaVariablesByName(ddManager, metaVariableNames);
+    return Add<LibraryType, ValueType>(ddManager, InternalAdd<LibraryType, ValueType>::fromSerializedNodes(&ddManager.getInternalDdManager(), nodes),
+                                       metaVariables);
+}
+
 template<DdType LibraryType, typename ValueType>
 AddIterator<LibraryType, ValueType> Add<LibraryType, ValueType>::begin(bool enumerateDontCareMetaVariables) const {
     uint_fast64_t numberOfDdVariables = 0;
@@ -742,6 +742,17 @@ class Add : public Dd<LibraryType> {
 
     virtual void exportToText(std::string const& filename) const override;
 
+    virtual void exportToBinary(std::string const& filename) const override;
+
+    /*!
+     * Loads an ADD that was previously exported with exportToBinary. This is only supported for double and uint_fast64_t values.
+     *
+     * @param ddManager The DD manager responsible for the resulting ADD. It needs to contain the meta variables of the stored ADD.
+     * @param filename The name of the file from which to load the ADD.
+     * @return The loaded ADD.
+     */
+    static Add<LibraryType, ValueType> fromBinary(DdManager<LibraryType> const& ddManager, std::string const& filename);
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -8,6 +8,7 @@
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdSerialization.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/storage/BitVector.h"
@@ -111,6 +112,7 @@ bool Bdd<LibraryType>::operator!=(Bdd<LibraryType> const& other) const {
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::ite(Bdd<LibraryType> const& thenBdd, Bdd<LibraryType> const& elseBdd) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Ite));
     std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::joinMetaVariables(thenBdd, elseBdd);
     metaVariables.insert(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end());
     return Bdd<LibraryType>(this->getDdManager(), internalBdd.ite(thenBdd.internalBdd, elseBdd.internalBdd), metaVariables);
@@ -119,6 +121,7 @@ Bdd<LibraryType> Bdd<LibraryType>::ite(Bdd<LibraryType> const& thenBdd, Bdd<Libr
 template<DdType LibraryType>
 template<typename ValueType>
 Add<LibraryType, ValueType> Bdd<LibraryType>::ite(Add<LibraryType, ValueType> const& thenAdd, Add<LibraryType, ValueType> const& elseAdd) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Ite));
     std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::joinMetaVariables(thenAdd, elseAdd);
     metaVariables.insert(this->getContainedMetaVariables().begin(), this->getContainedMetaVariables().end());
     return Add<LibraryType, ValueType>(this->getDdManager(), internalBdd.ite(thenAdd.internalAdd, elseAdd.internalAdd), metaVariables);
@@ -176,24 +179,28 @@ Bdd<LibraryType>& Bdd<LibraryType>::complement() {
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::existsAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = getCube(this->getDdManager(), metaVariables);
     return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
 }
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::existsAbstractRepresentative(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = getCube(this->getDdManager(), metaVariables);
     return Bdd<LibraryType>(this->getDdManager(), internalBdd.existsAbstractRepresentative(cube.getInternalBdd()), this->getContainedMetaVariables());
 }
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::universalAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::Abstraction));
     Bdd<LibraryType> cube = getCube(this->getDdManager(), metaVariables);
     return Bdd<LibraryType>(this->getDdManager(), internalBdd.universalAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
 }
 
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::andExists(Bdd<LibraryType> const& other, std::set<storm::expressions::Variable> const& existentialVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     Bdd<LibraryType> cube = getCube(this->getDdManager(), existentialVariables);
 
     std::set<storm::expressions::Variable> unionOfMetaVariables;
@@ -219,6 +226,7 @@ Bdd<LibraryType> Bdd<LibraryType>::restrict(Bdd<LibraryType> const& constraint)
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::relationalProduct(Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
@@ -245,6 +253,7 @@ Bdd<LibraryType> Bdd<LibraryType>::relationalProduct(Bdd<LibraryType> const& rel
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProduct(Bdd<LibraryType> const& relation, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                             std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
@@ -273,6 +282,7 @@ template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::inverseRelationalProductWithExtendedRelation(Bdd<LibraryType> const& relation,
                                                                                 std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                 std::set<storm::expressions::Variable> const& columnMetaVariables) const {
+    DdOperationTimer timer(this->getDdManager().getOperationStatistics(DdOperationType::AndExists));
     std::set<storm::expressions::Variable> newMetaVariables;
     std::set_difference(relation.getContainedMetaVariables().begin(), relation.getContainedMetaVariables().end(), columnMetaVariables.begin(),
                         columnMetaVariables.end(), std::inserter(newMetaVariables, newMetaVariables.begin()));
@@ -558,6 +568,20 @@ void Bdd<LibraryType>::exportToText(std::string const& filename) const {
     internalBdd.exportToText(filename);
 }
 
+template<DdType LibraryType>
+void Bdd<LibraryType>::exportToBinary(std::string const& filename) const {
+    writeSerializedDd(filename, SerializedDdKind::Bdd, this->getContainedMetaVariableNames(), internalBdd.toSerializedNodes());
+}
+
+template<DdType LibraryType>
+Bdd<LibraryType> Bdd<LibraryType>::fromBinary(DdManager<LibraryType> const& ddManager, std::string const& filename) {
+    std::vector<std::string> metaVariableNames;
+    std::vector<SerializedDdNode> nodes;
+    readSerializedDd(filename, SerializedDdKind::Bdd, metaVariableNames, nodes);
+    std::set<storm::expressions::Variable> metaVariables = Dd<LibraryType>::getMetaVariablesByName(ddManager, metaVariableNames);
+    return Bdd<LibraryType>(ddManager, InternalBdd<LibraryType>::fromSerializedNodes(&ddManager.getInternalDdManager(), nodes), metaVariables);
+}
+
 template<DdType LibraryType>
 Bdd<LibraryType> Bdd<LibraryType>::getCube(DdManager<LibraryType> const& manager, std::set<storm::expressions::Variable> const& metaVariables) {
     Bdd<LibraryType> cube = manager.getBddOne();
@@ -392,6 +392,17 @@ class Bdd : public Dd<LibraryType> {
 
     virtual void exportToText(std::string const& filename) const override;
 
+    virtual void exportToBinary(std::string const& filename) const override;
+
+    /*!
+     * Loads a BDD that was previously exported with exportToBinary.
+     *
+     * @param ddManager The DD manager responsible for the resulting BDD. It needs to contain the meta variables of the stored BDD.
+     * @param filename The name of the file from which to load the BDD.
+     * @return The loaded BDD.
+     */
+    static Bdd<LibraryType> fromBinary(DdManager<LibraryType> const& ddManager, std::string const& filename);
+
     /*!
      * Retrieves the cube of all given meta variables.
      *
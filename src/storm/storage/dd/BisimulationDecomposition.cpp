@@ -152,6 +152,11 @@ bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::getReachedFi
     return this->refiner->getStatus() == Status::FixedPoint;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+bisimulation::Partition<DdType, ValueType> const& BisimulationDecomposition<DdType, ValueType, ExportValueType>::getStatePartition() const {
+    return this->refiner->getStatePartition();
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 std::shared_ptr<storm::models::Model<ExportValueType>> BisimulationDecomposition<DdType, ValueType, ExportValueType>::getQuotient(
     storm::dd::bisimulation::QuotientFormat const& quotientFormat) const {
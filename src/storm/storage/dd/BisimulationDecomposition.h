@@ -67,6 +67,11 @@ class BisimulationDecomposition {
      */
     bool getReachedFixedPoint() const;
 
+    /*!
+     * Retrieves the current state partition. Note that the partition is refined further by subsequent calls to compute.
+     */
+    bisimulation::Partition<DdType, ValueType> const& getStatePartition() const;
+
     /*!
      * Retrieves the quotient model after the bisimulation decomposition was computed.
      */
@@ -91,6 +91,26 @@ std::set<storm::expressions::Variable> Dd<LibraryType>::subtractMetaVariables(st
     return metaVariables;
 }
 
+template<DdType LibraryType>
+std::vector<std::string> Dd<LibraryType>::getContainedMetaVariableNames() const {
+    std::vector<std::string> metaVariableNames;
+    for (auto const& metaVariable : containedMetaVariables) {
+        metaVariableNames.push_back(metaVariable.getName());
+    }
+    return metaVariableNames;
+}
+
+template<DdType LibraryType>
+std::set<storm::expressions::Variable> Dd<LibraryType>::getMetaVariablesByName(DdManager<LibraryType> const& ddManager,
+                                                                               std::vector<std::string> const& metaVariableNames) {
+    std::set<storm::expressions::Variable> metaVariables;
+    for (auto const& name : metaVariableNames) {
+        STORM_LOG_THROW(ddManager.hasMetaVariable(name), storm::exceptions::InvalidArgumentException, "Unknown meta variable '" << name << "'.");
+        metaVariables.insert(ddManager.getMetaVariable(name));
+    }
+    return metaVariables;
+}
+
 template class Dd<storm::dd::DdType::CUDD>;
 template class Dd<storm::dd::DdType::Sylvan>;
 }  // namespace dd
@@ -111,6 +111,14 @@ class Dd {
      */
     virtual void exportToText(std::string const& filename) const = 0;
 
+    /*!
+     * Exports the DD to the given file in a compact binary format from which it can be loaded again (in the same manager or a manager with
+     * equally named meta variables), e.g. to release the memory occupied by the DD while it is not needed.
+     *
+     * @param filename The name of the file to which the DD is to be exported.
+     */
+    virtual void exportToBinary(std::string const& filename) const = 0;
+
     /*!
      * Retrieves the manager that is responsible for this DD.
      *
@@ -188,6 +196,23 @@ class Dd {
      */
     static std::set<storm::expressions::Variable> subtractMetaVariables(storm::dd::Dd<LibraryType> const& first, storm::dd::Dd<LibraryType> const& second);
 
+    /*!
+     * Retrieves the names of the meta variables contained in this DD.
+     *
+     * @return The names of the contained meta variables.
+     */
+    std::vector<std::string> getContainedMetaVariableNames() const;
+
+    /*!
+     * Retrieves the meta variables with the given names.
+     *
+     * @param ddManager The manager responsible for the meta variables.
+     * @param metaVariableNames The names of the meta variables.
+     * @return The set of meta variables.
+     */
+    static std::set<storm::expressions::Variable> getMetaVariablesByName(DdManager<LibraryType> const& ddManager,
+                                                                         std::vector<std::string> const& metaVariableNames);
+
    private:
     // A pointer to the manager responsible for this DD.
     DdManager<LibraryType>* ddManager;
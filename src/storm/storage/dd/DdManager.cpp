@@ -514,6 +514,18 @@ void DdManager<LibraryType>::debugCheck() const {
     internalDdManager.debugCheck();
 }
 
+template<DdType LibraryType>
+DdManagerStatistics DdManager<LibraryType>::getStatistics() const {
+    DdManagerStatistics statistics = internalDdManager.getStatistics();
+    statistics.operations = operationStatistics;
+    return statistics;
+}
+
+template<DdType LibraryType>
+DdOperationStatistics& DdManager<LibraryType>::getOperationStatistics(DdOperationType const& type) const {
+    return operationStatistics[static_cast<uint64_t>(type)];
+}
+
 template<DdType LibraryType>
 void DdManager<LibraryType>::execute(std::function<void()> const& f) const {
     internalDdManager.execute(f);
@@ -9,6 +9,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/AddIterator.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
@@ -334,6 +335,22 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void debugCheck() const;
 
+    /*!
+     * Retrieves runtime statistics of this manager, i.e. the statistics of the underlying DD library together with the number of invocations and the
+     * accumulated time of the major DD operations.
+     *
+     * @return The statistics.
+     */
+    DdManagerStatistics getStatistics() const;
+
+    /*!
+     * Retrieves the statistics of the given operation type, which are to be updated whenever an operation of this type is performed.
+     *
+     * @param type The operation type.
+     * @return The (mutable) statistics of the operation type.
+     */
+    DdOperationStatistics& getOperationStatistics(DdOperationType const& type) const;
+
     /*!
      * All code that manipulates DDs shall be called through this function.
      * This is generally needed to set-up the correct context.
@@ -410,6 +427,9 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
 
     // The manager responsible for the variables.
     std::shared_ptr<storm::expressions::ExpressionManager> manager;
+
+    // The number of invocations and the accumulated time of the major DD operations, indexed by their operation type.
+    mutable std::array<DdOperationStatistics, numberOfDdOperationTypes> operationStatistics;
 };
 }  // namespace dd
 }  // namespace storm
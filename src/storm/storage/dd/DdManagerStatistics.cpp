@@ -0,0 +1,113 @@
+#include "storm/storage/dd/DdManagerStatistics.h"
+
+#include <iomanip>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+std::string toString(DdOperationType const& type) {
+    switch (type) {
+        case DdOperationType::AndExists:
+            return "and-exists";
+        case DdOperationType::Ite:
+            return "ite";
+        case DdOperationType::Abstraction:
+            return "abstraction";
+    }
+    STORM_LOG_ASSERT(false, "Unknown DD operation type.");
+    return "unknown";
+}
+
+DdOperationStatistics const& DdManagerStatistics::getOperationStatistics(DdOperationType const& type) const {
+    return operations[static_cast<uint64_t>(type)];
+}
+
+storm::json<double> DdManagerStatistics::toJson() const {
+    storm::json<double> result;
+    result["library"] = library;
+    if (peakNodes) {
+        result["peak-nodes"] = *peakNodes;
+    }
+    if (liveNodes) {
+        result["live-nodes"] = *liveNodes;
+    }
+    if (uniqueTableSize) {
+        result["unique-table-size"] = *uniqueTableSize;
+    }
+    if (operationCacheSize) {
+        result["operation-cache-size"] = *operationCacheSize;
+    }
+    if (operationCacheUsage) {
+        result["operation-cache-usage"] = *operationCacheUsage;
+    }
+    if (operationCacheHitRate) {
+        result["operation-cache-hit-rate"] = *operationCacheHitRate;
+    }
+    if (garbageCollections) {
+        result["gc-count"] = *garbageCollections;
+    }
+    if (garbageCollectionTime) {
+        result["gc-time"] = static_cast<uint64_t>(garbageCollectionTime->count());
+    }
+    storm::json<double> operationsJson;
+    for (uint64_t index = 0; index < numberOfDdOperationTypes; ++index) {
+        storm::json<double> operationJson;
+        operationJson["count"] = operations[index].count;
+        operationJson["time"] = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(operations[index].time).count());
+        operationsJson[toString(static_cast<DdOperationType>(index))] = std::move(operationJson);
+    }
+    result["operations"] = std::move(operationsJson);
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics) {
+    out << "DD statistics (" << statistics.library << "):\n";
+    if (statistics.peakNodes) {
+        out << "  * peak nodes: " << *statistics.peakNodes << '\n';
+    }
+    if (statistics.liveNodes) {
+        out << "  * live nodes: " << *statistics.liveNodes << '\n';
+    }
+    if (statistics.uniqueTableSize) {
+        out << "  * unique table size: " << *statistics.uniqueTableSize << '\n';
+    }
+    if (statistics.operationCacheSize) {
+        out << "  * operation cache size: " << *statistics.operationCacheSize;
+        if (statistics.operationCacheUsage) {
+            out << " (" << std::fixed << std::setprecision(1) << *statistics.operationCacheUsage * 100.0 << std::defaultfloat << "% used)";
+        }
+        out << '\n';
+    }
+    if (statistics.operationCacheHitRate) {
+        out << "  * operation cache hit rate: " << std::fixed << std::setprecision(1) << *statistics.operationCacheHitRate * 100.0 << std::defaultfloat
+            << "%\n";
+    }
+    if (statistics.garbageCollections) {
+        out << "  * garbage collections: " << *statistics.garbageCollections;
+        if (statistics.garbageCollectionTime) {
+            out << " (" << statistics.garbageCollectionTime->count() << "ms)";
+        }
+        out << '\n';
+    }
+    for (uint64_t index = 0; index < numberOfDdOperationTypes; ++index) {
+        auto const& operation = statistics.operations[index];
+        out << "  * " << toString(static_cast<DdOperationType>(index)) << ": " << operation.count << " calls ("
+            << std::chrono::duration_cast<std::chrono::milliseconds>(operation.time).count() << "ms)\n";
+    }
+    return out;
+}
+
+DdOperationTimer::DdOperationTimer(DdOperationStatistics& statistics) : statistics(statistics), start(std::chrono::steady_clock::now()) {
+    // Intentionally left empty.
+}
+
+DdOperationTimer::~DdOperationTimer() {
+    ++statistics.count;
+    statistics.time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * The major DD operations whose number of invocations and accumulated time are recorded by a DD manager.
+ * AndExists covers the (BDD) and-exists and relational products as well as the (ADD) matrix multiplication, Ite covers if-then-else on BDDs and ADDs and
+ * Abstraction covers the exists, forall, sum, min and max abstractions (including the ones computing representatives).
+ */
+enum class DdOperationType { AndExists, Ite, Abstraction };
+
+/*!
+ * The number of different DD operation types.
+ */
+uint64_t constexpr numberOfDdOperationTypes = 3;
+
+/*!
+ * Retrieves a string representation of the given operation type.
+ */
+std::string toString(DdOperationType const& type);
+
+/*!
+ * The number of invocations of a DD operation and the wall-clock time spent in these invocations.
+ */
+struct DdOperationStatistics {
+    uint64_t count = 0;
+    std::chrono::nanoseconds time{0};
+};
+
+/*!
+ * Runtime statistics of a DD manager. Values that the underlying DD library does not provide are not set.
+ * All values (except the current node count and table sizes) are accumulated since the creation of the DD package.
+ */
+struct DdManagerStatistics {
+    // The name of the DD library.
+    std::string library;
+
+    // The peak number of nodes and the number of nodes currently in the unique table.
+    // For Sylvan, the nodes in the unique table include dead nodes that have not yet been garbage collected and the peak is the largest count that has
+    // been observed (at the start of a garbage collection or a query of the statistics).
+    std::optional<uint64_t> peakNodes;
+    std::optional<uint64_t> liveNodes;
+
+    // The number of slots of the unique table and of the operation cache.
+    std::optional<uint64_t> uniqueTableSize;
+    std::optional<uint64_t> operationCacheSize;
+
+    // The fraction of used slots of the operation cache and the fraction of operation cache lookups that were successful.
+    std::optional<double> operationCacheUsage;
+    std::optional<double> operationCacheHitRate;
+
+    // The number of garbage collections and the time spent in them.
+    std::optional<uint64_t> garbageCollections;
+    std::optional<std::chrono::milliseconds> garbageCollectionTime;
+
+    // The statistics of the major operations, indexed by their operation type.
+    std::array<DdOperationStatistics, numberOfDdOperationTypes> operations;
+
+    /*!
+     * Retrieves the statistics of the given operation type.
+     */
+    DdOperationStatistics const& getOperationStatistics(DdOperationType const& type) const;
+
+    /*!
+     * Converts the statistics to a json object. Values that are not set are omitted, times are given in milliseconds.
+     */
+    storm::json<double> toJson() const;
+};
+
+std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics);
+
+/*!
+ * Measures the time from its construction to its destruction and adds it (as one invocation) to the given operation statistics.
+ */
+class DdOperationTimer {
+   public:
+    explicit DdOperationTimer(DdOperationStatistics& statistics);
+    DdOperationTimer(DdOperationTimer const& other) = delete;
+    DdOperationTimer& operator=(DdOperationTimer const& other) = delete;
+    ~DdOperationTimer();
+
+   private:
+    DdOperationStatistics& statistics;
+    std::chrono::steady_clock::time_point start;
+};
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,118 @@
+#include "storm/storage/dd/DdSerialization.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace dd {
+
+namespace {
+// The magic number at the beginning of every file, i.e. "STORMDD" followed by the format version.
+uint64_t constexpr magicNumber = 0x53544F524D444401ull;
+
+void writeWord(std::ofstream& out, uint64_t word) {
+    out.write(reinterpret_cast<char const*>(&word), sizeof(word));
+}
+
+uint64_t readWord(std::ifstream& in, std::string const& filename) {
+    uint64_t word;
+    in.read(reinterpret_cast<char*>(&word), sizeof(word));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of DD file " << filename << ".");
+    return word;
+}
+}  // namespace
+
+void writeSerializedDd(std::string const& filename, SerializedDdKind const& kind, std::vector<std::string> const& metaVariableNames,
+                       std::vector<SerializedDdNode> const& nodes) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+
+    writeWord(out, magicNumber);
+    writeWord(out, static_cast<uint64_t>(kind));
+    writeWord(out, metaVariableNames.size());
+    for (auto const& name : metaVariableNames) {
+        writeWord(out, name.size());
+        out.write(name.data(), name.size());
+    }
+    writeWord(out, nodes.size());
+    out.write(reinterpret_cast<char const*>(nodes.data()), nodes.size() * sizeof(SerializedDdNode));
+
+    STORM_LOG_THROW(out, storm::exceptions::FileIoException, "Could not write DD to file " << filename << ".");
+}
+
+void readSerializedDd(std::string const& filename, SerializedDdKind const& kind, std::vector<std::string>& metaVariableNames,
+                      std::vector<SerializedDdNode>& nodes) {
+    std::ifstream in(filename, std::ios::binary);
+    STORM_LOG_THROW(in, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+
+    STORM_LOG_THROW(readWord(in, filename) == magicNumber, storm::exceptions::WrongFormatException, "File " << filename << " does not contain a DD.");
+    STORM_LOG_THROW(readWord(in, filename) == static_cast<uint64_t>(kind), storm::exceptions::WrongFormatException,
+                    "File " << filename << " contains a DD of the wrong kind.");
+
+    metaVariableNames.resize(readWord(in, filename));
+    for (auto& name : metaVariableNames) {
+        name.resize(readWord(in, filename));
+        in.read(&name[0], name.size());
+    }
+
+    nodes.resize(readWord(in, filename));
+    in.read(reinterpret_cast<char*>(nodes.data()), nodes.size() * sizeof(SerializedDdNode));
+    STORM_LOG_THROW(in, storm::exceptions::WrongFormatException, "Unexpected end of DD file " << filename << ".");
+    STORM_LOG_THROW(!nodes.empty(), storm::exceptions::WrongFormatException, "DD file " << filename << " does not contain any nodes.");
+    for (uint64_t position = 0; position < nodes.size(); ++position) {
+        auto const& node = nodes[position];
+        STORM_LOG_THROW(node.index == SerializedDdNode::leafIndex || (node.thenNode < position && node.elseNode < position),
+                        storm::exceptions::WrongFormatException, "DD file " << filename << " contains a node whose successors are not stored before it.");
+    }
+}
+
+template<typename ValueType>
+uint64_t encodeLeafValue(ValueType const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storing DDs with this value type is not supported.");
+}
+
+template<>
+uint64_t encodeLeafValue(double const& value) {
+    uint64_t result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+template<>
+uint64_t encodeLeafValue(uint_fast64_t const& value) {
+    return value;
+}
+
+template<typename ValueType>
+ValueType decodeLeafValue(uint64_t) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Loading DDs with this value type is not supported.");
+}
+
+template<>
+double decodeLeafValue(uint64_t encodedValue) {
+    double result;
+    std::memcpy(&result, &encodedValue, sizeof(result));
+    return result;
+}
+
+template<>
+uint_fast64_t decodeLeafValue(uint64_t encodedValue) {
+    return encodedValue;
+}
+
+#ifdef STORM_HAVE_CARL
+template uint64_t encodeLeafValue(storm::RationalNumber const& value);
+template uint64_t encodeLeafValue(storm::RationalFunction const& value);
+template storm::RationalNumber decodeLeafValue(uint64_t encodedValue);
+template storm::RationalFunction decodeLeafValue(uint64_t encodedValue);
+#endif
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace storm {
+namespace dd {
+
+/*!
+ * A node of a DD in the library-independent binary format that is used to store DDs on disk. Nodes refer to their successors by their position in
+ * the node table. Successors always precede their parents, so the last node of a table is the root of the DD.
+ */
+struct SerializedDdNode {
+    // The index that marks a node as a leaf.
+    static uint64_t constexpr leafIndex = std::numeric_limits<uint64_t>::max();
+
+    // The index of the DD variable of the node or leafIndex if the node is a leaf.
+    uint64_t index;
+
+    // The position of the then-successor in the node table. For leaves, this holds the encoded value of the leaf (see encodeLeafValue).
+    uint64_t thenNode;
+
+    // The position of the else-successor in the node table. Unused for leaves.
+    uint64_t elseNode;
+};
+
+/*!
+ * The kinds of DDs that can be stored in the binary format.
+ */
+enum class SerializedDdKind : uint64_t { Bdd = 0, Add = 1 };
+
+/*!
+ * Writes the given node table of a DD to the given file.
+ *
+ * @param filename The name of the file to write. An existing file is overwritten.
+ * @param kind The kind of the DD.
+ * @param metaVariableNames The names of the meta variables contained in the DD.
+ * @param nodes The node table of the DD.
+ */
+void writeSerializedDd(std::string const& filename, SerializedDdKind const& kind, std::vector<std::string> const& metaVariableNames,
+                       std::vector<SerializedDdNode> const& nodes);
+
+/*!
+ * Reads the node table of a DD from the given file that was previously written with writeSerializedDd.
+ *
+ * @param filename The name of the file to read.
+ * @param kind The expected kind of the DD.
+ * @param metaVariableNames Is filled with the names of the meta variables contained in the DD.
+ * @param nodes Is filled with the node table of the DD.
+ */
+void readSerializedDd(std::string const& filename, SerializedDdKind const& kind, std::vector<std::string>& metaVariableNames,
+                      std::vector<SerializedDdNode>& nodes);
+
+/*!
+ * Encodes the given leaf value into the 64 bits that are stored for a leaf. Only double and uint_fast64_t values are supported.
+ */
+template<typename ValueType>
+uint64_t encodeLeafValue(ValueType const& value);
+
+/*!
+ * Decodes a leaf value previously encoded with encodeLeafValue.
+ */
+template<typename ValueType>
+ValueType decodeLeafValue(uint64_t encodedValue);
+
+}  // namespace dd
+}  // namespace storm
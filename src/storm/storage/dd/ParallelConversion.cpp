@@ -0,0 +1,55 @@
+#include "storm/storage/dd/ParallelConversion.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace dd {
+
+// DDs with fewer row variables are translated sequentially, because the overhead of spawning jobs dominates.
+static const uint_fast64_t minimalNumberOfRowVariablesForParallelConversion = 10;
+
+// The number of jobs that are created per thread to balance the (possibly very different) sizes of the subtrees.
+static const uint_fast64_t jobsPerThread = 8;
+
+uint_fast64_t getParallelConversionSplitLevel(uint_fast64_t numberOfRowVariables) {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfRowVariables < minimalNumberOfRowVariablesForParallelConversion ||
+        !storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return 0;
+    }
+    uint_fast64_t const numberOfThreads = storm::utility::getNumberOfThreads();
+    if (numberOfThreads <= 1) {
+        return 0;
+    }
+    uint_fast64_t splitLevel = 0;
+    while ((1ull << splitLevel) < jobsPerThread * numberOfThreads) {
+        ++splitLevel;
+    }
+    return std::min(splitLevel, numberOfRowVariables - 1);
+#else
+    return 0;
+#endif
+}
+
+void performParallelConversion(uint_fast64_t numberOfJobs, std::function<void(uint_fast64_t)> const& job) {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfJobs, 1), [&job](tbb::blocked_range<uint_fast64_t> const& range) {
+        for (auto jobIndex = range.begin(); jobIndex < range.end(); ++jobIndex) {
+            job(jobIndex);
+        }
+    });
+#else
+    for (uint_fast64_t jobIndex = 0; jobIndex < numberOfJobs; ++jobIndex) {
+        job(jobIndex);
+    }
+#endif
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace storm {
+namespace dd {
+
+/*!
+ * Retrieves the number of (row) levels at which the translation of a DD to an explicit matrix is split into jobs that are processed concurrently.
+ * All subtrees below the same assignment of the first row variables form one job, so different jobs write to disjoint rows of the matrix.
+ *
+ * @param numberOfRowVariables The number of DD row variables of the translated DD.
+ * @return The split level or zero if the translation is to be done sequentially, i.e., if Intel TBB is not enabled or the DD is too small.
+ */
+uint_fast64_t getParallelConversionSplitLevel(uint_fast64_t numberOfRowVariables);
+
+/*!
+ * Processes the given number of (independent) conversion jobs concurrently.
+ *
+ * @param numberOfJobs The number of jobs.
+ * @param job A function that processes the job with the given index.
+ */
+void performParallelConversion(uint_fast64_t numberOfJobs, std::function<void(uint_fast64_t)> const& job);
+
+}  // namespace dd
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/bisimulation/InternalSylvanSignatureRefiner.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
@@ -57,14 +59,29 @@ Partition<storm::dd::DdType::Sylvan, ValueType> InternalSignatureRefiner<storm::
     return oldPartition.replacePartition(newPartitionDds.first, nextFreeBlockIndex, nextFreeBlockIndex, newPartitionDds.second);
 }
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+// Fills the given range with the given value. As the table grows with the number of blocks, it is cleared in parallel in every refinement step.
+VOID_TASK_4(sylvan_fill, uint64_t*, data, size_t, first, size_t, count, uint64_t, value) {
+    if (count > 4096) {
+        SPAWN(sylvan_fill, data, first, count / 2, value);
+        CALL(sylvan_fill, data, first + count / 2, count - count / 2, value);
+        SYNC(sylvan_fill);
+        return;
+    }
+    std::fill(data + first, data + first + count, value);
+}
+
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+
 template<typename ValueType>
 void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
-    for (auto& e : this->table) {
-        e = NO_ELEMENT_MARKER;
-    }
-    for (auto& e : this->signatures) {
-        e = 0ull;
-    }
+    RUN(sylvan_fill, this->table.data(), 0, this->table.size(), NO_ELEMENT_MARKER);
+    RUN(sylvan_fill, this->signatures.data(), 0, this->signatures.size(), 0ull);
 }
 
 template<typename ValueType>
@@ -236,7 +253,9 @@ TASK_1(uint64_t, sylvan_decode_block, BDD, block) {
 }
 
 TASK_3(BDD, sylvan_encode_block, BDD, vars, uint64_t, numberOfVariables, uint64_t, blockIndex) {
-    std::vector<uint8_t> e(numberOfVariables);
+    // Reuse the buffer of the worker to avoid contention on the allocator, as this is called for every leaf of the refinement.
+    static thread_local std::vector<uint8_t> e;
+    e.resize(numberOfVariables);
     for (uint64_t i = 0; i < numberOfVariables; ++i) {
         e[i] = blockIndex & 1 ? 1 : 0;
         blockIndex >>= 1;
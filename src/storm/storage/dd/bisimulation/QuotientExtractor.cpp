@@ -1,8 +1,10 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <limits>
 #include <numeric>
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ParallelConversion.h"
 
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Dtmc.h"
@@ -25,6 +27,7 @@
 #include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 
 #include "storm/storage/BitVector.h"
@@ -240,6 +243,21 @@ class InternalRepresentativeComputer<storm::dd::DdType::Sylvan> : public Interna
     phmap::flat_hash_map<BDD, bool> visitedNodes;
 };
 
+// A recursive call of the transition matrix extraction that is deferred such that it can be processed concurrently with others. All calls with
+// different source offsets (at the same depth) produce disjoint ranges of rows.
+template<typename NodeType>
+struct MatrixExtractionTask {
+    NodeType transitionMatrixNode;
+    storm::dd::Odd const* sourceOdd;
+    uint64_t sourceOffset;
+    NodeType targetPartitionNode;
+    NodeType representativesNode;
+    NodeType variables;
+    NodeType nondeterminismVariables;
+    storm::dd::Odd const* stateOdd;
+    uint64_t stateOffset;
+};
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
 class InternalSparseQuotientExtractor;
 
@@ -248,7 +266,7 @@ class InternalSparseQuotientExtractorBase {
    public:
     InternalSparseQuotientExtractorBase(storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& partitionBdd,
                                         storm::expressions::Variable const& blockVariable, uint64_t numberOfBlocks,
-                                        storm::dd::Bdd<DdType> const& representatives)
+                                        storm::dd::Bdd<DdType> const& representatives, bool parallel)
         : model(model),
           manager(model.getManager()),
           isNondeterministic(false),
@@ -256,6 +274,8 @@ class InternalSparseQuotientExtractorBase {
           numberOfBlocks(numberOfBlocks),
           blockVariable(blockVariable),
           representatives(representatives),
+          parallel(parallel),
+          splitDepth(std::numeric_limits<uint64_t>::max()),
           matrixEntriesCreated(false) {
         // Create cubes.
         rowVariablesCube = manager.getBddOne();
@@ -276,6 +296,23 @@ class InternalSparseQuotientExtractorBase {
         allSourceVariablesCube = rowVariablesCube && nondeterminismVariablesCube;
         isNondeterministic = !nondeterminismVariablesCube.isOne();
 
+        // Determine the depth at which the matrix extraction is split into parallel tasks (if at all).
+        if (this->parallel) {
+            uint64_t numberOfSourceVariables = 0;
+            for (auto const& variable : model.getRowVariables()) {
+                numberOfSourceVariables += manager.getMetaVariable(variable).getNumberOfDdVariables();
+            }
+            for (auto const& variable : model.getNondeterminismVariables()) {
+                numberOfSourceVariables += manager.getMetaVariable(variable).getNumberOfDdVariables();
+            }
+            uint64_t splitLevel = storm::dd::getParallelConversionSplitLevel(numberOfSourceVariables);
+            STORM_LOG_INFO_COND(splitLevel > 0, "Extracting the quotient sequentially, because Intel TBB is disabled or the model is too small.");
+            this->parallel = splitLevel > 0;
+            if (this->parallel) {
+                splitDepth = splitLevel;
+            }
+        }
+
         // Create ODDs.
         this->odd = representatives.createOdd();
         if (this->isNondeterministic) {
@@ -328,11 +365,52 @@ class InternalSparseQuotientExtractorBase {
     virtual std::vector<ExportValueType> extractVectorInternal(storm::dd::Add<DdType, ValueType> const& vector, storm::dd::Bdd<DdType> const& variablesCube,
                                                                storm::dd::Odd const& odd) = 0;
 
+    /*!
+     * Processes the given deferred calls of the matrix extraction. Calls that share their source offset write to the same rows and are therefore processed
+     * by the same thread, whereas the row ranges of different source offsets are processed in parallel.
+     */
+    template<typename NodeType, typename ExtractFunction>
+    void processMatrixExtractionTasks(std::vector<MatrixExtractionTask<NodeType>>& tasks, ExtractFunction const& extract) {
+        if (tasks.empty()) {
+            return;
+        }
+        std::stable_sort(tasks.begin(), tasks.end(), [](MatrixExtractionTask<NodeType> const& first, MatrixExtractionTask<NodeType> const& second) {
+            return first.sourceOffset < second.sourceOffset;
+        });
+        std::vector<uint64_t> groupStarts = {0};
+        for (uint64_t taskIndex = 1; taskIndex < tasks.size(); ++taskIndex) {
+            if (tasks[taskIndex].sourceOffset != tasks[taskIndex - 1].sourceOffset) {
+                groupStarts.push_back(taskIndex);
+            }
+        }
+        groupStarts.push_back(tasks.size());
+        STORM_LOG_TRACE("Extracting the quotient matrix in " << groupStarts.size() - 1 << " row ranges from " << tasks.size() << " tasks.");
+
+        storm::dd::performParallelConversion(groupStarts.size() - 1, [&tasks, &groupStarts, &extract](uint_fast64_t group) {
+            for (uint64_t taskIndex = groupStarts[group]; taskIndex < groupStarts[group + 1]; ++taskIndex) {
+                extract(tasks[taskIndex]);
+            }
+        });
+        tasks.clear();
+    }
+
     storm::storage::SparseMatrix<ExportValueType> createMatrixFromEntries() {
-        for (auto& row : matrixEntries) {
+        auto sortRow = [](std::vector<storm::storage::MatrixEntry<uint_fast64_t, ExportValueType>>& row) {
             std::sort(row.begin(), row.end(),
                       [](storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& a,
                          storm::storage::MatrixEntry<uint_fast64_t, ExportValueType> const& b) { return a.getColumn() < b.getColumn(); });
+        };
+        if (parallel) {
+            uint64_t const rowsPerJob = 1024;
+            storm::dd::performParallelConversion((matrixEntries.size() + rowsPerJob - 1) / rowsPerJob, [this, &sortRow](uint_fast64_t job) {
+                for (uint64_t row = job * rowsPerJob, end = std::min<uint64_t>(row + rowsPerJob, matrixEntries.size()); row < end; ++row) {
+                    sortRow(matrixEntries[row]);
+                }
+            });
+        } else {
+            for (auto& row : matrixEntries) {
+                sortRow(row);
+            }
         }
 
         rowPermutation = std::vector<uint64_t>(matrixEntries.size());
@@ -418,6 +496,11 @@ class InternalSparseQuotientExtractorBase {
     storm::dd::Odd odd;
     storm::dd::Odd nondeterminismOdd;
 
+    // Whether the transition matrix is extracted in parallel. If so, the recursive extraction is split into independent tasks once it has descended
+    // splitDepth source variables, which yields up to 2^splitDepth row ranges.
+    bool parallel;
+    uint64_t splitDepth;
+
     // A flag that stores whether the underlying storage for matrix entries has been created.
     bool matrixEntriesCreated;
 
@@ -436,8 +519,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::CUDD, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::CUDD> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives)
-        : InternalSparseQuotientExtractorBase<storm::dd::DdType::CUDD, ValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives),
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::CUDD> const& representatives, bool parallel)
+        : InternalSparseQuotientExtractorBase<storm::dd::DdType::CUDD, ValueType>(model, partitionBdd, blockVariable, numberOfBlocks, representatives,
+                                                                                  parallel),
           ddman(this->manager.getInternalDdManager().getCuddManager().getManager()) {
         this->createBlockToOffsetMapping();
     }
@@ -448,7 +532,11 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
         extractTransitionMatrixRec(matrix.getInternalAdd().getCuddDdNode(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0,
                                    this->partitionBdd.getInternalBdd().getCuddDdNode(), this->representatives.getInternalBdd().getCuddDdNode(),
                                    this->allSourceVariablesCube.getInternalBdd().getCuddDdNode(),
-                                   this->nondeterminismVariablesCube.getInternalBdd().getCuddDdNode(), this->isNondeterministic ? &this->odd : nullptr, 0);
+                                   this->nondeterminismVariablesCube.getInternalBdd().getCuddDdNode(), this->isNondeterministic ? &this->odd : nullptr, 0, 0);
+        this->processMatrixExtractionTasks(extractionTasks, [this](MatrixExtractionTask<DdNodePtr> const& task) {
+            extractTransitionMatrixRec(task.transitionMatrixNode, *task.sourceOdd, task.sourceOffset, task.targetPartitionNode, task.representativesNode,
+                                       task.variables, task.nondeterminismVariables, task.stateOdd, task.stateOffset, this->splitDepth + 1);
+        });
         return this->createMatrixFromEntries();
     }
 
@@ -553,13 +641,20 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
 
     void extractTransitionMatrixRec(DdNodePtr transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, DdNodePtr targetPartitionNode,
                                     DdNodePtr representativesNode, DdNodePtr variables, DdNodePtr nondeterminismVariables, storm::dd::Odd const* stateOdd,
-                                    uint64_t stateOffset) {
+                                    uint64_t stateOffset, uint64_t depth) {
         // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
         // as all states of the model have to be contained.
         if (transitionMatrixNode == Cudd_ReadZero(ddman) || representativesNode == Cudd_ReadLogicZero(ddman)) {
             return;
         }
 
+        // Defer the call if the extraction is split into parallel tasks at this depth.
+        if (depth == this->splitDepth) {
+            extractionTasks.push_back({transitionMatrixNode, &sourceOdd, sourceOffset, targetPartitionNode, representativesNode, variables,
+                                       nondeterminismVariables, stateOdd, stateOffset});
+            return;
+        }
+
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (Cudd_IsConstant(variables)) {
             STORM_LOG_ASSERT(Cudd_IsConstant(transitionMatrixNode), "Expected constant node.");
@@ -586,9 +681,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
 
                 STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
                 extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, Cudd_T(variables),
-                                           Cudd_T(nondeterminismVariables), stateOdd, stateOffset);
+                                           Cudd_T(nondeterminismVariables), stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode,
-                                           Cudd_T(variables), Cudd_T(nondeterminismVariables), stateOdd, stateOffset);
+                                           Cudd_T(variables), Cudd_T(nondeterminismVariables), stateOdd, stateOffset, depth + 1);
             } else {
                 DdNodePtr t;
                 DdNodePtr tt;
@@ -659,15 +754,15 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
                 }
 
                 extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, Cudd_T(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, Cudd_T(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT,
                                            Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), depth + 1);
                 extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT,
                                            Cudd_T(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), depth + 1);
             }
         }
     }
@@ -676,6 +771,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::CUDD, ValueType> : publ
 
     // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block.
     phmap::flat_hash_map<DdNode const*, uint64_t> blockToOffset;
+
+    // The calls of the matrix extraction that are deferred to be processed in parallel.
+    std::vector<MatrixExtractionTask<DdNodePtr>> extractionTasks;
 };
 
 template<typename ValueType, typename ExportValueType>
@@ -684,9 +782,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
    public:
     InternalSparseQuotientExtractor(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, ValueType> const& model,
                                     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& partitionBdd, storm::expressions::Variable const& blockVariable,
-                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives)
+                                    uint64_t numberOfBlocks, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& representatives, bool parallel)
         : InternalSparseQuotientExtractorBase<storm::dd::DdType::Sylvan, ValueType, ExportValueType>(model, partitionBdd, blockVariable, numberOfBlocks,
-                                                                                                     representatives) {
+                                                                                                     representatives, parallel) {
         this->createBlockToOffsetMapping();
     }
 
@@ -697,7 +795,11 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
                                    this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
                                    this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
                                    this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr,
-                                   0);
+                                   0, 0);
+        this->processMatrixExtractionTasks(extractionTasks, [this](MatrixExtractionTask<MTBDD> const& task) {
+            extractTransitionMatrixRec(task.transitionMatrixNode, *task.sourceOdd, task.sourceOffset, task.targetPartitionNode, task.representativesNode,
+                                       task.variables, task.nondeterminismVariables, task.stateOdd, task.stateOffset, this->splitDepth + 1);
+        });
         return this->createMatrixFromEntries();
     }
 
@@ -786,13 +888,21 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
     }
 
     void extractTransitionMatrixRec(MTBDD transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, BDD targetPartitionNode,
-                                    BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset) {
+                                    BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset,
+                                    uint64_t depth) {
         // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
         // as all states of the model have to be contained.
         if (mtbdd_iszero(transitionMatrixNode) || representativesNode == sylvan_false) {
             return;
         }
 
+        // Defer the call if the extraction is split into parallel tasks at this depth.
+        if (depth == this->splitDepth) {
+            extractionTasks.push_back({transitionMatrixNode, &sourceOdd, sourceOffset, targetPartitionNode, representativesNode, variables,
+                                       nondeterminismVariables, stateOdd, stateOffset});
+            return;
+        }
+
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (sylvan_isconst(variables)) {
             STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
@@ -821,9 +931,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
 
                 STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
                 extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, sylvan_high(variables),
-                                           sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
+                                           sylvan_high(nondeterminismVariables), stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode,
-                                           sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
+                                           sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset, depth + 1);
             } else {
                 MTBDD t;
                 MTBDD tt;
@@ -884,29 +994,35 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
                 }
 
                 extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, depth + 1);
                 extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT,
                                            sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), depth + 1);
                 extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT,
                                            sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), depth + 1);
             }
         }
     }
 
     // A mapping from blocks (stored in terms of a DD node) to the offset of the corresponding block.
     phmap::flat_hash_map<BDD, uint64_t> blockToOffset;
+
+    // The calls of the matrix extraction that are deferred to be processed in parallel.
+    std::vector<MatrixExtractionTask<MTBDD>> extractionTasks;
 };
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 QuotientExtractor<DdType, ValueType, ExportValueType>::QuotientExtractor(storm::dd::bisimulation::QuotientFormat const& quotientFormat)
-    : useRepresentatives(false), quotientFormat(quotientFormat) {
+    : useRepresentatives(false), parallelSparseExtraction(false), quotientFormat(quotientFormat) {
     auto const& settings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
     this->useRepresentatives = settings.isUseRepresentativesSet();
     this->useOriginalVariables = settings.isUseOriginalVariablesSet();
+
+    this->parallelSparseExtraction = storm::NumberTraits<ValueType>::IsThreadSafe && storm::NumberTraits<ExportValueType>::IsThreadSafe &&
+                                     settings.isParallelQuotientExtractionSet();
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -945,7 +1061,8 @@ std::shared_ptr<storm::models::sparse::Model<ExportValueType>> QuotientExtractor
     STORM_LOG_ASSERT((representatives && partitionAsBdd).existsAbstract(model.getRowVariables()) == partitionAsBdd.existsAbstract(model.getRowVariables()),
                      "Representatives do not cover all blocks.");
     InternalSparseQuotientExtractor<DdType, ValueType, ExportValueType> sparseExtractor(model, partitionAsBdd, partition.getBlockVariable(),
-                                                                                        partition.getNumberOfBlocks(), representatives);
+                                                                                        partition.getNumberOfBlocks(), representatives,
+                                                                                        parallelSparseExtraction);
     storm::storage::SparseMatrix<ExportValueType> quotientTransitionMatrix = sparseExtractor.extractTransitionMatrix(model.getTransitionMatrix());
     auto end = std::chrono::high_resolution_clock::now();
     STORM_LOG_INFO("Quotient transition matrix extracted in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
@@ -41,6 +41,7 @@ class QuotientExtractor {
 
     bool useRepresentatives;
     bool useOriginalVariables;
+    bool parallelSparseExtraction;
     storm::dd::bisimulation::QuotientFormat quotientFormat;
 };
 
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ParallelConversion.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
@@ -432,6 +433,51 @@ AddIterator<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::end(D
     return AddIterator<DdType::CUDD, ValueType>(fullDdManager, nullptr, nullptr, 0, true, nullptr, false);
 }
 
+template<typename ValueType>
+std::vector<SerializedDdNode> InternalAdd<DdType::CUDD, ValueType>::toSerializedNodes() const {
+    std::vector<SerializedDdNode> nodes;
+    std::unordered_map<DdNode*, uint64_t> nodeToPosition;
+    toSerializedNodesRec(this->getCuddDdNode(), nodes, nodeToPosition);
+    return nodes;
+}
+
+template<typename ValueType>
+uint64_t InternalAdd<DdType::CUDD, ValueType>::toSerializedNodesRec(DdNode* node, std::vector<SerializedDdNode>& nodes,
+                                                                    std::unordered_map<DdNode*, uint64_t>& nodeToPosition) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+
+    SerializedDdNode serializedNode;
+    if (Cudd_IsConstant(node)) {
+        serializedNode = {SerializedDdNode::leafIndex, encodeLeafValue(storm::utility::convertNumber<ValueType>(Cudd_V(node))), 0};
+    } else {
+        uint64_t thenPosition = toSerializedNodesRec(Cudd_T(node), nodes, nodeToPosition);
+        uint64_t elsePosition = toSerializedNodesRec(Cudd_E(node), nodes, nodeToPosition);
+        serializedNode = {static_cast<uint64_t>(Cudd_NodeReadIndex(node)), thenPosition, elsePosition};
+    }
+    nodes.push_back(serializedNode);
+    nodeToPosition.emplace(node, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+template<typename ValueType>
+InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromSerializedNodes(InternalDdManager<DdType::CUDD> const* ddManager,
+                                                                                               std::vector<SerializedDdNode> const& nodes) {
+    cudd::Cudd const& manager = ddManager->getCuddManager();
+    std::vector<cudd::ADD> adds;
+    adds.reserve(nodes.size());
+    for (auto const& node : nodes) {
+        if (node.index == SerializedDdNode::leafIndex) {
+            adds.push_back(ddManager->getConstant(decodeLeafValue<ValueType>(node.thenNode)).getCuddAdd());
+        } else {
+            adds.push_back(manager.addVar(node.index).Ite(adds[node.thenNode], adds[node.elseNode]));
+        }
+    }
+    return InternalAdd<DdType::CUDD, ValueType>(ddManager, adds.back());
+}
+
 template<typename ValueType>
 cudd::ADD InternalAdd<DdType::CUDD, ValueType>::getCuddAdd() const {
     return this->cuddAdd;
@@ -729,9 +775,88 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_f
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+    uint_fast64_t const maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    uint_fast64_t const splitLevel = storm::dd::getParallelConversionSplitLevel(ddRowVariableIndices.size());
+    if (splitLevel == 0) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Collect the subtrees at the split level and translate them concurrently. As all subtrees of a job share their rows, the jobs write to disjoint
+    // rows and the subtrees of a job are (in the order of their columns) translated sequentially.
+    std::vector<std::vector<MatrixComponentsSubtree>> jobs(1ull << splitLevel);
+    collectMatrixComponentsSubtreesRec(this->getCuddDdNode(), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    storm::dd::performParallelConversion(jobs.size(), [&](uint_fast64_t job) {
+        for (auto const& subtree : jobs[job]) {
+            toMatrixComponentsRec(subtree.dd, rowGroupIndices, rowIndications, columnsAndValues, *subtree.rowOdd, *subtree.columnOdd, splitLevel, splitLevel,
+                                  maxLevel, subtree.rowOffset, subtree.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+    });
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::getMatrixSuccessors(DdNode const* dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex,
+                                                               DdNode const*& elseElse, DdNode const*& elseThen, DdNode const*& thenElse,
+                                                               DdNode const*& thenThen) {
+    if (ddColumnVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndex < Cudd_NodeReadIndex(dd)) {
+        elseElse = thenElse = Cudd_E_const(dd);
+        elseThen = thenThen = Cudd_T_const(dd);
+    } else {
+        DdNode const* elseNode = Cudd_E_const(dd);
+        if (ddColumnVariableIndex < Cudd_NodeReadIndex(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = Cudd_E_const(elseNode);
+            elseThen = Cudd_T_const(elseNode);
+        }
+
+        DdNode const* thenNode = Cudd_T_const(dd);
+        if (ddColumnVariableIndex < Cudd_NodeReadIndex(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = Cudd_E_const(thenNode);
+            thenThen = Cudd_T_const(thenNode);
+        }
+    }
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::CUDD, ValueType>::collectMatrixComponentsSubtreesRec(DdNode const* dd, Odd const& rowOdd, Odd const& columnOdd,
+                                                                              uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                                                                              uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                              uint_fast64_t currentJob, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                              std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                                                              std::vector<std::vector<MatrixComponentsSubtree>>& jobs) const {
+    // For the empty DD, we do not need to add any entries.
+    if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        jobs[currentJob].push_back({dd, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
+    DdNode const* elseElse;
+    DdNode const* elseThen;
+    DdNode const* thenElse;
+    DdNode const* thenThen;
+    getMatrixSuccessors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+    collectMatrixComponentsSubtreesRec(elseElse, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel, currentRowOffset,
+                                       currentColumnOffset, 2 * currentJob, ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(elseThen, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel, currentRowOffset,
+                                       currentColumnOffset + columnOdd.getElseOffset(), 2 * currentJob, ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(thenElse, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, splitLevel,
+                                       currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, 2 * currentJob + 1, ddRowVariableIndices,
+                                       ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(thenThen, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, splitLevel,
+                                       currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), 2 * currentJob + 1,
+                                       ddRowVariableIndices, ddColumnVariableIndices, jobs);
 }
 
 template<typename ValueType>
@@ -759,29 +884,7 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         DdNode const* elseThen;
         DdNode const* thenElse;
         DdNode const* thenThen;
-
-        if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(dd)) {
-            elseElse = thenElse = Cudd_E_const(dd);
-            elseThen = thenThen = Cudd_T_const(dd);
-        } else {
-            DdNode const* elseNode = Cudd_E_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = Cudd_E_const(elseNode);
-                elseThen = Cudd_T_const(elseNode);
-            }
-
-            DdNode const* thenNode = Cudd_T_const(dd);
-            if (ddColumnVariableIndices[currentColumnLevel] < Cudd_NodeReadIndex(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = Cudd_E_const(thenNode);
-                thenThen = Cudd_T_const(thenNode);
-            }
-        }
+        getMatrixSuccessors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
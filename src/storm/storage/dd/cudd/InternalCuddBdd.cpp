@@ -230,6 +230,52 @@ void InternalBdd<DdType::CUDD>::exportToText(std::string const&) const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported");
 }
 
+std::vector<SerializedDdNode> InternalBdd<DdType::CUDD>::toSerializedNodes() const {
+    std::vector<SerializedDdNode> nodes;
+    std::unordered_map<DdNode*, uint64_t> nodeToPosition;
+    toSerializedNodesRec(this->getCuddDdNode(), nodes, nodeToPosition);
+    return nodes;
+}
+
+uint64_t InternalBdd<DdType::CUDD>::toSerializedNodesRec(DdNode* node, std::vector<SerializedDdNode>& nodes,
+                                                         std::unordered_map<DdNode*, uint64_t>& nodeToPosition) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+
+    // The complement mark of the node is pushed to the successors, so every (possibly complemented) node is stored as a regular node.
+    DdNode* regularNode = Cudd_Regular(node);
+    bool complemented = Cudd_IsComplement(node);
+    SerializedDdNode serializedNode;
+    if (Cudd_IsConstant(regularNode)) {
+        serializedNode = {SerializedDdNode::leafIndex, complemented ? 0ull : 1ull, 0};
+    } else {
+        uint64_t thenPosition = toSerializedNodesRec(Cudd_NotCond(Cudd_T(regularNode), complemented), nodes, nodeToPosition);
+        uint64_t elsePosition = toSerializedNodesRec(Cudd_NotCond(Cudd_E(regularNode), complemented), nodes, nodeToPosition);
+        serializedNode = {static_cast<uint64_t>(Cudd_NodeReadIndex(regularNode)), thenPosition, elsePosition};
+    }
+    nodes.push_back(serializedNode);
+    nodeToPosition.emplace(node, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+InternalBdd<DdType::CUDD> InternalBdd<DdType::CUDD>::fromSerializedNodes(InternalDdManager<DdType::CUDD> const* ddManager,
+                                                                         std::vector<SerializedDdNode> const& nodes) {
+    cudd::Cudd const& manager = ddManager->getCuddManager();
+    std::vector<cudd::BDD> bdds;
+    bdds.reserve(nodes.size());
+    for (auto const& node : nodes) {
+        if (node.index == SerializedDdNode::leafIndex) {
+            bdds.push_back(node.thenNode != 0 ? manager.bddOne() : manager.bddZero());
+        } else {
+            // Building the nodes via ite keeps the BDD valid even if the variable order changed since the BDD was stored.
+            bdds.push_back(manager.bddVar(node.index).Ite(bdds[node.thenNode], bdds[node.elseNode]));
+        }
+    }
+    return InternalBdd<DdType::CUDD>(ddManager, bdds.back());
+}
+
 cudd::BDD InternalBdd<DdType::CUDD>::getCuddBdd() const {
     return this->cuddBdd;
 }
@@ -201,6 +201,24 @@ void InternalDdManager<DdType::CUDD>::debugCheck() const {
     this->getCuddManager().DebugCheck();
 }
 
+DdManagerStatistics InternalDdManager<DdType::CUDD>::getStatistics() const {
+    ::DdManager* manager = this->getCuddManager().getManager();
+    DdManagerStatistics statistics;
+    statistics.library = "CUDD";
+    statistics.peakNodes = static_cast<uint64_t>(Cudd_ReadPeakLiveNodeCount(manager));
+    statistics.liveNodes = static_cast<uint64_t>(Cudd_ReadNodeCount(manager));
+    statistics.uniqueTableSize = Cudd_ReadSlots(manager);
+    statistics.operationCacheSize = Cudd_ReadCacheSlots(manager);
+    statistics.operationCacheUsage = Cudd_ReadCacheUsedSlots(manager);
+    double lookups = Cudd_ReadCacheLookUps(manager);
+    if (lookups > 0) {
+        statistics.operationCacheHitRate = Cudd_ReadCacheHits(manager) / lookups;
+    }
+    statistics.garbageCollections = static_cast<uint64_t>(Cudd_ReadGarbageCollections(manager));
+    statistics.garbageCollectionTime = std::chrono::milliseconds(Cudd_ReadGarbageCollectionTime(manager));
+    return statistics;
+}
+
 void InternalDdManager<DdType::CUDD>::execute(std::function<void()> const& f) const {
     f();
 }
@@ -4,6 +4,7 @@
 #include <boost/optional.hpp>
 #include <functional>
 
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
 
@@ -132,6 +133,13 @@ class InternalDdManager<DdType::CUDD> {
      */
     void debugCheck() const;
 
+    /*!
+     * Retrieves statistics of the DD library, e.g. node counts, cache usage and garbage collections. The operation statistics are not set.
+     *
+     * @return The statistics.
+     */
+    DdManagerStatistics getStatistics() const;
+
     /*!
      * All code that manipulates DDs shall be called through this function.
      * This is generally needed to set-up the correct context.
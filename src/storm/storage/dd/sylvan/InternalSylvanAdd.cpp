@@ -3,6 +3,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ParallelConversion.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 
@@ -12,6 +13,7 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -1233,9 +1235,96 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+    uint_fast64_t const maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    uint_fast64_t splitLevel = 0;
+    if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+        splitLevel = storm::dd::getParallelConversionSplitLevel(ddRowVariableIndices.size());
+    }
+    if (splitLevel == 0) {
+        toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                              ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Collect the subtrees at the split level and translate them concurrently. As all subtrees of a job share their rows, the jobs write to disjoint
+    // rows and the subtrees of a job are (in the order of their columns) translated sequentially.
+    std::vector<std::vector<MatrixComponentsSubtree>> jobs(1ull << splitLevel);
+    collectMatrixComponentsSubtreesRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowOdd, columnOdd, 0, splitLevel, 0, 0, 0, ddRowVariableIndices,
+                                       ddColumnVariableIndices, jobs);
+    storm::dd::performParallelConversion(jobs.size(), [&](uint_fast64_t job) {
+        for (auto const& subtree : jobs[job]) {
+            toMatrixComponentsRec(subtree.dd, subtree.negated, rowGroupIndices, rowIndications, columnsAndValues, *subtree.rowOdd, *subtree.columnOdd,
+                                  splitLevel, splitLevel, maxLevel, subtree.rowOffset, subtree.columnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                                  writeValues);
+        }
+    });
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::getMatrixSuccessors(MTBDD dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex,
+                                                                 MTBDD& elseElse, MTBDD& elseThen, MTBDD& thenElse, MTBDD& thenThen) {
+    if (mtbdd_isleaf(dd) || ddColumnVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = elseThen = thenElse = thenThen = dd;
+    } else if (ddRowVariableIndex < mtbdd_getvar(dd)) {
+        elseElse = thenElse = mtbdd_getlow(dd);
+        elseThen = thenThen = mtbdd_gethigh(dd);
+    } else {
+        MTBDD elseNode = mtbdd_getlow(dd);
+        if (mtbdd_isleaf(elseNode) || ddColumnVariableIndex < mtbdd_getvar(elseNode)) {
+            elseElse = elseThen = elseNode;
+        } else {
+            elseElse = mtbdd_getlow(elseNode);
+            elseThen = mtbdd_gethigh(elseNode);
+        }
+
+        MTBDD thenNode = mtbdd_gethigh(dd);
+        if (mtbdd_isleaf(thenNode) || ddColumnVariableIndex < mtbdd_getvar(thenNode)) {
+            thenElse = thenThen = thenNode;
+        } else {
+            thenElse = mtbdd_getlow(thenNode);
+            thenThen = mtbdd_gethigh(thenNode);
+        }
+    }
+}
+
+template<typename ValueType>
+void InternalAdd<DdType::Sylvan, ValueType>::collectMatrixComponentsSubtreesRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd,
+                                                                                uint_fast64_t currentLevel, uint_fast64_t splitLevel,
+                                                                                uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                                uint_fast64_t currentJob,
+                                                                                std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                                std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                                                                std::vector<std::vector<MatrixComponentsSubtree>>& jobs) const {
+    // For the empty DD, we do not need to add any entries.
+    if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
+        return;
+    }
+
+    if (currentLevel == splitLevel) {
+        jobs[currentJob].push_back({dd, negated, &rowOdd, &columnOdd, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
+    MTBDD elseElse;
+    MTBDD elseThen;
+    MTBDD thenElse;
+    MTBDD thenThen;
+    getMatrixSuccessors(dd, ddRowVariableIndices[currentLevel], ddColumnVariableIndices[currentLevel], elseElse, elseThen, thenElse, thenThen);
+
+    collectMatrixComponentsSubtreesRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
+                                       currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset, 2 * currentJob, ddRowVariableIndices,
+                                       ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
+                                       currentLevel + 1, splitLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), 2 * currentJob,
+                                       ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
+                                       currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, 2 * currentJob + 1,
+                                       ddRowVariableIndices, ddColumnVariableIndices, jobs);
+    collectMatrixComponentsSubtreesRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
+                                       currentLevel + 1, splitLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(),
+                                       2 * currentJob + 1, ddRowVariableIndices, ddColumnVariableIndices, jobs);
 }
 
 template<typename ValueType>
@@ -1263,29 +1352,7 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         MTBDD elseThen;
         MTBDD thenElse;
         MTBDD thenThen;
-
-        if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = elseThen = thenElse = thenThen = dd;
-        } else if (ddRowVariableIndices[currentColumnLevel] < mtbdd_getvar(dd)) {
-            elseElse = thenElse = mtbdd_getlow(dd);
-            elseThen = thenThen = mtbdd_gethigh(dd);
-        } else {
-            MTBDD elseNode = mtbdd_getlow(dd);
-            if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(elseNode)) {
-                elseElse = elseThen = elseNode;
-            } else {
-                elseElse = mtbdd_getlow(elseNode);
-                elseThen = mtbdd_gethigh(elseNode);
-            }
-
-            MTBDD thenNode = mtbdd_gethigh(dd);
-            if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentColumnLevel] < mtbdd_getvar(thenNode)) {
-                thenElse = thenThen = thenNode;
-            } else {
-                thenElse = mtbdd_getlow(thenNode);
-                thenThen = mtbdd_gethigh(thenNode);
-            }
-        }
+        getMatrixSuccessors(dd, ddRowVariableIndices[currentColumnLevel], ddColumnVariableIndices[currentColumnLevel], elseElse, elseThen, thenElse, thenThen);
 
         // Visit else-else.
         toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
@@ -1386,6 +1453,50 @@ MTBDD InternalAdd<DdType::Sylvan, ValueType>::getLeaf(storm::RationalNumber cons
     return mtbdd_storm_rational_number(ptr);
 }
 
+template<typename ValueType>
+std::vector<SerializedDdNode> InternalAdd<DdType::Sylvan, ValueType>::toSerializedNodes() const {
+    std::vector<SerializedDdNode> nodes;
+    std::unordered_map<MTBDD, uint64_t> nodeToPosition;
+    toSerializedNodesRec(this->getSylvanMtbdd().GetMTBDD(), nodes, nodeToPosition);
+    return nodes;
+}
+
+template<typename ValueType>
+uint64_t InternalAdd<DdType::Sylvan, ValueType>::toSerializedNodesRec(MTBDD node, std::vector<SerializedDdNode>& nodes,
+                                                                      std::unordered_map<MTBDD, uint64_t>& nodeToPosition) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+
+    SerializedDdNode serializedNode;
+    if (mtbdd_isleaf(node)) {
+        serializedNode = {SerializedDdNode::leafIndex, encodeLeafValue(getValue(node)), 0};
+    } else {
+        uint64_t thenPosition = toSerializedNodesRec(mtbdd_gethigh(node), nodes, nodeToPosition);
+        uint64_t elsePosition = toSerializedNodesRec(mtbdd_getlow(node), nodes, nodeToPosition);
+        serializedNode = {static_cast<uint64_t>(mtbdd_getvar(node)), thenPosition, elsePosition};
+    }
+    nodes.push_back(serializedNode);
+    nodeToPosition.emplace(node, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+template<typename ValueType>
+InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::fromSerializedNodes(InternalDdManager<DdType::Sylvan> const* ddManager,
+                                                                                                   std::vector<SerializedDdNode> const& nodes) {
+    std::vector<sylvan::Mtbdd> mtbdds;
+    mtbdds.reserve(nodes.size());
+    for (auto const& node : nodes) {
+        if (node.index == SerializedDdNode::leafIndex) {
+            mtbdds.emplace_back(getLeaf(decodeLeafValue<ValueType>(node.thenNode)));
+        } else {
+            mtbdds.push_back(sylvan::Bdd::bddVar(node.index).Ite(mtbdds[node.thenNode], mtbdds[node.elseNode]));
+        }
+    }
+    return InternalAdd<DdType::Sylvan, ValueType>(ddManager, mtbdds.back());
+}
+
 template<typename ValueType>
 sylvan::Mtbdd InternalAdd<DdType::Sylvan, ValueType>::getSylvanMtbdd() const {
     return sylvanMtbdd;
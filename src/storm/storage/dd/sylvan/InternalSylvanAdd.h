@@ -4,6 +4,7 @@
 #include <set>
 #include <unordered_map>
 
+#include "storm/storage/dd/DdSerialization.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalAdd.h"
 #include "storm/storage/dd/Odd.h"
@@ -518,6 +519,23 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      */
     void exportToText(std::string const& filename) const;
 
+    /*!
+     * Retrieves the node table of the ADD in the library-independent binary format.
+     *
+     * @return The node table whose last node is the root of the ADD.
+     */
+    std::vector<SerializedDdNode> toSerializedNodes() const;
+
+    /*!
+     * Builds the ADD described by the given node table in the library-independent binary format.
+     *
+     * @param ddManager The manager responsible for the ADD.
+     * @param nodes The node table whose last node is the root of the ADD.
+     * @return The resulting ADD.
+     */
+    static InternalAdd<DdType::Sylvan, ValueType> fromSerializedNodes(InternalDdManager<DdType::Sylvan> const* ddManager,
+                                                                      std::vector<SerializedDdNode> const& nodes);
+
     /*!
      * Retrieves an iterator that points to the first meta variable assignment with a non-zero function value.
      *
@@ -679,6 +697,16 @@ class InternalAdd<DdType::Sylvan, ValueType> {
     std::string getStringId() const;
 
    private:
+    /*!
+     * Recursively appends the (not yet visited) nodes of the given DD to the node table.
+     *
+     * @param node The (possibly complemented) node to append.
+     * @param nodes The node table.
+     * @param nodeToPosition A mapping from the already appended nodes to their position in the node table.
+     * @return The position of the given node in the node table.
+     */
+    static uint64_t toSerializedNodesRec(MTBDD node, std::vector<SerializedDdNode>& nodes, std::unordered_map<MTBDD, uint64_t>& nodeToPosition);
+
     /*!
      * Recursively builds the ODD from an ADD.
      *
@@ -813,6 +841,35 @@ class InternalAdd<DdType::Sylvan, ValueType> {
                                uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
 
+    // A subtree of the DD that is translated by one job of the parallel translation to an explicit matrix.
+    struct MatrixComponentsSubtree {
+        MTBDD dd;
+        bool negated;
+        Odd const* rowOdd;
+        Odd const* columnOdd;
+        uint_fast64_t rowOffset;
+        uint_fast64_t columnOffset;
+    };
+
+    /*!
+     * Retrieves the successors of the given node wrt. the given row variable and the given (subsequent) column variable.
+     */
+    static void getMatrixSuccessors(MTBDD dd, uint_fast64_t ddRowVariableIndex, uint_fast64_t ddColumnVariableIndex, MTBDD& elseElse, MTBDD& elseThen,
+                                    MTBDD& thenElse, MTBDD& thenThen);
+
+    /*!
+     * Collects the (non-zero) subtrees of the DD at the given split level. The subtrees are grouped into jobs according to the values of the first
+     * splitLevel row variables. Within a job, the subtrees are ordered by their columns.
+     *
+     * @param currentJob The index of the job that is determined by the values of the row variables visited so far.
+     * @param jobs The jobs of which there need to be 2^splitLevel.
+     */
+    void collectMatrixComponentsSubtreesRec(MTBDD dd, bool negated, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel,
+                                            uint_fast64_t splitLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                            uint_fast64_t currentJob, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                            std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                                            std::vector<std::vector<MatrixComponentsSubtree>>& jobs) const;
+
     /*!
      * Retrieves the sylvan representation of the given double value.
      *
@@ -265,6 +265,47 @@ void InternalBdd<DdType::Sylvan>::exportToText(std::string const& filename) cons
     }
 }
 
+std::vector<SerializedDdNode> InternalBdd<DdType::Sylvan>::toSerializedNodes() const {
+    std::vector<SerializedDdNode> nodes;
+    std::unordered_map<BDD, uint64_t> nodeToPosition;
+    toSerializedNodesRec(this->getSylvanBdd().GetBDD(), nodes, nodeToPosition);
+    return nodes;
+}
+
+uint64_t InternalBdd<DdType::Sylvan>::toSerializedNodesRec(BDD node, std::vector<SerializedDdNode>& nodes, std::unordered_map<BDD, uint64_t>& nodeToPosition) {
+    auto positionIt = nodeToPosition.find(node);
+    if (positionIt != nodeToPosition.end()) {
+        return positionIt->second;
+    }
+
+    // Retrieving the successors transfers the complement mark of the node, so every (possibly complemented) node is stored as a regular node.
+    SerializedDdNode serializedNode;
+    if (node == sylvan_true || node == sylvan_false) {
+        serializedNode = {SerializedDdNode::leafIndex, node == sylvan_true ? 1ull : 0ull, 0};
+    } else {
+        uint64_t thenPosition = toSerializedNodesRec(sylvan_high(node), nodes, nodeToPosition);
+        uint64_t elsePosition = toSerializedNodesRec(sylvan_low(node), nodes, nodeToPosition);
+        serializedNode = {static_cast<uint64_t>(sylvan_var(node)), thenPosition, elsePosition};
+    }
+    nodes.push_back(serializedNode);
+    nodeToPosition.emplace(node, nodes.size() - 1);
+    return nodes.size() - 1;
+}
+
+InternalBdd<DdType::Sylvan> InternalBdd<DdType::Sylvan>::fromSerializedNodes(InternalDdManager<DdType::Sylvan> const* ddManager,
+                                                                             std::vector<SerializedDdNode> const& nodes) {
+    std::vector<sylvan::Bdd> bdds;
+    bdds.reserve(nodes.size());
+    for (auto const& node : nodes) {
+        if (node.index == SerializedDdNode::leafIndex) {
+            bdds.push_back(node.thenNode != 0 ? sylvan::Bdd::bddOne() : sylvan::Bdd::bddZero());
+        } else {
+            bdds.push_back(sylvan::Bdd::bddVar(node.index).Ite(bdds[node.thenNode], bdds[node.elseNode]));
+        }
+    }
+    return InternalBdd<DdType::Sylvan>(ddManager, bdds.back());
+}
+
 sylvan::Bdd& InternalBdd<DdType::Sylvan>::getSylvanBdd() {
     return sylvanBdd;
 }
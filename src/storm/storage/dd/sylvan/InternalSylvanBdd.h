@@ -9,6 +9,7 @@
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/storage/dd/DdSerialization.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalAdd.h"
 #include "storm/storage/dd/InternalBdd.h"
@@ -333,6 +334,22 @@ class InternalBdd<DdType::Sylvan> {
      */
     void exportToText(std::string const& filename) const;
 
+    /*!
+     * Retrieves the node table of the BDD in the library-independent binary format.
+     *
+     * @return The node table whose last node is the root of the BDD.
+     */
+    std::vector<SerializedDdNode> toSerializedNodes() const;
+
+    /*!
+     * Builds the BDD described by the given node table in the library-independent binary format.
+     *
+     * @param ddManager The manager responsible for the BDD.
+     * @param nodes The node table whose last node is the root of the BDD.
+     * @return The resulting BDD.
+     */
+    static InternalBdd<DdType::Sylvan> fromSerializedNodes(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<SerializedDdNode> const& nodes);
+
     /*!
      * Converts a BDD to an equivalent ADD.
      *
@@ -417,6 +434,16 @@ class InternalBdd<DdType::Sylvan> {
     sylvan::Bdd const& getSylvanBdd() const;
 
    private:
+    /*!
+     * Recursively appends the (not yet visited) nodes of the given DD to the node table.
+     *
+     * @param node The (possibly complemented) node to append.
+     * @param nodes The node table.
+     * @param nodeToPosition A mapping from the already appended nodes to their position in the node table.
+     * @return The position of the given node in the node table.
+     */
+    static uint64_t toSerializedNodesRec(BDD node, std::vector<SerializedDdNode>& nodes, std::unordered_map<BDD, uint64_t>& nodeToPosition);
+
     /*!
      * Builds a BDD representing the values that make the given filter function evaluate to true.
      *
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -13,6 +15,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/sylvan.h"
+#include "sylvan_cache.h"
 
 #include "storm-config.h"
 
@@ -35,6 +38,25 @@ VOID_TASK_0(gc_end) {
 }
 #endif
 
+// Statistics about the garbage collections. Like the sylvan package itself, these are 'global'.
+static uint_fast64_t numberOfGarbageCollections = 0;
+static std::chrono::nanoseconds garbageCollectionTime(0);
+static std::chrono::steady_clock::time_point garbageCollectionStart;
+static uint_fast64_t peakNumberOfNodes = 0;
+
+VOID_TASK_0(gc_statistics_start) {
+    // Before the garbage collection, the table contains the largest number of nodes since the last collection.
+    size_t filled = 0;
+    CALL(sylvan_table_usage, &filled, NULL);
+    peakNumberOfNodes = std::max<uint_fast64_t>(peakNumberOfNodes, filled);
+    garbageCollectionStart = std::chrono::steady_clock::now();
+}
+
+VOID_TASK_0(gc_statistics_end) {
+    ++numberOfGarbageCollections;
+    garbageCollectionTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - garbageCollectionStart);
+}
+
 VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*, e) {
     try {
         (*f)();
@@ -43,6 +65,22 @@ VOID_TASK_2(execute_sylvan, std::function<void()> const*, f, std::exception_ptr*
     }
 }
 
+VOID_TASK_4(execute_sylvan_parallel, std::vector<std::function<void()>> const*, functions, size_t, first, size_t, count, std::vector<std::exception_ptr>*,
+            exceptions) {
+    if (count == 1) {
+        try {
+            (*functions)[first]();
+        } catch (std::exception& exception) {
+            (*exceptions)[first] = std::current_exception();
+        }
+    } else {
+        // Split the range in two halves, one of which may be stolen by another worker.
+        SPAWN(execute_sylvan_parallel, functions, first, count / 2, exceptions);
+        CALL(execute_sylvan_parallel, functions, first + count / 2, count - count / 2, exceptions);
+        SYNC(execute_sylvan_parallel);
+    }
+}
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -83,6 +121,11 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
 #endif
+        numberOfGarbageCollections = 0;
+        garbageCollectionTime = std::chrono::nanoseconds(0);
+        peakNumberOfNodes = 0;
+        sylvan_gc_hook_pregc(TASK(gc_statistics_start));
+        sylvan_gc_hook_postgc(TASK(gc_statistics_end));
         // TODO: uncomment these to disable lace threads whenever they are not used. This requires that *all* DD code is run through execute
         // lace_suspend();
         // suspended = true;
@@ -245,6 +288,26 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
 
+DdManagerStatistics InternalDdManager<DdType::Sylvan>::getStatistics() const {
+    DdManagerStatistics statistics;
+    statistics.library = "Sylvan";
+    size_t filled = 0;
+    size_t total = 0;
+    sylvan_table_usage(&filled, &total);
+    peakNumberOfNodes = std::max<uint_fast64_t>(peakNumberOfNodes, filled);
+    statistics.peakNodes = peakNumberOfNodes;
+    statistics.liveNodes = filled;
+    statistics.uniqueTableSize = total;
+    statistics.operationCacheSize = cache_getsize();
+    if (cache_getsize() > 0) {
+        statistics.operationCacheUsage = static_cast<double>(cache_getused()) / static_cast<double>(cache_getsize());
+    }
+    // Sylvan only counts cache hits if it is compiled with SYLVAN_STATS, so the hit rate is left unset.
+    statistics.garbageCollections = numberOfGarbageCollections;
+    statistics.garbageCollectionTime = std::chrono::duration_cast<std::chrono::milliseconds>(garbageCollectionTime);
+    return statistics;
+}
+
 void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f) const {
     // Only wake up the sylvan (i.e. lace) threads when they are suspended.
     std::exception_ptr e = nullptr;  // propagate exception
@@ -263,6 +326,20 @@ void InternalDdManager<DdType::Sylvan>::execute(std::function<void()> const& f)
     }
 }
 
+void InternalDdManager<DdType::Sylvan>::executeInParallel(std::vector<std::function<void()>> const& functions) const {
+    if (functions.empty()) {
+        return;
+    }
+    std::vector<std::exception_ptr> exceptions(functions.size(), nullptr);
+    // If we are already running in a LACE task, this directly spawns the tasks on the current worker.
+    this->execute([&]() { RUN(execute_sylvan_parallel, &functions, 0, functions.size(), &exceptions); });
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
     return nextFreeVariableIndex;
 }
@@ -3,6 +3,7 @@
 
 #include <boost/optional.hpp>
 
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
 
@@ -132,6 +133,13 @@ class InternalDdManager<DdType::Sylvan> {
      */
     void debugCheck() const;
 
+    /*!
+     * Retrieves statistics of the DD library, e.g. node counts, cache usage and garbage collections. The operation statistics are not set.
+     *
+     * @return The statistics.
+     */
+    DdManagerStatistics getStatistics() const;
+
     /*!
      * All code that manipulates DDs shall be called through this function.
      * This is generally needed to set-up the correct context.
@@ -142,6 +150,15 @@ class InternalDdManager<DdType::Sylvan> {
      */
     void execute(std::function<void()> const& f) const;
 
+    /*!
+     * Executes the given functions as parallel LACE tasks and waits until all of them are done. If several functions
+     * throw an exception, the exception of the first of them is rethrown.
+     * The functions must not access shared data without synchronization. As for execute, they may manipulate DDs.
+     *
+     * @param functions the functions that are executed
+     */
+    void executeInParallel(std::vector<std::function<void()>> const& functions) const;
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
@@ -0,0 +1,377 @@
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * Translates an expression to the program of a BytecodeCompiledExpression. The value of each subexpression is written to the register given as data,
+ * operands of binary operations use the next register, so the number of registers is bounded by the depth of the expression.
+ */
+class BytecodeCompiler : public ExpressionVisitor {
+   public:
+    using OpCode = BytecodeCompiledExpression::OpCode;
+
+    BytecodeCompiler(BytecodeCompiledExpression& result) : result(result) {
+        result.program.clear();
+        result.numberOfRegisters = 1;
+    }
+
+    void compile(BaseExpression const& expression) {
+        compile(expression, 0);
+    }
+
+    virtual boost::any visit(IfThenElseExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getCondition(), target);
+        uint64_t jumpToElse = emit(OpCode::JumpIfFalse, target);
+        compile(*expression.getThenExpression(), target);
+        uint64_t jumpToEnd = emit(OpCode::Jump, target);
+        result.program[jumpToElse].argument = result.program.size();
+        compile(*expression.getElseExpression(), target);
+        result.program[jumpToEnd].argument = result.program.size();
+        return boost::any();
+    }
+
+    virtual boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getOperatorType()) {
+            case BinaryBooleanFunctionExpression::OperatorType::And:
+                compileShortCircuit(expression, target, OpCode::JumpIfFalse, false);
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Or:
+                compileShortCircuit(expression, target, OpCode::JumpIfTrue, false);
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Implies:
+                compileShortCircuit(expression, target, OpCode::JumpIfTrue, true);
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Xor:
+                compileBinary(expression, target, OpCode::Xor);
+                break;
+            case BinaryBooleanFunctionExpression::OperatorType::Iff:
+                compileBinary(expression, target, OpCode::Equal);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getOperatorType()) {
+            case BinaryNumericalFunctionExpression::OperatorType::Plus:
+                compileBinary(expression, target, OpCode::Plus);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Minus:
+                compileBinary(expression, target, OpCode::Minus);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Times:
+                compileBinary(expression, target, OpCode::Times);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Divide:
+                compileBinary(expression, target, OpCode::Divide);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Min:
+                compileBinary(expression, target, OpCode::Min);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Max:
+                compileBinary(expression, target, OpCode::Max);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Power:
+                compileBinary(expression, target, OpCode::Power);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+                compileBinary(expression, target, OpCode::Modulo);
+                break;
+            case BinaryNumericalFunctionExpression::OperatorType::Logarithm:
+                if (expression.getSecondOperand()->isLiteral()) {
+                    double base = expression.getSecondOperand()->evaluateAsDouble();
+                    if (base == 2.0 || base == 10.0) {
+                        compile(*expression.getFirstOperand(), target);
+                        emit(base == 2.0 ? OpCode::Log2 : OpCode::Log10, target);
+                        break;
+                    }
+                }
+                compileBinary(expression, target, OpCode::Logarithm);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(BinaryRelationExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        switch (expression.getRelationType()) {
+            case RelationType::Equal:
+                compileBinary(expression, target, OpCode::Equal);
+                break;
+            case RelationType::NotEqual:
+                compileBinary(expression, target, OpCode::NotEqual);
+                break;
+            case RelationType::Less:
+                compileBinary(expression, target, OpCode::Less);
+                break;
+            case RelationType::LessOrEqual:
+                compileBinary(expression, target, OpCode::LessOrEqual);
+                break;
+            case RelationType::Greater:
+                compileBinary(expression, target, OpCode::Greater);
+                break;
+            case RelationType::GreaterOrEqual:
+                compileBinary(expression, target, OpCode::GreaterOrEqual);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(VariableExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        storm::expressions::Variable const& variable = expression.getVariable();
+        if (variable.hasBooleanType()) {
+            emit(OpCode::LoadBoolean, target, 0, variable.getOffset());
+        } else if (variable.hasIntegerType()) {
+            emit(OpCode::LoadInteger, target, 0, variable.getOffset());
+        } else {
+            STORM_LOG_THROW(variable.hasRationalType(), storm::exceptions::NotSupportedException,
+                            "Cannot compile variable '" << variable.getName() << "' of type " << variable.getType() << ".");
+            emit(OpCode::LoadRational, target, 0, variable.getOffset());
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getOperand(), target);
+        emit(OpCode::Not, target);
+        return boost::any();
+    }
+
+    virtual boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        uint32_t target = boost::any_cast<uint32_t>(data);
+        compile(*expression.getOperand(), target);
+        switch (expression.getOperatorType()) {
+            case UnaryNumericalFunctionExpression::OperatorType::Minus:
+                emit(OpCode::Negate, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Floor:
+                emit(OpCode::Floor, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                emit(OpCode::Ceil, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Cos:
+                emit(OpCode::Cos, target);
+                break;
+            case UnaryNumericalFunctionExpression::OperatorType::Sin:
+                emit(OpCode::Sin, target);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), expression.getValue() ? 1.0 : 0.0);
+        return boost::any();
+    }
+
+    virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), static_cast<double>(expression.getValue()));
+        return boost::any();
+    }
+
+    virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override {
+        emitConstant(boost::any_cast<uint32_t>(data), expression.getValueAsDouble());
+        return boost::any();
+    }
+
+   private:
+    void compile(BaseExpression const& expression, uint32_t target) {
+        result.numberOfRegisters = std::max(result.numberOfRegisters, target + 1);
+        expression.accept(*this, target);
+    }
+
+    uint64_t emit(OpCode opCode, uint32_t target, uint32_t operand = 0, uint64_t argument = 0) {
+        result.program.push_back({opCode, target, operand, argument});
+        return result.program.size() - 1;
+    }
+
+    void emitConstant(uint32_t target, double value) {
+        emit(OpCode::Constant, target, 0, std::bit_cast<uint64_t>(value));
+    }
+
+    void compileBinary(BinaryExpression const& expression, uint32_t target, OpCode opCode) {
+        compile(*expression.getFirstOperand(), target);
+        compile(*expression.getSecondOperand(), target + 1);
+        emit(opCode, target, target + 1);
+    }
+
+    /*!
+     * Compiles a boolean operation that skips the second operand if the (possibly negated) first operand already determines the result.
+     */
+    void compileShortCircuit(BinaryExpression const& expression, uint32_t target, OpCode jump, bool negateFirstOperand) {
+        compile(*expression.getFirstOperand(), target);
+        if (negateFirstOperand) {
+            emit(OpCode::Not, target);
+        }
+        uint64_t jumpToEnd = emit(jump, target);
+        compile(*expression.getSecondOperand(), target);
+        result.program[jumpToEnd].argument = result.program.size();
+        emit(OpCode::ToBool, target);
+    }
+
+    BytecodeCompiledExpression& result;
+};
+
+namespace {
+// The comparisons of exprtk tolerate a relative deviation.
+inline bool approximatelyEqual(double first, double second) {
+    return std::abs(first - second) <= std::max(1.0, std::max(std::abs(first), std::abs(second))) * 1e-10;
+}
+
+inline double fromBool(bool value) {
+    return value ? 1.0 : 0.0;
+}
+}  // namespace
+
+BytecodeCompiledExpression::BytecodeCompiledExpression(Expression const& expression) {
+    BytecodeCompiler(*this).compile(expression.getBaseExpression());
+}
+
+double BytecodeCompiledExpression::evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues,
+                                            std::vector<double>& registers) const {
+    if (registers.size() < numberOfRegisters) {
+        registers.resize(numberOfRegisters);
+    }
+    double* reg = registers.data();
+    Instruction const* instructions = program.data();
+    uint64_t const numberOfInstructions = program.size();
+    for (uint64_t index = 0; index < numberOfInstructions; ++index) {
+        Instruction const& instruction = instructions[index];
+        double& value = reg[instruction.target];
+        double const operand = reg[instruction.operand];
+        switch (instruction.opCode) {
+            case OpCode::Constant:
+                value = std::bit_cast<double>(instruction.argument);
+                break;
+            case OpCode::LoadBoolean:
+                value = booleanValues[instruction.argument];
+                break;
+            case OpCode::LoadInteger:
+                value = integerValues[instruction.argument];
+                break;
+            case OpCode::LoadRational:
+                value = rationalValues[instruction.argument];
+                break;
+            case OpCode::Jump:
+                // The loop increments the index afterwards.
+                index = instruction.argument - 1;
+                break;
+            case OpCode::JumpIfFalse:
+                if (value == 0.0) {
+                    index = instruction.argument - 1;
+                }
+                break;
+            case OpCode::JumpIfTrue:
+                if (value != 0.0) {
+                    index = instruction.argument - 1;
+                }
+                break;
+            case OpCode::ToBool:
+                value = fromBool(value != 0.0);
+                break;
+            case OpCode::Not:
+                value = fromBool(value == 0.0);
+                break;
+            case OpCode::Xor:
+                value = fromBool((value == 0.0) != (operand == 0.0));
+                break;
+            case OpCode::Equal:
+                value = fromBool(approximatelyEqual(value, operand));
+                break;
+            case OpCode::NotEqual:
+                value = fromBool(!approximatelyEqual(value, operand));
+                break;
+            case OpCode::Less:
+                value = fromBool(value < operand);
+                break;
+            case OpCode::LessOrEqual:
+                value = fromBool(value <= operand);
+                break;
+            case OpCode::Greater:
+                value = fromBool(value > operand);
+                break;
+            case OpCode::GreaterOrEqual:
+                value = fromBool(value >= operand);
+                break;
+            case OpCode::Negate:
+                value = -value;
+                break;
+            case OpCode::Plus:
+                value += operand;
+                break;
+            case OpCode::Minus:
+                value -= operand;
+                break;
+            case OpCode::Times:
+                value *= operand;
+                break;
+            case OpCode::Divide:
+                value /= operand;
+                break;
+            case OpCode::Min:
+                value = std::min(value, operand);
+                break;
+            case OpCode::Max:
+                value = std::max(value, operand);
+                break;
+            case OpCode::Power:
+                value = std::pow(value, operand);
+                break;
+            case OpCode::Modulo:
+                value = std::fmod(value, operand);
+                break;
+            case OpCode::Log2:
+                value = std::log2(value);
+                break;
+            case OpCode::Log10:
+                value = std::log10(value);
+                break;
+            case OpCode::Logarithm:
+                value = std::log(value) / std::log(operand);
+                break;
+            case OpCode::Floor:
+                value = std::floor(value);
+                break;
+            case OpCode::Ceil:
+                value = std::ceil(value);
+                break;
+            case OpCode::Cos:
+                value = std::cos(value);
+                break;
+            case OpCode::Sin:
+                value = std::sin(value);
+                break;
+        }
+    }
+    return reg[0];
+}
+
+uint64_t BytecodeCompiledExpression::getNumberOfInstructions() const {
+    return program.size();
+}
+
+bool BytecodeCompiledExpression::isBytecodeCompiledExpression() const {
+    return true;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/expressions/CompiledExpression.h"
+
+namespace storm {
+namespace expressions {
+
+class BaseExpression;
+class Expression;
+
+/*!
+ * An expression that is compiled to a linear program for a small register machine. All values are represented as doubles and the operations mirror
+ * the semantics of the expressions compiled by exprtk, so both backends yield the same results. Variables are read directly from the value arrays
+ * of the evaluator (indexed by the offset of the variable), so no symbol table is involved.
+ */
+class BytecodeCompiledExpression : public CompiledExpression {
+   public:
+    /*!
+     * Compiles the given expression.
+     */
+    BytecodeCompiledExpression(Expression const& expression);
+
+    /*!
+     * Evaluates the expression.
+     *
+     * @param booleanValues The values of the boolean variables, indexed by their offset.
+     * @param integerValues The values of the integer variables, indexed by their offset.
+     * @param rationalValues The values of the rational variables, indexed by their offset.
+     * @param registers Scratch space for the evaluation. It is resized if needed.
+     */
+    double evaluate(double const* booleanValues, double const* integerValues, double const* rationalValues, std::vector<double>& registers) const;
+
+    /*!
+     * Retrieves the number of instructions of the compiled program.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+    virtual bool isBytecodeCompiledExpression() const override;
+
+    enum class OpCode : uint8_t {
+        Constant,
+        LoadBoolean,
+        LoadInteger,
+        LoadRational,
+        Jump,
+        JumpIfFalse,
+        JumpIfTrue,
+        ToBool,
+        Not,
+        Xor,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Negate,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Min,
+        Max,
+        Power,
+        Modulo,
+        Log2,
+        Log10,
+        Logarithm,
+        Floor,
+        Ceil,
+        Cos,
+        Sin
+    };
+
+    struct Instruction {
+        OpCode opCode;
+        /// The register that is written (or tested for jumps).
+        uint32_t target;
+        /// The register holding the second operand. The first operand of binary operations is always the target register.
+        uint32_t operand;
+        /// The offset of a variable, the target of a jump or the bit pattern of a constant.
+        uint64_t argument;
+    };
+
+   private:
+    friend class BytecodeCompiler;
+
+    /// The instructions of the program. The result is found in register 0 after the last instruction.
+    std::vector<Instruction> program;
+
+    /// The number of registers used by the program.
+    uint32_t numberOfRegisters;
+};
+
+}  // namespace expressions
+}  // namespace storm
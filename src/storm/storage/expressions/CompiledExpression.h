@@ -4,6 +4,7 @@ namespace storm {
 namespace expressions {
 
 class ExprtkCompiledExpression;
+class BytecodeCompiledExpression;
 
 class CompiledExpression {
    public:
@@ -13,6 +14,10 @@ class CompiledExpression {
     ExprtkCompiledExpression& asExprtkCompiledExpression();
     ExprtkCompiledExpression const& asExprtkCompiledExpression() const;
 
+    virtual bool isBytecodeCompiledExpression() const;
+    BytecodeCompiledExpression& asBytecodeCompiledExpression();
+    BytecodeCompiledExpression const& asBytecodeCompiledExpression() const;
+
    private:
     // Currently empty.
 };
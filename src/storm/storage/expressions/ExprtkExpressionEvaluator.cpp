@@ -19,7 +19,8 @@ ExprtkExpressionEvaluatorBase<RationalType>::ExprtkExpressionEvaluatorBase(storm
       symbolTable(std::make_unique<exprtk::symbol_table<ValueType>>()),
       booleanValues(manager.getNumberOfBooleanVariables()),
       integerValues(manager.getNumberOfIntegerVariables()),
-      rationalValues(manager.getNumberOfRationalVariables()) {
+      rationalValues(manager.getNumberOfRationalVariables()),
+      useBytecode(false) {
     // Since some expressions are very long, we need to increase the stack depth of the exprtk parser.
     // Otherwise, we'll get
     //   ERR000 - Current stack depth X exceeds maximum allowed stack depth of Y
@@ -38,14 +39,12 @@ ExprtkExpressionEvaluatorBase<RationalType>::ExprtkExpressionEvaluatorBase(storm
 
 template<typename RationalType>
 bool ExprtkExpressionEvaluatorBase<RationalType>::asBool(Expression const& expression) const {
-    auto const& compiledExpression = getCompiledExpression(expression);
-    return compiledExpression.value() == ValueType(1);
+    return evaluate(expression) == ValueType(1);
 }
 
 template<typename RationalType>
 int_fast64_t ExprtkExpressionEvaluatorBase<RationalType>::asInt(Expression const& expression) const {
-    auto const& compiledExpression = getCompiledExpression(expression);
-    return static_cast<int_fast64_t>(compiledExpression.value());
+    return static_cast<int_fast64_t>(evaluate(expression));
 }
 
 template<typename RationalType>
@@ -62,6 +61,30 @@ typename ExprtkExpressionEvaluatorBase<RationalType>::CompiledExpressionType con
     return expression.getCompiledExpression().asExprtkCompiledExpression().getCompiledExpression();
 }
 
+template<typename RationalType>
+typename ExprtkExpressionEvaluatorBase<RationalType>::ValueType ExprtkExpressionEvaluatorBase<RationalType>::evaluate(
+    storm::expressions::Expression const& expression) const {
+    if (useBytecode) {
+        // An expression only holds one compiled version, so switching the backend recompiles it.
+        if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isBytecodeCompiledExpression()) {
+            expression.setCompiledExpression(std::make_shared<BytecodeCompiledExpression>(expression));
+        }
+        return expression.getCompiledExpression().asBytecodeCompiledExpression().evaluate(booleanValues.data(), integerValues.data(),
+                                                                                           rationalValues.data(), registers);
+    }
+    return getCompiledExpression(expression).value();
+}
+
+template<typename RationalType>
+void ExprtkExpressionEvaluatorBase<RationalType>::setUseBytecode(bool newValue) {
+    useBytecode = newValue;
+}
+
+template<typename RationalType>
+bool ExprtkExpressionEvaluatorBase<RationalType>::isUseBytecodeSet() const {
+    return useBytecode;
+}
+
 template<typename RationalType>
 void ExprtkExpressionEvaluatorBase<RationalType>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
     this->booleanValues[variable.getOffset()] = static_cast<ValueType>(value);
@@ -82,8 +105,7 @@ ExprtkExpressionEvaluator::ExprtkExpressionEvaluator(storm::expressions::Express
 }
 
 double ExprtkExpressionEvaluator::asRational(Expression const& expression) const {
-    auto const& compiledExpression = getCompiledExpression(expression);
-    return static_cast<double>(compiledExpression.value());
+    return static_cast<double>(evaluate(expression));
 }
 
 template class ExprtkExpressionEvaluatorBase<double>;
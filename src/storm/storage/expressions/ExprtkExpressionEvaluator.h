@@ -8,6 +8,7 @@
 
 #include "storm/storage/expressions/ToExprtkStringVisitor.h"
 
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
 #include "storm/storage/expressions/ExprtkCompiledExpression.h"
 
 namespace storm {
@@ -25,10 +26,22 @@ class ExprtkExpressionEvaluatorBase : public ExpressionEvaluatorBase<RationalTyp
     void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
     void setRationalValue(storm::expressions::Variable const& variable, double value) override;
 
+    /*!
+     * Sets whether expressions are compiled to bytecode that is interpreted by a small register machine instead of being compiled by exprtk.
+     * Both backends yield the same results, but the bytecode avoids the overhead of exprtk's expression trees.
+     */
+    void setUseBytecode(bool newValue = true);
+    bool isUseBytecodeSet() const;
+
    protected:
     typedef double ValueType;
     typedef ExprtkCompiledExpression::CompiledExpressionType CompiledExpressionType;
 
+    /*!
+     * Evaluates the given expression with the selected backend.
+     */
+    ValueType evaluate(storm::expressions::Expression const& expression) const;
+
     /*!
      * Retrieves a compiled version of the given expression.
      *
@@ -46,6 +59,12 @@ class ExprtkExpressionEvaluatorBase : public ExpressionEvaluatorBase<RationalTyp
     std::vector<ValueType> booleanValues;
     std::vector<ValueType> integerValues;
     std::vector<ValueType> rationalValues;
+
+    // Whether expressions are evaluated via bytecode rather than exprtk.
+    bool useBytecode;
+
+    // The registers used when evaluating bytecode.
+    mutable std::vector<ValueType> registers;
 };
 
 class ExprtkExpressionEvaluator : public ExprtkExpressionEvaluatorBase<double> {
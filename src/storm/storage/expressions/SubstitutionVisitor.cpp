@@ -14,17 +14,33 @@ SubstitutionVisitor<MapType>::SubstitutionVisitor(MapType const& variableToExpre
 
 template<typename MapType>
 Expression SubstitutionVisitor<MapType>::substitute(Expression const& expression) {
-    return Expression(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
+    substitutedSharedOperands.clear();
+    Expression result(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getBaseExpression().accept(*this, boost::none)));
+    substitutedSharedOperands.clear();
+    return result;
+}
+
+template<typename MapType>
+std::shared_ptr<BaseExpression const> SubstitutionVisitor<MapType>::substituteOperand(std::shared_ptr<BaseExpression const> const& operand,
+                                                                                      boost::any const& data) {
+    // An operand that is only referenced by its parent can not be reached a second time, so its result does not need to be remembered.
+    if (operand.use_count() <= 1) {
+        return boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    }
+    auto it = substitutedSharedOperands.find(operand.get());
+    if (it != substitutedSharedOperands.end()) {
+        return it->second.second;
+    }
+    std::shared_ptr<BaseExpression const> result = boost::any_cast<std::shared_ptr<BaseExpression const>>(operand->accept(*this, data));
+    substitutedSharedOperands.emplace(operand.get(), std::make_pair(operand, result));
+    return result;
 }
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> conditionExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getCondition()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> thenExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getThenExpression()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> elseExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getElseExpression()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> conditionExpression = substituteOperand(expression.getCondition(), data);
+    std::shared_ptr<BaseExpression const> thenExpression = substituteOperand(expression.getThenExpression(), data);
+    std::shared_ptr<BaseExpression const> elseExpression = substituteOperand(expression.getElseExpression(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (conditionExpression.get() == expression.getCondition().get() && thenExpression.get() == expression.getThenExpression().get() &&
@@ -38,10 +54,8 @@ boost::any SubstitutionVisitor<MapType>::visit(IfThenElseExpression const& expre
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -54,10 +68,8 @@ boost::any SubstitutionVisitor<MapType>::visit(BinaryBooleanFunctionExpression c
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -70,10 +82,8 @@ boost::any SubstitutionVisitor<MapType>::visit(BinaryNumericalFunctionExpression
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(BinaryRelationExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> firstExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getFirstOperand()->accept(*this, data));
-    std::shared_ptr<BaseExpression const> secondExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getSecondOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> firstExpression = substituteOperand(expression.getFirstOperand(), data);
+    std::shared_ptr<BaseExpression const> secondExpression = substituteOperand(expression.getSecondOperand(), data);
 
     // If the arguments did not change, we simply push the expression itself.
     if (firstExpression.get() == expression.getFirstOperand().get() && secondExpression.get() == expression.getSecondOperand().get()) {
@@ -97,8 +107,7 @@ boost::any SubstitutionVisitor<MapType>::visit(VariableExpression const& express
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
@@ -111,8 +120,7 @@ boost::any SubstitutionVisitor<MapType>::visit(UnaryBooleanFunctionExpression co
 
 template<typename MapType>
 boost::any SubstitutionVisitor<MapType>::visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    std::shared_ptr<BaseExpression const> operandExpression =
-        boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand()->accept(*this, data));
+    std::shared_ptr<BaseExpression const> operandExpression = substituteOperand(expression.getOperand(), data);
 
     // If the argument did not change, we simply push the expression itself.
     if (operandExpression.get() == expression.getOperand().get()) {
@@ -128,7 +136,7 @@ boost::any SubstitutionVisitor<MapType>::visit(PredicateExpression const& expres
     bool changed = false;
     std::vector<std::shared_ptr<BaseExpression const>> newExpressions;
     for (uint64_t i = 0; i < expression.getArity(); ++i) {
-        newExpressions.push_back(boost::any_cast<std::shared_ptr<BaseExpression const>>(expression.getOperand(i)->accept(*this, data)));
+        newExpressions.push_back(substituteOperand(expression.getOperand(i), data));
         if (!changed && newExpressions.back() != expression.getOperand(i)) {
             changed = true;
         }
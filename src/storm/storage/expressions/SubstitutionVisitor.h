@@ -2,6 +2,7 @@
 #define STORM_STORAGE_EXPRESSIONS_SUBSTITUTIONVISITOR_H_
 
 #include <stack>
+#include <unordered_map>
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionVisitor.h"
@@ -41,8 +42,19 @@ class SubstitutionVisitor : public ExpressionVisitor {
     virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
 
    protected:
+    /*!
+     * Substitutes the identifiers in the given operand of an expression. Operands that are shared by several expressions are only substituted
+     * once per call to substitute, which also preserves the sharing in the resulting expression.
+     */
+    std::shared_ptr<BaseExpression const> substituteOperand(std::shared_ptr<BaseExpression const> const& operand, boost::any const& data);
+
     // A mapping of variables to expressions with which they shall be replaced.
     MapType const& variableToExpressionMapping;
+
+    // The shared operands that were substituted during the current call to substitute together with their results. Keeping the operands alive
+    // makes sure that their addresses are not reused while substituting.
+    std::unordered_map<BaseExpression const*, std::pair<std::shared_ptr<BaseExpression const>, std::shared_ptr<BaseExpression const>>>
+        substitutedSharedOperands;
 };
 }  // namespace expressions
 }  // namespace storm
@@ -68,13 +68,14 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::create(boost::op
 }
 
 template<typename ValueType>
-NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b) {
+NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other)
+    : emptyStatus(other.emptyStatus), A(other.A), b(other.b), vertices(other.vertices) {
     // Intentionally left empty
 }
 
 template<typename ValueType>
 NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other)
-    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)) {
+    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)), vertices(std::move(other.vertices)) {
     // Intentionally left empty
 }
 
@@ -97,7 +98,7 @@ NativePolytope<ValueType>::~NativePolytope() {
 
 template<typename ValueType>
 std::vector<typename Polytope<ValueType>::Point> NativePolytope<ValueType>::getVertices() const {
-    std::vector<EigenVector> eigenVertices = getEigenVertices();
+    std::vector<EigenVector> const& eigenVertices = getEigenVertices();
     std::vector<Point> result;
     result.reserve(eigenVertices.size());
     for (auto const& p : eigenVertices) {
@@ -223,7 +224,27 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::intersection(Hal
     resultA << A, storm::adapters::EigenAdapter::toEigenVector(halfspace.normalVector()).transpose();
     EigenVector resultb(resultA.rows());
     resultb << b, halfspace.offset();
-    return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
+    auto result = std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Unknown, std::move(resultA), std::move(resultb));
+
+    if (vertices) {
+        // Update the vertices incrementally: A vertex of the intersection is either a vertex of this polytope that satisfies the new constraint or it lies on
+        // the new hyperplane. Only the latter ones need to be enumerated, which means that only subsets of hyperplanes containing the new one are considered.
+        Eigen::Index const newRow = result->A.rows() - 1;
+        storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
+        he.generateVerticesOnHyperplane(result->A, result->b, newRow);
+        std::vector<EigenVector> resultVertices = std::move(he.getResultVertices());
+        for (auto const& vertex : *vertices) {
+            // Vertices on the new hyperplane have already been found.
+            if ((result->A.row(newRow) * vertex)(0) < result->b(newRow)) {
+                resultVertices.push_back(vertex);
+            }
+        }
+        if (!resultVertices.empty()) {
+            result->emptyStatus = EmptyStatus::Nonempty;
+        }
+        result->vertices = std::move(resultVertices);
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -240,9 +261,9 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::convexUnion(std:
 
     STORM_LOG_WARN_COND_DEBUG(false, "Implementation of convex union of two polytopes only works if the polytopes are bounded. This is not checked.");
 
-    std::vector<EigenVector> rhsVertices = dynamic_cast<NativePolytope<ValueType> const&>(*rhs).getEigenVertices();
+    std::vector<EigenVector> const& rhsVertices = dynamic_cast<NativePolytope<ValueType> const&>(*rhs).getEigenVertices();
     std::vector<EigenVector> resultVertices = this->getEigenVertices();
-    resultVertices.insert(resultVertices.end(), std::make_move_iterator(rhsVertices.begin()), std::make_move_iterator(rhsVertices.end()));
+    resultVertices.insert(resultVertices.end(), rhsVertices.begin(), rhsVertices.end());
 
     storm::storage::geometry::QuickHull<ValueType> qh;
     qh.generateHalfspacesFromPoints(resultVertices, false);
@@ -312,7 +333,17 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::affineTransforma
     }
     EigenMatrix newA = A * luMatrix.inverse();
     EigenVector newb = b + (newA * eigenVector);
-    return std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    auto result = std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    if (vertices) {
+        // As the transformation is invertible, it maps the vertices of this polytope to the vertices of the result.
+        std::vector<EigenVector> resultVertices;
+        resultVertices.reserve(vertices->size());
+        for (auto const& vertex : *vertices) {
+            resultVertices.push_back(eigenMatrix * vertex + eigenVector);
+        }
+        result->vertices = std::move(resultVertices);
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -381,10 +412,13 @@ bool NativePolytope<ValueType>::isNativePolytope() const {
     return true;
 }
 template<typename ValueType>
-std::vector<typename NativePolytope<ValueType>::EigenVector> NativePolytope<ValueType>::getEigenVertices() const {
-    storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
-    he.generateVerticesFromConstraints(A, b, false);
-    return he.getResultVertices();
+std::vector<typename NativePolytope<ValueType>::EigenVector> const& NativePolytope<ValueType>::getEigenVertices() const {
+    if (!vertices) {
+        storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
+        he.generateVerticesFromConstraints(A, b, false);
+        vertices = std::move(he.getResultVertices());
+    }
+    return *vertices;
 }
 
 template<typename ValueType>
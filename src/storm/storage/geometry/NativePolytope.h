@@ -2,6 +2,7 @@
 #define STORM_STORAGE_GEOMETRY_NATIVEPOLYTOPE_H_
 
 #include <memory>
+#include <optional>
 #include "storm/adapters/EigenAdapter.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/geometry/Polytope.h"
@@ -140,8 +141,8 @@ class NativePolytope : public Polytope<ValueType> {
     virtual std::shared_ptr<Polytope<ValueType>> clean() override;
 
    private:
-    // returns the vertices of this polytope as EigenVectors
-    std::vector<EigenVector> getEigenVertices() const;
+    // returns the vertices of this polytope as EigenVectors. The vertices are computed on the first call and cached afterwards.
+    std::vector<EigenVector> const& getEigenVertices() const;
 
     // As optimize(..) but with EigenVectors
     std::pair<EigenVector, bool> optimize(EigenVector const& direction) const;
@@ -152,6 +153,9 @@ class NativePolytope : public Polytope<ValueType> {
     // Intern representation of the polytope as { x | Ax<=b }
     EigenMatrix A;
     EigenVector b;
+
+    // The vertices of the polytope (if already known). Like the empty status, this is a cache that is not protected against concurrent accesses.
+    mutable std::optional<std::vector<EigenVector>> vertices;
 };
 
 }  // namespace geometry
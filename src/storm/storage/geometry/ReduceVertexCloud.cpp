@@ -1,6 +1,13 @@
 #include "storm/storage/geometry/ReduceVertexCloud.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/threads.h"
 #undef _DEBUG_REDUCE_VERTEX_CLOUD
 
 namespace storm {
@@ -25,105 +32,154 @@ std::string toString(std::map<uint64_t, ValueType> const& point) {
 template<typename ValueType>
 std::pair<storm::storage::BitVector, bool> ReduceVertexCloud<ValueType>::eliminate(std::vector<std::map<uint64_t, ValueType>> const& input,
                                                                                    uint64_t maxdimension) {
-    std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
     std::vector<storm::storage::BitVector> supports;
-    std::vector<storm::expressions::Variable> weightVariables;
-    std::vector<storm::expressions::Expression> weightVariableExpressions;
-
-    for (uint64_t pointIndex = 0; pointIndex < input.size(); ++pointIndex) {
+    supports.reserve(input.size());
+    for (auto const& point : input) {
         // Compute the support vectors to quickly determine which input points could be relevant.
-        supports.push_back(storm::storage::BitVector(maxdimension));
-        for (auto const& entry : input[pointIndex]) {
+        supports.emplace_back(maxdimension);
+        for (auto const& entry : point) {
             supports.back().set(entry.first, true);
         }
-        // Add a weight variable for each input point
-        weightVariables.push_back(expressionManager->declareRationalVariable("w_" + std::to_string(pointIndex)));
-        // For convenience and performance, obtain the expression.
-        weightVariableExpressions.push_back(weightVariables.back().getExpression());
     }
 
-    std::unique_ptr<storm::solver::SmtSolver> smtSolver = smtSolverFactory->create(*expressionManager);
-    for (auto const& weightVariableExpr : weightVariableExpressions) {
-        // smtSolver->add((weightVariableExpr == expressionManager->rational(0.0)) || (weightVariableExpr > expressionManager->rational(0.00001)));
-        smtSolver->add((weightVariableExpr >= expressionManager->rational(0.0)));
-        smtSolver->add(weightVariableExpr < expressionManager->rational(1.0));
+    // The points are split into contiguous chunks that are checked concurrently. Each chunk has its own expression manager and solver.
+    uint64_t numberOfChunks = 1;
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+        numberOfChunks = std::max<uint64_t>(1, std::min<uint64_t>(storm::utility::getNumberOfThreads(), input.size()));
     }
-    if (storm::utility::isZero(wiggle)) {
-        smtSolver->add(storm::expressions::sum(weightVariableExpressions) <= expressionManager->rational(1));
-    } else {
-        smtSolver->add(storm::expressions::sum(weightVariableExpressions) <= expressionManager->rational(1 + wiggle));
-        smtSolver->add(storm::expressions::sum(weightVariableExpressions) >= expressionManager->rational(1 - wiggle));
+#endif
+    struct Chunk {
+        uint64_t begin;
+        uint64_t end;
+        std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
+        std::vector<storm::expressions::Variable> weightVariables;
+        std::vector<storm::expressions::Expression> weightVariableExpressions;
+        std::unique_ptr<storm::solver::SmtSolver> smtSolver;
+    };
+    // The solvers are created sequentially as the factory is shared.
+    std::vector<Chunk> chunks(numberOfChunks);
+    for (uint64_t chunkIndex = 0; chunkIndex < numberOfChunks; ++chunkIndex) {
+        Chunk& chunk = chunks[chunkIndex];
+        chunk.begin = input.size() * chunkIndex / numberOfChunks;
+        chunk.end = input.size() * (chunkIndex + 1) / numberOfChunks;
+        chunk.expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+        for (uint64_t pointIndex = 0; pointIndex < input.size(); ++pointIndex) {
+            // Add a weight variable for each input point
+            chunk.weightVariables.push_back(chunk.expressionManager->declareRationalVariable("w_" + std::to_string(pointIndex)));
+            // For convenience and performance, obtain the expression.
+            chunk.weightVariableExpressions.push_back(chunk.weightVariables.back().getExpression());
+        }
+        chunk.smtSolver = smtSolverFactory->create(*chunk.expressionManager);
+        for (auto const& weightVariableExpr : chunk.weightVariableExpressions) {
+            // smtSolver->add((weightVariableExpr == expressionManager->rational(0.0)) || (weightVariableExpr > expressionManager->rational(0.00001)));
+            chunk.smtSolver->add((weightVariableExpr >= chunk.expressionManager->rational(0.0)));
+            chunk.smtSolver->add(weightVariableExpr < chunk.expressionManager->rational(1.0));
+        }
+        if (storm::utility::isZero(wiggle)) {
+            chunk.smtSolver->add(storm::expressions::sum(chunk.weightVariableExpressions) <= chunk.expressionManager->rational(1));
+        } else {
+            chunk.smtSolver->add(storm::expressions::sum(chunk.weightVariableExpressions) <= chunk.expressionManager->rational(1 + wiggle));
+            chunk.smtSolver->add(storm::expressions::sum(chunk.weightVariableExpressions) >= chunk.expressionManager->rational(1 - wiggle));
+        }
     }
 
-    storm::utility::Stopwatch solverTime;
     storm::utility::Stopwatch totalTime(true);
-    storm::storage::BitVector vertices(input.size());
-    for (uint64_t pointIndex = 0; pointIndex < input.size(); ++pointIndex) {
+    std::atomic<bool> timedOut(false);
+    // One flag per point. We use char instead of bool to avoid concurrent writes to the same byte (or word of a BitVector).
+    std::vector<char> vertices(input.size(), false);
+    auto checkChunk = [&](Chunk& chunk) {
+        storm::expressions::ExpressionManager& expressionManager = *chunk.expressionManager;
+        std::vector<storm::expressions::Expression> const& weightVariableExpressions = chunk.weightVariableExpressions;
+        for (uint64_t pointIndex = chunk.begin; pointIndex < chunk.end; ++pointIndex) {
+            if (timedOut.load(std::memory_order_relaxed)) {
+                std::fill(vertices.begin() + pointIndex, vertices.begin() + chunk.end, true);
+                return;
+            }
 #ifdef _DEBUG_REUCE_VERTEX_CLOUD
-        std::cout << pointIndex << " out of " << input.size() << '\n';
+            std::cout << pointIndex << " out of " << input.size() << '\n';
 #endif
-        smtSolver->push();
-        std::map<uint64_t, std::vector<storm::expressions::Expression>> dimensionTerms;
-        for (auto const& entry : input[pointIndex]) {
-            dimensionTerms[entry.first] = {expressionManager->rational(-entry.second)};
-        }
-        for (uint64_t potentialSupport = 0; potentialSupport < input.size(); ++potentialSupport) {
-            if (pointIndex == potentialSupport) {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
-            } else if (potentialSupport < pointIndex && !vertices.get(potentialSupport)) {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
-            } else if (supports[potentialSupport].isSubsetOf(supports[pointIndex])) {
-                for (auto const& entry : input[potentialSupport]) {
-                    dimensionTerms[entry.first].push_back(weightVariableExpressions[potentialSupport] * expressionManager->rational(entry.second));
+            chunk.smtSolver->push();
+            std::map<uint64_t, std::vector<storm::expressions::Expression>> dimensionTerms;
+            for (auto const& entry : input[pointIndex]) {
+                dimensionTerms[entry.first] = {expressionManager.rational(-entry.second)};
+            }
+            for (uint64_t potentialSupport = 0; potentialSupport < input.size(); ++potentialSupport) {
+                if (pointIndex == potentialSupport) {
+                    chunk.smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager.rational(0.0));
+                } else if (potentialSupport < pointIndex && potentialSupport >= chunk.begin && !vertices[potentialSupport]) {
+                    // Points that are no vertices are not needed as support. We only know this for the previous points of the same chunk.
+                    chunk.smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager.rational(0.0));
+                } else if (supports[potentialSupport].isSubsetOf(supports[pointIndex])) {
+                    if (potentialSupport < pointIndex && input[potentialSupport] == input[pointIndex]) {
+                        // Only the last copy of a point can be used as support. This way, the result does not depend on how the points are chunked.
+                        chunk.smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager.rational(0.0));
+                    } else {
+                        for (auto const& entry : input[potentialSupport]) {
+                            dimensionTerms[entry.first].push_back(weightVariableExpressions[potentialSupport] * expressionManager.rational(entry.second));
+                        }
+                    }
+                } else {
+                    chunk.smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager.rational(0.0));
                 }
-            } else {
-                smtSolver->add(weightVariableExpressions[potentialSupport] == expressionManager->rational(0.0));
             }
-        }
-        for (auto const& entry : dimensionTerms) {
-            smtSolver->add(storm::expressions::sum(entry.second) == expressionManager->rational(0.0));
-        }
+            for (auto const& entry : dimensionTerms) {
+                chunk.smtSolver->add(storm::expressions::sum(entry.second) == expressionManager.rational(0.0));
+            }
 
-        solverTime.start();
-        auto result = smtSolver->check();
-        solverTime.stop();
-        if (result == storm::solver::SmtSolver::CheckResult::Unsat) {
+            auto result = chunk.smtSolver->check();
+            if (result == storm::solver::SmtSolver::CheckResult::Unsat) {
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
-            if (input[pointIndex].size() == 2) {
-                std::cout << "point " << toString(input[pointIndex]) << " is a vertex:";
-                std::cout << smtSolver->getSmtLibString() << '\n';
-            }
+                if (input[pointIndex].size() == 2) {
+                    std::cout << "point " << toString(input[pointIndex]) << " is a vertex:";
+                    std::cout << chunk.smtSolver->getSmtLibString() << '\n';
+                }
 #endif
-            vertices.set(pointIndex, true);
-        }
+                vertices[pointIndex] = true;
+            }
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
-        else {
-            std::cout << "point " << toString(input[pointIndex]) << " is a convex combination of ";
-            auto val = smtSolver->getModelAsValuation();
-            uint64_t varIndex = 0;
-            for (auto const& wvar : weightVariables) {
-                if (!storm::utility::isZero(val.getRationalValue(wvar))) {
-                    std::cout << toString(input[varIndex]) << " (weight: " << val.getRationalValue(wvar) << ")";
+            else {
+                std::cout << "point " << toString(input[pointIndex]) << " is a convex combination of ";
+                auto val = chunk.smtSolver->getModelAsValuation();
+                uint64_t varIndex = 0;
+                for (auto const& wvar : chunk.weightVariables) {
+                    if (!storm::utility::isZero(val.getRationalValue(wvar))) {
+                        std::cout << toString(input[varIndex]) << " (weight: " << val.getRationalValue(wvar) << ")";
+                    }
+                    varIndex++;
                 }
-                varIndex++;
+                std::cout << '\n';
             }
-            std::cout << '\n';
-        }
-        if (timeOut >)
 #endif
+            chunk.smtSolver->pop();
             if (timeOut > 0 && static_cast<uint64_t>(totalTime.getTimeInMilliseconds()) > timeOut) {
-                for (uint64_t remainingPoint = pointIndex + 1; remainingPoint < input.size(); ++remainingPoint) {
-                    vertices.set(remainingPoint);
-                }
-                return {vertices, true};
+                timedOut.store(true, std::memory_order_relaxed);
             }
-        smtSolver->pop();
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfChunks > 1) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfChunks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                checkChunk(chunks[chunkIndex]);
+            }
+        });
+    } else {
+        checkChunk(chunks.front());
+    }
+#else
+    checkChunk(chunks.front());
+#endif
 #ifdef _DEBUG_REDUCE_VERTEX_CLOUD
-        std::cout << "Solver time " << solverTime.getTimeInMilliseconds() << '\n';
-        std::cout << "Total time " << totalTime.getTimeInMilliseconds() << '\n';
+    std::cout << "Total time " << totalTime.getTimeInMilliseconds() << '\n';
 #endif
+
+    storm::storage::BitVector result(input.size());
+    for (uint64_t pointIndex = 0; pointIndex < input.size(); ++pointIndex) {
+        result.set(pointIndex, vertices[pointIndex]);
     }
-    return {vertices, false};
+    return {result, timedOut.load()};
 }
 
 template class ReduceVertexCloud<double>;
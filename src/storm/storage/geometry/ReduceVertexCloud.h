@@ -21,6 +21,12 @@ class ReduceVertexCloud {
                       uint64_t timeout = 0)
         : smtSolverFactory(smtSolverFactory), wiggle(wiggle), timeOut(timeout) {}
 
+    /*!
+     * Determines the input points that are not a convex combination of other input points (with at most the same support).
+     * If Storm is built with Intel TBB, the points are checked concurrently.
+     *
+     * @return the set of remaining points and whether the timeout was reached (in which case all unchecked points are kept).
+     */
     std::pair<storm::storage::BitVector, bool> eliminate(std::vector<std::map<uint64_t, ValueType>> const& input, uint64_t maxdimension);
 
    private:
@@ -1,13 +1,103 @@
 #include "storm/storage/geometry/nativepolytopeconversion/HyperplaneEnumeration.h"
 
+#include <optional>
+#include <unordered_set>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/geometry/nativepolytopeconversion/HyperplaneCollector.h"
 #include "storm/storage/geometry/nativepolytopeconversion/SubsetEnumerator.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace storage {
 namespace geometry {
 
+namespace {
+uint64_t constexpr HyperplaneEnumerationBatchSize = 1024;
+
+/*!
+ * Enumerates the intersection points of all linear independent subsets of dimension() many hyperplanes and invokes the given function for each such
+ * point that is contained in the polytope (together with the corresponding subset).
+ * If onlyFirstHyperplane is true, only subsets that contain the hyperplane with index 0 are considered.
+ *
+ * The subsets are solved in batches. The subsets of a batch are solved in parallel, but the points are passed to the given function in the order of the
+ * enumeration, i.e., the result does not depend on the number of threads.
+ */
+template<typename ValueType, typename CollectFunction>
+void enumerateVertices(typename HyperplaneEnumeration<ValueType>::EigenMatrix const& constraintMatrix,
+                       typename HyperplaneEnumeration<ValueType>::EigenVector const& constraintVector, bool onlyFirstHyperplane,
+                       CollectFunction const& collect) {
+    typedef typename HyperplaneEnumeration<ValueType>::EigenMatrix EigenMatrix;
+    typedef typename HyperplaneEnumeration<ValueType>::EigenVector EigenVector;
+    Eigen::Index dimension = constraintMatrix.cols();
+
+    auto computePoint = [&](std::vector<uint_fast64_t> const& subset) -> std::optional<EigenVector> {
+        EigenMatrix subMatrix(dimension, dimension);
+        EigenVector subVector(dimension);
+        for (Eigen::Index i = 0; i < dimension; ++i) {
+            subMatrix.row(i) = constraintMatrix.row(subset[i]);
+            subVector(i) = constraintVector(subset[i]);
+        }
+
+        EigenVector point = subMatrix.fullPivLu().solve(subVector);
+        for (Eigen::Index row = 0; row < constraintMatrix.rows(); ++row) {
+            if ((constraintMatrix.row(row) * point)(0) > constraintVector(row)) {
+                return std::nullopt;
+            }
+        }
+        return point;
+    };
+
+    std::vector<std::vector<uint_fast64_t>> subsets;
+    std::vector<std::optional<EigenVector>> points;
+    auto processBatch = [&]() {
+        points.clear();
+        points.resize(subsets.size());
+#ifdef STORM_HAVE_INTELTBB
+        if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, subsets.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    points[index] = computePoint(subsets[index]);
+                }
+            });
+        } else {
+            for (uint64_t index = 0; index < subsets.size(); ++index) {
+                points[index] = computePoint(subsets[index]);
+            }
+        }
+#else
+        for (uint64_t index = 0; index < subsets.size(); ++index) {
+            points[index] = computePoint(subsets[index]);
+        }
+#endif
+        for (uint64_t index = 0; index < subsets.size(); ++index) {
+            if (points[index]) {
+                collect(std::move(*points[index]), subsets[index]);
+            }
+        }
+        subsets.clear();
+    };
+
+    storm::storage::geometry::SubsetEnumerator<EigenMatrix> subsetEnum(constraintMatrix.rows(), dimension, constraintMatrix,
+                                                                       HyperplaneEnumeration<ValueType>::linearDependenciesFilter);
+    if (subsetEnum.setToFirstSubset()) {
+        do {
+            std::vector<uint_fast64_t> const& subset = subsetEnum.getCurrentSubset();
+            // The subsets are enumerated in lexicographic order, i.e., the subsets that contain the first hyperplane come first.
+            if (onlyFirstHyperplane && subset.front() != 0) {
+                break;
+            }
+            subsets.push_back(subset);
+            if (subsets.size() == HyperplaneEnumerationBatchSize) {
+                processBatch();
+            }
+        } while (subsetEnum.incrementSubset());
+    }
+    processBatch();
+}
+}  // namespace
+
 template<typename ValueType>
 void HyperplaneEnumeration<ValueType>::generateVerticesFromConstraints(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector,
                                                                        bool generateRelevantHyperplanesAndVertexSets) {
@@ -22,38 +112,15 @@ void HyperplaneEnumeration<ValueType>::generateVerticesFromConstraints(EigenMatr
         return;
     }
     std::unordered_map<EigenVector, std::set<uint_fast64_t>> vertexCollector;
-    storm::storage::geometry::SubsetEnumerator<EigenMatrix> subsetEnum(constraintMatrix.rows(), dimension, constraintMatrix, this->linearDependenciesFilter);
-    if (subsetEnum.setToFirstSubset()) {
-        do {
-            std::vector<uint_fast64_t> const& subset = subsetEnum.getCurrentSubset();
-
-            EigenMatrix subMatrix(dimension, dimension);
-            EigenVector subVector(dimension);
-            for (Eigen::Index i = 0; i < dimension; ++i) {
-                subMatrix.row(i) = constraintMatrix.row(subset[i]);
-                subVector(i) = constraintVector(subset[i]);
-            }
-
-            EigenVector point = subMatrix.fullPivLu().solve(subVector);
-            bool pointContained = true;
-            for (Eigen::Index row = 0; row < constraintMatrix.rows(); ++row) {
-                if ((constraintMatrix.row(row) * point)(0) > constraintVector(row)) {
-                    pointContained = false;
-                    break;
-                }
-            }
-            if (pointContained) {
-                // Note that the map avoids duplicates.
-                auto hyperplaneIndices =
-                    vertexCollector
-                        .insert(typename std::unordered_map<EigenVector, std::set<uint_fast64_t>>::value_type(std::move(point), std::set<uint_fast64_t>()))
-                        .first;
-                if (generateRelevantHyperplanesAndVertexSets) {
-                    hyperplaneIndices->second.insert(subset.begin(), subset.end());
-                }
-            }
-        } while (subsetEnum.incrementSubset());
-    }
+    enumerateVertices<ValueType>(constraintMatrix, constraintVector, false, [&](EigenVector&& point, std::vector<uint_fast64_t> const& subset) {
+        // Note that the map avoids duplicates.
+        auto hyperplaneIndices =
+            vertexCollector.insert(typename std::unordered_map<EigenVector, std::set<uint_fast64_t>>::value_type(std::move(point), std::set<uint_fast64_t>()))
+                .first;
+        if (generateRelevantHyperplanesAndVertexSets) {
+            hyperplaneIndices->second.insert(subset.begin(), subset.end());
+        }
+    });
 
     if (generateRelevantHyperplanesAndVertexSets) {
         // For each hyperplane, get the number of (unique) vertices that lie on it.
@@ -119,6 +186,31 @@ void HyperplaneEnumeration<ValueType>::generateVerticesFromConstraints(EigenMatr
     }
 }
 
+template<typename ValueType>
+void HyperplaneEnumeration<ValueType>::generateVerticesOnHyperplane(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector,
+                                                                    Eigen::Index hyperplaneIndex) {
+    STORM_LOG_DEBUG("Invoked Hyperplane enumeration on one of " << constraintMatrix.rows() << " constraints.");
+    STORM_LOG_ASSERT(hyperplaneIndex < constraintMatrix.rows(), "Invalid hyperplane index.");
+    resultVertices.clear();
+    relevantMatrix = EigenMatrix();
+    relevantVector = EigenVector();
+    vertexSets.clear();
+    if (constraintMatrix.cols() == 0) {
+        return;
+    }
+
+    // Move the given hyperplane to the front so that only the first subsets have to be enumerated.
+    EigenMatrix reorderedMatrix = constraintMatrix;
+    EigenVector reorderedVector = constraintVector;
+    reorderedMatrix.row(0).swap(reorderedMatrix.row(hyperplaneIndex));
+    std::swap(reorderedVector(0), reorderedVector(hyperplaneIndex));
+
+    std::unordered_set<EigenVector> vertexCollector;
+    enumerateVertices<ValueType>(reorderedMatrix, reorderedVector, true,
+                                 [&vertexCollector](EigenVector&& point, std::vector<uint_fast64_t> const&) { vertexCollector.insert(std::move(point)); });
+    resultVertices.assign(vertexCollector.begin(), vertexCollector.end());
+}
+
 template<typename ValueType>
 bool HyperplaneEnumeration<ValueType>::linearDependenciesFilter(std::vector<uint_fast64_t> const& subset, uint_fast64_t const& item, EigenMatrix const& A) {
     EigenMatrix subMatrix(subset.size() + 1, A.cols());
@@ -30,6 +30,16 @@ class HyperplaneEnumeration {
     void generateVerticesFromConstraints(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector,
                                          bool generateRelevantHyperplanesAndVertexSets);
 
+    /*
+     * Generates the vertices of the given polytope that lie on the hyperplane with the given index, i.e., only the intersection points of subsets that
+     * contain this hyperplane are enumerated.
+     * This can be used to update the vertices of a polytope after intersecting it with a halfspace: The vertices of the intersection are the previous
+     * vertices that satisfy the new constraint plus the vertices on the new hyperplane.
+     *
+     * The relevant hyperplanes and vertex sets are not computed.
+     */
+    void generateVerticesOnHyperplane(EigenMatrix const& constraintMatrix, EigenVector const& constraintVector, Eigen::Index hyperplaneIndex);
+
     std::vector<EigenVector>& getResultVertices();
 
     /*!
@@ -1,6 +1,7 @@
 #include "storm/storage/jani/Model.h"
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
@@ -21,6 +22,7 @@
 #include "storm/storage/jani/visitor/JSONExporter.h"
 #include "storm/storage/jani/visitor/JaniExpressionSubstitutionVisitor.h"
 
+#include "storm/storage/BitVector.h"
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
 
 #include "storm/utility/combinatorics.h"
@@ -227,22 +229,24 @@ ConditionalMetaEdge createSynchronizedMetaEdge(Automaton& automaton, std::vector
     return result;
 }
 
+// The edges of an automaton grouped by their action index.
+using EdgesByAction = std::unordered_map<uint64_t, std::vector<std::reference_wrapper<Edge const>>>;
+
 std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldModel, Model& newModel, Automaton& newAutomaton,
                                                               std::vector<std::set<uint64_t>>& synchronizingActionIndices, SynchronizationVector const& vector,
-                                                              std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata,
-                                                              storm::solver::SmtSolver& solver) {
+                                                              std::vector<EdgesByAction> const& edgesOfComposedAutomata, storm::solver::SmtSolver& solver) {
     std::vector<ConditionalMetaEdge> result;
 
     // Gather all participating automata and the corresponding input symbols.
     std::vector<uint64_t> components;
-    std::vector<std::pair<std::reference_wrapper<Automaton const>, uint64_t>> participatingAutomataAndActions;
-    for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
+    std::vector<uint64_t> participatingActions;
+    for (uint64_t i = 0; i < edgesOfComposedAutomata.size(); ++i) {
         std::string const& actionName = vector.getInput(i);
         if (!SynchronizationVector::isNoActionInput(actionName)) {
             components.push_back(i);
             uint64_t actionIndex = oldModel.getActionIndex(actionName);
             // store that automaton occurs in the sync vector.
-            participatingAutomataAndActions.push_back(std::make_pair(composedAutomata[i], actionIndex));
+            participatingActions.push_back(actionIndex);
             // Store for later that this action is one of the possible actions that synchronise
             synchronizingActionIndices[i].insert(actionIndex);
         }
@@ -263,19 +267,15 @@ std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldMo
     // Prepare the list that stores for each automaton the list of edges with the participating action.
     std::vector<std::vector<std::reference_wrapper<storm::jani::Edge const>>> possibleEdges;
 
-    for (auto const& automatonActionPair : participatingAutomataAndActions) {
-        possibleEdges.emplace_back();
-        for (auto const& edge : automatonActionPair.first.get().getEdges()) {
-            if (edge.getActionIndex() == automatonActionPair.second) {
-                possibleEdges.back().push_back(edge);
-            }
-        }
+    for (uint64_t i = 0; i < components.size(); ++i) {
+        auto edgesIt = edgesOfComposedAutomata[components[i]].find(participatingActions[i]);
 
         // If there were no edges with the participating action index, then there is no synchronization possible.
-        if (possibleEdges.back().empty()) {
+        if (edgesIt == edgesOfComposedAutomata[components[i]].end()) {
             noCombinations = true;
             break;
         }
+        possibleEdges.push_back(edgesIt->second);
     }
 
     // If there are no valid combinations for the action, we need to skip the generation of synchronizing edges.
@@ -346,6 +346,36 @@ std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldMo
     return result;
 }
 
+/*!
+ * Computes the locations of the given automaton that are reachable from its initial locations when ignoring guards and synchronization.
+ * Only these locations can be part of a reachable location combination of a composition that contains the automaton.
+ */
+storm::storage::BitVector computeLocallyReachableLocations(Automaton const& automaton) {
+    std::vector<std::vector<uint64_t>> successors(automaton.getNumberOfLocations());
+    for (auto const& edge : automaton.getEdges()) {
+        for (auto const& destination : edge.getDestinations()) {
+            successors[edge.getSourceLocationIndex()].push_back(destination.getLocationIndex());
+        }
+    }
+
+    storm::storage::BitVector reachableLocations(automaton.getNumberOfLocations());
+    std::vector<uint64_t> locationsToExplore(automaton.getInitialLocationIndices().begin(), automaton.getInitialLocationIndices().end());
+    for (auto const& location : locationsToExplore) {
+        reachableLocations.set(location);
+    }
+    while (!locationsToExplore.empty()) {
+        uint64_t currentLocation = locationsToExplore.back();
+        locationsToExplore.pop_back();
+        for (auto const& successor : successors[currentLocation]) {
+            if (!reachableLocations.get(successor)) {
+                reachableLocations.set(successor);
+                locationsToExplore.push_back(successor);
+            }
+        }
+    }
+    return reachableLocations;
+}
+
 void createCombinedLocation(std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata, Automaton& newAutomaton,
                             std::vector<uint64_t> const& locations, bool initial = false) {
     std::stringstream locationNameBuilder;
@@ -386,6 +416,17 @@ void addEdgesToReachableLocations(std::vector<std::reference_wrapper<Automaton c
             return true;
         });
 
+    // Group the meta edges by the source location of their first component. Then, for each location combination, only the meta edges whose first
+    // condition is met need to be considered.
+    std::vector<std::vector<std::vector<uint64_t>>> metaEdgesByFirstCondition(composedAutomata.size());
+    for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
+        metaEdgesByFirstCondition[i].resize(composedAutomata[i].get().getNumberOfLocations());
+    }
+    for (uint64_t metaEdgeIndex = 0; metaEdgeIndex < conditionalMetaEdges.size(); ++metaEdgeIndex) {
+        auto const& metaEdge = conditionalMetaEdges[metaEdgeIndex];
+        metaEdgesByFirstCondition[metaEdge.components.front()][metaEdge.condition.front()].push_back(metaEdgeIndex);
+    }
+
     // We also maintain a mapping from location combinations to new locations.
     std::unordered_map<std::vector<uint64_t>, uint64_t, storm::utility::vector::VectorHash<uint64_t>> newLocationMapping;
 
@@ -401,9 +442,18 @@ void addEdgesToReachableLocations(std::vector<std::reference_wrapper<Automaton c
         std::vector<uint64_t> currentLocations = std::move(locationsToExplore.back());
         locationsToExplore.pop_back();
 
-        for (auto const& metaEdge : conditionalMetaEdges) {
+        // Collect the candidate meta edges in their original order so that the edges are created in the same order as before.
+        std::vector<uint64_t> candidateMetaEdges;
+        for (uint64_t i = 0; i < currentLocations.size(); ++i) {
+            auto const& candidates = metaEdgesByFirstCondition[i][currentLocations[i]];
+            candidateMetaEdges.insert(candidateMetaEdges.end(), candidates.begin(), candidates.end());
+        }
+        std::sort(candidateMetaEdges.begin(), candidateMetaEdges.end());
+
+        for (auto const& metaEdgeIndex : candidateMetaEdges) {
+            auto const& metaEdge = conditionalMetaEdges[metaEdgeIndex];
             bool isApplicable = true;
-            for (uint64_t i = 0; i < metaEdge.components.size(); ++i) {
+            for (uint64_t i = 1; i < metaEdge.components.size(); ++i) {
                 if (currentLocations[metaEdge.components[i]] != metaEdge.condition[i]) {
                     isApplicable = false;
                     break;
@@ -535,6 +585,20 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
         solver->add(variable.getRangeExpression());
     }
 
+    // Group the edges of the composed automata by their action, so that each synchronization vector only visits the edges that participate in it.
+    // Edges leaving a location that is unreachable even within its own automaton can never be taken and are dropped right away, which avoids
+    // enumerating their combinations with the edges of other automata.
+    std::vector<storm::storage::BitVector> locallyReachableLocations;
+    std::vector<EdgesByAction> edgesOfComposedAutomata(composedAutomata.size());
+    for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
+        locallyReachableLocations.push_back(computeLocallyReachableLocations(composedAutomata[i].get()));
+        for (auto const& edge : composedAutomata[i].get().getEdges()) {
+            if (locallyReachableLocations[i].get(edge.getSourceLocationIndex())) {
+                edgesOfComposedAutomata[i][edge.getActionIndex()].push_back(edge);
+            }
+        }
+    }
+
     // Perform all necessary synchronizations and keep track which action indices participate in synchronization.
     std::vector<std::set<uint64_t>> synchronizingActionIndices(composedAutomata.size());
     std::vector<ConditionalMetaEdge> conditionalMetaEdges;
@@ -546,18 +610,22 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
 
         // Create all conditional template edges corresponding to this synchronization vector.
         std::vector<ConditionalMetaEdge> newConditionalMetaEdges =
-            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, composedAutomata, *solver);
+            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, edgesOfComposedAutomata, *solver);
         conditionalMetaEdges.insert(conditionalMetaEdges.end(), newConditionalMetaEdges.begin(), newConditionalMetaEdges.end());
     }
 
     // Now add all edges with action indices that were not mentioned in synchronization vectors.
+    std::map<uint64_t, std::string> const actionIndexToNameMap = this->getActionIndexToNameMap();
     for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
         Automaton const& automaton = composedAutomata[i].get();
         for (auto const& edge : automaton.getEdges()) {
+            if (!locallyReachableLocations[i].get(edge.getSourceLocationIndex())) {
+                continue;
+            }
             if (synchronizingActionIndices[i].find(edge.getActionIndex()) == synchronizingActionIndices[i].end()) {
                 uint64_t actionIndex = edge.getActionIndex();
                 if (actionIndex != SILENT_ACTION_INDEX) {
-                    std::string actionName = this->getActionIndexToNameMap().at(edge.getActionIndex());
+                    std::string const& actionName = actionIndexToNameMap.at(edge.getActionIndex());
                     if (flattenedModel.hasAction(actionName)) {
                         actionIndex = flattenedModel.getActionIndex(actionName);
                     } else {
@@ -869,6 +937,15 @@ uint64_t Model::addAutomaton(Automaton const& automaton) {
     return automata.size() - 1;
 }
 
+uint64_t Model::addAutomaton(Automaton&& automaton) {
+    auto it = automatonToIndex.find(automaton.getName());
+    STORM_LOG_THROW(it == automatonToIndex.end(), storm::exceptions::WrongFormatException,
+                    "Automaton with name '" << automaton.getName() << "' already exists.");
+    automatonToIndex.emplace(automaton.getName(), automata.size());
+    automata.push_back(std::move(automaton));
+    return automata.size() - 1;
+}
+
 std::vector<Automaton>& Model::getAutomata() {
     return automata;
 }
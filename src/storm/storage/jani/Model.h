@@ -296,6 +296,11 @@ class Model {
      */
     uint64_t addAutomaton(Automaton const& automaton);
 
+    /*!
+     * Adds the given automaton to the automata of this model without copying it.
+     */
+    uint64_t addAutomaton(Automaton&& automaton);
+
     /*!
      * Retrieves the automata of the model.
      */
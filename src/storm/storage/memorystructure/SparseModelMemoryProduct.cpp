@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -9,7 +10,10 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/memorystructure/MemoryStructureBuilder.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -99,10 +103,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
     if (scheduler) {
         transitionMatrix = buildTransitionMatrixForScheduler();
-    } else if (model.getTransitionMatrix().hasTrivialRowGrouping()) {
-        transitionMatrix = buildDeterministicTransitionMatrix();
     } else {
-        transitionMatrix = buildNondeterministicTransitionMatrix();
+        transitionMatrix = buildTransitionMatrix();
     }
     storm::models::sparse::StateLabeling labeling = buildStateLabeling(transitionMatrix);
     std::unordered_map<std::string, RewardModelType> rewardModels = buildRewardModels(transitionMatrix);
@@ -127,21 +129,27 @@ uint64_t const& SparseModelMemoryProduct<ValueType, RewardModelType>::getResultS
 
 template<typename ValueType, typename RewardModelType>
 void SparseModelMemoryProduct<ValueType, RewardModelType>::computeMemorySuccessors() {
-    uint64_t modelTransitionCount = model.getTransitionMatrix().getEntryCount();
-    memorySuccessors = std::vector<uint64_t>(modelTransitionCount * memoryStateCount, std::numeric_limits<uint64_t>::max());
-
+    memoryTransitions.assign(memoryStateCount, {});
     for (uint64_t memoryState = 0; memoryState < memoryStateCount; ++memoryState) {
         for (uint64_t transitionGoal = 0; transitionGoal < memoryStateCount; ++transitionGoal) {
             auto const& memoryTransition = memory.getTransitionMatrix()[memoryState][transitionGoal];
-            if (memoryTransition) {
-                for (auto modelTransitionIndex : memoryTransition.get()) {
-                    memorySuccessors[modelTransitionIndex * memoryStateCount + memoryState] = transitionGoal;
-                }
+            if (memoryTransition && !memoryTransition->empty()) {
+                memoryTransitions[memoryState].emplace_back(transitionGoal, &memoryTransition.get());
             }
         }
     }
 }
 
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseModelMemoryProduct<ValueType, RewardModelType>::getMemorySuccessor(uint64_t const& modelTransition, uint64_t const& memoryState) const {
+    for (auto const& [transitionGoal, modelTransitions] : memoryTransitions[memoryState]) {
+        if (modelTransitions->get(modelTransition)) {
+            return transitionGoal;
+        }
+    }
+    return std::numeric_limits<uint64_t>::max();
+}
+
 template<typename ValueType, typename RewardModelType>
 void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableStates(storm::storage::BitVector const& initialStates) {
     // Explore the reachable states via DFS.
@@ -166,7 +174,7 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                         if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                             uint64_t successorModelState = modelTransitionIt->getColumn();
                             uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                             uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                             if (!reachableStates.get(successorStateIndex)) {
                                 reachableStates.set(successorStateIndex, true);
@@ -181,7 +189,7 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
                     if (!storm::utility::isZero(modelTransitionIt->getValue())) {
                         uint64_t successorModelState = modelTransitionIt->getColumn();
                         uint64_t modelTransitionId = modelTransitionIt - model.getTransitionMatrix().begin();
-                        uint64_t successorMemoryState = memorySuccessors[modelTransitionId * memoryStateCount + memoryState];
+                        uint64_t successorMemoryState = getMemorySuccessor(modelTransitionId, memoryState);
                         uint64_t successorStateIndex = successorModelState * memoryStateCount + successorMemoryState;
                         if (!reachableStates.get(successorStateIndex)) {
                             reachableStates.set(successorStateIndex, true);
@@ -195,63 +203,60 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildDeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        numResTransitions += model.getTransitionMatrix().getRow(stateIndex / memoryStateCount).getNumberOfEntries();
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResStates, numResStates, numResTransitions, true);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
+storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildTransitionMatrix() {
+    auto const& modelMatrix = model.getTransitionMatrix();
+    auto const& modelRowGroupIndices = modelMatrix.getRowGroupIndices();
+
+    // First compute the row (group) indications of the result so that afterwards all row groups can be filled independently.
+    std::vector<uint64_t> resultToStateIndex(reachableStates.begin(), reachableStates.end());
+    uint64_t const numResStates = resultToStateIndex.size();
+    std::vector<uint64_t> rowGroupIndices;
+    rowGroupIndices.reserve(numResStates + 1);
+    rowGroupIndices.push_back(0);
+    std::vector<uint64_t> rowIndications(1, 0);
+    for (auto stateIndex : resultToStateIndex) {
         uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
-        for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-            uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-            builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+        for (uint64_t modelRow = modelRowGroupIndices[modelState]; modelRow < modelRowGroupIndices[modelState + 1]; ++modelRow) {
+            rowIndications.push_back(rowIndications.back() + modelMatrix.getRow(modelRow).getNumberOfEntries());
         }
-        ++currentRow;
+        rowGroupIndices.push_back(rowIndications.size() - 1);
     }
 
-    return builder.build();
-}
-
-template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildNondeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResChoices = 0;
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        for (uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRow < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRow) {
-            ++numResChoices;
-            numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
-        }
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResChoices, numResStates, numResTransitions, true, true, numResStates);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        builder.newRowGroup(currentRow);
-        for (uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRowIndex < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRowIndex) {
-            auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
-            for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+    // The entries of a product row are the entries of the model row with the column replaced by the product successor.
+    // As the result states are ordered by their model state, the columns of each row remain sorted.
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> columnsAndValues(rowIndications.back());
+    auto fillRowGroups = [&](uint64_t resultStateBegin, uint64_t resultStateEnd) {
+        for (uint64_t resultState = resultStateBegin; resultState < resultStateEnd; ++resultState) {
+            uint64_t modelState = resultToStateIndex[resultState] / memoryStateCount;
+            uint64_t memoryState = resultToStateIndex[resultState] % memoryStateCount;
+            auto resultEntryIt = columnsAndValues.begin() + rowIndications[rowGroupIndices[resultState]];
+            auto const modelEntryEnd = modelMatrix.end(modelRowGroupIndices[modelState + 1] - 1);
+            for (auto modelEntryIt = modelMatrix.begin(modelRowGroupIndices[modelState]); modelEntryIt != modelEntryEnd; ++modelEntryIt, ++resultEntryIt) {
+                uint64_t successorMemoryState = getMemorySuccessor(modelEntryIt - modelMatrix.begin(), memoryState);
+                *resultEntryIt = storm::storage::MatrixEntry<uint64_t, ValueType>(
+                    toResultStateMapping[modelEntryIt->getColumn() * memoryStateCount + successorMemoryState], modelEntryIt->getValue());
             }
-            ++currentRow;
         }
+    };
+    bool filled = false;
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numResStates),
+                              [&fillRowGroups](tbb::blocked_range<uint64_t> const& range) { fillRowGroups(range.begin(), range.end()); });
+            filled = true;
+        }
+    }
+#endif
+    if (!filled) {
+        fillRowGroups(0, numResStates);
     }
 
-    return builder.build();
+    boost::optional<std::vector<uint64_t>> resultRowGroupIndices;
+    if (!modelMatrix.hasTrivialRowGrouping()) {
+        resultRowGroupIndices = std::move(rowGroupIndices);
+    }
+    return storm::storage::SparseMatrix<ValueType>(numResStates, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -308,7 +313,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
             } else {
@@ -319,7 +324,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                         auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                         for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                             uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                            uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                             ValueType transitionValue = choiceIndex.second * entryIt->getValue();
                             auto insertionRes = transitions.insert(std::make_pair(getResultState(entryIt->getColumn(), successorMemoryState), transitionValue));
                             if (!insertionRes.second) {
@@ -339,7 +344,7 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
                 auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
                 for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
                     uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                     builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
                 }
                 ++currentRow;
@@ -475,7 +480,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 auto insertionRes =
                                     rewards.insert(std::make_pair(getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue()));
                                 if (!insertionRes.second) {
@@ -499,7 +504,7 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
                                     ++transitionEntryIt;
                                 }
                                 uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                                uint64_t successorMemoryState = getMemorySuccessor(transitionId, memoryState);
                                 builder.addNextValue(resRowIndex, getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue());
                             }
                         }
@@ -56,18 +56,18 @@ class SparseModelMemoryProduct {
     // Initializes auxiliary data for building the product
     void initialize();
 
-    // Computes for each pair of memory state and model transition index the successor memory state
-    // The resulting vector maps (modelTransition * memoryStateCount) + memoryState to the corresponding successor state of the memory structure
+    // Collects for each memory state the outgoing memory transitions, which are used to compute the successor memory states on the fly
     void computeMemorySuccessors();
 
+    // Retrieves the successor memory state when taking the given model transition in the given memory state
+    uint64_t getMemorySuccessor(uint64_t const& modelTransition, uint64_t const& memoryState) const;
+
     // Computes the reachable states of the resulting model
     void computeReachableStates(storm::storage::BitVector const& initialStates);
 
     // Methods that build the model components
-    // Matrix for deterministic models
-    storm::storage::SparseMatrix<ValueType> buildDeterministicTransitionMatrix();
-    // Matrix for nondeterministic models
-    storm::storage::SparseMatrix<ValueType> buildNondeterministicTransitionMatrix();
+    // Matrix for models that do not consider a scheduler. The row groups are filled in parallel if Intel TBB is enabled
+    storm::storage::SparseMatrix<ValueType> buildTransitionMatrix();
     // Matrix for models that consider a scheduler
     storm::storage::SparseMatrix<ValueType> buildTransitionMatrixForScheduler();
     // State labeling.
@@ -83,8 +83,9 @@ class SparseModelMemoryProduct {
     // Stores whether this builder has already been initialized.
     bool isInitialized;
 
-    // stores the successor memory states for each transition in the product
-    std::vector<uint64_t> memorySuccessors;
+    // Stores for each memory state the successor memory states together with the model transitions that lead to them.
+    // This avoids storing a successor for every pair of model transition and memory state.
+    std::vector<std::vector<std::pair<uint64_t, storm::storage::BitVector const*>>> memoryTransitions;
 
     // Maps (modelState * memoryStateCount) + memoryState to the state in the result that represents (memoryState,modelState)
     std::vector<uint64_t> toResultStateMapping;
@@ -4,6 +4,8 @@
 #include <boost/algorithm/string/join.hpp>
 #include <sstream>
 
+#include "storm/logic/AtomicLabelFormula.h"
+#include "storm/logic/Formula.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
 
@@ -11,6 +13,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/solver/SmtSolver.h"
@@ -345,7 +348,9 @@ bool Program::undefinedConstantsAreGraphPreserving() const {
 
     // Check the reward models.
     for (auto const& rewardModel : this->getRewardModels()) {
-        rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables);
+        if (!rewardModel.containsVariablesOnlyInRewardValueExpressions(undefinedConstantVariables)) {
+            return false;
+        }
     }
 
     // Initial construct.
@@ -1179,6 +1184,226 @@ Program Program::labelUnlabelledCommands(std::map<uint64_t, std::string> const&
                    this->getObservationLabels(), this->getOptionalInitialConstruct(), this->getOptionalSystemCompositionConstruct(), prismCompatibility);
 }
 
+namespace {
+// Adds the variables of the given expression and returns true iff this added a new variable.
+bool insertVariables(std::set<storm::expressions::Variable>& variables, storm::expressions::Expression const& expression) {
+    uint64_t const numberOfVariables = variables.size();
+    expression.gatherVariables(variables);
+    return variables.size() > numberOfVariables;
+}
+
+bool assignsVariable(Command const& command, std::set<storm::expressions::Variable> const& variables) {
+    for (auto const& update : command.getUpdates()) {
+        for (auto const& assignment : update.getAssignments()) {
+            if (variables.count(assignment.getVariable()) > 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void gatherRewardModelVariables(RewardModel const& rewardModel, std::set<storm::expressions::Variable>& variables) {
+    for (auto const& stateReward : rewardModel.getStateRewards()) {
+        stateReward.getStatePredicateExpression().gatherVariables(variables);
+        stateReward.getRewardValueExpression().gatherVariables(variables);
+    }
+    for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+        stateActionReward.getStatePredicateExpression().gatherVariables(variables);
+        stateActionReward.getRewardValueExpression().gatherVariables(variables);
+    }
+    for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
+        transitionReward.getSourceStatePredicateExpression().gatherVariables(variables);
+        transitionReward.getTargetStatePredicateExpression().gatherVariables(variables);
+        transitionReward.getRewardValueExpression().gatherVariables(variables);
+    }
+}
+
+// A module is neutral if it never blocks any of its (synchronizing) actions and does not change the state when taking part in a synchronization.
+bool isNeutralModule(Module const& module) {
+    if (module.getNumberOfBooleanVariables() > 0 || module.getNumberOfIntegerVariables() > 0 || module.getNumberOfClockVariables() > 0) {
+        return false;
+    }
+    std::set<uint_fast64_t> actionIndices;
+    for (auto const& command : module.getCommands()) {
+        if (!command.isLabeled() || !actionIndices.insert(command.getActionIndex()).second || !command.getGuardExpression().isTrue() ||
+            command.getNumberOfUpdates() != 1) {
+            return false;
+        }
+        auto const& update = command.getUpdates().front();
+        if (!update.getAssignments().empty() || update.getLikelihoodExpression().containsVariables() ||
+            update.getLikelihoodExpression().evaluateAsDouble() != 1.0) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+Program Program::restrictToConeOfInfluence(std::set<storm::expressions::Variable> const& relevantVariables) const {
+    STORM_LOG_THROW(this->getModelType() != ModelType::PTA && this->getPlayers().empty(), storm::exceptions::NotSupportedException,
+                    "Restricting to the cone of influence is not supported for programs with clocks or players.");
+    bool const discreteTime = this->isDiscreteTimeModel();
+
+    // The guards, invariants and the initial states are always relevant as they determine the enabled commands and the initial states. For
+    // continuous time models, the rates of all commands are relevant as they determine the exit rates.
+    std::set<storm::expressions::Variable> coneOfInfluence = relevantVariables;
+    for (auto const& module : this->getModules()) {
+        if (module.getInvariant().isInitialized()) {
+            insertVariables(coneOfInfluence, module.getInvariant());
+        }
+        for (auto const& command : module.getCommands()) {
+            insertVariables(coneOfInfluence, command.getGuardExpression());
+            if (!discreteTime) {
+                for (auto const& update : command.getUpdates()) {
+                    insertVariables(coneOfInfluence, update.getLikelihoodExpression());
+                }
+            }
+        }
+    }
+    if (this->hasInitialConstruct()) {
+        insertVariables(coneOfInfluence, this->getInitialConstruct().getInitialStatesExpression());
+    }
+    for (auto const& observationLabel : this->getObservationLabels()) {
+        insertVariables(coneOfInfluence, observationLabel.getStatePredicateExpression());
+    }
+
+    // Close the set under the assignments to relevant variables. The probabilities of a command only matter if it assigns a relevant variable.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto const& module : this->getModules()) {
+            for (auto const& command : module.getCommands()) {
+                bool const relevantCommand = assignsVariable(command, coneOfInfluence);
+                for (auto const& update : command.getUpdates()) {
+                    if (relevantCommand) {
+                        changed |= insertVariables(coneOfInfluence, update.getLikelihoodExpression());
+                    }
+                    for (auto const& assignment : update.getAssignments()) {
+                        if (coneOfInfluence.count(assignment.getVariable()) > 0) {
+                            changed |= insertVariables(coneOfInfluence, assignment.getExpression());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::set<storm::expressions::Variable> removedVariables;
+    auto isRelevant = [&coneOfInfluence, &removedVariables](auto const& variable) {
+        if (coneOfInfluence.count(variable.getExpressionVariable()) > 0) {
+            return true;
+        }
+        removedVariables.insert(variable.getExpressionVariable());
+        return false;
+    };
+    std::vector<BooleanVariable> newBooleanVariables;
+    std::copy_if(this->getGlobalBooleanVariables().begin(), this->getGlobalBooleanVariables().end(), std::back_inserter(newBooleanVariables), isRelevant);
+    std::vector<IntegerVariable> newIntegerVariables;
+    std::copy_if(this->getGlobalIntegerVariables().begin(), this->getGlobalIntegerVariables().end(), std::back_inserter(newIntegerVariables), isRelevant);
+
+    std::vector<Module> newModules;
+    newModules.reserve(this->getNumberOfModules());
+    for (auto const& module : this->getModules()) {
+        std::vector<BooleanVariable> newModuleBooleanVariables;
+        std::copy_if(module.getBooleanVariables().begin(), module.getBooleanVariables().end(), std::back_inserter(newModuleBooleanVariables), isRelevant);
+        std::vector<IntegerVariable> newModuleIntegerVariables;
+        std::copy_if(module.getIntegerVariables().begin(), module.getIntegerVariables().end(), std::back_inserter(newModuleIntegerVariables), isRelevant);
+
+        std::vector<Command> newCommands;
+        newCommands.reserve(module.getNumberOfCommands());
+        for (auto const& command : module.getCommands()) {
+            std::vector<Update> newUpdates;
+            if (discreteTime && !command.getUpdates().empty() && !assignsVariable(command, coneOfInfluence)) {
+                // All updates lead to the same state, so their probabilities add up to one.
+                auto const& update = command.getUpdates().front();
+                newUpdates.emplace_back(update.getGlobalIndex(), this->getManager().rational(1.0), std::vector<Assignment>(), update.getFilename(),
+                                        update.getLineNumber());
+            } else {
+                for (auto const& update : command.getUpdates()) {
+                    std::vector<Assignment> newAssignments;
+                    std::copy_if(update.getAssignments().begin(), update.getAssignments().end(), std::back_inserter(newAssignments),
+                                 [&coneOfInfluence](Assignment const& assignment) { return coneOfInfluence.count(assignment.getVariable()) > 0; });
+                    newUpdates.emplace_back(update.getGlobalIndex(), update.getLikelihoodExpression(), newAssignments, update.getFilename(),
+                                            update.getLineNumber());
+                }
+            }
+            newCommands.emplace_back(command.getGlobalIndex(), command.isMarkovian(), command.getActionIndex(), command.getActionName(),
+                                     command.getGuardExpression(), newUpdates, command.getFilename(), command.getLineNumber());
+        }
+        newModules.emplace_back(module.getName(), newModuleBooleanVariables, newModuleIntegerVariables, module.getClockVariables(), module.getInvariant(),
+                                newCommands, module.getFilename(), module.getLineNumber());
+    }
+
+    // Neutral modules can be removed if all of their actions are still present in the remaining modules.
+    if (!this->specifiesSystemComposition()) {
+        std::set<uint_fast64_t> remainingActionIndices;
+        for (auto const& module : newModules) {
+            if (!isNeutralModule(module)) {
+                auto const& actionIndices = module.getSynchronizingActionIndices();
+                remainingActionIndices.insert(actionIndices.begin(), actionIndices.end());
+            }
+        }
+        std::vector<Module> remainingModules;
+        for (auto const& module : newModules) {
+            auto const& actionIndices = module.getSynchronizingActionIndices();
+            if (!isNeutralModule(module) ||
+                !std::includes(remainingActionIndices.begin(), remainingActionIndices.end(), actionIndices.begin(), actionIndices.end())) {
+                remainingModules.push_back(module);
+            }
+        }
+        if (!remainingModules.empty()) {
+            STORM_LOG_INFO("Removed " << (newModules.size() - remainingModules.size()) << " modules outside of the cone of influence.");
+            newModules = std::move(remainingModules);
+        }
+    }
+    STORM_LOG_INFO("Removed " << removedVariables.size() << " variables outside of the cone of influence.");
+
+    std::vector<Formula> newFormulas;
+    std::copy_if(this->getFormulas().begin(), this->getFormulas().end(), std::back_inserter(newFormulas),
+                 [&removedVariables](Formula const& formula) { return !formula.getExpression().containsVariable(removedVariables); });
+    std::vector<Label> newLabels;
+    std::copy_if(this->getLabels().begin(), this->getLabels().end(), std::back_inserter(newLabels),
+                 [&removedVariables](Label const& label) { return !label.getStatePredicateExpression().containsVariable(removedVariables); });
+    std::vector<RewardModel> newRewardModels;
+    for (auto const& rewardModel : this->getRewardModels()) {
+        std::set<storm::expressions::Variable> rewardVariables;
+        gatherRewardModelVariables(rewardModel, rewardVariables);
+        if (std::none_of(rewardVariables.begin(), rewardVariables.end(),
+                         [&removedVariables](storm::expressions::Variable const& variable) { return removedVariables.count(variable) > 0; })) {
+            newRewardModels.push_back(rewardModel);
+        }
+    }
+
+    return Program(this->manager, this->getModelType(), this->getConstants(), newBooleanVariables, newIntegerVariables, newFormulas, this->getPlayers(),
+                   newModules, this->getActionNameToIndexMapping(), newRewardModels, newLabels, this->getObservationLabels(),
+                   this->getOptionalInitialConstruct(), this->getOptionalSystemCompositionConstruct(), prismCompatibility, this->getFilename(),
+                   this->getLineNumber());
+}
+
+Program Program::restrictToConeOfInfluence(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) const {
+    std::set<storm::expressions::Variable> relevantVariables;
+    std::vector<std::shared_ptr<storm::logic::AtomicLabelFormula const>> atomicLabelFormulas;
+    std::set<std::string> referencedRewardModels;
+    for (auto const& formula : formulas) {
+        formula->gatherUsedVariables(relevantVariables);
+        formula->gatherAtomicLabelFormulas(atomicLabelFormulas);
+        formula->gatherReferencedRewardModels(referencedRewardModels);
+    }
+    for (auto const& atomicLabelFormula : atomicLabelFormulas) {
+        if (this->hasLabel(atomicLabelFormula->getLabel())) {
+            insertVariables(relevantVariables, this->getLabelExpression(atomicLabelFormula->getLabel()));
+        }
+    }
+    for (auto const& rewardModel : this->getRewardModels()) {
+        // The empty name refers to the default reward model.
+        if (referencedRewardModels.count(rewardModel.getName()) > 0 || referencedRewardModels.count("") > 0) {
+            gatherRewardModelVariables(rewardModel, relevantVariables);
+        }
+    }
+    return restrictToConeOfInfluence(relevantVariables);
+}
+
 Program Program::replaceVariableInitializationByInitExpression() const {
     std::vector<BooleanVariable> newBooleanVariables = globalBooleanVariables;
     for (auto& newVar : newBooleanVariables) {
@@ -28,6 +28,10 @@ class Model;
 class Property;
 }  // namespace jani
 
+namespace logic {
+class Formula;
+}
+
 namespace prism {
 class Program : public LocatedInformation {
    public:
@@ -736,6 +740,27 @@ class Program : public LocatedInformation {
      */
     Program labelUnlabelledCommands(std::map<uint64_t, std::string> const& nameSuggestions = {}) const;
 
+    /*!
+     * Removes all variables that can not influence the values of the given variables (cone of influence). The guards of all commands are preserved,
+     * i.e., each command is enabled in the same (projected) states as before. Assignments to removed variables are dropped and commands of discrete
+     * time models that only assign removed variables are collapsed to a single update. Formulas, labels and reward models that refer to removed
+     * variables are dropped. Finally, modules without variables whose commands are all synchronizing, always enabled and without effect are removed
+     * (unless the program specifies a system composition).
+     *
+     * @param relevantVariables The variables whose behavior needs to be preserved.
+     * @return The restricted program.
+     */
+    Program restrictToConeOfInfluence(std::set<storm::expressions::Variable> const& relevantVariables) const;
+
+    /*!
+     * Restricts the program to the cone of influence of the variables that appear in the given formulas, in the labels they refer to and in the
+     * reward models they refer to.
+     *
+     * @param formulas The formulas that need to be preserved.
+     * @return The restricted program.
+     */
+    Program restrictToConeOfInfluence(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) const;
+
     friend std::ostream& operator<<(std::ostream& stream, Program const& program);
 
     /*!
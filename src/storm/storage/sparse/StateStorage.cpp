@@ -5,7 +5,8 @@ namespace storage {
 namespace sparse {
 
 template<typename StateType>
-StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), bitsPerState(bitsPerState) {
+StateStorage<StateType>::StateStorage(uint64_t bitsPerState, bool treeCompression)
+    : stateToId(bitsPerState, 100000, 0.75, treeCompression), bitsPerState(bitsPerState) {
     // Intentionally left empty.
 }
 
@@ -11,11 +11,13 @@ namespace sparse {
 // A structure holding information about the reachable state space while building it.
 template<typename StateType>
 struct StateStorage {
-    // Creates an empty state storage structure for storing states of the given bit width.
-    StateStorage(uint64_t bitsPerState);
+    // Creates an empty state storage structure for storing states of the given bit width. If tree compression is enabled, the states are
+    // stored tree-compressed (see BitVectorTreeCompressor).
+    StateStorage(uint64_t bitsPerState, bool treeCompression = false);
 
-    // This member stores all the states and maps them to their unique indices.
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    // This member stores all the states and maps them to their unique indices. States are hashed with a Zobrist-style hash, so generators can
+    // compute the hashes of successor states incrementally.
+    storm::storage::BitVectorHashMap<StateType, storm::storage::ZobristBitVectorHash> stateToId;
 
     // A list of initial states in terms of their global indices.
     std::vector<StateType> initialStateIndices;
@@ -1,10 +1,12 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/adapters/JsonAdapter.h"
 
-#include "storm/adapters/RationalNumberForward.h"
+#include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/storage/BitVector.h"
 
@@ -16,19 +18,76 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+namespace {
+// Maps signed to unsigned integers (and back) such that the order is preserved.
+uint64_t toOrderedUnsigned(int64_t value) {
+    return static_cast<uint64_t>(value) ^ (1ull << 63);
+}
+
+int64_t fromOrderedUnsigned(uint64_t value) {
+    return static_cast<int64_t>(value ^ (1ull << 63));
+}
+
+// Retrieves the number of bits (at least one) that are needed to encode values in the range [0, range].
+uint64_t getRequiredBitWidth(uint64_t range) {
+    uint64_t bitWidth = 1;
+    while (bitWidth < 64 && (range >> bitWidth) > 0) {
+        ++bitWidth;
+    }
+    return bitWidth;
+}
+}  // namespace
+
+StateValuations::IntegerColumn::IntegerColumn(int64_t lowerBound, int64_t upperBound)
+    : offset(lowerBound), bitWidth(getRequiredBitWidth(toOrderedUnsigned(upperBound) - toOrderedUnsigned(lowerBound))) {
+    STORM_LOG_ASSERT(lowerBound <= upperBound, "Invalid bounds.");
+}
+
+int64_t StateValuations::IntegerColumn::get(uint64_t state) const {
+    return fromOrderedUnsigned(toOrderedUnsigned(offset) + bits.getAsInt(state * bitWidth, bitWidth));
+}
+
+void StateValuations::IntegerColumn::set(uint64_t state, int64_t value) {
+    STORM_LOG_ASSERT((state + 1) * bitWidth <= bits.size(), "The column has not been grown to the given state.");
+    uint64_t lower = toOrderedUnsigned(offset);
+    uint64_t orderedValue = toOrderedUnsigned(value);
+    if (bitWidth < 64 && (orderedValue < lower || ((orderedValue - lower) >> bitWidth) > 0)) {
+        // The value does not fit, so we (at least) double the range of the encoding to keep the number of re-encodings small.
+        uint64_t encodingMaximum = (1ull << bitWidth) - 1;
+        uint64_t upper = lower + std::min(encodingMaximum, ~0ull - lower);
+        uint64_t newLower = std::min(lower, orderedValue);
+        uint64_t newUpper = std::max(upper, orderedValue);
+        uint64_t newBitWidth = std::max(bitWidth + 1, getRequiredBitWidth(newUpper - newLower));
+        if (newBitWidth == 64) {
+            newLower = 0;
+        } else if (orderedValue < lower) {
+            // Leave room for even smaller values.
+            uint64_t newEncodingMaximum = (1ull << newBitWidth) - 1;
+            newLower = newUpper >= newEncodingMaximum ? newUpper - newEncodingMaximum : 0;
+        }
+
+        uint64_t numberOfStates = bits.size() / bitWidth;
+        storm::storage::BitVector newBits(numberOfStates * newBitWidth);
+        for (uint64_t otherState = 0; otherState < numberOfStates; ++otherState) {
+            newBits.setFromInt(otherState * newBitWidth, newBitWidth, toOrderedUnsigned(get(otherState)) - newLower);
+        }
+        bits = std::move(newBits);
+        offset = fromOrderedUnsigned(newLower);
+        bitWidth = newBitWidth;
+    }
+    bits.setFromInt(state * bitWidth, bitWidth, orderedValue - toOrderedUnsigned(offset));
+}
+
+void StateValuations::IntegerColumn::grow(uint64_t numberOfStates) {
+    bits.grow(numberOfStates * bitWidth);
+}
+
+void StateValuations::IntegerColumn::clear() {
+    bits = storm::storage::BitVector();
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+uint64_t StateValuations::IntegerColumn::getBitWidth() const {
+    return bitWidth;
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,14 +95,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                                                        storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      valuations(valuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -83,28 +144,28 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return valuations->booleanColumns[variableIt->second].get(state) != 0;
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return valuations->integerColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    STORM_LOG_ASSERT(labelIt->second < valuations->observationLabelColumns.size(),
+                     "Label index " << labelIt->second << " larger than number of labels " << valuations->observationLabelColumns.size());
+    return valuations->observationLabelColumns[labelIt->second].get(state);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return valuations->rationalColumns[variableIt->second][state];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -131,42 +192,42 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations, state);
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return booleanColumns[variableToIndexMap.at(booleanVariable)].get(stateIndex) != 0;
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(!isEmpty(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return stateIndex >= statesWithValuation.size() || !statesWithValuation.get(stateIndex) || (variableToIndexMap.empty() && observationLabels.empty());
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -257,43 +318,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,11 +325,32 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
+}
+
+std::vector<storm::expressions::Variable> StateValuations::getVariables() const {
+    std::vector<storm::expressions::Variable> result;
+    result.reserve(variableToIndexMap.size());
+    for (auto const& variableIndexPair : variableToIndexMap) {
+        result.push_back(variableIndexPair.first);
+    }
+    return result;
+}
+
+void StateValuations::getIntegerValues(storm::expressions::Variable const& variable, std::vector<uint64_t> const& states,
+                                       std::vector<int64_t>& values) const {
+    STORM_LOG_ASSERT(variableToIndexMap.count(variable) > 0, "Variable " << variable.getName() << " is not part of this valuation.");
+    STORM_LOG_THROW(variable.hasBooleanType() || variable.hasIntegerType(), storm::exceptions::InvalidTypeException,
+                    "Variable " << variable.getName() << " is neither a boolean nor an integer variable.");
+    IntegerColumn const& column = variable.hasBooleanType() ? booleanColumns[variableToIndexMap.at(variable)] : integerColumns[variableToIndexMap.at(variable)];
+    values.resize(states.size());
+    for (uint64_t i = 0; i < states.size(); ++i) {
+        values[i] = isEmpty(states[i]) ? 0 : column.get(states[i]);
+    }
 }
 
 std::size_t StateValuations::hash() const {
@@ -313,28 +358,79 @@ std::size_t StateValuations::hash() const {
 }
 
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    return selectStatesByIndices(std::vector<uint64_t>(selectedStates.begin(), selectedStates.end()));
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
-    for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
-        } else {
-            selectedValuations.emplace_back();
+    return selectStatesByIndices(std::vector<uint64_t>(selectedStates.begin(), selectedStates.end()));
+}
+
+StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
+    STORM_LOG_ASSERT(std::all_of(mapNewToOld.begin(), mapNewToOld.end(), [this](uint64_t oldState) { return oldState < getNumberOfStates(); }),
+                     "Invalid state index.");
+    return selectStatesByIndices(mapNewToOld);
+}
+
+StateValuations StateValuations::selectStatesByIndices(std::vector<uint64_t> const& selectedStates) const {
+    StateValuations result;
+    result.variableToIndexMap = variableToIndexMap;
+    result.observationLabels = observationLabels;
+    // Columns are copied (without values) such that their encoding is kept.
+    auto createEmptyColumns = [](std::vector<IntegerColumn> const& columns) {
+        std::vector<IntegerColumn> emptyColumns(columns);
+        for (auto& column : emptyColumns) {
+            column.clear();
+        }
+        return emptyColumns;
+    };
+    result.booleanColumns = createEmptyColumns(booleanColumns);
+    result.integerColumns = createEmptyColumns(integerColumns);
+    result.observationLabelColumns = createEmptyColumns(observationLabelColumns);
+    result.rationalColumns.resize(rationalColumns.size());
+    result.resize(selectedStates.size());
+    for (uint64_t newState = 0; newState < selectedStates.size(); ++newState) {
+        if (!isEmpty(selectedStates[newState])) {
+            result.copyValuation(newState, *this, selectedStates[newState]);
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return result;
 }
 
-StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
+void StateValuations::resize(uint64_t newNumberOfStates) {
+    if (newNumberOfStates <= numberOfStates) {
+        return;
+    }
+    for (auto& column : booleanColumns) {
+        column.grow(newNumberOfStates);
+    }
+    for (auto& column : integerColumns) {
+        column.grow(newNumberOfStates);
+    }
+    for (auto& column : observationLabelColumns) {
+        column.grow(newNumberOfStates);
     }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    for (auto& column : rationalColumns) {
+        column.resize(newNumberOfStates);
+    }
+    statesWithValuation.grow(newNumberOfStates);
+    numberOfStates = newNumberOfStates;
+}
+
+void StateValuations::copyValuation(uint64_t state, StateValuations const& other, uint64_t otherState) {
+    STORM_LOG_ASSERT(state < numberOfStates, "Invalid state index.");
+    for (uint64_t index = 0; index < booleanColumns.size(); ++index) {
+        booleanColumns[index].set(state, other.booleanColumns[index].get(otherState));
+    }
+    for (uint64_t index = 0; index < integerColumns.size(); ++index) {
+        integerColumns[index].set(state, other.integerColumns[index].get(otherState));
+    }
+    for (uint64_t index = 0; index < rationalColumns.size(); ++index) {
+        rationalColumns[index][state] = other.rationalColumns[index][otherState];
+    }
+    for (uint64_t index = 0; index < observationLabelColumns.size(); ++index) {
+        observationLabelColumns[index].set(state, other.observationLabelColumns[index].get(otherState));
+    }
+    statesWithValuation.set(state);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -342,21 +438,30 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    addVariable(variable, 0, 1);
+}
+
+void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+        currentStateValuations.booleanColumns.emplace_back(0, 1);
     }
     if (variable.hasIntegerType()) {
         currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+        currentStateValuations.integerColumns.emplace_back(lowerBound, upperBound);
     }
     if (variable.hasRationalType()) {
         currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+        currentStateValuations.rationalColumns.emplace_back();
     }
 }
 
 void StateValuationsBuilder::addObservationLabel(const std::string& label) {
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add an observation label, although a state has already been added before.");
     currentStateValuations.observationLabels[label] = labelCount++;
+    currentStateValuations.observationLabelColumns.emplace_back();
 }
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues,
@@ -366,17 +471,24 @@ void StateValuationsBuilder::addState(storm::storage::sparse::state_type const&
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount &&
+                         observationLabelValues.size() == labelCount,
+                     "The number of given values does not match the number of added variables.");
+    currentStateValuations.resize(state + 1);
+    STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
+    for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+        currentStateValuations.booleanColumns[index].set(state, booleanValues[index] ? 1 : 0);
     }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
-    } else {
-        STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    for (uint64_t index = 0; index < integerValues.size(); ++index) {
+        currentStateValuations.integerColumns[index].set(state, integerValues[index]);
     }
+    for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+        currentStateValuations.rationalColumns[index][state] = std::move(rationalValues[index]);
+    }
+    for (uint64_t index = 0; index < observationLabelValues.size(); ++index) {
+        currentStateValuations.observationLabelColumns[index].set(state, observationLabelValues[index]);
+    }
+    currentStateValuations.statesWithValuation.set(state);
 }
 
 uint64_t StateValuationsBuilder::getBooleanVarCount() const {
@@ -396,7 +508,9 @@ StateValuations StateValuationsBuilder::build() {
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
-    return std::move(currentStateValuations);
+    StateValuations result = std::move(currentStateValuations);
+    currentStateValuations = StateValuations();
+    return result;
 }
 
 template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const&,
@@ -22,20 +22,6 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +29,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,20 +60,22 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* valuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     StateValuations() = default;
@@ -95,7 +84,7 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
@@ -122,6 +111,18 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     // Returns the (current) number of states that this object describes.
     uint_fast64_t getNumberOfStates() const;
 
+    /*!
+     * Retrieves the variables of these valuations in the order in which they appear in the valuation of a state.
+     */
+    std::vector<storm::expressions::Variable> getVariables() const;
+
+    /*!
+     * Retrieves the values of the given boolean or integer variable for the given states, where booleans are represented by 0 and 1.
+     * As the underlying column is accessed directly, this is considerably faster than retrieving the values state by state.
+     * States without a valuation get the value 0.
+     */
+    void getIntegerValues(storm::expressions::Variable const& variable, std::vector<uint64_t> const& states, std::vector<int64_t>& values) const;
+
     /*
      * Derive new state valuations from this by selecting the given states.
      */
@@ -138,14 +139,72 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    /*!
+     * The values of one integer (or boolean) variable for all states. Each value is stored relative to an offset with a fixed number of bits. If a
+     * value does not fit into this encoding, the encoding of the whole column is widened.
+     */
+    class IntegerColumn {
+       public:
+        /*!
+         * Creates an empty column whose encoding initially covers the given range of values.
+         */
+        IntegerColumn(int64_t lowerBound = 0, int64_t upperBound = 1);
+
+        int64_t get(uint64_t state) const;
+
+        /*!
+         * Sets the value of the given state, which has to be smaller than the number of states the column was grown to.
+         */
+        void set(uint64_t state, int64_t value);
+
+        /*!
+         * Ensures that the column can store values for (at least) the given number of states.
+         */
+        void grow(uint64_t numberOfStates);
+
+        /*!
+         * Removes all values but keeps the encoding.
+         */
+        void clear();
+
+        /*!
+         * Retrieves the number of bits used per state.
+         */
+        uint64_t getBitWidth() const;
+
+       private:
+        int64_t offset;
+        uint64_t bitWidth;
+        storm::storage::BitVector bits;
+    };
+
+    /*!
+     * Derives new state valuations from this by selecting the given states. States that are out of range get an empty valuation.
+     */
+    StateValuations selectStatesByIndices(std::vector<uint64_t> const& selectedStates) const;
+
+    /*!
+     * Ensures that there is storage for (at least) the given number of states. Added states have an empty valuation.
+     */
+    void resize(uint64_t newNumberOfStates);
+
+    /*!
+     * Copies the valuation of the given state of the other valuations (over the same variables) to the given state.
+     */
+    void copyValuation(uint64_t state, StateValuations const& other, uint64_t otherState);
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+
+    // The values of the variables and labels in columnar form, i.e. one column per variable (or label), indexed by the value index of the variable.
+    std::vector<IntegerColumn> booleanColumns;
+    std::vector<IntegerColumn> integerColumns;
+    std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+    std::vector<IntegerColumn> observationLabelColumns;
+
+    // The number of states and the states that have a valuation. The latter may be larger than the number of states.
+    uint64_t numberOfStates = 0;
+    storm::storage::BitVector statesWithValuation;
 };
 
 class StateValuationsBuilder {
@@ -157,6 +216,12 @@ class StateValuationsBuilder {
      */
     void addVariable(storm::expressions::Variable const& variable);
 
+    /*! Adds a new integer variable whose values are expected to be within the given bounds. This is only used to choose an initial encoding of
+     * its values, i.e. values outside of the bounds can still be added.
+     * All variables need to be added before adding new states.
+     */
+    void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+
     void addObservationLabel(std::string const& label);
 
     /*!
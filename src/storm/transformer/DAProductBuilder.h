@@ -38,9 +38,22 @@ class DAProductBuilder {
         return da.getSuccessor(automatonFrom, getLabelForState(modelTo));
     }
 
+    /*!
+     * Sets the automaton states whose outcome is already decided, e.g., because no accepting run starts in them.
+     * The successors of product states with such an automaton state are not explored. Instead, these product states get a self-loop.
+     */
+    void setAbsorbingStates(storm::storage::BitVector const& absorbingAutomatonStates) {
+        absorbingStates = absorbingAutomatonStates;
+    }
+
+    bool isAbsorbing(storm::storage::sparse::state_type automatonState) const {
+        return absorbingStates.size() > automatonState && absorbingStates.get(automatonState);
+    }
+
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    storm::storage::BitVector absorbingStates;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
         storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
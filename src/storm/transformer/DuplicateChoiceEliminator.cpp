@@ -0,0 +1,121 @@
+#include "storm/transformer/DuplicateChoiceEliminator.h"
+
+#include <algorithm>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/transformer/ChoiceSelector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace transformer {
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType, RewardModelType>> DuplicateChoiceEliminator<ValueType, RewardModelType>::transform(
+    storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp) {
+    std::vector<uint64_t> representatives = computeRepresentatives(mdp);
+    storm::storage::BitVector keptChoices(representatives.size());
+    for (uint64_t choice = 0; choice < representatives.size(); ++choice) {
+        if (representatives[choice] == choice) {
+            keptChoices.set(choice);
+        }
+    }
+    STORM_LOG_INFO("Removing " << keptChoices.getNumberOfUnsetBits() << " of " << keptChoices.size() << " choices that duplicate another choice.");
+
+    auto result = ChoiceSelector<ValueType, RewardModelType>(mdp).transform(keptChoices)->template as<storm::models::sparse::Mdp<ValueType, RewardModelType>>();
+    if (result->hasChoiceLabeling() && !keptChoices.full()) {
+        // The kept choice represents all removed choices, so it gets their labels as well.
+        auto& choiceLabeling = result->getOptionalChoiceLabeling().value();
+        std::vector<uint64_t> newChoiceIndices = keptChoices.getNumberOfSetBitsBeforeIndices();
+        for (auto choice : ~keptChoices) {
+            uint64_t const newChoice = newChoiceIndices[representatives[choice]];
+            for (auto const& label : mdp.getChoiceLabeling().getLabelsOfChoice(choice)) {
+                if (!choiceLabeling.getChoiceHasLabel(label, newChoice)) {
+                    choiceLabeling.addLabelToChoice(label, newChoice);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<uint64_t> DuplicateChoiceEliminator<ValueType, RewardModelType>::computeRepresentatives(
+    storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp) {
+    auto const& rowGroupIndices = mdp.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint64_t> representatives(mdp.getNumberOfChoices());
+    // Holds the hash and the index of each choice of the current state.
+    std::vector<std::pair<std::size_t, uint64_t>> hashedChoices;
+    for (uint64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
+        hashedChoices.clear();
+        for (uint64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+            representatives[choice] = choice;
+            hashedChoices.emplace_back(hashChoice(mdp, choice), choice);
+        }
+        if (hashedChoices.size() < 2) {
+            continue;
+        }
+        // After sorting, choices with the same hash are adjacent and ordered by their index. Hence, the representative is the first choice of the range.
+        std::sort(hashedChoices.begin(), hashedChoices.end());
+        for (auto rangeBegin = hashedChoices.begin(); rangeBegin != hashedChoices.end();) {
+            auto rangeEnd = std::find_if(rangeBegin, hashedChoices.end(), [&rangeBegin](auto const& entry) { return entry.first != rangeBegin->first; });
+            for (auto choiceIt = rangeBegin + 1; choiceIt != rangeEnd; ++choiceIt) {
+                // Hash collisions are resolved by comparing with all previous choices of the range that are kept.
+                for (auto candidateIt = rangeBegin; candidateIt != choiceIt; ++candidateIt) {
+                    if (representatives[candidateIt->second] == candidateIt->second && choicesAreEqual(mdp, candidateIt->second, choiceIt->second)) {
+                        representatives[choiceIt->second] = candidateIt->second;
+                        break;
+                    }
+                }
+            }
+            rangeBegin = rangeEnd;
+        }
+    }
+    return representatives;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::size_t DuplicateChoiceEliminator<ValueType, RewardModelType>::hashChoice(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp,
+                                                                              uint64_t choice) {
+    auto const row = mdp.getTransitionMatrix().getRow(choice);
+    std::size_t result = boost::hash_range(row.begin(), row.end());
+    for (auto const& rewardModel : mdp.getRewardModels()) {
+        if (rewardModel.second.hasStateActionRewards()) {
+            boost::hash_combine(result, rewardModel.second.getStateActionReward(choice));
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            auto const rewardRow = rewardModel.second.getTransitionRewardMatrix().getRow(choice);
+            boost::hash_combine(result, boost::hash_range(rewardRow.begin(), rewardRow.end()));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType>
+bool DuplicateChoiceEliminator<ValueType, RewardModelType>::choicesAreEqual(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp,
+                                                                            uint64_t choice1, uint64_t choice2) {
+    auto const& matrix = mdp.getTransitionMatrix();
+    if (!std::equal(matrix.begin(choice1), matrix.end(choice1), matrix.begin(choice2), matrix.end(choice2))) {
+        return false;
+    }
+    for (auto const& rewardModel : mdp.getRewardModels()) {
+        if (rewardModel.second.hasStateActionRewards() &&
+            rewardModel.second.getStateActionReward(choice1) != rewardModel.second.getStateActionReward(choice2)) {
+            return false;
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            auto const& rewardMatrix = rewardModel.second.getTransitionRewardMatrix();
+            if (!std::equal(rewardMatrix.begin(choice1), rewardMatrix.end(choice1), rewardMatrix.begin(choice2), rewardMatrix.end(choice2))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template class DuplicateChoiceEliminator<double>;
+template class DuplicateChoiceEliminator<storm::RationalNumber>;
+
+}  // namespace transformer
+}  // namespace storm
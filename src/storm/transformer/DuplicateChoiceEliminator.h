@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Removes choices of an MDP that are identical to another choice of the same state, i.e., that have the same distribution and the same rewards in
+ * every reward model. Such choices often stem from commands that only differ in their action labels.
+ * Of each set of identical choices, the first one is kept. It inherits the choice labels of the removed choices; choice origins and state valuations
+ * are kept such that schedulers of the resulting MDP can still be exported.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+class DuplicateChoiceEliminator {
+   public:
+    /*!
+     * @return The MDP without duplicate choices. If there are no duplicate choices, a copy of the given MDP is returned.
+     */
+    static std::shared_ptr<storm::models::sparse::Mdp<ValueType, RewardModelType>> transform(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp);
+
+    /*!
+     * Computes for each choice the first choice of the same state that has the same distribution and rewards.
+     * @return A vector that maps each choice to its representative. Choices that are kept are their own representative.
+     */
+    static std::vector<uint64_t> computeRepresentatives(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp);
+
+   private:
+    static std::size_t hashChoice(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp, uint64_t choice);
+    static bool choicesAreEqual(storm::models::sparse::Mdp<ValueType, RewardModelType> const& mdp, uint64_t choice1, uint64_t choice2);
+};
+
+}  // namespace transformer
+}  // namespace storm
@@ -0,0 +1,194 @@
+#include "storm/transformer/EndComponentEliminator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+namespace transformer {
+
+namespace detail {
+/*!
+ * Appends the entries in [begin, end) to the given buffer, redirecting their columns to the states of the resulting matrix.
+ * Entries leading to a state that does not exist in the result are dropped and entries leading to the same state are merged.
+ */
+template<typename EntryIterator, typename EntryType>
+void appendRedirectedRow(EntryIterator begin, EntryIterator end, std::vector<uint_fast64_t> const& oldToNewStateMapping, uint_fast64_t numRowGroups,
+                         std::vector<EntryType>& buffer) {
+    auto const rowStart = buffer.size();
+    for (auto entryIt = begin; entryIt != end; ++entryIt) {
+        uint_fast64_t newColumn = oldToNewStateMapping[entryIt->getColumn()];
+        if (newColumn < numRowGroups) {
+            buffer.emplace_back(newColumn, entryIt->getValue());
+        }
+    }
+    // The kept states remain ordered but the states that substitute ECs may appear in any order.
+    // Sorting stably makes sure that merged values are summed up in the order in which they appear in the original row.
+    auto const compareColumns = [](EntryType const& lhs, EntryType const& rhs) { return lhs.getColumn() < rhs.getColumn(); };
+    if (!std::is_sorted(buffer.begin() + rowStart, buffer.end(), compareColumns)) {
+        std::stable_sort(buffer.begin() + rowStart, buffer.end(), compareColumns);
+    }
+    auto writeIt = buffer.begin() + rowStart;
+    for (auto readIt = writeIt; readIt != buffer.end(); ++readIt) {
+        if (writeIt != buffer.begin() + rowStart && std::prev(writeIt)->getColumn() == readIt->getColumn()) {
+            std::prev(writeIt)->setValue(std::prev(writeIt)->getValue() + readIt->getValue());
+        } else {
+            if (writeIt != readIt) {
+                *writeIt = std::move(*readIt);
+            }
+            ++writeIt;
+        }
+    }
+    buffer.erase(writeIt, buffer.end());
+}
+}  // namespace detail
+
+template<typename ValueType>
+typename EndComponentEliminator<ValueType>::EndComponentEliminatorReturnType EndComponentEliminator<ValueType>::transform(
+    storm::storage::SparseMatrix<ValueType>&& originalMatrix, storm::storage::MaximalEndComponentDecomposition<ValueType> const& ecs,
+    storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& addSinkRowStates, bool addSelfLoopAtSinkStates) {
+    using IndexType = typename storm::storage::SparseMatrix<ValueType>::index_type;
+    using EntryType = storm::storage::MatrixEntry<IndexType, ValueType>;
+
+    // further shrink the set of kept states by removing all states that are part of an EC
+    storm::storage::BitVector keptStates = subsystemStates;
+    for (auto const& ec : ecs) {
+        for (auto const& stateActionsPair : ec) {
+            keptStates.set(stateActionsPair.first, false);
+        }
+    }
+    STORM_LOG_DEBUG("Found " << ecs.size() << " end components to eliminate. Keeping " << keptStates.getNumberOfSetBits() << " of " << keptStates.size()
+                             << " original states plus " << ecs.size() << "new end component states.");
+
+    EndComponentEliminatorReturnType result;
+    std::vector<IndexType> newRowGroupIndices;
+    result.oldToNewStateMapping = std::vector<uint_fast64_t>(originalMatrix.getRowGroupCount(), std::numeric_limits<uint_fast64_t>::max());
+    result.sinkRows =
+        storm::storage::BitVector(originalMatrix.getRowCount(), false);  // will be resized as soon as the rowCount of the resulting matrix is known
+
+    for (auto keptState : keptStates) {
+        result.oldToNewStateMapping[keptState] = newRowGroupIndices.size();  // i.e., the current number of processed states
+        newRowGroupIndices.push_back(result.newToOldRowMapping.size());      // i.e., the current number of processed rows
+        for (uint_fast64_t oldRow = originalMatrix.getRowGroupIndices()[keptState]; oldRow < originalMatrix.getRowGroupIndices()[keptState + 1]; ++oldRow) {
+            result.newToOldRowMapping.push_back(oldRow);
+        }
+    }
+    uint_fast64_t const numKeptStates = newRowGroupIndices.size();
+    uint_fast64_t const numKeptRows = result.newToOldRowMapping.size();
+    for (auto const& ec : ecs) {
+        newRowGroupIndices.push_back(result.newToOldRowMapping.size());
+        bool ecGetsSinkRow = false;
+        for (auto const& stateActionsPair : ec) {
+            result.oldToNewStateMapping[stateActionsPair.first] = newRowGroupIndices.size() - 1;
+            for (uint_fast64_t row = originalMatrix.getRowGroupIndices()[stateActionsPair.first];
+                 row < originalMatrix.getRowGroupIndices()[stateActionsPair.first + 1]; ++row) {
+                if (stateActionsPair.second.find(row) == stateActionsPair.second.end()) {
+                    result.newToOldRowMapping.push_back(row);
+                }
+            }
+            ecGetsSinkRow |= addSinkRowStates.get(stateActionsPair.first);
+        }
+        if (ecGetsSinkRow) {
+            STORM_LOG_ASSERT(result.newToOldRowMapping.size() < originalMatrix.getRowCount(),
+                             "Didn't expect to see more rows in the reduced matrix than in the original one.");
+            result.sinkRows.set(result.newToOldRowMapping.size(), true);
+            result.newToOldRowMapping.push_back(*ec.begin()->second.begin());
+        }
+    }
+    newRowGroupIndices.push_back(result.newToOldRowMapping.size());
+    result.sinkRows.resize(result.newToOldRowMapping.size());
+    uint_fast64_t const numRowGroups = newRowGroupIndices.size() - 1;
+    uint_fast64_t const numRows = result.newToOldRowMapping.size();
+
+    // From now on, we work directly on the storage of the original matrix.
+    auto [rowIndications, entries] = originalMatrix.releaseRowsAndEntries();
+
+    // The rows of the states that substitute ECs are collected first as their entries might be overwritten when compacting the rows of the kept states.
+    // Every EC writes to its own buffer and its own range of row sizes, so ECs can be processed independently.
+    std::vector<std::vector<EntryType>> ecEntries(ecs.size());
+    std::vector<IndexType> ecRowSizes(numRows - numKeptRows);
+    auto collectEcRows = [&](uint_fast64_t ecBegin, uint_fast64_t ecEnd) {
+        for (uint_fast64_t ecIndex = ecBegin; ecIndex < ecEnd; ++ecIndex) {
+            uint_fast64_t const newRowGroup = numKeptStates + ecIndex;
+            auto& buffer = ecEntries[ecIndex];
+            for (uint_fast64_t newRow = newRowGroupIndices[newRowGroup]; newRow < newRowGroupIndices[newRowGroup + 1]; ++newRow) {
+                uint_fast64_t const rowStart = buffer.size();
+                if (result.sinkRows.get(newRow)) {
+                    if (addSelfLoopAtSinkStates) {
+                        buffer.emplace_back(newRowGroup, storm::utility::one<ValueType>());
+                    }
+                } else {
+                    uint_fast64_t const oldRow = result.newToOldRowMapping[newRow];
+                    detail::appendRedirectedRow(entries.cbegin() + rowIndications[oldRow], entries.cbegin() + rowIndications[oldRow + 1],
+                                                result.oldToNewStateMapping, numRowGroups, buffer);
+                }
+                ecRowSizes[newRow - numKeptRows] = buffer.size() - rowStart;
+            }
+        }
+    };
+    bool collected = false;
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, ecs.size()),
+                              [&collectEcRows](tbb::blocked_range<uint_fast64_t> const& range) { collectEcRows(range.begin(), range.end()); });
+            collected = true;
+        }
+    }
+#endif
+    if (!collected) {
+        collectEcRows(0, ecs.size());
+    }
+
+    // Compact the rows of the kept states. These rows keep their relative order and never grow, so a row is only written to positions
+    // (of both, the entries and the row indications) that have already been read.
+    std::vector<EntryType> rowBuffer;
+    IndexType writePosition = 0;
+    for (uint_fast64_t newRow = 0; newRow < numKeptRows; ++newRow) {
+        uint_fast64_t const oldRow = result.newToOldRowMapping[newRow];
+        STORM_LOG_ASSERT(oldRow >= newRow, "Unexpected order of kept rows.");
+        rowBuffer.clear();
+        detail::appendRedirectedRow(entries.cbegin() + rowIndications[oldRow], entries.cbegin() + rowIndications[oldRow + 1], result.oldToNewStateMapping,
+                                    numRowGroups, rowBuffer);
+        rowIndications[newRow] = writePosition;
+        std::move(rowBuffer.begin(), rowBuffer.end(), entries.begin() + writePosition);
+        writePosition += rowBuffer.size();
+    }
+
+    // Append the rows of the states that substitute ECs.
+    rowIndications.resize(numRows + 1);
+    for (uint_fast64_t newRow = numKeptRows; newRow < numRows; ++newRow) {
+        rowIndications[newRow] = writePosition;
+        writePosition += ecRowSizes[newRow - numKeptRows];
+    }
+    rowIndications[numRows] = writePosition;
+    // Sink rows with a selfloop replace a row within the EC, so the entries never need more space than before. We resize anyway to be safe.
+    if (entries.size() < writePosition) {
+        entries.resize(writePosition);
+    }
+    auto entryIt = entries.begin() + rowIndications[numKeptRows];
+    for (auto& buffer : ecEntries) {
+        entryIt = std::move(buffer.begin(), buffer.end(), entryIt);
+        std::vector<EntryType>().swap(buffer);
+    }
+    entries.resize(writePosition);
+
+    result.matrix = storm::storage::SparseMatrix<ValueType>(numRowGroups, std::move(rowIndications), std::move(entries),
+                                                            boost::optional<std::vector<IndexType>>(std::move(newRowGroupIndices)));
+    STORM_LOG_DEBUG("EndComponentEliminator is done. Resulting matrix has " << result.matrix.getRowGroupCount() << " row groups.");
+    return result;
+}
+
+template class EndComponentEliminator<double>;
+template class EndComponentEliminator<storm::RationalNumber>;
+template class EndComponentEliminator<storm::RationalFunction>;
+template class EndComponentEliminator<storm::Interval>;
+
+}  // namespace transformer
+}  // namespace storm
@@ -41,61 +41,22 @@ class EndComponentEliminator {
      * forever). If addSelfLoopAtSinkStates is true, such rows get a selfloop (with value 1). Otherwise, the row remains empty.
      */
     static EndComponentEliminatorReturnType transform(storm::storage::SparseMatrix<ValueType> const& originalMatrix,
-                                                      storm::storage::MaximalEndComponentDecomposition<ValueType> ecs,
+                                                      storm::storage::MaximalEndComponentDecomposition<ValueType> const& ecs,
                                                       storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& addSinkRowStates,
                                                       bool addSelfLoopAtSinkStates = false) {
-        // further shrink the set of kept states by removing all states that are part of an EC
-        storm::storage::BitVector keptStates = subsystemStates;
-        for (auto const& ec : ecs) {
-            for (auto const& stateActionsPair : ec) {
-                keptStates.set(stateActionsPair.first, false);
-            }
-        }
-        STORM_LOG_DEBUG("Found " << ecs.size() << " end components to eliminate. Keeping " << keptStates.getNumberOfSetBits() << " of " << keptStates.size()
-                                 << " original states plus " << ecs.size() << "new end component states.");
-
-        EndComponentEliminatorReturnType result;
-        std::vector<uint_fast64_t> newRowGroupIndices;
-        result.oldToNewStateMapping = std::vector<uint_fast64_t>(originalMatrix.getRowGroupCount(), std::numeric_limits<uint_fast64_t>::max());
-        result.sinkRows =
-            storm::storage::BitVector(originalMatrix.getRowCount(), false);  // will be resized as soon as the rowCount of the resulting matrix is known
-
-        for (auto keptState : keptStates) {
-            result.oldToNewStateMapping[keptState] = newRowGroupIndices.size();  // i.e., the current number of processed states
-            newRowGroupIndices.push_back(result.newToOldRowMapping.size());      // i.e., the current number of processed rows
-            for (uint_fast64_t oldRow = originalMatrix.getRowGroupIndices()[keptState]; oldRow < originalMatrix.getRowGroupIndices()[keptState + 1]; ++oldRow) {
-                result.newToOldRowMapping.push_back(oldRow);
-            }
-        }
-        for (auto const& ec : ecs) {
-            newRowGroupIndices.push_back(result.newToOldRowMapping.size());
-            bool ecGetsSinkRow = false;
-            for (auto const& stateActionsPair : ec) {
-                result.oldToNewStateMapping[stateActionsPair.first] = newRowGroupIndices.size() - 1;
-                for (uint_fast64_t row = originalMatrix.getRowGroupIndices()[stateActionsPair.first];
-                     row < originalMatrix.getRowGroupIndices()[stateActionsPair.first + 1]; ++row) {
-                    if (stateActionsPair.second.find(row) == stateActionsPair.second.end()) {
-                        result.newToOldRowMapping.push_back(row);
-                    }
-                }
-                ecGetsSinkRow |= addSinkRowStates.get(stateActionsPair.first);
-            }
-            if (ecGetsSinkRow) {
-                STORM_LOG_ASSERT(result.newToOldRowMapping.size() < originalMatrix.getRowCount(),
-                                 "Didn't expect to see more rows in the reduced matrix than in the original one.");
-                result.sinkRows.set(result.newToOldRowMapping.size(), true);
-                result.newToOldRowMapping.push_back(*ec.begin()->second.begin());
-            }
-        }
-        newRowGroupIndices.push_back(result.newToOldRowMapping.size());
-        result.sinkRows.resize(result.newToOldRowMapping.size());
-
-        result.matrix = buildTransformedMatrix(originalMatrix, newRowGroupIndices, result.newToOldRowMapping, result.oldToNewStateMapping, result.sinkRows,
-                                               addSelfLoopAtSinkStates);
-        STORM_LOG_DEBUG("EndComponentEliminator is done. Resulting matrix has " << result.matrix.getRowGroupCount() << " row groups.");
-        return result;
+        return transform(storm::storage::SparseMatrix<ValueType>(originalMatrix), ecs, subsystemStates, addSinkRowStates, addSelfLoopAtSinkStates);
     }
 
+    /*
+     * Same as above, but the given matrix is collapsed in place, i.e., the storage of the given matrix is reused for the resulting matrix.
+     * This avoids holding both matrices in memory, so callers that do not need the original matrix afterwards should move it in.
+     * The rows of the states that substitute the ECs are computed in parallel if Intel TBB is enabled.
+     */
+    static EndComponentEliminatorReturnType transform(storm::storage::SparseMatrix<ValueType>&& originalMatrix,
+                                                      storm::storage::MaximalEndComponentDecomposition<ValueType> const& ecs,
+                                                      storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& addSinkRowStates,
+                                                      bool addSelfLoopAtSinkStates = false);
+
     /*
      * Identifies end components and substitutes them by a single state.
      *
@@ -122,6 +83,16 @@ class EndComponentEliminator {
         return transform(originalMatrix, ecs, subsystemStates, addSinkRowStates, addSelfLoopAtSinkStates);
     }
 
+    /*
+     * Same as above, but the given matrix is collapsed in place (see above).
+     */
+    static EndComponentEliminatorReturnType transform(storm::storage::SparseMatrix<ValueType>&& originalMatrix,
+                                                      storm::storage::BitVector const& subsystemStates, storm::storage::BitVector const& possibleECRows,
+                                                      storm::storage::BitVector const& addSinkRowStates, bool addSelfLoopAtSinkStates = false) {
+        storm::storage::MaximalEndComponentDecomposition<ValueType> ecs(originalMatrix, originalMatrix.transpose(true), subsystemStates, possibleECRows);
+        return transform(std::move(originalMatrix), ecs, subsystemStates, addSinkRowStates, addSelfLoopAtSinkStates);
+    }
+
    private:
     static storm::storage::MaximalEndComponentDecomposition<ValueType> computeECs(storm::storage::SparseMatrix<ValueType> const& originalMatrix,
                                                                                   storm::storage::BitVector const& possibleECRows,
@@ -165,45 +136,6 @@ class EndComponentEliminator {
                                                                             auxSubsystemStates, sinkStateAsBitVector));
         return storm::storage::MaximalEndComponentDecomposition<ValueType>(auxiliaryMatrix, backwardsTransitions, auxSubsystemStates);
     }
-
-    static storm::storage::SparseMatrix<ValueType> buildTransformedMatrix(storm::storage::SparseMatrix<ValueType> const& originalMatrix,
-                                                                          std::vector<uint_fast64_t> const& newRowGroupIndices,
-                                                                          std::vector<uint_fast64_t> const& newToOldRowMapping,
-                                                                          std::vector<uint_fast64_t> const& oldToNewStateMapping,
-                                                                          storm::storage::BitVector const& sinkRows, bool addSelfLoopAtSinkStates) {
-        uint_fast64_t numRowGroups = newRowGroupIndices.size() - 1;
-        uint_fast64_t newRow = 0;
-        storm::storage::SparseMatrixBuilder<ValueType> builder(newToOldRowMapping.size(), numRowGroups, originalMatrix.getEntryCount(), false, true,
-                                                               numRowGroups);
-        for (uint_fast64_t newRowGroup = 0; newRowGroup < numRowGroups; ++newRowGroup) {
-            builder.newRowGroup(newRow);
-            for (; newRow < newRowGroupIndices[newRowGroup + 1]; ++newRow) {
-                if (sinkRows.get(newRow)) {
-                    if (addSelfLoopAtSinkStates) {
-                        builder.addNextValue(newRow, newRowGroup, storm::utility::one<ValueType>());
-                    }
-                } else {
-                    // Make sure that the entries for this row are inserted in the right order.
-                    // Also, transitions to the same EC need to be merged and transitions to states that are erased need to be ignored
-                    std::map<uint_fast64_t, ValueType> sortedEntries;
-                    for (auto const& entry : originalMatrix.getRow(newToOldRowMapping[newRow])) {
-                        uint_fast64_t newColumn = oldToNewStateMapping[entry.getColumn()];
-                        if (newColumn < numRowGroups) {
-                            auto insertResult = sortedEntries.insert(std::make_pair(newColumn, entry.getValue()));
-                            if (!insertResult.second) {
-                                // We have already seen an entry with this column. ==> merge transitions
-                                insertResult.first->second += entry.getValue();
-                            }
-                        }
-                    }
-                    for (auto const& sortedEntry : sortedEntries) {
-                        builder.addNextValue(newRow, sortedEntry.first, sortedEntry.second);
-                    }
-                }
-            }
-        }
-        return builder.build(newToOldRowMapping.size(), numRowGroups, numRowGroups);
-    }
 };
 }  // namespace transformer
 }  // namespace storm
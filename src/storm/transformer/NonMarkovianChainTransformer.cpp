@@ -1,17 +1,23 @@
 #include "NonMarkovianChainTransformer.h"
 
+#include <atomic>
+#include <limits>
 #include <queue>
 
 #include <storm/solver/stateelimination/NondeterministicModelStateEliminator.h>
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidModelException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -19,9 +25,56 @@
 namespace storm {
 namespace transformer {
 
+namespace {
+
+template<typename MarkovAutomatonType>
+void warnAboutDroppedComponents(MarkovAutomatonType const& ma) {
+    // TODO: update reward models and choice labels according to kept states
+    STORM_LOG_WARN_COND(ma.getRewardModels().empty(), "Reward models are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma.hasChoiceLabeling(), "Choice labels are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma.hasStateValuations(), "State valuations are not preserved in chain elimination.");
+    STORM_LOG_WARN_COND(!ma.hasChoiceOrigins(), "Choice origins are not preserved in chain elimination.");
+}
+
+/*!
+ * Calls the given function for all indices in [0, size). The calls are made in parallel if possible for the given value type.
+ */
+template<typename ValueType, typename Function>
+void forEachIndex(uint64_t size, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    if constexpr (storm::NumberTraits<ValueType>::IsThreadSafe) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size), [&function](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                function(index);
+            }
+        });
+        return;
+    }
+#endif
+    for (uint64_t index = 0; index < size; ++index) {
+        function(index);
+    }
+}
+
+/*!
+ * A bijective hash of the given state which serves as its (pseudo-random but deterministic) priority when selecting independent states.
+ */
+uint64_t getPriority(uint64_t state) {
+    state = (state ^ (state >> 30)) * 0xbf58476d1ce4e5b9ull;
+    state = (state ^ (state >> 27)) * 0x94d049bb133111ebull;
+    return state ^ (state >> 31);
+}
+
+enum class StateStatus : uint8_t { Kept, Candidate, Selected, Eliminated };
+
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianChainTransformer<ValueType, RewardModelType>::eliminateNonmarkovianStates(
     std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> ma, EliminationLabelBehavior labelBehavior) {
+    if (storm::NumberTraits<ValueType>::IsThreadSafe && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+        return eliminateNonmarkovianStatesInParallel(ma, labelBehavior);
+    }
     STORM_LOG_THROW(ma->isClosed(), storm::exceptions::InvalidModelException, "MA should be closed first.");
 
     if (ma->getMarkovianStates().full()) {
@@ -36,12 +89,7 @@ std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianC
     storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(ma->getTransitionMatrix());
     storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(ma->getTransitionMatrix().transpose(), true);
     storm::models::sparse::StateLabeling stateLabeling = ma->getStateLabeling();
-    // TODO: update reward models and choice labels according to kept states
-    STORM_LOG_WARN_COND(ma->getRewardModels().empty(), "Reward models are not preserved in chain elimination.");
-    std::unordered_map<std::string, RewardModelType> rewardModels;
-    STORM_LOG_WARN_COND(!ma->hasChoiceLabeling(), "Choice labels are not preserved in chain elimination.");
-    STORM_LOG_WARN_COND(!ma->hasStateValuations(), "State valuations are not preserved in chain elimination.");
-    STORM_LOG_WARN_COND(!ma->hasChoiceOrigins(), "Choice origins are not preserved in chain elimination.");
+    warnAboutDroppedComponents(*ma);
 
     // Eliminate all probabilistic states by state elimination
     auto actionRewards = std::vector<ValueType>(ma->getTransitionMatrix().getRowCount(), storm::utility::zero<ValueType>());
@@ -137,13 +185,294 @@ std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianC
     // Create the new matrix
     auto keptRows = ma->getTransitionMatrix().getRowFilter(keepStates);
     storm::storage::SparseMatrix<ValueType> matrix = flexibleMatrix.createSparseMatrix(keptRows, keepStates);
+    return createTransformedModel(ma, std::move(matrix), keepStates, stateLabeling);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>>
+NonMarkovianChainTransformer<ValueType, RewardModelType>::eliminateNonmarkovianStatesInParallel(
+    std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> ma, EliminationLabelBehavior labelBehavior) {
+    typedef storm::storage::MatrixEntry<uint_fast64_t, ValueType> Entry;
+
+    STORM_LOG_THROW(ma->isClosed(), storm::exceptions::InvalidModelException, "MA should be closed first.");
+
+    if (ma->getMarkovianStates().full()) {
+        // Is already a CTMC
+        return ma->convertToCtmc();
+    }
+
+    STORM_LOG_WARN_COND(labelBehavior == EliminationLabelBehavior::KeepLabels || labelBehavior == EliminationLabelBehavior::ExtendLabels,
+                        "Labels are not preserved! Results may be incorrect. Continue at your own caution.");
+    storm::models::sparse::StateLabeling stateLabeling = ma->getStateLabeling();
+    warnAboutDroppedComponents(*ma);
+
+    // Initialize the CSR representation of the transition matrix. The row groups never change, eliminated states just get empty rows.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = ma->getTransitionMatrix();
+    uint64_t const numberOfStates = ma->getNumberOfStates();
+    uint64_t const numberOfRows = transitionMatrix.getRowCount();
+    std::vector<uint_fast64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    std::vector<uint64_t> rowIndications(numberOfRows + 1, 0);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        rowIndications[row + 1] = rowIndications[row] + transitionMatrix.getRow(row).getNumberOfEntries();
+    }
+    std::vector<Entry> entries(transitionMatrix.begin(), transitionMatrix.end());
+
+    // Only eliminate immediate states (and no Markovian states) without non-determinism
+    std::vector<StateStatus> status(numberOfStates, StateStatus::Kept);
+    std::vector<uint64_t> candidates;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        STORM_LOG_ASSERT(!ma->isHybridState(state), "State is hybrid.");
+        if (ma->isProbabilisticState(state) && ma->getNumberOfChoices(state) <= 1) {
+            STORM_LOG_ASSERT(ma->getNumberOfChoices(state) == 1, "State " << state << " has no choices.");
+            status[state] = StateStatus::Candidate;
+            candidates.push_back(state);
+        }
+    }
+
+    // The label criteria only read the labeling, so we obtain the labeled states once beforehand.
+    std::vector<storm::storage::BitVector const*> labeledStates;
+    for (auto const& label : stateLabeling.getLabels()) {
+        labeledStates.push_back(&stateLabeling.getStates(label));
+    }
+    auto satisfiesLabelCriterion = [&](uint64_t state, uint64_t successor) {
+        for (auto const* states : labeledStates) {
+            if (labelBehavior == EliminationLabelBehavior::KeepLabels ? states->get(state) != states->get(successor)
+                                                                         : states->get(state) && !states->get(successor)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    bool const checkLabels = labelBehavior == EliminationLabelBehavior::KeepLabels || labelBehavior == EliminationLabelBehavior::ExtendLabels;
+
+    std::vector<char> blocked(numberOfStates, 0);
+    std::vector<uint64_t> selected;
+    std::vector<uint64_t> selectedIndex(numberOfStates);
+    // For each row the index of its substituted row (or notSubstituted).
+    uint64_t const notSubstituted = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> substitutedRowIndex(numberOfRows);
+    uint64_t rounds = 0;
+    while (!candidates.empty()) {
+        ++rounds;
+        // Block every candidate with a candidate neighbor of smaller priority. The remaining candidates are independent and the candidate
+        // with the smallest priority is never blocked.
+        forEachIndex<ValueType>(candidates.size(), [&](uint64_t index) {
+            uint64_t const state = candidates[index];
+            uint64_t const row = rowGroupIndices[state];
+            for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                uint64_t const successor = entries[position].getColumn();
+                if (successor != state && status[successor] == StateStatus::Candidate) {
+                    uint64_t const blockedState = getPriority(successor) < getPriority(state) ? state : successor;
+                    std::atomic_ref<char>(blocked[blockedState]).store(1, std::memory_order_relaxed);
+                }
+            }
+        });
+
+        // Decide for all unblocked candidates whether they are eliminated. Blocked candidates are considered again in the next round.
+        forEachIndex<ValueType>(candidates.size(), [&](uint64_t index) {
+            uint64_t const state = candidates[index];
+            if (blocked[state]) {
+                blocked[state] = 0;
+                return;
+            }
+            uint64_t const row = rowGroupIndices[state];
+            bool onlySelfLoop = true;
+            bool eliminate = true;
+            for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                uint64_t const successor = entries[position].getColumn();
+                onlySelfLoop &= successor == state;
+                if (checkLabels && !satisfiesLabelCriterion(state, successor)) {
+                    STORM_LOG_TRACE("Do not eliminate state " << state << " because of the labels of state " << successor << ".");
+                    eliminate = false;
+                    break;
+                }
+            }
+            // A state that only has a self-loop can not be eliminated.
+            status[state] = eliminate && !onlySelfLoop ? StateStatus::Selected : StateStatus::Kept;
+        });
+
+        selected.clear();
+        std::vector<uint64_t> remainingCandidates;
+        for (uint64_t state : candidates) {
+            if (status[state] == StateStatus::Selected) {
+                selectedIndex[state] = selected.size();
+                selected.push_back(state);
+            } else if (status[state] == StateStatus::Candidate) {
+                remainingCandidates.push_back(state);
+            }
+        }
+        candidates = std::move(remainingCandidates);
+        if (selected.empty()) {
+            continue;
+        }
+
+        // Handle labels according to given behavior. As the selected states are independent, their successors are not eliminated in this round.
+        if (labelBehavior == EliminationLabelBehavior::MergeLabels || labelBehavior == EliminationLabelBehavior::DeleteLabels) {
+            for (uint64_t state : selected) {
+                std::set<std::string> labels;
+                if (labelBehavior == EliminationLabelBehavior::MergeLabels) {
+                    labels = stateLabeling.getLabelsOfState(state);
+                } else if (stateLabeling.getStateHasLabel("init", state)) {
+                    labels.insert("init");
+                }
+                uint64_t const row = rowGroupIndices[state];
+                for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                    for (auto const& label : labels) {
+                        stateLabeling.addLabelToState(label, entries[position].getColumn());
+                    }
+                }
+            }
+        }
+
+        // Remove the self-loops of the selected states and scale their remaining transitions accordingly.
+        std::vector<std::vector<Entry>> scaledRows(selected.size());
+        forEachIndex<ValueType>(selected.size(), [&](uint64_t index) {
+            uint64_t const state = selected[index];
+            uint64_t const row = rowGroupIndices[state];
+            ValueType selfLoop = storm::utility::zero<ValueType>();
+            for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                if (entries[position].getColumn() == state) {
+                    selfLoop += entries[position].getValue();
+                } else {
+                    scaledRows[index].push_back(entries[position]);
+                }
+            }
+            if (!storm::utility::isZero(selfLoop)) {
+                ValueType const factor = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - selfLoop);
+                for (auto& entry : scaledRows[index]) {
+                    entry.setValue(entry.getValue() * factor);
+                }
+            }
+        });
+
+        // Find the rows that lead to selected states. The rows of the selected states themselves are dropped.
+        forEachIndex<ValueType>(numberOfStates, [&](uint64_t state) {
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                substitutedRowIndex[row] = notSubstituted;
+                if (status[state] != StateStatus::Selected) {
+                    for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                        if (status[entries[position].getColumn()] == StateStatus::Selected) {
+                            substitutedRowIndex[row] = 0;
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+        std::vector<uint64_t> substitutedRows;
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            if (substitutedRowIndex[row] != notSubstituted) {
+                substitutedRowIndex[row] = substitutedRows.size();
+                substitutedRows.push_back(row);
+            }
+        }
 
+        // Substitute the scaled rows of the selected states. These do not lead to selected states as the selected states are independent.
+        std::vector<std::vector<Entry>> newRows(substitutedRows.size());
+        forEachIndex<ValueType>(substitutedRows.size(), [&](uint64_t index) {
+            uint64_t const row = substitutedRows[index];
+            std::vector<Entry>& newRow = newRows[index];
+            for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                Entry const& entry = entries[position];
+                if (status[entry.getColumn()] == StateStatus::Selected) {
+                    for (auto const& scaledEntry : scaledRows[selectedIndex[entry.getColumn()]]) {
+                        newRow.emplace_back(scaledEntry.getColumn(), entry.getValue() * scaledEntry.getValue());
+                    }
+                } else {
+                    newRow.push_back(entry);
+                }
+            }
+            std::sort(newRow.begin(), newRow.end(), [](Entry const& lhs, Entry const& rhs) { return lhs.getColumn() < rhs.getColumn(); });
+            // Merge entries with the same column
+            if (!newRow.empty()) {
+                auto last = newRow.begin();
+                for (auto entryIt = newRow.begin() + 1; entryIt != newRow.end(); ++entryIt) {
+                    if (entryIt->getColumn() == last->getColumn()) {
+                        last->setValue(last->getValue() + entryIt->getValue());
+                    } else {
+                        *(++last) = std::move(*entryIt);
+                    }
+                }
+                newRow.erase(last + 1, newRow.end());
+            }
+        });
+
+        // Write the new matrix
+        std::vector<uint64_t> newRowIndications(numberOfRows + 1, 0);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                uint64_t rowSize = 0;
+                if (status[state] != StateStatus::Selected) {
+                    rowSize = substitutedRowIndex[row] != notSubstituted ? newRows[substitutedRowIndex[row]].size()
+                                                                         : rowIndications[row + 1] - rowIndications[row];
+                }
+                newRowIndications[row + 1] = newRowIndications[row] + rowSize;
+            }
+        }
+        std::vector<Entry> newEntries(newRowIndications.back());
+        forEachIndex<ValueType>(numberOfStates, [&](uint64_t state) {
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                if (newRowIndications[row] == newRowIndications[row + 1]) {
+                    continue;
+                }
+                auto outputIt = newEntries.begin() + newRowIndications[row];
+                if (substitutedRowIndex[row] != notSubstituted) {
+                    std::move(newRows[substitutedRowIndex[row]].begin(), newRows[substitutedRowIndex[row]].end(), outputIt);
+                } else {
+                    std::copy(entries.begin() + rowIndications[row], entries.begin() + rowIndications[row + 1], outputIt);
+                }
+            }
+        });
+        rowIndications = std::move(newRowIndications);
+        entries = std::move(newEntries);
+        for (uint64_t state : selected) {
+            status[state] = StateStatus::Eliminated;
+        }
+    }
+
+    // Create the new matrix which only contains the kept states
+    storm::storage::BitVector keepStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        keepStates.set(state, status[state] != StateStatus::Eliminated);
+    }
+    STORM_LOG_DEBUG("Eliminated " << numberOfStates - keepStates.getNumberOfSetBits() << " states in " << rounds << " rounds.");
+    std::vector<uint_fast64_t> newStateIndices = keepStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint_fast64_t> newRowGroupIndices(1, 0);
+    std::vector<uint_fast64_t> newRowIndications(1, 0);
+    std::vector<uint64_t> keptRows;
+    for (uint64_t state : keepStates) {
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            keptRows.push_back(row);
+            newRowIndications.push_back(newRowIndications.back() + rowIndications[row + 1] - rowIndications[row]);
+        }
+        newRowGroupIndices.push_back(newRowIndications.size() - 1);
+    }
+    std::vector<Entry> newEntries(newRowIndications.back());
+    forEachIndex<ValueType>(keptRows.size(), [&](uint64_t newRow) {
+        uint64_t const row = keptRows[newRow];
+        auto outputIt = newEntries.begin() + newRowIndications[newRow];
+        for (uint64_t position = rowIndications[row]; position < rowIndications[row + 1]; ++position, ++outputIt) {
+            STORM_LOG_ASSERT(keepStates.get(entries[position].getColumn()), "Transition to eliminated state.");
+            *outputIt = Entry(newStateIndices[entries[position].getColumn()], entries[position].getValue());
+        }
+    });
+    uint64_t const numberOfKeptStates = keepStates.getNumberOfSetBits();
+    storm::storage::SparseMatrix<ValueType> matrix(numberOfKeptStates, std::move(newRowIndications), std::move(newEntries), std::move(newRowGroupIndices));
+    return createTransformedModel(ma, std::move(matrix), keepStates, stateLabeling);
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> NonMarkovianChainTransformer<ValueType, RewardModelType>::createTransformedModel(
+    std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> const& ma, storm::storage::SparseMatrix<ValueType>&& matrix,
+    storm::storage::BitVector const& keepStates, storm::models::sparse::StateLabeling const& stateLabeling) {
     // TODO: obtain the reward model for the resulting system
 
     // Prepare model components
     storm::storage::BitVector markovianStates = ma->getMarkovianStates() % keepStates;
     storm::models::sparse::StateLabeling labeling = stateLabeling.getSubLabeling(keepStates);
-    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(matrix, labeling, ma->getRewardModels(), false, markovianStates);
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(std::move(matrix), std::move(labeling));
+    components.rewardModels = ma->getRewardModels();
+    components.markovianStates = markovianStates;
     std::vector<ValueType> exitRates(markovianStates.size());
     storm::utility::vector::selectVectorValues(exitRates, keepStates, ma->getExitRates());
     components.exitRates = exitRates;
@@ -31,6 +31,21 @@ class NonMarkovianChainTransformer {
         std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> ma,
         EliminationLabelBehavior labelBehavior = EliminationLabelBehavior::KeepLabels);
 
+    /**
+     * Generates a model with the same basic behavior as the input, but eliminates non-Markovian chains.
+     * In contrast to eliminateNonmarkovianStates, the states are eliminated in rounds. In each round, an independent set of non-Markovian states
+     * (i.e., no two of them are connected by a transition) is eliminated in parallel and the transition matrix is rebuilt directly in CSR format.
+     * The set of eliminated states may differ from the sequential elimination, but the same properties are preserved.
+     * If no non-determinism occurs, a CTMC is generated.
+     *
+     * @param ma The input Markov Automaton.
+     * @param labelBehavior How the labels of non-Markovian states should be treated when eliminating states.
+     * @return A reference to the new model after eliminating non-Markovian states.
+     */
+    static std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> eliminateNonmarkovianStatesInParallel(
+        std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> ma,
+        EliminationLabelBehavior labelBehavior = EliminationLabelBehavior::KeepLabels);
+
     /**
      * Check if the property specified by the given formula is preserved by the transformation.
      *
@@ -47,6 +62,19 @@ class NonMarkovianChainTransformer {
      */
     static std::vector<std::shared_ptr<storm::logic::Formula const>> checkAndTransformFormulas(
         std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
+   private:
+    /**
+     * Builds the model consisting of the kept states of the given MA.
+     *
+     * @param ma The input Markov Automaton.
+     * @param matrix The transition matrix of the kept states.
+     * @param keepStates The states of the input that are kept.
+     * @param stateLabeling The (updated) labeling of all states of the input.
+     */
+    static std::shared_ptr<models::sparse::Model<ValueType, RewardModelType>> createTransformedModel(
+        std::shared_ptr<models::sparse::MarkovAutomaton<ValueType, RewardModelType>> const& ma, storm::storage::SparseMatrix<ValueType>&& matrix,
+        storm::storage::BitVector const& keepStates, storm::models::sparse::StateLabeling const& stateLabeling);
 };
 }  // namespace transformer
 }  // namespace storm
@@ -24,7 +24,7 @@ class Product {
     Product(Product<Model>&& product) = default;
     Product& operator=(Product<Model>&& product) = default;
 
-    Model& getProductModel() {
+    Model const& getProductModel() const {
         return productModel;
     }
 
@@ -1,14 +1,20 @@
 #include "SymbolicToSparseTransformer.h"
 
+#include <functional>
+
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/logic/AtomicLabelFormula.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/ParallelConversion.h"
 #include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -37,225 +43,203 @@ struct LabelInformation {
     std::map<std::string, storm::expressions::Expression> expressionLabels;
 };
 
+/*!
+ * Collects translations of DDs to explicit vectors over the same ODD. As these translations only traverse the (already existing) DDs without creating
+ * new nodes, they are performed concurrently once all DDs have been created.
+ */
 template<storm::dd::DdType Type, typename ValueType>
-std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-    this->odd = symbolicDtmc.getReachableStates().createOdd();
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
-    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
-    for (auto const& rewardModelNameAndModel : symbolicDtmc.getRewardModels()) {
-        std::optional<std::vector<ValueType>> stateRewards;
-        std::optional<std::vector<ValueType>> stateActionRewards;
-        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(this->odd);
-        }
-        if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(this->odd);
-        }
-        if (rewardModelNameAndModel.second.hasTransitionRewards()) {
-            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd);
+class VectorTranslations {
+   public:
+    VectorTranslations(storm::dd::Odd const& odd) : odd(odd) {
+        // Intentionally left empty.
+    }
+
+    void add(storm::dd::Bdd<Type> const& set, storm::storage::BitVector& result) {
+        translations.emplace_back([this, set, &result]() { result = set.toVector(this->odd); });
+    }
+
+    void add(storm::dd::Add<Type, ValueType> const& values, std::vector<ValueType>& result) {
+        translations.emplace_back([this, values, &result]() { result = values.toVector(this->odd); });
+    }
+
+    void perform() {
+        if (storm::NumberTraits<ValueType>::IsThreadSafe && translations.size() > 1 &&
+            storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+            storm::dd::performParallelConversion(translations.size(), [this](uint_fast64_t index) { translations[index](); });
+        } else {
+            for (auto const& translation : translations) {
+                translation();
+            }
         }
-        rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
+        translations.clear();
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
-    labelling.addLabel("init", symbolicDtmc.getInitialStates().toVector(this->odd));
-    labelling.addLabel("deadlock", symbolicDtmc.getDeadlockStates().toVector(this->odd));
+   private:
+    storm::dd::Odd const& odd;
+    std::vector<std::function<void()>> translations;
+};
+
+/*!
+ * Translates the labels and reward models of the given model. The labels either comprise all labels of the model or only the ones needed for the given
+ * formulas. For nondeterministic models, the state-action rewards have to be translated along with the transition matrix and are given explicitly.
+ * Further translations (e.g. of model-specific components) may be added to the given translations, which are all performed before returning.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+std::pair<storm::models::sparse::StateLabeling, std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>>
+translateLabelsAndRewardModels(storm::models::symbolic::Model<Type, ValueType> const& model,
+                               std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::dd::Odd const& odd,
+                               std::map<std::string, std::vector<ValueType>>&& stateActionRewardVectors, VectorTranslations<Type, ValueType>& translations) {
+    // First create all sets that are to be translated, as this may involve DD operations that must not run concurrently.
+    std::vector<std::pair<std::string, storm::dd::Bdd<Type>>> labelSets;
+    labelSets.emplace_back("init", model.getInitialStates());
+    labelSets.emplace_back("deadlock", model.getDeadlockStates());
     if (formulas.empty()) {
-        for (auto const& label : symbolicDtmc.getLabels()) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+        for (auto const& label : model.getLabels()) {
+            labelSets.emplace_back(label, model.getStates(label));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+            labelSets.emplace_back(label, model.getStates(label));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
+            labelSets.emplace_back(expressionLabel.first, model.getStates(expressionLabel.second));
         }
     }
-    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
-}
+    std::vector<storm::storage::BitVector> labelVectors(labelSets.size());
+    for (uint64_t labelIndex = 0; labelIndex < labelSets.size(); ++labelIndex) {
+        translations.add(labelSets[labelIndex].second, labelVectors[labelIndex]);
+    }
 
-template<storm::dd::DdType Type, typename ValueType>
-storm::dd::Odd const& SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::getOdd() const {
-    return this->odd;
+    // Translating transition rewards involves DD operations, so it is done upfront.
+    std::map<std::string, std::optional<std::vector<ValueType>>> stateRewards;
+    std::map<std::string, std::optional<std::vector<ValueType>>> stateActionRewards;
+    std::map<std::string, std::optional<storm::storage::SparseMatrix<ValueType>>> transitionRewards;
+    for (auto const& rewardModelNameAndModel : model.getRewardModels()) {
+        auto const& name = rewardModelNameAndModel.first;
+        auto const& rewardModel = rewardModelNameAndModel.second;
+        if (rewardModel.hasStateRewards()) {
+            translations.add(rewardModel.getStateRewardVector(), stateRewards[name].emplace());
+        }
+        if (model.isNondeterministicModel()) {
+            auto stateActionRewardIt = stateActionRewardVectors.find(name);
+            if (stateActionRewardIt != stateActionRewardVectors.end()) {
+                stateActionRewards[name] = std::move(stateActionRewardIt->second);
+            }
+            STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotImplementedException,
+                            "Translation of symbolic to explicit transition rewards is not yet supported.");
+        } else {
+            if (rewardModel.hasStateActionRewards()) {
+                translations.add(rewardModel.getStateActionRewardVector(), stateActionRewards[name].emplace());
+            }
+            if (rewardModel.hasTransitionRewards()) {
+                transitionRewards[name] = rewardModel.getTransitionRewardMatrix().toMatrix(odd, odd);
+            }
+        }
+    }
+
+    translations.perform();
+
+    storm::models::sparse::StateLabeling labelling(odd.getTotalOffset());
+    for (uint64_t labelIndex = 0; labelIndex < labelSets.size(); ++labelIndex) {
+        labelling.addLabel(labelSets[labelIndex].first, std::move(labelVectors[labelIndex]));
+    }
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    for (auto const& rewardModelNameAndModel : model.getRewardModels()) {
+        auto const& name = rewardModelNameAndModel.first;
+        rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards[name]), std::move(stateActionRewards[name]),
+                                                                                         std::move(transitionRewards[name])));
+    }
+    return std::make_pair(std::move(labelling), std::move(rewardModels));
 }
 
+/*!
+ * Translates the transition matrix of the given nondeterministic model along with all state-action reward vectors.
+ */
 template<storm::dd::DdType Type, typename ValueType>
-std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-    storm::dd::Odd odd = symbolicMdp.getReachableStates().createOdd();
-
+std::pair<storm::storage::SparseMatrix<ValueType>, std::map<std::string, std::vector<ValueType>>> translateNondeterministicTransitionMatrix(
+    storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model, storm::dd::Odd const& odd) {
     // Collect action reward vectors that need translation
     std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
-    std::map<std::string, uint64_t> rewardNameToActionRewardIndexMap;
-    for (auto const& rewardModelNameAndModel : symbolicMdp.getRewardModels()) {
+    std::vector<std::string> actionRewardModelNames;
+    for (auto const& rewardModelNameAndModel : model.getRewardModels()) {
         if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            rewardNameToActionRewardIndexMap.emplace(rewardModelNameAndModel.first, symbolicActionRewardVectors.size());
+            actionRewardModelNames.push_back(rewardModelNameAndModel.first);
             symbolicActionRewardVectors.push_back(rewardModelNameAndModel.second.getStateActionRewardVector());
         }
     }
+
     // Build transition matrix and (potentially) actionRewardVectors.
-    storm::storage::SparseMatrix<ValueType> transitionMatrix;
-    std::vector<std::vector<ValueType>> actionRewardVectors;
+    std::pair<storm::storage::SparseMatrix<ValueType>, std::map<std::string, std::vector<ValueType>>> result;
     if (symbolicActionRewardVectors.empty()) {
-        transitionMatrix = symbolicMdp.getTransitionMatrix().toMatrix(symbolicMdp.getNondeterminismVariables(), odd, odd);
+        result.first = model.getTransitionMatrix().toMatrix(model.getNondeterminismVariables(), odd, odd);
     } else {
-        auto matrRewards = symbolicMdp.getTransitionMatrix().toMatrixVectors(symbolicActionRewardVectors, symbolicMdp.getNondeterminismVariables(), odd, odd);
-        transitionMatrix = std::move(matrRewards.first);
-        actionRewardVectors = std::move(matrRewards.second);
-    }
-
-    // Translate reward models
-    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
-    for (auto const& rewardModelNameAndModel : symbolicMdp.getRewardModels()) {
-        std::optional<std::vector<ValueType>> stateRewards;
-        std::optional<std::vector<ValueType>> stateActionRewards;
-        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
-        auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
-        if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
-            stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
+        auto matrRewards = model.getTransitionMatrix().toMatrixVectors(symbolicActionRewardVectors, model.getNondeterminismVariables(), odd, odd);
+        result.first = std::move(matrRewards.first);
+        for (uint64_t index = 0; index < actionRewardModelNames.size(); ++index) {
+            result.second.emplace(actionRewardModelNames[index], std::move(matrRewards.second[index]));
         }
-        STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
-                        "Translation of symbolic to explicit transition rewards is not yet supported.");
-        rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
+    return result;
+}
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
+    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    this->odd = symbolicDtmc.getReachableStatesOdd();
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
+    VectorTranslations<Type, ValueType> translations(this->odd);
+    auto labellingAndRewardModels = translateLabelsAndRewardModels(symbolicDtmc, formulas, this->odd, {}, translations);
+    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(transitionMatrix), std::move(labellingAndRewardModels.first),
+                                                                    std::move(labellingAndRewardModels.second));
+}
 
-    labelling.addLabel("init", symbolicMdp.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMdp.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMdp.getLabels()) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMdp.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Odd const& SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::getOdd() const {
+    return this->odd;
+}
 
-    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTransformer<Type, ValueType>::translate(
+    storm::models::symbolic::Mdp<Type, ValueType> const& symbolicMdp, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    storm::dd::Odd const& odd = symbolicMdp.getReachableStatesOdd();
+    auto transitionMatrixAndActionRewards = translateNondeterministicTransitionMatrix(symbolicMdp, odd);
+    VectorTranslations<Type, ValueType> translations(odd);
+    auto labellingAndRewardModels =
+        translateLabelsAndRewardModels(symbolicMdp, formulas, odd, std::move(transitionMatrixAndActionRewards.second), translations);
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(transitionMatrixAndActionRewards.first), std::move(labellingAndRewardModels.first),
+                                                                   std::move(labellingAndRewardModels.second));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmcTransformer<Type, ValueType>::translate(
     storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-    storm::dd::Odd odd = symbolicCtmc.getReachableStates().createOdd();
+    storm::dd::Odd const& odd = symbolicCtmc.getReachableStatesOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicCtmc.getTransitionMatrix().toMatrix(odd, odd);
-    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
-    for (auto const& rewardModelNameAndModel : symbolicCtmc.getRewardModels()) {
-        std::optional<std::vector<ValueType>> stateRewards;
-        std::optional<std::vector<ValueType>> stateActionRewards;
-        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
-        if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(odd);
-        }
-        if (rewardModelNameAndModel.second.hasTransitionRewards()) {
-            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(odd, odd);
-        }
-        rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
-    }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicCtmc.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicCtmc.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicCtmc.getLabels()) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicCtmc.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
-
-    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    VectorTranslations<Type, ValueType> translations(odd);
+    auto labellingAndRewardModels = translateLabelsAndRewardModels(symbolicCtmc, formulas, odd, {}, translations);
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(transitionMatrix), std::move(labellingAndRewardModels.first),
+                                                                    std::move(labellingAndRewardModels.second));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
 std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToSparseMaTransformer<Type, ValueType>::translate(
     storm::models::symbolic::MarkovAutomaton<Type, ValueType> const& symbolicMa, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-    storm::dd::Odd odd = symbolicMa.getReachableStates().createOdd();
-    // Collect action reward vectors that need translation
-    std::vector<storm::dd::Add<Type, ValueType>> symbolicActionRewardVectors;
-    std::map<std::string, uint64_t> rewardNameToActionRewardIndexMap;
-    for (auto const& rewardModelNameAndModel : symbolicMa.getRewardModels()) {
-        if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            rewardNameToActionRewardIndexMap.emplace(rewardModelNameAndModel.first, symbolicActionRewardVectors.size());
-            symbolicActionRewardVectors.push_back(rewardModelNameAndModel.second.getStateActionRewardVector());
-        }
-    }
-    // Build transition matrix and (potentially) actionRewardVectors.
-    storm::storage::SparseMatrix<ValueType> transitionMatrix;
-    std::vector<std::vector<ValueType>> actionRewardVectors;
-    if (symbolicActionRewardVectors.empty()) {
-        transitionMatrix = symbolicMa.getTransitionMatrix().toMatrix(symbolicMa.getNondeterminismVariables(), odd, odd);
-    } else {
-        auto matrRewards = symbolicMa.getTransitionMatrix().toMatrixVectors(symbolicActionRewardVectors, symbolicMa.getNondeterminismVariables(), odd, odd);
-        transitionMatrix = std::move(matrRewards.first);
-        actionRewardVectors = std::move(matrRewards.second);
-    }
-
-    // Translate reward models
-    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
-    for (auto const& rewardModelNameAndModel : symbolicMa.getRewardModels()) {
-        std::optional<std::vector<ValueType>> stateRewards;
-        std::optional<std::vector<ValueType>> stateActionRewards;
-        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
-        auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
-        if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
-            stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
-        }
-        STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
-                        "Translation of symbolic to explicit transition rewards is not yet supported.");
-        rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
-    }
+    storm::dd::Odd const& odd = symbolicMa.getReachableStatesOdd();
+    auto transitionMatrixAndActionRewards = translateNondeterministicTransitionMatrix(symbolicMa, odd);
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
+    // The Markovian states and exit rates are translated along with the labels and rewards.
+    VectorTranslations<Type, ValueType> translations(odd);
+    storm::storage::BitVector markovianStates;
+    std::vector<ValueType> exitRates;
+    translations.add(symbolicMa.getMarkovianStates(), markovianStates);
+    translations.add(symbolicMa.getExitRateVector(), exitRates);
+    auto labellingAndRewardModels =
+        translateLabelsAndRewardModels(symbolicMa, formulas, odd, std::move(transitionMatrixAndActionRewards.second), translations);
 
-    labelling.addLabel("init", symbolicMa.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMa.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMa.getLabels()) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMa.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
-    storm::storage::BitVector markovianStates = symbolicMa.getMarkovianStates().toVector(odd);
-    storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels), false,
-                                                                  std::move(markovianStates));
-    components.exitRates = symbolicMa.getExitRateVector().toVector(odd);
+    storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrixAndActionRewards.first), std::move(labellingAndRewardModels.first),
+                                                                  std::move(labellingAndRewardModels.second), false, std::move(markovianStates));
+    components.exitRates = std::move(exitRates);
 
     return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
 }
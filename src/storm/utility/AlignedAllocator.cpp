@@ -0,0 +1,20 @@
+#include "storm/utility/AlignedAllocator.h"
+
+#include <cstdint>
+
+#include "storm/utility/OsDetection.h"
+
+namespace storm::utility {
+
+void adviseHugePages([[maybe_unused]] void const* begin, [[maybe_unused]] std::size_t bytes) {
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+    uintptr_t const first = (reinterpret_cast<uintptr_t>(begin) + HugePageSize - 1) & ~(HugePageSize - 1);
+    uintptr_t const end = (reinterpret_cast<uintptr_t>(begin) + bytes) & ~(HugePageSize - 1);
+    if (first < end) {
+        // Failures (e.g. if transparent huge pages are disabled) are not critical, so we ignore them.
+        madvise(reinterpret_cast<void*>(first), end - first, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+}  // namespace storm::utility
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace storm::utility {
+
+/*!
+ * The alignment (in bytes) of all allocations of the AlignedAllocator. This is the size of a cache line, which also suffices for all SIMD loads.
+ */
+std::size_t constexpr CacheLineSize = 64;
+
+/*!
+ * The size (in bytes) of a transparent huge page.
+ */
+std::size_t constexpr HugePageSize = std::size_t(1) << 21;
+
+/*!
+ * Advises the operating system to back the pages of the given memory region with transparent huge pages. This is most effective before the memory is
+ * first touched; otherwise the pages are only collapsed eventually (if at all). Only pages that are completely covered by the region are affected.
+ * Does nothing if the region is smaller than a huge page or if the operating system does not support transparent huge pages.
+ */
+void adviseHugePages(void const* begin, std::size_t bytes);
+
+/*!
+ * Advises the operating system to back the (possibly not yet touched) capacity of the given vector with transparent huge pages.
+ */
+template<typename T, typename Allocator>
+void adviseHugePages(std::vector<T, Allocator> const& vector) {
+    adviseHugePages(static_cast<void const*>(vector.data()), vector.capacity() * sizeof(T));
+}
+
+/*!
+ * An allocator for large, frequently accessed arrays. All allocations are aligned to cache lines. Allocations of at least the size of a huge page are
+ * aligned to huge pages and are advised to be backed by transparent huge pages, which reduces TLB misses on random accesses.
+ */
+template<typename T>
+class AlignedAllocator {
+   public:
+    using value_type = T;
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(AlignedAllocator<U> const&) noexcept {
+        // Intentionally left empty.
+    }
+
+    T* allocate(std::size_t n) {
+        std::size_t const bytes = n * sizeof(T);
+        void* result = ::operator new(bytes, getAlignment(bytes));
+        if (bytes >= HugePageSize) {
+            adviseHugePages(result, bytes);
+        }
+        return static_cast<T*>(result);
+    }
+
+    void deallocate(T* pointer, std::size_t n) noexcept {
+        ::operator delete(static_cast<void*>(pointer), getAlignment(n * sizeof(T)));
+    }
+
+    template<typename U>
+    bool operator==(AlignedAllocator<U> const&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(AlignedAllocator<U> const&) const noexcept {
+        return false;
+    }
+
+   private:
+    static std::align_val_t getAlignment(std::size_t bytes) {
+        return std::align_val_t(bytes >= HugePageSize ? HugePageSize : std::max(CacheLineSize, alignof(T)));
+    }
+};
+
+/*!
+ * A vector whose storage is allocated by the AlignedAllocator.
+ */
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+}  // namespace storm::utility
@@ -1,5 +1,6 @@
 #include "storm/utility/AutomaticSettings.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "storm/logic/Formula.h"
@@ -10,6 +11,7 @@
 
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
 
 namespace storm {
 namespace utility {
@@ -90,10 +92,28 @@ AutomaticSettings::AutomaticSettings() : engine(storm::utility::Engine::Unknown)
     // Intentionally left empty
 }
 
+void AutomaticSettings::setMemoryLimit(uint64_t bytes) {
+    memoryLimit = bytes;
+}
+
 void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Property const& property) {
-    typedef pfinternal::PropertyType PropertyType;
     auto f = pfinternal::Features(model, property);
     STORM_LOG_INFO("Automatic engine using features " << f.toString() << ".");
+    predict(f);
+    respectMemoryLimit(f);
+}
+
+void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Property const& property, uint64_t stateEstimate) {
+    auto f = pfinternal::Features(model, property);
+    f.stateEstimate = stateEstimate;
+    STORM_LOG_INFO("Automatic engine using features " << f.toString() << ".");
+    // Right now, the decision tree does not make use of the state estimate. It only sharpens the memory estimates.
+    predict(f);
+    respectMemoryLimit(f);
+}
+
+void AutomaticSettings::predict(pfinternal::Features const& f) {
+    typedef pfinternal::PropertyType PropertyType;
 
     if (f.numVariables <= 12) {
         if (f.avgDomainSize <= 323.25) {
@@ -214,14 +234,33 @@ void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Pr
     }
 }
 
-void AutomaticSettings::predict(storm::jani::Model const& model, storm::jani::Property const& property, uint64_t) {
-    // typedef pfinternal::PropertyType PropertyType;
-    // auto f = pfinternal::Features(model, property);
-    // f.stateEstimate = stateEstimate;
-    // STORM_LOG_INFO("Automatic engine using features " << f.toString() << ".");
-
-    // Right now, we do not make use of the state estimate, so we just ask the 'default' decision tree.
-    predict(model, property);
+void AutomaticSettings::respectMemoryLimit(pfinternal::Features const& f) {
+    if (!memoryLimit || (f.stateEstimate == 0 && f.stateDomainSize == 0)) {
+        return;
+    }
+    // Without a hint, the size of the state domain serves as (over-)approximation of the number of reachable states. Capping it at the limit (every
+    // state needs more than one byte) avoids overflows in the estimates below. The transitions are guessed from the typical branching of models.
+    uint64_t const states = std::min(f.stateEstimate > 0 ? f.stateEstimate : f.stateDomainSize, *memoryLimit);
+    uint64_t const rows = f.nondeterminism ? 2 * states : states;
+    uint64_t const entries = 4 * rows;
+    auto sparseBytes = [&](bool exact) {
+        return storm::utility::memory::estimateSparseVerificationBytes(storm::solver::MinMaxMethod::ValueIteration, states, rows, entries, f.nondeterminism,
+                                                                        storm::utility::memory::getValueBytes(exact));
+    };
+    if (engine == storm::utility::Engine::Sparse && useExact && sparseBytes(true) > *memoryLimit) {
+        STORM_LOG_WARN("Exact model checking is expected to exceed the memory limit. Falling back to floating point numbers.");
+        sparse();
+    }
+    if (engine == storm::utility::Engine::Sparse && sparseBytes(false) > *memoryLimit) {
+        STORM_LOG_WARN("The sparse engine is expected to exceed the memory limit. Falling back to the hybrid engine.");
+        hybrid();
+    }
+    // The hybrid engine stores the transitions symbolically, but still needs explicit vectors for the solver.
+    if (engine == storm::utility::Engine::Hybrid &&
+        storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::ValueIteration, states, rows, sizeof(double)) > *memoryLimit) {
+        STORM_LOG_WARN("The hybrid engine is expected to exceed the memory limit. Falling back to the dd engine.");
+        dd();
+    }
 }
 
 storm::utility::Engine AutomaticSettings::getEngine() const {
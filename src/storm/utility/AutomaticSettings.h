@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "storm/utility/Engine.h"
 
 namespace storm {
@@ -10,10 +12,20 @@ class Property;
 }  // namespace jani
 
 namespace utility {
+namespace pfinternal {
+struct Features;
+}
+
 class AutomaticSettings {
    public:
     AutomaticSettings();
 
+    /*!
+     * Sets a memory limit. Predictions whose estimated memory consumption exceeds the limit are replaced by less memory demanding settings.
+     * @param bytes The memory limit in bytes.
+     */
+    void setMemoryLimit(uint64_t bytes);
+
     /*!
      * Predicts "good" settings for the provided model checking query
      */
@@ -38,9 +50,13 @@ class AutomaticSettings {
     void exact();
     void ddbisim();
 
+    void predict(pfinternal::Features const& features);
+    void respectMemoryLimit(pfinternal::Features const& features);
+
     storm::utility::Engine engine;
     bool useBisimulation;
     bool useExact;
+    std::optional<uint64_t> memoryLimit;
 };
 
 }  // namespace utility
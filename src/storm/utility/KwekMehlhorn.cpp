@@ -79,12 +79,36 @@ void sharpen(uint64_t precision, std::vector<ImpreciseType> const& input, std::v
     }
 }
 
+template<typename RationalType>
+RationalType findRationalInInterval(RationalType const& lower, RationalType const& upper) {
+    typedef typename NumberTraits<RationalType>::IntegerType IntegerType;
+    STORM_LOG_ASSERT(lower <= upper, "Invalid interval [" << lower << ", " << upper << "].");
+
+    RationalType integer = storm::utility::floor(lower);
+    if (integer == lower) {
+        return lower;
+    }
+    if (storm::utility::floor(upper) > integer) {
+        // There is an integer in the interval.
+        return integer + storm::utility::one<RationalType>();
+    }
+    // Now, lower and upper only differ in their fractional part.
+    RationalType const lowerFraction = lower - integer;
+    RationalType const upperFraction = upper - integer;
+    std::pair<IntegerType, IntegerType> result =
+        findRational<IntegerType>(storm::utility::numerator(lowerFraction), storm::utility::denominator(lowerFraction),
+                                  storm::utility::numerator(upperFraction), storm::utility::denominator(upperFraction));
+    return integer + storm::utility::convertNumber<RationalType>(result.first) / storm::utility::convertNumber<RationalType>(result.second);
+}
+
 template storm::RationalNumber sharpen(uint64_t precision, double const& input);
 template storm::RationalNumber sharpen(uint64_t precision, storm::RationalNumber const& input);
 
 template void sharpen(uint64_t precision, std::vector<double> const& input, std::vector<storm::RationalNumber>& output);
 template void sharpen(uint64_t precision, std::vector<storm::RationalNumber> const& input, std::vector<storm::RationalNumber>& output);
 
+template storm::RationalNumber findRationalInInterval(storm::RationalNumber const& lower, storm::RationalNumber const& upper);
+
 }  // namespace kwek_mehlhorn
 }  // namespace utility
 }  // namespace storm
@@ -30,6 +30,12 @@ RationalType sharpen(uint64_t precision, ImpreciseType const& value);
 template<typename RationalType, typename ImpreciseType>
 void sharpen(uint64_t precision, std::vector<ImpreciseType> const& input, std::vector<RationalType>& output);
 
+/*!
+ * Finds the rational number with the smallest denominator within the (closed) interval [lower, upper].
+ */
+template<typename RationalType>
+RationalType findRationalInInterval(RationalType const& lower, RationalType const& upper);
+
 }  // namespace kwek_mehlhorn
 }  // namespace utility
 }  // namespace storm
@@ -10,12 +10,15 @@ template<typename ValueType>
 struct NumberTraits {
     static const bool SupportsExponential = false;
     static const bool IsExact = false;
+    // Whether (copies of) the same number can be used by multiple threads concurrently.
+    static const bool IsThreadSafe = false;
 };
 
 template<>
 struct NumberTraits<double> {
     static const bool SupportsExponential = true;
     static const bool IsExact = false;
+    static const bool IsThreadSafe = true;
 
     typedef uint64_t IntegerType;
 };
@@ -25,6 +28,8 @@ template<>
 struct NumberTraits<storm::ClnRationalNumber> {
     static const bool SupportsExponential = false;
     static const bool IsExact = true;
+    // CLN numbers share their representation via (unsynchronized) reference counting.
+    static const bool IsThreadSafe = false;
 
     typedef ClnIntegerNumber IntegerType;
 };
@@ -35,6 +40,7 @@ template<>
 struct NumberTraits<storm::GmpRationalNumber> {
     static const bool SupportsExponential = false;
     static const bool IsExact = true;
+    static const bool IsThreadSafe = true;
 
     typedef GmpIntegerNumber IntegerType;
 };
@@ -44,5 +50,6 @@ template<>
 struct NumberTraits<storm::RationalFunction> {
     static const bool SupportsExponential = false;
     static const bool IsExact = true;
+    static const bool IsThreadSafe = false;
 };
 }  // namespace storm
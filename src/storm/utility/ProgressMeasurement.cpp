@@ -1,15 +1,46 @@
 #include "storm/utility/ProgressMeasurement.h"
 
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <mutex>
 #include <sstream>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
 namespace utility {
 
+namespace detail {
+std::mutex progressCallbackMutex;
+ProgressCallback progressCallback;
+std::atomic<bool> hasProgressCallback{false};
+std::atomic<int64_t> progressCallbackIntervalInMilliseconds{500};
+thread_local std::optional<std::pair<double, double>> publishedResidual;
+}  // namespace detail
+
+void setProgressCallback(ProgressCallback const& callback, std::chrono::milliseconds const& interval) {
+    std::lock_guard<std::mutex> lock(detail::progressCallbackMutex);
+    detail::progressCallback = callback;
+    detail::progressCallbackIntervalInMilliseconds = interval.count();
+    detail::hasProgressCallback = static_cast<bool>(callback);
+}
+
+void clearProgressCallback() {
+    setProgressCallback(ProgressCallback());
+}
+
+bool hasProgressCallback() {
+    return detail::hasProgressCallback;
+}
+
+void publishResidual(double residual, double targetResidual) {
+    detail::publishedResidual = std::make_pair(residual, targetResidual);
+}
+
 ProgressMeasurement::ProgressMeasurement(std::string const& itemName) : itemName(itemName), maxCount(std::numeric_limits<uint64_t>::max()) {
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     showProgress = generalSettings.isShowProgressSet();
@@ -20,9 +51,17 @@ void ProgressMeasurement::startNewMeasurement(uint64_t startCount) {
     lastDisplayedCount = startCount;
     timeOfStart = std::chrono::high_resolution_clock::now();
     timeOfLastMessage = timeOfStart;
+    lastReportedCount = startCount;
+    lastReportedResidual.reset();
+    timeOfLastReport = timeOfStart;
+    frontierSize.reset();
+    residual.reset();
+    targetResidual.reset();
+    detail::publishedResidual.reset();
 }
 
 bool ProgressMeasurement::updateProgress(uint64_t count) {
+    reportProgress(count);
     if (showProgress) {
         std::stringstream stream;
         if (updateProgress(count, stream)) {
@@ -35,6 +74,67 @@ bool ProgressMeasurement::updateProgress(uint64_t count) {
     return false;
 }
 
+bool ProgressMeasurement::reportProgress(uint64_t count) {
+    if (!detail::hasProgressCallback) {
+        return false;
+    }
+    if (detail::publishedResidual) {
+        setResidual(detail::publishedResidual->first, detail::publishedResidual->second);
+        detail::publishedResidual.reset();
+    }
+    auto now = std::chrono::high_resolution_clock::now();
+    auto millisecondsSinceLastReport = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->timeOfLastReport).count();
+    if (millisecondsSinceLastReport < detail::progressCallbackIntervalInMilliseconds) {
+        return false;
+    }
+
+    ProgressReport report;
+    report.itemName = itemName;
+    report.count = count;
+    if (this->isMaxCountSet()) {
+        report.maxCount = this->getMaxCount();
+    }
+    report.frontierSize = frontierSize;
+    report.residual = residual;
+    report.targetResidual = targetResidual;
+    report.elapsedSeconds = std::chrono::duration<double>(now - timeOfStart).count();
+    uint64_t const itemsSinceLastReport = count > lastReportedCount ? count - lastReportedCount : 0;
+    report.itemsPerSecond = millisecondsSinceLastReport > 0 ? static_cast<double>(itemsSinceLastReport) * 1000.0 / millisecondsSinceLastReport : 0.0;
+    if (report.itemsPerSecond > 0.0) {
+        if (report.maxCount) {
+            report.estimatedSecondsRemaining = static_cast<double>(*report.maxCount > count ? *report.maxCount - count : 0) / report.itemsPerSecond;
+        } else if (residual && targetResidual && lastReportedResidual && *residual < *lastReportedResidual && *residual > 0.0) {
+            // Assume that the residual decreases geometrically, which is the case for value iteration in the long run.
+            double const factorPerItem = std::pow(*residual / *lastReportedResidual, 1.0 / itemsSinceLastReport);
+            double const remainingItems = *residual > *targetResidual ? std::log(*targetResidual / *residual) / std::log(factorPerItem) : 0.0;
+            report.estimatedSecondsRemaining = remainingItems / report.itemsPerSecond;
+        }
+    }
+
+    ProgressCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(detail::progressCallbackMutex);
+        callback = detail::progressCallback;
+    }
+    if (callback && !callback(report)) {
+        STORM_LOG_INFO("Termination requested by the progress callback.");
+        storm::utility::resources::SignalInformation::infos().setTerminate(true);
+    }
+    lastReportedCount = count;
+    lastReportedResidual = residual;
+    timeOfLastReport = std::chrono::high_resolution_clock::now();
+    return true;
+}
+
+void ProgressMeasurement::setFrontierSize(uint64_t frontierSize) {
+    this->frontierSize = frontierSize;
+}
+
+void ProgressMeasurement::setResidual(double residual, double targetResidual) {
+    this->residual = residual;
+    this->targetResidual = targetResidual;
+}
+
 bool ProgressMeasurement::updateProgress(uint64_t count, std::ostream& outstream) {
     auto now = std::chrono::high_resolution_clock::now();
     // Get the duration since the last message in milliseconds.
@@ -2,11 +2,66 @@
 
 #include <boost/optional.hpp>
 #include <chrono>
+#include <functional>
+#include <optional>
 #include <ostream>
 
 namespace storm {
 namespace utility {
 
+/*!
+ * A snapshot of the progress of a long running computation (e.g., building a model or solving an equation system) that is passed to the progress callback.
+ */
+struct ProgressReport {
+    // The name of what is counted (iterations, states, ...).
+    std::string itemName;
+    // The number of completed items, e.g., the explored states or the performed iterations.
+    uint64_t count;
+    // The number of items that are required to complete the computation (if known).
+    std::optional<uint64_t> maxCount;
+    // The number of discovered but not yet processed items (if applicable), e.g., the states that are still to be explored.
+    std::optional<uint64_t> frontierSize;
+    // The current residual of an iterative computation and the residual that is required for convergence (if applicable).
+    std::optional<double> residual;
+    std::optional<double> targetResidual;
+    // The time since the start of the measurement.
+    double elapsedSeconds;
+    // The number of items per second since the previous report.
+    double itemsPerSecond;
+    // The estimated time until the computation completes. Derived from the maximal count or from the decrease of the residual (if available).
+    std::optional<double> estimatedSecondsRemaining;
+};
+
+/*!
+ * A callback receiving progress reports. Returning false requests the termination of the computation (just like a termination signal would),
+ * upon which solvers stop and provide their current (best-so-far) values.
+ */
+typedef std::function<bool(ProgressReport const&)> ProgressCallback;
+
+/*!
+ * Registers a callback that is informed about the progress of all progress measurements, independent of the showProgress setting.
+ * The callback might be invoked concurrently by different threads.
+ *
+ * @param interval The minimal time between two reports of the same measurement.
+ */
+void setProgressCallback(ProgressCallback const& callback, std::chrono::milliseconds const& interval = std::chrono::milliseconds(500));
+
+/*!
+ * Removes a previously registered progress callback.
+ */
+void clearProgressCallback();
+
+/*!
+ * Retrieves whether a progress callback is registered.
+ */
+bool hasProgressCallback();
+
+/*!
+ * Publishes the residual of the current iteration of an iterative computation of the calling thread. It is attached to the next report of a progress
+ * measurement by the same thread. This allows helpers (that do not know about the measurement) to provide the residual.
+ */
+void publishResidual(double residual, double targetResidual);
+
 /*!
  * A class that provides convenience operations to display run times.
  */
@@ -47,6 +102,24 @@ class ProgressMeasurement {
      */
     bool updateProgress(uint64_t count, std::ostream& outstream);
 
+    /*!
+     * Informs the progress callback (if any and if its interval passed) about the current count without printing anything.
+     *
+     * @param count The currently achieved count.
+     * @return True iff the callback was invoked.
+     */
+    bool reportProgress(uint64_t count);
+
+    /*!
+     * Sets the number of discovered but not yet processed items that is attached to the following reports.
+     */
+    void setFrontierSize(uint64_t frontierSize);
+
+    /*!
+     * Sets the current residual and the residual required for convergence that are attached to the following reports.
+     */
+    void setResidual(double residual, double targetResidual);
+
     /*!
      * Returns whether a maximal count (which is required to achieve 100% progress) has been specified
      */
@@ -106,6 +179,16 @@ class ProgressMeasurement {
 
     std::chrono::high_resolution_clock::time_point timeOfStart;
     std::chrono::high_resolution_clock::time_point timeOfLastMessage;
+
+    // The count, the residual and the time of the last report to the progress callback.
+    uint64_t lastReportedCount;
+    std::optional<double> lastReportedResidual;
+    std::chrono::high_resolution_clock::time_point timeOfLastReport;
+
+    // The values attached to the next report.
+    std::optional<uint64_t> frontierSize;
+    std::optional<double> residual;
+    std::optional<double> targetResidual;
 };
 
 }  // namespace utility
@@ -0,0 +1,228 @@
+#include "storm/utility/Telemetry.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+namespace telemetry {
+
+namespace {
+uint64_t const noRecord = std::numeric_limits<uint64_t>::max();
+
+// The maximal number of values of a series that are recorded
+uint64_t const maximalSeriesLength = 10000;
+
+struct Record {
+    std::string name;
+    uint64_t parent;
+    uint64_t thread;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+    bool isOpen;
+    uint64_t peakRssAtStart;
+    uint64_t peakRssAtEnd;
+    storm::json<double> attributes;
+};
+
+std::atomic<bool> enabled{false};
+std::mutex mutex;
+// Records are only appended (until they are cleared), so their indices remain valid
+std::deque<Record> records;
+std::chrono::steady_clock::time_point const origin = std::chrono::steady_clock::now();
+std::atomic<uint64_t> numberOfThreads{0};
+
+// The records of the scopes opened by the calling thread that are still open (innermost last)
+thread_local std::vector<uint64_t> openScopes;
+thread_local uint64_t const threadIndex = numberOfThreads++;
+
+// Returns the peak resident set size of the process in kilobytes (or zero if unknown)
+uint64_t getPeakRss() {
+#if defined LINUX
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // For Linux, this is returned in kilobytes.
+    return ru.ru_maxrss;
+#elif defined MACOS
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    // For Mac OS, this is returned in bytes.
+    return ru.ru_maxrss / 1024;
+#else
+    return 0;
+#endif
+}
+
+uint64_t toMicroseconds(std::chrono::steady_clock::time_point const& time) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - origin).count();
+}
+
+// Sets the attribute of the innermost open scope of the calling thread (if any)
+template<typename T>
+void setAttributeOfCurrentScope(std::string const& key, T const& value) {
+    if (!enabled || openScopes.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    records[openScopes.back()].attributes[key] = value;
+}
+
+storm::json<double> toJson(std::vector<std::vector<uint64_t>> const& children, uint64_t recordIndex, std::chrono::steady_clock::time_point const& now) {
+    Record const& record = records[recordIndex];
+    auto end = record.isOpen ? now : record.end;
+    uint64_t peakRssAtEnd = record.isOpen ? getPeakRss() : record.peakRssAtEnd;
+    storm::json<double> result;
+    result["name"] = record.name;
+    result["thread"] = record.thread;
+    result["start-us"] = toMicroseconds(record.start);
+    result["time-us"] = toMicroseconds(end) - toMicroseconds(record.start);
+    result["peak-rss-kb"] = peakRssAtEnd;
+    result["peak-rss-increase-kb"] = peakRssAtEnd - record.peakRssAtStart;
+    if (record.isOpen) {
+        result["open"] = true;
+    }
+    if (!record.attributes.empty()) {
+        result["attributes"] = record.attributes;
+    }
+    if (!children[recordIndex].empty()) {
+        storm::json<double> childScopes = storm::json<double>::array();
+        for (auto const& child : children[recordIndex]) {
+            childScopes.push_back(toJson(children, child, now));
+        }
+        result["scopes"] = std::move(childScopes);
+    }
+    return result;
+}
+}  // namespace
+
+void setEnabled(bool value) {
+    enabled = value;
+}
+
+bool isEnabled() {
+    return enabled;
+}
+
+bool isRecording() {
+    return enabled && !openScopes.empty();
+}
+
+Scope::Scope(std::string const& name) : record(noRecord) {
+    if (!enabled) {
+        return;
+    }
+    uint64_t parent = openScopes.empty() ? noRecord : openScopes.back();
+    uint64_t peakRss = getPeakRss();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        record = records.size();
+        records.push_back(Record{name, parent, threadIndex, std::chrono::steady_clock::now(), {}, true, peakRss, peakRss, storm::json<double>::object()});
+    }
+    openScopes.push_back(record);
+}
+
+Scope::~Scope() {
+    if (record == noRecord) {
+        return;
+    }
+    STORM_LOG_ASSERT(!openScopes.empty() && openScopes.back() == record, "Telemetry scopes are not closed in reverse order of opening.");
+    openScopes.pop_back();
+    uint64_t peakRss = getPeakRss();
+    std::lock_guard<std::mutex> lock(mutex);
+    Record& closedRecord = records[record];
+    closedRecord.end = std::chrono::steady_clock::now();
+    closedRecord.isOpen = false;
+    closedRecord.peakRssAtEnd = peakRss;
+}
+
+void setAttribute(std::string const& key, std::string const& value) {
+    setAttributeOfCurrentScope(key, value);
+}
+
+void setAttribute(std::string const& key, uint64_t value) {
+    setAttributeOfCurrentScope(key, value);
+}
+
+void setAttribute(std::string const& key, double value) {
+    setAttributeOfCurrentScope(key, value);
+}
+
+void appendToSeries(std::string const& key, double value) {
+    if (!enabled || openScopes.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& attributes = records[openScopes.back()].attributes;
+    auto& series = attributes[key];
+    if (series.is_null()) {
+        series = storm::json<double>::array();
+    }
+    if (series.size() < maximalSeriesLength) {
+        series.push_back(value);
+    } else {
+        attributes[key + "-truncated"] = true;
+    }
+}
+
+void exportJson(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto now = std::chrono::steady_clock::now();
+    std::vector<std::vector<uint64_t>> children(records.size() + 1);
+    for (uint64_t recordIndex = 0; recordIndex < records.size(); ++recordIndex) {
+        uint64_t parent = records[recordIndex].parent;
+        // Top-level scopes are collected in the last entry
+        children[parent == noRecord ? records.size() : parent].push_back(recordIndex);
+    }
+    storm::json<double> result;
+    result["peak-rss-kb"] = getPeakRss();
+    storm::json<double> scopes = storm::json<double>::array();
+    for (auto const& recordIndex : children.back()) {
+        scopes.push_back(toJson(children, recordIndex, now));
+    }
+    result["scopes"] = std::move(scopes);
+    out << storm::dumpJson(result);
+}
+
+void exportChromeTrace(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto now = std::chrono::steady_clock::now();
+    storm::json<double> events = storm::json<double>::array();
+    for (auto const& record : records) {
+        auto end = record.isOpen ? now : record.end;
+        storm::json<double> event;
+        event["name"] = record.name;
+        event["cat"] = "storm";
+        event["ph"] = "X";
+        event["pid"] = 0;
+        event["tid"] = record.thread;
+        event["ts"] = toMicroseconds(record.start);
+        event["dur"] = toMicroseconds(end) - toMicroseconds(record.start);
+        storm::json<double> args = record.attributes;
+        args["peak-rss-kb"] = record.isOpen ? getPeakRss() : record.peakRssAtEnd;
+        args["peak-rss-at-start-kb"] = record.peakRssAtStart;
+        event["args"] = std::move(args);
+        events.push_back(std::move(event));
+    }
+    storm::json<double> result;
+    result["traceEvents"] = std::move(events);
+    result["displayTimeUnit"] = "ms";
+    out << storm::dumpJson(result, true);
+}
+
+void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    STORM_LOG_ASSERT(openScopes.empty(), "Telemetry is cleared while a scope is open.");
+    records.clear();
+}
+
+}  // namespace telemetry
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+namespace utility {
+namespace telemetry {
+
+/*!
+ * Enables or disables the recording of telemetry. Recording is disabled by default, in which case opening a scope only checks a flag.
+ */
+void setEnabled(bool value);
+
+/*!
+ * Retrieves whether telemetry is recorded.
+ */
+bool isEnabled();
+
+/*!
+ * Retrieves whether telemetry is recorded and the calling thread has an open scope, i.e., whether attributes set by the calling thread are recorded.
+ * Can be used to avoid computing attributes that would be discarded anyway.
+ */
+bool isRecording();
+
+/*!
+ * A named phase of the computation that is recorded from its construction to its destruction (if telemetry is enabled).
+ * Scopes opened by the same thread while another scope is open become children of that scope. For each scope, the wallclock time, the peak
+ * resident set size of the process at its start and end, and the attributes set while it is the innermost open scope of its thread are recorded.
+ * As the peak resident set size is measured for the whole process, it is attributed to concurrently running scopes alike.
+ */
+class Scope {
+   public:
+    explicit Scope(std::string const& name);
+    ~Scope();
+    Scope(Scope const& other) = delete;
+    Scope& operator=(Scope const& other) = delete;
+
+   private:
+    // The index of the record of this scope or the maximal value if the scope is not recorded.
+    uint64_t record;
+};
+
+/*!
+ * Sets an attribute of the innermost open scope of the calling thread. Does nothing if there is no such scope.
+ */
+void setAttribute(std::string const& key, std::string const& value);
+void setAttribute(std::string const& key, uint64_t value);
+void setAttribute(std::string const& key, double value);
+
+/*!
+ * Appends a value to a series (e.g., the residuals of an iterative solver) of the innermost open scope of the calling thread.
+ * Does nothing if there is no such scope. Series are truncated after a fixed number of values to bound the memory consumption.
+ */
+void appendToSeries(std::string const& key, double value);
+
+/*!
+ * Writes the recorded scopes as a tree of nested scopes in the json format.
+ */
+void exportJson(std::ostream& out);
+
+/*!
+ * Writes the recorded scopes as complete events in the Chrome trace event format (e.g., for chrome://tracing or Perfetto).
+ */
+void exportChromeTrace(std::ostream& out);
+
+/*!
+ * Discards all recorded scopes. Must not be called while a scope is open.
+ */
+void clear();
+
+}  // namespace telemetry
+}  // namespace utility
+}  // namespace storm
@@ -991,6 +991,17 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float (used for single precision value iteration)
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isInfinity(float const& value);
+template float max(float const& first, float const& second);
+template float min(float const& first, float const& second);
+template float abs(float const& number);
+
 // int
 template int one();
 template int zero();
@@ -1,5 +1,8 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -49,6 +52,92 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
     return {reachableStates, iteration};
 }
 
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+    std::vector<std::set<storm::expressions::Variable>> const& componentRowMetaVariables, storm::builder::SymbolicReachabilityStrategy const& strategy) {
+    if (strategy == storm::builder::SymbolicReachabilityStrategy::Bfs) {
+        return computeReachableStates(initialStates, transitions, rowMetaVariables, columnMetaVariables);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::DdManager<Type> const& manager = transitions.getDdManager();
+
+    // Split the transitions into the parts that only change the variables of a single component. Each part is associated with the bottom-most level
+    // of the variables of the component. The remaining transitions are kept in a separate part that is associated with the top-most level.
+    std::vector<std::pair<storm::dd::Bdd<Type>, uint64_t>> partitions;
+    storm::dd::Bdd<Type> remainingTransitions = transitions;
+    for (auto const& componentVariables : componentRowMetaVariables) {
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> otherRowColumnMetaVariablePairs;
+        uint64_t level = 0;
+        for (auto const& rowColumnPair : rowColumnMetaVariablePairs) {
+            if (componentVariables.count(rowColumnPair.first) > 0) {
+                level = std::max({level, manager.getMetaVariable(rowColumnPair.first).getHighestLevel(),
+                                  manager.getMetaVariable(rowColumnPair.second).getHighestLevel()});
+            } else {
+                otherRowColumnMetaVariablePairs.push_back(rowColumnPair);
+            }
+        }
+        storm::dd::Bdd<Type> localTransitions = remainingTransitions && getRowColumnDiagonal(manager, otherRowColumnMetaVariablePairs);
+        if (!localTransitions.isZero()) {
+            remainingTransitions &= !localTransitions;
+            partitions.emplace_back(localTransitions, level);
+        }
+    }
+    if (!remainingTransitions.isZero()) {
+        partitions.emplace_back(remainingTransitions, 0);
+    }
+    std::stable_sort(partitions.begin(), partitions.end(), [](auto const& lhs, auto const& rhs) { return lhs.second > rhs.second; });
+    STORM_LOG_TRACE("Computing reachable states using " << strategy << " with " << partitions.size() << " transition partition(s).");
+
+    storm::dd::Bdd<Type> reachableStates = initialStates;
+    uint64_t numberOfImages = 0;
+    if (strategy == storm::builder::SymbolicReachabilityStrategy::Chaining) {
+        // Apply the partitions one after another. States found by one partition are already considered by the subsequent ones.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto const& partition : partitions) {
+                storm::dd::Bdd<Type> newReachableStates =
+                    reachableStates.relationalProduct(partition.first, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++numberOfImages;
+                if (!newReachableStates.isZero()) {
+                    reachableStates |= newReachableStates;
+                    changed = true;
+                }
+            }
+        }
+    } else {
+        STORM_LOG_ASSERT(strategy == storm::builder::SymbolicReachabilityStrategy::Saturation, "Unexpected strategy.");
+        uint64_t index = 0;
+        while (index < partitions.size()) {
+            // Saturate the reachable states with respect to the current partition.
+            bool changed = false;
+            storm::dd::Bdd<Type> frontier = reachableStates;
+            while (true) {
+                frontier = frontier.relationalProduct(partitions[index].first, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                ++numberOfImages;
+                if (frontier.isZero()) {
+                    break;
+                }
+                reachableStates |= frontier;
+                changed = true;
+            }
+
+            // The new states may enable transitions of the partitions further down, so these have to be saturated again.
+            index = (changed && index > 0) ? 0 : index + 1;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Reachability computation completed after " << numberOfImages << " image computations ("
+                                                                << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms), "
+                                                                << reachableStates.getNonZeroCount() << " reachable states found.");
+    return {reachableStates, numberOfImages};
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -87,6 +176,151 @@ storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const&
     return reachableStates;
 }
 
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> computeStronglyConnectedComponents(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions,
+                                                                     std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                     std::set<storm::expressions::Variable> const& columnMetaVariables) {
+    auto start = std::chrono::high_resolution_clock::now();
+    storm::dd::Bdd<Type> const zero = states.getDdManager().getBddZero();
+    std::vector<storm::dd::Bdd<Type>> components;
+    uint64_t numberOfImages = 0;
+
+    // Each task consists of a set of states, a skeleton (a path within the states that ends in the pivot) and the pivot. If the skeleton is empty, an
+    // arbitrary pivot is picked.
+    struct Task {
+        storm::dd::Bdd<Type> states;
+        storm::dd::Bdd<Type> skeleton;
+        storm::dd::Bdd<Type> pivot;
+    };
+    std::vector<Task> tasks = {{states, zero, zero}};
+    while (!tasks.empty()) {
+        Task task = std::move(tasks.back());
+        tasks.pop_back();
+        if (task.states.isZero()) {
+            continue;
+        }
+        if (task.skeleton.isZero()) {
+            task.pivot = task.states.existsAbstractRepresentative(rowMetaVariables);
+        }
+
+        // Compute the forward set of the pivot layer by layer.
+        std::vector<storm::dd::Bdd<Type>> layers = {task.pivot};
+        storm::dd::Bdd<Type> forwardStates = task.pivot;
+        while (true) {
+            storm::dd::Bdd<Type> nextLayer =
+                layers.back().relationalProduct(transitions, rowMetaVariables, columnMetaVariables) && task.states && !forwardStates;
+            ++numberOfImages;
+            if (nextLayer.isZero()) {
+                break;
+            }
+            forwardStates |= nextLayer;
+            layers.push_back(std::move(nextLayer));
+        }
+
+        // Walk back through the layers to obtain a path from the pivot to some state of the last layer. That state becomes the pivot within the forward set.
+        storm::dd::Bdd<Type> forwardPivot = layers.back().existsAbstractRepresentative(rowMetaVariables);
+        storm::dd::Bdd<Type> forwardSkeleton = forwardPivot;
+        storm::dd::Bdd<Type> current = forwardPivot;
+        for (auto layerIt = layers.rbegin() + 1; layerIt != layers.rend(); ++layerIt) {
+            current = (current.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables) && *layerIt)
+                          .existsAbstractRepresentative(rowMetaVariables);
+            ++numberOfImages;
+            forwardSkeleton |= current;
+        }
+
+        // The component of the pivot consists of the states of the forward set that can reach the pivot.
+        storm::dd::Bdd<Type> component = task.pivot;
+        storm::dd::Bdd<Type> frontier = task.pivot;
+        while (true) {
+            frontier = frontier.inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables) && forwardStates && !component;
+            ++numberOfImages;
+            if (frontier.isZero()) {
+                break;
+            }
+            component |= frontier;
+        }
+
+        // The remaining states outside of the forward set keep the part of the skeleton that leads to the component. Its last state becomes the pivot.
+        storm::dd::Bdd<Type> remainingSkeleton = task.skeleton && !component;
+        storm::dd::Bdd<Type> remainingPivot = zero;
+        if (!remainingSkeleton.isZero()) {
+            remainingPivot = (task.skeleton && component).inverseRelationalProduct(transitions, rowMetaVariables, columnMetaVariables) && remainingSkeleton;
+            remainingPivot = remainingPivot.existsAbstractRepresentative(rowMetaVariables);
+            ++numberOfImages;
+        }
+        tasks.push_back({task.states && !forwardStates, std::move(remainingSkeleton), std::move(remainingPivot)});
+        tasks.push_back({forwardStates && !component, forwardSkeleton && !component, forwardPivot && !component});
+        components.push_back(std::move(component));
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Found " << components.size() << " strongly connected component(s) with " << numberOfImages << " image computations in "
+                             << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    return components;
+}
+
+template<storm::dd::DdType Type>
+std::vector<std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>>> computeMaximalEndComponentDecomposition(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>>> endComponents;
+
+    std::vector<storm::dd::Bdd<Type>> candidates = {states};
+    while (!candidates.empty()) {
+        storm::dd::Bdd<Type> candidate = std::move(candidates.back());
+        candidates.pop_back();
+
+        // Remove all choices that leave the candidate (and the states without remaining choices) until a fixpoint is reached.
+        storm::dd::Bdd<Type> candidateChoices;
+        while (true) {
+            storm::dd::Bdd<Type> candidateTransitions = transitions && candidate;
+            storm::dd::Bdd<Type> leavingChoices =
+                (candidateTransitions && !candidate.swapVariables(rowColumnMetaVariablePairs)).existsAbstract(columnMetaVariables);
+            candidateChoices = candidateTransitions.existsAbstract(columnMetaVariables) && !leavingChoices;
+            storm::dd::Bdd<Type> newCandidate = candidateChoices.existsAbstract(choiceMetaVariables);
+            if (newCandidate == candidate) {
+                break;
+            }
+            candidate = newCandidate;
+        }
+        if (candidate.isZero()) {
+            continue;
+        }
+
+        // Split the candidate into the strongly connected components with respect to the remaining choices. Every end component of the candidate is
+        // contained in one of them.
+        storm::dd::Bdd<Type> stateTransitions = (transitions && candidateChoices).existsAbstract(choiceMetaVariables);
+        std::vector<storm::dd::Bdd<Type>> components = computeStronglyConnectedComponents(candidate, stateTransitions, rowMetaVariables, columnMetaVariables);
+        if (components.size() == 1) {
+            endComponents.emplace_back(std::move(candidate), std::move(candidateChoices));
+        } else {
+            candidates.insert(candidates.end(), std::make_move_iterator(components.begin()), std::make_move_iterator(components.end()));
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    STORM_LOG_TRACE("Found " << endComponents.size() << " maximal end component(s) in "
+                             << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+    return endComponents;
+}
+
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>> computeMaximalEndComponents(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+    storm::dd::Bdd<Type> endComponentRelation = states.getDdManager().getBddZero();
+    storm::dd::Bdd<Type> endComponentChoices = endComponentRelation;
+    for (auto const& endComponent : computeMaximalEndComponentDecomposition(states, transitions, rowMetaVariables, columnMetaVariables, choiceMetaVariables,
+                                                                            rowColumnMetaVariablePairs)) {
+        endComponentRelation |= endComponent.first && endComponent.first.swapVariables(rowColumnMetaVariablePairs);
+        endComponentChoices |= endComponent.second;
+    }
+    return std::make_pair(endComponentRelation, endComponentChoices);
+}
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
@@ -102,6 +336,17 @@ template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeR
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
     std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+    std::vector<std::set<storm::expressions::Variable>> const& componentRowMetaVariables, storm::builder::SymbolicReachabilityStrategy const& strategy);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+    std::vector<std::set<storm::expressions::Variable>> const& componentRowMetaVariables, storm::builder::SymbolicReachabilityStrategy const& strategy);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates,
                                                                                  storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
@@ -113,6 +358,36 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStat
                                                                                    std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                                    std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> computeStronglyConnectedComponents(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeStronglyConnectedComponents(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
+
+template std::vector<std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, storm::dd::Bdd<storm::dd::DdType::CUDD>>> computeMaximalEndComponentDecomposition(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::vector<std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>>>
+computeMaximalEndComponentDecomposition(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+                                        std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                        std::set<storm::expressions::Variable> const& columnMetaVariables,
+                                        std::set<storm::expressions::Variable> const& choiceMetaVariables,
+                                        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, storm::dd::Bdd<storm::dd::DdType::CUDD>> computeMaximalEndComponents(
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> computeMaximalEndComponents(
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions,
+    std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
@@ -4,6 +4,7 @@
 #include <set>
 #include <vector>
 
+#include "storm/builder/SymbolicReachabilityStrategy.h"
 #include "storm/storage/dd/DdType.h"
 
 namespace storm {
@@ -29,11 +30,74 @@ std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<
                                                                  std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                                  std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the states that are reachable from the initial states. The transitions are split into one part per component (e.g. a module or an automaton)
+ * that contains the transitions that leave the variables of all other components unchanged and one part with the remaining transitions. Depending on the
+ * strategy, the parts are either applied one after another until a fixpoint is reached (chaining) or the reachable states are saturated with respect to
+ * the part of the bottom-most component before moving upwards in the variable order (saturation). The breadth-first strategy applies all transitions at
+ * once.
+ *
+ * @param componentRowMetaVariables For each component, the row meta variables that are local to it.
+ * @return The reachable states and the number of performed image computations.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(
+    storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
+    std::vector<std::set<storm::expressions::Variable>> const& componentRowMetaVariables, storm::builder::SymbolicReachabilityStrategy const& strategy);
+
 template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates,
                                                      storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
                                                      std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+/*!
+ * Computes the strongly connected components of the graph induced by the given transitions and restricted to the given states. The components are
+ * determined with the skeleton-based algorithm of Gentilini, Piazza and Policriti (SODA 2003): each forward search remembers a path (the skeleton) to a
+ * state of its last layer. This path is used to pick the next pivot state in the forward set, which bounds the overall number of image computations
+ * linearly in the number of states.
+ *
+ * @param states The states (over the row meta variables) to which the graph is restricted.
+ * @param transitions The transitions as a BDD over the row and column meta variables.
+ * @return The strongly connected components, each given as a BDD over the row meta variables. Every state is contained in exactly one component (states
+ * that are not on a cycle form singleton components).
+ */
+template<storm::dd::DdType Type>
+std::vector<storm::dd::Bdd<Type>> computeStronglyConnectedComponents(storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions,
+                                                                     std::set<storm::expressions::Variable> const& rowMetaVariables,
+                                                                     std::set<storm::expressions::Variable> const& columnMetaVariables);
+
+/*!
+ * Computes the maximal end components of the given nondeterministic transitions within the given states. The end components are decomposed by repeatedly
+ * removing the choices that leave the current candidate and splitting the candidate into its strongly connected components.
+ * For deterministic transitions (i.e., without choice meta variables), the result are the bottom strongly connected components.
+ *
+ * @param states The states (over the row meta variables) in which to search for end components.
+ * @param transitions The transitions as a BDD over the row, choice and column meta variables.
+ * @return For each maximal end component, its states (over the row meta variables) and the choices that stay within the component (over the row and
+ * choice meta variables).
+ */
+template<storm::dd::DdType Type>
+std::vector<std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>>> computeMaximalEndComponentDecomposition(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+/*!
+ * Computes the maximal end components of the given nondeterministic transitions within the given states (see computeMaximalEndComponentDecomposition).
+ *
+ * @param states The states (over the row meta variables) in which to search for end components.
+ * @param transitions The transitions as a BDD over the row, choice and column meta variables.
+ * @return A BDD over the row and column meta variables that relates all states of the same maximal end component and a BDD over the row and choice meta
+ * variables that characterizes the choices that stay within the maximal end component of their state.
+ */
+template<storm::dd::DdType Type>
+std::pair<storm::dd::Bdd<Type>, storm::dd::Bdd<Type>> computeMaximalEndComponents(
+    storm::dd::Bdd<Type> const& states, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables,
+    std::set<storm::expressions::Variable> const& columnMetaVariables, std::set<storm::expressions::Variable> const& choiceMetaVariables,
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Add<Type, ValueType> getRowColumnDiagonal(
     storm::dd::DdManager<Type> const& ddManager,
@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/utility/OsDetection.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/storage/dd/Add.h"
@@ -23,15 +24,127 @@
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include <mutex>
+#include <optional>
 #include <queue>
 
 namespace storm {
 namespace utility {
 namespace graph {
 
+namespace detail {
+// Graphs with fewer states are searched sequentially as the synchronization overhead would dominate.
+static const uint64_t minimalNumberOfStatesForParallelSearch = 1ull << 16;
+// The number of frontier states that a task of the parallel search processes at least.
+static const uint64_t parallelSearchGrainSize = 256;
+
+bool useParallelSearch(uint64_t numberOfStates) {
+#ifdef STORM_HAVE_INTELTBB
+    return numberOfStates >= minimalNumberOfStatesForParallelSearch &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+/*!
+ * Performs a level-synchronous backward search in which the states of a level (the frontier) are processed in parallel. A predecessor of a
+ * frontier state is visited (and becomes part of the next frontier) if it is a candidate, has not been visited yet and satisfies the given
+ * condition. The condition may access the visited states only via BitVector::getAtomically. It has to be monotone, i.e., remain satisfied when
+ * more states are visited: A state that is rejected because a successor is visited concurrently is reconsidered on the next level.
+ *
+ * @param frontier The states to start from. Upon return, it is empty but keeps its capacity, so it can be reused for further searches.
+ * @param nextFrontier A buffer for the next level that can be reused for further searches.
+ * @param maximalLevels If given, at most this many levels are explored.
+ */
+template<typename T, typename Condition>
+void performParallelBackwardSearch(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& candidates,
+                                   storm::storage::BitVector& visited, std::vector<uint64_t>& frontier, std::vector<uint64_t>& nextFrontier,
+                                   Condition const& condition, std::optional<uint64_t> const& maximalLevels = std::nullopt) {
+#ifdef STORM_HAVE_INTELTBB
+    std::mutex nextFrontierMutex;
+    for (uint64_t level = 0; !frontier.empty() && (!maximalLevels || level < maximalLevels.value()); ++level) {
+        nextFrontier.clear();
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, frontier.size(), parallelSearchGrainSize), [&](tbb::blocked_range<uint64_t> const& range) {
+            std::vector<uint64_t> localFrontier;
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                for (auto const& entry : backwardTransitions.getRow(frontier[index])) {
+                    uint64_t const predecessor = entry.getColumn();
+                    if (candidates.get(predecessor) && !visited.getAtomically(predecessor) && condition(predecessor) && visited.setAtomically(predecessor)) {
+                        localFrontier.push_back(predecessor);
+                    }
+                }
+            }
+            std::lock_guard<std::mutex> lock(nextFrontierMutex);
+            nextFrontier.insert(nextFrontier.end(), localFrontier.begin(), localFrontier.end());
+        });
+        std::swap(frontier, nextFrontier);
+    }
+    frontier.clear();
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel graph searches require Intel TBB.");
+#endif
+}
+
+/*!
+ * Computes the states that can reach a psi state via phi states (within the given number of steps) using a parallel backward search.
+ */
+template<typename T>
+storm::storage::BitVector performParallelProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                      storm::storage::BitVector const& psiStates, std::optional<uint64_t> const& maximalSteps) {
+    storm::storage::BitVector result(psiStates);
+    std::vector<uint64_t> frontier(psiStates.begin(), psiStates.end());
+    std::vector<uint64_t> nextFrontier;
+    performParallelBackwardSearch(
+        backwardTransitions, phiStates, result, frontier, nextFrontier, [](uint64_t) { return true; }, maximalSteps);
+    return result;
+}
+
+/*!
+ * Computes the greatest fixpoint of prob1E and prob1A, whose rounds are least fixpoints computed by parallel backward searches. As the set of
+ * current states only shrinks, the candidates of a round are restricted to the current states and the frontier buffers are shared among rounds.
+ *
+ * @param choiceSatisfied Decides whether the given choice only leads to current states and has a successor in the visited states.
+ * @param universal If set, all (enabled) choices of a state have to be satisfied. Otherwise, one choice suffices.
+ */
+template<typename T, typename ChoiceCondition>
+storm::storage::BitVector performParallelProb1(storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint,
+                                               bool universal, ChoiceCondition const& choiceSatisfied) {
+    storm::storage::BitVector currentStates(phiStates.size(), true);
+    storm::storage::BitVector candidates(phiStates);
+    std::vector<uint64_t> frontier;
+    std::vector<uint64_t> nextFrontier;
+    while (true) {
+        storm::storage::BitVector nextStates(psiStates);
+        frontier.assign(psiStates.begin(), psiStates.end());
+        performParallelBackwardSearch(backwardTransitions, candidates, nextStates, frontier, nextFrontier, [&](uint64_t state) {
+            for (uint64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                if (!choiceConstraint || choiceConstraint->get(row)) {
+                    if (choiceSatisfied(row, currentStates, nextStates) != universal) {
+                        return !universal;
+                    }
+                }
+            }
+            return universal;
+        });
+
+        if (currentStates == nextStates) {
+            return currentStates;
+        }
+        currentStates = std::move(nextStates);
+        candidates &= currentStates;
+    }
+}
+}  // namespace detail
+
 template<typename T>
 storm::storage::BitVector getReachableOneStep(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
     storm::storage::BitVector result{initialStates.size()};
@@ -323,6 +436,10 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
+    if (detail::useParallelSearch(numberOfStates)) {
+        return detail::performParallelProbGreater0(backwardTransitions, phiStates, psiStates,
+                                                   useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
+    }
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
 
     // Add all psi states as they already satisfy the condition.
@@ -401,7 +518,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
+    auto const backwardTransitionsPtr = model.getBackwardTransitions();
+    storm::storage::SparseMatrix<T> const& backwardTransitions = *backwardTransitionsPtr;
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
     result.first.complement();
@@ -628,7 +746,7 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
     // set an arbitrary (valid) choice for the psi states.
     for (auto psiState : psiStates) {
         for (uint_fast64_t memState = 0; memState < scheduler.getNumberOfMemoryStates(); ++memState) {
-            if (!scheduler.getChoice(psiState, memState).isDefined()) {
+            if (!scheduler.isChoiceDefined(psiState, memState)) {
                 scheduler.setChoice(0, psiState, memState);
             }
         }
@@ -689,6 +807,10 @@ template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
     size_t numberOfStates = phiStates.size();
+    if (detail::useParallelSearch(numberOfStates)) {
+        return detail::performParallelProbGreater0(backwardTransitions, phiStates, psiStates,
+                                                   useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
+    }
 
     // Prepare resulting bit vector.
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -759,6 +881,20 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
+    if (detail::useParallelSearch(numberOfStates)) {
+        return detail::performParallelProb1(backwardTransitions, nondeterministicChoiceIndices, phiStates, psiStates, choiceConstraint, false,
+                                            [&transitionMatrix](uint64_t row, storm::storage::BitVector const& currentStates,
+                                                                storm::storage::BitVector const& nextStates) {
+                                                bool hasNextStateSuccessor = false;
+                                                for (auto const& entry : transitionMatrix.getRow(row)) {
+                                                    if (!currentStates.get(entry.getColumn())) {
+                                                        return false;
+                                                    }
+                                                    hasNextStateSuccessor |= nextStates.getAtomically(entry.getColumn());
+                                                }
+                                                return hasNextStateSuccessor;
+                                            });
+    }
 
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
@@ -849,7 +985,7 @@ template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
+    return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), *model.getBackwardTransitions(), phiStates,
                             psiStates);
 }
 
@@ -861,6 +997,29 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
+    // With a step bound, a state must not be justified by a successor that is found on the same level, so we then use the sequential search.
+    if (!useStepBound && detail::useParallelSearch(numberOfStates)) {
+        storm::storage::BitVector result(psiStates);
+        std::vector<uint64_t> frontier(psiStates.begin(), psiStates.end());
+        std::vector<uint64_t> nextFrontier;
+        detail::performParallelBackwardSearch(backwardTransitions, phiStates, result, frontier, nextFrontier, [&](uint64_t state) {
+            uint64_t const endOfGroup = nondeterministicChoiceIndices[state + 1];
+            if (choiceConstraint && choiceConstraint->getNextSetIndex(nondeterministicChoiceIndices[state]) >= endOfGroup) {
+                return false;
+            }
+            for (uint64_t row = nondeterministicChoiceIndices[state]; row < endOfGroup; ++row) {
+                if (!choiceConstraint || choiceConstraint->get(row)) {
+                    auto const& successors = transitionMatrix.getRow(row);
+                    if (std::none_of(successors.begin(), successors.end(), [&result](auto const& entry) { return result.getAtomically(entry.getColumn()); })) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        });
+        return result;
+    }
+
     // Prepare resulting bit vector.
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
 
@@ -1006,6 +1165,20 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates) {
     size_t numberOfStates = phiStates.size();
+    if (detail::useParallelSearch(numberOfStates)) {
+        return detail::performParallelProb1(backwardTransitions, nondeterministicChoiceIndices, phiStates, psiStates, boost::none, true,
+                                            [&transitionMatrix](uint64_t row, storm::storage::BitVector const& currentStates,
+                                                                storm::storage::BitVector const& nextStates) {
+                                                bool hasNextStateSuccessor = false;
+                                                for (auto const& entry : transitionMatrix.getRow(row)) {
+                                                    if (!currentStates.get(entry.getColumn())) {
+                                                        return false;
+                                                    }
+                                                    hasNextStateSuccessor |= nextStates.getAtomically(entry.getColumn());
+                                                }
+                                                return hasNextStateSuccessor;
+                                            });
+    }
 
     // Initialize the environment for the iterative algorithm.
     storm::storage::BitVector currentStates(numberOfStates, true);
@@ -1094,7 +1267,7 @@ template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
+    return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), *model.getBackwardTransitions(), phiStates,
                             psiStates);
 }
 
@@ -0,0 +1,98 @@
+#include "storm/utility/memory.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm::utility::memory {
+
+namespace detail {
+// Matrix entries, row indications and row group indices use 64 bit indices.
+uint64_t const indexBytes = 8;
+// A rational number stores numerator and denominator plus their (typically small) limbs.
+uint64_t const rationalBytes = 48;
+// The stacks and bit vectors of an SCC decomposition need a few words per state.
+uint64_t const sccBytesPerState = 4 * indexBytes;
+}  // namespace detail
+
+uint64_t getValueBytes(bool exact) {
+    return exact ? detail::rationalBytes : sizeof(double);
+}
+
+uint64_t estimateSparseMatrixBytes(uint64_t rows, uint64_t entries, uint64_t rowGroups, uint64_t valueBytes) {
+    return entries * (detail::indexBytes + valueBytes) + (rows + 1) * detail::indexBytes + (rowGroups + 1) * detail::indexBytes;
+}
+
+uint64_t estimateSolverVectorBytes(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t valueBytes) {
+    // The number of vectors with one entry per state. Every method additionally keeps a right-hand side with one entry per row.
+    uint64_t stateVectors;
+    uint64_t additionalBytes = 0;
+    switch (method) {
+        case storm::solver::MinMaxMethod::Acyclic:
+        case storm::solver::MinMaxMethod::AsyncGaussSeidel:
+            stateVectors = 1;
+            break;
+        case storm::solver::MinMaxMethod::ValueIteration:
+            // The operand and the auxiliary vector of regular multiplication.
+            stateVectors = 2;
+            break;
+        case storm::solver::MinMaxMethod::Topological:
+            stateVectors = 2;
+            additionalBytes = states * detail::sccBytesPerState;
+            break;
+        case storm::solver::MinMaxMethod::PolicyIteration:
+        case storm::solver::MinMaxMethod::ViToPi:
+            // Besides the values, the scheduler and the right-hand side of the induced system are stored.
+            stateVectors = 3;
+            additionalBytes = states * detail::indexBytes;
+            break;
+        case storm::solver::MinMaxMethod::IntervalIteration:
+        case storm::solver::MinMaxMethod::SoundValueIteration:
+        case storm::solver::MinMaxMethod::OptimisticValueIteration:
+            // Lower and upper values together with their auxiliary vectors.
+            stateVectors = 4;
+            break;
+        case storm::solver::MinMaxMethod::RationalSearch:
+            // Value iteration vectors plus the rationalized candidates.
+            stateVectors = 4;
+            additionalBytes = states * detail::rationalBytes;
+            break;
+        case storm::solver::MinMaxMethod::LinearProgramming:
+            // The LP solver holds a copy of all constraints.
+            stateVectors = 1;
+            additionalBytes = rows * (detail::indexBytes + valueBytes) * 4;
+            break;
+        default:
+            stateVectors = 4;
+            break;
+    }
+    return stateVectors * states * valueBytes + rows * valueBytes + additionalBytes;
+}
+
+uint64_t estimateMecDecompositionBytes(uint64_t states, uint64_t rows, uint64_t entries) {
+    // The decomposition works on the backward transitions and repeatedly decomposes the states into SCCs.
+    return estimateSparseMatrixBytes(rows, entries, states, 0) + states * detail::sccBytesPerState;
+}
+
+uint64_t estimateSparseVerificationBytes(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t entries, bool nondeterministic,
+                                         uint64_t valueBytes) {
+    uint64_t result = estimateSparseMatrixBytes(rows, entries, states, valueBytes);
+    // The graph-based precomputations need the backward transitions.
+    result += estimateSparseMatrixBytes(states, entries, states, 0);
+    result += estimateSolverVectorBytes(nondeterministic ? method : storm::solver::MinMaxMethod::ValueIteration, states, rows, valueBytes);
+    if (nondeterministic) {
+        result += estimateMecDecompositionBytes(states, rows, entries);
+    }
+    return result;
+}
+
+storm::solver::MinMaxMethod selectMinMaxMethod(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t valueBytes,
+                                               uint64_t budget) {
+    uint64_t required = estimateSolverVectorBytes(method, states, rows, valueBytes);
+    if (required <= budget || method == storm::solver::MinMaxMethod::ValueIteration) {
+        return method;
+    }
+    STORM_LOG_WARN("The solution method " << storm::solver::toString(method) << " needs about " << (required >> 20)
+                                          << " MB, which exceeds the memory budget of " << (budget >> 20) << " MB. Falling back to value iteration.");
+    return storm::solver::MinMaxMethod::ValueIteration;
+}
+
+}  // namespace storm::utility::memory
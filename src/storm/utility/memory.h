@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm::utility::memory {
+
+/*!
+ * Rough estimates of the memory needed by the main data structures of an analysis. They are meant to decide between alternatives before anything is
+ * allocated and thus deliberately ignore small (e.g. constant) overheads.
+ */
+
+/*!
+ * Retrieves the (approximate) number of bytes that are needed to store a single value.
+ *
+ * @param exact Whether the values are rational numbers rather than floating point numbers.
+ */
+uint64_t getValueBytes(bool exact);
+
+/*!
+ * Estimates the bytes of a sparse matrix with the given dimensions.
+ */
+uint64_t estimateSparseMatrixBytes(uint64_t rows, uint64_t entries, uint64_t rowGroups, uint64_t valueBytes);
+
+/*!
+ * Estimates the bytes of the vectors that the given method for solving MinMax equation systems allocates, i.e., the operands, the right-hand side
+ * and method specific auxiliary vectors (e.g. the second bound of interval iteration). The matrix itself is not included.
+ */
+uint64_t estimateSolverVectorBytes(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t valueBytes);
+
+/*!
+ * Estimates the bytes needed to compute the maximal end component decomposition of a model with the given dimensions.
+ */
+uint64_t estimateMecDecompositionBytes(uint64_t states, uint64_t rows, uint64_t entries);
+
+/*!
+ * Estimates the peak number of bytes of verifying an unbounded property on an explicitly stored model with the given dimensions using the given method.
+ */
+uint64_t estimateSparseVerificationBytes(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t entries, bool nondeterministic,
+                                         uint64_t valueBytes);
+
+/*!
+ * Retrieves the given method if it fits the memory budget. Otherwise, the method with the smallest footprint (value iteration) is returned.
+ */
+storm::solver::MinMaxMethod selectMinMaxMethod(storm::solver::MinMaxMethod const& method, uint64_t states, uint64_t rows, uint64_t valueBytes,
+                                               uint64_t budget);
+
+}  // namespace storm::utility::memory
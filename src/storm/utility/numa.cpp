@@ -0,0 +1,153 @@
+#include "storm/utility/numa.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/macros.h"
+
+#if defined(STORM_HAVE_INTELTBB) && defined(__linux__)
+#define STORM_NUMA_SUPPORTED
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace storm::utility::numa {
+
+#ifdef STORM_NUMA_SUPPORTED
+namespace detail {
+// Flag of the move_pages system call that moves pages that are only mapped by this process (see linux/mempolicy.h).
+int const moveFlag = 1 << 1;
+// The number of pages that are moved with a single system call.
+uint64_t const pagesPerCall = 1024;
+
+/*!
+ * Retrieves the NUMA node of the given CPU as given in sysfs (or 0 if it is unknown).
+ */
+int getNodeOfCpu(int cpu) {
+    std::error_code errorCode;
+    std::filesystem::directory_iterator entryIt("/sys/devices/system/cpu/cpu" + std::to_string(cpu), errorCode);
+    if (!errorCode) {
+        for (auto const& entry : entryIt) {
+            std::string const name = entry.path().filename().string();
+            auto isDigit = [](unsigned char c) { return std::isdigit(c) != 0; };
+            if (name.size() > 4 && name.compare(0, 4, "node") == 0 && std::all_of(name.begin() + 4, name.end(), isDigit)) {
+                return std::stoi(name.substr(4));
+            }
+        }
+    }
+    return 0;
+}
+
+/*!
+ * Retrieves the CPUs this process may run on, ordered such that consecutive CPUs alternate between the NUMA nodes.
+ */
+std::vector<int> getCpusRoundRobin() {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        return {};
+    }
+    std::map<int, std::vector<int>> nodeToCpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &cpuSet)) {
+            nodeToCpus[getNodeOfCpu(cpu)].push_back(cpu);
+        }
+    }
+    std::vector<int> result;
+    for (uint64_t index = 0; result.size() < static_cast<uint64_t>(CPU_COUNT(&cpuSet)); ++index) {
+        for (auto const& nodeCpus : nodeToCpus) {
+            if (index < nodeCpus.second.size()) {
+                result.push_back(nodeCpus.second[index]);
+            }
+        }
+    }
+    STORM_LOG_INFO("Pinning threads to " << result.size() << " CPUs on " << nodeToCpus.size() << " NUMA node(s).");
+    return result;
+}
+
+/*!
+ * Pins each thread that enters the TBB scheduler to the CPU that corresponds to its index within the arena.
+ */
+class PinningObserver : public tbb::task_scheduler_observer {
+   public:
+    PinningObserver() : cpus(getCpusRoundRobin()) {
+        if (!cpus.empty()) {
+            observe(true);
+        }
+    }
+
+    ~PinningObserver() {
+        observe(false);
+    }
+
+    void on_scheduler_entry(bool) override {
+        int const threadIndex = tbb::this_task_arena::current_thread_index();
+        if (threadIndex >= 0) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(cpus[threadIndex % cpus.size()], &cpuSet);
+            STORM_LOG_WARN_COND(sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0, "Unable to pin thread " << threadIndex << ".");
+        }
+    }
+
+   private:
+    std::vector<int> cpus;
+};
+}  // namespace detail
+#endif
+
+bool isEnabled() {
+#ifdef STORM_NUMA_SUPPORTED
+    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+    return coreSettings.isNumaSet() && coreSettings.isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+void pinThreads() {
+#ifdef STORM_NUMA_SUPPORTED
+    if (isEnabled()) {
+        static std::once_flag pinned;
+        std::call_once(pinned, []() { static detail::PinningObserver observer; });
+    }
+#endif
+}
+
+void moveToCurrentNode([[maybe_unused]] void const* begin, [[maybe_unused]] void const* end) {
+#ifdef STORM_NUMA_SUPPORTED
+    unsigned cpu, node;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return;
+    }
+    uintptr_t const pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    // Only move pages that are completely covered by the range as the remaining ones are shared with data that might belong to other threads.
+    uintptr_t page = (reinterpret_cast<uintptr_t>(begin) + pageSize - 1) & ~(pageSize - 1);
+    uintptr_t const endPage = reinterpret_cast<uintptr_t>(end) & ~(pageSize - 1);
+    std::vector<void*> pages;
+    std::vector<int> nodes, status;
+    while (page < endPage) {
+        pages.clear();
+        for (; page < endPage && pages.size() < detail::pagesPerCall; page += pageSize) {
+            pages.push_back(reinterpret_cast<void*>(page));
+        }
+        nodes.assign(pages.size(), static_cast<int>(node));
+        status.resize(pages.size());
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nodes.data(), status.data(), detail::moveFlag) < 0) {
+            // Moving is not possible (e.g. on systems without NUMA support), so there is no point in trying the remaining pages.
+            return;
+        }
+    }
+#endif
+}
+
+}  // namespace storm::utility::numa
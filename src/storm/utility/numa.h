@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm::utility::numa {
+
+/*!
+ * Retrieves whether NUMA-aware placement is enabled, i.e., whether it was requested via the settings and this version of Storm supports it (which
+ * requires Intel TBB and Linux).
+ */
+bool isEnabled();
+
+/*!
+ * Pins the threads of the TBB thread pool to the available CPUs such that consecutive thread indices are distributed round-robin over the NUMA nodes.
+ * The pinning is installed only once and affects all threads that join the pool afterwards (including threads that are already running when they
+ * enter the next parallel region). Does nothing if NUMA-aware placement is not enabled.
+ */
+void pinThreads();
+
+/*!
+ * Moves the memory pages that overlap the given byte range to the NUMA node of the calling thread. Pages that can not be moved (e.g. because they are
+ * shared or not yet allocated) are left as is, so this is only a hint for performance and never affects correctness.
+ */
+void moveToCurrentNode(void const* begin, void const* end);
+
+/*!
+ * Moves the memory pages of the given range of the given vector to the NUMA node of the calling thread.
+ */
+template<typename T, typename Allocator>
+void moveToCurrentNode(std::vector<T, Allocator> const& vector, uint64_t begin, uint64_t end) {
+    if (begin < end) {
+        moveToCurrentNode(static_cast<void const*>(vector.data() + begin), static_cast<void const*>(vector.data() + end));
+    }
+}
+
+}  // namespace storm::utility::numa
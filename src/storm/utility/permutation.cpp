@@ -1,6 +1,7 @@
 #include "storm/utility/permutation.h"
 
 #include <algorithm>
+#include <array>
 #include <deque>
 #include <numeric>
 #include <random>
@@ -9,10 +10,16 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "storm/utility/macros.h"
 
 namespace storm::utility::permutation {
 
+namespace detail {
+constexpr std::array<OrderKind, 8> allOrderKinds = {OrderKind::Bfs,    OrderKind::Dfs,                 OrderKind::ReverseBfs,     OrderKind::ReverseDfs,
+                                                    OrderKind::Random, OrderKind::ReverseCuthillMcKee, OrderKind::SccTopological, OrderKind::BackwardBfs};
+}  // namespace detail
+
 /*!
  * Converts the given order to a string.
  */
@@ -28,13 +35,19 @@ std::string orderKindtoString(OrderKind order) {
             return "reverse-dfs";
         case OrderKind::Random:
             return "random";
+        case OrderKind::ReverseCuthillMcKee:
+            return "rcm";
+        case OrderKind::SccTopological:
+            return "scc-topological";
+        case OrderKind::BackwardBfs:
+            return "backward-bfs";
     }
     STORM_LOG_ASSERT(false, "unreachable");
     return "";
 }
 
 OrderKind orderKindFromString(std::string const& order) {
-    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random}) {
+    for (auto kind : detail::allOrderKinds) {
         if (order == orderKindtoString(kind)) {
             return kind;
         }
@@ -45,7 +58,7 @@ OrderKind orderKindFromString(std::string const& order) {
 
 std::vector<std::string> orderKinds() {
     std::vector<std::string> kinds;
-    for (auto kind : {OrderKind::Bfs, OrderKind::Dfs, OrderKind::ReverseBfs, OrderKind::ReverseDfs, OrderKind::Random}) {
+    for (auto kind : detail::allOrderKinds) {
         kinds.push_back(orderKindtoString(kind));
     }
     return kinds;
@@ -65,18 +78,116 @@ std::vector<index_type> createRandomPermutation(index_type size, index_type seed
     return permutation;
 }
 
+namespace detail {
+template<typename ValueType>
+std::vector<index_type> createReverseCuthillMcKeePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    // The bandwidth is a property of the undirected graph, so we consider both the successors and the predecessors of each state.
+    auto const backwardTransitions = transitionMatrix.transpose(true);
+    index_type const numberOfStates = transitionMatrix.getRowGroupCount();
+    auto forEachNeighbor = [&transitionMatrix, &backwardTransitions](index_type state, auto const& function) {
+        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+            function(entry.getColumn());
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            function(entry.getColumn());
+        }
+    };
+    std::vector<index_type> degrees(numberOfStates, 0);
+    for (index_type state = 0; state < numberOfStates; ++state) {
+        forEachNeighbor(state, [&degrees, state](index_type) { ++degrees[state]; });
+    }
+    auto const lessDegree = [&degrees](index_type lhs, index_type rhs) { return degrees[lhs] < degrees[rhs]; };
+
+    // Each connected component is explored from a state with minimal degree. The order vector also serves as the queue of the search.
+    std::vector<index_type> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(), lessDegree);
+    std::vector<index_type> order;
+    order.reserve(numberOfStates);
+    storm::storage::BitVector discoveredStates(numberOfStates, false);
+    for (auto const start : statesByDegree) {
+        if (discoveredStates.get(start)) {
+            continue;
+        }
+        discoveredStates.set(start, true);
+        order.push_back(start);
+        for (index_type head = order.size() - 1; head < order.size(); ++head) {
+            auto const firstNeighbor = order.size();
+            forEachNeighbor(order[head], [&discoveredStates, &order](index_type neighbor) {
+                if (!discoveredStates.get(neighbor)) {
+                    discoveredStates.set(neighbor, true);
+                    order.push_back(neighbor);
+                }
+            });
+            std::stable_sort(order.begin() + firstNeighbor, order.end(), lessDegree);
+        }
+    }
+    auto permutation = invertPermutation(order);
+    reversePermutationInPlace(permutation);
+    return permutation;
+}
+
+template<typename ValueType>
+std::vector<index_type> createSccTopologicalPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccs(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    // An SCC can only reach SCCs with a smaller index, so we place the SCCs in reversed order.
+    std::vector<index_type> permutation(transitionMatrix.getRowGroupCount());
+    index_type position = 0;
+    for (auto sccIndex = sccs.size(); sccIndex > 0; --sccIndex) {
+        for (auto const state : sccs.getBlock(sccIndex - 1)) {
+            permutation[state] = position++;
+        }
+    }
+    return permutation;
+}
+
+template<typename ValueType>
+std::vector<index_type> createBackwardBfsPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                     storm::storage::BitVector const& startStates) {
+    auto const backwardTransitions = transitionMatrix.transpose(true);
+    std::vector<index_type> order(startStates.begin(), startStates.end());
+    order.reserve(transitionMatrix.getRowGroupCount());
+    storm::storage::BitVector discoveredStates = startStates;
+    for (index_type head = 0; head < order.size(); ++head) {
+        for (auto const& entry : backwardTransitions.getRow(order[head])) {
+            if (auto const predecessor = entry.getColumn(); !discoveredStates.get(predecessor)) {
+                discoveredStates.set(predecessor, true);
+                order.push_back(predecessor);
+            }
+        }
+    }
+    for (auto const state : ~discoveredStates) {
+        order.push_back(state);
+    }
+    // States close to the start states get the highest indices.
+    auto permutation = invertPermutation(order);
+    reversePermutationInPlace(permutation);
+    return permutation;
+}
+}  // namespace detail
+
 template<typename ValueType>
 std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                           storm::storage::BitVector const& initialStates) {
-    if (order == OrderKind::Random) {
-        return createRandomPermutation(transitionMatrix.getRowGroupCount());
+    STORM_LOG_ASSERT(initialStates.size() == transitionMatrix.getRowGroupCount(), "Unexpected dimensions of initial states and transition matrix.");
+    STORM_LOG_ASSERT(initialStates.size() == transitionMatrix.getColumnCount(), "Unexpected dimensions of initial states and transition matrix.");
+    switch (order) {
+        case OrderKind::Random:
+            return createRandomPermutation(transitionMatrix.getRowGroupCount());
+        case OrderKind::ReverseCuthillMcKee:
+            return detail::createReverseCuthillMcKeePermutation(transitionMatrix);
+        case OrderKind::SccTopological:
+            return detail::createSccTopologicalPermutation(transitionMatrix);
+        case OrderKind::BackwardBfs:
+            return detail::createBackwardBfsPermutation(transitionMatrix, initialStates);
+        default:
+            break;
     }
     STORM_LOG_ASSERT((order == OrderKind::Bfs || order == OrderKind::Dfs || order == OrderKind::ReverseBfs || order == OrderKind::ReverseDfs),
                      "Unknown order kind");
-    STORM_LOG_ASSERT(initialStates.size() == transitionMatrix.getRowGroupCount(), "Unexpected dimensions of initial states and transition matrix.");
-    STORM_LOG_ASSERT(initialStates.size() == transitionMatrix.getColumnCount(), "Unexpected dimensions of initial states and transition matrix.");
-    std::vector<index_type> permutation;
-    permutation.reserve(transitionMatrix.getRowGroupCount());
+    std::vector<index_type> visitedStates;
+    visitedStates.reserve(transitionMatrix.getRowGroupCount());
 
     std::deque<index_type> stack(initialStates.begin(), initialStates.end());
     storm::storage::BitVector discoveredStates = initialStates;
@@ -85,7 +196,7 @@ std::vector<index_type> createPermutation(OrderKind order, storm::storage::Spars
     while (!stack.empty()) {
         auto current = stack.front();
         stack.pop_front();
-        permutation.push_back(current);
+        visitedStates.push_back(current);
         for (auto const& entry : transitionMatrix.getRowGroup(current)) {
             if (auto const successor = entry.getColumn(); !discoveredStates.get(successor)) {
                 discoveredStates.set(successor, true);
@@ -97,6 +208,11 @@ std::vector<index_type> createPermutation(OrderKind order, storm::storage::Spars
             }
         }
     }
+    for (auto const state : ~discoveredStates) {
+        visitedStates.push_back(state);
+    }
+    // The i-th visited state is moved to position i.
+    auto permutation = invertPermutation(visitedStates);
     if (order == OrderKind::ReverseDfs || order == OrderKind::ReverseBfs) {
         reversePermutationInPlace(permutation);
     }
@@ -135,5 +251,7 @@ template std::vector<index_type> createPermutation(OrderKind order, storm::stora
                                                    storm::storage::BitVector const& initialStates);
 template std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                    storm::storage::BitVector const& initialStates);
+template std::vector<index_type> createPermutation(OrderKind order, storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                   storm::storage::BitVector const& initialStates);
 
 }  // namespace storm::utility::permutation
\ No newline at end of file
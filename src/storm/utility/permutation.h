@@ -16,9 +16,14 @@ namespace utility::permutation {
 using index_type = uint64_t;
 
 /*!
- * The order in which the states of a matrix are visited in a depth-first search or breadth-first search traversal.
+ * The order in which the states of a matrix are arranged.
+ * - Bfs, Dfs (and their reversals): the order in which the states are visited in a breadth-first or depth-first search from the initial states.
+ * - ReverseCuthillMcKee: reduces the bandwidth of the (symmetrized) matrix, i.e., successors tend to have nearby indices.
+ * - SccTopological: states of an SCC are consecutive and every SCC precedes the SCCs it can reach.
+ * - BackwardBfs: states are sorted by decreasing distance to the initial states in a breadth-first search on the backward transitions.
+ *   Backward (Gauss-Seidel) sweeps as performed by the value iteration operator thus process states close to the initial (target) states first.
  */
-enum class OrderKind { Bfs, Dfs, ReverseBfs, ReverseDfs, Random };
+enum class OrderKind { Bfs, Dfs, ReverseBfs, ReverseDfs, Random, ReverseCuthillMcKee, SccTopological, BackwardBfs };
 
 /*!
  * Converts the given order to a string.
@@ -47,15 +52,16 @@ std::vector<index_type> createRandomPermutation(index_type size);
 std::vector<index_type> createRandomPermutation(index_type size, index_type seed);
 
 /*!
- * Creates a permutation that orders the states of the given matrix in the given exploration order.
+ * Creates a permutation that orders the states of the given matrix in the given order.
  *
- * @note the resulting permutation will only contain those states that are reachable from the initial states.
+ * @note For exploration orders, states that are not reachable from the initial states are placed after all reachable states (before them for reversed orders).
  *
  * Example:
  * Let permutation[i_0] = 0, permutation[i_1] = 1, ..., permutation[i_n-1] = n-1.
  * i_0 is the firs initial state.
  * If the order is Dfs, i_1 is a successor of i_0, i_2 is a successor of i_1, etc. (assuming those successors exist).
  * If the order is Bfs, i_1 is the second initial state, ...
+ * For BackwardBfs, the initial states are the states from which the search on the backward transitions starts (typically the target states).
  *
  * @pre initialStates.size() == transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount()
  */
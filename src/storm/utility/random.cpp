@@ -1,5 +1,7 @@
 #include "storm/utility/random.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 
 namespace storm {
@@ -34,6 +36,44 @@ uint64_t RandomProbabilityGenerator<RationalNumber>::random_uint(uint64_t min, u
     return std::uniform_int_distribution<uint64_t>(min, max)(engine);
 }
 
+uint64_t getStreamSeed(uint64_t seed, uint64_t stream) {
+    // The seed sequence scrambles all bits of the input, so streams with nearby indices yield unrelated seeds.
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    std::array<uint32_t, 2> result;
+    sequence.generate(result.begin(), result.end());
+    return (static_cast<uint64_t>(result[0]) << 32) | result[1];
+}
+
+namespace {
+// The finalizer of SplitMix64, which maps consecutive inputs to statistically independent outputs.
+uint64_t mix(uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+uint64_t constexpr goldenGamma = 0x9e3779b97f4a7c15ull;
+}  // namespace
+
+CounterBasedRandomGenerator::CounterBasedRandomGenerator(uint64_t seed) : key(mix(seed)) {}
+
+uint64_t CounterBasedRandomGenerator::random_uint64(uint64_t stream, uint64_t counter) const {
+    // Each stream is a SplitMix64 sequence whose starting point is derived from the key and the stream index.
+    uint64_t const streamKey = mix(key + mix(stream + goldenGamma));
+    return mix(streamKey + (counter + 1) * goldenGamma);
+}
+
+double CounterBasedRandomGenerator::random(uint64_t stream, uint64_t counter) const {
+    // Use the upper 53 bits, which is the precision of a double.
+    return static_cast<double>(random_uint64(stream, counter) >> 11) * 0x1.0p-53;
+}
+
+uint64_t CounterBasedRandomGenerator::random_uint(uint64_t stream, uint64_t counter, uint64_t min, uint64_t max) const {
+    // Scaling a uniform number in [0, 1) is sufficiently precise for the small ranges we sample from (e.g., the choices of a state).
+    uint64_t const result = min + static_cast<uint64_t>(random(stream, counter) * (static_cast<double>(max - min) + 1.0));
+    return std::min(result, max);
+}
+
 BernoulliDistributionGenerator::BernoulliDistributionGenerator(double prob) : distribution(prob) {}
 
 bool BernoulliDistributionGenerator::random(boost::mt19937& engine) {
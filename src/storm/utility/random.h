@@ -41,6 +41,43 @@ class RandomProbabilityGenerator<storm::RationalNumber> {
     std::mt19937 engine;
 };
 
+/*!
+ * Derives the seed of an independent random stream from the given seed, e.g., for the random number generators of several threads.
+ *
+ * @param seed The seed shared by all streams.
+ * @param stream The index of the stream.
+ * @return The seed for the given stream.
+ */
+uint64_t getStreamSeed(uint64_t seed, uint64_t stream);
+
+/*!
+ * A counter-based random number generator: the i-th number of a stream only depends on the seed, the index of the stream and i. Hence, the numbers
+ * of a stream do not depend on how many numbers were drawn from other streams or in which order, which makes sampling with many streams (e.g., one
+ * per trace) reproducible, regardless of how the streams are distributed over threads.
+ */
+class CounterBasedRandomGenerator {
+   public:
+    CounterBasedRandomGenerator(uint64_t seed = 0);
+
+    /*!
+     * Retrieves the number with the given counter of the given stream, uniformly distributed over all 64-bit numbers.
+     */
+    uint64_t random_uint64(uint64_t stream, uint64_t counter) const;
+
+    /*!
+     * Retrieves the number with the given counter of the given stream, uniformly distributed in [0, 1).
+     */
+    double random(uint64_t stream, uint64_t counter) const;
+
+    /*!
+     * Retrieves the number with the given counter of the given stream, uniformly distributed in [min, max].
+     */
+    uint64_t random_uint(uint64_t stream, uint64_t counter, uint64_t min, uint64_t max) const;
+
+   private:
+    uint64_t key;
+};
+
 class BernoulliDistributionGenerator {
    public:
     BernoulliDistributionGenerator(double prob);
@@ -266,12 +266,12 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
                                                  shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
             candidatePaths[node].insert(pathToPredecessorPlusEdge);
+        }
 
-            // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
-            }
+        // ... but not the actual shortest path
+        auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
+        if (it != candidatePaths[node].end()) {
+            candidatePaths[node].erase(it);
         }
     }
 
@@ -305,15 +305,10 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
 
     // Step B.6 in J&M paper
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        // candidates are ordered by decreasing distance, so the first one is the best
+        auto bestCandidateIt = candidatePaths[node].begin();
+        kShortestPaths[node].push_back(*bestCandidateIt);
+        candidatePaths[node].erase(bestCandidateIt);
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
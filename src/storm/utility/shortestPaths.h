@@ -55,6 +55,18 @@ struct Path {
     }
 };
 
+// orders paths by decreasing distance (i.e., probability), so the best candidate comes first;
+// ties are broken by the (arbitrary) order of Path
+template<typename T>
+struct PathDistanceComparator {
+    bool operator()(Path<T> const& lhs, Path<T> const& rhs) const {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance > rhs.distance;
+        }
+        return lhs < rhs;
+    }
+};
+
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
@@ -130,7 +142,7 @@ class ShortestPathsGenerator {
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    std::vector<std::set<Path<T>, PathDistanceComparator<T>>> candidatePaths;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -185,7 +197,7 @@ class ShortestPathsGenerator {
     // --- tiny helper fcts ---
 
     inline bool isInitialState(state_t node) const {
-        return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
+        return node < initialStates.size() && initialStates.get(node);
     }
 
     inline bool isMetaTargetPredecessor(state_t node) const {
@@ -1,6 +1,9 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
+#include <limits>
 #include <random>
+#include <set>
 
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -44,8 +47,14 @@ bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSetting
            order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
 }
 
+bool eliminationOrderIsGraphBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
+    return order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection;
+}
+
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
-    return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
+    return eliminationOrderNeedsDistances(order) || eliminationOrderIsGraphBased(order) ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
 }
 
 template<typename ValueType>
@@ -100,6 +109,306 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+namespace {
+/*!
+ * Computes the adjacency lists of the undirected graph underlying the transitions between the given states, i.e., two states are adjacent iff there
+ * is a transition from one to the other. Self-loops are omitted. The lists are indexed by the states of the matrix, but only those of the given
+ * states are filled.
+ */
+template<typename ValueType>
+std::vector<std::vector<storm::storage::sparse::state_type>> getUndirectedAdjacency(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                                   storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                                   storm::storage::BitVector const& states) {
+    std::vector<std::vector<storm::storage::sparse::state_type>> adjacency(transitionMatrix.getRowCount());
+    for (auto state : states) {
+        auto& neighbors = adjacency[state];
+        neighbors.reserve(transitionMatrix.getRow(state).size() + backwardTransitions.getRow(state).size());
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (entry.getColumn() != state && states.get(entry.getColumn())) {
+                neighbors.push_back(entry.getColumn());
+            }
+        }
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            if (entry.getColumn() != state && states.get(entry.getColumn())) {
+                neighbors.push_back(entry.getColumn());
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+    return adjacency;
+}
+
+/*!
+ * Computes the SCCs of the transitions between the given states (with an iterative version of Tarjan's algorithm). The SCCs are returned in reverse
+ * topological order, i.e., every SCC precedes the SCCs that can reach it.
+ */
+template<typename ValueType>
+std::vector<std::vector<storm::storage::sparse::state_type>> getSccs(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                    storm::storage::BitVector const& states) {
+    uint64_t const unvisited = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> preorder(transitionMatrix.getRowCount(), unvisited);
+    std::vector<uint64_t> lowlink(transitionMatrix.getRowCount());
+    storm::storage::BitVector onStack(transitionMatrix.getRowCount());
+    std::vector<storm::storage::sparse::state_type> tarjanStack;
+    std::vector<std::pair<storm::storage::sparse::state_type, uint64_t>> callStack;
+    std::vector<std::vector<storm::storage::sparse::state_type>> result;
+    uint64_t counter = 0;
+
+    for (auto root : states) {
+        if (preorder[root] != unvisited) {
+            continue;
+        }
+        callStack.emplace_back(root, 0);
+        preorder[root] = lowlink[root] = counter++;
+        tarjanStack.push_back(root);
+        onStack.set(root);
+
+        while (!callStack.empty()) {
+            auto& [state, position] = callStack.back();
+            auto const& row = transitionMatrix.getRow(state);
+            if (position < row.size()) {
+                storm::storage::sparse::state_type successor = row[position].getColumn();
+                ++position;
+                if (!states.get(successor)) {
+                    continue;
+                }
+                if (preorder[successor] == unvisited) {
+                    preorder[successor] = lowlink[successor] = counter++;
+                    tarjanStack.push_back(successor);
+                    onStack.set(successor);
+                    callStack.emplace_back(successor, 0);
+                } else if (onStack.get(successor)) {
+                    lowlink[state] = std::min(lowlink[state], preorder[successor]);
+                }
+                continue;
+            }
+
+            // All successors are done, so the state is either the root of an SCC or passes its lowlink to its parent.
+            storm::storage::sparse::state_type finishedState = state;
+            callStack.pop_back();
+            if (lowlink[finishedState] == preorder[finishedState]) {
+                result.emplace_back();
+                storm::storage::sparse::state_type member;
+                do {
+                    member = tarjanStack.back();
+                    tarjanStack.pop_back();
+                    onStack.set(member, false);
+                    result.back().push_back(member);
+                } while (member != finishedState);
+            }
+            if (!callStack.empty()) {
+                auto parent = callStack.back().first;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[finishedState]);
+            }
+        }
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& states) {
+    typedef storm::storage::sparse::state_type state_type;
+
+    // We work on the quotient graph: Every eliminated state becomes an element that represents the clique formed by its remaining neighbors. The
+    // neighborhood of a state is thus given by its adjacent states and the states of its adjacent elements, which avoids storing the fill-in.
+    std::vector<std::vector<state_type>> adjacentStates = getUndirectedAdjacency(transitionMatrix, backwardTransitions, states);
+    std::vector<std::vector<state_type>> adjacentElements(transitionMatrix.getRowCount());
+    std::vector<std::vector<state_type>> elementStates(transitionMatrix.getRowCount());
+    storm::storage::BitVector eliminated(transitionMatrix.getRowCount());
+    storm::storage::BitVector absorbed(transitionMatrix.getRowCount());
+    std::vector<uint64_t> marker(transitionMatrix.getRowCount(), 0);
+
+    std::set<std::pair<uint64_t, state_type>> queue;
+    std::vector<uint64_t> degrees(transitionMatrix.getRowCount());
+    for (auto state : states) {
+        degrees[state] = adjacentStates[state].size();
+        queue.emplace(degrees[state], state);
+    }
+
+    std::vector<state_type> result;
+    result.reserve(queue.size());
+    uint64_t remainingStates = queue.size();
+    while (!queue.empty()) {
+        state_type pivot = queue.begin()->second;
+        queue.erase(queue.begin());
+        eliminated.set(pivot);
+        result.push_back(pivot);
+        --remainingStates;
+
+        // Collect the neighborhood of the pivot, which becomes the new element. All elements adjacent to the pivot are absorbed by the new one.
+        uint64_t const mark = result.size();
+        marker[pivot] = mark;
+        std::vector<state_type> newElement;
+        for (auto neighbor : adjacentStates[pivot]) {
+            if (!eliminated.get(neighbor) && marker[neighbor] != mark) {
+                marker[neighbor] = mark;
+                newElement.push_back(neighbor);
+            }
+        }
+        for (auto element : adjacentElements[pivot]) {
+            if (absorbed.get(element)) {
+                continue;
+            }
+            for (auto neighbor : elementStates[element]) {
+                if (!eliminated.get(neighbor) && marker[neighbor] != mark) {
+                    marker[neighbor] = mark;
+                    newElement.push_back(neighbor);
+                }
+            }
+            absorbed.set(element);
+            std::vector<state_type>().swap(elementStates[element]);
+        }
+        std::vector<state_type>().swap(adjacentStates[pivot]);
+        std::vector<state_type>().swap(adjacentElements[pivot]);
+
+        // Update the neighbors of the pivot. Adjacencies between states of the new element are represented by the element and can be dropped.
+        for (auto neighbor : newElement) {
+            auto& neighborStates = adjacentStates[neighbor];
+            neighborStates.erase(std::remove_if(neighborStates.begin(), neighborStates.end(),
+                                                [&](state_type state) { return eliminated.get(state) || marker[state] == mark; }),
+                                 neighborStates.end());
+            auto& neighborElements = adjacentElements[neighbor];
+            neighborElements.erase(std::remove_if(neighborElements.begin(), neighborElements.end(), [&](state_type element) { return absorbed.get(element); }),
+                                   neighborElements.end());
+            neighborElements.push_back(pivot);
+
+            // The degree is approximated from above by the sizes of the adjacent elements, which may overlap.
+            uint64_t degree = neighborStates.size();
+            for (auto element : neighborElements) {
+                degree += element == pivot ? newElement.size() - 1 : elementStates[element].size() - 1;
+            }
+            degree = std::min(degree, remainingStates - 1);
+            if (degree != degrees[neighbor]) {
+                queue.erase(std::make_pair(degrees[neighbor], neighbor));
+                degrees[neighbor] = degree;
+                queue.emplace(degree, neighbor);
+            }
+        }
+        elementStates[pivot] = std::move(newElement);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                             storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                             storm::storage::BitVector const& states) {
+    typedef storm::storage::sparse::state_type state_type;
+
+    // Parts with at most this many states are not dissected further.
+    uint64_t const minimalPartSize = 64;
+
+    std::vector<std::vector<state_type>> adjacency = getUndirectedAdjacency(transitionMatrix, backwardTransitions, states);
+
+    // Every part that is currently considered is marked with a unique stamp, such that searches are restricted to it.
+    std::vector<uint64_t> part(transitionMatrix.getRowCount(), 0);
+    std::vector<uint64_t> level(transitionMatrix.getRowCount());
+    uint64_t currentPart = 0;
+
+    // Performs a breadth-first search from the given state within the part of the state and returns the visited states ordered by their level.
+    std::vector<state_type> visited;
+    auto breadthFirstSearch = [&](state_type start) {
+        uint64_t const searchPart = part[start];
+        uint64_t const searchStamp = ++currentPart;
+        visited.clear();
+        visited.push_back(start);
+        part[start] = searchStamp;
+        level[start] = 0;
+        for (uint64_t index = 0; index < visited.size(); ++index) {
+            state_type state = visited[index];
+            for (auto neighbor : adjacency[state]) {
+                if (part[neighbor] == searchPart) {
+                    part[neighbor] = searchStamp;
+                    level[neighbor] = level[state] + 1;
+                    visited.push_back(neighbor);
+                }
+            }
+        }
+        // Restore the stamp of the part.
+        for (auto state : visited) {
+            part[state] = searchPart;
+        }
+    };
+
+    std::vector<state_type> result;
+    result.reserve(states.getNumberOfSetBits());
+
+    // The SCCs are dissected independently, such that the states of an SCC are eliminated before the states of the SCCs that can reach it.
+    for (auto const& scc : getSccs(transitionMatrix, states)) {
+        // The order of the SCC is filled from the back: the separator of a part is placed behind the states of the (sub)parts it separates.
+        std::vector<state_type> sccOrder(scc.size());
+        uint64_t back = scc.size();
+
+        // Split the SCC into its connected (undirected) components, which may happen if states are excluded.
+        std::vector<std::vector<state_type>> parts;
+        uint64_t const sccStamp = ++currentPart;
+        for (auto state : scc) {
+            part[state] = sccStamp;
+        }
+        for (auto state : scc) {
+            if (part[state] == sccStamp) {
+                breadthFirstSearch(state);
+                parts.push_back(visited);
+                uint64_t const componentStamp = ++currentPart;
+                for (auto componentState : visited) {
+                    part[componentState] = componentStamp;
+                }
+            }
+        }
+
+        while (!parts.empty()) {
+            std::vector<state_type> currentStates = std::move(parts.back());
+            parts.pop_back();
+
+            // Find a pseudo-peripheral state by searching twice and take the level structure rooted in it.
+            bool dissected = false;
+            if (currentStates.size() > minimalPartSize) {
+                breadthFirstSearch(currentStates.front());
+                breadthFirstSearch(visited.back());
+                uint64_t const numberOfLevels = level[visited.back()] + 1;
+                if (numberOfLevels >= 3) {
+                    // The separator is the level that contains the median state.
+                    uint64_t const separatorLevel = std::clamp<uint64_t>(level[visited[visited.size() / 2]], 1, numberOfLevels - 2);
+                    uint64_t const remainderStamp = ++currentPart;
+                    for (auto state : visited) {
+                        if (level[state] == separatorLevel) {
+                            sccOrder[--back] = state;
+                            part[state] = 0;
+                        } else {
+                            part[state] = remainderStamp;
+                        }
+                    }
+                    for (auto state : currentStates) {
+                        if (part[state] == remainderStamp) {
+                            breadthFirstSearch(state);
+                            parts.push_back(visited);
+                            uint64_t const componentStamp = ++currentPart;
+                            for (auto componentState : visited) {
+                                part[componentState] = componentStamp;
+                            }
+                        }
+                    }
+                    dissected = true;
+                }
+            }
+
+            if (!dissected) {
+                for (auto it = currentStates.rbegin(), ite = currentStates.rend(); it != ite; ++it) {
+                    sccOrder[--back] = *it;
+                    part[*it] = 0;
+                }
+            }
+        }
+        STORM_LOG_ASSERT(back == 0, "Expected all states of the SCC to be ordered.");
+        result.insert(result.end(), sccOrder.begin(), sccOrder.end());
+    }
+    return result;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -118,6 +427,10 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
         std::mt19937 generator(randomDevice());
         std::shuffle(sortedStates.begin(), sortedStates.end(), generator);
         return std::make_unique<StaticStatePriorityQueue>(sortedStates);
+    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree) {
+        return std::make_unique<StaticStatePriorityQueue>(computeApproximateMinimumDegreeOrder(transitionMatrix, backwardTransitions, states));
+    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::NestedDissection) {
+        return std::make_unique<StaticStatePriorityQueue>(computeNestedDissectionOrder(transitionMatrix, backwardTransitions, states));
     } else {
         if (eliminationOrderNeedsDistances(order)) {
             STORM_LOG_THROW(static_cast<bool>(distanceBasedStatePriorities), storm::exceptions::InvalidStateException,
@@ -229,6 +542,12 @@ std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<ValueT
 }
 
 template uint_fast64_t estimateComplexity(double const& value);
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& states);
+template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(
+    storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -252,6 +571,12 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
 
 #ifdef STORM_HAVE_CARL
 template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
+template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -274,6 +599,12 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& initialStates,
                                                       std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
+template std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -37,6 +37,7 @@ bool eliminationOrderNeedsDistances(storm::settings::modules::EliminationSetting
 bool eliminationOrderNeedsForwardDistances(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
 bool eliminationOrderNeedsReversedDistances(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
+bool eliminationOrderIsGraphBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
 
 template<typename ValueType>
@@ -58,6 +59,27 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Computes an elimination order of the given states that greedily eliminates a state of (approximately) minimal degree in the undirected graph
+ * underlying the transitions, where the degree accounts for the transitions introduced by previous eliminations. The graph resulting from the
+ * eliminations is represented implicitly (as a quotient graph), so the order is computed without performing the eliminations.
+ */
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& states);
+
+/*!
+ * Computes an elimination order of the given states by nested dissection: Every SCC is recursively split by a separator (a level of a breadth-first
+ * search from a pseudo-peripheral state) whose states are eliminated after the states of the parts they separate. This way, eliminations in one
+ * part do not introduce transitions to the other part. The SCCs themselves are ordered such that an SCC is eliminated before the SCCs that can
+ * reach it.
+ */
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                             storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                             storm::storage::BitVector const& states);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -59,6 +59,7 @@ TEST_F(DftSmt, FDEPBoundTest) {
     smtChecker.toSolver();
     EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getLeastFailureBound(*dft, true, 30), uint64_t(1));
     EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getAlwaysFailedBound(*dft, true, 30), uint64_t(5));
+    EXPECT_EQ(storm::dft::utility::FailureBoundFinder::getFailureBounds(*dft, true, 30), std::make_pair(uint64_t(1), uint64_t(5)));
 }
 
 TEST_F(DftSmt, FDEPConflictTest) {
@@ -89,5 +90,7 @@ TEST_F(DftSmt, FDEPConflictSEQTest) {
 
     EXPECT_EQ(storm::dft::utility::FDEPConflictFinder<double>::getDynamicBehavior(*dft), expected_dynamic_vector);
     EXPECT_EQ(storm::dft::utility::FDEPConflictFinder<double>::getDependencyConflicts(*dft, true).size(), uint64_t(3));
+    EXPECT_EQ(storm::dft::utility::FDEPConflictFinder<double>::getDependencyConflicts(*dft, true, 10, 3),
+              storm::dft::utility::FDEPConflictFinder<double>::getDependencyConflicts(*dft, true, 10, 1));
 }
 }  // namespace
@@ -102,6 +102,20 @@ TEST_P(SftBddTest, Birnbaum) {
     expectVectorNear(checker->getAllBirnbaumFactorsAtTimebound(1), param.birnbaum);
 }
 
+TEST_P(SftBddTest, BirnbaumAtTimepoints) {
+    auto const &param{TestWithParam::GetParam()};
+    std::vector<double> const timepoints{0.5, 1, 1.5, 2, 3};
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    for (size_t chunksize : {0, 1, 2}) {
+        auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, chunksize)};
+        ASSERT_EQ(basicElements.size(), birnbaumFactors.size());
+        for (size_t i{0}; i < basicElements.size(); ++i) {
+            expectVectorNear(birnbaumFactors[i], checker->getBirnbaumFactorsAtTimepoints(basicElements[i]->name(), timepoints));
+            EXPECT_NEAR(birnbaumFactors[i][1], param.birnbaum[i], 1e-6);
+        }
+    }
+}
+
 TEST_P(SftBddTest, CIF) {
     auto const &param{TestWithParam::GetParam()};
     expectVectorNear(checker->getAllCIFsAtTimebound(1), param.CIF);
@@ -220,6 +234,24 @@ TEST(TestBdd, AndOrRelevantEventsChecked) {
     EXPECT_NEAR(checker.getProbabilityAtTimebound(relevantEventsBdds["x1"], 1), 0.5, 1e-6);
 }
 
+TEST(TestBdd, DepthFirstVariableOrdering) {
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/ImportanceTest.dft");
+    auto manager{std::make_shared<storm::dft::storage::SylvanBddManager>()};
+    auto transformator{std::make_shared<storm::dft::transformations::SftToBddTransformator<double>>(
+        dft, manager, storm::dft::utility::RelevantEvents{}, storm::dft::transformations::SftVariableOrdering::DepthFirst)};
+
+    // The unreachable basic element x7 is ordered last.
+    std::vector<std::string> variableNames{};
+    for (auto const &variable : transformator->getDdVariables()) {
+        variableNames.push_back(manager->getName(variable));
+    }
+    EXPECT_EQ(variableNames, (std::vector<std::string>{"x1", "x2", "x3", "x4", "x5", "x6", "x7"}));
+
+    storm::dft::modelchecker::SFTBDDChecker checker{transformator};
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(1), 0.2655055433, 1e-6);
+    expectVectorNear(checker.getAllBirnbaumFactorsAtTimebound(1), std::vector<double>{0.531011, 0.368041, 0.224763, 0.0596235, 0.0543206, 0.0810368, 0});
+}
+
 TEST(TestBdd, AndOrFormulaFail) {
     auto dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/AndOrTest.dft");
     auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F < 1 !\"F2_failed\"];"))};
@@ -287,4 +319,19 @@ TEST(TestBdd, AndOrFormula) {
     EXPECT_EQ(result[7].GetShaHash(), "a4f129fa27c6cd32625b088811d4b12f8059ae0547ee035c083deed9ef9d2c59");
 }
 
+TEST(TestBdd, AllBeDistributionsAtTimepoints) {
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/all_be_distributions.dft");
+    storm::dft::modelchecker::SFTBDDChecker checker{dft};
+
+    // The vectorized computation over all timepoints must match the computation for single timepoints
+    std::vector<double> const timepoints{0.1, 0.25, 0.5, 1, 2};
+    auto const probabilities{checker.getProbabilitiesAtTimepoints(timepoints)};
+    ASSERT_EQ(probabilities.size(), timepoints.size());
+    for (size_t i{0}; i < timepoints.size(); ++i) {
+        EXPECT_NEAR(probabilities[i], checker.getProbabilityAtTimebound(timepoints[i]), 1e-10);
+    }
+    // Computation in chunks
+    expectVectorNear(checker.getProbabilitiesAtTimepoints(timepoints, 2), probabilities);
+}
+
 }  // namespace
@@ -64,7 +64,26 @@ static std::vector<ModularizerTestData> modularizerTestData{
         STORM_TEST_RESOURCES_DIR "/dft/mcs.dft",
         0.9984947969,
     },
+    {
+        "ReplicatedModules",
+        STORM_TEST_RESOURCES_DIR "/dft/bdd/ReplicatedModulesTest.dft",
+        0.0092280012,
+    },
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerParallelTest, ReplicatedModules) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/bdd/ReplicatedModulesTest.dft")};
+    std::vector<double> sequentialProbabilities;
+    {
+        storm::dft::modelchecker::DftModularizationChecker<double> checker{dft};
+        sequentialProbabilities = checker.getProbabilitiesAtTimepoints({0.5, 1});
+    }
+    storm::dft::modelchecker::DftModularizationChecker<double> checker{dft, 2};
+    auto const probabilities{checker.getProbabilitiesAtTimepoints({0.5, 1})};
+    ASSERT_EQ(2ul, probabilities.size());
+    EXPECT_NEAR(sequentialProbabilities[0], probabilities[0], 1e-10);
+    EXPECT_NEAR(0.0092280012, probabilities[1], 1e-6);
+}
+
 }  // namespace
@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTSimulationEngine.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DftSymmetries.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+
+namespace {
+
+std::pair<std::shared_ptr<storm::dft::storage::DFT<double>>, storm::dft::storage::DFTStateGenerationInfo> prepareDFT(std::string const& file) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+
+    // Compute relevant events
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents({}, {"all"});
+    dft->setRelevantEvents(relevantEvents, false);
+
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(storm::dft::storage::DftSymmetries()));
+    return std::make_pair(dft, stateGenerationInfo);
+}
+
+TEST(DftSimulationEngineTest, MonteCarloAnd) {
+    auto pair = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    storm::dft::simulator::SimulationOptions options;
+    options.numberOfThreads = 3;
+    options.relativeError = 0.01;
+    storm::dft::simulator::DFTSimulationEngine<double> engine(*pair.first, pair.second, options);
+    auto result = engine.estimateUnreliability(2);
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.015);
+    EXPECT_LE(result.lowerBound, result.estimate);
+    EXPECT_GE(result.upperBound, result.estimate);
+    EXPECT_LE(result.upperBound - result.lowerBound, 2 * 0.015 * result.estimate);
+    // The stopping rule applies long before the maximal number of batches is reached
+    EXPECT_LT(result.numberOfBatches, options.maxBatches);
+    EXPECT_EQ(result.numberOfBatches * options.batchSize, result.numberOfTraces);
+}
+
+TEST(DftSimulationEngineTest, IndependentOfThreads) {
+    auto pair = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+    storm::dft::simulator::SimulationOptions options;
+    options.maxBatches = 12;
+    storm::dft::simulator::DFTSimulationEngine<double> sequentialEngine(*pair.first, pair.second, options);
+    auto sequentialResult = sequentialEngine.estimateUnreliability(1);
+    options.numberOfThreads = 4;
+    storm::dft::simulator::DFTSimulationEngine<double> parallelEngine(*pair.first, pair.second, options);
+    auto parallelResult = parallelEngine.estimateUnreliability(1);
+    EXPECT_EQ(12ul, parallelResult.numberOfBatches);
+    EXPECT_EQ(sequentialResult.estimate, parallelResult.estimate);
+    EXPECT_EQ(sequentialResult.lowerBound, parallelResult.lowerBound);
+    EXPECT_NEAR(parallelResult.estimate, 0.4511883639, 0.02);
+}
+
+TEST(DftSimulationEngineTest, ImportanceSplittingAnd) {
+    auto pair = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    storm::dft::simulator::BECountImportanceFunction<double> importanceFunction(*pair.first);
+    storm::dft::simulator::SimulationOptions options;
+    options.numberOfThreads = 2;
+    options.maxBatches = 100;
+    storm::dft::simulator::DFTSimulationEngine<double> engine(*pair.first, pair.second, options);
+    // Rare failure: both BEs fail within the time bound, i.e., (1 - exp(-0.05))^2
+    auto result = engine.estimateUnreliabilityWithSplitting(0.1, importanceFunction, {1});
+    EXPECT_NEAR(result.estimate, 0.002378569, 0.0003);
+    EXPECT_LE(result.lowerBound, 0.002378569 + 0.0003);
+    EXPECT_GE(result.upperBound, 0.002378569 - 0.0003);
+
+    std::vector<double> invalidThresholds = {1, 1};
+    STORM_SILENT_EXPECT_THROW(engine.estimateUnreliabilityWithSplitting(0.1, importanceFunction, invalidThresholds),
+                              storm::exceptions::IllegalArgumentException);
+}
+
+}  // namespace
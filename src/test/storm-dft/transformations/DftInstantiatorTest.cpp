@@ -4,7 +4,9 @@
 #include <carl/core/VariablePool.h>
 #include <carl/numbers/numbers.h>
 #include "storm-dft/api/storm-dft.h"
+#include "storm-dft/modelchecker/DFTInstantiationChecker.h"
 #include "storm-dft/transformations/DftInstantiator.h"
+#include "storm-parsers/api/storm-parsers.h"
 
 namespace {
 
@@ -63,4 +65,30 @@ TEST(DftInstantiatorTest, InstantiateSymmetry) {
     beExp = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<double> const>(elem);
     EXPECT_EQ(beExp->activeFailureRate(), 0.01);
 }
+
+TEST(DftInstantiatorTest, CheckInstantiations) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/and_param.dft";
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> dft = storm::dft::api::loadDFTGalileoFile<storm::RationalFunction>(file);
+    auto properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=1 \"failed\"]"));
+    storm::dft::modelchecker::DFTInstantiationChecker checker(*dft, properties);
+
+    storm::RationalFunctionVariable const& x = carl::VariablePool::getInstance().findVariableWithName("x");
+    ASSERT_NE(x, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (double value : {0.5, 1.0, 2.0, 4.0}) {
+        valuations.push_back({{x, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value)}});
+    }
+    std::vector<double> expected = {0.1548181217, 0.2487200593, 0.3402190557, 0.3862626979};
+
+    for (size_t threads : {1, 3}) {
+        std::vector<std::vector<double>> results = checker.check(valuations, threads);
+        ASSERT_EQ(valuations.size(), results.size());
+        for (size_t i = 0; i < results.size(); ++i) {
+            ASSERT_EQ(1ul, results[i].size());
+            EXPECT_NEAR(expected[i], results[i][0], 1e-8);
+        }
+    }
+}
 }  // namespace
@@ -0,0 +1,52 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-gamebased-ar/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+
+namespace {
+
+template<storm::dd::DdType DdType>
+void checkDie() {
+    typedef storm::models::symbolic::Dtmc<DdType, double> ModelType;
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<ModelType> model = storm::builder::DdPrismModelBuilder<DdType, double>().build(program)->template as<ModelType>();
+
+    storm::gbar::modelchecker::BisimulationAbstractionRefinementModelChecker<ModelType> checker(*model);
+    double precision = storm::settings::getModule<storm::settings::modules::AbstractionSettings>().getPrecision();
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"two\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+    ASSERT_TRUE(checker.canHandle(task));
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(task);
+    EXPECT_NEAR(1.0 / 6.0, result->asQuantitativeCheckResult<double>().getMin(), precision);
+
+    formula = formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]");
+    task = storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true);
+    result = checker.check(task);
+    EXPECT_NEAR(11.0 / 3.0, result->asQuantitativeCheckResult<double>().getMin(), precision);
+}
+
+}  // namespace
+
+TEST(BisimulationAbstractionRefinementModelCheckerTest, Die_Cudd) {
+    checkDie<storm::dd::DdType::CUDD>();
+}
+
+TEST(BisimulationAbstractionRefinementModelCheckerTest, Die_Sylvan) {
+    checkDie<storm::dd::DdType::Sylvan>();
+}
@@ -164,6 +164,11 @@ TEST_F(AssumptionCheckerTest, Simple1) {
         *expressionManager, expressionManager->getBooleanType(), expressionManager->getVariable("1").getExpression().getBaseExpressionPointer(),
         expressionManager->getVariable("2").getExpression().getBaseExpressionPointer(), storm::expressions::RelationType::Greater));
     EXPECT_EQ(storm::analysis::AssumptionStatus::VALID, checker.validateAssumption(assumption, order, region));
+    // The validated assumption is reused on subregions, but not on regions that are not contained in the validated one
+    EXPECT_EQ(storm::analysis::AssumptionStatus::VALID,
+              checker.validateAssumption(assumption, order, storm::api::parseRegion<storm::RationalFunction>("0.6 <= p <= 0.9", vars)));
+    EXPECT_EQ(storm::analysis::AssumptionStatus::INVALID,
+              checker.validateAssumption(assumption, order, storm::api::parseRegion<storm::RationalFunction>("0.00001 <= p <= 0.99", vars)));
 
     assumption = std::make_shared<storm::expressions::BinaryRelationExpression>(storm::expressions::BinaryRelationExpression(
         *expressionManager, expressionManager->getBooleanType(), expressionManager->getVariable("2").getExpression().getBaseExpressionPointer(),
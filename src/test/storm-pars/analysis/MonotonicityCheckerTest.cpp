@@ -58,7 +58,7 @@ TEST_F(MonotonicityCheckerTest, Simple1_larger_region) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
     // OrderExtender
@@ -106,7 +106,7 @@ TEST_F(MonotonicityCheckerTest, Simple1_small_region) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
     // OrderExtender
@@ -155,7 +155,7 @@ TEST_F(MonotonicityCheckerTest, Casestudy1) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
     // OrderExtender
@@ -208,7 +208,7 @@ TEST_F(MonotonicityCheckerTest, Casestudy2) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
     // OrderExtender
@@ -262,7 +262,7 @@ TEST_F(MonotonicityCheckerTest, Casestudy3) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
     // OrderExtender
@@ -149,7 +149,7 @@ TEST_F(OrderExtenderTest, Brp_with_bisimulation_on_matrix) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -196,7 +196,7 @@ TEST_F(OrderExtenderTest, Brp_without_bisimulation_on_matrix) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -273,7 +273,7 @@ TEST_F(OrderExtenderTest, simple1_on_matrix) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -364,7 +364,7 @@ TEST_F(OrderExtenderTest, casestudy1_on_matrix) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -417,7 +417,7 @@ TEST_F(OrderExtenderTest, casestudy2_on_matrix) {
     psiStates = propositionalChecker.check(formula.getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
     // Get the maybeStates
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-        storm::utility::graph::performProb01(model->getBackwardTransitions(), phiStates, psiStates);
+        storm::utility::graph::performProb01(*model->getBackwardTransitions(), phiStates, psiStates);
     storm::storage::BitVector topStates = statesWithProbability01.second;
     storm::storage::BitVector bottomStates = statesWithProbability01.first;
 
@@ -24,6 +24,7 @@
 #include "storm-pars/analysis/OrderExtender.h"
 #include "storm-pars/api/storm-pars.h"
 #include "storm-pars/derivative/GradientDescentInstantiationSearcher.h"
+#include "storm-pars/derivative/MultiStartGradientDescent.h"
 #include "storm-pars/transformer/SparseParametricDtmcSimplifier.h"
 #include "storm-pars/utility/FeasibilitySynthesisTask.h"
 
@@ -144,6 +145,50 @@ TYPED_TEST(GradientDescentInstantiationSearcherTest, Simple) {
     ASSERT_NEAR(doubleInstantiation * 4, 1, 1e-6);
 }
 
+TYPED_TEST(GradientDescentInstantiationSearcherTest, MultiStart) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/gradient1.pm";
+    std::string formulaAsString = "P>=0.2499 [F s=2]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<storm::models::sparse::Dtmc<storm::RationalFunction>>(*dtmc);
+    ASSERT_TRUE(simplifier.simplify(*formulas[0]));
+    dtmc = simplifier.getSimplifiedModel()->template as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    std::shared_ptr<FeasibilitySynthesisTask> t = std::make_shared<FeasibilitySynthesisTask>(formulas[0]->clone()->asSharedPointer());
+    t->setBound(formulas[0]->asOperatorFormula().getBound());
+    std::shared_ptr<FeasibilitySynthesisTask const> feasibilityTask = std::make_shared<FeasibilitySynthesisTask const>(std::move(*t));
+
+    typedef storm::derivative::GradientDescentInstantiationSearcher<typename TestFixture::FunctionType, typename TestFixture::ConstantType> Searcher;
+    uint64_t const numberOfStarts = 4;
+    std::vector<std::unique_ptr<Searcher>> searchers;
+    for (uint64_t i = 0; i < numberOfStarts; ++i) {
+        searchers.push_back(std::make_unique<Searcher>(*dtmc));
+        searchers.back()->setup(this->env(), feasibilityTask);
+    }
+
+    std::default_random_engine engine(42);
+    auto startPoints = storm::derivative::createLatinHypercubeStartPoints<storm::RationalFunction>(searchers.front()->getParameters(), numberOfStarts, engine);
+    ASSERT_EQ(numberOfStarts, startPoints.size());
+    // Each of the intervals [i/n, (i+1)/n) contains the value of exactly one start point for each parameter
+    for (auto const& parameter : searchers.front()->getParameters()) {
+        std::set<uint64_t> intervals;
+        for (auto const& point : startPoints) {
+            intervals.insert(static_cast<uint64_t>(storm::utility::convertNumber<double>(point.at(parameter)) * numberOfStarts));
+        }
+        EXPECT_EQ(numberOfStarts, intervals.size());
+    }
+
+    uint64_t numberOfImprovements = 0;
+    auto result = storm::derivative::multiStartGradientDescent<typename TestFixture::FunctionType, typename TestFixture::ConstantType>(
+        searchers, startPoints, feasibilityTask->getBound(), [&numberOfImprovements](auto const&, auto const&) { ++numberOfImprovements; });
+    EXPECT_TRUE(feasibilityTask->getBound().isSatisfied(result.second));
+    EXPECT_GE(numberOfImprovements, 1ul);
+}
+
 TYPED_TEST(GradientDescentInstantiationSearcherTest, Crowds) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm";
     std::string formulaAsString = "P<=0.00000001 [F \"observe0Greater1\"]";
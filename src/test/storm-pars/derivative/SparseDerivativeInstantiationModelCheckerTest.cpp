@@ -164,6 +164,18 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6)
                 << instantiation;
         }
+
+        // Computing all derivatives at once, either with a shared solver or with the adjoint method, yields the same results.
+        std::vector<VariableType<storm::RationalFunction>> parameterVector(parameters.begin(), parameters.end());
+        auto allDerivatives = derivativeModelChecker.check(env(), instantiation, parameterVector);
+        auto gradient = derivativeModelChecker.computeGradientAtInitialState(env(), instantiation, parameterVector);
+        for (auto const& parameter : parameterVector) {
+            double expectedResult = storm::utility::convertNumber<double>(testCase.second.at(parameter));
+            ASSERT_NEAR(storm::utility::convertNumber<double>(allDerivatives.at(parameter)->getValueVector()[derivativeModelChecker.getInitialState()]),
+                        expectedResult, 1e-6)
+                << instantiation;
+            ASSERT_NEAR(storm::utility::convertNumber<double>(gradient.at(parameter)), expectedResult, 1e-6) << instantiation;
+        }
     }
 }
 
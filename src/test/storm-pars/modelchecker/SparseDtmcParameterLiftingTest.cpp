@@ -112,6 +112,33 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Incremental) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+
+    // Checking a region after a neighboring region (i.e., incrementally) has to yield the same bounds as checking it from scratch.
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.7<=pL<=0.8,0.75<=pK<=0.95", modelParameters);
+    auto neighbor = storm::api::parseRegion<storm::RationalFunction>("0.8<=pL<=0.9,0.75<=pK<=0.95", modelParameters);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto freshChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto incrementalChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        incrementalChecker->getBoundAtInitState(this->env(), neighbor, dir);
+        double freshBound = storm::utility::convertNumber<double>(freshChecker->getBoundAtInitState(this->env(), region, dir));
+        double incrementalBound = storm::utility::convertNumber<double>(incrementalChecker->getBoundAtInitState(this->env(), region, dir));
+        EXPECT_NEAR(freshBound, incrementalBound, 1e-5);
+    }
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -587,5 +614,54 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, ZeroConf) {
               regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
+
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+    typedef typename TestFixture::ValueType ValueType;
+    typedef typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType CoefficientType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+    std::string constantsAsString = "";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsAsString);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+
+    auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+    std::vector<std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>>> additionalCheckers;
+    for (uint64_t thread = 1; thread < 4; ++thread) {
+        additionalCheckers.push_back(storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task));
+    }
+
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+    boost::optional<storm::RationalFunction> coverageThreshold = storm::utility::zero<storm::RationalFunction>();
+    auto sequentialResult = regionChecker->performRegionRefinement(this->env(), region, coverageThreshold, 3);
+    auto parallelResult = regionChecker->performParallelRegionRefinement(this->env(), region, coverageThreshold, 3,
+                                                                         storm::modelchecker::RegionResultHypothesis::Unknown, additionalCheckers);
+
+    // The refinement yields the same regions, only their order differs.
+    auto getArea = [](auto const& regionResults, storm::modelchecker::RegionResult type) {
+        auto area = storm::utility::zero<CoefficientType>();
+        for (auto const& regionResult : regionResults) {
+            if (regionResult.second == type) {
+                area += regionResult.first.area();
+            }
+        }
+        return area;
+    };
+    auto const& sequentialRegions = sequentialResult->getRegionResults();
+    auto const& parallelRegions = parallelResult->getRegionResults();
+    EXPECT_EQ(sequentialRegions.size(), parallelRegions.size());
+    for (auto type : {storm::modelchecker::RegionResult::AllSat, storm::modelchecker::RegionResult::AllViolated}) {
+        EXPECT_EQ(getArea(sequentialRegions, type), getArea(parallelRegions, type));
+    }
+    EXPECT_GT(getArea(parallelRegions, storm::modelchecker::RegionResult::AllSat), storm::utility::zero<CoefficientType>());
+}
 }  // namespace
 #endif
@@ -0,0 +1,44 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-pars/storage/ParameterSampleIndex.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+namespace {
+typedef storm::storage::ParameterRegion<storm::RationalFunction>::Valuation Valuation;
+
+Valuation makeValuation(storm::RationalFunctionVariable const& p, double pValue, storm::RationalFunctionVariable const& q, double qValue) {
+    Valuation result;
+    result.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pValue));
+    result.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qValue));
+    return result;
+}
+}  // namespace
+
+TEST(ParameterSampleIndexTest, ContainsSample) {
+    auto p = storm::createRFVariable("p");
+    auto q = storm::createRFVariable("q");
+    storm::storage::ParameterSampleIndex<storm::RationalFunction> index;
+    // Satisfying samples in the lower half of the parameter space, violating samples in the upper half
+    for (uint64_t i = 0; i <= 8; ++i) {
+        for (uint64_t j = 0; j <= 8; ++j) {
+            index.insert(makeValuation(p, i / 8.0, q, j / 8.0), j < 4);
+        }
+    }
+    index.insert(makeValuation(p, 0.5, q, 0.5), false);
+    EXPECT_EQ(81ul, index.getNumberOfSamples());
+
+    storm::storage::ParameterRegion<storm::RationalFunction> lowerRegion(makeValuation(p, 0.1, q, 0.1), makeValuation(p, 0.9, q, 0.4));
+    EXPECT_TRUE(index.containsSample(lowerRegion, true));
+    EXPECT_FALSE(index.containsSample(lowerRegion, false));
+
+    // Samples on the boundary belong to the region
+    storm::storage::ParameterRegion<storm::RationalFunction> mixedRegion(makeValuation(p, 0.3, q, 0.375), makeValuation(p, 0.4, q, 0.5));
+    EXPECT_TRUE(index.containsSample(mixedRegion, true));
+    EXPECT_TRUE(index.containsSample(mixedRegion, false));
+
+    storm::storage::ParameterRegion<storm::RationalFunction> emptyRegion(makeValuation(p, 0.51, q, 0.51), makeValuation(p, 0.62, q, 0.62));
+    EXPECT_FALSE(index.containsSample(emptyRegion, true));
+    EXPECT_FALSE(index.containsSample(emptyRegion, false));
+}
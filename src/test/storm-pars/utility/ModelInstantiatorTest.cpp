@@ -153,6 +153,54 @@ TEST_F(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST_F(ModelInstantiatorTest, BrpProb_Batch) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (double valueL : {0.1, 0.5, 0.8}) {
+        for (double valueK : {0.3, 0.9}) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueL)));
+            valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(valueK)));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    // Batch instantiation has to coincide with instantiating every valuation separately.
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> batchInstantiator(*dtmc);
+    uint64_t numberOfCallbacks = 0;
+    batchInstantiator.instantiateBatch(valuations, [&](uint64_t index, storm::models::sparse::Dtmc<double> const& batchInstantiated) {
+        EXPECT_EQ(numberOfCallbacks, index);
+        ++numberOfCallbacks;
+        storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(valuations[index]));
+        ASSERT_EQ(instantiated.getTransitionMatrix().getEntryCount(), batchInstantiated.getTransitionMatrix().getEntryCount());
+        auto batchEntry = batchInstantiated.getTransitionMatrix().begin();
+        for (auto const& entry : instantiated.getTransitionMatrix()) {
+            EXPECT_EQ(entry.getColumn(), batchEntry->getColumn());
+            EXPECT_NEAR(entry.getValue(), batchEntry->getValue(), 1e-12);
+            ++batchEntry;
+        }
+    });
+    EXPECT_EQ(valuations.size(), numberOfCallbacks);
+}
+
 TEST_F(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
 
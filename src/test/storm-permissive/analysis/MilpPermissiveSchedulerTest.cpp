@@ -67,4 +67,39 @@ TEST(MilpPermissiveSchedulerTest, DieSelection) {
     EXPECT_TRUE(qualitativeResult1[0]);
 }
 
+
+TEST(MilpPermissiveSchedulerTest, DieSelectionSweep) {
+    if (storm::test::noGurobi) {
+        GTEST_SKIP();
+    }
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::parser::FormulaParser formulaParser(program.getManager().getSharedPointer());
+    auto formulas = formulaParser.parseFromString("P>=0.10 [ F \"one\"];\nP<=0.10 [ F \"one\"];");
+    auto const& lowerBoundFormula = formulas[0].getRawFormula()->asProbabilityOperatorFormula();
+    auto const& upperBoundFormula = formulas[1].getRawFormula()->asProbabilityOperatorFormula();
+
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels().setBuildChoiceLabels(true);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    // The MILP is reused between the thresholds, so going back to an earlier threshold must yield the same outcome.
+    std::vector<double> thresholds = {0.10, 0.17, 0.05, 0.17};
+    for (bool parallel : {false, true}) {
+        auto lowerPerms = storm::ps::computePermissiveSchedulersViaMILP<>(*mdp, lowerBoundFormula, thresholds, parallel);
+        ASSERT_EQ(thresholds.size(), lowerPerms.size());
+        EXPECT_TRUE(lowerPerms[0].is_initialized());
+        EXPECT_FALSE(lowerPerms[1].is_initialized());
+        EXPECT_TRUE(lowerPerms[2].is_initialized());
+        EXPECT_FALSE(lowerPerms[3].is_initialized());
+
+        auto upperPerms = storm::ps::computePermissiveSchedulersViaMILP<>(*mdp, upperBoundFormula, thresholds, parallel);
+        ASSERT_EQ(thresholds.size(), upperPerms.size());
+        EXPECT_FALSE(upperPerms[0].is_initialized());
+        EXPECT_TRUE(upperPerms[1].is_initialized());
+        EXPECT_FALSE(upperPerms[2].is_initialized());
+        EXPECT_TRUE(upperPerms[3].is_initialized());
+    }
+}
+
 #endif
@@ -5,6 +5,7 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm/api/storm.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -77,6 +78,36 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     }
 }
 
+void portfolio_test(std::string const& path, std::string const& constants, std::string formulaString) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+    bool expected = search.analyzeForInitialStates(lookahead);
+
+    storm::pomdp::PolicySearchPortfolio<double> portfolio(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget);
+    portfolio.addDefaultConfigurations(lookahead, options);
+    // The portfolio contains the configuration above, so it finds a policy whenever that configuration does.
+    bool result = portfolio.analyzeForInitialStates();
+    if (expected) {
+        EXPECT_TRUE(result);
+    }
+    EXPECT_EQ(result, portfolio.getSuccessfulConfiguration().has_value());
+}
+
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
     program = storm::utility::prism::preprocess(program, constants);
@@ -154,6 +185,12 @@ TEST_F(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST_F(QualitativeAnalysis, Portfolio) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]");
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]");
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]");
+}
+
 TEST_F(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
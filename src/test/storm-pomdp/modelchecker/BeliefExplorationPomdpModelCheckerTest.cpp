@@ -740,6 +740,23 @@ TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmin_SE) {
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
 }
 
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmax_ParallelExpansion) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+    auto result = checker.check(this->env(), *data.formula);
+
+    auto parallelOptions = this->options();
+    parallelOptions.parallelExpansionBatchSize = 16;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> parallelChecker(data.model, parallelOptions);
+    auto parallelResult = parallelChecker.check(this->env(), *data.formula);
+
+    // The parallel expansion yields the same belief MDPs
+    EXPECT_EQ(result.lowerBound, parallelResult.lowerBound);
+    EXPECT_EQ(result.upperBound, parallelResult.upperBound);
+}
+
 #if defined STORM_HAVE_Z3_OPTIMIZE
 
 TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, simple_Pmax_Clip) {
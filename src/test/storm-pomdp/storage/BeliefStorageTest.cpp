@@ -0,0 +1,49 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-pomdp/storage/BeliefStorage.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+TEST(BeliefStorageTest, FindOrAdd) {
+    // States 0, 2 and 3 have observation 0, states 1 and 4 have observation 1.
+    storm::storage::BeliefStorage<uint64_t, double> storage({0, 1, 0, 0, 1});
+    typedef storm::storage::BeliefStorage<uint64_t, double>::BeliefType BeliefType;
+
+    BeliefType first = {{0, 0.25}, {3, 0.75}};
+    BeliefType second = {{1, 1.0 / 3.0}, {4, 2.0 / 3.0}};
+    BeliefType third = {{0, 0.5}, {2, 0.25}, {3, 0.25}};
+    EXPECT_EQ(std::make_pair(0ul, true), storage.findOrAdd(first, 0));
+    EXPECT_EQ(std::make_pair(1ul, true), storage.findOrAdd(second, 1, 3));
+    EXPECT_EQ(std::make_pair(2ul, true), storage.findOrAdd(third, 0, 4));
+    EXPECT_EQ(std::make_pair(0ul, false), storage.findOrAdd(first, 0, 4));
+    EXPECT_EQ(std::make_pair(1ul, false), storage.findOrAdd(second, 1));
+    EXPECT_EQ(3ul, storage.size());
+
+    // Stored values (quantized or not) are restored exactly.
+    EXPECT_EQ(first, storage.getBelief(0));
+    EXPECT_EQ(second, storage.getBelief(1));
+    EXPECT_EQ(third, storage.getBelief(2));
+    EXPECT_EQ(1u, storage.getObservation(1));
+
+    EXPECT_FALSE(storage.find(BeliefType({{0, 0.75}, {3, 0.25}}), 0).has_value());
+    EXPECT_EQ(2ul, storage.find(third, 0).value());
+
+    // Enforce growing the hash table.
+    for (uint64_t numerator = 0; numerator <= 2000; ++numerator) {
+        BeliefType belief = {{0, numerator / 2000.0}, {2, (2000 - numerator) / 2000.0}};
+        storage.findOrAdd(belief, 0, 2000);
+    }
+    EXPECT_EQ(3ul + 2001ul, storage.size());
+    EXPECT_EQ(0ul, storage.find(first, 0).value());
+    EXPECT_EQ(1ul, storage.find(second, 1).value());
+}
+
+TEST(BeliefStorageTest, RationalValues) {
+    storm::storage::BeliefStorage<uint64_t, storm::RationalNumber> storage({0, 0});
+    typedef storm::storage::BeliefStorage<uint64_t, storm::RationalNumber>::BeliefType BeliefType;
+    BeliefType belief = {{0, storm::utility::convertNumber<storm::RationalNumber>(std::string("1/3"))},
+                         {1, storm::utility::convertNumber<storm::RationalNumber>(std::string("2/3"))}};
+    EXPECT_EQ(std::make_pair(0ul, true), storage.findOrAdd(belief, 0, 3));
+    EXPECT_EQ(belief, storage.getBelief(0));
+    EXPECT_EQ(0ul, storage.find(belief, 0).value());
+}
@@ -0,0 +1,90 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+#include "storm-pomdp/analysis/WinningRegion.h"
+#include "storm-pomdp/storage/SupportSetIndex.h"
+
+namespace {
+storm::storage::BitVector setOf(uint64_t size, std::vector<uint_fast64_t> const& elements) {
+    return storm::storage::BitVector(size, elements);
+}
+
+storm::storage::BitVector randomSet(std::mt19937& generator, uint64_t size, double density) {
+    std::bernoulli_distribution distribution(density);
+    storm::storage::BitVector result(size);
+    for (uint64_t index = 0; index < size; ++index) {
+        if (distribution(generator)) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+TEST(SupportSetIndexTest, Simple) {
+    storm::storage::SupportSetIndex emptyIndex;
+    EXPECT_FALSE(emptyIndex.containsSupersetOf(storm::storage::BitVector(5)));
+    EXPECT_FALSE(emptyIndex.containsSubsetOf(storm::storage::BitVector(5, true)));
+
+    std::vector<storm::storage::BitVector> sets = {setOf(5, {0, 2}), setOf(5, {1, 2, 4}), setOf(5, {0, 3})};
+    storm::storage::SupportSetIndex index(sets);
+    EXPECT_TRUE(index.containsSupersetOf(setOf(5, {2})));
+    EXPECT_TRUE(index.containsSupersetOf(setOf(5, {1, 4})));
+    EXPECT_TRUE(index.containsSupersetOf(setOf(5, {0, 3})));
+    EXPECT_FALSE(index.containsSupersetOf(setOf(5, {0, 1})));
+    EXPECT_FALSE(index.containsSupersetOf(setOf(5, {0, 2, 3})));
+    EXPECT_TRUE(index.containsSubsetOf(setOf(5, {0, 1, 2})));
+    EXPECT_FALSE(index.containsSubsetOf(setOf(5, {0, 1, 4})));
+}
+
+TEST(SupportSetIndexTest, AgreesWithLinearScan) {
+    std::mt19937 generator(42);
+    uint64_t const size = 70;
+    std::vector<storm::storage::BitVector> sets;
+    for (uint64_t set = 0; set < 300; ++set) {
+        sets.push_back(randomSet(generator, size, 0.6));
+    }
+    storm::storage::SupportSetIndex index(sets);
+    for (uint64_t query = 0; query < 2000; ++query) {
+        storm::storage::BitVector small = randomSet(generator, size, 0.05);
+        storm::storage::BitVector large = randomSet(generator, size, 0.9);
+        bool expectedSuperset = false;
+        bool expectedSubset = false;
+        for (auto const& set : sets) {
+            expectedSuperset |= small.isSubsetOf(set);
+            expectedSubset |= set.isSubsetOf(large);
+        }
+        EXPECT_EQ(expectedSuperset, index.containsSupersetOf(small));
+        EXPECT_EQ(expectedSubset, index.containsSubsetOf(large));
+    }
+}
+
+TEST(SupportSetIndexTest, WinningRegionBinaryFile) {
+    storm::pomdp::WinningRegion region({3, 70});
+    region.update(0, setOf(3, {0, 1}));
+    region.update(1, setOf(70, {1, 64, 69}));
+    region.update(1, setOf(70, {2, 3}));
+
+    std::string const filename = (std::filesystem::temp_directory_path() / "storm-test-winningregion.wr").string();
+    region.storeToBinaryFile(filename);
+    storm::pomdp::WinningRegion loaded = storm::pomdp::WinningRegion::loadFromBinaryFile(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(2ul, loaded.getNumberOfObservations());
+    for (uint64_t observation = 0; observation < 2; ++observation) {
+        EXPECT_EQ(region.getWinningSetsPerObservation(observation), loaded.getWinningSetsPerObservation(observation));
+    }
+    // Queries on the loaded (indexed) region coincide with those on the original region.
+    EXPECT_TRUE(loaded.query(1, setOf(70, {64, 69})));
+    EXPECT_FALSE(loaded.query(1, setOf(70, {1, 2})));
+    EXPECT_TRUE(loaded.isWinning(0, 1));
+    EXPECT_FALSE(loaded.isWinning(0, 2));
+
+    // Updates drop the index of the affected observation.
+    loaded.update(0, setOf(3, {2}));
+    EXPECT_TRUE(loaded.isWinning(0, 2));
+}
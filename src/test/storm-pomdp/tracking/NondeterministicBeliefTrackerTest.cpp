@@ -0,0 +1,88 @@
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    return makeCanonic.transform();
+}
+
+// Follows the last transition of the last choice in every step and collects the observations along that path.
+std::vector<uint32_t> getObservationTrace(storm::models::sparse::Pomdp<double> const& pomdp, uint64_t length) {
+    uint64_t state = pomdp.getInitialStates().getNextSetIndex(0);
+    std::vector<uint32_t> trace = {pomdp.getObservation(state)};
+    for (uint64_t step = 0; step < length; ++step) {
+        auto row = pomdp.getTransitionMatrix().getRow(pomdp.getTransitionMatrix().getRowGroupIndices()[state + 1] - 1);
+        state = (row.end() - 1)->getColumn();
+        trace.push_back(pomdp.getObservation(state));
+    }
+    return trace;
+}
+
+std::vector<double> getRisk(storm::models::sparse::Pomdp<double> const& pomdp) {
+    std::vector<double> risk;
+    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        risk.push_back(static_cast<double>(state) / pomdp.getNumberOfStates());
+    }
+    return risk;
+}
+}  // namespace
+
+TEST(NondeterministicBeliefTracking, DenseCoincidesWithSparse) {
+    auto pomdp = buildMaze();
+    auto trace = getObservationTrace(*pomdp, 6);
+
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> sparseTracker(*pomdp);
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::ObservationDenseBeliefState<double>>::Options denseOptions;
+    denseOptions.parallelUpdates = true;
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::ObservationDenseBeliefState<double>> denseTracker(*pomdp, denseOptions);
+    sparseTracker.setRisk(getRisk(*pomdp));
+    denseTracker.setRisk(getRisk(*pomdp));
+    ASSERT_TRUE(sparseTracker.reset(trace.front()));
+    ASSERT_TRUE(denseTracker.reset(trace.front()));
+    for (uint64_t step = 1; step < trace.size(); ++step) {
+        ASSERT_TRUE(sparseTracker.track(trace[step]));
+        ASSERT_TRUE(denseTracker.track(trace[step]));
+        EXPECT_EQ(sparseTracker.getNumberOfBeliefs(), denseTracker.getNumberOfBeliefs());
+        EXPECT_EQ(sparseTracker.getCurrentDimension(), denseTracker.getCurrentDimension());
+        EXPECT_NEAR(sparseTracker.getCurrentRisk(true), denseTracker.getCurrentRisk(true), 1e-9);
+        EXPECT_NEAR(sparseTracker.getCurrentRisk(false), denseTracker.getCurrentRisk(false), 1e-9);
+    }
+}
+
+TEST(NondeterministicBeliefTracking, Pruning) {
+    auto pomdp = buildMaze();
+    auto trace = getObservationTrace(*pomdp, 6);
+
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> completeTracker(*pomdp);
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>>::Options options;
+    options.maxNumberOfBeliefs = 2;
+    storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> prunedTracker(*pomdp, options);
+    completeTracker.setRisk(getRisk(*pomdp));
+    prunedTracker.setRisk(getRisk(*pomdp));
+    ASSERT_TRUE(completeTracker.reset(trace.front()));
+    ASSERT_TRUE(prunedTracker.reset(trace.front()));
+    for (uint64_t step = 1; step < trace.size(); ++step) {
+        ASSERT_TRUE(completeTracker.track(trace[step]));
+        ASSERT_TRUE(prunedTracker.track(trace[step]));
+        EXPECT_LE(prunedTracker.getNumberOfBeliefs(), 2ul);
+        // Pruning keeps the beliefs with the highest risk, which is exact in the first step.
+        if (step == 1) {
+            EXPECT_NEAR(completeTracker.getCurrentRisk(true), prunedTracker.getCurrentRisk(true), 1e-9);
+        }
+    }
+    EXPECT_EQ(completeTracker.getNumberOfPrunedBeliefs(), 0ul);
+}
@@ -0,0 +1,71 @@
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/ObservationTraceUnfolder.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    return makeCanonic.transform();
+}
+
+// Follows the last transition of the last choice in every step and collects the observations along that path.
+std::vector<uint32_t> getObservationTrace(storm::models::sparse::Pomdp<double> const& pomdp, uint64_t length) {
+    uint64_t state = pomdp.getInitialStates().getNextSetIndex(0);
+    std::vector<uint32_t> trace = {pomdp.getObservation(state)};
+    for (uint64_t step = 0; step < length; ++step) {
+        auto row = pomdp.getTransitionMatrix().getRow(pomdp.getTransitionMatrix().getRowGroupIndices()[state + 1] - 1);
+        state = (row.end() - 1)->getColumn();
+        trace.push_back(pomdp.getObservation(state));
+    }
+    return trace;
+}
+
+double getMaximalRisk(std::shared_ptr<storm::models::sparse::Mdp<double>> const& unfolding) {
+    auto formula = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmax=? [F \"_goal\"]")).front();
+    auto result = storm::api::verifyWithSparseEngine<double>(unfolding, storm::api::createTask<double>(formula, true));
+    return result->asExplicitQuantitativeCheckResult<double>()[unfolding->getInitialStates().getNextSetIndex(0)];
+}
+}  // namespace
+
+TEST(ObservationTraceUnfolder, Window) {
+    auto pomdp = buildMaze();
+    auto trace = getObservationTrace(*pomdp, 8);
+    std::vector<double> risk;
+    for (uint64_t state = 0; state < pomdp->getNumberOfStates(); ++state) {
+        risk.push_back(static_cast<double>(state) / pomdp->getNumberOfStates());
+    }
+
+    uint64_t const windowSize = 3;
+    auto exprManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::pomdp::ObservationTraceUnfolder<double> completeUnfolder(*pomdp, risk, exprManager);
+    storm::pomdp::ObservationTraceUnfolder<double> windowUnfolder(*pomdp, risk, exprManager, windowSize);
+    completeUnfolder.reset(trace.front());
+    windowUnfolder.reset(trace.front());
+    for (uint64_t step = 1; step < trace.size(); ++step) {
+        auto completeUnfolding = completeUnfolder.extend(trace[step]);
+        auto windowUnfolding = windowUnfolder.extend(trace[step]);
+        // The window consists of at most windowSize layers, a selection state, a sink and a target state.
+        EXPECT_LE(windowUnfolding->getNumberOfStates(), windowSize * pomdp->getNumberOfStates() + 3);
+        if (step < windowSize) {
+            EXPECT_EQ(completeUnfolding->getNumberOfStates(), windowUnfolding->getNumberOfStates());
+            EXPECT_NEAR(getMaximalRisk(completeUnfolding), getMaximalRisk(windowUnfolding), 1e-6);
+        } else {
+            // Forgetting observations can only increase the maximal risk.
+            EXPECT_GE(getMaximalRisk(windowUnfolding), getMaximalRisk(completeUnfolding) - 1e-6);
+        }
+    }
+}
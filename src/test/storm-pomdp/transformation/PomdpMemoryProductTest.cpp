@@ -0,0 +1,80 @@
+#include "storm-config.h"
+
+#include <map>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/storage/PomdpMemoryProduct.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/PomdpMemoryUnfolder.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/graph.h"
+#include "test/storm_gtest.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Pomdp<double>> buildMaze() {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    return makeCanonic.transform();
+}
+
+void checkAgainstUnfolding(storm::models::sparse::Pomdp<double> const& pomdp, storm::storage::PomdpMemory const& memory) {
+    storm::storage::PomdpMemoryProduct<double> product(pomdp, memory);
+    auto unfolded = storm::transformer::PomdpMemoryUnfolder<double>(pomdp, memory).transform(false);
+    auto const& matrix = unfolded->getTransitionMatrix();
+
+    ASSERT_EQ(unfolded->getNumberOfStates(), product.getNumberOfStates());
+    ASSERT_EQ(unfolded->getNumberOfChoices(), product.getNumberOfChoices());
+    EXPECT_EQ(unfolded->getInitialStates(), product.getInitialStates());
+    for (uint64_t state = 0; state < product.getNumberOfStates(); ++state) {
+        ASSERT_EQ(matrix.getRowGroupIndices()[state], product.getRowGroupIndex(state));
+        ASSERT_EQ(matrix.getRowGroupSize(state), product.getRowGroupSize(state));
+        for (uint64_t localChoice = 0; localChoice < product.getRowGroupSize(state); ++localChoice) {
+            std::map<uint64_t, double> expected, actual;
+            for (auto const& entry : matrix.getRow(state, localChoice)) {
+                expected[entry.getColumn()] += entry.getValue();
+            }
+            product.forEachTransition(state, localChoice, [&actual](uint64_t successor, double probability) { actual[successor] += probability; });
+            EXPECT_EQ(expected, actual);
+        }
+    }
+
+    storm::storage::BitVector phiStates = product.liftModelStates(~pomdp.getStateLabeling().getStates("bad"));
+    storm::storage::BitVector psiStates = product.liftModelStates(pomdp.getStateLabeling().getStates("goal"));
+    auto backwardTransitions = *unfolded->getBackwardTransitions();
+    EXPECT_EQ(storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates), product.performProbGreater0E(phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb0A(backwardTransitions, phiStates, psiStates), product.performProb0A(phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb1E(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates),
+              product.performProb1E(phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::getReachableStates(matrix, product.getInitialStates(), phiStates, psiStates),
+              product.getReachableStates(product.getInitialStates(), phiStates, psiStates));
+
+    // The computed values are a fixpoint of the Bellman operator of the unfolded model.
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> values = product.computeUntilProbabilities(dir, phiStates, psiStates, 1e-10);
+        std::vector<double> expected(values.size());
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), values, nullptr, expected, nullptr);
+        std::vector<double> actual(values.size());
+        product.multiplyAndReduce(dir, values, storm::storage::BitVector(values.size(), false), actual);
+        for (auto const& state : phiStates & ~psiStates) {
+            EXPECT_NEAR(expected[state], actual[state], 1e-12);
+            EXPECT_NEAR(values[state], expected[state], 1e-8);
+        }
+    }
+}
+}  // namespace
+
+TEST(PomdpMemoryProduct, CoincidesWithUnfolding) {
+    auto pomdp = buildMaze();
+    storm::storage::PomdpMemoryBuilder builder;
+    checkAgainstUnfolding(*pomdp, builder.build(storm::storage::PomdpMemoryPattern::Trivial, 1));
+    checkAgainstUnfolding(*pomdp, builder.build(storm::storage::PomdpMemoryPattern::SelectiveCounter, 3));
+    checkAgainstUnfolding(*pomdp, builder.build(storm::storage::PomdpMemoryPattern::Full, 2));
+}
@@ -0,0 +1,43 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/logic/Formulas.h"
+
+TEST(LTL2DeterministicAutomaton, Cache) {
+#ifndef STORM_HAVE_SPOT
+    GTEST_SKIP() << "Spot not available.";
+#endif
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "storm-ltl2da-cache-test";
+    std::filesystem::remove_all(directory);
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+
+    auto formula = std::make_shared<storm::logic::EventuallyFormula>(std::make_shared<storm::logic::AtomicLabelFormula>("p0"));
+    auto da = storm::automata::LTL2DeterministicAutomaton::ltl2da(*formula, true, boost::none, directory.string());
+    ASSERT_TRUE(da != nullptr);
+    EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator(directory), std::filesystem::directory_iterator()));
+
+    // The second translation is served from memory
+    EXPECT_EQ(da, storm::automata::LTL2DeterministicAutomaton::ltl2da(*formula, true, boost::none, directory.string()));
+
+    // After clearing the in-memory cache, the automaton is read from disk
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+    auto loadedDa = storm::automata::LTL2DeterministicAutomaton::ltl2da(*formula, true, boost::none, directory.string());
+    ASSERT_TRUE(loadedDa != nullptr);
+    EXPECT_NE(da, loadedDa);
+    EXPECT_EQ(da->getNumberOfStates(), loadedDa->getNumberOfStates());
+    EXPECT_EQ(da->getAPSet().size(), loadedDa->getAPSet().size());
+    EXPECT_EQ(da->getAcceptance()->getNumberOfAcceptanceSets(), loadedDa->getAcceptance()->getNumberOfAcceptanceSets());
+    for (uint64_t state = 0; state < da->getNumberOfStates(); ++state) {
+        for (uint64_t label = 0; label < da->getNumberOfEdgesPerState(); ++label) {
+            EXPECT_EQ(da->getSuccessor(state, label), loadedDa->getSuccessor(state, label));
+        }
+    }
+
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+    std::filesystem::remove_all(directory);
+}
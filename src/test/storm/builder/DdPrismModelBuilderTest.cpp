@@ -10,8 +10,61 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/utility/dd.h"
 #include "test/storm_gtest.h"
 
+namespace {
+template<storm::dd::DdType DdType>
+void checkReachabilityStrategies(std::string const& filename) {
+    storm::prism::Program program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(filename)).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+    storm::dd::Bdd<DdType> transitions = model->getTransitionMatrix().notZero().existsAbstract(model->getNondeterminismVariables());
+
+    std::vector<std::set<storm::expressions::Variable>> moduleRowMetaVariables;
+    for (auto const& module : program.getModules()) {
+        std::set<storm::expressions::Variable> rowMetaVariables;
+        for (auto const& variable : module.getIntegerVariables()) {
+            rowMetaVariables.insert(model->getManager().getMetaVariable(variable.getName()));
+        }
+        for (auto const& variable : module.getBooleanVariables()) {
+            rowMetaVariables.insert(model->getManager().getMetaVariable(variable.getName()));
+        }
+        moduleRowMetaVariables.push_back(std::move(rowMetaVariables));
+    }
+
+    for (auto strategy : {storm::builder::SymbolicReachabilityStrategy::Bfs, storm::builder::SymbolicReachabilityStrategy::Chaining,
+                          storm::builder::SymbolicReachabilityStrategy::Saturation}) {
+        auto reachableStates =
+            storm::utility::dd::computeReachableStates(model->getInitialStates(), transitions, model->getRowVariables(), model->getColumnVariables(),
+                                                       model->getRowColumnMetaVariablePairs(), moduleRowMetaVariables, strategy)
+                .first;
+        EXPECT_TRUE(reachableStates == model->getReachableStates()) << "for strategy " << strategy << " on " << filename;
+    }
+}
+
+template<storm::dd::DdType DdType>
+void checkExplicitMatrixCache(std::string const& filename) {
+    storm::prism::Program program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(filename)).preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+    storm::dd::Odd const& odd = model->getReachableStatesOdd();
+    EXPECT_EQ(model->getNumberOfStates(), odd.getTotalOffset());
+
+    storm::storage::SparseMatrix<double> expected;
+    if (model->isNondeterministicModel()) {
+        expected = model->getTransitionMatrix().toMatrix(model->getNondeterminismVariables(), odd, odd);
+    } else {
+        expected = model->getTransitionMatrix().toMatrix(odd, odd);
+    }
+    storm::storage::SparseMatrix<double> const& explicitMatrix = model->getExplicitMatrix(model->getTransitionMatrix());
+    EXPECT_EQ(expected, explicitMatrix) << "on " << filename;
+
+    // Translating another matrix does not evict the transition matrix from the cache.
+    model->getExplicitMatrix(model->getTransitionMatrix() * model->getManager().template getConstant<double>(0.5));
+    EXPECT_EQ(&explicitMatrix, &model->getExplicitMatrix(model->getTransitionMatrix())) << "on " << filename;
+}
+}  // namespace
+
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -357,3 +410,27 @@ TEST(UnboundedTest_Cudd, Mdp) {
     storm::prism::Program program = modelDescription.preprocess("N=1").asPrismProgram();
     EXPECT_FALSE(storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().canHandle(program));
 }
+
+TEST(DdPrismModelBuilderTest_Sylvan, ReachabilityStrategies) {
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    checkReachabilityStrategies<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ReachabilityStrategies) {
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    checkReachabilityStrategies<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ExplicitMatrixCache) {
+    checkExplicitMatrixCache<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkExplicitMatrixCache<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
+
+TEST(DdPrismModelBuilderTest_Cudd, ExplicitMatrixCache) {
+    checkExplicitMatrixCache<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    checkExplicitMatrixCache<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+}
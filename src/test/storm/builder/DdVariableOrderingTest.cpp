@@ -0,0 +1,51 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+
+TEST(DdVariableOrderingTest, Force) {
+    // Variables 0 and 2 as well as 1 and 3 depend on each other.
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(4, {{0, 2}, {1, 3}});
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 1, 3}), order);
+
+    // Without dependencies, the order is kept.
+    order = storm::builder::computeForceOrder(3, {});
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), order);
+}
+
+TEST(DdVariableOrderingTest, PrismProgram) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::vector<std::string> declarationOrder = storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderingHeuristic::Declaration);
+    std::vector<std::string> forceOrder = storm::builder::computeDdVariableOrder(program, storm::builder::DdVariableOrderingHeuristic::Force);
+    uint64_t numberOfVariables = program.getNumberOfGlobalBooleanVariables() + program.getNumberOfGlobalIntegerVariables();
+    for (auto const& module : program.getModules()) {
+        numberOfVariables += module.getNumberOfBooleanVariables() + module.getNumberOfIntegerVariables();
+    }
+    ASSERT_EQ(numberOfVariables, declarationOrder.size());
+    EXPECT_TRUE(std::is_permutation(declarationOrder.begin(), declarationOrder.end(), forceOrder.begin(), forceOrder.end()));
+
+    std::vector<std::string> preferredOrder = storm::builder::applyPreferredDdVariableOrder(declarationOrder, {declarationOrder.back(), "unknown"});
+    ASSERT_EQ(declarationOrder.size(), preferredOrder.size());
+    EXPECT_EQ(declarationOrder.back(), preferredOrder.front());
+    EXPECT_TRUE(std::equal(declarationOrder.begin(), declarationOrder.end() - 1, preferredOrder.begin() + 1));
+}
+
+TEST(DdVariableOrderingTest, ExportImport) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::map<std::string, std::optional<std::pair<int64_t, int64_t>>> domains = {{"x", std::make_pair<int64_t, int64_t>(0, 3)}, {"b", std::nullopt}};
+    auto metaVariables = storm::builder::createMetaVariablesInOrder(*manager, {"b", "x", "unknown"}, domains);
+    ASSERT_EQ(2ul, metaVariables.size());
+    EXPECT_LT(manager->getMetaVariable(metaVariables.at("b").first).getHighestLevel(), manager->getMetaVariable(metaVariables.at("x").first).getHighestLevel());
+
+    std::string const filename = (std::filesystem::temp_directory_path() / "storm-test-ddvarorder.txt").string();
+    storm::builder::exportDdVariableOrder(*manager, {metaVariables.at("x"), metaVariables.at("b")}, filename);
+    EXPECT_EQ(std::vector<std::string>({"b", "x"}), storm::builder::importDdVariableOrder(filename));
+    std::filesystem::remove(filename);
+}
@@ -1,7 +1,13 @@
+#include <filesystem>
+#include <sstream>
+
 #include <storm/generator/PrismNextStateGenerator.h>
 #include "storm-config.h"
+#include "storm-parsers/parser/DirectEncodingBinaryParser.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/StateLookupTable.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -164,6 +170,142 @@ TEST_F(ExplicitPrismModelBuilderTest, POMdp) {
     model = storm::builder::ExplicitModelBuilder<double>(program).build();
 }
 
+TEST_F(ExplicitPrismModelBuilderTest, ParallelExploration) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    for (std::string const file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ctmc/cluster2.sm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels().setBuildAllRewardModels().setBuildStateValuations();
+        storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+
+        builderOptions.parallelExploration = false;
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+        builderOptions.parallelExploration = true;
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+
+        // The state indices need to coincide.
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels()) << file;
+        for (uint64_t state = 0; state < sequentialModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(sequentialModel->getStateValuations().getStateInfo(state), parallelModel->getStateValuations().getStateInfo(state)) << file;
+        }
+    }
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, StreamingBuild) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm-test-streaming-build.drb").string();
+    for (std::string const file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ctmc/cluster2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::generator::NextStateGeneratorOptions generatorOptions;
+        generatorOptions.setBuildAllLabels().setBuildAllRewardModels().setBuildChoiceLabels();
+
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).buildToDrbFile(filename);
+        storm::parser::DirectEncodingBinaryParserOptions parserOptions;
+        parserOptions.buildChoiceLabeling = true;
+        auto streamedModel = storm::parser::DirectEncodingBinaryParser<double>::parseModel(filename, parserOptions);
+
+        EXPECT_EQ(model->getType(), streamedModel->getType()) << file;
+        EXPECT_EQ(model->getTransitionMatrix(), streamedModel->getTransitionMatrix()) << file;
+        EXPECT_EQ(model->getStateLabeling(), streamedModel->getStateLabeling()) << file;
+        EXPECT_EQ(model->getChoiceLabeling(), streamedModel->getChoiceLabeling()) << file;
+        ASSERT_EQ(model->getNumberOfRewardModels(), streamedModel->getNumberOfRewardModels()) << file;
+        for (auto const& rewardModel : model->getRewardModels()) {
+            auto const& streamedRewardModel = streamedModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), streamedRewardModel.hasStateRewards()) << file;
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), streamedRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), streamedRewardModel.getStateRewardVector()) << file;
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), streamedRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, ProbabilityMassExplorationOrder) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(
+        "dtmc\n"
+        "module branches\n  s : [0..2] init 0;\n  c : [0..5] init 0;\n"
+        "  [] s=0 -> 0.99:(s'=1) + 0.01:(s'=2);\n  [] s>0 & c<5 -> (c'=c+1);\n  [] s>0 & c=5 -> true;\nendmodule\n"
+        "label \"goal\" = s=1 & c=5;\n",
+        "branches.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(14ul, model->getNumberOfTransitions());
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::ProbabilityMass;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(14ul, model->getNumberOfTransitions());
+
+    // With a state limit, breadth-first exploration does not reach the goal state whereas the probability mass guided one does.
+    builderOptions.explorationStateLimit = 8;
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getStates("unexplored").getNumberOfSetBits());
+    EXPECT_EQ(0ul, model->getStates("goal").getNumberOfSetBits());
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::ProbabilityMass;
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, builderOptions).build();
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    EXPECT_EQ(2ul, model->getStates("unexplored").getNumberOfSetBits());
+    EXPECT_EQ(1ul, model->getStates("goal").getNumberOfSetBits());
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    // The counter y is invisible and independent of x, so it is incremented first without interleaving the steps of x.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(
+        "mdp\n"
+        "module countX\n  x : [0..3] init 0;\n  [] x<3 -> 0.5:(x'=x+1) + 0.5:(x'=x);\nendmodule\n"
+        "module countY\n  y : [0..3] init 0;\n  [] y<3 -> (y'=y+1);\nendmodule\n"
+        "label \"done\" = x=3;\n",
+        "por.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(16ul, model->getNumberOfStates());
+    EXPECT_EQ(37ul, model->getNumberOfTransitions());
+
+    generatorOptions.setPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(10ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("done").getNumberOfSetBits());
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string const modules =
+        "mdp\n"
+        "module P1\n  s1 : [0..2] init 0;\n  [] s1<2 -> 0.5:(s1'=s1+1) + 0.5:(s1'=s1);\nendmodule\n"
+        "module P2 = P1 [s1=s2] endmodule\n"
+        "module P3 = P1 [s1=s3] endmodule\n";
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels().setSymmetryReduction();
+
+    // States are identified up to permutations of the processes, i.e. only the multiset of their values matters.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(modules + "label \"all\" = s1=2 & s3=2 & s2=2;\n", "symmetric.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getStates("all").getNumberOfSetBits());
+
+    // A label distinguishing the processes prevents the reduction.
+    program = storm::parser::PrismParser::parseFromString(modules + "label \"first\" = s1=2;\n", "asymmetric.nm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+    EXPECT_EQ(9ul, model->getStates("first").getNumberOfSetBits());
+}
+
 TEST_F(ExplicitPrismModelBuilderTest, FailComposition) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/system_composition.nm");
 
@@ -191,6 +333,40 @@ TEST_F(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST_F(ExplicitPrismModelBuilderTest, BatchExplicitLookup) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto builder = storm::builder::ExplicitModelBuilder<double>(program);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+    auto lookup = builder.exportExplicitStateLookup();
+    auto svar = program.getModules()[0].getIntegerVariable("s").getExpressionVariable();
+    auto dvar = program.getModules()[0].getIntegerVariable("d").getExpressionVariable();
+    auto& manager = program.getManager();
+    ASSERT_EQ(std::vector<std::string>({"s", "d"}), lookup.getLookupTable().getVariableNames());
+
+    // Valuations of (s, d): a reachable one, an unreachable one and one that is out of bounds.
+    std::vector<int64_t> valuations = {7, 2, 1, 2, 9, 2};
+    uint32_t numberOfStates = static_cast<uint32_t>(model->getNumberOfStates());
+    std::vector<uint32_t> expected = {lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}}), numberOfStates, numberOfStates};
+    EXPECT_EQ(expected, lookup.lookup(valuations));
+    STORM_SILENT_EXPECT_THROW(lookup.lookup(std::vector<int64_t>({7, 2, 1})), storm::exceptions::InvalidArgumentException);
+
+    // The stored table gives the same results.
+    std::stringstream stream;
+    lookup.getLookupTable().store(stream);
+    auto table = storm::builder::StateLookupTable<uint32_t>::load(stream);
+    EXPECT_EQ(model->getNumberOfStates(), table.size());
+    EXPECT_EQ(expected, table.lookup(valuations));
+    for (int64_t s = 0; s <= 7; ++s) {
+        for (int64_t d = 0; d <= 6; ++d) {
+            std::vector<int64_t> valuation = {s, d};
+            EXPECT_EQ(lookup.lookup({{svar, manager.integer(s)}, {dvar, manager.integer(d)}}), table.lookup(valuation.data()));
+        }
+    }
+
+    std::stringstream invalidStream("not a table");
+    STORM_SILENT_EXPECT_THROW(storm::builder::StateLookupTable<uint32_t>::load(invalidStream), storm::exceptions::WrongFormatException);
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
@@ -234,3 +410,31 @@ TEST_F(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST_F(ExplicitPrismModelBuilderTest, CompiledGuards) {
+    // If no compiler is available, the guards are interpreted and the test still has to succeed.
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setCompileGuards();
+    generatorOptions.setCompiledGuardsCacheDirectory((std::filesystem::temp_directory_path() / "storm-test-compiled").string());
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(677ul, model->getNumberOfStates());
+    EXPECT_EQ(867ul, model->getNumberOfTransitions());
+
+    // The second build uses the cached library.
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(273ul, model->getNumberOfStates());
+    EXPECT_EQ(397ul, model->getNumberOfTransitions());
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(273ul, model->getNumberOfStates());
+    EXPECT_EQ(397ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(272ul, model->getNumberOfStates());
+    EXPECT_EQ(492ul, model->getNumberOfTransitions());
+
+    std::filesystem::remove_all(std::filesystem::temp_directory_path() / "storm-test-compiled");
+}
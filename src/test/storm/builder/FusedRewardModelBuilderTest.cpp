@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/builder/FusedRewardModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(FusedRewardModelBuilderTest, DistributesRewards) {
+    std::vector<storm::builder::RewardModelInformation> information;
+    information.emplace_back("states", true, false, false);
+    information.emplace_back("none", false, false, false);
+    information.emplace_back("both", true, true, false);
+    information.emplace_back("choices", false, true, false);
+    storm::builder::FusedRewardModelBuilder<double> builder(information);
+
+    // Use enough states such that the rewards are stored in multiple blocks. Each state has two choices except for the last one.
+    uint64_t const numberOfStates = 50000;
+    for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+        double const value = static_cast<double>(state);
+        builder.addStateRewards(std::vector<double>({value, -1.0, 2 * value, -1.0}));
+        builder.addChoiceRewards(std::vector<double>({-1.0, -1.0, 3 * value, 4 * value}));
+        builder.addChoiceRewards(std::vector<double>({-1.0, -1.0, 5 * value, 6 * value}));
+    }
+    builder.addZeroStateRewards();
+    builder.addZeroChoiceRewards();
+
+    uint64_t const numberOfChoices = 2 * numberOfStates - 1;
+    auto rewardModels = builder.build(numberOfChoices, numberOfStates);
+    ASSERT_EQ(4ull, rewardModels.size());
+
+    auto const& states = rewardModels.at("states");
+    ASSERT_TRUE(states.hasStateRewards());
+    EXPECT_FALSE(states.hasStateActionRewards());
+    EXPECT_TRUE(rewardModels.at("none").empty());
+    auto const& both = rewardModels.at("both");
+    ASSERT_TRUE(both.hasStateRewards());
+    ASSERT_TRUE(both.hasStateActionRewards());
+    auto const& choices = rewardModels.at("choices");
+    EXPECT_FALSE(choices.hasStateRewards());
+    ASSERT_TRUE(choices.hasStateActionRewards());
+
+    ASSERT_EQ(numberOfStates, states.getStateRewardVector().size());
+    ASSERT_EQ(numberOfChoices, both.getStateActionRewardVector().size());
+    for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+        double const value = static_cast<double>(state);
+        EXPECT_EQ(value, states.getStateReward(state));
+        EXPECT_EQ(2 * value, both.getStateReward(state));
+        EXPECT_EQ(3 * value, both.getStateActionReward(2 * state));
+        EXPECT_EQ(5 * value, both.getStateActionReward(2 * state + 1));
+        EXPECT_EQ(4 * value, choices.getStateActionReward(2 * state));
+        EXPECT_EQ(6 * value, choices.getStateActionReward(2 * state + 1));
+    }
+    EXPECT_EQ(0.0, states.getStateReward(numberOfStates - 1));
+    EXPECT_EQ(0.0, both.getStateActionReward(numberOfChoices - 1));
+}
+
+TEST(FusedRewardModelBuilderTest, RejectsTransitionRewards) {
+    std::vector<storm::builder::RewardModelInformation> information;
+    information.emplace_back("transitions", false, false, true);
+    STORM_SILENT_EXPECT_THROW(storm::builder::FusedRewardModelBuilder<double> builder(information), storm::exceptions::InvalidArgumentException);
+}
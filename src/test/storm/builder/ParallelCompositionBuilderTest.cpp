@@ -0,0 +1,44 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// A repairable component that fails with rate 1 and is repaired with rate 2.
+std::shared_ptr<storm::models::sparse::Ctmc<double>> buildComponent() {
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 2);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 0, 2.0);
+    storm::models::sparse::StateLabeling labeling(2);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("failed");
+    labeling.addLabelToState("failed", 1);
+    return std::make_shared<storm::models::sparse::Ctmc<double>>(builder.build(), std::move(labeling));
+}
+
+}  // namespace
+
+TEST(ParallelCompositionBuilderTest, ComposeMinimized) {
+    typedef storm::builder::ParallelCompositionBuilder<double> Builder;
+    std::vector<std::shared_ptr<storm::models::sparse::Ctmc<double>>> components = {buildComponent(), buildComponent(), buildComponent()};
+
+    auto fullProduct = Builder::compose(Builder::compose(components[0], components[1], false), components[2], false);
+    EXPECT_EQ(8ul, fullProduct->getNumberOfStates());
+
+    // The states of the minimized product correspond to the number of failed components.
+    for (bool labelAnd : {false, true}) {
+        auto composed = Builder::composeMinimized(components, labelAnd, {}, storm::storage::BisimulationType::Strong);
+        EXPECT_EQ(4ul, composed->getNumberOfStates());
+        ASSERT_EQ(1ul, composed->getInitialStates().getNumberOfSetBits());
+        EXPECT_TRUE(composed->hasLabel("failed"));
+        EXPECT_FALSE(composed->getStateLabeling().getStateHasLabel("failed", *composed->getInitialStates().begin()));
+        EXPECT_NEAR(3.0, composed->getExitRateVector()[*composed->getInitialStates().begin()], 1e-12);
+    }
+
+    auto single = Builder::composeMinimized({components[0]}, false, {}, storm::storage::BisimulationType::Strong);
+    EXPECT_EQ(2ul, single->getNumberOfStates());
+}
@@ -9,11 +9,15 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -475,6 +479,64 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, MultipleTimeBounds) {
+    std::string formulasString = "P=? [ F<=100 !\"minimum\"]";
+    std::vector<double> timeBounds = {0.0, 0.5, 10.0, 100.0, 100.0, 1000.0};
+    for (auto const& timeBound : timeBounds) {
+        formulasString += "; P=? [ F<=" + std::to_string(timeBound) + " !\"minimum\"]";
+    }
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+    storm::Environment env;
+
+    storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double> task(
+        formulas[0]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    auto result = checker.computeBoundedUntilProbabilities(env, task, timeBounds);
+    ASSERT_TRUE(result->isExplicitTimeBoundsCheckResult());
+    auto const& timeBoundsResult = result->asExplicitTimeBoundsCheckResult<double>();
+    ASSERT_EQ(timeBounds.size(), timeBoundsResult.getNumberOfTimeBounds());
+    EXPECT_EQ(timeBounds, timeBoundsResult.getTimeBounds());
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+    EXPECT_NEAR(5.5461254704419085E-5, timeBoundsResult.getResult(3)[initialState], 1e-6);
+
+    // Each time bound has to yield the same values as checking the property for that bound alone.
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        auto singleResult = checker.check(env, *formulas[boundIndex + 1]);
+        auto const& singleValues = singleResult->asExplicitQuantitativeCheckResult<double>();
+        for (uint64_t state = 0; state < ctmc->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(singleValues[state], timeBoundsResult.getResult(boundIndex)[state], 1e-10) << "for time bound " << timeBounds[boundIndex];
+        }
+    }
+
+    std::vector<double> unsortedTimeBounds = {10.0, 1.0};
+    STORM_SILENT_EXPECT_THROW(checker.computeBoundedUntilProbabilities(env, task, unsortedTimeBounds), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(CtmcCslModelCheckerTest, TransientMethods) {
+    std::string formulasString = "P=? [ F<=10 !\"minimum\"]; P=? [ F[2,10] !\"minimum\"]; R{\"num_repairs\"}=? [ C<=10 ]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+
+    storm::Environment uniformizationEnv;
+    for (auto const method : {storm::solver::CtmcTransientMethod::AdaptiveUniformization, storm::solver::CtmcTransientMethod::Krylov}) {
+        storm::Environment env;
+        env.solver().timeBounded().setCtmcMethod(method);
+        for (auto const& formula : formulas) {
+            auto expected = checker.check(uniformizationEnv, *formula);
+            auto result = checker.check(env, *formula);
+            auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>();
+            auto const& values = result->asExplicitQuantitativeCheckResult<double>();
+            for (uint64_t state = 0; state < ctmc->getNumberOfStates(); ++state) {
+                EXPECT_NEAR(expectedValues[state], values[state], 1e-6) << "for method " << toString(method) << " and formula " << *formula;
+            }
+        }
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
@@ -6,6 +6,8 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -152,4 +154,48 @@ TYPED_TEST(ExpectedVisitingTimesCtmcCslModelCheckerTest, expvisittimestest) {
     EXPECT_EQ(sortedVector[9], storm::utility::infinity<ValueType>())
         << "Result of expected visiting times computation is " << storm::utility::vector::toString(resultVector) << '\n';
 }
+
+TYPED_TEST(ExpectedVisitingTimesCtmcCslModelCheckerTest, batchedexpvisittimestest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto model = this->buildJaniModel(STORM_TEST_RESOURCES_DIR "/ctmc/expvisittimes.jani");
+    auto probabilisticTransitions = model->computeProbabilityMatrix();
+    uint64_t const numStates = model->getNumberOfStates();
+
+    // The expected visiting times when starting in each state, computed one by one
+    std::vector<std::vector<ValueType>> expected;
+    for (uint64_t state = 0; state < numStates; ++state) {
+        storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<ValueType> helper(probabilisticTransitions, model->getExitRateVector());
+        expected.push_back(helper.computeExpectedVisitingTimes(this->env(), state));
+    }
+
+    auto checkBatched = [&](storm::Environment const& env) {
+        std::vector<std::vector<ValueType>> batched(numStates, std::vector<ValueType>(numStates, storm::utility::zero<ValueType>()));
+        for (uint64_t state = 0; state < numStates; ++state) {
+            batched[state][state] = storm::utility::one<ValueType>();
+        }
+        storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<ValueType> helper(probabilisticTransitions, model->getExitRateVector());
+        helper.computeExpectedVisitingTimes(env, batched);
+        for (uint64_t initialState = 0; initialState < numStates; ++initialState) {
+            for (uint64_t state = 0; state < numStates; ++state) {
+                if (storm::utility::isInfinity(expected[initialState][state])) {
+                    EXPECT_TRUE(storm::utility::isInfinity(batched[initialState][state]));
+                } else {
+                    EXPECT_NEAR(expected[initialState][state], batched[initialState][state], this->precision())
+                        << "Initial state " << initialState << ", state " << state << ".";
+                }
+            }
+        }
+    };
+    checkBatched(this->env());
+
+    if (!this->env().solver().isForceSoundness()) {
+        // Process the SCCs (concurrently) in topological order
+        storm::Environment topologicalEnv = this->env();
+        topologicalEnv.solver().topological().setUnderlyingEquationSolverType(this->env().solver().getLinearEquationSolverType());
+        topologicalEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        topologicalEnv.solver().topological().setParallelSccSolving(true);
+        checkBatched(topologicalEnv);
+    }
+}
 }  // namespace
@@ -15,6 +15,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
@@ -415,4 +416,44 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(MarkovAutomatonCslModelCheckerBatchTest, BatchedUnifPlus) {
+    std::string formulasString = "Pmax=? [F<1 s>2]";
+    formulasString += "; Pmax=? [F<1.3 s=3]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+    storm::Environment env;
+
+    std::vector<storm::storage::BitVector> goals;
+    for (auto const& formula : formulas) {
+        auto const& untilFormula = formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+        goals.push_back(checker.check(env, untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+    }
+    std::vector<double> bounds = {1.0, 1.3};
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+
+    auto batchResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+        env, storm::OptimizationDirection::Maximize, model->getTransitionMatrix(), model->getExitRates(), model->getMarkovianStates(), allStates, goals,
+        bounds);
+    ASSERT_EQ(goals.size() * bounds.size(), batchResult.size());
+    uint64_t initialState = *model->getInitialStates().begin();
+    EXPECT_NEAR(0.727468207, batchResult[1 * bounds.size() + 1][initialState], 1e-6);
+
+    // The results have to coincide with the ones obtained for the single queries.
+    for (uint64_t goal = 0; goal < goals.size(); ++goal) {
+        for (uint64_t bound = 0; bound < bounds.size(); ++bound) {
+            auto singleResult = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+                env, storm::solver::SolveGoal<double>(storm::OptimizationDirection::Maximize), model->getTransitionMatrix(), model->getExitRates(),
+                model->getMarkovianStates(), allStates, goals[goal], std::make_pair(0.0, bounds[bound]));
+            auto const& result = batchResult[goal * bounds.size() + bound];
+            ASSERT_EQ(singleResult.size(), result.size());
+            for (uint64_t state = 0; state < result.size(); ++state) {
+                EXPECT_NEAR(singleResult[state], result[state], 1e-6);
+            }
+        }
+    }
+}
 }  // namespace
@@ -6,8 +6,10 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
+#include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/helper/infinitehorizon/internal/AggregationDisaggregationHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -61,6 +63,63 @@ class SparseClassicEnvironment {
     }
 };
 
+class SparseNativeBicgstabEnvironment {
+   public:
+    static const CtmcEngine engine = CtmcEngine::JaniSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+};
+
+class SparseNativeGmresEnvironment {
+   public:
+    static const CtmcEngine engine = CtmcEngine::JaniSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+};
+
+class SparseIadEnvironment {
+   public:
+    static const CtmcEngine engine = CtmcEngine::JaniSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.modelchecker().setSteadyStateDistributionAlgorithm(storm::SteadyStateDistributionAlgorithm::AggregationDisaggregation);
+        env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        return env;
+    }
+};
+
+class SparseParallelBsccEnvironment {
+   public:
+    static const CtmcEngine engine = CtmcEngine::JaniSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().lra().setParallelComponentSolving(true);
+        return env;
+    }
+};
+
 class SparseEigenRationalLuEnvironment {
    public:
     static const CtmcEngine engine = CtmcEngine::JaniSparse;
@@ -120,7 +179,9 @@ class SteadyStateCtmcCslModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, SparseSoundEvtEnvironment, SparseClassicEnvironment, SparseEigenRationalLuEnvironment> TestingTypes;
+typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, SparseSoundEvtEnvironment, SparseClassicEnvironment, SparseNativeBicgstabEnvironment,
+                         SparseNativeGmresEnvironment, SparseIadEnvironment, SparseParallelBsccEnvironment, SparseEigenRationalLuEnvironment>
+    TestingTypes;
 
 TYPED_TEST_SUITE(SteadyStateCtmcCslModelCheckerTest, TestingTypes, );
 
@@ -155,4 +216,49 @@ TYPED_TEST(SteadyStateCtmcCslModelCheckerTest, steadystatetest) {
     EXPECT_NEAR(sortedVector[7], this->parseNumber("3/5"), this->precision())
         << "Result of steady state computation is " << storm::utility::vector::toString(resultVector) << '\n';
 }
+
+TEST(SteadyStateAggregationDisaggregationTest, NearlyCompletelyDecomposable) {
+    // Two blocks of strongly coupled states, {0,1} and {2,3}, with weak transitions between them.
+    // The embedded DTMC is doubly stochastic, i.e., its steady state distribution is uniform.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4);
+    builder.addNextValue(0, 0, 0.49);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.01);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(2, 2, 0.5);
+    builder.addNextValue(2, 3, 0.5);
+    builder.addNextValue(3, 0, 0.01);
+    builder.addNextValue(3, 2, 0.49);
+    builder.addNextValue(3, 3, 0.5);
+    auto transitionMatrix = builder.build();
+    storm::storage::StronglyConnectedComponent bscc;
+    for (uint64_t state = 0; state < 4; ++state) {
+        bscc.insert(state);
+    }
+    std::vector<double> exitRates = {1.0, 2.0, 1.0, 2.0};
+
+    storm::Environment env;
+    env.solver().lra().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-12));
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-12));
+
+    storm::modelchecker::helper::internal::AggregationDisaggregationHelper<double> dtmcHelper(transitionMatrix, bscc, nullptr);
+    EXPECT_EQ(2ull, dtmcHelper.getNumberOfBlocks());
+    auto result = dtmcHelper.computeSteadyStateDistribution(env);
+    ASSERT_EQ(4ull, result.size());
+    for (auto const& value : result) {
+        EXPECT_NEAR(0.25, value, 1e-8);
+    }
+
+    // In the CTMC, the time spent in a state is proportional to the inverse of its exit rate.
+    storm::modelchecker::helper::internal::AggregationDisaggregationHelper<double> ctmcHelper(transitionMatrix, bscc, &exitRates);
+    result = ctmcHelper.computeSteadyStateDistribution(env);
+    ASSERT_EQ(4ull, result.size());
+    EXPECT_NEAR(1.0 / 3.0, result[0], 1e-8);
+    EXPECT_NEAR(1.0 / 6.0, result[1], 1e-8);
+    EXPECT_NEAR(1.0 / 3.0, result[2], 1e-8);
+    EXPECT_NEAR(1.0 / 6.0, result[3], 1e-8);
+}
 }  // namespace
@@ -2,6 +2,7 @@
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/lexicographic/lexicographicModelChecking.h"
@@ -37,6 +38,16 @@ TEST(LexicographicModelCheckingTest, prob_sched1) {
         EXPECT_NEAR(0.5, lexResult[1], storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
         EXPECT_NEAR(0, lexResult[2], storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
     }
+    {
+        // analyze the end components concurrently
+        env.modelchecker().setLtlThreads(2);
+        auto result = checker.checkLexObjectiveFormula(env, tasks[0]);
+        ASSERT_TRUE(result->isLexicographicCheckResult());
+        auto& lexResult = result->asLexicographicCheckResult<double>().getInitialStateValue();
+        EXPECT_NEAR(1.0, lexResult[0], storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+        EXPECT_NEAR(0.5, lexResult[1], storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+        EXPECT_NEAR(0, lexResult[2], storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+    }
 #else
     GTEST_SKIP();
 #endif
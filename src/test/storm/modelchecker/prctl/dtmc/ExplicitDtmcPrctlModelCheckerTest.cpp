@@ -8,6 +8,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
@@ -158,3 +159,33 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979591836789, quantitativeResult3[0], precision);
 }
+
+TEST(ExplicitDtmcPrctlModelCheckerTest, StepBounds) {
+    storm::Environment env;
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    auto expManager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::parser::FormulaParser formulaParser(expManager);
+
+    std::vector<uint64_t> const stepBounds = {0, 3, 10, 10, 50};
+    auto formula = formulaParser.parseSingleFormulaFromString("P=? [F<=1 \"observe0Greater1\"]");
+    storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double> task(
+        formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    auto result = checker.computeBoundedUntilProbabilities(env, task, stepBounds);
+    ASSERT_TRUE(result->isExplicitTimeBoundsCheckResult());
+    auto const& boundsResult = result->asExplicitTimeBoundsCheckResult<double>();
+    ASSERT_EQ(stepBounds.size(), boundsResult.getNumberOfTimeBounds());
+    for (uint64_t boundIndex = 0; boundIndex < stepBounds.size(); ++boundIndex) {
+        auto singleFormula =
+            formulaParser.parseSingleFormulaFromString("P=? [F<=" + std::to_string(stepBounds[boundIndex]) + " \"observe0Greater1\"]");
+        auto singleResult = checker.check(env, *singleFormula);
+        auto const& expected = singleResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& actual = boundsResult.getResult(boundIndex).getValueVector();
+        ASSERT_EQ(expected.size(), actual.size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], actual[state], 1e-10) << "for state " << state << " and bound " << stepBounds[boundIndex];
+        }
+    }
+}
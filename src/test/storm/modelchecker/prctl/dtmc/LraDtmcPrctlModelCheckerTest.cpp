@@ -114,6 +114,17 @@ class DistrGmmxxDoubleGmresEnvironment {
     }
 };
 
+class DistrGmmxxDoubleGmresParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = DistrGmmxxDoubleGmresEnvironment::createEnvironment();
+        env.solver().lra().setParallelComponentSolving(true);
+        return env;
+    }
+};
+
 class DistrEigenRationalLUEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -175,8 +186,8 @@ class LraDtmcPrctlModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<GBGmmxxDoubleGmresEnvironment, GBEigenDoubleDGmresEnvironment, GBEigenRationalLUEnvironment, GBNativeSorEnvironment,
-                         GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment,
-                         ValueIterationEnvironment>
+                         GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrGmmxxDoubleGmresParallelEnvironment,
+                         DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment, ValueIterationEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LraDtmcPrctlModelCheckerTest, TestingTypes, );
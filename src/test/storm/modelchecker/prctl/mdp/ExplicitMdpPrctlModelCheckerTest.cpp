@@ -3,11 +3,15 @@
 
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseReachabilityBatch.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitTimeBoundsCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
@@ -202,3 +206,125 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, AnalysisCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::Environment cachingEnv = env;
+    cachingEnv.modelchecker().setAnalysisCacheEnabled(true);
+
+    storm::parser::FormulaParser formulaParser;
+    auto minFormula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"two\"]");
+    auto maxFormula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]");
+    auto boundedFormula = formulaParser.parseSingleFormulaFromString("Pmax>=0.5 [F \"two\"]");
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    auto expected = checker.check(env, *minFormula)->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    EXPECT_EQ(0ull, mdp->getAnalysisCache()->getNumberOfCachedUntilProbabilities());
+
+    // The first computation fills the cache, the second one reuses the results.
+    for (uint64_t i = 0; i < 2; ++i) {
+        auto result = checker.check(cachingEnv, *minFormula);
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expected.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expected[state], values[state], precision);
+        }
+        EXPECT_EQ(1ull, mdp->getAnalysisCache()->getNumberOfCachedUntilProbabilities());
+    }
+
+    // Results for other optimization directions are cached separately.
+    auto result = checker.check(cachingEnv, *maxFormula);
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(2ull, mdp->getAnalysisCache()->getNumberOfCachedUntilProbabilities());
+    auto checkTask = storm::modelchecker::CheckTask<storm::logic::Formula, double>(*boundedFormula, true);
+    result = checker.check(cachingEnv, checkTask);
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[*mdp->getInitialStates().begin()]);
+    EXPECT_EQ(2ull, mdp->getAnalysisCache()->getNumberOfCachedUntilProbabilities());
+
+    // The backward transitions are only computed once.
+    auto const& constMdp = *mdp;
+    auto backwardTransitions = constMdp.getBackwardTransitions();
+    EXPECT_EQ(backwardTransitions, constMdp.getBackwardTransitions());
+    EXPECT_EQ(constMdp.getTransitionMatrix().transpose(true), *backwardTransitions);
+
+    // Non-const access to the transition matrix invalidates the cache, but previously obtained data stays alive.
+    auto cache = mdp->getAnalysisCache();
+    mdp->getTransitionMatrix();
+    EXPECT_EQ(0ull, mdp->getAnalysisCache()->getNumberOfCachedUntilProbabilities());
+    EXPECT_EQ(2ull, cache->getNumberOfCachedUntilProbabilities());
+    EXPECT_NE(backwardTransitions, constMdp.getBackwardTransitions());
+    EXPECT_EQ(constMdp.getTransitionMatrix().transpose(true), *backwardTransitions);
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, BatchedReachability) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    for (std::string const label : {"two", "three", "seven"}) {
+        formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin=? [F \"" + label + "\"]"));
+        formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [!\"done\" U \"" + label + "\"]"));
+    }
+    // A single formula with this left subformula and a bounded formula are not batched.
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]"));
+    formulas.push_back(formulaParser.parseSingleFormulaFromString("Pmin>=0.5 [F \"two\"]"));
+
+    storm::modelchecker::SparseReachabilityBatch<double> batch(mdp, formulas);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    for (uint64_t i = 0; i < 6; ++i) {
+        ASSERT_TRUE(batch.contains(*formulas[i]));
+        auto expected = checker.check(env, *formulas[i])->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto result = batch.check(env, *formulas[i]);
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expected.size(), values.size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(expected[state], values[state], precision) << "for formula " << *formulas[i] << " and state " << state;
+        }
+        EXPECT_FALSE(batch.contains(*formulas[i]));
+    }
+    EXPECT_FALSE(batch.contains(*formulas[6]));
+    EXPECT_FALSE(batch.contains(*formulas[7]));
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, StepBounds) {
+    storm::Environment env;
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/leader4.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4.trans.rew");
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::parser::FormulaParser formulaParser;
+
+    std::vector<uint64_t> const stepBounds = {0, 5, 25, 25, 40};
+    for (std::string const dir : {"min", "max"}) {
+        auto formula = formulaParser.parseSingleFormulaFromString("P" + dir + "=? [F<=1 \"elected\"]");
+        storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double> task(
+            formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+        task.setOptimizationDirection(dir == "min" ? storm::OptimizationDirection::Minimize : storm::OptimizationDirection::Maximize);
+        auto result = checker.computeBoundedUntilProbabilities(env, task, stepBounds);
+        ASSERT_TRUE(result->isExplicitTimeBoundsCheckResult());
+        auto const& boundsResult = result->asExplicitTimeBoundsCheckResult<double>();
+        ASSERT_EQ(stepBounds.size(), boundsResult.getNumberOfTimeBounds());
+        for (uint64_t boundIndex = 0; boundIndex < stepBounds.size(); ++boundIndex) {
+            auto singleFormula =
+                formulaParser.parseSingleFormulaFromString("P" + dir + "=? [F<=" + std::to_string(stepBounds[boundIndex]) + " \"elected\"]");
+            auto singleResult = checker.check(env, *singleFormula);
+            auto const& expected = singleResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& actual = boundsResult.getResult(boundIndex).getValueVector();
+            ASSERT_EQ(expected.size(), actual.size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], actual[state], 1e-10) << "for state " << state << " and bound " << stepBounds[boundIndex];
+            }
+        }
+    }
+}
@@ -39,6 +39,18 @@ class SparseValueTypeValueIterationEnvironment {
     }
 };
 
+class SparseValueTypeParallelValueIterationEnvironment {
+   public:
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = SparseValueTypeValueIterationEnvironment::createEnvironment();
+        env.solver().lra().setParallelComponentSolving(true);
+        return env;
+    }
+};
+
 class SparseValueTypeLinearProgrammingEnvironment {
    public:
     static const bool isExact = false;
@@ -126,7 +138,8 @@ class LraMdpPrctlModelCheckerTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment, SparseSoundEnvironment
+typedef ::testing::Types<SparseValueTypeValueIterationEnvironment, SparseValueTypeParallelValueIterationEnvironment, SparseValueTypeLinearProgrammingEnvironment,
+                         SparseSoundEnvironment
 #ifdef STORM_HAVE_Z3_OPTIMIZE
                          ,
                          SparseRationalLinearProgrammingEnvironment
@@ -9,6 +9,7 @@
 #include "storm/api/properties.h"
 #include "storm/parser/CSVParser.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -34,6 +35,17 @@ class UnsoundEnvironment {
     }
 };
 
+class UnsoundConcurrentEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        env.modelchecker().setEpochThreads(3);
+        return env;
+    }
+};
+
 class SoundEnvironment {
    public:
     typedef double ValueType;
@@ -171,7 +183,7 @@ class QuantileQueryTest : public ::testing::Test {
     }
 };
 
-typedef ::testing::Types<UnsoundEnvironment, SoundEnvironment, ExactEnvironment> TestingTypes;
+typedef ::testing::Types<UnsoundEnvironment, UnsoundConcurrentEnvironment, SoundEnvironment, ExactEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(QuantileQueryTest, TestingTypes, );
 
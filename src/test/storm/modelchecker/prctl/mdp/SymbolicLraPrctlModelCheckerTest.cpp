@@ -0,0 +1,115 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/utility/dd.h"
+
+namespace {
+
+// Two end components: the periodic cycle between s=1 and s=2 (gain 0.5) and the self-loop in s=3 (gain 0.3). In the MDP, s=0 can additionally move to s=3
+// directly.
+std::string createProgram(bool nondeterministic) {
+    return std::string(nondeterministic ? "mdp" : "dtmc") + R"(
+module m
+    s : [0..3] init 0;
+    [] s=0 -> 0.25 : (s'=1) + 0.75 : (s'=3);
+)" + (nondeterministic ? "    [] s=0 -> (s'=3);\n" : "") +
+           R"(    [] s=1 -> (s'=2);
+    [] s=2 -> (s'=1);
+    [] s=3 -> (s'=3);
+endmodule
+rewards "r"
+    s=1 : 1;
+    s=3 : 0.3;
+endrewards
+label "one" = s=1;
+)";
+}
+
+template<typename ModelType, typename CheckerType>
+std::vector<double> checkAtInitialState(bool nondeterministic, std::string const& formulasAsString) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(createProgram(nondeterministic), "lra");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    auto model = storm::api::buildSymbolicModel<ModelType::DdType, double>(program, formulas)->template as<ModelType>();
+
+    CheckerType checker(*model);
+    storm::Environment env;
+    storm::modelchecker::SymbolicQualitativeCheckResult<ModelType::DdType> initialStates(model->getReachableStates(), model->getInitialStates());
+    std::vector<double> results;
+    for (auto const& formula : formulas) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+        result->filter(initialStates);
+        results.push_back(result->template asQuantitativeCheckResult<double>().getMin());
+    }
+    return results;
+}
+
+template<storm::dd::DdType DdType>
+void checkMdp() {
+    typedef storm::models::symbolic::Mdp<DdType, double> ModelType;
+    auto results = checkAtInitialState<ModelType, storm::modelchecker::SymbolicMdpPrctlModelChecker<ModelType>>(
+        true, "Rmax=? [LRA]; Rmin=? [LRA]; LRAmax=? [\"one\"]; LRAmin=? [\"one\"]");
+    ASSERT_EQ(4ul, results.size());
+    EXPECT_NEAR(0.25 * 0.5 + 0.75 * 0.3, results[0], 1e-6);
+    EXPECT_NEAR(0.3, results[1], 1e-6);
+    EXPECT_NEAR(0.25 * 0.5, results[2], 1e-6);
+    EXPECT_NEAR(0.0, results[3], 1e-6);
+}
+
+template<storm::dd::DdType DdType>
+void checkDtmc() {
+    typedef storm::models::symbolic::Dtmc<DdType, double> ModelType;
+    auto results = checkAtInitialState<ModelType, storm::modelchecker::SymbolicDtmcPrctlModelChecker<ModelType>>(false, "R=? [LRA]; LRA=? [\"one\"]");
+    ASSERT_EQ(2ul, results.size());
+    EXPECT_NEAR(0.25 * 0.5 + 0.75 * 0.3, results[0], 1e-6);
+    EXPECT_NEAR(0.25 * 0.5, results[1], 1e-6);
+}
+
+}  // namespace
+
+TEST(SymbolicLraPrctlModelCheckerTest, StronglyConnectedComponents) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(createProgram(false), "lra");
+    auto model = storm::api::buildSymbolicModel<storm::dd::DdType::Sylvan, double>(program, {});
+    auto transitions = model->getTransitionMatrix().notZero();
+    auto components = storm::utility::dd::computeStronglyConnectedComponents(model->getReachableStates(), transitions, model->getRowVariables(),
+                                                                             model->getColumnVariables());
+    ASSERT_EQ(3ul, components.size());
+    uint64_t numberOfStates = 0;
+    for (auto const& component : components) {
+        numberOfStates += component.getNonZeroCount();
+    }
+    EXPECT_EQ(4ul, numberOfStates);
+
+    auto bottomComponents = storm::utility::dd::computeMaximalEndComponentDecomposition(
+        model->getReachableStates(), transitions, model->getRowVariables(), model->getColumnVariables(), {}, model->getRowColumnMetaVariablePairs());
+    EXPECT_EQ(2ul, bottomComponents.size());
+}
+
+TEST(SymbolicLraPrctlModelCheckerTest, MdpCudd) {
+    checkMdp<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicLraPrctlModelCheckerTest, MdpSylvan) {
+    checkMdp<storm::dd::DdType::Sylvan>();
+}
+
+TEST(SymbolicLraPrctlModelCheckerTest, DtmcCudd) {
+    checkDtmc<storm::dd::DdType::CUDD>();
+}
+
+TEST(SymbolicLraPrctlModelCheckerTest, DtmcSylvan) {
+    checkDtmc<storm::dd::DdType::Sylvan>();
+}
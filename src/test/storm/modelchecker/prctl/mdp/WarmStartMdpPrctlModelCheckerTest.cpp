@@ -0,0 +1,128 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/WarmStartStore.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/prism.h"
+
+namespace {
+
+std::string const walkProgram = R"(
+mdp
+const int N;
+module walk
+    x : [0..N] init 1;
+    [a] 0<x & x<N -> 0.5 : (x'=x+1) + 0.5 : (x'=x-1);
+    [b] 0<x & x<N -> 0.4 : (x'=x+1) + 0.6 : (x'=x-1);
+    [] x=0 | x=N -> true;
+endmodule
+label "goal" = x=N;
+)";
+
+std::pair<std::shared_ptr<storm::models::sparse::Mdp<double>>, std::shared_ptr<storm::logic::Formula const>> buildWalk(std::string const& constants) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(walkProgram, "walk");
+    program = storm::utility::prism::preprocess(program, constants);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\"]", program));
+    storm::builder::BuilderOptions options(formulas, program);
+    options.setBuildStateValuations();
+    auto model = storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Mdp<double>>();
+    return {model, formulas.front()};
+}
+
+std::unique_ptr<storm::modelchecker::CheckResult> checkWalk(storm::models::sparse::Mdp<double> const& mdp, storm::logic::Formula const& formula) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(formula);
+    task.setProduceSchedulers(true);
+    return checker.check(env, task);
+}
+
+}  // namespace
+
+TEST(WarmStartMdpPrctlModelCheckerTest, SameModel) {
+    std::string const directory = (std::filesystem::temp_directory_path() / "storm-test-warmstart-same").string();
+    std::filesystem::remove_all(directory);
+    storm::modelchecker::WarmStartStore<double> store(directory);
+
+    auto [mdp, formula] = buildWalk("N=4");
+    EXPECT_FALSE(store.load(*mdp, *formula).has_value());
+
+    auto result = checkWalk(*mdp, *formula);
+    auto const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+    ASSERT_TRUE(quantitativeResult.hasScheduler());
+    store.store(*mdp, *formula, quantitativeResult.getValueVector(), &quantitativeResult.getScheduler());
+
+    auto hint = store.load(*mdp, *formula);
+    ASSERT_TRUE(hint.has_value());
+    ASSERT_TRUE(hint->hasResultHint());
+    EXPECT_EQ(quantitativeResult.getValueVector(), hint->getResultHint());
+    ASSERT_TRUE(hint->hasSchedulerHint());
+    for (uint64_t state = 0; state < mdp->getNumberOfStates(); ++state) {
+        EXPECT_EQ(quantitativeResult.getScheduler().getChoice(state).getDeterministicChoice(),
+                  hint->getSchedulerHint().getChoice(state).getDeterministicChoice());
+    }
+
+    // A different formula has no entry.
+    auto otherFormula = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F \"goal\"]")).front();
+    EXPECT_FALSE(store.load(*mdp, *otherFormula).has_value());
+    std::filesystem::remove_all(directory);
+}
+
+TEST(WarmStartMdpPrctlModelCheckerTest, ChangedModel) {
+    std::string const directory = (std::filesystem::temp_directory_path() / "storm-test-warmstart-changed").string();
+    std::filesystem::remove_all(directory);
+    storm::modelchecker::WarmStartStore<double> store(directory);
+
+    auto [smallMdp, formula] = buildWalk("N=4");
+    auto result = checkWalk(*smallMdp, *formula);
+    store.store(*smallMdp, *formula, result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+
+    auto [largeMdp, largeFormula] = buildWalk("N=6");
+    auto hint = store.load(*largeMdp, *largeFormula);
+    ASSERT_TRUE(hint.has_value());
+    ASSERT_EQ(largeMdp->getNumberOfStates(), hint->getResultHint().size());
+    EXPECT_FALSE(hint->hasSchedulerHint());
+
+    // States are matched via their valuation. States with x > 4 do not exist in the small model.
+    auto const& smallValuations = smallMdp->getStateValuations();
+    auto const& largeValuations = largeMdp->getStateValuations();
+    auto const& smallValues = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    uint64_t numberOfMatchedStates = 0;
+    for (uint64_t largeState = 0; largeState < largeMdp->getNumberOfStates(); ++largeState) {
+        std::string const valuation = largeValuations.toString(largeState, false);
+        double expected = 0.0;
+        for (uint64_t smallState = 0; smallState < smallMdp->getNumberOfStates(); ++smallState) {
+            if (smallValuations.toString(smallState, false) == valuation) {
+                expected = smallValues[smallState];
+                ++numberOfMatchedStates;
+            }
+        }
+        EXPECT_EQ(expected, hint->getResultHint()[largeState]) << "for state " << valuation;
+    }
+    EXPECT_EQ(smallMdp->getNumberOfStates(), numberOfMatchedStates);
+
+    // The hint yields the correct result.
+    storm::Environment env;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*largeMdp);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*largeFormula);
+    task.setHint(std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<double>>(std::move(*hint)));
+    auto hintedResult = checker.check(env, task);
+    auto unhintedResult = checkWalk(*largeMdp, *largeFormula);
+    auto const& initialState = *largeMdp->getInitialStates().begin();
+    EXPECT_NEAR(unhintedResult->asExplicitQuantitativeCheckResult<double>()[initialState],
+                hintedResult->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    std::filesystem::remove_all(directory);
+}
@@ -2,11 +2,14 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/environment/Environment.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/solver/SolveGoal.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/settings/SettingMemento.h"
@@ -109,6 +112,32 @@ TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     EXPECT_NEAR(0.96592521978041668, quantitativeResult5[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseDtmcEliminationModelCheckerTest, ConditionalWithProduct) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+    storm::Environment env;
+
+    // The iterative computation on the product yields the same values as the state elimination (see the Crowds test).
+    auto result = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeConditionalProbabilitiesWithProduct(
+        env, storm::solver::SolveGoal<double>(), dtmc->getTransitionMatrix(), *dtmc->getBackwardTransitions(), dtmc->getStates("observe0Greater1"),
+        dtmc->getStates("observeIGreater1"), false);
+    EXPECT_NEAR(0.15330064292476167, result[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    result = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeConditionalProbabilitiesWithProduct(
+        env, storm::solver::SolveGoal<double>(), dtmc->getTransitionMatrix(), *dtmc->getBackwardTransitions(), dtmc->getStates("observeOnlyTrueSender"),
+        dtmc->getStates("observe0Greater1"), false);
+    EXPECT_NEAR(0.96592521978041668, result[initialState], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    // States that can not reach the condition have an undefined conditional probability.
+    storm::storage::BitVector noCondition(dtmc->getNumberOfStates());
+    result = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeConditionalProbabilitiesWithProduct(
+        env, storm::solver::SolveGoal<double>(), dtmc->getTransitionMatrix(), *dtmc->getBackwardTransitions(), dtmc->getStates("observe0Greater1"),
+        noCondition, false);
+    EXPECT_EQ(storm::utility::infinity<double>(), result[initialState]);
+}
+
 TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "",
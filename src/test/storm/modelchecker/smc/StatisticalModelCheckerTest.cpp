@@ -0,0 +1,121 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/smc/StatisticalModelChecker.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/Scheduler.h"
+
+namespace {
+
+storm::modelchecker::StatisticalModelCheckerOptions getOptions(storm::modelchecker::smc::StoppingRule stoppingRule) {
+    storm::modelchecker::StatisticalModelCheckerOptions options;
+    options.stoppingRule = stoppingRule;
+    options.epsilon = 0.01;
+    options.delta = 0.001;
+    options.numberOfThreads = 2;
+    options.seed = 42;
+    return options;
+}
+
+}  // namespace
+
+TEST(StatisticalModelCheckerTest, StoppingRules) {
+    EXPECT_EQ(18445ull, storm::modelchecker::smc::getChernoffHoeffdingNumberOfTraces(0.01, 0.05));
+
+    auto interval = storm::modelchecker::smc::getClopperPearsonInterval(0, 10, 0.05);
+    EXPECT_EQ(0.0, interval.first);
+    EXPECT_NEAR(0.3085, interval.second, 1e-4);
+    interval = storm::modelchecker::smc::getClopperPearsonInterval(50, 100, 0.05);
+    EXPECT_NEAR(0.3983, interval.first, 1e-4);
+    EXPECT_NEAR(0.6017, interval.second, 1e-4);
+
+    EXPECT_FALSE(storm::modelchecker::smc::getSprtDecision(5, 10, 0.5, 0.05, 0.01).has_value());
+    EXPECT_EQ(std::optional<bool>(true), storm::modelchecker::smc::getSprtDecision(90, 100, 0.5, 0.05, 0.01));
+    EXPECT_EQ(std::optional<bool>(false), storm::modelchecker::smc::getSprtDecision(10, 100, 0.5, 0.05, 0.01));
+}
+
+TEST(StatisticalModelCheckerTest, DieProgram) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+
+    for (auto stoppingRule : {storm::modelchecker::smc::StoppingRule::ChernoffHoeffding, storm::modelchecker::smc::StoppingRule::ClopperPearson}) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, getOptions(stoppingRule));
+
+        auto formula = formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]");
+        auto result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], 0.02);
+
+        formula = formulaParser.parseSingleFormulaFromString("P=? [F<=3 \"done\"]");
+        result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[0], 0.02);
+
+        formula = formulaParser.parseSingleFormulaFromString("P=? [X !\"done\"]");
+        result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-12);
+    }
+
+    auto options = getOptions(storm::modelchecker::smc::StoppingRule::ChernoffHoeffding);
+    options.epsilon = 0.05;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(program, options);
+    auto formula = formulaParser.parseSingleFormulaFromString("R{\"coin_flips\"}=? [F \"done\"]");
+    auto result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0], 0.1);
+
+    formula = formulaParser.parseSingleFormulaFromString("R{\"coin_flips\"}=? [C<=2]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(2.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-12);
+}
+
+TEST(StatisticalModelCheckerTest, Sprt) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>> checker(
+        program, getOptions(storm::modelchecker::smc::StoppingRule::Sprt));
+
+    auto formula = formulaParser.parseSingleFormulaFromString("P>=0.5 [F \"one\"]");
+    auto result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+
+    formula = formulaParser.parseSingleFormulaFromString("P<0.2 [F \"one\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
+
+TEST(StatisticalModelCheckerTest, DiceWithScheduler) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    auto options = getOptions(storm::modelchecker::smc::StoppingRule::ChernoffHoeffding);
+
+    // The probability to throw two is independent of the scheduler.
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<double>> programChecker(program, options);
+    auto formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"two\"]");
+    auto result = programChecker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[0], 0.02);
+
+    // Sample the built model under a scheduler that minimizes the number of coin flips.
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(true, true))
+                   .build()
+                   ->as<storm::models::sparse::Mdp<double>>();
+    formula = formulaParser.parseSingleFormulaFromString("Rmin=? [F \"done\"]");
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    task.setProduceSchedulers(true);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> exactChecker(*mdp);
+    result = exactChecker.check(task);
+    auto const& exactResult = result->asExplicitQuantitativeCheckResult<double>();
+    double const expected = exactResult[*mdp->getInitialStates().begin()];
+
+    options.epsilon = 0.05;
+    storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Mdp<double>> modelChecker(*mdp, options);
+    modelChecker.setScheduler(exactResult.getScheduler());
+    auto estimate = modelChecker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    EXPECT_NEAR(expected, estimate->asExplicitQuantitativeCheckResult<double>()[*mdp->getInitialStates().begin()], 0.1);
+}
@@ -0,0 +1,101 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/parser/DdEncodingBinaryParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/export.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/dd/DdManager.h"
+
+namespace {
+
+template<storm::dd::DdType DdType>
+std::shared_ptr<storm::models::symbolic::Model<DdType>> buildModel(std::string const& filename) {
+    storm::prism::Program program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(filename)).preprocess().asPrismProgram();
+    return storm::builder::DdPrismModelBuilder<DdType>().build(program);
+}
+
+template<storm::dd::DdType DdType>
+std::shared_ptr<storm::models::symbolic::Model<DdType>> exportAndReload(std::shared_ptr<storm::models::symbolic::Model<DdType>> const& model,
+                                                                        std::string const& name) {
+    std::string directory = (std::filesystem::temp_directory_path() / ("storm-test-" + name + "-drdd")).string();
+    storm::api::exportSymbolicModelAsBinaryDrdd(model, directory);
+    auto result = storm::parser::DdEncodingBinaryParser<DdType>::parseModel(directory);
+    std::filesystem::remove_all(directory);
+    return result;
+}
+
+template<storm::dd::DdType DdType>
+void checkEqual(storm::models::symbolic::Model<DdType> const& expected, storm::models::symbolic::Model<DdType> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_EQ(expected.getInitialStates().getNonZeroCount(), actual.getInitialStates().getNonZeroCount());
+    EXPECT_EQ(expected.getRowColumnMetaVariablePairs().size(), actual.getRowColumnMetaVariablePairs().size());
+    EXPECT_EQ(expected.getNondeterminismVariables().size(), actual.getNondeterminismVariables().size());
+
+    // As the DD variables are recreated with the same indices and levels, the DDs have exactly the same structure.
+    EXPECT_EQ(expected.getTransitionMatrix().getNodeCount(), actual.getTransitionMatrix().getNodeCount());
+    EXPECT_EQ(expected.getTransitionMatrix().getMax(), actual.getTransitionMatrix().getMax());
+    EXPECT_EQ(expected.getTransitionMatrix().sumAbstract(expected.getTransitionMatrix().getContainedMetaVariables()).getValue(),
+              actual.getTransitionMatrix().sumAbstract(actual.getTransitionMatrix().getContainedMetaVariables()).getValue());
+    EXPECT_EQ(expected.getReachableStates().getNodeCount(), actual.getReachableStates().getNodeCount());
+
+    ASSERT_EQ(expected.getLabels().size(), actual.getLabels().size());
+    for (auto const& label : expected.getLabels()) {
+        ASSERT_TRUE(actual.hasLabel(label));
+        EXPECT_EQ(expected.getStates(label).getNonZeroCount(), actual.getStates(label).getNonZeroCount());
+    }
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& [name, rewardModel] : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(name));
+        auto const& actualRewardModel = actual.getRewardModel(name);
+        EXPECT_EQ(rewardModel.hasStateRewards(), actualRewardModel.hasStateRewards());
+        EXPECT_EQ(rewardModel.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        EXPECT_EQ(rewardModel.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+        if (rewardModel.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.getStateActionRewardVector().getNodeCount(), actualRewardModel.getStateActionRewardVector().getNodeCount());
+        }
+    }
+}
+
+template<storm::dd::DdType DdType>
+void checkRoundTrip(std::string const& filename, std::string const& name) {
+    auto model = buildModel<DdType>(filename);
+    auto reloaded = exportAndReload(model, name);
+    checkEqual(*model, *reloaded);
+}
+
+TEST(DdEncodingBinaryParserTest_Cudd, Dtmc) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", "cudd-dtmc");
+}
+
+TEST(DdEncodingBinaryParserTest_Cudd, Mdp) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", "cudd-mdp");
+}
+
+TEST(DdEncodingBinaryParserTest_Cudd, Ctmc) {
+    checkRoundTrip<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/ctmc/embedded2.sm", "cudd-ctmc");
+}
+
+TEST(DdEncodingBinaryParserTest_Sylvan, Dtmc) {
+    checkRoundTrip<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", "sylvan-dtmc");
+}
+
+TEST(DdEncodingBinaryParserTest_Sylvan, Mdp) {
+    checkRoundTrip<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", "sylvan-mdp");
+}
+
+TEST(DdEncodingBinaryParserTest, MissingManifest) {
+    std::string directory = (std::filesystem::temp_directory_path() / "storm-test-missing-drdd").string();
+    STORM_SILENT_ASSERT_THROW(storm::parser::DdEncodingBinaryParser<storm::dd::DdType::Sylvan>::parseModel(directory), storm::exceptions::FileIoException);
+}
+
+}  // namespace
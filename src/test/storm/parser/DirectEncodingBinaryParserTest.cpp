@@ -0,0 +1,217 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/DirectEncodingBinaryParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/parser/MappedDirectEncodingBinaryModel.h"
+#include "storm/api/export.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/helper/MappedValueIterationHelper.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+std::string getTemporaryFilename(std::string const& name) {
+    return (std::filesystem::temp_directory_path() / ("storm-test-" + name + ".drb")).string();
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndReload(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                                                                      std::string const& name,
+                                                                      storm::parser::DirectEncodingBinaryParserOptions const& options = {}) {
+    std::string filename = getTemporaryFilename(name);
+    storm::api::exportSparseModelAsDrb(model, filename);
+    auto result = storm::parser::DirectEncodingBinaryParser<double>::parseModel(filename, options);
+    std::filesystem::remove(filename);
+    return result;
+}
+
+void checkEqual(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+TEST(DirectEncodingBinaryParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto reloaded = exportAndReload(model, "dtmc");
+    checkEqual(*model, *reloaded);
+    EXPECT_EQ(15113ul, reloaded->getNumberOfTransitions());
+    EXPECT_EQ(4650ul, reloaded->getStates("observeIGreater1").getNumberOfSetBits());
+}
+
+TEST(DirectEncodingBinaryParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    auto reloaded = exportAndReload(model, "mdp");
+    checkEqual(*model, *reloaded);
+    EXPECT_TRUE(model->getTransitionMatrix().getRowGroupIndices() == reloaded->getTransitionMatrix().getRowGroupIndices());
+}
+
+TEST(DirectEncodingBinaryParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto reloaded = exportAndReload(model, "ctmc");
+    checkEqual(*model, *reloaded);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), reloaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(DirectEncodingBinaryParserTest, MarkovAutomatonRoundTrip) {
+    storm::parser::DirectEncodingParserOptions drnOptions;
+    drnOptions.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", drnOptions);
+    storm::parser::DirectEncodingBinaryParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto reloaded = exportAndReload(model, "ma", options);
+    checkEqual(*model, *reloaded);
+    ASSERT_TRUE(reloaded->hasChoiceLabeling());
+    EXPECT_TRUE(model->getChoiceLabeling() == reloaded->getChoiceLabeling());
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto reloadedMa = reloaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), reloadedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), reloadedMa->getExitRates());
+}
+
+TEST(DirectEncodingBinaryParserTest, StateValuations) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3, 4);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 2, 1.0);
+    storm::storage::sparse::ModelComponents<double> components(builder.build());
+    components.stateLabeling = storm::models::sparse::StateLabeling(3);
+    storm::storage::BitVector initialStates(3);
+    initialStates.set(0);
+    components.stateLabeling.addLabel("init", std::move(initialStates));
+
+    auto manager = std::make_shared<storm::expressions::ExpressionManager>();
+    storm::storage::sparse::StateValuationsBuilder valuationsBuilder;
+    valuationsBuilder.addVariable(manager->declareBooleanVariable("done"));
+    valuationsBuilder.addVariable(manager->declareIntegerVariable("x"));
+    for (uint64_t state = 0; state < 3; ++state) {
+        valuationsBuilder.addState(state, {state > 0}, {static_cast<int64_t>(state) - 1});
+    }
+    components.stateValuations = valuationsBuilder.build();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = std::make_shared<storm::models::sparse::Dtmc<double>>(std::move(components));
+
+    // Without an expression manager, the valuations are skipped.
+    auto reloaded = exportAndReload(model, "valuations");
+    checkEqual(*model, *reloaded);
+    EXPECT_FALSE(reloaded->hasStateValuations());
+
+    storm::parser::DirectEncodingBinaryParserOptions options;
+    options.expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+    reloaded = exportAndReload(model, "valuations", options);
+    checkEqual(*model, *reloaded);
+    ASSERT_TRUE(reloaded->hasStateValuations());
+    auto done = options.expressionManager->getVariable("done");
+    auto x = options.expressionManager->getVariable("x");
+    for (uint64_t state = 0; state < 3; ++state) {
+        EXPECT_EQ(state > 0, reloaded->getStateValuations().getBooleanValue(state, done));
+        EXPECT_EQ(static_cast<int64_t>(state) - 1, reloaded->getStateValuations().getIntegerValue(state, x));
+    }
+}
+
+// Checks the given reachability probability with value iteration on the mapped file and compares the result with the sparse engine.
+void checkMappedReachability(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& name, std::string const& label,
+                             std::string const& formula, std::optional<storm::OptimizationDirection> const& dir) {
+    std::string filename = getTemporaryFilename(name);
+    storm::api::exportSparseModelAsDrb(model, filename);
+    std::vector<double> mappedValues;
+    {
+        storm::parser::MappedDirectEncodingBinaryModel mappedModel(filename);
+        EXPECT_EQ(model->getType(), mappedModel.getType());
+        storm::solver::helper::MappedValueIterationHelper helper(mappedModel.getTransitionMatrix());
+        uint64_t numIterations = 0;
+        mappedValues = helper.computeReachabilityProbabilities(mappedModel.getStateLabel(label), dir, false, 1e-8, 100000, numIterations);
+        EXPECT_LT(0ul, numIterations);
+    }
+    std::filesystem::remove(filename);
+
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formula));
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas.front(), false));
+    auto const& expectedValues = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    ASSERT_EQ(expectedValues.size(), mappedValues.size());
+    for (uint64_t state = 0; state < mappedValues.size(); ++state) {
+        EXPECT_NEAR(expectedValues[state], mappedValues[state], 1e-6) << "state " << state;
+    }
+}
+
+TEST(DirectEncodingBinaryParserTest, MappedDtmc) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    checkMappedReachability(model, "mapped-dtmc", "observeIGreater1", "P=? [F \"observeIGreater1\"]", std::nullopt);
+}
+
+TEST(DirectEncodingBinaryParserTest, MappedMdp) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    checkMappedReachability(model, "mapped-mdp-min", "six", "Pmin=? [F \"six\"]", storm::OptimizationDirection::Minimize);
+    checkMappedReachability(model, "mapped-mdp-max", "six", "Pmax=? [F \"six\"]", storm::OptimizationDirection::Maximize);
+}
+
+TEST(DirectEncodingBinaryParserTest, MappedExpectedRewards) {
+    // State 0 loops or moves to the target state 1, state 2 moves to state 3 from which the target is not reachable.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4, 5);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(2, 3, 1.0);
+    builder.addNextValue(3, 3, 1.0);
+    storm::storage::sparse::ModelComponents<double> components(builder.build());
+    components.stateLabeling = storm::models::sparse::StateLabeling(4);
+    storm::storage::BitVector initialStates(4);
+    initialStates.set(0);
+    components.stateLabeling.addLabel("init", std::move(initialStates));
+    storm::storage::BitVector targetStates(4);
+    targetStates.set(1);
+    components.stateLabeling.addLabel("target", std::move(targetStates));
+    components.rewardModels.emplace("steps", storm::models::sparse::StandardRewardModel<double>(std::vector<double>(4, 1.0)));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = std::make_shared<storm::models::sparse::Dtmc<double>>(std::move(components));
+
+    std::string filename = getTemporaryFilename("mapped-rewards");
+    storm::api::exportSparseModelAsDrb(model, filename);
+    {
+        storm::parser::MappedDirectEncodingBinaryModel mappedModel(filename);
+        storm::solver::helper::MappedValueIterationHelper helper(mappedModel.getTransitionMatrix());
+        auto const& rewardModel = mappedModel.getRewardModel("");
+        EXPECT_EQ(nullptr, rewardModel.stateActionRewards);
+        uint64_t numIterations = 0;
+        auto values = helper.computeExpectedRewards(mappedModel.getStateLabel("target"), rewardModel.stateRewards, rewardModel.stateActionRewards, false,
+                                                    1e-8, 100000, numIterations);
+        ASSERT_EQ(4ul, values.size());
+        EXPECT_NEAR(2.0, values[0], 1e-6);
+        EXPECT_EQ(0.0, values[1]);
+        EXPECT_EQ(storm::utility::infinity<double>(), values[2]);
+        EXPECT_EQ(storm::utility::infinity<double>(), values[3]);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(DirectEncodingBinaryParserTest, WrongFormat) {
+    STORM_SILENT_ASSERT_THROW(storm::parser::DirectEncodingBinaryParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn"),
+                              storm::exceptions::WrongFormatException);
+}
+
+}  // namespace
@@ -97,3 +97,47 @@ TEST(DirectEncodingParserTest, IntervalDtmcTest) {
     ASSERT_EQ(613ul, dtmc->getNumberOfStates());
     EXPECT_TRUE(modelPtr->hasUncertainty());
 }
+
+void checkParallelParsing(std::string const& filename, bool buildChoiceLabeling) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = buildChoiceLabeling;
+    auto sequentialModel = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+    options.parallelParsing = true;
+    // Use small chunks to parse the test files in several chunks.
+    options.parallelParsingChunkSize = 512;
+    auto parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+
+    ASSERT_EQ(sequentialModel->getType(), parallelModel->getType());
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+    EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+    ASSERT_EQ(sequentialModel->hasChoiceLabeling(), parallelModel->hasChoiceLabeling());
+    if (sequentialModel->hasChoiceLabeling()) {
+        EXPECT_TRUE(sequentialModel->getChoiceLabeling() == parallelModel->getChoiceLabeling());
+    }
+    ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+    for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+        ASSERT_TRUE(parallelModel->hasRewardModel(rewardModel.first));
+        auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+        }
+    }
+    if (sequentialModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto sequentialMa = sequentialModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        auto parallelMa = parallelModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+        EXPECT_EQ(sequentialMa->getMarkovianStates(), parallelMa->getMarkovianStates());
+        EXPECT_EQ(sequentialMa->getExitRates(), parallelMa->getExitRates());
+    }
+}
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", false);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", false);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn", false);
+    checkParallelParsing(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn", true);
+}
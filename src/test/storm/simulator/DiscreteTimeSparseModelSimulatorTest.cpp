@@ -0,0 +1,80 @@
+#include <algorithm>
+
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+// State 0 moves to the states 1 to 4 with probabilities 0.1, 0.2, 0.3 and 0.4. All other states are absorbing.
+storm::models::sparse::Dtmc<double> createDtmc() {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 0.1);
+    builder.addNextValue(0, 2, 0.2);
+    builder.addNextValue(0, 3, 0.3);
+    builder.addNextValue(0, 4, 0.4);
+    for (uint64_t state = 1; state < 5; ++state) {
+        builder.addNextValue(state, state, 1.0);
+    }
+    storm::models::sparse::StateLabeling labeling(5);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    return storm::models::sparse::Dtmc<double>(builder.build(), labeling);
+}
+
+}  // namespace
+
+TEST(DiscreteTimeSparseModelSimulatorTest, SuccessorFrequencies) {
+    auto dtmc = createDtmc();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(dtmc);
+    simulator.setSeed(42);
+
+    uint64_t const numberOfTraces = 40000;
+    std::vector<uint64_t> singleCounts(5, 0);
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        simulator.resetToInitial();
+        EXPECT_TRUE(simulator.randomStep());
+        ++singleCounts[simulator.getCurrentState()];
+    }
+
+    simulator.resetBatchToInitial(numberOfTraces);
+    EXPECT_EQ(numberOfTraces, simulator.batchRandomStep());
+    std::vector<uint64_t> batchCounts(5, 0);
+    for (auto const& state : simulator.getBatchStates()) {
+        ++batchCounts[state];
+    }
+
+    EXPECT_EQ(0ull, singleCounts[0]);
+    EXPECT_EQ(0ull, batchCounts[0]);
+    for (uint64_t state = 1; state < 5; ++state) {
+        EXPECT_NEAR(0.1 * state, static_cast<double>(singleCounts[state]) / numberOfTraces, 0.01) << "for state " << state;
+        EXPECT_NEAR(0.1 * state, static_cast<double>(batchCounts[state]) / numberOfTraces, 0.01) << "for state " << state;
+    }
+
+    // Absorbing states do not need random numbers and are never left.
+    EXPECT_EQ(numberOfTraces, simulator.batchStep(std::vector<uint64_t>(numberOfTraces, 0)));
+    std::vector<uint64_t> statesAfterSecondStep = simulator.getBatchStates();
+    for (uint64_t state = 0; state < 5; ++state) {
+        EXPECT_EQ(batchCounts[state], static_cast<uint64_t>(std::count(statesAfterSecondStep.begin(), statesAfterSecondStep.end(), state)));
+    }
+}
+
+TEST(DiscreteTimeSparseModelSimulatorTest, ReproducibleBatches) {
+    auto dtmc = createDtmc();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(dtmc);
+    simulator.setSeed(7);
+    simulator.resetBatchToInitial(100);
+    simulator.batchRandomStep();
+    std::vector<uint64_t> states = simulator.getBatchStates();
+
+    // Sampling the same traces in two batches (in reverse order and with another simulator) yields the same states.
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> otherSimulator(dtmc);
+    otherSimulator.setSeed(7);
+    otherSimulator.resetBatchToInitial(50, 50);
+    otherSimulator.batchRandomStep();
+    EXPECT_EQ(std::vector<uint64_t>(states.begin() + 50, states.end()), otherSimulator.getBatchStates());
+    otherSimulator.resetBatchToInitial(50, 0);
+    otherSimulator.batchRandomStep();
+    EXPECT_EQ(std::vector<uint64_t>(states.begin(), states.begin() + 50), otherSimulator.getBatchStates());
+}
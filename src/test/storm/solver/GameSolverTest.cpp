@@ -7,6 +7,7 @@
 
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/exceptions/UnmetRequirementException.h"
 #include "storm/solver/StandardGameSolver.h"
 
 namespace {
@@ -132,4 +133,55 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TEST(GameSolverIntervalIterationTest, EndComponents) {
+    // Player 1 state 0 can either stay in an end component forever or reach the target with probability 0.5. Player 1 state 1 is a sink.
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 0, 1.0);
+    player2MatrixBuilder.newRowGroup(1);
+    player2MatrixBuilder.addNextValue(1, 1, 0.5);
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 1, 1.0);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build();
+
+    storm::storage::SparseMatrixBuilder<storm::storage::sparse::state_type> player1MatrixBuilder(0, 0, 0, false, true);
+    player1MatrixBuilder.newRowGroup(0);
+    player1MatrixBuilder.addNextValue(0, 0, 1);
+    player1MatrixBuilder.addNextValue(1, 1, 1);
+    player1MatrixBuilder.newRowGroup(2);
+    player1MatrixBuilder.addNextValue(2, 2, 1);
+    storm::storage::SparseMatrix<storm::storage::sparse::state_type> player1Matrix = player1MatrixBuilder.build();
+
+    storm::Environment env;
+    env.solver().game().setMethod(storm::solver::GameMethod::IntervalIteration);
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().game().setRelativeTerminationCriterion(false);
+
+    storm::solver::GameSolverFactory<double> factory;
+    auto solver = factory.create(env, player1Matrix, player2Matrix);
+    std::vector<double> b = {0.0, 0.5, 0.0};
+    std::vector<double> result(2);
+    STORM_SILENT_EXPECT_THROW(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b),
+                              storm::exceptions::UnmetRequirementException);
+
+    // Without deflation, the upper bounds in the end components would remain at one.
+    solver->setBounds(0.0, 1.0);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(0.5, result[0], 1e-8);
+    EXPECT_NEAR(0.0, result[1], 1e-8);
+
+    result = std::vector<double>(2);
+    EXPECT_TRUE(solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, result, b));
+    EXPECT_NEAR(0.0, result[0], 1e-8);
+
+    // Sound solving picks interval iteration as the bounds are known.
+    storm::Environment soundEnv;
+    soundEnv.solver().setForceSoundness(true);
+    soundEnv.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    soundEnv.solver().game().setRelativeTerminationCriterion(false);
+    result = std::vector<double>(2);
+    EXPECT_TRUE(solver->solveGame(soundEnv, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b));
+    EXPECT_NEAR(0.5, result[0], 1e-8);
+}
+
 }  // namespace
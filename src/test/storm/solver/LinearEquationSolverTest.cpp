@@ -6,6 +6,9 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/AcyclicSolverHelper.h"
+
+#include "storm/exceptions/InvalidEnvironmentException.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -108,6 +111,19 @@ class NativeDoubleGaussSeidelEnvironment {
     }
 };
 
+class NativeDoubleAsyncGaussSeidelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::AsyncGaussSeidel);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
 class NativeDoubleSorEnvironment {
    public:
     typedef double ValueType;
@@ -147,6 +163,18 @@ class NativeRationalRationalSearchEnvironment {
     }
 };
 
+class NativeRationalRationalReconstructionEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::RationalReconstruction);
+        return env;
+    }
+};
+
 class EliminationRationalEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -328,11 +356,12 @@ class LinearEquationSolverTest : public ::testing::Test {
 
 typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoublePowerRegMultEnvironment, NativeDoubleSoundValueIterationEnvironment,
                          NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment,
-                         NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
-                         NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment,
-                         GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment, EigenDGmresDiagonalEnvironment,
-                         EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment, EigenRationalLUEnvironment,
-                         TopologicalEigenRationalLUEnvironment>
+                         NativeDoubleGaussSeidelEnvironment, NativeDoubleAsyncGaussSeidelEnvironment, NativeDoubleSorEnvironment,
+                         NativeDoubleWalkerChaeEnvironment, NativeRationalRationalSearchEnvironment, NativeRationalRationalReconstructionEnvironment,
+                         EliminationRationalEnvironment, GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment,
+                         GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment,
+                         EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment,
+                         EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LinearEquationSolverTest, TestingTypes, );
@@ -373,4 +402,93 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
+
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemWithUpdatedMatrix) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto buildMatrix = [this](bool modified) {
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        builder.addNextValue(0, 0, this->parseNumber("1/5"));
+        builder.addNextValue(0, 1, this->parseNumber("2/5"));
+        builder.addNextValue(0, 2, this->parseNumber("2/5"));
+        builder.addNextValue(1, 0, this->parseNumber("1/50"));
+        builder.addNextValue(1, 1, this->parseNumber("48/50"));
+        builder.addNextValue(1, 2, this->parseNumber("1/50"));
+        if (modified) {
+            builder.addNextValue(2, 0, this->parseNumber("1/10"));
+            builder.addNextValue(2, 2, this->parseNumber("1/10"));
+        } else {
+            builder.addNextValue(2, 0, this->parseNumber("4/10"));
+            builder.addNextValue(2, 1, this->parseNumber("3/10"));
+            builder.addNextValue(2, 2, this->parseNumber("0"));
+        }
+        return builder.build();
+    };
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    bool const equationSystem = factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    storm::storage::SparseMatrix<ValueType> modifiedA = buildMatrix(true);
+    storm::storage::SparseMatrix<ValueType> A = buildMatrix(false);
+    if (equationSystem) {
+        modifiedA.convertToEquationSystem();
+        A.convertToEquationSystem();
+    }
+
+    std::vector<ValueType> x(3);
+    std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+
+    // Solve a system first and then change one of its rows. Solvers that cache data for the first matrix must not produce stale results.
+    auto solver = factory.create(this->env(), modifiedA);
+    solver->setCachingEnabled(true);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    solver->setMatrix(std::move(A));
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("481/9"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
+}
+
+TEST(AcyclicSolverHelperTest, TopologicalLevels) {
+    // Row i only depends on rows j > i. Row 4 has no successors and row 3 only has a selfloop.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    builder.addNextValue(1, 2, 0.2);
+    builder.addNextValue(1, 4, 0.8);
+    builder.addNextValue(2, 4, 1.0);
+    builder.addNextValue(3, 3, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(5, 5);
+
+    auto levels = storm::solver::helper::computeTopologicalLevels(A);
+    ASSERT_EQ(4ull, levels.getNumberOfLevels());
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 3, 4, 5}), levels.levelIndications);
+    EXPECT_EQ(std::vector<uint64_t>({3, 4, 2, 1, 0}), levels.groups);
+
+#ifdef STORM_HAVE_INTELTBB
+    std::vector<double> b = {1.0, 2.0, 3.0, 0.0, 4.0};
+    std::vector<double> expected(5, 0.0), x(5, 0.0);
+    A.multiplyWithVectorBackward(expected, expected, &b);
+    storm::solver::helper::solveLevelsInParallel(A, levels, x, &b);
+    for (uint64_t i = 0; i < x.size(); ++i) {
+        EXPECT_NEAR(expected[i], x[i], 1e-12);
+    }
+#endif
+}
+
+TEST(LinearEquationSolverAsyncGaussSeidelTest, RejectedIfSoundnessIsForced) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 0, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(2, 2);
+    std::vector<double> b = {0.5, 0.5};
+
+    storm::Environment env = NativeDoubleAsyncGaussSeidelEnvironment::createEnvironment();
+    env.solver().setForceSoundness(true);
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<double>();
+    auto solver = factory.create(env, A);
+    solver->setBounds(0.0, 1.0);
+    std::vector<double> x(2);
+    EXPECT_THROW(solver->solveEquations(env, x, b), storm::exceptions::InvalidEnvironmentException);
+}
 }  // namespace
\ No newline at end of file
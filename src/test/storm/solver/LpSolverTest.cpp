@@ -231,6 +231,98 @@ TYPED_TEST(LpSolverTest, LPOptimizeMaxRaw) {
     EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
 }
 
+TYPED_TEST(LpSolverTest, LPChangeObjective) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto solver = this->factory()->create("");
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    storm::expressions::Variable x;
+    storm::expressions::Variable y;
+    storm::expressions::Variable z;
+    ASSERT_NO_THROW(x = solver->addBoundedContinuousVariable("x", 0, 1, -1));
+    ASSERT_NO_THROW(y = solver->addLowerBoundedContinuousVariable("y", 0, 2));
+    ASSERT_NO_THROW(z = solver->addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->addConstraint("", x + y + z <= solver->getConstant(12)));
+    ASSERT_NO_THROW(solver->addConstraint("", solver->getConstant(this->parseNumber("1/2")) * y + z - x == solver->getConstant(5)));
+    ASSERT_NO_THROW(solver->addConstraint("", y - x <= solver->getConstant(this->parseNumber("11/2"))));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
+
+    // Maximize z
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(x, this->parseNumber("0")));
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(y, this->parseNumber("0")));
+    ASSERT_NO_THROW(solver->update());
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(x), this->precision());
+    EXPECT_NEAR(this->parseNumber("0"), solver->getContinuousValue(y), this->precision());
+    EXPECT_NEAR(this->parseNumber("6"), solver->getContinuousValue(z), this->precision());
+    EXPECT_NEAR(this->parseNumber("6"), solver->getObjectiveValue(), this->precision());
+
+    // Restore the original objective function
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(x, -this->parseNumber("1")));
+    ASSERT_NO_THROW(solver->setObjectiveFunctionCoefficient(y, this->parseNumber("2")));
+    ASSERT_NO_THROW(solver->update());
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(x), this->precision());
+    EXPECT_NEAR(this->parseNumber("13/2"), solver->getContinuousValue(y), this->precision());
+    EXPECT_NEAR(this->parseNumber("11/4"), solver->getContinuousValue(z), this->precision());
+    EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
+}
+
+TYPED_TEST(LpSolverTest, LPChangeRhsRaw) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto solver = this->factory()->createRaw("");
+    solver->setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(0u, solver->addBoundedContinuousVariable("x", 0, 1, -1));
+    ASSERT_EQ(1u, solver->addLowerBoundedContinuousVariable("y", 0, 2));
+    ASSERT_EQ(2u, solver->addLowerBoundedContinuousVariable("z", 0, 1));
+    ASSERT_NO_THROW(solver->update());
+
+    std::vector<storm::solver::RawLpConstraint<ValueType>> constraints;
+    // x + y + z <= 12
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("12"), 3);
+    constraints.back().addToLhs(0, this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    // -x + 1/2 * y + z == 5
+    constraints.emplace_back(storm::expressions::RelationType::Equal, this->parseNumber("5"), 3);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1/2"));
+    constraints.back().addToLhs(2, this->parseNumber("1"));
+    // -x + y <= 11/2
+    constraints.emplace_back(storm::expressions::RelationType::LessOrEqual, this->parseNumber("11/2"), 2);
+    constraints.back().addToLhs(0, -this->parseNumber("1"));
+    constraints.back().addToLhs(1, this->parseNumber("1"));
+    ASSERT_NO_THROW(solver->addConstraints(constraints));
+    ASSERT_NO_THROW(solver->update());
+
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(0), this->precision());
+    EXPECT_NEAR(this->parseNumber("13/2"), solver->getContinuousValue(1), this->precision());
+    EXPECT_NEAR(this->parseNumber("11/4"), solver->getContinuousValue(2), this->precision());
+    EXPECT_NEAR(this->parseNumber("59/4"), solver->getObjectiveValue(), this->precision());
+
+    if (!solver->isConstraintRhsChangeSupported()) {
+        return;
+    }
+    // -x + y <= 7/2
+    ASSERT_NO_THROW(solver->setConstraintRhs(2, this->parseNumber("7/2")));
+    ASSERT_NO_THROW(solver->update());
+    ASSERT_NO_THROW(solver->optimize());
+    ASSERT_TRUE(solver->isOptimal());
+    EXPECT_NEAR(this->parseNumber("1"), solver->getContinuousValue(0), this->precision());
+    EXPECT_NEAR(this->parseNumber("9/2"), solver->getContinuousValue(1), this->precision());
+    EXPECT_NEAR(this->parseNumber("15/4"), solver->getContinuousValue(2), this->precision());
+    EXPECT_NEAR(this->parseNumber("47/4"), solver->getObjectiveValue(), this->precision());
+}
+
 TYPED_TEST(LpSolverTest, LPOptimizeMin) {
     typedef typename TestFixture::ValueType ValueType;
     auto solver = this->factory()->create("");
@@ -1,15 +1,20 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+
 #include "test/storm_gtest.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/exceptions/InvalidEnvironmentException.h"
+
 namespace {
 
 class DoubleViEnvironment {
@@ -37,6 +42,44 @@ class DoubleViRegMultEnvironment {
     }
 };
 
+class DoubleMixedPrecisionViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setMixedPrecision(true);
+        return env;
+    }
+};
+
+class DoubleReorderedViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setStateOrder(storm::utility::permutation::OrderKind::BackwardBfs);
+        return env;
+    }
+};
+
+class DoubleAsyncGaussSeidelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::AsyncGaussSeidel);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
 class DoubleSoundViEnvironment {
    public:
     typedef double ValueType;
@@ -143,9 +186,9 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
-                         DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleViRegMultEnvironment, DoubleMixedPrecisionViEnvironment, DoubleReorderedViEnvironment,
+                         DoubleAsyncGaussSeidelEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
+                         DoubleTopologicalViEnvironment, DoublePIEnvironment, RationalPIEnvironment, RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -177,4 +220,93 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MinMaxLinearEquationSolverCheckpointTest, ResumeConverged) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> b = {0.099, 0.5};
+
+    std::string const directory = (std::filesystem::temp_directory_path() / "storm-test-checkpoint").string();
+    std::filesystem::remove_all(directory);
+    storm::Environment env = DoubleViEnvironment::createEnvironment();
+    env.solver().setCheckpointDirectory(directory);
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    auto solver = factory.create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+    std::vector<double> x(1);
+    ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(0.99, x[0], 1e-6);
+    EXPECT_FALSE(std::filesystem::is_empty(directory));
+
+    // A resumed run takes the final solution from the checkpoint, so a single iteration suffices.
+    env.solver().setResumeFromCheckpoints(true);
+    env.solver().minMax().setMaximalNumberOfIterations(1);
+    solver = factory.create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+    x = {0.0};
+    ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(0.99, x[0], 1e-6);
+
+    // Checkpoints of another optimization direction are not used.
+    x = {0.0};
+    ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_GT(0.5 - 1e-6, x[0]);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(MinMaxLinearEquationSolverBoundsTest, Interrupted) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> b = {0.099, 0.5};
+
+    for (auto const& env : {DoubleIntervalIterationEnvironment::createEnvironment(), DoubleSoundViEnvironment::createEnvironment()}) {
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        std::vector<double> x(1);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-6);
+        EXPECT_FALSE(solver->hasSolutionBounds());
+
+        // Stopping after a few iterations still yields sound bounds on the solution.
+        storm::Environment interruptedEnv = env;
+        interruptedEnv.solver().minMax().setMaximalNumberOfIterations(3);
+        x = {0.0};
+        ASSERT_NO_THROW(solver->solveEquations(interruptedEnv, storm::OptimizationDirection::Maximize, x, b));
+        ASSERT_TRUE(solver->hasSolutionBounds());
+        auto const& bounds = solver->getSolutionBounds();
+        EXPECT_LE(bounds.first[0], 0.99);
+        EXPECT_GE(bounds.second[0], 0.99);
+        EXPECT_GT(bounds.second[0] - bounds.first[0], 1e-6);
+    }
+}
+
+TEST(MinMaxLinearEquationSolverAsyncGaussSeidelTest, RejectedIfSoundnessIsForced) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> b = {0.099, 0.5};
+
+    storm::Environment env = DoubleAsyncGaussSeidelEnvironment::createEnvironment();
+    env.solver().setForceSoundness(true);
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    auto solver = factory.create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+    std::vector<double> x(1);
+    EXPECT_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b), storm::exceptions::InvalidEnvironmentException);
+}
 }  // namespace
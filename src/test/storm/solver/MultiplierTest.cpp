@@ -1,8 +1,13 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#ifdef STORM_HAVE_CUDA
+#include "storm/solver/multiplier/cuda/DeviceMultiplication.h"
+#endif
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/utility/vector.h"
@@ -17,6 +22,9 @@ class NativeEnvironment {
         env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
         return env;
     }
+    static bool skip() {
+        return false;
+    }
 };
 
 class GmmxxEnvironment {
@@ -28,13 +36,37 @@ class GmmxxEnvironment {
         env.solver().multiplier().setType(storm::solver::MultiplierType::Gmmxx);
         return env;
     }
+    static bool skip() {
+        return false;
+    }
 };
 
+#ifdef STORM_HAVE_CUDA
+class CudaEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Cuda);
+        return env;
+    }
+    static bool skip() {
+        return !storm::solver::cuda::DeviceMultiplication::isDeviceAvailable();
+    }
+};
+#endif
+
 template<typename TestType>
 class MultiplierTest : public ::testing::Test {
    public:
     typedef typename TestType::ValueType ValueType;
     MultiplierTest() : _environment(TestType::createEnvironment()) {}
+    void SetUp() override {
+        if (TestType::skip()) {
+            GTEST_SKIP() << "No CUDA capable device is available.";
+        }
+    }
     storm::Environment const& env() const {
         return _environment;
     }
@@ -49,7 +81,13 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment
+#ifdef STORM_HAVE_CUDA
+                         ,
+                         CudaEnvironment
+#endif
+                         >
+    TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -123,4 +161,119 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
-}  // namespace
\ No newline at end of file
+TYPED_TEST(MultiplierTest, multiplyAndReduceChoicesTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 1, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> x = {this->parseNumber("1"), this->parseNumber("1")};
+    std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0.5"), this->parseNumber("0")};
+    std::vector<ValueType> result(2);
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+
+    // All choices of the first group yield 1 without the offset, so the previous choice is kept unless another one is strictly better.
+    std::vector<uint64_t> choices = {1, 0};
+    ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), storm::OptimizationDirection::Minimize, x, nullptr, result, &choices));
+    EXPECT_NEAR(result[0], this->parseNumber("1"), this->precision());
+    EXPECT_EQ(1ull, choices[0]);
+
+    ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), storm::OptimizationDirection::Maximize, x, &b, result, &choices));
+    EXPECT_NEAR(result[0], this->parseNumber("1.5"), this->precision());
+    EXPECT_NEAR(result[1], this->parseNumber("1"), this->precision());
+    EXPECT_EQ(2ull, choices[0]);
+    EXPECT_EQ(0ull, choices[1]);
+}
+
+#ifdef STORM_HAVE_CUDA
+TEST(CudaMultiplierTest, compareWithNativeMultiplier) {
+    if (CudaEnvironment::skip()) {
+        GTEST_SKIP() << "No CUDA capable device is available.";
+    }
+    // Enough states to launch several blocks, where every 100th state has no choices and is not reachable.
+    uint64_t const numberOfStates = 1000;
+    auto isEmpty = [](uint64_t state) { return state % 100 == 50; };
+    uint64_t seed = 42;
+    auto nextRandom = [&seed]() {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        return seed >> 33;
+    };
+    auto nextSuccessor = [&]() {
+        uint64_t const successor = nextRandom() % numberOfStates;
+        return isEmpty(successor) ? successor + 1 : successor;
+    };
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        if (isEmpty(state)) {
+            continue;
+        }
+        for (uint64_t choice = 0, numberOfChoices = 1 + nextRandom() % 3; choice < numberOfChoices; ++choice, ++row) {
+            uint64_t const first = nextSuccessor();
+            uint64_t const second = nextSuccessor();
+            double const probability = static_cast<double>(1 + nextRandom() % 9) / 10.0;
+            if (first == second) {
+                builder.addNextValue(row, first, 1.0);
+            } else {
+                builder.addNextValue(row, std::min(first, second), probability);
+                builder.addNextValue(row, std::max(first, second), 1.0 - probability);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(0, numberOfStates, numberOfStates);
+
+    std::vector<double> x(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        x[state] = static_cast<double>(nextRandom() % 1000) / 1000.0;
+    }
+    std::vector<double> b(A.getRowCount());
+    for (auto& value : b) {
+        value = static_cast<double>(nextRandom() % 100) / 1000.0;
+    }
+
+    storm::Environment const nativeEnv = NativeEnvironment::createEnvironment();
+    storm::Environment const cudaEnv = CudaEnvironment::createEnvironment();
+    auto nativeMultiplier = storm::solver::MultiplierFactory<double>().create(nativeEnv, A);
+    auto cudaMultiplier = storm::solver::MultiplierFactory<double>().create(cudaEnv, A);
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        // Entries of empty row groups keep their previous value.
+        std::vector<double> nativeResult(numberOfStates, -1.0);
+        std::vector<double> cudaResult(numberOfStates, -1.0);
+        std::vector<uint64_t> nativeChoices(numberOfStates, 0);
+        std::vector<uint64_t> cudaChoices(numberOfStates, 0);
+        ASSERT_NO_THROW(nativeMultiplier->multiplyAndReduce(nativeEnv, dir, x, &b, nativeResult, &nativeChoices));
+        ASSERT_NO_THROW(cudaMultiplier->multiplyAndReduce(cudaEnv, dir, x, &b, cudaResult, &cudaChoices));
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(nativeResult[state], cudaResult[state], 1e-12) << "State " << state;
+            EXPECT_EQ(nativeChoices[state], cudaChoices[state]) << "State " << state;
+        }
+        EXPECT_EQ(-1.0, cudaResult[50]);
+
+        // More multiplications than in a single batch of the CUDA multiplier. The values of the (unreachable) empty row groups are unspecified here.
+        std::vector<double> nativeX = x;
+        std::vector<double> cudaX = x;
+        ASSERT_NO_THROW(nativeMultiplier->repeatedMultiplyAndReduce(nativeEnv, dir, nativeX, nullptr, 150));
+        ASSERT_NO_THROW(cudaMultiplier->repeatedMultiplyAndReduce(cudaEnv, dir, cudaX, nullptr, 150));
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            if (!isEmpty(state)) {
+                EXPECT_NEAR(nativeX[state], cudaX[state], 1e-12) << "State " << state;
+            }
+        }
+    }
+}
+#endif
+
+}  // namespace
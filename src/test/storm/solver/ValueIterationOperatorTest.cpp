@@ -0,0 +1,145 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+/*!
+ * Creates a chain-like MDP with enough choices so that the value iteration operator splits it into multiple chunks.
+ * In each state i, the first action moves to state i+1 (or back to the initial state) and the second action has a self-loop.
+ * Only every resetInterval'th state (and the last state) can move back to the initial state.
+ */
+storm::storage::SparseMatrix<double> createChainMdp(uint64_t numStates, std::vector<double>& offsets, uint64_t resetInterval = 1) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    offsets.clear();
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numStates; ++state) {
+        builder.newRowGroup(row);
+        if (state + 1 < numStates && state % resetInterval == 0) {
+            builder.addNextValue(row, 0, 0.1);
+            builder.addNextValue(row, state + 1, 0.8);
+        } else if (state + 1 < numStates) {
+            builder.addNextValue(row, state + 1, 0.9);
+        } else {
+            builder.addNextValue(row, 0, 0.9);
+        }
+        offsets.push_back(0.1);
+        ++row;
+        builder.addNextValue(row, state, 0.5);
+        offsets.push_back(0.05 + 0.4 * (static_cast<double>(state % 7) / 7.0));
+        ++row;
+    }
+    return builder.build();
+}
+
+TEST(ValueIterationOperatorTest, ParallelApply) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    std::vector<double> offsets;
+    auto matrix = createChainMdp(20000, offsets);
+
+    auto sequentialOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    sequentialOperator->setMatrixBackwards(matrix);
+    auto parallelOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    parallelOperator->setMatrixBackwards(matrix);
+    parallelOperator->setParallelApply(4);
+    EXPECT_TRUE(parallelOperator->isParallelApplySet());
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> sequentialResult(matrix.getRowGroupCount(), 0.0);
+        std::vector<double> parallelResult(matrix.getRowGroupCount(), 0.0);
+        storm::solver::helper::ValueIterationHelper<double, false> sequentialHelper(sequentialOperator);
+        storm::solver::helper::ValueIterationHelper<double, false> parallelHelper(parallelOperator);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, sequentialHelper.VI(sequentialResult, offsets, false, 1e-10, dir));
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, parallelHelper.VI(parallelResult, offsets, false, 1e-10, dir));
+        for (uint64_t state = 0; state < matrix.getRowGroupCount(); state += 997) {
+            EXPECT_NEAR(sequentialResult[state], parallelResult[state], 1e-8);
+        }
+
+        storm::solver::helper::SoundValueIterationHelper<double, false> parallelSoundHelper(parallelOperator);
+        std::vector<double> soundResult(matrix.getRowGroupCount(), 0.0);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, parallelSoundHelper.SVI(soundResult, offsets, false, 1e-8, dir));
+        for (uint64_t state = 0; state < matrix.getRowGroupCount(); state += 997) {
+            EXPECT_NEAR(sequentialResult[state], soundResult[state], 1e-6);
+        }
+    }
+}
+
+TEST(ValueIterationOperatorTest, ParallelApplyDisabledForSmallMatrices) {
+    std::vector<double> offsets;
+    auto matrix = createChainMdp(10, offsets);
+    storm::solver::helper::ValueIterationOperator<double, false> viOperator;
+    viOperator.setMatrixBackwards(matrix);
+    viOperator.setParallelApply(4);
+    EXPECT_FALSE(viOperator.isParallelApplySet());
+}
+
+TEST(ValueIterationOperatorTest, ValueDictionary) {
+    std::vector<double> offsets;
+    auto matrix = createChainMdp(1000, offsets);
+    // Use more than 256 distinct values so that 16 bit dictionary indices are needed.
+    auto manyValuesMatrix = matrix;
+    for (uint64_t row = 0; row < manyValuesMatrix.getRowCount(); row += 2) {
+        auto rowEntries = manyValuesMatrix.getRow(row);
+        rowEntries.begin()->setValue(0.1 + 1e-5 * static_cast<double>(row % 600));
+    }
+
+    for (auto const* m : {&matrix, &manyValuesMatrix}) {
+        auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+        viOperator->setMatrixBackwards(*m);
+        EXPECT_TRUE(viOperator->usesValueDictionary());
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> result(m->getRowGroupCount(), 0.0);
+            storm::solver::helper::ValueIterationHelper<double, false> helper(viOperator);
+            EXPECT_EQ(storm::solver::SolverStatus::Converged, helper.VI(result, offsets, false, 1e-12, dir));
+
+            // The result has to be a fixed point of the Bellman operator on the original matrix
+            std::vector<double> step(m->getRowGroupCount());
+            m->multiplyAndReduce(dir, m->getRowGroupIndices(), result, &offsets, step);
+            for (uint64_t state = 0; state < m->getRowGroupCount(); ++state) {
+                EXPECT_NEAR(result[state], step[state], 1e-9);
+            }
+        }
+    }
+
+    // Exact values are not stored in a dictionary
+    auto exactMatrix = matrix.toValueType<storm::RationalNumber>();
+    storm::solver::helper::ValueIterationOperator<storm::RationalNumber, false> exactOperator;
+    exactOperator.setMatrixBackwards(exactMatrix);
+    EXPECT_FALSE(exactOperator.usesValueDictionary());
+}
+
+TEST(ValueIterationOperatorTest, DeltaColumns) {
+    std::vector<double> offsets;
+    // The columns of the rare transitions back to the initial state are too far away from their row group and have to be escaped.
+    auto matrix = createChainMdp(20000, offsets, 500);
+    auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<double, false>>();
+    viOperator->setMatrixBackwards(matrix);
+    EXPECT_TRUE(viOperator->usesDeltaColumns());
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> result(matrix.getRowGroupCount(), 0.0);
+        storm::solver::helper::ValueIterationHelper<double, false> helper(viOperator);
+        EXPECT_EQ(storm::solver::SolverStatus::Converged, helper.VI(result, offsets, false, 1e-12, dir));
+
+        // The result has to be a fixed point of the Bellman operator on the original matrix
+        std::vector<double> step(matrix.getRowGroupCount());
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), result, &offsets, step);
+        for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+            EXPECT_NEAR(result[state], step[state], 1e-9);
+        }
+    }
+
+    // If many columns would have to be escaped, the delta encoding is not used.
+    auto manyResetsMatrix = createChainMdp(20000, offsets);
+    storm::solver::helper::ValueIterationOperator<double, false> manyResetsOperator;
+    manyResetsOperator.setMatrixBackwards(manyResetsMatrix);
+    EXPECT_FALSE(manyResetsOperator.usesDeltaColumns());
+}
+
+}  // namespace
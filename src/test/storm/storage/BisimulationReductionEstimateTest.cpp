@@ -0,0 +1,49 @@
+#include "storm-config.h"
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/bisimulation.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/BisimulationReductionEstimate.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Model<double>> parseDie() {
+    return storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+}
+
+}  // namespace
+
+TEST(BisimulationReductionEstimateTest, Die) {
+    auto model = parseDie();
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]")};
+
+    // With sufficiently many rounds, the estimate coincides with the strong bisimulation quotient that respects the label "one".
+    auto estimate = storm::storage::estimateBisimulationReduction(*model, formulas, 100);
+    EXPECT_EQ(13ul, estimate.numberOfStates);
+    EXPECT_TRUE(estimate.converged);
+    EXPECT_EQ(5ul, estimate.numberOfBlocks);
+
+    // Fewer rounds yield a lower bound.
+    estimate = storm::storage::estimateBisimulationReduction(*model, formulas, 1);
+    EXPECT_LE(estimate.numberOfBlocks, 5ul);
+    EXPECT_LE(estimate.getQuotientRatio(), 5.0 / 13.0);
+}
+
+TEST(BisimulationReductionEstimateTest, AutomaticMinimization) {
+    auto model = parseDie();
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]")};
+
+    auto result = storm::api::performAutomaticBisimulationMinimization(model, formulas, 1.0);
+    EXPECT_EQ(5ul, result->getNumberOfStates());
+
+    // The refinement is aborted if the quotient is known to be too large.
+    result = storm::api::performBisimulationMinimization(model, formulas, storm::storage::BisimulationType::Strong,
+                                                         storm::storage::BisimulationRefinementMethod::Splitter, 1ul);
+    EXPECT_EQ(model, result);
+    result = storm::api::performAutomaticBisimulationMinimization(model, formulas, 0.1);
+    EXPECT_EQ(model, result);
+}
@@ -1,6 +1,7 @@
 #include "test/storm_gtest.h"
 
 #include <cstdint>
+#include <vector>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
@@ -67,3 +68,62 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, IncrementalHash) {
+    storm::storage::ZobristBitVectorHash hasher;
+    storm::storage::BitVectorHashMap<uint64_t, storm::storage::ZobristBitVectorHash> map(192, 3);
+
+    storm::storage::BitVector state(192);
+    state.setFromInt(60, 10, 513);
+    state.set(150);
+    uint64_t stateHash = hasher(state);
+    EXPECT_EQ(0ul, map.findOrAdd(state, 0, stateHash));
+
+    // Derive the hashes of successors that differ in a few (possibly bucket-crossing) slots.
+    for (uint64_t value = 0; value < 100; ++value) {
+        storm::storage::BitVector successor(state);
+        successor.setFromInt(60, 10, value);
+        successor.set(130 + value % 50, value % 2 == 0);
+        uint64_t successorHash = hasher.update(stateHash, state, successor);
+        EXPECT_EQ(hasher(successor), successorHash);
+        uint64_t expectedValue = map.contains(successor) ? map.getValue(successor) : map.size();
+        EXPECT_EQ(expectedValue, map.findOrAdd(successor, map.size(), successorHash));
+    }
+
+    // Keys that were inserted with a given hash must be found after rehashing.
+    EXPECT_EQ(0ul, map.findOrAdd(state, map.size()));
+}
+
+TEST(BitVectorHashMapTest, TreeCompression) {
+    storm::storage::BitVectorHashMap<uint64_t, storm::storage::ZobristBitVectorHash> map(320, 3, 0.75, true);
+
+    // The states share most of their buckets, so their trees share most of their nodes.
+    std::vector<storm::storage::BitVector> states;
+    for (uint64_t value = 0; value < 200; ++value) {
+        storm::storage::BitVector state(320);
+        state.setFromInt(10, 8, value % 7);
+        state.setFromInt(120, 20, value);
+        state.set(300, value % 3 == 0);
+        EXPECT_EQ(value, map.findOrAdd(state, value));
+        states.push_back(state);
+    }
+    EXPECT_EQ(200ul, map.size());
+
+    storm::storage::BitVector missing(320);
+    missing.set(319);
+    EXPECT_FALSE(map.contains(missing));
+
+    for (uint64_t value = 0; value < 200; ++value) {
+        EXPECT_TRUE(map.contains(states[value]));
+        EXPECT_EQ(value, map.getValue(states[value]));
+        EXPECT_EQ(value, map.findOrAdd(states[value], map.size()));
+    }
+
+    // Iterating the map yields the decompressed keys.
+    uint64_t numberOfKeys = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(states[keyValuePair.second], keyValuePair.first);
+        ++numberOfKeys;
+    }
+    EXPECT_EQ(200ul, numberOfKeys);
+}
@@ -3,6 +3,8 @@
 #include "storm/storage/BitVector.h"
 #include "test/storm_gtest.h"
 
+#include <thread>
+
 TEST(BitVectorTest, InitToZero) {
     storm::storage::BitVector vector(32);
 
@@ -66,6 +68,27 @@ TEST(BitVectorTest, GetSet) {
     }
 }
 
+TEST(BitVectorTest, SetAtomically) {
+    storm::storage::BitVector vector(200);
+
+    // Two threads set interleaved bits, i.e., they write to the same buckets.
+    std::thread other([&vector]() {
+        for (uint_fast64_t i = 1; i < 200; i += 2) {
+            EXPECT_TRUE(vector.setAtomically(i));
+        }
+    });
+    for (uint_fast64_t i = 0; i < 200; i += 2) {
+        EXPECT_TRUE(vector.setAtomically(i));
+    }
+    other.join();
+
+    EXPECT_TRUE(vector.full());
+    EXPECT_FALSE(vector.setAtomically(42));
+    EXPECT_TRUE(vector.getAtomically(42));
+    vector.set(42, false);
+    EXPECT_FALSE(vector.getAtomically(42));
+}
+
 TEST(BitVectorTest, GetAsInt) {
     storm::storage::BitVector vector(77);
 
@@ -321,6 +344,23 @@ TEST(BitVectorTest, OperatorModulo) {
     }
 }
 
+TEST(BitVectorTest, OperatorModuloSparse) {
+    // Few elements compared to the filter, spread over many buckets.
+    storm::storage::BitVector filter(2000);
+    for (uint_fast64_t i = 0; i < 2000; i += 3) {
+        filter.set(i);
+    }
+    storm::storage::BitVector vector(2000);
+    vector.set(0);
+    vector.set(1);
+    vector.set(700);
+    vector.set(1998);
+
+    storm::storage::BitVector moduloResult = vector % filter;
+    ASSERT_EQ(filter.getNumberOfSetBits(), moduloResult.size());
+    EXPECT_EQ(storm::storage::BitVector(moduloResult.size(), std::vector<uint_fast64_t>({0, filter.getNumberOfSetBitsBeforeIndex(1998)})), moduloResult);
+}
+
 TEST(BitVectorTest, OperatorNot) {
     storm::storage::BitVector vector1(32);
     storm::storage::BitVector vector2(32);
@@ -580,6 +620,38 @@ TEST(BitVectorTest, SequenceBefore) {
     }
 }
 
+TEST(BitVectorTest, LongRuns) {
+    storm::storage::BitVector vector(5000);
+    vector.set(3);
+    vector.set(2500);
+    vector.set(4999);
+
+    EXPECT_EQ(2500ull, vector.getNextSetIndex(4));
+    EXPECT_EQ(4999ull, vector.getNextSetIndex(2501));
+    EXPECT_EQ(2500ull, vector.getNextSetIndex(2500));
+    EXPECT_EQ(4ull, vector.getStartOfZeroSequenceBefore(2500));
+    EXPECT_EQ(2501ull, vector.getStartOfZeroSequenceBefore(4999));
+    EXPECT_EQ(3000ull, vector.getNextUnsetIndex(3000));
+
+    storm::storage::BitVector complement = ~vector;
+    EXPECT_EQ(2500ull, complement.getNextUnsetIndex(4));
+    EXPECT_EQ(4ull, complement.getStartOfOneSequenceBefore(2500));
+
+    std::vector<uint64_t> setBits(vector.begin(), vector.end());
+    EXPECT_EQ(std::vector<uint64_t>({3, 2500, 4999}), setBits);
+    EXPECT_EQ(3ull, vector.getNumberOfSetBits());
+    EXPECT_EQ(2ull, vector.getNumberOfSetBitsBeforeIndex(4999));
+
+    storm::storage::BitVector subset(5000);
+    subset.set(2500);
+    EXPECT_TRUE(subset.isSubsetOf(vector));
+    EXPECT_FALSE(vector.isSubsetOf(subset));
+    EXPECT_FALSE(subset.isDisjointFrom(vector));
+    EXPECT_TRUE(subset.isDisjointFrom(~subset));
+    EXPECT_FALSE(subset.empty());
+    EXPECT_TRUE(storm::storage::BitVector(5000).empty());
+}
+
 TEST(BitVectorTest, Iterator) {
     storm::storage::BitVector vector(32);
 
@@ -0,0 +1,99 @@
+#include "storm/storage/CompressedBitVector.h"
+#include "test/storm_gtest.h"
+
+namespace {
+// A bit vector spanning several chunks: a sparse chunk, a chunk with a few long runs, a dense random chunk and an empty chunk.
+storm::storage::BitVector createMixedBitVector() {
+    uint64_t const chunk = 1ull << 16;
+    storm::storage::BitVector result(4 * chunk + 17);
+    for (uint64_t i = 0; i < chunk; i += 997) {
+        result.set(i);
+    }
+    result.setMultiple(chunk + 100, 5000);
+    result.setMultiple(chunk + 20000, 30000);
+    for (uint64_t i = 2 * chunk, seed = 42; i < 3 * chunk; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        result.set(i, (seed >> 33) & 1);
+    }
+    result.set(4 * chunk + 16);
+    return result;
+}
+}  // namespace
+
+TEST(CompressedBitVectorTest, RoundTrip) {
+    storm::storage::BitVector const dense = createMixedBitVector();
+    storm::storage::CompressedBitVector const compressed(dense);
+
+    EXPECT_EQ(dense.size(), compressed.size());
+    EXPECT_EQ(dense.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    EXPECT_EQ(dense, compressed.toBitVector());
+    EXPECT_LT(compressed.getSizeInBytes(), dense.getSizeInBytes());
+
+    std::vector<uint64_t> denseIndices(dense.begin(), dense.end());
+    std::vector<uint64_t> compressedIndices(compressed.begin(), compressed.end());
+    EXPECT_EQ(denseIndices, compressedIndices);
+    for (uint64_t i = 0; i < dense.size(); i += 13) {
+        EXPECT_EQ(dense.get(i), compressed.get(i)) << "at index " << i;
+        EXPECT_EQ(dense.getNextSetIndex(i), compressed.getNextSetIndex(i)) << "at index " << i;
+    }
+
+    storm::storage::CompressedBitVector const empty(100);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(empty.full());
+    EXPECT_EQ(100ull, empty.getNextSetIndex(0));
+    EXPECT_TRUE((~empty).full());
+}
+
+TEST(CompressedBitVectorTest, SetAndGet) {
+    storm::storage::BitVector dense = createMixedBitVector();
+    storm::storage::CompressedBitVector compressed(dense);
+
+    // Touch every kind of container, including run boundaries.
+    uint64_t const chunk = 1ull << 16;
+    std::vector<std::pair<uint64_t, bool>> updates = {{5, true},
+                                                      {997, false},
+                                                      {chunk + 99, true},
+                                                      {chunk + 5100, true},
+                                                      {chunk + 5101, true},
+                                                      {chunk + 2000, false},
+                                                      {chunk + 20000, false},
+                                                      {chunk + 49999, false},
+                                                      {chunk + 30000, true},
+                                                      {2 * chunk + 7, true},
+                                                      {2 * chunk + 8, false},
+                                                      {3 * chunk + 1, true},
+                                                      {4 * chunk + 16, false}};
+    for (auto const& [index, value] : updates) {
+        dense.set(index, value);
+        compressed.set(index, value);
+        EXPECT_EQ(value, compressed.get(index));
+        EXPECT_EQ(dense.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    }
+    EXPECT_EQ(dense, compressed.toBitVector());
+
+    // Clearing most of the dense chunk eventually switches to a smaller container.
+    for (uint64_t i = 2 * chunk; i < 3 * chunk - 100; ++i) {
+        dense.set(i, false);
+        compressed.set(i, false);
+    }
+    EXPECT_EQ(dense, compressed.toBitVector());
+    EXPECT_EQ(storm::storage::CompressedBitVector(dense), compressed);
+}
+
+TEST(CompressedBitVectorTest, Operations) {
+    storm::storage::BitVector const dense1 = createMixedBitVector();
+    storm::storage::BitVector dense2(dense1.size());
+    dense2.setMultiple(500, 3 * (1ull << 16));
+    storm::storage::CompressedBitVector const compressed1(dense1);
+    storm::storage::CompressedBitVector const compressed2(dense2);
+
+    EXPECT_EQ(dense1 & dense2, (compressed1 & compressed2).toBitVector());
+    EXPECT_EQ(dense1 | dense2, (compressed1 | compressed2).toBitVector());
+    EXPECT_EQ(~dense1, (~compressed1).toBitVector());
+    EXPECT_EQ(~dense2, (~compressed2).toBitVector());
+    EXPECT_TRUE((compressed1 | ~compressed1).full());
+    EXPECT_TRUE((compressed1 & ~compressed1).empty());
+
+    EXPECT_EQ(compressed1, storm::storage::CompressedBitVector(dense1));
+    EXPECT_NE(compressed1, compressed2);
+}
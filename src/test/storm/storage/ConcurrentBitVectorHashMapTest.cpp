@@ -0,0 +1,118 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <thread>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+storm::storage::BitVector createKey(uint64_t index) {
+    storm::storage::BitVector key(128);
+    key.setFromInt(0, 64, index);
+    key.setFromInt(64, 64, index * 7 + 13);
+    return key;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3);
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i, map.findOrAdd(createKey(i), i));
+    }
+    EXPECT_EQ(1000ul, map.size());
+    EXPECT_GE(map.capacity(), 1000ul);
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(i, map.findOrAdd(createKey(i), i + 1));
+        auto valueBucketPair = map.findOrAddAndGetBucket(createKey(i), i + 1);
+        EXPECT_EQ(i, valueBucketPair.first);
+        EXPECT_EQ(createKey(i), map.getBucketAndValue(valueBucketPair.second).first);
+        EXPECT_TRUE(map.contains(createKey(i)));
+        EXPECT_EQ(i, map.getValue(createKey(i)));
+    }
+    EXPECT_FALSE(map.contains(createKey(1000)));
+    EXPECT_EQ(1000ul, map.size());
+}
+
+TEST(ConcurrentBitVectorHashMapTest, IterateAndRemap) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10);
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.findOrAdd(createKey(i), i);
+    }
+    map.remap([](uint32_t const& value) { return 2 * value; });
+
+    storm::storage::BitVector seen(100);
+    for (auto const& keyValuePair : map) {
+        uint64_t index = keyValuePair.first.getAsInt(0, 64);
+        ASSERT_LT(index, 100ul);
+        EXPECT_EQ(createKey(index), keyValuePair.first);
+        EXPECT_EQ(2 * index, keyValuePair.second);
+        EXPECT_FALSE(seen.get(index));
+        seen.set(index);
+    }
+    EXPECT_TRUE(seen.full());
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 50000;
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 10);
+
+    // All threads insert the same keys (in different orders) with their own values, so every key is contended.
+    std::vector<std::vector<uint64_t>> foundValues(numberOfThreads, std::vector<uint64_t>(numberOfKeys));
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&map, &foundValues, thread, numberOfKeys, numberOfThreads]() {
+            for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                uint64_t key = (thread % 2 == 0) ? i : numberOfKeys - 1 - i;
+                foundValues[thread][key] = map.findOrAdd(createKey(key), key * numberOfThreads + thread);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        uint64_t value = map.getValue(createKey(key));
+        EXPECT_EQ(key, value / numberOfThreads);
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(value, foundValues[thread][key]);
+        }
+    }
+    uint64_t numberOfIteratedElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.first.getAsInt(0, 64), keyValuePair.second / numberOfThreads);
+        ++numberOfIteratedElements;
+    }
+    EXPECT_EQ(numberOfKeys, numberOfIteratedElements);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAddWithMaximalLoadFactor) {
+    uint64_t const numberOfThreads = 8;
+    uint64_t const numberOfKeys = 20000;
+    // With a load factor of one, the map is only increased when it is (almost) full, so concurrent insertions must not claim the last free bucket.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 1, 1.0);
+
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&map, thread, numberOfKeys, numberOfThreads]() {
+            for (uint64_t key = thread; key < numberOfKeys; key += numberOfThreads) {
+                map.findOrAdd(createKey(key), key);
+                EXPECT_FALSE(map.contains(createKey(numberOfKeys + key)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_GT(map.capacity(), numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        EXPECT_EQ(key, map.getValue(createKey(key)));
+    }
+}
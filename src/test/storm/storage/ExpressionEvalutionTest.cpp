@@ -93,3 +93,43 @@ TEST(ExpressionEvaluation, NegativeModulo) {
     EXPECT_NEAR(result3, expectedDouble, 1e-6);
     EXPECT_NEAR(result4, expectedDouble, 1e-6);
 }
+
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+
+    std::vector<storm::expressions::Expression> expressions = {
+        storm::expressions::ite(x, y + z, manager->integer(3) * z),
+        (x && y > manager->integer(3)) || (!x && storm::expressions::modulo(y, manager->integer(4)) == manager->integer(1)),
+        storm::expressions::implies(x, z <= manager->rational(1.5)) != (y >= manager->integer(5)),
+        storm::expressions::maximum(storm::expressions::floor(z), y - manager->integer(2)) / manager->integer(2) + z * z,
+        storm::expressions::minimum(-z, storm::expressions::ceil(z)) * storm::expressions::ite(y < manager->integer(2), manager->integer(1), y)};
+
+    storm::expressions::ExprtkExpressionEvaluator exprtkEvaluator(*manager);
+    storm::expressions::ExprtkExpressionEvaluator bytecodeEvaluator(*manager);
+    bytecodeEvaluator.setUseBytecode();
+    EXPECT_TRUE(bytecodeEvaluator.isUseBytecodeSet());
+
+    for (bool xValue : {false, true}) {
+        for (int_fast64_t yValue = -3; yValue < 8; ++yValue) {
+            for (int_fast64_t i = -4; i < 5; ++i) {
+                double zValue = i / static_cast<double>(2);
+                for (auto* evaluator : {&exprtkEvaluator, &bytecodeEvaluator}) {
+                    evaluator->setBooleanValue(x, xValue);
+                    evaluator->setIntegerValue(y, yValue);
+                    evaluator->setRationalValue(z, zValue);
+                }
+                for (auto const& expression : expressions) {
+                    if (expression.hasBooleanType()) {
+                        EXPECT_EQ(exprtkEvaluator.asBool(expression), bytecodeEvaluator.asBool(expression)) << expression;
+                    } else {
+                        EXPECT_NEAR(exprtkEvaluator.asRational(expression), bytecodeEvaluator.asRational(expression), 1e-9) << expression;
+                    }
+                }
+            }
+        }
+    }
+}
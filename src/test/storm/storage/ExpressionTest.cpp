@@ -318,6 +318,26 @@ TEST(Expression, SubstitutionTest) {
     EXPECT_TRUE(substitutedExpression.simplify().isTrue());
 }
 
+TEST(Expression, SubstitutionPreservesSharingTest) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Expression x = manager->declareIntegerVariable("x");
+    storm::expressions::Expression y = manager->declareIntegerVariable("y");
+
+    // Both operands of the product refer to the same sum.
+    storm::expressions::Expression sum = x + y;
+    storm::expressions::Expression product = sum * sum;
+
+    std::map<storm::expressions::Variable, storm::expressions::Expression> substitution = {std::make_pair(manager->getVariable("x"), manager->integer(2))};
+    storm::expressions::Expression substitutedExpression = product.substitute(substitution);
+    ASSERT_EQ(2ull, substitutedExpression.getArity());
+    EXPECT_EQ(substitutedExpression.getBaseExpression().getOperand(0).get(), substitutedExpression.getBaseExpression().getOperand(1).get());
+    EXPECT_NE(sum.getBaseExpressionPointer().get(), substitutedExpression.getBaseExpression().getOperand(0).get());
+
+    storm::expressions::SimpleValuation valuation(manager);
+    valuation.setIntegerValue(manager->getVariable("y"), 3);
+    EXPECT_EQ(25, substitutedExpression.evaluateAsInt(&valuation));
+}
+
 TEST(Expression, SimplificationTest) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
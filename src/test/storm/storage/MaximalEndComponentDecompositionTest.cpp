@@ -185,3 +185,34 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, UpdateForRemovedChoices) {
+    // State 0 can go to state 1 or stay, state 1 returns to state 0, and state 2 is absorbing.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 3, 4, true, true, 3);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 0, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 2, 1.0);
+    auto matrix = builder.build();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(matrix, matrix.transpose(true));
+    ASSERT_EQ(2ul, mecDecomposition.size());
+
+    storm::storage::BitVector removedChoices(4, false);
+    removedChoices.set(0);
+    mecDecomposition.updateForRemovedChoices(matrix, removedChoices);
+
+    ASSERT_EQ(2ul, mecDecomposition.size());
+    for (auto const& mec : mecDecomposition) {
+        ASSERT_EQ(1ul, mec.size());
+        if (mec.containsState(0)) {
+            EXPECT_TRUE(mec.containsChoice(0, 1));
+            EXPECT_FALSE(mec.containsChoice(0, 0));
+        } else {
+            EXPECT_TRUE(mec.containsChoice(2, 3));
+        }
+    }
+}
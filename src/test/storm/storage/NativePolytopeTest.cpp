@@ -0,0 +1,68 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/geometry/Polytope.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+typedef storm::RationalNumber ValueType;
+typedef std::vector<ValueType> Point;
+
+ValueType rational(int64_t numerator, int64_t denominator = 1) {
+    return storm::utility::convertNumber<ValueType>(numerator) / storm::utility::convertNumber<ValueType>(denominator);
+}
+
+std::vector<Point> sorted(std::vector<Point> points) {
+    std::sort(points.begin(), points.end());
+    return points;
+}
+
+std::shared_ptr<storm::storage::geometry::Polytope<ValueType>> unitCube() {
+    std::vector<Point> points;
+    for (int64_t x = 0; x <= 1; ++x) {
+        for (int64_t y = 0; y <= 1; ++y) {
+            for (int64_t z = 0; z <= 1; ++z) {
+                points.push_back({rational(x), rational(y), rational(z)});
+            }
+        }
+    }
+    return storm::storage::geometry::Polytope<ValueType>::create(points);
+}
+
+}  // namespace
+
+TEST(NativePolytopeTest, IncrementalIntersection) {
+    auto cube = unitCube();
+    ASSERT_TRUE(cube->isNativePolytope());
+    EXPECT_EQ(8ull, cube->getVertices().size());
+
+    // Cut off the vertex (1,1,1). The vertices of the intersection are obtained from the (now cached) vertices of the cube.
+    storm::storage::geometry::Halfspace<ValueType> halfspace({rational(1), rational(1), rational(1)}, rational(5, 2));
+    auto intersection = cube->intersection(halfspace);
+    auto expected = storm::storage::geometry::Polytope<ValueType>::create(intersection->getHalfspaces());
+    EXPECT_EQ(10ull, intersection->getVertices().size());
+    EXPECT_EQ(sorted(expected->getVertices()), sorted(intersection->getVertices()));
+
+    // Cut through the vertices (1,0,0), (0,1,0) and (0,0,1) and then through the resulting simplex.
+    intersection = intersection->intersection(storm::storage::geometry::Halfspace<ValueType>({rational(1), rational(1), rational(1)}, rational(1)));
+    EXPECT_EQ(4ull, intersection->getVertices().size());
+    intersection = intersection->intersection(storm::storage::geometry::Halfspace<ValueType>({rational(-1), rational(0), rational(0)}, rational(-1, 2)));
+    expected = storm::storage::geometry::Polytope<ValueType>::create(intersection->getHalfspaces());
+    EXPECT_EQ(sorted(expected->getVertices()), sorted(intersection->getVertices()));
+    EXPECT_EQ(4ull, intersection->getVertices().size());
+}
+
+TEST(NativePolytopeTest, IncrementalIntersectionUnbounded) {
+    // The downward closure of a single point is unbounded. Its only vertex is the point itself.
+    auto closure = storm::storage::geometry::Polytope<ValueType>::createDownwardClosure({{rational(1), rational(1)}});
+    EXPECT_EQ(1ull, closure->getVertices().size());
+
+    auto intersection = closure->intersection(storm::storage::geometry::Halfspace<ValueType>({rational(1), rational(1)}, rational(1)));
+    auto expected = storm::storage::geometry::Polytope<ValueType>::create(intersection->getHalfspaces());
+    EXPECT_EQ(sorted(expected->getVertices()), sorted(intersection->getVertices()));
+    EXPECT_EQ(2ull, intersection->getVertices().size());
+}
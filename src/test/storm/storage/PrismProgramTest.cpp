@@ -2,6 +2,12 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "test/storm_gtest.h"
 
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/utility/solver.h"
@@ -185,4 +191,56 @@ TEST(PrismProgramTest, ReplaceConstantByVariable) {
                         origPrismProgram.getConstant("CrowdSize"), origPrismProgram.getManager().integer(0), origPrismProgram.getManager().integer(20), true));
     EXPECT_NO_THROW(transformedPrismProgram.getGlobalIntegerVariable("CrowdSize"));
     EXPECT_FALSE(transformedPrismProgram.hasConstant("CrowdSize"));
-}
\ No newline at end of file
+}
+TEST(PrismProgramTest, RestrictToConeOfInfluence) {
+    // The counter does not influence the properties and its module only joins the synchronization, whereas the guard of the unlabeled command makes 'g'
+    // relevant.
+    std::string const programString = R"(
+dtmc
+module main
+    s : [0..2] init 0;
+    [tick] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);
+    [tick] s>0 -> (s'=s);
+endmodule
+module counter
+    c : [0..10] init 0;
+    [tick] true -> (c'=min(c+1, 10));
+endmodule
+module other
+    g : [0..3] init 0;
+    [] g<3 -> 0.5 : (g'=g+1) + 0.5 : (g'=0);
+endmodule
+label "done" = s=2;
+label "full" = c=10;
+rewards "steps"
+    [tick] true : 1;
+endrewards
+rewards "count"
+    c>5 : 1;
+endrewards
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "coi").substituteConstantsFormulas();
+    auto formulas = storm::api::extractFormulasFromProperties(
+        storm::api::parsePropertiesForPrismProgram("P=? [F<=5 \"done\"]; R{\"steps\"}=? [C<=5]", program));
+    storm::prism::Program restrictedProgram = program.restrictToConeOfInfluence(formulas);
+
+    EXPECT_EQ(2ull, restrictedProgram.getNumberOfModules());
+    EXPECT_TRUE(restrictedProgram.hasModule("main"));
+    EXPECT_TRUE(restrictedProgram.hasModule("other"));
+    EXPECT_TRUE(restrictedProgram.hasLabel("done"));
+    EXPECT_FALSE(restrictedProgram.hasLabel("full"));
+    EXPECT_TRUE(restrictedProgram.hasRewardModel("steps"));
+    EXPECT_FALSE(restrictedProgram.hasRewardModel("count"));
+
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+    auto restrictedModel = storm::api::buildSparseModel<double>(restrictedProgram, formulas);
+    EXPECT_EQ(12ull, restrictedModel->getNumberOfStates());
+    EXPECT_LT(restrictedModel->getNumberOfStates(), model->getNumberOfStates());
+    storm::Environment env;
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formula, true));
+        auto restrictedResult = storm::api::verifyWithSparseEngine<double>(env, restrictedModel, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()],
+                    restrictedResult->asExplicitQuantitativeCheckResult<double>()[*restrictedModel->getInitialStates().begin()], 1e-8);
+    }
+}
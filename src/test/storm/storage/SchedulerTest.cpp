@@ -1,5 +1,9 @@
 #include "storm-config.h"
+
+#include <sstream>
+
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/storage/CompactScheduler.h"
 #include "storm/storage/Scheduler.h"
 #include "test/storm_gtest.h"
 
@@ -50,3 +54,44 @@ TEST(SchedulerTest, PartialDeterministicMemorylessScheduler) {
     ASSERT_FALSE(scheduler.getChoice(1).isDefined());
     ASSERT_FALSE(scheduler.getChoice(2).isDefined());
 }
+
+TEST(SchedulerTest, CompactDeterministicMemorylessScheduler) {
+    storm::storage::CompactScheduler compactScheduler(std::vector<uint64_t>({0, 2, 3, 7, 9}));
+    EXPECT_EQ(2ul, compactScheduler.getNumberOfBitsPerChoice());
+    compactScheduler.setChoice(1, 0);
+    compactScheduler.setChoice(3, 2);
+    // Choices that exceed the initial size enlarge the storage
+    compactScheduler.setChoice(6, 3);
+    EXPECT_EQ(3ul, compactScheduler.getNumberOfBitsPerChoice());
+    EXPECT_EQ(1ul, compactScheduler.getChoice(0));
+    EXPECT_EQ(3ul, compactScheduler.getChoice(2));
+    EXPECT_EQ(6ul, compactScheduler.getChoice(3));
+    EXPECT_FALSE(compactScheduler.isChoiceDefined(1));
+
+    storm::storage::Scheduler<double> scheduler(std::move(compactScheduler));
+    EXPECT_TRUE(scheduler.hasCompactRepresentation());
+    EXPECT_TRUE(scheduler.isPartialScheduler());
+    EXPECT_TRUE(scheduler.isDeterministicScheduler());
+    scheduler.setChoice(0, 1);
+    scheduler.clearChoice(3);
+    EXPECT_TRUE(scheduler.isChoiceDefined(1));
+    EXPECT_FALSE(scheduler.isChoiceDefined(3));
+    scheduler.setChoice(3, 3);
+    EXPECT_FALSE(scheduler.isPartialScheduler());
+    EXPECT_TRUE(scheduler.hasCompactRepresentation());
+    std::stringstream compactOutput;
+    scheduler.printToStream(compactOutput);
+    EXPECT_TRUE(scheduler.hasCompactRepresentation());
+
+    // Accessing choices converts to the general representation
+    EXPECT_EQ(1ul, scheduler.getChoice(0).getDeterministicChoice());
+    EXPECT_FALSE(scheduler.hasCompactRepresentation());
+    EXPECT_EQ(0ul, scheduler.getChoice(1).getDeterministicChoice());
+    EXPECT_EQ(3ul, scheduler.getChoice(2).getDeterministicChoice());
+    EXPECT_EQ(3ul, scheduler.getChoice(3).getDeterministicChoice());
+    EXPECT_TRUE(scheduler.isDeterministicScheduler());
+    EXPECT_FALSE(scheduler.isPartialScheduler());
+    std::stringstream generalOutput;
+    scheduler.printToStream(generalOutput);
+    EXPECT_EQ(generalOutput.str(), compactOutput.str());
+}
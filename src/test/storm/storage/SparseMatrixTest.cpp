@@ -1,8 +1,10 @@
+#include "storm-config.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SubmatrixView.h"
 #include "storm/utility/permutation.h"
 #include "test/storm_gtest.h"
 
@@ -608,6 +610,33 @@ TEST(SparseMatrix, Transpose) {
     ASSERT_TRUE(transposeResult == matrix2);
 }
 
+TEST(SparseMatrix, TransposeParallel) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Intel TBB not available.";
+#else
+    // A row-grouped matrix with enough rows to be split into several chunks.
+    uint64_t const numGroups = 1000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= group % 3; ++choice, ++row) {
+            uint64_t const firstColumn = (group * 7 + choice) % numGroups;
+            uint64_t const secondColumn = (group * 13 + choice + 500) % numGroups;
+            matrixBuilder.addNextValue(row, std::min(firstColumn, secondColumn), 0.5);
+            if (firstColumn != secondColumn) {
+                matrixBuilder.addNextValue(row, std::max(firstColumn, secondColumn), choice == 1 ? 0.0 : 0.5);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    EXPECT_EQ(matrix.transpose(), matrix.transposeParallel());
+    EXPECT_EQ(matrix.transpose(true), matrix.transposeParallel(true));
+    EXPECT_EQ(matrix.transpose(true, true), matrix.transposeParallel(true, true));
+#endif
+}
+
 TEST(SparseMatrix, EquationSystem) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 7);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.1));
@@ -990,3 +1019,44 @@ TEST(SparseMatrix, DropZeroEntries) {
     ASSERT_TRUE(matrixX == matrix4);
     ASSERT_FALSE(matrixX.getEntryCount() == matrix4.getEntryCount());
 }
+
+TEST(SparseMatrix, SubmatrixView) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    storm::storage::BitVector constraint(4);
+    STORM_SILENT_ASSERT_THROW(storm::storage::SubmatrixView<double>(matrix, constraint, constraint), storm::exceptions::InvalidArgumentException);
+
+    constraint.set(0);
+    constraint.set(2);
+    constraint.set(3);
+    storm::storage::BitVector makeZeroColumns(4);
+    makeZeroColumns.set(3);
+
+    storm::storage::SubmatrixView<double> view(matrix, constraint, constraint);
+    EXPECT_EQ(4ul, view.getRowCount());
+    EXPECT_EQ(3ul, view.getColumnCount());
+    EXPECT_EQ(3ul, view.getRowGroupCount());
+    EXPECT_EQ(5ul, view.getEntryCount());
+    EXPECT_EQ(2ul, view.getMaximalRowEntryCount());
+    EXPECT_EQ(4ul, view.getOriginalRow(3));
+    EXPECT_EQ(matrix.getSubmatrix(true, constraint, constraint, false), view.toSparseMatrix());
+
+    storm::storage::SubmatrixView<double> zeroView(matrix, constraint, constraint, makeZeroColumns);
+    EXPECT_EQ(4ul, zeroView.getEntryCount());
+    EXPECT_EQ(matrix.getSubmatrix(true, constraint, constraint, false, makeZeroColumns), zeroView.toSparseMatrix());
+}
@@ -0,0 +1,53 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+TEST(StateValuationsTest, AddAndSelect) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable b = manager->declareBooleanVariable("b");
+    storm::expressions::Variable x = manager->declareIntegerVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x, 0, 3);
+    builder.addVariable(y);
+    // Values outside of the given bounds have to widen the encoding.
+    std::vector<int64_t> xValues = {0, 3, 7, -5, 1000, std::numeric_limits<int64_t>::min()};
+    std::vector<int64_t> yValues = {std::numeric_limits<int64_t>::max(), -1, 0, 1, -1000, 42};
+    for (uint64_t state = 0; state < xValues.size(); ++state) {
+        builder.addState(state, {state % 2 == 0}, {xValues[state], yValues[state]});
+    }
+    storm::storage::sparse::StateValuations valuations = builder.build();
+
+    ASSERT_EQ(xValues.size(), valuations.getNumberOfStates());
+    for (uint64_t state = 0; state < xValues.size(); ++state) {
+        EXPECT_FALSE(valuations.isEmpty(state));
+        EXPECT_EQ(state % 2 == 0, valuations.getBooleanValue(state, b));
+        EXPECT_EQ(xValues[state], valuations.getIntegerValue(state, x));
+        EXPECT_EQ(yValues[state], valuations.getIntegerValue(state, y));
+    }
+    EXPECT_EQ("[b\t& x=0\t& y=9223372036854775807]", valuations.toString(0));
+
+    storm::storage::BitVector selectedStates(xValues.size());
+    selectedStates.set(1);
+    selectedStates.set(4);
+    storm::storage::sparse::StateValuations selected = valuations.selectStates(selectedStates);
+    ASSERT_EQ(2ul, selected.getNumberOfStates());
+    EXPECT_EQ(3, selected.getIntegerValue(0, x));
+    EXPECT_EQ(-1000, selected.getIntegerValue(1, y));
+    EXPECT_TRUE(selected.getBooleanValue(1, b));
+
+    storm::storage::sparse::StateValuations reordered = valuations.selectStates(std::vector<uint64_t>({5, 10, 2}));
+    ASSERT_EQ(3ul, reordered.getNumberOfStates());
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), reordered.getIntegerValue(0, x));
+    EXPECT_TRUE(reordered.isEmpty(1));
+    EXPECT_EQ(7, reordered.getIntegerValue(2, x));
+}
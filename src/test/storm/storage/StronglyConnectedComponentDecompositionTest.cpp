@@ -1,4 +1,8 @@
 #include "storm-config.h"
+
+#include <random>
+#include <set>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -90,3 +94,80 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    // Build a large random model consisting of clusters of 100 states with occasional links to later clusters.
+    uint64_t const numStates = 30000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numStates; ++state) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0, numChoices = 1 + generator() % 2; choice < numChoices; ++choice, ++row) {
+            std::set<uint64_t> targets;
+            for (uint64_t i = 0, numTargets = 1 + generator() % 3; i < numTargets; ++i) {
+                uint64_t cluster = state / 100;
+                if (generator() % 10 == 0) {
+                    cluster += 1 + generator() % 5;
+                }
+                targets.insert(std::min(numStates - 1, cluster * 100 + generator() % 100));
+            }
+            for (auto const target : targets) {
+                builder.addNextValue(row, target, 1.0 / targets.size());
+            }
+        }
+    }
+    auto matrix = builder.build();
+    storm::storage::BitVector subsystem(numStates, true), choices(matrix.getRowCount(), true);
+    for (uint64_t state = 0; state < numStates; state += 7) {
+        subsystem.set(state, false);
+    }
+    for (uint64_t choice = 0; choice < matrix.getRowCount(); choice += 5) {
+        choices.set(choice, false);
+    }
+
+    for (bool restrict : {false, true}) {
+        storm::storage::StronglyConnectedComponentDecompositionOptions sequentialOptions, parallelOptions;
+        sequentialOptions.computeSccDepths();
+        parallelOptions.computeSccDepths().parallel();
+        if (restrict) {
+            sequentialOptions.subsystem(subsystem).choices(choices);
+            parallelOptions.subsystem(subsystem).choices(choices);
+        }
+        storm::storage::SccDecompositionResult sequentialResult, parallelResult;
+        storm::storage::performSccDecomposition(matrix, sequentialOptions, sequentialResult);
+        storm::storage::performSccDecomposition(matrix, parallelOptions, parallelResult);
+
+        ASSERT_EQ(sequentialResult.sccCount, parallelResult.sccCount);
+        EXPECT_EQ(sequentialResult.nonTrivialStates, parallelResult.nonTrivialStates);
+        std::vector<uint64_t> sccMapping(sequentialResult.sccCount, std::numeric_limits<uint64_t>::max());
+        for (uint64_t state = 0; state < numStates; ++state) {
+            ASSERT_EQ(sequentialResult.stateHasScc(state), parallelResult.stateHasScc(state));
+            if (!parallelResult.stateHasScc(state)) {
+                continue;
+            }
+            // Both decompositions need to induce the same partition with the same SCC depths.
+            auto const sequentialScc = sequentialResult.stateToSccMapping[state];
+            auto const parallelScc = parallelResult.stateToSccMapping[state];
+            if (sccMapping[sequentialScc] == std::numeric_limits<uint64_t>::max()) {
+                sccMapping[sequentialScc] = parallelScc;
+            }
+            ASSERT_EQ(sccMapping[sequentialScc], parallelScc);
+            EXPECT_EQ(sequentialResult.sccDepths->at(sequentialScc), parallelResult.sccDepths->at(parallelScc));
+            // The SCCs need to be sorted topologically
+            for (auto const choice : matrix.getRowGroupIndices(state)) {
+                if (restrict && !choices.get(choice)) {
+                    continue;
+                }
+                for (auto const& entry : matrix.getRow(choice)) {
+                    if (parallelResult.stateHasScc(entry.getColumn())) {
+                        EXPECT_LE(parallelResult.stateToSccMapping[entry.getColumn()], parallelScc);
+                    }
+                }
+            }
+        }
+    }
+}
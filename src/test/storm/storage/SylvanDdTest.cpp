@@ -1,8 +1,10 @@
 #include "storm-config.h"
+#include "storm/adapters/JsonAdapter.h"
 #include "test/storm_gtest.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
@@ -13,6 +15,7 @@
 
 #include "carl/util/stringparser.h"
 
+#include <filesystem>
 #include <iostream>
 #include <memory>
 
@@ -953,3 +956,57 @@ TEST(SylvanDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, StatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+
+    storm::dd::DdManagerStatistics statistics = manager->getStatistics();
+    for (auto const& operation : statistics.operations) {
+        EXPECT_EQ(0ul, operation.count);
+    }
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> bdd =
+        manager->getRange(x.first).relationalProduct(manager->getIdentity(x.first, x.second), {x.first}, {x.second});
+    bdd = bdd.ite(manager->getBddOne(), manager->getBddZero()).existsAbstract({x.first});
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> add = manager->template getIdentity<double>(x.first).sumAbstract({x.first});
+    EXPECT_EQ(45, add.getMax());
+
+    statistics = manager->getStatistics();
+    EXPECT_EQ(1ul, statistics.getOperationStatistics(storm::dd::DdOperationType::AndExists).count);
+    EXPECT_EQ(1ul, statistics.getOperationStatistics(storm::dd::DdOperationType::Ite).count);
+    EXPECT_EQ(2ul, statistics.getOperationStatistics(storm::dd::DdOperationType::Abstraction).count);
+    ASSERT_TRUE(statistics.liveNodes.has_value());
+    EXPECT_GT(*statistics.liveNodes, 0ul);
+    ASSERT_TRUE(statistics.peakNodes.has_value());
+    EXPECT_GE(*statistics.peakNodes, *statistics.liveNodes);
+    EXPECT_TRUE(statistics.garbageCollections.has_value());
+
+    auto json = statistics.toJson();
+    EXPECT_EQ(1ul, json["operations"]["and-exists"]["count"].get<uint64_t>());
+}
+
+TEST(SylvanDd, BinaryExportTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> bdd = (manager->getEncoding(x.first, 4) || manager->getEncoding(x.first, 7)) && !manager->getEncoding(y.first, 2);
+    std::string const bddFilename = (std::filesystem::temp_directory_path() / "storm-test-sylvan-bdd.dd").string();
+    ASSERT_NO_THROW(bdd.exportToBinary(bddFilename));
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> loadedBdd = storm::dd::Bdd<storm::dd::DdType::Sylvan>::fromBinary(*manager, bddFilename);
+    EXPECT_TRUE(bdd == loadedBdd);
+    EXPECT_EQ(bdd.getContainedMetaVariables(), loadedBdd.getContainedMetaVariables());
+    std::filesystem::remove(bddFilename);
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> add =
+        manager->template getIdentity<double>(x.first) * manager->template getConstant<double>(0.5) + manager->template getIdentity<double>(y.first);
+    std::string const addFilename = (std::filesystem::temp_directory_path() / "storm-test-sylvan-add.dd").string();
+    ASSERT_NO_THROW(add.exportToBinary(addFilename));
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> loadedAdd = storm::dd::Add<storm::dd::DdType::Sylvan, double>::fromBinary(*manager, addFilename);
+    EXPECT_TRUE(add == loadedAdd);
+    EXPECT_EQ(add.getContainedMetaVariables(), loadedAdd.getContainedMetaVariables());
+
+    STORM_SILENT_ASSERT_THROW(storm::dd::Bdd<storm::dd::DdType::Sylvan>::fromBinary(*manager, addFilename), storm::exceptions::WrongFormatException);
+    std::filesystem::remove(addFilename);
+}
@@ -0,0 +1,62 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/transformer/DuplicateChoiceEliminator.h"
+
+namespace {
+
+// The commands labeled a and b only differ in their action. The reward model optionally distinguishes them.
+std::string createProgram(bool distinguishingRewards) {
+    return std::string(R"(
+mdp
+module m
+    s : [0..2] init 0;
+    [a] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);
+    [b] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);
+    [c] s=0 -> (s'=2);
+    [] s>0 -> true;
+endmodule
+rewards "r"
+)") + (distinguishingRewards ? "    [a] true : 1;\n" : "    [a] true : 1;\n    [b] true : 1;\n") +
+           "endrewards\n";
+}
+
+std::shared_ptr<storm::models::sparse::Mdp<double>> buildMdp(bool distinguishingRewards) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(createProgram(distinguishingRewards), "duplicates");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels().setBuildChoiceLabels();
+    return storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Mdp<double>>();
+}
+
+TEST(DuplicateChoiceEliminatorTest, MergesIdenticalChoices) {
+    auto mdp = buildMdp(false);
+    ASSERT_EQ(3ul, mdp->getTransitionMatrix().getRowGroupSize(*mdp->getInitialStates().begin()));
+
+    auto representatives = storm::transformer::DuplicateChoiceEliminator<double>::computeRepresentatives(*mdp);
+    uint64_t const firstChoice = mdp->getTransitionMatrix().getRowGroupIndices()[*mdp->getInitialStates().begin()];
+    EXPECT_EQ(firstChoice, representatives[firstChoice]);
+    EXPECT_EQ(firstChoice, representatives[firstChoice + 1]);
+    EXPECT_EQ(firstChoice + 2, representatives[firstChoice + 2]);
+
+    auto result = storm::transformer::DuplicateChoiceEliminator<double>::transform(*mdp);
+    EXPECT_EQ(mdp->getNumberOfStates(), result->getNumberOfStates());
+    EXPECT_EQ(mdp->getNumberOfChoices() - 1, result->getNumberOfChoices());
+    uint64_t const initialState = *result->getInitialStates().begin();
+    ASSERT_EQ(2ul, result->getTransitionMatrix().getRowGroupSize(initialState));
+    uint64_t const keptChoice = result->getTransitionMatrix().getRowGroupIndices()[initialState];
+    ASSERT_TRUE(result->hasChoiceLabeling());
+    EXPECT_EQ((std::set<std::string>{"a", "b"}), result->getChoiceLabeling().getLabelsOfChoice(keptChoice));
+    EXPECT_EQ(1.0, result->getRewardModel("r").getStateActionReward(keptChoice));
+}
+
+TEST(DuplicateChoiceEliminatorTest, KeepsChoicesWithDifferentRewards) {
+    auto mdp = buildMdp(true);
+    auto result = storm::transformer::DuplicateChoiceEliminator<double>::transform(*mdp);
+    EXPECT_EQ(mdp->getNumberOfChoices(), result->getNumberOfChoices());
+    EXPECT_TRUE(mdp->getTransitionMatrix() == result->getTransitionMatrix());
+}
+
+}  // namespace
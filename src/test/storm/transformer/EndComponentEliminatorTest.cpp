@@ -141,3 +141,45 @@ TEST(NeutralECRemover, SimpleModelTest) {
         }
     }
 }
+
+TEST(NeutralECRemover, InPlaceTest) {
+    storm::storage::SparseMatrixBuilder<double> builder(7, 4, 11, true, true, 4);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 3, 0.5));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 1.0));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(3, 3, 0.75));
+    ASSERT_NO_THROW(builder.newRowGroup(4));
+    ASSERT_NO_THROW(builder.addNextValue(4, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(4, 1, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(4, 3, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(5, 2, 1.0));
+    ASSERT_NO_THROW(builder.newRowGroup(6));
+    ASSERT_NO_THROW(builder.addNextValue(6, 3, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    storm::storage::BitVector subsystem(4, true);
+    storm::storage::BitVector possibleEcRows(7, true);
+    possibleEcRows.set(6, false);
+    storm::storage::BitVector addSinkRowStates(4, true);
+
+    auto expected = storm::transformer::EndComponentEliminator<double>::transform(matrix, subsystem, possibleEcRows, addSinkRowStates, true);
+    auto actual = storm::transformer::EndComponentEliminator<double>::transform(storm::storage::SparseMatrix<double>(matrix), subsystem, possibleEcRows,
+                                                                                addSinkRowStates, true);
+
+    // States 0 and 1 form an EC, state 2 is a singleton EC and state 3 is kept (but not an EC as its selfloop is not a possible EC row).
+    EXPECT_EQ(3ull, actual.matrix.getRowGroupCount());
+    EXPECT_EQ(expected.matrix, actual.matrix);
+    EXPECT_EQ(expected.newToOldRowMapping, actual.newToOldRowMapping);
+    EXPECT_EQ(expected.oldToNewStateMapping, actual.oldToNewStateMapping);
+    EXPECT_EQ(expected.sinkRows, actual.sinkRows);
+    EXPECT_EQ(2ull, actual.sinkRows.getNumberOfSetBits());
+    for (auto sinkRow : actual.sinkRows) {
+        ASSERT_EQ(1ull, actual.matrix.getRow(sinkRow).getNumberOfEntries());
+        EXPECT_EQ(1.0, actual.matrix.getRow(sinkRow).begin()->getValue());
+    }
+}
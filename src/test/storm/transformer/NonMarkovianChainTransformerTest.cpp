@@ -242,3 +242,26 @@ TEST(NonMarkovianChainTransformerTest, ChainElimination2ExampleTest) {
     // result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(transformed.second[2], true));
     // EXPECT_NEAR(190, result->asExplicitQuantitativeCheckResult<double>()[initState], 1e-6);
 }
+
+TEST(NonMarkovianChainTransformerTest, ParallelEliminationTest) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/chain_elimination1.drn")
+                     ->template as<storm::models::sparse::MarkovAutomaton<double>>();
+    std::string formulasString = "Pmin=? [ F \"Fail\"];Pmin=? [ F<=300 \"Fail\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulasString));
+
+    for (auto labelBehavior : {storm::transformer::EliminationLabelBehavior::KeepLabels, storm::transformer::EliminationLabelBehavior::MergeLabels}) {
+        auto sequential = storm::transformer::NonMarkovianChainTransformer<double>::eliminateNonmarkovianStates(model, labelBehavior);
+        auto parallel = storm::transformer::NonMarkovianChainTransformer<double>::eliminateNonmarkovianStatesInParallel(model, labelBehavior);
+        // The states are eliminated in a different order, so only the results are compared.
+        EXPECT_LT(parallel->getNumberOfStates(), model->getNumberOfStates());
+        ASSERT_EQ(1ul, parallel->getInitialStates().getNumberOfSetBits());
+        uint64_t sequentialInitState = *sequential->getInitialStates().begin();
+        uint64_t parallelInitState = *parallel->getInitialStates().begin();
+        for (auto const& formula : formulas) {
+            auto sequentialResult = storm::api::verifyWithSparseEngine(sequential, storm::api::createTask<double>(formula, true));
+            auto parallelResult = storm::api::verifyWithSparseEngine(parallel, storm::api::createTask<double>(formula, true));
+            EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[sequentialInitState],
+                        parallelResult->asExplicitQuantitativeCheckResult<double>()[parallelInitState], 1e-6);
+        }
+    }
+}
@@ -54,6 +54,10 @@ void testStatePermuter(std::string const& prismModelFile, std::string const& for
     EXPECT_EQ(permutedModel->getNumberOfStates() - 1, *permutedModel->getInitialStates().begin()) << "Failed for model " << prismModelFile;
     permutedModel = checkOrder(storm::utility::permutation::OrderKind::ReverseBfs);
     EXPECT_EQ(permutedModel->getNumberOfStates() - 1, *permutedModel->getInitialStates().begin()) << "Failed for model " << prismModelFile;
+    checkOrder(storm::utility::permutation::OrderKind::ReverseCuthillMcKee);
+    checkOrder(storm::utility::permutation::OrderKind::SccTopological);
+    permutedModel = checkOrder(storm::utility::permutation::OrderKind::BackwardBfs);
+    EXPECT_EQ(permutedModel->getNumberOfStates() - 1, *permutedModel->getInitialStates().begin()) << "Failed for model " << prismModelFile;
 }
 TEST_F(StatePermuterTest, BrpTest) {
     testStatePermuter(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "P=? [ F \"target\"]");
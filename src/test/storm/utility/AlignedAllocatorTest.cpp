@@ -0,0 +1,23 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+
+#include "storm/utility/AlignedAllocator.h"
+
+TEST(AlignedAllocatorTest, Alignment) {
+    storm::utility::AlignedVector<double> small(3, 1.0);
+    EXPECT_EQ(0ull, reinterpret_cast<uintptr_t>(small.data()) % storm::utility::CacheLineSize);
+
+    storm::utility::AlignedVector<uint32_t> large(storm::utility::HugePageSize, 2u);
+    EXPECT_EQ(0ull, reinterpret_cast<uintptr_t>(large.data()) % storm::utility::HugePageSize);
+    EXPECT_EQ(2u, large.back());
+
+    // Growing the vector preserves the contents.
+    for (uint32_t i = 0; i < 100; ++i) {
+        small.push_back(static_cast<double>(i));
+    }
+    EXPECT_EQ(0ull, reinterpret_cast<uintptr_t>(small.data()) % storm::utility::CacheLineSize);
+    EXPECT_EQ(1.0, small[2]);
+    EXPECT_EQ(99.0, small.back());
+}
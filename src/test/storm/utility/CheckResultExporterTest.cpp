@@ -0,0 +1,148 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <sstream>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/io/CheckResultExporter.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+namespace {
+
+std::string const walkProgram = R"(
+dtmc
+module walk
+    x : [0..4] init 1;
+    b : bool init false;
+    [] 0<x & x<4 -> 0.5 : (x'=x+1) & (b'=true) + 0.5 : (x'=x-1);
+    [] x=0 | x=4 -> true;
+endmodule
+label "goal" = x=4;
+)";
+
+std::shared_ptr<storm::models::sparse::Model<double>> buildWalk() {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(walkProgram, "walk");
+    storm::builder::BuilderOptions options;
+    options.setBuildStateValuations().setBuildAllLabels();
+    return storm::api::buildSparseModel<double>(program, options);
+}
+
+// Assigns each state a distinct value such that the order of the values differs from the order of the states.
+storm::modelchecker::ExplicitQuantitativeCheckResult<double> createResult(storm::models::sparse::Model<double> const& model) {
+    std::vector<double> values(model.getNumberOfStates());
+    for (uint64_t state = 0; state < values.size(); ++state) {
+        values[state] = (state % 2 == 0 ? 0.1 : -0.1) * static_cast<double>(state);
+    }
+    return storm::modelchecker::ExplicitQuantitativeCheckResult<double>(std::move(values));
+}
+
+std::vector<std::string> exportLines(storm::models::sparse::Model<double> const& model,
+                                     storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& result,
+                                     storm::exporter::CheckResultExportOptions const& options) {
+    std::stringstream stream;
+    storm::exporter::exportCheckResult(stream, model, result, options);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+}  // namespace
+
+TEST(CheckResultExporterTest, FormatFromExtension) {
+    EXPECT_EQ(storm::exporter::CheckResultExportFormat::Csv, storm::exporter::getCheckResultExportFormat("result.csv"));
+    EXPECT_EQ(storm::exporter::CheckResultExportFormat::Jsonl, storm::exporter::getCheckResultExportFormat("result.jsonl"));
+    EXPECT_EQ(storm::exporter::CheckResultExportFormat::Binary, storm::exporter::getCheckResultExportFormat("result.srb"));
+    EXPECT_EQ(storm::exporter::CheckResultExportFormat::Json, storm::exporter::getCheckResultExportFormat("result.json"));
+    EXPECT_EQ(storm::exporter::CheckResultExportFormat::Json, storm::exporter::getCheckResultExportFormat("result"));
+}
+
+TEST(CheckResultExporterTest, Csv) {
+    auto model = buildWalk();
+    auto result = createResult(*model);
+    storm::exporter::CheckResultExportOptions options;
+    options.format = storm::exporter::CheckResultExportFormat::Csv;
+    auto lines = exportLines(*model, result, options);
+    ASSERT_EQ(model->getNumberOfStates() + 1, lines.size());
+    EXPECT_EQ(0ul, lines[0].find("state,"));
+    EXPECT_NE(std::string::npos, lines[0].find(",x"));
+    EXPECT_NE(std::string::npos, lines[0].find(",b"));
+    EXPECT_EQ(lines[0].size() - std::string(",value,labels").size(), lines[0].find(",value,labels"));
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(0ul, lines[state + 1].find(std::to_string(state) + ","));
+    }
+}
+
+TEST(CheckResultExporterTest, JsonlWithLabelFilter) {
+    auto model = buildWalk();
+    auto result = createResult(*model);
+    storm::exporter::CheckResultExportOptions options;
+    options.format = storm::exporter::CheckResultExportFormat::Jsonl;
+    options.stateLabel = "goal";
+    auto lines = exportLines(*model, result, options);
+    ASSERT_EQ(1ul, lines.size());
+    EXPECT_NE(std::string::npos, lines[0].find("\"x\":4"));
+    EXPECT_NE(std::string::npos, lines[0].find("\"b\":true"));
+    EXPECT_NE(std::string::npos, lines[0].find("\"goal\""));
+}
+
+TEST(CheckResultExporterTest, TopK) {
+    auto model = buildWalk();
+    auto result = createResult(*model);
+    storm::exporter::CheckResultExportOptions options;
+    options.format = storm::exporter::CheckResultExportFormat::Csv;
+    options.includeLabels = false;
+    options.topK = 3;
+    auto lines = exportLines(*model, result, options);
+    ASSERT_EQ(4ul, lines.size());
+
+    std::vector<uint64_t> expectedStates(model->getNumberOfStates());
+    std::iota(expectedStates.begin(), expectedStates.end(), 0);
+    std::sort(expectedStates.begin(), expectedStates.end(), [&result](uint64_t lhs, uint64_t rhs) { return result[lhs] > result[rhs]; });
+    for (uint64_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(0ul, lines[i + 1].find(std::to_string(expectedStates[i]) + ","));
+    }
+}
+
+TEST(CheckResultExporterTest, Binary) {
+    auto model = buildWalk();
+    auto result = createResult(*model);
+    storm::exporter::CheckResultExportOptions options;
+    options.format = storm::exporter::CheckResultExportFormat::Binary;
+    std::stringstream stream;
+    storm::exporter::exportCheckResult(stream, *model, result, options);
+    std::string const data = stream.str();
+
+    storm::exporter::srb::Header header;
+    ASSERT_GE(data.size(), sizeof(header));
+    std::memcpy(&header, data.data(), sizeof(header));
+    EXPECT_EQ(0, std::memcmp(header.magic, storm::exporter::srb::Magic, sizeof(header.magic)));
+    EXPECT_EQ(storm::exporter::srb::Version, header.version);
+    EXPECT_EQ(model->getNumberOfStates(), header.numberOfRows);
+    EXPECT_EQ(4 + model->getStateLabeling().getNumberOfLabels(), header.numberOfColumns);
+
+    // The first column contains the state indices, the second one the values.
+    std::vector<uint64_t> words((data.size() - sizeof(header)) / 8);
+    std::memcpy(words.data(), data.data() + sizeof(header), words.size() * 8);
+    EXPECT_EQ(static_cast<uint64_t>(storm::exporter::srb::ColumnTypeCode::State), words[0]);
+    EXPECT_EQ(5ul, words[1]);
+    uint64_t const numberOfStates = model->getNumberOfStates();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_EQ(state, words[3 + state]);
+    }
+    uint64_t const valueColumn = 3 + numberOfStates;
+    EXPECT_EQ(static_cast<uint64_t>(storm::exporter::srb::ColumnTypeCode::Value), words[valueColumn]);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        double value;
+        std::memcpy(&value, &words[valueColumn + 3 + state], sizeof(value));
+        EXPECT_EQ(result[state], value);
+    }
+}
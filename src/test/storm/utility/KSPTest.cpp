@@ -63,6 +63,19 @@ TEST_F(KSPTest, reentry) {
     EXPECT_NEAR(3.0462610000679315e-08, dist2, 1e-12);
 }
 
+TEST_F(KSPTest, manyPaths) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+
+    double previousDistance = spg.getDistance(1);
+    for (unsigned long k = 2; k <= 5000; ++k) {
+        double dist = spg.getDistance(k);
+        ASSERT_LE(dist, previousDistance) << "for k=" << k;
+        previousDistance = dist;
+    }
+    EXPECT_NEAR(3.0462610000679315e-08, spg.getDistance(500), 1e-12);
+}
+
 TEST_F(KSPTest, groupTarget) {
     auto model = buildExampleModel();
     auto groupTarget = std::vector<storm::utility::ksp::state_t>{50, 90};
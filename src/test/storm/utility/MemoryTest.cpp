@@ -0,0 +1,34 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/utility/memory.h"
+
+TEST(MemoryTest, SolverVectorEstimates) {
+    uint64_t const states = 1000;
+    uint64_t const rows = 3000;
+    uint64_t const valueBytes = storm::utility::memory::getValueBytes(false);
+    EXPECT_EQ(sizeof(double), valueBytes);
+    EXPECT_LT(valueBytes, storm::utility::memory::getValueBytes(true));
+
+    uint64_t const vi = storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::ValueIteration, states, rows, valueBytes);
+    EXPECT_EQ((2 * states + rows) * valueBytes, vi);
+    EXPECT_LT(vi, storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::IntervalIteration, states, rows, valueBytes));
+    EXPECT_LT(vi, storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::OptimisticValueIteration, states, rows, valueBytes));
+    EXPECT_LT(vi, storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::PolicyIteration, states, rows, valueBytes));
+}
+
+TEST(MemoryTest, SelectMinMaxMethod) {
+    uint64_t const states = 1000;
+    uint64_t const rows = 3000;
+    uint64_t const valueBytes = storm::utility::memory::getValueBytes(false);
+    uint64_t const required =
+        storm::utility::memory::estimateSolverVectorBytes(storm::solver::MinMaxMethod::IntervalIteration, states, rows, valueBytes);
+
+    EXPECT_EQ(storm::solver::MinMaxMethod::IntervalIteration,
+              storm::utility::memory::selectMinMaxMethod(storm::solver::MinMaxMethod::IntervalIteration, states, rows, valueBytes, required));
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration,
+              storm::utility::memory::selectMinMaxMethod(storm::solver::MinMaxMethod::IntervalIteration, states, rows, valueBytes, required - 1));
+    // Value iteration is kept even if it does not fit, as there is nothing to fall back to.
+    EXPECT_EQ(storm::solver::MinMaxMethod::ValueIteration,
+              storm::utility::memory::selectMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration, states, rows, valueBytes, 0));
+}
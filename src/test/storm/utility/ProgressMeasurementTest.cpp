@@ -0,0 +1,72 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+
+TEST(ProgressMeasurementTest, Callback) {
+    std::vector<storm::utility::ProgressReport> reports;
+    storm::utility::setProgressCallback(
+        [&reports](storm::utility::ProgressReport const& report) {
+            reports.push_back(report);
+            return true;
+        },
+        std::chrono::milliseconds(0));
+    EXPECT_TRUE(storm::utility::hasProgressCallback());
+
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(100);
+    progress.startNewMeasurement(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    progress.setFrontierSize(7);
+    EXPECT_TRUE(progress.reportProgress(25));
+    storm::utility::clearProgressCallback();
+    EXPECT_FALSE(storm::utility::hasProgressCallback());
+    EXPECT_FALSE(progress.reportProgress(50));
+
+    ASSERT_EQ(1ull, reports.size());
+    EXPECT_EQ("states", reports.front().itemName);
+    EXPECT_EQ(25ull, reports.front().count);
+    EXPECT_EQ(100ull, reports.front().maxCount.value());
+    EXPECT_EQ(7ull, reports.front().frontierSize.value());
+    EXPECT_FALSE(reports.front().residual.has_value());
+    EXPECT_GT(reports.front().itemsPerSecond, 0.0);
+    // 75 remaining states at the current rate
+    ASSERT_TRUE(reports.front().estimatedSecondsRemaining.has_value());
+    EXPECT_NEAR(75.0 / reports.front().itemsPerSecond, reports.front().estimatedSecondsRemaining.value(), 1e-9);
+}
+
+TEST(ProgressMeasurementTest, ResidualAndCancellation) {
+    std::vector<storm::utility::ProgressReport> reports;
+    storm::utility::setProgressCallback(
+        [&reports](storm::utility::ProgressReport const& report) {
+            reports.push_back(report);
+            return reports.size() < 2;
+        },
+        std::chrono::milliseconds(0));
+
+    storm::utility::ProgressMeasurement progress("iterations");
+    progress.startNewMeasurement(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    storm::utility::publishResidual(1e-2, 1e-6);
+    EXPECT_TRUE(progress.reportProgress(10));
+    EXPECT_FALSE(storm::utility::resources::isTerminate());
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    storm::utility::publishResidual(1e-4, 1e-6);
+    EXPECT_TRUE(progress.reportProgress(20));
+    storm::utility::clearProgressCallback();
+
+    // The second report requested termination.
+    EXPECT_TRUE(storm::utility::resources::isTerminate());
+    storm::utility::resources::resetTimeoutAlarm();
+
+    ASSERT_EQ(2ull, reports.size());
+    EXPECT_FALSE(reports.front().estimatedSecondsRemaining.has_value());
+    EXPECT_EQ(1e-4, reports.back().residual.value());
+    EXPECT_EQ(1e-6, reports.back().targetResidual.value());
+    // The residual decreased by two orders of magnitude within 10 iterations, so 10 more iterations are needed.
+    ASSERT_TRUE(reports.back().estimatedSecondsRemaining.has_value());
+    EXPECT_NEAR(10.0 / reports.back().itemsPerSecond, reports.back().estimatedSecondsRemaining.value(), 1e-6);
+}
@@ -0,0 +1,89 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/stateelimination.h"
+
+namespace {
+// Creates a matrix whose transitions go in both directions between the given pairs of states.
+storm::storage::SparseMatrix<double> createSymmetricMatrix(uint64_t numberOfStates, std::vector<std::pair<uint64_t, uint64_t>> const& edges) {
+    std::vector<std::vector<uint64_t>> successors(numberOfStates);
+    for (auto const& edge : edges) {
+        successors[edge.first].push_back(edge.second);
+        successors[edge.second].push_back(edge.first);
+    }
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::sort(successors[state].begin(), successors[state].end());
+        for (auto successor : successors[state]) {
+            builder.addNextValue(state, successor, 1.0 / successors[state].size());
+        }
+    }
+    return builder.build();
+}
+
+bool isPermutation(std::vector<uint64_t> order, storm::storage::BitVector const& states) {
+    std::sort(order.begin(), order.end());
+    return order == std::vector<uint64_t>(states.begin(), states.end());
+}
+}  // namespace
+
+TEST(StateEliminationOrderTest, MinimumDegreeStar) {
+    // A star whose center is only eliminated when at most one leaf is left, as otherwise the remaining leaves become connected.
+    std::vector<std::pair<uint64_t, uint64_t>> edges;
+    for (uint64_t leaf = 1; leaf < 10; ++leaf) {
+        edges.emplace_back(0, leaf);
+    }
+    auto matrix = createSymmetricMatrix(10, edges);
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::storage::BitVector states(10, true);
+
+    auto order = storm::utility::stateelimination::computeApproximateMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    EXPECT_TRUE(isPermutation(order, states));
+    EXPECT_GE(std::find(order.begin(), order.end(), 0ull) - order.begin(), 8);
+
+    // Only the given states are ordered.
+    states.set(3, false);
+    order = storm::utility::stateelimination::computeApproximateMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    EXPECT_TRUE(isPermutation(order, states));
+}
+
+TEST(StateEliminationOrderTest, NestedDissectionPath) {
+    // The separator of a long path is a state in its middle, which is eliminated last.
+    std::vector<std::pair<uint64_t, uint64_t>> edges;
+    for (uint64_t state = 0; state + 1 < 200; ++state) {
+        edges.emplace_back(state, state + 1);
+    }
+    auto matrix = createSymmetricMatrix(200, edges);
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::storage::BitVector states(200, true);
+
+    auto order = storm::utility::stateelimination::computeNestedDissectionOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    EXPECT_TRUE(isPermutation(order, states));
+    EXPECT_TRUE(order.back() == 99 || order.back() == 100);
+}
+
+TEST(StateEliminationOrderTest, NestedDissectionSccs) {
+    // Two SCCs {0, 1} and {2, 3}, where the second one is reachable from the first one.
+    storm::storage::SparseMatrixBuilder<double> builder(4, 4);
+    builder.addNextValue(0, 1, 1.0);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.addNextValue(2, 3, 1.0);
+    builder.addNextValue(3, 2, 1.0);
+    auto matrix = builder.build();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::storage::BitVector states(4, true);
+
+    auto order = storm::utility::stateelimination::computeNestedDissectionOrder(flexibleMatrix, flexibleBackwardTransitions, states);
+    EXPECT_TRUE(isPermutation(order, states));
+    EXPECT_EQ(2ull, std::min(order[0], order[1]));
+    EXPECT_EQ(3ull, std::max(order[0], order[1]));
+}
@@ -0,0 +1,51 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/Telemetry.h"
+
+TEST(TelemetryTest, NestedScopes) {
+    storm::utility::telemetry::clear();
+    storm::utility::telemetry::setEnabled(true);
+    {
+        storm::utility::telemetry::Scope outer("outer");
+        storm::utility::telemetry::setAttribute("states", static_cast<uint64_t>(42));
+        {
+            storm::utility::telemetry::Scope inner("inner");
+            EXPECT_TRUE(storm::utility::telemetry::isRecording());
+            storm::utility::telemetry::setAttribute("method", std::string("ValueIteration"));
+            storm::utility::telemetry::appendToSeries("residual", 0.5);
+            storm::utility::telemetry::appendToSeries("residual", 0.25);
+        }
+    }
+    EXPECT_FALSE(storm::utility::telemetry::isRecording());
+    storm::utility::telemetry::setEnabled(false);
+    {
+        // Not recorded
+        storm::utility::telemetry::Scope ignored("ignored");
+        EXPECT_FALSE(storm::utility::telemetry::isRecording());
+    }
+
+    std::stringstream stream;
+    storm::utility::telemetry::exportJson(stream);
+    auto result = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(1ul, result["scopes"].size());
+    auto const& outer = result["scopes"][0];
+    EXPECT_EQ("outer", outer["name"].get<std::string>());
+    EXPECT_EQ(42ul, outer["attributes"]["states"].get<uint64_t>());
+    ASSERT_EQ(1ul, outer["scopes"].size());
+    auto const& inner = outer["scopes"][0];
+    EXPECT_EQ("inner", inner["name"].get<std::string>());
+    EXPECT_EQ("ValueIteration", inner["attributes"]["method"].get<std::string>());
+    ASSERT_EQ(2ul, inner["attributes"]["residual"].size());
+    EXPECT_EQ(0.25, inner["attributes"]["residual"][1].get<double>());
+    EXPECT_LE(inner["time-us"].get<uint64_t>(), outer["time-us"].get<uint64_t>());
+
+    std::stringstream traceStream;
+    storm::utility::telemetry::exportChromeTrace(traceStream);
+    auto trace = storm::json<double>::parse(traceStream.str());
+    ASSERT_EQ(2ul, trace["traceEvents"].size());
+    EXPECT_EQ("X", trace["traceEvents"][1]["ph"].get<std::string>());
+    EXPECT_EQ("inner", trace["traceEvents"][1]["name"].get<std::string>());
+    storm::utility::telemetry::clear();
+}